@@ -16,7 +16,7 @@ struct StereoDelayParameters : ParameterMenu {
         switch (section)
         {
         case 0: return 1
-        case 1: return 6
+        case 1: return 7
         default: fatalError("[StereoDelayParameters] Unknown section")
         }
     }
@@ -28,6 +28,7 @@ struct StereoDelayParameters : ParameterMenu {
         "Feedback",
         "Modulation",
         "Offset",
+        "Ping-Pong",
         "Mix"
     ]
     
@@ -39,6 +40,7 @@ struct StereoDelayParameters : ParameterMenu {
             (address: kDelayFeedback, increment: 0.01, type: .continuousSlow),
             (address: kDelayModulation, increment: 0.01, type: .continuousSlow),
             (address: kStereoDelayOffset, increment: 1.0, type: .continuousRegular),
+            (address: kStereoDelayPingPong, increment: 1.0, type: .discreteSlow),
             (address: kDelayMix, increment: 0.01, type: .continuousSlow)
         ]
     }
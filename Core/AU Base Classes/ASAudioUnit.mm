@@ -109,6 +109,7 @@
 - (void)deallocateRenderResources
 {
     [super deallocateRenderResources];
+    self.kernel->deinit();
 }
 
 - (BOOL)canProcessInPlace
@@ -26,6 +26,8 @@ public:
         this->sampleRate = sampleRate;
     }
 
+    virtual void deinit() {}
+
     virtual bool isPlaying() = 0;
     
     virtual bool isSetup()   { return isInitialized; }
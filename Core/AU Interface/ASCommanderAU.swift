@@ -323,6 +323,7 @@ public class ASCommanderAU : ASAudioUnit
         /// details from its `AudioComponentDescription`.
         
         get {
+            __interop__Flush(dsp)
             guard let coreState = collateCoreState() else { return nil }
             let presetState = super.fullStateForDocument
             return presetState?.merging(coreState) { a, b in b }
@@ -125,7 +125,8 @@ struct ASCommanderAUParameters
                                     ASCommanderAUParameters.stereoDelayTimeRight,
                                     ASCommanderAUParameters.stereoDelayMix,
                                     ASCommanderAUParameters.stereoDelayOffset,
-                                    ASCommanderAUParameters.stereoDelayModulation
+                                    ASCommanderAUParameters.stereoDelayModulation,
+                                    ASCommanderAUParameters.stereoDelayPingPong
         ])
     
     static public let parametersVibrato =
@@ -900,6 +901,21 @@ struct ASCommanderAUParameters
         return parameter
     }()
     
+    static var stereoDelayPingPong: AUParameter = {
+        let parameter =
+            AUParameterTree.createParameter(withIdentifier: "kStereoDelayPingPong",
+                                            name: "Stereo Delay Ping-Pong",
+                                            address: AUParameterAddress(kStereoDelayPingPong),
+                                            min: 0, max: 1,
+                                            unit: .indexed,
+                                            unitName: nil,
+                                            flags: [.flag_IsReadable, .flag_IsWritable],
+                                            valueStrings: [ "Off", "On" ],
+                                            dependentParameters: nil)
+        parameter.value = 0
+        return parameter
+    }()
+    
     // MARK: - Vibrato Parameters
     
     static var vibratoToggle: AUParameter = {
@@ -43,6 +43,10 @@ void __interop__LoadPatternState(ASDSPRef, const char* state, const int pattern)
 
 const char* __interop__GetPatternState(ASDSPRef, const int pattern);
 
+/// \brief Return once the core has performed every request that has been made of it, so that its state can be saved.
+
+void __interop__Flush(ASDSPRef);
+
 /// \brief Play or pause the sequencer by toggling the state of the clock
 
 const bool  __interop__PlayOrPause(ASDSPRef);
@@ -91,6 +95,10 @@ struct ASCommanderDSP : ASDSPBase, ASCommanderCore
     /// \param sampleRate The sample rate to use
 
     void init(int channelCount, double sampleRate) override;
+
+    /// \brief Detach the ASCommanderCore from the audio thread, which has stopped rendering
+
+    void deinit() override;
     
     /// \brief Indicate whether the underlying clock is ticking or not
 
@@ -12,6 +12,10 @@
 
 extern "C" void * makeASCommanderDSP(int channels, double sampleRate)
 {
+    NSURL *caches = [[NSFileManager defaultManager] URLsForDirectory:NSCachesDirectory inDomains:NSUserDomainMask].firstObject;
+    if (caches != nil)
+        WaveTableBuilder::setCachePath([caches URLByAppendingPathComponent:@"Wavetables.cache"].path.UTF8String);
+
     return new ASCommanderDSP();
 }
 
@@ -70,6 +74,11 @@ extern "C" const char* __interop__GetPatternState(void *DSP, const int pattern)
     return ((ASCommanderDSP*) DSP)->encodePatternState(pattern);
 }
 
+extern "C" void __interop__Flush(void *DSP)
+{
+    ((ASCommanderDSP*) DSP)->flush();
+}
+
 extern "C" void __interop__LoadPatternState(void *DSP, const char* state, const int pattern)
 {
     ((ASCommanderDSP*) DSP)->loadFromEncodedPatternState(state, pattern);
@@ -81,6 +90,12 @@ void ASCommanderDSP::init(int channels, double sampleRate)
 {
     ASDSPBase::init(channels, sampleRate);
     ASCommanderCore::init(sampleRate);
+    ASCommanderCore::attach(true);
+}
+
+void ASCommanderDSP::deinit()
+{
+    ASCommanderCore::attach(false);
 }
 
 bool ASCommanderDSP::isPlaying()
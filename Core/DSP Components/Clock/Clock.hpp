@@ -40,12 +40,15 @@ public:
         update();
     }
     
-    /// \brief Advance the clock by one sample.
+    /// \brief Advance the clock by the given number of samples.
+    /// \pre   `samples` must not exceed `samplesUntilTick()`, so that the clock ticks at most once,
+    /// and only on the last sample of the advance.
+    /// \param samples The number of samples to advance by.
     /// \return True if the clock ticked during the advance; False otherwise.
 
-    inline const bool advance()
+    inline const bool advance(const uint32_t samples = 1)
     {
-        if ((++time) >= tick)
+        if ((time += samples) >= tick)
         {
             time = 0;
             return true;
@@ -54,15 +57,29 @@ public:
         return false;
     }
 
+    /// \brief Return the number of samples until the next tick, where a value of 1
+    /// indicates that the clock will tick on the next call to `advance()`.
+    /// This allows the caller to render contiguous spans of samples between ticks.
+
+    inline const uint32_t samplesUntilTick() const
+    {
+        return time < tick ? tick - time : 1;
+    }
+
 public:
-    inline const bool isTicking()   { return ticking; }
-    inline const bool playOrPause() { return (ticking = !ticking); }
+    /// \brief Indicate whether the Clock is ticking. This may be called from any thread.
+
+    inline const bool isTicking() const { return ticking.load(std::memory_order_acquire); }
+
+    /// \brief Start or stop the Clock. This is called by the audio thread, which advances the Clock.
+
+    inline void setTicking(const bool status) { ticking.store(status, std::memory_order_release); }
 
 private:
     inline void update() { tick = sampleRate * 60 / bpm / subdivision; }
 
 private:
-    bool  ticking = false;
+    std::atomic<bool> ticking = {false};
     float sampleRate = 48000.F;
 
 private:
@@ -71,7 +88,7 @@ private:
     uint32_t tick;
     uint32_t time;
     
-friend class Delay;
+friend class MultiTapDelay;
 };
 
 #endif
@@ -3,6 +3,8 @@
 //  Copyright © 2020 David Spry. All rights reserved.
 
 #include "ASCommanderCore.hpp"
+#include <chrono>
+#include <thread>
 
 void ASCommanderCore::init(double sampleRate)
 {
@@ -18,29 +20,160 @@ void ASCommanderCore::init(double sampleRate)
         noise.setSampleRate(audioRate);
     }
 
-    for (size_t r = 0; r < 2; ++r)
+    delay.reserve();
+
+#ifndef BASE_RATE_DELAY
+    for (auto& oversampler : oversamplers)
+        oversampler.configure(OVERSAMPLING, OVERSAMPLING_STEEPNESS, OVERSAMPLING_ATTENUATION, BLOCK_SIZE);
+#endif
+
+    for (auto& channel : oversample)
+        channel.assign(BLOCK_SIZE * DELAY_OVERSAMPLING, 0.F);
+
+    path = Path::Oversampled;
+    fade = 0;
+    history.fill(0.F);
+
+#ifdef BASE_RATE_DELAY
+    latency = 0;
+#else
+    latency = std::min(static_cast<unsigned int>(oversamplers[0].latency()), static_cast<unsigned int>(history.size() - 1));
+#endif
+
+    __state__.reserve(2048);
+    printf("[ASCommanderCore] Initialising with sample rate %.0fHz\n", audioRate);
+}
+
+const bool ASCommanderCore::playOrPause()
+{
+    const bool status = !playing.load(std::memory_order_relaxed);
+    if (submit(Command::play(status)))
+        playing.store(status, std::memory_order_relaxed);
+
+    return playing.load(std::memory_order_relaxed);
+}
+
+void ASCommanderCore::copyPatternWithIndex(const int pattern)
+{
+    if (!Command::isPattern(pattern))
+        return;
+
+    /// The spare Pattern is allocated here, on the UI thread, so that the audio thread never allocates.
+    /// The copy itself is deferred so that it observes any writes that are still in the command queue.
+
+    sequencer.prepareCopiedPattern();
+    submit(Command::forPattern(Command::CopyPattern, pattern));
+}
+
+const bool ASCommanderCore::submit(const Command& command)
+{
+    if (!commands.push(command))
+        return false;
+
+    submitted = submitted + 1;
+
+    if (!attached.load(std::memory_order_acquire))
+        flush();
+
+    return true;
+}
+
+void ASCommanderCore::attach(const bool rendering)
+{
+    attached.store(rendering, std::memory_order_release);
+
+    if (!rendering)
+        flush();
+}
+
+void ASCommanderCore::flush()
+{
+    using namespace std::chrono;
+
+    const uint64_t target = submitted;
+    if (performed.load(std::memory_order_acquire) >= target)
+        return;
+
+    /// While the audio thread is rendering, it performs the queue at the beginning of its next call to `render`.
+
+    if (attached.load(std::memory_order_acquire))
     {
-        if (r < upsamplers.size()) delete upsamplers[r];
-        if (r < dnsamplers.size()) delete dnsamplers[r];
+        uint64_t calls = renders.load(std::memory_order_relaxed);
+        auto since = steady_clock::now();
+
+        while (performed.load(std::memory_order_acquire) < target)
+        {
+            std::this_thread::sleep_for(milliseconds(1));
+
+            const uint64_t latest = renders.load(std::memory_order_relaxed);
+            if (latest != calls)
+            {
+                calls = latest;
+                since = steady_clock::now();
+            }
+
+            else if (steady_clock::now() - since >= milliseconds(stall))
+                break;
+        }
     }
-    
-    upsamplers.clear();
-    dnsamplers.clear();
-    for (size_t r = 0; r < 2; ++r)
+
+    while (exclusive.exchange(true, std::memory_order_acquire))
+        std::this_thread::yield();
+
+    drain();
+    exclusive.store(false, std::memory_order_release);
+}
+
+void ASCommanderCore::drain()
+{
+    uint64_t count = 0;
+
+    Command command;
+    while (commands.pop(command))
     {
-        const auto capacity = 4096 * (int) OVERSAMPLING;
-        const auto destinationRate = sampleRate * (double) OVERSAMPLING;
-        upsamplers.push_back(new r8b::CDSPResampler24(sampleRate, destinationRate, capacity));
-        dnsamplers.push_back(new r8b::CDSPResampler24(destinationRate, sampleRate, capacity));
+        perform(command);
+        count = count + 1;
     }
 
-    __state__.reserve(2048);
-    printf("[ASCommanderCore] Initialising with sample rate %.0fHz\n", audioRate);
+    if (count > 0)
+        performed.store(performed.load(std::memory_order_relaxed) + count, std::memory_order_release);
 }
 
-const bool ASCommanderCore::playOrPause()
+void ASCommanderCore::perform(const Command& command)
 {
-    if (!clock.isTicking())
+    switch (command.type)
+    {
+        case Command::SetParameter:     return apply(command.parameter, command.value);
+        case Command::LoadNote:         return synthesiser.loadNote(command.note, command.shape);
+        case Command::WriteNote:        return sequencer.addOrModify(command.x, command.y, command.note, command.shape);
+        case Command::EraseNote:        return sequencer.erase(command.x, command.y);
+        case Command::CopyPattern:      return sequencer.copy(command.pattern);
+        case Command::PastePattern:     return sequencer.paste(command.pattern);
+        case Command::ClearPattern:     return sequencer.hardReset(command.pattern);
+        case Command::ClearAllPatterns: return sequencer.hardReset();
+        case Command::PlayOrPause:      return play(command.value > 0.F);
+        case Command::WritePatternNote:
+            return sequencer.addOrModifyToPattern(command.pattern, command.x, command.y, command.note, command.shape);
+
+        /// \brief Clear the given Pattern, then set its on-off state, as the first step of `loadFromEncodedPatternState`.
+
+        case Command::ResetPattern:
+        {
+            const bool status = command.value > 0.F;
+            sequencer.hardReset(command.pattern);
+            sequencer.activePatterns += static_cast<int>(status);
+            sequencer.patterns[command.pattern].set(status);
+            return;
+        }
+    }
+}
+
+void ASCommanderCore::play(const bool status)
+{
+    if (status == clock.isTicking())
+        return;
+
+    if (status)
     {
         clock.prepare();
         sequencer.prepare();
@@ -48,10 +181,10 @@ const bool ASCommanderCore::playOrPause()
     else
         sequencer.reset();
 
-    return clock.playOrPause();
+    clock.setTicking(status);
 }
 
-void ASCommanderCore::set(uint64_t parameter, const float value)
+void ASCommanderCore::apply(uint64_t parameter, const float value)
 {
     const int type = (int) parameter / (2 << 7);
 
@@ -99,6 +232,15 @@ void ASCommanderCore::set(uint64_t parameter, const float value)
 
 const float ASCommanderCore::get(uint64_t parameter)
 {
+    const auto request = pending.find(parameter);
+    if (request != pending.end())
+    {
+        if (request->second.second > performed.load(std::memory_order_acquire))
+            return request->second.first;
+
+        pending.erase(request);
+    }
+
     const int type = (int) parameter / (2 << 7);
 
     switch (type)
@@ -134,60 +276,204 @@ const float ASCommanderCore::get(uint64_t parameter)
 
 void ASCommanderCore::render(unsigned int channels, unsigned int sampleCount, float * output[])
 {
-    for (size_t t = 0; t < sampleCount; ++t)
+    /// If `flush` is performing the command queue on the UI thread, the core cannot be rendered without
+    /// waiting for it, so this call renders silence instead.
+
+    if (exclusive.exchange(true, std::memory_order_acquire))
+    {
+        for (unsigned int c = 0; c < channels; ++c)
+            std::fill(output[c], output[c] + sampleCount, 0.F);
+
+        return;
+    }
+
+    drain();
+    renders.fetch_add(1, std::memory_order_relaxed);
+
+    if (channels > 0)
+        stage(std::min(channels, 2U), sampleCount, output);
+
+    exclusive.store(false, std::memory_order_release);
+}
+
+void ASCommanderCore::stage(unsigned int channels, unsigned int sampleCount, float * output[])
+{
+    for (unsigned int t = 0, samples = 0; t < sampleCount; t += samples)
     {
-        if (clock.isTicking() && clock.advance())
+        /// Whole blocks are rendered directly into the output. The last block of a request that does not
+        /// end on a block boundary is rendered into `staged`, and the remainder is kept for the next request.
+
+        if (position == BLOCK_SIZE && sampleCount - t >= BLOCK_SIZE)
         {
-            const auto row = sequencer.nextRow();
-            std::vector<Note>::iterator notes = row.second;
-            for (size_t n = 0; n < row.first; ++n)
-            {
-                const auto note = *notes;
-                loadNote(note.note, note.shape);
-                std::advance(notes, 1);
-            }
+            samples = BLOCK_SIZE;
+            float* block[2] = { output[0] + t, output[channels - 1] + t };
+            renderBlock(channels, samples, block);
+            continue;
+        }
+
+        if (position == BLOCK_SIZE)
+        {
+            float* block[2] = { staged[0].data(), staged[1].data() };
+            renderBlock(2, BLOCK_SIZE, block);
+            position = 0;
         }
 
-        float sample = synthesiser.nextSample();
-        vibrato.process(sample);
-        buffer[t] = sample;
+        samples = std::min(sampleCount - t, static_cast<unsigned int>(BLOCK_SIZE) - position);
+
+        for (unsigned int c = 0; c < channels; ++c)
+            std::copy(staged[c].begin() + position, staged[c].begin() + position + samples, output[c] + t);
+
+        position = position + samples;
     }
+}
 
-    const int loversampled = upsamplers.at(0)->process(buffer.data(), sampleCount, oversample[0]);
-    const int roversampled = upsamplers.at(1)->process(buffer.data(), sampleCount, oversample[1]);
-    
-    for (size_t k = 0; k < loversampled; ++k)
+void ASCommanderCore::renderBlock(unsigned int channels, unsigned int sampleCount, float * output[])
+{
+    for (unsigned int t = 0, span = 0; t < sampleCount; t += span)
     {
-        float lsample = (float) oversample[0][k];
-        float rsample = (float) oversample[1][k];
-        delay.process(lsample, rsample);
-        oversample[0][k] = (double) lsample;
-        oversample[1][k] = (double) rsample;
+        span = advance(sampleCount - t);
+        synthesiser.process(&block[t], span);
+        vibrato.process(&block[t], span);
     }
-    
-    const int ldownsampled = dnsamplers.at(0)->process(&(oversample[0][0]), loversampled, downsample[0]);
-    const int rdownsampled = dnsamplers.at(1)->process(&(oversample[1][0]), roversampled, downsample[1]);
-    const size_t size = std::min(static_cast<int>(sampleCount), std::min(ldownsampled, rdownsampled));
 
-    for (size_t k = 0; k < size; ++k)
+    delay.adopt();
+
+    /// Switch to the direct path once the StereoDelay is silent, and back to the oversampled path as soon
+    /// as it is not. If the switch interrupts a crossfade, the new crossfade begins from the same mix.
+
+    const bool silent = delay.isSilent();
+    if (silent != (path == Path::Direct))
+    {
+        if (!silent && fade == 0)
+            resumeOversampling();
+
+        path = silent ? Path::Direct : Path::Oversampled;
+        fade = crossfade - fade;
+    }
+
+    processDirect(sampleCount);
+
+    if (path == Path::Oversampled || fade > 0)
+        processOversampled(sampleCount);
+
+    for (size_t k = 0; k < sampleCount; ++k)
     {
         const float whiteNoise = noise.nextSample();
+        const float previous = fade > 0 ? static_cast<float>(fade--) / crossfade : 0.F;
+
         for (size_t c = 0; c < channels; ++c)
-            output[c & 1][k] = whiteNoise + (float) downsample[c & 1][k];
+        {
+            float sample = direct[k];
+
+            if (path == Path::Oversampled)
+                sample = previous * sample + (1.F - previous) * oversample[c & 1][k];
+            else if (previous > 0.F)
+                sample = (1.F - previous) * sample + previous * oversample[c & 1][k];
+
+            output[c & 1][k] = whiteNoise + sample;
+        }
+    }
+}
+
+void ASCommanderCore::processOversampled(const unsigned int samples)
+{
+    float* const lchannel = oversample[0].data();
+    float* const rchannel = oversample[1].data();
+
+    /// The signal is mono until it reaches the StereoDelay, so it is upsampled once. The StereoDelay forks it
+    /// into the left channel, which is written in place, and the right channel. A StereoDelay that runs at the
+    /// base rate processes the block as it is.
+
+    std::copy(block.begin(), block.begin() + samples, lchannel);
+#ifdef BASE_RATE_DELAY
+    const int oversampled = static_cast<int>(samples);
+#else
+    const int oversampled = oversamplers[0].upsample(lchannel, samples);
+#endif
+
+    std::copy(lchannel, lchannel + oversampled, rchannel);
+    delay.process(lchannel, rchannel, oversampled);
+
+#ifndef BASE_RATE_DELAY
+    oversamplers[0].downsample(lchannel, oversampled);
+    oversamplers[1].downsample(rchannel, oversampled);
+#endif
+}
+
+void ASCommanderCore::processDirect(const unsigned int samples)
+{
+    const unsigned int mask = static_cast<unsigned int>(history.size() - 1);
+
+    for (unsigned int k = 0; k < samples; ++k)
+    {
+        history[historyHead & mask] = block[k];
+        direct[k] = history[(historyHead - latency) & mask];
+        historyHead = historyHead + 1;
+    }
+}
+
+void ASCommanderCore::resumeOversampling()
+{
+#ifndef BASE_RATE_DELAY
+    const unsigned int mask = static_cast<unsigned int>(history.size() - 1);
+
+    for (size_t c = 0; c < oversamplers.size(); ++c)
+    {
+        float* const samples = oversample[c].data();
+        for (unsigned int k = 0; k < warming; ++k)
+            samples[k] = history[(historyHead - warming + k) & mask];
+
+        oversamplers[c].reset();
+        const int oversampled = oversamplers[c].upsample(samples, warming);
+        oversamplers[c].downsample(samples, oversampled);
+    }
+#endif
+}
+
+const unsigned int ASCommanderCore::advance(unsigned int samples)
+{
+    samples = std::min(samples, static_cast<unsigned int>(BLOCK_SIZE));
+
+    if (!clock.isTicking())
+        return samples;
+
+    if (clock.samplesUntilTick() == 1)
+    {
+        clock.advance();
+        loadNextRow();
+        samples = std::min(samples, clock.samplesUntilTick());
+        clock.advance(samples - 1);
+        return samples;
+    }
+
+    samples = std::min(samples, clock.samplesUntilTick() - 1);
+    clock.advance(samples);
+    return samples;
+}
+
+void ASCommanderCore::loadNextRow()
+{
+    const auto row = sequencer.nextRow();
+    std::vector<Note>::iterator notes = row.second;
+    for (size_t n = 0; n < row.first; ++n)
+    {
+        const auto note = *notes;
+        synthesiser.loadNote(note.note, note.shape);
+        std::advance(notes, 1);
     }
 }
 
 void ASCommanderCore::loadFromEncodedPatternState(const char* state, const int pattern)
 {
-    sequencer.hardReset(pattern);
+    if (!Command::isPattern(pattern))
+        return;
 
     const char * note = strchr(state, '~');
 
     /// 1. Decode the Pattern's on-off state
 
     const bool status = static_cast<bool>(std::atoi(&state[0]));
-    sequencer.activePatterns += static_cast<int>(status);
-    sequencer.patterns.at(pattern).set(status);
+    submit(Command::forPattern(Command::ResetPattern, pattern, status));
 
     /// 2. Decode each encoded Note: "#<NumberOfAttributes><x><y><Note><Shape>"
 
@@ -198,7 +484,9 @@ void ASCommanderCore::loadFromEncodedPatternState(const char* state, const int p
         const int y     = static_cast<int>((char) *(state + index + 3) - 1);
         const int pitch = static_cast<int>((char) *(state + index + 4) - 1);
         const int shape = static_cast<int>((char) *(state + index + 5) - 1);
-        sequencer.addOrModifyToPattern(pattern, x, y, pitch, shape);
+        if (Command::isPosition(x, y) && Command::isPitch(pitch))
+            submit(Command::write(pattern, x, y, pitch, shape));
+
         note = strchr(note + 1, '~');
     }
 }
@@ -207,6 +495,8 @@ const char* ASCommanderCore::encodePatternState(const int pattern) noexcept(fals
 {
     if (pattern < 0 || pattern >= PATTERNS) throw "[ASCommanderCore] Invalid Pattern index";
 
+    flush();
+
     __state__.clear();
     __state__ += sequencer.patterns.at(pattern).isActive() ? '1' : '0';
     
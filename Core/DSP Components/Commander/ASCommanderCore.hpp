@@ -9,16 +9,29 @@
 
 #include "ASHeaders.h"
 #include "ASEffects.h"
+#include <unordered_map>
 #include "ASConstants.h"
 
 #include "WhiteNoisePeriodic.hpp"
 #include "Synthesiser.hpp"
 #include "Sequencer.hpp"
+#include "SPSCQueue.hpp"
+#include "Command.hpp"
 #include "Clock.hpp"
 
-#include "CDSPResampler.h"
+#include "Oversampler.hpp"
 
 /// \brief The interface to the Assemble core. This class coordinates propagates requests and pulls new samples from underlying DSP components.
+///
+/// Requests that mutate the state of the core, such as `set`, `writeNote`, `playOrPause`, and `pastePatternWithIndex`, are not
+/// performed immediately. They are pushed onto a wait-free queue of Commands by the UI thread, and the audio thread
+/// performs them in order at the beginning of each call to `render`. These requests must all be made from one thread.
+/// A request whose Pattern index, position, or MIDI note number is out of range is ignored, as described by `Command`.
+///
+/// Reads are consistent with the requests that precede them. While no audio thread is attached, as when the host
+/// has not allocated its render resources, each request is performed as soon as it is made. Otherwise, `get` returns
+/// the value of a parameter whose request is still in the queue, and `getNote` and `encodePatternState` wait for the
+/// audio thread to perform the queue with `flush`.
 
 class ASCommanderCore
 {
@@ -32,11 +45,24 @@ public:
     /// `output` is assumed to be initialised such that it can accommodate `sampleCount` samples for
     /// `channels` channels, and it expects them to be stored in an interleaved fashion.
     ///
+    /// Any number of samples can be requested. The core always renders whole blocks of `BLOCK_SIZE` samples,
+    /// and the samples of a block that exceed the request are returned by the next call, so the output does
+    /// not depend on how the host divides it between calls.
+    ///
     /// This callback is the engine that drives every component. It advances the Clock,
     /// advances the Sequencer, and loads the next row of Notes into the Synthesiser, which is
     /// subsequently polled for new samples. Finally, the samples are processed by any active
     /// global audio effects, such as filters, delay, and vibrato.
     ///
+    /// The Synthesiser and the Vibrato are rendered in contiguous spans of samples between the
+    /// Clock's ticks, so the Sequencer is only consulted at the edges of each span.
+    ///
+    /// While the StereoDelay is bypassed and its tail has decayed, the oversampled effects path is skipped,
+    /// and the output of the Synthesiser is delayed by the latency of the Oversamplers instead. The two
+    /// paths are crossfaded whenever the core switches between them.
+    ///
+    /// If `flush` is performing the command queue on another thread, the call renders silence rather than waiting.
+    ///
     /// \param channels The number of channels to be rendered.
     /// \param sampleCount The number of samples per channel to be rendered.
     /// \param output A pointer to an array of floats, the output buffer.
@@ -47,9 +73,10 @@ public:
     /// \param note The pitch of the note to load as a MIDI note number
     /// \param shape The index of the oscillator to use
 
-    void loadNote(const int note, const int shape)
+    inline void loadNote(const int note, const int shape)
     {
-        synthesiser.loadNote(note, shape);
+        if (Command::isPitch(note))
+            submit(Command::load(note, shape));
     }
     
     /// \brief Get the note at position (x, y) in the Sequencer's current Pattern,
@@ -62,6 +89,8 @@ public:
 
     void getNote(const int x, const int y, int* note, int* shape)
     {
+        flush();
+
         const Note* datum = sequencer.patterns.at(sequencer.pattern).pattern.at(x, y);
         
         if (datum == nullptr || datum->null)
@@ -77,30 +106,32 @@ public:
     /// \param note The pitch of the note to load as a MIDI note number
     /// \param shape The index of the oscillator to use
 
-    void writeNote(int x, int y, int note, int shape)
+    inline void writeNote(int x, int y, int note, int shape)
     {
-        sequencer.addOrModify(x, y, note, shape);
+        if (Command::isPosition(x, y) && Command::isPitch(note))
+            submit(Command::write(x, y, note, shape));
     }
     
     /// \brief Erase the contents of the sequencer at position (x, y)
     /// \param x The x-coordinate of the position on the sequencer that should be erased
     /// \param y The y-coordinate of the position on the sequencer that should be erased
 
-    void eraseNote(int x, int y)
+    inline void eraseNote(int x, int y)
     {
-        sequencer.erase(x, y);
+        if (Command::isPosition(x, y))
+            submit(Command::erase(x, y));
     }
 
-    /// \brief Toggle the state of the Clock, which drives the Sequencer.
-    /// \note  If the Clock is about to begin ticking, the Clock and the Sequencer need to prepare for playback.
-    /// Otherwise, the Sequencer should reset to its initial state for the current Pattern.
+    /// \brief Request that the Clock, which drives the Sequencer, be started if it was last requested to stop, or stopped
+    /// otherwise. The request is performed by the audio thread, as in `play`, like any other request.
+    /// \return The requested state of the Clock, which is `true` if it will be ticking.
 
     const bool playOrPause();
 
     /// \brief Copy the state of the Pattern with the given index.
     /// \param pattern The index of the Pattern to be copied.
 
-    inline void copyPatternWithIndex(const int pattern) { sequencer.copy(pattern); }
+    void copyPatternWithIndex(const int pattern);
     
     /// \brief Indicate whether a copied pattern state exists in the sequencer.
 
@@ -109,21 +140,29 @@ public:
     /// \brief Paste a previously copied pattern state into the pattern with the given index.
     /// \param pattern The index of the Pattern whose state should be replaced with the previously copied state.
 
-    inline void pastePatternWithIndex(const int pattern) { sequencer.paste(pattern); }
+    inline void pastePatternWithIndex(const int pattern)
+    {
+        if (Command::isPattern(pattern))
+            submit(Command::forPattern(Command::PastePattern, pattern));
+    }
     
     /// \brief Clear the state of the Sequencer, resetting each of its Patterns.
 
-    inline void clearAllPatterns() { sequencer.hardReset(); }
+    inline void clearAllPatterns() { submit(Command::forPattern(Command::ClearAllPatterns, 0)); }
     
     /// \brief Clear the state of the Pattern with the given index.
     /// \param pattern The index of the Pattern to be cleared.
 
-    inline void clearPatternWithIndex(const int pattern) { sequencer.hardReset(pattern); }
+    inline void clearPatternWithIndex(const int pattern)
+    {
+        if (Command::isPattern(pattern))
+            submit(Command::forPattern(Command::ClearPattern, pattern));
+    }
     
-    /// \brief Indicate whether or not the Clock is ticking.
+    /// \brief Indicate whether or not the Clock is ticking, or will be once the requests before this are performed.
     /// \return `true` if the Clock is ticking; `false` otherwise.
 
-    inline const bool clockIsTicking() { return clock.isTicking();  }
+    inline const bool clockIsTicking() { return playing.load(std::memory_order_relaxed); }
 
     /// \brief From an encoded Pattern state, decode the on-off state and each Note, and initialise
     /// the corresponding Pattern accordingly.
@@ -150,34 +189,250 @@ public:
 
     const char* encodePatternState(const int pattern) noexcept(false);
 
+    /// \brief Enable or disable rendering the Synthesiser's VoiceBanks in parallel on worker threads.
+    /// This should not be called from the audio thread.
+    /// \param enabled Whether the VoiceBanks should be rendered in parallel
+
+    inline void setParallelRendering(const bool enabled) { synthesiser.setParallel(enabled); }
+
+    /// \brief Select the vectorised nonlinearity of the Synthesiser's filters, or the exact scalar nonlinearity.
+    /// \param enabled Whether the vectorised nonlinearity should be used
+
+    inline void setVectorisedFilter(const bool enabled) { synthesiser.setVectorisedFilter(enabled); }
+
+    /// \brief Enable or disable crossfading the Synthesiser's wavetables between adjacent levels.
+    /// \param enabled Whether the wavetables should be crossfaded
+
+    inline void setCrossfade(const bool enabled) { synthesiser.setCrossfade(enabled); }
+
+    /// \brief Seed every pseudorandom generator in the core, including the phases and noise of the Synthesiser's
+    /// Voices and the phases of the effects' modulators, so that a render can be reproduced exactly. Without a seed,
+    /// each generator is seeded with a distinct value from `Assemble::Random::entropy`.
+    /// This must not be called while the audio thread is rendering.
+    /// \param seed The seed of the core
+
+    void seed(const uint64_t seed)
+    {
+        synthesiser.seed(Assemble::Random::split(seed, 0));
+        vibrato.seed(Assemble::Random::split(seed, 1));
+        delay.seed(Assemble::Random::split(seed, 2));
+        noise.seed(Assemble::Random::split(seed, 3));
+    }
+
     /// \brief Set a parameter value in one of the underlying components
     /// \param parameter The hexadecimal address of the parameter to be set
     /// \param value The value to be set for the given parameter
     
-    void set(uint64_t parameter, const float value);
+    inline void set(uint64_t parameter, const float value)
+    {
+        delay.prepare(parameter, value);
+
+        if (submit(Command::set(parameter, value)))
+            pending[parameter] = { value, submitted };
+    }
     
     /// \brief Return a parameter value. If the parameter does not exist, 0 will be returned.
+    /// If a request to set the parameter has not yet been performed, the requested value is returned.
+    /// This must be called from the thread that makes requests.
     /// \param parameter The hexadecimal address of the desired parameter.
     
     const float get(uint64_t parameter);
 
+    /// \brief Return once every request that has been made is performed. While an audio thread is attached,
+    /// this waits for it to perform the command queue, unless it has not rendered for `stall`, in which case the
+    /// queue is performed on the calling thread instead. This must be called from the thread that makes requests.
+
+    void flush();
+
+    /// \brief Indicate whether an audio thread is calling `render`. This is called by the DSP layer when the host
+    /// allocates or deallocates its render resources. While no audio thread is attached, each request is performed
+    /// immediately by the thread that makes it.
+    /// \param rendering Whether an audio thread is calling `render`
+
+    void attach(const bool rendering);
+
+    /// \brief Indicate whether the core is rendering through the oversampled effects path, including
+    /// while it crossfades to or from the direct path.
+
+    inline const bool isOversampling() const { return path == Path::Oversampled || fade > 0; }
+
+    /// \brief Return the number of Commands that are waiting to be performed by the audio thread.
+
+    inline const size_t commandQueueDepth() const { return commands.size(); }
+
+    /// \brief Return the number of Commands that have been dropped because the command queue was full.
+
+    inline const uint64_t droppedCommands() const { return commands.dropped(); }
+
+    /// \brief Free any buffers that the StereoDelay has given up, then return the number of bytes allocated for its buffers,
+    /// which are sized to its delay times. This should not be called from the audio thread.
+
+    inline const size_t delayMemory()
+    {
+        delay.collect();
+        return delay.bytes();
+    }
+
+private:
+    /// \brief Push the given Command onto the command queue, and perform it immediately if no audio thread is attached.
+    /// \return `true` if the Command was pushed; `false` if the queue was full and it was dropped.
+
+    const bool submit(const Command& command);
+
+    /// \brief Perform each Command in the command queue. This is called by the audio thread, or by `flush`, while `exclusive` is held.
+
+    void drain();
+
+    /// \brief Perform the given Command.
+    /// \param command The Command to be performed
+
+    void perform(const Command& command);
+
+    /// \brief Start or stop the Clock. If the Clock is about to begin ticking, the Clock and the Sequencer prepare for
+    /// playback. Otherwise, the Sequencer resets to its initial state for the current Pattern. This is called by the audio thread.
+    /// \param status Whether the Clock should be ticking
+
+    void play(const bool status);
+
+    /// \brief Set a parameter value in one of the underlying components
+    /// \param parameter The hexadecimal address of the parameter to be set
+    /// \param value The value to be set for the given parameter
+
+    void apply(uint64_t parameter, const float value);
+
+private:
+    /// \brief Render the requested samples into `output` in whole blocks, returning any samples staged by the previous call first.
+    /// \param channels The number of channels to be rendered, which is 1 or 2.
+    /// \param sampleCount The number of samples per channel to be rendered.
+    /// \param output A pointer to an array of floats, the output buffer.
+
+    void stage(unsigned int channels, unsigned int sampleCount, float * output[]);
+
+    /// \brief Render the next block of samples into `output`.
+    /// \param channels The number of channels to be rendered.
+    /// \param sampleCount The number of samples per channel to be rendered, which is `BLOCK_SIZE`.
+    /// \param output A pointer to an array of floats, the output buffer.
+
+    void renderBlock(unsigned int channels, unsigned int sampleCount, float * output[]);
+
+    /// \brief Advance the Clock through the next span of samples. If the Clock ticks at the
+    /// beginning of the span, the next row of Notes is loaded into the Synthesiser.
+    /// \param samples The maximum number of samples in the span
+    /// \return The number of samples in the span, which is at most `BLOCK_SIZE`. The Clock
+    /// never ticks after the first sample of a span.
+
+    const unsigned int advance(unsigned int samples);
+
+    /// \brief Advance the Sequencer and load the next row of Notes into the Synthesiser.
+
+    void loadNextRow();
+
+    /// \brief Upsample the block, process it with the StereoDelay, then downsample each channel in place in `oversample`.
+    /// If BASE_RATE_DELAY is defined, the block is processed at the base rate, without the Oversamplers.
+    /// \param samples The number of samples in the block
+
+    void processOversampled(const unsigned int samples);
+
+    /// \brief Write the block into the history, and write the block delayed by the latency of the
+    /// oversampled path into `direct`.
+    /// \param samples The number of samples in the block
+
+    void processDirect(const unsigned int samples);
+
+    /// \brief Reset the Oversamplers and pass the most recent samples of the history through them,
+    /// so that the oversampled path can resume without a discontinuity.
+
+    void resumeOversampling();
+
 private:
     Clock       clock = {100};
     Sequencer   sequencer;
     Synthesiser synthesiser;
     Vibrato     vibrato;
-    StereoDelay delay = {&clock};
+    StereoDelay delay = {&clock, DELAY_OVERSAMPLING};
     WhiteNoisePeriodic noise;
 
+private:
+    /// \brief The queue of Commands passed from the UI thread to the audio thread. A complete Pattern,
+    /// as loaded by `loadFromEncodedPatternState`, occupies at most `SEQUENCER_WIDTH * SEQUENCER_HEIGHT + 1` Commands.
+
+    SPSCQueue<Command, 4096> commands;
+
+    /// \brief The number of Commands that have been pushed by the UI thread, and the number that have been performed.
+
+    uint64_t submitted = 0;
+    std::atomic<uint64_t> performed = {0};
+
+    /// \brief The requested value of each parameter, and the number of Commands submitted up to and including its request.
+    /// The value is returned by `get` until the request is performed. This is only used by the UI thread.
+
+    std::unordered_map<uint64_t, std::pair<float, uint64_t>> pending;
+
+    /// \brief The requested state of the Clock, which is returned by `clockIsTicking`. This is only written by the UI thread.
+
+    std::atomic<bool> playing = {false};
+
+    /// \brief Whether an audio thread is attached, and whether a thread is draining the command queue or rendering.
+    /// `render` never waits for `exclusive`: if `flush` holds it, the call renders silence instead.
+
+    std::atomic<bool> attached  = {false};
+    std::atomic<bool> exclusive = {false};
+
+    /// \brief The number of calls to `render`, and the time in milliseconds for which `flush` waits for the next call before it
+    /// concludes that the audio thread has stalled, as when the host pauses without deallocating its render resources.
+
+    std::atomic<uint64_t> renders = {0};
+    constexpr static int stall = 100;
+
 private:
     float sampleRate;
     
-    std::vector<r8b::CDSPResampler*> upsamplers;
-    std::vector<r8b::CDSPResampler*> dnsamplers;
+    /// \brief The Oversamplers for the left and right channels. The mono output of the Synthesiser is
+    /// upsampled by the first Oversampler alone, and each channel is downsampled by its own Oversampler.
+    /// They are not used if BASE_RATE_DELAY is defined.
+
+    std::array<Oversampler, 2> oversamplers;
+
+    /// \brief The left and right channels of the oversampled signal, which diverge at the StereoDelay.
+    /// Each channel is upsampled and downsampled in place.
+
+    std::array<std::vector<float>, 2> oversample;
+
+    /// \brief A block rendered ahead of the host, and the position of its next sample to be returned.
+    /// A position of `BLOCK_SIZE` indicates that every sample in the block has been returned.
+
+    std::array<std::array<float, BLOCK_SIZE>, 2> staged;
+    unsigned int position = BLOCK_SIZE;
+
+    std::array<float, BLOCK_SIZE> block;
+    std::array<float, BLOCK_SIZE> direct;
+
+private:
+    /// \brief The paths through which the output of the Synthesiser can reach the output of the core.
+
+    enum class Path { Oversampled, Direct };
+
+    /// \brief The current path, and the number of samples that remain in the crossfade from the previous path.
+
+    Path path = Path::Oversampled;
+    int  fade = 0;
+
+    /// \brief The most recent samples of the Synthesiser's output, which delay the direct path by the
+    /// latency of the oversampled path, and which prepare the Oversamplers when the oversampled path resumes.
+    /// The Oversamplers delay their round trip by a whole number of samples, so the direct path needs no
+    /// fractional delay to be aligned with it. The residual between the paths is measured by asbench.
+
+    std::array<float, 64> history = {};
+    unsigned int historyHead = 0;
+    unsigned int latency = 0;
+
+    /// \brief The length of the crossfade between the paths in samples, and the number of samples of
+    /// history passed through the Oversamplers before the oversampled path resumes.
+
+    constexpr static int crossfade = 1024;
+    constexpr static int warming   = 48;
 
-    std::array<double, 4096>   buffer;
-    std::array<double*, 2> oversample;
-    std::array<double*, 2> downsample;
+    static_assert(BLOCK_SIZE >= warming, "The block must be able to hold the samples used to warm the Oversamplers.");
 
 private:
     /// \brief A flag to enable or disable periodic white noise in the audio output.
@@ -0,0 +1,135 @@
+//  Assemble
+//  ============================
+//  Copyright © 2020 David Spry. All rights reserved.
+
+#ifndef COMMAND_HPP
+#define COMMAND_HPP
+
+#include "ASHeaders.h"
+#include "ASConstants.h"
+#include "ASFrequencies.h"
+
+/// \brief A request to mutate the state of the core, which is passed from the UI thread to the audio thread
+/// by way of the core's command queue. Commands are small and trivially copyable, so that they can be stored
+/// by value in a fixed-capacity queue.
+///
+/// The Pattern index, the position, and the MIDI note number of a request are checked with `isPattern`, `isPosition`,
+/// and `isPitch` on the UI thread, and a request that fails is dropped before its Command is built. The audio thread
+/// therefore performs each Command without checking its indices, and nothing that it performs throws.
+
+struct Command
+{
+    enum Type : uint8_t
+    {
+        SetParameter,
+        LoadNote,
+        WriteNote,
+        EraseNote,
+        CopyPattern,
+        PastePattern,
+        ClearPattern,
+        ClearAllPatterns,
+        ResetPattern,
+        WritePatternNote,
+        PlayOrPause
+    };
+
+    Type     type;
+    uint8_t  pattern = 0;
+    uint8_t  note    = 0;
+    uint8_t  shape   = 0;
+    int8_t   x       = 0;
+    int8_t   y       = 0;
+    uint32_t parameter = 0;
+    float    value     = 0.F;
+
+    /// \brief Indicate whether the given index addresses one of the Sequencer's Patterns.
+
+    static constexpr bool isPattern(const int pattern) { return pattern >= 0 && pattern < PATTERNS; }
+
+    /// \brief Indicate whether the given position addresses a cell of a Pattern.
+
+    static constexpr bool isPosition(const int x, const int y)
+    {
+        return x >= 0 && x < SEQUENCER_WIDTH && y >= 0 && y < SEQUENCER_HEIGHT;
+    }
+
+    /// \brief Indicate whether the given MIDI note number has a frequency.
+
+    static constexpr bool isPitch(const int note) { return note >= 0 && note < static_cast<int>(frequencies.size()); }
+
+    /// \brief Set the value of the parameter with the given address.
+
+    static inline Command set(const uint64_t parameter, const float value)
+    {
+        Command command = {SetParameter};
+        command.parameter = static_cast<uint32_t>(parameter);
+        command.value = value;
+        return command;
+    }
+
+    /// \brief Load a note into the Synthesiser.
+
+    static inline Command load(const int note, const int shape)
+    {
+        Command command = {LoadNote};
+        command.note  = static_cast<uint8_t>(note);
+        command.shape = static_cast<uint8_t>(shape);
+        return command;
+    }
+
+    /// \brief Write a note to the current Pattern at position (x, y).
+
+    static inline Command write(const int x, const int y, const int note, const int shape)
+    {
+        Command command = load(note, shape);
+        command.type = WriteNote;
+        command.x = static_cast<int8_t>(x);
+        command.y = static_cast<int8_t>(y);
+        return command;
+    }
+
+    /// \brief Write a note to the given Pattern at position (x, y).
+
+    static inline Command write(const int pattern, const int x, const int y, const int note, const int shape)
+    {
+        Command command = write(x, y, note, shape);
+        command.type = WritePatternNote;
+        command.pattern = static_cast<uint8_t>(pattern);
+        return command;
+    }
+
+    /// \brief Erase the contents of the current Pattern at position (x, y).
+
+    static inline Command erase(const int x, const int y)
+    {
+        Command command = {EraseNote};
+        command.x = static_cast<int8_t>(x);
+        command.y = static_cast<int8_t>(y);
+        return command;
+    }
+
+    /// \brief Start or stop the Clock, which drives the Sequencer.
+    /// \param status Whether the Clock should be ticking after the command is performed.
+
+    static inline Command play(const bool status)
+    {
+        Command command = {PlayOrPause};
+        command.value = static_cast<float>(status);
+        return command;
+    }
+
+    /// \brief Perform an operation on the Pattern with the given index.
+    /// \param type One of `CopyPattern`, `PastePattern`, `ClearPattern`, or `ResetPattern`.
+    /// \param value The on-off state of the Pattern after a `ResetPattern` command.
+
+    static inline Command forPattern(const Type type, const int pattern, const bool value = false)
+    {
+        Command command = {type};
+        command.pattern = static_cast<uint8_t>(pattern);
+        command.value = static_cast<float>(value);
+        return command;
+    }
+};
+
+#endif
@@ -19,14 +19,17 @@ void AHREnvelope::set(float attack, float hold, float release)
     holdInSamples    = Assemble::Utilities::samples(hold,   sampleRate);
     releaseInSamples = Assemble::Utilities::samples(release,sampleRate);
 
+    attackReciprocal  = 1.0F / static_cast<float>(attackInSamples  + 1);
+    releaseReciprocal = 1.0F / static_cast<float>(releaseInSamples + 1);
+
     if ((mode == Mode::Attack  && !(time < attackInSamples)) ||
         (mode == Mode::Release && !(time < releaseInSamples)))
     {
-        time.store(computeReleaseInverse());
+        time = computeReleaseInverse();
         setMode(Mode::Release);
     }
     
-    shouldUpdate.store(false);
+    shouldUpdate = false;
 }
 
 void AHREnvelope::setSampleRate(float sampleRate)
@@ -44,7 +47,7 @@ void AHREnvelope::prepare()
     
     time = 0;
 
-    if (shouldUpdate.load() == true)
+    if (shouldUpdate)
         set(attackInMs, holdInMs, releaseInMs);
 
     if (amplitude > 0.0F)
@@ -67,7 +70,7 @@ const float AHREnvelope::get(uint64_t parameter)
 
 void AHREnvelope::set(uint64_t parameter, float value)
 {
-    shouldUpdate.store(true);
+    shouldUpdate = true;
 
     const int subtype = (int) parameter % 16;
     switch (subtype)
@@ -81,65 +84,111 @@ void AHREnvelope::set(uint64_t parameter, float value)
 
 const float AHREnvelope::nextSample()
 {
-    switch (mode)
+    float sample;
+    process(&sample, 1);
+    return sample;
+}
+
+void AHREnvelope::process(float* output, const int samples) noexcept
+{
+    int k = 0;
+    while (k < samples)
     {
-        case Attack:
+        const int remaining = samples - k;
+        switch (mode)
         {
-            amplitude = std::powf(computeAttack(time.load()), 3.0F);
-            mode = static_cast<Mode>(Mode::Attack + static_cast<int>(amplitude >= 1.0F));
-            break;
-        }
-            
-        case Hold:
-        {
-            if ((holdInSamples == 0) || (time - attackInSamples >= holdInSamples))
+            /// The attack phase ends on the sample whose amplitude is 1, which is the sample at which
+            /// `time == attackInSamples + 1`. Since the curve is computed with a reciprocal, that sample is set exactly.
+
+            case Attack:
             {
-                time = 0;
-                mode = static_cast<Mode>(Mode::Release);
-            }   else break;
-        }
+                const int end = attackInSamples + 1;
+                const int span = std::min(remaining, std::max(1, end - time + 1));
 
-        case Release:
-        {
-            if (time <= releaseInSamples)
-                amplitude = std::powf(computeRelease(time.load()), 3.0F);
-            
-            mode = static_cast<Mode>(Mode::Release + static_cast<int>(time == releaseInSamples) * 1);
-            mode = static_cast<Mode>(Mode::Release + static_cast<int>(time >  releaseInSamples) * 2);
-            break;
-        }
+                for (int s = 0; s < span; ++s)
+                    output[k + s] = computeAttack(time + s);
 
-        case Closed:
-        {
-            amplitude = 0.0F;
-            break;
-        }
+                time = time + span;
+                k = k + span;
 
-        /// The recovery phase is reserved for cases where the duration of the release phase has been decreased
-        /// such that releaseInSamples < time. This relationship produces a negative value for amplitude, which in
-        /// turn causes loud popping and clicking sounds for several seconds.
-        /// To avoid this, the recovery phase is entered manually when the envelope's properties are set, but only
-        /// in cases where the time > releaseInSamples. The recovery phase lasts for as long as it takes for the
-        /// amplitude to fade out linearly to zero, then the envelope will close.
+                if (time > end)
+                {
+                    if (time - 1 == end) output[k - 1] = 1.0F;
+                    mode = Mode::Hold;
+                }
 
-        case Recovery:
-        {
-            amplitude = Assemble::Utilities::bound(amplitude - 1E-4F, 0.F, 1.F);
-            mode = static_cast<Mode>(Mode::Recovery - static_cast<int>(amplitude == 0.0F));
-        }
+                amplitude = output[k - 1];
+                break;
+            }
 
-    }
-    
-    time++;
-    return amplitude;
-}
+            /// The hold phase ends when `time - attackInSamples` reaches `holdInSamples`, as an unsigned difference.
+            /// The release phase then begins on the same sample.
 
-const float AHREnvelope::computeAttack(uint time)
-{
-    return (float) time / (float) (attackInSamples + 1);
-}
-
-const float AHREnvelope::computeRelease(uint time)
-{
-    return 1.0F - ((float) time / (float) (releaseInSamples + 1));
+            case Hold:
+            {
+                const unsigned int elapsed = static_cast<unsigned int>(time) - static_cast<unsigned int>(attackInSamples);
+                const unsigned int duration = static_cast<unsigned int>(holdInSamples);
+                if (holdInSamples == 0 || elapsed >= duration)
+                {
+                    time = 0;
+                    mode = Mode::Release;
+                    break;
+                }
+
+                const int span = static_cast<int>(std::min<unsigned int>(remaining, duration - elapsed));
+                std::fill(output + k, output + k + span, amplitude);
+
+                time = time + span;
+                k = k + span;
+                break;
+            }
+
+            /// The release curve is computed until `time == releaseInSamples`. On the following sample,
+            /// the amplitude is held and the envelope enters the recovery phase.
+
+            case Release:
+            {
+                if (time > releaseInSamples)
+                {
+                    output[k++] = amplitude;
+                    time = time + 1;
+                    mode = Mode::Recovery;
+                    break;
+                }
+
+                const int span = std::min(remaining, releaseInSamples - time + 1);
+                for (int s = 0; s < span; ++s)
+                    output[k + s] = computeRelease(time + s);
+
+                time = time + span;
+                k = k + span;
+                amplitude = output[k - 1];
+                break;
+            }
+
+            case Closed:
+            {
+                amplitude = 0.0F;
+                std::fill(output + k, output + samples, 0.0F);
+                k = samples;
+                break;
+            }
+
+            /// The recovery phase is reserved for cases where the duration of the release phase has been decreased
+            /// such that releaseInSamples < time. This relationship produces a negative value for amplitude, which in
+            /// turn causes loud popping and clicking sounds for several seconds.
+            /// To avoid this, the recovery phase is entered manually when the envelope's properties are set, but only
+            /// in cases where the time > releaseInSamples. The recovery phase lasts for as long as it takes for the
+            /// amplitude to fade out linearly to zero, then the envelope will close.
+
+            case Recovery:
+            {
+                amplitude = Assemble::Utilities::bound(amplitude - 1E-4F, 0.F, 1.F);
+                mode = static_cast<Mode>(Mode::Recovery - static_cast<int>(amplitude == 0.0F));
+                output[k++] = amplitude;
+                time = time + 1;
+                break;
+            }
+        }
+    }
 }
@@ -14,6 +14,11 @@
 #include "ASUtilities.h"
 
 /// \brief An amplitude envelope with three phases whose durations are defined in milliseconds.
+///
+/// The attack and release phases are cubic curves. Each phase is rendered as a segment whose length is known
+/// when it begins, so that a whole block can be computed at once without calls to `pow`. The envelope is not
+/// thread-safe: its parameters are set from the audio thread, by way of the Commander's queue, and changes to
+/// its durations are held in a snapshot that takes effect when the envelope is next prepared.
 
 class AHREnvelope
 {
@@ -73,6 +78,12 @@ public:
 
     const float nextSample();
 
+    /// \brief Compute the next block of samples from the envelope.
+    /// \param output The buffer that should receive values in the range [0, 1]
+    /// \param samples The number of samples to compute
+
+    void process(float* output, const int samples) noexcept;
+
     /// \brief Get the parameter values of the AHREnvelope.
     /// Specifically, these are the attack, hold, and releaes times in milliseconds.
     /// \param parameter The hexadecimal address of the desired parameter
@@ -111,23 +122,35 @@ private:
 
     inline void setMode(Mode mode) { this->mode = mode; }
 
-    /// \brief Compute the attack function at the given time value
+    /// \brief Compute the attack function at the given time value, which is the cube of `time / (attackInSamples + 1)`.
     /// \param time The current time value in samples
-    
-    inline const float computeAttack(uint time);
-    
-    /// \brief Compute the release function at the given time value
+
+    inline const float computeAttack(const int time) const
+    {
+        const float x = static_cast<float>(time) * attackReciprocal;
+        return x * x * x;
+    }
+
+    /// \brief Compute the release function at the given time value, which is the cube of `1 - time / (releaseInSamples + 1)`.
     /// \param time The current time value in samples
-    
-    inline const float computeRelease(uint time);
+
+    inline const float computeRelease(const int time) const
+    {
+        const float x = 1.0F - static_cast<float>(time) * releaseReciprocal;
+        return x * x * x;
+    }
 
 private:
-    std::atomic<uint> time = {0};
-    std::atomic<bool> shouldUpdate = {false};
+    /// \brief The number of samples since the beginning of the current phase, or since the beginning of
+    /// the attack phase during the hold phase.
+
+    int  time = 0;
+    bool shouldUpdate = false;
 
 private:
     int  attackInMs, holdInMs, releaseInMs;
     int  attackInSamples, holdInSamples, releaseInSamples;
+    float attackReciprocal, releaseReciprocal;
 
 private:
     float amplitude  = 0.0F;
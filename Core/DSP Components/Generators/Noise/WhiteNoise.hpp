@@ -6,29 +6,38 @@
 #define WHITENOISE_HPP
 
 #include "ASHeaders.h"
-#include <random>
+#include "ASRandom.h"
 
-/// \brief A white noise generator
+/// \brief A white noise generator, whose samples are uniformly distributed in the range [-0.8, 0.8).
 
 class WhiteNoise
 {
 public:
-    WhiteNoise()
+    WhiteNoise() = default;
+    explicit WhiteNoise(const uint64_t seed) : random(seed) {}
+
+    const float nextSample()
     {
-        std::uniform_real_distribution<float>::param_type range(-0.8F, 0.8F);
-        distribution.param(range);
-        twister.seed(rd());
+        return random.uniform(-0.8F, 0.8F);
     }
 
-    const float nextSample()
+    /// \brief Compute the next block of samples.
+    /// \param output The buffer that should receive the samples
+    /// \param samples The number of samples to compute
+
+    void process(float* output, const int samples) noexcept
     {
-        return distribution(twister);
+        for (int k = 0; k < samples; ++k)
+            output[k] = random.uniform(-0.8F, 0.8F);
     }
 
+    /// \brief Seed the generator.
+    /// \param seed The seed of the generator
+
+    void seed(const uint64_t seed) { random.seed(seed); }
+
 private:
-    std::mt19937 twister;
-    std::random_device rd;
-    std::uniform_real_distribution<float> distribution;
+    Assemble::Random::Generator random;
 };
 
 #endif
@@ -39,6 +39,11 @@ public:
         if (this->sampleRate != sampleRate)
             this->sampleRate = sampleRate;
     }
+
+    /// \brief Seed the generator of the noise.
+    /// \param seed The seed of the generator
+
+    void seed(const uint64_t seed) { noise.seed(seed); }
     
     const float nextSample()
     {
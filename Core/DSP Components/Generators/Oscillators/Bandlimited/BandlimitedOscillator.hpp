@@ -10,10 +10,12 @@
 #include "WaveTable.hpp"
 
 /// \brief An oscillator that interpolates from a collection of bandlimited wavetables.
-/// \see   Wavetables are stored in `/Core/Utilities/Headers/Wavetables/`
+/// The wavetable is selected whenever the frequency changes. If crossfading is enabled, it is blended
+/// with the following wavetable, as in `WaveTableSelector`, so that a modulated pitch changes smoothly.
+/// \see   Wavetables are synthesised by `WaveTableBuilder`
 
 template <WaveTableType W>
-class BandlimitedOscillator : public Oscillator
+class BandlimitedOscillator final : public Oscillator
 {
 public:
     BandlimitedOscillator() { }
@@ -29,7 +31,31 @@ public:
     void load(const float frequency) override
     {
         Oscillator::load(frequency);
-        wavetable.select(frequency);
+        wavetable.select(selector, frequency);
+    }
+
+    /// \brief Update the frequency of the oscillator without randomising the phase, and select its wavetable
+    /// \param frequency The target frequency in Hz
+
+    void update(const float frequency) override
+    {
+        Oscillator::update(frequency);
+        wavetable.select(selector, frequency);
+    }
+
+    /// \brief Enable or disable crossfading the selected wavetable with the following wavetable
+    /// \param enabled Whether the wavetables should be crossfaded
+
+    inline void setCrossfade(const bool enabled) { crossfade = enabled; }
+
+    /// \brief Set the sample rate of the oscillator and tabulate its selection of wavetables for it.
+    /// The wavetable is selected for the new sample rate when the frequency is next loaded or updated.
+    /// \param sampleRate The sample rate of the oscillator
+
+    void setSampleRate(const float sampleRate) override
+    {
+        Oscillator::setSampleRate(sampleRate);
+        selector.setSampleRate(sampleRate);
     }
 
     /// \brief Compute the next sample using linear interpolation
@@ -38,7 +64,14 @@ public:
     {
         using namespace Assemble::Utilities;
         const float index  = static_cast<float>(wavetable.length()) * phase;
-        const float sample = hermite(index, wavetable.table(), wavetable.length());
+        float sample = hermite(index, wavetable.table(), wavetable.length()) * wavetable.scale();
+
+        if (crossfade)
+        {
+            const float next = hermite(static_cast<float>(wavetable.nextLength()) * phase, wavetable.nextTable(), wavetable.nextLength())
+                             * wavetable.nextScale();
+            sample = sample + (next - sample) * wavetable.blend();
+        }
 
         phase += translation;
         phase += static_cast<int>(phase >= 1.0F) * -1.0F;
@@ -46,8 +79,48 @@ public:
         return sample;
     }
 
+    /// \brief Compute the next block of samples using Hermite interpolation
+    /// \param output The buffer that should receive the samples
+    /// \param samples The number of samples to compute
+
+    inline void process(float* output, const int samples) noexcept override
+    {
+        using namespace Assemble::Utilities;
+        const int   length = wavetable.length();
+        const float scale  = wavetable.scale();
+        const WaveTableSample* table = wavetable.table();
+
+        if (crossfade)
+        {
+            const int   nextLength = wavetable.nextLength();
+            const float nextScale  = wavetable.nextScale();
+            const float blend      = wavetable.blend();
+            const WaveTableSample* nextTable = wavetable.nextTable();
+
+            for (int k = 0; k < samples; ++k)
+            {
+                const float sample = hermite(static_cast<float>(length) * phase, table, length) * scale;
+                const float next   = hermite(static_cast<float>(nextLength) * phase, nextTable, nextLength) * nextScale;
+                output[k] = sample + (next - sample) * blend;
+                phase += translation;
+                phase += static_cast<int>(phase >= 1.0F) * -1.0F;
+            }
+
+            return;
+        }
+
+        for (int k = 0; k < samples; ++k)
+        {
+            output[k] = hermite(static_cast<float>(length) * phase, table, length) * scale;
+            phase += translation;
+            phase += static_cast<int>(phase >= 1.0F) * -1.0F;
+        }
+    }
+
 private:
     WaveTable<W> wavetable;
+    WaveTableSelector selector = WaveTable<W>::selector(sampleRate);
+    bool crossfade = false;
 };
 
 #endif
@@ -0,0 +1,136 @@
+//  Assemble
+//  ============================
+//  Copyright © 2020 David Spry. All rights reserved.
+
+#ifndef FIXEDPOINTOSCILLATOR_HPP
+#define FIXEDPOINTOSCILLATOR_HPP
+
+#include "Oscillator.hpp"
+#include "ASUtilities.h"
+#include "WaveTable.hpp"
+
+/// \brief A bandlimited wavetable oscillator whose phase is a 32-bit fixed-point accumulator.
+///
+/// The phase wraps by integer overflow, so it neither drifts nor needs a comparison to wrap. The length of each
+/// wavetable is a power of two of at most 2^16 samples, so the index of a sample is the upper bits of the product
+/// of the phase and the length, and the fraction between samples is the lower bits of the same product. The
+/// wavetables are padded with guard samples, so they are interpolated without wrapping the indices.
+/// \see   `BandlimitedOscillator<W>`, which has a floating-point phase
+
+template <WaveTableType W>
+class FixedPointOscillator final : public Oscillator
+{
+public:
+    FixedPointOscillator() { }
+    FixedPointOscillator(const float frequency)
+    {
+        load(frequency);
+    }
+
+public:
+    /// \brief Set the frequency of the oscillator and randomise its phase
+    /// \param frequency The target frequency in Hz
+
+    void load(const float frequency) override
+    {
+        accumulator = random.next();
+        update(frequency);
+    }
+
+    /// \brief Update the frequency of the oscillator without randomising the phase, and select its wavetable
+    /// \param frequency The target frequency in Hz
+
+    void update(const float frequency) override
+    {
+        increment = Assemble::Utilities::increment(frequency, sampleRate);
+        wavetable.select(selector, frequency);
+    }
+
+    /// \brief Seed the generator that randomises the oscillator's phase, then randomise the phase.
+    /// \param seed The seed of the generator
+
+    void seed(const uint64_t seed) override
+    {
+        random.seed(seed);
+        accumulator = random.next();
+    }
+
+    /// \brief Set the sample rate of the oscillator and tabulate its selection of wavetables for it.
+    /// The wavetable is selected for the new sample rate when the frequency is next loaded or updated.
+    /// \param sampleRate The sample rate of the oscillator
+
+    void setSampleRate(const float sampleRate) override
+    {
+        Oscillator::setSampleRate(sampleRate);
+        selector.setSampleRate(sampleRate);
+    }
+
+    /// \brief Compute the next sample using Hermite interpolation
+
+    inline const float nextSample() noexcept override
+    {
+        const float sample = interpolate(accumulator, wavetable.table(), static_cast<uint32_t>(wavetable.length())) * wavetable.scale();
+        accumulator = accumulator + increment;
+        return sample;
+    }
+
+    /// \brief Compute the next sample at each of the given offsets from the oscillator's phase using Hermite interpolation,
+    /// then advance the phase once, as for several oscillators that share a frequency and differ only in phase.
+    /// \param offsets The offset of each sample from the phase of the oscillator, where 2^32 is one cycle
+    /// \param output The buffer that should receive the samples
+    /// \param count The number of offsets
+
+    inline void nextSamples(const uint32_t* offsets, float* output, const int count) noexcept
+    {
+        const uint32_t length = static_cast<uint32_t>(wavetable.length());
+        const float    scale  = wavetable.scale();
+        const WaveTableSample* table = wavetable.table();
+
+        for (int k = 0; k < count; ++k)
+            output[k] = interpolate(accumulator + offsets[k], table, length) * scale;
+
+        accumulator = accumulator + increment;
+    }
+
+    /// \brief Compute the next block of samples using Hermite interpolation
+    /// \param output The buffer that should receive the samples
+    /// \param samples The number of samples to compute
+
+    inline void process(float* output, const int samples) noexcept override
+    {
+        const uint32_t length = static_cast<uint32_t>(wavetable.length());
+        const float    scale  = wavetable.scale();
+        const WaveTableSample* table = wavetable.table();
+
+        uint32_t phase = accumulator;
+        for (int k = 0; k < samples; ++k)
+        {
+            output[k] = interpolate(phase, table, length) * scale;
+            phase = phase + increment;
+        }
+
+        accumulator = phase;
+    }
+
+    /// \brief Return the phase of the oscillator in cycles, in the range [0, 1).
+
+    const double position() const noexcept override { return accumulator * (1.0 / 4294967296.0); }
+
+private:
+    /// \brief Interpolate the given wavetable, whose length is a power of two, at the given phase, without its scale.
+
+    static inline const float interpolate(const uint32_t phase, const WaveTableSample* table, const uint32_t length) noexcept
+    {
+        const uint32_t index    = ((phase >> 16) * length) >> 16;
+        const float    fraction = static_cast<float>((phase * length) >> 8) * (1.0F / 16777216.0F);
+        return Assemble::Utilities::hermite(table, static_cast<int>(index), fraction);
+    }
+
+private:
+    WaveTable<W> wavetable;
+    WaveTableSelector selector = WaveTable<W>::selector(sampleRate);
+    uint32_t accumulator = 0;
+    uint32_t increment   = 0;
+};
+
+#endif
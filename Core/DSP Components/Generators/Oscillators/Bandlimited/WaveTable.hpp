@@ -5,69 +5,171 @@
 #ifndef WAVETABLETYPE_HPP
 #define WAVETABLETYPE_HPP
 
-#include "ASSawtoothTable.h"
-#include "ASTriangleTable.h"
-#include "ASSquareTable.h"
-#include "ASSineTable.h"
+#include "WaveTableBuilder.hpp"
 
-/// \brief A set of constants to be used for the purpose of constructing a
-/// bandlimited wavetable oscillator, as in `BandlimitedOscillator<WaveTableType>`
+/// \brief The level of a set of wavetables that should be used at each pitch, tabulated for one sample rate.
+///
+/// A level is safe at a given frequency if its highest harmonic lies below `limit` times the sample rate, so that
+/// any alias folds back above a third of the sample rate, as with the thresholds that were formerly tuned for 44.1kHz.
+/// The selected level is the safe level with the most harmonics. Towards the upper end of its range, it is crossfaded
+/// with the following level, whose weight reaches one where that level would be selected, so that a voice whose pitch
+/// is modulated passes between the levels without a discontinuity.
+///
+/// Pitches are indexed by the exponent and the leading bits of the mantissa of the frequency, so that `select` needs
+/// neither a logarithm nor a branch. Each index spans 1/32 of an octave, which is finer than a semitone, and every
+/// entry is computed at the upper edge of its span, so that no frequency within the span aliases.
 
-enum WaveTableType { SIN, SQR, TRI, SAW };
+class WaveTableSelector
+{
+    constexpr static int   octaves    = 16;
+    constexpr static int   resolution = 5;
+    constexpr static int   pitches    = octaves << resolution;
+    constexpr static float limit      = 2.0F / 3.0F;
+
+public:
+    /// \brief A level, the following level, and the weight of the following level.
 
-// ===================================================== //
-// =============== Template declaration ================ //
-// ===================================================== //
+    struct Selection
+    {
+        int   level;
+        int   next;
+        float blend;
+    };
+
+public:
+    WaveTableSelector(const WaveTableSet& set, const float sampleRate) : set(&set)
+    {
+        setSampleRate(sampleRate);
+    }
+
+    /// \brief Return the selection for the given frequency, which is clamped to the range [1Hz, 65536Hz).
+    /// \param frequency The frequency in Hz
+
+    inline const Selection& select(const float frequency) const noexcept
+    {
+        uint32_t bits;
+        std::memcpy(&bits, &frequency, sizeof(bits));
+
+        const int index = static_cast<int>(bits >> (23 - resolution)) - (127 << resolution);
+        return selections[std::clamp(index, 0, pitches - 1)];
+    }
+
+    /// \brief Tabulate the selection for each pitch at the given sample rate.
+    /// \param sampleRate The sample rate to set
+
+    void setSampleRate(const float sampleRate)
+    {
+        const int    levels  = set->levels();
+        const double ceiling = static_cast<double>(limit) * sampleRate;
+
+        /// The greatest frequency at which each level is safe. The level before the first is taken
+        /// to have twice as many harmonics as the first, so that the first level is crossfaded too.
+
+        auto threshold = [&] (const int level) {
+            const double harmonics = level < 0 ? 2.0 * set->harmonics(0) : set->harmonics(level);
+            return ceiling / std::max(1.0, harmonics);
+        };
+
+        for (int p = 0; p < pitches; ++p)
+        {
+            const int    octave    = p >> resolution;
+            const int    step      = p & ((1 << resolution) - 1);
+            const double frequency = std::ldexp(1.0 + (step + 1.0) / (1 << resolution), octave);
+
+            int level = 0;
+            while (level < levels - 1 && frequency > threshold(level))
+                level = level + 1;
+
+            Selection& selection = selections[p];
+            selection.level = level;
+            selection.next  = std::min(level + 1, levels - 1);
+            selection.blend = 0.0F;
+
+            if (selection.next != level)
+            {
+                const double lower = threshold(level - 1);
+                const double upper = threshold(level);
+                const double blend = std::log2(frequency / lower) / std::log2(upper / lower);
+                selection.blend = static_cast<float>(std::clamp(blend, 0.0, 1.0));
+            }
+        }
+    }
+
+private:
+    const WaveTableSet* set;
+    std::array<Selection, pitches> selections;
+};
 
 /// \brief A collection of bandlimited wavetables to be used with a BandlimitedOscillator.
+/// The wavetables are the standard set of the given type, which is synthesised by `WaveTableBuilder`.
+/// The length of the selected wavetable depends on the number of harmonics it contains.
+///
+/// The selected level is looked up from a `WaveTableSelector` that is tabulated for the sample rate of the
+/// oscillator. The selector is owned by the oscillator, or by the `VoiceEngine` whose Voices share it, so that
+/// instances at different sample rates select their levels independently. Only the set of wavetables is shared.
 
 template <WaveTableType W>
 struct WaveTable
 {
 public:
-    /// \brief Return the length of the wavetable.
-    
-    const int length();
-    
+    WaveTable() : set(&WaveTableBuilder::standard(W)) {}
+
+public:
+    /// \brief Return a selector of the wavetables that is tabulated for the given sample rate.
+    /// \param sampleRate The sample rate of the selector
+
+    static WaveTableSelector selector(const float sampleRate)
+    {
+        return WaveTableSelector(WaveTableBuilder::standard(W), sampleRate);
+    }
+
+    /// \brief Return the length of the selected wavetable, which is a power of two.
+
+    inline const int length() const { return set->length(selection.level); }
+
     /// \brief Return a pointer to the selected wavetable
-    
-    const float * table();
-    
-    /// \brief Select the wavetable with the greatest number of
-    /// overtones that won't produce aliasing at 44.1kHz.
 
-    void select(const float frequency)
+    inline const WaveTableSample * table() const { return set->table(selection.level); }
+
+    /// \brief Return the factor that converts the samples of the selected wavetable to their amplitudes.
+
+    inline const float scale() const { return set->scale(selection.level); }
+
+    /// \brief Return the length of the wavetable that follows the selected wavetable, which is a power of two.
+
+    inline const int nextLength() const { return set->length(selection.next); }
+
+    /// \brief Return a pointer to the wavetable that follows the selected wavetable,
+    /// which contains half as many harmonics, or the selected wavetable if it is the last.
+
+    inline const WaveTableSample * nextTable() const { return set->table(selection.next); }
+
+    /// \brief Return the factor that converts the samples of the following wavetable to their amplitudes.
+
+    inline const float nextScale() const { return set->scale(selection.next); }
+
+    /// \brief Return the weight of the following wavetable in a crossfade with the selected wavetable.
+
+    inline const float blend() const { return selection.blend; }
+
+    /// \brief Select the wavetable with the greatest number of overtones
+    /// that won't produce aliasing at the sample rate of the given selector.
+    /// \param selector A selector of this set of wavetables
+    /// \param frequency The frequency in Hz
+
+    inline void select(const WaveTableSelector& selector, const float frequency) noexcept
     {
-        if      (frequency > 10240.F) tableIndex = 9;
-        else if (frequency > 5120.F ) tableIndex = 8;
-        else if (frequency > 2560.F ) tableIndex = 7;
-        else if (frequency > 1280.F ) tableIndex = 6;
-        else if (frequency > 640.F  ) tableIndex = 5;
-        else if (frequency > 320.F  ) tableIndex = 4;
-        else if (frequency > 160.F  ) tableIndex = 3;
-        else if (frequency > 80.F   ) tableIndex = 2;
-        else if (frequency > 40.F   ) tableIndex = 1;
-        else                          tableIndex = 0;
+        selection = selector.select(frequency);
     }
 
 private:
-    /// \brief The currently selected wavetable index
+    /// \brief The set of wavetables
 
-    int tableIndex = 0;
-};
-
-// ===================================================== //
-// ============== Template implementation ============== //
-// ===================================================== //
+    const WaveTableSet* set;
 
-template <> inline const int WaveTable<SIN>::length() { return kSineTableLength;     }
-template <> inline const int WaveTable<SQR>::length() { return kSquareTableLength;   }
-template <> inline const int WaveTable<TRI>::length() { return kTriangleTableLength; }
-template <> inline const int WaveTable<SAW>::length() { return kSawtoothTableLength; }
+    /// \brief The current selection, which is the first level until a frequency is selected
 
-template <> inline const float * WaveTable<SIN>::table() { return &(wt_sine[0]);                 }
-template <> inline const float * WaveTable<SQR>::table() { return &(wt_square[tableIndex][0]);   }
-template <> inline const float * WaveTable<TRI>::table() { return &(wt_triangle[tableIndex][0]); }
-template <> inline const float * WaveTable<SAW>::table() { return &(wt_sawtooth[tableIndex][0]); }
+    WaveTableSelector::Selection selection = {0, 0, 0.0F};
+};
 
 #endif
@@ -0,0 +1,328 @@
+//  Assemble
+//  ============================
+//  Copyright © 2020 David Spry. All rights reserved.
+
+#include "WaveTableBuilder.hpp"
+#include "CDSPRealFFT.h"
+
+#include <mutex>
+#include <limits>
+
+namespace
+{
+    /// \brief The identifier and version of the cache file format. The version should be incremented
+    /// whenever the standard sets change, so that existing cache files are rebuilt.
+
+    constexpr char     cacheMagic[4] = {'A', 'S', 'W', 'T'};
+    constexpr uint32_t cacheVersion  = 3;
+
+    /// \brief The size of each sample in the cache file, which distinguishes compact sets from floating-point sets.
+
+    constexpr uint32_t cacheFormat = sizeof(WaveTableSample);
+
+    constexpr double tau = 6.283185307179586;
+
+    /// \brief Return the base-2 logarithm of the given power of two.
+
+    int bits(int length)
+    {
+        int result = 0;
+        while (length > 1) { length = length >> 1; result = result + 1; }
+        return result;
+    }
+}
+
+WaveTableSet WaveTableBuilder::build(const Spectrum& spectrum, const Layout& layout)
+{
+    WaveTableSet set;
+    std::vector<double> buffer;
+    double scale = 0.0;
+
+    for (int level = 0; level < layout.levels; ++level)
+    {
+        const int size = length(layout, level);
+        const int harmonics = std::min({layout.harmonics >> level, size / 2 - 1,
+                                        static_cast<int>(std::max(spectrum.cosine.size(), spectrum.sine.size())) - 1});
+
+        /// The harmonics are placed in the format of Ooura's `rdft`, whose inverse transform
+        /// computes the sum of each harmonic's cosine and sine components without scaling.
+
+        const int cosines = static_cast<int>(spectrum.cosine.size());
+        const int sines   = static_cast<int>(spectrum.sine.size());
+
+        buffer.assign(size, 0.0);
+        for (int h = 1; h <= harmonics; ++h)
+        {
+            buffer[2 * h + 0] = h < cosines ? spectrum.cosine[h] : 0.0;
+            buffer[2 * h + 1] = h < sines   ? spectrum.sine[h]   : 0.0;
+        }
+
+        r8b::CDSPRealFFTKeeper fft(bits(size));
+        fft->inverse(buffer.data());
+
+        /// Every level is scaled by the same factor, which normalises the peak of the first level,
+        /// so that the levels have the same loudness.
+
+        if (level == 0)
+        {
+            double peak = 0.0;
+            for (const double sample : buffer)
+                peak = std::max(peak, std::abs(sample));
+
+            scale = peak > 0.0 ? layout.peak / peak : 1.0;
+        }
+
+        /// A compact level is quantised so that its peak is the greatest value of `WaveTableSample`.
+
+        double quantum = 1.0;
+        if constexpr (WaveTableSet::compact)
+        {
+            double peak = 0.0;
+            for (const double sample : buffer)
+                peak = std::max(peak, std::abs(sample * scale));
+
+            quantum = peak > 0.0 ? peak / std::numeric_limits<WaveTableSample>::max() : 1.0;
+        }
+
+        auto quantise = [&] (const double sample) {
+            const double value = sample * scale / quantum;
+            if constexpr (WaveTableSet::compact) return static_cast<WaveTableSample>(std::round(value));
+            else return static_cast<WaveTableSample>(value);
+        };
+
+        for (int k = size - WaveTableSet::guardBefore; k < size; ++k)
+            set.samples.push_back(quantise(buffer[k]));
+
+        set.offsets.push_back(static_cast<int>(set.samples.size()));
+        set.lengths.push_back(size);
+        set.partials.push_back(harmonics);
+        set.scales.push_back(static_cast<float>(quantum));
+        for (const double sample : buffer)
+            set.samples.push_back(quantise(sample));
+
+        for (int k = 0; k < WaveTableSet::guardAfter; ++k)
+            set.samples.push_back(quantise(buffer[k]));
+    }
+
+    return set;
+}
+
+WaveTableSet WaveTableBuilder::build(const float* cycle, const int length, const Layout& layout)
+{
+    const int harmonics = std::min(layout.harmonics, (length - 1) / 2);
+
+    Spectrum spectrum;
+    spectrum.cosine.assign(harmonics + 1, 0.0);
+    spectrum.sine  .assign(harmonics + 1, 0.0);
+
+    /// The spectrum of a cycle whose length is a power of two is computed with the FFT.
+    /// Otherwise, each harmonic is computed directly.
+
+    if (length >= 4 && (length & (length - 1)) == 0)
+    {
+        std::vector<double> buffer(cycle, cycle + length);
+        r8b::CDSPRealFFTKeeper fft(bits(length));
+        fft->forward(buffer.data());
+
+        for (int h = 1; h <= harmonics; ++h)
+        {
+            spectrum.cosine[h] = 2.0 * buffer[2 * h + 0] / length;
+            spectrum.sine  [h] = 2.0 * buffer[2 * h + 1] / length;
+        }
+    }
+
+    else
+    {
+        for (int h = 1; h <= harmonics; ++h)
+        {
+            double cosine = 0.0, sine = 0.0;
+            for (int k = 0; k < length; ++k)
+            {
+                const double angle = tau * static_cast<double>(h) * k / length;
+                cosine = cosine + cycle[k] * std::cos(angle);
+                sine   = sine   + cycle[k] * std::sin(angle);
+            }
+
+            spectrum.cosine[h] = 2.0 * cosine / length;
+            spectrum.sine  [h] = 2.0 * sine   / length;
+        }
+    }
+
+    return build(spectrum, layout);
+}
+
+WaveTableSet WaveTableBuilder::build(const WaveTableType type)
+{
+    const Layout layout = standardLayout(type);
+
+    Spectrum spectrum;
+    spectrum.sine.assign(layout.harmonics + 1, 0.0);
+
+    for (int h = 1; h <= layout.harmonics; ++h)
+    {
+        const double harmonic = static_cast<double>(h);
+        switch (type)
+        {
+            case SIN: spectrum.sine[h] = 1.0; break;
+            case SAW: spectrum.sine[h] = -1.0 / harmonic; break;
+            case SQR: spectrum.sine[h] = (h & 1) ? 1.0 / harmonic : 0.0; break;
+            case TRI: spectrum.sine[h] = (h & 1) ? (h % 4 == 1 ? -1.0 : 1.0) / (harmonic * harmonic) : 0.0; break;
+        }
+    }
+
+    return build(spectrum, layout);
+}
+
+const WaveTableSet& WaveTableBuilder::standard(const WaveTableType type)
+{
+    static std::array<WaveTableSet, 4> sets;
+    static std::array<std::once_flag, 4> loaded;
+
+    /// Each set is loaded when it is first used, so that a build that uses only some of the sets holds only those.
+    /// If the cache file is missing or out of date, every set is synthesised once to rewrite it.
+
+    std::call_once(loaded[type], [type] {
+        if (cachePath.empty())
+        {
+            sets[type] = build(type);
+            return;
+        }
+
+        if (read(cachePath, type, sets[type]))
+            return;
+
+        std::array<WaveTableSet, 4> built;
+        for (const WaveTableType other : {SIN, SQR, TRI, SAW})
+            built[other] = build(other);
+
+        write(cachePath, built);
+        sets[type] = std::move(built[type]);
+    });
+
+    return sets[type];
+}
+
+void WaveTableBuilder::setCachePath(const std::string& path)
+{
+    cachePath = path;
+}
+
+const WaveTableBuilder::Layout WaveTableBuilder::standardLayout(const WaveTableType type)
+{
+    Layout layout;
+    if (type == SIN)
+    {
+        layout.levels = 1;
+        layout.harmonics = 1;
+        layout.minimumLength = 512;
+        layout.maximumLength = 512;
+        layout.peak = 1.0;
+    }
+
+    return layout;
+}
+
+const int WaveTableBuilder::length(const Layout& layout, const int level)
+{
+    const int harmonics = std::max(1, layout.harmonics >> level);
+
+    int size = layout.minimumLength;
+    while (size < layout.oversampling * harmonics && size < layout.maximumLength)
+        size = size << 1;
+
+    return size;
+}
+
+/// The cache file begins with `cacheMagic`, `cacheVersion`, `cacheFormat`, and the number of samples in each set. Each set
+/// follows as the length of each level, the scale of each level, and the samples of each level, including its guard samples.
+
+bool WaveTableBuilder::read(const std::string& path, const WaveTableType type, WaveTableSet& set)
+{
+    std::FILE* file = std::fopen(path.c_str(), "rb");
+    if (file == nullptr) return false;
+
+    char magic[4];
+    uint32_t version = 0;
+    uint32_t format  = 0;
+    std::array<uint32_t, 4> sizes;
+
+    bool valid = std::fread(magic, 1, 4, file) == 4
+              && std::memcmp(magic, cacheMagic, 4) == 0
+              && std::fread(&version, sizeof(version), 1, file) == 1
+              && version == cacheVersion
+              && std::fread(&format, sizeof(format), 1, file) == 1
+              && format == cacheFormat
+              && std::fread(sizes.data(), sizeof(uint32_t), 4, file) == 4;
+
+    /// The sets that precede the given set are skipped.
+
+    for (int other = 0; valid && other < type; ++other)
+    {
+        const long levels = standardLayout(static_cast<WaveTableType>(other)).levels;
+        const long skip = levels * (sizeof(int) + sizeof(float)) + sizes[other] * sizeof(WaveTableSample);
+        valid = std::fseek(file, skip, SEEK_CUR) == 0;
+    }
+
+    if (valid)
+    {
+        const Layout layout = standardLayout(type);
+        set.lengths.resize(layout.levels);
+        set.offsets.resize(layout.levels);
+        set.partials.resize(layout.levels);
+        set.scales.resize(layout.levels);
+
+        valid = std::fread(set.lengths.data(), sizeof(int), layout.levels, file) == static_cast<size_t>(layout.levels)
+             && std::fread(set.scales.data(), sizeof(float), layout.levels, file) == static_cast<size_t>(layout.levels);
+
+        int offset = 0;
+        for (int level = 0; valid && level < layout.levels; ++level)
+        {
+            valid = set.lengths[level] == length(layout, level);
+            set.offsets[level] = offset + WaveTableSet::guardBefore;
+            set.partials[level] = std::min(layout.harmonics >> level, set.lengths[level] / 2 - 1);
+            offset = offset + WaveTableSet::guardBefore + set.lengths[level] + WaveTableSet::guardAfter;
+        }
+
+        valid = valid && sizes[type] == static_cast<uint32_t>(offset);
+        if (valid)
+        {
+            set.samples.resize(offset);
+            valid = std::fread(set.samples.data(), sizeof(WaveTableSample), offset, file) == static_cast<size_t>(offset);
+        }
+    }
+
+    std::fclose(file);
+    return valid;
+}
+
+bool WaveTableBuilder::write(const std::string& path, const std::array<WaveTableSet, 4>& sets)
+{
+    /// The file is written under a temporary name, then renamed,
+    /// so that a partially written file is never read.
+
+    const std::string temporary = path + ".tmp";
+    std::FILE* file = std::fopen(temporary.c_str(), "wb");
+    if (file == nullptr) return false;
+
+    std::array<uint32_t, 4> sizes;
+    for (int k = 0; k < 4; ++k)
+        sizes[k] = static_cast<uint32_t>(sets[k].samples.size());
+
+    bool valid = std::fwrite(cacheMagic, 1, 4, file) == 4
+              && std::fwrite(&cacheVersion, sizeof(cacheVersion), 1, file) == 1
+              && std::fwrite(&cacheFormat, sizeof(cacheFormat), 1, file) == 1
+              && std::fwrite(sizes.data(), sizeof(uint32_t), 4, file) == 4;
+
+    for (const WaveTableSet& set : sets)
+    {
+        valid = valid && std::fwrite(set.lengths.data(), sizeof(int), set.lengths.size(), file) == set.lengths.size();
+        valid = valid && std::fwrite(set.scales.data(), sizeof(float), set.scales.size(), file) == set.scales.size();
+        valid = valid && std::fwrite(set.samples.data(), sizeof(WaveTableSample), set.samples.size(), file) == set.samples.size();
+    }
+
+    valid = std::fclose(file) == 0 && valid;
+    valid = valid && std::rename(temporary.c_str(), path.c_str()) == 0;
+
+    if (!valid) std::remove(temporary.c_str());
+    return valid;
+}
@@ -0,0 +1,183 @@
+//  Assemble
+//  ============================
+//  Copyright © 2020 David Spry. All rights reserved.
+
+#ifndef WAVETABLEBUILDER_HPP
+#define WAVETABLEBUILDER_HPP
+
+#include "ASHeaders.h"
+
+#include <cstdint>
+#include <type_traits>
+
+/// \brief A set of constants to be used for the purpose of constructing a
+/// bandlimited wavetable oscillator, as in `BandlimitedOscillator<WaveTableType>`
+
+enum WaveTableType { SIN, SQR, TRI, SAW };
+
+/// \brief The type of the samples of a wavetable, which are 16-bit integers if COMPACT_WAVETABLES is defined.
+
+#ifdef COMPACT_WAVETABLES
+using WaveTableSample = int16_t;
+#else
+using WaveTableSample = float;
+#endif
+
+/// \brief The bandlimited mip levels of one waveform, from the level with the most harmonics to the level with the fewest.
+/// Each level is a single cycle whose length is a power of two, and levels with fewer harmonics may be shorter.
+///
+/// Each level is preceded by `guardBefore` guard samples, which copy the end of the cycle, and followed by `guardAfter`
+/// guard samples, which copy its beginning, so that four-point interpolation can read `table(level)[index - 1]` to
+/// `table(level)[index + 2]` for any index in the cycle without wrapping.
+///
+/// If the samples are integers, each level is quantised to the full range of `WaveTableSample` and its samples should
+/// be multiplied by `scale(level)`. Interpolation is linear in the samples, so the scale can be applied to its result.
+
+class WaveTableSet
+{
+public:
+    constexpr static int guardBefore = 1;
+    constexpr static int guardAfter  = 2;
+    constexpr static bool compact    = std::is_integral_v<WaveTableSample>;
+
+public:
+    /// \brief Return the number of levels in the set.
+
+    inline const int levels() const { return static_cast<int>(lengths.size()); }
+
+    /// \brief Return the length of the given level.
+    /// \param level The index of the level
+
+    inline const int length(const int level) const { return lengths[level]; }
+
+    /// \brief Return a pointer to the first sample of the given level.
+    /// \param level The index of the level
+
+    inline const WaveTableSample * table(const int level) const { return samples.data() + offsets[level]; }
+
+    /// \brief Return the factor that converts the samples of the given level to their amplitudes, which is 1 unless the set is compact.
+    /// \param level The index of the level
+
+    inline const float scale(const int level) const { return scales[level]; }
+
+    /// \brief Return the number of harmonics in the given level.
+    /// \param level The index of the level
+
+    inline const int harmonics(const int level) const { return partials[level]; }
+
+    /// \brief Return the number of bytes occupied by the samples of every level, including the guard samples.
+
+    inline const size_t bytes() const { return samples.size() * sizeof(WaveTableSample); }
+
+private:
+    friend class WaveTableBuilder;
+
+    std::vector<WaveTableSample> samples;
+    std::vector<float> scales;
+    std::vector<int>   offsets;
+    std::vector<int>   lengths;
+    std::vector<int>   partials;
+};
+
+/// \brief Synthesise sets of bandlimited wavetables with the inverse FFT of r8brain's `CDSPRealFFT`.
+///
+/// A waveform is described either by its harmonic spectrum or by a single cycle of samples, whose spectrum is computed.
+/// The first level of a set contains `Layout::harmonics` harmonics, and each following level contains half as many
+/// as the one before, so that the levels are an octave apart. Each level is as short as possible, such that its highest
+/// harmonic spans at least `Layout::oversampling` samples, within the bounds of `Layout::minimumLength` and
+/// `Layout::maximumLength`. The highest harmonics of the levels with few harmonics are then interpolated as accurately
+/// as the highest harmonics of the first level, while those levels are much shorter.
+///
+/// Each standard set used by `WaveTable<W>` is synthesised once per process, when it is first used. If a cache path
+/// has been given, it is read from the cache file instead, and every set is written to it if it is missing or out of date.
+
+class WaveTableBuilder
+{
+public:
+    /// \brief The shape of a set of wavetables.
+
+    struct Layout
+    {
+        /// \brief The number of levels in the set.
+
+        int levels = 10;
+
+        /// \brief The number of harmonics in the first level.
+
+        int harmonics = 735;
+
+        /// \brief The least number of samples that a cycle of the highest harmonic of each level should span.
+
+        int oversampling = 8;
+
+        /// \brief The least and greatest length of any level, which must be powers of two.
+
+        int minimumLength = 256;
+        int maximumLength = 4096;
+
+        /// \brief The peak amplitude of the first level. The other levels are scaled by the same factor.
+
+        double peak = 0.999;
+    };
+
+    /// \brief The amplitudes of the cosine and sine components of each harmonic of a waveform.
+    /// The element at index 0 of each vector, which is the DC offset, is ignored.
+
+    struct Spectrum
+    {
+        std::vector<double> cosine;
+        std::vector<double> sine;
+    };
+
+public:
+    /// \brief Synthesise a set of wavetables from the given harmonic spectrum.
+    /// \param spectrum The harmonic spectrum of the waveform
+    /// \param layout The shape of the set
+
+    static WaveTableSet build(const Spectrum& spectrum, const Layout& layout);
+
+    /// \brief Synthesise a set of wavetables from a single cycle of an arbitrary waveform.
+    /// \param cycle The samples of one cycle of the waveform
+    /// \param length The number of samples in the cycle, which need not be a power of two
+    /// \param layout The shape of the set
+
+    static WaveTableSet build(const float* cycle, const int length, const Layout& layout);
+
+    /// \brief Synthesise the standard set of wavetables of the given type.
+    /// \param type The type of the waveform
+
+    static WaveTableSet build(const WaveTableType type);
+
+    /// \brief Return the standard set of wavetables of the given type, which is shared by every `WaveTable<W>`.
+    /// Each standard set is loaded or synthesised on its first call, which should not be on the audio thread.
+    /// \param type The type of the waveform
+
+    static const WaveTableSet& standard(const WaveTableType type);
+
+    /// \brief Set the path of the file that caches the standard sets. This has no effect after they have been loaded.
+    /// \param path The path of the cache file, or an empty string if the sets should not be cached
+
+    static void setCachePath(const std::string& path);
+
+private:
+    /// \brief Return the layout of the standard set of the given type.
+
+    static const Layout standardLayout(const WaveTableType type);
+
+    /// \brief Return the length of the given level of a set with the given layout.
+
+    static const int length(const Layout& layout, const int level);
+
+    /// \brief Read the standard set of the given type from the cache file, or return `false` if it is missing or out of date.
+
+    static bool read(const std::string& path, const WaveTableType type, WaveTableSet& set);
+
+    /// \brief Write the standard sets to the cache file, or return `false` if it cannot be written.
+
+    static bool write(const std::string& path, const std::array<WaveTableSet, 4>& sets);
+
+private:
+    static inline std::string cachePath;
+};
+
+#endif
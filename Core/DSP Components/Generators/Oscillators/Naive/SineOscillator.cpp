@@ -11,7 +11,7 @@ SineOscillator::SineOscillator(const float frequency)
 
 void SineOscillator::load(const float frequency)
 {
-    phase = distribution(twister);
+    phase = random.uniform();
     translation = TWO_PI * frequency / sampleRate;
 }
 
@@ -20,5 +20,5 @@ inline const float SineOscillator::nextSample() noexcept
     phase += translation;
     phase += static_cast<int>(phase >= TWO_PI) * -TWO_PI;
 
-    return std::sinf(phase);
+    return std::sin(phase);
 }
@@ -12,7 +12,7 @@
 /// \author This oscillator is based on an oscillator written by Rob Clifton Harvey.
 /// <https://github.com/rcliftonharvey/rchoscillators/>
 /// \note ASConstants.h is required to access the TWO_PI constant.
-/// \note The C++ Numeric module is required to access std::sinf
+/// \note The C++ Numeric module is required to access std::sin
 
 class SineOscillator : public Oscillator
 {
@@ -5,28 +5,33 @@
 #ifndef OSCILLATOR_HPP
 #define OSCILLATOR_HPP
 
-#include <random>
+#include "ASRandom.h"
 
 class Oscillator
 {
 public:
-    /// \brief Initialise an Oscillator capable of randomising its phase within the range [0, 1].
-    
-    Oscillator()
-    {
-        std::uniform_real_distribution<float>::param_type range(0.F, 1.F);
-        distribution.param(range);
-        twister.seed(rd());
-    }
+    /// \brief Initialise an Oscillator capable of randomising its phase within the range [0, 1).
+
+    Oscillator() = default;
 
     /// \brief Compute the next sample.
 
     virtual inline const float nextSample() noexcept = 0;
 
+    /// \brief Compute the next block of samples.
+    /// \param output The buffer that should receive the samples
+    /// \param samples The number of samples to compute
+
+    virtual void process(float* output, const int samples) noexcept
+    {
+        for (int k = 0; k < samples; ++k)
+            output[k] = nextSample();
+    }
+
     /// \brief Begin oscillating at a new frequency.
     /// The phase is randomised whenever it is initialised to a new frequency
     /// in order to simulate an always-running analog oscillator. The randomisation
-    /// step takes about 400 nanoseconds to compute, which is likely preferable
+    /// step takes a few nanoseconds to compute, which is likely preferable
     /// to incrementing the phase of each oscillator continually and will achieve
     /// a similar effect.
     ///
@@ -34,7 +39,7 @@ public:
 
     virtual void load(const float frequency)
     {
-        phase = distribution(twister);
+        phase = random.uniform();
         translation = frequency / sampleRate;
     }
     
@@ -49,10 +54,21 @@ public:
         translation = frequency / sampleRate;
     }
     
+    /// \brief Seed the generator that randomises the oscillator's phase, then randomise the phase.
+    /// \param seed The seed of the generator
+
+    virtual void seed(const uint64_t seed)
+    {
+        random.seed(seed);
+        phase = random.uniform();
+    }
+
+    /// \brief Return the phase of the oscillator in cycles, in the range [0, 1).
+
+    virtual const double position() const noexcept { return phase; }
+
 protected:
-    std::mt19937 twister;
-    std::random_device rd;
-    std::uniform_real_distribution<float> distribution;
+    Assemble::Random::Generator random;
 
 public:
     /// \brief Set the sample rate of the oscillator.
@@ -30,6 +30,98 @@ const float Synthesiser::nextSample()
     return sample * 0.0625F;
 }
 
+void Synthesiser::process(float* output, const int samples)
+{
+    if (workers.isRunning())
+    {
+        const int remaining = cooldown.load(std::memory_order_relaxed);
+        if (remaining <= 0) return processInParallel(output, samples);
+        cooldown.store(remaining - samples, std::memory_order_relaxed);
+    }
+
+    std::fill(output, output + samples, 0.F);
+
+    sin.process(output, samples);
+    tri.process(output, samples);
+    sqr.process(output, samples);
+    saw.process(output, samples);
+
+    for (int k = 0; k < samples; ++k)
+        output[k] = output[k] * 0.0625F;
+}
+
+void Synthesiser::processInParallel(float* output, const int samples)
+{
+    using Time = WorkerGroup::Time;
+    const auto duration = std::chrono::duration<float>(deadline * samples / sampleRate);
+
+    const auto due = Time::now() + std::chrono::duration_cast<Time::duration>(duration);
+
+    span = samples;
+    workers.fork();
+
+    std::fill(banks[0].begin(), banks[0].begin() + samples, 0.F);
+    sin.process(banks[0].data(), samples);
+
+    if (!workers.join(due))
+        cooldown.store(static_cast<int>(sampleRate), std::memory_order_relaxed);
+
+    for (int k = 0; k < samples; ++k)
+    {
+        const float sample = banks[0][k] + banks[1][k] + banks[2][k] + banks[3][k];
+        output[k] = sample * 0.0625F;
+    }
+}
+
+void Synthesiser::processBank(void* synthesiser, int task)
+{
+    Synthesiser& self = *static_cast<Synthesiser*>(synthesiser);
+    const int bank = task + 1;
+    float* buffer = self.banks[bank].data();
+
+    std::fill(buffer, buffer + self.span, 0.F);
+
+    switch (bank)
+    {
+        case 0x1: return self.tri.process(buffer, self.span);
+        case 0x2: return self.sqr.process(buffer, self.span);
+        case 0x3: return self.saw.process(buffer, self.span);
+        default:  return;
+    }
+}
+
+void Synthesiser::setVectorisedFilter(const bool enabled)
+{
+    sin.setVectorisedFilter(enabled);
+    tri.setVectorisedFilter(enabled);
+    sqr.setVectorisedFilter(enabled);
+    saw.setVectorisedFilter(enabled);
+}
+
+void Synthesiser::setCrossfade(const bool enabled)
+{
+    sin.setCrossfade(enabled);
+    tri.setCrossfade(enabled);
+    sqr.setCrossfade(enabled);
+    saw.setCrossfade(enabled);
+}
+
+void Synthesiser::seed(const uint64_t seed)
+{
+    sin.seed(Assemble::Random::split(seed, 0));
+    tri.seed(Assemble::Random::split(seed, 1));
+    sqr.seed(Assemble::Random::split(seed, 2));
+    saw.seed(Assemble::Random::split(seed, 3));
+}
+
+void Synthesiser::setParallel(const bool enabled)
+{
+    cooldown.store(0, std::memory_order_relaxed);
+
+    if (enabled) workers.start(&Synthesiser::processBank, this);
+    else         workers.stop();
+}
+
 const float Synthesiser::get(uint64_t parameter)
 {
     const int bank = (int) parameter / 16 % 16 - 1;
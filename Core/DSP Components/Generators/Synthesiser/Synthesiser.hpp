@@ -9,6 +9,7 @@
 #include "ASConstants.h"
 #include "ASFrequencies.h"
 #include "VoiceBank.hpp"
+#include "WorkerGroup.hpp"
 
 /// \brief A polyphonic synthesiser with four oscillator banks. Each oscillator bank is polyphonic.
 
@@ -22,6 +23,13 @@ public:
 
     const float nextSample();
 
+    /// \brief Render the next block of samples from each VoiceBank into `output`.
+    /// \pre   `samples` must not exceed `BLOCK_SIZE`.
+    /// \param output The buffer that should receive the samples
+    /// \param samples The number of samples to render
+
+    void process(float* output, const int samples);
+
     /// \brief Load a new note into the least recently used Voice whose oscillator
     /// matches the requested oscillator type.
 
@@ -45,14 +53,85 @@ public:
 
     void setSampleRate(const float sampleRate);
 
+    /// \brief Select the vectorised nonlinearity of the Voices' filters, which differs from the exact nonlinearity
+    /// only where the filters saturate, or the exact nonlinearity, which is computed for each Voice in turn.
+    /// \param enabled Whether the vectorised nonlinearity should be used
+
+    void setVectorisedFilter(const bool enabled);
+
+    /// \brief Enable or disable crossfading each Voice's wavetable with the following wavetable, which contains
+    /// half as many harmonics, so that the Voices' spectra change smoothly with pitch rather than by octaves.
+    /// \param enabled Whether the wavetables should be crossfaded
+
+    void setCrossfade(const bool enabled);
+
+    /// \brief Seed the generators of each VoiceBank with a distinct value derived from the given seed.
+    /// \param seed The seed of the Synthesiser
+
+    void seed(const uint64_t seed);
+
+    /// \brief Enable or disable parallel rendering. In parallel mode, the first VoiceBank is rendered
+    /// on the audio thread while each other VoiceBank is rendered by a worker thread.
+    /// If a worker misses its deadline, the Synthesiser renders serially for one second before
+    /// trying again. This should not be called from the audio thread.
+    /// \param enabled Whether the VoiceBanks should be rendered in parallel
+
+    void setParallel(const bool enabled);
+
+    /// \brief Indicate whether parallel rendering is enabled.
+
+    inline const bool isParallel() const { return workers.isRunning(); }
+
+    /// \brief Return the number of VoiceBanks that were rendered on the audio thread because
+    /// a worker missed its deadline.
+
+    inline const uint64_t missedDeadlines() const { return workers.missedDeadlines(); }
+
+private:
+    /// \brief Render each VoiceBank into its own buffer, in parallel, then sum the results into `output`.
+
+    void processInParallel(float* output, const int samples);
+
+    /// \brief Render the VoiceBank with the given index into its buffer.
+    /// This is the job executed by each worker.
+    /// \param synthesiser A pointer to the Synthesiser
+    /// \param task The index of the task, which is the index of the VoiceBank minus 1.
+
+    static void processBank(void* synthesiser, int task);
+
 private:
-    VoiceBank<SIN, POLYPHONY> sin;
-    VoiceBank<TRI, POLYPHONY> tri;
-    VoiceBank<SQR, POLYPHONY> sqr;
-    VoiceBank<SAW, POLYPHONY> saw;
+    /// \brief The oscillators of each VoiceBank, which are analytic if `ANALYTIC_OSCILLATORS` is defined.
+
+#ifdef ANALYTIC_OSCILLATORS
+    template <WaveTableType W> using Oscillators = PolyBLEP<W>;
+#else
+    template <WaveTableType W> using Oscillators = WaveTables<W>;
+#endif
+
+    VoiceBank<Oscillators<SIN>, POLYPHONY> sin;
+    VoiceBank<Oscillators<TRI>, POLYPHONY> tri;
+    VoiceBank<Oscillators<SQR>, POLYPHONY> sqr;
+    VoiceBank<Oscillators<SAW>, POLYPHONY> saw;
 
 private:
     float sampleRate = 48000.F;
+
+private:
+    WorkerGroup workers = {OSCILLATORS - 1};
+    std::array<std::array<float, BLOCK_SIZE>, OSCILLATORS> banks;
+
+    /// \brief The number of samples being rendered by the current fork.
+
+    int span = 0;
+
+    /// \brief The number of samples to render serially before parallel rendering resumes.
+    /// This is reset by `setParallel` on the UI thread, so it is atomic.
+
+    std::atomic<int> cooldown = {0};
+
+    /// \brief The fraction of each span's duration that a worker has to claim its VoiceBank.
+
+    constexpr static float deadline = 0.25F;
 };
 
 #endif
@@ -62,3 +62,23 @@ const float Voice::nextSample()
 
     return envelope * sample;
 }
+
+void Voice::process(float* output, float* scratch, const int samples)
+{
+    if (vca.closed()) return;
+
+    osc->process(scratch, samples);
+
+    const float gain = noiseGain.load();
+    if (gain > 0.0F)
+    {
+        for (int k = 0; k < samples; ++k)
+            scratch[k] = scratch[k] + gain * noise.nextSample();
+    }
+
+    for (int k = 0; k < samples; ++k)
+    {
+        const float envelope = vca.nextSample();
+        output[k] = output[k] + envelope * lpf.process(scratch[k]);
+    }
+}
@@ -27,6 +27,17 @@ public:
 
     const float nextSample();
 
+    /// \brief Render the next block of samples from the Voice and add them to `output`.
+    /// \param output The buffer that the Voice's samples should be added to
+    /// \param scratch A buffer of at least `samples` floats that the Voice can use as working memory
+    /// \param samples The number of samples to render
+
+    void process(float* output, float* scratch, const int samples);
+
+    /// \brief Indicate whether the Voice is silent because its amplitude envelope is closed.
+
+    inline const bool closed() { return vca.closed(); }
+
 public:
     /// \brief Assign an Oscillator to the Voice.
     /// \param osc The Oscillator that should correspond with the Voice.
@@ -5,45 +5,57 @@
 #ifndef OSCILLATORBANK_HPP
 #define OSCILLATORBANK_HPP
 
-#include "Voice.hpp"
+#include "VoiceEngine.hpp"
 #include "ASHeaders.h"
 #include "ASUtilities.h"
 #include "ASParameters.h"
 #include "ASOscillators.h"
 
 /// \brief A bank of Voices, which are each comprised of an oscillator, envelopes, and a lowpass filter.
+/// The Voices are stored and processed by a VoiceEngine, which renders several Voices at once.
+/// The oscillators are given by `Oscillators`, as in `VoiceBank<WaveTables<SAW>, N>` or `VoiceBank<PolyBLEP<SAW>, N>`.
 
-template <WaveTableType W, int N>
+template <typename Oscillators, int N>
 class VoiceBank
 {
 public:
-    /// \brief Initialise each Voice and ValueTransition object in the VoiceBank.
-    /// Each Voice bank is assigned with an Oscillator*.
+    /// \brief Initialise each ValueTransition object in the VoiceBank.
 
     VoiceBank()
     {
-        for (size_t v = 0; v < N; ++v)
-        {
-            voices[v].assign(&(oscillators[v]));
-        }
-        
         frequency.set(1.00F, 0.15F);
         resonance.set(0.00F, 0.15F);
     }
 
 public:
-    /// \brief Load a note into the least recently used Voice
+    /// \brief Load a note into the least recently used Voice, and add the Voice to the list of active Voices.
+    /// Since only the active Voices follow the filter's ValueTransitions, the Voice's filter is brought up to date first.
 
     void load(const float frequency)
     {
-        voices.at(nextVoice).load(frequency);
+        if (cutoff    >= 0.F) voices.set(nextVoice, kFrequencyType, cutoff);
+        if (emphasis  >= 0.F) voices.set(nextVoice, kResonanceType, emphasis);
+        voices.load(nextVoice, frequency);
+
+        if (!listed[nextVoice])
+        {
+            /// The list is kept in ascending order, so that the Voices are always summed in the same order.
+
+            int a = activeVoices;
+            for (; a > 0 && active[a - 1] > nextVoice; --a)
+                active[a] = active[a - 1];
+
+            active[a] = nextVoice;
+            listed[nextVoice] = true;
+            activeVoices = activeVoices + 1;
+        }
 
         nextVoice = nextVoice + 1;
         nextVoice = static_cast<int>(nextVoice < polyphony) * nextVoice;
     }
 
-    /// \brief Poll each Voice for its next sample, and poll each ValueTransition for its next value.
-    /// \note  If a ValueTransition has not yet reached its target value, it will be used to set the filter of each Voice
+    /// \brief Poll each active Voice for its next sample, and poll each ValueTransition for its next value.
+    /// \note  If a ValueTransition has not yet reached its target value, it will be used to set the filter of each active Voice
 
     inline const float nextSample() noexcept
     {
@@ -52,18 +64,71 @@ public:
         const float resonance = this->resonance.get();
         const bool  fcomplete = this->frequency.complete();
         const bool  rcomplete = this->resonance.complete();
-        
-        for (auto& voice : voices)
+
+        if (!fcomplete) cutoff   = frequency;
+        if (!rcomplete) emphasis = resonance;
+
+        if (didUpdateNoiseGain.exchange(false))
         {
-            if (!fcomplete) voice.set(kFrequencyType, frequency);
-            if (!rcomplete) voice.set(kResonanceType, resonance);
-            if (didUpdateNoiseGain) voice.set(kNoiseType, noiseGain.load());
+            voices.set(0, kNoiseType, noiseGain.load());
+        }
 
-            sample += voice.nextSample();
+        for (int a = 0; a < activeVoices; ++a)
+        {
+            if (!fcomplete) voices.set(active[a], kFrequencyType, frequency);
+            if (!rcomplete) voices.set(active[a], kResonanceType, resonance);
         }
 
+        voices.process(&sample, 1, active.data(), activeVoices);
+
+        release();
         return sample;
     }
+
+    /// \brief Render the next block of samples from each active Voice and add them to `output`.
+    /// \note  While a ValueTransition has not yet reached its target value, the block is divided into spans
+    /// of `smoothingInterval` samples, and the filter of each active Voice is set at the beginning of each span.
+    /// If no Voice is active and neither ValueTransition is moving, the VoiceBank does nothing.
+    /// \pre   `samples` must not exceed `BLOCK_SIZE`.
+    /// \param output The buffer that the VoiceBank's samples should be added to
+    /// \param samples The number of samples to render
+
+    inline void process(float* output, const int samples) noexcept
+    {
+        if (didUpdateNoiseGain.exchange(false))
+        {
+            voices.set(0, kNoiseType, noiseGain.load());
+        }
+
+        const bool smoothing = !(frequency.complete() && resonance.complete());
+        const int  interval  = smoothing ? smoothingInterval : samples;
+
+        if (activeVoices == 0 && !smoothing)
+            return;
+
+        for (int t = 0; t < samples; t += interval)
+        {
+            const int span = std::min(interval, samples - t);
+
+            if (!frequency.complete())
+            {
+                cutoff = frequency.get(span);
+                for (int a = 0; a < activeVoices; ++a)
+                    voices.set(active[a], kFrequencyType, cutoff);
+            }
+
+            if (!resonance.complete())
+            {
+                emphasis = resonance.get(span);
+                for (int a = 0; a < activeVoices; ++a)
+                    voices.set(active[a], kResonanceType, emphasis);
+            }
+
+            voices.process(output + t, span, active.data(), activeVoices);
+        }
+
+        release();
+    }
     
 public:
     /// \brief Set the sample rate of each Voice in the VoiceBank.
@@ -71,8 +136,31 @@ public:
 
     inline void setSampleRate(const float sampleRate)
     {
-        for (auto& voice : voices)
-            voice.setSampleRate(sampleRate);
+        voices.setSampleRate(sampleRate);
+    }
+
+    /// \brief Select the vectorised nonlinearity of each Voice's filter, or the exact nonlinearity of `HuovilainenFilter`.
+    /// \param enabled Whether the vectorised nonlinearity should be used
+
+    inline void setVectorisedFilter(const bool enabled)
+    {
+        voices.setVectorisedFilter(enabled);
+    }
+
+    /// \brief Enable or disable crossfading each Voice's wavetable with the wavetable that contains half as many harmonics.
+    /// \param enabled Whether the wavetables should be crossfaded
+
+    inline void setCrossfade(const bool enabled)
+    {
+        voices.setCrossfade(enabled);
+    }
+
+    /// \brief Seed the generators of the Voices' phases and noise.
+    /// \param seed The seed of the VoiceBank
+
+    inline void seed(const uint64_t seed)
+    {
+        voices.seed(seed);
     }
 
     /// \brief Get the parameter values of the VoiceBank.
@@ -88,7 +176,7 @@ public:
             case 0xAE: // Fallthrough
             case 0xFE: // Fallthrough
             {
-                return voices[0].get(parameter);
+                return voices.get(0, parameter);
             }
 
             /// Get a value from the filter for this VoiceBank.
@@ -135,8 +223,8 @@ public:
             case 0xAE:
             case 0xFE:
             {
-                for (auto& voice : voices)
-                    voice.set(parameter, value);
+                for (int v = 0; v < N; ++v)
+                    voices.set(v, parameter, value);
 
                 return;
             }
@@ -176,19 +264,52 @@ public:
         }
     }
 
+private:
+    /// \brief Remove each Voice whose amplitude envelope has closed from the list of active Voices.
+
+    inline void release() noexcept
+    {
+        int kept = 0;
+        for (int a = 0; a < activeVoices; ++a)
+        {
+            const int v = active[a];
+            if (voices.closed(v)) listed[v] = false;
+            else active[kept++] = v;
+        }
+
+        activeVoices = kept;
+    }
+
 private:
     int  nextVoice = 0;
-    bool didUpdateNoiseGain = false;
+    std::atomic<bool>  didUpdateNoiseGain = {false};
     std::atomic<int>   polyphony = {N};
     std::atomic<float> noiseGain = {0.0F};
 
 private:
     ValueTransition frequency;
     ValueTransition resonance;
+
+    /// \brief The number of samples between filter updates while a ValueTransition is incomplete.
+
+    constexpr static int smoothingInterval = 32;
+
+    /// \brief The values most recently produced by the filter's ValueTransitions, or -1 if they have not produced one.
+
+    float cutoff   = -1.F;
+    float emphasis = -1.F;
+
+private:
+    /// \brief The indices of the Voices whose amplitude envelopes are open, in ascending order. A Voice is added
+    /// when it is loaded and removed when its envelope closes, so Voices beyond the current polyphony leave the
+    /// list once they have finished releasing.
+
+    std::array<int,  N> active;
+    std::array<bool, N> listed = {};
+    int activeVoices = 0;
     
 private:
-    std::array<Voice, N>                    voices;
-    std::array<BandlimitedOscillator<W>, N> oscillators;
+    VoiceEngine<Oscillators, N> voices;
 };
 
 #endif 
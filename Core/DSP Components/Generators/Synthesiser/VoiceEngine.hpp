@@ -0,0 +1,418 @@
+//  Assemble
+//  ============================
+//  Copyright © 2020 David Spry. All rights reserved.
+
+#ifndef VOICEENGINE_HPP
+#define VOICEENGINE_HPP
+
+#include "ASSIMD.h"
+#include "ASRandom.h"
+#include "ASHeaders.h"
+#include "ASUtilities.h"
+#include "ASParameters.h"
+#include "VoiceOscillators.hpp"
+#include "AHREnvelope.hpp"
+#include "HuovilainenFilter.hpp"
+#include "HuovilainenLadder.hpp"
+
+/// \brief The Voices of a VoiceBank, stored as a structure of arrays so that `SIMD::width` Voices are processed at once.
+///
+/// Each Voice is equivalent to a `Voice` with a bandlimited oscillator: the oscillator and white noise are filtered
+/// by a Huovilainen lowpass filter, whose cutoff follows a filter envelope, and shaped by an amplitude envelope.
+/// The oscillators are given by `Oscillators`, which is either `WaveTables<W>` or `PolyBLEP<W>`. The Voices are divided
+/// into groups of `SIMD::width` lanes. The phase accumulators, which are 32-bit fixed-point phases as in
+/// `FixedPointOscillator<W>`, the oscillators, and the ladder filter are computed for a whole group at once, while the
+/// envelopes, the reads from each Voice's wavetable, and the filter's coefficients are computed for each lane in turn.
+///
+/// By default, the ladder's nonlinearity is vectorised, and it differs from the scalar filter only where its input
+/// saturates. The exact nonlinearity, which is computed for each lane in turn, can be selected with `setVectorisedFilter`.
+///
+/// With `WaveTables<W>`, each Voice's wavetable is selected from the frequency of its note and the sample rate.
+/// Optionally, the selected wavetable is crossfaded with the following wavetable, which contains half as many harmonics,
+/// as in `WaveTableSelector`. The crossfade interpolates both wavetables at every sample, which can be enabled with
+/// `setCrossfade`.
+///
+/// The phases of the oscillators are randomised by one generator, and the noise of each group is drawn from
+/// `SIMD::width` independent generators at once. Both are seeded with `seed`.
+///
+/// Only the open Voices of a group contribute to the output, and they are summed in ascending order.
+
+template <typename Oscillators, int N>
+class VoiceEngine
+{
+    using Lanes = Assemble::SIMD::Lanes;
+    using Mask  = Assemble::SIMD::Mask;
+    using Bits  = Assemble::SIMD::Bits;
+
+    constexpr static int width  = Assemble::SIMD::width;
+    constexpr static int groups = (N + width - 1) / width;
+    constexpr static int lanes  = groups * width;
+
+    constexpr static float noiseUpperBound = 0.35F;
+
+    constexpr static int   controlInterval  = FILTER_CONTROL_INTERVAL;
+    constexpr static int   gainTableSize    = 512;
+    constexpr static float maximumFrequency = 20E3F;
+
+    static_assert(controlInterval > 0, "The filter's control interval must be at least one sample.");
+
+public:
+    VoiceEngine()
+    {
+        for (int v = 0; v < lanes; ++v)
+        {
+            vca[v].set( 5, 0, 500);
+            vcf[v].set(25, 0, 250);
+        }
+
+        targetFrequencyNormal.fill(1.0F);
+        targetFrequency.fill(20E3F);
+        targetResonance.fill(0.0F);
+        phase.fill(Bits{});
+        translation.fill(Bits{});
+        filterGain.fill(Lanes{});
+        filterFeedback.fill(Lanes{});
+        tabulate();
+    }
+
+public:
+    /// \brief Load a note into the given Voice. Its envelopes are prepared and the phase of its oscillator is randomised.
+    /// \param voice The index of the Voice
+    /// \param frequency The frequency to load in Hertz
+
+    void load(const int voice, const float frequency)
+    {
+        vca[voice].prepare();
+        vcf[voice].prepare();
+        shared.select(oscillators[voice], frequency);
+
+        const int group = voice / width;
+        const int lane  = voice % width;
+        Assemble::SIMD::set(phase[group], lane, random.next());
+        Assemble::SIMD::set(translation[group], lane, Assemble::Utilities::increment(frequency, sampleRate));
+    }
+
+    /// \brief Indicate whether the given Voice is silent because its amplitude envelope is closed.
+
+    inline const bool closed(const int voice) { return vca[voice].closed(); }
+
+    /// \brief Render the next block of samples from the given Voices and add them to `output`.
+    /// \pre   `samples` must not exceed `BLOCK_SIZE`.
+    /// \param output The buffer that the Voices' samples should be added to
+    /// \param samples The number of samples to render
+    /// \param voices The indices of the Voices to render, in ascending order
+    /// \param count The number of indices in `voices`
+
+    void process(float* output, const int samples, const int* voices, const int count) noexcept
+    {
+        for (int a = 0; a < count;)
+        {
+            const int group = voices[a] / width;
+
+            bool any = false;
+            std::array<bool, width> live = {};
+            for (; a < count && voices[a] / width == group; ++a)
+            {
+                live[voices[a] % width] = !vca[voices[a]].closed();
+                any = any || live[voices[a] % width];
+            }
+
+            if (!any) continue;
+
+            const bool exact = !vectorisedFilter.load(std::memory_order_relaxed);
+            const bool blend = crossfade.load(std::memory_order_relaxed);
+
+            if      (!exact && !blend) process<false, false>(output, samples, group, live);
+            else if (!exact &&  blend) process<false, true> (output, samples, group, live);
+            else if ( exact && !blend) process<true,  false>(output, samples, group, live);
+            else                       process<true,  true> (output, samples, group, live);
+        }
+    }
+
+public:
+    /// \brief Get the parameter values of the given Voice.
+    /// \param voice The index of the Voice
+    /// \param parameter The hexadecimal address of the desired parameter
+
+    const float get(const int voice, uint64_t parameter)
+    {
+        const int type = (int) parameter / (2 << 7);
+        switch (type)
+        {
+            case 0xAE: return vca[voice].get(parameter);
+            case 0xFE: return vcf[voice].get(parameter);
+            case 0xF0:
+            {
+                const int subtype = (int) parameter % 16;
+                if (subtype == 0) return targetFrequencyNormal[voice];
+                if (subtype == 1) return targetResonance[voice];
+                return 0.F;
+            }
+
+            default: return 0.F;
+        }
+    }
+
+    /// \brief Set the parameters of the given Voice. The noise gain is shared by every Voice.
+    /// \param voice The index of the Voice
+    /// \param parameter The hexadecimal address of the parameter to set
+    /// \param value The value to set for the parameter
+
+    void set(const int voice, uint64_t parameter, float value)
+    {
+        const int type = (int) parameter / (2 << 7);
+        switch (type)
+        {
+            case 0xAE: vca[voice].set(parameter, value); return;
+            case 0xFE: vcf[voice].set(parameter, value); return;
+            case 0xAC: noiseGain = value * noiseUpperBound; return;
+            case 0xF0:
+            {
+                /// The value is mapped to the filter's cutoff frequency as in `HuovilainenFilter::set`.
+
+                value = Assemble::Utilities::bound(value, 0.0F, 1.0F);
+                const int subtype = (int) parameter % 16;
+                if (subtype == 1) targetResonance[voice] = value;
+                if (subtype == 0)
+                {
+                    targetFrequencyNormal[voice] = value;
+                    targetFrequency[voice] = std::exp(LN100 + value * (LN20E3 - LN100));
+                }
+
+                return;
+            }
+
+            default: return;
+        }
+    }
+
+    /// \brief Select the vectorised nonlinearity of the ladder filter, or the exact nonlinearity of `HuovilainenFilter`.
+    /// \param enabled Whether the vectorised nonlinearity should be used
+
+    inline void setVectorisedFilter(const bool enabled) { vectorisedFilter.store(enabled); }
+
+    /// \brief Indicate whether the ladder filter uses the vectorised nonlinearity.
+
+    inline const bool isVectorisedFilter() const { return vectorisedFilter.load(); }
+
+    /// \brief Enable or disable crossfading each Voice's wavetable with the wavetable that contains half as many harmonics.
+    /// \param enabled Whether the wavetables should be crossfaded
+
+    inline void setCrossfade(const bool enabled) { crossfade.store(enabled); }
+
+    /// \brief Indicate whether each Voice's wavetable is crossfaded with the following wavetable.
+
+    inline const bool isCrossfade() const { return crossfade.load(); }
+
+    /// \brief Seed the generators of the oscillators' phases and of the noise.
+    /// \param seed The seed of the Voices
+
+    void seed(const uint64_t seed)
+    {
+        random.seed(Assemble::Random::split(seed, 0));
+        noise.seed(Assemble::Random::split(seed, 1));
+    }
+
+    /// \brief Set the sample rate of each Voice.
+    /// \param sampleRate The sample rate to set
+
+    void setSampleRate(const float sampleRate)
+    {
+        this->sampleRate = sampleRate;
+        for (auto& envelope : vca) envelope.setSampleRate(sampleRate);
+        for (auto& envelope : vcf) envelope.setSampleRate(sampleRate);
+        shared.setSampleRate(sampleRate);
+        tabulate();
+    }
+
+private:
+    /// \brief Render the next block of samples from the given group of Voices and add the live Voices to `output`.
+    /// The state of each lane that is not live is left as it was, as if the Voice had not been processed.
+    /// \tparam exact Whether the ladder filter should use the exact nonlinearity
+    /// \tparam blend Whether each Voice's wavetable should be crossfaded with the following wavetable
+
+    template <bool exact, bool blend>
+    void process(float* output, const int samples, const int group, const std::array<bool, width>& live) noexcept
+    {
+        using namespace Assemble;
+        const int base = group * width;
+
+        /// The envelopes of each live lane are rendered as blocks and stored in lane-major order.
+
+        for (int l = 0; l < width; ++l)
+        {
+            if (!live[l])
+            {
+                for (int k = 0; k < samples; ++k)
+                {
+                    amplitude [k * width + l] = 0.F;
+                    modulation[k * width + l] = 0.F;
+                }
+
+                continue;
+            }
+
+            vca[base + l].process(envelope.data(), samples);
+            for (int k = 0; k < samples; ++k)
+                amplitude [k * width + l] = envelope[k];
+
+            vcf[base + l].process(envelope.data(), samples);
+            for (int k = 0; k < samples; ++k)
+                modulation[k * width + l] = Utilities::bound(envelope[k], 0.F, 1.F);
+        }
+
+        const float gain  = noiseGain;
+        const bool  noisy = gain > 0.0F;
+        const Lanes lower = SIMD::broadcast(-0.8F * gain);
+        const Lanes range = SIMD::broadcast( 1.6F * gain);
+
+        HuovilainenLadder ladder = filters[group];
+        const Bits initial = phase[group];
+
+        Bits position  = phase[group];
+        Bits increment = translation[group];
+        Lanes G = filterGain[group];
+        Lanes resonanceFour = filterFeedback[group];
+
+        const typename Oscillators::Group oscillator(oscillators.data() + base, increment, blend);
+
+        for (int t = 0; t < samples; t += controlInterval)
+        {
+            const int span = std::min(controlInterval, samples - t);
+
+            /// The filter's coefficients are computed for each live lane, as in `HuovilainenFilter::process`,
+            /// from the envelope at the end of the span, and they are interpolated linearly across the span.
+
+            Lanes targetG = G, targetResonanceFour = resonanceFour;
+            for (int l = 0; l < width; ++l)
+            {
+                if (!live[l]) continue;
+
+                const float E = modulation[(t + span - 1) * width + l];
+                const float frequency = E * targetFrequency[base + l];
+                const float resonance = E * targetResonance[base + l];
+                const float A = HuovilainenFilter::compensation(frequency, sampleRate);
+                SIMD::set(targetG, l, lookup(frequency));
+                SIMD::set(targetResonanceFour, l, 2.0F * (resonance * A));
+            }
+
+            const Lanes scale = SIMD::broadcast(1.0F / static_cast<float>(span));
+            const Lanes stepG = (targetG - G) * scale;
+            const Lanes stepResonanceFour = (targetResonanceFour - resonanceFour) * scale;
+
+            for (int s = 0; s < span; ++s)
+            {
+                const int k = t + s;
+
+                Lanes sample = oscillator.template sample<blend>(position);
+
+                position = position + increment;
+
+                if (noisy) sample = sample + (lower + range * noise.uniform());
+
+                /// The last sample of the span uses the target coefficients exactly, so an interval
+                /// of one sample reproduces `HuovilainenFilter::process`.
+
+                const bool  last = s + 1 == span;
+                const Lanes progress = SIMD::broadcast(static_cast<float>(s + 1));
+                const Lanes g = last ? targetG : G + stepG * progress;
+                const Lanes r = last ? targetResonanceFour : resonanceFour + stepResonanceFour * progress;
+
+                const Lanes filtered = ladder.process<exact>(sample, g, r);
+
+                const Lanes voices = SIMD::load(amplitude.data() + k * width) * filtered;
+                for (int l = 0; l < width; ++l)
+                    if (live[l]) output[k] = output[k] + SIMD::lane(voices, l);
+            }
+
+            G = targetG;
+            resonanceFour = targetResonanceFour;
+        }
+
+        /// The lanes that are not live are restored.
+
+        for (int l = 0; l < width; ++l)
+        {
+            if (live[l]) continue;
+
+            SIMD::set(position, l, SIMD::lane(initial, l));
+            ladder.copy(filters[group], l);
+        }
+
+        phase[group] = position;
+        filters[group] = ladder;
+        filterGain[group] = G;
+        filterFeedback[group] = resonanceFour;
+    }
+
+    /// \brief Return the gain coefficient of the filter for the given cutoff frequency, which is either computed
+    /// or, if `FILTER_GAIN_TABLE` is defined, interpolated linearly from `gainTable`.
+
+    inline const float lookup(const float frequency) const noexcept
+    {
+    #ifdef FILTER_GAIN_TABLE
+        const float position = std::min(frequency * (gainTableSize / maximumFrequency), static_cast<float>(gainTableSize));
+        const int   index    = static_cast<int>(position);
+        const float fraction = position - static_cast<float>(index);
+        return gainTable[index] + fraction * (gainTable[index + 1] - gainTable[index]);
+    #else
+        return HuovilainenFilter::gain(frequency, sampleRate);
+    #endif
+    }
+
+    /// \brief Tabulate the gain coefficient of the filter from 0 Hz to `maximumFrequency` at the current sample rate.
+
+    void tabulate()
+    {
+        for (int k = 0; k <= gainTableSize; ++k)
+            gainTable[k] = HuovilainenFilter::gain(maximumFrequency * k / gainTableSize, sampleRate);
+
+        gainTable[gainTableSize + 1] = gainTable[gainTableSize];
+    }
+
+private:
+    std::array<Bits, groups>              phase;
+    std::array<Bits, groups>              translation;
+    std::array<HuovilainenLadder, groups> filters;
+    std::array<Lanes, groups>             filterGain;
+    std::array<Lanes, groups>             filterFeedback;
+    std::array<typename Oscillators::Voice, lanes> oscillators;
+    std::array<AHREnvelope, lanes>        vca, vcf;
+
+    /// \brief The state that the oscillators of every Voice share, such as the selector of their wavetables.
+
+    Oscillators shared;
+
+private:
+    std::array<float, lanes> targetFrequency;
+    std::array<float, lanes> targetResonance;
+    std::array<float, lanes> targetFrequencyNormal;
+
+private:
+    /// \brief The gain coefficient of the filter at `gainTableSize + 1` equally spaced cutoff frequencies
+    /// from 0 Hz to `maximumFrequency`, followed by a copy of the last, so that it can be interpolated.
+
+    std::array<float, gainTableSize + 2> gainTable;
+
+private:
+    float sampleRate = 48000.F;
+    float noiseGain  = 0.0F;
+    std::atomic<bool> vectorisedFilter = {true};
+    std::atomic<bool> crossfade = {false};
+
+private:
+    Assemble::Random::Generator random;
+    Assemble::Random::Streams   noise;
+
+private:
+    /// \brief Working memory for the envelopes of a group, in lane-major order.
+
+    std::array<float, BLOCK_SIZE * width> amplitude;
+    std::array<float, BLOCK_SIZE * width> modulation;
+
+    /// \brief Working memory for the block rendered by one envelope.
+
+    std::array<float, BLOCK_SIZE> envelope;
+};
+
+#endif
@@ -0,0 +1,274 @@
+//  Assemble
+//  ============================
+//  Copyright © 2020 David Spry. All rights reserved.
+
+#ifndef VOICEOSCILLATORS_HPP
+#define VOICEOSCILLATORS_HPP
+
+#include "ASSIMD.h"
+#include "ASHeaders.h"
+#include "WaveTable.hpp"
+
+/// \brief The oscillators of a `VoiceEngine`, which are selected by the first template parameter of `VoiceBank` and
+/// `VoiceEngine`, as in `VoiceBank<WaveTables<SAW>, N>` or `VoiceBank<PolyBLEP<SAW>, N>`.
+///
+/// An oscillator type defines a `Voice`, which holds the state of one Voice's oscillator and is selected with
+/// `select(voice, frequency)` when a note is loaded, and a `Group`, which computes the oscillators of `SIMD::width`
+/// Voices at once from their 32-bit fixed-point phases, as in `FixedPointOscillator<W>`. An instance of the oscillator
+/// type holds the state that its Voices share, and it is owned by the `VoiceEngine`.
+
+/// \brief Oscillators that interpolate the standard sets of bandlimited wavetables.
+/// The selected wavetable of each Voice may be crossfaded with the wavetable that contains half as many harmonics.
+
+template <WaveTableType W>
+struct WaveTables
+{
+    using Lanes = Assemble::SIMD::Lanes;
+    using Bits  = Assemble::SIMD::Bits;
+    constexpr static int width = Assemble::SIMD::width;
+
+    using Voice = WaveTable<W>;
+
+    /// \brief The wavetables of a group of Voices.
+
+    class Group
+    {
+    public:
+        /// \param voices The `SIMD::width` Voices of the group
+        /// \param increment The increment of each Voice's phase, which is not needed
+        /// \param blend Whether the wavetables will be crossfaded
+
+        Group(const Voice* voices, const Bits, const bool blend)
+        {
+            for (int l = 0; l < width; ++l)
+            {
+                selected.tables[l] = voices[l].table();
+                Assemble::SIMD::set(selected.length, l, static_cast<uint32_t>(voices[l].length()));
+                Assemble::SIMD::set(selected.scale,  l, voices[l].scale());
+
+                if (!blend) continue;
+
+                following.tables[l] = voices[l].nextTable();
+                Assemble::SIMD::set(following.length, l, static_cast<uint32_t>(voices[l].nextLength()));
+                Assemble::SIMD::set(following.scale,  l, voices[l].nextScale());
+                Assemble::SIMD::set(weight, l, voices[l].blend());
+            }
+        }
+
+        /// \brief Compute each Voice's sample at the given phase.
+        /// \tparam blend Whether the wavetables should be crossfaded
+
+        template <bool blend>
+        inline const Lanes sample(const Bits position) const noexcept
+        {
+            Lanes sample = interpolate(selected, position);
+            if (blend) sample = sample + (interpolate(following, position) - sample) * weight;
+            return sample;
+        }
+
+    private:
+        /// \brief The wavetable of each lane of a group, its length, and the scale of its samples.
+
+        struct Table
+        {
+            std::array<const WaveTableSample*, width> tables;
+            Bits  length;
+            Lanes scale;
+        };
+
+        /// \brief Interpolate each lane's wavetable at the given phase, as in `FixedPointOscillator<W>`. The length of each
+        /// lane's wavetable is a power of two, so the index and the fraction are the upper and lower bits of the product of
+        /// the phase and the length, and the wavetable's guard samples are read without wrapping the index. Compact samples
+        /// are converted to floats as they are gathered, and the interpolated sample is multiplied by the lane's scale.
+
+        static inline const Lanes interpolate(const Table& wavetable, const Bits position) noexcept
+        {
+            using namespace Assemble;
+            const Lanes half = SIMD::broadcast(0.5F);
+
+            const Bits  a = ((position >> 16) * wavetable.length) >> 16;
+            const Lanes f = SIMD::unit(position * wavetable.length);
+
+            Lanes xa, xb, xc, xd;
+            for (int l = 0; l < width; ++l)
+            {
+                const WaveTableSample* x = wavetable.tables[l] + SIMD::lane(a, l);
+                SIMD::set(xa, l, static_cast<float>(x[ 0]));
+                SIMD::set(xb, l, static_cast<float>(x[-1]));
+                SIMD::set(xc, l, static_cast<float>(x[ 1]));
+                SIMD::set(xd, l, static_cast<float>(x[ 2]));
+            }
+
+            const Lanes C = (xc - xb) * half;
+            const Lanes V = (xa - xc);
+            const Lanes U = C + V;
+            const Lanes A = U + V + (xd - xa) * half;
+            const Lanes B = U + A;
+
+            return ((((A * f) - B) * f + C) * f + xa) * wavetable.scale;
+        }
+
+    private:
+        Table selected = {}, following = {};
+        Lanes weight = {};
+    };
+
+    /// \brief Select the wavetables of the given Voice for the given frequency.
+    /// \param voice The Voice
+    /// \param frequency The frequency in Hz
+
+    inline void select(Voice& voice, const float frequency) const noexcept { voice.select(selector, frequency); }
+
+    /// \brief Tabulate the selection of the Voices' wavetables for the given sample rate.
+
+    void setSampleRate(const float sampleRate) { selector.setSampleRate(sampleRate); }
+
+private:
+    /// \brief The selector of the wavetables, which is shared by the Voices of one `VoiceEngine`.
+
+    WaveTableSelector selector = WaveTable<W>::selector(48000.F);
+};
+
+/// \brief Oscillators that compute each waveform analytically, without wavetables. The discontinuities of the sawtooth
+/// and square waves are smoothed with two-point polynomial bandlimited steps (PolyBLEP), and the corners of the triangle
+/// wave with their integrals (PolyBLAMP), as described by Välimäki et al. The sine wave is a polynomial approximation.
+///
+/// Each waveform has the phase and polarity of the standard wavetable of the same type, and it is scaled so that its
+/// fundamental matches that of the wavetable. The correction is two samples wide, so it attenuates the highest
+/// harmonics and leaves more aliasing than the wavetables, but it uses no memory and reads no tables.
+
+template <WaveTableType W>
+struct PolyBLEP
+{
+    using Lanes = Assemble::SIMD::Lanes;
+    using Bits  = Assemble::SIMD::Bits;
+
+    /// \brief An analytic oscillator has no state besides its phase.
+
+    struct Voice {};
+
+    /// \brief An analytic oscillator needs no selection.
+
+    inline void select(Voice&, const float) const noexcept {}
+
+    /// \brief The analytic oscillators of a group of Voices.
+
+    class Group
+    {
+    public:
+        /// \param voices The `SIMD::width` Voices of the group, which are not needed
+        /// \param increment The increment of each Voice's phase
+        /// \param blend Whether the wavetables will be crossfaded, which has no effect
+
+        Group(const Voice*, const Bits increment, const bool)
+        {
+            using namespace Assemble;
+            const Lanes least = SIMD::broadcast(1E-6F);
+            const Lanes step  = SIMD::unit(increment);
+
+            dt = SIMD::select(SIMD::mask(step > least), step, least);
+            reciprocal = SIMD::broadcast(1.0F) / dt;
+        }
+
+        /// \brief Compute each Voice's sample at the given phase.
+
+        template <bool blend>
+        inline const Lanes sample(const Bits position) const noexcept
+        {
+            using namespace Assemble;
+            const Lanes one = SIMD::broadcast(1.0F);
+
+            if constexpr (W == SAW)
+            {
+                const Lanes t = SIMD::unit(position);
+                return (t + t - one - blep(t)) * SIMD::broadcast(sawtoothGain);
+            }
+
+            else if constexpr (W == SQR)
+            {
+                const Lanes t = SIMD::unit(position);
+                const Lanes u = SIMD::unit(position + 0x80000000U);
+                const Lanes naive = SIMD::select(SIMD::mask(t < SIMD::broadcast(0.5F)), one, -one);
+                return (naive + blep(t) - blep(u)) * SIMD::broadcast(squareGain);
+            }
+
+            else if constexpr (W == TRI)
+            {
+                /// The triangle is at its maximum where `u` wraps, and at its minimum where `v` wraps.
+
+                const Lanes u = SIMD::unit(position + 0x40000000U);
+                const Lanes v = SIMD::unit(position + 0xC0000000U);
+                const Lanes naive = SIMD::abs(u * SIMD::broadcast(4.0F) - SIMD::broadcast(2.0F)) - one;
+                const Lanes corner = SIMD::broadcast(8.0F) * dt;
+                return (naive - corner * (blamp(u) - blamp(v))) * SIMD::broadcast(triangleGain);
+            }
+
+            else
+            {
+                /// The sine is an odd polynomial in a triangle wave that has the same phase, as in `sin(πx / 2)`.
+
+                const Lanes u = SIMD::unit(position + 0x40000000U);
+                const Lanes x = one - SIMD::abs(u * SIMD::broadcast(4.0F) - SIMD::broadcast(2.0F));
+                const Lanes y = x * x;
+                return x * (SIMD::broadcast(sine[0]) + y * (SIMD::broadcast(sine[1]) + y * (SIMD::broadcast(sine[2]) +
+                            y * (SIMD::broadcast(sine[3]) + y * SIMD::broadcast(sine[4])))));
+            }
+        }
+
+    private:
+        /// \brief Return the two-point PolyBLEP residual of a unit downward step at the phase 0.
+
+        inline const Lanes blep(const Lanes t) const noexcept
+        {
+            using namespace Assemble;
+            const Lanes one  = SIMD::broadcast(1.0F);
+            const Lanes zero = SIMD::broadcast(0.0F);
+
+            const Lanes a = t * reciprocal;
+            const Lanes b = (t - one) * reciprocal;
+            const Lanes before = a + a - a * a - one;
+            const Lanes after  = b * b + b + b + one;
+
+            return SIMD::select(SIMD::mask(t < dt), before, SIMD::select(SIMD::mask(t > one - dt), after, zero));
+        }
+
+        /// \brief Return the two-point PolyBLAMP residual of a unit change of slope at the phase 0, in units of `dt`.
+
+        inline const Lanes blamp(const Lanes t) const noexcept
+        {
+            using namespace Assemble;
+            const Lanes one   = SIMD::broadcast(1.0F);
+            const Lanes zero  = SIMD::broadcast(0.0F);
+            const Lanes sixth = SIMD::broadcast(1.0F / 6.0F);
+
+            const Lanes a = t * reciprocal - one;
+            const Lanes b = (t - one) * reciprocal + one;
+            const Lanes before = -(a * a * a) * sixth;
+            const Lanes after  =  (b * b * b) * sixth;
+
+            return SIMD::select(SIMD::mask(t < dt), before, SIMD::select(SIMD::mask(t > one - dt), after, zero));
+        }
+
+    private:
+        Lanes dt;
+        Lanes reciprocal;
+    };
+
+    /// \brief Analytic oscillators do not depend on the sample rate.
+
+    void setSampleRate(const float) {}
+
+private:
+    /// \brief The gain of each waveform that matches its fundamental to that of the standard wavetable,
+    /// which is normalised to a peak of 0.999 with 735 harmonics.
+
+    constexpr static float sawtoothGain = 0.852502F;
+    constexpr static float squareGain   = 0.851513F;
+    constexpr static float triangleGain = 0.999550F;
+
+    /// \brief The Taylor coefficients of `sin(πx / 2)` to the ninth order, whose error is below 4E-6 in [-1, 1].
+
+    constexpr static float sine[5] = {1.5707963F, -0.6459641F, 0.0796926F, -0.0046818F, 0.0001604F};
+};
+
+#endif
@@ -0,0 +1,108 @@
+//  Assemble
+//  ============================
+//  Copyright © 2020 David Spry. All rights reserved.
+
+#include "DelayBuffer.hpp"
+
+template <int Channels>
+DelayBuffer<Channels>::~DelayBuffer()
+{
+    collect();
+
+    Storage* storage;
+    while (offers.pop(storage)) delete storage;
+
+    delete current;
+    delete waiting;
+    delete previous;
+}
+
+template <int Channels>
+void DelayBuffer<Channels>::reserve(const int length)
+{
+    collect();
+
+    int capacity = 0;
+    if (length > 0)
+    {
+        capacity = Ring::minimum;
+        while (capacity < length) capacity = capacity << 1;
+    }
+
+    const bool grow   = capacity > reserved;
+    const bool shrink = capacity < reserved && (length == 0 || static_cast<int64_t>(length) * 8 <= static_cast<int64_t>(reserved) * 3);
+    if (!grow && !shrink) return;
+
+    Storage* storage = new Storage;
+    storage->samples.assign(capacity > 0 ? Ring::length(capacity) : 0, 0.F);
+    storage->capacity = capacity;
+
+    if (!offers.push(storage))
+    {
+        delete storage;
+        return;
+    }
+
+    reserved = capacity;
+    allocated.fetch_add(storage->samples.size() * sizeof(float), std::memory_order_relaxed);
+}
+
+template <int Channels>
+void DelayBuffer<Channels>::collect()
+{
+    Storage* storage;
+    while (retired.pop(storage))
+    {
+        allocated.fetch_sub(storage->samples.size() * sizeof(float), std::memory_order_relaxed);
+        delete storage;
+    }
+}
+
+template <int Channels>
+void DelayBuffer<Channels>::adopt(const int length, const bool silent) noexcept
+{
+    Storage* offer;
+    while (offers.pop(offer))
+    {
+        retire(waiting);
+        waiting = offer;
+    }
+
+    if (previous != nullptr && written >= overlap)
+    {
+        retire(previous);
+        previous = nullptr;
+    }
+
+    if (waiting == nullptr) return;
+
+    /// A buffer that is too short for the current delay waits until the delay has shortened.
+    /// While the previous buffer is still being read, a new buffer is only adopted if the current buffer is too short.
+
+    const int next = waiting->capacity;
+    if (next == 0 ? !silent : next < length) return;
+    if (previous != nullptr && ring.capacity() >= length) return;
+
+    retire(previous);
+    previous = nullptr;
+
+    if (silent || current == nullptr)
+        retire(current);
+
+    else
+    {
+        previous = current;
+        past     = ring;
+        written  = 0;
+        overlap  = std::min(ring.capacity(), next);
+    }
+
+    current = waiting;
+    waiting = nullptr;
+    ring.attach(next > 0 ? current->samples.data() : nullptr, next);
+}
+
+/// The buffers of the mono `Delay` and of the stereo `MultiTapDelay`.
+
+template class DelayBuffer<1>;
+template class DelayBuffer<2>;
@@ -0,0 +1,203 @@
+//  Assemble
+//  ============================
+//  Copyright © 2020 David Spry. All rights reserved.
+
+#ifndef DELAYBUFFER_HPP
+#define DELAYBUFFER_HPP
+
+#include "ASHeaders.h"
+#include "ASUtilities.h"
+#include "SPSCQueue.hpp"
+#include "RingBuffer.hpp"
+
+#include <type_traits>
+
+/// \brief The circular buffer of a delay line, whose storage is sized to the longest delay that is currently needed.
+/// Each frame of the buffer holds one sample of each of its `Channels` channels, which are interleaved.
+/// The current buffer is a `RingBuffer`, whose guards span the reach of a `SincInterpolator`.
+///
+/// Storage is allocated and freed off the audio thread by `reserve`, which offers a new buffer to the audio thread
+/// through a wait-free queue, and by `collect`, which frees the buffers that the audio thread has given up. The audio
+/// thread takes the most recent offer in `adopt`, without allocating or copying. Until the new buffer holds as many
+/// samples as the previous buffer could, the older samples are read from the previous buffer, which is then retired.
+///
+/// Capacities are powers of two. A buffer grows as soon as the longest delay exceeds it, and shrinks once the
+/// longest delay fits within 3/8 of it, so that small changes around a power of two do not reallocate the buffer.
+
+template <int Channels = 1>
+class DelayBuffer
+{
+public:
+    DelayBuffer() = default;
+    ~DelayBuffer();
+
+    DelayBuffer(const DelayBuffer&) = delete;
+    DelayBuffer& operator=(const DelayBuffer&) = delete;
+
+public:
+    /// \brief Offer the audio thread a buffer that can hold the given number of samples, if the current buffer should
+    /// grow or shrink, and free any buffer that the audio thread has given up. This should not be called from the audio thread.
+    /// \param length The longest delay that the buffer must hold in frames, or 0 if the buffer can be freed
+
+    void reserve(const int length);
+
+    /// \brief Free every buffer that the audio thread has given up. This should not be called from the audio thread.
+
+    void collect();
+
+    /// \brief Return the number of bytes allocated for the buffers, including any that are offered or retired.
+
+    inline const size_t bytes() const { return allocated.load(std::memory_order_relaxed); }
+
+public:
+    /// \brief Adopt the most recent buffer offered by `reserve`, if it can hold the given number of samples.
+    /// An empty buffer is only adopted when the contents of the current buffer are silent. This is called by
+    /// the audio thread before each block.
+    /// \param length The longest delay that the buffer must hold in frames
+    /// \param silent Whether every sample in the current buffer is inaudible
+
+    void adopt(const int length, const bool silent) noexcept;
+
+    /// \brief Return the number of frames in the current buffer.
+
+    inline const int capacity() const noexcept { return ring.capacity(); }
+
+    /// \brief Write the next sample of a buffer with one channel.
+
+    template <int C = Channels, typename = std::enable_if_t<C == 1>>
+    inline void write(const float sample) noexcept
+    {
+        write(&sample);
+    }
+
+    /// \brief Write the next frame, which holds one sample of each channel.
+
+    inline void write(const float* frame) noexcept
+    {
+        ring.write(frame);
+        written = written + static_cast<int>(previous != nullptr);
+    }
+
+    /// \brief Write the given block of interleaved frames.
+    /// \param block The frames to write
+    /// \param count The number of frames to write, which should not exceed the capacity
+
+    inline void write(const float* block, const int count) noexcept
+    {
+        ring.write(block, count);
+        written = written + count * static_cast<int>(previous != nullptr);
+    }
+
+    /// \brief Return the sample of the given channel at the given distance before the next write, using Hermite interpolation.
+    /// \param distance The distance in frames, in the range [3, capacity - 2]
+    /// \param channel The channel
+
+    inline const float read(const float distance, const int channel = 0) const noexcept
+    {
+        if (previous == nullptr)
+            return ring.read(distance, channel);
+
+        const auto [a, k] = locate(distance);
+        const float x[4] = { at(a - 1, channel), at(a, channel), at(a + 1, channel), at(a + 2, channel) };
+        return Assemble::Utilities::hermite(x, 1, k);
+    }
+
+    /// \brief Return the sample of the given channel at the given distance before the next write, using the given
+    /// windowed-sinc interpolator.
+    /// \param distance The distance in frames, in the range [taps / 2 + 1, capacity - taps / 2]
+    /// \param interpolator The interpolator
+    /// \param channel The channel
+
+    inline const float read(const float distance, const SincInterpolator& interpolator, const int channel = 0) const noexcept
+    {
+        constexpr int taps = SincInterpolator::taps;
+
+        if (previous == nullptr)
+            return ring.read(distance, interpolator, channel);
+
+        const auto [a, k] = locate(distance);
+        const int first = a - (taps / 2 - 1);
+
+        alignas(32) float x[taps];
+        for (int j = 0; j < taps; ++j) x[j] = at(first + j, channel);
+
+        return interpolator.interpolate(x, k);
+    }
+
+private:
+    using Ring = RingBuffer<Channels, SincInterpolator::taps / 2>;
+
+    /// \brief A buffer of samples with the guards of a `Ring`, which is allocated and freed off the audio thread.
+
+    struct Storage
+    {
+        std::vector<float> samples;
+        int capacity = 0;
+    };
+
+    /// \brief Return the frame before the given distance from the next write, and the fraction between it and the next frame.
+
+    inline const std::pair<int, float> locate(const float distance) const noexcept
+    {
+        float position = static_cast<float>(ring.head()) - distance;
+        position = position + static_cast<float>(position < 0.F) * static_cast<float>(ring.capacity());
+
+        const int a = static_cast<int>(position);
+        return { a, position - static_cast<float>(a) };
+    }
+
+    /// \brief Return the sample of the given channel at the given frame of the current buffer, or at the same time
+    /// in the previous buffer if that frame has not been written to the current buffer since it was adopted.
+
+    inline const float at(const int index, const int channel = 0) const noexcept
+    {
+        const int mask = ring.capacity() - 1;
+        const int distance = ((ring.head() - index - 1) & mask) + 1;
+        if (distance <= written) return ring.at(index, channel);
+
+        const int before = distance - written;
+        if (before > past.capacity()) return 0.F;
+
+        return past.at(past.head() - before, channel);
+    }
+
+    /// \brief Pass the given buffer to the UI thread to be freed.
+
+    inline void retire(Storage* storage) noexcept
+    {
+        if (storage != nullptr) retired.push(storage);
+    }
+
+private:
+    Storage* current  = nullptr;
+    Storage* waiting  = nullptr;
+    Storage* previous = nullptr;
+
+    /// \brief The current buffer, and the previous buffer as it was when it was given up.
+
+    Ring ring;
+    Ring past;
+
+private:
+    /// \brief The number of samples written to the current buffer since the previous buffer was given up,
+    /// and the number of samples after which the previous buffer is retired.
+
+    int written = 0;
+    int overlap = 0;
+
+private:
+    /// \brief The buffers offered to the audio thread, and the buffers given up by it. Every buffer in flight is
+    /// either offered, waiting, current, previous, or retired, and `reserve` collects the retired buffers before
+    /// offering another, so that the queue of retired buffers never overflows.
+
+    SPSCQueue<Storage*, 8>  offers;
+    SPSCQueue<Storage*, 16> retired;
+
+    /// \brief The capacity in frames of the most recent buffer offered, which is only accessed by `reserve`.
+
+    int reserved = 0;
+
+    std::atomic<size_t> allocated = {0};
+};
+
+#endif
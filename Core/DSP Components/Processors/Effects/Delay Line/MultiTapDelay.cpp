@@ -0,0 +1,285 @@
+//  Assemble
+//  ============================
+//  Copyright © 2020 David Spry. All rights reserved.
+
+#include "MultiTapDelay.hpp"
+
+MultiTapDelay::MultiTapDelay(Clock *clock, const int factor) :
+factor(factor),
+reach(factor > 1 ? 2 : SincInterpolator::taps / 2)
+{
+    bpm = clock->bpm;
+    this->clock = clock;
+
+    const float sampleRate = clock->sampleRate * (float) factor;
+
+    for (int t = 0; t < taps; ++t)
+    {
+        Tap& tap = heads[t];
+        tap.delay.set(1E3F * (float) factor / (float) OVERSAMPLING, 96E3F, 2.0F);
+        tap.distance = headroom;
+        tap.phase = static_cast<uint32_t>((static_cast<uint64_t>(t) << 32) / taps);
+        setMusicalTimeIndex(tap.index, t);
+        tap.delay.setSampleRate(sampleRate);
+
+        for (int c = 0; c < channels; ++c)
+            tap.routes[c] = { static_cast<float>(c == t % channels), static_cast<float>(c == t % channels) };
+    }
+
+    modulation.setSampleRate(sampleRate);
+}
+
+const float MultiTapDelay::get(uint64_t parameter, const int tap)
+{
+    switch (parameter)
+    {
+        case kDelayMix:         return mix;
+        case kDelayMusicalTime: return heads[tap].index;
+        case kDelayFeedback:    return feedback.load();
+        case kDelayModulation:  return modulation.getTarget() - 1.0F;
+
+        case kDelayTimeInMs:
+        {
+            const float target = heads[tap].delay.getTarget();
+            const float sampleRate = clock->sampleRate * (float) factor;
+            return Assemble::Utilities::milliseconds(target, sampleRate);
+        }
+
+        default: return 0.0F;
+    }
+}
+
+void MultiTapDelay::set(uint64_t parameter, float value)
+{
+    switch (parameter)
+    {
+        case kStereoDelayToggle:
+        {
+            bypassed.store(static_cast<bool>(value));
+            break;
+        }
+        case kDelayFeedback:
+        {
+            feedback.store(Assemble::Utilities::bound(value, 0.F, 1.F));
+            break;
+        }
+        case kDelayModulation:
+        {
+            const float depth = Assemble::Utilities::bound(value, 0.F, 1.F);
+            modulation.set(depth + 1.0F);
+            break;
+        }
+        case kDelayTimeInMs:
+        {
+            const int time = (int) std::floor(Assemble::Utilities::bound(value, 0.F, 4000.F));
+            const float sampleRate = clock->sampleRate * (float) factor;
+            for (Tap& tap : heads)
+                tap.delay.set(Assemble::Utilities::samples(time, sampleRate) + tap.offset);
+            break;
+        }
+        case kDelayMusicalTime:
+        {
+            for (int t = 0; t < taps; ++t)
+                setMusicalTimeIndex(static_cast<int>(value), t);
+            break;
+        }
+        case kDelayMix:
+        {
+            mix = Assemble::Utilities::bound(value, 0.F, 1.F);
+            break;
+        }
+        default: return;
+    }
+}
+
+void MultiTapDelay::setInMusicalTime(const float time, const int tap)
+{
+    heads[tap].time = time;
+    bpm = clock->bpm;
+
+    const float target = clock->sampleRate * (float) factor * 60 / bpm * time;
+    heads[tap].delay.set(target + heads[tap].offset);
+}
+
+void MultiTapDelay::setMusicalTimeIndex(const int index, const int tap)
+{
+    heads[tap].index = index;
+    setInMusicalTime(parseMusicalTimeParameterIndex(index), tap);
+}
+
+/// \brief Parse an index from an input parameter value and return the matching
+/// musical time factor constant.
+/// \param index The input value
+
+const float MultiTapDelay::parseMusicalTimeParameterIndex(const int index)
+{
+    switch (index)
+    {
+        case 0:  return fDelayWholeNote;
+        case 1:  return fDelayHalfDotted;
+        case 2:  return fDelayHalfNote;
+        case 3:  return fDelayQuarterDotted;
+        case 4:  return fDelayQuarterNote;
+        case 5:  return fDelayEighthDotted;
+        case 6:  return fDelayEighthNote;
+        case 7:  return fDelaySixteenthDotted;
+        case 8:  return fDelaySixteenthNote;
+        case 9:  return fDelayThirtySecondNote;
+        case 10: return fDelaySixtyFourthNote;
+        default: return 1.F;
+    }
+}
+
+void MultiTapDelay::inject(const int milliseconds, const int tap)
+{
+    const float sampleRate = clock->sampleRate * (float) factor;
+    heads[tap].offset = Assemble::Utilities::samples(milliseconds, sampleRate);
+    setInMusicalTime(heads[tap].time, tap);
+}
+
+void MultiTapDelay::route(const int tap, const int channel)
+{
+    for (int c = 0; c < channels; ++c)
+        heads[tap].routes[c].target = static_cast<float>(c == channel);
+}
+
+void MultiTapDelay::reserve(const std::array<float, taps>& seconds)
+{
+    const float sampleRate = clock->sampleRate * (float) factor;
+    const float longest = *std::max_element(seconds.begin(), seconds.end());
+    const float length = longest > 0.F ? longest * sampleRate + headroom : 0.F;
+    buffer.reserve(static_cast<int>(std::ceil(length)));
+}
+
+/// \brief Process a block of frames in contiguous spans. Each span ends before a tap would reach a frame that the span
+/// has yet to write, so that every frame of the span is read before the span is written to the buffer as one block.
+///
+/// The first pass over a span reads each tap, sums it into the output of its channel and into the feedback of each
+/// channel that it is routed to, and moves it by the modulator. The second pass mixes the input with the feedback and
+/// with the output of every channel at once, in SIMD lanes over the interleaved frames of the span.
+
+void MultiTapDelay::process(float* lsamples, float* rsamples, const int count) noexcept
+{
+    using Lanes = Assemble::SIMD::Lanes;
+    constexpr int width = Assemble::SIMD::width;
+
+    const int capacity = buffer.capacity();
+    if (capacity == 0)
+    {
+        for (int k = 0; k < count; ++k)
+        {
+            if (bpm != clock->bpm) update();
+            fade();
+        }
+
+        return;
+    }
+
+    float* const samples[channels] = { lsamples, rsamples };
+
+    const float feedback = this->feedback.load();
+    const float mix = this->mix.load();
+
+    std::array<uint32_t, taps> phases;
+    std::array<float, taps> swings;
+    for (int h = 0; h < taps; ++h)
+        phases[h] = heads[h].phase;
+
+    /// The input, its level in the buffer, the level of the dry signal, the output of the taps, and their feedback,
+    /// for each interleaved frame of the span. The input is replaced by the output of the delay line.
+
+    std::array<float, span * channels> input, send, dry, wet, echo, block;
+
+    /// The routes and sends glide only while one of them has yet to reach its target, which is rare.
+
+    bool gliding = false;
+    for (int c = 0; c < channels; ++c)
+    {
+        gliding = gliding || sends[c].value != sends[c].target;
+        for (const Tap& tap : heads)
+            gliding = gliding || tap.routes[c].value != tap.routes[c].target;
+    }
+
+    for (int t = 0, n = 0; t < count; t += n)
+    {
+        for (n = 0; n < span && t + n < count; ++n)
+        {
+            /// The buffer's write head is at the start of the span, so the distance to each tap is shortened by `n`.
+
+            bool reached = false;
+            for (const Tap& tap : heads)
+                reached = reached || tap.distance < static_cast<float>(n + reach + 1);
+
+            if (n > 0 && reached) break;
+            if (bpm != clock->bpm) update();
+
+            fade();
+
+            const int frame = n * channels;
+            for (int c = 0; c < channels; ++c)
+            {
+                if (gliding) sends[c].glide(taper);
+                input[frame + c] = samples[c][t + n];
+                send [frame + c] = gain * sends[c].value;
+                dry  [frame + c] = 1.0F - gain * mix;
+                wet  [frame + c] = 0.F;
+                echo [frame + c] = 0.F;
+            }
+
+            bool inaudible = gainLinear == 0.F;
+            for (int h = 0; h < taps; ++h)
+            {
+                Tap& tap = heads[h];
+                const int   channel  = h % channels;
+                const float distance = tap.distance - static_cast<float>(n);
+                const float output   = factor > 1 ? buffer.read(distance, channel) : buffer.read(distance, sinc, channel);
+
+                wet[frame + channel] += output;
+                for (int c = 0; c < channels; ++c)
+                {
+                    if (gliding) tap.routes[c].glide(taper);
+                    echo[frame + c] += tap.routes[c].value * output;
+                }
+
+                inaudible = inaudible && std::abs(output) < silence;
+            }
+
+            quiet = inaudible ? std::min(quiet + 1, capacity) : 0;
+
+            /// The distance is bounded by the buffer, which may be shorter than the delay until a longer buffer is adopted.
+
+            const float depth = scalar * (modulation.get() - 1.0F);
+            modulator.nextSamples(phases.data(), swings.data(), taps);
+
+            for (int h = 0; h < taps; ++h)
+            {
+                const float distance = heads[h].delay.get() - depth * swings[h];
+                heads[h].distance = std::clamp(distance, static_cast<float>(reach + 1), static_cast<float>(capacity - reach));
+            }
+        }
+
+        const int length = n * channels;
+        const Lanes feedbacks = Assemble::SIMD::broadcast(feedback);
+        const Lanes mixes = Assemble::SIMD::broadcast(mix);
+
+        int k = 0;
+        for (; k + width <= length; k += width)
+        {
+            const Lanes x = Assemble::SIMD::load(&input[k]);
+            Assemble::SIMD::store(&block[k], Assemble::SIMD::load(&send[k]) * x + feedbacks * Assemble::SIMD::load(&echo[k]));
+            Assemble::SIMD::store(&input[k], Assemble::SIMD::load(&dry[k]) * x + mixes * Assemble::SIMD::load(&wet[k]));
+        }
+
+        for (; k < length; ++k)
+        {
+            block[k] = send[k] * input[k] + feedback * echo[k];
+            input[k] = dry[k] * input[k] + mix * wet[k];
+        }
+
+        buffer.write(block.data(), n);
+
+        for (int f = 0; f < n; ++f)
+            for (int c = 0; c < channels; ++c)
+                samples[c][t + f] = input[f * channels + c];
+    }
+}
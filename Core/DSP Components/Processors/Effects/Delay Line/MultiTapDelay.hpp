@@ -0,0 +1,313 @@
+//  Assemble
+//  ============================
+//  Copyright © 2020 David Spry. All rights reserved.
+
+#ifndef MULTITAPDELAY_HPP
+#define MULTITAPDELAY_HPP
+
+#include "ASHeaders.h"
+#include "ASSIMD.h"
+#include "ASUtilities.h"
+#include "ASConstants.h"
+#include "ASParameters.h"
+#include "ASOscillators.h"
+#include "Clock.hpp"
+#include "DelayBuffer.hpp"
+
+/// \brief A delay line with feedback, whose channels are interleaved in one buffer and read by any number of taps,
+/// using interpolation in order to smoothly vary between delay lengths.
+///
+/// Each tap has its own delay time, and is heard in the channel that it reads. Its output is fed back into each channel
+/// in proportion to its route to that channel, so a tap that is routed to its own channel echoes in place, and a tap
+/// that is routed to another channel echoes across the stereo field, as in a ping-pong delay. Each channel receives
+/// the input in proportion to its send. Routes and sends glide to their targets, so that they can change without a click.
+///
+/// The taps share one buffer, one modulator, one modulation depth, and one input gain. The modulator is read at a
+/// distinct phase for each tap, which are spread evenly over its cycle, so that the taps are not modulated in unison.
+/// Every channel is processed in the same pass, in spans of frames. The taps of a span are read first, then the input
+/// and the feedback of every channel are mixed in one SIMD pass over the interleaved frames of the span.
+///
+/// The buffer is sized to the longest delay that it needs, which is reserved off the audio thread with `reserve` and
+/// adopted by the audio thread with `adopt`, as described by `DelayBuffer`. No buffer is allocated until one is
+/// reserved, and while the delay line has no buffer, it passes its input through unchanged.
+///
+/// The delay line runs at a multiple of its Clock's sample rate, which is the oversampling factor by default. A delay
+/// line that is oversampled reads its modulated taps with Hermite interpolation, which would attenuate and alias the
+/// upper octave of the signal at the base rate. A delay line that runs at the base rate reads them with a
+/// `SincInterpolator` instead, so that it needs neither the Oversamplers nor a buffer of oversampled samples.
+
+class MultiTapDelay
+{
+public:
+    /// \brief The number of channels, which are the left and right channels.
+
+    constexpr static int channels = 2;
+
+    /// \brief The number of taps. Tap `t` reads channel `t % channels`.
+
+    constexpr static int taps = 2;
+
+public:
+    /// \brief Initialise the delay line with a Clock who should define its tempo
+    /// \param clock The Clock
+    /// \param factor The factor by which the delay line's sample rate exceeds the Clock's
+
+    MultiTapDelay(Clock *clock, const int factor = OVERSAMPLING);
+
+    /// \brief Consume the next sample of each channel and replace it with the output of the delay line
+    /// \param lsample The next sample of the left channel
+    /// \param rsample The next sample of the right channel
+
+    inline void process(float& lsample, float& rsample) noexcept
+    {
+        process(&lsample, &rsample, 1);
+    }
+
+    /// \brief Process a block of each channel in place
+    /// \param lsamples The samples of the left channel
+    /// \param rsamples The samples of the right channel
+    /// \param count The number of samples in each channel
+
+    void process(float* lsamples, float* rsamples, const int count) noexcept;
+
+    /// \brief Get a parameter value from the given tap
+    /// \param parameter The hexadecimal address of the desired parameter
+    /// \param tap The index of the tap
+
+    const float get(uint64_t parameter, const int tap = 0);
+
+    /// \brief Set a parameter value for every tap
+    /// \param parameter The hexadecimal address of the target parameter
+    /// \param value The value to set for the given parameter
+
+    void set(uint64_t parameter, float value);
+
+    /// \brief Set the delay time of the given tap as a factor of musical time
+    /// \param time A factor of musical time, such as 0.5, 1.0, or 2.5
+    /// \param tap The index of the tap
+
+    void setInMusicalTime(const float time, const int tap);
+
+    /// \brief Set the delay time of the given tap from the index of a musical time factor, as in `kDelayMusicalTime`
+    /// \param index The index of the musical time factor
+    /// \param tap The index of the tap
+
+    void setMusicalTimeIndex(const int index, const int tap);
+
+    /// \brief Inject a delay of the given number of milliseconds into the given tap's delay time.
+    /// When the taps of the left and right channels are combined for a stereo effect, injecting a 3-5
+    /// millisecond offset into one of them creates a wider effect.
+    /// \param milliseconds The number of milliseconds to inject
+    /// \param tap The index of the tap
+
+    void inject(const int milliseconds, const int tap);
+
+    /// \brief Route the feedback of the given tap to the given channel, such that it is no longer fed back into any other channel.
+    /// \param tap The index of the tap
+    /// \param channel The channel that the tap should be fed back into
+
+    void route(const int tap, const int channel);
+
+    /// \brief Set the level at which the given channel receives the input.
+    /// \param channel The channel
+    /// \param level The level of the input, in [0, 1]
+
+    inline void send(const int channel, const float level)
+    {
+        sends[channel].target = Assemble::Utilities::bound(level, 0.F, 1.F);
+    }
+
+    /// \brief Reserve a buffer that can hold the given delay of each tap with the greatest modulation depth.
+    /// This should not be called from the audio thread.
+    /// \param seconds The duration of the longest delay of each tap, or 0 if the buffer can be freed once the delay line is silent
+
+    void reserve(const std::array<float, taps>& seconds);
+
+    /// \brief Free any buffer that the audio thread has given up. This should not be called from the audio thread.
+
+    inline void collect() { buffer.collect(); }
+
+    /// \brief Adopt the most recently reserved buffer if it can hold the current delay of every tap.
+    /// This is called by the audio thread before each block.
+
+    inline void adopt() noexcept
+    {
+        float longest = 0.F;
+        for (const Tap& tap : heads)
+            longest = std::max({longest, tap.delay.getValue(), tap.delay.getTarget()});
+
+        buffer.adopt(static_cast<int>(std::ceil(longest + headroom)), isSilent());
+    }
+
+    /// \brief Return the number of bytes allocated for the delay line's buffers.
+
+    inline const size_t bytes() const { return buffer.bytes(); }
+
+    /// \brief Seed the generator that randomises the phase of the modulator.
+    /// \param seed The seed of the generator
+
+    inline void seed(const uint64_t seed) { modulator.seed(seed); }
+
+    /// \brief Given an index, return the corresponding musical time factor.
+    /// \note Indices are expected to reach this function as a parameter value via the parameter system.
+    /// \param index The index whose corresponding musical time factor is being requested.
+    /// \returns A musical time factor, such as 1.0f or 0.5f, which is used to set the delay time.
+
+    static const float parseMusicalTimeParameterIndex(const int index);
+
+    /// \brief Set whether the delay line should consume new samples from its input.
+    /// \param status A flag to indicate whether the delay line should be bypassed or not.
+
+    inline bool toggle(const bool status)
+    {
+        return !(bypassed = !status);
+    }
+
+    /// \brief Indicate whether the delay line is bypassed and its tail has decayed, such that every
+    /// sample in its buffer is inaudible. While this is the case, it need not be processed.
+
+    inline const bool isSilent() const
+    {
+        return bypassed && quiet >= buffer.capacity();
+    }
+
+private:
+    /// \brief Synchronise the delay time of each tap with the Clock's tempo
+
+    inline void update()
+    {
+        for (int t = 0; t < taps; ++t)
+            setInMusicalTime(heads[t].time, t);
+    }
+
+    /// \brief Move the input gain towards 1 if the delay line is enabled, or towards 0 if it is bypassed.
+    /// \note   The pseudo-sinusoidal function f(x) = -(x^2 - 1.0)^2 + 1.0 is used to compute the gain.
+    /// \author Frederick
+    /// <https://www.musicdsp.org/en/latest/Other/166-cheap-pseudo-sinusoidal-lfo.html>
+
+    inline void fade()
+    {
+        const float target = bypassed ? 0.F : 1.F;
+        if (gainLinear == target) return;
+
+        gainLinear = bypassed ? std::max(0.F, gainLinear - taper) : std::min(1.F, gainLinear + taper);
+        gain = -(std::pow((std::pow(gainLinear, 2.F) - 1.F), 2.F)) + 1.F;
+    }
+
+private:
+    /// \brief A level that glides linearly to its target by `taper` per frame.
+
+    struct Level
+    {
+        float value  = 1.F;
+        float target = 1.F;
+
+        inline void glide(const float taper)
+        {
+            if (value != target)
+                value = target > value ? std::min(target, value + taper) : std::max(target, value - taper);
+        }
+    };
+
+    /// \brief The state of one tap, which reads one channel and feeds it back into each channel by its routes.
+
+    struct Tap
+    {
+        /// \brief The delay between the write head and the tap in frames, which glides from a short delay when the delay line is constructed.
+
+        ValueTransition delay;
+
+        /// \brief The distance between the write head and the tap in frames, including the modulation.
+
+        float distance = 0.F;
+
+        /// \brief The musical time factor of the delay, its index, and the offset injected into it in frames.
+
+        float time = fDelayQuarterNote;
+        int   index = 4;
+        int   offset = 0;
+
+        /// \brief The level at which the tap is fed back into each channel.
+
+        std::array<Level, channels> routes;
+
+        /// \brief The phase of the modulator at which the tap is read, where 2^32 is one cycle.
+
+        uint32_t phase = 0;
+    };
+
+private:
+    /// \brief The factor by which the delay line's sample rate exceeds its Clock's.
+
+    const int factor;
+
+    /// \brief The number of frames that the interpolation reads on each side of a tap.
+
+    const int reach;
+
+private:
+    /// \brief The read head of each tap.
+
+    std::array<Tap, taps> heads;
+
+    /// \brief The level at which each channel receives the input.
+
+    std::array<Level, channels> sends;
+
+    /// \brief The number of consecutive frames for which the input gain has been 0 and the output of
+    /// every tap has been inaudible. Once this reaches the capacity, the whole buffer is inaudible.
+
+    int quiet = 0;
+
+private:
+    float gain       = 1.00F;
+    float gainLinear = 1.00F;
+    std::atomic<float> mix      = 0.25F;
+    std::atomic<float> feedback = 0.55F;
+    std::atomic<bool>  bypassed = {false};
+
+private:
+    const float taper = 1E-4F * (1.0F / (float) factor);
+    constexpr static float silence = 1E-5F;
+
+    /// \brief The greatest number of frames that are read before they are written to the buffer as one block.
+
+    constexpr static int span = 64;
+
+    static_assert((span * channels) % Assemble::SIMD::width == 0, "A span of interleaved frames must fill whole SIMD lanes.");
+
+private:
+    DelayBuffer<channels> buffer;
+
+    uint16_t bpm;
+    Clock *  clock;
+
+private:
+    /// @brief The modulation depth in [1, 2], which is shared by every tap. This range should be normalised to [0, 1]
+    /// when interfacing with external classes.
+
+    ValueTransition modulation = {1.0F, 1.0F, 1.00F};
+
+    /// @brief The factor to scale the depth of the modulation, which is 512 samples at the oversampled rate.
+
+    const float scalar = 512.0F * (float) factor / (float) OVERSAMPLING;
+
+    /// @brief The number of frames that a buffer needs beyond the longest delay, which cover the modulation and the interpolation.
+
+    const float headroom = scalar + (float) (2 * reach);
+
+    /// @brief The frequency of the modulation, scaled by the delay line's rate factor.
+
+    const float modulationRate = 2.0F * (1.0F / (float) factor);
+
+    /// @brief The interpolator that reads the delay line at the base rate.
+
+    const SincInterpolator& sinc = SincInterpolator::shared();
+
+    /// @brief The sine wavetable oscillator that modulates the position of every tap. Its phase is a fixed-point
+    /// accumulator, which keeps the very small increment of the oscillator exact at the oversampled rate.
+
+    FixedPointOscillator<SIN> modulator = {modulationRate};
+};
+
+#endif
@@ -0,0 +1,165 @@
+//  Assemble
+//  ============================
+//  Copyright © 2020 David Spry. All rights reserved.
+
+#ifndef RINGBUFFER_HPP
+#define RINGBUFFER_HPP
+
+#include "ASHeaders.h"
+#include "ASUtilities.h"
+#include "SincInterpolator.hpp"
+
+/// \brief A circular buffer of frames, each of which holds one sample of each of its `Channels` channels, interleaved.
+/// The buffer is a view of storage that is owned elsewhere, as by `DelayBuffer` or `Vibrato`, so that it can be
+/// replaced on the audio thread without allocating.
+///
+/// The capacity is a power of two, so indices wrap with a mask rather than a comparison or a division. The frames
+/// are preceded by `Guard` guard frames, which mirror the last frames of the buffer, and followed by `Guard` guard
+/// frames, which mirror its first frames, as with the guard samples of `WaveTableSet`. Interpolation can then read
+/// up to `Guard` frames on each side of any frame without wrapping. The guards are kept by `write`, which costs a
+/// second store per sample, or once per block for a block of frames.
+
+template <int Channels = 1, int Guard = 2>
+class RingBuffer
+{
+public:
+    /// \brief Return the number of samples of storage that a buffer of the given capacity needs, including its guards.
+    /// \param capacity The capacity of the buffer in frames, which is a power of two of at least `minimum`
+
+    constexpr static size_t length(const int capacity)
+    {
+        return static_cast<size_t>(capacity + 2 * Guard) * Channels;
+    }
+
+    /// \brief The least capacity of a buffer, such that its two guards do not mirror the same frame.
+
+    constexpr static int minimum = 2 * Guard;
+
+public:
+    /// \brief Use the given storage, which should hold `length(capacity)` samples, and move the write head to its first frame.
+    /// \param storage The storage, or `nullptr` if the capacity is 0
+    /// \param capacity The capacity of the buffer in frames
+
+    inline void attach(float* storage, const int capacity) noexcept
+    {
+        frames = storage == nullptr ? nullptr : storage + Guard * Channels;
+        size   = capacity;
+        mask   = capacity - 1;
+        whead  = 0;
+    }
+
+    /// \brief Return the number of frames in the buffer.
+
+    inline const int capacity() const noexcept { return size; }
+
+    /// \brief Return the index of the frame that will be written next.
+
+    inline const int head() const noexcept { return whead; }
+
+    /// \brief Return the sample of the given channel at the given frame, whose index wraps.
+
+    inline const float at(const int index, const int channel = 0) const noexcept
+    {
+        return frames[(index & mask) * Channels + channel];
+    }
+
+    /// \brief Write the next frame, which holds one sample of each channel, and its mirror in the guards.
+
+    inline void write(const float* frame) noexcept
+    {
+        const int mirror = whead + size * (static_cast<int>(whead < Guard) - static_cast<int>(whead >= size - Guard));
+
+        for (int c = 0; c < Channels; ++c)
+        {
+            frames[whead  * Channels + c] = frame[c];
+            frames[mirror * Channels + c] = frame[c];
+        }
+
+        whead = (whead + 1) & mask;
+    }
+
+    /// \brief Write the given block of interleaved frames in at most two contiguous spans, then refresh the guards that mirror them.
+    /// \param block The frames to write
+    /// \param count The number of frames to write, which should not exceed the capacity
+
+    inline void write(const float* block, const int count) noexcept
+    {
+        const int first = std::min(count, size - whead);
+        std::copy(block, block + first * Channels, frames + whead * Channels);
+        std::copy(block + first * Channels, block + count * Channels, frames);
+
+        const int end = whead + count;
+        if (whead < Guard || end > size)
+            std::copy(frames, frames + Guard * Channels, frames + size * Channels);
+        if (end > size - Guard)
+            std::copy(frames + (size - Guard) * Channels, frames + size * Channels, frames - Guard * Channels);
+
+        whead = end & mask;
+    }
+
+    /// \brief Return the sample of the given channel at the given distance before the next write, using Hermite interpolation.
+    /// \param distance The distance in frames, in the range [3, capacity - 2]
+    /// \param channel The channel
+
+    inline const float read(const float distance, const int channel = 0) const noexcept
+    {
+        const auto [a, k] = locate(distance);
+
+        if constexpr (Channels == 1)
+            return Assemble::Utilities::hermite(frames, a, k);
+
+        else
+        {
+            const float* x = frames + a * Channels + channel;
+            const float  y[4] = { x[-Channels], x[0], x[Channels], x[2 * Channels] };
+            return Assemble::Utilities::hermite(y, 1, k);
+        }
+    }
+
+    /// \brief Return the sample of the given channel at the given distance before the next write, using the given
+    /// windowed-sinc interpolator. The samples of a buffer with one channel are read in place.
+    /// \param distance The distance in frames, in the range [taps / 2 + 1, capacity - taps / 2]
+    /// \param interpolator The interpolator
+    /// \param channel The channel
+
+    inline const float read(const float distance, const SincInterpolator& interpolator, const int channel = 0) const noexcept
+    {
+        constexpr int taps = SincInterpolator::taps;
+        static_assert(Guard >= taps / 2, "The guards must span half of the interpolator's taps.");
+
+        const auto [a, k] = locate(distance);
+        const int first = a - (taps / 2 - 1);
+
+        if constexpr (Channels == 1)
+            return interpolator.interpolate(frames + first, k);
+
+        else
+        {
+            alignas(32) float x[taps];
+            for (int j = 0; j < taps; ++j) x[j] = frames[(first + j) * Channels + channel];
+
+            return interpolator.interpolate(x, k);
+        }
+    }
+
+private:
+    /// \brief Return the index of the frame before the given distance from the next write, and the fraction between it and the next frame.
+
+    inline const std::pair<int, float> locate(const float distance) const noexcept
+    {
+        float position = static_cast<float>(whead) - distance;
+        position = position + static_cast<float>(position < 0.F) * static_cast<float>(size);
+
+        const int   a = static_cast<int>(position);
+        const float k = position - static_cast<float>(a);
+        return { a & mask, k };
+    }
+
+private:
+    float* frames = nullptr;
+    int    size   = 0;
+    int    mask   = -1;
+    int    whead  = 0;
+};
+
+#endif
@@ -0,0 +1,69 @@
+//  Assemble
+//  ============================
+//  Copyright © 2020 David Spry. All rights reserved.
+
+#include "SincInterpolator.hpp"
+#include "ASConstants.h"
+
+const SincInterpolator& SincInterpolator::shared()
+{
+    static const SincInterpolator interpolator;
+    return interpolator;
+}
+
+/// \brief The zeroth-order modified Bessel function of the first kind, which shapes the Kaiser window.
+
+static double bessel(const double x)
+{
+    double sum = 1.0, term = 1.0;
+    for (int k = 1; k < 32; ++k)
+    {
+        term = term * (x * 0.5 / k) * (x * 0.5 / k);
+        sum  = sum + term;
+    }
+
+    return sum;
+}
+
+SincInterpolator::SincInterpolator()
+{
+    constexpr int half = taps / 2;
+    constexpr int bins = 512;
+
+    kernel.resize((phases + 1) * taps);
+    std::vector<double> row(taps);
+
+    for (int p = 0; p <= phases; ++p)
+    {
+        const double fraction = static_cast<double>(p) / phases;
+
+        for (int j = 0; j < taps; ++j)
+        {
+            const double t = static_cast<double>(j - (half - 1)) - fraction;
+            const double x = 2.0 * cutoff * t;
+            const double r = t / half;
+            const double sinc   = t == 0.0 ? 1.0 : std::sin(PI * x) / (PI * x);
+            const double window = bessel(beta * std::sqrt(std::max(0.0, 1.0 - r * r))) / bessel(beta);
+            row[j] = 2.0 * cutoff * sinc * window;
+        }
+
+        /// The gain of the phase at each frequency, which is greatest in the passband's ripple.
+
+        double peak = 0.0;
+        for (int b = 0; b <= bins; ++b)
+        {
+            const double w = PI * b / bins;
+            double re = 0.0, im = 0.0;
+            for (int j = 0; j < taps; ++j)
+            {
+                re = re + row[j] * std::cos(w * j);
+                im = im - row[j] * std::sin(w * j);
+            }
+
+            peak = std::max(peak, std::sqrt(re * re + im * im));
+        }
+
+        for (int j = 0; j < taps; ++j)
+            kernel[p * taps + j] = static_cast<float>(row[j] / peak);
+    }
+}
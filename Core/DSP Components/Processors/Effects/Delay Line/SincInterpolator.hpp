@@ -0,0 +1,86 @@
+//  Assemble
+//  ============================
+//  Copyright © 2020 David Spry. All rights reserved.
+
+#ifndef SINCINTERPOLATOR_HPP
+#define SINCINTERPOLATOR_HPP
+
+#include "ASSIMD.h"
+#include "ASHeaders.h"
+
+/// \brief A windowed-sinc interpolator, which reads a signal between its samples without the attenuation and the
+/// aliasing of polynomial interpolation near the Nyquist frequency, so that a modulated delay line can be read at the
+/// sample rate of its input rather than oversampled.
+///
+/// The kernel is a sinc function with a Kaiser window, which is tabulated at `phases + 1` fractions between samples
+/// and interpolated linearly between them. Each phase is normalised so that its gain is at most 1 at every frequency,
+/// so that a delay line with a feedback of 1 cannot grow. The passband is flat to within 0.01dB up to 0.42 of the
+/// sample rate, or 20kHz at 48kHz, and the stopband begins at 0.5 of the sample rate.
+
+class SincInterpolator
+{
+public:
+    /// \brief The number of samples on which each interpolated sample depends, which are the `taps / 2` samples
+    /// at and before the position, and the `taps / 2` samples after it.
+
+    constexpr static int taps = 64;
+
+    /// \brief The number of fractions between samples at which the kernel is tabulated.
+
+    constexpr static int phases = 128;
+
+    /// \brief Return the interpolator shared by every delay line, which is computed on its first call.
+    /// This should not be first called on the audio thread.
+
+    static const SincInterpolator& shared();
+
+public:
+    /// \brief Interpolate the given samples at the given fraction between the sample at index `taps / 2 - 1`
+    /// and the sample that follows it.
+    /// \param x The `taps` consecutive samples around the position
+    /// \param fraction The fraction between the samples in [0, 1]
+
+    inline const float interpolate(const float* x, const float fraction) const noexcept
+    {
+        using namespace Assemble;
+        using Lanes = SIMD::Lanes;
+
+        const float position = fraction * static_cast<float>(phases);
+        const int   phase    = std::min(static_cast<int>(position), phases - 1);
+        const float weight   = position - static_cast<float>(phase);
+
+        const float* a = kernel.data() + phase * taps;
+        const float* b = a + taps;
+
+        Lanes sa = {}, sb = {};
+        for (int j = 0; j < taps; j += SIMD::width)
+        {
+            const Lanes s = SIMD::load(x + j);
+            sa = sa + s * SIMD::load(a + j);
+            sb = sb + s * SIMD::load(b + j);
+        }
+
+        const Lanes sum = sa + (sb - sa) * SIMD::broadcast(weight);
+
+        float sample = 0.F;
+        for (int l = 0; l < SIMD::width; ++l)
+            sample = sample + SIMD::lane(sum, l);
+
+        return sample;
+    }
+
+private:
+    SincInterpolator();
+
+private:
+    /// \brief The coefficients of each phase, which are applied to the samples in order.
+
+    std::vector<float> kernel;
+
+    /// \brief The cutoff of the sinc function and the shape of the Kaiser window.
+
+    constexpr static double cutoff = 0.46;
+    constexpr static double beta   = 8.0;
+};
+
+#endif
@@ -13,13 +13,58 @@ const float StereoDelay::get(uint64_t parameter)
     switch (parameter)
     {
         case kStereoDelayToggle: return static_cast<float>(!bypassed);
-        case kStereoDelayLTime:  return ldelay.get(kDelayMusicalTime);
-        case kStereoDelayRTime:  return rdelay.get(kDelayMusicalTime);
+        case kStereoDelayLTime:  return delay.get(kDelayMusicalTime, 0);
+        case kStereoDelayRTime:  return delay.get(kDelayMusicalTime, 1);
         case kStereoDelayOffset: return offsetInMs;
-        default:                 return ldelay.get(parameter);
+        case kStereoDelayPingPong: return static_cast<float>(pingPong.load());
+        default:                 return delay.get(parameter);
     }
 }
 
+void StereoDelay::prepare(uint64_t parameter, const float value)
+{
+    switch (parameter)
+    {
+        case kClockBPM:          bpm = std::max(1, static_cast<int>(value)); break;
+        case kStereoDelayToggle: enabled = static_cast<bool>(value); break;
+        case kStereoDelayOffset: offset = value; break;
+        case kDelayTimeInMs:
+        {
+            const int time = (int) std::floor(Assemble::Utilities::bound(value, 0.F, 4000.F));
+            for (Extent& extent : extents) extent = {false, extent.time, time};
+            break;
+        }
+        case kDelayMusicalTime:
+        {
+            const float time = MultiTapDelay::parseMusicalTimeParameterIndex(static_cast<int>(value));
+            for (Extent& extent : extents) extent = {true, time, extent.milliseconds};
+            break;
+        }
+        case kStereoDelayLTime: extents[0] = {true, MultiTapDelay::parseMusicalTimeParameterIndex(static_cast<int>(value)), extents[0].milliseconds}; break;
+        case kStereoDelayRTime: extents[1] = {true, MultiTapDelay::parseMusicalTimeParameterIndex(static_cast<int>(value)), extents[1].milliseconds}; break;
+        default: return;
+    }
+
+    reserve();
+}
+
+/// \brief Reserve the buffer for the delay time of each channel, and the right channel's injected offset too.
+/// While the StereoDelay is disabled, the buffer is freed once the delay line is silent.
+
+void StereoDelay::reserve()
+{
+    std::array<float, MultiTapDelay::taps> seconds;
+    for (int c = 0; c < MultiTapDelay::taps; ++c)
+    {
+        const Extent& extent = extents[c];
+        seconds[c] = extent.musical ? 60.F / static_cast<float>(bpm) * extent.time : extent.milliseconds * 1E-3F;
+        seconds[c] = seconds[c] + (c == 1 ? offset * 1E-3F : 0.F);
+        seconds[c] = enabled ? seconds[c] : 0.F;
+    }
+
+    delay.reserve(seconds);
+}
+
 /// \brief Set the parameters of the Stereo Delay
 /// \param parameter The hexadecimal address of the parameter
 /// \param value The value to set for the selected parameter
@@ -31,8 +76,7 @@ void StereoDelay::set(uint64_t parameter, const float value)
         case kStereoDelayToggle:
         {
             const bool status = static_cast<bool>(value);
-            rdelay.toggle(status);
-            ldelay.toggle(status);
+            delay.toggle(status);
             bypassed = !status;
             return;
         }
@@ -43,13 +87,11 @@ void StereoDelay::set(uint64_t parameter, const float value)
         case kDelayModulation:
         case kDelayMusicalTime:
         {
-            ldelay.set(parameter, value);
-            rdelay.set(parameter, value);
-            return;
+            return delay.set(parameter, value);
         }
             
-        case kStereoDelayLTime: { return ldelay.set(kDelayMusicalTime, value); }
-        case kStereoDelayRTime: { return rdelay.set(kDelayMusicalTime, value); }
+        case kStereoDelayLTime: { return delay.setMusicalTimeIndex(static_cast<int>(value), 0); }
+        case kStereoDelayRTime: { return delay.setMusicalTimeIndex(static_cast<int>(value), 1); }
         case kStereoDelayOffset:
         {
             inject(value, false);
@@ -57,6 +99,19 @@ void StereoDelay::set(uint64_t parameter, const float value)
             return;
         }
 
+        /// \brief In ping-pong mode, the input is sent to the left channel alone, and each channel's echo is fed
+        /// back into the other channel, so that the echoes alternate between the channels.
+
+        case kStereoDelayPingPong:
+        {
+            const bool status = static_cast<bool>(value);
+            delay.route(0, status ? 1 : 0);
+            delay.route(1, status ? 0 : 1);
+            delay.send(1, status ? 0.F : 1.F);
+            pingPong = status;
+            return;
+        }
+
         default: return;
     }
 }
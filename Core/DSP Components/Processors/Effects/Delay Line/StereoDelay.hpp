@@ -6,18 +6,27 @@
 #ifndef STEREODELAY_H
 #define STEREODELAY_H
 
-#include "Delay.hpp"
+#include "MultiTapDelay.hpp"
 #include "ASHeaders.h"
 #include "ASParameters.h"
 
-/// \brief A stereo delay effect using two Delays
+/// \brief A stereo delay effect, whose left and right channels are the two taps of a `MultiTapDelay`. Each tap echoes
+/// in its own channel, or, in ping-pong mode, in the other channel.
+///
+/// Parameters are applied to the delay line on the audio thread. Each parameter is also given to `prepare` on the UI thread
+/// before it is sent, which tracks the settings that determine the length of each channel and reserves the buffer, so that
+/// a longer buffer is offered to the audio thread before the parameter that needs it is applied.
 
 class StereoDelay
 {
 public:
-    StereoDelay(Clock *clock) :
-    ldelay(clock),
-    rdelay(clock)
+    /// \brief Initialise the StereoDelay with a Clock who should define its tempo
+    /// \param clock The Clock
+    /// \param factor The factor by which the sample rate of the delay line exceeds the Clock's
+
+    StereoDelay(Clock *clock, const int factor = OVERSAMPLING) :
+    delay(clock, factor),
+    bpm(static_cast<int>(clock->get(kClockBPM)))
     {
         inject(offsetInMs, static_cast<bool>(0));
     }
@@ -29,26 +38,101 @@ public:
 
     inline void process(float & lsample, float & rsample)
     {
-        ldelay.process(lsample);
-        rdelay.process(rsample);
+        delay.process(lsample, rsample);
+    }
+
+    /// \brief Process a block of the left and right channels in place
+    /// \param lsamples The samples of the left stereo channel
+    /// \param rsamples The samples of the right stereo channel
+    /// \param count The number of samples in each channel
+
+    inline void process(float* lsamples, float* rsamples, const int count)
+    {
+        delay.process(lsamples, rsamples, count);
     }
     
+    /// \brief Indicate whether the delay line is bypassed and its tail has decayed.
+
+    inline const bool isSilent() const
+    {
+        return delay.isSilent();
+    }
+
+    /// \brief Adopt the most recently reserved buffer of the delay line. This is called by the audio thread before each block.
+
+    inline void adopt() noexcept
+    {
+        delay.adopt();
+    }
+
+    /// \brief Return the number of bytes allocated for the buffers of the delay line, including any buffers
+    /// that have been given up by the audio thread but not yet freed by `collect`.
+
+    inline const size_t bytes() const { return delay.bytes(); }
+
+    /// \brief Free any buffer that the audio thread has given up. This should not be called from the audio thread.
+
+    inline void collect()
+    {
+        delay.collect();
+    }
+
+public:
+    /// \brief Track the given parameter, which is about to be sent to the audio thread, and reserve the buffer
+    /// of the delay line for the length that it implies. This should be called on the UI thread.
+    /// Parameters that do not affect the length of the delay line are ignored. Buffers that the audio thread has
+    /// given up are freed when the next buffer is reserved, or by `collect`.
+    /// \param parameter The hexadecimal address of the parameter
+    /// \param value The value of the parameter
+
+    void prepare(uint64_t parameter, const float value);
+
+    /// \brief Reserve the buffer of the delay line for the settings tracked by `prepare`, as when the sample rate changes.
+    /// This should not be called from the audio thread.
+
+    void reserve();
+
 public:
     const float get(uint64_t parameter);
     void set(uint64_t parameter, const float value);
-    void set(float time, const bool left) { left ? ldelay.setInMusicalTime(time) : rdelay.setInMusicalTime(time); }
+    void set(float time, const bool left) { delay.setInMusicalTime(time, left ? 0 : 1); }
 
 public:    
     void inject(int milliseconds, const bool left)
-    { left ? ldelay.inject(milliseconds) : rdelay.inject(milliseconds); }
+    { delay.inject(milliseconds, left ? 0 : 1); }
+
+    /// \brief Seed the modulator of the delay line with a value derived from the given seed.
+    /// \param seed The seed of the StereoDelay
+
+    void seed(const uint64_t seed)
+    {
+        delay.seed(Assemble::Random::split(seed, 0));
+    }
 
 private:
-    Delay ldelay;
-    Delay rdelay;
+    MultiTapDelay delay;
     
 private:
     std::atomic<bool>  bypassed = {false};
     std::atomic<float> offsetInMs = 4.F;
+    std::atomic<bool>  pingPong = {false};
+
+private:
+    /// \brief The delay time of one channel, as tracked by `prepare`, in musical time or in milliseconds.
+
+    struct Extent
+    {
+        bool  musical = true;
+        float time = fDelayQuarterNote;
+        int   milliseconds = 0;
+    };
+
+    /// \brief The settings tracked by `prepare`, which are only accessed on the UI thread.
+
+    std::array<Extent, 2> extents;
+    int   bpm;
+    float offset = 4.F;
+    bool  enabled = true;
     
 };
 
@@ -6,9 +6,8 @@
 
 Vibrato::Vibrato()
 {
-    capacity = 256;
-    samples.reserve(capacity);
-    samples.assign (capacity, 0.F);
+    samples.assign(RingBuffer<>::length(capacity), 0.F);
+    ring.attach(samples.data(), capacity);
     
     set(kVibratoSpeed, 3.00F);
     set(kVibratoDepth, 0.15F);
@@ -71,20 +70,28 @@ inline void Vibrato::update()
 
 void Vibrato::process(float& sample)
 {
-    update();
+    process(&sample, 1);
+}
 
-    samples[whead] = sample;
+void Vibrato::process(float* buffer, const int count)
+{
+    for (int t = 0, n = 0; t < count; t += n)
+    {
+        n = std::min(count - t, span);
+        ring.write(buffer + t, n);
 
-    sample = Assemble::Utilities::hermite(rhead, samples.data(), capacity);
-    
-    whead = whead + 1;
-    whead = static_cast<int>(whead < capacity) * whead;
+        /// The buffer's write head is at the end of the span, so the distance to the read head is lengthened by `n - k`.
 
-    rhead = whead - depth + depth * modulator.nextSample();
-    rhead = rhead - 5.0F;
-    
-    while (rhead < 0)         rhead = rhead + capacity;
-    while (rhead >= capacity) rhead = rhead - capacity;
+        for (int k = 0; k < n; ++k)
+        {
+            update();
+
+            buffer[t + k] = ring.read(distance + static_cast<float>(n - k));
+
+            const float depth = this->depth.load();
+            distance = depth - depth * modulator.nextSample() + 5.0F;
 
-    if (!portamento.complete()) modulator.update (portamento.get());
+            if (!portamento.complete()) modulator.update (portamento.get());
+        }
+    }
 }
@@ -10,6 +10,13 @@
 #include "ASUtilities.h"
 #include "ASParameters.h"
 #include "ASOscillators.h"
+#include "RingBuffer.hpp"
+
+/// \brief A vibrato that reads a `RingBuffer` at a distance modulated by a sinusoid.
+///
+/// A block is processed in spans of at most `span` samples. Each span is written to the buffer as one block, then
+/// read back sample by sample. The read head is at least 5 samples behind the sample being read, so it never reaches
+/// a sample of the span that comes later, and the buffer holds more than a span beyond the deepest modulation.
 
 class Vibrato
 {
@@ -18,16 +25,27 @@ public:
 
 public:
     void process(float& sample);
+
+    /// \brief Process a block of samples in place
+    /// \param buffer The samples to process
+    /// \param count The number of samples in the buffer
+
+    void process(float* buffer, const int count);
     
 public:
     void setSampleRate(float sampleRate);
     void set(uint64_t parameter, float value);
     const float get(uint64_t parameter);
 
+    /// \brief Seed the generator that randomises the phase of the Vibrato's modulator.
+    /// \param seed The seed of the generator
+
+    inline void seed(const uint64_t seed) { modulator.seed(seed); }
+
 private:
     std::atomic<bool>  bypassed = {false};
     std::atomic<float> speed;
-    std::atomic<float> depth;
+    std::atomic<float> depth = {0.F};
     std::atomic<float> targetDepth;
     std::atomic<float> depthNormal;
     
@@ -41,18 +59,22 @@ private:
     void update();
 
 private:
-    int   whead = 0;
-    float rhead;
+    /// \brief The distance from the sample being read to the read head in samples.
+
+    float distance = 5.0F;
     
 private:
     constexpr static float scale = 1.00F;
     constexpr static float taper = 0.01F;
     constexpr static float scalar = 125.0F;
+
+    constexpr static int capacity = 512;
+    constexpr static int span = 128;
     
 private:
-    int capacity;
     float sampleRate = 48000.F;
     std::vector<float> samples;
+    RingBuffer<> ring;
 };
 
 #endif
@@ -58,33 +58,11 @@ void HuovilainenFilter::set(uint64_t parameter, float value)
     }
 }
 
-/// \brief An approximation of the tanh function.
-/// \author John Fitch
-
-float HuovilainenFilter::quicktanh(float x)
-{
-    float sign = x < 0 ? -1.0F : 1.0F;
-    
-    x = std::abs(x);
-    if (x >= 4.0F) return sign;
-    if (x <  0.5F) return sign * x;
-    return sign * std::tanh(x);
-}
-
 void HuovilainenFilter::set(const float frequency, const float resonance)
 {
     this->frequency = Assemble::Utilities::bound(frequency, 0.F, 20E3F);
     this->resonance = Assemble::Utilities::bound(resonance, 0.F, 1.00F);
-
-    const float cutoff = frequency / sampleRate;
-    const float oversampledCutoff = cutoff * 0.5F;
-    const float cutoffSquared = cutoff * cutoff;
-    const float cutoffCubed = cutoffSquared * cutoff;
-    const float F = 1.873F * cutoffCubed + 0.4955F * cutoffSquared - 0.649F * cutoff + 0.9988F;
-
-    A = -3.9364F * cutoffSquared + 1.8409F * cutoff + 0.9968F;
-    G = (1.0F - std::exp(-(TWO_PI * oversampledCutoff * F))) / thermal;
-    resonanceFour = 2.0F * (resonance * A);
+    coefficients(frequency, resonance, sampleRate, G, A, resonanceFour);
 }
 
 const float HuovilainenFilter::process(float sample)
@@ -34,9 +34,63 @@ public:
     void set(const float frequency, const float resonance);
     void setSampleRate(float sampleRate) { this->sampleRate = sampleRate; }
 
+public:
+    /// \brief Compute the coefficients of the filter for the given cutoff frequency and resonance.
+    /// \param frequency The cutoff frequency in Hertz
+    /// \param resonance The resonance, from 0 to 1
+    /// \param sampleRate The sample rate in Hertz
+
+    static inline void coefficients(const float frequency, const float resonance, const float sampleRate,
+                                    float& G, float& A, float& resonanceFour)
+    {
+        A = compensation(frequency, sampleRate);
+        G = gain(frequency, sampleRate);
+        resonanceFour = 2.0F * (resonance * A);
+    }
+
+    /// \brief Compute the gain coefficient, G, of the filter for the given cutoff frequency.
+    /// This is the only coefficient that requires an exponential.
+
+    static inline float gain(const float frequency, const float sampleRate)
+    {
+        const float cutoff = frequency / sampleRate;
+        const float oversampledCutoff = cutoff * 0.5F;
+        const float cutoffSquared = cutoff * cutoff;
+        const float cutoffCubed = cutoffSquared * cutoff;
+        const float F = 1.873F * cutoffCubed + 0.4955F * cutoffSquared - 0.649F * cutoff + 0.9988F;
+
+        return (1.0F - std::exp(-(TWO_PI * oversampledCutoff * F))) / thermal;
+    }
+
+    /// \brief Compute the resonance compensation coefficient, A, of the filter for the given cutoff frequency.
+
+    static inline float compensation(const float frequency, const float sampleRate)
+    {
+        const float cutoff = frequency / sampleRate;
+        const float cutoffSquared = cutoff * cutoff;
+
+        return -3.9364F * cutoffSquared + 1.8409F * cutoff + 0.9968F;
+    }
+
+    /// \brief An approximation of the tanh function.
+    /// \author John Fitch
+
+    static inline float quicktanh(float x)
+    {
+        float sign = x < 0 ? -1.0F : 1.0F;
+
+        x = std::abs(x);
+        if (x >= 4.0F) return sign;
+        if (x <  0.5F) return sign * x;
+        return sign * std::tanh(x);
+    }
+
+    /// \brief The thermal voltage scale of the ladder's transistors.
+
+    constexpr static float thermal = 25E-6F;
+
 private:
     void initialise();
-    inline float quicktanh(float);
     
 private:
     float sampleRate = 48000.F;
@@ -54,7 +108,6 @@ private:
 private:
     float G = 0.0F;
     float A = 0.0F;
-    float thermal = 25E-6F;
     float resonanceFour = 0.0F;
 
 private:
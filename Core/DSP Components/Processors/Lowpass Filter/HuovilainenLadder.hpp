@@ -0,0 +1,139 @@
+//  Assemble
+//  ============================
+//  Copyright © 2020 David Spry. All rights reserved.
+//
+//  Source: The rational approximation of tanh uses the single-precision coefficients of Eigen's `ptanh`
+//  <https://gitlab.com/libeigen/eigen/-/blob/master/Eigen/src/Core/MathFunctionsImpl.h>
+//
+//  License: Mozilla Public License v2.0
+//  <https://www.mozilla.org/en-US/MPL/2.0/>
+
+#ifndef HUOVILAINENLADDER_HPP
+#define HUOVILAINENLADDER_HPP
+
+#include "ASSIMD.h"
+#include "ASHeaders.h"
+#include "HuovilainenFilter.hpp"
+
+/// \brief The ladder of the Huovilainen filter, computed for `SIMD::width` filters at once.
+///
+/// Each lane is equivalent to the ladder of a `HuovilainenFilter`, whose coefficients are given with each sample.
+/// The nonlinearity of each stage is either `HuovilainenFilter::quicktanh`, which is computed for each lane in turn
+/// and reproduces the scalar filter exactly, or a vectorised equivalent, whose tanh is a rational approximation.
+/// The two differ only where quicktanh calls `std::tanh`, where the approximation is accurate to about 4E-7.
+
+class HuovilainenLadder
+{
+    using Lanes = Assemble::SIMD::Lanes;
+
+public:
+    HuovilainenLadder() { reset(); }
+
+public:
+    /// \brief Compute the next sample of each lane.
+    /// \tparam exact Whether the nonlinearity should be computed for each lane with `HuovilainenFilter::quicktanh`
+    /// \param sample The input to each lane
+    /// \param G The gain coefficient of each lane
+    /// \param resonanceFour The feedback coefficient of each lane
+
+    template <bool exact>
+    inline const Lanes process(Lanes sample, const Lanes G, const Lanes resonanceFour) noexcept
+    {
+        const Lanes half    = Assemble::SIMD::broadcast(0.5F);
+        const Lanes thermal = Assemble::SIMD::broadcast(HuovilainenFilter::thermal);
+
+        /// As in `HuovilainenFilter::process`, the second of the two oversampled steps
+        /// is driven by the output of the third stage rather than by the input.
+
+        for (int oversampling = 0; oversampling < 2; ++oversampling)
+        {
+            sample = sample - resonanceFour * delay[5];
+            delay[0] = delay[0] + G * (saturate<exact>(sample * thermal) - tanhStage[0]);
+            tanhStage[0] = saturate<exact>(delay[0] * thermal);
+            delay[1] = delay[1] + G * (tanhStage[0] - tanhStage[1]);
+            tanhStage[1] = saturate<exact>(delay[1] * thermal);
+            delay[2] = delay[2] + G * (tanhStage[1] - tanhStage[2]);
+            tanhStage[2] = saturate<exact>(delay[2] * thermal);
+            delay[3] = delay[3] + G * (tanhStage[2] - saturate<exact>(delay[3] * thermal));
+            delay[5] = half * (delay[3] + delay[4]);
+            delay[4] = delay[3];
+            sample = delay[2];
+        }
+
+        return delay[5];
+    }
+
+    /// \brief Clear the state of each lane.
+
+    void reset()
+    {
+        std::fill(delay.begin(), delay.end(), Lanes{});
+        std::fill(tanhStage.begin(), tanhStage.end(), Lanes{});
+    }
+
+    /// \brief Copy the state of one lane from another ladder.
+    /// \param source The ladder whose state should be copied
+    /// \param lane The index of the lane
+
+    void copy(const HuovilainenLadder& source, const int lane)
+    {
+        using Assemble::SIMD::set;
+        for (size_t s = 0; s < delay.size(); ++s)
+            set(delay[s], lane, Assemble::SIMD::lane(source.delay[s], lane));
+
+        for (size_t s = 0; s < tanhStage.size(); ++s)
+            set(tanhStage[s], lane, Assemble::SIMD::lane(source.tanhStage[s], lane));
+    }
+
+public:
+    /// \brief Compute `HuovilainenFilter::quicktanh` for each lane, using a rational approximation of tanh.
+    /// Like quicktanh, it returns its input when every lane is in the linear region, which is the usual case.
+
+    static inline const Lanes quicktanh(const Lanes x) noexcept
+    {
+        using namespace Assemble::SIMD;
+        const Lanes magnitude = abs(x);
+        const Mask  linear = mask(magnitude < broadcast(0.5F));
+        if (!any(~linear)) return x;
+
+        const Lanes x2 = x * x;
+
+        Lanes p = broadcast(-2.76076847742355E-16F);
+        p = p * x2 + 2.00018790482477E-13F;
+        p = p * x2 - 8.60467152213735E-11F;
+        p = p * x2 + 5.12229709037114E-08F;
+        p = p * x2 + 1.48572235717979E-05F;
+        p = p * x2 + 6.37261928875436E-04F;
+        p = p * x2 + 4.89352455891786E-03F;
+
+        Lanes q = broadcast(1.19825839466702E-06F);
+        q = q * x2 + 1.18534705686654E-04F;
+        q = q * x2 + 2.26843463243900E-03F;
+        q = q * x2 + 4.89352518554385E-03F;
+
+        const Lanes y = select(mask(magnitude >= broadcast(4.0F)), sign(x), x * p / q);
+        return select(linear, x, y);
+    }
+
+private:
+    template <bool exact>
+    static inline const Lanes saturate(const Lanes x) noexcept
+    {
+        if constexpr (exact)
+        {
+            Lanes y;
+            for (int l = 0; l < Assemble::SIMD::width; ++l)
+                Assemble::SIMD::set(y, l, HuovilainenFilter::quicktanh(Assemble::SIMD::lane(x, l)));
+
+            return y;
+        }
+
+        else return quicktanh(x);
+    }
+
+private:
+    std::array<Lanes, 6> delay;
+    std::array<Lanes, 3> tanhStage;
+};
+
+#endif
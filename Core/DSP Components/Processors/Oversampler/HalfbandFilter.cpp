@@ -0,0 +1,85 @@
+//  Assemble
+//  ============================
+//  Copyright © 2020 David Spry. All rights reserved.
+
+#include "HalfbandFilter.hpp"
+#include "CDSPHBUpsampler.h"
+
+void HalfbandFilter::configure(const int steepness, const double attenuation, const int capacity, const int phase)
+{
+    int length;
+    double stopband;
+    const double* kernel;
+    r8b::CDSPHBUpsampler::getHBFilter(attenuation, steepness, kernel, length, stopband);
+
+    taps.assign(kernel, kernel + length);
+    this->phase = phase;
+
+    sides  .assign(2 * length - 1 + 2 * capacity, 0.F);
+    centres.assign(length + capacity, 0.F);
+    interpolated.assign(capacity, 0.F);
+}
+
+void HalfbandFilter::reset()
+{
+    std::fill(sides  .begin(), sides  .end(), 0.F);
+    std::fill(centres.begin(), centres.end(), 0.F);
+}
+
+void HalfbandFilter::upsample(const float* input, const int samples, float* output)
+{
+    const int n = length();
+    const int history = 2 * n - 1;
+
+    std::copy(input, input + samples, sides.begin() + history);
+    convolve(sides.data(), samples, interpolated.data());
+
+    /// Each interpolated sample lies between the input samples `sides[j + n - 1]` and `sides[j + n]`.
+
+    for (int j = 0; j < samples; ++j)
+    {
+        output[2 * j]     = sides[j + n - 1];
+        output[2 * j + 1] = interpolated[j];
+    }
+
+    std::copy(sides.begin() + samples, sides.begin() + samples + history, sides.begin());
+}
+
+void HalfbandFilter::downsample(const float* input, const int samples, float* output)
+{
+    const int n = length();
+    const int count = samples / 2;
+    const int history = 2 * n - 1;
+    const int centring = n - 1 + phase;
+
+    for (int j = 0; j < count; ++j)
+    {
+        centres[centring + j] = input[2 * j + phase];
+        sides  [history  + j] = input[2 * j + 1 - phase];
+    }
+
+    convolve(sides.data(), count, output);
+
+    for (int j = 0; j < count; ++j)
+        output[j] = 0.5F * (centres[j] + output[j]);
+
+    std::copy(centres.begin() + count, centres.begin() + count + centring, centres.begin());
+    std::copy(sides  .begin() + count, sides  .begin() + count + history,  sides.begin());
+}
+
+void HalfbandFilter::convolve(const float* input, const int samples, float* output) const
+{
+    const int n = length();
+
+    std::fill(output, output + samples, 0.F);
+
+    for (int i = 0; i < n; ++i)
+    {
+        const float tap = taps[i];
+        const float* later   = input + n + i;
+        const float* earlier = input + n - 1 - i;
+
+        for (int j = 0; j < samples; ++j)
+            output[j] += tap * (later[j] + earlier[j]);
+    }
+}
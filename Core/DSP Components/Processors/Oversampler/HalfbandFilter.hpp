@@ -0,0 +1,76 @@
+//  Assemble
+//  ============================
+//  Copyright © 2020 David Spry. All rights reserved.
+
+#ifndef HALFBANDFILTER_HPP
+#define HALFBANDFILTER_HPP
+
+#include "ASHeaders.h"
+
+/// \brief A single-precision halfband filter that doubles or halves the sample rate of a signal.
+///
+/// The filter uses the symmetric halfband kernels designed by r8brain, but it is causal, so that every call
+/// produces exactly twice or half as many samples as it consumes. Each filter keeps its own copy of its input,
+/// so its output may overwrite its input. An instance should be used to either upsample or downsample, but not both.
+
+class HalfbandFilter
+{
+public:
+    /// \brief Select the kernel and allocate the filter's buffers. This should not be called from the audio thread.
+    /// \param steepness The steepness index of the kernel, from 0 (steepest) to 6
+    /// \param attenuation The required stopband attenuation in decibels
+    /// \param capacity The largest number of samples that will be passed to the filter at once
+    /// \param phase The phase of the input samples, 0 or 1, that are aligned to the centre tap while downsampling
+
+    void configure(const int steepness, const double attenuation, const int capacity, const int phase = 0);
+
+    /// \brief Return the number of non-zero taps on each side of the kernel, excluding its centre tap.
+
+    inline const int length() const { return static_cast<int>(taps.size()); }
+
+    /// \brief Clear the filter's history. This does not allocate.
+
+    void reset();
+
+    /// \brief Double the sample rate of the given samples.
+    /// \param input The samples to upsample
+    /// \param samples The number of samples to upsample, which must not exceed the filter's capacity
+    /// \param output The destination of the `2 * samples` upsampled samples, which may be `input`
+
+    void upsample(const float* input, const int samples, float* output);
+
+    /// \brief Halve the sample rate of the given samples.
+    /// \param input The samples to downsample
+    /// \param samples The number of samples to downsample, which must be even and must not exceed twice the filter's capacity
+    /// \param output The destination of the `samples / 2` downsampled samples, which may be `input`
+
+    void downsample(const float* input, const int samples, float* output);
+
+private:
+    /// \brief Compute `output[j] = Σ taps[i] * (input[j + n + i] + input[j + n - 1 - i])` for each of the given samples,
+    /// where `n` is the number of taps. Each tap is applied to the whole block in turn, so the inner loop vectorises.
+
+    void convolve(const float* input, const int samples, float* output) const;
+
+private:
+    /// \brief The non-zero taps of one side of the symmetric kernel, excluding its centre tap.
+
+    std::vector<float> taps;
+
+    /// \brief The input, preceded by the most recent samples of the previous input. While downsampling,
+    /// `centres` holds the samples aligned to the centre tap, and `sides` holds the samples between them,
+    /// which are weighted by the remaining taps. While upsampling, `sides` holds the whole input.
+
+    std::vector<float> sides;
+    std::vector<float> centres;
+
+    /// \brief The interpolated samples computed while upsampling.
+
+    std::vector<float> interpolated;
+
+    /// \brief The phase of the input samples that are aligned to the centre tap while downsampling.
+
+    int phase = 0;
+};
+
+#endif
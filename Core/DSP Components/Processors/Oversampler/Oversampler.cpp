@@ -0,0 +1,65 @@
+//  Assemble
+//  ============================
+//  Copyright © 2020 David Spry. All rights reserved.
+
+#include "Oversampler.hpp"
+
+void Oversampler::configure(const int factor, const int steepness, const double attenuation, const int capacity)
+{
+    int stages = 0;
+    while ((2 << stages) <= factor) stages = stages + 1;
+
+    upsamplers.assign(stages, HalfbandFilter());
+    downsamplers.assign(stages, HalfbandFilter());
+
+    /// The latency is found from the innermost stage outwards. Each upsampling stage places the samples of its
+    /// input at the even samples of its output, delayed by twice its length. The stages within it delay them by
+    /// `delay` samples, so each downsampling stage centres its kernel on the phase to which they are delayed.
+    /// The round trip is then delayed by a whole number of samples at every rate.
+
+    delay = 0;
+
+    for (int s = stages - 1; s >= 0; --s)
+    {
+        const int index = std::min(steepness + s, 6);
+        const int phase = delay % 2;
+
+        upsamplers[s].configure(index, attenuation, capacity << s);
+        downsamplers[stages - 1 - s].configure(index, attenuation, capacity << s, phase);
+
+        const int length = upsamplers[s].length();
+        delay = 2 * length - 1 + phase + delay / 2;
+    }
+}
+
+void Oversampler::reset()
+{
+    for (auto& stage : upsamplers)   stage.reset();
+    for (auto& stage : downsamplers) stage.reset();
+}
+
+const int Oversampler::upsample(float* samples, const int count)
+{
+    int length = count;
+
+    for (auto& stage : upsamplers)
+    {
+        stage.upsample(samples, length, samples);
+        length = length * 2;
+    }
+
+    return length;
+}
+
+const int Oversampler::downsample(float* samples, const int count)
+{
+    int length = count;
+
+    for (auto& stage : downsamplers)
+    {
+        stage.downsample(samples, length, samples);
+        length = length / 2;
+    }
+
+    return length;
+}
@@ -0,0 +1,75 @@
+//  Assemble
+//  ============================
+//  Copyright © 2020 David Spry. All rights reserved.
+
+#ifndef OVERSAMPLER_HPP
+#define OVERSAMPLER_HPP
+
+#include "ASHeaders.h"
+#include "HalfbandFilter.hpp"
+
+/// \brief A cascade of halfband filters that raises or lowers the sample rate of a signal by a power of two.
+///
+/// Each stage doubles or halves the sample rate. The stage nearest to the base rate uses the steepest filter,
+/// as selected by the steepness index, and each subsequent stage uses a filter that is one step less steep,
+/// since the band that it must reject is wider. With the steepest filters, the passband is flat to about 0.3 times
+/// the base sample rate.
+///
+/// The signal is processed in place, in single precision. Every call to `upsample` or `downsample` produces exactly
+/// `factor` times more or fewer samples than it consumes, and the signal is delayed by a fixed number of samples
+/// at the base rate, which is given by `latency()`.
+
+class Oversampler
+{
+public:
+    Oversampler() {}
+
+    Oversampler(const Oversampler&) = delete;
+    Oversampler& operator=(const Oversampler&) = delete;
+
+public:
+    /// \brief Build the filter stages and allocate their buffers. This should not be called from the audio thread.
+    /// \param factor The oversampling factor, which must be a power of two
+    /// \param steepness The steepness index of the stage nearest to the base rate, from 0 (steepest) to 6
+    /// \param attenuation The required stopband attenuation in decibels
+    /// \param capacity The largest number of samples that will be passed to `upsample` at once
+
+    void configure(const int factor, const int steepness, const double attenuation, const int capacity);
+
+    /// \brief Raise the sample rate of the given samples by the oversampling factor, in place.
+    /// \param samples The samples to upsample, which must have room for `factor` times as many samples
+    /// \param count The number of samples to upsample, which must not exceed the Oversampler's capacity
+    /// \return The number of upsampled samples, which is `factor * count`.
+
+    const int upsample(float* samples, const int count);
+
+    /// \brief Lower the sample rate of the given samples by the oversampling factor, in place.
+    /// \param samples The samples to downsample, which may be the output of `upsample`
+    /// \param count The number of samples to downsample, which must be a multiple of the oversampling factor
+    /// \return The number of downsampled samples, which is `count / factor`.
+
+    const int downsample(float* samples, const int count);
+
+    /// \brief Clear the state of each stage, as if the Oversampler had just been configured. This does not allocate.
+
+    void reset();
+
+    /// \brief Return the delay, in samples at the base rate, between a signal's entry into `upsample`
+    /// and its exit from `downsample`.
+
+    inline const int latency() const { return delay; }
+
+    /// \brief Return the oversampling factor.
+
+    inline const int factor() const { return 1 << (int) upsamplers.size(); }
+
+private:
+    std::vector<HalfbandFilter> upsamplers;
+    std::vector<HalfbandFilter> downsamplers;
+
+    /// \brief The latency of the round trip in samples at the base rate.
+
+    int delay = 0;
+};
+
+#endif
@@ -4,6 +4,8 @@
 
 #include "Sequencer.hpp"
 
+#include <cassert>
+
 void Sequencer::set(uint64_t parameter, float value)
 {
     switch (parameter)
@@ -110,17 +112,22 @@ void Sequencer::selectNextActivePattern()
 
 void Sequencer::copy(const int source)
 {
-    if (copiedPattern == nullptr)
-        copiedPattern = new Pattern();
+    /// The spare Pattern is allocated by `prepareCopiedPattern` on the UI thread, so that the audio thread never allocates.
+
+    assert(copiedPattern != nullptr);
+    if (copiedPattern == nullptr) return;
     
-    const Pattern& pattern = patterns.at(source);
+    const Pattern& pattern = patterns[source];
     
     copiedPattern->clone(pattern);
 }
 
 void Sequencer::paste(const int target)
 {
+    assert(copiedPattern != nullptr);
+    if (copiedPattern == nullptr) return;
+
     const Pattern& source = *(copiedPattern);
 
-    patterns.at(target).clone(source);
+    patterns[target].clone(source);
 }
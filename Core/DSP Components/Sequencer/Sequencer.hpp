@@ -66,12 +66,13 @@ public:
     
     /// @brief Clear and deactivate the pattern with the given pattern index .
     /// @param pattern The index of the pattern to be cleared.
+    /// @pre   The index is in the range [0, PATTERNS).
 
     inline void hardReset(const int pattern)
     {
-        const bool active = patterns.at(pattern).isActive();
+        const bool active = patterns[pattern].isActive();
         activePatterns = activePatterns - (active ? 1 : 0);
-        patterns.at(pattern).clear();
+        patterns[pattern].clear();
     }
 
     /// @brief Delete the Sequencer's copied pattern and set its pointer to nullptr.
@@ -86,31 +87,43 @@ public:
     /// @param x The x-coordinate of the selected location
     /// @param y The y-coordinate of the selected location
     /// @param note A parameter pack containing the properties used to construct a new Note.
+    /// @pre   The location is within the bounds of a Pattern.
     
     template <typename ...N>
     inline void addOrModify(const int x, const int y, N... note)
     {
-        patterns.at(pattern).include(x, y, note...);
+        patterns[pattern].include(x, y, note...);
     }
 
     /// @brief Set the Note at the given location to have the given properties.
     /// @param pattern The index of the pattern that should include the given Note.
     /// @param note A parameter pack containing the properties used to construct a new Note, including its location.
+    /// @pre   The index is in the range [0, PATTERNS), and the location is within the bounds of a Pattern.
 
     template <typename ...N>
     inline void addOrModifyToPattern(const int pattern, N... note)
     {
-        patterns.at(pattern).include(note...);
+        patterns[pattern].include(note...);
     }
     
+    /// @brief Allocate the Sequencer's spare Pattern, if it does not already exist, so that `copy` will not allocate.
+
+    inline void prepareCopiedPattern()
+    {
+        if (copiedPattern == nullptr)
+            copiedPattern = new Pattern();
+    }
+
     /// @brief Copy the state of the given source pattern into the Sequencer's spare Pattern.
     /// @param source The index of the pattern that should be copied.
+    /// @pre   The spare Pattern has been allocated by `prepareCopiedPattern`, and the index is in the range [0, PATTERNS).
 
     void copy(const int source);
     
     /// @brief Copy a previously copied Pattern state into the Pattern with the given index.
     /// @param target The index of the pattern whose state should be replaced with the previously copied state.
     /// @pre   A previously copied state exists. This can be ascertained using the method `copiedStateExists`.
+    ///        The index is in the range [0, PATTERNS).
     
     void paste(const int target);
     
@@ -124,10 +137,11 @@ public:
     /// @brief Erase the contents of the given position, (x, y).
     /// @param x The x-coordinate of the position whose contents should be erased.
     /// @param y The y-coordinate of the position whose contents should be erased.
+    /// @pre   The position is within the bounds of a Pattern.
 
     inline void erase(const int x, const int y)
     {
-        patterns.at(pattern).erase(x, y);
+        patterns[pattern].erase(x, y);
     }
     
     /// @brief Toggle between the sequencer's modes.
@@ -199,7 +213,7 @@ private:
     
 private:
     std::vector<Pattern> patterns;
-    Pattern*        copiedPattern;
+    Pattern*        copiedPattern = nullptr;
     
 private:
     int  row            = 0;
@@ -24,16 +24,17 @@ public:
     }
 
 public:
-    /// @brief Conform to the state of the given Matrix.
+    /// @brief Conform to the state of the given Matrix. Every Matrix of the same shape holds the same number
+    /// of Notes and rows, so the state is copied into the existing storage without allocating.
     /// @param source The Matrix whose state should be cloned and conformed with.
 
-    void clone(const Matrix& source)
+    void clone(const Matrix& source) noexcept
     {
         w = source.w;
         h = source.h;
-        
-        vector = std::vector<Note>(source.vector);
-        length = std::vector<int> (source.length);
+
+        std::copy(source.vector.begin(), source.vector.end(), vector.begin());
+        std::copy(source.length.begin(), source.length.end(), length.begin());
     }
     
     /// \brief Return a pointer to the Note at position (x, y) or nullptr if the note does not exist.
@@ -143,11 +144,13 @@ public:
     template <typename ...A>
     void include(int x, int y, A... arguments) noexcept(false)
     {
-        if (y < 0 || y > M)  throw "[Matrix] Invalid row";
-        if (length[y] >= N) throw "[Matrix] Row is full";
-        
+        if (y < 0 || y >= M) throw "[Matrix] Invalid row";
+
+        /// A Note that already exists is modified in place, so only a new Note needs room in its row.
+
         int position = find(x, y);
         if (position == -1) {
+            if (length[y] >= N) throw "[Matrix] Row is full";
             position = index(length[y], y);
             length[y] += 1;
         }
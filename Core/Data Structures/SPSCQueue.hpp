@@ -0,0 +1,86 @@
+//  Assemble
+//  ============================
+//  Copyright © 2020 David Spry. All rights reserved.
+
+#ifndef SPSCQUEUE_HPP
+#define SPSCQUEUE_HPP
+
+#include "ASHeaders.h"
+
+/// \brief A fixed-capacity, wait-free queue for one producer thread and one consumer thread.
+/// Items that are pushed while the queue is full are dropped and counted.
+/// \tparam T The type of the items in the queue, which should be trivially copyable.
+/// \tparam N The capacity of the queue, which must be a power of two.
+
+template <typename T, int N>
+class SPSCQueue
+{
+    static_assert(N > 0 && (N & (N - 1)) == 0, "The capacity of an SPSCQueue must be a power of two.");
+
+public:
+    /// \brief Push an item onto the queue. This should only be called by the producer.
+    /// \param item The item to push
+    /// \return `true` if the item was pushed; `false` if the queue was full and the item was dropped.
+
+    inline const bool push(const T& item) noexcept
+    {
+        const size_t head = this->head.load(std::memory_order_relaxed);
+        const size_t tail = this->tail.load(std::memory_order_acquire);
+
+        if (head - tail >= N)
+        {
+            drops.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        items[head & (N - 1)] = item;
+        this->head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// \brief Pop the item at the front of the queue. This should only be called by the consumer.
+    /// \param item The location where the item should be stored
+    /// \return `true` if an item was popped; `false` if the queue was empty.
+
+    inline const bool pop(T& item) noexcept
+    {
+        const size_t tail = this->tail.load(std::memory_order_relaxed);
+
+        if (tail == head.load(std::memory_order_acquire))
+            return false;
+
+        item = items[tail & (N - 1)];
+        this->tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// \brief Return the number of items in the queue.
+
+    inline const size_t size() const noexcept
+    {
+        const size_t tail = this->tail.load(std::memory_order_acquire);
+        const size_t head = this->head.load(std::memory_order_acquire);
+        return head - tail;
+    }
+
+    /// \brief Return the number of items that have been dropped because the queue was full.
+
+    inline const uint64_t dropped() const noexcept
+    {
+        return drops.load(std::memory_order_relaxed);
+    }
+
+    /// \brief Return the capacity of the queue.
+
+    constexpr static int capacity() { return N; }
+
+private:
+    alignas(64) std::atomic<size_t> head = {0};
+    alignas(64) std::atomic<size_t> tail = {0};
+    alignas(64) std::atomic<uint64_t> drops = {0};
+
+private:
+    std::array<T, N> items;
+};
+
+#endif
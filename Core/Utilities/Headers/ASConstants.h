@@ -11,6 +11,35 @@
 #define LN100       4.6051701859
 #define LN20E3      9.9034875525
 
+// RENDERING
+// ====================
+
+// The largest number of samples that a component's block API processes at once. The core renders
+// in blocks of this length, whatever the length requested by the host. It can be set at build time.
+#ifndef BLOCK_SIZE
+    #define BLOCK_SIZE   256
+#endif
+
+// The number of samples between updates of the coefficients of each Voice's filter, which are
+// interpolated linearly in between. An interval of 1 updates them on every sample. It can be set at build time.
+#ifndef FILTER_CONTROL_INTERVAL
+    #define FILTER_CONTROL_INTERVAL 16
+#endif
+
+// Define FILTER_GAIN_TABLE at build time to look up the gain of each Voice's filter in a table
+// rather than computing an exponential at each update.
+
+// Define ANALYTIC_OSCILLATORS at build time to compute the Synthesiser's oscillators with PolyBLEP
+// rather than wavetables, which saves the memory of the wavetables, as for low-memory devices.
+
+// Define COMPACT_WAVETABLES at build time to store the samples of the wavetables as 16-bit integers
+// rather than floats, which halves their memory and cache footprint at a quantisation error near -96dB.
+
+// The steepness index of the first halfband stage of the Oversampler, from 0 (steepest) to 6,
+// and the stopband attenuation of each stage in decibels
+#define OVERSAMPLING_STEEPNESS   0
+#define OVERSAMPLING_ATTENUATION 120.0
+
 // ASSEMBLE LIGHT (IOS)
 // ====================
 
@@ -44,4 +73,13 @@
     #define OVERSAMPLING     16
 
 #endif
+
+// Define BASE_RATE_DELAY at build time to run the StereoDelay at the sample rate with windowed-sinc
+// interpolation rather than oversampling it, which processes and stores OVERSAMPLING times fewer samples.
+#ifdef BASE_RATE_DELAY
+    #define DELAY_OVERSAMPLING 1
+#else
+    #define DELAY_OVERSAMPLING OVERSAMPLING
+#endif
+
 #endif
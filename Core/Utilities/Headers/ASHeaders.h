@@ -6,11 +6,17 @@
 #ifndef ASHEADERS_H
 #define ASHEADERS_H
 
+#include <cmath>
 #include <array>
+#include <string>
+#include <cstdio>
+#include <cstring>
 #include <atomic>
 #include <vector>
+#include <memory>
 #include <sstream>
 #include <numeric>
+#include <algorithm>
 #include <charconv>
 #include <iterator>
 
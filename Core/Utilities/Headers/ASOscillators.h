@@ -7,5 +7,6 @@
 #define ASOSCILLATORS_H
 
 #include "BandlimitedOscillator.hpp"
+#include "FixedPointOscillator.hpp"
 
 #endif
@@ -121,6 +121,7 @@ static const int kStereoDelayToggle       = 0xEF10;
 static const int kStereoDelayLTime        = 0xEF11;
 static const int kStereoDelayRTime        = 0xEF12;
 static const int kStereoDelayOffset       = 0xEF13;
+static const int kStereoDelayPingPong     = 0xEF14;
 
 // Vibrato
 static const int kVibratoToggle           = 0xEF20;
@@ -0,0 +1,172 @@
+//  Assemble
+//  ============================
+//  Copyright © 2020 David Spry. All rights reserved.
+//
+//  Source: xoshiro128+ and splitmix64 by David Blackman and Sebastiano Vigna
+//  <https://prng.di.unimi.it>
+//
+//  License: Public Domain (CC0)
+//  <https://creativecommons.org/publicdomain/zero/1.0/>
+
+#ifndef ASRANDOM_H
+#define ASRANDOM_H
+
+#include "ASSIMD.h"
+#include "ASHeaders.h"
+#include <random>
+
+/// \brief Small, seedable pseudorandom number generators for oscillator phases and noise.
+///
+/// Each generator is a xoshiro128+ generator, whose state is 16 bytes, rather than a `std::mt19937`, whose state
+/// is about 5 KB. The upper 24 bits of each output are used to produce floats. Every generator is seeded from a
+/// 64-bit value, which is expanded with splitmix64. Generators that are not seeded explicitly are seeded with a
+/// distinct value from `entropy`.
+
+namespace Assemble::Random
+{
+    /// \brief Advance the given splitmix64 state and return its next output.
+    /// \param state The state of the splitmix64 generator
+
+    static inline uint64_t mix(uint64_t& state) noexcept
+    {
+        uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+
+    /// \brief Derive the seed of a subordinate generator from a seed, so that one seed can seed many generators.
+    /// \param seed The seed of the owner
+    /// \param stream The index of the subordinate generator
+
+    static inline uint64_t split(uint64_t seed, const uint64_t stream) noexcept
+    {
+        seed = seed ^ (stream * 0xD1B54A32D192ED03ULL);
+        return mix(seed);
+    }
+
+    /// \brief Return a distinct seed on each call. The sequence begins at a value drawn once from `std::random_device`.
+
+    static inline uint64_t entropy() noexcept
+    {
+        static const uint64_t origin = [] {
+            std::random_device rd;
+            return (static_cast<uint64_t>(rd()) << 32) | static_cast<uint64_t>(rd());
+        }();
+
+        static std::atomic<uint64_t> count = {0};
+        return split(origin, count.fetch_add(1, std::memory_order_relaxed));
+    }
+
+    /// \brief A xoshiro128+ generator.
+
+    class Generator
+    {
+    public:
+        Generator() { seed(entropy()); }
+        explicit Generator(const uint64_t value) { seed(value); }
+
+    public:
+        /// \brief Seed the generator.
+        /// \param value The seed, which is expanded to the generator's state with splitmix64
+
+        void seed(uint64_t value) noexcept
+        {
+            for (int k = 0; k < 4; k += 2)
+            {
+                const uint64_t z = mix(value);
+                state[k + 0] = static_cast<uint32_t>(z);
+                state[k + 1] = static_cast<uint32_t>(z >> 32);
+            }
+        }
+
+        /// \brief Return the next 32-bit output.
+
+        inline uint32_t next() noexcept
+        {
+            const uint32_t result = state[0] + state[3];
+            const uint32_t t = state[1] << 9;
+
+            state[2] ^= state[0];
+            state[3] ^= state[1];
+            state[1] ^= state[2];
+            state[0] ^= state[3];
+            state[2] ^= t;
+            state[3] = (state[3] << 11) | (state[3] >> 21);
+
+            return result;
+        }
+
+        /// \brief Return a float in the range [0, 1).
+
+        inline float uniform() noexcept
+        {
+            return static_cast<float>(next() >> 8) * (1.0F / 16777216.0F);
+        }
+
+        /// \brief Return a float in the range [lower, upper).
+
+        inline float uniform(const float lower, const float upper) noexcept
+        {
+            return lower + (upper - lower) * uniform();
+        }
+
+    private:
+        std::array<uint32_t, 4> state;
+    };
+
+    /// \brief `SIMD::width` independent xoshiro128+ generators, which produce one float per lane at once.
+
+    class Streams
+    {
+        using Bits  = Assemble::SIMD::Bits;
+        using Lanes = Assemble::SIMD::Lanes;
+
+    public:
+        Streams() { seed(entropy()); }
+        explicit Streams(const uint64_t value) { seed(value); }
+
+    public:
+        /// \brief Seed each lane's generator with a value derived from the given seed.
+        /// \param value The seed of the streams
+
+        void seed(const uint64_t value) noexcept
+        {
+            for (int l = 0; l < Assemble::SIMD::width; ++l)
+            {
+                Generator lane(split(value, l));
+                for (int k = 0; k < 4; ++k)
+                    Assemble::SIMD::set(state[k], l, lane.next());
+            }
+        }
+
+        /// \brief Return a float in the range [0, 1) from each lane.
+
+        inline Lanes uniform() noexcept
+        {
+            const Bits result = state[0] + state[3];
+            const Bits t = state[1] << 9;
+
+            state[2] ^= state[0];
+            state[3] ^= state[1];
+            state[1] ^= state[2];
+            state[0] ^= state[3];
+            state[2] ^= t;
+            state[3] = (state[3] << 11) | (state[3] >> 21);
+
+            return Assemble::SIMD::unit(result);
+        }
+
+        /// \brief Return a float in the range [lower, upper) from each lane.
+
+        inline Lanes uniform(const float lower, const float upper) noexcept
+        {
+            return Assemble::SIMD::broadcast(lower) + Assemble::SIMD::broadcast(upper - lower) * uniform();
+        }
+
+    private:
+        std::array<Bits, 4> state;
+    };
+}
+
+#endif
@@ -0,0 +1,144 @@
+//  Assemble
+//  ============================
+//  Copyright © 2020 David Spry. All rights reserved.
+
+#ifndef ASSIMD_H
+#define ASSIMD_H
+
+#include "ASHeaders.h"
+
+/// \brief Portable SIMD lanes, which are used to process several Voices at once.
+///
+/// With GCC or Clang, `Lanes` is a vector extension type, which compiles to SSE on x86, AVX when it is enabled
+/// (as with `-mavx2`), and NEON on ARM. With any other compiler, `Lanes` holds a single float, and the same code
+/// compiles to scalar code. Code that uses `Lanes` should use the functions below rather than the operators that
+/// are specific to vector types, such as subscripts and vector comparisons.
+
+namespace Assemble::SIMD
+{
+#if defined(__GNUC__) || defined(__clang__)
+
+#if defined(__AVX__)
+    constexpr int width = 8;
+#else
+    constexpr int width = 4;
+#endif
+
+    typedef float   Lanes __attribute__((vector_size(4 * width)));
+    typedef int32_t Mask  __attribute__((vector_size(4 * width)));
+    typedef uint32_t Bits __attribute__((vector_size(4 * width)));
+
+    /// \brief Return the given comparison as a mask, whose lanes are all ones where the comparison holds.
+
+    static inline Mask mask(const Mask comparison) { return comparison; }
+
+    /// \brief Return the value of the given lane.
+
+    static inline float lane(const Lanes& lanes, const int index) { return lanes[index]; }
+    static inline int32_t lane(const Mask& lanes, const int index) { return lanes[index]; }
+    static inline uint32_t lane(const Bits& lanes, const int index) { return lanes[index]; }
+
+    /// \brief Set the value of the given lane.
+
+    static inline void set(Lanes& lanes, const int index, const float value) { lanes[index] = value; }
+    static inline void set(Bits& lanes, const int index, const uint32_t value) { lanes[index] = value; }
+
+    /// \brief Convert each lane to an integer, rounding towards zero, or to a float.
+
+    static inline Mask  truncate(const Lanes lanes) { return __builtin_convertvector(lanes, Mask); }
+    static inline Lanes convert(const Mask lanes)   { return __builtin_convertvector(lanes, Lanes); }
+
+    /// \brief Convert the upper 24 bits of each lane to a float in the range [0, 1).
+
+    static inline Lanes unit(const Bits bits)
+    {
+        return __builtin_convertvector(reinterpret_cast<Mask>(bits >> 8), Lanes) * (1.0F / 16777216.0F);
+    }
+
+    /// \brief Return the lanes of `a` where `mask` is set, and the lanes of `b` elsewhere.
+
+    static inline Lanes select(const Mask mask, const Lanes a, const Lanes b)
+    {
+        return reinterpret_cast<Lanes>((reinterpret_cast<Mask>(a) & mask) | (reinterpret_cast<Mask>(b) & ~mask));
+    }
+
+    /// \brief Indicate whether any lane of the given mask is set.
+
+    static inline bool any(const Mask mask)
+    {
+        int32_t result = 0;
+        for (int l = 0; l < width; ++l) result = result | mask[l];
+        return result != 0;
+    }
+
+    /// \brief Return the magnitude of each lane.
+
+    static inline Lanes abs(const Lanes lanes)
+    {
+        return reinterpret_cast<Lanes>(reinterpret_cast<Mask>(lanes) & 0x7FFFFFFF);
+    }
+
+    /// \brief Return 1 with the sign of each lane.
+
+    static inline Lanes sign(const Lanes lanes)
+    {
+        const Lanes unit = Lanes{} + 1.0F;
+        const Mask  one  = reinterpret_cast<Mask>(unit);
+        return reinterpret_cast<Lanes>((reinterpret_cast<Mask>(lanes) & static_cast<int32_t>(0x80000000)) | one);
+    }
+
+#else
+
+    constexpr int width = 1;
+
+    using Lanes = float;
+    using Mask  = int32_t;
+    using Bits  = uint32_t;
+
+    static inline Mask mask(const bool comparison) { return -static_cast<Mask>(comparison); }
+
+    static inline float lane(const Lanes& lanes, const int) { return lanes; }
+    static inline int32_t lane(const Mask& lanes, const int) { return lanes; }
+    static inline uint32_t lane(const Bits& lanes, const int) { return lanes; }
+
+    static inline void set(Lanes& lanes, const int, const float value) { lanes = value; }
+    static inline void set(Bits& lanes, const int, const uint32_t value) { lanes = value; }
+
+    static inline Mask  truncate(const Lanes lanes) { return static_cast<Mask>(lanes); }
+    static inline Lanes convert(const Mask lanes)   { return static_cast<Lanes>(lanes); }
+    static inline Lanes unit(const Bits bits)       { return static_cast<Lanes>(bits >> 8) * (1.0F / 16777216.0F); }
+
+    static inline Lanes select(const Mask mask, const Lanes a, const Lanes b) { return mask ? a : b; }
+
+    static inline bool  any(const Mask mask)    { return mask != 0; }
+    static inline Lanes abs(const Lanes lanes)  { return std::abs(lanes); }
+    static inline Lanes sign(const Lanes lanes) { return std::copysign(1.0F, lanes); }
+
+#endif
+
+    /// \brief Return lanes that each hold the given value.
+
+    static inline Lanes broadcast(const float value)
+    {
+        Lanes lanes = {};
+        return lanes + value;
+    }
+
+    /// \brief Load `width` consecutive floats, which need not be aligned.
+
+    static inline Lanes load(const float* source)
+    {
+        Lanes lanes;
+        std::memcpy(&lanes, source, sizeof(Lanes));
+        return lanes;
+    }
+
+    /// \brief Store the lanes to `width` consecutive floats, which need not be aligned.
+
+    static inline void store(float* destination, const Lanes lanes)
+    {
+        std::memcpy(destination, &lanes, sizeof(Lanes));
+    }
+}
+
+#endif
@@ -30,6 +30,17 @@ namespace Assemble::Utilities
         return milliseconds * frequency * 1e-3f;
     }
 
+    /// \brief Convert a frequency to the increment of a 32-bit fixed-point phase, which wraps once per cycle
+    /// \param frequency The frequency in Hz, which is clamped to the range [0, sampleRate)
+    /// \param sampleRate The sampling rate
+    /// \return The increment of the phase per sample, in units of 2^-32 cycles
+
+    static inline const uint32_t increment(const float frequency, const float sampleRate)
+    {
+        const double cycles = static_cast<double>(frequency) / static_cast<double>(sampleRate);
+        return static_cast<uint32_t>(std::clamp(std::round(cycles * 4294967296.0), 0.0, 4294967295.0));
+    }
+
     /// \brief Compute linear interpolation at the given index in the given table
     /// \param index The position in the table to interpolate a value for
     /// \param table A pointer to an array of floats
@@ -49,19 +60,20 @@ namespace Assemble::Utilities
 
     /// \brief Compute four-point, fourth-order Hermite interpolation
     /// \param index The position in the table to interpolate a value for
-    /// \param table A pointer to an array of floats
+    /// \param table A pointer to an array of floats, or of integers, which are converted to floats
     /// \param capacity The capacity of the table
     /// \author Laurent de Soras
 
-    [[nodiscard]] static inline const float hermite(const float index, const float *table, const int capacity)
+    template <typename Sample>
+    [[nodiscard]] static inline const float hermite(const float index, const Sample *table, const int capacity)
     {
         const int   a = (int) index;
         const float k = index - a;
         
-        const float xa = table[a];
-        const float xb = table[(a - 1 + capacity) % capacity];
-        const float xc = table[(a + 1) % capacity];
-        const float xd = table[(a + 2) % capacity];
+        const float xa = static_cast<float>(table[a]);
+        const float xb = static_cast<float>(table[(a - 1 + capacity) % capacity]);
+        const float xc = static_cast<float>(table[(a + 1) % capacity]);
+        const float xd = static_cast<float>(table[(a + 2) % capacity]);
         
         const float C = (xc - xb) * 0.5F;
         const float V = (xa - xc);
@@ -72,6 +84,29 @@ namespace Assemble::Utilities
         return ((((A * k) - B) * k + C) * k + xa);
     }
 
+    /// \brief Compute four-point, fourth-order Hermite interpolation between two samples of a table with guard samples,
+    /// whose neighbours are read without wrapping, as in `WaveTableSet`.
+    /// \param table A pointer to an array of floats or integers, which must be readable from `table[index - 1]` to `table[index + 2]`
+    /// \param index The index of the sample before the position to interpolate
+    /// \param fraction The position between `table[index]` and `table[index + 1]` in the range [0, 1)
+
+    template <typename Sample>
+    [[nodiscard]] static inline const float hermite(const Sample *table, const int index, const float fraction)
+    {
+        const float xa = static_cast<float>(table[index]);
+        const float xb = static_cast<float>(table[index - 1]);
+        const float xc = static_cast<float>(table[index + 1]);
+        const float xd = static_cast<float>(table[index + 2]);
+
+        const float C = (xc - xb) * 0.5F;
+        const float V = (xa - xc);
+        const float W = C + V;
+        const float A = W + V + (xd - xa) * 0.5F;
+        const float B = W + A;
+
+        return ((((A * fraction) - B) * fraction + C) * fraction + xa);
+    }
+
     /// \brief Compute Catmull-Rom cubic interpolation at the given index in the given table
     /// \param index The position in the table to interpolate a value for
     /// \param table A pointed to an array of floats
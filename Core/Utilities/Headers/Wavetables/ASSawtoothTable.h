@@ -1,41059 +0,0 @@
-//  Assemble
-//  Created by David Spry on 9/5/20.
-//  Copyright © 2020 David Spry. All rights reserved.
-
-#ifndef ASSAWTOOTHTABLE_H
-#define ASSAWTOOTHTABLE_H
-
-#include <array>
-
-/// \note The collection of tables is at the bottom of this file.
-///
-/// \brief A collection of wavetables containing a bandlimited sawtooth wave.
-/// The sawtooth is oversampled by a factor of 2 and bandlimited in order to
-/// contain the maximum number of harmonics in each table without exceeding the Nyquist frequency.
-///
-/// Correct use of these wavetables should ensure that aliasing from the synthesiser is minimised if not obviated completely.
-///
-/// For each table, the top frequency and the number of harmonics follows.
-/// 1. 40Hz             735
-/// 2. 80Hz             367
-/// 3. 160Hz           183
-/// 4. 320Hz             91
-/// 5. 640Hz             45
-/// 6. 1280Hz           22
-/// 7. 2560Hz           11
-/// 8. 5120Hz            5
-/// 9. 10240Hz          2
-/// 10. 20480Hz+      1
-///
-/// \note These tables were generated with Nigel Redmon's C++ program, "WaveTableOsc", which is available for download from his blog, EarLevel Engineering.
-/// http://www.earlevel.com/main/2012/05/03/a-wavetable-oscillator—introduction/
-
-constexpr static int kSawtoothTableLength = 4096;
-
-// Top frequency: 44.1K * 0.000907029
-constexpr static std::array<float, 4096> wt_sawtooth_0x1 =
-{
-    0,
-    -0.570219,
-    -0.925965,
-    -0.999,
-    -0.89454,
-    -0.786033,
-    -0.776687,
-    -0.844478,
-    -0.900945,
-    -0.891237,
-    -0.838846,
-    -0.805772,
-    -0.822788,
-    -0.86351,
-    -0.880826,
-    -0.859075,
-    -0.82614,
-    -0.81833,
-    -0.840747,
-    -0.865411,
-    -0.864872,
-    -0.841723,
-    -0.822863,
-    -0.82807,
-    -0.849137,
-    -0.861199,
-    -0.85125,
-    -0.831443,
-    -0.823867,
-    -0.835564,
-    -0.851844,
-    -0.853936,
-    -0.839964,
-    -0.825943,
-    -0.82697,
-    -0.840571,
-    -0.850458,
-    -0.845374,
-    -0.831313,
-    -0.823941,
-    -0.830672,
-    -0.842838,
-    -0.846135,
-    -0.836833,
-    -0.82544,
-    -0.824321,
-    -0.83381,
-    -0.842367,
-    -0.839986,
-    -0.829317,
-    -0.822184,
-    -0.825976,
-    -0.835549,
-    -0.839478,
-    -0.833097,
-    -0.823481,
-    -0.821076,
-    -0.827862,
-    -0.835426,
-    -0.834771,
-    -0.826442,
-    -0.819592,
-    -0.82141,
-    -0.829105,
-    -0.833363,
-    -0.829027,
-    -0.820774,
-    -0.817548,
-    -0.822367,
-    -0.829095,
-    -0.829627,
-    -0.823068,
-    -0.816543,
-    -0.816941,
-    -0.823154,
-    -0.827548,
-    -0.824743,
-    -0.817622,
-    -0.813866,
-    -0.817159,
-    -0.823135,
-    -0.82451,
-    -0.819372,
-    -0.813214,
-    -0.812547,
-    -0.817525,
-    -0.821919,
-    -0.820306,
-    -0.814175,
-    -0.81009,
-    -0.812153,
-    -0.817425,
-    -0.819403,
-    -0.815448,
-    -0.809692,
-    -0.808214,
-    -0.812126,
-    -0.816418,
-    -0.815754,
-    -0.810514,
-    -0.806251,
-    -0.8073,
-    -0.811898,
-    -0.814298,
-    -0.811352,
-    -0.806029,
-    -0.80393,
-    -0.806903,
-    -0.811012,
-    -0.811111,
-    -0.806688,
-    -0.802365,
-    -0.802569,
-    -0.806515,
-    -0.809194,
-    -0.807119,
-    -0.802252,
-    -0.799688,
-    -0.801822,
-    -0.805683,
-    -0.806393,
-    -0.802726,
-    -0.798441,
-    -0.797936,
-    -0.80125,
-    -0.804091,
-    -0.802771,
-    -0.798381,
-    -0.795477,
-    -0.79686,
-    -0.800421,
-    -0.801614,
-    -0.798649,
-    -0.79448,
-    -0.793385,
-    -0.796089,
-    -0.798994,
-    -0.798327,
-    -0.794425,
-    -0.791291,
-    -0.792,
-    -0.79522,
-    -0.796786,
-    -0.794471,
-    -0.790485,
-    -0.788904,
-    -0.791019,
-    -0.793904,
-    -0.7938,
-    -0.790391,
-    -0.787122,
-    -0.787231,
-    -0.790077,
-    -0.791918,
-    -0.790203,
-    -0.786453,
-    -0.784482,
-    -0.786034,
-    -0.788828,
-    -0.7892,
-    -0.786285,
-    -0.782963,
-    -0.782541,
-    -0.784991,
-    -0.787019,
-    -0.785854,
-    -0.782384,
-    -0.780108,
-    -0.781126,
-    -0.783769,
-    -0.784539,
-    -0.78211,
-    -0.778808,
-    -0.777922,
-    -0.77996,
-    -0.782098,
-    -0.78143,
-    -0.778274,
-    -0.775774,
-    -0.776291,
-    -0.778731,
-    -0.779824,
-    -0.777869,
-    -0.774649,
-    -0.773366,
-    -0.774986,
-    -0.777161,
-    -0.776938,
-    -0.774123,
-    -0.771471,
-    -0.771524,
-    -0.77372,
-    -0.775065,
-    -0.773564,
-    -0.770481,
-    -0.768865,
-    -0.770067,
-    -0.772217,
-    -0.772386,
-    -0.769927,
-    -0.767192,
-    -0.766821,
-    -0.768739,
-    -0.770268,
-    -0.769198,
-    -0.766298,
-    -0.764412,
-    -0.765203,
-    -0.767272,
-    -0.767778,
-    -0.765686,
-    -0.762928,
-    -0.762176,
-    -0.763792,
-    -0.765442,
-    -0.764773,
-    -0.762095,
-    -0.76,
-    -0.760394,
-    -0.762332,
-    -0.763121,
-    -0.761398,
-    -0.758674,
-    -0.757585,
-    -0.758882,
-    -0.760594,
-    -0.760294,
-    -0.757867,
-    -0.755621,
-    -0.755638,
-    -0.757404,
-    -0.758421,
-    -0.757062,
-    -0.754421,
-    -0.753043,
-    -0.754011,
-    -0.75573,
-    -0.755762,
-    -0.75361,
-    -0.75127,
-    -0.750933,
-    -0.752493,
-    -0.753684,
-    -0.752678,
-    -0.750165,
-    -0.748545,
-    -0.749181,
-    -0.750858,
-    -0.751182,
-    -0.749321,
-    -0.746939,
-    -0.746277,
-    -0.747603,
-    -0.748916,
-    -0.748247,
-    -0.745899,
-    -0.744085,
-    -0.744394,
-    -0.745983,
-    -0.746558,
-    -0.744998,
-    -0.742622,
-    -0.741668,
-    -0.742739,
-    -0.744124,
-    -0.74377,
-    -0.741618,
-    -0.739659,
-    -0.73965,
-    -0.741112,
-    -0.741894,
-    -0.740637,
-    -0.738312,
-    -0.737103,
-    -0.737904,
-    -0.739314,
-    -0.739248,
-    -0.737317,
-    -0.73526,
-    -0.734948,
-    -0.73625,
-    -0.737196,
-    -0.736237,
-    -0.734004,
-    -0.732577,
-    -0.733101,
-    -0.734492,
-    -0.734684,
-    -0.732992,
-    -0.730883,
-    -0.730289,
-    -0.731402,
-    -0.732468,
-    -0.731798,
-    -0.729693,
-    -0.728087,
-    -0.728333,
-    -0.729663,
-    -0.730081,
-    -0.728641,
-    -0.726522,
-    -0.72567,
-    -0.726572,
-    -0.727716,
-    -0.72732,
-    -0.725372,
-    -0.723628,
-    -0.723599,
-    -0.724834,
-    -0.725442,
-    -0.72426,
-    -0.722172,
-    -0.721089,
-    -0.721765,
-    -0.722944,
-    -0.722804,
-    -0.721038,
-    -0.719196,
-    -0.718903,
-    -0.720009,
-    -0.72077,
-    -0.719846,
-    -0.717826,
-    -0.716545,
-    -0.716984,
-    -0.718158,
-    -0.71825,
-    -0.716686,
-    -0.714785,
-    -0.714242,
-    -0.715193,
-    -0.71607,
-    -0.7154,
-    -0.713481,
-    -0.712033,
-    -0.712231,
-    -0.713364,
-    -0.71366,
-    -0.712313,
-    -0.710392,
-    -0.709617,
-    -0.71039,
-    -0.711346,
-    -0.710919,
-    -0.70913,
-    -0.707551,
-    -0.707508,
-    -0.708566,
-    -0.709038,
-    -0.707914,
-    -0.706011,
-    -0.705027,
-    -0.705606,
-    -0.706603,
-    -0.706405,
-    -0.704769,
-    -0.703094,
-    -0.702816,
-    -0.703769,
-    -0.704386,
-    -0.703489,
-    -0.701636,
-    -0.700469,
-    -0.700842,
-    -0.701845,
-    -0.701858,
-    -0.700395,
-    -0.698659,
-    -0.698156,
-    -0.698978,
-    -0.699707,
-    -0.699036,
-    -0.697264,
-    -0.695942,
-    -0.696102,
-    -0.697078,
-    -0.697278,
-    -0.696003,
-    -0.69424,
-    -0.693528,
-    -0.694198,
-    -0.695005,
-    -0.694553,
-    -0.692889,
-    -0.691442,
-    -0.691387,
-    -0.692305,
-    -0.692668,
-    -0.691592,
-    -0.689835,
-    -0.68893,
-    -0.689431,
-    -0.690284,
-    -0.690039,
-    -0.688507,
-    -0.686966,
-    -0.6867,
-    -0.687531,
-    -0.688031,
-    -0.687156,
-    -0.685437,
-    -0.684363,
-    -0.684682,
-    -0.685548,
-    -0.685496,
-    -0.684115,
-    -0.682511,
-    -0.682041,
-    -0.68276,
-    -0.683368,
-    -0.682697,
-    -0.681043,
-    -0.679824,
-    -0.679953,
-    -0.680801,
-    -0.680924,
-    -0.679708,
-    -0.678073,
-    -0.677411,
-    -0.677997,
-    -0.678683,
-    -0.67821,
-    -0.676649,
-    -0.67531,
-    -0.675246,
-    -0.676048,
-    -0.676323,
-    -0.675285,
-    -0.673648,
-    -0.672809,
-    -0.673246,
-    -0.67398,
-    -0.673697,
-    -0.67225,
-    -0.67082,
-    -0.670563,
-    -0.671293,
-    -0.671697,
-    -0.670841,
-    -0.669232,
-    -0.668234,
-    -0.668509,
-    -0.669262,
-    -0.669157,
-    -0.667843,
-    -0.666349,
-    -0.665906,
-    -0.666539,
-    -0.667047,
-    -0.666375,
-    -0.66482,
-    -0.663686,
-    -0.663789,
-    -0.664532,
-    -0.66459,
-    -0.663424,
-    -0.661895,
-    -0.661274,
-    -0.661791,
-    -0.662376,
-    -0.661886,
-    -0.66041,
-    -0.659161,
-    -0.659089,
-    -0.659796,
-    -0.659997,
-    -0.65899,
-    -0.657454,
-    -0.656669,
-    -0.657053,
-    -0.657687,
-    -0.657373,
-    -0.655997,
-    -0.654658,
-    -0.65441,
-    -0.655056,
-    -0.65538,
-    -0.654539,
-    -0.653022,
-    -0.652088,
-    -0.652326,
-    -0.652984,
-    -0.652835,
-    -0.651577,
-    -0.650175,
-    -0.649755,
-    -0.650317,
-    -0.650741,
-    -0.650068,
-    -0.648596,
-    -0.647532,
-    -0.647614,
-    -0.648269,
-    -0.648272,
-    -0.647147,
-    -0.645707,
-    -0.645122,
-    -0.645581,
-    -0.646081,
-    -0.645576,
-    -0.644172,
-    -0.642999,
-    -0.64292,
-    -0.643546,
-    -0.643685,
-    -0.642704,
-    -0.641253,
-    -0.640514,
-    -0.640853,
-    -0.641404,
-    -0.641062,
-    -0.639746,
-    -0.638486,
-    -0.638245,
-    -0.63882,
-    -0.639075,
-    -0.638247,
-    -0.636808,
-    -0.635929,
-    -0.636135,
-    -0.636713,
-    -0.636525,
-    -0.635315,
-    -0.633992,
-    -0.633591,
-    -0.634092,
-    -0.634444,
-    -0.633771,
-    -0.63237,
-    -0.631367,
-    -0.631431,
-    -0.63201,
-    -0.631966,
-    -0.630876,
-    -0.629513,
-    -0.628959,
-    -0.629368,
-    -0.629794,
-    -0.629277,
-    -0.627934,
-    -0.626826,
-    -0.626742,
-    -0.627299,
-    -0.627384,
-    -0.626426,
-    -0.625048,
-    -0.624348,
-    -0.624649,
-    -0.625128,
-    -0.624762,
-    -0.623497,
-    -0.622305,
-    -0.622071,
-    -0.622584,
-    -0.62278,
-    -0.621962,
-    -0.620592,
-    -0.61976,
-    -0.619939,
-    -0.620447,
-    -0.620227,
-    -0.619057,
-    -0.617802,
-    -0.617418,
-    -0.617867,
-    -0.618157,
-    -0.617483,
-    -0.616142,
-    -0.615192,
-    -0.615241,
-    -0.615754,
-    -0.61567,
-    -0.61461,
-    -0.613314,
-    -0.612785,
-    -0.613151,
-    -0.613515,
-    -0.612986,
-    -0.611696,
-    -0.610645,
-    -0.610557,
-    -0.611054,
-    -0.611092,
-    -0.610154,
-    -0.608838,
-    -0.608173,
-    -0.608441,
-    -0.608857,
-    -0.608471,
-    -0.607251,
-    -0.606117,
-    -0.605888,
-    -0.606348,
-    -0.606494,
-    -0.605685,
-    -0.604373,
-    -0.603581,
-    -0.603738,
-    -0.604185,
-    -0.603936,
-    -0.602802,
-    -0.601606,
-    -0.601237,
-    -0.60164,
-    -0.601876,
-    -0.601202,
-    -0.599914,
-    -0.59901,
-    -0.599045,
-    -0.599502,
-    -0.599381,
-    -0.598348,
-    -0.597109,
-    -0.596605,
-    -0.596933,
-    -0.597241,
-    -0.596703,
-    -0.595459,
-    -0.594457,
-    -0.594365,
-    -0.59481,
-    -0.594807,
-    -0.593886,
-    -0.592626,
-    -0.591991,
-    -0.592229,
-    -0.592591,
-    -0.592187,
-    -0.591006,
-    -0.589923,
-    -0.5897,
-    -0.590113,
-    -0.590213,
-    -0.589412,
-    -0.588152,
-    -0.587397,
-    -0.587533,
-    -0.587927,
-    -0.587652,
-    -0.58655,
-    -0.585405,
-    -0.58505,
-    -0.585412,
-    -0.585601,
-    -0.584926,
-    -0.583685,
-    -0.582821,
-    -0.582845,
-    -0.583251,
-    -0.5831,
-    -0.58209,
-    -0.580902,
-    -0.580417,
-    -0.580713,
-    -0.580972,
-    -0.580425,
-    -0.579223,
-    -0.578264,
-    -0.578169,
-    -0.578567,
-    -0.578528,
-    -0.577622,
-    -0.57641,
-    -0.575803,
-    -0.576016,
-    -0.576328,
-    -0.575908,
-    -0.574762,
-    -0.573725,
-    -0.573506,
-    -0.573877,
-    -0.573938,
-    -0.573144,
-    -0.571929,
-    -0.571206,
-    -0.571324,
-    -0.571671,
-    -0.571374,
-    -0.570299,
-    -0.569201,
-    -0.568857,
-    -0.569184,
-    -0.569331,
-    -0.568655,
-    -0.567455,
-    -0.566628,
-    -0.566641,
-    -0.567003,
-    -0.566823,
-    -0.565833,
-    -0.564691,
-    -0.564225,
-    -0.564491,
-    -0.564708,
-    -0.564152,
-    -0.562986,
-    -0.562066,
-    -0.561968,
-    -0.562326,
-    -0.562254,
-    -0.561361,
-    -0.560193,
-    -0.559609,
-    -0.5598,
-    -0.560069,
-    -0.559635,
-    -0.558519,
-    -0.557522,
-    -0.557307,
-    -0.557642,
-    -0.557668,
-    -0.55688,
-    -0.555705,
-    -0.555011,
-    -0.555113,
-    -0.555418,
-    -0.555101,
-    -0.554051,
-    -0.552993,
-    -0.55266,
-    -0.552956,
-    -0.553065,
-    -0.552388,
-    -0.551225,
-    -0.55043,
-    -0.550434,
-    -0.550756,
-    -0.550551,
-    -0.54958,
-    -0.548477,
-    -0.548028,
-    -0.548268,
-    -0.548446,
-    -0.547883,
-    -0.546749,
-    -0.545865,
-    -0.545764,
-    -0.546085,
-    -0.545984,
-    -0.545103,
-    -0.543974,
-    -0.543412,
-    -0.543582,
-    -0.543813,
-    -0.543365,
-    -0.542276,
-    -0.541316,
-    -0.541106,
-    -0.541408,
-    -0.541401,
-    -0.540618,
-    -0.53948,
-    -0.538812,
-    -0.5389,
-    -0.539167,
-    -0.538832,
-    -0.537803,
-    -0.536782,
-    -0.53646,
-    -0.536727,
-    -0.536802,
-    -0.536124,
-    -0.534994,
-    -0.534228,
-    -0.534225,
-    -0.53451,
-    -0.534283,
-    -0.533327,
-    -0.532262,
-    -0.531828,
-    -0.532044,
-    -0.532187,
-    -0.531618,
-    -0.530513,
-    -0.52966,
-    -0.529557,
-    -0.529845,
-    -0.529718,
-    -0.528847,
-    -0.527753,
-    -0.527211,
-    -0.527363,
-    -0.527559,
-    -0.527099,
-    -0.526035,
-    -0.525107,
-    -0.524901,
-    -0.525173,
-    -0.525137,
-    -0.524359,
-    -0.523254,
-    -0.522609,
-    -0.522685,
-    -0.522918,
-    -0.522566,
-    -0.521557,
-    -0.520569,
-    -0.520256,
-    -0.520497,
-    -0.520541,
-    -0.519863,
-    -0.518762,
-    -0.518023,
-    -0.518013,
-    -0.518266,
-    -0.518018,
-    -0.517077,
-    -0.516044,
-    -0.515624,
-    -0.51582,
-    -0.515931,
-    -0.515355,
-    -0.514276,
-    -0.513452,
-    -0.513348,
-    -0.513606,
-    -0.513455,
-    -0.512593,
-    -0.511531,
-    -0.511006,
-    -0.511142,
-    -0.511306,
-    -0.510836,
-    -0.509794,
-    -0.508896,
-    -0.508693,
-    -0.508939,
-    -0.508877,
-    -0.508103,
-    -0.507027,
-    -0.506403,
-    -0.506468,
-    -0.50667,
-    -0.506303,
-    -0.505311,
-    -0.504354,
-    -0.504049,
-    -0.504268,
-    -0.504284,
-    -0.503604,
-    -0.502531,
-    -0.501815,
-    -0.501799,
-    -0.502023,
-    -0.501756,
-    -0.500828,
-    -0.499825,
-    -0.499418,
-    -0.499594,
-    -0.499676,
-    -0.499095,
-    -0.49804,
-    -0.497242,
-    -0.497137,
-    -0.497367,
-    -0.497194,
-    -0.496341,
-    -0.495307,
-    -0.494799,
-    -0.494921,
-    -0.495056,
-    -0.494575,
-    -0.493553,
-    -0.492683,
-    -0.492483,
-    -0.492705,
-    -0.492618,
-    -0.491848,
-    -0.490799,
-    -0.490195,
-    -0.49025,
-    -0.490423,
-    -0.490042,
-    -0.489067,
-    -0.488138,
-    -0.48784,
-    -0.488038,
-    -0.488028,
-    -0.487347,
-    -0.486299,
-    -0.485605,
-    -0.485583,
-    -0.485781,
-    -0.485496,
-    -0.48458,
-    -0.483605,
-    -0.483209,
-    -0.483368,
-    -0.483424,
-    -0.482837,
-    -0.481804,
-    -0.48103,
-    -0.480923,
-    -0.481129,
-    -0.480936,
-    -0.48009,
-    -0.479083,
-    -0.47859,
-    -0.478698,
-    -0.478807,
-    -0.478316,
-    -0.477313,
-    -0.476468,
-    -0.476271,
-    -0.476471,
-    -0.476362,
-    -0.475595,
-    -0.474571,
-    -0.473985,
-    -0.47403,
-    -0.474178,
-    -0.473784,
-    -0.472823,
-    -0.471919,
-    -0.471629,
-    -0.471807,
-    -0.471774,
-    -0.471092,
-    -0.470066,
-    -0.469393,
-    -0.469366,
-    -0.469539,
-    -0.469238,
-    -0.468333,
-    -0.467383,
-    -0.466998,
-    -0.467141,
-    -0.467173,
-    -0.466581,
-    -0.465568,
-    -0.464816,
-    -0.464708,
-    -0.464891,
-    -0.46468,
-    -0.46384,
-    -0.462858,
-    -0.462379,
-    -0.462475,
-    -0.462559,
-    -0.46206,
-    -0.461073,
-    -0.460251,
-    -0.460058,
-    -0.460237,
-    -0.460108,
-    -0.459343,
-    -0.458342,
-    -0.457773,
-    -0.45781,
-    -0.457934,
-    -0.457527,
-    -0.45658,
-    -0.4557,
-    -0.455416,
-    -0.455577,
-    -0.455522,
-    -0.454839,
-    -0.453834,
-    -0.45318,
-    -0.453148,
-    -0.453298,
-    -0.452983,
-    -0.452087,
-    -0.45116,
-    -0.450785,
-    -0.450914,
-    -0.450923,
-    -0.450327,
-    -0.449331,
-    -0.4486,
-    -0.448492,
-    -0.448654,
-    -0.448425,
-    -0.447592,
-    -0.446631,
-    -0.446166,
-    -0.446251,
-    -0.446313,
-    -0.445805,
-    -0.444833,
-    -0.444033,
-    -0.443843,
-    -0.444003,
-    -0.443855,
-    -0.443092,
-    -0.442112,
-    -0.441559,
-    -0.441588,
-    -0.44169,
-    -0.441273,
-    -0.440338,
-    -0.439479,
-    -0.439202,
-    -0.439347,
-    -0.439271,
-    -0.438587,
-    -0.437601,
-    -0.436964,
-    -0.436929,
-    -0.437058,
-    -0.436729,
-    -0.435842,
-    -0.434936,
-    -0.434571,
-    -0.434687,
-    -0.434675,
-    -0.434074,
-    -0.433095,
-    -0.432383,
-    -0.432274,
-    -0.432417,
-    -0.432172,
-    -0.431344,
-    -0.430405,
-    -0.429951,
-    -0.430026,
-    -0.430067,
-    -0.429552,
-    -0.428594,
-    -0.427814,
-    -0.427626,
-    -0.427769,
-    -0.427603,
-    -0.426843,
-    -0.425882,
-    -0.425343,
-    -0.425366,
-    -0.425448,
-    -0.425019,
-    -0.424096,
-    -0.423257,
-    -0.422986,
-    -0.423116,
-    -0.423022,
-    -0.422336,
-    -0.421367,
-    -0.420748,
-    -0.420709,
-    -0.420818,
-    -0.420476,
-    -0.419597,
-    -0.418712,
-    -0.418356,
-    -0.418459,
-    -0.418428,
-    -0.417822,
-    -0.416859,
-    -0.416164,
-    -0.416055,
-    -0.416181,
-    -0.415921,
-    -0.415098,
-    -0.414177,
-    -0.413735,
-    -0.413801,
-    -0.413822,
-    -0.4133,
-    -0.412355,
-    -0.411593,
-    -0.411408,
-    -0.411536,
-    -0.411353,
-    -0.410595,
-    -0.409652,
-    -0.409127,
-    -0.409143,
-    -0.409206,
-    -0.408767,
-    -0.407854,
-    -0.407034,
-    -0.406769,
-    -0.406885,
-    -0.406774,
-    -0.406086,
-    -0.405134,
-    -0.40453,
-    -0.404487,
-    -0.404579,
-    -0.404224,
-    -0.403353,
-    -0.402486,
-    -0.402139,
-    -0.402231,
-    -0.402182,
-    -0.401572,
-    -0.400623,
-    -0.399945,
-    -0.399836,
-    -0.399944,
-    -0.39967,
-    -0.398852,
-    -0.397949,
-    -0.397518,
-    -0.397575,
-    -0.397579,
-    -0.397049,
-    -0.396116,
-    -0.395372,
-    -0.39519,
-    -0.395302,
-    -0.395104,
-    -0.394347,
-    -0.393421,
-    -0.392909,
-    -0.392919,
-    -0.392965,
-    -0.392517,
-    -0.391613,
-    -0.39081,
-    -0.390551,
-    -0.390654,
-    -0.390526,
-    -0.389838,
-    -0.388901,
-    -0.38831,
-    -0.388266,
-    -0.388341,
-    -0.387974,
-    -0.38711,
-    -0.38626,
-    -0.385921,
-    -0.386003,
-    -0.385937,
-    -0.385322,
-    -0.384387,
-    -0.383724,
-    -0.383615,
-    -0.383708,
-    -0.383421,
-    -0.382606,
-    -0.38172,
-    -0.3813,
-    -0.381349,
-    -0.381335,
-    -0.380799,
-    -0.379878,
-    -0.379149,
-    -0.37897,
-    -0.379069,
-    -0.378856,
-    -0.3781,
-    -0.37719,
-    -0.37669,
-    -0.376695,
-    -0.376724,
-    -0.376267,
-    -0.375372,
-    -0.374586,
-    -0.374332,
-    -0.374423,
-    -0.37428,
-    -0.37359,
-    -0.372667,
-    -0.37209,
-    -0.372043,
-    -0.372102,
-    -0.371725,
-    -0.370867,
-    -0.370034,
-    -0.369702,
-    -0.369774,
-    -0.369692,
-    -0.369074,
-    -0.368151,
-    -0.367502,
-    -0.367394,
-    -0.367473,
-    -0.367173,
-    -0.366362,
-    -0.365491,
-    -0.365081,
-    -0.365123,
-    -0.365093,
-    -0.36455,
-    -0.363639,
-    -0.362926,
-    -0.36275,
-    -0.362835,
-    -0.362609,
-    -0.361854,
-    -0.360958,
-    -0.36047,
-    -0.360471,
-    -0.360484,
-    -0.360018,
-    -0.359131,
-    -0.358361,
-    -0.358112,
-    -0.358192,
-    -0.358034,
-    -0.357343,
-    -0.356433,
-    -0.355869,
-    -0.35582,
-    -0.355865,
-    -0.355477,
-    -0.354624,
-    -0.353806,
-    -0.353482,
-    -0.353545,
-    -0.353448,
-    -0.352826,
-    -0.351914,
-    -0.35128,
-    -0.351172,
-    -0.351237,
-    -0.350925,
-    -0.350117,
-    -0.349262,
-    -0.34886,
-    -0.348896,
-    -0.348851,
-    -0.348302,
-    -0.347401,
-    -0.346702,
-    -0.346528,
-    -0.346602,
-    -0.346363,
-    -0.345609,
-    -0.344726,
-    -0.344249,
-    -0.344245,
-    -0.344244,
-    -0.34377,
-    -0.342891,
-    -0.342135,
-    -0.341891,
-    -0.341962,
-    -0.34179,
-    -0.341096,
-    -0.340199,
-    -0.339647,
-    -0.339596,
-    -0.339627,
-    -0.339229,
-    -0.338382,
-    -0.337578,
-    -0.337261,
-    -0.337316,
-    -0.337205,
-    -0.336579,
-    -0.335678,
-    -0.335057,
-    -0.334949,
-    -0.335002,
-    -0.334679,
-    -0.333874,
-    -0.333032,
-    -0.332639,
-    -0.332669,
-    -0.33261,
-    -0.332055,
-    -0.331162,
-    -0.330477,
-    -0.330307,
-    -0.330369,
-    -0.330117,
-    -0.329364,
-    -0.328494,
-    -0.328027,
-    -0.32802,
-    -0.328005,
-    -0.327523,
-    -0.32665,
-    -0.325908,
-    -0.32567,
-    -0.32573,
-    -0.325545,
-    -0.32485,
-    -0.323965,
-    -0.323425,
-    -0.323372,
-    -0.32339,
-    -0.322983,
-    -0.32214,
-    -0.32135,
-    -0.32104,
-    -0.321087,
-    -0.320963,
-    -0.320332,
-    -0.319442,
-    -0.318833,
-    -0.318726,
-    -0.318767,
-    -0.318433,
-    -0.31763,
-    -0.316801,
-    -0.316418,
-    -0.316441,
-    -0.316369,
-    -0.315808,
-    -0.314924,
-    -0.314252,
-    -0.314084,
-    -0.314136,
-    -0.313873,
-    -0.313119,
-    -0.312262,
-    -0.311805,
-    -0.311794,
-    -0.311766,
-    -0.311277,
-    -0.31041,
-    -0.309681,
-    -0.309447,
-    -0.309499,
-    -0.309302,
-    -0.308605,
-    -0.30773,
-    -0.307202,
-    -0.307147,
-    -0.307153,
-    -0.306737,
-    -0.305899,
-    -0.305121,
-    -0.304817,
-    -0.304858,
-    -0.304721,
-    -0.304087,
-    -0.303205,
-    -0.302609,
-    -0.302502,
-    -0.302532,
-    -0.302188,
-    -0.301387,
-    -0.300571,
-    -0.300195,
-    -0.300214,
-    -0.300129,
-    -0.299562,
-    -0.298686,
-    -0.298026,
-    -0.297861,
-    -0.297903,
-    -0.297628,
-    -0.296875,
-    -0.296029,
-    -0.295582,
-    -0.295568,
-    -0.295528,
-    -0.295031,
-    -0.29417,
-    -0.293454,
-    -0.293225,
-    -0.293268,
-    -0.293059,
-    -0.29236,
-    -0.291496,
-    -0.290978,
-    -0.290922,
-    -0.290917,
-    -0.290491,
-    -0.289657,
-    -0.288892,
-    -0.288595,
-    -0.288629,
-    -0.288479,
-    -0.287841,
-    -0.286969,
-    -0.286384,
-    -0.286278,
-    -0.286297,
-    -0.285943,
-    -0.285145,
-    -0.28434,
-    -0.283972,
-    -0.283986,
-    -0.283889,
-    -0.283317,
-    -0.282448,
-    -0.2818,
-    -0.281638,
-    -0.28167,
-    -0.281385,
-    -0.280632,
-    -0.279796,
-    -0.279358,
-    -0.279342,
-    -0.27929,
-    -0.278786,
-    -0.277931,
-    -0.277226,
-    -0.277001,
-    -0.277037,
-    -0.276817,
-    -0.276116,
-    -0.275261,
-    -0.274753,
-    -0.274697,
-    -0.27468,
-    -0.274247,
-    -0.273416,
-    -0.272662,
-    -0.272371,
-    -0.272399,
-    -0.272238,
-    -0.271597,
-    -0.270733,
-    -0.270158,
-    -0.270054,
-    -0.270063,
-    -0.269699,
-    -0.268903,
-    -0.268108,
-    -0.267749,
-    -0.267758,
-    -0.26765,
-    -0.267072,
-    -0.26621,
-    -0.265573,
-    -0.265414,
-    -0.265438,
-    -0.265142,
-    -0.264388,
-    -0.263563,
-    -0.263134,
-    -0.263115,
-    -0.263052,
-    -0.262541,
-    -0.261691,
-    -0.260998,
-    -0.260778,
-    -0.260806,
-    -0.260575,
-    -0.259872,
-    -0.259026,
-    -0.258528,
-    -0.258471,
-    -0.258444,
-    -0.258002,
-    -0.257175,
-    -0.256433,
-    -0.256148,
-    -0.25617,
-    -0.255998,
-    -0.255352,
-    -0.254496,
-    -0.253932,
-    -0.253829,
-    -0.253829,
-    -0.253455,
-    -0.25266,
-    -0.251877,
-    -0.251525,
-    -0.25153,
-    -0.251411,
-    -0.250828,
-    -0.249972,
-    -0.249345,
-    -0.249189,
-    -0.249205,
-    -0.248899,
-    -0.248146,
-    -0.24733,
-    -0.246909,
-    -0.246888,
-    -0.246814,
-    -0.246297,
-    -0.245452,
-    -0.244769,
-    -0.244554,
-    -0.244575,
-    -0.244333,
-    -0.243629,
-    -0.242791,
-    -0.242303,
-    -0.242245,
-    -0.242209,
-    -0.241759,
-    -0.240934,
-    -0.240202,
-    -0.239923,
-    -0.23994,
-    -0.239758,
-    -0.239109,
-    -0.238259,
-    -0.237705,
-    -0.237604,
-    -0.237594,
-    -0.237212,
-    -0.236419,
-    -0.235645,
-    -0.2353,
-    -0.235302,
-    -0.235172,
-    -0.234584,
-    -0.233734,
-    -0.233118,
-    -0.232964,
-    -0.232973,
-    -0.232657,
-    -0.231903,
-    -0.231097,
-    -0.230684,
-    -0.230661,
-    -0.230577,
-    -0.230053,
-    -0.229212,
-    -0.22854,
-    -0.228329,
-    -0.228344,
-    -0.228092,
-    -0.227385,
-    -0.226556,
-    -0.226077,
-    -0.226019,
-    -0.225973,
-    -0.225515,
-    -0.224694,
-    -0.223972,
-    -0.223699,
-    -0.223711,
-    -0.223518,
-    -0.222865,
-    -0.222023,
-    -0.221478,
-    -0.221378,
-    -0.22136,
-    -0.22097,
-    -0.220177,
-    -0.219413,
-    -0.219075,
-    -0.219074,
-    -0.218934,
-    -0.21834,
-    -0.217495,
-    -0.21689,
-    -0.216739,
-    -0.21674,
-    -0.216415,
-    -0.21566,
-    -0.214863,
-    -0.214459,
-    -0.214434,
-    -0.21434,
-    -0.21381,
-    -0.212973,
-    -0.21231,
-    -0.212104,
-    -0.212113,
-    -0.211852,
-    -0.211143,
-    -0.210321,
-    -0.20985,
-    -0.209793,
-    -0.209738,
-    -0.209273,
-    -0.208453,
-    -0.207741,
-    -0.207474,
-    -0.207481,
-    -0.207279,
-    -0.206622,
-    -0.205786,
-    -0.205251,
-    -0.205152,
-    -0.205127,
-    -0.204728,
-    -0.203936,
-    -0.203181,
-    -0.20285,
-    -0.202845,
-    -0.202696,
-    -0.202097,
-    -0.201257,
-    -0.200661,
-    -0.200514,
-    -0.200508,
-    -0.200174,
-    -0.199418,
-    -0.198629,
-    -0.198233,
-    -0.198206,
-    -0.198104,
-    -0.197567,
-    -0.196733,
-    -0.196081,
-    -0.195879,
-    -0.195883,
-    -0.195612,
-    -0.1949,
-    -0.194086,
-    -0.193624,
-    -0.193566,
-    -0.193503,
-    -0.19303,
-    -0.192213,
-    -0.19151,
-    -0.191248,
-    -0.191252,
-    -0.19104,
-    -0.190379,
-    -0.189549,
-    -0.189023,
-    -0.188926,
-    -0.188893,
-    -0.188486,
-    -0.187694,
-    -0.186948,
-    -0.186624,
-    -0.186617,
-    -0.186458,
-    -0.185854,
-    -0.185019,
-    -0.184432,
-    -0.184288,
-    -0.184276,
-    -0.183933,
-    -0.183176,
-    -0.182395,
-    -0.182006,
-    -0.181979,
-    -0.181868,
-    -0.181324,
-    -0.180494,
-    -0.179851,
-    -0.179653,
-    -0.179652,
-    -0.179372,
-    -0.178657,
-    -0.17785,
-    -0.177397,
-    -0.177339,
-    -0.177268,
-    -0.176788,
-    -0.175972,
-    -0.175278,
-    -0.175023,
-    -0.175022,
-    -0.174801,
-    -0.174136,
-    -0.173313,
-    -0.172795,
-    -0.1727,
-    -0.17266,
-    -0.172244,
-    -0.171453,
-    -0.170715,
-    -0.170398,
-    -0.170388,
-    -0.170221,
-    -0.169612,
-    -0.168781,
-    -0.168203,
-    -0.168062,
-    -0.168044,
-    -0.167692,
-    -0.166935,
-    -0.166161,
-    -0.16578,
-    -0.165751,
-    -0.165631,
-    -0.165082,
-    -0.164255,
-    -0.16362,
-    -0.163428,
-    -0.163421,
-    -0.163132,
-    -0.162415,
-    -0.161614,
-    -0.161169,
-    -0.161113,
-    -0.161033,
-    -0.160546,
-    -0.159732,
-    -0.159047,
-    -0.158797,
-    -0.158793,
-    -0.158562,
-    -0.157894,
-    -0.157076,
-    -0.156567,
-    -0.156474,
-    -0.156426,
-    -0.156003,
-    -0.155212,
-    -0.154482,
-    -0.154172,
-    -0.15416,
-    -0.153984,
-    -0.153369,
-    -0.152543,
-    -0.151974,
-    -0.151836,
-    -0.151812,
-    -0.151452,
-    -0.150693,
-    -0.149926,
-    -0.149553,
-    -0.149523,
-    -0.149396,
-    -0.14884,
-    -0.148015,
-    -0.14739,
-    -0.147202,
-    -0.14719,
-    -0.146893,
-    -0.146173,
-    -0.145379,
-    -0.144942,
-    -0.144886,
-    -0.144799,
-    -0.144304,
-    -0.143492,
-    -0.142815,
-    -0.142571,
-    -0.142563,
-    -0.142324,
-    -0.141652,
-    -0.140839,
-    -0.140338,
-    -0.140247,
-    -0.140193,
-    -0.139762,
-    -0.138971,
-    -0.138249,
-    -0.137945,
-    -0.137931,
-    -0.137747,
-    -0.137127,
-    -0.136305,
-    -0.135744,
-    -0.13561,
-    -0.13558,
-    -0.135212,
-    -0.134451,
-    -0.133692,
-    -0.133326,
-    -0.133296,
-    -0.13316,
-    -0.132598,
-    -0.131776,
-    -0.131159,
-    -0.130975,
-    -0.13096,
-    -0.130654,
-    -0.129931,
-    -0.129143,
-    -0.128714,
-    -0.128658,
-    -0.128564,
-    -0.128063,
-    -0.127252,
-    -0.126582,
-    -0.126344,
-    -0.126333,
-    -0.126086,
-    -0.12541,
-    -0.124601,
-    -0.12411,
-    -0.124021,
-    -0.12396,
-    -0.123521,
-    -0.12273,
-    -0.122015,
-    -0.121718,
-    -0.121702,
-    -0.12151,
-    -0.120885,
-    -0.120066,
-    -0.119514,
-    -0.119384,
-    -0.119348,
-    -0.118972,
-    -0.11821,
-    -0.117457,
-    -0.117098,
-    -0.117068,
-    -0.116925,
-    -0.116356,
-    -0.115537,
-    -0.114928,
-    -0.114749,
-    -0.114729,
-    -0.114415,
-    -0.11369,
-    -0.112907,
-    -0.112485,
-    -0.112431,
-    -0.11233,
-    -0.111822,
-    -0.111012,
-    -0.11035,
-    -0.110118,
-    -0.110104,
-    -0.109849,
-    -0.109168,
-    -0.108364,
-    -0.10788,
-    -0.107794,
-    -0.107727,
-    -0.107281,
-    -0.106489,
-    -0.105782,
-    -0.105491,
-    -0.105474,
-    -0.105274,
-    -0.104643,
-    -0.103828,
-    -0.103284,
-    -0.103157,
-    -0.103117,
-    -0.102733,
-    -0.101969,
-    -0.101222,
-    -0.100871,
-    -0.10084,
-    -0.100689,
-    -0.100115,
-    -0.0992976,
-    -0.0986962,
-    -0.0985222,
-    -0.0984986,
-    -0.0981763,
-    -0.0974481,
-    -0.0966706,
-    -0.0962569,
-    -0.096204,
-    -0.0960963,
-    -0.095581,
-    -0.0947715,
-    -0.0941175,
-    -0.0938907,
-    -0.0938745,
-    -0.0936113,
-    -0.0929263,
-    -0.0921268,
-    -0.091651,
-    -0.0915669,
-    -0.0914946,
-    -0.0910408,
-    -0.0902486,
-    -0.0895478,
-    -0.0892638,
-    -0.0892453,
-    -0.0890374,
-    -0.0884019,
-    -0.0875897,
-    -0.0870534,
-    -0.0869303,
-    -0.086885,
-    -0.0864934,
-    -0.0857274,
-    -0.0849869,
-    -0.0846427,
-    -0.0846123,
-    -0.0844544,
-    -0.0838737,
-    -0.0830583,
-    -0.0824646,
-    -0.0822954,
-    -0.0822682,
-    -0.081938,
-    -0.0812066,
-    -0.0804343,
-    -0.0800283,
-    -0.0799767,
-    -0.0798625,
-    -0.0793404,
-    -0.0785314,
-    -0.0778847,
-    -0.0776637,
-    -0.0776451,
-    -0.0773741,
-    -0.0766847,
-    -0.0758893,
-    -0.0754214,
-    -0.07534,
-    -0.0752621,
-    -0.0748009,
-    -0.0740078,
-    -0.0733138,
-    -0.0730364,
-    -0.0730168,
-    -0.0728014,
-    -0.0721605,
-    -0.0713512,
-    -0.0708227,
-    -0.0707035,
-    -0.0706537,
-    -0.0702544,
-    -0.0694862,
-    -0.0687516,
-    -0.0684146,
-    -0.0683844,
-    -0.0682196,
-    -0.0676327,
-    -0.0668188,
-    -0.0662327,
-    -0.0660685,
-    -0.0660379,
-    -0.0657,
-    -0.0649652,
-    -0.0641978,
-    -0.0637994,
-    -0.0637494,
-    -0.063629,
-    -0.0630999,
-    -0.0622912,
-    -0.0616517,
-    -0.0614365,
-    -0.0614158,
-    -0.0611371,
-    -0.0604433,
-    -0.0596517,
-    -0.0591916,
-    -0.059113,
-    -0.0590298,
-    -0.0585612,
-    -0.057767,
-    -0.0570795,
-    -0.0568087,
-    -0.0567883,
-    -0.0565656,
-    -0.0559193,
-    -0.0551126,
-    -0.0545918,
-    -0.0544765,
-    -0.0544225,
-    -0.0540155,
-    -0.053245,
-    -0.0525162,
-    -0.0521863,
-    -0.0521566,
-    -0.051985,
-    -0.0513918,
-    -0.0505794,
-    -0.0500007,
-    -0.0498415,
-    -0.0498078,
-    -0.0494621,
-    -0.0487238,
-    -0.0479612,
-    -0.0475703,
-    -0.047522,
-    -0.0473956,
-    -0.0468596,
-    -0.046051,
-    -0.0454184,
-    -0.0452092,
-    -0.0451866,
-    -0.0449004,
-    -0.044202,
-    -0.043414,
-    -0.0429615,
-    -0.0428859,
-    -0.0427976,
-    -0.0423216,
-    -0.0415263,
-    -0.0408451,
-    -0.0405809,
-    -0.0405599,
-    -0.04033,
-    -0.0396782,
-    -0.0388739,
-    -0.0383607,
-    -0.0382496,
-    -0.0381914,
-    -0.0377768,
-    -0.0370039,
-    -0.0362805,
-    -0.0359578,
-    -0.0359288,
-    -0.0357506,
-    -0.0351511,
-    -0.0343398,
-    -0.0337685,
-    -0.0336144,
-    -0.0335777,
-    -0.0332244,
-    -0.0324825,
-    -0.0317244,
-    -0.031341,
-    -0.0312947,
-    -0.0311624,
-    -0.0306195,
-    -0.0298107,
-    -0.029185,
-    -0.0289818,
-    -0.0289574,
-    -0.0286638,
-    -0.0279607,
-    -0.0271761,
-    -0.0267313,
-    -0.0266588,
-    -0.0265656,
-    -0.0260822,
-    -0.0252855,
-    -0.0246105,
-    -0.024353,
-    -0.0243315,
-    -0.0240946,
-    -0.0234371,
-    -0.022635,
-    -0.0221294,
-    -0.0220225,
-    -0.0219605,
-    -0.0215383,
-    -0.0207628,
-    -0.0200447,
-    -0.0197292,
-    -0.0197011,
-    -0.0195164,
-    -0.0189105,
-    -0.0181001,
-    -0.017536,
-    -0.0173872,
-    -0.0173478,
-    -0.016987,
-    -0.0162412,
-    -0.0154875,
-    -0.0151115,
-    -0.0150673,
-    -0.0149294,
-    -0.0143795,
-    -0.0135704,
-    -0.0129514,
-    -0.0127543,
-    -0.0127284,
-    -0.0124275,
-    -0.0117195,
-    -0.0109381,
-    -0.0105009,
-    -0.0104317,
-    -0.0103337,
-    -0.00984299,
-    -0.00904468,
-    -0.00837565,
-    -0.00812494,
-    -0.00810324,
-    -0.00785936,
-    -0.0071962,
-    -0.00639609,
-    -0.00589796,
-    -0.00579542,
-    -0.00572973,
-    -0.00530001,
-    -0.00452165,
-    -0.00380873,
-    -0.00350046,
-    -0.00347336,
-    -0.00328242,
-    -0.00266999,
-    -0.00186039,
-    -0.00130341,
-    -0.00115996,
-    -0.00111808,
-    -0.000749663,
-    0,
-    0.000749663,
-    0.00111808,
-    0.00115996,
-    0.00130341,
-    0.00186039,
-    0.00266999,
-    0.00328242,
-    0.00347336,
-    0.00350046,
-    0.00380873,
-    0.00452165,
-    0.00530001,
-    0.00572973,
-    0.00579542,
-    0.00589796,
-    0.00639609,
-    0.0071962,
-    0.00785936,
-    0.00810324,
-    0.00812494,
-    0.00837565,
-    0.00904468,
-    0.00984299,
-    0.0103337,
-    0.0104317,
-    0.0105009,
-    0.0109381,
-    0.0117195,
-    0.0124275,
-    0.0127284,
-    0.0127543,
-    0.0129514,
-    0.0135704,
-    0.0143795,
-    0.0149294,
-    0.0150673,
-    0.0151115,
-    0.0154875,
-    0.0162412,
-    0.016987,
-    0.0173478,
-    0.0173872,
-    0.017536,
-    0.0181001,
-    0.0189105,
-    0.0195164,
-    0.0197011,
-    0.0197292,
-    0.0200447,
-    0.0207628,
-    0.0215383,
-    0.0219605,
-    0.0220225,
-    0.0221294,
-    0.022635,
-    0.0234371,
-    0.0240946,
-    0.0243315,
-    0.024353,
-    0.0246105,
-    0.0252855,
-    0.0260822,
-    0.0265656,
-    0.0266588,
-    0.0267313,
-    0.0271761,
-    0.0279607,
-    0.0286638,
-    0.0289574,
-    0.0289818,
-    0.029185,
-    0.0298107,
-    0.0306195,
-    0.0311624,
-    0.0312947,
-    0.031341,
-    0.0317244,
-    0.0324825,
-    0.0332244,
-    0.0335777,
-    0.0336144,
-    0.0337685,
-    0.0343398,
-    0.0351511,
-    0.0357506,
-    0.0359288,
-    0.0359578,
-    0.0362805,
-    0.0370039,
-    0.0377768,
-    0.0381914,
-    0.0382496,
-    0.0383607,
-    0.0388739,
-    0.0396782,
-    0.04033,
-    0.0405599,
-    0.0405809,
-    0.0408451,
-    0.0415263,
-    0.0423216,
-    0.0427976,
-    0.0428859,
-    0.0429615,
-    0.043414,
-    0.044202,
-    0.0449004,
-    0.0451866,
-    0.0452092,
-    0.0454184,
-    0.046051,
-    0.0468596,
-    0.0473956,
-    0.047522,
-    0.0475703,
-    0.0479612,
-    0.0487238,
-    0.0494621,
-    0.0498078,
-    0.0498415,
-    0.0500007,
-    0.0505794,
-    0.0513918,
-    0.051985,
-    0.0521566,
-    0.0521863,
-    0.0525162,
-    0.053245,
-    0.0540155,
-    0.0544225,
-    0.0544765,
-    0.0545918,
-    0.0551126,
-    0.0559193,
-    0.0565656,
-    0.0567883,
-    0.0568087,
-    0.0570795,
-    0.057767,
-    0.0585612,
-    0.0590298,
-    0.059113,
-    0.0591916,
-    0.0596517,
-    0.0604433,
-    0.0611371,
-    0.0614158,
-    0.0614365,
-    0.0616517,
-    0.0622912,
-    0.0630999,
-    0.063629,
-    0.0637494,
-    0.0637994,
-    0.0641978,
-    0.0649652,
-    0.0657,
-    0.0660379,
-    0.0660685,
-    0.0662327,
-    0.0668188,
-    0.0676327,
-    0.0682196,
-    0.0683844,
-    0.0684146,
-    0.0687516,
-    0.0694862,
-    0.0702544,
-    0.0706537,
-    0.0707035,
-    0.0708227,
-    0.0713512,
-    0.0721605,
-    0.0728014,
-    0.0730168,
-    0.0730364,
-    0.0733138,
-    0.0740078,
-    0.0748009,
-    0.0752621,
-    0.07534,
-    0.0754214,
-    0.0758893,
-    0.0766847,
-    0.0773741,
-    0.0776451,
-    0.0776637,
-    0.0778847,
-    0.0785314,
-    0.0793404,
-    0.0798625,
-    0.0799767,
-    0.0800283,
-    0.0804343,
-    0.0812066,
-    0.081938,
-    0.0822682,
-    0.0822954,
-    0.0824646,
-    0.0830583,
-    0.0838737,
-    0.0844544,
-    0.0846123,
-    0.0846427,
-    0.0849869,
-    0.0857274,
-    0.0864934,
-    0.086885,
-    0.0869303,
-    0.0870534,
-    0.0875897,
-    0.0884019,
-    0.0890374,
-    0.0892453,
-    0.0892638,
-    0.0895478,
-    0.0902486,
-    0.0910408,
-    0.0914946,
-    0.0915669,
-    0.091651,
-    0.0921268,
-    0.0929263,
-    0.0936113,
-    0.0938745,
-    0.0938907,
-    0.0941175,
-    0.0947715,
-    0.095581,
-    0.0960963,
-    0.096204,
-    0.0962569,
-    0.0966706,
-    0.0974481,
-    0.0981763,
-    0.0984986,
-    0.0985222,
-    0.0986962,
-    0.0992976,
-    0.100115,
-    0.100689,
-    0.10084,
-    0.100871,
-    0.101222,
-    0.101969,
-    0.102733,
-    0.103117,
-    0.103157,
-    0.103284,
-    0.103828,
-    0.104643,
-    0.105274,
-    0.105474,
-    0.105491,
-    0.105782,
-    0.106489,
-    0.107281,
-    0.107727,
-    0.107794,
-    0.10788,
-    0.108364,
-    0.109168,
-    0.109849,
-    0.110104,
-    0.110118,
-    0.11035,
-    0.111012,
-    0.111822,
-    0.11233,
-    0.112431,
-    0.112485,
-    0.112907,
-    0.11369,
-    0.114415,
-    0.114729,
-    0.114749,
-    0.114928,
-    0.115537,
-    0.116356,
-    0.116925,
-    0.117068,
-    0.117098,
-    0.117457,
-    0.11821,
-    0.118972,
-    0.119348,
-    0.119384,
-    0.119514,
-    0.120066,
-    0.120885,
-    0.12151,
-    0.121702,
-    0.121718,
-    0.122015,
-    0.12273,
-    0.123521,
-    0.12396,
-    0.124021,
-    0.12411,
-    0.124601,
-    0.12541,
-    0.126086,
-    0.126333,
-    0.126344,
-    0.126582,
-    0.127252,
-    0.128063,
-    0.128564,
-    0.128658,
-    0.128714,
-    0.129143,
-    0.129931,
-    0.130654,
-    0.13096,
-    0.130975,
-    0.131159,
-    0.131776,
-    0.132598,
-    0.13316,
-    0.133296,
-    0.133326,
-    0.133692,
-    0.134451,
-    0.135212,
-    0.13558,
-    0.13561,
-    0.135744,
-    0.136305,
-    0.137127,
-    0.137747,
-    0.137931,
-    0.137945,
-    0.138249,
-    0.138971,
-    0.139762,
-    0.140193,
-    0.140247,
-    0.140338,
-    0.140839,
-    0.141652,
-    0.142324,
-    0.142563,
-    0.142571,
-    0.142815,
-    0.143492,
-    0.144304,
-    0.144799,
-    0.144886,
-    0.144942,
-    0.145379,
-    0.146173,
-    0.146893,
-    0.14719,
-    0.147202,
-    0.14739,
-    0.148015,
-    0.14884,
-    0.149396,
-    0.149523,
-    0.149553,
-    0.149926,
-    0.150693,
-    0.151452,
-    0.151812,
-    0.151836,
-    0.151974,
-    0.152543,
-    0.153369,
-    0.153984,
-    0.15416,
-    0.154172,
-    0.154482,
-    0.155212,
-    0.156003,
-    0.156426,
-    0.156474,
-    0.156567,
-    0.157076,
-    0.157894,
-    0.158562,
-    0.158793,
-    0.158797,
-    0.159047,
-    0.159732,
-    0.160546,
-    0.161033,
-    0.161113,
-    0.161169,
-    0.161614,
-    0.162415,
-    0.163132,
-    0.163421,
-    0.163428,
-    0.16362,
-    0.164255,
-    0.165082,
-    0.165631,
-    0.165751,
-    0.16578,
-    0.166161,
-    0.166935,
-    0.167692,
-    0.168044,
-    0.168062,
-    0.168203,
-    0.168781,
-    0.169612,
-    0.170221,
-    0.170388,
-    0.170398,
-    0.170715,
-    0.171453,
-    0.172244,
-    0.17266,
-    0.1727,
-    0.172795,
-    0.173313,
-    0.174136,
-    0.174801,
-    0.175022,
-    0.175023,
-    0.175278,
-    0.175972,
-    0.176788,
-    0.177268,
-    0.177339,
-    0.177397,
-    0.17785,
-    0.178657,
-    0.179372,
-    0.179652,
-    0.179653,
-    0.179851,
-    0.180494,
-    0.181324,
-    0.181868,
-    0.181979,
-    0.182006,
-    0.182395,
-    0.183176,
-    0.183933,
-    0.184276,
-    0.184288,
-    0.184432,
-    0.185019,
-    0.185854,
-    0.186458,
-    0.186617,
-    0.186624,
-    0.186948,
-    0.187694,
-    0.188486,
-    0.188893,
-    0.188926,
-    0.189023,
-    0.189549,
-    0.190379,
-    0.19104,
-    0.191252,
-    0.191248,
-    0.19151,
-    0.192213,
-    0.19303,
-    0.193503,
-    0.193566,
-    0.193624,
-    0.194086,
-    0.1949,
-    0.195612,
-    0.195883,
-    0.195879,
-    0.196081,
-    0.196733,
-    0.197567,
-    0.198104,
-    0.198206,
-    0.198233,
-    0.198629,
-    0.199418,
-    0.200174,
-    0.200508,
-    0.200514,
-    0.200661,
-    0.201257,
-    0.202097,
-    0.202696,
-    0.202845,
-    0.20285,
-    0.203181,
-    0.203936,
-    0.204728,
-    0.205127,
-    0.205152,
-    0.205251,
-    0.205786,
-    0.206622,
-    0.207279,
-    0.207481,
-    0.207474,
-    0.207741,
-    0.208453,
-    0.209273,
-    0.209738,
-    0.209793,
-    0.20985,
-    0.210321,
-    0.211143,
-    0.211852,
-    0.212113,
-    0.212104,
-    0.21231,
-    0.212973,
-    0.21381,
-    0.21434,
-    0.214434,
-    0.214459,
-    0.214863,
-    0.21566,
-    0.216415,
-    0.21674,
-    0.216739,
-    0.21689,
-    0.217495,
-    0.21834,
-    0.218934,
-    0.219074,
-    0.219075,
-    0.219413,
-    0.220177,
-    0.22097,
-    0.22136,
-    0.221378,
-    0.221478,
-    0.222023,
-    0.222865,
-    0.223518,
-    0.223711,
-    0.223699,
-    0.223972,
-    0.224694,
-    0.225515,
-    0.225973,
-    0.226019,
-    0.226077,
-    0.226556,
-    0.227385,
-    0.228092,
-    0.228344,
-    0.228329,
-    0.22854,
-    0.229212,
-    0.230053,
-    0.230577,
-    0.230661,
-    0.230684,
-    0.231097,
-    0.231903,
-    0.232657,
-    0.232973,
-    0.232964,
-    0.233118,
-    0.233734,
-    0.234584,
-    0.235172,
-    0.235302,
-    0.2353,
-    0.235645,
-    0.236419,
-    0.237212,
-    0.237594,
-    0.237604,
-    0.237705,
-    0.238259,
-    0.239109,
-    0.239758,
-    0.23994,
-    0.239923,
-    0.240202,
-    0.240934,
-    0.241759,
-    0.242209,
-    0.242245,
-    0.242303,
-    0.242791,
-    0.243629,
-    0.244333,
-    0.244575,
-    0.244554,
-    0.244769,
-    0.245452,
-    0.246297,
-    0.246814,
-    0.246888,
-    0.246909,
-    0.24733,
-    0.248146,
-    0.248899,
-    0.249205,
-    0.249189,
-    0.249345,
-    0.249972,
-    0.250828,
-    0.251411,
-    0.25153,
-    0.251525,
-    0.251877,
-    0.25266,
-    0.253455,
-    0.253829,
-    0.253829,
-    0.253932,
-    0.254496,
-    0.255352,
-    0.255998,
-    0.25617,
-    0.256148,
-    0.256433,
-    0.257175,
-    0.258002,
-    0.258444,
-    0.258471,
-    0.258528,
-    0.259026,
-    0.259872,
-    0.260575,
-    0.260806,
-    0.260778,
-    0.260998,
-    0.261691,
-    0.262541,
-    0.263052,
-    0.263115,
-    0.263134,
-    0.263563,
-    0.264388,
-    0.265142,
-    0.265438,
-    0.265414,
-    0.265573,
-    0.26621,
-    0.267072,
-    0.26765,
-    0.267758,
-    0.267749,
-    0.268108,
-    0.268903,
-    0.269699,
-    0.270063,
-    0.270054,
-    0.270158,
-    0.270733,
-    0.271597,
-    0.272238,
-    0.272399,
-    0.272371,
-    0.272662,
-    0.273416,
-    0.274247,
-    0.27468,
-    0.274697,
-    0.274753,
-    0.275261,
-    0.276116,
-    0.276817,
-    0.277037,
-    0.277001,
-    0.277226,
-    0.277931,
-    0.278786,
-    0.27929,
-    0.279342,
-    0.279358,
-    0.279796,
-    0.280632,
-    0.281385,
-    0.28167,
-    0.281638,
-    0.2818,
-    0.282448,
-    0.283317,
-    0.283889,
-    0.283986,
-    0.283972,
-    0.28434,
-    0.285145,
-    0.285943,
-    0.286297,
-    0.286278,
-    0.286384,
-    0.286969,
-    0.287841,
-    0.288479,
-    0.288629,
-    0.288595,
-    0.288892,
-    0.289657,
-    0.290491,
-    0.290917,
-    0.290922,
-    0.290978,
-    0.291496,
-    0.29236,
-    0.293059,
-    0.293268,
-    0.293225,
-    0.293454,
-    0.29417,
-    0.295031,
-    0.295528,
-    0.295568,
-    0.295582,
-    0.296029,
-    0.296875,
-    0.297628,
-    0.297903,
-    0.297861,
-    0.298026,
-    0.298686,
-    0.299562,
-    0.300129,
-    0.300214,
-    0.300195,
-    0.300571,
-    0.301387,
-    0.302188,
-    0.302532,
-    0.302502,
-    0.302609,
-    0.303205,
-    0.304087,
-    0.304721,
-    0.304858,
-    0.304817,
-    0.305121,
-    0.305899,
-    0.306737,
-    0.307153,
-    0.307147,
-    0.307202,
-    0.30773,
-    0.308605,
-    0.309302,
-    0.309499,
-    0.309447,
-    0.309681,
-    0.31041,
-    0.311277,
-    0.311766,
-    0.311794,
-    0.311805,
-    0.312262,
-    0.313119,
-    0.313873,
-    0.314136,
-    0.314084,
-    0.314252,
-    0.314924,
-    0.315808,
-    0.316369,
-    0.316441,
-    0.316418,
-    0.316801,
-    0.31763,
-    0.318433,
-    0.318767,
-    0.318726,
-    0.318833,
-    0.319442,
-    0.320332,
-    0.320963,
-    0.321087,
-    0.32104,
-    0.32135,
-    0.32214,
-    0.322983,
-    0.32339,
-    0.323372,
-    0.323425,
-    0.323965,
-    0.32485,
-    0.325545,
-    0.32573,
-    0.32567,
-    0.325908,
-    0.32665,
-    0.327523,
-    0.328005,
-    0.32802,
-    0.328027,
-    0.328494,
-    0.329364,
-    0.330117,
-    0.330369,
-    0.330307,
-    0.330477,
-    0.331162,
-    0.332055,
-    0.33261,
-    0.332669,
-    0.332639,
-    0.333032,
-    0.333874,
-    0.334679,
-    0.335002,
-    0.334949,
-    0.335057,
-    0.335678,
-    0.336579,
-    0.337205,
-    0.337316,
-    0.337261,
-    0.337578,
-    0.338382,
-    0.339229,
-    0.339627,
-    0.339596,
-    0.339647,
-    0.340199,
-    0.341096,
-    0.34179,
-    0.341962,
-    0.341891,
-    0.342135,
-    0.342891,
-    0.34377,
-    0.344244,
-    0.344245,
-    0.344249,
-    0.344726,
-    0.345609,
-    0.346363,
-    0.346602,
-    0.346528,
-    0.346702,
-    0.347401,
-    0.348302,
-    0.348851,
-    0.348896,
-    0.34886,
-    0.349262,
-    0.350117,
-    0.350925,
-    0.351237,
-    0.351172,
-    0.35128,
-    0.351914,
-    0.352826,
-    0.353448,
-    0.353545,
-    0.353482,
-    0.353806,
-    0.354624,
-    0.355477,
-    0.355865,
-    0.35582,
-    0.355869,
-    0.356433,
-    0.357343,
-    0.358034,
-    0.358192,
-    0.358112,
-    0.358361,
-    0.359131,
-    0.360018,
-    0.360484,
-    0.360471,
-    0.36047,
-    0.360958,
-    0.361854,
-    0.362609,
-    0.362835,
-    0.36275,
-    0.362926,
-    0.363639,
-    0.36455,
-    0.365093,
-    0.365123,
-    0.365081,
-    0.365491,
-    0.366362,
-    0.367173,
-    0.367473,
-    0.367394,
-    0.367502,
-    0.368151,
-    0.369074,
-    0.369692,
-    0.369774,
-    0.369702,
-    0.370034,
-    0.370867,
-    0.371725,
-    0.372102,
-    0.372043,
-    0.37209,
-    0.372667,
-    0.37359,
-    0.37428,
-    0.374423,
-    0.374332,
-    0.374586,
-    0.375372,
-    0.376267,
-    0.376724,
-    0.376695,
-    0.37669,
-    0.37719,
-    0.3781,
-    0.378856,
-    0.379069,
-    0.37897,
-    0.379149,
-    0.379878,
-    0.380799,
-    0.381335,
-    0.381349,
-    0.3813,
-    0.38172,
-    0.382606,
-    0.383421,
-    0.383708,
-    0.383615,
-    0.383724,
-    0.384387,
-    0.385322,
-    0.385937,
-    0.386003,
-    0.385921,
-    0.38626,
-    0.38711,
-    0.387974,
-    0.388341,
-    0.388266,
-    0.38831,
-    0.388901,
-    0.389838,
-    0.390526,
-    0.390654,
-    0.390551,
-    0.39081,
-    0.391613,
-    0.392517,
-    0.392965,
-    0.392919,
-    0.392909,
-    0.393421,
-    0.394347,
-    0.395104,
-    0.395302,
-    0.39519,
-    0.395372,
-    0.396116,
-    0.397049,
-    0.397579,
-    0.397575,
-    0.397518,
-    0.397949,
-    0.398852,
-    0.39967,
-    0.399944,
-    0.399836,
-    0.399945,
-    0.400623,
-    0.401572,
-    0.402182,
-    0.402231,
-    0.402139,
-    0.402486,
-    0.403353,
-    0.404224,
-    0.404579,
-    0.404487,
-    0.40453,
-    0.405134,
-    0.406086,
-    0.406774,
-    0.406885,
-    0.406769,
-    0.407034,
-    0.407854,
-    0.408767,
-    0.409206,
-    0.409143,
-    0.409127,
-    0.409652,
-    0.410595,
-    0.411353,
-    0.411536,
-    0.411408,
-    0.411593,
-    0.412355,
-    0.4133,
-    0.413822,
-    0.413801,
-    0.413735,
-    0.414177,
-    0.415098,
-    0.415921,
-    0.416181,
-    0.416055,
-    0.416164,
-    0.416859,
-    0.417822,
-    0.418428,
-    0.418459,
-    0.418356,
-    0.418712,
-    0.419597,
-    0.420476,
-    0.420818,
-    0.420709,
-    0.420748,
-    0.421367,
-    0.422336,
-    0.423022,
-    0.423116,
-    0.422986,
-    0.423257,
-    0.424096,
-    0.425019,
-    0.425448,
-    0.425366,
-    0.425343,
-    0.425882,
-    0.426843,
-    0.427603,
-    0.427769,
-    0.427626,
-    0.427814,
-    0.428594,
-    0.429552,
-    0.430067,
-    0.430026,
-    0.429951,
-    0.430405,
-    0.431344,
-    0.432172,
-    0.432417,
-    0.432274,
-    0.432383,
-    0.433095,
-    0.434074,
-    0.434675,
-    0.434687,
-    0.434571,
-    0.434936,
-    0.435842,
-    0.436729,
-    0.437058,
-    0.436929,
-    0.436964,
-    0.437601,
-    0.438587,
-    0.439271,
-    0.439347,
-    0.439202,
-    0.439479,
-    0.440338,
-    0.441273,
-    0.44169,
-    0.441588,
-    0.441559,
-    0.442112,
-    0.443092,
-    0.443855,
-    0.444003,
-    0.443843,
-    0.444033,
-    0.444833,
-    0.445805,
-    0.446313,
-    0.446251,
-    0.446166,
-    0.446631,
-    0.447592,
-    0.448425,
-    0.448654,
-    0.448492,
-    0.4486,
-    0.449331,
-    0.450327,
-    0.450923,
-    0.450914,
-    0.450785,
-    0.45116,
-    0.452087,
-    0.452983,
-    0.453298,
-    0.453148,
-    0.45318,
-    0.453834,
-    0.454839,
-    0.455522,
-    0.455577,
-    0.455416,
-    0.4557,
-    0.45658,
-    0.457527,
-    0.457934,
-    0.45781,
-    0.457773,
-    0.458342,
-    0.459343,
-    0.460108,
-    0.460237,
-    0.460058,
-    0.460251,
-    0.461073,
-    0.46206,
-    0.462559,
-    0.462475,
-    0.462379,
-    0.462858,
-    0.46384,
-    0.46468,
-    0.464891,
-    0.464708,
-    0.464816,
-    0.465568,
-    0.466581,
-    0.467173,
-    0.467141,
-    0.466998,
-    0.467383,
-    0.468333,
-    0.469238,
-    0.469539,
-    0.469366,
-    0.469393,
-    0.470066,
-    0.471092,
-    0.471774,
-    0.471807,
-    0.471629,
-    0.471919,
-    0.472823,
-    0.473784,
-    0.474178,
-    0.47403,
-    0.473985,
-    0.474571,
-    0.475595,
-    0.476362,
-    0.476471,
-    0.476271,
-    0.476468,
-    0.477313,
-    0.478316,
-    0.478807,
-    0.478698,
-    0.47859,
-    0.479083,
-    0.48009,
-    0.480936,
-    0.481129,
-    0.480923,
-    0.48103,
-    0.481804,
-    0.482837,
-    0.483424,
-    0.483368,
-    0.483209,
-    0.483605,
-    0.48458,
-    0.485496,
-    0.485781,
-    0.485583,
-    0.485605,
-    0.486299,
-    0.487347,
-    0.488028,
-    0.488038,
-    0.48784,
-    0.488138,
-    0.489067,
-    0.490042,
-    0.490423,
-    0.49025,
-    0.490195,
-    0.490799,
-    0.491848,
-    0.492618,
-    0.492705,
-    0.492483,
-    0.492683,
-    0.493553,
-    0.494575,
-    0.495056,
-    0.494921,
-    0.494799,
-    0.495307,
-    0.496341,
-    0.497194,
-    0.497367,
-    0.497137,
-    0.497242,
-    0.49804,
-    0.499095,
-    0.499676,
-    0.499594,
-    0.499418,
-    0.499825,
-    0.500828,
-    0.501756,
-    0.502023,
-    0.501799,
-    0.501815,
-    0.502531,
-    0.503604,
-    0.504284,
-    0.504268,
-    0.504049,
-    0.504354,
-    0.505311,
-    0.506303,
-    0.50667,
-    0.506468,
-    0.506403,
-    0.507027,
-    0.508103,
-    0.508877,
-    0.508939,
-    0.508693,
-    0.508896,
-    0.509794,
-    0.510836,
-    0.511306,
-    0.511142,
-    0.511006,
-    0.511531,
-    0.512593,
-    0.513455,
-    0.513606,
-    0.513348,
-    0.513452,
-    0.514276,
-    0.515355,
-    0.515931,
-    0.51582,
-    0.515624,
-    0.516044,
-    0.517077,
-    0.518018,
-    0.518266,
-    0.518013,
-    0.518023,
-    0.518762,
-    0.519863,
-    0.520541,
-    0.520497,
-    0.520256,
-    0.520569,
-    0.521557,
-    0.522566,
-    0.522918,
-    0.522685,
-    0.522609,
-    0.523254,
-    0.524359,
-    0.525137,
-    0.525173,
-    0.524901,
-    0.525107,
-    0.526035,
-    0.527099,
-    0.527559,
-    0.527363,
-    0.527211,
-    0.527753,
-    0.528847,
-    0.529718,
-    0.529845,
-    0.529557,
-    0.52966,
-    0.530513,
-    0.531618,
-    0.532187,
-    0.532044,
-    0.531828,
-    0.532262,
-    0.533327,
-    0.534283,
-    0.53451,
-    0.534225,
-    0.534228,
-    0.534994,
-    0.536124,
-    0.536802,
-    0.536727,
-    0.53646,
-    0.536782,
-    0.537803,
-    0.538832,
-    0.539167,
-    0.5389,
-    0.538812,
-    0.53948,
-    0.540618,
-    0.541401,
-    0.541408,
-    0.541106,
-    0.541316,
-    0.542276,
-    0.543365,
-    0.543813,
-    0.543582,
-    0.543412,
-    0.543974,
-    0.545103,
-    0.545984,
-    0.546085,
-    0.545764,
-    0.545865,
-    0.546749,
-    0.547883,
-    0.548446,
-    0.548268,
-    0.548028,
-    0.548477,
-    0.54958,
-    0.550551,
-    0.550756,
-    0.550434,
-    0.55043,
-    0.551225,
-    0.552388,
-    0.553065,
-    0.552956,
-    0.55266,
-    0.552993,
-    0.554051,
-    0.555101,
-    0.555418,
-    0.555113,
-    0.555011,
-    0.555705,
-    0.55688,
-    0.557668,
-    0.557642,
-    0.557307,
-    0.557522,
-    0.558519,
-    0.559635,
-    0.560069,
-    0.5598,
-    0.559609,
-    0.560193,
-    0.561361,
-    0.562254,
-    0.562326,
-    0.561968,
-    0.562066,
-    0.562986,
-    0.564152,
-    0.564708,
-    0.564491,
-    0.564225,
-    0.564691,
-    0.565833,
-    0.566823,
-    0.567003,
-    0.566641,
-    0.566628,
-    0.567455,
-    0.568655,
-    0.569331,
-    0.569184,
-    0.568857,
-    0.569201,
-    0.570299,
-    0.571374,
-    0.571671,
-    0.571324,
-    0.571206,
-    0.571929,
-    0.573144,
-    0.573938,
-    0.573877,
-    0.573506,
-    0.573725,
-    0.574762,
-    0.575908,
-    0.576328,
-    0.576016,
-    0.575803,
-    0.57641,
-    0.577622,
-    0.578528,
-    0.578567,
-    0.578169,
-    0.578264,
-    0.579223,
-    0.580425,
-    0.580972,
-    0.580713,
-    0.580417,
-    0.580902,
-    0.58209,
-    0.5831,
-    0.583251,
-    0.582845,
-    0.582821,
-    0.583685,
-    0.584926,
-    0.585601,
-    0.585412,
-    0.58505,
-    0.585405,
-    0.58655,
-    0.587652,
-    0.587927,
-    0.587533,
-    0.587397,
-    0.588152,
-    0.589412,
-    0.590213,
-    0.590113,
-    0.5897,
-    0.589923,
-    0.591006,
-    0.592187,
-    0.592591,
-    0.592229,
-    0.591991,
-    0.592626,
-    0.593886,
-    0.594807,
-    0.59481,
-    0.594365,
-    0.594457,
-    0.595459,
-    0.596703,
-    0.597241,
-    0.596933,
-    0.596605,
-    0.597109,
-    0.598348,
-    0.599381,
-    0.599502,
-    0.599045,
-    0.59901,
-    0.599914,
-    0.601202,
-    0.601876,
-    0.60164,
-    0.601237,
-    0.601606,
-    0.602802,
-    0.603936,
-    0.604185,
-    0.603738,
-    0.603581,
-    0.604373,
-    0.605685,
-    0.606494,
-    0.606348,
-    0.605888,
-    0.606117,
-    0.607251,
-    0.608471,
-    0.608857,
-    0.608441,
-    0.608173,
-    0.608838,
-    0.610154,
-    0.611092,
-    0.611054,
-    0.610557,
-    0.610645,
-    0.611696,
-    0.612986,
-    0.613515,
-    0.613151,
-    0.612785,
-    0.613314,
-    0.61461,
-    0.61567,
-    0.615754,
-    0.615241,
-    0.615192,
-    0.616142,
-    0.617483,
-    0.618157,
-    0.617867,
-    0.617418,
-    0.617802,
-    0.619057,
-    0.620227,
-    0.620447,
-    0.619939,
-    0.61976,
-    0.620592,
-    0.621962,
-    0.62278,
-    0.622584,
-    0.622071,
-    0.622305,
-    0.623497,
-    0.624762,
-    0.625128,
-    0.624649,
-    0.624348,
-    0.625048,
-    0.626426,
-    0.627384,
-    0.627299,
-    0.626742,
-    0.626826,
-    0.627934,
-    0.629277,
-    0.629794,
-    0.629368,
-    0.628959,
-    0.629513,
-    0.630876,
-    0.631966,
-    0.63201,
-    0.631431,
-    0.631367,
-    0.63237,
-    0.633771,
-    0.634444,
-    0.634092,
-    0.633591,
-    0.633992,
-    0.635315,
-    0.636525,
-    0.636713,
-    0.636135,
-    0.635929,
-    0.636808,
-    0.638247,
-    0.639075,
-    0.63882,
-    0.638245,
-    0.638486,
-    0.639746,
-    0.641062,
-    0.641404,
-    0.640853,
-    0.640514,
-    0.641253,
-    0.642704,
-    0.643685,
-    0.643546,
-    0.64292,
-    0.642999,
-    0.644172,
-    0.645576,
-    0.646081,
-    0.645581,
-    0.645122,
-    0.645707,
-    0.647147,
-    0.648272,
-    0.648269,
-    0.647614,
-    0.647532,
-    0.648596,
-    0.650068,
-    0.650741,
-    0.650317,
-    0.649755,
-    0.650175,
-    0.651577,
-    0.652835,
-    0.652984,
-    0.652326,
-    0.652088,
-    0.653022,
-    0.654539,
-    0.65538,
-    0.655056,
-    0.65441,
-    0.654658,
-    0.655997,
-    0.657373,
-    0.657687,
-    0.657053,
-    0.656669,
-    0.657454,
-    0.65899,
-    0.659997,
-    0.659796,
-    0.659089,
-    0.659161,
-    0.66041,
-    0.661886,
-    0.662376,
-    0.661791,
-    0.661274,
-    0.661895,
-    0.663424,
-    0.66459,
-    0.664532,
-    0.663789,
-    0.663686,
-    0.66482,
-    0.666375,
-    0.667047,
-    0.666539,
-    0.665906,
-    0.666349,
-    0.667843,
-    0.669157,
-    0.669262,
-    0.668509,
-    0.668234,
-    0.669232,
-    0.670841,
-    0.671697,
-    0.671293,
-    0.670563,
-    0.67082,
-    0.67225,
-    0.673697,
-    0.67398,
-    0.673246,
-    0.672809,
-    0.673648,
-    0.675285,
-    0.676323,
-    0.676048,
-    0.675246,
-    0.67531,
-    0.676649,
-    0.67821,
-    0.678683,
-    0.677997,
-    0.677411,
-    0.678073,
-    0.679708,
-    0.680924,
-    0.680801,
-    0.679953,
-    0.679824,
-    0.681043,
-    0.682697,
-    0.683368,
-    0.68276,
-    0.682041,
-    0.682511,
-    0.684115,
-    0.685496,
-    0.685548,
-    0.684682,
-    0.684363,
-    0.685437,
-    0.687156,
-    0.688031,
-    0.687531,
-    0.6867,
-    0.686966,
-    0.688507,
-    0.690039,
-    0.690284,
-    0.689431,
-    0.68893,
-    0.689835,
-    0.691592,
-    0.692668,
-    0.692305,
-    0.691387,
-    0.691442,
-    0.692889,
-    0.694553,
-    0.695005,
-    0.694198,
-    0.693528,
-    0.69424,
-    0.696003,
-    0.697278,
-    0.697078,
-    0.696102,
-    0.695942,
-    0.697264,
-    0.699036,
-    0.699707,
-    0.698978,
-    0.698156,
-    0.698659,
-    0.700395,
-    0.701858,
-    0.701845,
-    0.700842,
-    0.700469,
-    0.701636,
-    0.703489,
-    0.704386,
-    0.703769,
-    0.702816,
-    0.703094,
-    0.704769,
-    0.706405,
-    0.706603,
-    0.705606,
-    0.705027,
-    0.706011,
-    0.707914,
-    0.709038,
-    0.708566,
-    0.707508,
-    0.707551,
-    0.70913,
-    0.710919,
-    0.711346,
-    0.71039,
-    0.709617,
-    0.710392,
-    0.712313,
-    0.71366,
-    0.713364,
-    0.712231,
-    0.712033,
-    0.713481,
-    0.7154,
-    0.71607,
-    0.715193,
-    0.714242,
-    0.714785,
-    0.716686,
-    0.71825,
-    0.718158,
-    0.716984,
-    0.716545,
-    0.717826,
-    0.719846,
-    0.72077,
-    0.720009,
-    0.718903,
-    0.719196,
-    0.721038,
-    0.722804,
-    0.722944,
-    0.721765,
-    0.721089,
-    0.722172,
-    0.72426,
-    0.725442,
-    0.724834,
-    0.723599,
-    0.723628,
-    0.725372,
-    0.72732,
-    0.727716,
-    0.726572,
-    0.72567,
-    0.726522,
-    0.728641,
-    0.730081,
-    0.729663,
-    0.728333,
-    0.728087,
-    0.729693,
-    0.731798,
-    0.732468,
-    0.731402,
-    0.730289,
-    0.730883,
-    0.732992,
-    0.734684,
-    0.734492,
-    0.733101,
-    0.732577,
-    0.734004,
-    0.736237,
-    0.737196,
-    0.73625,
-    0.734948,
-    0.73526,
-    0.737317,
-    0.739248,
-    0.739314,
-    0.737904,
-    0.737103,
-    0.738312,
-    0.740637,
-    0.741894,
-    0.741112,
-    0.73965,
-    0.739659,
-    0.741618,
-    0.74377,
-    0.744124,
-    0.742739,
-    0.741668,
-    0.742622,
-    0.744998,
-    0.746558,
-    0.745983,
-    0.744394,
-    0.744085,
-    0.745899,
-    0.748247,
-    0.748916,
-    0.747603,
-    0.746277,
-    0.746939,
-    0.749321,
-    0.751182,
-    0.750858,
-    0.749181,
-    0.748545,
-    0.750165,
-    0.752678,
-    0.753684,
-    0.752493,
-    0.750933,
-    0.75127,
-    0.75361,
-    0.755762,
-    0.75573,
-    0.754011,
-    0.753043,
-    0.754421,
-    0.757062,
-    0.758421,
-    0.757404,
-    0.755638,
-    0.755621,
-    0.757867,
-    0.760294,
-    0.760594,
-    0.758882,
-    0.757585,
-    0.758674,
-    0.761398,
-    0.763121,
-    0.762332,
-    0.760394,
-    0.76,
-    0.762095,
-    0.764773,
-    0.765442,
-    0.763792,
-    0.762176,
-    0.762928,
-    0.765686,
-    0.767778,
-    0.767272,
-    0.765203,
-    0.764412,
-    0.766298,
-    0.769198,
-    0.770268,
-    0.768739,
-    0.766821,
-    0.767192,
-    0.769927,
-    0.772386,
-    0.772217,
-    0.770067,
-    0.768865,
-    0.770481,
-    0.773564,
-    0.775065,
-    0.77372,
-    0.771524,
-    0.771471,
-    0.774123,
-    0.776938,
-    0.777161,
-    0.774986,
-    0.773366,
-    0.774649,
-    0.777869,
-    0.779824,
-    0.778731,
-    0.776291,
-    0.775774,
-    0.778274,
-    0.78143,
-    0.782098,
-    0.77996,
-    0.777922,
-    0.778808,
-    0.78211,
-    0.784539,
-    0.783769,
-    0.781126,
-    0.780108,
-    0.782384,
-    0.785854,
-    0.787019,
-    0.784991,
-    0.782541,
-    0.782963,
-    0.786285,
-    0.7892,
-    0.788828,
-    0.786034,
-    0.784482,
-    0.786453,
-    0.790203,
-    0.791918,
-    0.790077,
-    0.787231,
-    0.787122,
-    0.790391,
-    0.7938,
-    0.793904,
-    0.791019,
-    0.788904,
-    0.790485,
-    0.794471,
-    0.796786,
-    0.79522,
-    0.792,
-    0.791291,
-    0.794425,
-    0.798327,
-    0.798994,
-    0.796089,
-    0.793385,
-    0.79448,
-    0.798649,
-    0.801614,
-    0.800421,
-    0.79686,
-    0.795477,
-    0.798381,
-    0.802771,
-    0.804091,
-    0.80125,
-    0.797936,
-    0.798441,
-    0.802726,
-    0.806393,
-    0.805683,
-    0.801822,
-    0.799688,
-    0.802252,
-    0.807119,
-    0.809194,
-    0.806515,
-    0.802569,
-    0.802365,
-    0.806688,
-    0.811111,
-    0.811012,
-    0.806903,
-    0.80393,
-    0.806029,
-    0.811352,
-    0.814298,
-    0.811898,
-    0.8073,
-    0.806251,
-    0.810514,
-    0.815754,
-    0.816418,
-    0.812126,
-    0.808214,
-    0.809692,
-    0.815448,
-    0.819403,
-    0.817425,
-    0.812153,
-    0.81009,
-    0.814175,
-    0.820306,
-    0.821919,
-    0.817525,
-    0.812547,
-    0.813214,
-    0.819372,
-    0.82451,
-    0.823135,
-    0.817159,
-    0.813866,
-    0.817622,
-    0.824743,
-    0.827548,
-    0.823154,
-    0.816941,
-    0.816543,
-    0.823068,
-    0.829627,
-    0.829095,
-    0.822367,
-    0.817548,
-    0.820774,
-    0.829027,
-    0.833363,
-    0.829105,
-    0.82141,
-    0.819592,
-    0.826442,
-    0.834771,
-    0.835426,
-    0.827862,
-    0.821076,
-    0.823481,
-    0.833097,
-    0.839478,
-    0.835549,
-    0.825976,
-    0.822184,
-    0.829317,
-    0.839986,
-    0.842367,
-    0.83381,
-    0.824321,
-    0.82544,
-    0.836833,
-    0.846135,
-    0.842838,
-    0.830672,
-    0.823941,
-    0.831313,
-    0.845374,
-    0.850458,
-    0.840571,
-    0.82697,
-    0.825943,
-    0.839964,
-    0.853936,
-    0.851844,
-    0.835564,
-    0.823867,
-    0.831443,
-    0.85125,
-    0.861199,
-    0.849137,
-    0.82807,
-    0.822863,
-    0.841723,
-    0.864872,
-    0.865411,
-    0.840747,
-    0.81833,
-    0.82614,
-    0.859075,
-    0.880826,
-    0.86351,
-    0.822788,
-    0.805772,
-    0.838846,
-    0.891237,
-    0.900945,
-    0.844478,
-    0.776687,
-    0.786033,
-    0.89454,
-    0.999,
-    0.925965,
-    0.570219
-};
-
-//Top frequency: 44.1K * 0.00181406
-constexpr static std::array<float, 4096> wt_sawtooth_0x2 =
-{
-    0,
-    -0.300185,
-    -0.569469,
-    -0.782683,
-    -0.924846,
-    -0.993411,
-    -0.99784,
-    -0.95673,
-    -0.893236,
-    -0.829911,
-    -0.784172,
-    -0.765372,
-    -0.774017,
-    -0.803126,
-    -0.841195,
-    -0.875889,
-    -0.897472,
-    -0.901135,
-    -0.887736,
-    -0.862925,
-    -0.835037,
-    -0.812464,
-    -0.801251,
-    -0.803581,
-    -0.817488,
-    -0.837774,
-    -0.85778,
-    -0.871446,
-    -0.87503,
-    -0.868048,
-    -0.853177,
-    -0.835264,
-    -0.819744,
-    -0.811003,
-    -0.811134,
-    -0.819459,
-    -0.832888,
-    -0.846972,
-    -0.857308,
-    -0.86085,
-    -0.856747,
-    -0.84649,
-    -0.833348,
-    -0.821302,
-    -0.813818,
-    -0.812831,
-    -0.818227,
-    -0.827971,
-    -0.838803,
-    -0.847267,
-    -0.850767,
-    -0.848311,
-    -0.840749,
-    -0.830445,
-    -0.820505,
-    -0.813808,
-    -0.812147,
-    -0.815722,
-    -0.823137,
-    -0.831878,
-    -0.839116,
-    -0.842568,
-    -0.841182,
-    -0.835406,
-    -0.827013,
-    -0.818512,
-    -0.812372,
-    -0.810266,
-    -0.812591,
-    -0.81838,
-    -0.825642,
-    -0.831991,
-    -0.83539,
-    -0.834755,
-    -0.830262,
-    -0.82326,
-    -0.815826,
-    -0.810115,
-    -0.8077,
-    -0.809108,
-    -0.813685,
-    -0.819827,
-    -0.82549,
-    -0.828828,
-    -0.828747,
-    -0.825227,
-    -0.819297,
-    -0.812699,
-    -0.80734,
-    -0.804704,
-    -0.80541,
-    -0.809041,
-    -0.814293,
-    -0.819398,
-    -0.822666,
-    -0.82301,
-    -0.820256,
-    -0.815187,
-    -0.809273,
-    -0.804216,
-    -0.801421,
-    -0.801572,
-    -0.804437,
-    -0.808958,
-    -0.813588,
-    -0.816781,
-    -0.817455,
-    -0.815325,
-    -0.810968,
-    -0.805632,
-    -0.800846,
-    -0.797938,
-    -0.797639,
-    -0.799868,
-    -0.803768,
-    -0.807986,
-    -0.811095,
-    -0.812032,
-    -0.810418,
-    -0.806665,
-    -0.801832,
-    -0.797292,
-    -0.794306,
-    -0.793638,
-    -0.795328,
-    -0.798691,
-    -0.80254,
-    -0.805558,
-    -0.806704,
-    -0.805527,
-    -0.802296,
-    -0.797907,
-    -0.793598,
-    -0.790563,
-    -0.789588,
-    -0.790813,
-    -0.793703,
-    -0.797216,
-    -0.800138,
-    -0.80145,
-    -0.800645,
-    -0.797872,
-    -0.793883,
-    -0.789793,
-    -0.786732,
-    -0.7855,
-    -0.786321,
-    -0.788788,
-    -0.791992,
-    -0.79481,
-    -0.796253,
-    -0.795768,
-    -0.793402,
-    -0.789777,
-    -0.785898,
-    -0.782832,
-    -0.781383,
-    -0.781849,
-    -0.783934,
-    -0.786849,
-    -0.789558,
-    -0.791103,
-    -0.790895,
-    -0.788892,
-    -0.785603,
-    -0.781928,
-    -0.778874,
-    -0.777244,
-    -0.777396,
-    -0.779133,
-    -0.781774,
-    -0.784369,
-    -0.785991,
-    -0.786024,
-    -0.784348,
-    -0.781371,
-    -0.777895,
-    -0.774867,
-    -0.773086,
-    -0.772958,
-    -0.774376,
-    -0.776759,
-    -0.779234,
-    -0.780911,
-    -0.781153,
-    -0.779774,
-    -0.777088,
-    -0.773806,
-    -0.770818,
-    -0.768912,
-    -0.768535,
-    -0.76966,
-    -0.771796,
-    -0.774146,
-    -0.775858,
-    -0.776282,
-    -0.775173,
-    -0.772759,
-    -0.769669,
-    -0.766733,
-    -0.764725,
-    -0.764126,
-    -0.764979,
-    -0.766878,
-    -0.769101,
-    -0.770831,
-    -0.771412,
-    -0.770548,
-    -0.768391,
-    -0.765489,
-    -0.762615,
-    -0.760525,
-    -0.759728,
-    -0.76033,
-    -0.762002,
-    -0.764093,
-    -0.765826,
-    -0.766542,
-    -0.765901,
-    -0.763986,
-    -0.761269,
-    -0.758467,
-    -0.756314,
-    -0.755341,
-    -0.755709,
-    -0.757164,
-    -0.759119,
-    -0.760841,
-    -0.761672,
-    -0.761235,
-    -0.759548,
-    -0.757014,
-    -0.754291,
-    -0.752093,
-    -0.750964,
-    -0.751114,
-    -0.752359,
-    -0.754178,
-    -0.755875,
-    -0.756803,
-    -0.756551,
-    -0.75508,
-    -0.752725,
-    -0.75009,
-    -0.747861,
-    -0.746594,
-    -0.746544,
-    -0.747587,
-    -0.749265,
-    -0.750928,
-    -0.751935,
-    -0.751852,
-    -0.750585,
-    -0.748406,
-    -0.745865,
-    -0.74362,
-    -0.742232,
-    -0.741995,
-    -0.742844,
-    -0.744381,
-    -0.745999,
-    -0.747069,
-    -0.747138,
-    -0.746063,
-    -0.744057,
-    -0.741616,
-    -0.739368,
-    -0.737876,
-    -0.737466,
-    -0.738129,
-    -0.739523,
-    -0.741086,
-    -0.742205,
-    -0.742411,
-    -0.741518,
-    -0.739681,
-    -0.737345,
-    -0.735106,
-    -0.733524,
-    -0.732955,
-    -0.733439,
-    -0.734691,
-    -0.73619,
-    -0.737345,
-    -0.737673,
-    -0.736951,
-    -0.735279,
-    -0.733053,
-    -0.730833,
-    -0.729176,
-    -0.728461,
-    -0.728774,
-    -0.729882,
-    -0.731311,
-    -0.732489,
-    -0.732925,
-    -0.732363,
-    -0.730853,
-    -0.72874,
-    -0.72655,
-    -0.724831,
-    -0.723982,
-    -0.724131,
-    -0.725097,
-    -0.726448,
-    -0.727637,
-    -0.728169,
-    -0.727756,
-    -0.726404,
-    -0.724406,
-    -0.722255,
-    -0.720487,
-    -0.719517,
-    -0.71951,
-    -0.720334,
-    -0.721601,
-    -0.72279,
-    -0.723405,
-    -0.723132,
-    -0.721932,
-    -0.720053,
-    -0.717949,
-    -0.716144,
-    -0.715064,
-    -0.714909,
-    -0.715593,
-    -0.716771,
-    -0.717949,
-    -0.718635,
-    -0.718491,
-    -0.717439,
-    -0.71568,
-    -0.713632,
-    -0.711801,
-    -0.710622,
-    -0.710326,
-    -0.710872,
-    -0.711957,
-    -0.713115,
-    -0.71386,
-    -0.713836,
-    -0.712926,
-    -0.711288,
-    -0.709302,
-    -0.707456,
-    -0.70619,
-    -0.705762,
-    -0.706172,
-    -0.707159,
-    -0.708288,
-    -0.709081,
-    -0.709166,
-    -0.708393,
-    -0.706877,
-    -0.70496,
-    -0.703109,
-    -0.701766,
-    -0.701214,
-    -0.70149,
-    -0.702377,
-    -0.703469,
-    -0.704299,
-    -0.704485,
-    -0.703843,
-    -0.702448,
-    -0.700606,
-    -0.698759,
-    -0.69735,
-    -0.696681,
-    -0.696828,
-    -0.697612,
-    -0.698659,
-    -0.699516,
-    -0.699791,
-    -0.699275,
-    -0.698001,
-    -0.696238,
-    -0.694405,
-    -0.69294,
-    -0.692163,
-    -0.692184,
-    -0.692862,
-    -0.693858,
-    -0.694732,
-    -0.695088,
-    -0.69469,
-    -0.693536,
-    -0.691857,
-    -0.690046,
-    -0.688535,
-    -0.687659,
-    -0.687557,
-    -0.688129,
-    -0.689066,
-    -0.689949,
-    -0.690376,
-    -0.69009,
-    -0.689054,
-    -0.687463,
-    -0.685682,
-    -0.684133,
-    -0.683166,
-    -0.682947,
-    -0.683412,
-    -0.684285,
-    -0.685167,
-    -0.685656,
-    -0.685476,
-    -0.684555,
-    -0.683055,
-    -0.681311,
-    -0.679735,
-    -0.678685,
-    -0.678353,
-    -0.67871,
-    -0.679514,
-    -0.680387,
-    -0.680929,
-    -0.680847,
-    -0.68004,
-    -0.678632,
-    -0.676933,
-    -0.675339,
-    -0.674213,
-    -0.673774,
-    -0.674024,
-    -0.674755,
-    -0.67561,
-    -0.676197,
-    -0.676206,
-    -0.67551,
-    -0.674197,
-    -0.672547,
-    -0.670943,
-    -0.669751,
-    -0.669209,
-    -0.669353,
-    -0.670007,
-    -0.670838,
-    -0.67146,
-    -0.671554,
-    -0.670964,
-    -0.669747,
-    -0.668153,
-    -0.666547,
-    -0.665297,
-    -0.664658,
-    -0.664697,
-    -0.665271,
-    -0.66607,
-    -0.666719,
-    -0.66689,
-    -0.666403,
-    -0.665283,
-    -0.663749,
-    -0.66215,
-    -0.66085,
-    -0.66012,
-    -0.660057,
-    -0.660547,
-    -0.661308,
-    -0.661976,
-    -0.662216,
-    -0.661828,
-    -0.660805,
-    -0.659337,
-    -0.657751,
-    -0.656408,
-    -0.655595,
-    -0.65543,
-    -0.655835,
-    -0.656552,
-    -0.657231,
-    -0.657534,
-    -0.65724,
-    -0.656313,
-    -0.654914,
-    -0.653349,
-    -0.651972,
-    -0.65108,
-    -0.650818,
-    -0.651135,
-    -0.651804,
-    -0.652486,
-    -0.652844,
-    -0.652638,
-    -0.651807,
-    -0.650481,
-    -0.648943,
-    -0.64754,
-    -0.646576,
-    -0.646219,
-    -0.646449,
-    -0.647062,
-    -0.647741,
-    -0.648146,
-    -0.648025,
-    -0.647288,
-    -0.646038,
-    -0.644533,
-    -0.643111,
-    -0.642082,
-    -0.641634,
-    -0.641775,
-    -0.64233,
-    -0.642997,
-    -0.643442,
-    -0.6434,
-    -0.642756,
-    -0.641583,
-    -0.640117,
-    -0.638683,
-    -0.637596,
-    -0.637061,
-    -0.637113,
-    -0.637605,
-    -0.638256,
-    -0.638734,
-    -0.638764,
-    -0.63821,
-    -0.637117,
-    -0.635696,
-    -0.634257,
-    -0.633118,
-    -0.6325,
-    -0.632464,
-    -0.63289,
-    -0.633517,
-    -0.634021,
-    -0.634118,
-    -0.633652,
-    -0.63264,
-    -0.631268,
-    -0.629832,
-    -0.628647,
-    -0.627951,
-    -0.627828,
-    -0.628185,
-    -0.628782,
-    -0.629304,
-    -0.629463,
-    -0.629082,
-    -0.628151,
-    -0.626832,
-    -0.625405,
-    -0.624183,
-    -0.623413,
-    -0.623204,
-    -0.623489,
-    -0.624051,
-    -0.624585,
-    -0.624799,
-    -0.624499,
-    -0.623651,
-    -0.622389,
-    -0.620978,
-    -0.619723,
-    -0.618885,
-    -0.618592,
-    -0.618804,
-    -0.619325,
-    -0.619865,
-    -0.620128,
-    -0.619905,
-    -0.619139,
-    -0.617938,
-    -0.616547,
-    -0.615268,
-    -0.614367,
-    -0.613992,
-    -0.614129,
-    -0.614605,
-    -0.615144,
-    -0.61545,
-    -0.615301,
-    -0.614615,
-    -0.613478,
-    -0.612114,
-    -0.610817,
-    -0.609858,
-    -0.609404,
-    -0.609465,
-    -0.609892,
-    -0.610423,
-    -0.610766,
-    -0.610685,
-    -0.61008,
-    -0.60901,
-    -0.607678,
-    -0.606368,
-    -0.605357,
-    -0.604826,
-    -0.604811,
-    -0.605185,
-    -0.605703,
-    -0.606076,
-    -0.60606,
-    -0.605534,
-    -0.604531,
-    -0.603236,
-    -0.601921,
-    -0.600863,
-    -0.60026,
-    -0.600168,
-    -0.600486,
-    -0.600985,
-    -0.601382,
-    -0.601426,
-    -0.600976,
-    -0.600044,
-    -0.59879,
-    -0.597475,
-    -0.596376,
-    -0.595704,
-    -0.595536,
-    -0.595795,
-    -0.59627,
-    -0.596685,
-    -0.596783,
-    -0.596407,
-    -0.595546,
-    -0.594338,
-    -0.593029,
-    -0.591895,
-    -0.591158,
-    -0.590915,
-    -0.591112,
-    -0.591557,
-    -0.591984,
-    -0.592132,
-    -0.591828,
-    -0.591038,
-    -0.58988,
-    -0.588582,
-    -0.58742,
-    -0.586621,
-    -0.586305,
-    -0.586437,
-    -0.586849,
-    -0.587282,
-    -0.587474,
-    -0.587239,
-    -0.586521,
-    -0.585414,
-    -0.584135,
-    -0.582948,
-    -0.582094,
-    -0.581705,
-    -0.581772,
-    -0.582145,
-    -0.582578,
-    -0.58281,
-    -0.58264,
-    -0.581993,
-    -0.580942,
-    -0.579684,
-    -0.578481,
-    -0.577574,
-    -0.577115,
-    -0.577116,
-    -0.577446,
-    -0.577874,
-    -0.578139,
-    -0.578031,
-    -0.577455,
-    -0.576462,
-    -0.575232,
-    -0.574016,
-    -0.573062,
-    -0.572535,
-    -0.572469,
-    -0.572753,
-    -0.573171,
-    -0.573464,
-    -0.573413,
-    -0.572907,
-    -0.571974,
-    -0.570775,
-    -0.569554,
-    -0.568557,
-    -0.567966,
-    -0.567831,
-    -0.568066,
-    -0.568468,
-    -0.568783,
-    -0.568787,
-    -0.568349,
-    -0.567478,
-    -0.566315,
-    -0.565092,
-    -0.564059,
-    -0.563405,
-    -0.563203,
-    -0.563386,
-    -0.563767,
-    -0.5641,
-    -0.564152,
-    -0.563781,
-    -0.562973,
-    -0.56185,
-    -0.560632,
-    -0.559566,
-    -0.558854,
-    -0.558585,
-    -0.558713,
-    -0.559069,
-    -0.559413,
-    -0.559511,
-    -0.559204,
-    -0.558459,
-    -0.55738,
-    -0.556171,
-    -0.555079,
-    -0.554311,
-    -0.553976,
-    -0.554047,
-    -0.554374,
-    -0.554724,
-    -0.554862,
-    -0.554617,
-    -0.553937,
-    -0.552904,
-    -0.55171,
-    -0.550595,
-    -0.549776,
-    -0.549377,
-    -0.54939,
-    -0.549682,
-    -0.550034,
-    -0.550207,
-    -0.550021,
-    -0.549405,
-    -0.548421,
-    -0.547247,
-    -0.546116,
-    -0.54525,
-    -0.544787,
-    -0.54474,
-    -0.544995,
-    -0.545343,
-    -0.545547,
-    -0.545417,
-    -0.544864,
-    -0.543932,
-    -0.542781,
-    -0.541639,
-    -0.54073,
-    -0.540206,
-    -0.540099,
-    -0.540312,
-    -0.540651,
-    -0.540882,
-    -0.540804,
-    -0.540315,
-    -0.539436,
-    -0.538314,
-    -0.537165,
-    -0.536217,
-    -0.535634,
-    -0.535466,
-    -0.535635,
-    -0.535961,
-    -0.536212,
-    -0.536184,
-    -0.535756,
-    -0.534933,
-    -0.533842,
-    -0.532692,
-    -0.53171,
-    -0.53107,
-    -0.530841,
-    -0.530964,
-    -0.531271,
-    -0.531539,
-    -0.531556,
-    -0.531188,
-    -0.530422,
-    -0.529367,
-    -0.52822,
-    -0.527208,
-    -0.526515,
-    -0.526225,
-    -0.526299,
-    -0.526584,
-    -0.526863,
-    -0.526921,
-    -0.526612,
-    -0.525903,
-    -0.524887,
-    -0.523749,
-    -0.522712,
-    -0.521968,
-    -0.521618,
-    -0.521641,
-    -0.521899,
-    -0.522184,
-    -0.52228,
-    -0.522027,
-    -0.521377,
-    -0.520402,
-    -0.519276,
-    -0.518219,
-    -0.517429,
-    -0.51702,
-    -0.516989,
-    -0.517217,
-    -0.517504,
-    -0.517632,
-    -0.517434,
-    -0.516842,
-    -0.515912,
-    -0.514803,
-    -0.51373,
-    -0.512896,
-    -0.51243,
-    -0.512345,
-    -0.512539,
-    -0.512823,
-    -0.51298,
-    -0.512832,
-    -0.512299,
-    -0.511415,
-    -0.510328,
-    -0.509244,
-    -0.508371,
-    -0.507848,
-    -0.507708,
-    -0.507866,
-    -0.508142,
-    -0.508323,
-    -0.508223,
-    -0.507747,
-    -0.506913,
-    -0.505851,
-    -0.504761,
-    -0.503851,
-    -0.503275,
-    -0.503079,
-    -0.503197,
-    -0.503461,
-    -0.503661,
-    -0.503607,
-    -0.503188,
-    -0.502404,
-    -0.501371,
-    -0.500279,
-    -0.499338,
-    -0.498709,
-    -0.498458,
-    -0.498533,
-    -0.498781,
-    -0.498996,
-    -0.498984,
-    -0.49862,
-    -0.497888,
-    -0.496887,
-    -0.495798,
-    -0.494829,
-    -0.494151,
-    -0.493845,
-    -0.493874,
-    -0.494102,
-    -0.494328,
-    -0.494354,
-    -0.494044,
-    -0.493365,
-    -0.492399,
-    -0.491318,
-    -0.490326,
-    -0.489601,
-    -0.489239,
-    -0.489222,
-    -0.489425,
-    -0.489658,
-    -0.489718,
-    -0.48946,
-    -0.488835,
-    -0.487907,
-    -0.486837,
-    -0.485826,
-    -0.485058,
-    -0.484641,
-    -0.484576,
-    -0.484752,
-    -0.484986,
-    -0.485077,
-    -0.484869,
-    -0.484297,
-    -0.48341,
-    -0.482355,
-    -0.48133,
-    -0.480522,
-    -0.480052,
-    -0.479936,
-    -0.480081,
-    -0.480313,
-    -0.480431,
-    -0.48027,
-    -0.479751,
-    -0.478908,
-    -0.477873,
-    -0.476836,
-    -0.475991,
-    -0.47547,
-    -0.475303,
-    -0.475414,
-    -0.475639,
-    -0.47578,
-    -0.475663,
-    -0.475198,
-    -0.4744,
-    -0.473388,
-    -0.472345,
-    -0.471467,
-    -0.470895,
-    -0.470678,
-    -0.470752,
-    -0.470966,
-    -0.471125,
-    -0.47105,
-    -0.470638,
-    -0.469886,
-    -0.4689,
-    -0.467856,
-    -0.466948,
-    -0.466328,
-    -0.466059,
-    -0.466094,
-    -0.466293,
-    -0.466466,
-    -0.466431,
-    -0.46607,
-    -0.465366,
-    -0.46441,
-    -0.463368,
-    -0.462434,
-    -0.461769,
-    -0.461448,
-    -0.461441,
-    -0.461622,
-    -0.461805,
-    -0.461805,
-    -0.461494,
-    -0.460839,
-    -0.459916,
-    -0.458881,
-    -0.457925,
-    -0.457216,
-    -0.456844,
-    -0.456794,
-    -0.456952,
-    -0.457141,
-    -0.457174,
-    -0.456911,
-    -0.456306,
-    -0.455418,
-    -0.454393,
-    -0.45342,
-    -0.45267,
-    -0.452247,
-    -0.452152,
-    -0.452285,
-    -0.452476,
-    -0.452537,
-    -0.452321,
-    -0.451766,
-    -0.450915,
-    -0.449905,
-    -0.448918,
-    -0.44813,
-    -0.447658,
-    -0.447516,
-    -0.447621,
-    -0.447809,
-    -0.447895,
-    -0.447723,
-    -0.447218,
-    -0.446408,
-    -0.445415,
-    -0.444418,
-    -0.443597,
-    -0.443076,
-    -0.442887,
-    -0.44296,
-    -0.443142,
-    -0.443249,
-    -0.443119,
-    -0.442664,
-    -0.441896,
-    -0.440924,
-    -0.439921,
-    -0.439069,
-    -0.438501,
-    -0.438264,
-    -0.438302,
-    -0.438475,
-    -0.4386,
-    -0.438509,
-    -0.438102,
-    -0.437378,
-    -0.436431,
-    -0.435426,
-    -0.434546,
-    -0.433933,
-    -0.433648,
-    -0.43365,
-    -0.433809,
-    -0.433947,
-    -0.433892,
-    -0.433534,
-    -0.432854,
-    -0.431935,
-    -0.430932,
-    -0.430027,
-    -0.429372,
-    -0.429038,
-    -0.429001,
-    -0.429143,
-    -0.429291,
-    -0.42927,
-    -0.428958,
-    -0.428324,
-    -0.427435,
-    -0.426439,
-    -0.425513,
-    -0.424817,
-    -0.424436,
-    -0.424358,
-    -0.424479,
-    -0.424632,
-    -0.424642,
-    -0.424375,
-    -0.423788,
-    -0.422933,
-    -0.421945,
-    -0.421003,
-    -0.420269,
-    -0.41984,
-    -0.41972,
-    -0.419817,
-    -0.419972,
-    -0.420009,
-    -0.419786,
-    -0.419245,
-    -0.418426,
-    -0.417452,
-    -0.416496,
-    -0.415726,
-    -0.415251,
-    -0.415088,
-    -0.415158,
-    -0.415311,
-    -0.415371,
-    -0.41519,
-    -0.414696,
-    -0.413914,
-    -0.412957,
-    -0.411992,
-    -0.41119,
-    -0.410669,
-    -0.410461,
-    -0.410502,
-    -0.410649,
-    -0.410729,
-    -0.410588,
-    -0.410141,
-    -0.409398,
-    -0.40846,
-    -0.40749,
-    -0.406659,
-    -0.406094,
-    -0.405841,
-    -0.405849,
-    -0.405988,
-    -0.406084,
-    -0.405979,
-    -0.405578,
-    -0.404876,
-    -0.403962,
-    -0.40299,
-    -0.402132,
-    -0.401525,
-    -0.401227,
-    -0.401201,
-    -0.401326,
-    -0.401435,
-    -0.401365,
-    -0.401009,
-    -0.400349,
-    -0.399461,
-    -0.398491,
-    -0.397611,
-    -0.396963,
-    -0.396619,
-    -0.396556,
-    -0.396665,
-    -0.396783,
-    -0.396745,
-    -0.396433,
-    -0.395817,
-    -0.394958,
-    -0.393993,
-    -0.393093,
-    -0.392407,
-    -0.392018,
-    -0.391917,
-    -0.392006,
-    -0.39213,
-    -0.39212,
-    -0.391851,
-    -0.391278,
-    -0.39045,
-    -0.389495,
-    -0.388579,
-    -0.387857,
-    -0.387423,
-    -0.387282,
-    -0.387349,
-    -0.387474,
-    -0.38749,
-    -0.387262,
-    -0.386734,
-    -0.38594,
-    -0.384997,
-    -0.384068,
-    -0.383312,
-    -0.382834,
-    -0.382652,
-    -0.382694,
-    -0.382817,
-    -0.382855,
-    -0.382667,
-    -0.382183,
-    -0.381424,
-    -0.380497,
-    -0.37956,
-    -0.378774,
-    -0.378252,
-    -0.378029,
-    -0.378042,
-    -0.37816,
-    -0.378217,
-    -0.378066,
-    -0.377626,
-    -0.376905,
-    -0.375997,
-    -0.375054,
-    -0.37424,
-    -0.373677,
-    -0.37341,
-    -0.373393,
-    -0.373502,
-    -0.373575,
-    -0.373459,
-    -0.373063,
-    -0.37238,
-    -0.371494,
-    -0.37055,
-    -0.369711,
-    -0.369108,
-    -0.368798,
-    -0.368748,
-    -0.368845,
-    -0.368929,
-    -0.368846,
-    -0.368493,
-    -0.367851,
-    -0.366989,
-    -0.366047,
-    -0.365186,
-    -0.364545,
-    -0.364192,
-    -0.364107,
-    -0.364189,
-    -0.364282,
-    -0.364229,
-    -0.363917,
-    -0.363316,
-    -0.362482,
-    -0.361545,
-    -0.360665,
-    -0.359987,
-    -0.359591,
-    -0.359471,
-    -0.359533,
-    -0.359632,
-    -0.359606,
-    -0.359335,
-    -0.358776,
-    -0.357971,
-    -0.357043,
-    -0.356148,
-    -0.355436,
-    -0.354997,
-    -0.354839,
-    -0.35488,
-    -0.35498,
-    -0.354978,
-    -0.354747,
-    -0.354229,
-    -0.353457,
-    -0.35254,
-    -0.351634,
-    -0.35089,
-    -0.350409,
-    -0.350212,
-    -0.350229,
-    -0.350327,
-    -0.350346,
-    -0.350153,
-    -0.349677,
-    -0.348939,
-    -0.348037,
-    -0.347123,
-    -0.346349,
-    -0.345828,
-    -0.34559,
-    -0.34558,
-    -0.345673,
-    -0.345711,
-    -0.345553,
-    -0.345119,
-    -0.344416,
-    -0.343533,
-    -0.342613,
-    -0.341814,
-    -0.341252,
-    -0.340973,
-    -0.340935,
-    -0.341019,
-    -0.341071,
-    -0.340947,
-    -0.340555,
-    -0.339889,
-    -0.339027,
-    -0.338106,
-    -0.337282,
-    -0.336682,
-    -0.336363,
-    -0.336293,
-    -0.336365,
-    -0.336429,
-    -0.336336,
-    -0.335985,
-    -0.335358,
-    -0.334519,
-    -0.333599,
-    -0.332755,
-    -0.332119,
-    -0.331758,
-    -0.331655,
-    -0.331712,
-    -0.331784,
-    -0.331719,
-    -0.331409,
-    -0.330821,
-    -0.330008,
-    -0.329094,
-    -0.328232,
-    -0.327561,
-    -0.327158,
-    -0.327021,
-    -0.327061,
-    -0.327137,
-    -0.327098,
-    -0.326827,
-    -0.326278,
-    -0.325494,
-    -0.324588,
-    -0.323712,
-    -0.323008,
-    -0.322565,
-    -0.322391,
-    -0.322411,
-    -0.322489,
-    -0.322473,
-    -0.322239,
-    -0.321731,
-    -0.320977,
-    -0.320083,
-    -0.319195,
-    -0.318461,
-    -0.317978,
-    -0.317766,
-    -0.317762,
-    -0.317839,
-    -0.317843,
-    -0.317645,
-    -0.317178,
-    -0.316456,
-    -0.315576,
-    -0.314681,
-    -0.313919,
-    -0.313396,
-    -0.313146,
-    -0.313117,
-    -0.313188,
-    -0.31321,
-    -0.313046,
-    -0.312618,
-    -0.311932,
-    -0.311069,
-    -0.310169,
-    -0.309381,
-    -0.308821,
-    -0.308531,
-    -0.308474,
-    -0.308538,
-    -0.308573,
-    -0.308441,
-    -0.308054,
-    -0.307402,
-    -0.30656,
-    -0.305659,
-    -0.304848,
-    -0.304251,
-    -0.303922,
-    -0.303835,
-    -0.303887,
-    -0.303933,
-    -0.303831,
-    -0.303483,
-    -0.302869,
-    -0.302049,
-    -0.301149,
-    -0.300319,
-    -0.299687,
-    -0.299318,
-    -0.299199,
-    -0.299237,
-    -0.299291,
-    -0.299216,
-    -0.298907,
-    -0.29833,
-    -0.297536,
-    -0.296641,
-    -0.295794,
-    -0.295128,
-    -0.29472,
-    -0.294567,
-    -0.294588,
-    -0.294647,
-    -0.294597,
-    -0.294325,
-    -0.293786,
-    -0.293019,
-    -0.292133,
-    -0.291272,
-    -0.290574,
-    -0.290127,
-    -0.28994,
-    -0.28994,
-    -0.290001,
-    -0.289973,
-    -0.289737,
-    -0.289237,
-    -0.2885,
-    -0.287624,
-    -0.286753,
-    -0.286026,
-    -0.28554,
-    -0.285316,
-    -0.285295,
-    -0.285353,
-    -0.285345,
-    -0.285144,
-    -0.284683,
-    -0.283977,
-    -0.283115,
-    -0.282236,
-    -0.281483,
-    -0.280959,
-    -0.280698,
-    -0.280652,
-    -0.280705,
-    -0.280713,
-    -0.280545,
-    -0.280123,
-    -0.27945,
-    -0.278605,
-    -0.277722,
-    -0.276944,
-    -0.276383,
-    -0.276085,
-    -0.276012,
-    -0.276057,
-    -0.276079,
-    -0.275941,
-    -0.275558,
-    -0.274919,
-    -0.274094,
-    -0.273209,
-    -0.272409,
-    -0.271813,
-    -0.271477,
-    -0.271374,
-    -0.271409,
-    -0.271441,
-    -0.271332,
-    -0.270986,
-    -0.270383,
-    -0.26958,
-    -0.268697,
-    -0.267879,
-    -0.267249,
-    -0.266874,
-    -0.266741,
-    -0.266761,
-    -0.266801,
-    -0.266718,
-    -0.26641,
-    -0.265843,
-    -0.265065,
-    -0.264186,
-    -0.263352,
-    -0.26269,
-    -0.262276,
-    -0.262111,
-    -0.262115,
-    -0.262159,
-    -0.2621,
-    -0.261828,
-    -0.261298,
-    -0.260546,
-    -0.259676,
-    -0.258828,
-    -0.258136,
-    -0.257684,
-    -0.257485,
-    -0.25747,
-    -0.257515,
-    -0.257477,
-    -0.25724,
-    -0.256748,
-    -0.256025,
-    -0.255165,
-    -0.254307,
-    -0.253586,
-    -0.253098,
-    -0.252863,
-    -0.252827,
-    -0.25287,
-    -0.252851,
-    -0.252647,
-    -0.252193,
-    -0.2515,
-    -0.250654,
-    -0.249788,
-    -0.249042,
-    -0.248517,
-    -0.248247,
-    -0.248186,
-    -0.248224,
-    -0.248221,
-    -0.248049,
-    -0.247632,
-    -0.246971,
-    -0.246142,
-    -0.245272,
-    -0.244502,
-    -0.243941,
-    -0.243635,
-    -0.243547,
-    -0.243578,
-    -0.243588,
-    -0.243445,
-    -0.243066,
-    -0.242438,
-    -0.241628,
-    -0.240757,
-    -0.239966,
-    -0.239371,
-    -0.239027,
-    -0.238912,
-    -0.238932,
-    -0.238952,
-    -0.238837,
-    -0.238494,
-    -0.237901,
-    -0.237112,
-    -0.236243,
-    -0.235434,
-    -0.234807,
-    -0.234426,
-    -0.23428,
-    -0.234286,
-    -0.234313,
-    -0.234224,
-    -0.233918,
-    -0.23336,
-    -0.232595,
-    -0.231731,
-    -0.230906,
-    -0.230247,
-    -0.229829,
-    -0.229652,
-    -0.229642,
-    -0.229673,
-    -0.229607,
-    -0.229335,
-    -0.228814,
-    -0.228074,
-    -0.227218,
-    -0.226381,
-    -0.225692,
-    -0.225237,
-    -0.225027,
-    -0.224999,
-    -0.225031,
-    -0.224985,
-    -0.224748,
-    -0.224262,
-    -0.223551,
-    -0.222705,
-    -0.221858,
-    -0.221143,
-    -0.220651,
-    -0.220407,
-    -0.220357,
-    -0.220388,
-    -0.22036,
-    -0.220155,
-    -0.219706,
-    -0.219025,
-    -0.218192,
-    -0.217338,
-    -0.216597,
-    -0.216071,
-    -0.215792,
-    -0.215718,
-    -0.215744,
-    -0.215732,
-    -0.215557,
-    -0.215145,
-    -0.214494,
-    -0.213678,
-    -0.21282,
-    -0.212057,
-    -0.211495,
-    -0.211181,
-    -0.211082,
-    -0.211099,
-    -0.2111,
-    -0.210954,
-    -0.210578,
-    -0.20996,
-    -0.209163,
-    -0.208303,
-    -0.20752,
-    -0.206925,
-    -0.206575,
-    -0.206448,
-    -0.206455,
-    -0.206465,
-    -0.206346,
-    -0.206006,
-    -0.205422,
-    -0.204646,
-    -0.203788,
-    -0.202987,
-    -0.20236,
-    -0.201973,
-    -0.201817,
-    -0.201811,
-    -0.201828,
-    -0.201734,
-    -0.201429,
-    -0.200879,
-    -0.200126,
-    -0.199274,
-    -0.198457,
-    -0.1978,
-    -0.197377,
-    -0.197191,
-    -0.197168,
-    -0.197189,
-    -0.197117,
-    -0.196847,
-    -0.196332,
-    -0.195604,
-    -0.19476,
-    -0.193931,
-    -0.193245,
-    -0.192787,
-    -0.192567,
-    -0.192527,
-    -0.192549,
-    -0.192497,
-    -0.192259,
-    -0.19178,
-    -0.19108,
-    -0.190245,
-    -0.189407,
-    -0.188695,
-    -0.188201,
-    -0.187949,
-    -0.187887,
-    -0.187907,
-    -0.187873,
-    -0.187666,
-    -0.187223,
-    -0.186552,
-    -0.185731,
-    -0.184886,
-    -0.184149,
-    -0.18362,
-    -0.183334,
-    -0.18325,
-    -0.183264,
-    -0.183245,
-    -0.183069,
-    -0.182661,
-    -0.18202,
-    -0.181215,
-    -0.180366,
-    -0.179608,
-    -0.179045,
-    -0.178724,
-    -0.178614,
-    -0.178621,
-    -0.178614,
-    -0.178466,
-    -0.178094,
-    -0.177485,
-    -0.176698,
-    -0.175848,
-    -0.17507,
-    -0.174475,
-    -0.174119,
-    -0.173982,
-    -0.173979,
-    -0.173981,
-    -0.173859,
-    -0.173522,
-    -0.172946,
-    -0.172179,
-    -0.171332,
-    -0.170536,
-    -0.16991,
-    -0.169518,
-    -0.169353,
-    -0.169336,
-    -0.169345,
-    -0.169247,
-    -0.168944,
-    -0.168402,
-    -0.167659,
-    -0.166816,
-    -0.166006,
-    -0.16535,
-    -0.164923,
-    -0.164727,
-    -0.164695,
-    -0.164707,
-    -0.164631,
-    -0.164362,
-    -0.163854,
-    -0.163135,
-    -0.1623,
-    -0.161478,
-    -0.160795,
-    -0.160332,
-    -0.160105,
-    -0.160055,
-    -0.160068,
-    -0.160011,
-    -0.159774,
-    -0.159301,
-    -0.15861,
-    -0.157785,
-    -0.156954,
-    -0.156244,
-    -0.155747,
-    -0.155487,
-    -0.155416,
-    -0.155427,
-    -0.155388,
-    -0.155182,
-    -0.154743,
-    -0.15408,
-    -0.153269,
-    -0.152431,
-    -0.151698,
-    -0.151167,
-    -0.150874,
-    -0.15078,
-    -0.150786,
-    -0.150761,
-    -0.150584,
-    -0.150181,
-    -0.149548,
-    -0.148752,
-    -0.147911,
-    -0.147156,
-    -0.146592,
-    -0.146264,
-    -0.146146,
-    -0.146144,
-    -0.146131,
-    -0.145982,
-    -0.145613,
-    -0.145012,
-    -0.144234,
-    -0.143392,
-    -0.142618,
-    -0.142022,
-    -0.14166,
-    -0.141515,
-    -0.141503,
-    -0.141498,
-    -0.141375,
-    -0.141041,
-    -0.140471,
-    -0.139714,
-    -0.138874,
-    -0.138083,
-    -0.137457,
-    -0.13706,
-    -0.136886,
-    -0.136861,
-    -0.136863,
-    -0.136763,
-    -0.136463,
-    -0.135927,
-    -0.135192,
-    -0.134357,
-    -0.133552,
-    -0.132897,
-    -0.132465,
-    -0.132262,
-    -0.132221,
-    -0.132227,
-    -0.132148,
-    -0.13188,
-    -0.131378,
-    -0.130668,
-    -0.129841,
-    -0.129024,
-    -0.128341,
-    -0.127875,
-    -0.127641,
-    -0.127582,
-    -0.127588,
-    -0.127528,
-    -0.127292,
-    -0.126825,
-    -0.126141,
-    -0.125324,
-    -0.124499,
-    -0.12379,
-    -0.12329,
-    -0.123024,
-    -0.122944,
-    -0.122948,
-    -0.122905,
-    -0.1227,
-    -0.122267,
-    -0.121611,
-    -0.120807,
-    -0.119975,
-    -0.119244,
-    -0.11871,
-    -0.118411,
-    -0.118309,
-    -0.118308,
-    -0.118279,
-    -0.118102,
-    -0.117703,
-    -0.117078,
-    -0.116289,
-    -0.115454,
-    -0.114701,
-    -0.114135,
-    -0.113802,
-    -0.113676,
-    -0.113667,
-    -0.11365,
-    -0.1135,
-    -0.113135,
-    -0.112541,
-    -0.11177,
-    -0.110935,
-    -0.110163,
-    -0.109565,
-    -0.109198,
-    -0.109046,
-    -0.109027,
-    -0.109018,
-    -0.108893,
-    -0.108563,
-    -0.108,
-    -0.10725,
-    -0.106416,
-    -0.105628,
-    -0.105,
-    -0.104599,
-    -0.104418,
-    -0.104386,
-    -0.104383,
-    -0.104282,
-    -0.103985,
-    -0.103454,
-    -0.102727,
-    -0.101898,
-    -0.101096,
-    -0.10044,
-    -0.100004,
-    -0.0997945,
-    -0.0997468,
-    -0.0997472,
-    -0.0996668,
-    -0.0994016,
-    -0.0989049,
-    -0.0982018,
-    -0.097381,
-    -0.0965677,
-    -0.0958848,
-    -0.0954147,
-    -0.0951741,
-    -0.0951086,
-    -0.0951094,
-    -0.0950477,
-    -0.0948136,
-    -0.0943509,
-    -0.093674,
-    -0.0928636,
-    -0.0920417,
-    -0.0913338,
-    -0.0908301,
-    -0.0905577,
-    -0.0904719,
-    -0.0904705,
-    -0.090425,
-    -0.0902208,
-    -0.0897923,
-    -0.0891432,
-    -0.0883458,
-    -0.087518,
-    -0.0867871,
-    -0.0862505,
-    -0.0859454,
-    -0.0858373,
-    -0.0858308,
-    -0.0857991,
-    -0.0856232,
-    -0.0852288,
-    -0.0846091,
-    -0.0838272,
-    -0.0829962,
-    -0.0822445,
-    -0.0816759,
-    -0.0813374,
-    -0.081205,
-    -0.0811907,
-    -0.0811702,
-    -0.081021,
-    -0.0806604,
-    -0.0800714,
-    -0.0793074,
-    -0.078476,
-    -0.0777058,
-    -0.0771062,
-    -0.0767339,
-    -0.0765753,
-    -0.0765506,
-    -0.0765386,
-    -0.0764142,
-    -0.0760871,
-    -0.0755298,
-    -0.074786,
-    -0.073957,
-    -0.0731706,
-    -0.0725413,
-    -0.0721351,
-    -0.0719487,
-    -0.071911,
-    -0.0719048,
-    -0.0718032,
-    -0.0715089,
-    -0.0709841,
-    -0.0702626,
-    -0.0694387,
-    -0.0686387,
-    -0.0679812,
-    -0.067541,
-    -0.0673254,
-    -0.0672722,
-    -0.067269,
-    -0.0671881,
-    -0.0669257,
-    -0.0664342,
-    -0.0657369,
-    -0.0649208,
-    -0.0641097,
-    -0.0634258,
-    -0.0629518,
-    -0.0627056,
-    -0.0626345,
-    -0.0626317,
-    -0.0625692,
-    -0.0623376,
-    -0.0618797,
-    -0.0612085,
-    -0.0604029,
-    -0.0595834,
-    -0.0588748,
-    -0.0583675,
-    -0.0580897,
-    -0.0579985,
-    -0.0579932,
-    -0.0579467,
-    -0.0577446,
-    -0.0573206,
-    -0.0566771,
-    -0.0558846,
-    -0.0550594,
-    -0.0543281,
-    -0.0537882,
-    -0.0534779,
-    -0.0533644,
-    -0.053354,
-    -0.053321,
-    -0.0531469,
-    -0.0527567,
-    -0.0521425,
-    -0.0513654,
-    -0.0505372,
-    -0.0497854,
-    -0.0492138,
-    -0.0488704,
-    -0.0487326,
-    -0.0487143,
-    -0.0486923,
-    -0.0485446,
-    -0.048188,
-    -0.0476043,
-    -0.0468451,
-    -0.0460167,
-    -0.0452466,
-    -0.0446443,
-    -0.0442673,
-    -0.0441035,
-    -0.0440747,
-    -0.044061,
-    -0.0439378,
-    -0.0436144,
-    -0.0430622,
-    -0.0423232,
-    -0.0414973,
-    -0.0407113,
-    -0.0400796,
-    -0.0396689,
-    -0.0394773,
-    -0.0394355,
-    -0.0394274,
-    -0.0393268,
-    -0.0390359,
-    -0.0385161,
-    -0.0377993,
-    -0.0369787,
-    -0.0361793,
-    -0.0355196,
-    -0.0350752,
-    -0.0348545,
-    -0.0347971,
-    -0.0347919,
-    -0.0347117,
-    -0.0344525,
-    -0.0339657,
-    -0.0332732,
-    -0.0324604,
-    -0.0316502,
-    -0.0309643,
-    -0.0304863,
-    -0.0302352,
-    -0.0301598,
-    -0.0301548,
-    -0.0300928,
-    -0.0298641,
-    -0.0294109,
-    -0.0287444,
-    -0.0279422,
-    -0.0271237,
-    -0.0264134,
-    -0.0259023,
-    -0.0256197,
-    -0.0255242,
-    -0.0255165,
-    -0.0254703,
-    -0.025271,
-    -0.0248514,
-    -0.0242126,
-    -0.0234236,
-    -0.0225995,
-    -0.0218668,
-    -0.0213232,
-    -0.0210082,
-    -0.0208904,
-    -0.0208775,
-    -0.0208446,
-    -0.0206731,
-    -0.0202872,
-    -0.0196776,
-    -0.0189041,
-    -0.0180773,
-    -0.0173242,
-    -0.0167491,
-    -0.016401,
-    -0.016259,
-    -0.0162381,
-    -0.016216,
-    -0.0160706,
-    -0.0157182,
-    -0.015139,
-    -0.0143835,
-    -0.0135566,
-    -0.0127854,
-    -0.0121798,
-    -0.0117983,
-    -0.0116302,
-    -0.0115987,
-    -0.0115847,
-    -0.0114637,
-    -0.0111443,
-    -0.0105967,
-    -0.00986133,
-    -0.00903708,
-    -0.00825018,
-    -0.00761533,
-    -0.00720017,
-    -0.00700436,
-    -0.00695967,
-    -0.0069511,
-    -0.00685249,
-    -0.00656554,
-    -0.00605023,
-    -0.00533722,
-    -0.00451834,
-    -0.0037182,
-    -0.0030556,
-    -0.00260676,
-    -0.00238178,
-    -0.00232144,
-    -0.00231561,
-    -0.00223726,
-    -0.00198183,
-    -0.00149954,
-    -0.000810821,
-    0,
-    0.000810821,
-    0.00149954,
-    0.00198183,
-    0.00223726,
-    0.00231561,
-    0.00232144,
-    0.00238178,
-    0.00260676,
-    0.0030556,
-    0.0037182,
-    0.00451834,
-    0.00533722,
-    0.00605023,
-    0.00656554,
-    0.00685249,
-    0.0069511,
-    0.00695967,
-    0.00700436,
-    0.00720017,
-    0.00761533,
-    0.00825018,
-    0.00903708,
-    0.00986133,
-    0.0105967,
-    0.0111443,
-    0.0114637,
-    0.0115847,
-    0.0115987,
-    0.0116302,
-    0.0117983,
-    0.0121798,
-    0.0127854,
-    0.0135566,
-    0.0143835,
-    0.015139,
-    0.0157182,
-    0.0160706,
-    0.016216,
-    0.0162381,
-    0.016259,
-    0.016401,
-    0.0167491,
-    0.0173242,
-    0.0180773,
-    0.0189041,
-    0.0196776,
-    0.0202872,
-    0.0206731,
-    0.0208446,
-    0.0208775,
-    0.0208904,
-    0.0210082,
-    0.0213232,
-    0.0218668,
-    0.0225995,
-    0.0234236,
-    0.0242126,
-    0.0248514,
-    0.025271,
-    0.0254703,
-    0.0255165,
-    0.0255242,
-    0.0256197,
-    0.0259023,
-    0.0264134,
-    0.0271237,
-    0.0279422,
-    0.0287444,
-    0.0294109,
-    0.0298641,
-    0.0300928,
-    0.0301548,
-    0.0301598,
-    0.0302352,
-    0.0304863,
-    0.0309643,
-    0.0316502,
-    0.0324604,
-    0.0332732,
-    0.0339657,
-    0.0344525,
-    0.0347117,
-    0.0347919,
-    0.0347971,
-    0.0348545,
-    0.0350752,
-    0.0355196,
-    0.0361793,
-    0.0369787,
-    0.0377993,
-    0.0385161,
-    0.0390359,
-    0.0393268,
-    0.0394274,
-    0.0394355,
-    0.0394773,
-    0.0396689,
-    0.0400796,
-    0.0407113,
-    0.0414973,
-    0.0423232,
-    0.0430622,
-    0.0436144,
-    0.0439378,
-    0.044061,
-    0.0440747,
-    0.0441035,
-    0.0442673,
-    0.0446443,
-    0.0452466,
-    0.0460167,
-    0.0468451,
-    0.0476043,
-    0.048188,
-    0.0485446,
-    0.0486923,
-    0.0487143,
-    0.0487326,
-    0.0488704,
-    0.0492138,
-    0.0497854,
-    0.0505372,
-    0.0513654,
-    0.0521425,
-    0.0527567,
-    0.0531469,
-    0.053321,
-    0.053354,
-    0.0533644,
-    0.0534779,
-    0.0537882,
-    0.0543281,
-    0.0550594,
-    0.0558846,
-    0.0566771,
-    0.0573206,
-    0.0577446,
-    0.0579467,
-    0.0579932,
-    0.0579985,
-    0.0580897,
-    0.0583675,
-    0.0588748,
-    0.0595834,
-    0.0604029,
-    0.0612085,
-    0.0618797,
-    0.0623376,
-    0.0625692,
-    0.0626317,
-    0.0626345,
-    0.0627056,
-    0.0629518,
-    0.0634258,
-    0.0641097,
-    0.0649208,
-    0.0657369,
-    0.0664342,
-    0.0669257,
-    0.0671881,
-    0.067269,
-    0.0672722,
-    0.0673254,
-    0.067541,
-    0.0679812,
-    0.0686387,
-    0.0694387,
-    0.0702626,
-    0.0709841,
-    0.0715089,
-    0.0718032,
-    0.0719048,
-    0.071911,
-    0.0719487,
-    0.0721351,
-    0.0725413,
-    0.0731706,
-    0.073957,
-    0.074786,
-    0.0755298,
-    0.0760871,
-    0.0764142,
-    0.0765386,
-    0.0765506,
-    0.0765753,
-    0.0767339,
-    0.0771062,
-    0.0777058,
-    0.078476,
-    0.0793074,
-    0.0800714,
-    0.0806604,
-    0.081021,
-    0.0811702,
-    0.0811907,
-    0.081205,
-    0.0813374,
-    0.0816759,
-    0.0822445,
-    0.0829962,
-    0.0838272,
-    0.0846091,
-    0.0852288,
-    0.0856232,
-    0.0857991,
-    0.0858308,
-    0.0858373,
-    0.0859454,
-    0.0862505,
-    0.0867871,
-    0.087518,
-    0.0883458,
-    0.0891432,
-    0.0897923,
-    0.0902208,
-    0.090425,
-    0.0904705,
-    0.0904719,
-    0.0905577,
-    0.0908301,
-    0.0913338,
-    0.0920417,
-    0.0928636,
-    0.093674,
-    0.0943509,
-    0.0948136,
-    0.0950477,
-    0.0951094,
-    0.0951086,
-    0.0951741,
-    0.0954147,
-    0.0958848,
-    0.0965677,
-    0.097381,
-    0.0982018,
-    0.0989049,
-    0.0994016,
-    0.0996668,
-    0.0997472,
-    0.0997468,
-    0.0997945,
-    0.100004,
-    0.10044,
-    0.101096,
-    0.101898,
-    0.102727,
-    0.103454,
-    0.103985,
-    0.104282,
-    0.104383,
-    0.104386,
-    0.104418,
-    0.104599,
-    0.105,
-    0.105628,
-    0.106416,
-    0.10725,
-    0.108,
-    0.108563,
-    0.108893,
-    0.109018,
-    0.109027,
-    0.109046,
-    0.109198,
-    0.109565,
-    0.110163,
-    0.110935,
-    0.11177,
-    0.112541,
-    0.113135,
-    0.1135,
-    0.11365,
-    0.113667,
-    0.113676,
-    0.113802,
-    0.114135,
-    0.114701,
-    0.115454,
-    0.116289,
-    0.117078,
-    0.117703,
-    0.118102,
-    0.118279,
-    0.118308,
-    0.118309,
-    0.118411,
-    0.11871,
-    0.119244,
-    0.119975,
-    0.120807,
-    0.121611,
-    0.122267,
-    0.1227,
-    0.122905,
-    0.122948,
-    0.122944,
-    0.123024,
-    0.12329,
-    0.12379,
-    0.124499,
-    0.125324,
-    0.126141,
-    0.126825,
-    0.127292,
-    0.127528,
-    0.127588,
-    0.127582,
-    0.127641,
-    0.127875,
-    0.128341,
-    0.129024,
-    0.129841,
-    0.130668,
-    0.131378,
-    0.13188,
-    0.132148,
-    0.132227,
-    0.132221,
-    0.132262,
-    0.132465,
-    0.132897,
-    0.133552,
-    0.134357,
-    0.135192,
-    0.135927,
-    0.136463,
-    0.136763,
-    0.136863,
-    0.136861,
-    0.136886,
-    0.13706,
-    0.137457,
-    0.138083,
-    0.138874,
-    0.139714,
-    0.140471,
-    0.141041,
-    0.141375,
-    0.141498,
-    0.141503,
-    0.141515,
-    0.14166,
-    0.142022,
-    0.142618,
-    0.143392,
-    0.144234,
-    0.145012,
-    0.145613,
-    0.145982,
-    0.146131,
-    0.146144,
-    0.146146,
-    0.146264,
-    0.146592,
-    0.147156,
-    0.147911,
-    0.148752,
-    0.149548,
-    0.150181,
-    0.150584,
-    0.150761,
-    0.150786,
-    0.15078,
-    0.150874,
-    0.151167,
-    0.151698,
-    0.152431,
-    0.153269,
-    0.15408,
-    0.154743,
-    0.155182,
-    0.155388,
-    0.155427,
-    0.155416,
-    0.155487,
-    0.155747,
-    0.156244,
-    0.156954,
-    0.157785,
-    0.15861,
-    0.159301,
-    0.159774,
-    0.160011,
-    0.160068,
-    0.160055,
-    0.160105,
-    0.160332,
-    0.160795,
-    0.161478,
-    0.1623,
-    0.163135,
-    0.163854,
-    0.164362,
-    0.164631,
-    0.164707,
-    0.164695,
-    0.164727,
-    0.164923,
-    0.16535,
-    0.166006,
-    0.166816,
-    0.167659,
-    0.168402,
-    0.168944,
-    0.169247,
-    0.169345,
-    0.169336,
-    0.169353,
-    0.169518,
-    0.16991,
-    0.170536,
-    0.171332,
-    0.172179,
-    0.172946,
-    0.173522,
-    0.173859,
-    0.173981,
-    0.173979,
-    0.173982,
-    0.174119,
-    0.174475,
-    0.17507,
-    0.175848,
-    0.176698,
-    0.177485,
-    0.178094,
-    0.178466,
-    0.178614,
-    0.178621,
-    0.178614,
-    0.178724,
-    0.179045,
-    0.179608,
-    0.180366,
-    0.181215,
-    0.18202,
-    0.182661,
-    0.183069,
-    0.183245,
-    0.183264,
-    0.18325,
-    0.183334,
-    0.18362,
-    0.184149,
-    0.184886,
-    0.185731,
-    0.186552,
-    0.187223,
-    0.187666,
-    0.187873,
-    0.187907,
-    0.187887,
-    0.187949,
-    0.188201,
-    0.188695,
-    0.189407,
-    0.190245,
-    0.19108,
-    0.19178,
-    0.192259,
-    0.192497,
-    0.192549,
-    0.192527,
-    0.192567,
-    0.192787,
-    0.193245,
-    0.193931,
-    0.19476,
-    0.195604,
-    0.196332,
-    0.196847,
-    0.197117,
-    0.197189,
-    0.197168,
-    0.197191,
-    0.197377,
-    0.1978,
-    0.198457,
-    0.199274,
-    0.200126,
-    0.200879,
-    0.201429,
-    0.201734,
-    0.201828,
-    0.201811,
-    0.201817,
-    0.201973,
-    0.20236,
-    0.202987,
-    0.203788,
-    0.204646,
-    0.205422,
-    0.206006,
-    0.206346,
-    0.206465,
-    0.206455,
-    0.206448,
-    0.206575,
-    0.206925,
-    0.20752,
-    0.208303,
-    0.209163,
-    0.20996,
-    0.210578,
-    0.210954,
-    0.2111,
-    0.211099,
-    0.211082,
-    0.211181,
-    0.211495,
-    0.212057,
-    0.21282,
-    0.213678,
-    0.214494,
-    0.215145,
-    0.215557,
-    0.215732,
-    0.215744,
-    0.215718,
-    0.215792,
-    0.216071,
-    0.216597,
-    0.217338,
-    0.218192,
-    0.219025,
-    0.219706,
-    0.220155,
-    0.22036,
-    0.220388,
-    0.220357,
-    0.220407,
-    0.220651,
-    0.221143,
-    0.221858,
-    0.222705,
-    0.223551,
-    0.224262,
-    0.224748,
-    0.224985,
-    0.225031,
-    0.224999,
-    0.225027,
-    0.225237,
-    0.225692,
-    0.226381,
-    0.227218,
-    0.228074,
-    0.228814,
-    0.229335,
-    0.229607,
-    0.229673,
-    0.229642,
-    0.229652,
-    0.229829,
-    0.230247,
-    0.230906,
-    0.231731,
-    0.232595,
-    0.23336,
-    0.233918,
-    0.234224,
-    0.234313,
-    0.234286,
-    0.23428,
-    0.234426,
-    0.234807,
-    0.235434,
-    0.236243,
-    0.237112,
-    0.237901,
-    0.238494,
-    0.238837,
-    0.238952,
-    0.238932,
-    0.238912,
-    0.239027,
-    0.239371,
-    0.239966,
-    0.240757,
-    0.241628,
-    0.242438,
-    0.243066,
-    0.243445,
-    0.243588,
-    0.243578,
-    0.243547,
-    0.243635,
-    0.243941,
-    0.244502,
-    0.245272,
-    0.246142,
-    0.246971,
-    0.247632,
-    0.248049,
-    0.248221,
-    0.248224,
-    0.248186,
-    0.248247,
-    0.248517,
-    0.249042,
-    0.249788,
-    0.250654,
-    0.2515,
-    0.252193,
-    0.252647,
-    0.252851,
-    0.25287,
-    0.252827,
-    0.252863,
-    0.253098,
-    0.253586,
-    0.254307,
-    0.255165,
-    0.256025,
-    0.256748,
-    0.25724,
-    0.257477,
-    0.257515,
-    0.25747,
-    0.257485,
-    0.257684,
-    0.258136,
-    0.258828,
-    0.259676,
-    0.260546,
-    0.261298,
-    0.261828,
-    0.2621,
-    0.262159,
-    0.262115,
-    0.262111,
-    0.262276,
-    0.26269,
-    0.263352,
-    0.264186,
-    0.265065,
-    0.265843,
-    0.26641,
-    0.266718,
-    0.266801,
-    0.266761,
-    0.266741,
-    0.266874,
-    0.267249,
-    0.267879,
-    0.268697,
-    0.26958,
-    0.270383,
-    0.270986,
-    0.271332,
-    0.271441,
-    0.271409,
-    0.271374,
-    0.271477,
-    0.271813,
-    0.272409,
-    0.273209,
-    0.274094,
-    0.274919,
-    0.275558,
-    0.275941,
-    0.276079,
-    0.276057,
-    0.276012,
-    0.276085,
-    0.276383,
-    0.276944,
-    0.277722,
-    0.278605,
-    0.27945,
-    0.280123,
-    0.280545,
-    0.280713,
-    0.280705,
-    0.280652,
-    0.280698,
-    0.280959,
-    0.281483,
-    0.282236,
-    0.283115,
-    0.283977,
-    0.284683,
-    0.285144,
-    0.285345,
-    0.285353,
-    0.285295,
-    0.285316,
-    0.28554,
-    0.286026,
-    0.286753,
-    0.287624,
-    0.2885,
-    0.289237,
-    0.289737,
-    0.289973,
-    0.290001,
-    0.28994,
-    0.28994,
-    0.290127,
-    0.290574,
-    0.291272,
-    0.292133,
-    0.293019,
-    0.293786,
-    0.294325,
-    0.294597,
-    0.294647,
-    0.294588,
-    0.294567,
-    0.29472,
-    0.295128,
-    0.295794,
-    0.296641,
-    0.297536,
-    0.29833,
-    0.298907,
-    0.299216,
-    0.299291,
-    0.299237,
-    0.299199,
-    0.299318,
-    0.299687,
-    0.300319,
-    0.301149,
-    0.302049,
-    0.302869,
-    0.303483,
-    0.303831,
-    0.303933,
-    0.303887,
-    0.303835,
-    0.303922,
-    0.304251,
-    0.304848,
-    0.305659,
-    0.30656,
-    0.307402,
-    0.308054,
-    0.308441,
-    0.308573,
-    0.308538,
-    0.308474,
-    0.308531,
-    0.308821,
-    0.309381,
-    0.310169,
-    0.311069,
-    0.311932,
-    0.312618,
-    0.313046,
-    0.31321,
-    0.313188,
-    0.313117,
-    0.313146,
-    0.313396,
-    0.313919,
-    0.314681,
-    0.315576,
-    0.316456,
-    0.317178,
-    0.317645,
-    0.317843,
-    0.317839,
-    0.317762,
-    0.317766,
-    0.317978,
-    0.318461,
-    0.319195,
-    0.320083,
-    0.320977,
-    0.321731,
-    0.322239,
-    0.322473,
-    0.322489,
-    0.322411,
-    0.322391,
-    0.322565,
-    0.323008,
-    0.323712,
-    0.324588,
-    0.325494,
-    0.326278,
-    0.326827,
-    0.327098,
-    0.327137,
-    0.327061,
-    0.327021,
-    0.327158,
-    0.327561,
-    0.328232,
-    0.329094,
-    0.330008,
-    0.330821,
-    0.331409,
-    0.331719,
-    0.331784,
-    0.331712,
-    0.331655,
-    0.331758,
-    0.332119,
-    0.332755,
-    0.333599,
-    0.334519,
-    0.335358,
-    0.335985,
-    0.336336,
-    0.336429,
-    0.336365,
-    0.336293,
-    0.336363,
-    0.336682,
-    0.337282,
-    0.338106,
-    0.339027,
-    0.339889,
-    0.340555,
-    0.340947,
-    0.341071,
-    0.341019,
-    0.340935,
-    0.340973,
-    0.341252,
-    0.341814,
-    0.342613,
-    0.343533,
-    0.344416,
-    0.345119,
-    0.345553,
-    0.345711,
-    0.345673,
-    0.34558,
-    0.34559,
-    0.345828,
-    0.346349,
-    0.347123,
-    0.348037,
-    0.348939,
-    0.349677,
-    0.350153,
-    0.350346,
-    0.350327,
-    0.350229,
-    0.350212,
-    0.350409,
-    0.35089,
-    0.351634,
-    0.35254,
-    0.353457,
-    0.354229,
-    0.354747,
-    0.354978,
-    0.35498,
-    0.35488,
-    0.354839,
-    0.354997,
-    0.355436,
-    0.356148,
-    0.357043,
-    0.357971,
-    0.358776,
-    0.359335,
-    0.359606,
-    0.359632,
-    0.359533,
-    0.359471,
-    0.359591,
-    0.359987,
-    0.360665,
-    0.361545,
-    0.362482,
-    0.363316,
-    0.363917,
-    0.364229,
-    0.364282,
-    0.364189,
-    0.364107,
-    0.364192,
-    0.364545,
-    0.365186,
-    0.366047,
-    0.366989,
-    0.367851,
-    0.368493,
-    0.368846,
-    0.368929,
-    0.368845,
-    0.368748,
-    0.368798,
-    0.369108,
-    0.369711,
-    0.37055,
-    0.371494,
-    0.37238,
-    0.373063,
-    0.373459,
-    0.373575,
-    0.373502,
-    0.373393,
-    0.37341,
-    0.373677,
-    0.37424,
-    0.375054,
-    0.375997,
-    0.376905,
-    0.377626,
-    0.378066,
-    0.378217,
-    0.37816,
-    0.378042,
-    0.378029,
-    0.378252,
-    0.378774,
-    0.37956,
-    0.380497,
-    0.381424,
-    0.382183,
-    0.382667,
-    0.382855,
-    0.382817,
-    0.382694,
-    0.382652,
-    0.382834,
-    0.383312,
-    0.384068,
-    0.384997,
-    0.38594,
-    0.386734,
-    0.387262,
-    0.38749,
-    0.387474,
-    0.387349,
-    0.387282,
-    0.387423,
-    0.387857,
-    0.388579,
-    0.389495,
-    0.39045,
-    0.391278,
-    0.391851,
-    0.39212,
-    0.39213,
-    0.392006,
-    0.391917,
-    0.392018,
-    0.392407,
-    0.393093,
-    0.393993,
-    0.394958,
-    0.395817,
-    0.396433,
-    0.396745,
-    0.396783,
-    0.396665,
-    0.396556,
-    0.396619,
-    0.396963,
-    0.397611,
-    0.398491,
-    0.399461,
-    0.400349,
-    0.401009,
-    0.401365,
-    0.401435,
-    0.401326,
-    0.401201,
-    0.401227,
-    0.401525,
-    0.402132,
-    0.40299,
-    0.403962,
-    0.404876,
-    0.405578,
-    0.405979,
-    0.406084,
-    0.405988,
-    0.405849,
-    0.405841,
-    0.406094,
-    0.406659,
-    0.40749,
-    0.40846,
-    0.409398,
-    0.410141,
-    0.410588,
-    0.410729,
-    0.410649,
-    0.410502,
-    0.410461,
-    0.410669,
-    0.41119,
-    0.411992,
-    0.412957,
-    0.413914,
-    0.414696,
-    0.41519,
-    0.415371,
-    0.415311,
-    0.415158,
-    0.415088,
-    0.415251,
-    0.415726,
-    0.416496,
-    0.417452,
-    0.418426,
-    0.419245,
-    0.419786,
-    0.420009,
-    0.419972,
-    0.419817,
-    0.41972,
-    0.41984,
-    0.420269,
-    0.421003,
-    0.421945,
-    0.422933,
-    0.423788,
-    0.424375,
-    0.424642,
-    0.424632,
-    0.424479,
-    0.424358,
-    0.424436,
-    0.424817,
-    0.425513,
-    0.426439,
-    0.427435,
-    0.428324,
-    0.428958,
-    0.42927,
-    0.429291,
-    0.429143,
-    0.429001,
-    0.429038,
-    0.429372,
-    0.430027,
-    0.430932,
-    0.431935,
-    0.432854,
-    0.433534,
-    0.433892,
-    0.433947,
-    0.433809,
-    0.43365,
-    0.433648,
-    0.433933,
-    0.434546,
-    0.435426,
-    0.436431,
-    0.437378,
-    0.438102,
-    0.438509,
-    0.4386,
-    0.438475,
-    0.438302,
-    0.438264,
-    0.438501,
-    0.439069,
-    0.439921,
-    0.440924,
-    0.441896,
-    0.442664,
-    0.443119,
-    0.443249,
-    0.443142,
-    0.44296,
-    0.442887,
-    0.443076,
-    0.443597,
-    0.444418,
-    0.445415,
-    0.446408,
-    0.447218,
-    0.447723,
-    0.447895,
-    0.447809,
-    0.447621,
-    0.447516,
-    0.447658,
-    0.44813,
-    0.448918,
-    0.449905,
-    0.450915,
-    0.451766,
-    0.452321,
-    0.452537,
-    0.452476,
-    0.452285,
-    0.452152,
-    0.452247,
-    0.45267,
-    0.45342,
-    0.454393,
-    0.455418,
-    0.456306,
-    0.456911,
-    0.457174,
-    0.457141,
-    0.456952,
-    0.456794,
-    0.456844,
-    0.457216,
-    0.457925,
-    0.458881,
-    0.459916,
-    0.460839,
-    0.461494,
-    0.461805,
-    0.461805,
-    0.461622,
-    0.461441,
-    0.461448,
-    0.461769,
-    0.462434,
-    0.463368,
-    0.46441,
-    0.465366,
-    0.46607,
-    0.466431,
-    0.466466,
-    0.466293,
-    0.466094,
-    0.466059,
-    0.466328,
-    0.466948,
-    0.467856,
-    0.4689,
-    0.469886,
-    0.470638,
-    0.47105,
-    0.471125,
-    0.470966,
-    0.470752,
-    0.470678,
-    0.470895,
-    0.471467,
-    0.472345,
-    0.473388,
-    0.4744,
-    0.475198,
-    0.475663,
-    0.47578,
-    0.475639,
-    0.475414,
-    0.475303,
-    0.47547,
-    0.475991,
-    0.476836,
-    0.477873,
-    0.478908,
-    0.479751,
-    0.48027,
-    0.480431,
-    0.480313,
-    0.480081,
-    0.479936,
-    0.480052,
-    0.480522,
-    0.48133,
-    0.482355,
-    0.48341,
-    0.484297,
-    0.484869,
-    0.485077,
-    0.484986,
-    0.484752,
-    0.484576,
-    0.484641,
-    0.485058,
-    0.485826,
-    0.486837,
-    0.487907,
-    0.488835,
-    0.48946,
-    0.489718,
-    0.489658,
-    0.489425,
-    0.489222,
-    0.489239,
-    0.489601,
-    0.490326,
-    0.491318,
-    0.492399,
-    0.493365,
-    0.494044,
-    0.494354,
-    0.494328,
-    0.494102,
-    0.493874,
-    0.493845,
-    0.494151,
-    0.494829,
-    0.495798,
-    0.496887,
-    0.497888,
-    0.49862,
-    0.498984,
-    0.498996,
-    0.498781,
-    0.498533,
-    0.498458,
-    0.498709,
-    0.499338,
-    0.500279,
-    0.501371,
-    0.502404,
-    0.503188,
-    0.503607,
-    0.503661,
-    0.503461,
-    0.503197,
-    0.503079,
-    0.503275,
-    0.503851,
-    0.504761,
-    0.505851,
-    0.506913,
-    0.507747,
-    0.508223,
-    0.508323,
-    0.508142,
-    0.507866,
-    0.507708,
-    0.507848,
-    0.508371,
-    0.509244,
-    0.510328,
-    0.511415,
-    0.512299,
-    0.512832,
-    0.51298,
-    0.512823,
-    0.512539,
-    0.512345,
-    0.51243,
-    0.512896,
-    0.51373,
-    0.514803,
-    0.515912,
-    0.516842,
-    0.517434,
-    0.517632,
-    0.517504,
-    0.517217,
-    0.516989,
-    0.51702,
-    0.517429,
-    0.518219,
-    0.519276,
-    0.520402,
-    0.521377,
-    0.522027,
-    0.52228,
-    0.522184,
-    0.521899,
-    0.521641,
-    0.521618,
-    0.521968,
-    0.522712,
-    0.523749,
-    0.524887,
-    0.525903,
-    0.526612,
-    0.526921,
-    0.526863,
-    0.526584,
-    0.526299,
-    0.526225,
-    0.526515,
-    0.527208,
-    0.52822,
-    0.529367,
-    0.530422,
-    0.531188,
-    0.531556,
-    0.531539,
-    0.531271,
-    0.530964,
-    0.530841,
-    0.53107,
-    0.53171,
-    0.532692,
-    0.533842,
-    0.534933,
-    0.535756,
-    0.536184,
-    0.536212,
-    0.535961,
-    0.535635,
-    0.535466,
-    0.535634,
-    0.536217,
-    0.537165,
-    0.538314,
-    0.539436,
-    0.540315,
-    0.540804,
-    0.540882,
-    0.540651,
-    0.540312,
-    0.540099,
-    0.540206,
-    0.54073,
-    0.541639,
-    0.542781,
-    0.543932,
-    0.544864,
-    0.545417,
-    0.545547,
-    0.545343,
-    0.544995,
-    0.54474,
-    0.544787,
-    0.54525,
-    0.546116,
-    0.547247,
-    0.548421,
-    0.549405,
-    0.550021,
-    0.550207,
-    0.550034,
-    0.549682,
-    0.54939,
-    0.549377,
-    0.549776,
-    0.550595,
-    0.55171,
-    0.552904,
-    0.553937,
-    0.554617,
-    0.554862,
-    0.554724,
-    0.554374,
-    0.554047,
-    0.553976,
-    0.554311,
-    0.555079,
-    0.556171,
-    0.55738,
-    0.558459,
-    0.559204,
-    0.559511,
-    0.559413,
-    0.559069,
-    0.558713,
-    0.558585,
-    0.558854,
-    0.559566,
-    0.560632,
-    0.56185,
-    0.562973,
-    0.563781,
-    0.564152,
-    0.5641,
-    0.563767,
-    0.563386,
-    0.563203,
-    0.563405,
-    0.564059,
-    0.565092,
-    0.566315,
-    0.567478,
-    0.568349,
-    0.568787,
-    0.568783,
-    0.568468,
-    0.568066,
-    0.567831,
-    0.567966,
-    0.568557,
-    0.569554,
-    0.570775,
-    0.571974,
-    0.572907,
-    0.573413,
-    0.573464,
-    0.573171,
-    0.572753,
-    0.572469,
-    0.572535,
-    0.573062,
-    0.574016,
-    0.575232,
-    0.576462,
-    0.577455,
-    0.578031,
-    0.578139,
-    0.577874,
-    0.577446,
-    0.577116,
-    0.577115,
-    0.577574,
-    0.578481,
-    0.579684,
-    0.580942,
-    0.581993,
-    0.58264,
-    0.58281,
-    0.582578,
-    0.582145,
-    0.581772,
-    0.581705,
-    0.582094,
-    0.582948,
-    0.584135,
-    0.585414,
-    0.586521,
-    0.587239,
-    0.587474,
-    0.587282,
-    0.586849,
-    0.586437,
-    0.586305,
-    0.586621,
-    0.58742,
-    0.588582,
-    0.58988,
-    0.591038,
-    0.591828,
-    0.592132,
-    0.591984,
-    0.591557,
-    0.591112,
-    0.590915,
-    0.591158,
-    0.591895,
-    0.593029,
-    0.594338,
-    0.595546,
-    0.596407,
-    0.596783,
-    0.596685,
-    0.59627,
-    0.595795,
-    0.595536,
-    0.595704,
-    0.596376,
-    0.597475,
-    0.59879,
-    0.600044,
-    0.600976,
-    0.601426,
-    0.601382,
-    0.600985,
-    0.600486,
-    0.600168,
-    0.60026,
-    0.600863,
-    0.601921,
-    0.603236,
-    0.604531,
-    0.605534,
-    0.60606,
-    0.606076,
-    0.605703,
-    0.605185,
-    0.604811,
-    0.604826,
-    0.605357,
-    0.606368,
-    0.607678,
-    0.60901,
-    0.61008,
-    0.610685,
-    0.610766,
-    0.610423,
-    0.609892,
-    0.609465,
-    0.609404,
-    0.609858,
-    0.610817,
-    0.612114,
-    0.613478,
-    0.614615,
-    0.615301,
-    0.61545,
-    0.615144,
-    0.614605,
-    0.614129,
-    0.613992,
-    0.614367,
-    0.615268,
-    0.616547,
-    0.617938,
-    0.619139,
-    0.619905,
-    0.620128,
-    0.619865,
-    0.619325,
-    0.618804,
-    0.618592,
-    0.618885,
-    0.619723,
-    0.620978,
-    0.622389,
-    0.623651,
-    0.624499,
-    0.624799,
-    0.624585,
-    0.624051,
-    0.623489,
-    0.623204,
-    0.623413,
-    0.624183,
-    0.625405,
-    0.626832,
-    0.628151,
-    0.629082,
-    0.629463,
-    0.629304,
-    0.628782,
-    0.628185,
-    0.627828,
-    0.627951,
-    0.628647,
-    0.629832,
-    0.631268,
-    0.63264,
-    0.633652,
-    0.634118,
-    0.634021,
-    0.633517,
-    0.63289,
-    0.632464,
-    0.6325,
-    0.633118,
-    0.634257,
-    0.635696,
-    0.637117,
-    0.63821,
-    0.638764,
-    0.638734,
-    0.638256,
-    0.637605,
-    0.637113,
-    0.637061,
-    0.637596,
-    0.638683,
-    0.640117,
-    0.641583,
-    0.642756,
-    0.6434,
-    0.643442,
-    0.642997,
-    0.64233,
-    0.641775,
-    0.641634,
-    0.642082,
-    0.643111,
-    0.644533,
-    0.646038,
-    0.647288,
-    0.648025,
-    0.648146,
-    0.647741,
-    0.647062,
-    0.646449,
-    0.646219,
-    0.646576,
-    0.64754,
-    0.648943,
-    0.650481,
-    0.651807,
-    0.652638,
-    0.652844,
-    0.652486,
-    0.651804,
-    0.651135,
-    0.650818,
-    0.65108,
-    0.651972,
-    0.653349,
-    0.654914,
-    0.656313,
-    0.65724,
-    0.657534,
-    0.657231,
-    0.656552,
-    0.655835,
-    0.65543,
-    0.655595,
-    0.656408,
-    0.657751,
-    0.659337,
-    0.660805,
-    0.661828,
-    0.662216,
-    0.661976,
-    0.661308,
-    0.660547,
-    0.660057,
-    0.66012,
-    0.66085,
-    0.66215,
-    0.663749,
-    0.665283,
-    0.666403,
-    0.66689,
-    0.666719,
-    0.66607,
-    0.665271,
-    0.664697,
-    0.664658,
-    0.665297,
-    0.666547,
-    0.668153,
-    0.669747,
-    0.670964,
-    0.671554,
-    0.67146,
-    0.670838,
-    0.670007,
-    0.669353,
-    0.669209,
-    0.669751,
-    0.670943,
-    0.672547,
-    0.674197,
-    0.67551,
-    0.676206,
-    0.676197,
-    0.67561,
-    0.674755,
-    0.674024,
-    0.673774,
-    0.674213,
-    0.675339,
-    0.676933,
-    0.678632,
-    0.68004,
-    0.680847,
-    0.680929,
-    0.680387,
-    0.679514,
-    0.67871,
-    0.678353,
-    0.678685,
-    0.679735,
-    0.681311,
-    0.683055,
-    0.684555,
-    0.685476,
-    0.685656,
-    0.685167,
-    0.684285,
-    0.683412,
-    0.682947,
-    0.683166,
-    0.684133,
-    0.685682,
-    0.687463,
-    0.689054,
-    0.69009,
-    0.690376,
-    0.689949,
-    0.689066,
-    0.688129,
-    0.687557,
-    0.687659,
-    0.688535,
-    0.690046,
-    0.691857,
-    0.693536,
-    0.69469,
-    0.695088,
-    0.694732,
-    0.693858,
-    0.692862,
-    0.692184,
-    0.692163,
-    0.69294,
-    0.694405,
-    0.696238,
-    0.698001,
-    0.699275,
-    0.699791,
-    0.699516,
-    0.698659,
-    0.697612,
-    0.696828,
-    0.696681,
-    0.69735,
-    0.698759,
-    0.700606,
-    0.702448,
-    0.703843,
-    0.704485,
-    0.704299,
-    0.703469,
-    0.702377,
-    0.70149,
-    0.701214,
-    0.701766,
-    0.703109,
-    0.70496,
-    0.706877,
-    0.708393,
-    0.709166,
-    0.709081,
-    0.708288,
-    0.707159,
-    0.706172,
-    0.705762,
-    0.70619,
-    0.707456,
-    0.709302,
-    0.711288,
-    0.712926,
-    0.713836,
-    0.71386,
-    0.713115,
-    0.711957,
-    0.710872,
-    0.710326,
-    0.710622,
-    0.711801,
-    0.713632,
-    0.71568,
-    0.717439,
-    0.718491,
-    0.718635,
-    0.717949,
-    0.716771,
-    0.715593,
-    0.714909,
-    0.715064,
-    0.716144,
-    0.717949,
-    0.720053,
-    0.721932,
-    0.723132,
-    0.723405,
-    0.72279,
-    0.721601,
-    0.720334,
-    0.71951,
-    0.719517,
-    0.720487,
-    0.722255,
-    0.724406,
-    0.726404,
-    0.727756,
-    0.728169,
-    0.727637,
-    0.726448,
-    0.725097,
-    0.724131,
-    0.723982,
-    0.724831,
-    0.72655,
-    0.72874,
-    0.730853,
-    0.732363,
-    0.732925,
-    0.732489,
-    0.731311,
-    0.729882,
-    0.728774,
-    0.728461,
-    0.729176,
-    0.730833,
-    0.733053,
-    0.735279,
-    0.736951,
-    0.737673,
-    0.737345,
-    0.73619,
-    0.734691,
-    0.733439,
-    0.732955,
-    0.733524,
-    0.735106,
-    0.737345,
-    0.739681,
-    0.741518,
-    0.742411,
-    0.742205,
-    0.741086,
-    0.739523,
-    0.738129,
-    0.737466,
-    0.737876,
-    0.739368,
-    0.741616,
-    0.744057,
-    0.746063,
-    0.747138,
-    0.747069,
-    0.745999,
-    0.744381,
-    0.742844,
-    0.741995,
-    0.742232,
-    0.74362,
-    0.745865,
-    0.748406,
-    0.750585,
-    0.751852,
-    0.751935,
-    0.750928,
-    0.749265,
-    0.747587,
-    0.746544,
-    0.746594,
-    0.747861,
-    0.75009,
-    0.752725,
-    0.75508,
-    0.756551,
-    0.756803,
-    0.755875,
-    0.754178,
-    0.752359,
-    0.751114,
-    0.750964,
-    0.752093,
-    0.754291,
-    0.757014,
-    0.759548,
-    0.761235,
-    0.761672,
-    0.760841,
-    0.759119,
-    0.757164,
-    0.755709,
-    0.755341,
-    0.756314,
-    0.758467,
-    0.761269,
-    0.763986,
-    0.765901,
-    0.766542,
-    0.765826,
-    0.764093,
-    0.762002,
-    0.76033,
-    0.759728,
-    0.760525,
-    0.762615,
-    0.765489,
-    0.768391,
-    0.770548,
-    0.771412,
-    0.770831,
-    0.769101,
-    0.766878,
-    0.764979,
-    0.764126,
-    0.764725,
-    0.766733,
-    0.769669,
-    0.772759,
-    0.775173,
-    0.776282,
-    0.775858,
-    0.774146,
-    0.771796,
-    0.76966,
-    0.768535,
-    0.768912,
-    0.770818,
-    0.773806,
-    0.777088,
-    0.779774,
-    0.781153,
-    0.780911,
-    0.779234,
-    0.776759,
-    0.774376,
-    0.772958,
-    0.773086,
-    0.774867,
-    0.777895,
-    0.781371,
-    0.784348,
-    0.786024,
-    0.785991,
-    0.784369,
-    0.781774,
-    0.779133,
-    0.777396,
-    0.777244,
-    0.778874,
-    0.781928,
-    0.785603,
-    0.788892,
-    0.790895,
-    0.791103,
-    0.789558,
-    0.786849,
-    0.783934,
-    0.781849,
-    0.781383,
-    0.782832,
-    0.785898,
-    0.789777,
-    0.793402,
-    0.795768,
-    0.796253,
-    0.79481,
-    0.791992,
-    0.788788,
-    0.786321,
-    0.7855,
-    0.786732,
-    0.789793,
-    0.793883,
-    0.797872,
-    0.800645,
-    0.80145,
-    0.800138,
-    0.797216,
-    0.793703,
-    0.790813,
-    0.789588,
-    0.790563,
-    0.793598,
-    0.797907,
-    0.802296,
-    0.805527,
-    0.806704,
-    0.805558,
-    0.80254,
-    0.798691,
-    0.795328,
-    0.793638,
-    0.794306,
-    0.797292,
-    0.801832,
-    0.806665,
-    0.810418,
-    0.812032,
-    0.811095,
-    0.807986,
-    0.803768,
-    0.799868,
-    0.797639,
-    0.797938,
-    0.800846,
-    0.805632,
-    0.810968,
-    0.815325,
-    0.817455,
-    0.816781,
-    0.813588,
-    0.808958,
-    0.804437,
-    0.801572,
-    0.801421,
-    0.804216,
-    0.809273,
-    0.815187,
-    0.820256,
-    0.82301,
-    0.822666,
-    0.819398,
-    0.814293,
-    0.809041,
-    0.80541,
-    0.804704,
-    0.80734,
-    0.812699,
-    0.819297,
-    0.825227,
-    0.828747,
-    0.828828,
-    0.82549,
-    0.819827,
-    0.813685,
-    0.809108,
-    0.8077,
-    0.810115,
-    0.815826,
-    0.82326,
-    0.830262,
-    0.834755,
-    0.83539,
-    0.831991,
-    0.825642,
-    0.81838,
-    0.812591,
-    0.810266,
-    0.812372,
-    0.818512,
-    0.827013,
-    0.835406,
-    0.841182,
-    0.842568,
-    0.839116,
-    0.831878,
-    0.823137,
-    0.815722,
-    0.812147,
-    0.813808,
-    0.820505,
-    0.830445,
-    0.840749,
-    0.848311,
-    0.850767,
-    0.847267,
-    0.838803,
-    0.827971,
-    0.818227,
-    0.812831,
-    0.813818,
-    0.821302,
-    0.833348,
-    0.84649,
-    0.856747,
-    0.86085,
-    0.857308,
-    0.846972,
-    0.832888,
-    0.819459,
-    0.811134,
-    0.811003,
-    0.819744,
-    0.835264,
-    0.853177,
-    0.868048,
-    0.87503,
-    0.871446,
-    0.85778,
-    0.837774,
-    0.817488,
-    0.803581,
-    0.801251,
-    0.812464,
-    0.835037,
-    0.862925,
-    0.887736,
-    0.901135,
-    0.897472,
-    0.875889,
-    0.841195,
-    0.803126,
-    0.774017,
-    0.765372,
-    0.784172,
-    0.829911,
-    0.893236,
-    0.95673,
-    0.99784,
-    0.993411,
-    0.924846,
-    0.782683,
-    0.569469,
-    0.300185
-};
-
-// Top frequency: 44.1K * 0.00362812
-constexpr static std::array<float, 4096> wt_sawtooth_0x3 =
-{
-    0,
-    -0.15168,
-    -0.299374,
-    -0.439281,
-    -0.56797,
-    -0.682529,
-    -0.780701,
-    -0.860968,
-    -0.922609,
-    -0.965703,
-    -0.991096,
-    -1.00033,
-    -0.995519,
-    -0.97924,
-    -0.954349,
-    -0.92383,
-    -0.89063,
-    -0.857498,
-    -0.826856,
-    -0.800686,
-    -0.780454,
-    -0.767064,
-    -0.760853,
-    -0.76162,
-    -0.768679,
-    -0.780955,
-    -0.797076,
-    -0.8155,
-    -0.83463,
-    -0.852931,
-    -0.869036,
-    -0.881832,
-    -0.890521,
-    -0.89466,
-    -0.894175,
-    -0.889338,
-    -0.880732,
-    -0.869191,
-    -0.855725,
-    -0.841433,
-    -0.827422,
-    -0.814722,
-    -0.804214,
-    -0.796569,
-    -0.792213,
-    -0.791301,
-    -0.79372,
-    -0.799107,
-    -0.806892,
-    -0.816342,
-    -0.82663,
-    -0.836896,
-    -0.846317,
-    -0.854165,
-    -0.859861,
-    -0.863011,
-    -0.863432,
-    -0.861155,
-    -0.856417,
-    -0.849638,
-    -0.841379,
-    -0.832295,
-    -0.823084,
-    -0.814432,
-    -0.806959,
-    -0.801175,
-    -0.797446,
-    -0.795966,
-    -0.79675,
-    -0.799641,
-    -0.80432,
-    -0.810342,
-    -0.81717,
-    -0.824218,
-    -0.830901,
-    -0.836678,
-    -0.841092,
-    -0.843803,
-    -0.844612,
-    -0.843472,
-    -0.840488,
-    -0.835906,
-    -0.830089,
-    -0.823487,
-    -0.816599,
-    -0.809935,
-    -0.803977,
-    -0.79914,
-    -0.795741,
-    -0.793981,
-    -0.793927,
-    -0.795514,
-    -0.798549,
-    -0.802734,
-    -0.807684,
-    -0.812966,
-    -0.81813,
-    -0.822742,
-    -0.826423,
-    -0.828871,
-    -0.82989,
-    -0.829394,
-    -0.827421,
-    -0.824119,
-    -0.819741,
-    -0.814615,
-    -0.809122,
-    -0.803666,
-    -0.798638,
-    -0.794391,
-    -0.791209,
-    -0.789288,
-    -0.788724,
-    -0.789503,
-    -0.791509,
-    -0.794532,
-    -0.798285,
-    -0.802432,
-    -0.806607,
-    -0.810454,
-    -0.813645,
-    -0.815909,
-    -0.817052,
-    -0.81697,
-    -0.815658,
-    -0.813204,
-    -0.809787,
-    -0.805655,
-    -0.80111,
-    -0.796481,
-    -0.792099,
-    -0.788268,
-    -0.785248,
-    -0.78323,
-    -0.782324,
-    -0.782552,
-    -0.783846,
-    -0.786058,
-    -0.788969,
-    -0.792309,
-    -0.795777,
-    -0.79907,
-    -0.801899,
-    -0.804017,
-    -0.805236,
-    -0.80544,
-    -0.804595,
-    -0.802749,
-    -0.800027,
-    -0.796621,
-    -0.792773,
-    -0.788759,
-    -0.784861,
-    -0.781351,
-    -0.778464,
-    -0.776387,
-    -0.775239,
-    -0.775066,
-    -0.775835,
-    -0.777442,
-    -0.77972,
-    -0.782448,
-    -0.785375,
-    -0.788237,
-    -0.790779,
-    -0.792772,
-    -0.794036,
-    -0.794447,
-    -0.79395,
-    -0.792563,
-    -0.790373,
-    -0.787526,
-    -0.784222,
-    -0.78069,
-    -0.777179,
-    -0.773929,
-    -0.77116,
-    -0.769051,
-    -0.767725,
-    -0.767247,
-    -0.767611,
-    -0.768747,
-    -0.770525,
-    -0.772766,
-    -0.775258,
-    -0.777769,
-    -0.780071,
-    -0.781953,
-    -0.783239,
-    -0.783802,
-    -0.783574,
-    -0.782548,
-    -0.780779,
-    -0.778382,
-    -0.775518,
-    -0.772383,
-    -0.769193,
-    -0.766166,
-    -0.763505,
-    -0.761381,
-    -0.759924,
-    -0.759208,
-    -0.759249,
-    -0.760004,
-    -0.761375,
-    -0.763215,
-    -0.765343,
-    -0.767557,
-    -0.769651,
-    -0.771428,
-    -0.77272,
-    -0.773397,
-    -0.773381,
-    -0.772645,
-    -0.771222,
-    -0.769196,
-    -0.7667,
-    -0.763901,
-    -0.760988,
-    -0.758158,
-    -0.755599,
-    -0.753477,
-    -0.751921,
-    -0.751016,
-    -0.750794,
-    -0.751234,
-    -0.752264,
-    -0.753763,
-    -0.75558,
-    -0.757535,
-    -0.759441,
-    -0.761118,
-    -0.762402,
-    -0.763165,
-    -0.763317,
-    -0.76282,
-    -0.761686,
-    -0.759975,
-    -0.757795,
-    -0.755287,
-    -0.752618,
-    -0.749966,
-    -0.747506,
-    -0.745397,
-    -0.743769,
-    -0.742712,
-    -0.742273,
-    -0.742447,
-    -0.743185,
-    -0.744391,
-    -0.745934,
-    -0.747658,
-    -0.749393,
-    -0.750971,
-    -0.752237,
-    -0.753062,
-    -0.75335,
-    -0.753052,
-    -0.752163,
-    -0.750723,
-    -0.748818,
-    -0.746568,
-    -0.744119,
-    -0.741632,
-    -0.73927,
-    -0.737184,
-    -0.735504,
-    -0.734325,
-    -0.733703,
-    -0.733651,
-    -0.734136,
-    -0.735083,
-    -0.736382,
-    -0.737896,
-    -0.739472,
-    -0.740953,
-    -0.742191,
-    -0.743059,
-    -0.743457,
-    -0.743326,
-    -0.742646,
-    -0.741443,
-    -0.739782,
-    -0.737763,
-    -0.735515,
-    -0.733183,
-    -0.730918,
-    -0.728864,
-    -0.727149,
-    -0.725872,
-    -0.725097,
-    -0.72485,
-    -0.725113,
-    -0.72583,
-    -0.726908,
-    -0.728229,
-    -0.729654,
-    -0.731038,
-    -0.732241,
-    -0.733135,
-    -0.733622,
-    -0.733631,
-    -0.733134,
-    -0.732139,
-    -0.730696,
-    -0.728888,
-    -0.726826,
-    -0.724641,
-    -0.722472,
-    -0.720458,
-    -0.718722,
-    -0.717367,
-    -0.716463,
-    -0.716046,
-    -0.716113,
-    -0.716623,
-    -0.7175,
-    -0.718642,
-    -0.719923,
-    -0.72121,
-    -0.72237,
-    -0.723278,
-    -0.723834,
-    -0.723962,
-    -0.723623,
-    -0.722813,
-    -0.721567,
-    -0.719951,
-    -0.718062,
-    -0.716018,
-    -0.713947,
-    -0.711979,
-    -0.710235,
-    -0.708818,
-    -0.707805,
-    -0.707241,
-    -0.707133,
-    -0.707456,
-    -0.708149,
-    -0.709122,
-    -0.710265,
-    -0.711455,
-    -0.712566,
-    -0.713477,
-    -0.714086,
-    -0.714314,
-    -0.714113,
-    -0.713468,
-    -0.7124,
-    -0.710962,
-    -0.709236,
-    -0.707327,
-    -0.705353,
-    -0.703437,
-    -0.701696,
-    -0.700233,
-    -0.699129,
-    -0.698436,
-    -0.698172,
-    -0.698325,
-    -0.698847,
-    -0.699662,
-    -0.700672,
-    -0.701764,
-    -0.70282,
-    -0.703723,
-    -0.704372,
-    -0.704683,
-    -0.704602,
-    -0.704105,
-    -0.703199,
-    -0.701925,
-    -0.700354,
-    -0.698576,
-    -0.6967,
-    -0.694841,
-    -0.693112,
-    -0.691616,
-    -0.690436,
-    -0.689631,
-    -0.689228,
-    -0.689226,
-    -0.689589,
-    -0.690254,
-    -0.691135,
-    -0.69213,
-    -0.693126,
-    -0.694012,
-    -0.694688,
-    -0.695068,
-    -0.695092,
-    -0.694726,
-    -0.693968,
-    -0.692848,
-    -0.691422,
-    -0.689771,
-    -0.687993,
-    -0.686196,
-    -0.684488,
-    -0.682971,
-    -0.681729,
-    -0.680826,
-    -0.680299,
-    -0.680155,
-    -0.68037,
-    -0.680893,
-    -0.681649,
-    -0.682546,
-    -0.683478,
-    -0.68434,
-    -0.685032,
-    -0.685467,
-    -0.685581,
-    -0.685333,
-    -0.684711,
-    -0.683733,
-    -0.682445,
-    -0.680918,
-    -0.679238,
-    -0.677507,
-    -0.675828,
-    -0.674299,
-    -0.673007,
-    -0.672021,
-    -0.671383,
-    -0.671109,
-    -0.671186,
-    -0.671575,
-    -0.67221,
-    -0.673008,
-    -0.673872,
-    -0.674702,
-    -0.675401,
-    -0.67588,
-    -0.676071,
-    -0.675928,
-    -0.675429,
-    -0.674585,
-    -0.673428,
-    -0.67202,
-    -0.670439,
-    -0.668777,
-    -0.667133,
-    -0.665602,
-    -0.664273,
-    -0.663215,
-    -0.662478,
-    -0.662086,
-    -0.662035,
-    -0.662295,
-    -0.662813,
-    -0.663512,
-    -0.664306,
-    -0.665098,
-    -0.665793,
-    -0.666305,
-    -0.666562,
-    -0.666512,
-    -0.666127,
-    -0.665406,
-    -0.664374,
-    -0.663082,
-    -0.661599,
-    -0.66001,
-    -0.658406,
-    -0.656883,
-    -0.655525,
-    -0.654407,
-    -0.653583,
-    -0.653083,
-    -0.652913,
-    -0.653051,
-    -0.653454,
-    -0.654056,
-    -0.654776,
-    -0.655524,
-    -0.656209,
-    -0.656744,
-    -0.657055,
-    -0.657087,
-    -0.656805,
-    -0.656199,
-    -0.655286,
-    -0.654106,
-    -0.652721,
-    -0.651206,
-    -0.64965,
-    -0.648141,
-    -0.646765,
-    -0.645597,
-    -0.644696,
-    -0.644098,
-    -0.643817,
-    -0.64384,
-    -0.644133,
-    -0.644637,
-    -0.645281,
-    -0.64598,
-    -0.646646,
-    -0.647195,
-    -0.647551,
-    -0.647655,
-    -0.647465,
-    -0.646967,
-    -0.646166,
-    -0.645096,
-    -0.643807,
-    -0.642369,
-    -0.640864,
-    -0.639377,
-    -0.637992,
-    -0.636784,
-    -0.635816,
-    -0.63513,
-    -0.634745,
-    -0.634659,
-    -0.634845,
-    -0.635253,
-    -0.635819,
-    -0.636464,
-    -0.637105,
-    -0.63766,
-    -0.638051,
-    -0.638217,
-    -0.638111,
-    -0.637712,
-    -0.637018,
-    -0.636052,
-    -0.634859,
-    -0.6335,
-    -0.632051,
-    -0.630591,
-    -0.629205,
-    -0.627967,
-    -0.626941,
-    -0.626175,
-    -0.625696,
-    -0.625506,
-    -0.625588,
-    -0.625901,
-    -0.626388,
-    -0.626976,
-    -0.627586,
-    -0.628138,
-    -0.628556,
-    -0.628774,
-    -0.628744,
-    -0.628436,
-    -0.627842,
-    -0.626978,
-    -0.625879,
-    -0.6246,
-    -0.62321,
-    -0.621785,
-    -0.620404,
-    -0.619144,
-    -0.61807,
-    -0.617233,
-    -0.616666,
-    -0.616379,
-    -0.616362,
-    -0.616581,
-    -0.616987,
-    -0.617514,
-    -0.618088,
-    -0.61863,
-    -0.619066,
-    -0.619329,
-    -0.619365,
-    -0.619141,
-    -0.618642,
-    -0.617875,
-    -0.616869,
-    -0.615671,
-    -0.614343,
-    -0.612957,
-    -0.611589,
-    -0.610315,
-    -0.609201,
-    -0.608301,
-    -0.607654,
-    -0.607276,
-    -0.607163,
-    -0.607291,
-    -0.607616,
-    -0.608079,
-    -0.608611,
-    -0.609137,
-    -0.609583,
-    -0.609882,
-    -0.609977,
-    -0.609829,
-    -0.609419,
-    -0.608745,
-    -0.60783,
-    -0.606713,
-    -0.60545,
-    -0.604107,
-    -0.602759,
-    -0.601478,
-    -0.600332,
-    -0.599378,
-    -0.598658,
-    -0.598194,
-    -0.59799,
-    -0.598028,
-    -0.598272,
-    -0.598669,
-    -0.599155,
-    -0.599659,
-    -0.600108,
-    -0.600435,
-    -0.600581,
-    -0.600503,
-    -0.600174,
-    -0.59959,
-    -0.598763,
-    -0.597727,
-    -0.596531,
-    -0.595237,
-    -0.593914,
-    -0.592634,
-    -0.591463,
-    -0.590462,
-    -0.589676,
-    -0.589133,
-    -0.588842,
-    -0.588793,
-    -0.588956,
-    -0.589285,
-    -0.589721,
-    -0.590197,
-    -0.590642,
-    -0.590989,
-    -0.591178,
-    -0.591163,
-    -0.590911,
-    -0.590411,
-    -0.58967,
-    -0.588715,
-    -0.587588,
-    -0.586345,
-    -0.585053,
-    -0.583779,
-    -0.582592,
-    -0.581552,
-    -0.580706,
-    -0.58009,
-    -0.579716,
-    -0.579583,
-    -0.579666,
-    -0.579925,
-    -0.580308,
-    -0.580751,
-    -0.581186,
-    -0.581546,
-    -0.581771,
-    -0.581811,
-    -0.58163,
-    -0.58121,
-    -0.580552,
-    -0.579677,
-    -0.57862,
-    -0.577432,
-    -0.576175,
-    -0.574915,
-    -0.573718,
-    -0.572645,
-    -0.571748,
-    -0.571063,
-    -0.570612,
-    -0.570397,
-    -0.570401,
-    -0.57059,
-    -0.570916,
-    -0.571321,
-    -0.57174,
-    -0.572108,
-    -0.572361,
-    -0.57245,
-    -0.572333,
-    -0.571989,
-    -0.571411,
-    -0.570614,
-    -0.569628,
-    -0.568498,
-    -0.567281,
-    -0.566039,
-    -0.564839,
-    -0.56374,
-    -0.562798,
-    -0.562052,
-    -0.561528,
-    -0.561234,
-    -0.56116,
-    -0.561278,
-    -0.561546,
-    -0.561909,
-    -0.562307,
-    -0.562674,
-    -0.56295,
-    -0.56308,
-    -0.563022,
-    -0.562748,
-    -0.562247,
-    -0.561527,
-    -0.560612,
-    -0.559542,
-    -0.558369,
-    -0.557151,
-    -0.555954,
-    -0.554837,
-    -0.553855,
-    -0.553054,
-    -0.552462,
-    -0.552093,
-    -0.551943,
-    -0.551989,
-    -0.552197,
-    -0.552514,
-    -0.552885,
-    -0.553247,
-    -0.553538,
-    -0.553704,
-    -0.553699,
-    -0.55349,
-    -0.553063,
-    -0.552418,
-    -0.551574,
-    -0.550565,
-    -0.549439,
-    -0.548251,
-    -0.547061,
-    -0.545932,
-    -0.544919,
-    -0.544067,
-    -0.543413,
-    -0.542972,
-    -0.542748,
-    -0.542724,
-    -0.542868,
-    -0.543138,
-    -0.543477,
-    -0.543828,
-    -0.544128,
-    -0.544323,
-    -0.544364,
-    -0.544216,
-    -0.543858,
-    -0.543286,
-    -0.542513,
-    -0.541568,
-    -0.540491,
-    -0.539336,
-    -0.538161,
-    -0.537026,
-    -0.535986,
-    -0.535091,
-    -0.534378,
-    -0.533871,
-    -0.533574,
-    -0.53348,
-    -0.533561,
-    -0.533779,
-    -0.534083,
-    -0.534417,
-    -0.534721,
-    -0.534939,
-    -0.535021,
-    -0.534928,
-    -0.534635,
-    -0.534134,
-    -0.533431,
-    -0.532549,
-    -0.531525,
-    -0.530407,
-    -0.529252,
-    -0.528116,
-    -0.527056,
-    -0.526124,
-    -0.525358,
-    -0.524787,
-    -0.524422,
-    -0.524258,
-    -0.524275,
-    -0.524439,
-    -0.524704,
-    -0.525016,
-    -0.525318,
-    -0.525552,
-    -0.525669,
-    -0.525626,
-    -0.525395,
-    -0.524961,
-    -0.524327,
-    -0.523509,
-    -0.52254,
-    -0.521463,
-    -0.520332,
-    -0.519201,
-    -0.518128,
-    -0.517163,
-    -0.51635,
-    -0.51572,
-    -0.515288,
-    -0.515057,
-    -0.51501,
-    -0.515118,
-    -0.51534,
-    -0.515626,
-    -0.51592,
-    -0.516165,
-    -0.516311,
-    -0.516313,
-    -0.516139,
-    -0.51577,
-    -0.515202,
-    -0.514449,
-    -0.513536,
-    -0.512504,
-    -0.511401,
-    -0.51028,
-    -0.509199,
-    -0.508208,
-    -0.507353,
-    -0.506668,
-    -0.506173,
-    -0.505875,
-    -0.505764,
-    -0.505816,
-    -0.505992,
-    -0.506247,
-    -0.506528,
-    -0.506779,
-    -0.506949,
-    -0.50699,
-    -0.506869,
-    -0.506561,
-    -0.506058,
-    -0.505369,
-    -0.504514,
-    -0.503528,
-    -0.502458,
-    -0.501353,
-    -0.500268,
-    -0.499257,
-    -0.498365,
-    -0.49763,
-    -0.497076,
-    -0.496714,
-    -0.496539,
-    -0.496532,
-    -0.496661,
-    -0.496881,
-    -0.497144,
-    -0.497395,
-    -0.497583,
-    -0.497659,
-    -0.497585,
-    -0.497335,
-    -0.496895,
-    -0.496269,
-    -0.495473,
-    -0.494536,
-    -0.493502,
-    -0.492417,
-    -0.491335,
-    -0.490308,
-    -0.489385,
-    -0.488604,
-    -0.487994,
-    -0.48757,
-    -0.487333,
-    -0.487267,
-    -0.487346,
-    -0.487529,
-    -0.487769,
-    -0.488015,
-    -0.488215,
-    -0.48832,
-    -0.488289,
-    -0.488093,
-    -0.487714,
-    -0.48715,
-    -0.486413,
-    -0.485528,
-    -0.484532,
-    -0.483472,
-    -0.482398,
-    -0.481361,
-    -0.480411,
-    -0.479589,
-    -0.478928,
-    -0.478445,
-    -0.478146,
-    -0.478021,
-    -0.478047,
-    -0.47819,
-    -0.478404,
-    -0.47864,
-    -0.478847,
-    -0.478975,
-    -0.478983,
-    -0.478837,
-    -0.478516,
-    -0.478012,
-    -0.477334,
-    -0.476502,
-    -0.475549,
-    -0.474517,
-    -0.473455,
-    -0.472414,
-    -0.471443,
-    -0.470585,
-    -0.469875,
-    -0.469336,
-    -0.468977,
-    -0.468793,
-    -0.468766,
-    -0.468865,
-    -0.469049,
-    -0.46927,
-    -0.469479,
-    -0.469626,
-    -0.469668,
-    -0.469568,
-    -0.469301,
-    -0.468857,
-    -0.468237,
-    -0.467459,
-    -0.46655,
-    -0.46555,
-    -0.464505,
-    -0.463465,
-    -0.462478,
-    -0.461589,
-    -0.460835,
-    -0.460243,
-    -0.459826,
-    -0.459584,
-    -0.459503,
-    -0.459555,
-    -0.459705,
-    -0.459908,
-    -0.460114,
-    -0.460275,
-    -0.460345,
-    -0.460286,
-    -0.460071,
-    -0.459684,
-    -0.459122,
-    -0.458399,
-    -0.457537,
-    -0.456572,
-    -0.455548,
-    -0.454513,
-    -0.453515,
-    -0.4526,
-    -0.451806,
-    -0.451165,
-    -0.450692,
-    -0.450392,
-    -0.450256,
-    -0.450261,
-    -0.450374,
-    -0.450554,
-    -0.450752,
-    -0.450921,
-    -0.451015,
-    -0.450994,
-    -0.450827,
-    -0.450494,
-    -0.44999,
-    -0.449321,
-    -0.448508,
-    -0.447582,
-    -0.446583,
-    -0.445557,
-    -0.444553,
-    -0.443616,
-    -0.442788,
-    -0.4421,
-    -0.441574,
-    -0.441218,
-    -0.441027,
-    -0.440983,
-    -0.441056,
-    -0.441208,
-    -0.441395,
-    -0.441568,
-    -0.441681,
-    -0.441693,
-    -0.44157,
-    -0.441289,
-    -0.44084,
-    -0.440226,
-    -0.439463,
-    -0.438578,
-    -0.437608,
-    -0.436596,
-    -0.435591,
-    -0.434637,
-    -0.433778,
-    -0.433048,
-    -0.432471,
-    -0.43206,
-    -0.431814,
-    -0.43172,
-    -0.431751,
-    -0.431873,
-    -0.432043,
-    -0.432215,
-    -0.432343,
-    -0.432383,
-    -0.432301,
-    -0.432069,
-    -0.431674,
-    -0.431115,
-    -0.430402,
-    -0.42956,
-    -0.428622,
-    -0.427629,
-    -0.426627,
-    -0.425661,
-    -0.424776,
-    -0.424007,
-    -0.423383,
-    -0.422919,
-    -0.422619,
-    -0.422473,
-    -0.422461,
-    -0.422549,
-    -0.422699,
-    -0.422865,
-    -0.423002,
-    -0.423066,
-    -0.42302,
-    -0.422835,
-    -0.422492,
-    -0.421987,
-    -0.421325,
-    -0.420528,
-    -0.419625,
-    -0.418654,
-    -0.41766,
-    -0.416687,
-    -0.41578,
-    -0.414977,
-    -0.414308,
-    -0.413793,
-    -0.41344,
-    -0.413242,
-    -0.413184,
-    -0.413236,
-    -0.413362,
-    -0.413518,
-    -0.41366,
-    -0.413744,
-    -0.413731,
-    -0.413588,
-    -0.413295,
-    -0.412842,
-    -0.412233,
-    -0.411482,
-    -0.410616,
-    -0.409671,
-    -0.408689,
-    -0.407714,
-    -0.406789,
-    -0.405956,
-    -0.405246,
-    -0.404682,
-    -0.404277,
-    -0.404028,
-    -0.403922,
-    -0.403936,
-    -0.404034,
-    -0.404176,
-    -0.404319,
-    -0.404418,
-    -0.404432,
-    -0.404329,
-    -0.404083,
-    -0.403682,
-    -0.403124,
-    -0.402421,
-    -0.401595,
-    -0.400679,
-    -0.399713,
-    -0.398739,
-    -0.397802,
-    -0.396942,
-    -0.396195,
-    -0.395586,
-    -0.395129,
-    -0.394829,
-    -0.394676,
-    -0.394648,
-    -0.394716,
-    -0.39484,
-    -0.394979,
-    -0.395088,
-    -0.395126,
-    -0.395059,
-    -0.394858,
-    -0.394506,
-    -0.393999,
-    -0.393344,
-    -0.392561,
-    -0.391677,
-    -0.390731,
-    -0.389763,
-    -0.388817,
-    -0.387936,
-    -0.387155,
-    -0.386502,
-    -0.385997,
-    -0.385646,
-    -0.385444,
-    -0.385374,
-    -0.385408,
-    -0.38551,
-    -0.385641,
-    -0.385756,
-    -0.385815,
-    -0.385779,
-    -0.385619,
-    -0.385315,
-    -0.384859,
-    -0.384253,
-    -0.383513,
-    -0.382664,
-    -0.381741,
-    -0.380783,
-    -0.379834,
-    -0.378935,
-    -0.378124,
-    -0.377431,
-    -0.37688,
-    -0.376479,
-    -0.376228,
-    -0.376113,
-    -0.376111,
-    -0.376188,
-    -0.376307,
-    -0.376424,
-    -0.376498,
-    -0.37649,
-    -0.376369,
-    -0.376111,
-    -0.375703,
-    -0.375146,
-    -0.374451,
-    -0.373639,
-    -0.372743,
-    -0.3718,
-    -0.370851,
-    -0.369938,
-    -0.369101,
-    -0.368372,
-    -0.367776,
-    -0.367326,
-    -0.367026,
-    -0.366866,
-    -0.366826,
-    -0.366875,
-    -0.366978,
-    -0.367093,
-    -0.367178,
-    -0.367194,
-    -0.367108,
-    -0.366892,
-    -0.366533,
-    -0.366024,
-    -0.365375,
-    -0.364603,
-    -0.363736,
-    -0.36281,
-    -0.361866,
-    -0.360944,
-    -0.360085,
-    -0.359323,
-    -0.358685,
-    -0.358189,
-    -0.35784,
-    -0.357634,
-    -0.357553,
-    -0.357572,
-    -0.357655,
-    -0.357763,
-    -0.357855,
-    -0.357892,
-    -0.357836,
-    -0.357662,
-    -0.357348,
-    -0.356888,
-    -0.356285,
-    -0.355554,
-    -0.354719,
-    -0.353815,
-    -0.352879,
-    -0.351952,
-    -0.351075,
-    -0.350283,
-    -0.349606,
-    -0.349065,
-    -0.348669,
-    -0.348416,
-    -0.348294,
-    -0.348278,
-    -0.348338,
-    -0.348436,
-    -0.348531,
-    -0.348584,
-    -0.348556,
-    -0.348419,
-    -0.348149,
-    -0.347737,
-    -0.34718,
-    -0.346491,
-    -0.345692,
-    -0.344812,
-    -0.343888,
-    -0.342961,
-    -0.342069,
-    -0.341252,
-    -0.340539,
-    -0.339955,
-    -0.339512,
-    -0.339212,
-    -0.339047,
-    -0.338996,
-    -0.339029,
-    -0.339113,
-    -0.339207,
-    -0.339272,
-    -0.339268,
-    -0.339165,
-    -0.338938,
-    -0.338571,
-    -0.338061,
-    -0.337416,
-    -0.336653,
-    -0.335801,
-    -0.334893,
-    -0.333969,
-    -0.333067,
-    -0.332227,
-    -0.331482,
-    -0.330857,
-    -0.330369,
-    -0.330023,
-    -0.329814,
-    -0.329724,
-    -0.329729,
-    -0.329795,
-    -0.329884,
-    -0.329957,
-    -0.329974,
-    -0.329902,
-    -0.329713,
-    -0.329391,
-    -0.328928,
-    -0.328327,
-    -0.327603,
-    -0.326781,
-    -0.325893,
-    -0.324975,
-    -0.324068,
-    -0.32321,
-    -0.322435,
-    -0.321772,
-    -0.32124,
-    -0.320848,
-    -0.320594,
-    -0.320465,
-    -0.320439,
-    -0.320484,
-    -0.320564,
-    -0.32064,
-    -0.320673,
-    -0.320629,
-    -0.320477,
-    -0.320198,
-    -0.31978,
-    -0.319224,
-    -0.318541,
-    -0.317751,
-    -0.316886,
-    -0.315979,
-    -0.31507,
-    -0.314197,
-    -0.313396,
-    -0.312698,
-    -0.312124,
-    -0.311687,
-    -0.311389,
-    -0.311219,
-    -0.311158,
-    -0.311179,
-    -0.311246,
-    -0.311323,
-    -0.311369,
-    -0.311348,
-    -0.311231,
-    -0.310992,
-    -0.310618,
-    -0.310107,
-    -0.309465,
-    -0.308711,
-    -0.307871,
-    -0.306979,
-    -0.306071,
-    -0.305188,
-    -0.304365,
-    -0.303635,
-    -0.303021,
-    -0.30254,
-    -0.302197,
-    -0.301985,
-    -0.301888,
-    -0.301882,
-    -0.301933,
-    -0.302006,
-    -0.30206,
-    -0.302061,
-    -0.301974,
-    -0.301773,
-    -0.301443,
-    -0.300976,
-    -0.300377,
-    -0.29966,
-    -0.298848,
-    -0.297974,
-    -0.297072,
-    -0.296182,
-    -0.29534,
-    -0.294581,
-    -0.29393,
-    -0.293407,
-    -0.293019,
-    -0.292764,
-    -0.29263,
-    -0.292594,
-    -0.292626,
-    -0.29269,
-    -0.29275,
-    -0.292767,
-    -0.292708,
-    -0.292543,
-    -0.292255,
-    -0.291832,
-    -0.291276,
-    -0.290597,
-    -0.289816,
-    -0.288963,
-    -0.288071,
-    -0.287178,
-    -0.286321,
-    -0.285536,
-    -0.28485,
-    -0.284286,
-    -0.283854,
-    -0.283557,
-    -0.283383,
-    -0.283315,
-    -0.283324,
-    -0.283378,
-    -0.283438,
-    -0.283469,
-    -0.283433,
-    -0.283302,
-    -0.283054,
-    -0.282674,
-    -0.282161,
-    -0.281522,
-    -0.280775,
-    -0.279945,
-    -0.279066,
-    -0.278174,
-    -0.277306,
-    -0.276498,
-    -0.275781,
-    -0.275178,
-    -0.274704,
-    -0.274363,
-    -0.274149,
-    -0.274046,
-    -0.27403,
-    -0.274069,
-    -0.274127,
-    -0.274166,
-    -0.274152,
-    -0.274051,
-    -0.273841,
-    -0.273503,
-    -0.273033,
-    -0.272435,
-    -0.271723,
-    -0.27092,
-    -0.270057,
-    -0.26917,
-    -0.268294,
-    -0.267467,
-    -0.266721,
-    -0.266081,
-    -0.265566,
-    -0.265182,
-    -0.264927,
-    -0.264788,
-    -0.264744,
-    -0.264765,
-    -0.264816,
-    -0.264861,
-    -0.264864,
-    -0.264791,
-    -0.264616,
-    -0.264319,
-    -0.263892,
-    -0.263335,
-    -0.26266,
-    -0.261886,
-    -0.261043,
-    -0.260164,
-    -0.259285,
-    -0.258442,
-    -0.25767,
-    -0.256996,
-    -0.256441,
-    -0.256014,
-    -0.255718,
-    -0.255541,
-    -0.255467,
-    -0.255466,
-    -0.255508,
-    -0.255555,
-    -0.255571,
-    -0.255523,
-    -0.25538,
-    -0.255123,
-    -0.254738,
-    -0.254223,
-    -0.253585,
-    -0.252844,
-    -0.252023,
-    -0.251155,
-    -0.250276,
-    -0.249422,
-    -0.248627,
-    -0.247922,
-    -0.247328,
-    -0.24686,
-    -0.246521,
-    -0.246306,
-    -0.246199,
-    -0.246175,
-    -0.246203,
-    -0.246248,
-    -0.246274,
-    -0.246247,
-    -0.246135,
-    -0.245914,
-    -0.24557,
-    -0.245097,
-    -0.244499,
-    -0.243791,
-    -0.242996,
-    -0.242143,
-    -0.241268,
-    -0.240405,
-    -0.239591,
-    -0.238857,
-    -0.238227,
-    -0.237718,
-    -0.237338,
-    -0.237083,
-    -0.236941,
-    -0.23689,
-    -0.236902,
-    -0.236941,
-    -0.236974,
-    -0.236964,
-    -0.236879,
-    -0.236694,
-    -0.23639,
-    -0.235959,
-    -0.235401,
-    -0.234728,
-    -0.233961,
-    -0.233126,
-    -0.232258,
-    -0.231391,
-    -0.230561,
-    -0.229801,
-    -0.229137,
-    -0.228589,
-    -0.228167,
-    -0.227872,
-    -0.227694,
-    -0.227614,
-    -0.227606,
-    -0.227637,
-    -0.227672,
-    -0.227676,
-    -0.227616,
-    -0.227463,
-    -0.227198,
-    -0.226807,
-    -0.22629,
-    -0.225654,
-    -0.224917,
-    -0.224104,
-    -0.223246,
-    -0.222378,
-    -0.221536,
-    -0.220753,
-    -0.220057,
-    -0.219472,
-    -0.219009,
-    -0.218673,
-    -0.218458,
-    -0.218347,
-    -0.218316,
-    -0.218335,
-    -0.218369,
-    -0.218384,
-    -0.218345,
-    -0.218222,
-    -0.217993,
-    -0.217643,
-    -0.217167,
-    -0.216569,
-    -0.215864,
-    -0.215075,
-    -0.214231,
-    -0.213366,
-    -0.212515,
-    -0.211712,
-    -0.210988,
-    -0.210366,
-    -0.209864,
-    -0.209487,
-    -0.209233,
-    -0.209089,
-    -0.209033,
-    -0.209036,
-    -0.209066,
-    -0.209088,
-    -0.209067,
-    -0.208972,
-    -0.208778,
-    -0.208467,
-    -0.208031,
-    -0.207472,
-    -0.206802,
-    -0.206039,
-    -0.205212,
-    -0.204353,
-    -0.203496,
-    -0.202677,
-    -0.201927,
-    -0.201272,
-    -0.200731,
-    -0.200314,
-    -0.200021,
-    -0.199841,
-    -0.199757,
-    -0.199742,
-    -0.199764,
-    -0.19979,
-    -0.199783,
-    -0.199713,
-    -0.199551,
-    -0.199278,
-    -0.198883,
-    -0.198364,
-    -0.197729,
-    -0.196995,
-    -0.196188,
-    -0.195338,
-    -0.19448,
-    -0.193648,
-    -0.192874,
-    -0.192188,
-    -0.19161,
-    -0.191153,
-    -0.19082,
-    -0.190604,
-    -0.19049,
-    -0.190454,
-    -0.190465,
-    -0.19049,
-    -0.190495,
-    -0.190446,
-    -0.190314,
-    -0.190078,
-    -0.189722,
-    -0.189243,
-    -0.188644,
-    -0.187942,
-    -0.187158,
-    -0.186321,
-    -0.185464,
-    -0.184622,
-    -0.183829,
-    -0.183114,
-    -0.182501,
-    -0.182005,
-    -0.181632,
-    -0.181379,
-    -0.181232,
-    -0.181172,
-    -0.181169,
-    -0.181191,
-    -0.181203,
-    -0.181172,
-    -0.181068,
-    -0.180866,
-    -0.180549,
-    -0.180109,
-    -0.179549,
-    -0.178879,
-    -0.178121,
-    -0.1773,
-    -0.176448,
-    -0.1756,
-    -0.174791,
-    -0.17405,
-    -0.173403,
-    -0.172868,
-    -0.172456,
-    -0.172164,
-    -0.171984,
-    -0.171897,
-    -0.171876,
-    -0.171892,
-    -0.171908,
-    -0.171893,
-    -0.171813,
-    -0.171643,
-    -0.171364,
-    -0.170964,
-    -0.170442,
-    -0.169807,
-    -0.169076,
-    -0.168274,
-    -0.167431,
-    -0.166581,
-    -0.165757,
-    -0.164993,
-    -0.164315,
-    -0.163744,
-    -0.163292,
-    -0.162962,
-    -0.162746,
-    -0.16263,
-    -0.162589,
-    -0.162594,
-    -0.162612,
-    -0.162608,
-    -0.16255,
-    -0.162411,
-    -0.162167,
-    -0.161806,
-    -0.161323,
-    -0.160724,
-    -0.160023,
-    -0.159243,
-    -0.158411,
-    -0.157562,
-    -0.156729,
-    -0.155944,
-    -0.155237,
-    -0.154631,
-    -0.154141,
-    -0.153771,
-    -0.153519,
-    -0.153372,
-    -0.153308,
-    -0.1533,
-    -0.153315,
-    -0.153319,
-    -0.15328,
-    -0.153168,
-    -0.152959,
-    -0.152636,
-    -0.152192,
-    -0.15163,
-    -0.150961,
-    -0.150205,
-    -0.149389,
-    -0.148544,
-    -0.147704,
-    -0.146902,
-    -0.146169,
-    -0.145529,
-    -0.145001,
-    -0.144593,
-    -0.144303,
-    -0.144123,
-    -0.144034,
-    -0.144009,
-    -0.144018,
-    -0.144028,
-    -0.144004,
-    -0.143917,
-    -0.14374,
-    -0.143454,
-    -0.143049,
-    -0.142525,
-    -0.14189,
-    -0.141161,
-    -0.140362,
-    -0.139525,
-    -0.138681,
-    -0.137865,
-    -0.137109,
-    -0.136438,
-    -0.135873,
-    -0.135426,
-    -0.135099,
-    -0.134884,
-    -0.134767,
-    -0.134723,
-    -0.134722,
-    -0.134734,
-    -0.134723,
-    -0.134657,
-    -0.13451,
-    -0.13426,
-    -0.133894,
-    -0.133408,
-    -0.132808,
-    -0.132108,
-    -0.13133,
-    -0.130504,
-    -0.12966,
-    -0.128834,
-    -0.128057,
-    -0.127357,
-    -0.126757,
-    -0.126272,
-    -0.125906,
-    -0.125656,
-    -0.125508,
-    -0.125442,
-    -0.125429,
-    -0.125439,
-    -0.125437,
-    -0.125391,
-    -0.125271,
-    -0.125056,
-    -0.124727,
-    -0.12428,
-    -0.123716,
-    -0.123047,
-    -0.122292,
-    -0.12148,
-    -0.12064,
-    -0.119806,
-    -0.119011,
-    -0.118285,
-    -0.117652,
-    -0.117129,
-    -0.116725,
-    -0.116438,
-    -0.116258,
-    -0.116167,
-    -0.116139,
-    -0.116144,
-    -0.116148,
-    -0.116118,
-    -0.116024,
-    -0.11584,
-    -0.115548,
-    -0.11514,
-    -0.114613,
-    -0.113976,
-    -0.113248,
-    -0.112452,
-    -0.111619,
-    -0.110781,
-    -0.109972,
-    -0.109222,
-    -0.108557,
-    -0.107998,
-    -0.107556,
-    -0.107231,
-    -0.107018,
-    -0.1069,
-    -0.106854,
-    -0.10685,
-    -0.106856,
-    -0.106839,
-    -0.106767,
-    -0.106614,
-    -0.106358,
-    -0.105987,
-    -0.105498,
-    -0.104896,
-    -0.104196,
-    -0.10342,
-    -0.102597,
-    -0.101758,
-    -0.100937,
-    -0.100166,
-    -0.099473,
-    -0.098879,
-    -0.0983985,
-    -0.0980363,
-    -0.0977882,
-    -0.0976409,
-    -0.0975733,
-    -0.0975578,
-    -0.097563,
-    -0.0975556,
-    -0.0975035,
-    -0.097378,
-    -0.0971563,
-    -0.096823,
-    -0.0963717,
-    -0.0958052,
-    -0.0951353,
-    -0.094382,
-    -0.0935719,
-    -0.0927359,
-    -0.0919072,
-    -0.0911181,
-    -0.090398,
-    -0.0897708,
-    -0.0892531,
-    -0.0888528,
-    -0.0885686,
-    -0.0883902,
-    -0.0882987,
-    -0.0882687,
-    -0.0882696,
-    -0.0882686,
-    -0.0882331,
-    -0.0881331,
-    -0.0879437,
-    -0.0876471,
-    -0.0872339,
-    -0.0867039,
-    -0.086066,
-    -0.0853378,
-    -0.0845438,
-    -0.0837138,
-    -0.0828802,
-    -0.0820761,
-    -0.0813318,
-    -0.0806732,
-    -0.0801194,
-    -0.0796811,
-    -0.07936,
-    -0.0791487,
-    -0.079031,
-    -0.0789833,
-    -0.0789767,
-    -0.0789788,
-    -0.0789568,
-    -0.0788797,
-    -0.0787206,
-    -0.0784596,
-    -0.0780842,
-    -0.0775914,
-    -0.0769872,
-    -0.0762864,
-    -0.0755114,
-    -0.0746905,
-    -0.0738555,
-    -0.0730394,
-    -0.0722737,
-    -0.0715858,
-    -0.0709971,
-    -0.0705212,
-    -0.0701627,
-    -0.069917,
-    -0.0697708,
-    -0.0697027,
-    -0.0696853,
-    -0.0696873,
-    -0.0696756,
-    -0.0696185,
-    -0.0694877,
-    -0.0692608,
-    -0.0689228,
-    -0.0684676,
-    -0.0678984,
-    -0.0672271,
-    -0.0664739,
-    -0.0656652,
-    -0.0648321,
-    -0.0640073,
-    -0.0632229,
-    -0.062508,
-    -0.061886,
-    -0.061373,
-    -0.0609768,
-    -0.0606956,
-    -0.0605189,
-    -0.0604277,
-    -0.0603965,
-    -0.060395,
-    -0.0603904,
-    -0.0603505,
-    -0.0602455,
-    -0.060051,
-    -0.0597496,
-    -0.0593322,
-    -0.058799,
-    -0.0581591,
-    -0.0574302,
-    -0.056637,
-    -0.055809,
-    -0.0549787,
-    -0.0541787,
-    -0.0534392,
-    -0.0527855,
-    -0.0522365,
-    -0.0518025,
-    -0.0514849,
-    -0.0512759,
-    -0.0511592,
-    -0.0511112,
-    -0.0511029,
-    -0.0511022,
-    -0.0510763,
-    -0.0509946,
-    -0.0508308,
-    -0.0505649,
-    -0.0501852,
-    -0.0496888,
-    -0.049082,
-    -0.0483798,
-    -0.0476048,
-    -0.0467851,
-    -0.0459526,
-    -0.0451401,
-    -0.0443786,
-    -0.0436954,
-    -0.0431115,
-    -0.04264,
-    -0.0422853,
-    -0.0420425,
-    -0.0418979,
-    -0.0418303,
-    -0.041812,
-    -0.0418118,
-    -0.041797,
-    -0.0417358,
-    -0.0416005,
-    -0.0413689,
-    -0.0410264,
-    -0.0405673,
-    -0.039995,
-    -0.0393217,
-    -0.0385677,
-    -0.0377596,
-    -0.0369282,
-    -0.0361063,
-    -0.0353256,
-    -0.034615,
-    -0.0339976,
-    -0.0334891,
-    -0.0330969,
-    -0.0328191,
-    -0.0326446,
-    -0.0325546,
-    -0.0325233,
-    -0.0325203,
-    -0.0325133,
-    -0.0324699,
-    -0.0323608,
-    -0.0321619,
-    -0.031856,
-    -0.0314344,
-    -0.0308977,
-    -0.0302553,
-    -0.0295249,
-    -0.0287314,
-    -0.0279044,
-    -0.0270763,
-    -0.0262794,
-    -0.0255438,
-    -0.0248945,
-    -0.0243499,
-    -0.0239201,
-    -0.0236062,
-    -0.0234,
-    -0.0232851,
-    -0.0232377,
-    -0.0232287,
-    -0.0232262,
-    -0.0231975,
-    -0.0231122,
-    -0.0229442,
-    -0.022674,
-    -0.02229,
-    -0.0217898,
-    -0.0211799,
-    -0.0204756,
-    -0.0196997,
-    -0.0188803,
-    -0.0180492,
-    -0.0172392,
-    -0.016481,
-    -0.0158018,
-    -0.0152222,
-    -0.0147549,
-    -0.0144041,
-    -0.0141646,
-    -0.0140225,
-    -0.0139561,
-    -0.0139379,
-    -0.0139367,
-    -0.0139197,
-    -0.0138555,
-    -0.0137164,
-    -0.0134806,
-    -0.0131339,
-    -0.0126708,
-    -0.012095,
-    -0.011419,
-    -0.0106634,
-    -0.00985481,
-    -0.00902413,
-    -0.00820397,
-    -0.00742612,
-    -0.00671906,
-    -0.00610566,
-    -0.00560144,
-    -0.00521332,
-    -0.00493909,
-    -0.00476756,
-    -0.00467946,
-    -0.00464898,
-    -0.00464573,
-    -0.00463721,
-    -0.00459134,
-    -0.00447894,
-    -0.00427612,
-    -0.00396606,
-    -0.00354041,
-    -0.00299992,
-    -0.00235435,
-    -0.00162176,
-    -0.000827046,
-    0,
-    0.000827046,
-    0.00162176,
-    0.00235435,
-    0.00299992,
-    0.00354041,
-    0.00396606,
-    0.00427612,
-    0.00447894,
-    0.00459134,
-    0.00463721,
-    0.00464573,
-    0.00464898,
-    0.00467946,
-    0.00476756,
-    0.00493909,
-    0.00521332,
-    0.00560144,
-    0.00610566,
-    0.00671906,
-    0.00742612,
-    0.00820397,
-    0.00902413,
-    0.00985481,
-    0.0106634,
-    0.011419,
-    0.012095,
-    0.0126708,
-    0.0131339,
-    0.0134806,
-    0.0137164,
-    0.0138555,
-    0.0139197,
-    0.0139367,
-    0.0139379,
-    0.0139561,
-    0.0140225,
-    0.0141646,
-    0.0144041,
-    0.0147549,
-    0.0152222,
-    0.0158018,
-    0.016481,
-    0.0172392,
-    0.0180492,
-    0.0188803,
-    0.0196997,
-    0.0204756,
-    0.0211799,
-    0.0217898,
-    0.02229,
-    0.022674,
-    0.0229442,
-    0.0231122,
-    0.0231975,
-    0.0232262,
-    0.0232287,
-    0.0232377,
-    0.0232851,
-    0.0234,
-    0.0236062,
-    0.0239201,
-    0.0243499,
-    0.0248945,
-    0.0255438,
-    0.0262794,
-    0.0270763,
-    0.0279044,
-    0.0287314,
-    0.0295249,
-    0.0302553,
-    0.0308977,
-    0.0314344,
-    0.031856,
-    0.0321619,
-    0.0323608,
-    0.0324699,
-    0.0325133,
-    0.0325203,
-    0.0325233,
-    0.0325546,
-    0.0326446,
-    0.0328191,
-    0.0330969,
-    0.0334891,
-    0.0339976,
-    0.034615,
-    0.0353256,
-    0.0361063,
-    0.0369282,
-    0.0377596,
-    0.0385677,
-    0.0393217,
-    0.039995,
-    0.0405673,
-    0.0410264,
-    0.0413689,
-    0.0416005,
-    0.0417358,
-    0.041797,
-    0.0418118,
-    0.041812,
-    0.0418303,
-    0.0418979,
-    0.0420425,
-    0.0422853,
-    0.04264,
-    0.0431115,
-    0.0436954,
-    0.0443786,
-    0.0451401,
-    0.0459526,
-    0.0467851,
-    0.0476048,
-    0.0483798,
-    0.049082,
-    0.0496888,
-    0.0501852,
-    0.0505649,
-    0.0508308,
-    0.0509946,
-    0.0510763,
-    0.0511022,
-    0.0511029,
-    0.0511112,
-    0.0511592,
-    0.0512759,
-    0.0514849,
-    0.0518025,
-    0.0522365,
-    0.0527855,
-    0.0534392,
-    0.0541787,
-    0.0549787,
-    0.055809,
-    0.056637,
-    0.0574302,
-    0.0581591,
-    0.058799,
-    0.0593322,
-    0.0597496,
-    0.060051,
-    0.0602455,
-    0.0603505,
-    0.0603904,
-    0.060395,
-    0.0603965,
-    0.0604277,
-    0.0605189,
-    0.0606956,
-    0.0609768,
-    0.061373,
-    0.061886,
-    0.062508,
-    0.0632229,
-    0.0640073,
-    0.0648321,
-    0.0656652,
-    0.0664739,
-    0.0672271,
-    0.0678984,
-    0.0684676,
-    0.0689228,
-    0.0692608,
-    0.0694877,
-    0.0696185,
-    0.0696756,
-    0.0696873,
-    0.0696853,
-    0.0697027,
-    0.0697708,
-    0.069917,
-    0.0701627,
-    0.0705212,
-    0.0709971,
-    0.0715858,
-    0.0722737,
-    0.0730394,
-    0.0738555,
-    0.0746905,
-    0.0755114,
-    0.0762864,
-    0.0769872,
-    0.0775914,
-    0.0780842,
-    0.0784596,
-    0.0787206,
-    0.0788797,
-    0.0789568,
-    0.0789788,
-    0.0789767,
-    0.0789833,
-    0.079031,
-    0.0791487,
-    0.07936,
-    0.0796811,
-    0.0801194,
-    0.0806732,
-    0.0813318,
-    0.0820761,
-    0.0828802,
-    0.0837138,
-    0.0845438,
-    0.0853378,
-    0.086066,
-    0.0867039,
-    0.0872339,
-    0.0876471,
-    0.0879437,
-    0.0881331,
-    0.0882331,
-    0.0882686,
-    0.0882696,
-    0.0882687,
-    0.0882987,
-    0.0883902,
-    0.0885686,
-    0.0888528,
-    0.0892531,
-    0.0897708,
-    0.090398,
-    0.0911181,
-    0.0919072,
-    0.0927359,
-    0.0935719,
-    0.094382,
-    0.0951353,
-    0.0958052,
-    0.0963717,
-    0.096823,
-    0.0971563,
-    0.097378,
-    0.0975035,
-    0.0975556,
-    0.097563,
-    0.0975578,
-    0.0975733,
-    0.0976409,
-    0.0977882,
-    0.0980363,
-    0.0983985,
-    0.098879,
-    0.099473,
-    0.100166,
-    0.100937,
-    0.101758,
-    0.102597,
-    0.10342,
-    0.104196,
-    0.104896,
-    0.105498,
-    0.105987,
-    0.106358,
-    0.106614,
-    0.106767,
-    0.106839,
-    0.106856,
-    0.10685,
-    0.106854,
-    0.1069,
-    0.107018,
-    0.107231,
-    0.107556,
-    0.107998,
-    0.108557,
-    0.109222,
-    0.109972,
-    0.110781,
-    0.111619,
-    0.112452,
-    0.113248,
-    0.113976,
-    0.114613,
-    0.11514,
-    0.115548,
-    0.11584,
-    0.116024,
-    0.116118,
-    0.116148,
-    0.116144,
-    0.116139,
-    0.116167,
-    0.116258,
-    0.116438,
-    0.116725,
-    0.117129,
-    0.117652,
-    0.118285,
-    0.119011,
-    0.119806,
-    0.12064,
-    0.12148,
-    0.122292,
-    0.123047,
-    0.123716,
-    0.12428,
-    0.124727,
-    0.125056,
-    0.125271,
-    0.125391,
-    0.125437,
-    0.125439,
-    0.125429,
-    0.125442,
-    0.125508,
-    0.125656,
-    0.125906,
-    0.126272,
-    0.126757,
-    0.127357,
-    0.128057,
-    0.128834,
-    0.12966,
-    0.130504,
-    0.13133,
-    0.132108,
-    0.132808,
-    0.133408,
-    0.133894,
-    0.13426,
-    0.13451,
-    0.134657,
-    0.134723,
-    0.134734,
-    0.134722,
-    0.134723,
-    0.134767,
-    0.134884,
-    0.135099,
-    0.135426,
-    0.135873,
-    0.136438,
-    0.137109,
-    0.137865,
-    0.138681,
-    0.139525,
-    0.140362,
-    0.141161,
-    0.14189,
-    0.142525,
-    0.143049,
-    0.143454,
-    0.14374,
-    0.143917,
-    0.144004,
-    0.144028,
-    0.144018,
-    0.144009,
-    0.144034,
-    0.144123,
-    0.144303,
-    0.144593,
-    0.145001,
-    0.145529,
-    0.146169,
-    0.146902,
-    0.147704,
-    0.148544,
-    0.149389,
-    0.150205,
-    0.150961,
-    0.15163,
-    0.152192,
-    0.152636,
-    0.152959,
-    0.153168,
-    0.15328,
-    0.153319,
-    0.153315,
-    0.1533,
-    0.153308,
-    0.153372,
-    0.153519,
-    0.153771,
-    0.154141,
-    0.154631,
-    0.155237,
-    0.155944,
-    0.156729,
-    0.157562,
-    0.158411,
-    0.159243,
-    0.160023,
-    0.160724,
-    0.161323,
-    0.161806,
-    0.162167,
-    0.162411,
-    0.16255,
-    0.162608,
-    0.162612,
-    0.162594,
-    0.162589,
-    0.16263,
-    0.162746,
-    0.162962,
-    0.163292,
-    0.163744,
-    0.164315,
-    0.164993,
-    0.165757,
-    0.166581,
-    0.167431,
-    0.168274,
-    0.169076,
-    0.169807,
-    0.170442,
-    0.170964,
-    0.171364,
-    0.171643,
-    0.171813,
-    0.171893,
-    0.171908,
-    0.171892,
-    0.171876,
-    0.171897,
-    0.171984,
-    0.172164,
-    0.172456,
-    0.172868,
-    0.173403,
-    0.17405,
-    0.174791,
-    0.1756,
-    0.176448,
-    0.1773,
-    0.178121,
-    0.178879,
-    0.179549,
-    0.180109,
-    0.180549,
-    0.180866,
-    0.181068,
-    0.181172,
-    0.181203,
-    0.181191,
-    0.181169,
-    0.181172,
-    0.181232,
-    0.181379,
-    0.181632,
-    0.182005,
-    0.182501,
-    0.183114,
-    0.183829,
-    0.184622,
-    0.185464,
-    0.186321,
-    0.187158,
-    0.187942,
-    0.188644,
-    0.189243,
-    0.189722,
-    0.190078,
-    0.190314,
-    0.190446,
-    0.190495,
-    0.19049,
-    0.190465,
-    0.190454,
-    0.19049,
-    0.190604,
-    0.19082,
-    0.191153,
-    0.19161,
-    0.192188,
-    0.192874,
-    0.193648,
-    0.19448,
-    0.195338,
-    0.196188,
-    0.196995,
-    0.197729,
-    0.198364,
-    0.198883,
-    0.199278,
-    0.199551,
-    0.199713,
-    0.199783,
-    0.19979,
-    0.199764,
-    0.199742,
-    0.199757,
-    0.199841,
-    0.200021,
-    0.200314,
-    0.200731,
-    0.201272,
-    0.201927,
-    0.202677,
-    0.203496,
-    0.204353,
-    0.205212,
-    0.206039,
-    0.206802,
-    0.207472,
-    0.208031,
-    0.208467,
-    0.208778,
-    0.208972,
-    0.209067,
-    0.209088,
-    0.209066,
-    0.209036,
-    0.209033,
-    0.209089,
-    0.209233,
-    0.209487,
-    0.209864,
-    0.210366,
-    0.210988,
-    0.211712,
-    0.212515,
-    0.213366,
-    0.214231,
-    0.215075,
-    0.215864,
-    0.216569,
-    0.217167,
-    0.217643,
-    0.217993,
-    0.218222,
-    0.218345,
-    0.218384,
-    0.218369,
-    0.218335,
-    0.218316,
-    0.218347,
-    0.218458,
-    0.218673,
-    0.219009,
-    0.219472,
-    0.220057,
-    0.220753,
-    0.221536,
-    0.222378,
-    0.223246,
-    0.224104,
-    0.224917,
-    0.225654,
-    0.22629,
-    0.226807,
-    0.227198,
-    0.227463,
-    0.227616,
-    0.227676,
-    0.227672,
-    0.227637,
-    0.227606,
-    0.227614,
-    0.227694,
-    0.227872,
-    0.228167,
-    0.228589,
-    0.229137,
-    0.229801,
-    0.230561,
-    0.231391,
-    0.232258,
-    0.233126,
-    0.233961,
-    0.234728,
-    0.235401,
-    0.235959,
-    0.23639,
-    0.236694,
-    0.236879,
-    0.236964,
-    0.236974,
-    0.236941,
-    0.236902,
-    0.23689,
-    0.236941,
-    0.237083,
-    0.237338,
-    0.237718,
-    0.238227,
-    0.238857,
-    0.239591,
-    0.240405,
-    0.241268,
-    0.242143,
-    0.242996,
-    0.243791,
-    0.244499,
-    0.245097,
-    0.24557,
-    0.245914,
-    0.246135,
-    0.246247,
-    0.246274,
-    0.246248,
-    0.246203,
-    0.246175,
-    0.246199,
-    0.246306,
-    0.246521,
-    0.24686,
-    0.247328,
-    0.247922,
-    0.248627,
-    0.249422,
-    0.250276,
-    0.251155,
-    0.252023,
-    0.252844,
-    0.253585,
-    0.254223,
-    0.254738,
-    0.255123,
-    0.25538,
-    0.255523,
-    0.255571,
-    0.255555,
-    0.255508,
-    0.255466,
-    0.255467,
-    0.255541,
-    0.255718,
-    0.256014,
-    0.256441,
-    0.256996,
-    0.25767,
-    0.258442,
-    0.259285,
-    0.260164,
-    0.261043,
-    0.261886,
-    0.26266,
-    0.263335,
-    0.263892,
-    0.264319,
-    0.264616,
-    0.264791,
-    0.264864,
-    0.264861,
-    0.264816,
-    0.264765,
-    0.264744,
-    0.264788,
-    0.264927,
-    0.265182,
-    0.265566,
-    0.266081,
-    0.266721,
-    0.267467,
-    0.268294,
-    0.26917,
-    0.270057,
-    0.27092,
-    0.271723,
-    0.272435,
-    0.273033,
-    0.273503,
-    0.273841,
-    0.274051,
-    0.274152,
-    0.274166,
-    0.274127,
-    0.274069,
-    0.27403,
-    0.274046,
-    0.274149,
-    0.274363,
-    0.274704,
-    0.275178,
-    0.275781,
-    0.276498,
-    0.277306,
-    0.278174,
-    0.279066,
-    0.279945,
-    0.280775,
-    0.281522,
-    0.282161,
-    0.282674,
-    0.283054,
-    0.283302,
-    0.283433,
-    0.283469,
-    0.283438,
-    0.283378,
-    0.283324,
-    0.283315,
-    0.283383,
-    0.283557,
-    0.283854,
-    0.284286,
-    0.28485,
-    0.285536,
-    0.286321,
-    0.287178,
-    0.288071,
-    0.288963,
-    0.289816,
-    0.290597,
-    0.291276,
-    0.291832,
-    0.292255,
-    0.292543,
-    0.292708,
-    0.292767,
-    0.29275,
-    0.29269,
-    0.292626,
-    0.292594,
-    0.29263,
-    0.292764,
-    0.293019,
-    0.293407,
-    0.29393,
-    0.294581,
-    0.29534,
-    0.296182,
-    0.297072,
-    0.297974,
-    0.298848,
-    0.29966,
-    0.300377,
-    0.300976,
-    0.301443,
-    0.301773,
-    0.301974,
-    0.302061,
-    0.30206,
-    0.302006,
-    0.301933,
-    0.301882,
-    0.301888,
-    0.301985,
-    0.302197,
-    0.30254,
-    0.303021,
-    0.303635,
-    0.304365,
-    0.305188,
-    0.306071,
-    0.306979,
-    0.307871,
-    0.308711,
-    0.309465,
-    0.310107,
-    0.310618,
-    0.310992,
-    0.311231,
-    0.311348,
-    0.311369,
-    0.311323,
-    0.311246,
-    0.311179,
-    0.311158,
-    0.311219,
-    0.311389,
-    0.311687,
-    0.312124,
-    0.312698,
-    0.313396,
-    0.314197,
-    0.31507,
-    0.315979,
-    0.316886,
-    0.317751,
-    0.318541,
-    0.319224,
-    0.31978,
-    0.320198,
-    0.320477,
-    0.320629,
-    0.320673,
-    0.32064,
-    0.320564,
-    0.320484,
-    0.320439,
-    0.320465,
-    0.320594,
-    0.320848,
-    0.32124,
-    0.321772,
-    0.322435,
-    0.32321,
-    0.324068,
-    0.324975,
-    0.325893,
-    0.326781,
-    0.327603,
-    0.328327,
-    0.328928,
-    0.329391,
-    0.329713,
-    0.329902,
-    0.329974,
-    0.329957,
-    0.329884,
-    0.329795,
-    0.329729,
-    0.329724,
-    0.329814,
-    0.330023,
-    0.330369,
-    0.330857,
-    0.331482,
-    0.332227,
-    0.333067,
-    0.333969,
-    0.334893,
-    0.335801,
-    0.336653,
-    0.337416,
-    0.338061,
-    0.338571,
-    0.338938,
-    0.339165,
-    0.339268,
-    0.339272,
-    0.339207,
-    0.339113,
-    0.339029,
-    0.338996,
-    0.339047,
-    0.339212,
-    0.339512,
-    0.339955,
-    0.340539,
-    0.341252,
-    0.342069,
-    0.342961,
-    0.343888,
-    0.344812,
-    0.345692,
-    0.346491,
-    0.34718,
-    0.347737,
-    0.348149,
-    0.348419,
-    0.348556,
-    0.348584,
-    0.348531,
-    0.348436,
-    0.348338,
-    0.348278,
-    0.348294,
-    0.348416,
-    0.348669,
-    0.349065,
-    0.349606,
-    0.350283,
-    0.351075,
-    0.351952,
-    0.352879,
-    0.353815,
-    0.354719,
-    0.355554,
-    0.356285,
-    0.356888,
-    0.357348,
-    0.357662,
-    0.357836,
-    0.357892,
-    0.357855,
-    0.357763,
-    0.357655,
-    0.357572,
-    0.357553,
-    0.357634,
-    0.35784,
-    0.358189,
-    0.358685,
-    0.359323,
-    0.360085,
-    0.360944,
-    0.361866,
-    0.36281,
-    0.363736,
-    0.364603,
-    0.365375,
-    0.366024,
-    0.366533,
-    0.366892,
-    0.367108,
-    0.367194,
-    0.367178,
-    0.367093,
-    0.366978,
-    0.366875,
-    0.366826,
-    0.366866,
-    0.367026,
-    0.367326,
-    0.367776,
-    0.368372,
-    0.369101,
-    0.369938,
-    0.370851,
-    0.3718,
-    0.372743,
-    0.373639,
-    0.374451,
-    0.375146,
-    0.375703,
-    0.376111,
-    0.376369,
-    0.37649,
-    0.376498,
-    0.376424,
-    0.376307,
-    0.376188,
-    0.376111,
-    0.376113,
-    0.376228,
-    0.376479,
-    0.37688,
-    0.377431,
-    0.378124,
-    0.378935,
-    0.379834,
-    0.380783,
-    0.381741,
-    0.382664,
-    0.383513,
-    0.384253,
-    0.384859,
-    0.385315,
-    0.385619,
-    0.385779,
-    0.385815,
-    0.385756,
-    0.385641,
-    0.38551,
-    0.385408,
-    0.385374,
-    0.385444,
-    0.385646,
-    0.385997,
-    0.386502,
-    0.387155,
-    0.387936,
-    0.388817,
-    0.389763,
-    0.390731,
-    0.391677,
-    0.392561,
-    0.393344,
-    0.393999,
-    0.394506,
-    0.394858,
-    0.395059,
-    0.395126,
-    0.395088,
-    0.394979,
-    0.39484,
-    0.394716,
-    0.394648,
-    0.394676,
-    0.394829,
-    0.395129,
-    0.395586,
-    0.396195,
-    0.396942,
-    0.397802,
-    0.398739,
-    0.399713,
-    0.400679,
-    0.401595,
-    0.402421,
-    0.403124,
-    0.403682,
-    0.404083,
-    0.404329,
-    0.404432,
-    0.404418,
-    0.404319,
-    0.404176,
-    0.404034,
-    0.403936,
-    0.403922,
-    0.404028,
-    0.404277,
-    0.404682,
-    0.405246,
-    0.405956,
-    0.406789,
-    0.407714,
-    0.408689,
-    0.409671,
-    0.410616,
-    0.411482,
-    0.412233,
-    0.412842,
-    0.413295,
-    0.413588,
-    0.413731,
-    0.413744,
-    0.41366,
-    0.413518,
-    0.413362,
-    0.413236,
-    0.413184,
-    0.413242,
-    0.41344,
-    0.413793,
-    0.414308,
-    0.414977,
-    0.41578,
-    0.416687,
-    0.41766,
-    0.418654,
-    0.419625,
-    0.420528,
-    0.421325,
-    0.421987,
-    0.422492,
-    0.422835,
-    0.42302,
-    0.423066,
-    0.423002,
-    0.422865,
-    0.422699,
-    0.422549,
-    0.422461,
-    0.422473,
-    0.422619,
-    0.422919,
-    0.423383,
-    0.424007,
-    0.424776,
-    0.425661,
-    0.426627,
-    0.427629,
-    0.428622,
-    0.42956,
-    0.430402,
-    0.431115,
-    0.431674,
-    0.432069,
-    0.432301,
-    0.432383,
-    0.432343,
-    0.432215,
-    0.432043,
-    0.431873,
-    0.431751,
-    0.43172,
-    0.431814,
-    0.43206,
-    0.432471,
-    0.433048,
-    0.433778,
-    0.434637,
-    0.435591,
-    0.436596,
-    0.437608,
-    0.438578,
-    0.439463,
-    0.440226,
-    0.44084,
-    0.441289,
-    0.44157,
-    0.441693,
-    0.441681,
-    0.441568,
-    0.441395,
-    0.441208,
-    0.441056,
-    0.440983,
-    0.441027,
-    0.441218,
-    0.441574,
-    0.4421,
-    0.442788,
-    0.443616,
-    0.444553,
-    0.445557,
-    0.446583,
-    0.447582,
-    0.448508,
-    0.449321,
-    0.44999,
-    0.450494,
-    0.450827,
-    0.450994,
-    0.451015,
-    0.450921,
-    0.450752,
-    0.450554,
-    0.450374,
-    0.450261,
-    0.450256,
-    0.450392,
-    0.450692,
-    0.451165,
-    0.451806,
-    0.4526,
-    0.453515,
-    0.454513,
-    0.455548,
-    0.456572,
-    0.457537,
-    0.458399,
-    0.459122,
-    0.459684,
-    0.460071,
-    0.460286,
-    0.460345,
-    0.460275,
-    0.460114,
-    0.459908,
-    0.459705,
-    0.459555,
-    0.459503,
-    0.459584,
-    0.459826,
-    0.460243,
-    0.460835,
-    0.461589,
-    0.462478,
-    0.463465,
-    0.464505,
-    0.46555,
-    0.46655,
-    0.467459,
-    0.468237,
-    0.468857,
-    0.469301,
-    0.469568,
-    0.469668,
-    0.469626,
-    0.469479,
-    0.46927,
-    0.469049,
-    0.468865,
-    0.468766,
-    0.468793,
-    0.468977,
-    0.469336,
-    0.469875,
-    0.470585,
-    0.471443,
-    0.472414,
-    0.473455,
-    0.474517,
-    0.475549,
-    0.476502,
-    0.477334,
-    0.478012,
-    0.478516,
-    0.478837,
-    0.478983,
-    0.478975,
-    0.478847,
-    0.47864,
-    0.478404,
-    0.47819,
-    0.478047,
-    0.478021,
-    0.478146,
-    0.478445,
-    0.478928,
-    0.479589,
-    0.480411,
-    0.481361,
-    0.482398,
-    0.483472,
-    0.484532,
-    0.485528,
-    0.486413,
-    0.48715,
-    0.487714,
-    0.488093,
-    0.488289,
-    0.48832,
-    0.488215,
-    0.488015,
-    0.487769,
-    0.487529,
-    0.487346,
-    0.487267,
-    0.487333,
-    0.48757,
-    0.487994,
-    0.488604,
-    0.489385,
-    0.490308,
-    0.491335,
-    0.492417,
-    0.493502,
-    0.494536,
-    0.495473,
-    0.496269,
-    0.496895,
-    0.497335,
-    0.497585,
-    0.497659,
-    0.497583,
-    0.497395,
-    0.497144,
-    0.496881,
-    0.496661,
-    0.496532,
-    0.496539,
-    0.496714,
-    0.497076,
-    0.49763,
-    0.498365,
-    0.499257,
-    0.500268,
-    0.501353,
-    0.502458,
-    0.503528,
-    0.504514,
-    0.505369,
-    0.506058,
-    0.506561,
-    0.506869,
-    0.50699,
-    0.506949,
-    0.506779,
-    0.506528,
-    0.506247,
-    0.505992,
-    0.505816,
-    0.505764,
-    0.505875,
-    0.506173,
-    0.506668,
-    0.507353,
-    0.508208,
-    0.509199,
-    0.51028,
-    0.511401,
-    0.512504,
-    0.513536,
-    0.514449,
-    0.515202,
-    0.51577,
-    0.516139,
-    0.516313,
-    0.516311,
-    0.516165,
-    0.51592,
-    0.515626,
-    0.51534,
-    0.515118,
-    0.51501,
-    0.515057,
-    0.515288,
-    0.51572,
-    0.51635,
-    0.517163,
-    0.518128,
-    0.519201,
-    0.520332,
-    0.521463,
-    0.52254,
-    0.523509,
-    0.524327,
-    0.524961,
-    0.525395,
-    0.525626,
-    0.525669,
-    0.525552,
-    0.525318,
-    0.525016,
-    0.524704,
-    0.524439,
-    0.524275,
-    0.524258,
-    0.524422,
-    0.524787,
-    0.525358,
-    0.526124,
-    0.527056,
-    0.528116,
-    0.529252,
-    0.530407,
-    0.531525,
-    0.532549,
-    0.533431,
-    0.534134,
-    0.534635,
-    0.534928,
-    0.535021,
-    0.534939,
-    0.534721,
-    0.534417,
-    0.534083,
-    0.533779,
-    0.533561,
-    0.53348,
-    0.533574,
-    0.533871,
-    0.534378,
-    0.535091,
-    0.535986,
-    0.537026,
-    0.538161,
-    0.539336,
-    0.540491,
-    0.541568,
-    0.542513,
-    0.543286,
-    0.543858,
-    0.544216,
-    0.544364,
-    0.544323,
-    0.544128,
-    0.543828,
-    0.543477,
-    0.543138,
-    0.542868,
-    0.542724,
-    0.542748,
-    0.542972,
-    0.543413,
-    0.544067,
-    0.544919,
-    0.545932,
-    0.547061,
-    0.548251,
-    0.549439,
-    0.550565,
-    0.551574,
-    0.552418,
-    0.553063,
-    0.55349,
-    0.553699,
-    0.553704,
-    0.553538,
-    0.553247,
-    0.552885,
-    0.552514,
-    0.552197,
-    0.551989,
-    0.551943,
-    0.552093,
-    0.552462,
-    0.553054,
-    0.553855,
-    0.554837,
-    0.555954,
-    0.557151,
-    0.558369,
-    0.559542,
-    0.560612,
-    0.561527,
-    0.562247,
-    0.562748,
-    0.563022,
-    0.56308,
-    0.56295,
-    0.562674,
-    0.562307,
-    0.561909,
-    0.561546,
-    0.561278,
-    0.56116,
-    0.561234,
-    0.561528,
-    0.562052,
-    0.562798,
-    0.56374,
-    0.564839,
-    0.566039,
-    0.567281,
-    0.568498,
-    0.569628,
-    0.570614,
-    0.571411,
-    0.571989,
-    0.572333,
-    0.57245,
-    0.572361,
-    0.572108,
-    0.57174,
-    0.571321,
-    0.570916,
-    0.57059,
-    0.570401,
-    0.570397,
-    0.570612,
-    0.571063,
-    0.571748,
-    0.572645,
-    0.573718,
-    0.574915,
-    0.576175,
-    0.577432,
-    0.57862,
-    0.579677,
-    0.580552,
-    0.58121,
-    0.58163,
-    0.581811,
-    0.581771,
-    0.581546,
-    0.581186,
-    0.580751,
-    0.580308,
-    0.579925,
-    0.579666,
-    0.579583,
-    0.579716,
-    0.58009,
-    0.580706,
-    0.581552,
-    0.582592,
-    0.583779,
-    0.585053,
-    0.586345,
-    0.587588,
-    0.588715,
-    0.58967,
-    0.590411,
-    0.590911,
-    0.591163,
-    0.591178,
-    0.590989,
-    0.590642,
-    0.590197,
-    0.589721,
-    0.589285,
-    0.588956,
-    0.588793,
-    0.588842,
-    0.589133,
-    0.589676,
-    0.590462,
-    0.591463,
-    0.592634,
-    0.593914,
-    0.595237,
-    0.596531,
-    0.597727,
-    0.598763,
-    0.59959,
-    0.600174,
-    0.600503,
-    0.600581,
-    0.600435,
-    0.600108,
-    0.599659,
-    0.599155,
-    0.598669,
-    0.598272,
-    0.598028,
-    0.59799,
-    0.598194,
-    0.598658,
-    0.599378,
-    0.600332,
-    0.601478,
-    0.602759,
-    0.604107,
-    0.60545,
-    0.606713,
-    0.60783,
-    0.608745,
-    0.609419,
-    0.609829,
-    0.609977,
-    0.609882,
-    0.609583,
-    0.609137,
-    0.608611,
-    0.608079,
-    0.607616,
-    0.607291,
-    0.607163,
-    0.607276,
-    0.607654,
-    0.608301,
-    0.609201,
-    0.610315,
-    0.611589,
-    0.612957,
-    0.614343,
-    0.615671,
-    0.616869,
-    0.617875,
-    0.618642,
-    0.619141,
-    0.619365,
-    0.619329,
-    0.619066,
-    0.61863,
-    0.618088,
-    0.617514,
-    0.616987,
-    0.616581,
-    0.616362,
-    0.616379,
-    0.616666,
-    0.617233,
-    0.61807,
-    0.619144,
-    0.620404,
-    0.621785,
-    0.62321,
-    0.6246,
-    0.625879,
-    0.626978,
-    0.627842,
-    0.628436,
-    0.628744,
-    0.628774,
-    0.628556,
-    0.628138,
-    0.627586,
-    0.626976,
-    0.626388,
-    0.625901,
-    0.625588,
-    0.625506,
-    0.625696,
-    0.626175,
-    0.626941,
-    0.627967,
-    0.629205,
-    0.630591,
-    0.632051,
-    0.6335,
-    0.634859,
-    0.636052,
-    0.637018,
-    0.637712,
-    0.638111,
-    0.638217,
-    0.638051,
-    0.63766,
-    0.637105,
-    0.636464,
-    0.635819,
-    0.635253,
-    0.634845,
-    0.634659,
-    0.634745,
-    0.63513,
-    0.635816,
-    0.636784,
-    0.637992,
-    0.639377,
-    0.640864,
-    0.642369,
-    0.643807,
-    0.645096,
-    0.646166,
-    0.646967,
-    0.647465,
-    0.647655,
-    0.647551,
-    0.647195,
-    0.646646,
-    0.64598,
-    0.645281,
-    0.644637,
-    0.644133,
-    0.64384,
-    0.643817,
-    0.644098,
-    0.644696,
-    0.645597,
-    0.646765,
-    0.648141,
-    0.64965,
-    0.651206,
-    0.652721,
-    0.654106,
-    0.655286,
-    0.656199,
-    0.656805,
-    0.657087,
-    0.657055,
-    0.656744,
-    0.656209,
-    0.655524,
-    0.654776,
-    0.654056,
-    0.653454,
-    0.653051,
-    0.652913,
-    0.653083,
-    0.653583,
-    0.654407,
-    0.655525,
-    0.656883,
-    0.658406,
-    0.66001,
-    0.661599,
-    0.663082,
-    0.664374,
-    0.665406,
-    0.666127,
-    0.666512,
-    0.666562,
-    0.666305,
-    0.665793,
-    0.665098,
-    0.664306,
-    0.663512,
-    0.662813,
-    0.662295,
-    0.662035,
-    0.662086,
-    0.662478,
-    0.663215,
-    0.664273,
-    0.665602,
-    0.667133,
-    0.668777,
-    0.670439,
-    0.67202,
-    0.673428,
-    0.674585,
-    0.675429,
-    0.675928,
-    0.676071,
-    0.67588,
-    0.675401,
-    0.674702,
-    0.673872,
-    0.673008,
-    0.67221,
-    0.671575,
-    0.671186,
-    0.671109,
-    0.671383,
-    0.672021,
-    0.673007,
-    0.674299,
-    0.675828,
-    0.677507,
-    0.679238,
-    0.680918,
-    0.682445,
-    0.683733,
-    0.684711,
-    0.685333,
-    0.685581,
-    0.685467,
-    0.685032,
-    0.68434,
-    0.683478,
-    0.682546,
-    0.681649,
-    0.680893,
-    0.68037,
-    0.680155,
-    0.680299,
-    0.680826,
-    0.681729,
-    0.682971,
-    0.684488,
-    0.686196,
-    0.687993,
-    0.689771,
-    0.691422,
-    0.692848,
-    0.693968,
-    0.694726,
-    0.695092,
-    0.695068,
-    0.694688,
-    0.694012,
-    0.693126,
-    0.69213,
-    0.691135,
-    0.690254,
-    0.689589,
-    0.689226,
-    0.689228,
-    0.689631,
-    0.690436,
-    0.691616,
-    0.693112,
-    0.694841,
-    0.6967,
-    0.698576,
-    0.700354,
-    0.701925,
-    0.703199,
-    0.704105,
-    0.704602,
-    0.704683,
-    0.704372,
-    0.703723,
-    0.70282,
-    0.701764,
-    0.700672,
-    0.699662,
-    0.698847,
-    0.698325,
-    0.698172,
-    0.698436,
-    0.699129,
-    0.700233,
-    0.701696,
-    0.703437,
-    0.705353,
-    0.707327,
-    0.709236,
-    0.710962,
-    0.7124,
-    0.713468,
-    0.714113,
-    0.714314,
-    0.714086,
-    0.713477,
-    0.712566,
-    0.711455,
-    0.710265,
-    0.709122,
-    0.708149,
-    0.707456,
-    0.707133,
-    0.707241,
-    0.707805,
-    0.708818,
-    0.710235,
-    0.711979,
-    0.713947,
-    0.716018,
-    0.718062,
-    0.719951,
-    0.721567,
-    0.722813,
-    0.723623,
-    0.723962,
-    0.723834,
-    0.723278,
-    0.72237,
-    0.72121,
-    0.719923,
-    0.718642,
-    0.7175,
-    0.716623,
-    0.716113,
-    0.716046,
-    0.716463,
-    0.717367,
-    0.718722,
-    0.720458,
-    0.722472,
-    0.724641,
-    0.726826,
-    0.728888,
-    0.730696,
-    0.732139,
-    0.733134,
-    0.733631,
-    0.733622,
-    0.733135,
-    0.732241,
-    0.731038,
-    0.729654,
-    0.728229,
-    0.726908,
-    0.72583,
-    0.725113,
-    0.72485,
-    0.725097,
-    0.725872,
-    0.727149,
-    0.728864,
-    0.730918,
-    0.733183,
-    0.735515,
-    0.737763,
-    0.739782,
-    0.741443,
-    0.742646,
-    0.743326,
-    0.743457,
-    0.743059,
-    0.742191,
-    0.740953,
-    0.739472,
-    0.737896,
-    0.736382,
-    0.735083,
-    0.734136,
-    0.733651,
-    0.733703,
-    0.734325,
-    0.735504,
-    0.737184,
-    0.73927,
-    0.741632,
-    0.744119,
-    0.746568,
-    0.748818,
-    0.750723,
-    0.752163,
-    0.753052,
-    0.75335,
-    0.753062,
-    0.752237,
-    0.750971,
-    0.749393,
-    0.747658,
-    0.745934,
-    0.744391,
-    0.743185,
-    0.742447,
-    0.742273,
-    0.742712,
-    0.743769,
-    0.745397,
-    0.747506,
-    0.749966,
-    0.752618,
-    0.755287,
-    0.757795,
-    0.759975,
-    0.761686,
-    0.76282,
-    0.763317,
-    0.763165,
-    0.762402,
-    0.761118,
-    0.759441,
-    0.757535,
-    0.75558,
-    0.753763,
-    0.752264,
-    0.751234,
-    0.750794,
-    0.751016,
-    0.751921,
-    0.753477,
-    0.755599,
-    0.758158,
-    0.760988,
-    0.763901,
-    0.7667,
-    0.769196,
-    0.771222,
-    0.772645,
-    0.773381,
-    0.773397,
-    0.77272,
-    0.771428,
-    0.769651,
-    0.767557,
-    0.765343,
-    0.763215,
-    0.761375,
-    0.760004,
-    0.759249,
-    0.759208,
-    0.759924,
-    0.761381,
-    0.763505,
-    0.766166,
-    0.769193,
-    0.772383,
-    0.775518,
-    0.778382,
-    0.780779,
-    0.782548,
-    0.783574,
-    0.783802,
-    0.783239,
-    0.781953,
-    0.780071,
-    0.777769,
-    0.775258,
-    0.772766,
-    0.770525,
-    0.768747,
-    0.767611,
-    0.767247,
-    0.767725,
-    0.769051,
-    0.77116,
-    0.773929,
-    0.777179,
-    0.78069,
-    0.784222,
-    0.787526,
-    0.790373,
-    0.792563,
-    0.79395,
-    0.794447,
-    0.794036,
-    0.792772,
-    0.790779,
-    0.788237,
-    0.785375,
-    0.782448,
-    0.77972,
-    0.777442,
-    0.775835,
-    0.775066,
-    0.775239,
-    0.776387,
-    0.778464,
-    0.781351,
-    0.784861,
-    0.788759,
-    0.792773,
-    0.796621,
-    0.800027,
-    0.802749,
-    0.804595,
-    0.80544,
-    0.805236,
-    0.804017,
-    0.801899,
-    0.79907,
-    0.795777,
-    0.792309,
-    0.788969,
-    0.786058,
-    0.783846,
-    0.782552,
-    0.782324,
-    0.78323,
-    0.785248,
-    0.788268,
-    0.792099,
-    0.796481,
-    0.80111,
-    0.805655,
-    0.809787,
-    0.813204,
-    0.815658,
-    0.81697,
-    0.817052,
-    0.815909,
-    0.813645,
-    0.810454,
-    0.806607,
-    0.802432,
-    0.798285,
-    0.794532,
-    0.791509,
-    0.789503,
-    0.788724,
-    0.789288,
-    0.791209,
-    0.794391,
-    0.798638,
-    0.803666,
-    0.809122,
-    0.814615,
-    0.819741,
-    0.824119,
-    0.827421,
-    0.829394,
-    0.82989,
-    0.828871,
-    0.826423,
-    0.822742,
-    0.81813,
-    0.812966,
-    0.807684,
-    0.802734,
-    0.798549,
-    0.795514,
-    0.793927,
-    0.793981,
-    0.795741,
-    0.79914,
-    0.803977,
-    0.809935,
-    0.816599,
-    0.823487,
-    0.830089,
-    0.835906,
-    0.840488,
-    0.843472,
-    0.844612,
-    0.843803,
-    0.841092,
-    0.836678,
-    0.830901,
-    0.824218,
-    0.81717,
-    0.810342,
-    0.80432,
-    0.799641,
-    0.79675,
-    0.795966,
-    0.797446,
-    0.801175,
-    0.806959,
-    0.814432,
-    0.823084,
-    0.832295,
-    0.841379,
-    0.849638,
-    0.856417,
-    0.861155,
-    0.863432,
-    0.863011,
-    0.859861,
-    0.854165,
-    0.846317,
-    0.836896,
-    0.82663,
-    0.816342,
-    0.806892,
-    0.799107,
-    0.79372,
-    0.791301,
-    0.792213,
-    0.796569,
-    0.804214,
-    0.814722,
-    0.827422,
-    0.841433,
-    0.855725,
-    0.869191,
-    0.880732,
-    0.889338,
-    0.894175,
-    0.89466,
-    0.890521,
-    0.881832,
-    0.869036,
-    0.852931,
-    0.83463,
-    0.8155,
-    0.797076,
-    0.780955,
-    0.768679,
-    0.76162,
-    0.760853,
-    0.767064,
-    0.780454,
-    0.800686,
-    0.826856,
-    0.857498,
-    0.89063,
-    0.92383,
-    0.954349,
-    0.97924,
-    0.995519,
-    1.00033,
-    0.991096,
-    0.965703,
-    0.922609,
-    0.860968,
-    0.780701,
-    0.682529,
-    0.56797,
-    0.439281,
-    0.299374,
-    0.15168
-};
-
-// Top frequency: 44.1K * 0.00725624
-constexpr static std::array<float, 4096> wt_sawtooth_0x4 =
-{
-    0,
-    -0.0756761,
-    -0.150853,
-    -0.225039,
-    -0.297752,
-    -0.368528,
-    -0.436927,
-    -0.502534,
-    -0.56497,
-    -0.623889,
-    -0.678989,
-    -0.730009,
-    -0.776735,
-    -0.819002,
-    -0.856692,
-    -0.889741,
-    -0.91813,
-    -0.941894,
-    -0.961111,
-    -0.97591,
-    -0.986458,
-    -0.992967,
-    -0.995681,
-    -0.99488,
-    -0.99087,
-    -0.98398,
-    -0.97456,
-    -0.96297,
-    -0.949581,
-    -0.934765,
-    -0.918891,
-    -0.902325,
-    -0.885416,
-    -0.868502,
-    -0.851896,
-    -0.835891,
-    -0.82075,
-    -0.806708,
-    -0.793967,
-    -0.782696,
-    -0.773028,
-    -0.765062,
-    -0.75886,
-    -0.754451,
-    -0.751829,
-    -0.750956,
-    -0.751765,
-    -0.754158,
-    -0.758016,
-    -0.763196,
-    -0.769536,
-    -0.77686,
-    -0.784981,
-    -0.793703,
-    -0.802829,
-    -0.812158,
-    -0.821496,
-    -0.830653,
-    -0.83945,
-    -0.847723,
-    -0.85532,
-    -0.862109,
-    -0.867976,
-    -0.87283,
-    -0.876601,
-    -0.87924,
-    -0.880724,
-    -0.881049,
-    -0.880237,
-    -0.878328,
-    -0.875382,
-    -0.871477,
-    -0.866709,
-    -0.861186,
-    -0.855027,
-    -0.84836,
-    -0.841321,
-    -0.834047,
-    -0.826678,
-    -0.819351,
-    -0.8122,
-    -0.80535,
-    -0.79892,
-    -0.793016,
-    -0.787733,
-    -0.783149,
-    -0.77933,
-    -0.776325,
-    -0.774164,
-    -0.772864,
-    -0.772421,
-    -0.772818,
-    -0.77402,
-    -0.775979,
-    -0.778632,
-    -0.781904,
-    -0.785712,
-    -0.789961,
-    -0.794552,
-    -0.799381,
-    -0.80434,
-    -0.809322,
-    -0.814222,
-    -0.818937,
-    -0.823372,
-    -0.827438,
-    -0.831053,
-    -0.834148,
-    -0.836663,
-    -0.838554,
-    -0.839785,
-    -0.840337,
-    -0.840203,
-    -0.83939,
-    -0.837917,
-    -0.835817,
-    -0.833132,
-    -0.829918,
-    -0.826238,
-    -0.822164,
-    -0.817773,
-    -0.813147,
-    -0.808374,
-    -0.803541,
-    -0.798734,
-    -0.794039,
-    -0.789537,
-    -0.785306,
-    -0.781415,
-    -0.777927,
-    -0.774896,
-    -0.772366,
-    -0.77037,
-    -0.768931,
-    -0.768061,
-    -0.767761,
-    -0.768019,
-    -0.768815,
-    -0.770116,
-    -0.771883,
-    -0.774065,
-    -0.776607,
-    -0.779445,
-    -0.782511,
-    -0.785735,
-    -0.789043,
-    -0.792362,
-    -0.795617,
-    -0.798739,
-    -0.80166,
-    -0.804318,
-    -0.806655,
-    -0.808622,
-    -0.810178,
-    -0.81129,
-    -0.811933,
-    -0.812092,
-    -0.811762,
-    -0.810949,
-    -0.809665,
-    -0.807934,
-    -0.805786,
-    -0.803262,
-    -0.800406,
-    -0.79727,
-    -0.793911,
-    -0.79039,
-    -0.786768,
-    -0.783109,
-    -0.779479,
-    -0.775938,
-    -0.772547,
-    -0.769362,
-    -0.766436,
-    -0.763814,
-    -0.761536,
-    -0.759635,
-    -0.758135,
-    -0.757052,
-    -0.756397,
-    -0.756167,
-    -0.756356,
-    -0.756946,
-    -0.757914,
-    -0.759228,
-    -0.76085,
-    -0.762739,
-    -0.764845,
-    -0.767117,
-    -0.769501,
-    -0.77194,
-    -0.774379,
-    -0.776761,
-    -0.779032,
-    -0.781142,
-    -0.783041,
-    -0.784687,
-    -0.786042,
-    -0.787075,
-    -0.787759,
-    -0.788078,
-    -0.78802,
-    -0.787582,
-    -0.786768,
-    -0.78559,
-    -0.784066,
-    -0.782221,
-    -0.780087,
-    -0.777699,
-    -0.775098,
-    -0.77233,
-    -0.769441,
-    -0.766482,
-    -0.763503,
-    -0.760554,
-    -0.757685,
-    -0.754943,
-    -0.752372,
-    -0.750012,
-    -0.747901,
-    -0.746069,
-    -0.744541,
-    -0.743335,
-    -0.742466,
-    -0.741939,
-    -0.741752,
-    -0.741898,
-    -0.742364,
-    -0.74313,
-    -0.744169,
-    -0.74545,
-    -0.746939,
-    -0.748597,
-    -0.75038,
-    -0.752246,
-    -0.754149,
-    -0.756043,
-    -0.757882,
-    -0.759624,
-    -0.761226,
-    -0.762651,
-    -0.763863,
-    -0.764833,
-    -0.765535,
-    -0.76595,
-    -0.766063,
-    -0.765867,
-    -0.76536,
-    -0.764547,
-    -0.763436,
-    -0.762045,
-    -0.760395,
-    -0.758511,
-    -0.756425,
-    -0.75417,
-    -0.751785,
-    -0.749308,
-    -0.746781,
-    -0.744245,
-    -0.741742,
-    -0.739313,
-    -0.736997,
-    -0.734829,
-    -0.732844,
-    -0.73107,
-    -0.729532,
-    -0.728252,
-    -0.727243,
-    -0.726515,
-    -0.726073,
-    -0.725915,
-    -0.726033,
-    -0.726416,
-    -0.727045,
-    -0.727899,
-    -0.728951,
-    -0.73017,
-    -0.731524,
-    -0.732976,
-    -0.734491,
-    -0.736028,
-    -0.73755,
-    -0.739019,
-    -0.740398,
-    -0.741653,
-    -0.742752,
-    -0.743666,
-    -0.744371,
-    -0.744845,
-    -0.745073,
-    -0.745045,
-    -0.744753,
-    -0.744199,
-    -0.743385,
-    -0.742321,
-    -0.741023,
-    -0.739508,
-    -0.7378,
-    -0.735925,
-    -0.733913,
-    -0.731797,
-    -0.729609,
-    -0.727386,
-    -0.725163,
-    -0.722975,
-    -0.720858,
-    -0.718843,
-    -0.716961,
-    -0.715241,
-    -0.713708,
-    -0.71238,
-    -0.711276,
-    -0.710407,
-    -0.709781,
-    -0.7094,
-    -0.709263,
-    -0.709361,
-    -0.709684,
-    -0.710215,
-    -0.710936,
-    -0.711821,
-    -0.712846,
-    -0.71398,
-    -0.715193,
-    -0.716452,
-    -0.717724,
-    -0.718976,
-    -0.720176,
-    -0.721291,
-    -0.722293,
-    -0.723154,
-    -0.72385,
-    -0.72436,
-    -0.724668,
-    -0.72476,
-    -0.724627,
-    -0.724265,
-    -0.723675,
-    -0.722861,
-    -0.721832,
-    -0.720602,
-    -0.719187,
-    -0.717609,
-    -0.715891,
-    -0.714059,
-    -0.712142,
-    -0.710169,
-    -0.708172,
-    -0.706182,
-    -0.704229,
-    -0.702344,
-    -0.700554,
-    -0.698887,
-    -0.697365,
-    -0.696011,
-    -0.694841,
-    -0.69387,
-    -0.693106,
-    -0.692556,
-    -0.692222,
-    -0.692099,
-    -0.692183,
-    -0.69246,
-    -0.692918,
-    -0.693538,
-    -0.694298,
-    -0.695175,
-    -0.696142,
-    -0.697173,
-    -0.698239,
-    -0.699309,
-    -0.700356,
-    -0.70135,
-    -0.702264,
-    -0.703073,
-    -0.703752,
-    -0.704282,
-    -0.704644,
-    -0.704823,
-    -0.70481,
-    -0.704597,
-    -0.704182,
-    -0.703564,
-    -0.70275,
-    -0.701748,
-    -0.700571,
-    -0.699233,
-    -0.697755,
-    -0.696158,
-    -0.694465,
-    -0.692702,
-    -0.690896,
-    -0.689074,
-    -0.687264,
-    -0.685493,
-    -0.683788,
-    -0.682173,
-    -0.680672,
-    -0.679305,
-    -0.678091,
-    -0.677044,
-    -0.676176,
-    -0.675494,
-    -0.675004,
-    -0.674705,
-    -0.674595,
-    -0.674667,
-    -0.674909,
-    -0.675309,
-    -0.675849,
-    -0.676511,
-    -0.677272,
-    -0.678109,
-    -0.678997,
-    -0.67991,
-    -0.680822,
-    -0.681707,
-    -0.682539,
-    -0.683295,
-    -0.683951,
-    -0.684487,
-    -0.684884,
-    -0.685129,
-    -0.685207,
-    -0.685111,
-    -0.684835,
-    -0.684376,
-    -0.683737,
-    -0.682923,
-    -0.681942,
-    -0.680806,
-    -0.67953,
-    -0.678132,
-    -0.676631,
-    -0.675048,
-    -0.673408,
-    -0.671735,
-    -0.670053,
-    -0.668387,
-    -0.666762,
-    -0.665201,
-    -0.663726,
-    -0.662359,
-    -0.661116,
-    -0.660014,
-    -0.659065,
-    -0.65828,
-    -0.657664,
-    -0.657222,
-    -0.656953,
-    -0.656852,
-    -0.656914,
-    -0.657128,
-    -0.657481,
-    -0.657958,
-    -0.65854,
-    -0.659208,
-    -0.659939,
-    -0.660712,
-    -0.661501,
-    -0.662285,
-    -0.663039,
-    -0.66374,
-    -0.664367,
-    -0.664899,
-    -0.665318,
-    -0.665609,
-    -0.665758,
-    -0.665754,
-    -0.665591,
-    -0.665263,
-    -0.664769,
-    -0.664113,
-    -0.663298,
-    -0.662334,
-    -0.661232,
-    -0.660007,
-    -0.658673,
-    -0.657251,
-    -0.655759,
-    -0.65422,
-    -0.652655,
-    -0.651087,
-    -0.649539,
-    -0.648033,
-    -0.646591,
-    -0.645231,
-    -0.643973,
-    -0.642832,
-    -0.641822,
-    -0.640954,
-    -0.640237,
-    -0.639676,
-    -0.639273,
-    -0.639028,
-    -0.638935,
-    -0.63899,
-    -0.63918,
-    -0.639495,
-    -0.639919,
-    -0.640436,
-    -0.641026,
-    -0.64167,
-    -0.642347,
-    -0.643035,
-    -0.643712,
-    -0.644357,
-    -0.64495,
-    -0.64547,
-    -0.6459,
-    -0.646223,
-    -0.646425,
-    -0.646494,
-    -0.646422,
-    -0.646202,
-    -0.645831,
-    -0.645309,
-    -0.644637,
-    -0.643823,
-    -0.642873,
-    -0.6418,
-    -0.640616,
-    -0.639336,
-    -0.637979,
-    -0.636563,
-    -0.635108,
-    -0.633634,
-    -0.632161,
-    -0.630712,
-    -0.629306,
-    -0.627962,
-    -0.626699,
-    -0.625532,
-    -0.624476,
-    -0.623544,
-    -0.622744,
-    -0.622084,
-    -0.621569,
-    -0.621199,
-    -0.620974,
-    -0.620888,
-    -0.620936,
-    -0.621107,
-    -0.62139,
-    -0.62177,
-    -0.622231,
-    -0.622756,
-    -0.623327,
-    -0.623923,
-    -0.624525,
-    -0.625113,
-    -0.625667,
-    -0.626168,
-    -0.626598,
-    -0.626941,
-    -0.627182,
-    -0.627309,
-    -0.627312,
-    -0.627182,
-    -0.626914,
-    -0.626507,
-    -0.62596,
-    -0.625276,
-    -0.624461,
-    -0.623524,
-    -0.622474,
-    -0.621325,
-    -0.620092,
-    -0.618791,
-    -0.617438,
-    -0.616054,
-    -0.614657,
-    -0.613266,
-    -0.611901,
-    -0.610579,
-    -0.60932,
-    -0.608138,
-    -0.607049,
-    -0.606066,
-    -0.605199,
-    -0.604457,
-    -0.603846,
-    -0.60337,
-    -0.603029,
-    -0.60282,
-    -0.602741,
-    -0.602783,
-    -0.602937,
-    -0.603192,
-    -0.603535,
-    -0.603949,
-    -0.604419,
-    -0.604927,
-    -0.605454,
-    -0.605983,
-    -0.606494,
-    -0.606969,
-    -0.607392,
-    -0.607745,
-    -0.608013,
-    -0.608185,
-    -0.608247,
-    -0.608192,
-    -0.608013,
-    -0.607705,
-    -0.607266,
-    -0.606698,
-    -0.606003,
-    -0.605188,
-    -0.604261,
-    -0.603232,
-    -0.602114,
-    -0.60092,
-    -0.599666,
-    -0.598369,
-    -0.597046,
-    -0.595715,
-    -0.594394,
-    -0.593101,
-    -0.591853,
-    -0.590666,
-    -0.589555,
-    -0.588533,
-    -0.587612,
-    -0.586802,
-    -0.586111,
-    -0.585542,
-    -0.585099,
-    -0.584782,
-    -0.584589,
-    -0.584515,
-    -0.584552,
-    -0.584692,
-    -0.584923,
-    -0.585233,
-    -0.585607,
-    -0.586029,
-    -0.586482,
-    -0.58695,
-    -0.587415,
-    -0.587859,
-    -0.588267,
-    -0.588621,
-    -0.588907,
-    -0.589111,
-    -0.589222,
-    -0.589228,
-    -0.589123,
-    -0.588901,
-    -0.588557,
-    -0.588091,
-    -0.587504,
-    -0.5868,
-    -0.585985,
-    -0.585067,
-    -0.584056,
-    -0.582964,
-    -0.581804,
-    -0.580592,
-    -0.579343,
-    -0.578074,
-    -0.576801,
-    -0.575541,
-    -0.574311,
-    -0.573126,
-    -0.572002,
-    -0.570953,
-    -0.56999,
-    -0.569124,
-    -0.568364,
-    -0.567716,
-    -0.567184,
-    -0.566771,
-    -0.566476,
-    -0.566295,
-    -0.566226,
-    -0.566259,
-    -0.566386,
-    -0.566597,
-    -0.566878,
-    -0.567216,
-    -0.567596,
-    -0.568001,
-    -0.568417,
-    -0.568826,
-    -0.569212,
-    -0.56956,
-    -0.569854,
-    -0.570082,
-    -0.570229,
-    -0.570286,
-    -0.570244,
-    -0.570095,
-    -0.569834,
-    -0.569459,
-    -0.568969,
-    -0.568366,
-    -0.567654,
-    -0.566838,
-    -0.565928,
-    -0.564933,
-    -0.563864,
-    -0.562735,
-    -0.561559,
-    -0.560352,
-    -0.55913,
-    -0.557908,
-    -0.556702,
-    -0.555527,
-    -0.554399,
-    -0.553331,
-    -0.552336,
-    -0.551425,
-    -0.550608,
-    -0.549892,
-    -0.549282,
-    -0.548783,
-    -0.548396,
-    -0.54812,
-    -0.547951,
-    -0.547885,
-    -0.547915,
-    -0.548031,
-    -0.548224,
-    -0.54848,
-    -0.548786,
-    -0.549128,
-    -0.549492,
-    -0.549861,
-    -0.550221,
-    -0.550555,
-    -0.55085,
-    -0.551091,
-    -0.551267,
-    -0.551364,
-    -0.551374,
-    -0.551288,
-    -0.551099,
-    -0.550805,
-    -0.550402,
-    -0.549891,
-    -0.549273,
-    -0.548554,
-    -0.547738,
-    -0.546835,
-    -0.545853,
-    -0.544805,
-    -0.543702,
-    -0.54256,
-    -0.54139,
-    -0.54021,
-    -0.539033,
-    -0.537875,
-    -0.53675,
-    -0.535672,
-    -0.534654,
-    -0.533707,
-    -0.532843,
-    -0.532068,
-    -0.531392,
-    -0.530817,
-    -0.530347,
-    -0.529983,
-    -0.529724,
-    -0.529565,
-    -0.529503,
-    -0.52953,
-    -0.529636,
-    -0.529812,
-    -0.530045,
-    -0.530324,
-    -0.530633,
-    -0.530959,
-    -0.531286,
-    -0.531602,
-    -0.53189,
-    -0.532138,
-    -0.532332,
-    -0.53246,
-    -0.532513,
-    -0.53248,
-    -0.532355,
-    -0.532131,
-    -0.531807,
-    -0.531379,
-    -0.530849,
-    -0.530218,
-    -0.529491,
-    -0.528676,
-    -0.527778,
-    -0.526809,
-    -0.52578,
-    -0.524701,
-    -0.523588,
-    -0.522452,
-    -0.521309,
-    -0.520173,
-    -0.519058,
-    -0.517977,
-    -0.516945,
-    -0.515971,
-    -0.515068,
-    -0.514245,
-    -0.51351,
-    -0.512868,
-    -0.512324,
-    -0.511881,
-    -0.511538,
-    -0.511294,
-    -0.511145,
-    -0.511086,
-    -0.51111,
-    -0.511207,
-    -0.511369,
-    -0.511582,
-    -0.511835,
-    -0.512114,
-    -0.512406,
-    -0.512696,
-    -0.512972,
-    -0.513218,
-    -0.513423,
-    -0.513575,
-    -0.513661,
-    -0.513673,
-    -0.513602,
-    -0.513441,
-    -0.513186,
-    -0.512834,
-    -0.512384,
-    -0.511836,
-    -0.511194,
-    -0.510461,
-    -0.509645,
-    -0.508753,
-    -0.507796,
-    -0.506783,
-    -0.505726,
-    -0.504639,
-    -0.503534,
-    -0.502425,
-    -0.501325,
-    -0.500249,
-    -0.499209,
-    -0.498217,
-    -0.497284,
-    -0.49642,
-    -0.495635,
-    -0.494935,
-    -0.494325,
-    -0.493809,
-    -0.49339,
-    -0.493066,
-    -0.492836,
-    -0.492695,
-    -0.49264,
-    -0.492661,
-    -0.49275,
-    -0.492898,
-    -0.493093,
-    -0.493323,
-    -0.493575,
-    -0.493836,
-    -0.494093,
-    -0.494332,
-    -0.494541,
-    -0.494708,
-    -0.49482,
-    -0.494868,
-    -0.494843,
-    -0.494737,
-    -0.494544,
-    -0.494261,
-    -0.493884,
-    -0.493413,
-    -0.492849,
-    -0.492196,
-    -0.491458,
-    -0.490642,
-    -0.489755,
-    -0.488807,
-    -0.487809,
-    -0.486773,
-    -0.485709,
-    -0.484632,
-    -0.483554,
-    -0.482488,
-    -0.481447,
-    -0.480443,
-    -0.479488,
-    -0.478592,
-    -0.477765,
-    -0.477014,
-    -0.476346,
-    -0.475765,
-    -0.475275,
-    -0.474877,
-    -0.474571,
-    -0.474354,
-    -0.474221,
-    -0.474168,
-    -0.474187,
-    -0.47427,
-    -0.474405,
-    -0.474584,
-    -0.474793,
-    -0.47502,
-    -0.475253,
-    -0.475479,
-    -0.475685,
-    -0.475859,
-    -0.47599,
-    -0.476067,
-    -0.47608,
-    -0.476021,
-    -0.475884,
-    -0.475662,
-    -0.475352,
-    -0.474952,
-    -0.474462,
-    -0.473884,
-    -0.473221,
-    -0.472478,
-    -0.471661,
-    -0.470779,
-    -0.469841,
-    -0.468856,
-    -0.467838,
-    -0.466796,
-    -0.465744,
-    -0.464694,
-    -0.463659,
-    -0.462651,
-    -0.461681,
-    -0.46076,
-    -0.459898,
-    -0.459103,
-    -0.458384,
-    -0.457745,
-    -0.457191,
-    -0.456725,
-    -0.456347,
-    -0.456057,
-    -0.455851,
-    -0.455726,
-    -0.455676,
-    -0.455693,
-    -0.455768,
-    -0.455893,
-    -0.456056,
-    -0.456246,
-    -0.45645,
-    -0.456657,
-    -0.456855,
-    -0.457031,
-    -0.457174,
-    -0.457272,
-    -0.457316,
-    -0.457297,
-    -0.457207,
-    -0.45704,
-    -0.456791,
-    -0.456457,
-    -0.456036,
-    -0.455529,
-    -0.454937,
-    -0.454265,
-    -0.453517,
-    -0.4527,
-    -0.451822,
-    -0.450892,
-    -0.449921,
-    -0.448919,
-    -0.447897,
-    -0.446869,
-    -0.445845,
-    -0.444838,
-    -0.44386,
-    -0.44292,
-    -0.442031,
-    -0.4412,
-    -0.440436,
-    -0.439746,
-    -0.439134,
-    -0.438605,
-    -0.438161,
-    -0.437801,
-    -0.437526,
-    -0.437331,
-    -0.437213,
-    -0.437165,
-    -0.43718,
-    -0.43725,
-    -0.437364,
-    -0.437513,
-    -0.437685,
-    -0.437868,
-    -0.438052,
-    -0.438223,
-    -0.438371,
-    -0.438484,
-    -0.438553,
-    -0.438567,
-    -0.438518,
-    -0.438399,
-    -0.438205,
-    -0.437931,
-    -0.437574,
-    -0.437134,
-    -0.436611,
-    -0.436007,
-    -0.435326,
-    -0.434573,
-    -0.433756,
-    -0.432882,
-    -0.43196,
-    -0.431,
-    -0.430013,
-    -0.429011,
-    -0.428004,
-    -0.427004,
-    -0.426023,
-    -0.425073,
-    -0.424162,
-    -0.423302,
-    -0.4225,
-    -0.421764,
-    -0.421101,
-    -0.420514,
-    -0.420008,
-    -0.419584,
-    -0.419242,
-    -0.41898,
-    -0.418796,
-    -0.418684,
-    -0.418638,
-    -0.418651,
-    -0.418716,
-    -0.418821,
-    -0.418956,
-    -0.419112,
-    -0.419276,
-    -0.419437,
-    -0.419585,
-    -0.419706,
-    -0.419792,
-    -0.419833,
-    -0.419819,
-    -0.419742,
-    -0.419597,
-    -0.419377,
-    -0.41908,
-    -0.418702,
-    -0.418244,
-    -0.417705,
-    -0.41709,
-    -0.416401,
-    -0.415644,
-    -0.414827,
-    -0.413956,
-    -0.413041,
-    -0.412092,
-    -0.41112,
-    -0.410134,
-    -0.409148,
-    -0.408171,
-    -0.407214,
-    -0.406289,
-    -0.405405,
-    -0.404572,
-    -0.403797,
-    -0.403088,
-    -0.40245,
-    -0.401887,
-    -0.401402,
-    -0.400997,
-    -0.400671,
-    -0.400422,
-    -0.400247,
-    -0.400141,
-    -0.400097,
-    -0.400109,
-    -0.400168,
-    -0.400265,
-    -0.400388,
-    -0.400529,
-    -0.400675,
-    -0.400815,
-    -0.40094,
-    -0.401037,
-    -0.401098,
-    -0.401112,
-    -0.401072,
-    -0.400969,
-    -0.400799,
-    -0.400556,
-    -0.400237,
-    -0.399839,
-    -0.399364,
-    -0.398812,
-    -0.398185,
-    -0.397489,
-    -0.396728,
-    -0.39591,
-    -0.395043,
-    -0.394135,
-    -0.393196,
-    -0.392237,
-    -0.391268,
-    -0.390299,
-    -0.389343,
-    -0.38841,
-    -0.387509,
-    -0.38665,
-    -0.385842,
-    -0.385093,
-    -0.384408,
-    -0.383793,
-    -0.383253,
-    -0.382788,
-    -0.382401,
-    -0.38209,
-    -0.381853,
-    -0.381687,
-    -0.381586,
-    -0.381545,
-    -0.381556,
-    -0.38161,
-    -0.381698,
-    -0.38181,
-    -0.381936,
-    -0.382065,
-    -0.382187,
-    -0.38229,
-    -0.382364,
-    -0.382401,
-    -0.382391,
-    -0.382326,
-    -0.382199,
-    -0.382006,
-    -0.38174,
-    -0.3814,
-    -0.380985,
-    -0.380493,
-    -0.379928,
-    -0.379291,
-    -0.378588,
-    -0.377823,
-    -0.377005,
-    -0.376141,
-    -0.375239,
-    -0.374309,
-    -0.373363,
-    -0.372409,
-    -0.371458,
-    -0.370522,
-    -0.36961,
-    -0.368731,
-    -0.367896,
-    -0.367112,
-    -0.366386,
-    -0.365725,
-    -0.365132,
-    -0.364612,
-    -0.364167,
-    -0.363796,
-    -0.363499,
-    -0.363274,
-    -0.363116,
-    -0.363021,
-    -0.362982,
-    -0.362991,
-    -0.363041,
-    -0.363121,
-    -0.363223,
-    -0.363336,
-    -0.363449,
-    -0.363552,
-    -0.363635,
-    -0.363688,
-    -0.363703,
-    -0.363669,
-    -0.363581,
-    -0.363432,
-    -0.363216,
-    -0.36293,
-    -0.36257,
-    -0.362137,
-    -0.361631,
-    -0.361053,
-    -0.360406,
-    -0.359696,
-    -0.358928,
-    -0.35811,
-    -0.357248,
-    -0.356352,
-    -0.355432,
-    -0.354496,
-    -0.353557,
-    -0.352623,
-    -0.351705,
-    -0.350813,
-    -0.349956,
-    -0.349143,
-    -0.348382,
-    -0.347678,
-    -0.347039,
-    -0.346467,
-    -0.345967,
-    -0.345539,
-    -0.345185,
-    -0.344901,
-    -0.344687,
-    -0.344537,
-    -0.344447,
-    -0.34441,
-    -0.344418,
-    -0.344463,
-    -0.344536,
-    -0.344628,
-    -0.344728,
-    -0.344826,
-    -0.344912,
-    -0.344977,
-    -0.34501,
-    -0.345003,
-    -0.344948,
-    -0.344838,
-    -0.344666,
-    -0.344429,
-    -0.344123,
-    -0.343746,
-    -0.343296,
-    -0.342776,
-    -0.342186,
-    -0.34153,
-    -0.340814,
-    -0.340042,
-    -0.339223,
-    -0.338364,
-    -0.337474,
-    -0.336561,
-    -0.335637,
-    -0.334711,
-    -0.333793,
-    -0.332893,
-    -0.33202,
-    -0.331183,
-    -0.330391,
-    -0.329651,
-    -0.328969,
-    -0.32835,
-    -0.327799,
-    -0.327317,
-    -0.326906,
-    -0.326566,
-    -0.326296,
-    -0.326092,
-    -0.32595,
-    -0.325864,
-    -0.325829,
-    -0.325836,
-    -0.325878,
-    -0.325944,
-    -0.326026,
-    -0.326114,
-    -0.326198,
-    -0.326268,
-    -0.326314,
-    -0.326328,
-    -0.326301,
-    -0.326225,
-    -0.326094,
-    -0.325903,
-    -0.325646,
-    -0.325321,
-    -0.324926,
-    -0.324461,
-    -0.323926,
-    -0.323325,
-    -0.322661,
-    -0.321938,
-    -0.321164,
-    -0.320344,
-    -0.319487,
-    -0.318602,
-    -0.317698,
-    -0.316784,
-    -0.315871,
-    -0.314968,
-    -0.314084,
-    -0.313229,
-    -0.312412,
-    -0.31164,
-    -0.31092,
-    -0.310258,
-    -0.309659,
-    -0.309127,
-    -0.308663,
-    -0.308268,
-    -0.307943,
-    -0.307685,
-    -0.30749,
-    -0.307355,
-    -0.307275,
-    -0.307241,
-    -0.307247,
-    -0.307285,
-    -0.307345,
-    -0.307418,
-    -0.307495,
-    -0.307565,
-    -0.30762,
-    -0.307649,
-    -0.307645,
-    -0.307598,
-    -0.307503,
-    -0.307352,
-    -0.307141,
-    -0.306865,
-    -0.306522,
-    -0.306111,
-    -0.30563,
-    -0.305083,
-    -0.304471,
-    -0.303798,
-    -0.30307,
-    -0.302292,
-    -0.301472,
-    -0.300617,
-    -0.299737,
-    -0.298841,
-    -0.297937,
-    -0.297036,
-    -0.296147,
-    -0.295279,
-    -0.294441,
-    -0.293642,
-    -0.292889,
-    -0.292189,
-    -0.291546,
-    -0.290966,
-    -0.290452,
-    -0.290005,
-    -0.289626,
-    -0.289314,
-    -0.289068,
-    -0.288883,
-    -0.288755,
-    -0.288679,
-    -0.288647,
-    -0.288652,
-    -0.288687,
-    -0.288741,
-    -0.288805,
-    -0.288871,
-    -0.288928,
-    -0.288968,
-    -0.288981,
-    -0.288959,
-    -0.288895,
-    -0.28878,
-    -0.288611,
-    -0.288381,
-    -0.288087,
-    -0.287726,
-    -0.287299,
-    -0.286804,
-    -0.286245,
-    -0.285622,
-    -0.284941,
-    -0.284207,
-    -0.283426,
-    -0.282605,
-    -0.281753,
-    -0.280878,
-    -0.279988,
-    -0.279094,
-    -0.278205,
-    -0.277329,
-    -0.276477,
-    -0.275656,
-    -0.274874,
-    -0.274139,
-    -0.273457,
-    -0.272833,
-    -0.272271,
-    -0.271774,
-    -0.271343,
-    -0.270979,
-    -0.270681,
-    -0.270446,
-    -0.27027,
-    -0.270149,
-    -0.270077,
-    -0.270047,
-    -0.270052,
-    -0.270082,
-    -0.270131,
-    -0.270187,
-    -0.270242,
-    -0.270287,
-    -0.270313,
-    -0.270311,
-    -0.270272,
-    -0.27019,
-    -0.270058,
-    -0.26987,
-    -0.269622,
-    -0.26931,
-    -0.268934,
-    -0.268491,
-    -0.267982,
-    -0.267411,
-    -0.266778,
-    -0.266089,
-    -0.26535,
-    -0.264566,
-    -0.263745,
-    -0.262894,
-    -0.262023,
-    -0.261141,
-    -0.260256,
-    -0.259377,
-    -0.258515,
-    -0.257677,
-    -0.256872,
-    -0.256107,
-    -0.25539,
-    -0.254725,
-    -0.254119,
-    -0.253575,
-    -0.253094,
-    -0.252679,
-    -0.25233,
-    -0.252044,
-    -0.251819,
-    -0.251652,
-    -0.251538,
-    -0.25147,
-    -0.251442,
-    -0.251446,
-    -0.251474,
-    -0.251516,
-    -0.251565,
-    -0.25161,
-    -0.251643,
-    -0.251656,
-    -0.251638,
-    -0.251584,
-    -0.251484,
-    -0.251335,
-    -0.251129,
-    -0.250864,
-    -0.250536,
-    -0.250143,
-    -0.249686,
-    -0.249164,
-    -0.24858,
-    -0.247938,
-    -0.247242,
-    -0.246497,
-    -0.24571,
-    -0.244889,
-    -0.24404,
-    -0.243173,
-    -0.242297,
-    -0.241421,
-    -0.240553,
-    -0.239703,
-    -0.238879,
-    -0.23809,
-    -0.237341,
-    -0.236641,
-    -0.235993,
-    -0.235404,
-    -0.234877,
-    -0.234412,
-    -0.234013,
-    -0.233677,
-    -0.233403,
-    -0.233189,
-    -0.233031,
-    -0.232923,
-    -0.232859,
-    -0.232833,
-    -0.232836,
-    -0.23286,
-    -0.232898,
-    -0.232939,
-    -0.232975,
-    -0.232997,
-    -0.232996,
-    -0.232964,
-    -0.232894,
-    -0.232778,
-    -0.232612,
-    -0.23239,
-    -0.232107,
-    -0.231763,
-    -0.231355,
-    -0.230883,
-    -0.230349,
-    -0.229754,
-    -0.229102,
-    -0.228399,
-    -0.227649,
-    -0.226859,
-    -0.226037,
-    -0.22519,
-    -0.224327,
-    -0.223458,
-    -0.22259,
-    -0.221732,
-    -0.220894,
-    -0.220084,
-    -0.219309,
-    -0.218576,
-    -0.217892,
-    -0.217261,
-    -0.216689,
-    -0.216177,
-    -0.215729,
-    -0.215343,
-    -0.215021,
-    -0.214759,
-    -0.214556,
-    -0.214405,
-    -0.214303,
-    -0.214244,
-    -0.214219,
-    -0.214222,
-    -0.214243,
-    -0.214276,
-    -0.21431,
-    -0.214336,
-    -0.214347,
-    -0.214334,
-    -0.214288,
-    -0.214203,
-    -0.214072,
-    -0.213889,
-    -0.21365,
-    -0.213352,
-    -0.212992,
-    -0.212569,
-    -0.212083,
-    -0.211536,
-    -0.21093,
-    -0.21027,
-    -0.209559,
-    -0.208804,
-    -0.208011,
-    -0.207189,
-    -0.206344,
-    -0.205485,
-    -0.204621,
-    -0.203761,
-    -0.202914,
-    -0.202088,
-    -0.20129,
-    -0.200529,
-    -0.199812,
-    -0.199143,
-    -0.198529,
-    -0.197972,
-    -0.197477,
-    -0.197043,
-    -0.196672,
-    -0.196363,
-    -0.196113,
-    -0.195919,
-    -0.195777,
-    -0.195681,
-    -0.195625,
-    -0.195602,
-    -0.195604,
-    -0.195623,
-    -0.195651,
-    -0.195677,
-    -0.195695,
-    -0.195695,
-    -0.19567,
-    -0.19561,
-    -0.195511,
-    -0.195364,
-    -0.195166,
-    -0.194911,
-    -0.194597,
-    -0.194222,
-    -0.193785,
-    -0.193285,
-    -0.192726,
-    -0.19211,
-    -0.19144,
-    -0.190723,
-    -0.189963,
-    -0.189167,
-    -0.188344,
-    -0.1875,
-    -0.186645,
-    -0.185788,
-    -0.184935,
-    -0.184098,
-    -0.183283,
-    -0.182498,
-    -0.181751,
-    -0.181048,
-    -0.180395,
-    -0.179796,
-    -0.179255,
-    -0.178775,
-    -0.178356,
-    -0.177999,
-    -0.177702,
-    -0.177464,
-    -0.177279,
-    -0.177145,
-    -0.177055,
-    -0.177003,
-    -0.176982,
-    -0.176984,
-    -0.177,
-    -0.177023,
-    -0.177043,
-    -0.177052,
-    -0.177042,
-    -0.177004,
-    -0.176932,
-    -0.176818,
-    -0.176657,
-    -0.176443,
-    -0.176173,
-    -0.175844,
-    -0.175453,
-    -0.175002,
-    -0.174489,
-    -0.173918,
-    -0.173292,
-    -0.172613,
-    -0.171889,
-    -0.171124,
-    -0.170326,
-    -0.169502,
-    -0.16866,
-    -0.167809,
-    -0.166956,
-    -0.166112,
-    -0.165284,
-    -0.164479,
-    -0.163707,
-    -0.162973,
-    -0.162285,
-    -0.161647,
-    -0.161063,
-    -0.160538,
-    -0.160072,
-    -0.159668,
-    -0.159324,
-    -0.15904,
-    -0.158812,
-    -0.158638,
-    -0.158511,
-    -0.158427,
-    -0.158379,
-    -0.158359,
-    -0.15836,
-    -0.158374,
-    -0.158392,
-    -0.158406,
-    -0.158407,
-    -0.158386,
-    -0.158337,
-    -0.158252,
-    -0.158125,
-    -0.157949,
-    -0.15772,
-    -0.157435,
-    -0.157091,
-    -0.156686,
-    -0.15622,
-    -0.155695,
-    -0.155113,
-    -0.154476,
-    -0.153789,
-    -0.153058,
-    -0.152288,
-    -0.151487,
-    -0.150662,
-    -0.149822,
-    -0.148974,
-    -0.148127,
-    -0.14729,
-    -0.146471,
-    -0.145677,
-    -0.144917,
-    -0.144197,
-    -0.143522,
-    -0.142899,
-    -0.14233,
-    -0.14182,
-    -0.141369,
-    -0.140978,
-    -0.140648,
-    -0.140376,
-    -0.140159,
-    -0.139994,
-    -0.139875,
-    -0.139796,
-    -0.139752,
-    -0.139734,
-    -0.139735,
-    -0.139746,
-    -0.13976,
-    -0.139767,
-    -0.13976,
-    -0.13973,
-    -0.139669,
-    -0.139572,
-    -0.139431,
-    -0.139241,
-    -0.138997,
-    -0.138697,
-    -0.138338,
-    -0.137919,
-    -0.13744,
-    -0.136902,
-    -0.136308,
-    -0.135661,
-    -0.134966,
-    -0.134228,
-    -0.133454,
-    -0.13265,
-    -0.131825,
-    -0.130986,
-    -0.130141,
-    -0.1293,
-    -0.12847,
-    -0.12766,
-    -0.126877,
-    -0.126128,
-    -0.125421,
-    -0.12476,
-    -0.124151,
-    -0.123597,
-    -0.123101,
-    -0.122664,
-    -0.122288,
-    -0.121971,
-    -0.12171,
-    -0.121504,
-    -0.121348,
-    -0.121236,
-    -0.121164,
-    -0.121123,
-    -0.121107,
-    -0.121107,
-    -0.121116,
-    -0.121126,
-    -0.121127,
-    -0.121111,
-    -0.121072,
-    -0.121,
-    -0.120891,
-    -0.120736,
-    -0.120532,
-    -0.120275,
-    -0.11996,
-    -0.119587,
-    -0.119154,
-    -0.118661,
-    -0.118111,
-    -0.117506,
-    -0.116849,
-    -0.116145,
-    -0.115401,
-    -0.114622,
-    -0.113816,
-    -0.11299,
-    -0.112152,
-    -0.111311,
-    -0.110474,
-    -0.109652,
-    -0.10885,
-    -0.108077,
-    -0.10734,
-    -0.106645,
-    -0.105998,
-    -0.105403,
-    -0.104863,
-    -0.104382,
-    -0.103959,
-    -0.103596,
-    -0.103292,
-    -0.103043,
-    -0.102848,
-    -0.1027,
-    -0.102596,
-    -0.102529,
-    -0.102492,
-    -0.102478,
-    -0.102478,
-    -0.102485,
-    -0.10249,
-    -0.102485,
-    -0.102462,
-    -0.102413,
-    -0.102331,
-    -0.102209,
-    -0.102041,
-    -0.101824,
-    -0.101552,
-    -0.101223,
-    -0.100836,
-    -0.100389,
-    -0.0998832,
-    -0.0993208,
-    -0.0987043,
-    -0.0980378,
-    -0.0973262,
-    -0.0965752,
-    -0.0957916,
-    -0.0949825,
-    -0.0941556,
-    -0.0933191,
-    -0.0924812,
-    -0.0916501,
-    -0.0908341,
-    -0.0900411,
-    -0.0892783,
-    -0.0885527,
-    -0.0878702,
-    -0.0872362,
-    -0.0866548,
-    -0.0861294,
-    -0.085662,
-    -0.0852537,
-    -0.0849042,
-    -0.0846123,
-    -0.0843754,
-    -0.0841901,
-    -0.0840518,
-    -0.083955,
-    -0.0838934,
-    -0.0838601,
-    -0.0838474,
-    -0.0838475,
-    -0.0838522,
-    -0.0838531,
-    -0.0838421,
-    -0.0838113,
-    -0.083753,
-    -0.0836601,
-    -0.0835265,
-    -0.0833464,
-    -0.0831154,
-    -0.0828296,
-    -0.0824867,
-    -0.0820851,
-    -0.0816246,
-    -0.081106,
-    -0.0805315,
-    -0.079904,
-    -0.0792279,
-    -0.0785081,
-    -0.0777508,
-    -0.0769625,
-    -0.0761506,
-    -0.075323,
-    -0.0744876,
-    -0.0736528,
-    -0.0728268,
-    -0.0720176,
-    -0.0712329,
-    -0.0704801,
-    -0.0697656,
-    -0.0690954,
-    -0.0684744,
-    -0.0679068,
-    -0.0673953,
-    -0.0669419,
-    -0.0665474,
-    -0.0662112,
-    -0.0659318,
-    -0.0657065,
-    -0.0655315,
-    -0.065402,
-    -0.0653125,
-    -0.0652564,
-    -0.0652268,
-    -0.0652159,
-    -0.0652158,
-    -0.0652183,
-    -0.0652153,
-    -0.0651985,
-    -0.06516,
-    -0.0650926,
-    -0.0649893,
-    -0.064844,
-    -0.0646513,
-    -0.0644069,
-    -0.0641073,
-    -0.0637504,
-    -0.063335,
-    -0.062861,
-    -0.0623295,
-    -0.061743,
-    -0.0611047,
-    -0.0604189,
-    -0.0596911,
-    -0.0589273,
-    -0.0581344,
-    -0.0573198,
-    -0.0564914,
-    -0.0556571,
-    -0.0548254,
-    -0.0540042,
-    -0.0532017,
-    -0.0524253,
-    -0.0516822,
-    -0.0509788,
-    -0.0503208,
-    -0.0497128,
-    -0.0491586,
-    -0.048661,
-    -0.0482215,
-    -0.0478406,
-    -0.0475176,
-    -0.0472506,
-    -0.0470367,
-    -0.0468719,
-    -0.0467513,
-    -0.046669,
-    -0.0466185,
-    -0.0465925,
-    -0.0465835,
-    -0.0465833,
-    -0.0465837,
-    -0.0465767,
-    -0.0465541,
-    -0.0465083,
-    -0.0464318,
-    -0.0463181,
-    -0.0461612,
-    -0.0459561,
-    -0.0456984,
-    -0.0453853,
-    -0.0450145,
-    -0.0445853,
-    -0.0440979,
-    -0.0435537,
-    -0.0429552,
-    -0.042306,
-    -0.0416108,
-    -0.0408749,
-    -0.0401047,
-    -0.0393072,
-    -0.0384898,
-    -0.0376605,
-    -0.0368273,
-    -0.0359986,
-    -0.0351822,
-    -0.0343863,
-    -0.0336181,
-    -0.0328847,
-    -0.0321923,
-    -0.0315462,
-    -0.030951,
-    -0.0304103,
-    -0.0299264,
-    -0.0295007,
-    -0.0291334,
-    -0.0288235,
-    -0.0285689,
-    -0.0283664,
-    -0.0282118,
-    -0.0281,
-    -0.0280249,
-    -0.0279799,
-    -0.0279577,
-    -0.0279504,
-    -0.0279501,
-    -0.0279486,
-    -0.0279377,
-    -0.0279094,
-    -0.0278562,
-    -0.0277708,
-    -0.0276469,
-    -0.0274785,
-    -0.0272609,
-    -0.0269901,
-    -0.0266634,
-    -0.0262789,
-    -0.025836,
-    -0.0253352,
-    -0.0247782,
-    -0.0241679,
-    -0.0235079,
-    -0.0228031,
-    -0.0220593,
-    -0.0212827,
-    -0.0204805,
-    -0.0196604,
-    -0.0188301,
-    -0.017998,
-    -0.0171721,
-    -0.0163606,
-    -0.0155711,
-    -0.0148111,
-    -0.0140873,
-    -0.0134057,
-    -0.0127716,
-    -0.0121892,
-    -0.0116618,
-    -0.0111916,
-    -0.0107796,
-    -0.0104258,
-    -0.010129,
-    -0.00988669,
-    -0.00969556,
-    -0.00955115,
-    -0.00944812,
-    -0.0093803,
-    -0.00934085,
-    -0.00932234,
-    -0.00931696,
-    -0.00931663,
-    -0.00931315,
-    -0.00929843,
-    -0.00926455,
-    -0.009204,
-    -0.00910978,
-    -0.00897557,
-    -0.0087958,
-    -0.00856584,
-    -0.00828202,
-    -0.00794174,
-    -0.0075435,
-    -0.00708694,
-    -0.00657287,
-    -0.00600321,
-    -0.00538097,
-    -0.0047102,
-    -0.00399592,
-    -0.00324398,
-    -0.00246099,
-    -0.00165415,
-    -0.000831156,
-    0,
-    0.000831156,
-    0.00165415,
-    0.00246099,
-    0.00324398,
-    0.00399592,
-    0.0047102,
-    0.00538097,
-    0.00600321,
-    0.00657287,
-    0.00708694,
-    0.0075435,
-    0.00794174,
-    0.00828202,
-    0.00856584,
-    0.0087958,
-    0.00897557,
-    0.00910978,
-    0.009204,
-    0.00926455,
-    0.00929843,
-    0.00931315,
-    0.00931663,
-    0.00931696,
-    0.00932234,
-    0.00934085,
-    0.0093803,
-    0.00944812,
-    0.00955115,
-    0.00969556,
-    0.00988669,
-    0.010129,
-    0.0104258,
-    0.0107796,
-    0.0111916,
-    0.0116618,
-    0.0121892,
-    0.0127716,
-    0.0134057,
-    0.0140873,
-    0.0148111,
-    0.0155711,
-    0.0163606,
-    0.0171721,
-    0.017998,
-    0.0188301,
-    0.0196604,
-    0.0204805,
-    0.0212827,
-    0.0220593,
-    0.0228031,
-    0.0235079,
-    0.0241679,
-    0.0247782,
-    0.0253352,
-    0.025836,
-    0.0262789,
-    0.0266634,
-    0.0269901,
-    0.0272609,
-    0.0274785,
-    0.0276469,
-    0.0277708,
-    0.0278562,
-    0.0279094,
-    0.0279377,
-    0.0279486,
-    0.0279501,
-    0.0279504,
-    0.0279577,
-    0.0279799,
-    0.0280249,
-    0.0281,
-    0.0282118,
-    0.0283664,
-    0.0285689,
-    0.0288235,
-    0.0291334,
-    0.0295007,
-    0.0299264,
-    0.0304103,
-    0.030951,
-    0.0315462,
-    0.0321923,
-    0.0328847,
-    0.0336181,
-    0.0343863,
-    0.0351822,
-    0.0359986,
-    0.0368273,
-    0.0376605,
-    0.0384898,
-    0.0393072,
-    0.0401047,
-    0.0408749,
-    0.0416108,
-    0.042306,
-    0.0429552,
-    0.0435537,
-    0.0440979,
-    0.0445853,
-    0.0450145,
-    0.0453853,
-    0.0456984,
-    0.0459561,
-    0.0461612,
-    0.0463181,
-    0.0464318,
-    0.0465083,
-    0.0465541,
-    0.0465767,
-    0.0465837,
-    0.0465833,
-    0.0465835,
-    0.0465925,
-    0.0466185,
-    0.046669,
-    0.0467513,
-    0.0468719,
-    0.0470367,
-    0.0472506,
-    0.0475176,
-    0.0478406,
-    0.0482215,
-    0.048661,
-    0.0491586,
-    0.0497128,
-    0.0503208,
-    0.0509788,
-    0.0516822,
-    0.0524253,
-    0.0532017,
-    0.0540042,
-    0.0548254,
-    0.0556571,
-    0.0564914,
-    0.0573198,
-    0.0581344,
-    0.0589273,
-    0.0596911,
-    0.0604189,
-    0.0611047,
-    0.061743,
-    0.0623295,
-    0.062861,
-    0.063335,
-    0.0637504,
-    0.0641073,
-    0.0644069,
-    0.0646513,
-    0.064844,
-    0.0649893,
-    0.0650926,
-    0.06516,
-    0.0651985,
-    0.0652153,
-    0.0652183,
-    0.0652158,
-    0.0652159,
-    0.0652268,
-    0.0652564,
-    0.0653125,
-    0.065402,
-    0.0655315,
-    0.0657065,
-    0.0659318,
-    0.0662112,
-    0.0665474,
-    0.0669419,
-    0.0673953,
-    0.0679068,
-    0.0684744,
-    0.0690954,
-    0.0697656,
-    0.0704801,
-    0.0712329,
-    0.0720176,
-    0.0728268,
-    0.0736528,
-    0.0744876,
-    0.075323,
-    0.0761506,
-    0.0769625,
-    0.0777508,
-    0.0785081,
-    0.0792279,
-    0.079904,
-    0.0805315,
-    0.081106,
-    0.0816246,
-    0.0820851,
-    0.0824867,
-    0.0828296,
-    0.0831154,
-    0.0833464,
-    0.0835265,
-    0.0836601,
-    0.083753,
-    0.0838113,
-    0.0838421,
-    0.0838531,
-    0.0838522,
-    0.0838475,
-    0.0838474,
-    0.0838601,
-    0.0838934,
-    0.083955,
-    0.0840518,
-    0.0841901,
-    0.0843754,
-    0.0846123,
-    0.0849042,
-    0.0852537,
-    0.085662,
-    0.0861294,
-    0.0866548,
-    0.0872362,
-    0.0878702,
-    0.0885527,
-    0.0892783,
-    0.0900411,
-    0.0908341,
-    0.0916501,
-    0.0924812,
-    0.0933191,
-    0.0941556,
-    0.0949825,
-    0.0957916,
-    0.0965752,
-    0.0973262,
-    0.0980378,
-    0.0987043,
-    0.0993208,
-    0.0998832,
-    0.100389,
-    0.100836,
-    0.101223,
-    0.101552,
-    0.101824,
-    0.102041,
-    0.102209,
-    0.102331,
-    0.102413,
-    0.102462,
-    0.102485,
-    0.10249,
-    0.102485,
-    0.102478,
-    0.102478,
-    0.102492,
-    0.102529,
-    0.102596,
-    0.1027,
-    0.102848,
-    0.103043,
-    0.103292,
-    0.103596,
-    0.103959,
-    0.104382,
-    0.104863,
-    0.105403,
-    0.105998,
-    0.106645,
-    0.10734,
-    0.108077,
-    0.10885,
-    0.109652,
-    0.110474,
-    0.111311,
-    0.112152,
-    0.11299,
-    0.113816,
-    0.114622,
-    0.115401,
-    0.116145,
-    0.116849,
-    0.117506,
-    0.118111,
-    0.118661,
-    0.119154,
-    0.119587,
-    0.11996,
-    0.120275,
-    0.120532,
-    0.120736,
-    0.120891,
-    0.121,
-    0.121072,
-    0.121111,
-    0.121127,
-    0.121126,
-    0.121116,
-    0.121107,
-    0.121107,
-    0.121123,
-    0.121164,
-    0.121236,
-    0.121348,
-    0.121504,
-    0.12171,
-    0.121971,
-    0.122288,
-    0.122664,
-    0.123101,
-    0.123597,
-    0.124151,
-    0.12476,
-    0.125421,
-    0.126128,
-    0.126877,
-    0.12766,
-    0.12847,
-    0.1293,
-    0.130141,
-    0.130986,
-    0.131825,
-    0.13265,
-    0.133454,
-    0.134228,
-    0.134966,
-    0.135661,
-    0.136308,
-    0.136902,
-    0.13744,
-    0.137919,
-    0.138338,
-    0.138697,
-    0.138997,
-    0.139241,
-    0.139431,
-    0.139572,
-    0.139669,
-    0.13973,
-    0.13976,
-    0.139767,
-    0.13976,
-    0.139746,
-    0.139735,
-    0.139734,
-    0.139752,
-    0.139796,
-    0.139875,
-    0.139994,
-    0.140159,
-    0.140376,
-    0.140648,
-    0.140978,
-    0.141369,
-    0.14182,
-    0.14233,
-    0.142899,
-    0.143522,
-    0.144197,
-    0.144917,
-    0.145677,
-    0.146471,
-    0.14729,
-    0.148127,
-    0.148974,
-    0.149822,
-    0.150662,
-    0.151487,
-    0.152288,
-    0.153058,
-    0.153789,
-    0.154476,
-    0.155113,
-    0.155695,
-    0.15622,
-    0.156686,
-    0.157091,
-    0.157435,
-    0.15772,
-    0.157949,
-    0.158125,
-    0.158252,
-    0.158337,
-    0.158386,
-    0.158407,
-    0.158406,
-    0.158392,
-    0.158374,
-    0.15836,
-    0.158359,
-    0.158379,
-    0.158427,
-    0.158511,
-    0.158638,
-    0.158812,
-    0.15904,
-    0.159324,
-    0.159668,
-    0.160072,
-    0.160538,
-    0.161063,
-    0.161647,
-    0.162285,
-    0.162973,
-    0.163707,
-    0.164479,
-    0.165284,
-    0.166112,
-    0.166956,
-    0.167809,
-    0.16866,
-    0.169502,
-    0.170326,
-    0.171124,
-    0.171889,
-    0.172613,
-    0.173292,
-    0.173918,
-    0.174489,
-    0.175002,
-    0.175453,
-    0.175844,
-    0.176173,
-    0.176443,
-    0.176657,
-    0.176818,
-    0.176932,
-    0.177004,
-    0.177042,
-    0.177052,
-    0.177043,
-    0.177023,
-    0.177,
-    0.176984,
-    0.176982,
-    0.177003,
-    0.177055,
-    0.177145,
-    0.177279,
-    0.177464,
-    0.177702,
-    0.177999,
-    0.178356,
-    0.178775,
-    0.179255,
-    0.179796,
-    0.180395,
-    0.181048,
-    0.181751,
-    0.182498,
-    0.183283,
-    0.184098,
-    0.184935,
-    0.185788,
-    0.186645,
-    0.1875,
-    0.188344,
-    0.189167,
-    0.189963,
-    0.190723,
-    0.19144,
-    0.19211,
-    0.192726,
-    0.193285,
-    0.193785,
-    0.194222,
-    0.194597,
-    0.194911,
-    0.195166,
-    0.195364,
-    0.195511,
-    0.19561,
-    0.19567,
-    0.195695,
-    0.195695,
-    0.195677,
-    0.195651,
-    0.195623,
-    0.195604,
-    0.195602,
-    0.195625,
-    0.195681,
-    0.195777,
-    0.195919,
-    0.196113,
-    0.196363,
-    0.196672,
-    0.197043,
-    0.197477,
-    0.197972,
-    0.198529,
-    0.199143,
-    0.199812,
-    0.200529,
-    0.20129,
-    0.202088,
-    0.202914,
-    0.203761,
-    0.204621,
-    0.205485,
-    0.206344,
-    0.207189,
-    0.208011,
-    0.208804,
-    0.209559,
-    0.21027,
-    0.21093,
-    0.211536,
-    0.212083,
-    0.212569,
-    0.212992,
-    0.213352,
-    0.21365,
-    0.213889,
-    0.214072,
-    0.214203,
-    0.214288,
-    0.214334,
-    0.214347,
-    0.214336,
-    0.21431,
-    0.214276,
-    0.214243,
-    0.214222,
-    0.214219,
-    0.214244,
-    0.214303,
-    0.214405,
-    0.214556,
-    0.214759,
-    0.215021,
-    0.215343,
-    0.215729,
-    0.216177,
-    0.216689,
-    0.217261,
-    0.217892,
-    0.218576,
-    0.219309,
-    0.220084,
-    0.220894,
-    0.221732,
-    0.22259,
-    0.223458,
-    0.224327,
-    0.22519,
-    0.226037,
-    0.226859,
-    0.227649,
-    0.228399,
-    0.229102,
-    0.229754,
-    0.230349,
-    0.230883,
-    0.231355,
-    0.231763,
-    0.232107,
-    0.23239,
-    0.232612,
-    0.232778,
-    0.232894,
-    0.232964,
-    0.232996,
-    0.232997,
-    0.232975,
-    0.232939,
-    0.232898,
-    0.23286,
-    0.232836,
-    0.232833,
-    0.232859,
-    0.232923,
-    0.233031,
-    0.233189,
-    0.233403,
-    0.233677,
-    0.234013,
-    0.234412,
-    0.234877,
-    0.235404,
-    0.235993,
-    0.236641,
-    0.237341,
-    0.23809,
-    0.238879,
-    0.239703,
-    0.240553,
-    0.241421,
-    0.242297,
-    0.243173,
-    0.24404,
-    0.244889,
-    0.24571,
-    0.246497,
-    0.247242,
-    0.247938,
-    0.24858,
-    0.249164,
-    0.249686,
-    0.250143,
-    0.250536,
-    0.250864,
-    0.251129,
-    0.251335,
-    0.251484,
-    0.251584,
-    0.251638,
-    0.251656,
-    0.251643,
-    0.25161,
-    0.251565,
-    0.251516,
-    0.251474,
-    0.251446,
-    0.251442,
-    0.25147,
-    0.251538,
-    0.251652,
-    0.251819,
-    0.252044,
-    0.25233,
-    0.252679,
-    0.253094,
-    0.253575,
-    0.254119,
-    0.254725,
-    0.25539,
-    0.256107,
-    0.256872,
-    0.257677,
-    0.258515,
-    0.259377,
-    0.260256,
-    0.261141,
-    0.262023,
-    0.262894,
-    0.263745,
-    0.264566,
-    0.26535,
-    0.266089,
-    0.266778,
-    0.267411,
-    0.267982,
-    0.268491,
-    0.268934,
-    0.26931,
-    0.269622,
-    0.26987,
-    0.270058,
-    0.27019,
-    0.270272,
-    0.270311,
-    0.270313,
-    0.270287,
-    0.270242,
-    0.270187,
-    0.270131,
-    0.270082,
-    0.270052,
-    0.270047,
-    0.270077,
-    0.270149,
-    0.27027,
-    0.270446,
-    0.270681,
-    0.270979,
-    0.271343,
-    0.271774,
-    0.272271,
-    0.272833,
-    0.273457,
-    0.274139,
-    0.274874,
-    0.275656,
-    0.276477,
-    0.277329,
-    0.278205,
-    0.279094,
-    0.279988,
-    0.280878,
-    0.281753,
-    0.282605,
-    0.283426,
-    0.284207,
-    0.284941,
-    0.285622,
-    0.286245,
-    0.286804,
-    0.287299,
-    0.287726,
-    0.288087,
-    0.288381,
-    0.288611,
-    0.28878,
-    0.288895,
-    0.288959,
-    0.288981,
-    0.288968,
-    0.288928,
-    0.288871,
-    0.288805,
-    0.288741,
-    0.288687,
-    0.288652,
-    0.288647,
-    0.288679,
-    0.288755,
-    0.288883,
-    0.289068,
-    0.289314,
-    0.289626,
-    0.290005,
-    0.290452,
-    0.290966,
-    0.291546,
-    0.292189,
-    0.292889,
-    0.293642,
-    0.294441,
-    0.295279,
-    0.296147,
-    0.297036,
-    0.297937,
-    0.298841,
-    0.299737,
-    0.300617,
-    0.301472,
-    0.302292,
-    0.30307,
-    0.303798,
-    0.304471,
-    0.305083,
-    0.30563,
-    0.306111,
-    0.306522,
-    0.306865,
-    0.307141,
-    0.307352,
-    0.307503,
-    0.307598,
-    0.307645,
-    0.307649,
-    0.30762,
-    0.307565,
-    0.307495,
-    0.307418,
-    0.307345,
-    0.307285,
-    0.307247,
-    0.307241,
-    0.307275,
-    0.307355,
-    0.30749,
-    0.307685,
-    0.307943,
-    0.308268,
-    0.308663,
-    0.309127,
-    0.309659,
-    0.310258,
-    0.31092,
-    0.31164,
-    0.312412,
-    0.313229,
-    0.314084,
-    0.314968,
-    0.315871,
-    0.316784,
-    0.317698,
-    0.318602,
-    0.319487,
-    0.320344,
-    0.321164,
-    0.321938,
-    0.322661,
-    0.323325,
-    0.323926,
-    0.324461,
-    0.324926,
-    0.325321,
-    0.325646,
-    0.325903,
-    0.326094,
-    0.326225,
-    0.326301,
-    0.326328,
-    0.326314,
-    0.326268,
-    0.326198,
-    0.326114,
-    0.326026,
-    0.325944,
-    0.325878,
-    0.325836,
-    0.325829,
-    0.325864,
-    0.32595,
-    0.326092,
-    0.326296,
-    0.326566,
-    0.326906,
-    0.327317,
-    0.327799,
-    0.32835,
-    0.328969,
-    0.329651,
-    0.330391,
-    0.331183,
-    0.33202,
-    0.332893,
-    0.333793,
-    0.334711,
-    0.335637,
-    0.336561,
-    0.337474,
-    0.338364,
-    0.339223,
-    0.340042,
-    0.340814,
-    0.34153,
-    0.342186,
-    0.342776,
-    0.343296,
-    0.343746,
-    0.344123,
-    0.344429,
-    0.344666,
-    0.344838,
-    0.344948,
-    0.345003,
-    0.34501,
-    0.344977,
-    0.344912,
-    0.344826,
-    0.344728,
-    0.344628,
-    0.344536,
-    0.344463,
-    0.344418,
-    0.34441,
-    0.344447,
-    0.344537,
-    0.344687,
-    0.344901,
-    0.345185,
-    0.345539,
-    0.345967,
-    0.346467,
-    0.347039,
-    0.347678,
-    0.348382,
-    0.349143,
-    0.349956,
-    0.350813,
-    0.351705,
-    0.352623,
-    0.353557,
-    0.354496,
-    0.355432,
-    0.356352,
-    0.357248,
-    0.35811,
-    0.358928,
-    0.359696,
-    0.360406,
-    0.361053,
-    0.361631,
-    0.362137,
-    0.36257,
-    0.36293,
-    0.363216,
-    0.363432,
-    0.363581,
-    0.363669,
-    0.363703,
-    0.363688,
-    0.363635,
-    0.363552,
-    0.363449,
-    0.363336,
-    0.363223,
-    0.363121,
-    0.363041,
-    0.362991,
-    0.362982,
-    0.363021,
-    0.363116,
-    0.363274,
-    0.363499,
-    0.363796,
-    0.364167,
-    0.364612,
-    0.365132,
-    0.365725,
-    0.366386,
-    0.367112,
-    0.367896,
-    0.368731,
-    0.36961,
-    0.370522,
-    0.371458,
-    0.372409,
-    0.373363,
-    0.374309,
-    0.375239,
-    0.376141,
-    0.377005,
-    0.377823,
-    0.378588,
-    0.379291,
-    0.379928,
-    0.380493,
-    0.380985,
-    0.3814,
-    0.38174,
-    0.382006,
-    0.382199,
-    0.382326,
-    0.382391,
-    0.382401,
-    0.382364,
-    0.38229,
-    0.382187,
-    0.382065,
-    0.381936,
-    0.38181,
-    0.381698,
-    0.38161,
-    0.381556,
-    0.381545,
-    0.381586,
-    0.381687,
-    0.381853,
-    0.38209,
-    0.382401,
-    0.382788,
-    0.383253,
-    0.383793,
-    0.384408,
-    0.385093,
-    0.385842,
-    0.38665,
-    0.387509,
-    0.38841,
-    0.389343,
-    0.390299,
-    0.391268,
-    0.392237,
-    0.393196,
-    0.394135,
-    0.395043,
-    0.39591,
-    0.396728,
-    0.397489,
-    0.398185,
-    0.398812,
-    0.399364,
-    0.399839,
-    0.400237,
-    0.400556,
-    0.400799,
-    0.400969,
-    0.401072,
-    0.401112,
-    0.401098,
-    0.401037,
-    0.40094,
-    0.400815,
-    0.400675,
-    0.400529,
-    0.400388,
-    0.400265,
-    0.400168,
-    0.400109,
-    0.400097,
-    0.400141,
-    0.400247,
-    0.400422,
-    0.400671,
-    0.400997,
-    0.401402,
-    0.401887,
-    0.40245,
-    0.403088,
-    0.403797,
-    0.404572,
-    0.405405,
-    0.406289,
-    0.407214,
-    0.408171,
-    0.409148,
-    0.410134,
-    0.41112,
-    0.412092,
-    0.413041,
-    0.413956,
-    0.414827,
-    0.415644,
-    0.416401,
-    0.41709,
-    0.417705,
-    0.418244,
-    0.418702,
-    0.41908,
-    0.419377,
-    0.419597,
-    0.419742,
-    0.419819,
-    0.419833,
-    0.419792,
-    0.419706,
-    0.419585,
-    0.419437,
-    0.419276,
-    0.419112,
-    0.418956,
-    0.418821,
-    0.418716,
-    0.418651,
-    0.418638,
-    0.418684,
-    0.418796,
-    0.41898,
-    0.419242,
-    0.419584,
-    0.420008,
-    0.420514,
-    0.421101,
-    0.421764,
-    0.4225,
-    0.423302,
-    0.424162,
-    0.425073,
-    0.426023,
-    0.427004,
-    0.428004,
-    0.429011,
-    0.430013,
-    0.431,
-    0.43196,
-    0.432882,
-    0.433756,
-    0.434573,
-    0.435326,
-    0.436007,
-    0.436611,
-    0.437134,
-    0.437574,
-    0.437931,
-    0.438205,
-    0.438399,
-    0.438518,
-    0.438567,
-    0.438553,
-    0.438484,
-    0.438371,
-    0.438223,
-    0.438052,
-    0.437868,
-    0.437685,
-    0.437513,
-    0.437364,
-    0.43725,
-    0.43718,
-    0.437165,
-    0.437213,
-    0.437331,
-    0.437526,
-    0.437801,
-    0.438161,
-    0.438605,
-    0.439134,
-    0.439746,
-    0.440436,
-    0.4412,
-    0.442031,
-    0.44292,
-    0.44386,
-    0.444838,
-    0.445845,
-    0.446869,
-    0.447897,
-    0.448919,
-    0.449921,
-    0.450892,
-    0.451822,
-    0.4527,
-    0.453517,
-    0.454265,
-    0.454937,
-    0.455529,
-    0.456036,
-    0.456457,
-    0.456791,
-    0.45704,
-    0.457207,
-    0.457297,
-    0.457316,
-    0.457272,
-    0.457174,
-    0.457031,
-    0.456855,
-    0.456657,
-    0.45645,
-    0.456246,
-    0.456056,
-    0.455893,
-    0.455768,
-    0.455693,
-    0.455676,
-    0.455726,
-    0.455851,
-    0.456057,
-    0.456347,
-    0.456725,
-    0.457191,
-    0.457745,
-    0.458384,
-    0.459103,
-    0.459898,
-    0.46076,
-    0.461681,
-    0.462651,
-    0.463659,
-    0.464694,
-    0.465744,
-    0.466796,
-    0.467838,
-    0.468856,
-    0.469841,
-    0.470779,
-    0.471661,
-    0.472478,
-    0.473221,
-    0.473884,
-    0.474462,
-    0.474952,
-    0.475352,
-    0.475662,
-    0.475884,
-    0.476021,
-    0.47608,
-    0.476067,
-    0.47599,
-    0.475859,
-    0.475685,
-    0.475479,
-    0.475253,
-    0.47502,
-    0.474793,
-    0.474584,
-    0.474405,
-    0.47427,
-    0.474187,
-    0.474168,
-    0.474221,
-    0.474354,
-    0.474571,
-    0.474877,
-    0.475275,
-    0.475765,
-    0.476346,
-    0.477014,
-    0.477765,
-    0.478592,
-    0.479488,
-    0.480443,
-    0.481447,
-    0.482488,
-    0.483554,
-    0.484632,
-    0.485709,
-    0.486773,
-    0.487809,
-    0.488807,
-    0.489755,
-    0.490642,
-    0.491458,
-    0.492196,
-    0.492849,
-    0.493413,
-    0.493884,
-    0.494261,
-    0.494544,
-    0.494737,
-    0.494843,
-    0.494868,
-    0.49482,
-    0.494708,
-    0.494541,
-    0.494332,
-    0.494093,
-    0.493836,
-    0.493575,
-    0.493323,
-    0.493093,
-    0.492898,
-    0.49275,
-    0.492661,
-    0.49264,
-    0.492695,
-    0.492836,
-    0.493066,
-    0.49339,
-    0.493809,
-    0.494325,
-    0.494935,
-    0.495635,
-    0.49642,
-    0.497284,
-    0.498217,
-    0.499209,
-    0.500249,
-    0.501325,
-    0.502425,
-    0.503534,
-    0.504639,
-    0.505726,
-    0.506783,
-    0.507796,
-    0.508753,
-    0.509645,
-    0.510461,
-    0.511194,
-    0.511836,
-    0.512384,
-    0.512834,
-    0.513186,
-    0.513441,
-    0.513602,
-    0.513673,
-    0.513661,
-    0.513575,
-    0.513423,
-    0.513218,
-    0.512972,
-    0.512696,
-    0.512406,
-    0.512114,
-    0.511835,
-    0.511582,
-    0.511369,
-    0.511207,
-    0.51111,
-    0.511086,
-    0.511145,
-    0.511294,
-    0.511538,
-    0.511881,
-    0.512324,
-    0.512868,
-    0.51351,
-    0.514245,
-    0.515068,
-    0.515971,
-    0.516945,
-    0.517977,
-    0.519058,
-    0.520173,
-    0.521309,
-    0.522452,
-    0.523588,
-    0.524701,
-    0.52578,
-    0.526809,
-    0.527778,
-    0.528676,
-    0.529491,
-    0.530218,
-    0.530849,
-    0.531379,
-    0.531807,
-    0.532131,
-    0.532355,
-    0.53248,
-    0.532513,
-    0.53246,
-    0.532332,
-    0.532138,
-    0.53189,
-    0.531602,
-    0.531286,
-    0.530959,
-    0.530633,
-    0.530324,
-    0.530045,
-    0.529812,
-    0.529636,
-    0.52953,
-    0.529503,
-    0.529565,
-    0.529724,
-    0.529983,
-    0.530347,
-    0.530817,
-    0.531392,
-    0.532068,
-    0.532843,
-    0.533707,
-    0.534654,
-    0.535672,
-    0.53675,
-    0.537875,
-    0.539033,
-    0.54021,
-    0.54139,
-    0.54256,
-    0.543702,
-    0.544805,
-    0.545853,
-    0.546835,
-    0.547738,
-    0.548554,
-    0.549273,
-    0.549891,
-    0.550402,
-    0.550805,
-    0.551099,
-    0.551288,
-    0.551374,
-    0.551364,
-    0.551267,
-    0.551091,
-    0.55085,
-    0.550555,
-    0.550221,
-    0.549861,
-    0.549492,
-    0.549128,
-    0.548786,
-    0.54848,
-    0.548224,
-    0.548031,
-    0.547915,
-    0.547885,
-    0.547951,
-    0.54812,
-    0.548396,
-    0.548783,
-    0.549282,
-    0.549892,
-    0.550608,
-    0.551425,
-    0.552336,
-    0.553331,
-    0.554399,
-    0.555527,
-    0.556702,
-    0.557908,
-    0.55913,
-    0.560352,
-    0.561559,
-    0.562735,
-    0.563864,
-    0.564933,
-    0.565928,
-    0.566838,
-    0.567654,
-    0.568366,
-    0.568969,
-    0.569459,
-    0.569834,
-    0.570095,
-    0.570244,
-    0.570286,
-    0.570229,
-    0.570082,
-    0.569854,
-    0.56956,
-    0.569212,
-    0.568826,
-    0.568417,
-    0.568001,
-    0.567596,
-    0.567216,
-    0.566878,
-    0.566597,
-    0.566386,
-    0.566259,
-    0.566226,
-    0.566295,
-    0.566476,
-    0.566771,
-    0.567184,
-    0.567716,
-    0.568364,
-    0.569124,
-    0.56999,
-    0.570953,
-    0.572002,
-    0.573126,
-    0.574311,
-    0.575541,
-    0.576801,
-    0.578074,
-    0.579343,
-    0.580592,
-    0.581804,
-    0.582964,
-    0.584056,
-    0.585067,
-    0.585985,
-    0.5868,
-    0.587504,
-    0.588091,
-    0.588557,
-    0.588901,
-    0.589123,
-    0.589228,
-    0.589222,
-    0.589111,
-    0.588907,
-    0.588621,
-    0.588267,
-    0.587859,
-    0.587415,
-    0.58695,
-    0.586482,
-    0.586029,
-    0.585607,
-    0.585233,
-    0.584923,
-    0.584692,
-    0.584552,
-    0.584515,
-    0.584589,
-    0.584782,
-    0.585099,
-    0.585542,
-    0.586111,
-    0.586802,
-    0.587612,
-    0.588533,
-    0.589555,
-    0.590666,
-    0.591853,
-    0.593101,
-    0.594394,
-    0.595715,
-    0.597046,
-    0.598369,
-    0.599666,
-    0.60092,
-    0.602114,
-    0.603232,
-    0.604261,
-    0.605188,
-    0.606003,
-    0.606698,
-    0.607266,
-    0.607705,
-    0.608013,
-    0.608192,
-    0.608247,
-    0.608185,
-    0.608013,
-    0.607745,
-    0.607392,
-    0.606969,
-    0.606494,
-    0.605983,
-    0.605454,
-    0.604927,
-    0.604419,
-    0.603949,
-    0.603535,
-    0.603192,
-    0.602937,
-    0.602783,
-    0.602741,
-    0.60282,
-    0.603029,
-    0.60337,
-    0.603846,
-    0.604457,
-    0.605199,
-    0.606066,
-    0.607049,
-    0.608138,
-    0.60932,
-    0.610579,
-    0.611901,
-    0.613266,
-    0.614657,
-    0.616054,
-    0.617438,
-    0.618791,
-    0.620092,
-    0.621325,
-    0.622474,
-    0.623524,
-    0.624461,
-    0.625276,
-    0.62596,
-    0.626507,
-    0.626914,
-    0.627182,
-    0.627312,
-    0.627309,
-    0.627182,
-    0.626941,
-    0.626598,
-    0.626168,
-    0.625667,
-    0.625113,
-    0.624525,
-    0.623923,
-    0.623327,
-    0.622756,
-    0.622231,
-    0.62177,
-    0.62139,
-    0.621107,
-    0.620936,
-    0.620888,
-    0.620974,
-    0.621199,
-    0.621569,
-    0.622084,
-    0.622744,
-    0.623544,
-    0.624476,
-    0.625532,
-    0.626699,
-    0.627962,
-    0.629306,
-    0.630712,
-    0.632161,
-    0.633634,
-    0.635108,
-    0.636563,
-    0.637979,
-    0.639336,
-    0.640616,
-    0.6418,
-    0.642873,
-    0.643823,
-    0.644637,
-    0.645309,
-    0.645831,
-    0.646202,
-    0.646422,
-    0.646494,
-    0.646425,
-    0.646223,
-    0.6459,
-    0.64547,
-    0.64495,
-    0.644357,
-    0.643712,
-    0.643035,
-    0.642347,
-    0.64167,
-    0.641026,
-    0.640436,
-    0.639919,
-    0.639495,
-    0.63918,
-    0.63899,
-    0.638935,
-    0.639028,
-    0.639273,
-    0.639676,
-    0.640237,
-    0.640954,
-    0.641822,
-    0.642832,
-    0.643973,
-    0.645231,
-    0.646591,
-    0.648033,
-    0.649539,
-    0.651087,
-    0.652655,
-    0.65422,
-    0.655759,
-    0.657251,
-    0.658673,
-    0.660007,
-    0.661232,
-    0.662334,
-    0.663298,
-    0.664113,
-    0.664769,
-    0.665263,
-    0.665591,
-    0.665754,
-    0.665758,
-    0.665609,
-    0.665318,
-    0.664899,
-    0.664367,
-    0.66374,
-    0.663039,
-    0.662285,
-    0.661501,
-    0.660712,
-    0.659939,
-    0.659208,
-    0.65854,
-    0.657958,
-    0.657481,
-    0.657128,
-    0.656914,
-    0.656852,
-    0.656953,
-    0.657222,
-    0.657664,
-    0.65828,
-    0.659065,
-    0.660014,
-    0.661116,
-    0.662359,
-    0.663726,
-    0.665201,
-    0.666762,
-    0.668387,
-    0.670053,
-    0.671735,
-    0.673408,
-    0.675048,
-    0.676631,
-    0.678132,
-    0.67953,
-    0.680806,
-    0.681942,
-    0.682923,
-    0.683737,
-    0.684376,
-    0.684835,
-    0.685111,
-    0.685207,
-    0.685129,
-    0.684884,
-    0.684487,
-    0.683951,
-    0.683295,
-    0.682539,
-    0.681707,
-    0.680822,
-    0.67991,
-    0.678997,
-    0.678109,
-    0.677272,
-    0.676511,
-    0.675849,
-    0.675309,
-    0.674909,
-    0.674667,
-    0.674595,
-    0.674705,
-    0.675004,
-    0.675494,
-    0.676176,
-    0.677044,
-    0.678091,
-    0.679305,
-    0.680672,
-    0.682173,
-    0.683788,
-    0.685493,
-    0.687264,
-    0.689074,
-    0.690896,
-    0.692702,
-    0.694465,
-    0.696158,
-    0.697755,
-    0.699233,
-    0.700571,
-    0.701748,
-    0.70275,
-    0.703564,
-    0.704182,
-    0.704597,
-    0.70481,
-    0.704823,
-    0.704644,
-    0.704282,
-    0.703752,
-    0.703073,
-    0.702264,
-    0.70135,
-    0.700356,
-    0.699309,
-    0.698239,
-    0.697173,
-    0.696142,
-    0.695175,
-    0.694298,
-    0.693538,
-    0.692918,
-    0.69246,
-    0.692183,
-    0.692099,
-    0.692222,
-    0.692556,
-    0.693106,
-    0.69387,
-    0.694841,
-    0.696011,
-    0.697365,
-    0.698887,
-    0.700554,
-    0.702344,
-    0.704229,
-    0.706182,
-    0.708172,
-    0.710169,
-    0.712142,
-    0.714059,
-    0.715891,
-    0.717609,
-    0.719187,
-    0.720602,
-    0.721832,
-    0.722861,
-    0.723675,
-    0.724265,
-    0.724627,
-    0.72476,
-    0.724668,
-    0.72436,
-    0.72385,
-    0.723154,
-    0.722293,
-    0.721291,
-    0.720176,
-    0.718976,
-    0.717724,
-    0.716452,
-    0.715193,
-    0.71398,
-    0.712846,
-    0.711821,
-    0.710936,
-    0.710215,
-    0.709684,
-    0.709361,
-    0.709263,
-    0.7094,
-    0.709781,
-    0.710407,
-    0.711276,
-    0.71238,
-    0.713708,
-    0.715241,
-    0.716961,
-    0.718843,
-    0.720858,
-    0.722975,
-    0.725163,
-    0.727386,
-    0.729609,
-    0.731797,
-    0.733913,
-    0.735925,
-    0.7378,
-    0.739508,
-    0.741023,
-    0.742321,
-    0.743385,
-    0.744199,
-    0.744753,
-    0.745045,
-    0.745073,
-    0.744845,
-    0.744371,
-    0.743666,
-    0.742752,
-    0.741653,
-    0.740398,
-    0.739019,
-    0.73755,
-    0.736028,
-    0.734491,
-    0.732976,
-    0.731524,
-    0.73017,
-    0.728951,
-    0.727899,
-    0.727045,
-    0.726416,
-    0.726033,
-    0.725915,
-    0.726073,
-    0.726515,
-    0.727243,
-    0.728252,
-    0.729532,
-    0.73107,
-    0.732844,
-    0.734829,
-    0.736997,
-    0.739313,
-    0.741742,
-    0.744245,
-    0.746781,
-    0.749308,
-    0.751785,
-    0.75417,
-    0.756425,
-    0.758511,
-    0.760395,
-    0.762045,
-    0.763436,
-    0.764547,
-    0.76536,
-    0.765867,
-    0.766063,
-    0.76595,
-    0.765535,
-    0.764833,
-    0.763863,
-    0.762651,
-    0.761226,
-    0.759624,
-    0.757882,
-    0.756043,
-    0.754149,
-    0.752246,
-    0.75038,
-    0.748597,
-    0.746939,
-    0.74545,
-    0.744169,
-    0.74313,
-    0.742364,
-    0.741898,
-    0.741752,
-    0.741939,
-    0.742466,
-    0.743335,
-    0.744541,
-    0.746069,
-    0.747901,
-    0.750012,
-    0.752372,
-    0.754943,
-    0.757685,
-    0.760554,
-    0.763503,
-    0.766482,
-    0.769441,
-    0.77233,
-    0.775098,
-    0.777699,
-    0.780087,
-    0.782221,
-    0.784066,
-    0.78559,
-    0.786768,
-    0.787582,
-    0.78802,
-    0.788078,
-    0.787759,
-    0.787075,
-    0.786042,
-    0.784687,
-    0.783041,
-    0.781142,
-    0.779032,
-    0.776761,
-    0.774379,
-    0.77194,
-    0.769501,
-    0.767117,
-    0.764845,
-    0.762739,
-    0.76085,
-    0.759228,
-    0.757914,
-    0.756946,
-    0.756356,
-    0.756167,
-    0.756397,
-    0.757052,
-    0.758135,
-    0.759635,
-    0.761536,
-    0.763814,
-    0.766436,
-    0.769362,
-    0.772547,
-    0.775938,
-    0.779479,
-    0.783109,
-    0.786768,
-    0.79039,
-    0.793911,
-    0.79727,
-    0.800406,
-    0.803262,
-    0.805786,
-    0.807934,
-    0.809665,
-    0.810949,
-    0.811762,
-    0.812092,
-    0.811933,
-    0.81129,
-    0.810178,
-    0.808622,
-    0.806655,
-    0.804318,
-    0.80166,
-    0.798739,
-    0.795617,
-    0.792362,
-    0.789043,
-    0.785735,
-    0.782511,
-    0.779445,
-    0.776607,
-    0.774065,
-    0.771883,
-    0.770116,
-    0.768815,
-    0.768019,
-    0.767761,
-    0.768061,
-    0.768931,
-    0.77037,
-    0.772366,
-    0.774896,
-    0.777927,
-    0.781415,
-    0.785306,
-    0.789537,
-    0.794039,
-    0.798734,
-    0.803541,
-    0.808374,
-    0.813147,
-    0.817773,
-    0.822164,
-    0.826238,
-    0.829918,
-    0.833132,
-    0.835817,
-    0.837917,
-    0.83939,
-    0.840203,
-    0.840337,
-    0.839785,
-    0.838554,
-    0.836663,
-    0.834148,
-    0.831053,
-    0.827438,
-    0.823372,
-    0.818937,
-    0.814222,
-    0.809322,
-    0.80434,
-    0.799381,
-    0.794552,
-    0.789961,
-    0.785712,
-    0.781904,
-    0.778632,
-    0.775979,
-    0.77402,
-    0.772818,
-    0.772421,
-    0.772864,
-    0.774164,
-    0.776325,
-    0.77933,
-    0.783149,
-    0.787733,
-    0.793016,
-    0.79892,
-    0.80535,
-    0.8122,
-    0.819351,
-    0.826678,
-    0.834047,
-    0.841321,
-    0.84836,
-    0.855027,
-    0.861186,
-    0.866709,
-    0.871477,
-    0.875382,
-    0.878328,
-    0.880237,
-    0.881049,
-    0.880724,
-    0.87924,
-    0.876601,
-    0.87283,
-    0.867976,
-    0.862109,
-    0.85532,
-    0.847723,
-    0.83945,
-    0.830653,
-    0.821496,
-    0.812158,
-    0.802829,
-    0.793703,
-    0.784981,
-    0.77686,
-    0.769536,
-    0.763196,
-    0.758016,
-    0.754158,
-    0.751765,
-    0.750956,
-    0.751829,
-    0.754451,
-    0.75886,
-    0.765062,
-    0.773028,
-    0.782696,
-    0.793967,
-    0.806708,
-    0.82075,
-    0.835891,
-    0.851896,
-    0.868502,
-    0.885416,
-    0.902325,
-    0.918891,
-    0.934765,
-    0.949581,
-    0.96297,
-    0.97456,
-    0.98398,
-    0.99087,
-    0.99488,
-    0.995681,
-    0.992967,
-    0.986458,
-    0.97591,
-    0.961111,
-    0.941894,
-    0.91813,
-    0.889741,
-    0.856692,
-    0.819002,
-    0.776735,
-    0.730009,
-    0.678989,
-    0.623889,
-    0.56497,
-    0.502534,
-    0.436927,
-    0.368528,
-    0.297752,
-    0.225039,
-    0.150853,
-    0.0756761
-};
-
-// Top frequency: 44.1K * 0.0145125
-constexpr static std::array<float, 4096> wt_sawtooth_0x5 =
-{
-    0,
-    -0.0374532,
-    -0.0748449,
-    -0.112114,
-    -0.149199,
-    -0.186041,
-    -0.222578,
-    -0.258753,
-    -0.294508,
-    -0.329786,
-    -0.364533,
-    -0.398693,
-    -0.432217,
-    -0.465053,
-    -0.497153,
-    -0.528473,
-    -0.558967,
-    -0.588594,
-    -0.617316,
-    -0.645097,
-    -0.671902,
-    -0.697701,
-    -0.722465,
-    -0.74617,
-    -0.768793,
-    -0.790315,
-    -0.81072,
-    -0.829993,
-    -0.848126,
-    -0.865112,
-    -0.880945,
-    -0.895625,
-    -0.909155,
-    -0.921538,
-    -0.932784,
-    -0.942902,
-    -0.951907,
-    -0.959815,
-    -0.966645,
-    -0.972419,
-    -0.97716,
-    -0.980895,
-    -0.983654,
-    -0.985466,
-    -0.986364,
-    -0.986385,
-    -0.985563,
-    -0.983937,
-    -0.981547,
-    -0.978434,
-    -0.974639,
-    -0.970207,
-    -0.96518,
-    -0.959603,
-    -0.953522,
-    -0.946983,
-    -0.94003,
-    -0.93271,
-    -0.925069,
-    -0.917152,
-    -0.909005,
-    -0.900671,
-    -0.892196,
-    -0.883621,
-    -0.874991,
-    -0.866344,
-    -0.857722,
-    -0.849163,
-    -0.840705,
-    -0.832382,
-    -0.824229,
-    -0.816279,
-    -0.808561,
-    -0.801105,
-    -0.793936,
-    -0.787081,
-    -0.780561,
-    -0.774398,
-    -0.768609,
-    -0.76321,
-    -0.758217,
-    -0.75364,
-    -0.749491,
-    -0.745775,
-    -0.742499,
-    -0.739667,
-    -0.737279,
-    -0.735335,
-    -0.733831,
-    -0.732764,
-    -0.732126,
-    -0.73191,
-    -0.732104,
-    -0.732698,
-    -0.733678,
-    -0.735028,
-    -0.736733,
-    -0.738776,
-    -0.741136,
-    -0.743796,
-    -0.746732,
-    -0.749925,
-    -0.753352,
-    -0.756989,
-    -0.760813,
-    -0.7648,
-    -0.768925,
-    -0.773165,
-    -0.777494,
-    -0.781888,
-    -0.786322,
-    -0.790773,
-    -0.795217,
-    -0.79963,
-    -0.803989,
-    -0.808273,
-    -0.81246,
-    -0.81653,
-    -0.820462,
-    -0.824239,
-    -0.827842,
-    -0.831254,
-    -0.834462,
-    -0.83745,
-    -0.840206,
-    -0.842717,
-    -0.844974,
-    -0.846968,
-    -0.848691,
-    -0.850138,
-    -0.851303,
-    -0.852182,
-    -0.852775,
-    -0.85308,
-    -0.853099,
-    -0.852833,
-    -0.852287,
-    -0.851463,
-    -0.85037,
-    -0.849013,
-    -0.847402,
-    -0.845545,
-    -0.843452,
-    -0.841137,
-    -0.83861,
-    -0.835884,
-    -0.832974,
-    -0.829895,
-    -0.82666,
-    -0.823287,
-    -0.819791,
-    -0.816189,
-    -0.812497,
-    -0.808733,
-    -0.804913,
-    -0.801056,
-    -0.797177,
-    -0.793294,
-    -0.789425,
-    -0.785584,
-    -0.781789,
-    -0.778056,
-    -0.774399,
-    -0.770834,
-    -0.767374,
-    -0.764033,
-    -0.760824,
-    -0.757759,
-    -0.754848,
-    -0.752102,
-    -0.749531,
-    -0.747142,
-    -0.744944,
-    -0.742942,
-    -0.741142,
-    -0.739549,
-    -0.738166,
-    -0.736994,
-    -0.736036,
-    -0.735292,
-    -0.734761,
-    -0.73444,
-    -0.734328,
-    -0.734421,
-    -0.734713,
-    -0.7352,
-    -0.735874,
-    -0.736729,
-    -0.737757,
-    -0.738948,
-    -0.740294,
-    -0.741783,
-    -0.743406,
-    -0.745151,
-    -0.747006,
-    -0.748959,
-    -0.750998,
-    -0.753111,
-    -0.755283,
-    -0.757502,
-    -0.759754,
-    -0.762027,
-    -0.764307,
-    -0.766581,
-    -0.768836,
-    -0.77106,
-    -0.773239,
-    -0.775362,
-    -0.777416,
-    -0.779392,
-    -0.781276,
-    -0.783061,
-    -0.784735,
-    -0.786289,
-    -0.787716,
-    -0.789007,
-    -0.790155,
-    -0.791155,
-    -0.792,
-    -0.792685,
-    -0.793208,
-    -0.793565,
-    -0.793753,
-    -0.793772,
-    -0.79362,
-    -0.793298,
-    -0.792806,
-    -0.792148,
-    -0.791324,
-    -0.79034,
-    -0.789198,
-    -0.787904,
-    -0.786463,
-    -0.784882,
-    -0.783167,
-    -0.781326,
-    -0.779366,
-    -0.777297,
-    -0.775127,
-    -0.772865,
-    -0.770522,
-    -0.768107,
-    -0.76563,
-    -0.763102,
-    -0.760534,
-    -0.757936,
-    -0.755319,
-    -0.752695,
-    -0.750073,
-    -0.747465,
-    -0.74488,
-    -0.74233,
-    -0.739824,
-    -0.737373,
-    -0.734985,
-    -0.73267,
-    -0.730436,
-    -0.728292,
-    -0.726245,
-    -0.724302,
-    -0.722471,
-    -0.720756,
-    -0.719164,
-    -0.717699,
-    -0.716366,
-    -0.715167,
-    -0.714106,
-    -0.713184,
-    -0.712404,
-    -0.711766,
-    -0.711269,
-    -0.710914,
-    -0.710699,
-    -0.710622,
-    -0.71068,
-    -0.71087,
-    -0.711189,
-    -0.711631,
-    -0.712192,
-    -0.712865,
-    -0.713646,
-    -0.714527,
-    -0.715502,
-    -0.716563,
-    -0.717702,
-    -0.718911,
-    -0.720182,
-    -0.721506,
-    -0.722874,
-    -0.724278,
-    -0.725708,
-    -0.727156,
-    -0.728611,
-    -0.730066,
-    -0.73151,
-    -0.732935,
-    -0.734333,
-    -0.735693,
-    -0.737009,
-    -0.738272,
-    -0.739474,
-    -0.740607,
-    -0.741666,
-    -0.742642,
-    -0.74353,
-    -0.744324,
-    -0.745018,
-    -0.745609,
-    -0.746091,
-    -0.746462,
-    -0.746717,
-    -0.746855,
-    -0.746873,
-    -0.746771,
-    -0.746546,
-    -0.7462,
-    -0.745733,
-    -0.745145,
-    -0.744438,
-    -0.743615,
-    -0.742677,
-    -0.741629,
-    -0.740474,
-    -0.739216,
-    -0.73786,
-    -0.736411,
-    -0.734874,
-    -0.733256,
-    -0.731564,
-    -0.729802,
-    -0.72798,
-    -0.726102,
-    -0.724178,
-    -0.722215,
-    -0.72022,
-    -0.718202,
-    -0.716168,
-    -0.714125,
-    -0.712083,
-    -0.710049,
-    -0.708031,
-    -0.706036,
-    -0.704072,
-    -0.702147,
-    -0.700267,
-    -0.698439,
-    -0.696671,
-    -0.694967,
-    -0.693334,
-    -0.691778,
-    -0.690303,
-    -0.688915,
-    -0.687617,
-    -0.686414,
-    -0.685308,
-    -0.684302,
-    -0.6834,
-    -0.682601,
-    -0.681909,
-    -0.681323,
-    -0.680844,
-    -0.680472,
-    -0.680205,
-    -0.680043,
-    -0.679983,
-    -0.680024,
-    -0.680163,
-    -0.680396,
-    -0.680719,
-    -0.68113,
-    -0.681622,
-    -0.682192,
-    -0.682835,
-    -0.683544,
-    -0.684313,
-    -0.685138,
-    -0.686011,
-    -0.686926,
-    -0.687876,
-    -0.688855,
-    -0.689855,
-    -0.69087,
-    -0.691892,
-    -0.692915,
-    -0.693931,
-    -0.694934,
-    -0.695917,
-    -0.696873,
-    -0.697795,
-    -0.698678,
-    -0.699514,
-    -0.700299,
-    -0.701027,
-    -0.701692,
-    -0.702289,
-    -0.702814,
-    -0.703263,
-    -0.703632,
-    -0.703917,
-    -0.704116,
-    -0.704225,
-    -0.704243,
-    -0.704168,
-    -0.703999,
-    -0.703735,
-    -0.703375,
-    -0.702921,
-    -0.702372,
-    -0.70173,
-    -0.700997,
-    -0.700173,
-    -0.699262,
-    -0.698267,
-    -0.69719,
-    -0.696035,
-    -0.694806,
-    -0.693508,
-    -0.692145,
-    -0.690722,
-    -0.689245,
-    -0.687717,
-    -0.686146,
-    -0.684537,
-    -0.682896,
-    -0.681229,
-    -0.679542,
-    -0.677841,
-    -0.676134,
-    -0.674425,
-    -0.672722,
-    -0.67103,
-    -0.669357,
-    -0.667707,
-    -0.666086,
-    -0.664502,
-    -0.662958,
-    -0.66146,
-    -0.660013,
-    -0.658623,
-    -0.657293,
-    -0.656028,
-    -0.654831,
-    -0.653706,
-    -0.652657,
-    -0.651685,
-    -0.650794,
-    -0.649985,
-    -0.64926,
-    -0.64862,
-    -0.648065,
-    -0.647596,
-    -0.647213,
-    -0.646916,
-    -0.646703,
-    -0.646573,
-    -0.646524,
-    -0.646554,
-    -0.646661,
-    -0.646842,
-    -0.647094,
-    -0.647412,
-    -0.647794,
-    -0.648235,
-    -0.64873,
-    -0.649276,
-    -0.649867,
-    -0.650497,
-    -0.651163,
-    -0.651858,
-    -0.652576,
-    -0.653313,
-    -0.654063,
-    -0.654819,
-    -0.655577,
-    -0.65633,
-    -0.657073,
-    -0.6578,
-    -0.658506,
-    -0.659185,
-    -0.659832,
-    -0.660442,
-    -0.66101,
-    -0.661532,
-    -0.662004,
-    -0.66242,
-    -0.662778,
-    -0.663073,
-    -0.663303,
-    -0.663465,
-    -0.663555,
-    -0.663573,
-    -0.663516,
-    -0.663382,
-    -0.663171,
-    -0.662882,
-    -0.662515,
-    -0.662069,
-    -0.661545,
-    -0.660944,
-    -0.660267,
-    -0.659516,
-    -0.658692,
-    -0.657798,
-    -0.656837,
-    -0.65581,
-    -0.654723,
-    -0.653577,
-    -0.652377,
-    -0.651127,
-    -0.64983,
-    -0.648493,
-    -0.647118,
-    -0.645711,
-    -0.644277,
-    -0.642821,
-    -0.641348,
-    -0.639863,
-    -0.638372,
-    -0.636879,
-    -0.63539,
-    -0.63391,
-    -0.632445,
-    -0.630999,
-    -0.629577,
-    -0.628184,
-    -0.626825,
-    -0.625503,
-    -0.624225,
-    -0.622993,
-    -0.621811,
-    -0.620682,
-    -0.619611,
-    -0.6186,
-    -0.617652,
-    -0.616768,
-    -0.615952,
-    -0.615205,
-    -0.614527,
-    -0.613921,
-    -0.613387,
-    -0.612925,
-    -0.612536,
-    -0.612218,
-    -0.611971,
-    -0.611794,
-    -0.611686,
-    -0.611644,
-    -0.611668,
-    -0.611754,
-    -0.611899,
-    -0.612102,
-    -0.612358,
-    -0.612664,
-    -0.613017,
-    -0.613413,
-    -0.613847,
-    -0.614315,
-    -0.614813,
-    -0.615337,
-    -0.615881,
-    -0.616441,
-    -0.617012,
-    -0.61759,
-    -0.618169,
-    -0.618744,
-    -0.619312,
-    -0.619866,
-    -0.620403,
-    -0.620917,
-    -0.621405,
-    -0.621862,
-    -0.622283,
-    -0.622666,
-    -0.623006,
-    -0.623299,
-    -0.623543,
-    -0.623734,
-    -0.623869,
-    -0.623947,
-    -0.623964,
-    -0.623919,
-    -0.623811,
-    -0.623637,
-    -0.623398,
-    -0.623091,
-    -0.622718,
-    -0.622278,
-    -0.621771,
-    -0.621198,
-    -0.620561,
-    -0.619859,
-    -0.619096,
-    -0.618272,
-    -0.61739,
-    -0.616452,
-    -0.615461,
-    -0.614421,
-    -0.613334,
-    -0.612203,
-    -0.611032,
-    -0.609826,
-    -0.608588,
-    -0.607321,
-    -0.606031,
-    -0.604722,
-    -0.603397,
-    -0.602062,
-    -0.600721,
-    -0.599379,
-    -0.598039,
-    -0.596707,
-    -0.595387,
-    -0.594083,
-    -0.592799,
-    -0.591541,
-    -0.590311,
-    -0.589113,
-    -0.587952,
-    -0.586831,
-    -0.585752,
-    -0.58472,
-    -0.583737,
-    -0.582806,
-    -0.581928,
-    -0.581107,
-    -0.580344,
-    -0.57964,
-    -0.578996,
-    -0.578414,
-    -0.577895,
-    -0.577438,
-    -0.577043,
-    -0.576711,
-    -0.57644,
-    -0.57623,
-    -0.576079,
-    -0.575987,
-    -0.575951,
-    -0.575969,
-    -0.57604,
-    -0.57616,
-    -0.576327,
-    -0.576537,
-    -0.576789,
-    -0.577078,
-    -0.5774,
-    -0.577753,
-    -0.578131,
-    -0.578533,
-    -0.578952,
-    -0.579386,
-    -0.579829,
-    -0.580279,
-    -0.58073,
-    -0.581178,
-    -0.58162,
-    -0.58205,
-    -0.582466,
-    -0.582862,
-    -0.583236,
-    -0.583582,
-    -0.583898,
-    -0.584181,
-    -0.584426,
-    -0.584631,
-    -0.584792,
-    -0.584908,
-    -0.584976,
-    -0.584992,
-    -0.584957,
-    -0.584867,
-    -0.584721,
-    -0.584519,
-    -0.584258,
-    -0.58394,
-    -0.583563,
-    -0.583127,
-    -0.582632,
-    -0.58208,
-    -0.581471,
-    -0.580806,
-    -0.580086,
-    -0.579313,
-    -0.578489,
-    -0.577615,
-    -0.576696,
-    -0.575732,
-    -0.574727,
-    -0.573683,
-    -0.572604,
-    -0.571494,
-    -0.570355,
-    -0.569191,
-    -0.568006,
-    -0.566803,
-    -0.565588,
-    -0.564362,
-    -0.563131,
-    -0.561899,
-    -0.560669,
-    -0.559445,
-    -0.558231,
-    -0.557032,
-    -0.55585,
-    -0.55469,
-    -0.553555,
-    -0.552448,
-    -0.551374,
-    -0.550334,
-    -0.549332,
-    -0.54837,
-    -0.547452,
-    -0.54658,
-    -0.545754,
-    -0.544979,
-    -0.544254,
-    -0.543582,
-    -0.542964,
-    -0.5424,
-    -0.541891,
-    -0.541437,
-    -0.541039,
-    -0.540696,
-    -0.540407,
-    -0.540172,
-    -0.539991,
-    -0.53986,
-    -0.53978,
-    -0.539749,
-    -0.539763,
-    -0.539822,
-    -0.539923,
-    -0.540062,
-    -0.540238,
-    -0.540447,
-    -0.540687,
-    -0.540953,
-    -0.541243,
-    -0.541553,
-    -0.541879,
-    -0.542219,
-    -0.542567,
-    -0.542921,
-    -0.543277,
-    -0.54363,
-    -0.543978,
-    -0.544316,
-    -0.54464,
-    -0.544948,
-    -0.545236,
-    -0.5455,
-    -0.545737,
-    -0.545945,
-    -0.546119,
-    -0.546257,
-    -0.546358,
-    -0.546417,
-    -0.546433,
-    -0.546404,
-    -0.546329,
-    -0.546205,
-    -0.546032,
-    -0.545808,
-    -0.545532,
-    -0.545204,
-    -0.544824,
-    -0.544391,
-    -0.543906,
-    -0.543369,
-    -0.542782,
-    -0.542144,
-    -0.541457,
-    -0.540722,
-    -0.539942,
-    -0.539118,
-    -0.538251,
-    -0.537345,
-    -0.536402,
-    -0.535425,
-    -0.534415,
-    -0.533377,
-    -0.532314,
-    -0.531228,
-    -0.530122,
-    -0.529001,
-    -0.527868,
-    -0.526726,
-    -0.525579,
-    -0.52443,
-    -0.523283,
-    -0.522141,
-    -0.521008,
-    -0.519888,
-    -0.518784,
-    -0.517699,
-    -0.516636,
-    -0.515598,
-    -0.514589,
-    -0.513612,
-    -0.512668,
-    -0.51176,
-    -0.510892,
-    -0.510064,
-    -0.509279,
-    -0.508538,
-    -0.507843,
-    -0.507195,
-    -0.506596,
-    -0.506046,
-    -0.505545,
-    -0.505094,
-    -0.504692,
-    -0.504341,
-    -0.504039,
-    -0.503785,
-    -0.503579,
-    -0.50342,
-    -0.503306,
-    -0.503236,
-    -0.503208,
-    -0.503219,
-    -0.503269,
-    -0.503354,
-    -0.503472,
-    -0.50362,
-    -0.503795,
-    -0.503995,
-    -0.504217,
-    -0.504457,
-    -0.504712,
-    -0.504978,
-    -0.505254,
-    -0.505534,
-    -0.505816,
-    -0.506096,
-    -0.506371,
-    -0.506638,
-    -0.506893,
-    -0.507133,
-    -0.507354,
-    -0.507555,
-    -0.507731,
-    -0.50788,
-    -0.508,
-    -0.508087,
-    -0.50814,
-    -0.508155,
-    -0.508132,
-    -0.508068,
-    -0.507962,
-    -0.507812,
-    -0.507617,
-    -0.507376,
-    -0.507089,
-    -0.506754,
-    -0.506371,
-    -0.505941,
-    -0.505463,
-    -0.504939,
-    -0.504368,
-    -0.503751,
-    -0.50309,
-    -0.502385,
-    -0.501639,
-    -0.500852,
-    -0.500028,
-    -0.499167,
-    -0.498272,
-    -0.497346,
-    -0.496391,
-    -0.495409,
-    -0.494404,
-    -0.493379,
-    -0.492336,
-    -0.491278,
-    -0.490209,
-    -0.489132,
-    -0.48805,
-    -0.486966,
-    -0.485883,
-    -0.484806,
-    -0.483737,
-    -0.482678,
-    -0.481634,
-    -0.480608,
-    -0.479601,
-    -0.478618,
-    -0.47766,
-    -0.476731,
-    -0.475833,
-    -0.474967,
-    -0.474137,
-    -0.473344,
-    -0.47259,
-    -0.471877,
-    -0.471205,
-    -0.470577,
-    -0.469992,
-    -0.469452,
-    -0.468958,
-    -0.468508,
-    -0.468105,
-    -0.467747,
-    -0.467434,
-    -0.467166,
-    -0.466941,
-    -0.466759,
-    -0.466618,
-    -0.466518,
-    -0.466456,
-    -0.466431,
-    -0.46644,
-    -0.466482,
-    -0.466554,
-    -0.466654,
-    -0.466779,
-    -0.466927,
-    -0.467095,
-    -0.467279,
-    -0.467478,
-    -0.467688,
-    -0.467905,
-    -0.468127,
-    -0.468351,
-    -0.468574,
-    -0.468792,
-    -0.469002,
-    -0.469202,
-    -0.469388,
-    -0.469558,
-    -0.469708,
-    -0.469836,
-    -0.46994,
-    -0.470016,
-    -0.470063,
-    -0.470078,
-    -0.470059,
-    -0.470005,
-    -0.469913,
-    -0.469783,
-    -0.469612,
-    -0.4694,
-    -0.469146,
-    -0.468849,
-    -0.468508,
-    -0.468124,
-    -0.467696,
-    -0.467224,
-    -0.466709,
-    -0.466151,
-    -0.465552,
-    -0.464911,
-    -0.46423,
-    -0.463511,
-    -0.462754,
-    -0.461963,
-    -0.461138,
-    -0.460282,
-    -0.459396,
-    -0.458484,
-    -0.457547,
-    -0.456589,
-    -0.455612,
-    -0.454618,
-    -0.45361,
-    -0.452592,
-    -0.451567,
-    -0.450537,
-    -0.449505,
-    -0.448474,
-    -0.447447,
-    -0.446428,
-    -0.445419,
-    -0.444423,
-    -0.443443,
-    -0.442482,
-    -0.441541,
-    -0.440625,
-    -0.439734,
-    -0.438872,
-    -0.43804,
-    -0.437241,
-    -0.436476,
-    -0.435747,
-    -0.435055,
-    -0.434402,
-    -0.433788,
-    -0.433215,
-    -0.432684,
-    -0.432194,
-    -0.431747,
-    -0.431341,
-    -0.430978,
-    -0.430657,
-    -0.430376,
-    -0.430136,
-    -0.429936,
-    -0.429774,
-    -0.429649,
-    -0.42956,
-    -0.429505,
-    -0.429483,
-    -0.42949,
-    -0.429526,
-    -0.429587,
-    -0.429672,
-    -0.429778,
-    -0.429903,
-    -0.430043,
-    -0.430197,
-    -0.43036,
-    -0.430531,
-    -0.430707,
-    -0.430885,
-    -0.431061,
-    -0.431233,
-    -0.431398,
-    -0.431554,
-    -0.431697,
-    -0.431825,
-    -0.431935,
-    -0.432024,
-    -0.432091,
-    -0.432133,
-    -0.432147,
-    -0.432132,
-    -0.432086,
-    -0.432007,
-    -0.431893,
-    -0.431743,
-    -0.431556,
-    -0.43133,
-    -0.431065,
-    -0.430761,
-    -0.430416,
-    -0.43003,
-    -0.429604,
-    -0.429137,
-    -0.42863,
-    -0.428082,
-    -0.427496,
-    -0.426872,
-    -0.42621,
-    -0.425513,
-    -0.424781,
-    -0.424016,
-    -0.42322,
-    -0.422395,
-    -0.421542,
-    -0.420665,
-    -0.419764,
-    -0.418844,
-    -0.417905,
-    -0.416951,
-    -0.415984,
-    -0.415008,
-    -0.414024,
-    -0.413035,
-    -0.412045,
-    -0.411056,
-    -0.410071,
-    -0.409092,
-    -0.408123,
-    -0.407166,
-    -0.406223,
-    -0.405298,
-    -0.404392,
-    -0.403509,
-    -0.402649,
-    -0.401816,
-    -0.401012,
-    -0.400237,
-    -0.399494,
-    -0.398785,
-    -0.398111,
-    -0.397473,
-    -0.396872,
-    -0.396308,
-    -0.395784,
-    -0.395298,
-    -0.394851,
-    -0.394445,
-    -0.394077,
-    -0.393748,
-    -0.393458,
-    -0.393206,
-    -0.392991,
-    -0.392812,
-    -0.392667,
-    -0.392556,
-    -0.392477,
-    -0.392428,
-    -0.392408,
-    -0.392414,
-    -0.392444,
-    -0.392496,
-    -0.392568,
-    -0.392658,
-    -0.392762,
-    -0.392879,
-    -0.393006,
-    -0.393139,
-    -0.393277,
-    -0.393417,
-    -0.393556,
-    -0.393691,
-    -0.39382,
-    -0.393939,
-    -0.394047,
-    -0.394141,
-    -0.394218,
-    -0.394277,
-    -0.394314,
-    -0.394327,
-    -0.394315,
-    -0.394276,
-    -0.394207,
-    -0.394107,
-    -0.393975,
-    -0.39381,
-    -0.393609,
-    -0.393373,
-    -0.393099,
-    -0.392789,
-    -0.39244,
-    -0.392054,
-    -0.391629,
-    -0.391166,
-    -0.390665,
-    -0.390127,
-    -0.389552,
-    -0.388941,
-    -0.388295,
-    -0.387615,
-    -0.386903,
-    -0.38616,
-    -0.385387,
-    -0.384587,
-    -0.383762,
-    -0.382913,
-    -0.382042,
-    -0.381152,
-    -0.380245,
-    -0.379323,
-    -0.37839,
-    -0.377446,
-    -0.376496,
-    -0.375542,
-    -0.374586,
-    -0.373631,
-    -0.372679,
-    -0.371734,
-    -0.370797,
-    -0.369871,
-    -0.36896,
-    -0.368064,
-    -0.367186,
-    -0.36633,
-    -0.365496,
-    -0.364687,
-    -0.363904,
-    -0.36315,
-    -0.362425,
-    -0.361733,
-    -0.361073,
-    -0.360446,
-    -0.359855,
-    -0.359299,
-    -0.35878,
-    -0.358298,
-    -0.357852,
-    -0.357444,
-    -0.357073,
-    -0.356738,
-    -0.35644,
-    -0.356178,
-    -0.35595,
-    -0.355757,
-    -0.355596,
-    -0.355468,
-    -0.355369,
-    -0.355298,
-    -0.355255,
-    -0.355237,
-    -0.355241,
-    -0.355267,
-    -0.355311,
-    -0.355372,
-    -0.355447,
-    -0.355534,
-    -0.35563,
-    -0.355733,
-    -0.35584,
-    -0.355949,
-    -0.356057,
-    -0.356162,
-    -0.35626,
-    -0.356351,
-    -0.35643,
-    -0.356496,
-    -0.356547,
-    -0.356579,
-    -0.356592,
-    -0.356582,
-    -0.356549,
-    -0.35649,
-    -0.356403,
-    -0.356287,
-    -0.35614,
-    -0.355961,
-    -0.35575,
-    -0.355504,
-    -0.355224,
-    -0.354908,
-    -0.354557,
-    -0.35417,
-    -0.353746,
-    -0.353286,
-    -0.352791,
-    -0.35226,
-    -0.351694,
-    -0.351094,
-    -0.350461,
-    -0.349796,
-    -0.3491,
-    -0.348375,
-    -0.347622,
-    -0.346843,
-    -0.346039,
-    -0.345213,
-    -0.344367,
-    -0.343502,
-    -0.342621,
-    -0.341726,
-    -0.34082,
-    -0.339904,
-    -0.338982,
-    -0.338056,
-    -0.337127,
-    -0.3362,
-    -0.335276,
-    -0.334358,
-    -0.333448,
-    -0.332548,
-    -0.331661,
-    -0.33079,
-    -0.329936,
-    -0.329101,
-    -0.328288,
-    -0.327498,
-    -0.326733,
-    -0.325996,
-    -0.325286,
-    -0.324607,
-    -0.323958,
-    -0.323342,
-    -0.322759,
-    -0.32221,
-    -0.321695,
-    -0.321215,
-    -0.32077,
-    -0.32036,
-    -0.319986,
-    -0.319647,
-    -0.319342,
-    -0.319072,
-    -0.318834,
-    -0.318629,
-    -0.318455,
-    -0.318311,
-    -0.318196,
-    -0.318108,
-    -0.318046,
-    -0.318008,
-    -0.317991,
-    -0.317995,
-    -0.318016,
-    -0.318053,
-    -0.318104,
-    -0.318166,
-    -0.318237,
-    -0.318315,
-    -0.318397,
-    -0.31848,
-    -0.318563,
-    -0.318643,
-    -0.318717,
-    -0.318783,
-    -0.318839,
-    -0.318882,
-    -0.318911,
-    -0.318923,
-    -0.318915,
-    -0.318887,
-    -0.318836,
-    -0.31876,
-    -0.318658,
-    -0.318529,
-    -0.31837,
-    -0.318181,
-    -0.31796,
-    -0.317708,
-    -0.317422,
-    -0.317102,
-    -0.316749,
-    -0.316361,
-    -0.315938,
-    -0.315481,
-    -0.31499,
-    -0.314465,
-    -0.313907,
-    -0.313316,
-    -0.312694,
-    -0.312041,
-    -0.311359,
-    -0.310648,
-    -0.309911,
-    -0.309149,
-    -0.308364,
-    -0.307557,
-    -0.30673,
-    -0.305886,
-    -0.305026,
-    -0.304154,
-    -0.30327,
-    -0.302377,
-    -0.301477,
-    -0.300574,
-    -0.299669,
-    -0.298765,
-    -0.297863,
-    -0.296967,
-    -0.296079,
-    -0.2952,
-    -0.294334,
-    -0.293483,
-    -0.292648,
-    -0.291831,
-    -0.291035,
-    -0.290261,
-    -0.289511,
-    -0.288787,
-    -0.28809,
-    -0.287422,
-    -0.286783,
-    -0.286174,
-    -0.285598,
-    -0.285054,
-    -0.284542,
-    -0.284064,
-    -0.28362,
-    -0.28321,
-    -0.282833,
-    -0.282489,
-    -0.282179,
-    -0.281901,
-    -0.281656,
-    -0.281441,
-    -0.281256,
-    -0.2811,
-    -0.280971,
-    -0.280869,
-    -0.280791,
-    -0.280736,
-    -0.280702,
-    -0.280688,
-    -0.28069,
-    -0.280708,
-    -0.280739,
-    -0.280781,
-    -0.280831,
-    -0.280888,
-    -0.280949,
-    -0.281012,
-    -0.281074,
-    -0.281133,
-    -0.281187,
-    -0.281233,
-    -0.28127,
-    -0.281295,
-    -0.281305,
-    -0.2813,
-    -0.281276,
-    -0.281232,
-    -0.281167,
-    -0.281078,
-    -0.280963,
-    -0.280823,
-    -0.280654,
-    -0.280456,
-    -0.280229,
-    -0.27997,
-    -0.27968,
-    -0.279357,
-    -0.279001,
-    -0.278613,
-    -0.278191,
-    -0.277737,
-    -0.277249,
-    -0.27673,
-    -0.276178,
-    -0.275595,
-    -0.274981,
-    -0.274338,
-    -0.273667,
-    -0.272969,
-    -0.272245,
-    -0.271497,
-    -0.270727,
-    -0.269935,
-    -0.269125,
-    -0.268298,
-    -0.267456,
-    -0.266601,
-    -0.265736,
-    -0.264862,
-    -0.263981,
-    -0.263097,
-    -0.262211,
-    -0.261325,
-    -0.260442,
-    -0.259564,
-    -0.258694,
-    -0.257833,
-    -0.256984,
-    -0.256149,
-    -0.255329,
-    -0.254527,
-    -0.253745,
-    -0.252984,
-    -0.252247,
-    -0.251534,
-    -0.250847,
-    -0.250187,
-    -0.249556,
-    -0.248954,
-    -0.248383,
-    -0.247842,
-    -0.247334,
-    -0.246858,
-    -0.246414,
-    -0.246002,
-    -0.245623,
-    -0.245277,
-    -0.244962,
-    -0.244678,
-    -0.244425,
-    -0.244203,
-    -0.244009,
-    -0.243842,
-    -0.243703,
-    -0.243589,
-    -0.243498,
-    -0.243429,
-    -0.243381,
-    -0.243352,
-    -0.243339,
-    -0.243341,
-    -0.243355,
-    -0.243381,
-    -0.243414,
-    -0.243454,
-    -0.243498,
-    -0.243543,
-    -0.243588,
-    -0.243631,
-    -0.243668,
-    -0.243698,
-    -0.243719,
-    -0.243729,
-    -0.243725,
-    -0.243705,
-    -0.243668,
-    -0.243612,
-    -0.243534,
-    -0.243434,
-    -0.24331,
-    -0.24316,
-    -0.242984,
-    -0.242779,
-    -0.242546,
-    -0.242282,
-    -0.241988,
-    -0.241663,
-    -0.241306,
-    -0.240917,
-    -0.240497,
-    -0.240044,
-    -0.23956,
-    -0.239044,
-    -0.238498,
-    -0.237921,
-    -0.237315,
-    -0.23668,
-    -0.236018,
-    -0.23533,
-    -0.234617,
-    -0.23388,
-    -0.233122,
-    -0.232344,
-    -0.231547,
-    -0.230734,
-    -0.229907,
-    -0.229067,
-    -0.228216,
-    -0.227357,
-    -0.226492,
-    -0.225623,
-    -0.224752,
-    -0.223882,
-    -0.223014,
-    -0.222151,
-    -0.221295,
-    -0.220449,
-    -0.219613,
-    -0.218791,
-    -0.217984,
-    -0.217195,
-    -0.216424,
-    -0.215674,
-    -0.214946,
-    -0.214241,
-    -0.213562,
-    -0.21291,
-    -0.212285,
-    -0.211688,
-    -0.211121,
-    -0.210584,
-    -0.210078,
-    -0.209603,
-    -0.209159,
-    -0.208747,
-    -0.208366,
-    -0.208017,
-    -0.207698,
-    -0.20741,
-    -0.207151,
-    -0.206922,
-    -0.20672,
-    -0.206546,
-    -0.206397,
-    -0.206273,
-    -0.206172,
-    -0.206092,
-    -0.206033,
-    -0.205991,
-    -0.205966,
-    -0.205954,
-    -0.205956,
-    -0.205967,
-    -0.205987,
-    -0.206013,
-    -0.206043,
-    -0.206075,
-    -0.206106,
-    -0.206135,
-    -0.206159,
-    -0.206176,
-    -0.206184,
-    -0.206181,
-    -0.206165,
-    -0.206135,
-    -0.206087,
-    -0.20602,
-    -0.205933,
-    -0.205825,
-    -0.205693,
-    -0.205536,
-    -0.205353,
-    -0.205143,
-    -0.204904,
-    -0.204637,
-    -0.20434,
-    -0.204013,
-    -0.203655,
-    -0.203266,
-    -0.202847,
-    -0.202396,
-    -0.201914,
-    -0.201402,
-    -0.20086,
-    -0.200288,
-    -0.199688,
-    -0.19906,
-    -0.198405,
-    -0.197725,
-    -0.197021,
-    -0.196294,
-    -0.195546,
-    -0.194778,
-    -0.193992,
-    -0.193191,
-    -0.192375,
-    -0.191546,
-    -0.190708,
-    -0.189861,
-    -0.189009,
-    -0.188152,
-    -0.187294,
-    -0.186436,
-    -0.18558,
-    -0.184729,
-    -0.183885,
-    -0.18305,
-    -0.182225,
-    -0.181414,
-    -0.180617,
-    -0.179837,
-    -0.179075,
-    -0.178333,
-    -0.177613,
-    -0.176916,
-    -0.176243,
-    -0.175596,
-    -0.174976,
-    -0.174384,
-    -0.17382,
-    -0.173286,
-    -0.172781,
-    -0.172307,
-    -0.171863,
-    -0.17145,
-    -0.171068,
-    -0.170716,
-    -0.170394,
-    -0.170102,
-    -0.169839,
-    -0.169604,
-    -0.169396,
-    -0.169215,
-    -0.169059,
-    -0.168927,
-    -0.168818,
-    -0.168729,
-    -0.16866,
-    -0.168609,
-    -0.168573,
-    -0.168552,
-    -0.168542,
-    -0.168543,
-    -0.168552,
-    -0.168567,
-    -0.168586,
-    -0.168607,
-    -0.168627,
-    -0.168645,
-    -0.168658,
-    -0.168665,
-    -0.168663,
-    -0.168651,
-    -0.168625,
-    -0.168585,
-    -0.168529,
-    -0.168455,
-    -0.16836,
-    -0.168245,
-    -0.168106,
-    -0.167944,
-    -0.167756,
-    -0.167542,
-    -0.1673,
-    -0.16703,
-    -0.166731,
-    -0.166402,
-    -0.166043,
-    -0.165655,
-    -0.165236,
-    -0.164786,
-    -0.164307,
-    -0.163797,
-    -0.163259,
-    -0.162691,
-    -0.162096,
-    -0.161473,
-    -0.160825,
-    -0.160151,
-    -0.159454,
-    -0.158735,
-    -0.157994,
-    -0.157235,
-    -0.156458,
-    -0.155665,
-    -0.154858,
-    -0.154039,
-    -0.15321,
-    -0.152374,
-    -0.151531,
-    -0.150684,
-    -0.149835,
-    -0.148987,
-    -0.148141,
-    -0.147299,
-    -0.146464,
-    -0.145638,
-    -0.144822,
-    -0.144018,
-    -0.143229,
-    -0.142457,
-    -0.141702,
-    -0.140967,
-    -0.140252,
-    -0.139561,
-    -0.138893,
-    -0.13825,
-    -0.137634,
-    -0.137045,
-    -0.136483,
-    -0.135951,
-    -0.135447,
-    -0.134974,
-    -0.13453,
-    -0.134116,
-    -0.133732,
-    -0.133378,
-    -0.133054,
-    -0.132759,
-    -0.132492,
-    -0.132253,
-    -0.13204,
-    -0.131854,
-    -0.131692,
-    -0.131554,
-    -0.131438,
-    -0.131342,
-    -0.131266,
-    -0.131207,
-    -0.131164,
-    -0.131134,
-    -0.131116,
-    -0.131109,
-    -0.131109,
-    -0.131116,
-    -0.131126,
-    -0.131138,
-    -0.13115,
-    -0.13116,
-    -0.131165,
-    -0.131164,
-    -0.131154,
-    -0.131134,
-    -0.131102,
-    -0.131055,
-    -0.130992,
-    -0.130912,
-    -0.130812,
-    -0.130691,
-    -0.130548,
-    -0.130382,
-    -0.13019,
-    -0.129972,
-    -0.129728,
-    -0.129456,
-    -0.129155,
-    -0.128826,
-    -0.128467,
-    -0.128078,
-    -0.12766,
-    -0.127212,
-    -0.126734,
-    -0.126227,
-    -0.125691,
-    -0.125127,
-    -0.124535,
-    -0.123917,
-    -0.123273,
-    -0.122605,
-    -0.121913,
-    -0.121199,
-    -0.120465,
-    -0.119712,
-    -0.118941,
-    -0.118155,
-    -0.117356,
-    -0.116544,
-    -0.115722,
-    -0.114893,
-    -0.114057,
-    -0.113218,
-    -0.112376,
-    -0.111535,
-    -0.110696,
-    -0.109862,
-    -0.109034,
-    -0.108214,
-    -0.107404,
-    -0.106607,
-    -0.105824,
-    -0.105057,
-    -0.104307,
-    -0.103576,
-    -0.102867,
-    -0.102179,
-    -0.101515,
-    -0.100875,
-    -0.100261,
-    -0.0996743,
-    -0.0991147,
-    -0.0985833,
-    -0.0980807,
-    -0.0976072,
-    -0.0971632,
-    -0.0967487,
-    -0.0963638,
-    -0.0960082,
-    -0.0956818,
-    -0.0953839,
-    -0.0951141,
-    -0.0948717,
-    -0.0946557,
-    -0.0944652,
-    -0.0942991,
-    -0.0941562,
-    -0.0940351,
-    -0.0939344,
-    -0.0938525,
-    -0.0937878,
-    -0.0937386,
-    -0.0937031,
-    -0.0936794,
-    -0.0936657,
-    -0.0936599,
-    -0.0936601,
-    -0.0936642,
-    -0.0936702,
-    -0.0936761,
-    -0.0936797,
-    -0.0936791,
-    -0.0936721,
-    -0.0936569,
-    -0.0936315,
-    -0.0935939,
-    -0.0935423,
-    -0.093475,
-    -0.0933903,
-    -0.0932865,
-    -0.0931622,
-    -0.0930158,
-    -0.0928462,
-    -0.0926521,
-    -0.0924325,
-    -0.0921863,
-    -0.0919128,
-    -0.0916113,
-    -0.0912812,
-    -0.0909221,
-    -0.0905338,
-    -0.0901161,
-    -0.089669,
-    -0.0891927,
-    -0.0886875,
-    -0.0881538,
-    -0.0875922,
-    -0.0870035,
-    -0.0863884,
-    -0.0857479,
-    -0.0850832,
-    -0.0843954,
-    -0.0836859,
-    -0.0829561,
-    -0.0822076,
-    -0.0814419,
-    -0.0806608,
-    -0.079866,
-    -0.0790595,
-    -0.078243,
-    -0.0774186,
-    -0.0765882,
-    -0.0757539,
-    -0.0749176,
-    -0.0740815,
-    -0.0732476,
-    -0.0724179,
-    -0.0715944,
-    -0.0707791,
-    -0.0699739,
-    -0.0691808,
-    -0.0684016,
-    -0.067638,
-    -0.0668917,
-    -0.0661643,
-    -0.0654574,
-    -0.0647723,
-    -0.0641104,
-    -0.0634728,
-    -0.0628606,
-    -0.0622748,
-    -0.0617162,
-    -0.0611855,
-    -0.0606831,
-    -0.0602097,
-    -0.0597653,
-    -0.0593501,
-    -0.0589642,
-    -0.0586074,
-    -0.0582794,
-    -0.0579797,
-    -0.0577078,
-    -0.0574629,
-    -0.0572443,
-    -0.0570509,
-    -0.0568817,
-    -0.0567355,
-    -0.0566109,
-    -0.0565066,
-    -0.0564209,
-    -0.0563524,
-    -0.0562992,
-    -0.0562597,
-    -0.0562319,
-    -0.056214,
-    -0.0562041,
-    -0.0562002,
-    -0.0562002,
-    -0.0562021,
-    -0.056204,
-    -0.0562037,
-    -0.0561992,
-    -0.0561886,
-    -0.0561699,
-    -0.0561411,
-    -0.0561003,
-    -0.0560457,
-    -0.0559756,
-    -0.0558883,
-    -0.0557821,
-    -0.0556556,
-    -0.0555074,
-    -0.0553361,
-    -0.0551406,
-    -0.0549198,
-    -0.0546727,
-    -0.0543986,
-    -0.0540967,
-    -0.0537665,
-    -0.0534076,
-    -0.0530197,
-    -0.0526026,
-    -0.0521564,
-    -0.0516813,
-    -0.0511774,
-    -0.0506453,
-    -0.0500855,
-    -0.0494987,
-    -0.0488857,
-    -0.0482476,
-    -0.0475854,
-    -0.0469002,
-    -0.0461934,
-    -0.0454665,
-    -0.0447209,
-    -0.0439582,
-    -0.0431802,
-    -0.0423886,
-    -0.0415851,
-    -0.0407718,
-    -0.0399505,
-    -0.0391233,
-    -0.038292,
-    -0.0374588,
-    -0.0366257,
-    -0.0357946,
-    -0.0349677,
-    -0.0341469,
-    -0.0333342,
-    -0.0325314,
-    -0.0317406,
-    -0.0309635,
-    -0.0302019,
-    -0.0294574,
-    -0.0287316,
-    -0.0280262,
-    -0.0273423,
-    -0.0266815,
-    -0.0260448,
-    -0.0254333,
-    -0.0248479,
-    -0.0242896,
-    -0.0237589,
-    -0.0232565,
-    -0.0227827,
-    -0.0223379,
-    -0.0219221,
-    -0.0215354,
-    -0.0211776,
-    -0.0208484,
-    -0.0205474,
-    -0.0202741,
-    -0.0200277,
-    -0.0198074,
-    -0.0196123,
-    -0.0194412,
-    -0.019293,
-    -0.0191664,
-    -0.01906,
-    -0.0189722,
-    -0.0189015,
-    -0.0188461,
-    -0.0188044,
-    -0.0187744,
-    -0.0187543,
-    -0.0187423,
-    -0.0187362,
-    -0.0187341,
-    -0.018734,
-    -0.0187339,
-    -0.0187318,
-    -0.0187255,
-    -0.0187132,
-    -0.0186929,
-    -0.0186625,
-    -0.0186204,
-    -0.0185646,
-    -0.0184933,
-    -0.018405,
-    -0.0182979,
-    -0.0181707,
-    -0.0180219,
-    -0.0178501,
-    -0.0176543,
-    -0.0174333,
-    -0.0171861,
-    -0.016912,
-    -0.0166103,
-    -0.0162804,
-    -0.0159219,
-    -0.0155346,
-    -0.0151181,
-    -0.0146727,
-    -0.0141984,
-    -0.0136954,
-    -0.0131643,
-    -0.0126056,
-    -0.0120199,
-    -0.0114082,
-    -0.0107713,
-    -0.0101103,
-    -0.00942644,
-    -0.00872101,
-    -0.00799541,
-    -0.00725115,
-    -0.00648982,
-    -0.00571311,
-    -0.00492277,
-    -0.00412062,
-    -0.00330854,
-    -0.00248846,
-    -0.00166234,
-    -0.000832183,
-    0,
-    0.000832183,
-    0.00166234,
-    0.00248846,
-    0.00330854,
-    0.00412062,
-    0.00492277,
-    0.00571311,
-    0.00648982,
-    0.00725115,
-    0.00799541,
-    0.00872101,
-    0.00942644,
-    0.0101103,
-    0.0107713,
-    0.0114082,
-    0.0120199,
-    0.0126056,
-    0.0131643,
-    0.0136954,
-    0.0141984,
-    0.0146727,
-    0.0151181,
-    0.0155346,
-    0.0159219,
-    0.0162804,
-    0.0166103,
-    0.016912,
-    0.0171861,
-    0.0174333,
-    0.0176543,
-    0.0178501,
-    0.0180219,
-    0.0181707,
-    0.0182979,
-    0.018405,
-    0.0184933,
-    0.0185646,
-    0.0186204,
-    0.0186625,
-    0.0186929,
-    0.0187132,
-    0.0187255,
-    0.0187318,
-    0.0187339,
-    0.018734,
-    0.0187341,
-    0.0187362,
-    0.0187423,
-    0.0187543,
-    0.0187744,
-    0.0188044,
-    0.0188461,
-    0.0189015,
-    0.0189722,
-    0.01906,
-    0.0191664,
-    0.019293,
-    0.0194412,
-    0.0196123,
-    0.0198074,
-    0.0200277,
-    0.0202741,
-    0.0205474,
-    0.0208484,
-    0.0211776,
-    0.0215354,
-    0.0219221,
-    0.0223379,
-    0.0227827,
-    0.0232565,
-    0.0237589,
-    0.0242896,
-    0.0248479,
-    0.0254333,
-    0.0260448,
-    0.0266815,
-    0.0273423,
-    0.0280262,
-    0.0287316,
-    0.0294574,
-    0.0302019,
-    0.0309635,
-    0.0317406,
-    0.0325314,
-    0.0333342,
-    0.0341469,
-    0.0349677,
-    0.0357946,
-    0.0366257,
-    0.0374588,
-    0.038292,
-    0.0391233,
-    0.0399505,
-    0.0407718,
-    0.0415851,
-    0.0423886,
-    0.0431802,
-    0.0439582,
-    0.0447209,
-    0.0454665,
-    0.0461934,
-    0.0469002,
-    0.0475854,
-    0.0482476,
-    0.0488857,
-    0.0494987,
-    0.0500855,
-    0.0506453,
-    0.0511774,
-    0.0516813,
-    0.0521564,
-    0.0526026,
-    0.0530197,
-    0.0534076,
-    0.0537665,
-    0.0540967,
-    0.0543986,
-    0.0546727,
-    0.0549198,
-    0.0551406,
-    0.0553361,
-    0.0555074,
-    0.0556556,
-    0.0557821,
-    0.0558883,
-    0.0559756,
-    0.0560457,
-    0.0561003,
-    0.0561411,
-    0.0561699,
-    0.0561886,
-    0.0561992,
-    0.0562037,
-    0.056204,
-    0.0562021,
-    0.0562002,
-    0.0562002,
-    0.0562041,
-    0.056214,
-    0.0562319,
-    0.0562597,
-    0.0562992,
-    0.0563524,
-    0.0564209,
-    0.0565066,
-    0.0566109,
-    0.0567355,
-    0.0568817,
-    0.0570509,
-    0.0572443,
-    0.0574629,
-    0.0577078,
-    0.0579797,
-    0.0582794,
-    0.0586074,
-    0.0589642,
-    0.0593501,
-    0.0597653,
-    0.0602097,
-    0.0606831,
-    0.0611855,
-    0.0617162,
-    0.0622748,
-    0.0628606,
-    0.0634728,
-    0.0641104,
-    0.0647723,
-    0.0654574,
-    0.0661643,
-    0.0668917,
-    0.067638,
-    0.0684016,
-    0.0691808,
-    0.0699739,
-    0.0707791,
-    0.0715944,
-    0.0724179,
-    0.0732476,
-    0.0740815,
-    0.0749176,
-    0.0757539,
-    0.0765882,
-    0.0774186,
-    0.078243,
-    0.0790595,
-    0.079866,
-    0.0806608,
-    0.0814419,
-    0.0822076,
-    0.0829561,
-    0.0836859,
-    0.0843954,
-    0.0850832,
-    0.0857479,
-    0.0863884,
-    0.0870035,
-    0.0875922,
-    0.0881538,
-    0.0886875,
-    0.0891927,
-    0.089669,
-    0.0901161,
-    0.0905338,
-    0.0909221,
-    0.0912812,
-    0.0916113,
-    0.0919128,
-    0.0921863,
-    0.0924325,
-    0.0926521,
-    0.0928462,
-    0.0930158,
-    0.0931622,
-    0.0932865,
-    0.0933903,
-    0.093475,
-    0.0935423,
-    0.0935939,
-    0.0936315,
-    0.0936569,
-    0.0936721,
-    0.0936791,
-    0.0936797,
-    0.0936761,
-    0.0936702,
-    0.0936642,
-    0.0936601,
-    0.0936599,
-    0.0936657,
-    0.0936794,
-    0.0937031,
-    0.0937386,
-    0.0937878,
-    0.0938525,
-    0.0939344,
-    0.0940351,
-    0.0941562,
-    0.0942991,
-    0.0944652,
-    0.0946557,
-    0.0948717,
-    0.0951141,
-    0.0953839,
-    0.0956818,
-    0.0960082,
-    0.0963638,
-    0.0967487,
-    0.0971632,
-    0.0976072,
-    0.0980807,
-    0.0985833,
-    0.0991147,
-    0.0996743,
-    0.100261,
-    0.100875,
-    0.101515,
-    0.102179,
-    0.102867,
-    0.103576,
-    0.104307,
-    0.105057,
-    0.105824,
-    0.106607,
-    0.107404,
-    0.108214,
-    0.109034,
-    0.109862,
-    0.110696,
-    0.111535,
-    0.112376,
-    0.113218,
-    0.114057,
-    0.114893,
-    0.115722,
-    0.116544,
-    0.117356,
-    0.118155,
-    0.118941,
-    0.119712,
-    0.120465,
-    0.121199,
-    0.121913,
-    0.122605,
-    0.123273,
-    0.123917,
-    0.124535,
-    0.125127,
-    0.125691,
-    0.126227,
-    0.126734,
-    0.127212,
-    0.12766,
-    0.128078,
-    0.128467,
-    0.128826,
-    0.129155,
-    0.129456,
-    0.129728,
-    0.129972,
-    0.13019,
-    0.130382,
-    0.130548,
-    0.130691,
-    0.130812,
-    0.130912,
-    0.130992,
-    0.131055,
-    0.131102,
-    0.131134,
-    0.131154,
-    0.131164,
-    0.131165,
-    0.13116,
-    0.13115,
-    0.131138,
-    0.131126,
-    0.131116,
-    0.131109,
-    0.131109,
-    0.131116,
-    0.131134,
-    0.131164,
-    0.131207,
-    0.131266,
-    0.131342,
-    0.131438,
-    0.131554,
-    0.131692,
-    0.131854,
-    0.13204,
-    0.132253,
-    0.132492,
-    0.132759,
-    0.133054,
-    0.133378,
-    0.133732,
-    0.134116,
-    0.13453,
-    0.134974,
-    0.135447,
-    0.135951,
-    0.136483,
-    0.137045,
-    0.137634,
-    0.13825,
-    0.138893,
-    0.139561,
-    0.140252,
-    0.140967,
-    0.141702,
-    0.142457,
-    0.143229,
-    0.144018,
-    0.144822,
-    0.145638,
-    0.146464,
-    0.147299,
-    0.148141,
-    0.148987,
-    0.149835,
-    0.150684,
-    0.151531,
-    0.152374,
-    0.15321,
-    0.154039,
-    0.154858,
-    0.155665,
-    0.156458,
-    0.157235,
-    0.157994,
-    0.158735,
-    0.159454,
-    0.160151,
-    0.160825,
-    0.161473,
-    0.162096,
-    0.162691,
-    0.163259,
-    0.163797,
-    0.164307,
-    0.164786,
-    0.165236,
-    0.165655,
-    0.166043,
-    0.166402,
-    0.166731,
-    0.16703,
-    0.1673,
-    0.167542,
-    0.167756,
-    0.167944,
-    0.168106,
-    0.168245,
-    0.16836,
-    0.168455,
-    0.168529,
-    0.168585,
-    0.168625,
-    0.168651,
-    0.168663,
-    0.168665,
-    0.168658,
-    0.168645,
-    0.168627,
-    0.168607,
-    0.168586,
-    0.168567,
-    0.168552,
-    0.168543,
-    0.168542,
-    0.168552,
-    0.168573,
-    0.168609,
-    0.16866,
-    0.168729,
-    0.168818,
-    0.168927,
-    0.169059,
-    0.169215,
-    0.169396,
-    0.169604,
-    0.169839,
-    0.170102,
-    0.170394,
-    0.170716,
-    0.171068,
-    0.17145,
-    0.171863,
-    0.172307,
-    0.172781,
-    0.173286,
-    0.17382,
-    0.174384,
-    0.174976,
-    0.175596,
-    0.176243,
-    0.176916,
-    0.177613,
-    0.178333,
-    0.179075,
-    0.179837,
-    0.180617,
-    0.181414,
-    0.182225,
-    0.18305,
-    0.183885,
-    0.184729,
-    0.18558,
-    0.186436,
-    0.187294,
-    0.188152,
-    0.189009,
-    0.189861,
-    0.190708,
-    0.191546,
-    0.192375,
-    0.193191,
-    0.193992,
-    0.194778,
-    0.195546,
-    0.196294,
-    0.197021,
-    0.197725,
-    0.198405,
-    0.19906,
-    0.199688,
-    0.200288,
-    0.20086,
-    0.201402,
-    0.201914,
-    0.202396,
-    0.202847,
-    0.203266,
-    0.203655,
-    0.204013,
-    0.20434,
-    0.204637,
-    0.204904,
-    0.205143,
-    0.205353,
-    0.205536,
-    0.205693,
-    0.205825,
-    0.205933,
-    0.20602,
-    0.206087,
-    0.206135,
-    0.206165,
-    0.206181,
-    0.206184,
-    0.206176,
-    0.206159,
-    0.206135,
-    0.206106,
-    0.206075,
-    0.206043,
-    0.206013,
-    0.205987,
-    0.205967,
-    0.205956,
-    0.205954,
-    0.205966,
-    0.205991,
-    0.206033,
-    0.206092,
-    0.206172,
-    0.206273,
-    0.206397,
-    0.206546,
-    0.20672,
-    0.206922,
-    0.207151,
-    0.20741,
-    0.207698,
-    0.208017,
-    0.208366,
-    0.208747,
-    0.209159,
-    0.209603,
-    0.210078,
-    0.210584,
-    0.211121,
-    0.211688,
-    0.212285,
-    0.21291,
-    0.213562,
-    0.214241,
-    0.214946,
-    0.215674,
-    0.216424,
-    0.217195,
-    0.217984,
-    0.218791,
-    0.219613,
-    0.220449,
-    0.221295,
-    0.222151,
-    0.223014,
-    0.223882,
-    0.224752,
-    0.225623,
-    0.226492,
-    0.227357,
-    0.228216,
-    0.229067,
-    0.229907,
-    0.230734,
-    0.231547,
-    0.232344,
-    0.233122,
-    0.23388,
-    0.234617,
-    0.23533,
-    0.236018,
-    0.23668,
-    0.237315,
-    0.237921,
-    0.238498,
-    0.239044,
-    0.23956,
-    0.240044,
-    0.240497,
-    0.240917,
-    0.241306,
-    0.241663,
-    0.241988,
-    0.242282,
-    0.242546,
-    0.242779,
-    0.242984,
-    0.24316,
-    0.24331,
-    0.243434,
-    0.243534,
-    0.243612,
-    0.243668,
-    0.243705,
-    0.243725,
-    0.243729,
-    0.243719,
-    0.243698,
-    0.243668,
-    0.243631,
-    0.243588,
-    0.243543,
-    0.243498,
-    0.243454,
-    0.243414,
-    0.243381,
-    0.243355,
-    0.243341,
-    0.243339,
-    0.243352,
-    0.243381,
-    0.243429,
-    0.243498,
-    0.243589,
-    0.243703,
-    0.243842,
-    0.244009,
-    0.244203,
-    0.244425,
-    0.244678,
-    0.244962,
-    0.245277,
-    0.245623,
-    0.246002,
-    0.246414,
-    0.246858,
-    0.247334,
-    0.247842,
-    0.248383,
-    0.248954,
-    0.249556,
-    0.250187,
-    0.250847,
-    0.251534,
-    0.252247,
-    0.252984,
-    0.253745,
-    0.254527,
-    0.255329,
-    0.256149,
-    0.256984,
-    0.257833,
-    0.258694,
-    0.259564,
-    0.260442,
-    0.261325,
-    0.262211,
-    0.263097,
-    0.263981,
-    0.264862,
-    0.265736,
-    0.266601,
-    0.267456,
-    0.268298,
-    0.269125,
-    0.269935,
-    0.270727,
-    0.271497,
-    0.272245,
-    0.272969,
-    0.273667,
-    0.274338,
-    0.274981,
-    0.275595,
-    0.276178,
-    0.27673,
-    0.277249,
-    0.277737,
-    0.278191,
-    0.278613,
-    0.279001,
-    0.279357,
-    0.27968,
-    0.27997,
-    0.280229,
-    0.280456,
-    0.280654,
-    0.280823,
-    0.280963,
-    0.281078,
-    0.281167,
-    0.281232,
-    0.281276,
-    0.2813,
-    0.281305,
-    0.281295,
-    0.28127,
-    0.281233,
-    0.281187,
-    0.281133,
-    0.281074,
-    0.281012,
-    0.280949,
-    0.280888,
-    0.280831,
-    0.280781,
-    0.280739,
-    0.280708,
-    0.28069,
-    0.280688,
-    0.280702,
-    0.280736,
-    0.280791,
-    0.280869,
-    0.280971,
-    0.2811,
-    0.281256,
-    0.281441,
-    0.281656,
-    0.281901,
-    0.282179,
-    0.282489,
-    0.282833,
-    0.28321,
-    0.28362,
-    0.284064,
-    0.284542,
-    0.285054,
-    0.285598,
-    0.286174,
-    0.286783,
-    0.287422,
-    0.28809,
-    0.288787,
-    0.289511,
-    0.290261,
-    0.291035,
-    0.291831,
-    0.292648,
-    0.293483,
-    0.294334,
-    0.2952,
-    0.296079,
-    0.296967,
-    0.297863,
-    0.298765,
-    0.299669,
-    0.300574,
-    0.301477,
-    0.302377,
-    0.30327,
-    0.304154,
-    0.305026,
-    0.305886,
-    0.30673,
-    0.307557,
-    0.308364,
-    0.309149,
-    0.309911,
-    0.310648,
-    0.311359,
-    0.312041,
-    0.312694,
-    0.313316,
-    0.313907,
-    0.314465,
-    0.31499,
-    0.315481,
-    0.315938,
-    0.316361,
-    0.316749,
-    0.317102,
-    0.317422,
-    0.317708,
-    0.31796,
-    0.318181,
-    0.31837,
-    0.318529,
-    0.318658,
-    0.31876,
-    0.318836,
-    0.318887,
-    0.318915,
-    0.318923,
-    0.318911,
-    0.318882,
-    0.318839,
-    0.318783,
-    0.318717,
-    0.318643,
-    0.318563,
-    0.31848,
-    0.318397,
-    0.318315,
-    0.318237,
-    0.318166,
-    0.318104,
-    0.318053,
-    0.318016,
-    0.317995,
-    0.317991,
-    0.318008,
-    0.318046,
-    0.318108,
-    0.318196,
-    0.318311,
-    0.318455,
-    0.318629,
-    0.318834,
-    0.319072,
-    0.319342,
-    0.319647,
-    0.319986,
-    0.32036,
-    0.32077,
-    0.321215,
-    0.321695,
-    0.32221,
-    0.322759,
-    0.323342,
-    0.323958,
-    0.324607,
-    0.325286,
-    0.325996,
-    0.326733,
-    0.327498,
-    0.328288,
-    0.329101,
-    0.329936,
-    0.33079,
-    0.331661,
-    0.332548,
-    0.333448,
-    0.334358,
-    0.335276,
-    0.3362,
-    0.337127,
-    0.338056,
-    0.338982,
-    0.339904,
-    0.34082,
-    0.341726,
-    0.342621,
-    0.343502,
-    0.344367,
-    0.345213,
-    0.346039,
-    0.346843,
-    0.347622,
-    0.348375,
-    0.3491,
-    0.349796,
-    0.350461,
-    0.351094,
-    0.351694,
-    0.35226,
-    0.352791,
-    0.353286,
-    0.353746,
-    0.35417,
-    0.354557,
-    0.354908,
-    0.355224,
-    0.355504,
-    0.35575,
-    0.355961,
-    0.35614,
-    0.356287,
-    0.356403,
-    0.35649,
-    0.356549,
-    0.356582,
-    0.356592,
-    0.356579,
-    0.356547,
-    0.356496,
-    0.35643,
-    0.356351,
-    0.35626,
-    0.356162,
-    0.356057,
-    0.355949,
-    0.35584,
-    0.355733,
-    0.35563,
-    0.355534,
-    0.355447,
-    0.355372,
-    0.355311,
-    0.355267,
-    0.355241,
-    0.355237,
-    0.355255,
-    0.355298,
-    0.355369,
-    0.355468,
-    0.355596,
-    0.355757,
-    0.35595,
-    0.356178,
-    0.35644,
-    0.356738,
-    0.357073,
-    0.357444,
-    0.357852,
-    0.358298,
-    0.35878,
-    0.359299,
-    0.359855,
-    0.360446,
-    0.361073,
-    0.361733,
-    0.362425,
-    0.36315,
-    0.363904,
-    0.364687,
-    0.365496,
-    0.36633,
-    0.367186,
-    0.368064,
-    0.36896,
-    0.369871,
-    0.370797,
-    0.371734,
-    0.372679,
-    0.373631,
-    0.374586,
-    0.375542,
-    0.376496,
-    0.377446,
-    0.37839,
-    0.379323,
-    0.380245,
-    0.381152,
-    0.382042,
-    0.382913,
-    0.383762,
-    0.384587,
-    0.385387,
-    0.38616,
-    0.386903,
-    0.387615,
-    0.388295,
-    0.388941,
-    0.389552,
-    0.390127,
-    0.390665,
-    0.391166,
-    0.391629,
-    0.392054,
-    0.39244,
-    0.392789,
-    0.393099,
-    0.393373,
-    0.393609,
-    0.39381,
-    0.393975,
-    0.394107,
-    0.394207,
-    0.394276,
-    0.394315,
-    0.394327,
-    0.394314,
-    0.394277,
-    0.394218,
-    0.394141,
-    0.394047,
-    0.393939,
-    0.39382,
-    0.393691,
-    0.393556,
-    0.393417,
-    0.393277,
-    0.393139,
-    0.393006,
-    0.392879,
-    0.392762,
-    0.392658,
-    0.392568,
-    0.392496,
-    0.392444,
-    0.392414,
-    0.392408,
-    0.392428,
-    0.392477,
-    0.392556,
-    0.392667,
-    0.392812,
-    0.392991,
-    0.393206,
-    0.393458,
-    0.393748,
-    0.394077,
-    0.394445,
-    0.394851,
-    0.395298,
-    0.395784,
-    0.396308,
-    0.396872,
-    0.397473,
-    0.398111,
-    0.398785,
-    0.399494,
-    0.400237,
-    0.401012,
-    0.401816,
-    0.402649,
-    0.403509,
-    0.404392,
-    0.405298,
-    0.406223,
-    0.407166,
-    0.408123,
-    0.409092,
-    0.410071,
-    0.411056,
-    0.412045,
-    0.413035,
-    0.414024,
-    0.415008,
-    0.415984,
-    0.416951,
-    0.417905,
-    0.418844,
-    0.419764,
-    0.420665,
-    0.421542,
-    0.422395,
-    0.42322,
-    0.424016,
-    0.424781,
-    0.425513,
-    0.42621,
-    0.426872,
-    0.427496,
-    0.428082,
-    0.42863,
-    0.429137,
-    0.429604,
-    0.43003,
-    0.430416,
-    0.430761,
-    0.431065,
-    0.43133,
-    0.431556,
-    0.431743,
-    0.431893,
-    0.432007,
-    0.432086,
-    0.432132,
-    0.432147,
-    0.432133,
-    0.432091,
-    0.432024,
-    0.431935,
-    0.431825,
-    0.431697,
-    0.431554,
-    0.431398,
-    0.431233,
-    0.431061,
-    0.430885,
-    0.430707,
-    0.430531,
-    0.43036,
-    0.430197,
-    0.430043,
-    0.429903,
-    0.429778,
-    0.429672,
-    0.429587,
-    0.429526,
-    0.42949,
-    0.429483,
-    0.429505,
-    0.42956,
-    0.429649,
-    0.429774,
-    0.429936,
-    0.430136,
-    0.430376,
-    0.430657,
-    0.430978,
-    0.431341,
-    0.431747,
-    0.432194,
-    0.432684,
-    0.433215,
-    0.433788,
-    0.434402,
-    0.435055,
-    0.435747,
-    0.436476,
-    0.437241,
-    0.43804,
-    0.438872,
-    0.439734,
-    0.440625,
-    0.441541,
-    0.442482,
-    0.443443,
-    0.444423,
-    0.445419,
-    0.446428,
-    0.447447,
-    0.448474,
-    0.449505,
-    0.450537,
-    0.451567,
-    0.452592,
-    0.45361,
-    0.454618,
-    0.455612,
-    0.456589,
-    0.457547,
-    0.458484,
-    0.459396,
-    0.460282,
-    0.461138,
-    0.461963,
-    0.462754,
-    0.463511,
-    0.46423,
-    0.464911,
-    0.465552,
-    0.466151,
-    0.466709,
-    0.467224,
-    0.467696,
-    0.468124,
-    0.468508,
-    0.468849,
-    0.469146,
-    0.4694,
-    0.469612,
-    0.469783,
-    0.469913,
-    0.470005,
-    0.470059,
-    0.470078,
-    0.470063,
-    0.470016,
-    0.46994,
-    0.469836,
-    0.469708,
-    0.469558,
-    0.469388,
-    0.469202,
-    0.469002,
-    0.468792,
-    0.468574,
-    0.468351,
-    0.468127,
-    0.467905,
-    0.467688,
-    0.467478,
-    0.467279,
-    0.467095,
-    0.466927,
-    0.466779,
-    0.466654,
-    0.466554,
-    0.466482,
-    0.46644,
-    0.466431,
-    0.466456,
-    0.466518,
-    0.466618,
-    0.466759,
-    0.466941,
-    0.467166,
-    0.467434,
-    0.467747,
-    0.468105,
-    0.468508,
-    0.468958,
-    0.469452,
-    0.469992,
-    0.470577,
-    0.471205,
-    0.471877,
-    0.47259,
-    0.473344,
-    0.474137,
-    0.474967,
-    0.475833,
-    0.476731,
-    0.47766,
-    0.478618,
-    0.479601,
-    0.480608,
-    0.481634,
-    0.482678,
-    0.483737,
-    0.484806,
-    0.485883,
-    0.486966,
-    0.48805,
-    0.489132,
-    0.490209,
-    0.491278,
-    0.492336,
-    0.493379,
-    0.494404,
-    0.495409,
-    0.496391,
-    0.497346,
-    0.498272,
-    0.499167,
-    0.500028,
-    0.500852,
-    0.501639,
-    0.502385,
-    0.50309,
-    0.503751,
-    0.504368,
-    0.504939,
-    0.505463,
-    0.505941,
-    0.506371,
-    0.506754,
-    0.507089,
-    0.507376,
-    0.507617,
-    0.507812,
-    0.507962,
-    0.508068,
-    0.508132,
-    0.508155,
-    0.50814,
-    0.508087,
-    0.508,
-    0.50788,
-    0.507731,
-    0.507555,
-    0.507354,
-    0.507133,
-    0.506893,
-    0.506638,
-    0.506371,
-    0.506096,
-    0.505816,
-    0.505534,
-    0.505254,
-    0.504978,
-    0.504712,
-    0.504457,
-    0.504217,
-    0.503995,
-    0.503795,
-    0.50362,
-    0.503472,
-    0.503354,
-    0.503269,
-    0.503219,
-    0.503208,
-    0.503236,
-    0.503306,
-    0.50342,
-    0.503579,
-    0.503785,
-    0.504039,
-    0.504341,
-    0.504692,
-    0.505094,
-    0.505545,
-    0.506046,
-    0.506596,
-    0.507195,
-    0.507843,
-    0.508538,
-    0.509279,
-    0.510064,
-    0.510892,
-    0.51176,
-    0.512668,
-    0.513612,
-    0.514589,
-    0.515598,
-    0.516636,
-    0.517699,
-    0.518784,
-    0.519888,
-    0.521008,
-    0.522141,
-    0.523283,
-    0.52443,
-    0.525579,
-    0.526726,
-    0.527868,
-    0.529001,
-    0.530122,
-    0.531228,
-    0.532314,
-    0.533377,
-    0.534415,
-    0.535425,
-    0.536402,
-    0.537345,
-    0.538251,
-    0.539118,
-    0.539942,
-    0.540722,
-    0.541457,
-    0.542144,
-    0.542782,
-    0.543369,
-    0.543906,
-    0.544391,
-    0.544824,
-    0.545204,
-    0.545532,
-    0.545808,
-    0.546032,
-    0.546205,
-    0.546329,
-    0.546404,
-    0.546433,
-    0.546417,
-    0.546358,
-    0.546257,
-    0.546119,
-    0.545945,
-    0.545737,
-    0.5455,
-    0.545236,
-    0.544948,
-    0.54464,
-    0.544316,
-    0.543978,
-    0.54363,
-    0.543277,
-    0.542921,
-    0.542567,
-    0.542219,
-    0.541879,
-    0.541553,
-    0.541243,
-    0.540953,
-    0.540687,
-    0.540447,
-    0.540238,
-    0.540062,
-    0.539923,
-    0.539822,
-    0.539763,
-    0.539749,
-    0.53978,
-    0.53986,
-    0.539991,
-    0.540172,
-    0.540407,
-    0.540696,
-    0.541039,
-    0.541437,
-    0.541891,
-    0.5424,
-    0.542964,
-    0.543582,
-    0.544254,
-    0.544979,
-    0.545754,
-    0.54658,
-    0.547452,
-    0.54837,
-    0.549332,
-    0.550334,
-    0.551374,
-    0.552448,
-    0.553555,
-    0.55469,
-    0.55585,
-    0.557032,
-    0.558231,
-    0.559445,
-    0.560669,
-    0.561899,
-    0.563131,
-    0.564362,
-    0.565588,
-    0.566803,
-    0.568006,
-    0.569191,
-    0.570355,
-    0.571494,
-    0.572604,
-    0.573683,
-    0.574727,
-    0.575732,
-    0.576696,
-    0.577615,
-    0.578489,
-    0.579313,
-    0.580086,
-    0.580806,
-    0.581471,
-    0.58208,
-    0.582632,
-    0.583127,
-    0.583563,
-    0.58394,
-    0.584258,
-    0.584519,
-    0.584721,
-    0.584867,
-    0.584957,
-    0.584992,
-    0.584976,
-    0.584908,
-    0.584792,
-    0.584631,
-    0.584426,
-    0.584181,
-    0.583898,
-    0.583582,
-    0.583236,
-    0.582862,
-    0.582466,
-    0.58205,
-    0.58162,
-    0.581178,
-    0.58073,
-    0.580279,
-    0.579829,
-    0.579386,
-    0.578952,
-    0.578533,
-    0.578131,
-    0.577753,
-    0.5774,
-    0.577078,
-    0.576789,
-    0.576537,
-    0.576327,
-    0.57616,
-    0.57604,
-    0.575969,
-    0.575951,
-    0.575987,
-    0.576079,
-    0.57623,
-    0.57644,
-    0.576711,
-    0.577043,
-    0.577438,
-    0.577895,
-    0.578414,
-    0.578996,
-    0.57964,
-    0.580344,
-    0.581107,
-    0.581928,
-    0.582806,
-    0.583737,
-    0.58472,
-    0.585752,
-    0.586831,
-    0.587952,
-    0.589113,
-    0.590311,
-    0.591541,
-    0.592799,
-    0.594083,
-    0.595387,
-    0.596707,
-    0.598039,
-    0.599379,
-    0.600721,
-    0.602062,
-    0.603397,
-    0.604722,
-    0.606031,
-    0.607321,
-    0.608588,
-    0.609826,
-    0.611032,
-    0.612203,
-    0.613334,
-    0.614421,
-    0.615461,
-    0.616452,
-    0.61739,
-    0.618272,
-    0.619096,
-    0.619859,
-    0.620561,
-    0.621198,
-    0.621771,
-    0.622278,
-    0.622718,
-    0.623091,
-    0.623398,
-    0.623637,
-    0.623811,
-    0.623919,
-    0.623964,
-    0.623947,
-    0.623869,
-    0.623734,
-    0.623543,
-    0.623299,
-    0.623006,
-    0.622666,
-    0.622283,
-    0.621862,
-    0.621405,
-    0.620917,
-    0.620403,
-    0.619866,
-    0.619312,
-    0.618744,
-    0.618169,
-    0.61759,
-    0.617012,
-    0.616441,
-    0.615881,
-    0.615337,
-    0.614813,
-    0.614315,
-    0.613847,
-    0.613413,
-    0.613017,
-    0.612664,
-    0.612358,
-    0.612102,
-    0.611899,
-    0.611754,
-    0.611668,
-    0.611644,
-    0.611686,
-    0.611794,
-    0.611971,
-    0.612218,
-    0.612536,
-    0.612925,
-    0.613387,
-    0.613921,
-    0.614527,
-    0.615205,
-    0.615952,
-    0.616768,
-    0.617652,
-    0.6186,
-    0.619611,
-    0.620682,
-    0.621811,
-    0.622993,
-    0.624225,
-    0.625503,
-    0.626825,
-    0.628184,
-    0.629577,
-    0.630999,
-    0.632445,
-    0.63391,
-    0.63539,
-    0.636879,
-    0.638372,
-    0.639863,
-    0.641348,
-    0.642821,
-    0.644277,
-    0.645711,
-    0.647118,
-    0.648493,
-    0.64983,
-    0.651127,
-    0.652377,
-    0.653577,
-    0.654723,
-    0.65581,
-    0.656837,
-    0.657798,
-    0.658692,
-    0.659516,
-    0.660267,
-    0.660944,
-    0.661545,
-    0.662069,
-    0.662515,
-    0.662882,
-    0.663171,
-    0.663382,
-    0.663516,
-    0.663573,
-    0.663555,
-    0.663465,
-    0.663303,
-    0.663073,
-    0.662778,
-    0.66242,
-    0.662004,
-    0.661532,
-    0.66101,
-    0.660442,
-    0.659832,
-    0.659185,
-    0.658506,
-    0.6578,
-    0.657073,
-    0.65633,
-    0.655577,
-    0.654819,
-    0.654063,
-    0.653313,
-    0.652576,
-    0.651858,
-    0.651163,
-    0.650497,
-    0.649867,
-    0.649276,
-    0.64873,
-    0.648235,
-    0.647794,
-    0.647412,
-    0.647094,
-    0.646842,
-    0.646661,
-    0.646554,
-    0.646524,
-    0.646573,
-    0.646703,
-    0.646916,
-    0.647213,
-    0.647596,
-    0.648065,
-    0.64862,
-    0.64926,
-    0.649985,
-    0.650794,
-    0.651685,
-    0.652657,
-    0.653706,
-    0.654831,
-    0.656028,
-    0.657293,
-    0.658623,
-    0.660013,
-    0.66146,
-    0.662958,
-    0.664502,
-    0.666086,
-    0.667707,
-    0.669357,
-    0.67103,
-    0.672722,
-    0.674425,
-    0.676134,
-    0.677841,
-    0.679542,
-    0.681229,
-    0.682896,
-    0.684537,
-    0.686146,
-    0.687717,
-    0.689245,
-    0.690722,
-    0.692145,
-    0.693508,
-    0.694806,
-    0.696035,
-    0.69719,
-    0.698267,
-    0.699262,
-    0.700173,
-    0.700997,
-    0.70173,
-    0.702372,
-    0.702921,
-    0.703375,
-    0.703735,
-    0.703999,
-    0.704168,
-    0.704243,
-    0.704225,
-    0.704116,
-    0.703917,
-    0.703632,
-    0.703263,
-    0.702814,
-    0.702289,
-    0.701692,
-    0.701027,
-    0.700299,
-    0.699514,
-    0.698678,
-    0.697795,
-    0.696873,
-    0.695917,
-    0.694934,
-    0.693931,
-    0.692915,
-    0.691892,
-    0.69087,
-    0.689855,
-    0.688855,
-    0.687876,
-    0.686926,
-    0.686011,
-    0.685138,
-    0.684313,
-    0.683544,
-    0.682835,
-    0.682192,
-    0.681622,
-    0.68113,
-    0.680719,
-    0.680396,
-    0.680163,
-    0.680024,
-    0.679983,
-    0.680043,
-    0.680205,
-    0.680472,
-    0.680844,
-    0.681323,
-    0.681909,
-    0.682601,
-    0.6834,
-    0.684302,
-    0.685308,
-    0.686414,
-    0.687617,
-    0.688915,
-    0.690303,
-    0.691778,
-    0.693334,
-    0.694967,
-    0.696671,
-    0.698439,
-    0.700267,
-    0.702147,
-    0.704072,
-    0.706036,
-    0.708031,
-    0.710049,
-    0.712083,
-    0.714125,
-    0.716168,
-    0.718202,
-    0.72022,
-    0.722215,
-    0.724178,
-    0.726102,
-    0.72798,
-    0.729802,
-    0.731564,
-    0.733256,
-    0.734874,
-    0.736411,
-    0.73786,
-    0.739216,
-    0.740474,
-    0.741629,
-    0.742677,
-    0.743615,
-    0.744438,
-    0.745145,
-    0.745733,
-    0.7462,
-    0.746546,
-    0.746771,
-    0.746873,
-    0.746855,
-    0.746717,
-    0.746462,
-    0.746091,
-    0.745609,
-    0.745018,
-    0.744324,
-    0.74353,
-    0.742642,
-    0.741666,
-    0.740607,
-    0.739474,
-    0.738272,
-    0.737009,
-    0.735693,
-    0.734333,
-    0.732935,
-    0.73151,
-    0.730066,
-    0.728611,
-    0.727156,
-    0.725708,
-    0.724278,
-    0.722874,
-    0.721506,
-    0.720182,
-    0.718911,
-    0.717702,
-    0.716563,
-    0.715502,
-    0.714527,
-    0.713646,
-    0.712865,
-    0.712192,
-    0.711631,
-    0.711189,
-    0.71087,
-    0.71068,
-    0.710622,
-    0.710699,
-    0.710914,
-    0.711269,
-    0.711766,
-    0.712404,
-    0.713184,
-    0.714106,
-    0.715167,
-    0.716366,
-    0.717699,
-    0.719164,
-    0.720756,
-    0.722471,
-    0.724302,
-    0.726245,
-    0.728292,
-    0.730436,
-    0.73267,
-    0.734985,
-    0.737373,
-    0.739824,
-    0.74233,
-    0.74488,
-    0.747465,
-    0.750073,
-    0.752695,
-    0.755319,
-    0.757936,
-    0.760534,
-    0.763102,
-    0.76563,
-    0.768107,
-    0.770522,
-    0.772865,
-    0.775127,
-    0.777297,
-    0.779366,
-    0.781326,
-    0.783167,
-    0.784882,
-    0.786463,
-    0.787904,
-    0.789198,
-    0.79034,
-    0.791324,
-    0.792148,
-    0.792806,
-    0.793298,
-    0.79362,
-    0.793772,
-    0.793753,
-    0.793565,
-    0.793208,
-    0.792685,
-    0.792,
-    0.791155,
-    0.790155,
-    0.789007,
-    0.787716,
-    0.786289,
-    0.784735,
-    0.783061,
-    0.781276,
-    0.779392,
-    0.777416,
-    0.775362,
-    0.773239,
-    0.77106,
-    0.768836,
-    0.766581,
-    0.764307,
-    0.762027,
-    0.759754,
-    0.757502,
-    0.755283,
-    0.753111,
-    0.750998,
-    0.748959,
-    0.747006,
-    0.745151,
-    0.743406,
-    0.741783,
-    0.740294,
-    0.738948,
-    0.737757,
-    0.736729,
-    0.735874,
-    0.7352,
-    0.734713,
-    0.734421,
-    0.734328,
-    0.73444,
-    0.734761,
-    0.735292,
-    0.736036,
-    0.736994,
-    0.738166,
-    0.739549,
-    0.741142,
-    0.742942,
-    0.744944,
-    0.747142,
-    0.749531,
-    0.752102,
-    0.754848,
-    0.757759,
-    0.760824,
-    0.764033,
-    0.767374,
-    0.770834,
-    0.774399,
-    0.778056,
-    0.781789,
-    0.785584,
-    0.789425,
-    0.793294,
-    0.797177,
-    0.801056,
-    0.804913,
-    0.808733,
-    0.812497,
-    0.816189,
-    0.819791,
-    0.823287,
-    0.82666,
-    0.829895,
-    0.832974,
-    0.835884,
-    0.83861,
-    0.841137,
-    0.843452,
-    0.845545,
-    0.847402,
-    0.849013,
-    0.85037,
-    0.851463,
-    0.852287,
-    0.852833,
-    0.853099,
-    0.85308,
-    0.852775,
-    0.852182,
-    0.851303,
-    0.850138,
-    0.848691,
-    0.846968,
-    0.844974,
-    0.842717,
-    0.840206,
-    0.83745,
-    0.834462,
-    0.831254,
-    0.827842,
-    0.824239,
-    0.820462,
-    0.81653,
-    0.81246,
-    0.808273,
-    0.803989,
-    0.79963,
-    0.795217,
-    0.790773,
-    0.786322,
-    0.781888,
-    0.777494,
-    0.773165,
-    0.768925,
-    0.7648,
-    0.760813,
-    0.756989,
-    0.753352,
-    0.749925,
-    0.746732,
-    0.743796,
-    0.741136,
-    0.738776,
-    0.736733,
-    0.735028,
-    0.733678,
-    0.732698,
-    0.732104,
-    0.73191,
-    0.732126,
-    0.732764,
-    0.733831,
-    0.735335,
-    0.737279,
-    0.739667,
-    0.742499,
-    0.745775,
-    0.749491,
-    0.75364,
-    0.758217,
-    0.76321,
-    0.768609,
-    0.774398,
-    0.780561,
-    0.787081,
-    0.793936,
-    0.801105,
-    0.808561,
-    0.816279,
-    0.824229,
-    0.832382,
-    0.840705,
-    0.849163,
-    0.857722,
-    0.866344,
-    0.874991,
-    0.883621,
-    0.892196,
-    0.900671,
-    0.909005,
-    0.917152,
-    0.925069,
-    0.93271,
-    0.94003,
-    0.946983,
-    0.953522,
-    0.959603,
-    0.96518,
-    0.970207,
-    0.974639,
-    0.978434,
-    0.981547,
-    0.983937,
-    0.985563,
-    0.986385,
-    0.986364,
-    0.985466,
-    0.983654,
-    0.980895,
-    0.97716,
-    0.972419,
-    0.966645,
-    0.959815,
-    0.951907,
-    0.942902,
-    0.932784,
-    0.921538,
-    0.909155,
-    0.895625,
-    0.880945,
-    0.865112,
-    0.848126,
-    0.829993,
-    0.81072,
-    0.790315,
-    0.768793,
-    0.74617,
-    0.722465,
-    0.697701,
-    0.671902,
-    0.645097,
-    0.617316,
-    0.588594,
-    0.558967,
-    0.528473,
-    0.497153,
-    0.465053,
-    0.432217,
-    0.398693,
-    0.364533,
-    0.329786,
-    0.294508,
-    0.258753,
-    0.222578,
-    0.186041,
-    0.149199,
-    0.112114,
-    0.0748449,
-    0.0374532
-};
-
-// Top frequency: 44.1K * 0.0290249
-constexpr static std::array<float, 4096> wt_sawtooth_0x6 =
-{
-    0,
-    -0.0183142,
-    -0.036621,
-    -0.0549129,
-    -0.0731826,
-    -0.0914226,
-    -0.109625,
-    -0.127784,
-    -0.145891,
-    -0.163938,
-    -0.18192,
-    -0.199828,
-    -0.217655,
-    -0.235395,
-    -0.25304,
-    -0.270584,
-    -0.288018,
-    -0.305338,
-    -0.322535,
-    -0.339604,
-    -0.356537,
-    -0.373329,
-    -0.389972,
-    -0.406462,
-    -0.42279,
-    -0.438953,
-    -0.454943,
-    -0.470754,
-    -0.486382,
-    -0.501821,
-    -0.517065,
-    -0.532108,
-    -0.546947,
-    -0.561575,
-    -0.575989,
-    -0.590183,
-    -0.604152,
-    -0.617893,
-    -0.631402,
-    -0.644673,
-    -0.657704,
-    -0.67049,
-    -0.683028,
-    -0.695315,
-    -0.707347,
-    -0.719122,
-    -0.730636,
-    -0.741886,
-    -0.752871,
-    -0.763588,
-    -0.774035,
-    -0.784209,
-    -0.794109,
-    -0.803734,
-    -0.813081,
-    -0.822151,
-    -0.83094,
-    -0.83945,
-    -0.847678,
-    -0.855625,
-    -0.863291,
-    -0.870674,
-    -0.877775,
-    -0.884595,
-    -0.891133,
-    -0.89739,
-    -0.903368,
-    -0.909066,
-    -0.914486,
-    -0.919629,
-    -0.924497,
-    -0.929092,
-    -0.933414,
-    -0.937466,
-    -0.941251,
-    -0.944769,
-    -0.948025,
-    -0.95102,
-    -0.953756,
-    -0.956238,
-    -0.958467,
-    -0.960447,
-    -0.962182,
-    -0.963674,
-    -0.964928,
-    -0.965947,
-    -0.966734,
-    -0.967294,
-    -0.967631,
-    -0.967748,
-    -0.967651,
-    -0.967343,
-    -0.966829,
-    -0.966113,
-    -0.965201,
-    -0.964097,
-    -0.962805,
-    -0.961331,
-    -0.95968,
-    -0.957856,
-    -0.955865,
-    -0.953712,
-    -0.951402,
-    -0.948941,
-    -0.946334,
-    -0.943585,
-    -0.940702,
-    -0.937688,
-    -0.93455,
-    -0.931293,
-    -0.927923,
-    -0.924444,
-    -0.920864,
-    -0.917186,
-    -0.913417,
-    -0.909563,
-    -0.905628,
-    -0.901618,
-    -0.89754,
-    -0.893398,
-    -0.889197,
-    -0.884944,
-    -0.880643,
-    -0.876301,
-    -0.871922,
-    -0.867511,
-    -0.863074,
-    -0.858616,
-    -0.854142,
-    -0.849657,
-    -0.845167,
-    -0.840675,
-    -0.836187,
-    -0.831707,
-    -0.827241,
-    -0.822793,
-    -0.818367,
-    -0.813967,
-    -0.809599,
-    -0.805266,
-    -0.800973,
-    -0.796722,
-    -0.79252,
-    -0.788368,
-    -0.784271,
-    -0.780233,
-    -0.776257,
-    -0.772346,
-    -0.768503,
-    -0.764732,
-    -0.761036,
-    -0.757418,
-    -0.75388,
-    -0.750425,
-    -0.747055,
-    -0.743774,
-    -0.740582,
-    -0.737483,
-    -0.734479,
-    -0.73157,
-    -0.728759,
-    -0.726048,
-    -0.723439,
-    -0.720931,
-    -0.718527,
-    -0.716228,
-    -0.714034,
-    -0.711948,
-    -0.709968,
-    -0.708096,
-    -0.706333,
-    -0.704678,
-    -0.703132,
-    -0.701695,
-    -0.700367,
-    -0.699148,
-    -0.698037,
-    -0.697034,
-    -0.696138,
-    -0.69535,
-    -0.694668,
-    -0.69409,
-    -0.693618,
-    -0.693248,
-    -0.692981,
-    -0.692815,
-    -0.692748,
-    -0.692779,
-    -0.692906,
-    -0.693128,
-    -0.693443,
-    -0.693849,
-    -0.694345,
-    -0.694928,
-    -0.695596,
-    -0.696346,
-    -0.697178,
-    -0.698088,
-    -0.699075,
-    -0.700135,
-    -0.701266,
-    -0.702466,
-    -0.703732,
-    -0.705061,
-    -0.706452,
-    -0.7079,
-    -0.709404,
-    -0.71096,
-    -0.712565,
-    -0.714218,
-    -0.715914,
-    -0.717651,
-    -0.719427,
-    -0.721237,
-    -0.723079,
-    -0.724951,
-    -0.726848,
-    -0.728769,
-    -0.73071,
-    -0.732669,
-    -0.734641,
-    -0.736625,
-    -0.738617,
-    -0.740614,
-    -0.742614,
-    -0.744614,
-    -0.74661,
-    -0.7486,
-    -0.750582,
-    -0.752551,
-    -0.754507,
-    -0.756445,
-    -0.758363,
-    -0.76026,
-    -0.762131,
-    -0.763975,
-    -0.765789,
-    -0.767571,
-    -0.769319,
-    -0.771029,
-    -0.772701,
-    -0.774331,
-    -0.775918,
-    -0.77746,
-    -0.778955,
-    -0.7804,
-    -0.781794,
-    -0.783136,
-    -0.784424,
-    -0.785655,
-    -0.786829,
-    -0.787944,
-    -0.788999,
-    -0.789992,
-    -0.790923,
-    -0.791789,
-    -0.792591,
-    -0.793327,
-    -0.793997,
-    -0.794599,
-    -0.795133,
-    -0.795598,
-    -0.795994,
-    -0.79632,
-    -0.796576,
-    -0.796762,
-    -0.796877,
-    -0.796921,
-    -0.796895,
-    -0.796798,
-    -0.796631,
-    -0.796394,
-    -0.796086,
-    -0.795709,
-    -0.795263,
-    -0.794749,
-    -0.794166,
-    -0.793516,
-    -0.792799,
-    -0.792017,
-    -0.79117,
-    -0.790259,
-    -0.789285,
-    -0.788249,
-    -0.787153,
-    -0.785998,
-    -0.784784,
-    -0.783514,
-    -0.782189,
-    -0.780809,
-    -0.779377,
-    -0.777895,
-    -0.776363,
-    -0.774784,
-    -0.773159,
-    -0.77149,
-    -0.769779,
-    -0.768027,
-    -0.766236,
-    -0.764409,
-    -0.762547,
-    -0.760652,
-    -0.758726,
-    -0.756771,
-    -0.754789,
-    -0.752783,
-    -0.750753,
-    -0.748703,
-    -0.746634,
-    -0.744548,
-    -0.742448,
-    -0.740336,
-    -0.738213,
-    -0.736082,
-    -0.733944,
-    -0.731803,
-    -0.729659,
-    -0.727516,
-    -0.725375,
-    -0.723237,
-    -0.721106,
-    -0.718983,
-    -0.71687,
-    -0.71477,
-    -0.712683,
-    -0.710612,
-    -0.708559,
-    -0.706526,
-    -0.704513,
-    -0.702524,
-    -0.70056,
-    -0.698623,
-    -0.696714,
-    -0.694834,
-    -0.692986,
-    -0.691171,
-    -0.68939,
-    -0.687646,
-    -0.685938,
-    -0.684269,
-    -0.682639,
-    -0.681051,
-    -0.679504,
-    -0.678001,
-    -0.676542,
-    -0.675129,
-    -0.673761,
-    -0.672441,
-    -0.671169,
-    -0.669945,
-    -0.66877,
-    -0.667645,
-    -0.666571,
-    -0.665548,
-    -0.664576,
-    -0.663657,
-    -0.662789,
-    -0.661973,
-    -0.66121,
-    -0.6605,
-    -0.659843,
-    -0.659238,
-    -0.658686,
-    -0.658187,
-    -0.65774,
-    -0.657345,
-    -0.657002,
-    -0.65671,
-    -0.65647,
-    -0.65628,
-    -0.65614,
-    -0.65605,
-    -0.656008,
-    -0.656015,
-    -0.656068,
-    -0.656169,
-    -0.656315,
-    -0.656506,
-    -0.65674,
-    -0.657018,
-    -0.657337,
-    -0.657697,
-    -0.658097,
-    -0.658535,
-    -0.65901,
-    -0.659522,
-    -0.660067,
-    -0.660647,
-    -0.661258,
-    -0.6619,
-    -0.662571,
-    -0.66327,
-    -0.663995,
-    -0.664745,
-    -0.665518,
-    -0.666314,
-    -0.667129,
-    -0.667963,
-    -0.668814,
-    -0.669681,
-    -0.670562,
-    -0.671455,
-    -0.672358,
-    -0.673271,
-    -0.674191,
-    -0.675117,
-    -0.676048,
-    -0.676981,
-    -0.677914,
-    -0.678848,
-    -0.679779,
-    -0.680706,
-    -0.681628,
-    -0.682543,
-    -0.683449,
-    -0.684345,
-    -0.68523,
-    -0.686102,
-    -0.686959,
-    -0.6878,
-    -0.688624,
-    -0.689429,
-    -0.690214,
-    -0.690978,
-    -0.691719,
-    -0.692435,
-    -0.693127,
-    -0.693792,
-    -0.694429,
-    -0.695038,
-    -0.695616,
-    -0.696164,
-    -0.69668,
-    -0.697163,
-    -0.697612,
-    -0.698027,
-    -0.698406,
-    -0.698748,
-    -0.699054,
-    -0.699322,
-    -0.699551,
-    -0.699742,
-    -0.699893,
-    -0.700004,
-    -0.700074,
-    -0.700104,
-    -0.700092,
-    -0.700039,
-    -0.699944,
-    -0.699807,
-    -0.699627,
-    -0.699406,
-    -0.699142,
-    -0.698836,
-    -0.698488,
-    -0.698097,
-    -0.697664,
-    -0.69719,
-    -0.696674,
-    -0.696117,
-    -0.695519,
-    -0.69488,
-    -0.694201,
-    -0.693482,
-    -0.692725,
-    -0.691928,
-    -0.691094,
-    -0.690223,
-    -0.689315,
-    -0.688371,
-    -0.687392,
-    -0.686378,
-    -0.685331,
-    -0.684252,
-    -0.683141,
-    -0.681999,
-    -0.680828,
-    -0.679628,
-    -0.6784,
-    -0.677146,
-    -0.675866,
-    -0.674562,
-    -0.673235,
-    -0.671886,
-    -0.670516,
-    -0.669126,
-    -0.667718,
-    -0.666293,
-    -0.664852,
-    -0.663397,
-    -0.661928,
-    -0.660447,
-    -0.658956,
-    -0.657455,
-    -0.655946,
-    -0.654431,
-    -0.65291,
-    -0.651385,
-    -0.649857,
-    -0.648328,
-    -0.6468,
-    -0.645272,
-    -0.643747,
-    -0.642226,
-    -0.64071,
-    -0.6392,
-    -0.637699,
-    -0.636206,
-    -0.634724,
-    -0.633253,
-    -0.631795,
-    -0.630351,
-    -0.628922,
-    -0.627509,
-    -0.626113,
-    -0.624736,
-    -0.623378,
-    -0.622041,
-    -0.620726,
-    -0.619433,
-    -0.618164,
-    -0.616919,
-    -0.6157,
-    -0.614506,
-    -0.61334,
-    -0.612202,
-    -0.611092,
-    -0.610012,
-    -0.608961,
-    -0.607942,
-    -0.606953,
-    -0.605996,
-    -0.605072,
-    -0.604181,
-    -0.603323,
-    -0.602498,
-    -0.601708,
-    -0.600952,
-    -0.600231,
-    -0.599544,
-    -0.598893,
-    -0.598277,
-    -0.597697,
-    -0.597152,
-    -0.596642,
-    -0.596168,
-    -0.595729,
-    -0.595326,
-    -0.594958,
-    -0.594625,
-    -0.594326,
-    -0.594063,
-    -0.593833,
-    -0.593638,
-    -0.593475,
-    -0.593346,
-    -0.59325,
-    -0.593186,
-    -0.593153,
-    -0.593152,
-    -0.593181,
-    -0.59324,
-    -0.593328,
-    -0.593445,
-    -0.593589,
-    -0.59376,
-    -0.593958,
-    -0.594181,
-    -0.594428,
-    -0.5947,
-    -0.594994,
-    -0.595309,
-    -0.595646,
-    -0.596003,
-    -0.596379,
-    -0.596772,
-    -0.597183,
-    -0.59761,
-    -0.598051,
-    -0.598507,
-    -0.598974,
-    -0.599454,
-    -0.599944,
-    -0.600444,
-    -0.600952,
-    -0.601467,
-    -0.601988,
-    -0.602514,
-    -0.603043,
-    -0.603576,
-    -0.60411,
-    -0.604644,
-    -0.605177,
-    -0.605709,
-    -0.606237,
-    -0.606762,
-    -0.607281,
-    -0.607794,
-    -0.608299,
-    -0.608796,
-    -0.609284,
-    -0.609761,
-    -0.610226,
-    -0.610678,
-    -0.611117,
-    -0.611542,
-    -0.61195,
-    -0.612343,
-    -0.612718,
-    -0.613074,
-    -0.613412,
-    -0.613729,
-    -0.614026,
-    -0.614301,
-    -0.614554,
-    -0.614784,
-    -0.61499,
-    -0.615171,
-    -0.615328,
-    -0.615458,
-    -0.615563,
-    -0.615641,
-    -0.615691,
-    -0.615714,
-    -0.615708,
-    -0.615674,
-    -0.615611,
-    -0.615518,
-    -0.615396,
-    -0.615244,
-    -0.615062,
-    -0.614849,
-    -0.614607,
-    -0.614333,
-    -0.614029,
-    -0.613694,
-    -0.613329,
-    -0.612933,
-    -0.612506,
-    -0.612049,
-    -0.611561,
-    -0.611043,
-    -0.610495,
-    -0.609917,
-    -0.60931,
-    -0.608674,
-    -0.608009,
-    -0.607315,
-    -0.606594,
-    -0.605845,
-    -0.605068,
-    -0.604265,
-    -0.603436,
-    -0.602582,
-    -0.601703,
-    -0.600799,
-    -0.599871,
-    -0.598921,
-    -0.597948,
-    -0.596954,
-    -0.595939,
-    -0.594904,
-    -0.59385,
-    -0.592777,
-    -0.591687,
-    -0.59058,
-    -0.589456,
-    -0.588319,
-    -0.587166,
-    -0.586001,
-    -0.584823,
-    -0.583634,
-    -0.582435,
-    -0.581226,
-    -0.580009,
-    -0.578785,
-    -0.577553,
-    -0.576317,
-    -0.575076,
-    -0.573831,
-    -0.572583,
-    -0.571335,
-    -0.570085,
-    -0.568836,
-    -0.567589,
-    -0.566344,
-    -0.565102,
-    -0.563865,
-    -0.562633,
-    -0.561407,
-    -0.560189,
-    -0.558979,
-    -0.557777,
-    -0.556586,
-    -0.555406,
-    -0.554238,
-    -0.553082,
-    -0.551939,
-    -0.550811,
-    -0.549699,
-    -0.548602,
-    -0.547521,
-    -0.546458,
-    -0.545414,
-    -0.544388,
-    -0.543382,
-    -0.542395,
-    -0.54143,
-    -0.540486,
-    -0.539564,
-    -0.538665,
-    -0.537788,
-    -0.536936,
-    -0.536107,
-    -0.535302,
-    -0.534523,
-    -0.533768,
-    -0.53304,
-    -0.532337,
-    -0.53166,
-    -0.531009,
-    -0.530385,
-    -0.529788,
-    -0.529218,
-    -0.528675,
-    -0.528158,
-    -0.527669,
-    -0.527208,
-    -0.526773,
-    -0.526365,
-    -0.525985,
-    -0.525631,
-    -0.525305,
-    -0.525004,
-    -0.524731,
-    -0.524483,
-    -0.524262,
-    -0.524066,
-    -0.523895,
-    -0.523749,
-    -0.523628,
-    -0.523531,
-    -0.523458,
-    -0.523408,
-    -0.523381,
-    -0.523376,
-    -0.523392,
-    -0.52343,
-    -0.523488,
-    -0.523567,
-    -0.523664,
-    -0.523781,
-    -0.523915,
-    -0.524066,
-    -0.524234,
-    -0.524418,
-    -0.524617,
-    -0.524831,
-    -0.525057,
-    -0.525297,
-    -0.525548,
-    -0.525811,
-    -0.526084,
-    -0.526366,
-    -0.526657,
-    -0.526955,
-    -0.52726,
-    -0.527572,
-    -0.527888,
-    -0.528208,
-    -0.528532,
-    -0.528859,
-    -0.529186,
-    -0.529515,
-    -0.529843,
-    -0.53017,
-    -0.530495,
-    -0.530818,
-    -0.531136,
-    -0.53145,
-    -0.531758,
-    -0.53206,
-    -0.532355,
-    -0.532642,
-    -0.53292,
-    -0.533189,
-    -0.533447,
-    -0.533694,
-    -0.533929,
-    -0.534151,
-    -0.53436,
-    -0.534554,
-    -0.534734,
-    -0.534898,
-    -0.535047,
-    -0.535178,
-    -0.535292,
-    -0.535388,
-    -0.535465,
-    -0.535523,
-    -0.535562,
-    -0.53558,
-    -0.535578,
-    -0.535554,
-    -0.535509,
-    -0.535443,
-    -0.535354,
-    -0.535242,
-    -0.535108,
-    -0.53495,
-    -0.534769,
-    -0.534564,
-    -0.534335,
-    -0.534082,
-    -0.533805,
-    -0.533504,
-    -0.533178,
-    -0.532828,
-    -0.532453,
-    -0.532054,
-    -0.531631,
-    -0.531183,
-    -0.53071,
-    -0.530214,
-    -0.529693,
-    -0.529149,
-    -0.528581,
-    -0.52799,
-    -0.527375,
-    -0.526738,
-    -0.526077,
-    -0.525395,
-    -0.524691,
-    -0.523965,
-    -0.523218,
-    -0.522451,
-    -0.521663,
-    -0.520856,
-    -0.52003,
-    -0.519184,
-    -0.518321,
-    -0.51744,
-    -0.516542,
-    -0.515628,
-    -0.514698,
-    -0.513753,
-    -0.512794,
-    -0.511821,
-    -0.510835,
-    -0.509836,
-    -0.508826,
-    -0.507805,
-    -0.506774,
-    -0.505733,
-    -0.504684,
-    -0.503626,
-    -0.502562,
-    -0.501491,
-    -0.500415,
-    -0.499334,
-    -0.498249,
-    -0.497161,
-    -0.496071,
-    -0.494979,
-    -0.493887,
-    -0.492794,
-    -0.491703,
-    -0.490613,
-    -0.489525,
-    -0.488441,
-    -0.487361,
-    -0.486286,
-    -0.485216,
-    -0.484153,
-    -0.483097,
-    -0.482049,
-    -0.48101,
-    -0.47998,
-    -0.47896,
-    -0.477951,
-    -0.476953,
-    -0.475967,
-    -0.474994,
-    -0.474035,
-    -0.47309,
-    -0.472159,
-    -0.471243,
-    -0.470344,
-    -0.46946,
-    -0.468594,
-    -0.467744,
-    -0.466913,
-    -0.4661,
-    -0.465306,
-    -0.464531,
-    -0.463775,
-    -0.463039,
-    -0.462324,
-    -0.461629,
-    -0.460955,
-    -0.460303,
-    -0.459671,
-    -0.459061,
-    -0.458473,
-    -0.457907,
-    -0.457363,
-    -0.456841,
-    -0.456342,
-    -0.455865,
-    -0.45541,
-    -0.454978,
-    -0.454567,
-    -0.45418,
-    -0.453814,
-    -0.453471,
-    -0.453149,
-    -0.45285,
-    -0.452572,
-    -0.452316,
-    -0.452081,
-    -0.451866,
-    -0.451673,
-    -0.4515,
-    -0.451347,
-    -0.451214,
-    -0.4511,
-    -0.451005,
-    -0.450929,
-    -0.450871,
-    -0.45083,
-    -0.450807,
-    -0.4508,
-    -0.450809,
-    -0.450835,
-    -0.450875,
-    -0.450929,
-    -0.450998,
-    -0.45108,
-    -0.451175,
-    -0.451281,
-    -0.451399,
-    -0.451528,
-    -0.451667,
-    -0.451816,
-    -0.451973,
-    -0.452138,
-    -0.452311,
-    -0.45249,
-    -0.452675,
-    -0.452865,
-    -0.45306,
-    -0.453258,
-    -0.45346,
-    -0.453663,
-    -0.453868,
-    -0.454074,
-    -0.45428,
-    -0.454485,
-    -0.454689,
-    -0.454891,
-    -0.455089,
-    -0.455284,
-    -0.455475,
-    -0.45566,
-    -0.45584,
-    -0.456013,
-    -0.456179,
-    -0.456337,
-    -0.456487,
-    -0.456627,
-    -0.456757,
-    -0.456877,
-    -0.456986,
-    -0.457084,
-    -0.457169,
-    -0.457241,
-    -0.457299,
-    -0.457344,
-    -0.457374,
-    -0.457389,
-    -0.457389,
-    -0.457372,
-    -0.45734,
-    -0.45729,
-    -0.457223,
-    -0.457139,
-    -0.457036,
-    -0.456915,
-    -0.456776,
-    -0.456617,
-    -0.45644,
-    -0.456242,
-    -0.456026,
-    -0.455789,
-    -0.455532,
-    -0.455254,
-    -0.454957,
-    -0.454638,
-    -0.4543,
-    -0.45394,
-    -0.45356,
-    -0.453159,
-    -0.452738,
-    -0.452295,
-    -0.451833,
-    -0.451349,
-    -0.450846,
-    -0.450322,
-    -0.449778,
-    -0.449214,
-    -0.44863,
-    -0.448027,
-    -0.447405,
-    -0.446764,
-    -0.446104,
-    -0.445426,
-    -0.444729,
-    -0.444016,
-    -0.443285,
-    -0.442537,
-    -0.441772,
-    -0.440992,
-    -0.440196,
-    -0.439386,
-    -0.43856,
-    -0.437721,
-    -0.436868,
-    -0.436002,
-    -0.435123,
-    -0.434233,
-    -0.433332,
-    -0.432419,
-    -0.431497,
-    -0.430565,
-    -0.429625,
-    -0.428676,
-    -0.42772,
-    -0.426757,
-    -0.425787,
-    -0.424812,
-    -0.423832,
-    -0.422848,
-    -0.42186,
-    -0.42087,
-    -0.419877,
-    -0.418883,
-    -0.417888,
-    -0.416893,
-    -0.415899,
-    -0.414906,
-    -0.413915,
-    -0.412926,
-    -0.411941,
-    -0.41096,
-    -0.409983,
-    -0.409012,
-    -0.408047,
-    -0.407088,
-    -0.406137,
-    -0.405194,
-    -0.404259,
-    -0.403333,
-    -0.402417,
-    -0.401511,
-    -0.400616,
-    -0.399732,
-    -0.39886,
-    -0.398001,
-    -0.397155,
-    -0.396322,
-    -0.395503,
-    -0.394699,
-    -0.393909,
-    -0.393135,
-    -0.392376,
-    -0.391633,
-    -0.390907,
-    -0.390198,
-    -0.389505,
-    -0.38883,
-    -0.388173,
-    -0.387534,
-    -0.386913,
-    -0.38631,
-    -0.385726,
-    -0.38516,
-    -0.384614,
-    -0.384086,
-    -0.383578,
-    -0.383089,
-    -0.382619,
-    -0.382169,
-    -0.381738,
-    -0.381326,
-    -0.380933,
-    -0.38056,
-    -0.380206,
-    -0.379871,
-    -0.379555,
-    -0.379258,
-    -0.37898,
-    -0.378719,
-    -0.378478,
-    -0.378254,
-    -0.378048,
-    -0.377859,
-    -0.377687,
-    -0.377533,
-    -0.377395,
-    -0.377273,
-    -0.377167,
-    -0.377076,
-    -0.377001,
-    -0.376939,
-    -0.376893,
-    -0.376859,
-    -0.376839,
-    -0.376832,
-    -0.376837,
-    -0.376854,
-    -0.376881,
-    -0.37692,
-    -0.376968,
-    -0.377026,
-    -0.377093,
-    -0.377168,
-    -0.377251,
-    -0.377342,
-    -0.377438,
-    -0.377541,
-    -0.377649,
-    -0.377761,
-    -0.377878,
-    -0.377998,
-    -0.37812,
-    -0.378245,
-    -0.378371,
-    -0.378498,
-    -0.378626,
-    -0.378752,
-    -0.378878,
-    -0.379002,
-    -0.379123,
-    -0.379241,
-    -0.379356,
-    -0.379466,
-    -0.379571,
-    -0.379671,
-    -0.379765,
-    -0.379852,
-    -0.379931,
-    -0.380003,
-    -0.380066,
-    -0.38012,
-    -0.380164,
-    -0.380199,
-    -0.380222,
-    -0.380235,
-    -0.380235,
-    -0.380224,
-    -0.3802,
-    -0.380163,
-    -0.380112,
-    -0.380048,
-    -0.379969,
-    -0.379875,
-    -0.379767,
-    -0.379643,
-    -0.379503,
-    -0.379347,
-    -0.379175,
-    -0.378986,
-    -0.37878,
-    -0.378557,
-    -0.378317,
-    -0.37806,
-    -0.377784,
-    -0.377491,
-    -0.37718,
-    -0.376851,
-    -0.376504,
-    -0.376138,
-    -0.375755,
-    -0.375353,
-    -0.374933,
-    -0.374494,
-    -0.374038,
-    -0.373563,
-    -0.373071,
-    -0.37256,
-    -0.372032,
-    -0.371486,
-    -0.370923,
-    -0.370343,
-    -0.369745,
-    -0.369131,
-    -0.3685,
-    -0.367853,
-    -0.36719,
-    -0.366511,
-    -0.365817,
-    -0.365109,
-    -0.364385,
-    -0.363647,
-    -0.362896,
-    -0.362131,
-    -0.361353,
-    -0.360562,
-    -0.35976,
-    -0.358946,
-    -0.358121,
-    -0.357285,
-    -0.356439,
-    -0.355583,
-    -0.354719,
-    -0.353846,
-    -0.352965,
-    -0.352077,
-    -0.351181,
-    -0.35028,
-    -0.349373,
-    -0.348461,
-    -0.347544,
-    -0.346624,
-    -0.3457,
-    -0.344774,
-    -0.343845,
-    -0.342916,
-    -0.341985,
-    -0.341054,
-    -0.340124,
-    -0.339194,
-    -0.338267,
-    -0.337341,
-    -0.336418,
-    -0.335499,
-    -0.334584,
-    -0.333673,
-    -0.332768,
-    -0.331868,
-    -0.330975,
-    -0.330089,
-    -0.32921,
-    -0.328339,
-    -0.327477,
-    -0.326624,
-    -0.32578,
-    -0.324946,
-    -0.324123,
-    -0.323311,
-    -0.322511,
-    -0.321722,
-    -0.320946,
-    -0.320182,
-    -0.319432,
-    -0.318695,
-    -0.317972,
-    -0.317264,
-    -0.31657,
-    -0.315891,
-    -0.315227,
-    -0.314579,
-    -0.313946,
-    -0.31333,
-    -0.312729,
-    -0.312145,
-    -0.311578,
-    -0.311027,
-    -0.310494,
-    -0.309977,
-    -0.309478,
-    -0.308996,
-    -0.308531,
-    -0.308083,
-    -0.307653,
-    -0.30724,
-    -0.306844,
-    -0.306466,
-    -0.306104,
-    -0.30576,
-    -0.305433,
-    -0.305123,
-    -0.30483,
-    -0.304553,
-    -0.304292,
-    -0.304048,
-    -0.30382,
-    -0.303607,
-    -0.30341,
-    -0.303229,
-    -0.303062,
-    -0.302909,
-    -0.302771,
-    -0.302647,
-    -0.302537,
-    -0.30244,
-    -0.302355,
-    -0.302283,
-    -0.302223,
-    -0.302174,
-    -0.302136,
-    -0.302109,
-    -0.302093,
-    -0.302085,
-    -0.302088,
-    -0.302098,
-    -0.302117,
-    -0.302143,
-    -0.302177,
-    -0.302217,
-    -0.302263,
-    -0.302315,
-    -0.302371,
-    -0.302431,
-    -0.302496,
-    -0.302563,
-    -0.302634,
-    -0.302706,
-    -0.302779,
-    -0.302854,
-    -0.302928,
-    -0.303002,
-    -0.303076,
-    -0.303148,
-    -0.303217,
-    -0.303284,
-    -0.303348,
-    -0.303408,
-    -0.303464,
-    -0.303515,
-    -0.30356,
-    -0.303599,
-    -0.303632,
-    -0.303658,
-    -0.303676,
-    -0.303686,
-    -0.303687,
-    -0.303679,
-    -0.303662,
-    -0.303635,
-    -0.303597,
-    -0.303548,
-    -0.303488,
-    -0.303416,
-    -0.303332,
-    -0.303235,
-    -0.303125,
-    -0.303003,
-    -0.302866,
-    -0.302716,
-    -0.302551,
-    -0.302372,
-    -0.302178,
-    -0.301969,
-    -0.301744,
-    -0.301504,
-    -0.301249,
-    -0.300977,
-    -0.30069,
-    -0.300386,
-    -0.300066,
-    -0.29973,
-    -0.299377,
-    -0.299008,
-    -0.298622,
-    -0.29822,
-    -0.297801,
-    -0.297365,
-    -0.296913,
-    -0.296444,
-    -0.295959,
-    -0.295458,
-    -0.294941,
-    -0.294407,
-    -0.293858,
-    -0.293292,
-    -0.292712,
-    -0.292116,
-    -0.291504,
-    -0.290878,
-    -0.290238,
-    -0.289583,
-    -0.288914,
-    -0.288231,
-    -0.287535,
-    -0.286826,
-    -0.286104,
-    -0.28537,
-    -0.284624,
-    -0.283867,
-    -0.283098,
-    -0.282319,
-    -0.28153,
-    -0.28073,
-    -0.279922,
-    -0.279105,
-    -0.278279,
-    -0.277445,
-    -0.276604,
-    -0.275757,
-    -0.274903,
-    -0.274043,
-    -0.273178,
-    -0.272308,
-    -0.271434,
-    -0.270556,
-    -0.269676,
-    -0.268792,
-    -0.267907,
-    -0.267021,
-    -0.266133,
-    -0.265245,
-    -0.264358,
-    -0.263471,
-    -0.262586,
-    -0.261703,
-    -0.260822,
-    -0.259945,
-    -0.259071,
-    -0.258201,
-    -0.257335,
-    -0.256475,
-    -0.255621,
-    -0.254773,
-    -0.253932,
-    -0.253098,
-    -0.252272,
-    -0.251454,
-    -0.250644,
-    -0.249844,
-    -0.249054,
-    -0.248273,
-    -0.247504,
-    -0.246744,
-    -0.245997,
-    -0.245261,
-    -0.244537,
-    -0.243825,
-    -0.243126,
-    -0.24244,
-    -0.241768,
-    -0.241109,
-    -0.240465,
-    -0.239834,
-    -0.239218,
-    -0.238617,
-    -0.23803,
-    -0.237459,
-    -0.236903,
-    -0.236362,
-    -0.235837,
-    -0.235328,
-    -0.234834,
-    -0.234356,
-    -0.233894,
-    -0.233448,
-    -0.233019,
-    -0.232605,
-    -0.232207,
-    -0.231825,
-    -0.231458,
-    -0.231108,
-    -0.230773,
-    -0.230454,
-    -0.230151,
-    -0.229863,
-    -0.22959,
-    -0.229332,
-    -0.229089,
-    -0.22886,
-    -0.228646,
-    -0.228445,
-    -0.228259,
-    -0.228086,
-    -0.227927,
-    -0.22778,
-    -0.227646,
-    -0.227524,
-    -0.227414,
-    -0.227316,
-    -0.227229,
-    -0.227152,
-    -0.227086,
-    -0.22703,
-    -0.226983,
-    -0.226945,
-    -0.226916,
-    -0.226895,
-    -0.226881,
-    -0.226875,
-    -0.226875,
-    -0.226882,
-    -0.226894,
-    -0.226911,
-    -0.226933,
-    -0.226959,
-    -0.226988,
-    -0.22702,
-    -0.227055,
-    -0.227092,
-    -0.22713,
-    -0.227169,
-    -0.227209,
-    -0.227248,
-    -0.227286,
-    -0.227323,
-    -0.227359,
-    -0.227392,
-    -0.227421,
-    -0.227448,
-    -0.22747,
-    -0.227488,
-    -0.227501,
-    -0.227509,
-    -0.22751,
-    -0.227505,
-    -0.227493,
-    -0.227474,
-    -0.227447,
-    -0.227411,
-    -0.227366,
-    -0.227312,
-    -0.227249,
-    -0.227175,
-    -0.227091,
-    -0.226995,
-    -0.226889,
-    -0.226771,
-    -0.226641,
-    -0.226498,
-    -0.226343,
-    -0.226175,
-    -0.225994,
-    -0.2258,
-    -0.225591,
-    -0.225369,
-    -0.225132,
-    -0.224881,
-    -0.224615,
-    -0.224335,
-    -0.224039,
-    -0.223729,
-    -0.223403,
-    -0.223062,
-    -0.222706,
-    -0.222334,
-    -0.221947,
-    -0.221545,
-    -0.221126,
-    -0.220693,
-    -0.220244,
-    -0.219779,
-    -0.219299,
-    -0.218804,
-    -0.218294,
-    -0.217769,
-    -0.217229,
-    -0.216674,
-    -0.216104,
-    -0.21552,
-    -0.214922,
-    -0.21431,
-    -0.213685,
-    -0.213046,
-    -0.212394,
-    -0.211729,
-    -0.211051,
-    -0.210361,
-    -0.209659,
-    -0.208946,
-    -0.208221,
-    -0.207486,
-    -0.20674,
-    -0.205984,
-    -0.205218,
-    -0.204443,
-    -0.20366,
-    -0.202868,
-    -0.202068,
-    -0.201261,
-    -0.200446,
-    -0.199626,
-    -0.198799,
-    -0.197967,
-    -0.197129,
-    -0.196288,
-    -0.195442,
-    -0.194592,
-    -0.19374,
-    -0.192886,
-    -0.192029,
-    -0.191171,
-    -0.190312,
-    -0.189453,
-    -0.188594,
-    -0.187735,
-    -0.186878,
-    -0.186023,
-    -0.18517,
-    -0.18432,
-    -0.183473,
-    -0.18263,
-    -0.181791,
-    -0.180957,
-    -0.180128,
-    -0.179305,
-    -0.178489,
-    -0.177679,
-    -0.176877,
-    -0.176082,
-    -0.175295,
-    -0.174517,
-    -0.173748,
-    -0.172988,
-    -0.172238,
-    -0.171499,
-    -0.170769,
-    -0.170051,
-    -0.169344,
-    -0.168649,
-    -0.167966,
-    -0.167295,
-    -0.166637,
-    -0.165991,
-    -0.165359,
-    -0.16474,
-    -0.164135,
-    -0.163543,
-    -0.162966,
-    -0.162402,
-    -0.161853,
-    -0.161319,
-    -0.160799,
-    -0.160294,
-    -0.159804,
-    -0.159329,
-    -0.158869,
-    -0.158424,
-    -0.157995,
-    -0.15758,
-    -0.15718,
-    -0.156796,
-    -0.156426,
-    -0.156071,
-    -0.155732,
-    -0.155407,
-    -0.155096,
-    -0.154801,
-    -0.154519,
-    -0.154252,
-    -0.153999,
-    -0.15376,
-    -0.153534,
-    -0.153322,
-    -0.153123,
-    -0.152936,
-    -0.152763,
-    -0.152601,
-    -0.152452,
-    -0.152314,
-    -0.152188,
-    -0.152072,
-    -0.151967,
-    -0.151873,
-    -0.151788,
-    -0.151713,
-    -0.151646,
-    -0.151588,
-    -0.151539,
-    -0.151497,
-    -0.151463,
-    -0.151435,
-    -0.151414,
-    -0.151398,
-    -0.151388,
-    -0.151383,
-    -0.151383,
-    -0.151386,
-    -0.151393,
-    -0.151403,
-    -0.151415,
-    -0.151429,
-    -0.151444,
-    -0.151461,
-    -0.151478,
-    -0.151494,
-    -0.15151,
-    -0.151525,
-    -0.151538,
-    -0.151549,
-    -0.151557,
-    -0.151562,
-    -0.151563,
-    -0.151561,
-    -0.151553,
-    -0.15154,
-    -0.151522,
-    -0.151497,
-    -0.151466,
-    -0.151428,
-    -0.151382,
-    -0.151329,
-    -0.151267,
-    -0.151196,
-    -0.151116,
-    -0.151027,
-    -0.150927,
-    -0.150817,
-    -0.150697,
-    -0.150565,
-    -0.150422,
-    -0.150268,
-    -0.150101,
-    -0.149922,
-    -0.149731,
-    -0.149526,
-    -0.149309,
-    -0.149078,
-    -0.148834,
-    -0.148576,
-    -0.148304,
-    -0.148018,
-    -0.147718,
-    -0.147403,
-    -0.147074,
-    -0.14673,
-    -0.146372,
-    -0.145999,
-    -0.145611,
-    -0.145209,
-    -0.144791,
-    -0.144359,
-    -0.143912,
-    -0.14345,
-    -0.142974,
-    -0.142483,
-    -0.141977,
-    -0.141457,
-    -0.140923,
-    -0.140375,
-    -0.139813,
-    -0.139237,
-    -0.138647,
-    -0.138044,
-    -0.137428,
-    -0.136799,
-    -0.136158,
-    -0.135504,
-    -0.134838,
-    -0.13416,
-    -0.133471,
-    -0.13277,
-    -0.132059,
-    -0.131337,
-    -0.130606,
-    -0.129864,
-    -0.129114,
-    -0.128354,
-    -0.127586,
-    -0.12681,
-    -0.126026,
-    -0.125235,
-    -0.124437,
-    -0.123633,
-    -0.122823,
-    -0.122008,
-    -0.121188,
-    -0.120364,
-    -0.119535,
-    -0.118703,
-    -0.117869,
-    -0.117032,
-    -0.116192,
-    -0.115352,
-    -0.114511,
-    -0.113669,
-    -0.112827,
-    -0.111986,
-    -0.111146,
-    -0.110308,
-    -0.109472,
-    -0.108638,
-    -0.107808,
-    -0.106981,
-    -0.106158,
-    -0.10534,
-    -0.104527,
-    -0.103719,
-    -0.102917,
-    -0.102122,
-    -0.101334,
-    -0.100553,
-    -0.0997797,
-    -0.0990147,
-    -0.0982584,
-    -0.097511,
-    -0.096773,
-    -0.0960448,
-    -0.0953268,
-    -0.0946192,
-    -0.0939225,
-    -0.093237,
-    -0.0925629,
-    -0.0919007,
-    -0.0912506,
-    -0.0906128,
-    -0.0899876,
-    -0.0893753,
-    -0.0887761,
-    -0.0881902,
-    -0.0876178,
-    -0.0870591,
-    -0.0865143,
-    -0.0859835,
-    -0.0854668,
-    -0.0849643,
-    -0.0844762,
-    -0.0840026,
-    -0.0835434,
-    -0.0830988,
-    -0.0826688,
-    -0.0822533,
-    -0.0818525,
-    -0.0814661,
-    -0.0810944,
-    -0.080737,
-    -0.0803941,
-    -0.0800655,
-    -0.079751,
-    -0.0794506,
-    -0.0791642,
-    -0.0788915,
-    -0.0786324,
-    -0.0783867,
-    -0.0781542,
-    -0.0779347,
-    -0.0777279,
-    -0.0775336,
-    -0.0773515,
-    -0.0771813,
-    -0.0770228,
-    -0.0768756,
-    -0.0767394,
-    -0.0766139,
-    -0.0764986,
-    -0.0763934,
-    -0.0762977,
-    -0.0762113,
-    -0.0761336,
-    -0.0760644,
-    -0.0760031,
-    -0.0759494,
-    -0.0759028,
-    -0.075863,
-    -0.0758293,
-    -0.0758014,
-    -0.0757789,
-    -0.0757612,
-    -0.0757479,
-    -0.0757384,
-    -0.0757324,
-    -0.0757293,
-    -0.0757286,
-    -0.0757298,
-    -0.0757325,
-    -0.0757361,
-    -0.0757402,
-    -0.0757441,
-    -0.0757475,
-    -0.0757499,
-    -0.0757506,
-    -0.0757494,
-    -0.0757455,
-    -0.0757386,
-    -0.0757282,
-    -0.0757138,
-    -0.0756948,
-    -0.0756709,
-    -0.0756416,
-    -0.0756064,
-    -0.0755648,
-    -0.0755165,
-    -0.0754609,
-    -0.0753977,
-    -0.0753264,
-    -0.0752467,
-    -0.075158,
-    -0.0750601,
-    -0.0749525,
-    -0.074835,
-    -0.074707,
-    -0.0745684,
-    -0.0744188,
-    -0.0742577,
-    -0.0740851,
-    -0.0739005,
-    -0.0737037,
-    -0.0734944,
-    -0.0732724,
-    -0.0730374,
-    -0.0727893,
-    -0.0725279,
-    -0.0722529,
-    -0.0719642,
-    -0.0716616,
-    -0.0713451,
-    -0.0710145,
-    -0.0706696,
-    -0.0703105,
-    -0.069937,
-    -0.0695492,
-    -0.0691469,
-    -0.0687301,
-    -0.068299,
-    -0.0678533,
-    -0.0673934,
-    -0.066919,
-    -0.0664305,
-    -0.0659277,
-    -0.0654109,
-    -0.0648802,
-    -0.0643356,
-    -0.0637774,
-    -0.0632057,
-    -0.0626207,
-    -0.0620227,
-    -0.0614117,
-    -0.0607882,
-    -0.0601522,
-    -0.0595041,
-    -0.0588442,
-    -0.0581727,
-    -0.05749,
-    -0.0567963,
-    -0.056092,
-    -0.0553775,
-    -0.0546531,
-    -0.0539191,
-    -0.053176,
-    -0.0524241,
-    -0.0516639,
-    -0.0508957,
-    -0.05012,
-    -0.0493372,
-    -0.0485478,
-    -0.0477521,
-    -0.0469506,
-    -0.0461439,
-    -0.0453323,
-    -0.0445163,
-    -0.0436964,
-    -0.0428731,
-    -0.0420469,
-    -0.0412183,
-    -0.0403877,
-    -0.0395557,
-    -0.0387226,
-    -0.0378892,
-    -0.0370557,
-    -0.0362228,
-    -0.035391,
-    -0.0345606,
-    -0.0337322,
-    -0.0329064,
-    -0.0320835,
-    -0.0312642,
-    -0.0304487,
-    -0.0296378,
-    -0.0288317,
-    -0.0280309,
-    -0.027236,
-    -0.0264474,
-    -0.0256654,
-    -0.0248907,
-    -0.0241235,
-    -0.0233642,
-    -0.0226134,
-    -0.0218714,
-    -0.0211386,
-    -0.0204153,
-    -0.0197019,
-    -0.0189988,
-    -0.0183064,
-    -0.0176249,
-    -0.0169546,
-    -0.0162959,
-    -0.0156491,
-    -0.0150143,
-    -0.014392,
-    -0.0137823,
-    -0.0131854,
-    -0.0126016,
-    -0.0120311,
-    -0.0114741,
-    -0.0109306,
-    -0.0104009,
-    -0.00988515,
-    -0.0093834,
-    -0.00889576,
-    -0.00842234,
-    -0.00796318,
-    -0.00751835,
-    -0.00708788,
-    -0.00667178,
-    -0.00627005,
-    -0.00588267,
-    -0.00550962,
-    -0.00515083,
-    -0.00480623,
-    -0.00447575,
-    -0.00415928,
-    -0.0038567,
-    -0.00356786,
-    -0.00329263,
-    -0.00303084,
-    -0.00278229,
-    -0.00254679,
-    -0.00232412,
-    -0.00211405,
-    -0.00191633,
-    -0.00173071,
-    -0.00155691,
-    -0.00139465,
-    -0.0012436,
-    -0.00110348,
-    -0.000973929,
-    -0.000854623,
-    -0.000745204,
-    -0.000645308,
-    -0.000554556,
-    -0.000472561,
-    -0.000398924,
-    -0.000333239,
-    -0.000275087,
-    -0.000224042,
-    -0.000179669,
-    -0.000141524,
-    -0.000109159,
-    -8.21152e-05,
-    -5.99296e-05,
-    -4.2133e-05,
-    -2.8251e-05,
-    -1.78045e-05,
-    -1.03103e-05,
-    -5.28167e-06,
-    -2.22913e-06,
-    -6.6068e-07,
-    -8.25997e-08,
-    0,
-    8.25997e-08,
-    6.6068e-07,
-    2.22913e-06,
-    5.28167e-06,
-    1.03103e-05,
-    1.78045e-05,
-    2.8251e-05,
-    4.2133e-05,
-    5.99296e-05,
-    8.21152e-05,
-    0.000109159,
-    0.000141524,
-    0.000179669,
-    0.000224042,
-    0.000275087,
-    0.000333239,
-    0.000398924,
-    0.000472561,
-    0.000554556,
-    0.000645308,
-    0.000745204,
-    0.000854623,
-    0.000973929,
-    0.00110348,
-    0.0012436,
-    0.00139465,
-    0.00155691,
-    0.00173071,
-    0.00191633,
-    0.00211405,
-    0.00232412,
-    0.00254679,
-    0.00278229,
-    0.00303084,
-    0.00329263,
-    0.00356786,
-    0.0038567,
-    0.00415928,
-    0.00447575,
-    0.00480623,
-    0.00515083,
-    0.00550962,
-    0.00588267,
-    0.00627005,
-    0.00667178,
-    0.00708788,
-    0.00751835,
-    0.00796318,
-    0.00842234,
-    0.00889576,
-    0.0093834,
-    0.00988515,
-    0.0104009,
-    0.0109306,
-    0.0114741,
-    0.0120311,
-    0.0126016,
-    0.0131854,
-    0.0137823,
-    0.014392,
-    0.0150143,
-    0.0156491,
-    0.0162959,
-    0.0169546,
-    0.0176249,
-    0.0183064,
-    0.0189988,
-    0.0197019,
-    0.0204153,
-    0.0211386,
-    0.0218714,
-    0.0226134,
-    0.0233642,
-    0.0241235,
-    0.0248907,
-    0.0256654,
-    0.0264474,
-    0.027236,
-    0.0280309,
-    0.0288317,
-    0.0296378,
-    0.0304487,
-    0.0312642,
-    0.0320835,
-    0.0329064,
-    0.0337322,
-    0.0345606,
-    0.035391,
-    0.0362228,
-    0.0370557,
-    0.0378892,
-    0.0387226,
-    0.0395557,
-    0.0403877,
-    0.0412183,
-    0.0420469,
-    0.0428731,
-    0.0436964,
-    0.0445163,
-    0.0453323,
-    0.0461439,
-    0.0469506,
-    0.0477521,
-    0.0485478,
-    0.0493372,
-    0.05012,
-    0.0508957,
-    0.0516639,
-    0.0524241,
-    0.053176,
-    0.0539191,
-    0.0546531,
-    0.0553775,
-    0.056092,
-    0.0567963,
-    0.05749,
-    0.0581727,
-    0.0588442,
-    0.0595041,
-    0.0601522,
-    0.0607882,
-    0.0614117,
-    0.0620227,
-    0.0626207,
-    0.0632057,
-    0.0637774,
-    0.0643356,
-    0.0648802,
-    0.0654109,
-    0.0659277,
-    0.0664305,
-    0.066919,
-    0.0673934,
-    0.0678533,
-    0.068299,
-    0.0687301,
-    0.0691469,
-    0.0695492,
-    0.069937,
-    0.0703105,
-    0.0706696,
-    0.0710145,
-    0.0713451,
-    0.0716616,
-    0.0719642,
-    0.0722529,
-    0.0725279,
-    0.0727893,
-    0.0730374,
-    0.0732724,
-    0.0734944,
-    0.0737037,
-    0.0739005,
-    0.0740851,
-    0.0742577,
-    0.0744188,
-    0.0745684,
-    0.074707,
-    0.074835,
-    0.0749525,
-    0.0750601,
-    0.075158,
-    0.0752467,
-    0.0753264,
-    0.0753977,
-    0.0754609,
-    0.0755165,
-    0.0755648,
-    0.0756064,
-    0.0756416,
-    0.0756709,
-    0.0756948,
-    0.0757138,
-    0.0757282,
-    0.0757386,
-    0.0757455,
-    0.0757494,
-    0.0757506,
-    0.0757499,
-    0.0757475,
-    0.0757441,
-    0.0757402,
-    0.0757361,
-    0.0757325,
-    0.0757298,
-    0.0757286,
-    0.0757293,
-    0.0757324,
-    0.0757384,
-    0.0757479,
-    0.0757612,
-    0.0757789,
-    0.0758014,
-    0.0758293,
-    0.075863,
-    0.0759028,
-    0.0759494,
-    0.0760031,
-    0.0760644,
-    0.0761336,
-    0.0762113,
-    0.0762977,
-    0.0763934,
-    0.0764986,
-    0.0766139,
-    0.0767394,
-    0.0768756,
-    0.0770228,
-    0.0771813,
-    0.0773515,
-    0.0775336,
-    0.0777279,
-    0.0779347,
-    0.0781542,
-    0.0783867,
-    0.0786324,
-    0.0788915,
-    0.0791642,
-    0.0794506,
-    0.079751,
-    0.0800655,
-    0.0803941,
-    0.080737,
-    0.0810944,
-    0.0814661,
-    0.0818525,
-    0.0822533,
-    0.0826688,
-    0.0830988,
-    0.0835434,
-    0.0840026,
-    0.0844762,
-    0.0849643,
-    0.0854668,
-    0.0859835,
-    0.0865143,
-    0.0870591,
-    0.0876178,
-    0.0881902,
-    0.0887761,
-    0.0893753,
-    0.0899876,
-    0.0906128,
-    0.0912506,
-    0.0919007,
-    0.0925629,
-    0.093237,
-    0.0939225,
-    0.0946192,
-    0.0953268,
-    0.0960448,
-    0.096773,
-    0.097511,
-    0.0982584,
-    0.0990147,
-    0.0997797,
-    0.100553,
-    0.101334,
-    0.102122,
-    0.102917,
-    0.103719,
-    0.104527,
-    0.10534,
-    0.106158,
-    0.106981,
-    0.107808,
-    0.108638,
-    0.109472,
-    0.110308,
-    0.111146,
-    0.111986,
-    0.112827,
-    0.113669,
-    0.114511,
-    0.115352,
-    0.116192,
-    0.117032,
-    0.117869,
-    0.118703,
-    0.119535,
-    0.120364,
-    0.121188,
-    0.122008,
-    0.122823,
-    0.123633,
-    0.124437,
-    0.125235,
-    0.126026,
-    0.12681,
-    0.127586,
-    0.128354,
-    0.129114,
-    0.129864,
-    0.130606,
-    0.131337,
-    0.132059,
-    0.13277,
-    0.133471,
-    0.13416,
-    0.134838,
-    0.135504,
-    0.136158,
-    0.136799,
-    0.137428,
-    0.138044,
-    0.138647,
-    0.139237,
-    0.139813,
-    0.140375,
-    0.140923,
-    0.141457,
-    0.141977,
-    0.142483,
-    0.142974,
-    0.14345,
-    0.143912,
-    0.144359,
-    0.144791,
-    0.145209,
-    0.145611,
-    0.145999,
-    0.146372,
-    0.14673,
-    0.147074,
-    0.147403,
-    0.147718,
-    0.148018,
-    0.148304,
-    0.148576,
-    0.148834,
-    0.149078,
-    0.149309,
-    0.149526,
-    0.149731,
-    0.149922,
-    0.150101,
-    0.150268,
-    0.150422,
-    0.150565,
-    0.150697,
-    0.150817,
-    0.150927,
-    0.151027,
-    0.151116,
-    0.151196,
-    0.151267,
-    0.151329,
-    0.151382,
-    0.151428,
-    0.151466,
-    0.151497,
-    0.151522,
-    0.15154,
-    0.151553,
-    0.151561,
-    0.151563,
-    0.151562,
-    0.151557,
-    0.151549,
-    0.151538,
-    0.151525,
-    0.15151,
-    0.151494,
-    0.151478,
-    0.151461,
-    0.151444,
-    0.151429,
-    0.151415,
-    0.151403,
-    0.151393,
-    0.151386,
-    0.151383,
-    0.151383,
-    0.151388,
-    0.151398,
-    0.151414,
-    0.151435,
-    0.151463,
-    0.151497,
-    0.151539,
-    0.151588,
-    0.151646,
-    0.151713,
-    0.151788,
-    0.151873,
-    0.151967,
-    0.152072,
-    0.152188,
-    0.152314,
-    0.152452,
-    0.152601,
-    0.152763,
-    0.152936,
-    0.153123,
-    0.153322,
-    0.153534,
-    0.15376,
-    0.153999,
-    0.154252,
-    0.154519,
-    0.154801,
-    0.155096,
-    0.155407,
-    0.155732,
-    0.156071,
-    0.156426,
-    0.156796,
-    0.15718,
-    0.15758,
-    0.157995,
-    0.158424,
-    0.158869,
-    0.159329,
-    0.159804,
-    0.160294,
-    0.160799,
-    0.161319,
-    0.161853,
-    0.162402,
-    0.162966,
-    0.163543,
-    0.164135,
-    0.16474,
-    0.165359,
-    0.165991,
-    0.166637,
-    0.167295,
-    0.167966,
-    0.168649,
-    0.169344,
-    0.170051,
-    0.170769,
-    0.171499,
-    0.172238,
-    0.172988,
-    0.173748,
-    0.174517,
-    0.175295,
-    0.176082,
-    0.176877,
-    0.177679,
-    0.178489,
-    0.179305,
-    0.180128,
-    0.180957,
-    0.181791,
-    0.18263,
-    0.183473,
-    0.18432,
-    0.18517,
-    0.186023,
-    0.186878,
-    0.187735,
-    0.188594,
-    0.189453,
-    0.190312,
-    0.191171,
-    0.192029,
-    0.192886,
-    0.19374,
-    0.194592,
-    0.195442,
-    0.196288,
-    0.197129,
-    0.197967,
-    0.198799,
-    0.199626,
-    0.200446,
-    0.201261,
-    0.202068,
-    0.202868,
-    0.20366,
-    0.204443,
-    0.205218,
-    0.205984,
-    0.20674,
-    0.207486,
-    0.208221,
-    0.208946,
-    0.209659,
-    0.210361,
-    0.211051,
-    0.211729,
-    0.212394,
-    0.213046,
-    0.213685,
-    0.21431,
-    0.214922,
-    0.21552,
-    0.216104,
-    0.216674,
-    0.217229,
-    0.217769,
-    0.218294,
-    0.218804,
-    0.219299,
-    0.219779,
-    0.220244,
-    0.220693,
-    0.221126,
-    0.221545,
-    0.221947,
-    0.222334,
-    0.222706,
-    0.223062,
-    0.223403,
-    0.223729,
-    0.224039,
-    0.224335,
-    0.224615,
-    0.224881,
-    0.225132,
-    0.225369,
-    0.225591,
-    0.2258,
-    0.225994,
-    0.226175,
-    0.226343,
-    0.226498,
-    0.226641,
-    0.226771,
-    0.226889,
-    0.226995,
-    0.227091,
-    0.227175,
-    0.227249,
-    0.227312,
-    0.227366,
-    0.227411,
-    0.227447,
-    0.227474,
-    0.227493,
-    0.227505,
-    0.22751,
-    0.227509,
-    0.227501,
-    0.227488,
-    0.22747,
-    0.227448,
-    0.227421,
-    0.227392,
-    0.227359,
-    0.227323,
-    0.227286,
-    0.227248,
-    0.227209,
-    0.227169,
-    0.22713,
-    0.227092,
-    0.227055,
-    0.22702,
-    0.226988,
-    0.226959,
-    0.226933,
-    0.226911,
-    0.226894,
-    0.226882,
-    0.226875,
-    0.226875,
-    0.226881,
-    0.226895,
-    0.226916,
-    0.226945,
-    0.226983,
-    0.22703,
-    0.227086,
-    0.227152,
-    0.227229,
-    0.227316,
-    0.227414,
-    0.227524,
-    0.227646,
-    0.22778,
-    0.227927,
-    0.228086,
-    0.228259,
-    0.228445,
-    0.228646,
-    0.22886,
-    0.229089,
-    0.229332,
-    0.22959,
-    0.229863,
-    0.230151,
-    0.230454,
-    0.230773,
-    0.231108,
-    0.231458,
-    0.231825,
-    0.232207,
-    0.232605,
-    0.233019,
-    0.233448,
-    0.233894,
-    0.234356,
-    0.234834,
-    0.235328,
-    0.235837,
-    0.236362,
-    0.236903,
-    0.237459,
-    0.23803,
-    0.238617,
-    0.239218,
-    0.239834,
-    0.240465,
-    0.241109,
-    0.241768,
-    0.24244,
-    0.243126,
-    0.243825,
-    0.244537,
-    0.245261,
-    0.245997,
-    0.246744,
-    0.247504,
-    0.248273,
-    0.249054,
-    0.249844,
-    0.250644,
-    0.251454,
-    0.252272,
-    0.253098,
-    0.253932,
-    0.254773,
-    0.255621,
-    0.256475,
-    0.257335,
-    0.258201,
-    0.259071,
-    0.259945,
-    0.260822,
-    0.261703,
-    0.262586,
-    0.263471,
-    0.264358,
-    0.265245,
-    0.266133,
-    0.267021,
-    0.267907,
-    0.268792,
-    0.269676,
-    0.270556,
-    0.271434,
-    0.272308,
-    0.273178,
-    0.274043,
-    0.274903,
-    0.275757,
-    0.276604,
-    0.277445,
-    0.278279,
-    0.279105,
-    0.279922,
-    0.28073,
-    0.28153,
-    0.282319,
-    0.283098,
-    0.283867,
-    0.284624,
-    0.28537,
-    0.286104,
-    0.286826,
-    0.287535,
-    0.288231,
-    0.288914,
-    0.289583,
-    0.290238,
-    0.290878,
-    0.291504,
-    0.292116,
-    0.292712,
-    0.293292,
-    0.293858,
-    0.294407,
-    0.294941,
-    0.295458,
-    0.295959,
-    0.296444,
-    0.296913,
-    0.297365,
-    0.297801,
-    0.29822,
-    0.298622,
-    0.299008,
-    0.299377,
-    0.29973,
-    0.300066,
-    0.300386,
-    0.30069,
-    0.300977,
-    0.301249,
-    0.301504,
-    0.301744,
-    0.301969,
-    0.302178,
-    0.302372,
-    0.302551,
-    0.302716,
-    0.302866,
-    0.303003,
-    0.303125,
-    0.303235,
-    0.303332,
-    0.303416,
-    0.303488,
-    0.303548,
-    0.303597,
-    0.303635,
-    0.303662,
-    0.303679,
-    0.303687,
-    0.303686,
-    0.303676,
-    0.303658,
-    0.303632,
-    0.303599,
-    0.30356,
-    0.303515,
-    0.303464,
-    0.303408,
-    0.303348,
-    0.303284,
-    0.303217,
-    0.303148,
-    0.303076,
-    0.303002,
-    0.302928,
-    0.302854,
-    0.302779,
-    0.302706,
-    0.302634,
-    0.302563,
-    0.302496,
-    0.302431,
-    0.302371,
-    0.302315,
-    0.302263,
-    0.302217,
-    0.302177,
-    0.302143,
-    0.302117,
-    0.302098,
-    0.302088,
-    0.302085,
-    0.302093,
-    0.302109,
-    0.302136,
-    0.302174,
-    0.302223,
-    0.302283,
-    0.302355,
-    0.30244,
-    0.302537,
-    0.302647,
-    0.302771,
-    0.302909,
-    0.303062,
-    0.303229,
-    0.30341,
-    0.303607,
-    0.30382,
-    0.304048,
-    0.304292,
-    0.304553,
-    0.30483,
-    0.305123,
-    0.305433,
-    0.30576,
-    0.306104,
-    0.306466,
-    0.306844,
-    0.30724,
-    0.307653,
-    0.308083,
-    0.308531,
-    0.308996,
-    0.309478,
-    0.309977,
-    0.310494,
-    0.311027,
-    0.311578,
-    0.312145,
-    0.312729,
-    0.31333,
-    0.313946,
-    0.314579,
-    0.315227,
-    0.315891,
-    0.31657,
-    0.317264,
-    0.317972,
-    0.318695,
-    0.319432,
-    0.320182,
-    0.320946,
-    0.321722,
-    0.322511,
-    0.323311,
-    0.324123,
-    0.324946,
-    0.32578,
-    0.326624,
-    0.327477,
-    0.328339,
-    0.32921,
-    0.330089,
-    0.330975,
-    0.331868,
-    0.332768,
-    0.333673,
-    0.334584,
-    0.335499,
-    0.336418,
-    0.337341,
-    0.338267,
-    0.339194,
-    0.340124,
-    0.341054,
-    0.341985,
-    0.342916,
-    0.343845,
-    0.344774,
-    0.3457,
-    0.346624,
-    0.347544,
-    0.348461,
-    0.349373,
-    0.35028,
-    0.351181,
-    0.352077,
-    0.352965,
-    0.353846,
-    0.354719,
-    0.355583,
-    0.356439,
-    0.357285,
-    0.358121,
-    0.358946,
-    0.35976,
-    0.360562,
-    0.361353,
-    0.362131,
-    0.362896,
-    0.363647,
-    0.364385,
-    0.365109,
-    0.365817,
-    0.366511,
-    0.36719,
-    0.367853,
-    0.3685,
-    0.369131,
-    0.369745,
-    0.370343,
-    0.370923,
-    0.371486,
-    0.372032,
-    0.37256,
-    0.373071,
-    0.373563,
-    0.374038,
-    0.374494,
-    0.374933,
-    0.375353,
-    0.375755,
-    0.376138,
-    0.376504,
-    0.376851,
-    0.37718,
-    0.377491,
-    0.377784,
-    0.37806,
-    0.378317,
-    0.378557,
-    0.37878,
-    0.378986,
-    0.379175,
-    0.379347,
-    0.379503,
-    0.379643,
-    0.379767,
-    0.379875,
-    0.379969,
-    0.380048,
-    0.380112,
-    0.380163,
-    0.3802,
-    0.380224,
-    0.380235,
-    0.380235,
-    0.380222,
-    0.380199,
-    0.380164,
-    0.38012,
-    0.380066,
-    0.380003,
-    0.379931,
-    0.379852,
-    0.379765,
-    0.379671,
-    0.379571,
-    0.379466,
-    0.379356,
-    0.379241,
-    0.379123,
-    0.379002,
-    0.378878,
-    0.378752,
-    0.378626,
-    0.378498,
-    0.378371,
-    0.378245,
-    0.37812,
-    0.377998,
-    0.377878,
-    0.377761,
-    0.377649,
-    0.377541,
-    0.377438,
-    0.377342,
-    0.377251,
-    0.377168,
-    0.377093,
-    0.377026,
-    0.376968,
-    0.37692,
-    0.376881,
-    0.376854,
-    0.376837,
-    0.376832,
-    0.376839,
-    0.376859,
-    0.376893,
-    0.376939,
-    0.377001,
-    0.377076,
-    0.377167,
-    0.377273,
-    0.377395,
-    0.377533,
-    0.377687,
-    0.377859,
-    0.378048,
-    0.378254,
-    0.378478,
-    0.378719,
-    0.37898,
-    0.379258,
-    0.379555,
-    0.379871,
-    0.380206,
-    0.38056,
-    0.380933,
-    0.381326,
-    0.381738,
-    0.382169,
-    0.382619,
-    0.383089,
-    0.383578,
-    0.384086,
-    0.384614,
-    0.38516,
-    0.385726,
-    0.38631,
-    0.386913,
-    0.387534,
-    0.388173,
-    0.38883,
-    0.389505,
-    0.390198,
-    0.390907,
-    0.391633,
-    0.392376,
-    0.393135,
-    0.393909,
-    0.394699,
-    0.395503,
-    0.396322,
-    0.397155,
-    0.398001,
-    0.39886,
-    0.399732,
-    0.400616,
-    0.401511,
-    0.402417,
-    0.403333,
-    0.404259,
-    0.405194,
-    0.406137,
-    0.407088,
-    0.408047,
-    0.409012,
-    0.409983,
-    0.41096,
-    0.411941,
-    0.412926,
-    0.413915,
-    0.414906,
-    0.415899,
-    0.416893,
-    0.417888,
-    0.418883,
-    0.419877,
-    0.42087,
-    0.42186,
-    0.422848,
-    0.423832,
-    0.424812,
-    0.425787,
-    0.426757,
-    0.42772,
-    0.428676,
-    0.429625,
-    0.430565,
-    0.431497,
-    0.432419,
-    0.433332,
-    0.434233,
-    0.435123,
-    0.436002,
-    0.436868,
-    0.437721,
-    0.43856,
-    0.439386,
-    0.440196,
-    0.440992,
-    0.441772,
-    0.442537,
-    0.443285,
-    0.444016,
-    0.444729,
-    0.445426,
-    0.446104,
-    0.446764,
-    0.447405,
-    0.448027,
-    0.44863,
-    0.449214,
-    0.449778,
-    0.450322,
-    0.450846,
-    0.451349,
-    0.451833,
-    0.452295,
-    0.452738,
-    0.453159,
-    0.45356,
-    0.45394,
-    0.4543,
-    0.454638,
-    0.454957,
-    0.455254,
-    0.455532,
-    0.455789,
-    0.456026,
-    0.456242,
-    0.45644,
-    0.456617,
-    0.456776,
-    0.456915,
-    0.457036,
-    0.457139,
-    0.457223,
-    0.45729,
-    0.45734,
-    0.457372,
-    0.457389,
-    0.457389,
-    0.457374,
-    0.457344,
-    0.457299,
-    0.457241,
-    0.457169,
-    0.457084,
-    0.456986,
-    0.456877,
-    0.456757,
-    0.456627,
-    0.456487,
-    0.456337,
-    0.456179,
-    0.456013,
-    0.45584,
-    0.45566,
-    0.455475,
-    0.455284,
-    0.455089,
-    0.454891,
-    0.454689,
-    0.454485,
-    0.45428,
-    0.454074,
-    0.453868,
-    0.453663,
-    0.45346,
-    0.453258,
-    0.45306,
-    0.452865,
-    0.452675,
-    0.45249,
-    0.452311,
-    0.452138,
-    0.451973,
-    0.451816,
-    0.451667,
-    0.451528,
-    0.451399,
-    0.451281,
-    0.451175,
-    0.45108,
-    0.450998,
-    0.450929,
-    0.450875,
-    0.450835,
-    0.450809,
-    0.4508,
-    0.450807,
-    0.45083,
-    0.450871,
-    0.450929,
-    0.451005,
-    0.4511,
-    0.451214,
-    0.451347,
-    0.4515,
-    0.451673,
-    0.451866,
-    0.452081,
-    0.452316,
-    0.452572,
-    0.45285,
-    0.453149,
-    0.453471,
-    0.453814,
-    0.45418,
-    0.454567,
-    0.454978,
-    0.45541,
-    0.455865,
-    0.456342,
-    0.456841,
-    0.457363,
-    0.457907,
-    0.458473,
-    0.459061,
-    0.459671,
-    0.460303,
-    0.460955,
-    0.461629,
-    0.462324,
-    0.463039,
-    0.463775,
-    0.464531,
-    0.465306,
-    0.4661,
-    0.466913,
-    0.467744,
-    0.468594,
-    0.46946,
-    0.470344,
-    0.471243,
-    0.472159,
-    0.47309,
-    0.474035,
-    0.474994,
-    0.475967,
-    0.476953,
-    0.477951,
-    0.47896,
-    0.47998,
-    0.48101,
-    0.482049,
-    0.483097,
-    0.484153,
-    0.485216,
-    0.486286,
-    0.487361,
-    0.488441,
-    0.489525,
-    0.490613,
-    0.491703,
-    0.492794,
-    0.493887,
-    0.494979,
-    0.496071,
-    0.497161,
-    0.498249,
-    0.499334,
-    0.500415,
-    0.501491,
-    0.502562,
-    0.503626,
-    0.504684,
-    0.505733,
-    0.506774,
-    0.507805,
-    0.508826,
-    0.509836,
-    0.510835,
-    0.511821,
-    0.512794,
-    0.513753,
-    0.514698,
-    0.515628,
-    0.516542,
-    0.51744,
-    0.518321,
-    0.519184,
-    0.52003,
-    0.520856,
-    0.521663,
-    0.522451,
-    0.523218,
-    0.523965,
-    0.524691,
-    0.525395,
-    0.526077,
-    0.526738,
-    0.527375,
-    0.52799,
-    0.528581,
-    0.529149,
-    0.529693,
-    0.530214,
-    0.53071,
-    0.531183,
-    0.531631,
-    0.532054,
-    0.532453,
-    0.532828,
-    0.533178,
-    0.533504,
-    0.533805,
-    0.534082,
-    0.534335,
-    0.534564,
-    0.534769,
-    0.53495,
-    0.535108,
-    0.535242,
-    0.535354,
-    0.535443,
-    0.535509,
-    0.535554,
-    0.535578,
-    0.53558,
-    0.535562,
-    0.535523,
-    0.535465,
-    0.535388,
-    0.535292,
-    0.535178,
-    0.535047,
-    0.534898,
-    0.534734,
-    0.534554,
-    0.53436,
-    0.534151,
-    0.533929,
-    0.533694,
-    0.533447,
-    0.533189,
-    0.53292,
-    0.532642,
-    0.532355,
-    0.53206,
-    0.531758,
-    0.53145,
-    0.531136,
-    0.530818,
-    0.530495,
-    0.53017,
-    0.529843,
-    0.529515,
-    0.529186,
-    0.528859,
-    0.528532,
-    0.528208,
-    0.527888,
-    0.527572,
-    0.52726,
-    0.526955,
-    0.526657,
-    0.526366,
-    0.526084,
-    0.525811,
-    0.525548,
-    0.525297,
-    0.525057,
-    0.524831,
-    0.524617,
-    0.524418,
-    0.524234,
-    0.524066,
-    0.523915,
-    0.523781,
-    0.523664,
-    0.523567,
-    0.523488,
-    0.52343,
-    0.523392,
-    0.523376,
-    0.523381,
-    0.523408,
-    0.523458,
-    0.523531,
-    0.523628,
-    0.523749,
-    0.523895,
-    0.524066,
-    0.524262,
-    0.524483,
-    0.524731,
-    0.525004,
-    0.525305,
-    0.525631,
-    0.525985,
-    0.526365,
-    0.526773,
-    0.527208,
-    0.527669,
-    0.528158,
-    0.528675,
-    0.529218,
-    0.529788,
-    0.530385,
-    0.531009,
-    0.53166,
-    0.532337,
-    0.53304,
-    0.533768,
-    0.534523,
-    0.535302,
-    0.536107,
-    0.536936,
-    0.537788,
-    0.538665,
-    0.539564,
-    0.540486,
-    0.54143,
-    0.542395,
-    0.543382,
-    0.544388,
-    0.545414,
-    0.546458,
-    0.547521,
-    0.548602,
-    0.549699,
-    0.550811,
-    0.551939,
-    0.553082,
-    0.554238,
-    0.555406,
-    0.556586,
-    0.557777,
-    0.558979,
-    0.560189,
-    0.561407,
-    0.562633,
-    0.563865,
-    0.565102,
-    0.566344,
-    0.567589,
-    0.568836,
-    0.570085,
-    0.571335,
-    0.572583,
-    0.573831,
-    0.575076,
-    0.576317,
-    0.577553,
-    0.578785,
-    0.580009,
-    0.581226,
-    0.582435,
-    0.583634,
-    0.584823,
-    0.586001,
-    0.587166,
-    0.588319,
-    0.589456,
-    0.59058,
-    0.591687,
-    0.592777,
-    0.59385,
-    0.594904,
-    0.595939,
-    0.596954,
-    0.597948,
-    0.598921,
-    0.599871,
-    0.600799,
-    0.601703,
-    0.602582,
-    0.603436,
-    0.604265,
-    0.605068,
-    0.605845,
-    0.606594,
-    0.607315,
-    0.608009,
-    0.608674,
-    0.60931,
-    0.609917,
-    0.610495,
-    0.611043,
-    0.611561,
-    0.612049,
-    0.612506,
-    0.612933,
-    0.613329,
-    0.613694,
-    0.614029,
-    0.614333,
-    0.614607,
-    0.614849,
-    0.615062,
-    0.615244,
-    0.615396,
-    0.615518,
-    0.615611,
-    0.615674,
-    0.615708,
-    0.615714,
-    0.615691,
-    0.615641,
-    0.615563,
-    0.615458,
-    0.615328,
-    0.615171,
-    0.61499,
-    0.614784,
-    0.614554,
-    0.614301,
-    0.614026,
-    0.613729,
-    0.613412,
-    0.613074,
-    0.612718,
-    0.612343,
-    0.61195,
-    0.611542,
-    0.611117,
-    0.610678,
-    0.610226,
-    0.609761,
-    0.609284,
-    0.608796,
-    0.608299,
-    0.607794,
-    0.607281,
-    0.606762,
-    0.606237,
-    0.605709,
-    0.605177,
-    0.604644,
-    0.60411,
-    0.603576,
-    0.603043,
-    0.602514,
-    0.601988,
-    0.601467,
-    0.600952,
-    0.600444,
-    0.599944,
-    0.599454,
-    0.598974,
-    0.598507,
-    0.598051,
-    0.59761,
-    0.597183,
-    0.596772,
-    0.596379,
-    0.596003,
-    0.595646,
-    0.595309,
-    0.594994,
-    0.5947,
-    0.594428,
-    0.594181,
-    0.593958,
-    0.59376,
-    0.593589,
-    0.593445,
-    0.593328,
-    0.59324,
-    0.593181,
-    0.593152,
-    0.593153,
-    0.593186,
-    0.59325,
-    0.593346,
-    0.593475,
-    0.593638,
-    0.593833,
-    0.594063,
-    0.594326,
-    0.594625,
-    0.594958,
-    0.595326,
-    0.595729,
-    0.596168,
-    0.596642,
-    0.597152,
-    0.597697,
-    0.598277,
-    0.598893,
-    0.599544,
-    0.600231,
-    0.600952,
-    0.601708,
-    0.602498,
-    0.603323,
-    0.604181,
-    0.605072,
-    0.605996,
-    0.606953,
-    0.607942,
-    0.608961,
-    0.610012,
-    0.611092,
-    0.612202,
-    0.61334,
-    0.614506,
-    0.6157,
-    0.616919,
-    0.618164,
-    0.619433,
-    0.620726,
-    0.622041,
-    0.623378,
-    0.624736,
-    0.626113,
-    0.627509,
-    0.628922,
-    0.630351,
-    0.631795,
-    0.633253,
-    0.634724,
-    0.636206,
-    0.637699,
-    0.6392,
-    0.64071,
-    0.642226,
-    0.643747,
-    0.645272,
-    0.6468,
-    0.648328,
-    0.649857,
-    0.651385,
-    0.65291,
-    0.654431,
-    0.655946,
-    0.657455,
-    0.658956,
-    0.660447,
-    0.661928,
-    0.663397,
-    0.664852,
-    0.666293,
-    0.667718,
-    0.669126,
-    0.670516,
-    0.671886,
-    0.673235,
-    0.674562,
-    0.675866,
-    0.677146,
-    0.6784,
-    0.679628,
-    0.680828,
-    0.681999,
-    0.683141,
-    0.684252,
-    0.685331,
-    0.686378,
-    0.687392,
-    0.688371,
-    0.689315,
-    0.690223,
-    0.691094,
-    0.691928,
-    0.692725,
-    0.693482,
-    0.694201,
-    0.69488,
-    0.695519,
-    0.696117,
-    0.696674,
-    0.69719,
-    0.697664,
-    0.698097,
-    0.698488,
-    0.698836,
-    0.699142,
-    0.699406,
-    0.699627,
-    0.699807,
-    0.699944,
-    0.700039,
-    0.700092,
-    0.700104,
-    0.700074,
-    0.700004,
-    0.699893,
-    0.699742,
-    0.699551,
-    0.699322,
-    0.699054,
-    0.698748,
-    0.698406,
-    0.698027,
-    0.697612,
-    0.697163,
-    0.69668,
-    0.696164,
-    0.695616,
-    0.695038,
-    0.694429,
-    0.693792,
-    0.693127,
-    0.692435,
-    0.691719,
-    0.690978,
-    0.690214,
-    0.689429,
-    0.688624,
-    0.6878,
-    0.686959,
-    0.686102,
-    0.68523,
-    0.684345,
-    0.683449,
-    0.682543,
-    0.681628,
-    0.680706,
-    0.679779,
-    0.678848,
-    0.677914,
-    0.676981,
-    0.676048,
-    0.675117,
-    0.674191,
-    0.673271,
-    0.672358,
-    0.671455,
-    0.670562,
-    0.669681,
-    0.668814,
-    0.667963,
-    0.667129,
-    0.666314,
-    0.665518,
-    0.664745,
-    0.663995,
-    0.66327,
-    0.662571,
-    0.6619,
-    0.661258,
-    0.660647,
-    0.660067,
-    0.659522,
-    0.65901,
-    0.658535,
-    0.658097,
-    0.657697,
-    0.657337,
-    0.657018,
-    0.65674,
-    0.656506,
-    0.656315,
-    0.656169,
-    0.656068,
-    0.656015,
-    0.656008,
-    0.65605,
-    0.65614,
-    0.65628,
-    0.65647,
-    0.65671,
-    0.657002,
-    0.657345,
-    0.65774,
-    0.658187,
-    0.658686,
-    0.659238,
-    0.659843,
-    0.6605,
-    0.66121,
-    0.661973,
-    0.662789,
-    0.663657,
-    0.664576,
-    0.665548,
-    0.666571,
-    0.667645,
-    0.66877,
-    0.669945,
-    0.671169,
-    0.672441,
-    0.673761,
-    0.675129,
-    0.676542,
-    0.678001,
-    0.679504,
-    0.681051,
-    0.682639,
-    0.684269,
-    0.685938,
-    0.687646,
-    0.68939,
-    0.691171,
-    0.692986,
-    0.694834,
-    0.696714,
-    0.698623,
-    0.70056,
-    0.702524,
-    0.704513,
-    0.706526,
-    0.708559,
-    0.710612,
-    0.712683,
-    0.71477,
-    0.71687,
-    0.718983,
-    0.721106,
-    0.723237,
-    0.725375,
-    0.727516,
-    0.729659,
-    0.731803,
-    0.733944,
-    0.736082,
-    0.738213,
-    0.740336,
-    0.742448,
-    0.744548,
-    0.746634,
-    0.748703,
-    0.750753,
-    0.752783,
-    0.754789,
-    0.756771,
-    0.758726,
-    0.760652,
-    0.762547,
-    0.764409,
-    0.766236,
-    0.768027,
-    0.769779,
-    0.77149,
-    0.773159,
-    0.774784,
-    0.776363,
-    0.777895,
-    0.779377,
-    0.780809,
-    0.782189,
-    0.783514,
-    0.784784,
-    0.785998,
-    0.787153,
-    0.788249,
-    0.789285,
-    0.790259,
-    0.79117,
-    0.792017,
-    0.792799,
-    0.793516,
-    0.794166,
-    0.794749,
-    0.795263,
-    0.795709,
-    0.796086,
-    0.796394,
-    0.796631,
-    0.796798,
-    0.796895,
-    0.796921,
-    0.796877,
-    0.796762,
-    0.796576,
-    0.79632,
-    0.795994,
-    0.795598,
-    0.795133,
-    0.794599,
-    0.793997,
-    0.793327,
-    0.792591,
-    0.791789,
-    0.790923,
-    0.789992,
-    0.788999,
-    0.787944,
-    0.786829,
-    0.785655,
-    0.784424,
-    0.783136,
-    0.781794,
-    0.7804,
-    0.778955,
-    0.77746,
-    0.775918,
-    0.774331,
-    0.772701,
-    0.771029,
-    0.769319,
-    0.767571,
-    0.765789,
-    0.763975,
-    0.762131,
-    0.76026,
-    0.758363,
-    0.756445,
-    0.754507,
-    0.752551,
-    0.750582,
-    0.7486,
-    0.74661,
-    0.744614,
-    0.742614,
-    0.740614,
-    0.738617,
-    0.736625,
-    0.734641,
-    0.732669,
-    0.73071,
-    0.728769,
-    0.726848,
-    0.724951,
-    0.723079,
-    0.721237,
-    0.719427,
-    0.717651,
-    0.715914,
-    0.714218,
-    0.712565,
-    0.71096,
-    0.709404,
-    0.7079,
-    0.706452,
-    0.705061,
-    0.703732,
-    0.702466,
-    0.701266,
-    0.700135,
-    0.699075,
-    0.698088,
-    0.697178,
-    0.696346,
-    0.695596,
-    0.694928,
-    0.694345,
-    0.693849,
-    0.693443,
-    0.693128,
-    0.692906,
-    0.692779,
-    0.692748,
-    0.692815,
-    0.692981,
-    0.693248,
-    0.693618,
-    0.69409,
-    0.694668,
-    0.69535,
-    0.696138,
-    0.697034,
-    0.698037,
-    0.699148,
-    0.700367,
-    0.701695,
-    0.703132,
-    0.704678,
-    0.706333,
-    0.708096,
-    0.709968,
-    0.711948,
-    0.714034,
-    0.716228,
-    0.718527,
-    0.720931,
-    0.723439,
-    0.726048,
-    0.728759,
-    0.73157,
-    0.734479,
-    0.737483,
-    0.740582,
-    0.743774,
-    0.747055,
-    0.750425,
-    0.75388,
-    0.757418,
-    0.761036,
-    0.764732,
-    0.768503,
-    0.772346,
-    0.776257,
-    0.780233,
-    0.784271,
-    0.788368,
-    0.79252,
-    0.796722,
-    0.800973,
-    0.805266,
-    0.809599,
-    0.813967,
-    0.818367,
-    0.822793,
-    0.827241,
-    0.831707,
-    0.836187,
-    0.840675,
-    0.845167,
-    0.849657,
-    0.854142,
-    0.858616,
-    0.863074,
-    0.867511,
-    0.871922,
-    0.876301,
-    0.880643,
-    0.884944,
-    0.889197,
-    0.893398,
-    0.89754,
-    0.901618,
-    0.905628,
-    0.909563,
-    0.913417,
-    0.917186,
-    0.920864,
-    0.924444,
-    0.927923,
-    0.931293,
-    0.93455,
-    0.937688,
-    0.940702,
-    0.943585,
-    0.946334,
-    0.948941,
-    0.951402,
-    0.953712,
-    0.955865,
-    0.957856,
-    0.95968,
-    0.961331,
-    0.962805,
-    0.964097,
-    0.965201,
-    0.966113,
-    0.966829,
-    0.967343,
-    0.967651,
-    0.967748,
-    0.967631,
-    0.967294,
-    0.966734,
-    0.965947,
-    0.964928,
-    0.963674,
-    0.962182,
-    0.960447,
-    0.958467,
-    0.956238,
-    0.953756,
-    0.95102,
-    0.948025,
-    0.944769,
-    0.941251,
-    0.937466,
-    0.933414,
-    0.929092,
-    0.924497,
-    0.919629,
-    0.914486,
-    0.909066,
-    0.903368,
-    0.89739,
-    0.891133,
-    0.884595,
-    0.877775,
-    0.870674,
-    0.863291,
-    0.855625,
-    0.847678,
-    0.83945,
-    0.83094,
-    0.822151,
-    0.813081,
-    0.803734,
-    0.794109,
-    0.784209,
-    0.774035,
-    0.763588,
-    0.752871,
-    0.741886,
-    0.730636,
-    0.719122,
-    0.707347,
-    0.695315,
-    0.683028,
-    0.67049,
-    0.657704,
-    0.644673,
-    0.631402,
-    0.617893,
-    0.604152,
-    0.590183,
-    0.575989,
-    0.561575,
-    0.546947,
-    0.532108,
-    0.517065,
-    0.501821,
-    0.486382,
-    0.470754,
-    0.454943,
-    0.438953,
-    0.42279,
-    0.406462,
-    0.389972,
-    0.373329,
-    0.356537,
-    0.339604,
-    0.322535,
-    0.305338,
-    0.288018,
-    0.270584,
-    0.25304,
-    0.235395,
-    0.217655,
-    0.199828,
-    0.18192,
-    0.163938,
-    0.145891,
-    0.127784,
-    0.109625,
-    0.0914226,
-    0.0731826,
-    0.0549129,
-    0.036621,
-    0.0183142
-};
-
-// Top frequency: 44.1K * 0.0580499
-constexpr static std::array<float, 4096> wt_sawtooth_0x7 =
-{
-    0,
-    -0.00915757,
-    -0.0183141,
-    -0.0274687,
-    -0.0366204,
-    -0.045768,
-    -0.0549107,
-    -0.0640475,
-    -0.0731773,
-    -0.0822992,
-    -0.0914123,
-    -0.100515,
-    -0.109608,
-    -0.118688,
-    -0.127756,
-    -0.13681,
-    -0.145849,
-    -0.154872,
-    -0.163879,
-    -0.172868,
-    -0.181838,
-    -0.190789,
-    -0.199719,
-    -0.208628,
-    -0.217514,
-    -0.226377,
-    -0.235215,
-    -0.244029,
-    -0.252816,
-    -0.261576,
-    -0.270308,
-    -0.279012,
-    -0.287685,
-    -0.296328,
-    -0.304939,
-    -0.313517,
-    -0.322063,
-    -0.330573,
-    -0.339049,
-    -0.347489,
-    -0.355892,
-    -0.364257,
-    -0.372584,
-    -0.380871,
-    -0.389118,
-    -0.397324,
-    -0.405488,
-    -0.413609,
-    -0.421687,
-    -0.42972,
-    -0.437709,
-    -0.445652,
-    -0.453548,
-    -0.461397,
-    -0.469197,
-    -0.476949,
-    -0.484652,
-    -0.492303,
-    -0.499904,
-    -0.507454,
-    -0.51495,
-    -0.522394,
-    -0.529784,
-    -0.53712,
-    -0.5444,
-    -0.551625,
-    -0.558793,
-    -0.565904,
-    -0.572958,
-    -0.579953,
-    -0.58689,
-    -0.593767,
-    -0.600584,
-    -0.607341,
-    -0.614037,
-    -0.62067,
-    -0.627242,
-    -0.633751,
-    -0.640197,
-    -0.646579,
-    -0.652897,
-    -0.659151,
-    -0.665339,
-    -0.671462,
-    -0.677519,
-    -0.683509,
-    -0.689432,
-    -0.695289,
-    -0.701077,
-    -0.706798,
-    -0.71245,
-    -0.718033,
-    -0.723548,
-    -0.728993,
-    -0.734368,
-    -0.739673,
-    -0.744908,
-    -0.750072,
-    -0.755166,
-    -0.760188,
-    -0.765139,
-    -0.770018,
-    -0.774826,
-    -0.779561,
-    -0.784224,
-    -0.788815,
-    -0.793333,
-    -0.797778,
-    -0.802151,
-    -0.80645,
-    -0.810677,
-    -0.81483,
-    -0.818909,
-    -0.822915,
-    -0.826848,
-    -0.830707,
-    -0.834493,
-    -0.838205,
-    -0.841843,
-    -0.845408,
-    -0.848899,
-    -0.852316,
-    -0.855659,
-    -0.85893,
-    -0.862126,
-    -0.865249,
-    -0.868299,
-    -0.871275,
-    -0.874178,
-    -0.877008,
-    -0.879765,
-    -0.88245,
-    -0.885061,
-    -0.8876,
-    -0.890067,
-    -0.892461,
-    -0.894784,
-    -0.897035,
-    -0.899214,
-    -0.901322,
-    -0.903359,
-    -0.905325,
-    -0.90722,
-    -0.909045,
-    -0.910801,
-    -0.912486,
-    -0.914102,
-    -0.915649,
-    -0.917127,
-    -0.918537,
-    -0.919879,
-    -0.921153,
-    -0.922359,
-    -0.923499,
-    -0.924572,
-    -0.925579,
-    -0.92652,
-    -0.927396,
-    -0.928207,
-    -0.928953,
-    -0.929635,
-    -0.930254,
-    -0.93081,
-    -0.931303,
-    -0.931733,
-    -0.932102,
-    -0.93241,
-    -0.932657,
-    -0.932845,
-    -0.932972,
-    -0.93304,
-    -0.93305,
-    -0.933002,
-    -0.932896,
-    -0.932733,
-    -0.932514,
-    -0.93224,
-    -0.93191,
-    -0.931525,
-    -0.931087,
-    -0.930595,
-    -0.93005,
-    -0.929454,
-    -0.928805,
-    -0.928106,
-    -0.927357,
-    -0.926558,
-    -0.92571,
-    -0.924813,
-    -0.923869,
-    -0.922878,
-    -0.921841,
-    -0.920758,
-    -0.91963,
-    -0.918458,
-    -0.917242,
-    -0.915983,
-    -0.914682,
-    -0.91334,
-    -0.911956,
-    -0.910533,
-    -0.90907,
-    -0.907568,
-    -0.906029,
-    -0.904452,
-    -0.902838,
-    -0.901189,
-    -0.899505,
-    -0.897786,
-    -0.896034,
-    -0.894248,
-    -0.892431,
-    -0.890582,
-    -0.888702,
-    -0.886792,
-    -0.884854,
-    -0.882886,
-    -0.880891,
-    -0.878869,
-    -0.876821,
-    -0.874747,
-    -0.872648,
-    -0.870525,
-    -0.868379,
-    -0.86621,
-    -0.86402,
-    -0.861808,
-    -0.859577,
-    -0.857325,
-    -0.855055,
-    -0.852766,
-    -0.85046,
-    -0.848138,
-    -0.845799,
-    -0.843446,
-    -0.841078,
-    -0.838696,
-    -0.836301,
-    -0.833894,
-    -0.831475,
-    -0.829045,
-    -0.826605,
-    -0.824156,
-    -0.821698,
-    -0.819232,
-    -0.816758,
-    -0.814278,
-    -0.811792,
-    -0.809301,
-    -0.806805,
-    -0.804305,
-    -0.801802,
-    -0.799297,
-    -0.796789,
-    -0.79428,
-    -0.791771,
-    -0.789262,
-    -0.786753,
-    -0.784246,
-    -0.781741,
-    -0.779239,
-    -0.77674,
-    -0.774244,
-    -0.771753,
-    -0.769268,
-    -0.766788,
-    -0.764314,
-    -0.761847,
-    -0.759388,
-    -0.756936,
-    -0.754494,
-    -0.75206,
-    -0.749637,
-    -0.747223,
-    -0.74482,
-    -0.742429,
-    -0.74005,
-    -0.737683,
-    -0.735329,
-    -0.732989,
-    -0.730662,
-    -0.72835,
-    -0.726053,
-    -0.723771,
-    -0.721505,
-    -0.719256,
-    -0.717023,
-    -0.714807,
-    -0.71261,
-    -0.71043,
-    -0.708269,
-    -0.706127,
-    -0.704004,
-    -0.701901,
-    -0.699818,
-    -0.697755,
-    -0.695714,
-    -0.693694,
-    -0.691695,
-    -0.689718,
-    -0.687764,
-    -0.685832,
-    -0.683924,
-    -0.682038,
-    -0.680176,
-    -0.678338,
-    -0.676524,
-    -0.674735,
-    -0.67297,
-    -0.671231,
-    -0.669516,
-    -0.667827,
-    -0.666164,
-    -0.664526,
-    -0.662915,
-    -0.66133,
-    -0.659772,
-    -0.65824,
-    -0.656735,
-    -0.655257,
-    -0.653807,
-    -0.652384,
-    -0.650988,
-    -0.64962,
-    -0.64828,
-    -0.646968,
-    -0.645684,
-    -0.644428,
-    -0.643201,
-    -0.642001,
-    -0.64083,
-    -0.639688,
-    -0.638574,
-    -0.637488,
-    -0.636431,
-    -0.635403,
-    -0.634403,
-    -0.633432,
-    -0.63249,
-    -0.631576,
-    -0.630691,
-    -0.629835,
-    -0.629007,
-    -0.628208,
-    -0.627437,
-    -0.626695,
-    -0.625981,
-    -0.625296,
-    -0.624639,
-    -0.62401,
-    -0.623409,
-    -0.622836,
-    -0.622291,
-    -0.621774,
-    -0.621284,
-    -0.620822,
-    -0.620388,
-    -0.61998,
-    -0.6196,
-    -0.619247,
-    -0.61892,
-    -0.61862,
-    -0.618346,
-    -0.618099,
-    -0.617878,
-    -0.617682,
-    -0.617512,
-    -0.617368,
-    -0.617249,
-    -0.617154,
-    -0.617085,
-    -0.61704,
-    -0.617019,
-    -0.617022,
-    -0.617049,
-    -0.6171,
-    -0.617173,
-    -0.61727,
-    -0.61739,
-    -0.617531,
-    -0.617695,
-    -0.617881,
-    -0.618088,
-    -0.618317,
-    -0.618566,
-    -0.618836,
-    -0.619126,
-    -0.619436,
-    -0.619766,
-    -0.620115,
-    -0.620483,
-    -0.62087,
-    -0.621275,
-    -0.621698,
-    -0.622139,
-    -0.622597,
-    -0.623072,
-    -0.623563,
-    -0.62407,
-    -0.624594,
-    -0.625132,
-    -0.625686,
-    -0.626255,
-    -0.626837,
-    -0.627434,
-    -0.628045,
-    -0.628668,
-    -0.629304,
-    -0.629953,
-    -0.630614,
-    -0.631286,
-    -0.63197,
-    -0.632664,
-    -0.633369,
-    -0.634084,
-    -0.634809,
-    -0.635543,
-    -0.636285,
-    -0.637036,
-    -0.637796,
-    -0.638563,
-    -0.639337,
-    -0.640118,
-    -0.640905,
-    -0.641699,
-    -0.642498,
-    -0.643302,
-    -0.644111,
-    -0.644925,
-    -0.645743,
-    -0.646564,
-    -0.647389,
-    -0.648216,
-    -0.649046,
-    -0.649878,
-    -0.650711,
-    -0.651546,
-    -0.652382,
-    -0.653218,
-    -0.654054,
-    -0.65489,
-    -0.655725,
-    -0.656559,
-    -0.657392,
-    -0.658223,
-    -0.659051,
-    -0.659877,
-    -0.6607,
-    -0.66152,
-    -0.662336,
-    -0.663148,
-    -0.663955,
-    -0.664758,
-    -0.665555,
-    -0.666347,
-    -0.667133,
-    -0.667913,
-    -0.668686,
-    -0.669453,
-    -0.670212,
-    -0.670963,
-    -0.671707,
-    -0.672442,
-    -0.673169,
-    -0.673887,
-    -0.674596,
-    -0.675295,
-    -0.675985,
-    -0.676664,
-    -0.677333,
-    -0.677992,
-    -0.678639,
-    -0.679275,
-    -0.6799,
-    -0.680512,
-    -0.681113,
-    -0.681701,
-    -0.682276,
-    -0.682839,
-    -0.683389,
-    -0.683925,
-    -0.684447,
-    -0.684956,
-    -0.685451,
-    -0.685931,
-    -0.686396,
-    -0.686847,
-    -0.687283,
-    -0.687704,
-    -0.68811,
-    -0.688499,
-    -0.688873,
-    -0.689232,
-    -0.689573,
-    -0.689899,
-    -0.690208,
-    -0.690501,
-    -0.690777,
-    -0.691036,
-    -0.691278,
-    -0.691502,
-    -0.691709,
-    -0.691899,
-    -0.692071,
-    -0.692226,
-    -0.692362,
-    -0.692481,
-    -0.692582,
-    -0.692664,
-    -0.692729,
-    -0.692775,
-    -0.692802,
-    -0.692811,
-    -0.692802,
-    -0.692774,
-    -0.692728,
-    -0.692663,
-    -0.692579,
-    -0.692477,
-    -0.692355,
-    -0.692215,
-    -0.692056,
-    -0.691879,
-    -0.691682,
-    -0.691467,
-    -0.691233,
-    -0.69098,
-    -0.690708,
-    -0.690418,
-    -0.690109,
-    -0.689781,
-    -0.689434,
-    -0.689069,
-    -0.688686,
-    -0.688283,
-    -0.687863,
-    -0.687424,
-    -0.686966,
-    -0.686491,
-    -0.685997,
-    -0.685485,
-    -0.684955,
-    -0.684408,
-    -0.683842,
-    -0.683259,
-    -0.682659,
-    -0.682041,
-    -0.681405,
-    -0.680753,
-    -0.680083,
-    -0.679397,
-    -0.678693,
-    -0.677973,
-    -0.677237,
-    -0.676484,
-    -0.675715,
-    -0.674931,
-    -0.67413,
-    -0.673313,
-    -0.672482,
-    -0.671635,
-    -0.670772,
-    -0.669895,
-    -0.669003,
-    -0.668097,
-    -0.667176,
-    -0.666241,
-    -0.665293,
-    -0.66433,
-    -0.663354,
-    -0.662365,
-    -0.661362,
-    -0.660347,
-    -0.659319,
-    -0.658279,
-    -0.657227,
-    -0.656163,
-    -0.655087,
-    -0.654,
-    -0.652901,
-    -0.651792,
-    -0.650672,
-    -0.649541,
-    -0.6484,
-    -0.64725,
-    -0.64609,
-    -0.64492,
-    -0.643741,
-    -0.642553,
-    -0.641357,
-    -0.640153,
-    -0.63894,
-    -0.63772,
-    -0.636492,
-    -0.635256,
-    -0.634014,
-    -0.632766,
-    -0.63151,
-    -0.630249,
-    -0.628982,
-    -0.627709,
-    -0.626431,
-    -0.625148,
-    -0.62386,
-    -0.622568,
-    -0.621272,
-    -0.619972,
-    -0.618668,
-    -0.617361,
-    -0.616051,
-    -0.614738,
-    -0.613423,
-    -0.612106,
-    -0.610787,
-    -0.609466,
-    -0.608144,
-    -0.606821,
-    -0.605497,
-    -0.604173,
-    -0.602849,
-    -0.601525,
-    -0.600201,
-    -0.598878,
-    -0.597556,
-    -0.596235,
-    -0.594916,
-    -0.593599,
-    -0.592283,
-    -0.59097,
-    -0.58966,
-    -0.588353,
-    -0.587048,
-    -0.585747,
-    -0.58445,
-    -0.583157,
-    -0.581868,
-    -0.580583,
-    -0.579304,
-    -0.578029,
-    -0.576759,
-    -0.575495,
-    -0.574237,
-    -0.572984,
-    -0.571738,
-    -0.570499,
-    -0.569265,
-    -0.568039,
-    -0.566821,
-    -0.565609,
-    -0.564405,
-    -0.563209,
-    -0.562021,
-    -0.560841,
-    -0.55967,
-    -0.558508,
-    -0.557354,
-    -0.556209,
-    -0.555074,
-    -0.553949,
-    -0.552833,
-    -0.551726,
-    -0.55063,
-    -0.549545,
-    -0.548469,
-    -0.547405,
-    -0.546351,
-    -0.545308,
-    -0.544276,
-    -0.543256,
-    -0.542246,
-    -0.541249,
-    -0.540263,
-    -0.539289,
-    -0.538328,
-    -0.537378,
-    -0.53644,
-    -0.535516,
-    -0.534603,
-    -0.533703,
-    -0.532816,
-    -0.531942,
-    -0.531081,
-    -0.530233,
-    -0.529399,
-    -0.528577,
-    -0.527769,
-    -0.526975,
-    -0.526194,
-    -0.525426,
-    -0.524673,
-    -0.523933,
-    -0.523207,
-    -0.522495,
-    -0.521797,
-    -0.521112,
-    -0.520442,
-    -0.519786,
-    -0.519144,
-    -0.518517,
-    -0.517903,
-    -0.517304,
-    -0.516719,
-    -0.516148,
-    -0.515592,
-    -0.51505,
-    -0.514522,
-    -0.514008,
-    -0.513509,
-    -0.513023,
-    -0.512553,
-    -0.512096,
-    -0.511654,
-    -0.511225,
-    -0.510811,
-    -0.510411,
-    -0.510025,
-    -0.509653,
-    -0.509295,
-    -0.508951,
-    -0.508621,
-    -0.508305,
-    -0.508002,
-    -0.507713,
-    -0.507438,
-    -0.507176,
-    -0.506928,
-    -0.506693,
-    -0.506471,
-    -0.506262,
-    -0.506067,
-    -0.505884,
-    -0.505714,
-    -0.505558,
-    -0.505413,
-    -0.505281,
-    -0.505162,
-    -0.505055,
-    -0.50496,
-    -0.504877,
-    -0.504806,
-    -0.504747,
-    -0.5047,
-    -0.504664,
-    -0.504639,
-    -0.504625,
-    -0.504623,
-    -0.504631,
-    -0.50465,
-    -0.50468,
-    -0.50472,
-    -0.50477,
-    -0.504831,
-    -0.504901,
-    -0.504981,
-    -0.505071,
-    -0.50517,
-    -0.505278,
-    -0.505395,
-    -0.505521,
-    -0.505655,
-    -0.505798,
-    -0.50595,
-    -0.506109,
-    -0.506276,
-    -0.506451,
-    -0.506633,
-    -0.506823,
-    -0.507019,
-    -0.507223,
-    -0.507433,
-    -0.507649,
-    -0.507872,
-    -0.5081,
-    -0.508335,
-    -0.508575,
-    -0.50882,
-    -0.50907,
-    -0.509326,
-    -0.509586,
-    -0.50985,
-    -0.510119,
-    -0.510392,
-    -0.510668,
-    -0.510949,
-    -0.511232,
-    -0.511519,
-    -0.511809,
-    -0.512101,
-    -0.512396,
-    -0.512693,
-    -0.512992,
-    -0.513292,
-    -0.513595,
-    -0.513898,
-    -0.514203,
-    -0.514509,
-    -0.514815,
-    -0.515122,
-    -0.515429,
-    -0.515736,
-    -0.516042,
-    -0.516348,
-    -0.516654,
-    -0.516958,
-    -0.517262,
-    -0.517564,
-    -0.517864,
-    -0.518163,
-    -0.51846,
-    -0.518754,
-    -0.519046,
-    -0.519335,
-    -0.519622,
-    -0.519905,
-    -0.520185,
-    -0.520461,
-    -0.520734,
-    -0.521003,
-    -0.521268,
-    -0.521528,
-    -0.521784,
-    -0.522035,
-    -0.522282,
-    -0.522523,
-    -0.522758,
-    -0.522989,
-    -0.523213,
-    -0.523432,
-    -0.523645,
-    -0.523851,
-    -0.524051,
-    -0.524244,
-    -0.524431,
-    -0.52461,
-    -0.524783,
-    -0.524948,
-    -0.525106,
-    -0.525256,
-    -0.525398,
-    -0.525532,
-    -0.525659,
-    -0.525777,
-    -0.525886,
-    -0.525987,
-    -0.52608,
-    -0.526163,
-    -0.526238,
-    -0.526304,
-    -0.52636,
-    -0.526407,
-    -0.526444,
-    -0.526472,
-    -0.52649,
-    -0.526498,
-    -0.526497,
-    -0.526485,
-    -0.526463,
-    -0.526431,
-    -0.526388,
-    -0.526335,
-    -0.526272,
-    -0.526198,
-    -0.526113,
-    -0.526017,
-    -0.525911,
-    -0.525793,
-    -0.525664,
-    -0.525525,
-    -0.525374,
-    -0.525212,
-    -0.525038,
-    -0.524854,
-    -0.524658,
-    -0.52445,
-    -0.524231,
-    -0.524001,
-    -0.523759,
-    -0.523505,
-    -0.52324,
-    -0.522963,
-    -0.522675,
-    -0.522374,
-    -0.522063,
-    -0.521739,
-    -0.521404,
-    -0.521057,
-    -0.520698,
-    -0.520328,
-    -0.519946,
-    -0.519552,
-    -0.519147,
-    -0.51873,
-    -0.518301,
-    -0.517861,
-    -0.517409,
-    -0.516946,
-    -0.516471,
-    -0.515985,
-    -0.515487,
-    -0.514978,
-    -0.514457,
-    -0.513926,
-    -0.513383,
-    -0.512829,
-    -0.512264,
-    -0.511688,
-    -0.511101,
-    -0.510503,
-    -0.509894,
-    -0.509274,
-    -0.508644,
-    -0.508004,
-    -0.507352,
-    -0.506691,
-    -0.506019,
-    -0.505337,
-    -0.504645,
-    -0.503943,
-    -0.503231,
-    -0.50251,
-    -0.501778,
-    -0.501038,
-    -0.500287,
-    -0.499528,
-    -0.498759,
-    -0.497981,
-    -0.497195,
-    -0.496399,
-    -0.495595,
-    -0.494783,
-    -0.493962,
-    -0.493133,
-    -0.492295,
-    -0.49145,
-    -0.490597,
-    -0.489736,
-    -0.488868,
-    -0.487993,
-    -0.48711,
-    -0.48622,
-    -0.485324,
-    -0.48442,
-    -0.48351,
-    -0.482594,
-    -0.481672,
-    -0.480743,
-    -0.479809,
-    -0.478869,
-    -0.477923,
-    -0.476972,
-    -0.476016,
-    -0.475054,
-    -0.474088,
-    -0.473117,
-    -0.472142,
-    -0.471163,
-    -0.470179,
-    -0.469192,
-    -0.4682,
-    -0.467205,
-    -0.466207,
-    -0.465206,
-    -0.464201,
-    -0.463194,
-    -0.462184,
-    -0.461172,
-    -0.460157,
-    -0.459141,
-    -0.458122,
-    -0.457102,
-    -0.45608,
-    -0.455057,
-    -0.454033,
-    -0.453008,
-    -0.451983,
-    -0.450956,
-    -0.44993,
-    -0.448903,
-    -0.447876,
-    -0.44685,
-    -0.445824,
-    -0.444798,
-    -0.443773,
-    -0.44275,
-    -0.441727,
-    -0.440706,
-    -0.439686,
-    -0.438668,
-    -0.437652,
-    -0.436638,
-    -0.435626,
-    -0.434617,
-    -0.43361,
-    -0.432607,
-    -0.431606,
-    -0.430608,
-    -0.429614,
-    -0.428623,
-    -0.427636,
-    -0.426652,
-    -0.425673,
-    -0.424698,
-    -0.423727,
-    -0.422761,
-    -0.4218,
-    -0.420843,
-    -0.419891,
-    -0.418945,
-    -0.418004,
-    -0.417068,
-    -0.416138,
-    -0.415214,
-    -0.414295,
-    -0.413383,
-    -0.412477,
-    -0.411578,
-    -0.410684,
-    -0.409798,
-    -0.408918,
-    -0.408045,
-    -0.40718,
-    -0.406321,
-    -0.40547,
-    -0.404626,
-    -0.403789,
-    -0.402961,
-    -0.40214,
-    -0.401327,
-    -0.400522,
-    -0.399725,
-    -0.398936,
-    -0.398156,
-    -0.397384,
-    -0.396621,
-    -0.395866,
-    -0.39512,
-    -0.394383,
-    -0.393654,
-    -0.392935,
-    -0.392224,
-    -0.391523,
-    -0.390831,
-    -0.390148,
-    -0.389475,
-    -0.388811,
-    -0.388156,
-    -0.387511,
-    -0.386875,
-    -0.38625,
-    -0.385633,
-    -0.385027,
-    -0.38443,
-    -0.383843,
-    -0.383266,
-    -0.382699,
-    -0.382142,
-    -0.381595,
-    -0.381058,
-    -0.380531,
-    -0.380014,
-    -0.379506,
-    -0.379009,
-    -0.378522,
-    -0.378045,
-    -0.377579,
-    -0.377122,
-    -0.376675,
-    -0.376239,
-    -0.375812,
-    -0.375396,
-    -0.374989,
-    -0.374593,
-    -0.374206,
-    -0.37383,
-    -0.373463,
-    -0.373107,
-    -0.37276,
-    -0.372423,
-    -0.372096,
-    -0.371779,
-    -0.371472,
-    -0.371174,
-    -0.370886,
-    -0.370607,
-    -0.370338,
-    -0.370078,
-    -0.369828,
-    -0.369587,
-    -0.369356,
-    -0.369133,
-    -0.36892,
-    -0.368716,
-    -0.36852,
-    -0.368334,
-    -0.368157,
-    -0.367988,
-    -0.367828,
-    -0.367676,
-    -0.367533,
-    -0.367398,
-    -0.367271,
-    -0.367153,
-    -0.367042,
-    -0.36694,
-    -0.366845,
-    -0.366758,
-    -0.366679,
-    -0.366607,
-    -0.366543,
-    -0.366486,
-    -0.366435,
-    -0.366392,
-    -0.366356,
-    -0.366327,
-    -0.366304,
-    -0.366288,
-    -0.366278,
-    -0.366275,
-    -0.366277,
-    -0.366285,
-    -0.3663,
-    -0.36632,
-    -0.366345,
-    -0.366376,
-    -0.366412,
-    -0.366453,
-    -0.366499,
-    -0.36655,
-    -0.366606,
-    -0.366666,
-    -0.366731,
-    -0.366799,
-    -0.366872,
-    -0.366948,
-    -0.367029,
-    -0.367112,
-    -0.3672,
-    -0.36729,
-    -0.367384,
-    -0.36748,
-    -0.367579,
-    -0.367681,
-    -0.367785,
-    -0.367892,
-    -0.368,
-    -0.368111,
-    -0.368223,
-    -0.368337,
-    -0.368452,
-    -0.368569,
-    -0.368686,
-    -0.368805,
-    -0.368924,
-    -0.369044,
-    -0.369164,
-    -0.369285,
-    -0.369406,
-    -0.369526,
-    -0.369647,
-    -0.369767,
-    -0.369886,
-    -0.370005,
-    -0.370122,
-    -0.370239,
-    -0.370354,
-    -0.370469,
-    -0.370581,
-    -0.370692,
-    -0.370801,
-    -0.370908,
-    -0.371012,
-    -0.371114,
-    -0.371214,
-    -0.371311,
-    -0.371406,
-    -0.371497,
-    -0.371585,
-    -0.37167,
-    -0.371751,
-    -0.371829,
-    -0.371903,
-    -0.371973,
-    -0.372039,
-    -0.372101,
-    -0.372159,
-    -0.372212,
-    -0.37226,
-    -0.372304,
-    -0.372343,
-    -0.372377,
-    -0.372406,
-    -0.372429,
-    -0.372447,
-    -0.372459,
-    -0.372466,
-    -0.372467,
-    -0.372462,
-    -0.372451,
-    -0.372434,
-    -0.372411,
-    -0.372381,
-    -0.372344,
-    -0.372302,
-    -0.372252,
-    -0.372195,
-    -0.372132,
-    -0.372062,
-    -0.371984,
-    -0.371899,
-    -0.371807,
-    -0.371707,
-    -0.3716,
-    -0.371486,
-    -0.371363,
-    -0.371233,
-    -0.371095,
-    -0.37095,
-    -0.370796,
-    -0.370634,
-    -0.370464,
-    -0.370286,
-    -0.370099,
-    -0.369904,
-    -0.369701,
-    -0.369489,
-    -0.369269,
-    -0.36904,
-    -0.368803,
-    -0.368557,
-    -0.368303,
-    -0.368039,
-    -0.367767,
-    -0.367486,
-    -0.367196,
-    -0.366898,
-    -0.36659,
-    -0.366274,
-    -0.365948,
-    -0.365614,
-    -0.365271,
-    -0.364918,
-    -0.364557,
-    -0.364187,
-    -0.363807,
-    -0.363419,
-    -0.363022,
-    -0.362616,
-    -0.3622,
-    -0.361776,
-    -0.361343,
-    -0.360901,
-    -0.36045,
-    -0.359989,
-    -0.359521,
-    -0.359043,
-    -0.358556,
-    -0.358061,
-    -0.357556,
-    -0.357043,
-    -0.356522,
-    -0.355991,
-    -0.355452,
-    -0.354905,
-    -0.354349,
-    -0.353784,
-    -0.353211,
-    -0.35263,
-    -0.352041,
-    -0.351443,
-    -0.350837,
-    -0.350223,
-    -0.349601,
-    -0.348971,
-    -0.348333,
-    -0.347687,
-    -0.347034,
-    -0.346373,
-    -0.345704,
-    -0.345028,
-    -0.344344,
-    -0.343654,
-    -0.342956,
-    -0.34225,
-    -0.341538,
-    -0.340819,
-    -0.340094,
-    -0.339361,
-    -0.338622,
-    -0.337876,
-    -0.337124,
-    -0.336366,
-    -0.335602,
-    -0.334831,
-    -0.334055,
-    -0.333273,
-    -0.332485,
-    -0.331691,
-    -0.330892,
-    -0.330088,
-    -0.329278,
-    -0.328464,
-    -0.327644,
-    -0.32682,
-    -0.325991,
-    -0.325158,
-    -0.32432,
-    -0.323477,
-    -0.322631,
-    -0.321781,
-    -0.320926,
-    -0.320068,
-    -0.319207,
-    -0.318342,
-    -0.317473,
-    -0.316602,
-    -0.315727,
-    -0.31485,
-    -0.31397,
-    -0.313087,
-    -0.312202,
-    -0.311315,
-    -0.310425,
-    -0.309534,
-    -0.30864,
-    -0.307745,
-    -0.306849,
-    -0.305951,
-    -0.305052,
-    -0.304152,
-    -0.30325,
-    -0.302348,
-    -0.301446,
-    -0.300543,
-    -0.299639,
-    -0.298736,
-    -0.297832,
-    -0.296929,
-    -0.296025,
-    -0.295123,
-    -0.294221,
-    -0.293319,
-    -0.292418,
-    -0.291519,
-    -0.290621,
-    -0.289724,
-    -0.288828,
-    -0.287934,
-    -0.287042,
-    -0.286152,
-    -0.285264,
-    -0.284378,
-    -0.283494,
-    -0.282613,
-    -0.281734,
-    -0.280859,
-    -0.279986,
-    -0.279116,
-    -0.27825,
-    -0.277386,
-    -0.276527,
-    -0.27567,
-    -0.274818,
-    -0.27397,
-    -0.273125,
-    -0.272285,
-    -0.271448,
-    -0.270617,
-    -0.269789,
-    -0.268967,
-    -0.268149,
-    -0.267336,
-    -0.266528,
-    -0.265725,
-    -0.264927,
-    -0.264135,
-    -0.263348,
-    -0.262567,
-    -0.261791,
-    -0.261021,
-    -0.260257,
-    -0.259499,
-    -0.258747,
-    -0.258001,
-    -0.257262,
-    -0.256529,
-    -0.255802,
-    -0.255082,
-    -0.254369,
-    -0.253662,
-    -0.252962,
-    -0.252269,
-    -0.251583,
-    -0.250904,
-    -0.250232,
-    -0.249568,
-    -0.248911,
-    -0.248261,
-    -0.247618,
-    -0.246983,
-    -0.246355,
-    -0.245736,
-    -0.245123,
-    -0.244519,
-    -0.243922,
-    -0.243333,
-    -0.242752,
-    -0.242179,
-    -0.241613,
-    -0.241056,
-    -0.240507,
-    -0.239966,
-    -0.239433,
-    -0.238908,
-    -0.238391,
-    -0.237882,
-    -0.237382,
-    -0.236889,
-    -0.236405,
-    -0.23593,
-    -0.235462,
-    -0.235003,
-    -0.234552,
-    -0.234109,
-    -0.233675,
-    -0.233248,
-    -0.232831,
-    -0.232421,
-    -0.23202,
-    -0.231626,
-    -0.231242,
-    -0.230865,
-    -0.230497,
-    -0.230136,
-    -0.229784,
-    -0.22944,
-    -0.229104,
-    -0.228776,
-    -0.228457,
-    -0.228145,
-    -0.227841,
-    -0.227545,
-    -0.227257,
-    -0.226977,
-    -0.226704,
-    -0.22644,
-    -0.226183,
-    -0.225933,
-    -0.225691,
-    -0.225457,
-    -0.22523,
-    -0.225011,
-    -0.224799,
-    -0.224594,
-    -0.224396,
-    -0.224205,
-    -0.224021,
-    -0.223845,
-    -0.223675,
-    -0.223512,
-    -0.223355,
-    -0.223206,
-    -0.223062,
-    -0.222926,
-    -0.222795,
-    -0.222671,
-    -0.222553,
-    -0.222441,
-    -0.222335,
-    -0.222235,
-    -0.22214,
-    -0.222052,
-    -0.221969,
-    -0.221891,
-    -0.221818,
-    -0.221751,
-    -0.221689,
-    -0.221632,
-    -0.22158,
-    -0.221532,
-    -0.221489,
-    -0.221451,
-    -0.221417,
-    -0.221388,
-    -0.221362,
-    -0.221341,
-    -0.221323,
-    -0.22131,
-    -0.2213,
-    -0.221293,
-    -0.22129,
-    -0.22129,
-    -0.221293,
-    -0.2213,
-    -0.221309,
-    -0.221321,
-    -0.221335,
-    -0.221352,
-    -0.221371,
-    -0.221393,
-    -0.221416,
-    -0.221442,
-    -0.221469,
-    -0.221498,
-    -0.221528,
-    -0.22156,
-    -0.221593,
-    -0.221627,
-    -0.221662,
-    -0.221698,
-    -0.221734,
-    -0.221771,
-    -0.221808,
-    -0.221846,
-    -0.221884,
-    -0.221921,
-    -0.221959,
-    -0.221996,
-    -0.222032,
-    -0.222068,
-    -0.222103,
-    -0.222138,
-    -0.222171,
-    -0.222203,
-    -0.222234,
-    -0.222264,
-    -0.222291,
-    -0.222318,
-    -0.222342,
-    -0.222364,
-    -0.222384,
-    -0.222402,
-    -0.222418,
-    -0.222431,
-    -0.222441,
-    -0.222448,
-    -0.222453,
-    -0.222455,
-    -0.222453,
-    -0.222448,
-    -0.22244,
-    -0.222428,
-    -0.222412,
-    -0.222393,
-    -0.22237,
-    -0.222342,
-    -0.222311,
-    -0.222275,
-    -0.222235,
-    -0.22219,
-    -0.222141,
-    -0.222087,
-    -0.222028,
-    -0.221965,
-    -0.221896,
-    -0.221822,
-    -0.221743,
-    -0.221658,
-    -0.221568,
-    -0.221473,
-    -0.221371,
-    -0.221264,
-    -0.221152,
-    -0.221033,
-    -0.220908,
-    -0.220777,
-    -0.22064,
-    -0.220497,
-    -0.220347,
-    -0.220191,
-    -0.220028,
-    -0.219859,
-    -0.219683,
-    -0.219501,
-    -0.219311,
-    -0.219115,
-    -0.218912,
-    -0.218702,
-    -0.218485,
-    -0.21826,
-    -0.218029,
-    -0.21779,
-    -0.217544,
-    -0.217291,
-    -0.21703,
-    -0.216762,
-    -0.216486,
-    -0.216203,
-    -0.215913,
-    -0.215615,
-    -0.215309,
-    -0.214996,
-    -0.214675,
-    -0.214346,
-    -0.21401,
-    -0.213666,
-    -0.213314,
-    -0.212954,
-    -0.212587,
-    -0.212212,
-    -0.211829,
-    -0.211438,
-    -0.21104,
-    -0.210634,
-    -0.21022,
-    -0.209798,
-    -0.209368,
-    -0.208931,
-    -0.208486,
-    -0.208033,
-    -0.207572,
-    -0.207104,
-    -0.206627,
-    -0.206144,
-    -0.205652,
-    -0.205153,
-    -0.204647,
-    -0.204132,
-    -0.203611,
-    -0.203081,
-    -0.202545,
-    -0.202001,
-    -0.201449,
-    -0.20089,
-    -0.200324,
-    -0.199751,
-    -0.199171,
-    -0.198583,
-    -0.197988,
-    -0.197387,
-    -0.196778,
-    -0.196163,
-    -0.195541,
-    -0.194912,
-    -0.194276,
-    -0.193634,
-    -0.192985,
-    -0.19233,
-    -0.191668,
-    -0.191,
-    -0.190326,
-    -0.189646,
-    -0.188959,
-    -0.188267,
-    -0.187569,
-    -0.186865,
-    -0.186155,
-    -0.18544,
-    -0.184719,
-    -0.183993,
-    -0.183262,
-    -0.182525,
-    -0.181784,
-    -0.181037,
-    -0.180285,
-    -0.179529,
-    -0.178768,
-    -0.178002,
-    -0.177232,
-    -0.176458,
-    -0.175679,
-    -0.174896,
-    -0.174109,
-    -0.173319,
-    -0.172524,
-    -0.171726,
-    -0.170924,
-    -0.170119,
-    -0.169311,
-    -0.1685,
-    -0.167685,
-    -0.166868,
-    -0.166047,
-    -0.165225,
-    -0.164399,
-    -0.163571,
-    -0.162741,
-    -0.161909,
-    -0.161075,
-    -0.160239,
-    -0.159401,
-    -0.158561,
-    -0.15772,
-    -0.156878,
-    -0.156034,
-    -0.15519,
-    -0.154344,
-    -0.153498,
-    -0.15265,
-    -0.151803,
-    -0.150955,
-    -0.150106,
-    -0.149258,
-    -0.148409,
-    -0.147561,
-    -0.146712,
-    -0.145865,
-    -0.145017,
-    -0.144171,
-    -0.143325,
-    -0.14248,
-    -0.141636,
-    -0.140793,
-    -0.139952,
-    -0.139112,
-    -0.138274,
-    -0.137437,
-    -0.136602,
-    -0.135769,
-    -0.134938,
-    -0.13411,
-    -0.133284,
-    -0.13246,
-    -0.131639,
-    -0.130821,
-    -0.130005,
-    -0.129192,
-    -0.128383,
-    -0.127577,
-    -0.126774,
-    -0.125974,
-    -0.125179,
-    -0.124386,
-    -0.123598,
-    -0.122813,
-    -0.122033,
-    -0.121257,
-    -0.120485,
-    -0.119717,
-    -0.118954,
-    -0.118195,
-    -0.117441,
-    -0.116692,
-    -0.115948,
-    -0.115209,
-    -0.114474,
-    -0.113745,
-    -0.113022,
-    -0.112303,
-    -0.11159,
-    -0.110883,
-    -0.110181,
-    -0.109485,
-    -0.108795,
-    -0.108111,
-    -0.107432,
-    -0.10676,
-    -0.106094,
-    -0.105434,
-    -0.10478,
-    -0.104133,
-    -0.103492,
-    -0.102858,
-    -0.10223,
-    -0.101609,
-    -0.100994,
-    -0.100386,
-    -0.0997851,
-    -0.0991909,
-    -0.0986037,
-    -0.0980233,
-    -0.09745,
-    -0.0968838,
-    -0.0963246,
-    -0.0957725,
-    -0.0952277,
-    -0.09469,
-    -0.0941596,
-    -0.0936365,
-    -0.0931206,
-    -0.0926122,
-    -0.092111,
-    -0.0916173,
-    -0.091131,
-    -0.0906521,
-    -0.0901807,
-    -0.0897167,
-    -0.0892602,
-    -0.0888111,
-    -0.0883696,
-    -0.0879356,
-    -0.0875091,
-    -0.08709,
-    -0.0866785,
-    -0.0862744,
-    -0.0858779,
-    -0.0854888,
-    -0.0851072,
-    -0.0847331,
-    -0.0843664,
-    -0.0840071,
-    -0.0836553,
-    -0.0833108,
-    -0.0829736,
-    -0.0826438,
-    -0.0823213,
-    -0.0820061,
-    -0.0816981,
-    -0.0813973,
-    -0.0811037,
-    -0.0808172,
-    -0.0805378,
-    -0.0802654,
-    -0.08,
-    -0.0797415,
-    -0.0794899,
-    -0.0792452,
-    -0.0790072,
-    -0.078776,
-    -0.0785514,
-    -0.0783334,
-    -0.078122,
-    -0.077917,
-    -0.0777185,
-    -0.0775263,
-    -0.0773403,
-    -0.0771606,
-    -0.0769869,
-    -0.0768193,
-    -0.0766577,
-    -0.0765019,
-    -0.0763519,
-    -0.0762077,
-    -0.076069,
-    -0.075936,
-    -0.0758083,
-    -0.075686,
-    -0.075569,
-    -0.0754572,
-    -0.0753504,
-    -0.0752486,
-    -0.0751517,
-    -0.0750596,
-    -0.0749722,
-    -0.0748893,
-    -0.0748109,
-    -0.0747368,
-    -0.074667,
-    -0.0746014,
-    -0.0745398,
-    -0.0744821,
-    -0.0744282,
-    -0.0743781,
-    -0.0743315,
-    -0.0742884,
-    -0.0742486,
-    -0.0742121,
-    -0.0741787,
-    -0.0741483,
-    -0.0741208,
-    -0.074096,
-    -0.0740738,
-    -0.0740542,
-    -0.0740369,
-    -0.074022,
-    -0.0740091,
-    -0.0739983,
-    -0.0739893,
-    -0.0739821,
-    -0.0739765,
-    -0.0739725,
-    -0.0739698,
-    -0.0739683,
-    -0.073968,
-    -0.0739686,
-    -0.0739702,
-    -0.0739724,
-    -0.0739752,
-    -0.0739785,
-    -0.0739822,
-    -0.073986,
-    -0.0739899,
-    -0.0739938,
-    -0.0739975,
-    -0.0740008,
-    -0.0740037,
-    -0.0740061,
-    -0.0740077,
-    -0.0740085,
-    -0.0740083,
-    -0.074007,
-    -0.0740045,
-    -0.0740007,
-    -0.0739954,
-    -0.0739884,
-    -0.0739798,
-    -0.0739692,
-    -0.0739567,
-    -0.0739421,
-    -0.0739253,
-    -0.073906,
-    -0.0738843,
-    -0.07386,
-    -0.073833,
-    -0.0738032,
-    -0.0737703,
-    -0.0737344,
-    -0.0736953,
-    -0.0736529,
-    -0.073607,
-    -0.0735576,
-    -0.0735045,
-    -0.0734477,
-    -0.0733869,
-    -0.0733222,
-    -0.0732534,
-    -0.0731803,
-    -0.073103,
-    -0.0730212,
-    -0.0729349,
-    -0.072844,
-    -0.0727484,
-    -0.0726479,
-    -0.0725425,
-    -0.0724321,
-    -0.0723166,
-    -0.0721959,
-    -0.0720699,
-    -0.0719385,
-    -0.0718016,
-    -0.0716592,
-    -0.0715111,
-    -0.0713574,
-    -0.0711978,
-    -0.0710323,
-    -0.0708609,
-    -0.0706834,
-    -0.0704998,
-    -0.0703101,
-    -0.0701141,
-    -0.0699117,
-    -0.069703,
-    -0.0694879,
-    -0.0692662,
-    -0.069038,
-    -0.0688031,
-    -0.0685616,
-    -0.0683133,
-    -0.0680583,
-    -0.0677964,
-    -0.0675276,
-    -0.0672519,
-    -0.0669693,
-    -0.0666796,
-    -0.0663829,
-    -0.0660791,
-    -0.0657682,
-    -0.0654501,
-    -0.0651248,
-    -0.0647924,
-    -0.0644527,
-    -0.0641058,
-    -0.0637515,
-    -0.06339,
-    -0.0630212,
-    -0.062645,
-    -0.0622616,
-    -0.0618707,
-    -0.0614726,
-    -0.061067,
-    -0.0606541,
-    -0.0602338,
-    -0.0598062,
-    -0.0593713,
-    -0.0589289,
-    -0.0584793,
-    -0.0580223,
-    -0.057558,
-    -0.0570864,
-    -0.0566075,
-    -0.0561214,
-    -0.055628,
-    -0.0551274,
-    -0.0546196,
-    -0.0541047,
-    -0.0535826,
-    -0.0530535,
-    -0.0525173,
-    -0.0519741,
-    -0.0514239,
-    -0.0508667,
-    -0.0503027,
-    -0.0497318,
-    -0.0491541,
-    -0.0485697,
-    -0.0479786,
-    -0.0473808,
-    -0.0467765,
-    -0.0461656,
-    -0.0455483,
-    -0.0449245,
-    -0.0442945,
-    -0.0436581,
-    -0.0430156,
-    -0.042367,
-    -0.0417122,
-    -0.0410515,
-    -0.0403849,
-    -0.0397125,
-    -0.0390343,
-    -0.0383505,
-    -0.0376611,
-    -0.0369662,
-    -0.0362658,
-    -0.0355602,
-    -0.0348493,
-    -0.0341333,
-    -0.0334122,
-    -0.0326862,
-    -0.0319553,
-    -0.0312197,
-    -0.0304794,
-    -0.0297346,
-    -0.0289853,
-    -0.0282316,
-    -0.0274737,
-    -0.0267117,
-    -0.0259456,
-    -0.0251756,
-    -0.0244018,
-    -0.0236243,
-    -0.0228432,
-    -0.0220587,
-    -0.0212707,
-    -0.0204796,
-    -0.0196852,
-    -0.0188879,
-    -0.0180877,
-    -0.0172847,
-    -0.0164791,
-    -0.0156709,
-    -0.0148603,
-    -0.0140475,
-    -0.0132324,
-    -0.0124153,
-    -0.0115963,
-    -0.0107756,
-    -0.0099531,
-    -0.0091291,
-    -0.0083037,
-    -0.007477,
-    -0.00664915,
-    -0.00582026,
-    -0.00499047,
-    -0.00415991,
-    -0.00332871,
-    -0.00249698,
-    -0.00166487,
-    -0.0008325,
-    0,
-    0.0008325,
-    0.00166487,
-    0.00249698,
-    0.00332871,
-    0.00415991,
-    0.00499047,
-    0.00582026,
-    0.00664915,
-    0.007477,
-    0.0083037,
-    0.0091291,
-    0.0099531,
-    0.0107756,
-    0.0115963,
-    0.0124153,
-    0.0132324,
-    0.0140475,
-    0.0148603,
-    0.0156709,
-    0.0164791,
-    0.0172847,
-    0.0180877,
-    0.0188879,
-    0.0196852,
-    0.0204796,
-    0.0212707,
-    0.0220587,
-    0.0228432,
-    0.0236243,
-    0.0244018,
-    0.0251756,
-    0.0259456,
-    0.0267117,
-    0.0274737,
-    0.0282316,
-    0.0289853,
-    0.0297346,
-    0.0304794,
-    0.0312197,
-    0.0319553,
-    0.0326862,
-    0.0334122,
-    0.0341333,
-    0.0348493,
-    0.0355602,
-    0.0362658,
-    0.0369662,
-    0.0376611,
-    0.0383505,
-    0.0390343,
-    0.0397125,
-    0.0403849,
-    0.0410515,
-    0.0417122,
-    0.042367,
-    0.0430156,
-    0.0436581,
-    0.0442945,
-    0.0449245,
-    0.0455483,
-    0.0461656,
-    0.0467765,
-    0.0473808,
-    0.0479786,
-    0.0485697,
-    0.0491541,
-    0.0497318,
-    0.0503027,
-    0.0508667,
-    0.0514239,
-    0.0519741,
-    0.0525173,
-    0.0530535,
-    0.0535826,
-    0.0541047,
-    0.0546196,
-    0.0551274,
-    0.055628,
-    0.0561214,
-    0.0566075,
-    0.0570864,
-    0.057558,
-    0.0580223,
-    0.0584793,
-    0.0589289,
-    0.0593713,
-    0.0598062,
-    0.0602338,
-    0.0606541,
-    0.061067,
-    0.0614726,
-    0.0618707,
-    0.0622616,
-    0.062645,
-    0.0630212,
-    0.06339,
-    0.0637515,
-    0.0641058,
-    0.0644527,
-    0.0647924,
-    0.0651248,
-    0.0654501,
-    0.0657682,
-    0.0660791,
-    0.0663829,
-    0.0666796,
-    0.0669693,
-    0.0672519,
-    0.0675276,
-    0.0677964,
-    0.0680583,
-    0.0683133,
-    0.0685616,
-    0.0688031,
-    0.069038,
-    0.0692662,
-    0.0694879,
-    0.069703,
-    0.0699117,
-    0.0701141,
-    0.0703101,
-    0.0704998,
-    0.0706834,
-    0.0708609,
-    0.0710323,
-    0.0711978,
-    0.0713574,
-    0.0715111,
-    0.0716592,
-    0.0718016,
-    0.0719385,
-    0.0720699,
-    0.0721959,
-    0.0723166,
-    0.0724321,
-    0.0725425,
-    0.0726479,
-    0.0727484,
-    0.072844,
-    0.0729349,
-    0.0730212,
-    0.073103,
-    0.0731803,
-    0.0732534,
-    0.0733222,
-    0.0733869,
-    0.0734477,
-    0.0735045,
-    0.0735576,
-    0.073607,
-    0.0736529,
-    0.0736953,
-    0.0737344,
-    0.0737703,
-    0.0738032,
-    0.073833,
-    0.07386,
-    0.0738843,
-    0.073906,
-    0.0739253,
-    0.0739421,
-    0.0739567,
-    0.0739692,
-    0.0739798,
-    0.0739884,
-    0.0739954,
-    0.0740007,
-    0.0740045,
-    0.074007,
-    0.0740083,
-    0.0740085,
-    0.0740077,
-    0.0740061,
-    0.0740037,
-    0.0740008,
-    0.0739975,
-    0.0739938,
-    0.0739899,
-    0.073986,
-    0.0739822,
-    0.0739785,
-    0.0739752,
-    0.0739724,
-    0.0739702,
-    0.0739686,
-    0.073968,
-    0.0739683,
-    0.0739698,
-    0.0739725,
-    0.0739765,
-    0.0739821,
-    0.0739893,
-    0.0739983,
-    0.0740091,
-    0.074022,
-    0.0740369,
-    0.0740542,
-    0.0740738,
-    0.074096,
-    0.0741208,
-    0.0741483,
-    0.0741787,
-    0.0742121,
-    0.0742486,
-    0.0742884,
-    0.0743315,
-    0.0743781,
-    0.0744282,
-    0.0744821,
-    0.0745398,
-    0.0746014,
-    0.074667,
-    0.0747368,
-    0.0748109,
-    0.0748893,
-    0.0749722,
-    0.0750596,
-    0.0751517,
-    0.0752486,
-    0.0753504,
-    0.0754572,
-    0.075569,
-    0.075686,
-    0.0758083,
-    0.075936,
-    0.076069,
-    0.0762077,
-    0.0763519,
-    0.0765019,
-    0.0766577,
-    0.0768193,
-    0.0769869,
-    0.0771606,
-    0.0773403,
-    0.0775263,
-    0.0777185,
-    0.077917,
-    0.078122,
-    0.0783334,
-    0.0785514,
-    0.078776,
-    0.0790072,
-    0.0792452,
-    0.0794899,
-    0.0797415,
-    0.08,
-    0.0802654,
-    0.0805378,
-    0.0808172,
-    0.0811037,
-    0.0813973,
-    0.0816981,
-    0.0820061,
-    0.0823213,
-    0.0826438,
-    0.0829736,
-    0.0833108,
-    0.0836553,
-    0.0840071,
-    0.0843664,
-    0.0847331,
-    0.0851072,
-    0.0854888,
-    0.0858779,
-    0.0862744,
-    0.0866785,
-    0.08709,
-    0.0875091,
-    0.0879356,
-    0.0883696,
-    0.0888111,
-    0.0892602,
-    0.0897167,
-    0.0901807,
-    0.0906521,
-    0.091131,
-    0.0916173,
-    0.092111,
-    0.0926122,
-    0.0931206,
-    0.0936365,
-    0.0941596,
-    0.09469,
-    0.0952277,
-    0.0957725,
-    0.0963246,
-    0.0968838,
-    0.09745,
-    0.0980233,
-    0.0986037,
-    0.0991909,
-    0.0997851,
-    0.100386,
-    0.100994,
-    0.101609,
-    0.10223,
-    0.102858,
-    0.103492,
-    0.104133,
-    0.10478,
-    0.105434,
-    0.106094,
-    0.10676,
-    0.107432,
-    0.108111,
-    0.108795,
-    0.109485,
-    0.110181,
-    0.110883,
-    0.11159,
-    0.112303,
-    0.113022,
-    0.113745,
-    0.114474,
-    0.115209,
-    0.115948,
-    0.116692,
-    0.117441,
-    0.118195,
-    0.118954,
-    0.119717,
-    0.120485,
-    0.121257,
-    0.122033,
-    0.122813,
-    0.123598,
-    0.124386,
-    0.125179,
-    0.125974,
-    0.126774,
-    0.127577,
-    0.128383,
-    0.129192,
-    0.130005,
-    0.130821,
-    0.131639,
-    0.13246,
-    0.133284,
-    0.13411,
-    0.134938,
-    0.135769,
-    0.136602,
-    0.137437,
-    0.138274,
-    0.139112,
-    0.139952,
-    0.140793,
-    0.141636,
-    0.14248,
-    0.143325,
-    0.144171,
-    0.145017,
-    0.145865,
-    0.146712,
-    0.147561,
-    0.148409,
-    0.149258,
-    0.150106,
-    0.150955,
-    0.151803,
-    0.15265,
-    0.153498,
-    0.154344,
-    0.15519,
-    0.156034,
-    0.156878,
-    0.15772,
-    0.158561,
-    0.159401,
-    0.160239,
-    0.161075,
-    0.161909,
-    0.162741,
-    0.163571,
-    0.164399,
-    0.165225,
-    0.166047,
-    0.166868,
-    0.167685,
-    0.1685,
-    0.169311,
-    0.170119,
-    0.170924,
-    0.171726,
-    0.172524,
-    0.173319,
-    0.174109,
-    0.174896,
-    0.175679,
-    0.176458,
-    0.177232,
-    0.178002,
-    0.178768,
-    0.179529,
-    0.180285,
-    0.181037,
-    0.181784,
-    0.182525,
-    0.183262,
-    0.183993,
-    0.184719,
-    0.18544,
-    0.186155,
-    0.186865,
-    0.187569,
-    0.188267,
-    0.188959,
-    0.189646,
-    0.190326,
-    0.191,
-    0.191668,
-    0.19233,
-    0.192985,
-    0.193634,
-    0.194276,
-    0.194912,
-    0.195541,
-    0.196163,
-    0.196778,
-    0.197387,
-    0.197988,
-    0.198583,
-    0.199171,
-    0.199751,
-    0.200324,
-    0.20089,
-    0.201449,
-    0.202001,
-    0.202545,
-    0.203081,
-    0.203611,
-    0.204132,
-    0.204647,
-    0.205153,
-    0.205652,
-    0.206144,
-    0.206627,
-    0.207104,
-    0.207572,
-    0.208033,
-    0.208486,
-    0.208931,
-    0.209368,
-    0.209798,
-    0.21022,
-    0.210634,
-    0.21104,
-    0.211438,
-    0.211829,
-    0.212212,
-    0.212587,
-    0.212954,
-    0.213314,
-    0.213666,
-    0.21401,
-    0.214346,
-    0.214675,
-    0.214996,
-    0.215309,
-    0.215615,
-    0.215913,
-    0.216203,
-    0.216486,
-    0.216762,
-    0.21703,
-    0.217291,
-    0.217544,
-    0.21779,
-    0.218029,
-    0.21826,
-    0.218485,
-    0.218702,
-    0.218912,
-    0.219115,
-    0.219311,
-    0.219501,
-    0.219683,
-    0.219859,
-    0.220028,
-    0.220191,
-    0.220347,
-    0.220497,
-    0.22064,
-    0.220777,
-    0.220908,
-    0.221033,
-    0.221152,
-    0.221264,
-    0.221371,
-    0.221473,
-    0.221568,
-    0.221658,
-    0.221743,
-    0.221822,
-    0.221896,
-    0.221965,
-    0.222028,
-    0.222087,
-    0.222141,
-    0.22219,
-    0.222235,
-    0.222275,
-    0.222311,
-    0.222342,
-    0.22237,
-    0.222393,
-    0.222412,
-    0.222428,
-    0.22244,
-    0.222448,
-    0.222453,
-    0.222455,
-    0.222453,
-    0.222448,
-    0.222441,
-    0.222431,
-    0.222418,
-    0.222402,
-    0.222384,
-    0.222364,
-    0.222342,
-    0.222318,
-    0.222291,
-    0.222264,
-    0.222234,
-    0.222203,
-    0.222171,
-    0.222138,
-    0.222103,
-    0.222068,
-    0.222032,
-    0.221996,
-    0.221959,
-    0.221921,
-    0.221884,
-    0.221846,
-    0.221808,
-    0.221771,
-    0.221734,
-    0.221698,
-    0.221662,
-    0.221627,
-    0.221593,
-    0.22156,
-    0.221528,
-    0.221498,
-    0.221469,
-    0.221442,
-    0.221416,
-    0.221393,
-    0.221371,
-    0.221352,
-    0.221335,
-    0.221321,
-    0.221309,
-    0.2213,
-    0.221293,
-    0.22129,
-    0.22129,
-    0.221293,
-    0.2213,
-    0.22131,
-    0.221323,
-    0.221341,
-    0.221362,
-    0.221388,
-    0.221417,
-    0.221451,
-    0.221489,
-    0.221532,
-    0.22158,
-    0.221632,
-    0.221689,
-    0.221751,
-    0.221818,
-    0.221891,
-    0.221969,
-    0.222052,
-    0.22214,
-    0.222235,
-    0.222335,
-    0.222441,
-    0.222553,
-    0.222671,
-    0.222795,
-    0.222926,
-    0.223062,
-    0.223206,
-    0.223355,
-    0.223512,
-    0.223675,
-    0.223845,
-    0.224021,
-    0.224205,
-    0.224396,
-    0.224594,
-    0.224799,
-    0.225011,
-    0.22523,
-    0.225457,
-    0.225691,
-    0.225933,
-    0.226183,
-    0.22644,
-    0.226704,
-    0.226977,
-    0.227257,
-    0.227545,
-    0.227841,
-    0.228145,
-    0.228457,
-    0.228776,
-    0.229104,
-    0.22944,
-    0.229784,
-    0.230136,
-    0.230497,
-    0.230865,
-    0.231242,
-    0.231626,
-    0.23202,
-    0.232421,
-    0.232831,
-    0.233248,
-    0.233675,
-    0.234109,
-    0.234552,
-    0.235003,
-    0.235462,
-    0.23593,
-    0.236405,
-    0.236889,
-    0.237382,
-    0.237882,
-    0.238391,
-    0.238908,
-    0.239433,
-    0.239966,
-    0.240507,
-    0.241056,
-    0.241613,
-    0.242179,
-    0.242752,
-    0.243333,
-    0.243922,
-    0.244519,
-    0.245123,
-    0.245736,
-    0.246355,
-    0.246983,
-    0.247618,
-    0.248261,
-    0.248911,
-    0.249568,
-    0.250232,
-    0.250904,
-    0.251583,
-    0.252269,
-    0.252962,
-    0.253662,
-    0.254369,
-    0.255082,
-    0.255802,
-    0.256529,
-    0.257262,
-    0.258001,
-    0.258747,
-    0.259499,
-    0.260257,
-    0.261021,
-    0.261791,
-    0.262567,
-    0.263348,
-    0.264135,
-    0.264927,
-    0.265725,
-    0.266528,
-    0.267336,
-    0.268149,
-    0.268967,
-    0.269789,
-    0.270617,
-    0.271448,
-    0.272285,
-    0.273125,
-    0.27397,
-    0.274818,
-    0.27567,
-    0.276527,
-    0.277386,
-    0.27825,
-    0.279116,
-    0.279986,
-    0.280859,
-    0.281734,
-    0.282613,
-    0.283494,
-    0.284378,
-    0.285264,
-    0.286152,
-    0.287042,
-    0.287934,
-    0.288828,
-    0.289724,
-    0.290621,
-    0.291519,
-    0.292418,
-    0.293319,
-    0.294221,
-    0.295123,
-    0.296025,
-    0.296929,
-    0.297832,
-    0.298736,
-    0.299639,
-    0.300543,
-    0.301446,
-    0.302348,
-    0.30325,
-    0.304152,
-    0.305052,
-    0.305951,
-    0.306849,
-    0.307745,
-    0.30864,
-    0.309534,
-    0.310425,
-    0.311315,
-    0.312202,
-    0.313087,
-    0.31397,
-    0.31485,
-    0.315727,
-    0.316602,
-    0.317473,
-    0.318342,
-    0.319207,
-    0.320068,
-    0.320926,
-    0.321781,
-    0.322631,
-    0.323477,
-    0.32432,
-    0.325158,
-    0.325991,
-    0.32682,
-    0.327644,
-    0.328464,
-    0.329278,
-    0.330088,
-    0.330892,
-    0.331691,
-    0.332485,
-    0.333273,
-    0.334055,
-    0.334831,
-    0.335602,
-    0.336366,
-    0.337124,
-    0.337876,
-    0.338622,
-    0.339361,
-    0.340094,
-    0.340819,
-    0.341538,
-    0.34225,
-    0.342956,
-    0.343654,
-    0.344344,
-    0.345028,
-    0.345704,
-    0.346373,
-    0.347034,
-    0.347687,
-    0.348333,
-    0.348971,
-    0.349601,
-    0.350223,
-    0.350837,
-    0.351443,
-    0.352041,
-    0.35263,
-    0.353211,
-    0.353784,
-    0.354349,
-    0.354905,
-    0.355452,
-    0.355991,
-    0.356522,
-    0.357043,
-    0.357556,
-    0.358061,
-    0.358556,
-    0.359043,
-    0.359521,
-    0.359989,
-    0.36045,
-    0.360901,
-    0.361343,
-    0.361776,
-    0.3622,
-    0.362616,
-    0.363022,
-    0.363419,
-    0.363807,
-    0.364187,
-    0.364557,
-    0.364918,
-    0.365271,
-    0.365614,
-    0.365948,
-    0.366274,
-    0.36659,
-    0.366898,
-    0.367196,
-    0.367486,
-    0.367767,
-    0.368039,
-    0.368303,
-    0.368557,
-    0.368803,
-    0.36904,
-    0.369269,
-    0.369489,
-    0.369701,
-    0.369904,
-    0.370099,
-    0.370286,
-    0.370464,
-    0.370634,
-    0.370796,
-    0.37095,
-    0.371095,
-    0.371233,
-    0.371363,
-    0.371486,
-    0.3716,
-    0.371707,
-    0.371807,
-    0.371899,
-    0.371984,
-    0.372062,
-    0.372132,
-    0.372195,
-    0.372252,
-    0.372302,
-    0.372344,
-    0.372381,
-    0.372411,
-    0.372434,
-    0.372451,
-    0.372462,
-    0.372467,
-    0.372466,
-    0.372459,
-    0.372447,
-    0.372429,
-    0.372406,
-    0.372377,
-    0.372343,
-    0.372304,
-    0.37226,
-    0.372212,
-    0.372159,
-    0.372101,
-    0.372039,
-    0.371973,
-    0.371903,
-    0.371829,
-    0.371751,
-    0.37167,
-    0.371585,
-    0.371497,
-    0.371406,
-    0.371311,
-    0.371214,
-    0.371114,
-    0.371012,
-    0.370908,
-    0.370801,
-    0.370692,
-    0.370581,
-    0.370469,
-    0.370354,
-    0.370239,
-    0.370122,
-    0.370005,
-    0.369886,
-    0.369767,
-    0.369647,
-    0.369526,
-    0.369406,
-    0.369285,
-    0.369164,
-    0.369044,
-    0.368924,
-    0.368805,
-    0.368686,
-    0.368569,
-    0.368452,
-    0.368337,
-    0.368223,
-    0.368111,
-    0.368,
-    0.367892,
-    0.367785,
-    0.367681,
-    0.367579,
-    0.36748,
-    0.367384,
-    0.36729,
-    0.3672,
-    0.367112,
-    0.367029,
-    0.366948,
-    0.366872,
-    0.366799,
-    0.366731,
-    0.366666,
-    0.366606,
-    0.36655,
-    0.366499,
-    0.366453,
-    0.366412,
-    0.366376,
-    0.366345,
-    0.36632,
-    0.3663,
-    0.366285,
-    0.366277,
-    0.366275,
-    0.366278,
-    0.366288,
-    0.366304,
-    0.366327,
-    0.366356,
-    0.366392,
-    0.366435,
-    0.366486,
-    0.366543,
-    0.366607,
-    0.366679,
-    0.366758,
-    0.366845,
-    0.36694,
-    0.367042,
-    0.367153,
-    0.367271,
-    0.367398,
-    0.367533,
-    0.367676,
-    0.367828,
-    0.367988,
-    0.368157,
-    0.368334,
-    0.36852,
-    0.368716,
-    0.36892,
-    0.369133,
-    0.369356,
-    0.369587,
-    0.369828,
-    0.370078,
-    0.370338,
-    0.370607,
-    0.370886,
-    0.371174,
-    0.371472,
-    0.371779,
-    0.372096,
-    0.372423,
-    0.37276,
-    0.373107,
-    0.373463,
-    0.37383,
-    0.374206,
-    0.374593,
-    0.374989,
-    0.375396,
-    0.375812,
-    0.376239,
-    0.376675,
-    0.377122,
-    0.377579,
-    0.378045,
-    0.378522,
-    0.379009,
-    0.379506,
-    0.380014,
-    0.380531,
-    0.381058,
-    0.381595,
-    0.382142,
-    0.382699,
-    0.383266,
-    0.383843,
-    0.38443,
-    0.385027,
-    0.385633,
-    0.38625,
-    0.386875,
-    0.387511,
-    0.388156,
-    0.388811,
-    0.389475,
-    0.390148,
-    0.390831,
-    0.391523,
-    0.392224,
-    0.392935,
-    0.393654,
-    0.394383,
-    0.39512,
-    0.395866,
-    0.396621,
-    0.397384,
-    0.398156,
-    0.398936,
-    0.399725,
-    0.400522,
-    0.401327,
-    0.40214,
-    0.402961,
-    0.403789,
-    0.404626,
-    0.40547,
-    0.406321,
-    0.40718,
-    0.408045,
-    0.408918,
-    0.409798,
-    0.410684,
-    0.411578,
-    0.412477,
-    0.413383,
-    0.414295,
-    0.415214,
-    0.416138,
-    0.417068,
-    0.418004,
-    0.418945,
-    0.419891,
-    0.420843,
-    0.4218,
-    0.422761,
-    0.423727,
-    0.424698,
-    0.425673,
-    0.426652,
-    0.427636,
-    0.428623,
-    0.429614,
-    0.430608,
-    0.431606,
-    0.432607,
-    0.43361,
-    0.434617,
-    0.435626,
-    0.436638,
-    0.437652,
-    0.438668,
-    0.439686,
-    0.440706,
-    0.441727,
-    0.44275,
-    0.443773,
-    0.444798,
-    0.445824,
-    0.44685,
-    0.447876,
-    0.448903,
-    0.44993,
-    0.450956,
-    0.451983,
-    0.453008,
-    0.454033,
-    0.455057,
-    0.45608,
-    0.457102,
-    0.458122,
-    0.459141,
-    0.460157,
-    0.461172,
-    0.462184,
-    0.463194,
-    0.464201,
-    0.465206,
-    0.466207,
-    0.467205,
-    0.4682,
-    0.469192,
-    0.470179,
-    0.471163,
-    0.472142,
-    0.473117,
-    0.474088,
-    0.475054,
-    0.476016,
-    0.476972,
-    0.477923,
-    0.478869,
-    0.479809,
-    0.480743,
-    0.481672,
-    0.482594,
-    0.48351,
-    0.48442,
-    0.485324,
-    0.48622,
-    0.48711,
-    0.487993,
-    0.488868,
-    0.489736,
-    0.490597,
-    0.49145,
-    0.492295,
-    0.493133,
-    0.493962,
-    0.494783,
-    0.495595,
-    0.496399,
-    0.497195,
-    0.497981,
-    0.498759,
-    0.499528,
-    0.500287,
-    0.501038,
-    0.501778,
-    0.50251,
-    0.503231,
-    0.503943,
-    0.504645,
-    0.505337,
-    0.506019,
-    0.506691,
-    0.507352,
-    0.508004,
-    0.508644,
-    0.509274,
-    0.509894,
-    0.510503,
-    0.511101,
-    0.511688,
-    0.512264,
-    0.512829,
-    0.513383,
-    0.513926,
-    0.514457,
-    0.514978,
-    0.515487,
-    0.515985,
-    0.516471,
-    0.516946,
-    0.517409,
-    0.517861,
-    0.518301,
-    0.51873,
-    0.519147,
-    0.519552,
-    0.519946,
-    0.520328,
-    0.520698,
-    0.521057,
-    0.521404,
-    0.521739,
-    0.522063,
-    0.522374,
-    0.522675,
-    0.522963,
-    0.52324,
-    0.523505,
-    0.523759,
-    0.524001,
-    0.524231,
-    0.52445,
-    0.524658,
-    0.524854,
-    0.525038,
-    0.525212,
-    0.525374,
-    0.525525,
-    0.525664,
-    0.525793,
-    0.525911,
-    0.526017,
-    0.526113,
-    0.526198,
-    0.526272,
-    0.526335,
-    0.526388,
-    0.526431,
-    0.526463,
-    0.526485,
-    0.526497,
-    0.526498,
-    0.52649,
-    0.526472,
-    0.526444,
-    0.526407,
-    0.52636,
-    0.526304,
-    0.526238,
-    0.526163,
-    0.52608,
-    0.525987,
-    0.525886,
-    0.525777,
-    0.525659,
-    0.525532,
-    0.525398,
-    0.525256,
-    0.525106,
-    0.524948,
-    0.524783,
-    0.52461,
-    0.524431,
-    0.524244,
-    0.524051,
-    0.523851,
-    0.523645,
-    0.523432,
-    0.523213,
-    0.522989,
-    0.522758,
-    0.522523,
-    0.522282,
-    0.522035,
-    0.521784,
-    0.521528,
-    0.521268,
-    0.521003,
-    0.520734,
-    0.520461,
-    0.520185,
-    0.519905,
-    0.519622,
-    0.519335,
-    0.519046,
-    0.518754,
-    0.51846,
-    0.518163,
-    0.517864,
-    0.517564,
-    0.517262,
-    0.516958,
-    0.516654,
-    0.516348,
-    0.516042,
-    0.515736,
-    0.515429,
-    0.515122,
-    0.514815,
-    0.514509,
-    0.514203,
-    0.513898,
-    0.513595,
-    0.513292,
-    0.512992,
-    0.512693,
-    0.512396,
-    0.512101,
-    0.511809,
-    0.511519,
-    0.511232,
-    0.510949,
-    0.510668,
-    0.510392,
-    0.510119,
-    0.50985,
-    0.509586,
-    0.509326,
-    0.50907,
-    0.50882,
-    0.508575,
-    0.508335,
-    0.5081,
-    0.507872,
-    0.507649,
-    0.507433,
-    0.507223,
-    0.507019,
-    0.506823,
-    0.506633,
-    0.506451,
-    0.506276,
-    0.506109,
-    0.50595,
-    0.505798,
-    0.505655,
-    0.505521,
-    0.505395,
-    0.505278,
-    0.50517,
-    0.505071,
-    0.504981,
-    0.504901,
-    0.504831,
-    0.50477,
-    0.50472,
-    0.50468,
-    0.50465,
-    0.504631,
-    0.504623,
-    0.504625,
-    0.504639,
-    0.504664,
-    0.5047,
-    0.504747,
-    0.504806,
-    0.504877,
-    0.50496,
-    0.505055,
-    0.505162,
-    0.505281,
-    0.505413,
-    0.505558,
-    0.505714,
-    0.505884,
-    0.506067,
-    0.506262,
-    0.506471,
-    0.506693,
-    0.506928,
-    0.507176,
-    0.507438,
-    0.507713,
-    0.508002,
-    0.508305,
-    0.508621,
-    0.508951,
-    0.509295,
-    0.509653,
-    0.510025,
-    0.510411,
-    0.510811,
-    0.511225,
-    0.511654,
-    0.512096,
-    0.512553,
-    0.513023,
-    0.513509,
-    0.514008,
-    0.514522,
-    0.51505,
-    0.515592,
-    0.516148,
-    0.516719,
-    0.517304,
-    0.517903,
-    0.518517,
-    0.519144,
-    0.519786,
-    0.520442,
-    0.521112,
-    0.521797,
-    0.522495,
-    0.523207,
-    0.523933,
-    0.524673,
-    0.525426,
-    0.526194,
-    0.526975,
-    0.527769,
-    0.528577,
-    0.529399,
-    0.530233,
-    0.531081,
-    0.531942,
-    0.532816,
-    0.533703,
-    0.534603,
-    0.535516,
-    0.53644,
-    0.537378,
-    0.538328,
-    0.539289,
-    0.540263,
-    0.541249,
-    0.542246,
-    0.543256,
-    0.544276,
-    0.545308,
-    0.546351,
-    0.547405,
-    0.548469,
-    0.549545,
-    0.55063,
-    0.551726,
-    0.552833,
-    0.553949,
-    0.555074,
-    0.556209,
-    0.557354,
-    0.558508,
-    0.55967,
-    0.560841,
-    0.562021,
-    0.563209,
-    0.564405,
-    0.565609,
-    0.566821,
-    0.568039,
-    0.569265,
-    0.570499,
-    0.571738,
-    0.572984,
-    0.574237,
-    0.575495,
-    0.576759,
-    0.578029,
-    0.579304,
-    0.580583,
-    0.581868,
-    0.583157,
-    0.58445,
-    0.585747,
-    0.587048,
-    0.588353,
-    0.58966,
-    0.59097,
-    0.592283,
-    0.593599,
-    0.594916,
-    0.596235,
-    0.597556,
-    0.598878,
-    0.600201,
-    0.601525,
-    0.602849,
-    0.604173,
-    0.605497,
-    0.606821,
-    0.608144,
-    0.609466,
-    0.610787,
-    0.612106,
-    0.613423,
-    0.614738,
-    0.616051,
-    0.617361,
-    0.618668,
-    0.619972,
-    0.621272,
-    0.622568,
-    0.62386,
-    0.625148,
-    0.626431,
-    0.627709,
-    0.628982,
-    0.630249,
-    0.63151,
-    0.632766,
-    0.634014,
-    0.635256,
-    0.636492,
-    0.63772,
-    0.63894,
-    0.640153,
-    0.641357,
-    0.642553,
-    0.643741,
-    0.64492,
-    0.64609,
-    0.64725,
-    0.6484,
-    0.649541,
-    0.650672,
-    0.651792,
-    0.652901,
-    0.654,
-    0.655087,
-    0.656163,
-    0.657227,
-    0.658279,
-    0.659319,
-    0.660347,
-    0.661362,
-    0.662365,
-    0.663354,
-    0.66433,
-    0.665293,
-    0.666241,
-    0.667176,
-    0.668097,
-    0.669003,
-    0.669895,
-    0.670772,
-    0.671635,
-    0.672482,
-    0.673313,
-    0.67413,
-    0.674931,
-    0.675715,
-    0.676484,
-    0.677237,
-    0.677973,
-    0.678693,
-    0.679397,
-    0.680083,
-    0.680753,
-    0.681405,
-    0.682041,
-    0.682659,
-    0.683259,
-    0.683842,
-    0.684408,
-    0.684955,
-    0.685485,
-    0.685997,
-    0.686491,
-    0.686966,
-    0.687424,
-    0.687863,
-    0.688283,
-    0.688686,
-    0.689069,
-    0.689434,
-    0.689781,
-    0.690109,
-    0.690418,
-    0.690708,
-    0.69098,
-    0.691233,
-    0.691467,
-    0.691682,
-    0.691879,
-    0.692056,
-    0.692215,
-    0.692355,
-    0.692477,
-    0.692579,
-    0.692663,
-    0.692728,
-    0.692774,
-    0.692802,
-    0.692811,
-    0.692802,
-    0.692775,
-    0.692729,
-    0.692664,
-    0.692582,
-    0.692481,
-    0.692362,
-    0.692226,
-    0.692071,
-    0.691899,
-    0.691709,
-    0.691502,
-    0.691278,
-    0.691036,
-    0.690777,
-    0.690501,
-    0.690208,
-    0.689899,
-    0.689573,
-    0.689232,
-    0.688873,
-    0.688499,
-    0.68811,
-    0.687704,
-    0.687283,
-    0.686847,
-    0.686396,
-    0.685931,
-    0.685451,
-    0.684956,
-    0.684447,
-    0.683925,
-    0.683389,
-    0.682839,
-    0.682276,
-    0.681701,
-    0.681113,
-    0.680512,
-    0.6799,
-    0.679275,
-    0.678639,
-    0.677992,
-    0.677333,
-    0.676664,
-    0.675985,
-    0.675295,
-    0.674596,
-    0.673887,
-    0.673169,
-    0.672442,
-    0.671707,
-    0.670963,
-    0.670212,
-    0.669453,
-    0.668686,
-    0.667913,
-    0.667133,
-    0.666347,
-    0.665555,
-    0.664758,
-    0.663955,
-    0.663148,
-    0.662336,
-    0.66152,
-    0.6607,
-    0.659877,
-    0.659051,
-    0.658223,
-    0.657392,
-    0.656559,
-    0.655725,
-    0.65489,
-    0.654054,
-    0.653218,
-    0.652382,
-    0.651546,
-    0.650711,
-    0.649878,
-    0.649046,
-    0.648216,
-    0.647389,
-    0.646564,
-    0.645743,
-    0.644925,
-    0.644111,
-    0.643302,
-    0.642498,
-    0.641699,
-    0.640905,
-    0.640118,
-    0.639337,
-    0.638563,
-    0.637796,
-    0.637036,
-    0.636285,
-    0.635543,
-    0.634809,
-    0.634084,
-    0.633369,
-    0.632664,
-    0.63197,
-    0.631286,
-    0.630614,
-    0.629953,
-    0.629304,
-    0.628668,
-    0.628045,
-    0.627434,
-    0.626837,
-    0.626255,
-    0.625686,
-    0.625132,
-    0.624594,
-    0.62407,
-    0.623563,
-    0.623072,
-    0.622597,
-    0.622139,
-    0.621698,
-    0.621275,
-    0.62087,
-    0.620483,
-    0.620115,
-    0.619766,
-    0.619436,
-    0.619126,
-    0.618836,
-    0.618566,
-    0.618317,
-    0.618088,
-    0.617881,
-    0.617695,
-    0.617531,
-    0.61739,
-    0.61727,
-    0.617173,
-    0.6171,
-    0.617049,
-    0.617022,
-    0.617019,
-    0.61704,
-    0.617085,
-    0.617154,
-    0.617249,
-    0.617368,
-    0.617512,
-    0.617682,
-    0.617878,
-    0.618099,
-    0.618346,
-    0.61862,
-    0.61892,
-    0.619247,
-    0.6196,
-    0.61998,
-    0.620388,
-    0.620822,
-    0.621284,
-    0.621774,
-    0.622291,
-    0.622836,
-    0.623409,
-    0.62401,
-    0.624639,
-    0.625296,
-    0.625981,
-    0.626695,
-    0.627437,
-    0.628208,
-    0.629007,
-    0.629835,
-    0.630691,
-    0.631576,
-    0.63249,
-    0.633432,
-    0.634403,
-    0.635403,
-    0.636431,
-    0.637488,
-    0.638574,
-    0.639688,
-    0.64083,
-    0.642001,
-    0.643201,
-    0.644428,
-    0.645684,
-    0.646968,
-    0.64828,
-    0.64962,
-    0.650988,
-    0.652384,
-    0.653807,
-    0.655257,
-    0.656735,
-    0.65824,
-    0.659772,
-    0.66133,
-    0.662915,
-    0.664526,
-    0.666164,
-    0.667827,
-    0.669516,
-    0.671231,
-    0.67297,
-    0.674735,
-    0.676524,
-    0.678338,
-    0.680176,
-    0.682038,
-    0.683924,
-    0.685832,
-    0.687764,
-    0.689718,
-    0.691695,
-    0.693694,
-    0.695714,
-    0.697755,
-    0.699818,
-    0.701901,
-    0.704004,
-    0.706127,
-    0.708269,
-    0.71043,
-    0.71261,
-    0.714807,
-    0.717023,
-    0.719256,
-    0.721505,
-    0.723771,
-    0.726053,
-    0.72835,
-    0.730662,
-    0.732989,
-    0.735329,
-    0.737683,
-    0.74005,
-    0.742429,
-    0.74482,
-    0.747223,
-    0.749637,
-    0.75206,
-    0.754494,
-    0.756936,
-    0.759388,
-    0.761847,
-    0.764314,
-    0.766788,
-    0.769268,
-    0.771753,
-    0.774244,
-    0.77674,
-    0.779239,
-    0.781741,
-    0.784246,
-    0.786753,
-    0.789262,
-    0.791771,
-    0.79428,
-    0.796789,
-    0.799297,
-    0.801802,
-    0.804305,
-    0.806805,
-    0.809301,
-    0.811792,
-    0.814278,
-    0.816758,
-    0.819232,
-    0.821698,
-    0.824156,
-    0.826605,
-    0.829045,
-    0.831475,
-    0.833894,
-    0.836301,
-    0.838696,
-    0.841078,
-    0.843446,
-    0.845799,
-    0.848138,
-    0.85046,
-    0.852766,
-    0.855055,
-    0.857325,
-    0.859577,
-    0.861808,
-    0.86402,
-    0.86621,
-    0.868379,
-    0.870525,
-    0.872648,
-    0.874747,
-    0.876821,
-    0.878869,
-    0.880891,
-    0.882886,
-    0.884854,
-    0.886792,
-    0.888702,
-    0.890582,
-    0.892431,
-    0.894248,
-    0.896034,
-    0.897786,
-    0.899505,
-    0.901189,
-    0.902838,
-    0.904452,
-    0.906029,
-    0.907568,
-    0.90907,
-    0.910533,
-    0.911956,
-    0.91334,
-    0.914682,
-    0.915983,
-    0.917242,
-    0.918458,
-    0.91963,
-    0.920758,
-    0.921841,
-    0.922878,
-    0.923869,
-    0.924813,
-    0.92571,
-    0.926558,
-    0.927357,
-    0.928106,
-    0.928805,
-    0.929454,
-    0.93005,
-    0.930595,
-    0.931087,
-    0.931525,
-    0.93191,
-    0.93224,
-    0.932514,
-    0.932733,
-    0.932896,
-    0.933002,
-    0.93305,
-    0.93304,
-    0.932972,
-    0.932845,
-    0.932657,
-    0.93241,
-    0.932102,
-    0.931733,
-    0.931303,
-    0.93081,
-    0.930254,
-    0.929635,
-    0.928953,
-    0.928207,
-    0.927396,
-    0.92652,
-    0.925579,
-    0.924572,
-    0.923499,
-    0.922359,
-    0.921153,
-    0.919879,
-    0.918537,
-    0.917127,
-    0.915649,
-    0.914102,
-    0.912486,
-    0.910801,
-    0.909045,
-    0.90722,
-    0.905325,
-    0.903359,
-    0.901322,
-    0.899214,
-    0.897035,
-    0.894784,
-    0.892461,
-    0.890067,
-    0.8876,
-    0.885061,
-    0.88245,
-    0.879765,
-    0.877008,
-    0.874178,
-    0.871275,
-    0.868299,
-    0.865249,
-    0.862126,
-    0.85893,
-    0.855659,
-    0.852316,
-    0.848899,
-    0.845408,
-    0.841843,
-    0.838205,
-    0.834493,
-    0.830707,
-    0.826848,
-    0.822915,
-    0.818909,
-    0.81483,
-    0.810677,
-    0.80645,
-    0.802151,
-    0.797778,
-    0.793333,
-    0.788815,
-    0.784224,
-    0.779561,
-    0.774826,
-    0.770018,
-    0.765139,
-    0.760188,
-    0.755166,
-    0.750072,
-    0.744908,
-    0.739673,
-    0.734368,
-    0.728993,
-    0.723548,
-    0.718033,
-    0.71245,
-    0.706798,
-    0.701077,
-    0.695289,
-    0.689432,
-    0.683509,
-    0.677519,
-    0.671462,
-    0.665339,
-    0.659151,
-    0.652897,
-    0.646579,
-    0.640197,
-    0.633751,
-    0.627242,
-    0.62067,
-    0.614037,
-    0.607341,
-    0.600584,
-    0.593767,
-    0.58689,
-    0.579953,
-    0.572958,
-    0.565904,
-    0.558793,
-    0.551625,
-    0.5444,
-    0.53712,
-    0.529784,
-    0.522394,
-    0.51495,
-    0.507454,
-    0.499904,
-    0.492303,
-    0.484652,
-    0.476949,
-    0.469197,
-    0.461397,
-    0.453548,
-    0.445652,
-    0.437709,
-    0.42972,
-    0.421687,
-    0.413609,
-    0.405488,
-    0.397324,
-    0.389118,
-    0.380871,
-    0.372584,
-    0.364257,
-    0.355892,
-    0.347489,
-    0.339049,
-    0.330573,
-    0.322063,
-    0.313517,
-    0.304939,
-    0.296328,
-    0.287685,
-    0.279012,
-    0.270308,
-    0.261576,
-    0.252816,
-    0.244029,
-    0.235215,
-    0.226377,
-    0.217514,
-    0.208628,
-    0.199719,
-    0.190789,
-    0.181838,
-    0.172868,
-    0.163879,
-    0.154872,
-    0.145849,
-    0.13681,
-    0.127756,
-    0.118688,
-    0.109608,
-    0.100515,
-    0.0914123,
-    0.0822992,
-    0.0731773,
-    0.0640475,
-    0.0549107,
-    0.045768,
-    0.0366204,
-    0.0274687,
-    0.0183141,
-    0.00915757
-};
-
-// Top frequency: 44.1K * 0.1161
-constexpr static std::array<float, 4096> wt_sawtooth_0x8 =
-{
-    0,
-    -0.00416259,
-    -0.00832507,
-    -0.0124873,
-    -0.0166493,
-    -0.0208108,
-    -0.0249718,
-    -0.0291321,
-    -0.0332916,
-    -0.0374504,
-    -0.0416081,
-    -0.0457648,
-    -0.0499202,
-    -0.0540744,
-    -0.0582272,
-    -0.0623785,
-    -0.0665282,
-    -0.0706761,
-    -0.0748222,
-    -0.0789664,
-    -0.0831086,
-    -0.0872486,
-    -0.0913863,
-    -0.0955217,
-    -0.0996546,
-    -0.103785,
-    -0.107913,
-    -0.112037,
-    -0.116159,
-    -0.120278,
-    -0.124394,
-    -0.128507,
-    -0.132616,
-    -0.136722,
-    -0.140824,
-    -0.144923,
-    -0.149018,
-    -0.153109,
-    -0.157197,
-    -0.16128,
-    -0.165359,
-    -0.169434,
-    -0.173504,
-    -0.17757,
-    -0.181631,
-    -0.185688,
-    -0.18974,
-    -0.193787,
-    -0.197829,
-    -0.201866,
-    -0.205897,
-    -0.209924,
-    -0.213945,
-    -0.21796,
-    -0.22197,
-    -0.225974,
-    -0.229973,
-    -0.233965,
-    -0.237952,
-    -0.241932,
-    -0.245907,
-    -0.249875,
-    -0.253836,
-    -0.257791,
-    -0.261739,
-    -0.265681,
-    -0.269616,
-    -0.273544,
-    -0.277465,
-    -0.281379,
-    -0.285286,
-    -0.289185,
-    -0.293077,
-    -0.296962,
-    -0.300839,
-    -0.304708,
-    -0.30857,
-    -0.312423,
-    -0.316269,
-    -0.320107,
-    -0.323936,
-    -0.327758,
-    -0.331571,
-    -0.335375,
-    -0.339171,
-    -0.342959,
-    -0.346737,
-    -0.350507,
-    -0.354268,
-    -0.35802,
-    -0.361763,
-    -0.365497,
-    -0.369222,
-    -0.372937,
-    -0.376643,
-    -0.380339,
-    -0.384026,
-    -0.387703,
-    -0.39137,
-    -0.395027,
-    -0.398675,
-    -0.402312,
-    -0.405939,
-    -0.409556,
-    -0.413163,
-    -0.416759,
-    -0.420345,
-    -0.42392,
-    -0.427485,
-    -0.431039,
-    -0.434582,
-    -0.438115,
-    -0.441636,
-    -0.445146,
-    -0.448645,
-    -0.452133,
-    -0.45561,
-    -0.459075,
-    -0.462529,
-    -0.465971,
-    -0.469402,
-    -0.472821,
-    -0.476229,
-    -0.479624,
-    -0.483008,
-    -0.486379,
-    -0.489739,
-    -0.493086,
-    -0.496421,
-    -0.499744,
-    -0.503055,
-    -0.506353,
-    -0.509639,
-    -0.512912,
-    -0.516172,
-    -0.51942,
-    -0.522655,
-    -0.525877,
-    -0.529087,
-    -0.532283,
-    -0.535466,
-    -0.538636,
-    -0.541793,
-    -0.544937,
-    -0.548067,
-    -0.551184,
-    -0.554287,
-    -0.557377,
-    -0.560454,
-    -0.563517,
-    -0.566566,
-    -0.569601,
-    -0.572623,
-    -0.57563,
-    -0.578624,
-    -0.581604,
-    -0.584569,
-    -0.587521,
-    -0.590458,
-    -0.593381,
-    -0.59629,
-    -0.599184,
-    -0.602064,
-    -0.60493,
-    -0.607781,
-    -0.610618,
-    -0.61344,
-    -0.616247,
-    -0.619039,
-    -0.621817,
-    -0.62458,
-    -0.627328,
-    -0.630061,
-    -0.632779,
-    -0.635482,
-    -0.63817,
-    -0.640843,
-    -0.643501,
-    -0.646144,
-    -0.648771,
-    -0.651383,
-    -0.65398,
-    -0.656561,
-    -0.659127,
-    -0.661677,
-    -0.664212,
-    -0.666731,
-    -0.669235,
-    -0.671723,
-    -0.674195,
-    -0.676652,
-    -0.679093,
-    -0.681518,
-    -0.683927,
-    -0.686321,
-    -0.688698,
-    -0.69106,
-    -0.693406,
-    -0.695735,
-    -0.698049,
-    -0.700347,
-    -0.702628,
-    -0.704893,
-    -0.707142,
-    -0.709376,
-    -0.711592,
-    -0.713793,
-    -0.715977,
-    -0.718145,
-    -0.720297,
-    -0.722432,
-    -0.724551,
-    -0.726653,
-    -0.728739,
-    -0.730809,
-    -0.732862,
-    -0.734899,
-    -0.736919,
-    -0.738923,
-    -0.74091,
-    -0.74288,
-    -0.744834,
-    -0.746771,
-    -0.748692,
-    -0.750596,
-    -0.752483,
-    -0.754354,
-    -0.756208,
-    -0.758045,
-    -0.759866,
-    -0.761669,
-    -0.763456,
-    -0.765227,
-    -0.76698,
-    -0.768717,
-    -0.770437,
-    -0.77214,
-    -0.773826,
-    -0.775496,
-    -0.777149,
-    -0.778785,
-    -0.780404,
-    -0.782006,
-    -0.783591,
-    -0.78516,
-    -0.786711,
-    -0.788246,
-    -0.789764,
-    -0.791265,
-    -0.792749,
-    -0.794217,
-    -0.795667,
-    -0.797101,
-    -0.798518,
-    -0.799918,
-    -0.801301,
-    -0.802667,
-    -0.804016,
-    -0.805349,
-    -0.806665,
-    -0.807964,
-    -0.809246,
-    -0.810511,
-    -0.81176,
-    -0.812991,
-    -0.814206,
-    -0.815404,
-    -0.816586,
-    -0.81775,
-    -0.818898,
-    -0.820029,
-    -0.821144,
-    -0.822241,
-    -0.823323,
-    -0.824387,
-    -0.825435,
-    -0.826466,
-    -0.82748,
-    -0.828478,
-    -0.829459,
-    -0.830424,
-    -0.831372,
-    -0.832304,
-    -0.833219,
-    -0.834117,
-    -0.834999,
-    -0.835865,
-    -0.836714,
-    -0.837547,
-    -0.838364,
-    -0.839164,
-    -0.839948,
-    -0.840715,
-    -0.841466,
-    -0.842201,
-    -0.84292,
-    -0.843623,
-    -0.844309,
-    -0.844979,
-    -0.845634,
-    -0.846272,
-    -0.846894,
-    -0.8475,
-    -0.84809,
-    -0.848664,
-    -0.849222,
-    -0.849765,
-    -0.850291,
-    -0.850802,
-    -0.851297,
-    -0.851776,
-    -0.852239,
-    -0.852687,
-    -0.853119,
-    -0.853536,
-    -0.853937,
-    -0.854322,
-    -0.854692,
-    -0.855047,
-    -0.855386,
-    -0.85571,
-    -0.856019,
-    -0.856312,
-    -0.85659,
-    -0.856853,
-    -0.857101,
-    -0.857333,
-    -0.857551,
-    -0.857754,
-    -0.857941,
-    -0.858114,
-    -0.858272,
-    -0.858415,
-    -0.858543,
-    -0.858657,
-    -0.858756,
-    -0.85884,
-    -0.85891,
-    -0.858965,
-    -0.859006,
-    -0.859032,
-    -0.859044,
-    -0.859041,
-    -0.859025,
-    -0.858994,
-    -0.858949,
-    -0.85889,
-    -0.858817,
-    -0.85873,
-    -0.858628,
-    -0.858513,
-    -0.858385,
-    -0.858242,
-    -0.858086,
-    -0.857916,
-    -0.857732,
-    -0.857535,
-    -0.857325,
-    -0.857101,
-    -0.856863,
-    -0.856613,
-    -0.856349,
-    -0.856072,
-    -0.855782,
-    -0.855478,
-    -0.855162,
-    -0.854833,
-    -0.854491,
-    -0.854136,
-    -0.853768,
-    -0.853388,
-    -0.852995,
-    -0.85259,
-    -0.852172,
-    -0.851741,
-    -0.851299,
-    -0.850844,
-    -0.850376,
-    -0.849897,
-    -0.849405,
-    -0.848902,
-    -0.848386,
-    -0.847859,
-    -0.84732,
-    -0.846769,
-    -0.846206,
-    -0.845632,
-    -0.845046,
-    -0.844449,
-    -0.84384,
-    -0.84322,
-    -0.842589,
-    -0.841946,
-    -0.841293,
-    -0.840628,
-    -0.839952,
-    -0.839266,
-    -0.838568,
-    -0.83786,
-    -0.837141,
-    -0.836412,
-    -0.835672,
-    -0.834922,
-    -0.834161,
-    -0.83339,
-    -0.832608,
-    -0.831816,
-    -0.831015,
-    -0.830203,
-    -0.829381,
-    -0.82855,
-    -0.827709,
-    -0.826858,
-    -0.825997,
-    -0.825127,
-    -0.824247,
-    -0.823358,
-    -0.822459,
-    -0.821551,
-    -0.820634,
-    -0.819708,
-    -0.818773,
-    -0.817829,
-    -0.816876,
-    -0.815915,
-    -0.814944,
-    -0.813965,
-    -0.812978,
-    -0.811982,
-    -0.810977,
-    -0.809964,
-    -0.808943,
-    -0.807914,
-    -0.806877,
-    -0.805831,
-    -0.804778,
-    -0.803717,
-    -0.802648,
-    -0.801572,
-    -0.800488,
-    -0.799396,
-    -0.798297,
-    -0.797191,
-    -0.796077,
-    -0.794956,
-    -0.793828,
-    -0.792693,
-    -0.791551,
-    -0.790402,
-    -0.789246,
-    -0.788084,
-    -0.786915,
-    -0.785739,
-    -0.784557,
-    -0.783369,
-    -0.782174,
-    -0.780973,
-    -0.779766,
-    -0.778553,
-    -0.777334,
-    -0.776109,
-    -0.774878,
-    -0.773641,
-    -0.772399,
-    -0.771151,
-    -0.769898,
-    -0.768639,
-    -0.767375,
-    -0.766105,
-    -0.764831,
-    -0.763551,
-    -0.762267,
-    -0.760977,
-    -0.759683,
-    -0.758384,
-    -0.75708,
-    -0.755772,
-    -0.754459,
-    -0.753141,
-    -0.75182,
-    -0.750494,
-    -0.749163,
-    -0.747829,
-    -0.746491,
-    -0.745149,
-    -0.743803,
-    -0.742453,
-    -0.741099,
-    -0.739742,
-    -0.738381,
-    -0.737017,
-    -0.735649,
-    -0.734278,
-    -0.732904,
-    -0.731527,
-    -0.730146,
-    -0.728763,
-    -0.727377,
-    -0.725988,
-    -0.724596,
-    -0.723202,
-    -0.721804,
-    -0.720405,
-    -0.719003,
-    -0.717598,
-    -0.716192,
-    -0.714783,
-    -0.713372,
-    -0.711959,
-    -0.710544,
-    -0.709127,
-    -0.707709,
-    -0.706288,
-    -0.704866,
-    -0.703443,
-    -0.702018,
-    -0.700591,
-    -0.699163,
-    -0.697734,
-    -0.696304,
-    -0.694872,
-    -0.69344,
-    -0.692006,
-    -0.690572,
-    -0.689137,
-    -0.687701,
-    -0.686265,
-    -0.684827,
-    -0.68339,
-    -0.681952,
-    -0.680513,
-    -0.679074,
-    -0.677635,
-    -0.676196,
-    -0.674757,
-    -0.673318,
-    -0.671879,
-    -0.67044,
-    -0.669001,
-    -0.667562,
-    -0.666124,
-    -0.664686,
-    -0.663249,
-    -0.661812,
-    -0.660376,
-    -0.658941,
-    -0.657506,
-    -0.656073,
-    -0.65464,
-    -0.653208,
-    -0.651777,
-    -0.650347,
-    -0.648919,
-    -0.647492,
-    -0.646066,
-    -0.644641,
-    -0.643218,
-    -0.641796,
-    -0.640376,
-    -0.638958,
-    -0.637541,
-    -0.636127,
-    -0.634713,
-    -0.633302,
-    -0.631893,
-    -0.630486,
-    -0.629081,
-    -0.627678,
-    -0.626278,
-    -0.624879,
-    -0.623483,
-    -0.62209,
-    -0.620698,
-    -0.61931,
-    -0.617924,
-    -0.61654,
-    -0.61516,
-    -0.613782,
-    -0.612407,
-    -0.611034,
-    -0.609665,
-    -0.608299,
-    -0.606936,
-    -0.605576,
-    -0.604219,
-    -0.602865,
-    -0.601515,
-    -0.600168,
-    -0.598824,
-    -0.597484,
-    -0.596147,
-    -0.594814,
-    -0.593484,
-    -0.592158,
-    -0.590836,
-    -0.589518,
-    -0.588203,
-    -0.586892,
-    -0.585585,
-    -0.584283,
-    -0.582984,
-    -0.581689,
-    -0.580398,
-    -0.579112,
-    -0.57783,
-    -0.576552,
-    -0.575278,
-    -0.574009,
-    -0.572744,
-    -0.571484,
-    -0.570228,
-    -0.568976,
-    -0.56773,
-    -0.566487,
-    -0.56525,
-    -0.564017,
-    -0.562789,
-    -0.561566,
-    -0.560348,
-    -0.559134,
-    -0.557926,
-    -0.556722,
-    -0.555524,
-    -0.55433,
-    -0.553142,
-    -0.551959,
-    -0.550781,
-    -0.549608,
-    -0.548441,
-    -0.547278,
-    -0.546121,
-    -0.54497,
-    -0.543824,
-    -0.542683,
-    -0.541548,
-    -0.540418,
-    -0.539294,
-    -0.538175,
-    -0.537062,
-    -0.535955,
-    -0.534853,
-    -0.533757,
-    -0.532667,
-    -0.531582,
-    -0.530504,
-    -0.529431,
-    -0.528364,
-    -0.527303,
-    -0.526247,
-    -0.525198,
-    -0.524155,
-    -0.523118,
-    -0.522086,
-    -0.521061,
-    -0.520042,
-    -0.519029,
-    -0.518022,
-    -0.517021,
-    -0.516027,
-    -0.515038,
-    -0.514056,
-    -0.51308,
-    -0.512111,
-    -0.511148,
-    -0.510191,
-    -0.50924,
-    -0.508296,
-    -0.507358,
-    -0.506426,
-    -0.505501,
-    -0.504582,
-    -0.50367,
-    -0.502764,
-    -0.501865,
-    -0.500972,
-    -0.500086,
-    -0.499206,
-    -0.498333,
-    -0.497466,
-    -0.496606,
-    -0.495753,
-    -0.494906,
-    -0.494066,
-    -0.493232,
-    -0.492405,
-    -0.491585,
-    -0.490771,
-    -0.489964,
-    -0.489164,
-    -0.48837,
-    -0.487583,
-    -0.486803,
-    -0.486029,
-    -0.485263,
-    -0.484503,
-    -0.483749,
-    -0.483003,
-    -0.482263,
-    -0.48153,
-    -0.480804,
-    -0.480084,
-    -0.479371,
-    -0.478665,
-    -0.477966,
-    -0.477274,
-    -0.476588,
-    -0.475909,
-    -0.475237,
-    -0.474572,
-    -0.473913,
-    -0.473262,
-    -0.472617,
-    -0.471979,
-    -0.471347,
-    -0.470723,
-    -0.470105,
-    -0.469494,
-    -0.468889,
-    -0.468292,
-    -0.467701,
-    -0.467117,
-    -0.46654,
-    -0.46597,
-    -0.465406,
-    -0.464849,
-    -0.464299,
-    -0.463755,
-    -0.463218,
-    -0.462688,
-    -0.462165,
-    -0.461648,
-    -0.461138,
-    -0.460634,
-    -0.460138,
-    -0.459648,
-    -0.459164,
-    -0.458687,
-    -0.458217,
-    -0.457754,
-    -0.457297,
-    -0.456846,
-    -0.456402,
-    -0.455965,
-    -0.455534,
-    -0.45511,
-    -0.454692,
-    -0.454281,
-    -0.453876,
-    -0.453478,
-    -0.453086,
-    -0.452701,
-    -0.452322,
-    -0.451949,
-    -0.451583,
-    -0.451223,
-    -0.450869,
-    -0.450522,
-    -0.450181,
-    -0.449846,
-    -0.449518,
-    -0.449196,
-    -0.44888,
-    -0.44857,
-    -0.448266,
-    -0.447969,
-    -0.447677,
-    -0.447392,
-    -0.447113,
-    -0.44684,
-    -0.446573,
-    -0.446312,
-    -0.446057,
-    -0.445808,
-    -0.445564,
-    -0.445327,
-    -0.445096,
-    -0.44487,
-    -0.44465,
-    -0.444436,
-    -0.444228,
-    -0.444026,
-    -0.443829,
-    -0.443638,
-    -0.443453,
-    -0.443273,
-    -0.443099,
-    -0.442931,
-    -0.442768,
-    -0.44261,
-    -0.442458,
-    -0.442312,
-    -0.44217,
-    -0.442035,
-    -0.441904,
-    -0.441779,
-    -0.441659,
-    -0.441545,
-    -0.441436,
-    -0.441332,
-    -0.441233,
-    -0.441139,
-    -0.44105,
-    -0.440967,
-    -0.440888,
-    -0.440814,
-    -0.440746,
-    -0.440682,
-    -0.440623,
-    -0.440569,
-    -0.44052,
-    -0.440476,
-    -0.440436,
-    -0.440401,
-    -0.440371,
-    -0.440345,
-    -0.440324,
-    -0.440307,
-    -0.440295,
-    -0.440288,
-    -0.440285,
-    -0.440286,
-    -0.440292,
-    -0.440302,
-    -0.440316,
-    -0.440335,
-    -0.440357,
-    -0.440384,
-    -0.440415,
-    -0.44045,
-    -0.44049,
-    -0.440533,
-    -0.44058,
-    -0.440631,
-    -0.440686,
-    -0.440745,
-    -0.440807,
-    -0.440874,
-    -0.440944,
-    -0.441017,
-    -0.441095,
-    -0.441176,
-    -0.44126,
-    -0.441348,
-    -0.44144,
-    -0.441535,
-    -0.441633,
-    -0.441734,
-    -0.441839,
-    -0.441948,
-    -0.442059,
-    -0.442173,
-    -0.442291,
-    -0.442412,
-    -0.442535,
-    -0.442662,
-    -0.442792,
-    -0.442924,
-    -0.44306,
-    -0.443198,
-    -0.443339,
-    -0.443483,
-    -0.443629,
-    -0.443778,
-    -0.44393,
-    -0.444084,
-    -0.44424,
-    -0.444399,
-    -0.444561,
-    -0.444725,
-    -0.444891,
-    -0.445059,
-    -0.44523,
-    -0.445402,
-    -0.445577,
-    -0.445754,
-    -0.445933,
-    -0.446114,
-    -0.446297,
-    -0.446482,
-    -0.446669,
-    -0.446857,
-    -0.447048,
-    -0.44724,
-    -0.447433,
-    -0.447628,
-    -0.447825,
-    -0.448024,
-    -0.448224,
-    -0.448425,
-    -0.448628,
-    -0.448832,
-    -0.449037,
-    -0.449243,
-    -0.449451,
-    -0.44966,
-    -0.44987,
-    -0.450081,
-    -0.450294,
-    -0.450507,
-    -0.450721,
-    -0.450936,
-    -0.451151,
-    -0.451368,
-    -0.451585,
-    -0.451803,
-    -0.452022,
-    -0.452241,
-    -0.452461,
-    -0.452681,
-    -0.452902,
-    -0.453123,
-    -0.453345,
-    -0.453567,
-    -0.453789,
-    -0.454011,
-    -0.454234,
-    -0.454457,
-    -0.45468,
-    -0.454903,
-    -0.455126,
-    -0.455349,
-    -0.455571,
-    -0.455794,
-    -0.456017,
-    -0.456239,
-    -0.456461,
-    -0.456683,
-    -0.456904,
-    -0.457125,
-    -0.457346,
-    -0.457566,
-    -0.457786,
-    -0.458005,
-    -0.458223,
-    -0.458441,
-    -0.458658,
-    -0.458874,
-    -0.45909,
-    -0.459305,
-    -0.459519,
-    -0.459731,
-    -0.459943,
-    -0.460154,
-    -0.460364,
-    -0.460573,
-    -0.460781,
-    -0.460988,
-    -0.461193,
-    -0.461397,
-    -0.4616,
-    -0.461801,
-    -0.462001,
-    -0.4622,
-    -0.462397,
-    -0.462593,
-    -0.462787,
-    -0.46298,
-    -0.463171,
-    -0.46336,
-    -0.463548,
-    -0.463734,
-    -0.463918,
-    -0.4641,
-    -0.464281,
-    -0.464459,
-    -0.464636,
-    -0.46481,
-    -0.464983,
-    -0.465153,
-    -0.465322,
-    -0.465488,
-    -0.465652,
-    -0.465814,
-    -0.465974,
-    -0.466132,
-    -0.466287,
-    -0.46644,
-    -0.46659,
-    -0.466738,
-    -0.466884,
-    -0.467027,
-    -0.467167,
-    -0.467305,
-    -0.467441,
-    -0.467573,
-    -0.467703,
-    -0.467831,
-    -0.467955,
-    -0.468077,
-    -0.468196,
-    -0.468312,
-    -0.468426,
-    -0.468536,
-    -0.468644,
-    -0.468748,
-    -0.46885,
-    -0.468948,
-    -0.469044,
-    -0.469136,
-    -0.469225,
-    -0.469312,
-    -0.469395,
-    -0.469474,
-    -0.469551,
-    -0.469624,
-    -0.469694,
-    -0.46976,
-    -0.469823,
-    -0.469883,
-    -0.46994,
-    -0.469993,
-    -0.470042,
-    -0.470088,
-    -0.47013,
-    -0.470169,
-    -0.470205,
-    -0.470236,
-    -0.470264,
-    -0.470289,
-    -0.470309,
-    -0.470326,
-    -0.47034,
-    -0.470349,
-    -0.470355,
-    -0.470357,
-    -0.470355,
-    -0.470349,
-    -0.470339,
-    -0.470326,
-    -0.470308,
-    -0.470287,
-    -0.470262,
-    -0.470232,
-    -0.470199,
-    -0.470161,
-    -0.47012,
-    -0.470074,
-    -0.470025,
-    -0.469971,
-    -0.469913,
-    -0.469851,
-    -0.469785,
-    -0.469715,
-    -0.46964,
-    -0.469561,
-    -0.469478,
-    -0.469391,
-    -0.469299,
-    -0.469203,
-    -0.469103,
-    -0.468999,
-    -0.46889,
-    -0.468777,
-    -0.468659,
-    -0.468537,
-    -0.468411,
-    -0.46828,
-    -0.468145,
-    -0.468005,
-    -0.467861,
-    -0.467713,
-    -0.46756,
-    -0.467402,
-    -0.46724,
-    -0.467074,
-    -0.466903,
-    -0.466727,
-    -0.466547,
-    -0.466362,
-    -0.466173,
-    -0.465979,
-    -0.465781,
-    -0.465578,
-    -0.46537,
-    -0.465158,
-    -0.464941,
-    -0.46472,
-    -0.464494,
-    -0.464263,
-    -0.464027,
-    -0.463787,
-    -0.463543,
-    -0.463293,
-    -0.463039,
-    -0.462781,
-    -0.462517,
-    -0.462249,
-    -0.461977,
-    -0.461699,
-    -0.461417,
-    -0.46113,
-    -0.460839,
-    -0.460543,
-    -0.460242,
-    -0.459936,
-    -0.459626,
-    -0.459311,
-    -0.458991,
-    -0.458667,
-    -0.458338,
-    -0.458004,
-    -0.457665,
-    -0.457322,
-    -0.456974,
-    -0.456621,
-    -0.456264,
-    -0.455902,
-    -0.455535,
-    -0.455164,
-    -0.454787,
-    -0.454407,
-    -0.454021,
-    -0.453631,
-    -0.453236,
-    -0.452837,
-    -0.452432,
-    -0.452023,
-    -0.45161,
-    -0.451192,
-    -0.450769,
-    -0.450342,
-    -0.44991,
-    -0.449473,
-    -0.449032,
-    -0.448586,
-    -0.448135,
-    -0.44768,
-    -0.44722,
-    -0.446756,
-    -0.446287,
-    -0.445814,
-    -0.445336,
-    -0.444854,
-    -0.444367,
-    -0.443875,
-    -0.443379,
-    -0.442879,
-    -0.442374,
-    -0.441865,
-    -0.441351,
-    -0.440832,
-    -0.44031,
-    -0.439783,
-    -0.439251,
-    -0.438715,
-    -0.438175,
-    -0.43763,
-    -0.437081,
-    -0.436528,
-    -0.435971,
-    -0.435409,
-    -0.434842,
-    -0.434272,
-    -0.433697,
-    -0.433118,
-    -0.432535,
-    -0.431948,
-    -0.431356,
-    -0.430761,
-    -0.430161,
-    -0.429557,
-    -0.428949,
-    -0.428337,
-    -0.42772,
-    -0.4271,
-    -0.426476,
-    -0.425847,
-    -0.425215,
-    -0.424579,
-    -0.423939,
-    -0.423294,
-    -0.422646,
-    -0.421994,
-    -0.421338,
-    -0.420679,
-    -0.420015,
-    -0.419348,
-    -0.418677,
-    -0.418002,
-    -0.417323,
-    -0.416641,
-    -0.415955,
-    -0.415265,
-    -0.414572,
-    -0.413875,
-    -0.413174,
-    -0.41247,
-    -0.411763,
-    -0.411051,
-    -0.410337,
-    -0.409619,
-    -0.408897,
-    -0.408172,
-    -0.407444,
-    -0.406712,
-    -0.405977,
-    -0.405238,
-    -0.404496,
-    -0.403752,
-    -0.403003,
-    -0.402252,
-    -0.401497,
-    -0.40074,
-    -0.399979,
-    -0.399215,
-    -0.398448,
-    -0.397678,
-    -0.396904,
-    -0.396128,
-    -0.395349,
-    -0.394567,
-    -0.393783,
-    -0.392995,
-    -0.392204,
-    -0.391411,
-    -0.390615,
-    -0.389816,
-    -0.389014,
-    -0.38821,
-    -0.387403,
-    -0.386593,
-    -0.385781,
-    -0.384966,
-    -0.384149,
-    -0.383329,
-    -0.382507,
-    -0.381682,
-    -0.380855,
-    -0.380026,
-    -0.379194,
-    -0.37836,
-    -0.377524,
-    -0.376685,
-    -0.375844,
-    -0.375001,
-    -0.374156,
-    -0.373308,
-    -0.372459,
-    -0.371607,
-    -0.370754,
-    -0.369898,
-    -0.369041,
-    -0.368182,
-    -0.36732,
-    -0.366457,
-    -0.365592,
-    -0.364726,
-    -0.363857,
-    -0.362987,
-    -0.362115,
-    -0.361242,
-    -0.360366,
-    -0.35949,
-    -0.358611,
-    -0.357732,
-    -0.35685,
-    -0.355968,
-    -0.355084,
-    -0.354198,
-    -0.353311,
-    -0.352423,
-    -0.351534,
-    -0.350643,
-    -0.349751,
-    -0.348858,
-    -0.347964,
-    -0.347069,
-    -0.346172,
-    -0.345275,
-    -0.344377,
-    -0.343477,
-    -0.342577,
-    -0.341676,
-    -0.340774,
-    -0.339871,
-    -0.338968,
-    -0.338063,
-    -0.337158,
-    -0.336252,
-    -0.335346,
-    -0.334439,
-    -0.333531,
-    -0.332623,
-    -0.331715,
-    -0.330806,
-    -0.329896,
-    -0.328986,
-    -0.328076,
-    -0.327166,
-    -0.326255,
-    -0.325344,
-    -0.324432,
-    -0.323521,
-    -0.322609,
-    -0.321697,
-    -0.320785,
-    -0.319873,
-    -0.318962,
-    -0.31805,
-    -0.317138,
-    -0.316226,
-    -0.315314,
-    -0.314403,
-    -0.313492,
-    -0.312581,
-    -0.31167,
-    -0.31076,
-    -0.309849,
-    -0.30894,
-    -0.30803,
-    -0.307122,
-    -0.306213,
-    -0.305305,
-    -0.304398,
-    -0.303491,
-    -0.302585,
-    -0.301679,
-    -0.300775,
-    -0.29987,
-    -0.298967,
-    -0.298065,
-    -0.297163,
-    -0.296262,
-    -0.295362,
-    -0.294463,
-    -0.293564,
-    -0.292667,
-    -0.291771,
-    -0.290876,
-    -0.289982,
-    -0.289089,
-    -0.288197,
-    -0.287307,
-    -0.286417,
-    -0.285529,
-    -0.284642,
-    -0.283757,
-    -0.282872,
-    -0.281989,
-    -0.281108,
-    -0.280228,
-    -0.279349,
-    -0.278472,
-    -0.277597,
-    -0.276723,
-    -0.27585,
-    -0.27498,
-    -0.27411,
-    -0.273243,
-    -0.272377,
-    -0.271513,
-    -0.270651,
-    -0.269791,
-    -0.268932,
-    -0.268075,
-    -0.26722,
-    -0.266368,
-    -0.265517,
-    -0.264668,
-    -0.263821,
-    -0.262976,
-    -0.262133,
-    -0.261292,
-    -0.260453,
-    -0.259617,
-    -0.258782,
-    -0.25795,
-    -0.25712,
-    -0.256293,
-    -0.255467,
-    -0.254644,
-    -0.253824,
-    -0.253005,
-    -0.252189,
-    -0.251376,
-    -0.250565,
-    -0.249756,
-    -0.24895,
-    -0.248146,
-    -0.247345,
-    -0.246546,
-    -0.245751,
-    -0.244957,
-    -0.244167,
-    -0.243379,
-    -0.242593,
-    -0.241811,
-    -0.241031,
-    -0.240254,
-    -0.239479,
-    -0.238708,
-    -0.237939,
-    -0.237173,
-    -0.236411,
-    -0.235651,
-    -0.234893,
-    -0.234139,
-    -0.233388,
-    -0.23264,
-    -0.231895,
-    -0.231152,
-    -0.230413,
-    -0.229677,
-    -0.228944,
-    -0.228214,
-    -0.227487,
-    -0.226764,
-    -0.226043,
-    -0.225326,
-    -0.224612,
-    -0.223901,
-    -0.223193,
-    -0.222489,
-    -0.221788,
-    -0.22109,
-    -0.220396,
-    -0.219704,
-    -0.219017,
-    -0.218332,
-    -0.217651,
-    -0.216973,
-    -0.216299,
-    -0.215628,
-    -0.214961,
-    -0.214297,
-    -0.213636,
-    -0.212979,
-    -0.212326,
-    -0.211675,
-    -0.211029,
-    -0.210386,
-    -0.209747,
-    -0.209111,
-    -0.208478,
-    -0.20785,
-    -0.207225,
-    -0.206603,
-    -0.205985,
-    -0.205371,
-    -0.20476,
-    -0.204153,
-    -0.20355,
-    -0.20295,
-    -0.202355,
-    -0.201762,
-    -0.201174,
-    -0.200589,
-    -0.200008,
-    -0.199431,
-    -0.198857,
-    -0.198287,
-    -0.197721,
-    -0.197159,
-    -0.1966,
-    -0.196046,
-    -0.195495,
-    -0.194947,
-    -0.194404,
-    -0.193865,
-    -0.193329,
-    -0.192797,
-    -0.192269,
-    -0.191744,
-    -0.191224,
-    -0.190707,
-    -0.190195,
-    -0.189686,
-    -0.189181,
-    -0.18868,
-    -0.188182,
-    -0.187689,
-    -0.187199,
-    -0.186713,
-    -0.186231,
-    -0.185753,
-    -0.185279,
-    -0.184809,
-    -0.184343,
-    -0.18388,
-    -0.183421,
-    -0.182967,
-    -0.182516,
-    -0.182069,
-    -0.181625,
-    -0.181186,
-    -0.180751,
-    -0.180319,
-    -0.179892,
-    -0.179468,
-    -0.179048,
-    -0.178632,
-    -0.178219,
-    -0.177811,
-    -0.177407,
-    -0.177006,
-    -0.176609,
-    -0.176216,
-    -0.175827,
-    -0.175442,
-    -0.17506,
-    -0.174683,
-    -0.174309,
-    -0.173939,
-    -0.173572,
-    -0.17321,
-    -0.172851,
-    -0.172497,
-    -0.172145,
-    -0.171798,
-    -0.171455,
-    -0.171115,
-    -0.170779,
-    -0.170447,
-    -0.170118,
-    -0.169793,
-    -0.169472,
-    -0.169155,
-    -0.168841,
-    -0.168531,
-    -0.168225,
-    -0.167922,
-    -0.167623,
-    -0.167328,
-    -0.167036,
-    -0.166748,
-    -0.166463,
-    -0.166182,
-    -0.165905,
-    -0.165631,
-    -0.165361,
-    -0.165095,
-    -0.164832,
-    -0.164572,
-    -0.164316,
-    -0.164064,
-    -0.163814,
-    -0.163569,
-    -0.163327,
-    -0.163088,
-    -0.162853,
-    -0.162621,
-    -0.162393,
-    -0.162168,
-    -0.161946,
-    -0.161728,
-    -0.161513,
-    -0.161301,
-    -0.161093,
-    -0.160887,
-    -0.160686,
-    -0.160487,
-    -0.160292,
-    -0.1601,
-    -0.159911,
-    -0.159725,
-    -0.159542,
-    -0.159363,
-    -0.159187,
-    -0.159013,
-    -0.158843,
-    -0.158676,
-    -0.158512,
-    -0.158351,
-    -0.158193,
-    -0.158038,
-    -0.157886,
-    -0.157737,
-    -0.157591,
-    -0.157448,
-    -0.157308,
-    -0.15717,
-    -0.157036,
-    -0.156904,
-    -0.156775,
-    -0.156649,
-    -0.156525,
-    -0.156404,
-    -0.156286,
-    -0.156171,
-    -0.156058,
-    -0.155948,
-    -0.155841,
-    -0.155736,
-    -0.155634,
-    -0.155534,
-    -0.155437,
-    -0.155342,
-    -0.15525,
-    -0.15516,
-    -0.155073,
-    -0.154988,
-    -0.154906,
-    -0.154826,
-    -0.154748,
-    -0.154672,
-    -0.154599,
-    -0.154528,
-    -0.154459,
-    -0.154393,
-    -0.154328,
-    -0.154266,
-    -0.154206,
-    -0.154148,
-    -0.154092,
-    -0.154038,
-    -0.153986,
-    -0.153936,
-    -0.153889,
-    -0.153843,
-    -0.153799,
-    -0.153756,
-    -0.153716,
-    -0.153678,
-    -0.153641,
-    -0.153606,
-    -0.153573,
-    -0.153541,
-    -0.153511,
-    -0.153483,
-    -0.153457,
-    -0.153432,
-    -0.153409,
-    -0.153387,
-    -0.153367,
-    -0.153348,
-    -0.153331,
-    -0.153315,
-    -0.1533,
-    -0.153287,
-    -0.153276,
-    -0.153265,
-    -0.153256,
-    -0.153248,
-    -0.153242,
-    -0.153236,
-    -0.153232,
-    -0.153229,
-    -0.153227,
-    -0.153226,
-    -0.153226,
-    -0.153227,
-    -0.153229,
-    -0.153232,
-    -0.153236,
-    -0.153241,
-    -0.153247,
-    -0.153253,
-    -0.153261,
-    -0.153269,
-    -0.153278,
-    -0.153288,
-    -0.153298,
-    -0.153309,
-    -0.153321,
-    -0.153333,
-    -0.153346,
-    -0.153359,
-    -0.153373,
-    -0.153387,
-    -0.153402,
-    -0.153417,
-    -0.153433,
-    -0.153448,
-    -0.153465,
-    -0.153481,
-    -0.153498,
-    -0.153515,
-    -0.153532,
-    -0.153549,
-    -0.153567,
-    -0.153585,
-    -0.153602,
-    -0.15362,
-    -0.153638,
-    -0.153655,
-    -0.153673,
-    -0.153691,
-    -0.153708,
-    -0.153725,
-    -0.153743,
-    -0.15376,
-    -0.153776,
-    -0.153793,
-    -0.153809,
-    -0.153825,
-    -0.15384,
-    -0.153855,
-    -0.15387,
-    -0.153884,
-    -0.153898,
-    -0.153912,
-    -0.153924,
-    -0.153936,
-    -0.153948,
-    -0.153959,
-    -0.153969,
-    -0.153979,
-    -0.153988,
-    -0.153996,
-    -0.154004,
-    -0.15401,
-    -0.154016,
-    -0.154021,
-    -0.154025,
-    -0.154028,
-    -0.15403,
-    -0.154031,
-    -0.154031,
-    -0.154031,
-    -0.154029,
-    -0.154026,
-    -0.154021,
-    -0.154016,
-    -0.15401,
-    -0.154002,
-    -0.153993,
-    -0.153983,
-    -0.153971,
-    -0.153959,
-    -0.153944,
-    -0.153929,
-    -0.153912,
-    -0.153894,
-    -0.153874,
-    -0.153852,
-    -0.15383,
-    -0.153805,
-    -0.153779,
-    -0.153752,
-    -0.153723,
-    -0.153692,
-    -0.153659,
-    -0.153625,
-    -0.153589,
-    -0.153552,
-    -0.153512,
-    -0.153471,
-    -0.153428,
-    -0.153383,
-    -0.153336,
-    -0.153287,
-    -0.153237,
-    -0.153184,
-    -0.153129,
-    -0.153073,
-    -0.153014,
-    -0.152953,
-    -0.152891,
-    -0.152826,
-    -0.152759,
-    -0.152689,
-    -0.152618,
-    -0.152545,
-    -0.152469,
-    -0.152391,
-    -0.15231,
-    -0.152228,
-    -0.152143,
-    -0.152056,
-    -0.151966,
-    -0.151874,
-    -0.15178,
-    -0.151683,
-    -0.151583,
-    -0.151482,
-    -0.151377,
-    -0.151271,
-    -0.151161,
-    -0.151049,
-    -0.150935,
-    -0.150818,
-    -0.150698,
-    -0.150576,
-    -0.150451,
-    -0.150323,
-    -0.150193,
-    -0.15006,
-    -0.149924,
-    -0.149786,
-    -0.149644,
-    -0.1495,
-    -0.149353,
-    -0.149204,
-    -0.149051,
-    -0.148896,
-    -0.148737,
-    -0.148576,
-    -0.148412,
-    -0.148245,
-    -0.148075,
-    -0.147902,
-    -0.147726,
-    -0.147547,
-    -0.147365,
-    -0.14718,
-    -0.146992,
-    -0.146801,
-    -0.146607,
-    -0.146409,
-    -0.146209,
-    -0.146005,
-    -0.145799,
-    -0.145589,
-    -0.145376,
-    -0.14516,
-    -0.144941,
-    -0.144718,
-    -0.144492,
-    -0.144264,
-    -0.144031,
-    -0.143796,
-    -0.143557,
-    -0.143315,
-    -0.14307,
-    -0.142822,
-    -0.14257,
-    -0.142315,
-    -0.142056,
-    -0.141794,
-    -0.141529,
-    -0.141261,
-    -0.140989,
-    -0.140713,
-    -0.140435,
-    -0.140153,
-    -0.139867,
-    -0.139579,
-    -0.139286,
-    -0.138991,
-    -0.138691,
-    -0.138389,
-    -0.138083,
-    -0.137773,
-    -0.13746,
-    -0.137144,
-    -0.136824,
-    -0.136501,
-    -0.136174,
-    -0.135844,
-    -0.13551,
-    -0.135172,
-    -0.134832,
-    -0.134487,
-    -0.134139,
-    -0.133788,
-    -0.133433,
-    -0.133075,
-    -0.132713,
-    -0.132347,
-    -0.131978,
-    -0.131606,
-    -0.131229,
-    -0.13085,
-    -0.130467,
-    -0.13008,
-    -0.12969,
-    -0.129296,
-    -0.128898,
-    -0.128497,
-    -0.128093,
-    -0.127685,
-    -0.127273,
-    -0.126858,
-    -0.126439,
-    -0.126017,
-    -0.125591,
-    -0.125162,
-    -0.124729,
-    -0.124293,
-    -0.123853,
-    -0.123409,
-    -0.122962,
-    -0.122512,
-    -0.122058,
-    -0.1216,
-    -0.121139,
-    -0.120675,
-    -0.120206,
-    -0.119735,
-    -0.11926,
-    -0.118781,
-    -0.118299,
-    -0.117813,
-    -0.117324,
-    -0.116831,
-    -0.116335,
-    -0.115836,
-    -0.115333,
-    -0.114827,
-    -0.114317,
-    -0.113803,
-    -0.113287,
-    -0.112766,
-    -0.112243,
-    -0.111716,
-    -0.111185,
-    -0.110652,
-    -0.110115,
-    -0.109574,
-    -0.10903,
-    -0.108483,
-    -0.107932,
-    -0.107378,
-    -0.106821,
-    -0.106261,
-    -0.105697,
-    -0.10513,
-    -0.104559,
-    -0.103986,
-    -0.103409,
-    -0.102829,
-    -0.102245,
-    -0.101659,
-    -0.101069,
-    -0.100476,
-    -0.0998796,
-    -0.0992803,
-    -0.0986778,
-    -0.0980721,
-    -0.0974634,
-    -0.0968515,
-    -0.0962365,
-    -0.0956184,
-    -0.0949973,
-    -0.0943731,
-    -0.0937459,
-    -0.0931157,
-    -0.0924824,
-    -0.0918462,
-    -0.0912069,
-    -0.0905648,
-    -0.0899196,
-    -0.0892716,
-    -0.0886206,
-    -0.0879668,
-    -0.0873101,
-    -0.0866505,
-    -0.085988,
-    -0.0853228,
-    -0.0846547,
-    -0.0839839,
-    -0.0833103,
-    -0.0826339,
-    -0.0819549,
-    -0.081273,
-    -0.0805885,
-    -0.0799014,
-    -0.0792116,
-    -0.0785191,
-    -0.077824,
-    -0.0771264,
-    -0.0764261,
-    -0.0757233,
-    -0.075018,
-    -0.0743101,
-    -0.0735998,
-    -0.072887,
-    -0.0721717,
-    -0.071454,
-    -0.0707339,
-    -0.0700115,
-    -0.0692866,
-    -0.0685594,
-    -0.0678299,
-    -0.0670981,
-    -0.066364,
-    -0.0656277,
-    -0.0648891,
-    -0.0641484,
-    -0.0634054,
-    -0.0626603,
-    -0.0619131,
-    -0.0611637,
-    -0.0604123,
-    -0.0596587,
-    -0.0589032,
-    -0.0581456,
-    -0.057386,
-    -0.0566245,
-    -0.055861,
-    -0.0550956,
-    -0.0543283,
-    -0.0535592,
-    -0.0527882,
-    -0.0520153,
-    -0.0512407,
-    -0.0504643,
-    -0.0496862,
-    -0.0489063,
-    -0.0481248,
-    -0.0473416,
-    -0.0465567,
-    -0.0457703,
-    -0.0449822,
-    -0.0441926,
-    -0.0434014,
-    -0.0426088,
-    -0.0418147,
-    -0.0410191,
-    -0.040222,
-    -0.0394236,
-    -0.0386238,
-    -0.0378227,
-    -0.0370202,
-    -0.0362165,
-    -0.0354115,
-    -0.0346052,
-    -0.0337978,
-    -0.0329891,
-    -0.0321793,
-    -0.0313684,
-    -0.0305564,
-    -0.0297433,
-    -0.0289291,
-    -0.028114,
-    -0.0272978,
-    -0.0264808,
-    -0.0256627,
-    -0.0248438,
-    -0.024024,
-    -0.0232034,
-    -0.0223819,
-    -0.0215597,
-    -0.0207367,
-    -0.0199129,
-    -0.0190885,
-    -0.0182634,
-    -0.0174377,
-    -0.0166113,
-    -0.0157843,
-    -0.0149568,
-    -0.0141288,
-    -0.0133003,
-    -0.0124713,
-    -0.0116419,
-    -0.010812,
-    -0.00998179,
-    -0.00915122,
-    -0.00832031,
-    -0.00748912,
-    -0.00665766,
-    -0.00582597,
-    -0.00499407,
-    -0.00416199,
-    -0.00332977,
-    -0.00249743,
-    -0.001665,
-    -0.000832516,
-    0,
-    0.000832516,
-    0.001665,
-    0.00249743,
-    0.00332977,
-    0.00416199,
-    0.00499407,
-    0.00582597,
-    0.00665766,
-    0.00748912,
-    0.00832031,
-    0.00915122,
-    0.00998179,
-    0.010812,
-    0.0116419,
-    0.0124713,
-    0.0133003,
-    0.0141288,
-    0.0149568,
-    0.0157843,
-    0.0166113,
-    0.0174377,
-    0.0182634,
-    0.0190885,
-    0.0199129,
-    0.0207367,
-    0.0215597,
-    0.0223819,
-    0.0232034,
-    0.024024,
-    0.0248438,
-    0.0256627,
-    0.0264808,
-    0.0272978,
-    0.028114,
-    0.0289291,
-    0.0297433,
-    0.0305564,
-    0.0313684,
-    0.0321793,
-    0.0329891,
-    0.0337978,
-    0.0346052,
-    0.0354115,
-    0.0362165,
-    0.0370202,
-    0.0378227,
-    0.0386238,
-    0.0394236,
-    0.040222,
-    0.0410191,
-    0.0418147,
-    0.0426088,
-    0.0434014,
-    0.0441926,
-    0.0449822,
-    0.0457703,
-    0.0465567,
-    0.0473416,
-    0.0481248,
-    0.0489063,
-    0.0496862,
-    0.0504643,
-    0.0512407,
-    0.0520153,
-    0.0527882,
-    0.0535592,
-    0.0543283,
-    0.0550956,
-    0.055861,
-    0.0566245,
-    0.057386,
-    0.0581456,
-    0.0589032,
-    0.0596587,
-    0.0604123,
-    0.0611637,
-    0.0619131,
-    0.0626603,
-    0.0634054,
-    0.0641484,
-    0.0648891,
-    0.0656277,
-    0.066364,
-    0.0670981,
-    0.0678299,
-    0.0685594,
-    0.0692866,
-    0.0700115,
-    0.0707339,
-    0.071454,
-    0.0721717,
-    0.072887,
-    0.0735998,
-    0.0743101,
-    0.075018,
-    0.0757233,
-    0.0764261,
-    0.0771264,
-    0.077824,
-    0.0785191,
-    0.0792116,
-    0.0799014,
-    0.0805885,
-    0.081273,
-    0.0819549,
-    0.0826339,
-    0.0833103,
-    0.0839839,
-    0.0846547,
-    0.0853228,
-    0.085988,
-    0.0866505,
-    0.0873101,
-    0.0879668,
-    0.0886206,
-    0.0892716,
-    0.0899196,
-    0.0905648,
-    0.0912069,
-    0.0918462,
-    0.0924824,
-    0.0931157,
-    0.0937459,
-    0.0943731,
-    0.0949973,
-    0.0956184,
-    0.0962365,
-    0.0968515,
-    0.0974634,
-    0.0980721,
-    0.0986778,
-    0.0992803,
-    0.0998796,
-    0.100476,
-    0.101069,
-    0.101659,
-    0.102245,
-    0.102829,
-    0.103409,
-    0.103986,
-    0.104559,
-    0.10513,
-    0.105697,
-    0.106261,
-    0.106821,
-    0.107378,
-    0.107932,
-    0.108483,
-    0.10903,
-    0.109574,
-    0.110115,
-    0.110652,
-    0.111185,
-    0.111716,
-    0.112243,
-    0.112766,
-    0.113287,
-    0.113803,
-    0.114317,
-    0.114827,
-    0.115333,
-    0.115836,
-    0.116335,
-    0.116831,
-    0.117324,
-    0.117813,
-    0.118299,
-    0.118781,
-    0.11926,
-    0.119735,
-    0.120206,
-    0.120675,
-    0.121139,
-    0.1216,
-    0.122058,
-    0.122512,
-    0.122962,
-    0.123409,
-    0.123853,
-    0.124293,
-    0.124729,
-    0.125162,
-    0.125591,
-    0.126017,
-    0.126439,
-    0.126858,
-    0.127273,
-    0.127685,
-    0.128093,
-    0.128497,
-    0.128898,
-    0.129296,
-    0.12969,
-    0.13008,
-    0.130467,
-    0.13085,
-    0.131229,
-    0.131606,
-    0.131978,
-    0.132347,
-    0.132713,
-    0.133075,
-    0.133433,
-    0.133788,
-    0.134139,
-    0.134487,
-    0.134832,
-    0.135172,
-    0.13551,
-    0.135844,
-    0.136174,
-    0.136501,
-    0.136824,
-    0.137144,
-    0.13746,
-    0.137773,
-    0.138083,
-    0.138389,
-    0.138691,
-    0.138991,
-    0.139286,
-    0.139579,
-    0.139867,
-    0.140153,
-    0.140435,
-    0.140713,
-    0.140989,
-    0.141261,
-    0.141529,
-    0.141794,
-    0.142056,
-    0.142315,
-    0.14257,
-    0.142822,
-    0.14307,
-    0.143315,
-    0.143557,
-    0.143796,
-    0.144031,
-    0.144264,
-    0.144492,
-    0.144718,
-    0.144941,
-    0.14516,
-    0.145376,
-    0.145589,
-    0.145799,
-    0.146005,
-    0.146209,
-    0.146409,
-    0.146607,
-    0.146801,
-    0.146992,
-    0.14718,
-    0.147365,
-    0.147547,
-    0.147726,
-    0.147902,
-    0.148075,
-    0.148245,
-    0.148412,
-    0.148576,
-    0.148737,
-    0.148896,
-    0.149051,
-    0.149204,
-    0.149353,
-    0.1495,
-    0.149644,
-    0.149786,
-    0.149924,
-    0.15006,
-    0.150193,
-    0.150323,
-    0.150451,
-    0.150576,
-    0.150698,
-    0.150818,
-    0.150935,
-    0.151049,
-    0.151161,
-    0.151271,
-    0.151377,
-    0.151482,
-    0.151583,
-    0.151683,
-    0.15178,
-    0.151874,
-    0.151966,
-    0.152056,
-    0.152143,
-    0.152228,
-    0.15231,
-    0.152391,
-    0.152469,
-    0.152545,
-    0.152618,
-    0.152689,
-    0.152759,
-    0.152826,
-    0.152891,
-    0.152953,
-    0.153014,
-    0.153073,
-    0.153129,
-    0.153184,
-    0.153237,
-    0.153287,
-    0.153336,
-    0.153383,
-    0.153428,
-    0.153471,
-    0.153512,
-    0.153552,
-    0.153589,
-    0.153625,
-    0.153659,
-    0.153692,
-    0.153723,
-    0.153752,
-    0.153779,
-    0.153805,
-    0.15383,
-    0.153852,
-    0.153874,
-    0.153894,
-    0.153912,
-    0.153929,
-    0.153944,
-    0.153959,
-    0.153971,
-    0.153983,
-    0.153993,
-    0.154002,
-    0.15401,
-    0.154016,
-    0.154021,
-    0.154026,
-    0.154029,
-    0.154031,
-    0.154031,
-    0.154031,
-    0.15403,
-    0.154028,
-    0.154025,
-    0.154021,
-    0.154016,
-    0.15401,
-    0.154004,
-    0.153996,
-    0.153988,
-    0.153979,
-    0.153969,
-    0.153959,
-    0.153948,
-    0.153936,
-    0.153924,
-    0.153912,
-    0.153898,
-    0.153884,
-    0.15387,
-    0.153855,
-    0.15384,
-    0.153825,
-    0.153809,
-    0.153793,
-    0.153776,
-    0.15376,
-    0.153743,
-    0.153725,
-    0.153708,
-    0.153691,
-    0.153673,
-    0.153655,
-    0.153638,
-    0.15362,
-    0.153602,
-    0.153585,
-    0.153567,
-    0.153549,
-    0.153532,
-    0.153515,
-    0.153498,
-    0.153481,
-    0.153465,
-    0.153448,
-    0.153433,
-    0.153417,
-    0.153402,
-    0.153387,
-    0.153373,
-    0.153359,
-    0.153346,
-    0.153333,
-    0.153321,
-    0.153309,
-    0.153298,
-    0.153288,
-    0.153278,
-    0.153269,
-    0.153261,
-    0.153253,
-    0.153247,
-    0.153241,
-    0.153236,
-    0.153232,
-    0.153229,
-    0.153227,
-    0.153226,
-    0.153226,
-    0.153227,
-    0.153229,
-    0.153232,
-    0.153236,
-    0.153242,
-    0.153248,
-    0.153256,
-    0.153265,
-    0.153276,
-    0.153287,
-    0.1533,
-    0.153315,
-    0.153331,
-    0.153348,
-    0.153367,
-    0.153387,
-    0.153409,
-    0.153432,
-    0.153457,
-    0.153483,
-    0.153511,
-    0.153541,
-    0.153573,
-    0.153606,
-    0.153641,
-    0.153678,
-    0.153716,
-    0.153756,
-    0.153799,
-    0.153843,
-    0.153889,
-    0.153936,
-    0.153986,
-    0.154038,
-    0.154092,
-    0.154148,
-    0.154206,
-    0.154266,
-    0.154328,
-    0.154393,
-    0.154459,
-    0.154528,
-    0.154599,
-    0.154672,
-    0.154748,
-    0.154826,
-    0.154906,
-    0.154988,
-    0.155073,
-    0.15516,
-    0.15525,
-    0.155342,
-    0.155437,
-    0.155534,
-    0.155634,
-    0.155736,
-    0.155841,
-    0.155948,
-    0.156058,
-    0.156171,
-    0.156286,
-    0.156404,
-    0.156525,
-    0.156649,
-    0.156775,
-    0.156904,
-    0.157036,
-    0.15717,
-    0.157308,
-    0.157448,
-    0.157591,
-    0.157737,
-    0.157886,
-    0.158038,
-    0.158193,
-    0.158351,
-    0.158512,
-    0.158676,
-    0.158843,
-    0.159013,
-    0.159187,
-    0.159363,
-    0.159542,
-    0.159725,
-    0.159911,
-    0.1601,
-    0.160292,
-    0.160487,
-    0.160686,
-    0.160887,
-    0.161093,
-    0.161301,
-    0.161513,
-    0.161728,
-    0.161946,
-    0.162168,
-    0.162393,
-    0.162621,
-    0.162853,
-    0.163088,
-    0.163327,
-    0.163569,
-    0.163814,
-    0.164064,
-    0.164316,
-    0.164572,
-    0.164832,
-    0.165095,
-    0.165361,
-    0.165631,
-    0.165905,
-    0.166182,
-    0.166463,
-    0.166748,
-    0.167036,
-    0.167328,
-    0.167623,
-    0.167922,
-    0.168225,
-    0.168531,
-    0.168841,
-    0.169155,
-    0.169472,
-    0.169793,
-    0.170118,
-    0.170447,
-    0.170779,
-    0.171115,
-    0.171455,
-    0.171798,
-    0.172145,
-    0.172497,
-    0.172851,
-    0.17321,
-    0.173572,
-    0.173939,
-    0.174309,
-    0.174683,
-    0.17506,
-    0.175442,
-    0.175827,
-    0.176216,
-    0.176609,
-    0.177006,
-    0.177407,
-    0.177811,
-    0.178219,
-    0.178632,
-    0.179048,
-    0.179468,
-    0.179892,
-    0.180319,
-    0.180751,
-    0.181186,
-    0.181625,
-    0.182069,
-    0.182516,
-    0.182967,
-    0.183421,
-    0.18388,
-    0.184343,
-    0.184809,
-    0.185279,
-    0.185753,
-    0.186231,
-    0.186713,
-    0.187199,
-    0.187689,
-    0.188182,
-    0.18868,
-    0.189181,
-    0.189686,
-    0.190195,
-    0.190707,
-    0.191224,
-    0.191744,
-    0.192269,
-    0.192797,
-    0.193329,
-    0.193865,
-    0.194404,
-    0.194947,
-    0.195495,
-    0.196046,
-    0.1966,
-    0.197159,
-    0.197721,
-    0.198287,
-    0.198857,
-    0.199431,
-    0.200008,
-    0.200589,
-    0.201174,
-    0.201762,
-    0.202355,
-    0.20295,
-    0.20355,
-    0.204153,
-    0.20476,
-    0.205371,
-    0.205985,
-    0.206603,
-    0.207225,
-    0.20785,
-    0.208478,
-    0.209111,
-    0.209747,
-    0.210386,
-    0.211029,
-    0.211675,
-    0.212326,
-    0.212979,
-    0.213636,
-    0.214297,
-    0.214961,
-    0.215628,
-    0.216299,
-    0.216973,
-    0.217651,
-    0.218332,
-    0.219017,
-    0.219704,
-    0.220396,
-    0.22109,
-    0.221788,
-    0.222489,
-    0.223193,
-    0.223901,
-    0.224612,
-    0.225326,
-    0.226043,
-    0.226764,
-    0.227487,
-    0.228214,
-    0.228944,
-    0.229677,
-    0.230413,
-    0.231152,
-    0.231895,
-    0.23264,
-    0.233388,
-    0.234139,
-    0.234893,
-    0.235651,
-    0.236411,
-    0.237173,
-    0.237939,
-    0.238708,
-    0.239479,
-    0.240254,
-    0.241031,
-    0.241811,
-    0.242593,
-    0.243379,
-    0.244167,
-    0.244957,
-    0.245751,
-    0.246546,
-    0.247345,
-    0.248146,
-    0.24895,
-    0.249756,
-    0.250565,
-    0.251376,
-    0.252189,
-    0.253005,
-    0.253824,
-    0.254644,
-    0.255467,
-    0.256293,
-    0.25712,
-    0.25795,
-    0.258782,
-    0.259617,
-    0.260453,
-    0.261292,
-    0.262133,
-    0.262976,
-    0.263821,
-    0.264668,
-    0.265517,
-    0.266368,
-    0.26722,
-    0.268075,
-    0.268932,
-    0.269791,
-    0.270651,
-    0.271513,
-    0.272377,
-    0.273243,
-    0.27411,
-    0.27498,
-    0.27585,
-    0.276723,
-    0.277597,
-    0.278472,
-    0.279349,
-    0.280228,
-    0.281108,
-    0.281989,
-    0.282872,
-    0.283757,
-    0.284642,
-    0.285529,
-    0.286417,
-    0.287307,
-    0.288197,
-    0.289089,
-    0.289982,
-    0.290876,
-    0.291771,
-    0.292667,
-    0.293564,
-    0.294463,
-    0.295362,
-    0.296262,
-    0.297163,
-    0.298065,
-    0.298967,
-    0.29987,
-    0.300775,
-    0.301679,
-    0.302585,
-    0.303491,
-    0.304398,
-    0.305305,
-    0.306213,
-    0.307122,
-    0.30803,
-    0.30894,
-    0.309849,
-    0.31076,
-    0.31167,
-    0.312581,
-    0.313492,
-    0.314403,
-    0.315314,
-    0.316226,
-    0.317138,
-    0.31805,
-    0.318962,
-    0.319873,
-    0.320785,
-    0.321697,
-    0.322609,
-    0.323521,
-    0.324432,
-    0.325344,
-    0.326255,
-    0.327166,
-    0.328076,
-    0.328986,
-    0.329896,
-    0.330806,
-    0.331715,
-    0.332623,
-    0.333531,
-    0.334439,
-    0.335346,
-    0.336252,
-    0.337158,
-    0.338063,
-    0.338968,
-    0.339871,
-    0.340774,
-    0.341676,
-    0.342577,
-    0.343477,
-    0.344377,
-    0.345275,
-    0.346172,
-    0.347069,
-    0.347964,
-    0.348858,
-    0.349751,
-    0.350643,
-    0.351534,
-    0.352423,
-    0.353311,
-    0.354198,
-    0.355084,
-    0.355968,
-    0.35685,
-    0.357732,
-    0.358611,
-    0.35949,
-    0.360366,
-    0.361242,
-    0.362115,
-    0.362987,
-    0.363857,
-    0.364726,
-    0.365592,
-    0.366457,
-    0.36732,
-    0.368182,
-    0.369041,
-    0.369898,
-    0.370754,
-    0.371607,
-    0.372459,
-    0.373308,
-    0.374156,
-    0.375001,
-    0.375844,
-    0.376685,
-    0.377524,
-    0.37836,
-    0.379194,
-    0.380026,
-    0.380855,
-    0.381682,
-    0.382507,
-    0.383329,
-    0.384149,
-    0.384966,
-    0.385781,
-    0.386593,
-    0.387403,
-    0.38821,
-    0.389014,
-    0.389816,
-    0.390615,
-    0.391411,
-    0.392204,
-    0.392995,
-    0.393783,
-    0.394567,
-    0.395349,
-    0.396128,
-    0.396904,
-    0.397678,
-    0.398448,
-    0.399215,
-    0.399979,
-    0.40074,
-    0.401497,
-    0.402252,
-    0.403003,
-    0.403752,
-    0.404496,
-    0.405238,
-    0.405977,
-    0.406712,
-    0.407444,
-    0.408172,
-    0.408897,
-    0.409619,
-    0.410337,
-    0.411051,
-    0.411763,
-    0.41247,
-    0.413174,
-    0.413875,
-    0.414572,
-    0.415265,
-    0.415955,
-    0.416641,
-    0.417323,
-    0.418002,
-    0.418677,
-    0.419348,
-    0.420015,
-    0.420679,
-    0.421338,
-    0.421994,
-    0.422646,
-    0.423294,
-    0.423939,
-    0.424579,
-    0.425215,
-    0.425847,
-    0.426476,
-    0.4271,
-    0.42772,
-    0.428337,
-    0.428949,
-    0.429557,
-    0.430161,
-    0.430761,
-    0.431356,
-    0.431948,
-    0.432535,
-    0.433118,
-    0.433697,
-    0.434272,
-    0.434842,
-    0.435409,
-    0.435971,
-    0.436528,
-    0.437081,
-    0.43763,
-    0.438175,
-    0.438715,
-    0.439251,
-    0.439783,
-    0.44031,
-    0.440832,
-    0.441351,
-    0.441865,
-    0.442374,
-    0.442879,
-    0.443379,
-    0.443875,
-    0.444367,
-    0.444854,
-    0.445336,
-    0.445814,
-    0.446287,
-    0.446756,
-    0.44722,
-    0.44768,
-    0.448135,
-    0.448586,
-    0.449032,
-    0.449473,
-    0.44991,
-    0.450342,
-    0.450769,
-    0.451192,
-    0.45161,
-    0.452023,
-    0.452432,
-    0.452837,
-    0.453236,
-    0.453631,
-    0.454021,
-    0.454407,
-    0.454787,
-    0.455164,
-    0.455535,
-    0.455902,
-    0.456264,
-    0.456621,
-    0.456974,
-    0.457322,
-    0.457665,
-    0.458004,
-    0.458338,
-    0.458667,
-    0.458991,
-    0.459311,
-    0.459626,
-    0.459936,
-    0.460242,
-    0.460543,
-    0.460839,
-    0.46113,
-    0.461417,
-    0.461699,
-    0.461977,
-    0.462249,
-    0.462517,
-    0.462781,
-    0.463039,
-    0.463293,
-    0.463543,
-    0.463787,
-    0.464027,
-    0.464263,
-    0.464494,
-    0.46472,
-    0.464941,
-    0.465158,
-    0.46537,
-    0.465578,
-    0.465781,
-    0.465979,
-    0.466173,
-    0.466362,
-    0.466547,
-    0.466727,
-    0.466903,
-    0.467074,
-    0.46724,
-    0.467402,
-    0.46756,
-    0.467713,
-    0.467861,
-    0.468005,
-    0.468145,
-    0.46828,
-    0.468411,
-    0.468537,
-    0.468659,
-    0.468777,
-    0.46889,
-    0.468999,
-    0.469103,
-    0.469203,
-    0.469299,
-    0.469391,
-    0.469478,
-    0.469561,
-    0.46964,
-    0.469715,
-    0.469785,
-    0.469851,
-    0.469913,
-    0.469971,
-    0.470025,
-    0.470074,
-    0.47012,
-    0.470161,
-    0.470199,
-    0.470232,
-    0.470262,
-    0.470287,
-    0.470308,
-    0.470326,
-    0.470339,
-    0.470349,
-    0.470355,
-    0.470357,
-    0.470355,
-    0.470349,
-    0.47034,
-    0.470326,
-    0.470309,
-    0.470289,
-    0.470264,
-    0.470236,
-    0.470205,
-    0.470169,
-    0.47013,
-    0.470088,
-    0.470042,
-    0.469993,
-    0.46994,
-    0.469883,
-    0.469823,
-    0.46976,
-    0.469694,
-    0.469624,
-    0.469551,
-    0.469474,
-    0.469395,
-    0.469312,
-    0.469225,
-    0.469136,
-    0.469044,
-    0.468948,
-    0.46885,
-    0.468748,
-    0.468644,
-    0.468536,
-    0.468426,
-    0.468312,
-    0.468196,
-    0.468077,
-    0.467955,
-    0.467831,
-    0.467703,
-    0.467573,
-    0.467441,
-    0.467305,
-    0.467167,
-    0.467027,
-    0.466884,
-    0.466738,
-    0.46659,
-    0.46644,
-    0.466287,
-    0.466132,
-    0.465974,
-    0.465814,
-    0.465652,
-    0.465488,
-    0.465322,
-    0.465153,
-    0.464983,
-    0.46481,
-    0.464636,
-    0.464459,
-    0.464281,
-    0.4641,
-    0.463918,
-    0.463734,
-    0.463548,
-    0.46336,
-    0.463171,
-    0.46298,
-    0.462787,
-    0.462593,
-    0.462397,
-    0.4622,
-    0.462001,
-    0.461801,
-    0.4616,
-    0.461397,
-    0.461193,
-    0.460988,
-    0.460781,
-    0.460573,
-    0.460364,
-    0.460154,
-    0.459943,
-    0.459731,
-    0.459519,
-    0.459305,
-    0.45909,
-    0.458874,
-    0.458658,
-    0.458441,
-    0.458223,
-    0.458005,
-    0.457786,
-    0.457566,
-    0.457346,
-    0.457125,
-    0.456904,
-    0.456683,
-    0.456461,
-    0.456239,
-    0.456017,
-    0.455794,
-    0.455571,
-    0.455349,
-    0.455126,
-    0.454903,
-    0.45468,
-    0.454457,
-    0.454234,
-    0.454011,
-    0.453789,
-    0.453567,
-    0.453345,
-    0.453123,
-    0.452902,
-    0.452681,
-    0.452461,
-    0.452241,
-    0.452022,
-    0.451803,
-    0.451585,
-    0.451368,
-    0.451151,
-    0.450936,
-    0.450721,
-    0.450507,
-    0.450294,
-    0.450081,
-    0.44987,
-    0.44966,
-    0.449451,
-    0.449243,
-    0.449037,
-    0.448832,
-    0.448628,
-    0.448425,
-    0.448224,
-    0.448024,
-    0.447825,
-    0.447628,
-    0.447433,
-    0.44724,
-    0.447048,
-    0.446857,
-    0.446669,
-    0.446482,
-    0.446297,
-    0.446114,
-    0.445933,
-    0.445754,
-    0.445577,
-    0.445402,
-    0.44523,
-    0.445059,
-    0.444891,
-    0.444725,
-    0.444561,
-    0.444399,
-    0.44424,
-    0.444084,
-    0.44393,
-    0.443778,
-    0.443629,
-    0.443483,
-    0.443339,
-    0.443198,
-    0.44306,
-    0.442924,
-    0.442792,
-    0.442662,
-    0.442535,
-    0.442412,
-    0.442291,
-    0.442173,
-    0.442059,
-    0.441948,
-    0.441839,
-    0.441734,
-    0.441633,
-    0.441535,
-    0.44144,
-    0.441348,
-    0.44126,
-    0.441176,
-    0.441095,
-    0.441017,
-    0.440944,
-    0.440874,
-    0.440807,
-    0.440745,
-    0.440686,
-    0.440631,
-    0.44058,
-    0.440533,
-    0.44049,
-    0.44045,
-    0.440415,
-    0.440384,
-    0.440357,
-    0.440335,
-    0.440316,
-    0.440302,
-    0.440292,
-    0.440286,
-    0.440285,
-    0.440288,
-    0.440295,
-    0.440307,
-    0.440324,
-    0.440345,
-    0.440371,
-    0.440401,
-    0.440436,
-    0.440476,
-    0.44052,
-    0.440569,
-    0.440623,
-    0.440682,
-    0.440746,
-    0.440814,
-    0.440888,
-    0.440967,
-    0.44105,
-    0.441139,
-    0.441233,
-    0.441332,
-    0.441436,
-    0.441545,
-    0.441659,
-    0.441779,
-    0.441904,
-    0.442035,
-    0.44217,
-    0.442312,
-    0.442458,
-    0.44261,
-    0.442768,
-    0.442931,
-    0.443099,
-    0.443273,
-    0.443453,
-    0.443638,
-    0.443829,
-    0.444026,
-    0.444228,
-    0.444436,
-    0.44465,
-    0.44487,
-    0.445096,
-    0.445327,
-    0.445564,
-    0.445808,
-    0.446057,
-    0.446312,
-    0.446573,
-    0.44684,
-    0.447113,
-    0.447392,
-    0.447677,
-    0.447969,
-    0.448266,
-    0.44857,
-    0.44888,
-    0.449196,
-    0.449518,
-    0.449846,
-    0.450181,
-    0.450522,
-    0.450869,
-    0.451223,
-    0.451583,
-    0.451949,
-    0.452322,
-    0.452701,
-    0.453086,
-    0.453478,
-    0.453876,
-    0.454281,
-    0.454692,
-    0.45511,
-    0.455534,
-    0.455965,
-    0.456402,
-    0.456846,
-    0.457297,
-    0.457754,
-    0.458217,
-    0.458687,
-    0.459164,
-    0.459648,
-    0.460138,
-    0.460634,
-    0.461138,
-    0.461648,
-    0.462165,
-    0.462688,
-    0.463218,
-    0.463755,
-    0.464299,
-    0.464849,
-    0.465406,
-    0.46597,
-    0.46654,
-    0.467117,
-    0.467701,
-    0.468292,
-    0.468889,
-    0.469494,
-    0.470105,
-    0.470723,
-    0.471347,
-    0.471979,
-    0.472617,
-    0.473262,
-    0.473913,
-    0.474572,
-    0.475237,
-    0.475909,
-    0.476588,
-    0.477274,
-    0.477966,
-    0.478665,
-    0.479371,
-    0.480084,
-    0.480804,
-    0.48153,
-    0.482263,
-    0.483003,
-    0.483749,
-    0.484503,
-    0.485263,
-    0.486029,
-    0.486803,
-    0.487583,
-    0.48837,
-    0.489164,
-    0.489964,
-    0.490771,
-    0.491585,
-    0.492405,
-    0.493232,
-    0.494066,
-    0.494906,
-    0.495753,
-    0.496606,
-    0.497466,
-    0.498333,
-    0.499206,
-    0.500086,
-    0.500972,
-    0.501865,
-    0.502764,
-    0.50367,
-    0.504582,
-    0.505501,
-    0.506426,
-    0.507358,
-    0.508296,
-    0.50924,
-    0.510191,
-    0.511148,
-    0.512111,
-    0.51308,
-    0.514056,
-    0.515038,
-    0.516027,
-    0.517021,
-    0.518022,
-    0.519029,
-    0.520042,
-    0.521061,
-    0.522086,
-    0.523118,
-    0.524155,
-    0.525198,
-    0.526247,
-    0.527303,
-    0.528364,
-    0.529431,
-    0.530504,
-    0.531582,
-    0.532667,
-    0.533757,
-    0.534853,
-    0.535955,
-    0.537062,
-    0.538175,
-    0.539294,
-    0.540418,
-    0.541548,
-    0.542683,
-    0.543824,
-    0.54497,
-    0.546121,
-    0.547278,
-    0.548441,
-    0.549608,
-    0.550781,
-    0.551959,
-    0.553142,
-    0.55433,
-    0.555524,
-    0.556722,
-    0.557926,
-    0.559134,
-    0.560348,
-    0.561566,
-    0.562789,
-    0.564017,
-    0.56525,
-    0.566487,
-    0.56773,
-    0.568976,
-    0.570228,
-    0.571484,
-    0.572744,
-    0.574009,
-    0.575278,
-    0.576552,
-    0.57783,
-    0.579112,
-    0.580398,
-    0.581689,
-    0.582984,
-    0.584283,
-    0.585585,
-    0.586892,
-    0.588203,
-    0.589518,
-    0.590836,
-    0.592158,
-    0.593484,
-    0.594814,
-    0.596147,
-    0.597484,
-    0.598824,
-    0.600168,
-    0.601515,
-    0.602865,
-    0.604219,
-    0.605576,
-    0.606936,
-    0.608299,
-    0.609665,
-    0.611034,
-    0.612407,
-    0.613782,
-    0.61516,
-    0.61654,
-    0.617924,
-    0.61931,
-    0.620698,
-    0.62209,
-    0.623483,
-    0.624879,
-    0.626278,
-    0.627678,
-    0.629081,
-    0.630486,
-    0.631893,
-    0.633302,
-    0.634713,
-    0.636127,
-    0.637541,
-    0.638958,
-    0.640376,
-    0.641796,
-    0.643218,
-    0.644641,
-    0.646066,
-    0.647492,
-    0.648919,
-    0.650347,
-    0.651777,
-    0.653208,
-    0.65464,
-    0.656073,
-    0.657506,
-    0.658941,
-    0.660376,
-    0.661812,
-    0.663249,
-    0.664686,
-    0.666124,
-    0.667562,
-    0.669001,
-    0.67044,
-    0.671879,
-    0.673318,
-    0.674757,
-    0.676196,
-    0.677635,
-    0.679074,
-    0.680513,
-    0.681952,
-    0.68339,
-    0.684827,
-    0.686265,
-    0.687701,
-    0.689137,
-    0.690572,
-    0.692006,
-    0.69344,
-    0.694872,
-    0.696304,
-    0.697734,
-    0.699163,
-    0.700591,
-    0.702018,
-    0.703443,
-    0.704866,
-    0.706288,
-    0.707709,
-    0.709127,
-    0.710544,
-    0.711959,
-    0.713372,
-    0.714783,
-    0.716192,
-    0.717598,
-    0.719003,
-    0.720405,
-    0.721804,
-    0.723202,
-    0.724596,
-    0.725988,
-    0.727377,
-    0.728763,
-    0.730146,
-    0.731527,
-    0.732904,
-    0.734278,
-    0.735649,
-    0.737017,
-    0.738381,
-    0.739742,
-    0.741099,
-    0.742453,
-    0.743803,
-    0.745149,
-    0.746491,
-    0.747829,
-    0.749163,
-    0.750494,
-    0.75182,
-    0.753141,
-    0.754459,
-    0.755772,
-    0.75708,
-    0.758384,
-    0.759683,
-    0.760977,
-    0.762267,
-    0.763551,
-    0.764831,
-    0.766105,
-    0.767375,
-    0.768639,
-    0.769898,
-    0.771151,
-    0.772399,
-    0.773641,
-    0.774878,
-    0.776109,
-    0.777334,
-    0.778553,
-    0.779766,
-    0.780973,
-    0.782174,
-    0.783369,
-    0.784557,
-    0.785739,
-    0.786915,
-    0.788084,
-    0.789246,
-    0.790402,
-    0.791551,
-    0.792693,
-    0.793828,
-    0.794956,
-    0.796077,
-    0.797191,
-    0.798297,
-    0.799396,
-    0.800488,
-    0.801572,
-    0.802648,
-    0.803717,
-    0.804778,
-    0.805831,
-    0.806877,
-    0.807914,
-    0.808943,
-    0.809964,
-    0.810977,
-    0.811982,
-    0.812978,
-    0.813965,
-    0.814944,
-    0.815915,
-    0.816876,
-    0.817829,
-    0.818773,
-    0.819708,
-    0.820634,
-    0.821551,
-    0.822459,
-    0.823358,
-    0.824247,
-    0.825127,
-    0.825997,
-    0.826858,
-    0.827709,
-    0.82855,
-    0.829381,
-    0.830203,
-    0.831015,
-    0.831816,
-    0.832608,
-    0.83339,
-    0.834161,
-    0.834922,
-    0.835672,
-    0.836412,
-    0.837141,
-    0.83786,
-    0.838568,
-    0.839266,
-    0.839952,
-    0.840628,
-    0.841293,
-    0.841946,
-    0.842589,
-    0.84322,
-    0.84384,
-    0.844449,
-    0.845046,
-    0.845632,
-    0.846206,
-    0.846769,
-    0.84732,
-    0.847859,
-    0.848386,
-    0.848902,
-    0.849405,
-    0.849897,
-    0.850376,
-    0.850844,
-    0.851299,
-    0.851741,
-    0.852172,
-    0.85259,
-    0.852995,
-    0.853388,
-    0.853768,
-    0.854136,
-    0.854491,
-    0.854833,
-    0.855162,
-    0.855478,
-    0.855782,
-    0.856072,
-    0.856349,
-    0.856613,
-    0.856863,
-    0.857101,
-    0.857325,
-    0.857535,
-    0.857732,
-    0.857916,
-    0.858086,
-    0.858242,
-    0.858385,
-    0.858513,
-    0.858628,
-    0.85873,
-    0.858817,
-    0.85889,
-    0.858949,
-    0.858994,
-    0.859025,
-    0.859041,
-    0.859044,
-    0.859032,
-    0.859006,
-    0.858965,
-    0.85891,
-    0.85884,
-    0.858756,
-    0.858657,
-    0.858543,
-    0.858415,
-    0.858272,
-    0.858114,
-    0.857941,
-    0.857754,
-    0.857551,
-    0.857333,
-    0.857101,
-    0.856853,
-    0.85659,
-    0.856312,
-    0.856019,
-    0.85571,
-    0.855386,
-    0.855047,
-    0.854692,
-    0.854322,
-    0.853937,
-    0.853536,
-    0.853119,
-    0.852687,
-    0.852239,
-    0.851776,
-    0.851297,
-    0.850802,
-    0.850291,
-    0.849765,
-    0.849222,
-    0.848664,
-    0.84809,
-    0.8475,
-    0.846894,
-    0.846272,
-    0.845634,
-    0.844979,
-    0.844309,
-    0.843623,
-    0.84292,
-    0.842201,
-    0.841466,
-    0.840715,
-    0.839948,
-    0.839164,
-    0.838364,
-    0.837547,
-    0.836714,
-    0.835865,
-    0.834999,
-    0.834117,
-    0.833219,
-    0.832304,
-    0.831372,
-    0.830424,
-    0.829459,
-    0.828478,
-    0.82748,
-    0.826466,
-    0.825435,
-    0.824387,
-    0.823323,
-    0.822241,
-    0.821144,
-    0.820029,
-    0.818898,
-    0.81775,
-    0.816586,
-    0.815404,
-    0.814206,
-    0.812991,
-    0.81176,
-    0.810511,
-    0.809246,
-    0.807964,
-    0.806665,
-    0.805349,
-    0.804016,
-    0.802667,
-    0.801301,
-    0.799918,
-    0.798518,
-    0.797101,
-    0.795667,
-    0.794217,
-    0.792749,
-    0.791265,
-    0.789764,
-    0.788246,
-    0.786711,
-    0.78516,
-    0.783591,
-    0.782006,
-    0.780404,
-    0.778785,
-    0.777149,
-    0.775496,
-    0.773826,
-    0.77214,
-    0.770437,
-    0.768717,
-    0.76698,
-    0.765227,
-    0.763456,
-    0.761669,
-    0.759866,
-    0.758045,
-    0.756208,
-    0.754354,
-    0.752483,
-    0.750596,
-    0.748692,
-    0.746771,
-    0.744834,
-    0.74288,
-    0.74091,
-    0.738923,
-    0.736919,
-    0.734899,
-    0.732862,
-    0.730809,
-    0.728739,
-    0.726653,
-    0.724551,
-    0.722432,
-    0.720297,
-    0.718145,
-    0.715977,
-    0.713793,
-    0.711592,
-    0.709376,
-    0.707142,
-    0.704893,
-    0.702628,
-    0.700347,
-    0.698049,
-    0.695735,
-    0.693406,
-    0.69106,
-    0.688698,
-    0.686321,
-    0.683927,
-    0.681518,
-    0.679093,
-    0.676652,
-    0.674195,
-    0.671723,
-    0.669235,
-    0.666731,
-    0.664212,
-    0.661677,
-    0.659127,
-    0.656561,
-    0.65398,
-    0.651383,
-    0.648771,
-    0.646144,
-    0.643501,
-    0.640843,
-    0.63817,
-    0.635482,
-    0.632779,
-    0.630061,
-    0.627328,
-    0.62458,
-    0.621817,
-    0.619039,
-    0.616247,
-    0.61344,
-    0.610618,
-    0.607781,
-    0.60493,
-    0.602064,
-    0.599184,
-    0.59629,
-    0.593381,
-    0.590458,
-    0.587521,
-    0.584569,
-    0.581604,
-    0.578624,
-    0.57563,
-    0.572623,
-    0.569601,
-    0.566566,
-    0.563517,
-    0.560454,
-    0.557377,
-    0.554287,
-    0.551184,
-    0.548067,
-    0.544937,
-    0.541793,
-    0.538636,
-    0.535466,
-    0.532283,
-    0.529087,
-    0.525877,
-    0.522655,
-    0.51942,
-    0.516172,
-    0.512912,
-    0.509639,
-    0.506353,
-    0.503055,
-    0.499744,
-    0.496421,
-    0.493086,
-    0.489739,
-    0.486379,
-    0.483008,
-    0.479624,
-    0.476229,
-    0.472821,
-    0.469402,
-    0.465971,
-    0.462529,
-    0.459075,
-    0.45561,
-    0.452133,
-    0.448645,
-    0.445146,
-    0.441636,
-    0.438115,
-    0.434582,
-    0.431039,
-    0.427485,
-    0.42392,
-    0.420345,
-    0.416759,
-    0.413163,
-    0.409556,
-    0.405939,
-    0.402312,
-    0.398675,
-    0.395027,
-    0.39137,
-    0.387703,
-    0.384026,
-    0.380339,
-    0.376643,
-    0.372937,
-    0.369222,
-    0.365497,
-    0.361763,
-    0.35802,
-    0.354268,
-    0.350507,
-    0.346737,
-    0.342959,
-    0.339171,
-    0.335375,
-    0.331571,
-    0.327758,
-    0.323936,
-    0.320107,
-    0.316269,
-    0.312423,
-    0.30857,
-    0.304708,
-    0.300839,
-    0.296962,
-    0.293077,
-    0.289185,
-    0.285286,
-    0.281379,
-    0.277465,
-    0.273544,
-    0.269616,
-    0.265681,
-    0.261739,
-    0.257791,
-    0.253836,
-    0.249875,
-    0.245907,
-    0.241932,
-    0.237952,
-    0.233965,
-    0.229973,
-    0.225974,
-    0.22197,
-    0.21796,
-    0.213945,
-    0.209924,
-    0.205897,
-    0.201866,
-    0.197829,
-    0.193787,
-    0.18974,
-    0.185688,
-    0.181631,
-    0.17757,
-    0.173504,
-    0.169434,
-    0.165359,
-    0.16128,
-    0.157197,
-    0.153109,
-    0.149018,
-    0.144923,
-    0.140824,
-    0.136722,
-    0.132616,
-    0.128507,
-    0.124394,
-    0.120278,
-    0.116159,
-    0.112037,
-    0.107913,
-    0.103785,
-    0.0996546,
-    0.0955217,
-    0.0913863,
-    0.0872486,
-    0.0831086,
-    0.0789664,
-    0.0748222,
-    0.0706761,
-    0.0665282,
-    0.0623785,
-    0.0582272,
-    0.0540744,
-    0.0499202,
-    0.0457648,
-    0.0416081,
-    0.0374504,
-    0.0332916,
-    0.0291321,
-    0.0249718,
-    0.0208108,
-    0.0166493,
-    0.0124873,
-    0.00832507,
-    0.00416259
-};
-
-// Top frequency: 44.1K * 0.2322
-constexpr static std::array<float, 4096> wt_sawtooth_0x9 =
-{
-    0,
-    -0.00166504,
-    -0.00333007,
-    -0.00499508,
-    -0.00666006,
-    -0.00832501,
-    -0.0099899,
-    -0.0116547,
-    -0.0133195,
-    -0.0149842,
-    -0.0166488,
-    -0.0183133,
-    -0.0199777,
-    -0.021642,
-    -0.0233061,
-    -0.0249701,
-    -0.026634,
-    -0.0282977,
-    -0.0299612,
-    -0.0316246,
-    -0.0332878,
-    -0.0349508,
-    -0.0366135,
-    -0.0382761,
-    -0.0399384,
-    -0.0416006,
-    -0.0432624,
-    -0.044924,
-    -0.0465854,
-    -0.0482464,
-    -0.0499072,
-    -0.0515677,
-    -0.0532279,
-    -0.0548877,
-    -0.0565473,
-    -0.0582065,
-    -0.0598654,
-    -0.0615239,
-    -0.0631821,
-    -0.0648399,
-    -0.0664973,
-    -0.0681543,
-    -0.0698109,
-    -0.0714671,
-    -0.0731229,
-    -0.0747783,
-    -0.0764332,
-    -0.0780876,
-    -0.0797416,
-    -0.0813952,
-    -0.0830482,
-    -0.0847008,
-    -0.0863529,
-    -0.0880045,
-    -0.0896555,
-    -0.091306,
-    -0.092956,
-    -0.0946055,
-    -0.0962544,
-    -0.0979027,
-    -0.0995504,
-    -0.101198,
-    -0.102844,
-    -0.10449,
-    -0.106135,
-    -0.10778,
-    -0.109424,
-    -0.111068,
-    -0.112711,
-    -0.114353,
-    -0.115994,
-    -0.117635,
-    -0.119275,
-    -0.120914,
-    -0.122553,
-    -0.124191,
-    -0.125828,
-    -0.127465,
-    -0.1291,
-    -0.130735,
-    -0.13237,
-    -0.134003,
-    -0.135636,
-    -0.137268,
-    -0.138899,
-    -0.140529,
-    -0.142158,
-    -0.143787,
-    -0.145415,
-    -0.147042,
-    -0.148668,
-    -0.150293,
-    -0.151917,
-    -0.15354,
-    -0.155163,
-    -0.156784,
-    -0.158405,
-    -0.160025,
-    -0.161644,
-    -0.163261,
-    -0.164878,
-    -0.166494,
-    -0.168109,
-    -0.169723,
-    -0.171336,
-    -0.172948,
-    -0.174559,
-    -0.176169,
-    -0.177778,
-    -0.179385,
-    -0.180992,
-    -0.182598,
-    -0.184203,
-    -0.185806,
-    -0.187409,
-    -0.18901,
-    -0.19061,
-    -0.19221,
-    -0.193808,
-    -0.195405,
-    -0.197,
-    -0.198595,
-    -0.200188,
-    -0.201781,
-    -0.203372,
-    -0.204962,
-    -0.20655,
-    -0.208138,
-    -0.209724,
-    -0.211309,
-    -0.212893,
-    -0.214476,
-    -0.216057,
-    -0.217637,
-    -0.219216,
-    -0.220793,
-    -0.22237,
-    -0.223944,
-    -0.225518,
-    -0.22709,
-    -0.228661,
-    -0.230231,
-    -0.231799,
-    -0.233366,
-    -0.234932,
-    -0.236496,
-    -0.238059,
-    -0.23962,
-    -0.24118,
-    -0.242739,
-    -0.244296,
-    -0.245852,
-    -0.247406,
-    -0.248959,
-    -0.25051,
-    -0.25206,
-    -0.253609,
-    -0.255156,
-    -0.256702,
-    -0.258246,
-    -0.259788,
-    -0.261329,
-    -0.262869,
-    -0.264407,
-    -0.265943,
-    -0.267478,
-    -0.269011,
-    -0.270543,
-    -0.272073,
-    -0.273602,
-    -0.275129,
-    -0.276654,
-    -0.278178,
-    -0.2797,
-    -0.281221,
-    -0.28274,
-    -0.284257,
-    -0.285773,
-    -0.287286,
-    -0.288799,
-    -0.290309,
-    -0.291818,
-    -0.293326,
-    -0.294831,
-    -0.296335,
-    -0.297837,
-    -0.299337,
-    -0.300836,
-    -0.302333,
-    -0.303828,
-    -0.305321,
-    -0.306813,
-    -0.308302,
-    -0.30979,
-    -0.311277,
-    -0.312761,
-    -0.314244,
-    -0.315724,
-    -0.317203,
-    -0.31868,
-    -0.320156,
-    -0.321629,
-    -0.3231,
-    -0.32457,
-    -0.326038,
-    -0.327504,
-    -0.328968,
-    -0.33043,
-    -0.33189,
-    -0.333348,
-    -0.334804,
-    -0.336259,
-    -0.337711,
-    -0.339162,
-    -0.34061,
-    -0.342057,
-    -0.343501,
-    -0.344944,
-    -0.346384,
-    -0.347823,
-    -0.349259,
-    -0.350694,
-    -0.352127,
-    -0.353557,
-    -0.354985,
-    -0.356412,
-    -0.357836,
-    -0.359258,
-    -0.360679,
-    -0.362097,
-    -0.363513,
-    -0.364927,
-    -0.366338,
-    -0.367748,
-    -0.369156,
-    -0.370561,
-    -0.371964,
-    -0.373365,
-    -0.374765,
-    -0.376161,
-    -0.377556,
-    -0.378949,
-    -0.380339,
-    -0.381727,
-    -0.383113,
-    -0.384497,
-    -0.385878,
-    -0.387257,
-    -0.388635,
-    -0.390009,
-    -0.391382,
-    -0.392752,
-    -0.39412,
-    -0.395486,
-    -0.39685,
-    -0.398211,
-    -0.39957,
-    -0.400927,
-    -0.402281,
-    -0.403633,
-    -0.404983,
-    -0.40633,
-    -0.407675,
-    -0.409018,
-    -0.410359,
-    -0.411697,
-    -0.413032,
-    -0.414366,
-    -0.415697,
-    -0.417025,
-    -0.418351,
-    -0.419675,
-    -0.420997,
-    -0.422316,
-    -0.423632,
-    -0.424946,
-    -0.426258,
-    -0.427567,
-    -0.428874,
-    -0.430178,
-    -0.43148,
-    -0.43278,
-    -0.434077,
-    -0.435371,
-    -0.436663,
-    -0.437953,
-    -0.43924,
-    -0.440524,
-    -0.441806,
-    -0.443086,
-    -0.444363,
-    -0.445637,
-    -0.446909,
-    -0.448178,
-    -0.449445,
-    -0.450709,
-    -0.451971,
-    -0.45323,
-    -0.454487,
-    -0.45574,
-    -0.456992,
-    -0.45824,
-    -0.459487,
-    -0.46073,
-    -0.461971,
-    -0.463209,
-    -0.464445,
-    -0.465678,
-    -0.466908,
-    -0.468136,
-    -0.469361,
-    -0.470583,
-    -0.471803,
-    -0.47302,
-    -0.474234,
-    -0.475446,
-    -0.476655,
-    -0.477861,
-    -0.479065,
-    -0.480265,
-    -0.481463,
-    -0.482659,
-    -0.483851,
-    -0.485041,
-    -0.486229,
-    -0.487413,
-    -0.488595,
-    -0.489774,
-    -0.49095,
-    -0.492123,
-    -0.493294,
-    -0.494461,
-    -0.495626,
-    -0.496789,
-    -0.497948,
-    -0.499105,
-    -0.500258,
-    -0.501409,
-    -0.502557,
-    -0.503703,
-    -0.504845,
-    -0.505985,
-    -0.507122,
-    -0.508255,
-    -0.509387,
-    -0.510515,
-    -0.51164,
-    -0.512762,
-    -0.513882,
-    -0.514999,
-    -0.516113,
-    -0.517223,
-    -0.518331,
-    -0.519436,
-    -0.520539,
-    -0.521638,
-    -0.522734,
-    -0.523828,
-    -0.524918,
-    -0.526006,
-    -0.52709,
-    -0.528172,
-    -0.52925,
-    -0.530326,
-    -0.531399,
-    -0.532468,
-    -0.533535,
-    -0.534599,
-    -0.53566,
-    -0.536718,
-    -0.537772,
-    -0.538824,
-    -0.539873,
-    -0.540919,
-    -0.541962,
-    -0.543001,
-    -0.544038,
-    -0.545072,
-    -0.546102,
-    -0.54713,
-    -0.548155,
-    -0.549176,
-    -0.550195,
-    -0.55121,
-    -0.552222,
-    -0.553232,
-    -0.554238,
-    -0.555241,
-    -0.556241,
-    -0.557238,
-    -0.558232,
-    -0.559223,
-    -0.56021,
-    -0.561195,
-    -0.562176,
-    -0.563155,
-    -0.56413,
-    -0.565102,
-    -0.566071,
-    -0.567037,
-    -0.567999,
-    -0.568959,
-    -0.569915,
-    -0.570869,
-    -0.571819,
-    -0.572766,
-    -0.573709,
-    -0.57465,
-    -0.575588,
-    -0.576522,
-    -0.577453,
-    -0.578381,
-    -0.579306,
-    -0.580227,
-    -0.581145,
-    -0.582061,
-    -0.582973,
-    -0.583881,
-    -0.584787,
-    -0.585689,
-    -0.586588,
-    -0.587484,
-    -0.588377,
-    -0.589266,
-    -0.590153,
-    -0.591035,
-    -0.591915,
-    -0.592792,
-    -0.593665,
-    -0.594535,
-    -0.595402,
-    -0.596265,
-    -0.597125,
-    -0.597982,
-    -0.598836,
-    -0.599687,
-    -0.600534,
-    -0.601378,
-    -0.602218,
-    -0.603056,
-    -0.60389,
-    -0.60472,
-    -0.605548,
-    -0.606372,
-    -0.607193,
-    -0.60801,
-    -0.608825,
-    -0.609635,
-    -0.610443,
-    -0.611247,
-    -0.612048,
-    -0.612846,
-    -0.61364,
-    -0.614431,
-    -0.615219,
-    -0.616003,
-    -0.616784,
-    -0.617562,
-    -0.618336,
-    -0.619107,
-    -0.619875,
-    -0.620639,
-    -0.6214,
-    -0.622158,
-    -0.622912,
-    -0.623663,
-    -0.624411,
-    -0.625155,
-    -0.625895,
-    -0.626633,
-    -0.627367,
-    -0.628098,
-    -0.628825,
-    -0.629549,
-    -0.630269,
-    -0.630986,
-    -0.6317,
-    -0.63241,
-    -0.633117,
-    -0.633821,
-    -0.634521,
-    -0.635218,
-    -0.635911,
-    -0.636601,
-    -0.637288,
-    -0.637971,
-    -0.638651,
-    -0.639327,
-    -0.64,
-    -0.640669,
-    -0.641335,
-    -0.641998,
-    -0.642657,
-    -0.643313,
-    -0.643965,
-    -0.644614,
-    -0.64526,
-    -0.645902,
-    -0.646541,
-    -0.647176,
-    -0.647808,
-    -0.648436,
-    -0.649061,
-    -0.649682,
-    -0.6503,
-    -0.650915,
-    -0.651526,
-    -0.652134,
-    -0.652738,
-    -0.653339,
-    -0.653936,
-    -0.65453,
-    -0.65512,
-    -0.655707,
-    -0.656291,
-    -0.656871,
-    -0.657447,
-    -0.65802,
-    -0.65859,
-    -0.659156,
-    -0.659719,
-    -0.660278,
-    -0.660834,
-    -0.661386,
-    -0.661935,
-    -0.66248,
-    -0.663022,
-    -0.663561,
-    -0.664096,
-    -0.664627,
-    -0.665155,
-    -0.66568,
-    -0.666201,
-    -0.666718,
-    -0.667232,
-    -0.667743,
-    -0.66825,
-    -0.668754,
-    -0.669254,
-    -0.669751,
-    -0.670244,
-    -0.670733,
-    -0.67122,
-    -0.671702,
-    -0.672182,
-    -0.672657,
-    -0.67313,
-    -0.673598,
-    -0.674064,
-    -0.674525,
-    -0.674984,
-    -0.675438,
-    -0.67589,
-    -0.676338,
-    -0.676782,
-    -0.677223,
-    -0.67766,
-    -0.678094,
-    -0.678524,
-    -0.678951,
-    -0.679375,
-    -0.679794,
-    -0.680211,
-    -0.680624,
-    -0.681033,
-    -0.681439,
-    -0.681841,
-    -0.68224,
-    -0.682636,
-    -0.683028,
-    -0.683416,
-    -0.683801,
-    -0.684182,
-    -0.68456,
-    -0.684935,
-    -0.685306,
-    -0.685673,
-    -0.686037,
-    -0.686398,
-    -0.686755,
-    -0.687108,
-    -0.687458,
-    -0.687805,
-    -0.688148,
-    -0.688487,
-    -0.688823,
-    -0.689156,
-    -0.689485,
-    -0.689811,
-    -0.690133,
-    -0.690451,
-    -0.690767,
-    -0.691078,
-    -0.691386,
-    -0.691691,
-    -0.691992,
-    -0.69229,
-    -0.692584,
-    -0.692875,
-    -0.693162,
-    -0.693446,
-    -0.693726,
-    -0.694003,
-    -0.694277,
-    -0.694546,
-    -0.694813,
-    -0.695076,
-    -0.695335,
-    -0.695591,
-    -0.695844,
-    -0.696093,
-    -0.696338,
-    -0.696581,
-    -0.696819,
-    -0.697054,
-    -0.697286,
-    -0.697514,
-    -0.697739,
-    -0.697961,
-    -0.698179,
-    -0.698393,
-    -0.698604,
-    -0.698811,
-    -0.699016,
-    -0.699216,
-    -0.699413,
-    -0.699607,
-    -0.699797,
-    -0.699984,
-    -0.700168,
-    -0.700348,
-    -0.700524,
-    -0.700697,
-    -0.700867,
-    -0.701033,
-    -0.701196,
-    -0.701355,
-    -0.701511,
-    -0.701664,
-    -0.701813,
-    -0.701958,
-    -0.702101,
-    -0.702239,
-    -0.702375,
-    -0.702507,
-    -0.702635,
-    -0.70276,
-    -0.702882,
-    -0.703,
-    -0.703115,
-    -0.703227,
-    -0.703335,
-    -0.70344,
-    -0.703541,
-    -0.703639,
-    -0.703734,
-    -0.703825,
-    -0.703912,
-    -0.703997,
-    -0.704078,
-    -0.704155,
-    -0.70423,
-    -0.7043,
-    -0.704368,
-    -0.704432,
-    -0.704493,
-    -0.70455,
-    -0.704604,
-    -0.704655,
-    -0.704702,
-    -0.704746,
-    -0.704787,
-    -0.704824,
-    -0.704858,
-    -0.704888,
-    -0.704915,
-    -0.704939,
-    -0.70496,
-    -0.704977,
-    -0.704991,
-    -0.705001,
-    -0.705009,
-    -0.705012,
-    -0.705013,
-    -0.70501,
-    -0.705004,
-    -0.704995,
-    -0.704982,
-    -0.704966,
-    -0.704947,
-    -0.704924,
-    -0.704898,
-    -0.704869,
-    -0.704837,
-    -0.704801,
-    -0.704762,
-    -0.704719,
-    -0.704674,
-    -0.704625,
-    -0.704573,
-    -0.704517,
-    -0.704459,
-    -0.704397,
-    -0.704332,
-    -0.704263,
-    -0.704191,
-    -0.704116,
-    -0.704038,
-    -0.703957,
-    -0.703872,
-    -0.703784,
-    -0.703693,
-    -0.703599,
-    -0.703501,
-    -0.7034,
-    -0.703296,
-    -0.703189,
-    -0.703079,
-    -0.702965,
-    -0.702848,
-    -0.702728,
-    -0.702605,
-    -0.702479,
-    -0.702349,
-    -0.702216,
-    -0.70208,
-    -0.701941,
-    -0.701799,
-    -0.701653,
-    -0.701505,
-    -0.701353,
-    -0.701198,
-    -0.70104,
-    -0.700879,
-    -0.700714,
-    -0.700547,
-    -0.700376,
-    -0.700203,
-    -0.700026,
-    -0.699846,
-    -0.699663,
-    -0.699476,
-    -0.699287,
-    -0.699095,
-    -0.698899,
-    -0.6987,
-    -0.698499,
-    -0.698294,
-    -0.698086,
-    -0.697875,
-    -0.697661,
-    -0.697444,
-    -0.697224,
-    -0.697,
-    -0.696774,
-    -0.696545,
-    -0.696312,
-    -0.696077,
-    -0.695838,
-    -0.695597,
-    -0.695352,
-    -0.695105,
-    -0.694854,
-    -0.694601,
-    -0.694344,
-    -0.694084,
-    -0.693822,
-    -0.693556,
-    -0.693288,
-    -0.693016,
-    -0.692741,
-    -0.692464,
-    -0.692183,
-    -0.6919,
-    -0.691613,
-    -0.691324,
-    -0.691032,
-    -0.690736,
-    -0.690438,
-    -0.690137,
-    -0.689833,
-    -0.689526,
-    -0.689216,
-    -0.688903,
-    -0.688587,
-    -0.688269,
-    -0.687947,
-    -0.687622,
-    -0.687295,
-    -0.686965,
-    -0.686632,
-    -0.686296,
-    -0.685957,
-    -0.685615,
-    -0.68527,
-    -0.684923,
-    -0.684573,
-    -0.684219,
-    -0.683863,
-    -0.683505,
-    -0.683143,
-    -0.682778,
-    -0.682411,
-    -0.682041,
-    -0.681668,
-    -0.681292,
-    -0.680914,
-    -0.680533,
-    -0.680148,
-    -0.679762,
-    -0.679372,
-    -0.67898,
-    -0.678584,
-    -0.678186,
-    -0.677786,
-    -0.677382,
-    -0.676976,
-    -0.676567,
-    -0.676156,
-    -0.675741,
-    -0.675324,
-    -0.674904,
-    -0.674482,
-    -0.674057,
-    -0.673629,
-    -0.673198,
-    -0.672765,
-    -0.672329,
-    -0.67189,
-    -0.671449,
-    -0.671005,
-    -0.670559,
-    -0.670109,
-    -0.669658,
-    -0.669203,
-    -0.668746,
-    -0.668286,
-    -0.667824,
-    -0.667359,
-    -0.666891,
-    -0.666421,
-    -0.665948,
-    -0.665473,
-    -0.664995,
-    -0.664514,
-    -0.664031,
-    -0.663546,
-    -0.663057,
-    -0.662567,
-    -0.662073,
-    -0.661578,
-    -0.661079,
-    -0.660578,
-    -0.660075,
-    -0.659569,
-    -0.65906,
-    -0.65855,
-    -0.658036,
-    -0.65752,
-    -0.657002,
-    -0.656481,
-    -0.655958,
-    -0.655432,
-    -0.654904,
-    -0.654373,
-    -0.65384,
-    -0.653304,
-    -0.652766,
-    -0.652226,
-    -0.651683,
-    -0.651137,
-    -0.65059,
-    -0.65004,
-    -0.649487,
-    -0.648932,
-    -0.648375,
-    -0.647816,
-    -0.647254,
-    -0.646689,
-    -0.646123,
-    -0.645554,
-    -0.644982,
-    -0.644409,
-    -0.643833,
-    -0.643254,
-    -0.642674,
-    -0.642091,
-    -0.641505,
-    -0.640918,
-    -0.640328,
-    -0.639736,
-    -0.639142,
-    -0.638545,
-    -0.637946,
-    -0.637345,
-    -0.636742,
-    -0.636136,
-    -0.635528,
-    -0.634918,
-    -0.634306,
-    -0.633691,
-    -0.633075,
-    -0.632456,
-    -0.631835,
-    -0.631211,
-    -0.630586,
-    -0.629958,
-    -0.629329,
-    -0.628697,
-    -0.628063,
-    -0.627426,
-    -0.626788,
-    -0.626148,
-    -0.625505,
-    -0.62486,
-    -0.624214,
-    -0.623565,
-    -0.622914,
-    -0.622261,
-    -0.621605,
-    -0.620948,
-    -0.620289,
-    -0.619628,
-    -0.618964,
-    -0.618299,
-    -0.617631,
-    -0.616962,
-    -0.61629,
-    -0.615617,
-    -0.614941,
-    -0.614264,
-    -0.613584,
-    -0.612903,
-    -0.612219,
-    -0.611534,
-    -0.610846,
-    -0.610157,
-    -0.609466,
-    -0.608773,
-    -0.608077,
-    -0.60738,
-    -0.606681,
-    -0.60598,
-    -0.605278,
-    -0.604573,
-    -0.603866,
-    -0.603158,
-    -0.602447,
-    -0.601735,
-    -0.601021,
-    -0.600305,
-    -0.599587,
-    -0.598868,
-    -0.598146,
-    -0.597423,
-    -0.596698,
-    -0.595971,
-    -0.595242,
-    -0.594512,
-    -0.59378,
-    -0.593046,
-    -0.59231,
-    -0.591572,
-    -0.590833,
-    -0.590092,
-    -0.589349,
-    -0.588605,
-    -0.587858,
-    -0.58711,
-    -0.586361,
-    -0.585609,
-    -0.584856,
-    -0.584101,
-    -0.583345,
-    -0.582587,
-    -0.581827,
-    -0.581066,
-    -0.580302,
-    -0.579538,
-    -0.578771,
-    -0.578003,
-    -0.577234,
-    -0.576463,
-    -0.57569,
-    -0.574915,
-    -0.574139,
-    -0.573362,
-    -0.572583,
-    -0.571802,
-    -0.57102,
-    -0.570236,
-    -0.56945,
-    -0.568664,
-    -0.567875,
-    -0.567085,
-    -0.566294,
-    -0.565501,
-    -0.564706,
-    -0.56391,
-    -0.563113,
-    -0.562314,
-    -0.561514,
-    -0.560712,
-    -0.559909,
-    -0.559104,
-    -0.558298,
-    -0.55749,
-    -0.556681,
-    -0.555871,
-    -0.555059,
-    -0.554246,
-    -0.553431,
-    -0.552615,
-    -0.551798,
-    -0.550979,
-    -0.550159,
-    -0.549338,
-    -0.548515,
-    -0.547691,
-    -0.546866,
-    -0.546039,
-    -0.545211,
-    -0.544382,
-    -0.543551,
-    -0.542719,
-    -0.541886,
-    -0.541052,
-    -0.540216,
-    -0.539379,
-    -0.538541,
-    -0.537702,
-    -0.536861,
-    -0.536019,
-    -0.535176,
-    -0.534332,
-    -0.533486,
-    -0.532639,
-    -0.531792,
-    -0.530942,
-    -0.530092,
-    -0.529241,
-    -0.528388,
-    -0.527535,
-    -0.52668,
-    -0.525824,
-    -0.524967,
-    -0.524109,
-    -0.52325,
-    -0.522389,
-    -0.521528,
-    -0.520665,
-    -0.519802,
-    -0.518937,
-    -0.518071,
-    -0.517204,
-    -0.516337,
-    -0.515468,
-    -0.514598,
-    -0.513727,
-    -0.512855,
-    -0.511982,
-    -0.511108,
-    -0.510233,
-    -0.509358,
-    -0.508481,
-    -0.507603,
-    -0.506724,
-    -0.505844,
-    -0.504964,
-    -0.504082,
-    -0.5032,
-    -0.502316,
-    -0.501432,
-    -0.500547,
-    -0.499661,
-    -0.498774,
-    -0.497886,
-    -0.496997,
-    -0.496108,
-    -0.495217,
-    -0.494326,
-    -0.493434,
-    -0.492541,
-    -0.491647,
-    -0.490753,
-    -0.489857,
-    -0.488961,
-    -0.488064,
-    -0.487166,
-    -0.486268,
-    -0.485369,
-    -0.484469,
-    -0.483568,
-    -0.482666,
-    -0.481764,
-    -0.480861,
-    -0.479957,
-    -0.479053,
-    -0.478148,
-    -0.477242,
-    -0.476335,
-    -0.475428,
-    -0.474521,
-    -0.473612,
-    -0.472703,
-    -0.471793,
-    -0.470883,
-    -0.469972,
-    -0.46906,
-    -0.468148,
-    -0.467235,
-    -0.466321,
-    -0.465407,
-    -0.464492,
-    -0.463577,
-    -0.462661,
-    -0.461745,
-    -0.460828,
-    -0.45991,
-    -0.458992,
-    -0.458074,
-    -0.457155,
-    -0.456235,
-    -0.455315,
-    -0.454394,
-    -0.453473,
-    -0.452552,
-    -0.45163,
-    -0.450707,
-    -0.449784,
-    -0.448861,
-    -0.447937,
-    -0.447012,
-    -0.446088,
-    -0.445163,
-    -0.444237,
-    -0.443311,
-    -0.442385,
-    -0.441458,
-    -0.440531,
-    -0.439603,
-    -0.438675,
-    -0.437747,
-    -0.436818,
-    -0.435889,
-    -0.43496,
-    -0.43403,
-    -0.433101,
-    -0.43217,
-    -0.43124,
-    -0.430309,
-    -0.429378,
-    -0.428446,
-    -0.427515,
-    -0.426583,
-    -0.42565,
-    -0.424718,
-    -0.423785,
-    -0.422852,
-    -0.421919,
-    -0.420986,
-    -0.420052,
-    -0.419118,
-    -0.418184,
-    -0.41725,
-    -0.416315,
-    -0.415381,
-    -0.414446,
-    -0.413511,
-    -0.412576,
-    -0.411641,
-    -0.410706,
-    -0.40977,
-    -0.408834,
-    -0.407899,
-    -0.406963,
-    -0.406027,
-    -0.405091,
-    -0.404155,
-    -0.403219,
-    -0.402282,
-    -0.401346,
-    -0.40041,
-    -0.399473,
-    -0.398537,
-    -0.3976,
-    -0.396664,
-    -0.395727,
-    -0.39479,
-    -0.393854,
-    -0.392917,
-    -0.391981,
-    -0.391044,
-    -0.390108,
-    -0.389171,
-    -0.388235,
-    -0.387298,
-    -0.386362,
-    -0.385426,
-    -0.384489,
-    -0.383553,
-    -0.382617,
-    -0.381681,
-    -0.380745,
-    -0.379809,
-    -0.378874,
-    -0.377938,
-    -0.377003,
-    -0.376067,
-    -0.375132,
-    -0.374197,
-    -0.373262,
-    -0.372328,
-    -0.371393,
-    -0.370459,
-    -0.369525,
-    -0.368591,
-    -0.367657,
-    -0.366723,
-    -0.36579,
-    -0.364857,
-    -0.363924,
-    -0.362991,
-    -0.362059,
-    -0.361127,
-    -0.360195,
-    -0.359263,
-    -0.358331,
-    -0.3574,
-    -0.356469,
-    -0.355539,
-    -0.354609,
-    -0.353679,
-    -0.352749,
-    -0.35182,
-    -0.35089,
-    -0.349962,
-    -0.349033,
-    -0.348105,
-    -0.347178,
-    -0.34625,
-    -0.345323,
-    -0.344397,
-    -0.343471,
-    -0.342545,
-    -0.341619,
-    -0.340694,
-    -0.33977,
-    -0.338845,
-    -0.337922,
-    -0.336998,
-    -0.336075,
-    -0.335153,
-    -0.334231,
-    -0.333309,
-    -0.332388,
-    -0.331467,
-    -0.330547,
-    -0.329627,
-    -0.328708,
-    -0.327789,
-    -0.326871,
-    -0.325953,
-    -0.325036,
-    -0.324119,
-    -0.323203,
-    -0.322287,
-    -0.321372,
-    -0.320458,
-    -0.319544,
-    -0.31863,
-    -0.317717,
-    -0.316805,
-    -0.315893,
-    -0.314982,
-    -0.314071,
-    -0.313161,
-    -0.312252,
-    -0.311343,
-    -0.310435,
-    -0.309527,
-    -0.30862,
-    -0.307714,
-    -0.306808,
-    -0.305903,
-    -0.304999,
-    -0.304095,
-    -0.303192,
-    -0.302289,
-    -0.301388,
-    -0.300487,
-    -0.299586,
-    -0.298687,
-    -0.297788,
-    -0.296889,
-    -0.295992,
-    -0.295095,
-    -0.294199,
-    -0.293304,
-    -0.292409,
-    -0.291515,
-    -0.290622,
-    -0.28973,
-    -0.288838,
-    -0.287947,
-    -0.287057,
-    -0.286168,
-    -0.285279,
-    -0.284391,
-    -0.283505,
-    -0.282618,
-    -0.281733,
-    -0.280849,
-    -0.279965,
-    -0.279082,
-    -0.2782,
-    -0.277319,
-    -0.276439,
-    -0.275559,
-    -0.27468,
-    -0.273803,
-    -0.272926,
-    -0.27205,
-    -0.271174,
-    -0.2703,
-    -0.269427,
-    -0.268554,
-    -0.267683,
-    -0.266812,
-    -0.265942,
-    -0.265073,
-    -0.264205,
-    -0.263338,
-    -0.262472,
-    -0.261607,
-    -0.260743,
-    -0.25988,
-    -0.259017,
-    -0.258156,
-    -0.257296,
-    -0.256436,
-    -0.255578,
-    -0.25472,
-    -0.253864,
-    -0.253008,
-    -0.252154,
-    -0.2513,
-    -0.250448,
-    -0.249597,
-    -0.248746,
-    -0.247897,
-    -0.247048,
-    -0.246201,
-    -0.245355,
-    -0.244509,
-    -0.243665,
-    -0.242822,
-    -0.24198,
-    -0.241139,
-    -0.240299,
-    -0.23946,
-    -0.238622,
-    -0.237786,
-    -0.23695,
-    -0.236115,
-    -0.235282,
-    -0.23445,
-    -0.233618,
-    -0.232788,
-    -0.231959,
-    -0.231131,
-    -0.230305,
-    -0.229479,
-    -0.228655,
-    -0.227831,
-    -0.227009,
-    -0.226188,
-    -0.225368,
-    -0.224549,
-    -0.223732,
-    -0.222916,
-    -0.2221,
-    -0.221286,
-    -0.220474,
-    -0.219662,
-    -0.218851,
-    -0.218042,
-    -0.217234,
-    -0.216427,
-    -0.215622,
-    -0.214817,
-    -0.214014,
-    -0.213212,
-    -0.212411,
-    -0.211612,
-    -0.210814,
-    -0.210017,
-    -0.209221,
-    -0.208426,
-    -0.207633,
-    -0.206841,
-    -0.20605,
-    -0.205261,
-    -0.204473,
-    -0.203686,
-    -0.2029,
-    -0.202116,
-    -0.201333,
-    -0.200551,
-    -0.199771,
-    -0.198991,
-    -0.198214,
-    -0.197437,
-    -0.196662,
-    -0.195888,
-    -0.195115,
-    -0.194344,
-    -0.193574,
-    -0.192805,
-    -0.192038,
-    -0.191272,
-    -0.190508,
-    -0.189744,
-    -0.188983,
-    -0.188222,
-    -0.187463,
-    -0.186705,
-    -0.185949,
-    -0.185194,
-    -0.18444,
-    -0.183688,
-    -0.182937,
-    -0.182187,
-    -0.181439,
-    -0.180692,
-    -0.179947,
-    -0.179203,
-    -0.17846,
-    -0.177719,
-    -0.17698,
-    -0.176241,
-    -0.175504,
-    -0.174769,
-    -0.174035,
-    -0.173302,
-    -0.172571,
-    -0.171841,
-    -0.171113,
-    -0.170386,
-    -0.169661,
-    -0.168937,
-    -0.168214,
-    -0.167493,
-    -0.166774,
-    -0.166055,
-    -0.165339,
-    -0.164623,
-    -0.16391,
-    -0.163197,
-    -0.162487,
-    -0.161777,
-    -0.16107,
-    -0.160363,
-    -0.159658,
-    -0.158955,
-    -0.158253,
-    -0.157553,
-    -0.156854,
-    -0.156157,
-    -0.155461,
-    -0.154766,
-    -0.154073,
-    -0.153382,
-    -0.152692,
-    -0.152004,
-    -0.151317,
-    -0.150632,
-    -0.149948,
-    -0.149266,
-    -0.148586,
-    -0.147906,
-    -0.147229,
-    -0.146553,
-    -0.145878,
-    -0.145205,
-    -0.144534,
-    -0.143864,
-    -0.143196,
-    -0.142529,
-    -0.141864,
-    -0.141201,
-    -0.140538,
-    -0.139878,
-    -0.139219,
-    -0.138562,
-    -0.137906,
-    -0.137252,
-    -0.136599,
-    -0.135948,
-    -0.135299,
-    -0.134651,
-    -0.134005,
-    -0.13336,
-    -0.132717,
-    -0.132076,
-    -0.131436,
-    -0.130797,
-    -0.130161,
-    -0.129526,
-    -0.128892,
-    -0.12826,
-    -0.12763,
-    -0.127001,
-    -0.126374,
-    -0.125749,
-    -0.125125,
-    -0.124503,
-    -0.123882,
-    -0.123263,
-    -0.122646,
-    -0.12203,
-    -0.121416,
-    -0.120804,
-    -0.120193,
-    -0.119584,
-    -0.118976,
-    -0.11837,
-    -0.117766,
-    -0.117163,
-    -0.116562,
-    -0.115963,
-    -0.115365,
-    -0.114769,
-    -0.114174,
-    -0.113582,
-    -0.11299,
-    -0.112401,
-    -0.111813,
-    -0.111227,
-    -0.110642,
-    -0.110059,
-    -0.109478,
-    -0.108899,
-    -0.108321,
-    -0.107744,
-    -0.10717,
-    -0.106597,
-    -0.106026,
-    -0.105456,
-    -0.104888,
-    -0.104322,
-    -0.103757,
-    -0.103194,
-    -0.102633,
-    -0.102073,
-    -0.101515,
-    -0.100959,
-    -0.100405,
-    -0.0998517,
-    -0.0993005,
-    -0.0987509,
-    -0.0982031,
-    -0.0976569,
-    -0.0971124,
-    -0.0965695,
-    -0.0960284,
-    -0.0954889,
-    -0.0949511,
-    -0.094415,
-    -0.0938806,
-    -0.0933479,
-    -0.0928169,
-    -0.0922875,
-    -0.0917598,
-    -0.0912338,
-    -0.0907095,
-    -0.0901869,
-    -0.089666,
-    -0.0891468,
-    -0.0886293,
-    -0.0881134,
-    -0.0875992,
-    -0.0870868,
-    -0.086576,
-    -0.0860669,
-    -0.0855595,
-    -0.0850538,
-    -0.0845498,
-    -0.0840475,
-    -0.0835469,
-    -0.083048,
-    -0.0825508,
-    -0.0820552,
-    -0.0815614,
-    -0.0810692,
-    -0.0805788,
-    -0.08009,
-    -0.079603,
-    -0.0791176,
-    -0.0786339,
-    -0.0781519,
-    -0.0776717,
-    -0.0771931,
-    -0.0767162,
-    -0.076241,
-    -0.0757675,
-    -0.0752957,
-    -0.0748255,
-    -0.0743571,
-    -0.0738904,
-    -0.0734254,
-    -0.072962,
-    -0.0725004,
-    -0.0720404,
-    -0.0715822,
-    -0.0711256,
-    -0.0706707,
-    -0.0702175,
-    -0.0697661,
-    -0.0693163,
-    -0.0688681,
-    -0.0684217,
-    -0.067977,
-    -0.067534,
-    -0.0670926,
-    -0.0666529,
-    -0.066215,
-    -0.0657787,
-    -0.0653441,
-    -0.0649112,
-    -0.0644799,
-    -0.0640504,
-    -0.0636225,
-    -0.0631963,
-    -0.0627718,
-    -0.062349,
-    -0.0619279,
-    -0.0615085,
-    -0.0610907,
-    -0.0606746,
-    -0.0602602,
-    -0.0598474,
-    -0.0594364,
-    -0.059027,
-    -0.0586193,
-    -0.0582132,
-    -0.0578089,
-    -0.0574062,
-    -0.0570052,
-    -0.0566058,
-    -0.0562081,
-    -0.0558121,
-    -0.0554177,
-    -0.0550251,
-    -0.054634,
-    -0.0542447,
-    -0.053857,
-    -0.0534709,
-    -0.0530866,
-    -0.0527038,
-    -0.0523228,
-    -0.0519434,
-    -0.0515656,
-    -0.0511895,
-    -0.0508151,
-    -0.0504423,
-    -0.0500711,
-    -0.0497016,
-    -0.0493338,
-    -0.0489675,
-    -0.048603,
-    -0.0482401,
-    -0.0478788,
-    -0.0475191,
-    -0.0471611,
-    -0.0468047,
-    -0.04645,
-    -0.0460969,
-    -0.0457454,
-    -0.0453955,
-    -0.0450473,
-    -0.0447007,
-    -0.0443558,
-    -0.0440124,
-    -0.0436707,
-    -0.0433306,
-    -0.0429921,
-    -0.0426552,
-    -0.0423199,
-    -0.0419863,
-    -0.0416542,
-    -0.0413238,
-    -0.0409949,
-    -0.0406677,
-    -0.0403421,
-    -0.0400181,
-    -0.0396956,
-    -0.0393748,
-    -0.0390556,
-    -0.0387379,
-    -0.0384219,
-    -0.0381074,
-    -0.0377945,
-    -0.0374832,
-    -0.0371735,
-    -0.0368654,
-    -0.0365588,
-    -0.0362538,
-    -0.0359504,
-    -0.0356486,
-    -0.0353483,
-    -0.0350496,
-    -0.0347524,
-    -0.0344568,
-    -0.0341628,
-    -0.0338704,
-    -0.0335794,
-    -0.0332901,
-    -0.0330023,
-    -0.032716,
-    -0.0324313,
-    -0.0321481,
-    -0.0318665,
-    -0.0315864,
-    -0.0313078,
-    -0.0310307,
-    -0.0307552,
-    -0.0304813,
-    -0.0302088,
-    -0.0299379,
-    -0.0296685,
-    -0.0294006,
-    -0.0291342,
-    -0.0288693,
-    -0.0286059,
-    -0.0283441,
-    -0.0280837,
-    -0.0278249,
-    -0.0275675,
-    -0.0273116,
-    -0.0270573,
-    -0.0268044,
-    -0.026553,
-    -0.0263031,
-    -0.0260546,
-    -0.0258077,
-    -0.0255622,
-    -0.0253182,
-    -0.0250756,
-    -0.0248346,
-    -0.0245949,
-    -0.0243568,
-    -0.0241201,
-    -0.0238848,
-    -0.023651,
-    -0.0234187,
-    -0.0231878,
-    -0.0229583,
-    -0.0227303,
-    -0.0225037,
-    -0.0222786,
-    -0.0220548,
-    -0.0218325,
-    -0.0216116,
-    -0.0213922,
-    -0.0211741,
-    -0.0209575,
-    -0.0207423,
-    -0.0205284,
-    -0.020316,
-    -0.020105,
-    -0.0198954,
-    -0.0196871,
-    -0.0194803,
-    -0.0192748,
-    -0.0190707,
-    -0.018868,
-    -0.0186667,
-    -0.0184668,
-    -0.0182682,
-    -0.018071,
-    -0.0178751,
-    -0.0176806,
-    -0.0174874,
-    -0.0172957,
-    -0.0171052,
-    -0.0169161,
-    -0.0167283,
-    -0.0165419,
-    -0.0163568,
-    -0.016173,
-    -0.0159906,
-    -0.0158094,
-    -0.0156296,
-    -0.0154511,
-    -0.0152739,
-    -0.0150981,
-    -0.0149235,
-    -0.0147502,
-    -0.0145782,
-    -0.0144075,
-    -0.0142381,
-    -0.01407,
-    -0.0139032,
-    -0.0137376,
-    -0.0135733,
-    -0.0134103,
-    -0.0132485,
-    -0.013088,
-    -0.0129287,
-    -0.0127707,
-    -0.012614,
-    -0.0124585,
-    -0.0123042,
-    -0.0121512,
-    -0.0119994,
-    -0.0118488,
-    -0.0116994,
-    -0.0115513,
-    -0.0114044,
-    -0.0112587,
-    -0.0111142,
-    -0.0109709,
-    -0.0108288,
-    -0.0106879,
-    -0.0105482,
-    -0.0104096,
-    -0.0102723,
-    -0.0101361,
-    -0.0100011,
-    -0.00986731,
-    -0.00973465,
-    -0.00960315,
-    -0.0094728,
-    -0.00934361,
-    -0.00921556,
-    -0.00908866,
-    -0.00896289,
-    -0.00883826,
-    -0.00871476,
-    -0.00859238,
-    -0.00847113,
-    -0.00835099,
-    -0.00823196,
-    -0.00811404,
-    -0.00799722,
-    -0.00788151,
-    -0.00776688,
-    -0.00765335,
-    -0.0075409,
-    -0.00742953,
-    -0.00731924,
-    -0.00721002,
-    -0.00710186,
-    -0.00699477,
-    -0.00688874,
-    -0.00678375,
-    -0.00667982,
-    -0.00657693,
-    -0.00647508,
-    -0.00637426,
-    -0.00627448,
-    -0.00617571,
-    -0.00607797,
-    -0.00598124,
-    -0.00588553,
-    -0.00579082,
-    -0.00569711,
-    -0.0056044,
-    -0.00551268,
-    -0.00542195,
-    -0.00533219,
-    -0.00524342,
-    -0.00515562,
-    -0.00506879,
-    -0.00498292,
-    -0.004898,
-    -0.00481404,
-    -0.00473103,
-    -0.00464896,
-    -0.00456783,
-    -0.00448764,
-    -0.00440837,
-    -0.00433002,
-    -0.0042526,
-    -0.00417608,
-    -0.00410048,
-    -0.00402578,
-    -0.00395198,
-    -0.00387907,
-    -0.00380705,
-    -0.00373592,
-    -0.00366566,
-    -0.00359628,
-    -0.00352777,
-    -0.00346011,
-    -0.00339332,
-    -0.00332738,
-    -0.00326229,
-    -0.00319804,
-    -0.00313463,
-    -0.00307206,
-    -0.00301031,
-    -0.00294938,
-    -0.00288927,
-    -0.00282997,
-    -0.00277148,
-    -0.0027138,
-    -0.0026569,
-    -0.0026008,
-    -0.00254549,
-    -0.00249096,
-    -0.0024372,
-    -0.00238421,
-    -0.00233199,
-    -0.00228053,
-    -0.00222982,
-    -0.00217987,
-    -0.00213066,
-    -0.00208218,
-    -0.00203444,
-    -0.00198743,
-    -0.00194114,
-    -0.00189557,
-    -0.00185071,
-    -0.00180656,
-    -0.00176311,
-    -0.00172035,
-    -0.00167829,
-    -0.00163691,
-    -0.00159621,
-    -0.00155619,
-    -0.00151684,
-    -0.00147815,
-    -0.00144011,
-    -0.00140274,
-    -0.001366,
-    -0.00132992,
-    -0.00129446,
-    -0.00125964,
-    -0.00122545,
-    -0.00119187,
-    -0.00115891,
-    -0.00112656,
-    -0.00109481,
-    -0.00106366,
-    -0.00103311,
-    -0.00100314,
-    -0.000973753,
-    -0.000944942,
-    -0.000916702,
-    -0.000889027,
-    -0.000861912,
-    -0.000835351,
-    -0.000809338,
-    -0.000783868,
-    -0.000758936,
-    -0.000734535,
-    -0.000710661,
-    -0.000687307,
-    -0.000664467,
-    -0.000642138,
-    -0.000620312,
-    -0.000598984,
-    -0.000578149,
-    -0.0005578,
-    -0.000537933,
-    -0.000518541,
-    -0.000499619,
-    -0.000481162,
-    -0.000463163,
-    -0.000445617,
-    -0.000428519,
-    -0.000411862,
-    -0.000395641,
-    -0.00037985,
-    -0.000364483,
-    -0.000349536,
-    -0.000335002,
-    -0.000320875,
-    -0.00030715,
-    -0.000293821,
-    -0.000280882,
-    -0.000268328,
-    -0.000256152,
-    -0.00024435,
-    -0.000232915,
-    -0.000221842,
-    -0.000211125,
-    -0.000200757,
-    -0.000190735,
-    -0.00018105,
-    -0.000171699,
-    -0.000162675,
-    -0.000153972,
-    -0.000145584,
-    -0.000137507,
-    -0.000129733,
-    -0.000122258,
-    -0.000115075,
-    -0.000108178,
-    -0.000101563,
-    -9.52221e-05,
-    -8.91508e-05,
-    -8.33429e-05,
-    -7.77926e-05,
-    -7.2494e-05,
-    -6.74415e-05,
-    -6.26291e-05,
-    -5.80511e-05,
-    -5.37016e-05,
-    -4.95747e-05,
-    -4.56648e-05,
-    -4.19659e-05,
-    -3.84721e-05,
-    -3.51778e-05,
-    -3.2077e-05,
-    -2.91638e-05,
-    -2.64325e-05,
-    -2.38772e-05,
-    -2.14921e-05,
-    -1.92713e-05,
-    -1.72089e-05,
-    -1.52991e-05,
-    -1.3536e-05,
-    -1.19139e-05,
-    -1.04268e-05,
-    -9.06881e-06,
-    -7.83417e-06,
-    -6.71697e-06,
-    -5.71136e-06,
-    -4.81147e-06,
-    -4.01143e-06,
-    -3.30538e-06,
-    -2.68744e-06,
-    -2.15175e-06,
-    -1.69244e-06,
-    -1.30362e-06,
-    -9.79444e-07,
-    -7.14023e-07,
-    -5.01486e-07,
-    -3.35959e-07,
-    -2.11568e-07,
-    -1.22436e-07,
-    -6.26875e-08,
-    -2.64464e-08,
-    -7.83599e-09,
-    -9.79501e-10,
-    0,
-    9.79501e-10,
-    7.83599e-09,
-    2.64464e-08,
-    6.26875e-08,
-    1.22436e-07,
-    2.11568e-07,
-    3.35959e-07,
-    5.01486e-07,
-    7.14023e-07,
-    9.79444e-07,
-    1.30362e-06,
-    1.69244e-06,
-    2.15175e-06,
-    2.68744e-06,
-    3.30538e-06,
-    4.01143e-06,
-    4.81147e-06,
-    5.71136e-06,
-    6.71697e-06,
-    7.83417e-06,
-    9.06881e-06,
-    1.04268e-05,
-    1.19139e-05,
-    1.3536e-05,
-    1.52991e-05,
-    1.72089e-05,
-    1.92713e-05,
-    2.14921e-05,
-    2.38772e-05,
-    2.64325e-05,
-    2.91638e-05,
-    3.2077e-05,
-    3.51778e-05,
-    3.84721e-05,
-    4.19659e-05,
-    4.56648e-05,
-    4.95747e-05,
-    5.37016e-05,
-    5.80511e-05,
-    6.26291e-05,
-    6.74415e-05,
-    7.2494e-05,
-    7.77926e-05,
-    8.33429e-05,
-    8.91508e-05,
-    9.52221e-05,
-    0.000101563,
-    0.000108178,
-    0.000115075,
-    0.000122258,
-    0.000129733,
-    0.000137507,
-    0.000145584,
-    0.000153972,
-    0.000162675,
-    0.000171699,
-    0.00018105,
-    0.000190735,
-    0.000200757,
-    0.000211125,
-    0.000221842,
-    0.000232915,
-    0.00024435,
-    0.000256152,
-    0.000268328,
-    0.000280882,
-    0.000293821,
-    0.00030715,
-    0.000320875,
-    0.000335002,
-    0.000349536,
-    0.000364483,
-    0.00037985,
-    0.000395641,
-    0.000411862,
-    0.000428519,
-    0.000445617,
-    0.000463163,
-    0.000481162,
-    0.000499619,
-    0.000518541,
-    0.000537933,
-    0.0005578,
-    0.000578149,
-    0.000598984,
-    0.000620312,
-    0.000642138,
-    0.000664467,
-    0.000687307,
-    0.000710661,
-    0.000734535,
-    0.000758936,
-    0.000783868,
-    0.000809338,
-    0.000835351,
-    0.000861912,
-    0.000889027,
-    0.000916702,
-    0.000944942,
-    0.000973753,
-    0.00100314,
-    0.00103311,
-    0.00106366,
-    0.00109481,
-    0.00112656,
-    0.00115891,
-    0.00119187,
-    0.00122545,
-    0.00125964,
-    0.00129446,
-    0.00132992,
-    0.001366,
-    0.00140274,
-    0.00144011,
-    0.00147815,
-    0.00151684,
-    0.00155619,
-    0.00159621,
-    0.00163691,
-    0.00167829,
-    0.00172035,
-    0.00176311,
-    0.00180656,
-    0.00185071,
-    0.00189557,
-    0.00194114,
-    0.00198743,
-    0.00203444,
-    0.00208218,
-    0.00213066,
-    0.00217987,
-    0.00222982,
-    0.00228053,
-    0.00233199,
-    0.00238421,
-    0.0024372,
-    0.00249096,
-    0.00254549,
-    0.0026008,
-    0.0026569,
-    0.0027138,
-    0.00277148,
-    0.00282997,
-    0.00288927,
-    0.00294938,
-    0.00301031,
-    0.00307206,
-    0.00313463,
-    0.00319804,
-    0.00326229,
-    0.00332738,
-    0.00339332,
-    0.00346011,
-    0.00352777,
-    0.00359628,
-    0.00366566,
-    0.00373592,
-    0.00380705,
-    0.00387907,
-    0.00395198,
-    0.00402578,
-    0.00410048,
-    0.00417608,
-    0.0042526,
-    0.00433002,
-    0.00440837,
-    0.00448764,
-    0.00456783,
-    0.00464896,
-    0.00473103,
-    0.00481404,
-    0.004898,
-    0.00498292,
-    0.00506879,
-    0.00515562,
-    0.00524342,
-    0.00533219,
-    0.00542195,
-    0.00551268,
-    0.0056044,
-    0.00569711,
-    0.00579082,
-    0.00588553,
-    0.00598124,
-    0.00607797,
-    0.00617571,
-    0.00627448,
-    0.00637426,
-    0.00647508,
-    0.00657693,
-    0.00667982,
-    0.00678375,
-    0.00688874,
-    0.00699477,
-    0.00710186,
-    0.00721002,
-    0.00731924,
-    0.00742953,
-    0.0075409,
-    0.00765335,
-    0.00776688,
-    0.00788151,
-    0.00799722,
-    0.00811404,
-    0.00823196,
-    0.00835099,
-    0.00847113,
-    0.00859238,
-    0.00871476,
-    0.00883826,
-    0.00896289,
-    0.00908866,
-    0.00921556,
-    0.00934361,
-    0.0094728,
-    0.00960315,
-    0.00973465,
-    0.00986731,
-    0.0100011,
-    0.0101361,
-    0.0102723,
-    0.0104096,
-    0.0105482,
-    0.0106879,
-    0.0108288,
-    0.0109709,
-    0.0111142,
-    0.0112587,
-    0.0114044,
-    0.0115513,
-    0.0116994,
-    0.0118488,
-    0.0119994,
-    0.0121512,
-    0.0123042,
-    0.0124585,
-    0.012614,
-    0.0127707,
-    0.0129287,
-    0.013088,
-    0.0132485,
-    0.0134103,
-    0.0135733,
-    0.0137376,
-    0.0139032,
-    0.01407,
-    0.0142381,
-    0.0144075,
-    0.0145782,
-    0.0147502,
-    0.0149235,
-    0.0150981,
-    0.0152739,
-    0.0154511,
-    0.0156296,
-    0.0158094,
-    0.0159906,
-    0.016173,
-    0.0163568,
-    0.0165419,
-    0.0167283,
-    0.0169161,
-    0.0171052,
-    0.0172957,
-    0.0174874,
-    0.0176806,
-    0.0178751,
-    0.018071,
-    0.0182682,
-    0.0184668,
-    0.0186667,
-    0.018868,
-    0.0190707,
-    0.0192748,
-    0.0194803,
-    0.0196871,
-    0.0198954,
-    0.020105,
-    0.020316,
-    0.0205284,
-    0.0207423,
-    0.0209575,
-    0.0211741,
-    0.0213922,
-    0.0216116,
-    0.0218325,
-    0.0220548,
-    0.0222786,
-    0.0225037,
-    0.0227303,
-    0.0229583,
-    0.0231878,
-    0.0234187,
-    0.023651,
-    0.0238848,
-    0.0241201,
-    0.0243568,
-    0.0245949,
-    0.0248346,
-    0.0250756,
-    0.0253182,
-    0.0255622,
-    0.0258077,
-    0.0260546,
-    0.0263031,
-    0.026553,
-    0.0268044,
-    0.0270573,
-    0.0273116,
-    0.0275675,
-    0.0278249,
-    0.0280837,
-    0.0283441,
-    0.0286059,
-    0.0288693,
-    0.0291342,
-    0.0294006,
-    0.0296685,
-    0.0299379,
-    0.0302088,
-    0.0304813,
-    0.0307552,
-    0.0310307,
-    0.0313078,
-    0.0315864,
-    0.0318665,
-    0.0321481,
-    0.0324313,
-    0.032716,
-    0.0330023,
-    0.0332901,
-    0.0335794,
-    0.0338704,
-    0.0341628,
-    0.0344568,
-    0.0347524,
-    0.0350496,
-    0.0353483,
-    0.0356486,
-    0.0359504,
-    0.0362538,
-    0.0365588,
-    0.0368654,
-    0.0371735,
-    0.0374832,
-    0.0377945,
-    0.0381074,
-    0.0384219,
-    0.0387379,
-    0.0390556,
-    0.0393748,
-    0.0396956,
-    0.0400181,
-    0.0403421,
-    0.0406677,
-    0.0409949,
-    0.0413238,
-    0.0416542,
-    0.0419863,
-    0.0423199,
-    0.0426552,
-    0.0429921,
-    0.0433306,
-    0.0436707,
-    0.0440124,
-    0.0443558,
-    0.0447007,
-    0.0450473,
-    0.0453955,
-    0.0457454,
-    0.0460969,
-    0.04645,
-    0.0468047,
-    0.0471611,
-    0.0475191,
-    0.0478788,
-    0.0482401,
-    0.048603,
-    0.0489675,
-    0.0493338,
-    0.0497016,
-    0.0500711,
-    0.0504423,
-    0.0508151,
-    0.0511895,
-    0.0515656,
-    0.0519434,
-    0.0523228,
-    0.0527038,
-    0.0530866,
-    0.0534709,
-    0.053857,
-    0.0542447,
-    0.054634,
-    0.0550251,
-    0.0554177,
-    0.0558121,
-    0.0562081,
-    0.0566058,
-    0.0570052,
-    0.0574062,
-    0.0578089,
-    0.0582132,
-    0.0586193,
-    0.059027,
-    0.0594364,
-    0.0598474,
-    0.0602602,
-    0.0606746,
-    0.0610907,
-    0.0615085,
-    0.0619279,
-    0.062349,
-    0.0627718,
-    0.0631963,
-    0.0636225,
-    0.0640504,
-    0.0644799,
-    0.0649112,
-    0.0653441,
-    0.0657787,
-    0.066215,
-    0.0666529,
-    0.0670926,
-    0.067534,
-    0.067977,
-    0.0684217,
-    0.0688681,
-    0.0693163,
-    0.0697661,
-    0.0702175,
-    0.0706707,
-    0.0711256,
-    0.0715822,
-    0.0720404,
-    0.0725004,
-    0.072962,
-    0.0734254,
-    0.0738904,
-    0.0743571,
-    0.0748255,
-    0.0752957,
-    0.0757675,
-    0.076241,
-    0.0767162,
-    0.0771931,
-    0.0776717,
-    0.0781519,
-    0.0786339,
-    0.0791176,
-    0.079603,
-    0.08009,
-    0.0805788,
-    0.0810692,
-    0.0815614,
-    0.0820552,
-    0.0825508,
-    0.083048,
-    0.0835469,
-    0.0840475,
-    0.0845498,
-    0.0850538,
-    0.0855595,
-    0.0860669,
-    0.086576,
-    0.0870868,
-    0.0875992,
-    0.0881134,
-    0.0886293,
-    0.0891468,
-    0.089666,
-    0.0901869,
-    0.0907095,
-    0.0912338,
-    0.0917598,
-    0.0922875,
-    0.0928169,
-    0.0933479,
-    0.0938806,
-    0.094415,
-    0.0949511,
-    0.0954889,
-    0.0960284,
-    0.0965695,
-    0.0971124,
-    0.0976569,
-    0.0982031,
-    0.0987509,
-    0.0993005,
-    0.0998517,
-    0.100405,
-    0.100959,
-    0.101515,
-    0.102073,
-    0.102633,
-    0.103194,
-    0.103757,
-    0.104322,
-    0.104888,
-    0.105456,
-    0.106026,
-    0.106597,
-    0.10717,
-    0.107744,
-    0.108321,
-    0.108899,
-    0.109478,
-    0.110059,
-    0.110642,
-    0.111227,
-    0.111813,
-    0.112401,
-    0.11299,
-    0.113582,
-    0.114174,
-    0.114769,
-    0.115365,
-    0.115963,
-    0.116562,
-    0.117163,
-    0.117766,
-    0.11837,
-    0.118976,
-    0.119584,
-    0.120193,
-    0.120804,
-    0.121416,
-    0.12203,
-    0.122646,
-    0.123263,
-    0.123882,
-    0.124503,
-    0.125125,
-    0.125749,
-    0.126374,
-    0.127001,
-    0.12763,
-    0.12826,
-    0.128892,
-    0.129526,
-    0.130161,
-    0.130797,
-    0.131436,
-    0.132076,
-    0.132717,
-    0.13336,
-    0.134005,
-    0.134651,
-    0.135299,
-    0.135948,
-    0.136599,
-    0.137252,
-    0.137906,
-    0.138562,
-    0.139219,
-    0.139878,
-    0.140538,
-    0.141201,
-    0.141864,
-    0.142529,
-    0.143196,
-    0.143864,
-    0.144534,
-    0.145205,
-    0.145878,
-    0.146553,
-    0.147229,
-    0.147906,
-    0.148586,
-    0.149266,
-    0.149948,
-    0.150632,
-    0.151317,
-    0.152004,
-    0.152692,
-    0.153382,
-    0.154073,
-    0.154766,
-    0.155461,
-    0.156157,
-    0.156854,
-    0.157553,
-    0.158253,
-    0.158955,
-    0.159658,
-    0.160363,
-    0.16107,
-    0.161777,
-    0.162487,
-    0.163197,
-    0.16391,
-    0.164623,
-    0.165339,
-    0.166055,
-    0.166774,
-    0.167493,
-    0.168214,
-    0.168937,
-    0.169661,
-    0.170386,
-    0.171113,
-    0.171841,
-    0.172571,
-    0.173302,
-    0.174035,
-    0.174769,
-    0.175504,
-    0.176241,
-    0.17698,
-    0.177719,
-    0.17846,
-    0.179203,
-    0.179947,
-    0.180692,
-    0.181439,
-    0.182187,
-    0.182937,
-    0.183688,
-    0.18444,
-    0.185194,
-    0.185949,
-    0.186705,
-    0.187463,
-    0.188222,
-    0.188983,
-    0.189744,
-    0.190508,
-    0.191272,
-    0.192038,
-    0.192805,
-    0.193574,
-    0.194344,
-    0.195115,
-    0.195888,
-    0.196662,
-    0.197437,
-    0.198214,
-    0.198991,
-    0.199771,
-    0.200551,
-    0.201333,
-    0.202116,
-    0.2029,
-    0.203686,
-    0.204473,
-    0.205261,
-    0.20605,
-    0.206841,
-    0.207633,
-    0.208426,
-    0.209221,
-    0.210017,
-    0.210814,
-    0.211612,
-    0.212411,
-    0.213212,
-    0.214014,
-    0.214817,
-    0.215622,
-    0.216427,
-    0.217234,
-    0.218042,
-    0.218851,
-    0.219662,
-    0.220474,
-    0.221286,
-    0.2221,
-    0.222916,
-    0.223732,
-    0.224549,
-    0.225368,
-    0.226188,
-    0.227009,
-    0.227831,
-    0.228655,
-    0.229479,
-    0.230305,
-    0.231131,
-    0.231959,
-    0.232788,
-    0.233618,
-    0.23445,
-    0.235282,
-    0.236115,
-    0.23695,
-    0.237786,
-    0.238622,
-    0.23946,
-    0.240299,
-    0.241139,
-    0.24198,
-    0.242822,
-    0.243665,
-    0.244509,
-    0.245355,
-    0.246201,
-    0.247048,
-    0.247897,
-    0.248746,
-    0.249597,
-    0.250448,
-    0.2513,
-    0.252154,
-    0.253008,
-    0.253864,
-    0.25472,
-    0.255578,
-    0.256436,
-    0.257296,
-    0.258156,
-    0.259017,
-    0.25988,
-    0.260743,
-    0.261607,
-    0.262472,
-    0.263338,
-    0.264205,
-    0.265073,
-    0.265942,
-    0.266812,
-    0.267683,
-    0.268554,
-    0.269427,
-    0.2703,
-    0.271174,
-    0.27205,
-    0.272926,
-    0.273803,
-    0.27468,
-    0.275559,
-    0.276439,
-    0.277319,
-    0.2782,
-    0.279082,
-    0.279965,
-    0.280849,
-    0.281733,
-    0.282618,
-    0.283505,
-    0.284391,
-    0.285279,
-    0.286168,
-    0.287057,
-    0.287947,
-    0.288838,
-    0.28973,
-    0.290622,
-    0.291515,
-    0.292409,
-    0.293304,
-    0.294199,
-    0.295095,
-    0.295992,
-    0.296889,
-    0.297788,
-    0.298687,
-    0.299586,
-    0.300487,
-    0.301388,
-    0.302289,
-    0.303192,
-    0.304095,
-    0.304999,
-    0.305903,
-    0.306808,
-    0.307714,
-    0.30862,
-    0.309527,
-    0.310435,
-    0.311343,
-    0.312252,
-    0.313161,
-    0.314071,
-    0.314982,
-    0.315893,
-    0.316805,
-    0.317717,
-    0.31863,
-    0.319544,
-    0.320458,
-    0.321372,
-    0.322287,
-    0.323203,
-    0.324119,
-    0.325036,
-    0.325953,
-    0.326871,
-    0.327789,
-    0.328708,
-    0.329627,
-    0.330547,
-    0.331467,
-    0.332388,
-    0.333309,
-    0.334231,
-    0.335153,
-    0.336075,
-    0.336998,
-    0.337922,
-    0.338845,
-    0.33977,
-    0.340694,
-    0.341619,
-    0.342545,
-    0.343471,
-    0.344397,
-    0.345323,
-    0.34625,
-    0.347178,
-    0.348105,
-    0.349033,
-    0.349962,
-    0.35089,
-    0.35182,
-    0.352749,
-    0.353679,
-    0.354609,
-    0.355539,
-    0.356469,
-    0.3574,
-    0.358331,
-    0.359263,
-    0.360195,
-    0.361127,
-    0.362059,
-    0.362991,
-    0.363924,
-    0.364857,
-    0.36579,
-    0.366723,
-    0.367657,
-    0.368591,
-    0.369525,
-    0.370459,
-    0.371393,
-    0.372328,
-    0.373262,
-    0.374197,
-    0.375132,
-    0.376067,
-    0.377003,
-    0.377938,
-    0.378874,
-    0.379809,
-    0.380745,
-    0.381681,
-    0.382617,
-    0.383553,
-    0.384489,
-    0.385426,
-    0.386362,
-    0.387298,
-    0.388235,
-    0.389171,
-    0.390108,
-    0.391044,
-    0.391981,
-    0.392917,
-    0.393854,
-    0.39479,
-    0.395727,
-    0.396664,
-    0.3976,
-    0.398537,
-    0.399473,
-    0.40041,
-    0.401346,
-    0.402282,
-    0.403219,
-    0.404155,
-    0.405091,
-    0.406027,
-    0.406963,
-    0.407899,
-    0.408834,
-    0.40977,
-    0.410706,
-    0.411641,
-    0.412576,
-    0.413511,
-    0.414446,
-    0.415381,
-    0.416315,
-    0.41725,
-    0.418184,
-    0.419118,
-    0.420052,
-    0.420986,
-    0.421919,
-    0.422852,
-    0.423785,
-    0.424718,
-    0.42565,
-    0.426583,
-    0.427515,
-    0.428446,
-    0.429378,
-    0.430309,
-    0.43124,
-    0.43217,
-    0.433101,
-    0.43403,
-    0.43496,
-    0.435889,
-    0.436818,
-    0.437747,
-    0.438675,
-    0.439603,
-    0.440531,
-    0.441458,
-    0.442385,
-    0.443311,
-    0.444237,
-    0.445163,
-    0.446088,
-    0.447012,
-    0.447937,
-    0.448861,
-    0.449784,
-    0.450707,
-    0.45163,
-    0.452552,
-    0.453473,
-    0.454394,
-    0.455315,
-    0.456235,
-    0.457155,
-    0.458074,
-    0.458992,
-    0.45991,
-    0.460828,
-    0.461745,
-    0.462661,
-    0.463577,
-    0.464492,
-    0.465407,
-    0.466321,
-    0.467235,
-    0.468148,
-    0.46906,
-    0.469972,
-    0.470883,
-    0.471793,
-    0.472703,
-    0.473612,
-    0.474521,
-    0.475428,
-    0.476335,
-    0.477242,
-    0.478148,
-    0.479053,
-    0.479957,
-    0.480861,
-    0.481764,
-    0.482666,
-    0.483568,
-    0.484469,
-    0.485369,
-    0.486268,
-    0.487166,
-    0.488064,
-    0.488961,
-    0.489857,
-    0.490753,
-    0.491647,
-    0.492541,
-    0.493434,
-    0.494326,
-    0.495217,
-    0.496108,
-    0.496997,
-    0.497886,
-    0.498774,
-    0.499661,
-    0.500547,
-    0.501432,
-    0.502316,
-    0.5032,
-    0.504082,
-    0.504964,
-    0.505844,
-    0.506724,
-    0.507603,
-    0.508481,
-    0.509358,
-    0.510233,
-    0.511108,
-    0.511982,
-    0.512855,
-    0.513727,
-    0.514598,
-    0.515468,
-    0.516337,
-    0.517204,
-    0.518071,
-    0.518937,
-    0.519802,
-    0.520665,
-    0.521528,
-    0.522389,
-    0.52325,
-    0.524109,
-    0.524967,
-    0.525824,
-    0.52668,
-    0.527535,
-    0.528388,
-    0.529241,
-    0.530092,
-    0.530942,
-    0.531792,
-    0.532639,
-    0.533486,
-    0.534332,
-    0.535176,
-    0.536019,
-    0.536861,
-    0.537702,
-    0.538541,
-    0.539379,
-    0.540216,
-    0.541052,
-    0.541886,
-    0.542719,
-    0.543551,
-    0.544382,
-    0.545211,
-    0.546039,
-    0.546866,
-    0.547691,
-    0.548515,
-    0.549338,
-    0.550159,
-    0.550979,
-    0.551798,
-    0.552615,
-    0.553431,
-    0.554246,
-    0.555059,
-    0.555871,
-    0.556681,
-    0.55749,
-    0.558298,
-    0.559104,
-    0.559909,
-    0.560712,
-    0.561514,
-    0.562314,
-    0.563113,
-    0.56391,
-    0.564706,
-    0.565501,
-    0.566294,
-    0.567085,
-    0.567875,
-    0.568664,
-    0.56945,
-    0.570236,
-    0.57102,
-    0.571802,
-    0.572583,
-    0.573362,
-    0.574139,
-    0.574915,
-    0.57569,
-    0.576463,
-    0.577234,
-    0.578003,
-    0.578771,
-    0.579538,
-    0.580302,
-    0.581066,
-    0.581827,
-    0.582587,
-    0.583345,
-    0.584101,
-    0.584856,
-    0.585609,
-    0.586361,
-    0.58711,
-    0.587858,
-    0.588605,
-    0.589349,
-    0.590092,
-    0.590833,
-    0.591572,
-    0.59231,
-    0.593046,
-    0.59378,
-    0.594512,
-    0.595242,
-    0.595971,
-    0.596698,
-    0.597423,
-    0.598146,
-    0.598868,
-    0.599587,
-    0.600305,
-    0.601021,
-    0.601735,
-    0.602447,
-    0.603158,
-    0.603866,
-    0.604573,
-    0.605278,
-    0.60598,
-    0.606681,
-    0.60738,
-    0.608077,
-    0.608773,
-    0.609466,
-    0.610157,
-    0.610846,
-    0.611534,
-    0.612219,
-    0.612903,
-    0.613584,
-    0.614264,
-    0.614941,
-    0.615617,
-    0.61629,
-    0.616962,
-    0.617631,
-    0.618299,
-    0.618964,
-    0.619628,
-    0.620289,
-    0.620948,
-    0.621605,
-    0.622261,
-    0.622914,
-    0.623565,
-    0.624214,
-    0.62486,
-    0.625505,
-    0.626148,
-    0.626788,
-    0.627426,
-    0.628063,
-    0.628697,
-    0.629329,
-    0.629958,
-    0.630586,
-    0.631211,
-    0.631835,
-    0.632456,
-    0.633075,
-    0.633691,
-    0.634306,
-    0.634918,
-    0.635528,
-    0.636136,
-    0.636742,
-    0.637345,
-    0.637946,
-    0.638545,
-    0.639142,
-    0.639736,
-    0.640328,
-    0.640918,
-    0.641505,
-    0.642091,
-    0.642674,
-    0.643254,
-    0.643833,
-    0.644409,
-    0.644982,
-    0.645554,
-    0.646123,
-    0.646689,
-    0.647254,
-    0.647816,
-    0.648375,
-    0.648932,
-    0.649487,
-    0.65004,
-    0.65059,
-    0.651137,
-    0.651683,
-    0.652226,
-    0.652766,
-    0.653304,
-    0.65384,
-    0.654373,
-    0.654904,
-    0.655432,
-    0.655958,
-    0.656481,
-    0.657002,
-    0.65752,
-    0.658036,
-    0.65855,
-    0.65906,
-    0.659569,
-    0.660075,
-    0.660578,
-    0.661079,
-    0.661578,
-    0.662073,
-    0.662567,
-    0.663057,
-    0.663546,
-    0.664031,
-    0.664514,
-    0.664995,
-    0.665473,
-    0.665948,
-    0.666421,
-    0.666891,
-    0.667359,
-    0.667824,
-    0.668286,
-    0.668746,
-    0.669203,
-    0.669658,
-    0.670109,
-    0.670559,
-    0.671005,
-    0.671449,
-    0.67189,
-    0.672329,
-    0.672765,
-    0.673198,
-    0.673629,
-    0.674057,
-    0.674482,
-    0.674904,
-    0.675324,
-    0.675741,
-    0.676156,
-    0.676567,
-    0.676976,
-    0.677382,
-    0.677786,
-    0.678186,
-    0.678584,
-    0.67898,
-    0.679372,
-    0.679762,
-    0.680148,
-    0.680533,
-    0.680914,
-    0.681292,
-    0.681668,
-    0.682041,
-    0.682411,
-    0.682778,
-    0.683143,
-    0.683505,
-    0.683863,
-    0.684219,
-    0.684573,
-    0.684923,
-    0.68527,
-    0.685615,
-    0.685957,
-    0.686296,
-    0.686632,
-    0.686965,
-    0.687295,
-    0.687622,
-    0.687947,
-    0.688269,
-    0.688587,
-    0.688903,
-    0.689216,
-    0.689526,
-    0.689833,
-    0.690137,
-    0.690438,
-    0.690736,
-    0.691032,
-    0.691324,
-    0.691613,
-    0.6919,
-    0.692183,
-    0.692464,
-    0.692741,
-    0.693016,
-    0.693288,
-    0.693556,
-    0.693822,
-    0.694084,
-    0.694344,
-    0.694601,
-    0.694854,
-    0.695105,
-    0.695352,
-    0.695597,
-    0.695838,
-    0.696077,
-    0.696312,
-    0.696545,
-    0.696774,
-    0.697,
-    0.697224,
-    0.697444,
-    0.697661,
-    0.697875,
-    0.698086,
-    0.698294,
-    0.698499,
-    0.6987,
-    0.698899,
-    0.699095,
-    0.699287,
-    0.699476,
-    0.699663,
-    0.699846,
-    0.700026,
-    0.700203,
-    0.700376,
-    0.700547,
-    0.700714,
-    0.700879,
-    0.70104,
-    0.701198,
-    0.701353,
-    0.701505,
-    0.701653,
-    0.701799,
-    0.701941,
-    0.70208,
-    0.702216,
-    0.702349,
-    0.702479,
-    0.702605,
-    0.702728,
-    0.702848,
-    0.702965,
-    0.703079,
-    0.703189,
-    0.703296,
-    0.7034,
-    0.703501,
-    0.703599,
-    0.703693,
-    0.703784,
-    0.703872,
-    0.703957,
-    0.704038,
-    0.704116,
-    0.704191,
-    0.704263,
-    0.704332,
-    0.704397,
-    0.704459,
-    0.704517,
-    0.704573,
-    0.704625,
-    0.704674,
-    0.704719,
-    0.704762,
-    0.704801,
-    0.704837,
-    0.704869,
-    0.704898,
-    0.704924,
-    0.704947,
-    0.704966,
-    0.704982,
-    0.704995,
-    0.705004,
-    0.70501,
-    0.705013,
-    0.705012,
-    0.705009,
-    0.705001,
-    0.704991,
-    0.704977,
-    0.70496,
-    0.704939,
-    0.704915,
-    0.704888,
-    0.704858,
-    0.704824,
-    0.704787,
-    0.704746,
-    0.704702,
-    0.704655,
-    0.704604,
-    0.70455,
-    0.704493,
-    0.704432,
-    0.704368,
-    0.7043,
-    0.70423,
-    0.704155,
-    0.704078,
-    0.703997,
-    0.703912,
-    0.703825,
-    0.703734,
-    0.703639,
-    0.703541,
-    0.70344,
-    0.703335,
-    0.703227,
-    0.703115,
-    0.703,
-    0.702882,
-    0.70276,
-    0.702635,
-    0.702507,
-    0.702375,
-    0.702239,
-    0.702101,
-    0.701958,
-    0.701813,
-    0.701664,
-    0.701511,
-    0.701355,
-    0.701196,
-    0.701033,
-    0.700867,
-    0.700697,
-    0.700524,
-    0.700348,
-    0.700168,
-    0.699984,
-    0.699797,
-    0.699607,
-    0.699413,
-    0.699216,
-    0.699016,
-    0.698811,
-    0.698604,
-    0.698393,
-    0.698179,
-    0.697961,
-    0.697739,
-    0.697514,
-    0.697286,
-    0.697054,
-    0.696819,
-    0.696581,
-    0.696338,
-    0.696093,
-    0.695844,
-    0.695591,
-    0.695335,
-    0.695076,
-    0.694813,
-    0.694546,
-    0.694277,
-    0.694003,
-    0.693726,
-    0.693446,
-    0.693162,
-    0.692875,
-    0.692584,
-    0.69229,
-    0.691992,
-    0.691691,
-    0.691386,
-    0.691078,
-    0.690767,
-    0.690451,
-    0.690133,
-    0.689811,
-    0.689485,
-    0.689156,
-    0.688823,
-    0.688487,
-    0.688148,
-    0.687805,
-    0.687458,
-    0.687108,
-    0.686755,
-    0.686398,
-    0.686037,
-    0.685673,
-    0.685306,
-    0.684935,
-    0.68456,
-    0.684182,
-    0.683801,
-    0.683416,
-    0.683028,
-    0.682636,
-    0.68224,
-    0.681841,
-    0.681439,
-    0.681033,
-    0.680624,
-    0.680211,
-    0.679794,
-    0.679375,
-    0.678951,
-    0.678524,
-    0.678094,
-    0.67766,
-    0.677223,
-    0.676782,
-    0.676338,
-    0.67589,
-    0.675438,
-    0.674984,
-    0.674525,
-    0.674064,
-    0.673598,
-    0.67313,
-    0.672657,
-    0.672182,
-    0.671702,
-    0.67122,
-    0.670733,
-    0.670244,
-    0.669751,
-    0.669254,
-    0.668754,
-    0.66825,
-    0.667743,
-    0.667232,
-    0.666718,
-    0.666201,
-    0.66568,
-    0.665155,
-    0.664627,
-    0.664096,
-    0.663561,
-    0.663022,
-    0.66248,
-    0.661935,
-    0.661386,
-    0.660834,
-    0.660278,
-    0.659719,
-    0.659156,
-    0.65859,
-    0.65802,
-    0.657447,
-    0.656871,
-    0.656291,
-    0.655707,
-    0.65512,
-    0.65453,
-    0.653936,
-    0.653339,
-    0.652738,
-    0.652134,
-    0.651526,
-    0.650915,
-    0.6503,
-    0.649682,
-    0.649061,
-    0.648436,
-    0.647808,
-    0.647176,
-    0.646541,
-    0.645902,
-    0.64526,
-    0.644614,
-    0.643965,
-    0.643313,
-    0.642657,
-    0.641998,
-    0.641335,
-    0.640669,
-    0.64,
-    0.639327,
-    0.638651,
-    0.637971,
-    0.637288,
-    0.636601,
-    0.635911,
-    0.635218,
-    0.634521,
-    0.633821,
-    0.633117,
-    0.63241,
-    0.6317,
-    0.630986,
-    0.630269,
-    0.629549,
-    0.628825,
-    0.628098,
-    0.627367,
-    0.626633,
-    0.625895,
-    0.625155,
-    0.624411,
-    0.623663,
-    0.622912,
-    0.622158,
-    0.6214,
-    0.620639,
-    0.619875,
-    0.619107,
-    0.618336,
-    0.617562,
-    0.616784,
-    0.616003,
-    0.615219,
-    0.614431,
-    0.61364,
-    0.612846,
-    0.612048,
-    0.611247,
-    0.610443,
-    0.609635,
-    0.608825,
-    0.60801,
-    0.607193,
-    0.606372,
-    0.605548,
-    0.60472,
-    0.60389,
-    0.603056,
-    0.602218,
-    0.601378,
-    0.600534,
-    0.599687,
-    0.598836,
-    0.597982,
-    0.597125,
-    0.596265,
-    0.595402,
-    0.594535,
-    0.593665,
-    0.592792,
-    0.591915,
-    0.591035,
-    0.590153,
-    0.589266,
-    0.588377,
-    0.587484,
-    0.586588,
-    0.585689,
-    0.584787,
-    0.583881,
-    0.582973,
-    0.582061,
-    0.581145,
-    0.580227,
-    0.579306,
-    0.578381,
-    0.577453,
-    0.576522,
-    0.575588,
-    0.57465,
-    0.573709,
-    0.572766,
-    0.571819,
-    0.570869,
-    0.569915,
-    0.568959,
-    0.567999,
-    0.567037,
-    0.566071,
-    0.565102,
-    0.56413,
-    0.563155,
-    0.562176,
-    0.561195,
-    0.56021,
-    0.559223,
-    0.558232,
-    0.557238,
-    0.556241,
-    0.555241,
-    0.554238,
-    0.553232,
-    0.552222,
-    0.55121,
-    0.550195,
-    0.549176,
-    0.548155,
-    0.54713,
-    0.546102,
-    0.545072,
-    0.544038,
-    0.543001,
-    0.541962,
-    0.540919,
-    0.539873,
-    0.538824,
-    0.537772,
-    0.536718,
-    0.53566,
-    0.534599,
-    0.533535,
-    0.532468,
-    0.531399,
-    0.530326,
-    0.52925,
-    0.528172,
-    0.52709,
-    0.526006,
-    0.524918,
-    0.523828,
-    0.522734,
-    0.521638,
-    0.520539,
-    0.519436,
-    0.518331,
-    0.517223,
-    0.516113,
-    0.514999,
-    0.513882,
-    0.512762,
-    0.51164,
-    0.510515,
-    0.509387,
-    0.508255,
-    0.507122,
-    0.505985,
-    0.504845,
-    0.503703,
-    0.502557,
-    0.501409,
-    0.500258,
-    0.499105,
-    0.497948,
-    0.496789,
-    0.495626,
-    0.494461,
-    0.493294,
-    0.492123,
-    0.49095,
-    0.489774,
-    0.488595,
-    0.487413,
-    0.486229,
-    0.485041,
-    0.483851,
-    0.482659,
-    0.481463,
-    0.480265,
-    0.479065,
-    0.477861,
-    0.476655,
-    0.475446,
-    0.474234,
-    0.47302,
-    0.471803,
-    0.470583,
-    0.469361,
-    0.468136,
-    0.466908,
-    0.465678,
-    0.464445,
-    0.463209,
-    0.461971,
-    0.46073,
-    0.459487,
-    0.45824,
-    0.456992,
-    0.45574,
-    0.454487,
-    0.45323,
-    0.451971,
-    0.450709,
-    0.449445,
-    0.448178,
-    0.446909,
-    0.445637,
-    0.444363,
-    0.443086,
-    0.441806,
-    0.440524,
-    0.43924,
-    0.437953,
-    0.436663,
-    0.435371,
-    0.434077,
-    0.43278,
-    0.43148,
-    0.430178,
-    0.428874,
-    0.427567,
-    0.426258,
-    0.424946,
-    0.423632,
-    0.422316,
-    0.420997,
-    0.419675,
-    0.418351,
-    0.417025,
-    0.415697,
-    0.414366,
-    0.413032,
-    0.411697,
-    0.410359,
-    0.409018,
-    0.407675,
-    0.40633,
-    0.404983,
-    0.403633,
-    0.402281,
-    0.400927,
-    0.39957,
-    0.398211,
-    0.39685,
-    0.395486,
-    0.39412,
-    0.392752,
-    0.391382,
-    0.390009,
-    0.388635,
-    0.387257,
-    0.385878,
-    0.384497,
-    0.383113,
-    0.381727,
-    0.380339,
-    0.378949,
-    0.377556,
-    0.376161,
-    0.374765,
-    0.373365,
-    0.371964,
-    0.370561,
-    0.369156,
-    0.367748,
-    0.366338,
-    0.364927,
-    0.363513,
-    0.362097,
-    0.360679,
-    0.359258,
-    0.357836,
-    0.356412,
-    0.354985,
-    0.353557,
-    0.352127,
-    0.350694,
-    0.349259,
-    0.347823,
-    0.346384,
-    0.344944,
-    0.343501,
-    0.342057,
-    0.34061,
-    0.339162,
-    0.337711,
-    0.336259,
-    0.334804,
-    0.333348,
-    0.33189,
-    0.33043,
-    0.328968,
-    0.327504,
-    0.326038,
-    0.32457,
-    0.3231,
-    0.321629,
-    0.320156,
-    0.31868,
-    0.317203,
-    0.315724,
-    0.314244,
-    0.312761,
-    0.311277,
-    0.30979,
-    0.308302,
-    0.306813,
-    0.305321,
-    0.303828,
-    0.302333,
-    0.300836,
-    0.299337,
-    0.297837,
-    0.296335,
-    0.294831,
-    0.293326,
-    0.291818,
-    0.290309,
-    0.288799,
-    0.287286,
-    0.285773,
-    0.284257,
-    0.28274,
-    0.281221,
-    0.2797,
-    0.278178,
-    0.276654,
-    0.275129,
-    0.273602,
-    0.272073,
-    0.270543,
-    0.269011,
-    0.267478,
-    0.265943,
-    0.264407,
-    0.262869,
-    0.261329,
-    0.259788,
-    0.258246,
-    0.256702,
-    0.255156,
-    0.253609,
-    0.25206,
-    0.25051,
-    0.248959,
-    0.247406,
-    0.245852,
-    0.244296,
-    0.242739,
-    0.24118,
-    0.23962,
-    0.238059,
-    0.236496,
-    0.234932,
-    0.233366,
-    0.231799,
-    0.230231,
-    0.228661,
-    0.22709,
-    0.225518,
-    0.223944,
-    0.22237,
-    0.220793,
-    0.219216,
-    0.217637,
-    0.216057,
-    0.214476,
-    0.212893,
-    0.211309,
-    0.209724,
-    0.208138,
-    0.20655,
-    0.204962,
-    0.203372,
-    0.201781,
-    0.200188,
-    0.198595,
-    0.197,
-    0.195405,
-    0.193808,
-    0.19221,
-    0.19061,
-    0.18901,
-    0.187409,
-    0.185806,
-    0.184203,
-    0.182598,
-    0.180992,
-    0.179385,
-    0.177778,
-    0.176169,
-    0.174559,
-    0.172948,
-    0.171336,
-    0.169723,
-    0.168109,
-    0.166494,
-    0.164878,
-    0.163261,
-    0.161644,
-    0.160025,
-    0.158405,
-    0.156784,
-    0.155163,
-    0.15354,
-    0.151917,
-    0.150293,
-    0.148668,
-    0.147042,
-    0.145415,
-    0.143787,
-    0.142158,
-    0.140529,
-    0.138899,
-    0.137268,
-    0.135636,
-    0.134003,
-    0.13237,
-    0.130735,
-    0.1291,
-    0.127465,
-    0.125828,
-    0.124191,
-    0.122553,
-    0.120914,
-    0.119275,
-    0.117635,
-    0.115994,
-    0.114353,
-    0.112711,
-    0.111068,
-    0.109424,
-    0.10778,
-    0.106135,
-    0.10449,
-    0.102844,
-    0.101198,
-    0.0995504,
-    0.0979027,
-    0.0962544,
-    0.0946055,
-    0.092956,
-    0.091306,
-    0.0896555,
-    0.0880045,
-    0.0863529,
-    0.0847008,
-    0.0830482,
-    0.0813952,
-    0.0797416,
-    0.0780876,
-    0.0764332,
-    0.0747783,
-    0.0731229,
-    0.0714671,
-    0.0698109,
-    0.0681543,
-    0.0664973,
-    0.0648399,
-    0.0631821,
-    0.0615239,
-    0.0598654,
-    0.0582065,
-    0.0565473,
-    0.0548877,
-    0.0532279,
-    0.0515677,
-    0.0499072,
-    0.0482464,
-    0.0465854,
-    0.044924,
-    0.0432624,
-    0.0416006,
-    0.0399384,
-    0.0382761,
-    0.0366135,
-    0.0349508,
-    0.0332878,
-    0.0316246,
-    0.0299612,
-    0.0282977,
-    0.026634,
-    0.0249701,
-    0.0233061,
-    0.021642,
-    0.0199777,
-    0.0183133,
-    0.0166488,
-    0.0149842,
-    0.0133195,
-    0.0116547,
-    0.0099899,
-    0.00832501,
-    0.00666006,
-    0.00499508,
-    0.00333007,
-    0.00166504
-};
-
-// Top frequency: 44.1K * 0.464399
-constexpr static std::array<float, 4096> wt_sawtooth_0xA =
-{
-    0,
-    -0.000832521,
-    -0.00166504,
-    -0.00249755,
-    -0.00333006,
-    -0.00416256,
-    -0.00499506,
-    -0.00582754,
-    -0.00666,
-    -0.00749245,
-    -0.00832488,
-    -0.0091573,
-    -0.00998969,
-    -0.0108221,
-    -0.0116544,
-    -0.0124867,
-    -0.013319,
-    -0.0141513,
-    -0.0149835,
-    -0.0158157,
-    -0.0166478,
-    -0.0174799,
-    -0.018312,
-    -0.019144,
-    -0.019976,
-    -0.0208079,
-    -0.0216398,
-    -0.0224716,
-    -0.0233034,
-    -0.0241351,
-    -0.0249668,
-    -0.0257984,
-    -0.02663,
-    -0.0274615,
-    -0.0282929,
-    -0.0291242,
-    -0.0299555,
-    -0.0307867,
-    -0.0316179,
-    -0.032449,
-    -0.03328,
-    -0.0341109,
-    -0.0349417,
-    -0.0357725,
-    -0.0366031,
-    -0.0374337,
-    -0.0382642,
-    -0.0390946,
-    -0.0399249,
-    -0.0407551,
-    -0.0415853,
-    -0.0424153,
-    -0.0432452,
-    -0.044075,
-    -0.0449047,
-    -0.0457344,
-    -0.0465639,
-    -0.0473933,
-    -0.0482225,
-    -0.0490517,
-    -0.0498808,
-    -0.0507097,
-    -0.0515385,
-    -0.0523672,
-    -0.0531958,
-    -0.0540242,
-    -0.0548526,
-    -0.0556808,
-    -0.0565088,
-    -0.0573368,
-    -0.0581646,
-    -0.0589922,
-    -0.0598197,
-    -0.0606471,
-    -0.0614743,
-    -0.0623014,
-    -0.0631284,
-    -0.0639552,
-    -0.0647818,
-    -0.0656083,
-    -0.0664346,
-    -0.0672608,
-    -0.0680868,
-    -0.0689127,
-    -0.0697384,
-    -0.0705639,
-    -0.0713893,
-    -0.0722145,
-    -0.0730396,
-    -0.0738644,
-    -0.0746891,
-    -0.0755136,
-    -0.0763379,
-    -0.0771621,
-    -0.0779861,
-    -0.0788099,
-    -0.0796335,
-    -0.0804569,
-    -0.0812801,
-    -0.0821031,
-    -0.082926,
-    -0.0837486,
-    -0.0845711,
-    -0.0853933,
-    -0.0862154,
-    -0.0870372,
-    -0.0878589,
-    -0.0886803,
-    -0.0895015,
-    -0.0903226,
-    -0.0911434,
-    -0.091964,
-    -0.0927843,
-    -0.0936045,
-    -0.0944244,
-    -0.0952441,
-    -0.0960636,
-    -0.0968829,
-    -0.0977019,
-    -0.0985207,
-    -0.0993393,
-    -0.100158,
-    -0.100976,
-    -0.101794,
-    -0.102611,
-    -0.103429,
-    -0.104246,
-    -0.105063,
-    -0.105879,
-    -0.106696,
-    -0.107512,
-    -0.108328,
-    -0.109143,
-    -0.109959,
-    -0.110774,
-    -0.111589,
-    -0.112403,
-    -0.113218,
-    -0.114032,
-    -0.114846,
-    -0.115659,
-    -0.116472,
-    -0.117285,
-    -0.118098,
-    -0.11891,
-    -0.119723,
-    -0.120535,
-    -0.121346,
-    -0.122157,
-    -0.122968,
-    -0.123779,
-    -0.12459,
-    -0.1254,
-    -0.12621,
-    -0.127019,
-    -0.127828,
-    -0.128637,
-    -0.129446,
-    -0.130254,
-    -0.131062,
-    -0.13187,
-    -0.132677,
-    -0.133485,
-    -0.134291,
-    -0.135098,
-    -0.135904,
-    -0.13671,
-    -0.137515,
-    -0.138321,
-    -0.139125,
-    -0.13993,
-    -0.140734,
-    -0.141538,
-    -0.142342,
-    -0.143145,
-    -0.143948,
-    -0.14475,
-    -0.145552,
-    -0.146354,
-    -0.147156,
-    -0.147957,
-    -0.148758,
-    -0.149558,
-    -0.150358,
-    -0.151158,
-    -0.151957,
-    -0.152756,
-    -0.153555,
-    -0.154353,
-    -0.155151,
-    -0.155949,
-    -0.156746,
-    -0.157543,
-    -0.15834,
-    -0.159136,
-    -0.159931,
-    -0.160727,
-    -0.161522,
-    -0.162316,
-    -0.163111,
-    -0.163904,
-    -0.164698,
-    -0.165491,
-    -0.166284,
-    -0.167076,
-    -0.167868,
-    -0.168659,
-    -0.16945,
-    -0.170241,
-    -0.171031,
-    -0.171821,
-    -0.172611,
-    -0.1734,
-    -0.174189,
-    -0.174977,
-    -0.175765,
-    -0.176552,
-    -0.177339,
-    -0.178126,
-    -0.178912,
-    -0.179698,
-    -0.180483,
-    -0.181268,
-    -0.182053,
-    -0.182837,
-    -0.18362,
-    -0.184403,
-    -0.185186,
-    -0.185969,
-    -0.186751,
-    -0.187532,
-    -0.188313,
-    -0.189094,
-    -0.189874,
-    -0.190653,
-    -0.191433,
-    -0.192211,
-    -0.19299,
-    -0.193768,
-    -0.194545,
-    -0.195322,
-    -0.196099,
-    -0.196875,
-    -0.19765,
-    -0.198425,
-    -0.1992,
-    -0.199974,
-    -0.200748,
-    -0.201521,
-    -0.202294,
-    -0.203066,
-    -0.203838,
-    -0.204609,
-    -0.20538,
-    -0.20615,
-    -0.20692,
-    -0.20769,
-    -0.208459,
-    -0.209227,
-    -0.209995,
-    -0.210762,
-    -0.211529,
-    -0.212296,
-    -0.213062,
-    -0.213827,
-    -0.214592,
-    -0.215356,
-    -0.21612,
-    -0.216884,
-    -0.217647,
-    -0.218409,
-    -0.219171,
-    -0.219932,
-    -0.220693,
-    -0.221453,
-    -0.222213,
-    -0.222973,
-    -0.223731,
-    -0.22449,
-    -0.225247,
-    -0.226004,
-    -0.226761,
-    -0.227517,
-    -0.228273,
-    -0.229028,
-    -0.229782,
-    -0.230536,
-    -0.23129,
-    -0.232042,
-    -0.232795,
-    -0.233547,
-    -0.234298,
-    -0.235048,
-    -0.235799,
-    -0.236548,
-    -0.237297,
-    -0.238046,
-    -0.238793,
-    -0.239541,
-    -0.240287,
-    -0.241034,
-    -0.241779,
-    -0.242524,
-    -0.243269,
-    -0.244013,
-    -0.244756,
-    -0.245499,
-    -0.246241,
-    -0.246983,
-    -0.247724,
-    -0.248464,
-    -0.249204,
-    -0.249943,
-    -0.250682,
-    -0.25142,
-    -0.252158,
-    -0.252894,
-    -0.253631,
-    -0.254366,
-    -0.255102,
-    -0.255836,
-    -0.25657,
-    -0.257303,
-    -0.258036,
-    -0.258768,
-    -0.2595,
-    -0.260231,
-    -0.260961,
-    -0.26169,
-    -0.26242,
-    -0.263148,
-    -0.263876,
-    -0.264603,
-    -0.265329,
-    -0.266055,
-    -0.266781,
-    -0.267505,
-    -0.268229,
-    -0.268953,
-    -0.269676,
-    -0.270398,
-    -0.271119,
-    -0.27184,
-    -0.27256,
-    -0.27328,
-    -0.273999,
-    -0.274717,
-    -0.275435,
-    -0.276152,
-    -0.276868,
-    -0.277584,
-    -0.278299,
-    -0.279014,
-    -0.279727,
-    -0.28044,
-    -0.281153,
-    -0.281865,
-    -0.282576,
-    -0.283286,
-    -0.283996,
-    -0.284705,
-    -0.285413,
-    -0.286121,
-    -0.286828,
-    -0.287535,
-    -0.28824,
-    -0.288945,
-    -0.28965,
-    -0.290354,
-    -0.291057,
-    -0.291759,
-    -0.292461,
-    -0.293162,
-    -0.293862,
-    -0.294561,
-    -0.29526,
-    -0.295958,
-    -0.296656,
-    -0.297353,
-    -0.298049,
-    -0.298744,
-    -0.299439,
-    -0.300133,
-    -0.300826,
-    -0.301519,
-    -0.302211,
-    -0.302902,
-    -0.303592,
-    -0.304282,
-    -0.304971,
-    -0.305659,
-    -0.306347,
-    -0.307034,
-    -0.30772,
-    -0.308405,
-    -0.30909,
-    -0.309774,
-    -0.310457,
-    -0.311139,
-    -0.311821,
-    -0.312502,
-    -0.313183,
-    -0.313862,
-    -0.314541,
-    -0.315219,
-    -0.315896,
-    -0.316573,
-    -0.317249,
-    -0.317924,
-    -0.318598,
-    -0.319272,
-    -0.319945,
-    -0.320617,
-    -0.321288,
-    -0.321959,
-    -0.322628,
-    -0.323298,
-    -0.323966,
-    -0.324633,
-    -0.3253,
-    -0.325966,
-    -0.326631,
-    -0.327296,
-    -0.32796,
-    -0.328623,
-    -0.329285,
-    -0.329946,
-    -0.330607,
-    -0.331267,
-    -0.331926,
-    -0.332584,
-    -0.333241,
-    -0.333898,
-    -0.334554,
-    -0.335209,
-    -0.335864,
-    -0.336517,
-    -0.33717,
-    -0.337822,
-    -0.338473,
-    -0.339123,
-    -0.339773,
-    -0.340422,
-    -0.34107,
-    -0.341717,
-    -0.342363,
-    -0.343009,
-    -0.343654,
-    -0.344298,
-    -0.344941,
-    -0.345583,
-    -0.346225,
-    -0.346865,
-    -0.347505,
-    -0.348144,
-    -0.348782,
-    -0.34942,
-    -0.350056,
-    -0.350692,
-    -0.351327,
-    -0.351961,
-    -0.352595,
-    -0.353227,
-    -0.353859,
-    -0.35449,
-    -0.35512,
-    -0.355749,
-    -0.356377,
-    -0.357004,
-    -0.357631,
-    -0.358257,
-    -0.358882,
-    -0.359506,
-    -0.360129,
-    -0.360752,
-    -0.361373,
-    -0.361994,
-    -0.362614,
-    -0.363233,
-    -0.363851,
-    -0.364468,
-    -0.365084,
-    -0.3657,
-    -0.366315,
-    -0.366929,
-    -0.367542,
-    -0.368154,
-    -0.368765,
-    -0.369375,
-    -0.369985,
-    -0.370593,
-    -0.371201,
-    -0.371808,
-    -0.372414,
-    -0.373019,
-    -0.373624,
-    -0.374227,
-    -0.37483,
-    -0.375431,
-    -0.376032,
-    -0.376632,
-    -0.377231,
-    -0.377829,
-    -0.378426,
-    -0.379022,
-    -0.379618,
-    -0.380212,
-    -0.380806,
-    -0.381399,
-    -0.38199,
-    -0.382581,
-    -0.383171,
-    -0.383761,
-    -0.384349,
-    -0.384936,
-    -0.385523,
-    -0.386108,
-    -0.386693,
-    -0.387276,
-    -0.387859,
-    -0.388441,
-    -0.389022,
-    -0.389602,
-    -0.390181,
-    -0.390759,
-    -0.391337,
-    -0.391913,
-    -0.392488,
-    -0.393063,
-    -0.393637,
-    -0.394209,
-    -0.394781,
-    -0.395352,
-    -0.395922,
-    -0.396491,
-    -0.397059,
-    -0.397626,
-    -0.398192,
-    -0.398757,
-    -0.399321,
-    -0.399885,
-    -0.400447,
-    -0.401008,
-    -0.401569,
-    -0.402129,
-    -0.402687,
-    -0.403245,
-    -0.403802,
-    -0.404357,
-    -0.404912,
-    -0.405466,
-    -0.406019,
-    -0.406571,
-    -0.407122,
-    -0.407672,
-    -0.408221,
-    -0.408769,
-    -0.409316,
-    -0.409862,
-    -0.410408,
-    -0.410952,
-    -0.411495,
-    -0.412038,
-    -0.412579,
-    -0.413119,
-    -0.413659,
-    -0.414197,
-    -0.414735,
-    -0.415271,
-    -0.415807,
-    -0.416341,
-    -0.416875,
-    -0.417407,
-    -0.417939,
-    -0.418469,
-    -0.418999,
-    -0.419528,
-    -0.420055,
-    -0.420582,
-    -0.421108,
-    -0.421632,
-    -0.422156,
-    -0.422679,
-    -0.423201,
-    -0.423721,
-    -0.424241,
-    -0.42476,
-    -0.425277,
-    -0.425794,
-    -0.42631,
-    -0.426824,
-    -0.427338,
-    -0.427851,
-    -0.428363,
-    -0.428873,
-    -0.429383,
-    -0.429892,
-    -0.430399,
-    -0.430906,
-    -0.431412,
-    -0.431916,
-    -0.43242,
-    -0.432922,
-    -0.433424,
-    -0.433924,
-    -0.434424,
-    -0.434922,
-    -0.43542,
-    -0.435916,
-    -0.436412,
-    -0.436906,
-    -0.437399,
-    -0.437892,
-    -0.438383,
-    -0.438873,
-    -0.439363,
-    -0.439851,
-    -0.440338,
-    -0.440824,
-    -0.441309,
-    -0.441793,
-    -0.442276,
-    -0.442758,
-    -0.443239,
-    -0.443719,
-    -0.444198,
-    -0.444676,
-    -0.445153,
-    -0.445628,
-    -0.446103,
-    -0.446577,
-    -0.447049,
-    -0.447521,
-    -0.447991,
-    -0.44846,
-    -0.448929,
-    -0.449396,
-    -0.449862,
-    -0.450327,
-    -0.450792,
-    -0.451255,
-    -0.451717,
-    -0.452178,
-    -0.452637,
-    -0.453096,
-    -0.453554,
-    -0.454011,
-    -0.454466,
-    -0.454921,
-    -0.455374,
-    -0.455827,
-    -0.456278,
-    -0.456728,
-    -0.457177,
-    -0.457625,
-    -0.458072,
-    -0.458518,
-    -0.458963,
-    -0.459407,
-    -0.45985,
-    -0.460291,
-    -0.460732,
-    -0.461171,
-    -0.46161,
-    -0.462047,
-    -0.462483,
-    -0.462918,
-    -0.463352,
-    -0.463785,
-    -0.464217,
-    -0.464648,
-    -0.465077,
-    -0.465506,
-    -0.465933,
-    -0.46636,
-    -0.466785,
-    -0.467209,
-    -0.467632,
-    -0.468054,
-    -0.468475,
-    -0.468895,
-    -0.469313,
-    -0.469731,
-    -0.470147,
-    -0.470563,
-    -0.470977,
-    -0.47139,
-    -0.471802,
-    -0.472213,
-    -0.472623,
-    -0.473032,
-    -0.473439,
-    -0.473846,
-    -0.474251,
-    -0.474655,
-    -0.475058,
-    -0.47546,
-    -0.475861,
-    -0.476261,
-    -0.476659,
-    -0.477057,
-    -0.477453,
-    -0.477849,
-    -0.478243,
-    -0.478636,
-    -0.479028,
-    -0.479418,
-    -0.479808,
-    -0.480197,
-    -0.480584,
-    -0.48097,
-    -0.481355,
-    -0.481739,
-    -0.482122,
-    -0.482504,
-    -0.482884,
-    -0.483264,
-    -0.483642,
-    -0.484019,
-    -0.484395,
-    -0.48477,
-    -0.485144,
-    -0.485516,
-    -0.485888,
-    -0.486258,
-    -0.486627,
-    -0.486995,
-    -0.487362,
-    -0.487728,
-    -0.488093,
-    -0.488456,
-    -0.488818,
-    -0.489179,
-    -0.489539,
-    -0.489898,
-    -0.490256,
-    -0.490613,
-    -0.490968,
-    -0.491322,
-    -0.491675,
-    -0.492027,
-    -0.492378,
-    -0.492727,
-    -0.493076,
-    -0.493423,
-    -0.493769,
-    -0.494114,
-    -0.494458,
-    -0.494801,
-    -0.495142,
-    -0.495482,
-    -0.495821,
-    -0.496159,
-    -0.496496,
-    -0.496832,
-    -0.497166,
-    -0.497499,
-    -0.497832,
-    -0.498163,
-    -0.498492,
-    -0.498821,
-    -0.499148,
-    -0.499475,
-    -0.4998,
-    -0.500124,
-    -0.500446,
-    -0.500768,
-    -0.501088,
-    -0.501407,
-    -0.501725,
-    -0.502042,
-    -0.502358,
-    -0.502672,
-    -0.502986,
-    -0.503298,
-    -0.503609,
-    -0.503918,
-    -0.504227,
-    -0.504534,
-    -0.50484,
-    -0.505145,
-    -0.505449,
-    -0.505752,
-    -0.506053,
-    -0.506353,
-    -0.506652,
-    -0.50695,
-    -0.507247,
-    -0.507542,
-    -0.507836,
-    -0.50813,
-    -0.508421,
-    -0.508712,
-    -0.509001,
-    -0.50929,
-    -0.509577,
-    -0.509863,
-    -0.510147,
-    -0.510431,
-    -0.510713,
-    -0.510994,
-    -0.511274,
-    -0.511553,
-    -0.51183,
-    -0.512106,
-    -0.512381,
-    -0.512655,
-    -0.512928,
-    -0.513199,
-    -0.51347,
-    -0.513739,
-    -0.514006,
-    -0.514273,
-    -0.514538,
-    -0.514803,
-    -0.515066,
-    -0.515327,
-    -0.515588,
-    -0.515847,
-    -0.516105,
-    -0.516362,
-    -0.516618,
-    -0.516872,
-    -0.517126,
-    -0.517378,
-    -0.517628,
-    -0.517878,
-    -0.518126,
-    -0.518374,
-    -0.51862,
-    -0.518864,
-    -0.519108,
-    -0.51935,
-    -0.519591,
-    -0.519831,
-    -0.52007,
-    -0.520307,
-    -0.520543,
-    -0.520778,
-    -0.521012,
-    -0.521244,
-    -0.521475,
-    -0.521706,
-    -0.521934,
-    -0.522162,
-    -0.522388,
-    -0.522613,
-    -0.522837,
-    -0.52306,
-    -0.523281,
-    -0.523502,
-    -0.523721,
-    -0.523938,
-    -0.524155,
-    -0.52437,
-    -0.524584,
-    -0.524797,
-    -0.525008,
-    -0.525219,
-    -0.525428,
-    -0.525636,
-    -0.525842,
-    -0.526048,
-    -0.526252,
-    -0.526455,
-    -0.526656,
-    -0.526857,
-    -0.527056,
-    -0.527254,
-    -0.527451,
-    -0.527646,
-    -0.52784,
-    -0.528033,
-    -0.528225,
-    -0.528416,
-    -0.528605,
-    -0.528793,
-    -0.52898,
-    -0.529165,
-    -0.529349,
-    -0.529532,
-    -0.529714,
-    -0.529895,
-    -0.530074,
-    -0.530252,
-    -0.530429,
-    -0.530604,
-    -0.530779,
-    -0.530952,
-    -0.531124,
-    -0.531294,
-    -0.531463,
-    -0.531631,
-    -0.531798,
-    -0.531964,
-    -0.532128,
-    -0.532291,
-    -0.532453,
-    -0.532614,
-    -0.532773,
-    -0.532931,
-    -0.533088,
-    -0.533243,
-    -0.533397,
-    -0.53355,
-    -0.533702,
-    -0.533853,
-    -0.534002,
-    -0.53415,
-    -0.534297,
-    -0.534442,
-    -0.534586,
-    -0.534729,
-    -0.534871,
-    -0.535011,
-    -0.535151,
-    -0.535289,
-    -0.535425,
-    -0.535561,
-    -0.535695,
-    -0.535828,
-    -0.535959,
-    -0.53609,
-    -0.536219,
-    -0.536346,
-    -0.536473,
-    -0.536598,
-    -0.536722,
-    -0.536845,
-    -0.536967,
-    -0.537087,
-    -0.537206,
-    -0.537324,
-    -0.53744,
-    -0.537555,
-    -0.537669,
-    -0.537782,
-    -0.537893,
-    -0.538004,
-    -0.538112,
-    -0.53822,
-    -0.538326,
-    -0.538432,
-    -0.538535,
-    -0.538638,
-    -0.538739,
-    -0.538839,
-    -0.538938,
-    -0.539035,
-    -0.539132,
-    -0.539226,
-    -0.53932,
-    -0.539413,
-    -0.539504,
-    -0.539594,
-    -0.539682,
-    -0.539769,
-    -0.539855,
-    -0.53994,
-    -0.540024,
-    -0.540106,
-    -0.540187,
-    -0.540267,
-    -0.540345,
-    -0.540422,
-    -0.540498,
-    -0.540573,
-    -0.540646,
-    -0.540718,
-    -0.540789,
-    -0.540858,
-    -0.540927,
-    -0.540994,
-    -0.541059,
-    -0.541124,
-    -0.541187,
-    -0.541249,
-    -0.541309,
-    -0.541369,
-    -0.541427,
-    -0.541484,
-    -0.541539,
-    -0.541593,
-    -0.541646,
-    -0.541698,
-    -0.541748,
-    -0.541798,
-    -0.541845,
-    -0.541892,
-    -0.541937,
-    -0.541981,
-    -0.542024,
-    -0.542066,
-    -0.542106,
-    -0.542145,
-    -0.542182,
-    -0.542219,
-    -0.542254,
-    -0.542288,
-    -0.54232,
-    -0.542352,
-    -0.542382,
-    -0.54241,
-    -0.542438,
-    -0.542464,
-    -0.542489,
-    -0.542512,
-    -0.542535,
-    -0.542556,
-    -0.542576,
-    -0.542594,
-    -0.542611,
-    -0.542627,
-    -0.542642,
-    -0.542656,
-    -0.542668,
-    -0.542678,
-    -0.542688,
-    -0.542696,
-    -0.542703,
-    -0.542709,
-    -0.542714,
-    -0.542717,
-    -0.542719,
-    -0.542719,
-    -0.542719,
-    -0.542717,
-    -0.542714,
-    -0.542709,
-    -0.542703,
-    -0.542696,
-    -0.542688,
-    -0.542678,
-    -0.542668,
-    -0.542656,
-    -0.542642,
-    -0.542627,
-    -0.542611,
-    -0.542594,
-    -0.542576,
-    -0.542556,
-    -0.542535,
-    -0.542512,
-    -0.542489,
-    -0.542464,
-    -0.542438,
-    -0.54241,
-    -0.542382,
-    -0.542352,
-    -0.54232,
-    -0.542288,
-    -0.542254,
-    -0.542219,
-    -0.542182,
-    -0.542145,
-    -0.542106,
-    -0.542066,
-    -0.542024,
-    -0.541981,
-    -0.541937,
-    -0.541892,
-    -0.541845,
-    -0.541798,
-    -0.541748,
-    -0.541698,
-    -0.541646,
-    -0.541593,
-    -0.541539,
-    -0.541484,
-    -0.541427,
-    -0.541369,
-    -0.541309,
-    -0.541249,
-    -0.541187,
-    -0.541124,
-    -0.541059,
-    -0.540994,
-    -0.540927,
-    -0.540858,
-    -0.540789,
-    -0.540718,
-    -0.540646,
-    -0.540573,
-    -0.540498,
-    -0.540422,
-    -0.540345,
-    -0.540267,
-    -0.540187,
-    -0.540106,
-    -0.540024,
-    -0.53994,
-    -0.539855,
-    -0.539769,
-    -0.539682,
-    -0.539594,
-    -0.539504,
-    -0.539413,
-    -0.53932,
-    -0.539226,
-    -0.539132,
-    -0.539035,
-    -0.538938,
-    -0.538839,
-    -0.538739,
-    -0.538638,
-    -0.538535,
-    -0.538432,
-    -0.538326,
-    -0.53822,
-    -0.538112,
-    -0.538004,
-    -0.537893,
-    -0.537782,
-    -0.537669,
-    -0.537555,
-    -0.53744,
-    -0.537324,
-    -0.537206,
-    -0.537087,
-    -0.536967,
-    -0.536845,
-    -0.536722,
-    -0.536598,
-    -0.536473,
-    -0.536346,
-    -0.536219,
-    -0.53609,
-    -0.535959,
-    -0.535828,
-    -0.535695,
-    -0.535561,
-    -0.535425,
-    -0.535289,
-    -0.535151,
-    -0.535011,
-    -0.534871,
-    -0.534729,
-    -0.534586,
-    -0.534442,
-    -0.534297,
-    -0.53415,
-    -0.534002,
-    -0.533853,
-    -0.533702,
-    -0.53355,
-    -0.533397,
-    -0.533243,
-    -0.533088,
-    -0.532931,
-    -0.532773,
-    -0.532614,
-    -0.532453,
-    -0.532291,
-    -0.532128,
-    -0.531964,
-    -0.531798,
-    -0.531631,
-    -0.531463,
-    -0.531294,
-    -0.531124,
-    -0.530952,
-    -0.530779,
-    -0.530604,
-    -0.530429,
-    -0.530252,
-    -0.530074,
-    -0.529895,
-    -0.529714,
-    -0.529532,
-    -0.529349,
-    -0.529165,
-    -0.52898,
-    -0.528793,
-    -0.528605,
-    -0.528416,
-    -0.528225,
-    -0.528033,
-    -0.52784,
-    -0.527646,
-    -0.527451,
-    -0.527254,
-    -0.527056,
-    -0.526857,
-    -0.526656,
-    -0.526455,
-    -0.526252,
-    -0.526048,
-    -0.525842,
-    -0.525636,
-    -0.525428,
-    -0.525219,
-    -0.525008,
-    -0.524797,
-    -0.524584,
-    -0.52437,
-    -0.524155,
-    -0.523938,
-    -0.523721,
-    -0.523502,
-    -0.523281,
-    -0.52306,
-    -0.522837,
-    -0.522613,
-    -0.522388,
-    -0.522162,
-    -0.521934,
-    -0.521706,
-    -0.521475,
-    -0.521244,
-    -0.521012,
-    -0.520778,
-    -0.520543,
-    -0.520307,
-    -0.52007,
-    -0.519831,
-    -0.519591,
-    -0.51935,
-    -0.519108,
-    -0.518864,
-    -0.51862,
-    -0.518374,
-    -0.518126,
-    -0.517878,
-    -0.517628,
-    -0.517378,
-    -0.517126,
-    -0.516872,
-    -0.516618,
-    -0.516362,
-    -0.516105,
-    -0.515847,
-    -0.515588,
-    -0.515327,
-    -0.515066,
-    -0.514803,
-    -0.514538,
-    -0.514273,
-    -0.514006,
-    -0.513739,
-    -0.51347,
-    -0.513199,
-    -0.512928,
-    -0.512655,
-    -0.512381,
-    -0.512106,
-    -0.51183,
-    -0.511553,
-    -0.511274,
-    -0.510994,
-    -0.510713,
-    -0.510431,
-    -0.510147,
-    -0.509863,
-    -0.509577,
-    -0.50929,
-    -0.509001,
-    -0.508712,
-    -0.508421,
-    -0.50813,
-    -0.507836,
-    -0.507542,
-    -0.507247,
-    -0.50695,
-    -0.506652,
-    -0.506353,
-    -0.506053,
-    -0.505752,
-    -0.505449,
-    -0.505145,
-    -0.50484,
-    -0.504534,
-    -0.504227,
-    -0.503918,
-    -0.503609,
-    -0.503298,
-    -0.502986,
-    -0.502672,
-    -0.502358,
-    -0.502042,
-    -0.501725,
-    -0.501407,
-    -0.501088,
-    -0.500768,
-    -0.500446,
-    -0.500124,
-    -0.4998,
-    -0.499475,
-    -0.499148,
-    -0.498821,
-    -0.498492,
-    -0.498163,
-    -0.497832,
-    -0.497499,
-    -0.497166,
-    -0.496832,
-    -0.496496,
-    -0.496159,
-    -0.495821,
-    -0.495482,
-    -0.495142,
-    -0.494801,
-    -0.494458,
-    -0.494114,
-    -0.493769,
-    -0.493423,
-    -0.493076,
-    -0.492727,
-    -0.492378,
-    -0.492027,
-    -0.491675,
-    -0.491322,
-    -0.490968,
-    -0.490613,
-    -0.490256,
-    -0.489898,
-    -0.489539,
-    -0.489179,
-    -0.488818,
-    -0.488456,
-    -0.488093,
-    -0.487728,
-    -0.487362,
-    -0.486995,
-    -0.486627,
-    -0.486258,
-    -0.485888,
-    -0.485516,
-    -0.485144,
-    -0.48477,
-    -0.484395,
-    -0.484019,
-    -0.483642,
-    -0.483264,
-    -0.482884,
-    -0.482504,
-    -0.482122,
-    -0.481739,
-    -0.481355,
-    -0.48097,
-    -0.480584,
-    -0.480197,
-    -0.479808,
-    -0.479418,
-    -0.479028,
-    -0.478636,
-    -0.478243,
-    -0.477849,
-    -0.477453,
-    -0.477057,
-    -0.476659,
-    -0.476261,
-    -0.475861,
-    -0.47546,
-    -0.475058,
-    -0.474655,
-    -0.474251,
-    -0.473846,
-    -0.473439,
-    -0.473032,
-    -0.472623,
-    -0.472213,
-    -0.471802,
-    -0.47139,
-    -0.470977,
-    -0.470563,
-    -0.470147,
-    -0.469731,
-    -0.469313,
-    -0.468895,
-    -0.468475,
-    -0.468054,
-    -0.467632,
-    -0.467209,
-    -0.466785,
-    -0.46636,
-    -0.465933,
-    -0.465506,
-    -0.465077,
-    -0.464648,
-    -0.464217,
-    -0.463785,
-    -0.463352,
-    -0.462918,
-    -0.462483,
-    -0.462047,
-    -0.46161,
-    -0.461171,
-    -0.460732,
-    -0.460291,
-    -0.45985,
-    -0.459407,
-    -0.458963,
-    -0.458518,
-    -0.458072,
-    -0.457625,
-    -0.457177,
-    -0.456728,
-    -0.456278,
-    -0.455827,
-    -0.455374,
-    -0.454921,
-    -0.454466,
-    -0.454011,
-    -0.453554,
-    -0.453096,
-    -0.452637,
-    -0.452178,
-    -0.451717,
-    -0.451255,
-    -0.450792,
-    -0.450327,
-    -0.449862,
-    -0.449396,
-    -0.448929,
-    -0.44846,
-    -0.447991,
-    -0.447521,
-    -0.447049,
-    -0.446577,
-    -0.446103,
-    -0.445628,
-    -0.445153,
-    -0.444676,
-    -0.444198,
-    -0.443719,
-    -0.443239,
-    -0.442758,
-    -0.442276,
-    -0.441793,
-    -0.441309,
-    -0.440824,
-    -0.440338,
-    -0.439851,
-    -0.439363,
-    -0.438873,
-    -0.438383,
-    -0.437892,
-    -0.437399,
-    -0.436906,
-    -0.436412,
-    -0.435916,
-    -0.43542,
-    -0.434922,
-    -0.434424,
-    -0.433924,
-    -0.433424,
-    -0.432922,
-    -0.43242,
-    -0.431916,
-    -0.431412,
-    -0.430906,
-    -0.430399,
-    -0.429892,
-    -0.429383,
-    -0.428873,
-    -0.428363,
-    -0.427851,
-    -0.427338,
-    -0.426824,
-    -0.42631,
-    -0.425794,
-    -0.425277,
-    -0.42476,
-    -0.424241,
-    -0.423721,
-    -0.423201,
-    -0.422679,
-    -0.422156,
-    -0.421632,
-    -0.421108,
-    -0.420582,
-    -0.420055,
-    -0.419528,
-    -0.418999,
-    -0.418469,
-    -0.417939,
-    -0.417407,
-    -0.416875,
-    -0.416341,
-    -0.415807,
-    -0.415271,
-    -0.414735,
-    -0.414197,
-    -0.413659,
-    -0.413119,
-    -0.412579,
-    -0.412038,
-    -0.411495,
-    -0.410952,
-    -0.410408,
-    -0.409862,
-    -0.409316,
-    -0.408769,
-    -0.408221,
-    -0.407672,
-    -0.407122,
-    -0.406571,
-    -0.406019,
-    -0.405466,
-    -0.404912,
-    -0.404357,
-    -0.403802,
-    -0.403245,
-    -0.402687,
-    -0.402129,
-    -0.401569,
-    -0.401008,
-    -0.400447,
-    -0.399885,
-    -0.399321,
-    -0.398757,
-    -0.398192,
-    -0.397626,
-    -0.397059,
-    -0.396491,
-    -0.395922,
-    -0.395352,
-    -0.394781,
-    -0.394209,
-    -0.393637,
-    -0.393063,
-    -0.392488,
-    -0.391913,
-    -0.391337,
-    -0.390759,
-    -0.390181,
-    -0.389602,
-    -0.389022,
-    -0.388441,
-    -0.387859,
-    -0.387276,
-    -0.386693,
-    -0.386108,
-    -0.385523,
-    -0.384936,
-    -0.384349,
-    -0.383761,
-    -0.383171,
-    -0.382581,
-    -0.38199,
-    -0.381399,
-    -0.380806,
-    -0.380212,
-    -0.379618,
-    -0.379022,
-    -0.378426,
-    -0.377829,
-    -0.377231,
-    -0.376632,
-    -0.376032,
-    -0.375431,
-    -0.37483,
-    -0.374227,
-    -0.373624,
-    -0.373019,
-    -0.372414,
-    -0.371808,
-    -0.371201,
-    -0.370593,
-    -0.369985,
-    -0.369375,
-    -0.368765,
-    -0.368154,
-    -0.367542,
-    -0.366929,
-    -0.366315,
-    -0.3657,
-    -0.365084,
-    -0.364468,
-    -0.363851,
-    -0.363233,
-    -0.362614,
-    -0.361994,
-    -0.361373,
-    -0.360752,
-    -0.360129,
-    -0.359506,
-    -0.358882,
-    -0.358257,
-    -0.357631,
-    -0.357004,
-    -0.356377,
-    -0.355749,
-    -0.35512,
-    -0.35449,
-    -0.353859,
-    -0.353227,
-    -0.352595,
-    -0.351961,
-    -0.351327,
-    -0.350692,
-    -0.350056,
-    -0.34942,
-    -0.348782,
-    -0.348144,
-    -0.347505,
-    -0.346865,
-    -0.346225,
-    -0.345583,
-    -0.344941,
-    -0.344298,
-    -0.343654,
-    -0.343009,
-    -0.342363,
-    -0.341717,
-    -0.34107,
-    -0.340422,
-    -0.339773,
-    -0.339123,
-    -0.338473,
-    -0.337822,
-    -0.33717,
-    -0.336517,
-    -0.335864,
-    -0.335209,
-    -0.334554,
-    -0.333898,
-    -0.333241,
-    -0.332584,
-    -0.331926,
-    -0.331267,
-    -0.330607,
-    -0.329946,
-    -0.329285,
-    -0.328623,
-    -0.32796,
-    -0.327296,
-    -0.326631,
-    -0.325966,
-    -0.3253,
-    -0.324633,
-    -0.323966,
-    -0.323298,
-    -0.322628,
-    -0.321959,
-    -0.321288,
-    -0.320617,
-    -0.319945,
-    -0.319272,
-    -0.318598,
-    -0.317924,
-    -0.317249,
-    -0.316573,
-    -0.315896,
-    -0.315219,
-    -0.314541,
-    -0.313862,
-    -0.313183,
-    -0.312502,
-    -0.311821,
-    -0.311139,
-    -0.310457,
-    -0.309774,
-    -0.30909,
-    -0.308405,
-    -0.30772,
-    -0.307034,
-    -0.306347,
-    -0.305659,
-    -0.304971,
-    -0.304282,
-    -0.303592,
-    -0.302902,
-    -0.302211,
-    -0.301519,
-    -0.300826,
-    -0.300133,
-    -0.299439,
-    -0.298744,
-    -0.298049,
-    -0.297353,
-    -0.296656,
-    -0.295958,
-    -0.29526,
-    -0.294561,
-    -0.293862,
-    -0.293162,
-    -0.292461,
-    -0.291759,
-    -0.291057,
-    -0.290354,
-    -0.28965,
-    -0.288945,
-    -0.28824,
-    -0.287535,
-    -0.286828,
-    -0.286121,
-    -0.285413,
-    -0.284705,
-    -0.283996,
-    -0.283286,
-    -0.282576,
-    -0.281865,
-    -0.281153,
-    -0.28044,
-    -0.279727,
-    -0.279014,
-    -0.278299,
-    -0.277584,
-    -0.276868,
-    -0.276152,
-    -0.275435,
-    -0.274717,
-    -0.273999,
-    -0.27328,
-    -0.27256,
-    -0.27184,
-    -0.271119,
-    -0.270398,
-    -0.269676,
-    -0.268953,
-    -0.268229,
-    -0.267505,
-    -0.266781,
-    -0.266055,
-    -0.265329,
-    -0.264603,
-    -0.263876,
-    -0.263148,
-    -0.26242,
-    -0.26169,
-    -0.260961,
-    -0.260231,
-    -0.2595,
-    -0.258768,
-    -0.258036,
-    -0.257303,
-    -0.25657,
-    -0.255836,
-    -0.255102,
-    -0.254366,
-    -0.253631,
-    -0.252894,
-    -0.252158,
-    -0.25142,
-    -0.250682,
-    -0.249943,
-    -0.249204,
-    -0.248464,
-    -0.247724,
-    -0.246983,
-    -0.246241,
-    -0.245499,
-    -0.244756,
-    -0.244013,
-    -0.243269,
-    -0.242524,
-    -0.241779,
-    -0.241034,
-    -0.240287,
-    -0.239541,
-    -0.238793,
-    -0.238046,
-    -0.237297,
-    -0.236548,
-    -0.235799,
-    -0.235048,
-    -0.234298,
-    -0.233547,
-    -0.232795,
-    -0.232042,
-    -0.23129,
-    -0.230536,
-    -0.229782,
-    -0.229028,
-    -0.228273,
-    -0.227517,
-    -0.226761,
-    -0.226004,
-    -0.225247,
-    -0.22449,
-    -0.223731,
-    -0.222973,
-    -0.222213,
-    -0.221453,
-    -0.220693,
-    -0.219932,
-    -0.219171,
-    -0.218409,
-    -0.217647,
-    -0.216884,
-    -0.21612,
-    -0.215356,
-    -0.214592,
-    -0.213827,
-    -0.213062,
-    -0.212296,
-    -0.211529,
-    -0.210762,
-    -0.209995,
-    -0.209227,
-    -0.208459,
-    -0.20769,
-    -0.20692,
-    -0.20615,
-    -0.20538,
-    -0.204609,
-    -0.203838,
-    -0.203066,
-    -0.202294,
-    -0.201521,
-    -0.200748,
-    -0.199974,
-    -0.1992,
-    -0.198425,
-    -0.19765,
-    -0.196875,
-    -0.196099,
-    -0.195322,
-    -0.194545,
-    -0.193768,
-    -0.19299,
-    -0.192211,
-    -0.191433,
-    -0.190653,
-    -0.189874,
-    -0.189094,
-    -0.188313,
-    -0.187532,
-    -0.186751,
-    -0.185969,
-    -0.185186,
-    -0.184403,
-    -0.18362,
-    -0.182837,
-    -0.182053,
-    -0.181268,
-    -0.180483,
-    -0.179698,
-    -0.178912,
-    -0.178126,
-    -0.177339,
-    -0.176552,
-    -0.175765,
-    -0.174977,
-    -0.174189,
-    -0.1734,
-    -0.172611,
-    -0.171821,
-    -0.171031,
-    -0.170241,
-    -0.16945,
-    -0.168659,
-    -0.167868,
-    -0.167076,
-    -0.166284,
-    -0.165491,
-    -0.164698,
-    -0.163904,
-    -0.163111,
-    -0.162316,
-    -0.161522,
-    -0.160727,
-    -0.159931,
-    -0.159136,
-    -0.15834,
-    -0.157543,
-    -0.156746,
-    -0.155949,
-    -0.155151,
-    -0.154353,
-    -0.153555,
-    -0.152756,
-    -0.151957,
-    -0.151158,
-    -0.150358,
-    -0.149558,
-    -0.148758,
-    -0.147957,
-    -0.147156,
-    -0.146354,
-    -0.145552,
-    -0.14475,
-    -0.143948,
-    -0.143145,
-    -0.142342,
-    -0.141538,
-    -0.140734,
-    -0.13993,
-    -0.139125,
-    -0.138321,
-    -0.137515,
-    -0.13671,
-    -0.135904,
-    -0.135098,
-    -0.134291,
-    -0.133485,
-    -0.132677,
-    -0.13187,
-    -0.131062,
-    -0.130254,
-    -0.129446,
-    -0.128637,
-    -0.127828,
-    -0.127019,
-    -0.12621,
-    -0.1254,
-    -0.12459,
-    -0.123779,
-    -0.122968,
-    -0.122157,
-    -0.121346,
-    -0.120535,
-    -0.119723,
-    -0.11891,
-    -0.118098,
-    -0.117285,
-    -0.116472,
-    -0.115659,
-    -0.114846,
-    -0.114032,
-    -0.113218,
-    -0.112403,
-    -0.111589,
-    -0.110774,
-    -0.109959,
-    -0.109143,
-    -0.108328,
-    -0.107512,
-    -0.106696,
-    -0.105879,
-    -0.105063,
-    -0.104246,
-    -0.103429,
-    -0.102611,
-    -0.101794,
-    -0.100976,
-    -0.100158,
-    -0.0993393,
-    -0.0985207,
-    -0.0977019,
-    -0.0968829,
-    -0.0960636,
-    -0.0952441,
-    -0.0944244,
-    -0.0936045,
-    -0.0927843,
-    -0.091964,
-    -0.0911434,
-    -0.0903226,
-    -0.0895015,
-    -0.0886803,
-    -0.0878589,
-    -0.0870372,
-    -0.0862154,
-    -0.0853933,
-    -0.0845711,
-    -0.0837486,
-    -0.082926,
-    -0.0821031,
-    -0.0812801,
-    -0.0804569,
-    -0.0796335,
-    -0.0788099,
-    -0.0779861,
-    -0.0771621,
-    -0.0763379,
-    -0.0755136,
-    -0.0746891,
-    -0.0738644,
-    -0.0730396,
-    -0.0722145,
-    -0.0713893,
-    -0.0705639,
-    -0.0697384,
-    -0.0689127,
-    -0.0680868,
-    -0.0672608,
-    -0.0664346,
-    -0.0656083,
-    -0.0647818,
-    -0.0639552,
-    -0.0631284,
-    -0.0623014,
-    -0.0614743,
-    -0.0606471,
-    -0.0598197,
-    -0.0589922,
-    -0.0581646,
-    -0.0573368,
-    -0.0565088,
-    -0.0556808,
-    -0.0548526,
-    -0.0540242,
-    -0.0531958,
-    -0.0523672,
-    -0.0515385,
-    -0.0507097,
-    -0.0498808,
-    -0.0490517,
-    -0.0482225,
-    -0.0473933,
-    -0.0465639,
-    -0.0457344,
-    -0.0449047,
-    -0.044075,
-    -0.0432452,
-    -0.0424153,
-    -0.0415853,
-    -0.0407551,
-    -0.0399249,
-    -0.0390946,
-    -0.0382642,
-    -0.0374337,
-    -0.0366031,
-    -0.0357725,
-    -0.0349417,
-    -0.0341109,
-    -0.03328,
-    -0.032449,
-    -0.0316179,
-    -0.0307867,
-    -0.0299555,
-    -0.0291242,
-    -0.0282929,
-    -0.0274615,
-    -0.02663,
-    -0.0257984,
-    -0.0249668,
-    -0.0241351,
-    -0.0233034,
-    -0.0224716,
-    -0.0216398,
-    -0.0208079,
-    -0.019976,
-    -0.019144,
-    -0.018312,
-    -0.0174799,
-    -0.0166478,
-    -0.0158157,
-    -0.0149835,
-    -0.0141513,
-    -0.013319,
-    -0.0124867,
-    -0.0116544,
-    -0.0108221,
-    -0.00998969,
-    -0.0091573,
-    -0.00832488,
-    -0.00749245,
-    -0.00666,
-    -0.00582754,
-    -0.00499506,
-    -0.00416256,
-    -0.00333006,
-    -0.00249755,
-    -0.00166504,
-    -0.000832521,
-    0,
-    0.000832521,
-    0.00166504,
-    0.00249755,
-    0.00333006,
-    0.00416256,
-    0.00499506,
-    0.00582754,
-    0.00666,
-    0.00749245,
-    0.00832488,
-    0.0091573,
-    0.00998969,
-    0.0108221,
-    0.0116544,
-    0.0124867,
-    0.013319,
-    0.0141513,
-    0.0149835,
-    0.0158157,
-    0.0166478,
-    0.0174799,
-    0.018312,
-    0.019144,
-    0.019976,
-    0.0208079,
-    0.0216398,
-    0.0224716,
-    0.0233034,
-    0.0241351,
-    0.0249668,
-    0.0257984,
-    0.02663,
-    0.0274615,
-    0.0282929,
-    0.0291242,
-    0.0299555,
-    0.0307867,
-    0.0316179,
-    0.032449,
-    0.03328,
-    0.0341109,
-    0.0349417,
-    0.0357725,
-    0.0366031,
-    0.0374337,
-    0.0382642,
-    0.0390946,
-    0.0399249,
-    0.0407551,
-    0.0415853,
-    0.0424153,
-    0.0432452,
-    0.044075,
-    0.0449047,
-    0.0457344,
-    0.0465639,
-    0.0473933,
-    0.0482225,
-    0.0490517,
-    0.0498808,
-    0.0507097,
-    0.0515385,
-    0.0523672,
-    0.0531958,
-    0.0540242,
-    0.0548526,
-    0.0556808,
-    0.0565088,
-    0.0573368,
-    0.0581646,
-    0.0589922,
-    0.0598197,
-    0.0606471,
-    0.0614743,
-    0.0623014,
-    0.0631284,
-    0.0639552,
-    0.0647818,
-    0.0656083,
-    0.0664346,
-    0.0672608,
-    0.0680868,
-    0.0689127,
-    0.0697384,
-    0.0705639,
-    0.0713893,
-    0.0722145,
-    0.0730396,
-    0.0738644,
-    0.0746891,
-    0.0755136,
-    0.0763379,
-    0.0771621,
-    0.0779861,
-    0.0788099,
-    0.0796335,
-    0.0804569,
-    0.0812801,
-    0.0821031,
-    0.082926,
-    0.0837486,
-    0.0845711,
-    0.0853933,
-    0.0862154,
-    0.0870372,
-    0.0878589,
-    0.0886803,
-    0.0895015,
-    0.0903226,
-    0.0911434,
-    0.091964,
-    0.0927843,
-    0.0936045,
-    0.0944244,
-    0.0952441,
-    0.0960636,
-    0.0968829,
-    0.0977019,
-    0.0985207,
-    0.0993393,
-    0.100158,
-    0.100976,
-    0.101794,
-    0.102611,
-    0.103429,
-    0.104246,
-    0.105063,
-    0.105879,
-    0.106696,
-    0.107512,
-    0.108328,
-    0.109143,
-    0.109959,
-    0.110774,
-    0.111589,
-    0.112403,
-    0.113218,
-    0.114032,
-    0.114846,
-    0.115659,
-    0.116472,
-    0.117285,
-    0.118098,
-    0.11891,
-    0.119723,
-    0.120535,
-    0.121346,
-    0.122157,
-    0.122968,
-    0.123779,
-    0.12459,
-    0.1254,
-    0.12621,
-    0.127019,
-    0.127828,
-    0.128637,
-    0.129446,
-    0.130254,
-    0.131062,
-    0.13187,
-    0.132677,
-    0.133485,
-    0.134291,
-    0.135098,
-    0.135904,
-    0.13671,
-    0.137515,
-    0.138321,
-    0.139125,
-    0.13993,
-    0.140734,
-    0.141538,
-    0.142342,
-    0.143145,
-    0.143948,
-    0.14475,
-    0.145552,
-    0.146354,
-    0.147156,
-    0.147957,
-    0.148758,
-    0.149558,
-    0.150358,
-    0.151158,
-    0.151957,
-    0.152756,
-    0.153555,
-    0.154353,
-    0.155151,
-    0.155949,
-    0.156746,
-    0.157543,
-    0.15834,
-    0.159136,
-    0.159931,
-    0.160727,
-    0.161522,
-    0.162316,
-    0.163111,
-    0.163904,
-    0.164698,
-    0.165491,
-    0.166284,
-    0.167076,
-    0.167868,
-    0.168659,
-    0.16945,
-    0.170241,
-    0.171031,
-    0.171821,
-    0.172611,
-    0.1734,
-    0.174189,
-    0.174977,
-    0.175765,
-    0.176552,
-    0.177339,
-    0.178126,
-    0.178912,
-    0.179698,
-    0.180483,
-    0.181268,
-    0.182053,
-    0.182837,
-    0.18362,
-    0.184403,
-    0.185186,
-    0.185969,
-    0.186751,
-    0.187532,
-    0.188313,
-    0.189094,
-    0.189874,
-    0.190653,
-    0.191433,
-    0.192211,
-    0.19299,
-    0.193768,
-    0.194545,
-    0.195322,
-    0.196099,
-    0.196875,
-    0.19765,
-    0.198425,
-    0.1992,
-    0.199974,
-    0.200748,
-    0.201521,
-    0.202294,
-    0.203066,
-    0.203838,
-    0.204609,
-    0.20538,
-    0.20615,
-    0.20692,
-    0.20769,
-    0.208459,
-    0.209227,
-    0.209995,
-    0.210762,
-    0.211529,
-    0.212296,
-    0.213062,
-    0.213827,
-    0.214592,
-    0.215356,
-    0.21612,
-    0.216884,
-    0.217647,
-    0.218409,
-    0.219171,
-    0.219932,
-    0.220693,
-    0.221453,
-    0.222213,
-    0.222973,
-    0.223731,
-    0.22449,
-    0.225247,
-    0.226004,
-    0.226761,
-    0.227517,
-    0.228273,
-    0.229028,
-    0.229782,
-    0.230536,
-    0.23129,
-    0.232042,
-    0.232795,
-    0.233547,
-    0.234298,
-    0.235048,
-    0.235799,
-    0.236548,
-    0.237297,
-    0.238046,
-    0.238793,
-    0.239541,
-    0.240287,
-    0.241034,
-    0.241779,
-    0.242524,
-    0.243269,
-    0.244013,
-    0.244756,
-    0.245499,
-    0.246241,
-    0.246983,
-    0.247724,
-    0.248464,
-    0.249204,
-    0.249943,
-    0.250682,
-    0.25142,
-    0.252158,
-    0.252894,
-    0.253631,
-    0.254366,
-    0.255102,
-    0.255836,
-    0.25657,
-    0.257303,
-    0.258036,
-    0.258768,
-    0.2595,
-    0.260231,
-    0.260961,
-    0.26169,
-    0.26242,
-    0.263148,
-    0.263876,
-    0.264603,
-    0.265329,
-    0.266055,
-    0.266781,
-    0.267505,
-    0.268229,
-    0.268953,
-    0.269676,
-    0.270398,
-    0.271119,
-    0.27184,
-    0.27256,
-    0.27328,
-    0.273999,
-    0.274717,
-    0.275435,
-    0.276152,
-    0.276868,
-    0.277584,
-    0.278299,
-    0.279014,
-    0.279727,
-    0.28044,
-    0.281153,
-    0.281865,
-    0.282576,
-    0.283286,
-    0.283996,
-    0.284705,
-    0.285413,
-    0.286121,
-    0.286828,
-    0.287535,
-    0.28824,
-    0.288945,
-    0.28965,
-    0.290354,
-    0.291057,
-    0.291759,
-    0.292461,
-    0.293162,
-    0.293862,
-    0.294561,
-    0.29526,
-    0.295958,
-    0.296656,
-    0.297353,
-    0.298049,
-    0.298744,
-    0.299439,
-    0.300133,
-    0.300826,
-    0.301519,
-    0.302211,
-    0.302902,
-    0.303592,
-    0.304282,
-    0.304971,
-    0.305659,
-    0.306347,
-    0.307034,
-    0.30772,
-    0.308405,
-    0.30909,
-    0.309774,
-    0.310457,
-    0.311139,
-    0.311821,
-    0.312502,
-    0.313183,
-    0.313862,
-    0.314541,
-    0.315219,
-    0.315896,
-    0.316573,
-    0.317249,
-    0.317924,
-    0.318598,
-    0.319272,
-    0.319945,
-    0.320617,
-    0.321288,
-    0.321959,
-    0.322628,
-    0.323298,
-    0.323966,
-    0.324633,
-    0.3253,
-    0.325966,
-    0.326631,
-    0.327296,
-    0.32796,
-    0.328623,
-    0.329285,
-    0.329946,
-    0.330607,
-    0.331267,
-    0.331926,
-    0.332584,
-    0.333241,
-    0.333898,
-    0.334554,
-    0.335209,
-    0.335864,
-    0.336517,
-    0.33717,
-    0.337822,
-    0.338473,
-    0.339123,
-    0.339773,
-    0.340422,
-    0.34107,
-    0.341717,
-    0.342363,
-    0.343009,
-    0.343654,
-    0.344298,
-    0.344941,
-    0.345583,
-    0.346225,
-    0.346865,
-    0.347505,
-    0.348144,
-    0.348782,
-    0.34942,
-    0.350056,
-    0.350692,
-    0.351327,
-    0.351961,
-    0.352595,
-    0.353227,
-    0.353859,
-    0.35449,
-    0.35512,
-    0.355749,
-    0.356377,
-    0.357004,
-    0.357631,
-    0.358257,
-    0.358882,
-    0.359506,
-    0.360129,
-    0.360752,
-    0.361373,
-    0.361994,
-    0.362614,
-    0.363233,
-    0.363851,
-    0.364468,
-    0.365084,
-    0.3657,
-    0.366315,
-    0.366929,
-    0.367542,
-    0.368154,
-    0.368765,
-    0.369375,
-    0.369985,
-    0.370593,
-    0.371201,
-    0.371808,
-    0.372414,
-    0.373019,
-    0.373624,
-    0.374227,
-    0.37483,
-    0.375431,
-    0.376032,
-    0.376632,
-    0.377231,
-    0.377829,
-    0.378426,
-    0.379022,
-    0.379618,
-    0.380212,
-    0.380806,
-    0.381399,
-    0.38199,
-    0.382581,
-    0.383171,
-    0.383761,
-    0.384349,
-    0.384936,
-    0.385523,
-    0.386108,
-    0.386693,
-    0.387276,
-    0.387859,
-    0.388441,
-    0.389022,
-    0.389602,
-    0.390181,
-    0.390759,
-    0.391337,
-    0.391913,
-    0.392488,
-    0.393063,
-    0.393637,
-    0.394209,
-    0.394781,
-    0.395352,
-    0.395922,
-    0.396491,
-    0.397059,
-    0.397626,
-    0.398192,
-    0.398757,
-    0.399321,
-    0.399885,
-    0.400447,
-    0.401008,
-    0.401569,
-    0.402129,
-    0.402687,
-    0.403245,
-    0.403802,
-    0.404357,
-    0.404912,
-    0.405466,
-    0.406019,
-    0.406571,
-    0.407122,
-    0.407672,
-    0.408221,
-    0.408769,
-    0.409316,
-    0.409862,
-    0.410408,
-    0.410952,
-    0.411495,
-    0.412038,
-    0.412579,
-    0.413119,
-    0.413659,
-    0.414197,
-    0.414735,
-    0.415271,
-    0.415807,
-    0.416341,
-    0.416875,
-    0.417407,
-    0.417939,
-    0.418469,
-    0.418999,
-    0.419528,
-    0.420055,
-    0.420582,
-    0.421108,
-    0.421632,
-    0.422156,
-    0.422679,
-    0.423201,
-    0.423721,
-    0.424241,
-    0.42476,
-    0.425277,
-    0.425794,
-    0.42631,
-    0.426824,
-    0.427338,
-    0.427851,
-    0.428363,
-    0.428873,
-    0.429383,
-    0.429892,
-    0.430399,
-    0.430906,
-    0.431412,
-    0.431916,
-    0.43242,
-    0.432922,
-    0.433424,
-    0.433924,
-    0.434424,
-    0.434922,
-    0.43542,
-    0.435916,
-    0.436412,
-    0.436906,
-    0.437399,
-    0.437892,
-    0.438383,
-    0.438873,
-    0.439363,
-    0.439851,
-    0.440338,
-    0.440824,
-    0.441309,
-    0.441793,
-    0.442276,
-    0.442758,
-    0.443239,
-    0.443719,
-    0.444198,
-    0.444676,
-    0.445153,
-    0.445628,
-    0.446103,
-    0.446577,
-    0.447049,
-    0.447521,
-    0.447991,
-    0.44846,
-    0.448929,
-    0.449396,
-    0.449862,
-    0.450327,
-    0.450792,
-    0.451255,
-    0.451717,
-    0.452178,
-    0.452637,
-    0.453096,
-    0.453554,
-    0.454011,
-    0.454466,
-    0.454921,
-    0.455374,
-    0.455827,
-    0.456278,
-    0.456728,
-    0.457177,
-    0.457625,
-    0.458072,
-    0.458518,
-    0.458963,
-    0.459407,
-    0.45985,
-    0.460291,
-    0.460732,
-    0.461171,
-    0.46161,
-    0.462047,
-    0.462483,
-    0.462918,
-    0.463352,
-    0.463785,
-    0.464217,
-    0.464648,
-    0.465077,
-    0.465506,
-    0.465933,
-    0.46636,
-    0.466785,
-    0.467209,
-    0.467632,
-    0.468054,
-    0.468475,
-    0.468895,
-    0.469313,
-    0.469731,
-    0.470147,
-    0.470563,
-    0.470977,
-    0.47139,
-    0.471802,
-    0.472213,
-    0.472623,
-    0.473032,
-    0.473439,
-    0.473846,
-    0.474251,
-    0.474655,
-    0.475058,
-    0.47546,
-    0.475861,
-    0.476261,
-    0.476659,
-    0.477057,
-    0.477453,
-    0.477849,
-    0.478243,
-    0.478636,
-    0.479028,
-    0.479418,
-    0.479808,
-    0.480197,
-    0.480584,
-    0.48097,
-    0.481355,
-    0.481739,
-    0.482122,
-    0.482504,
-    0.482884,
-    0.483264,
-    0.483642,
-    0.484019,
-    0.484395,
-    0.48477,
-    0.485144,
-    0.485516,
-    0.485888,
-    0.486258,
-    0.486627,
-    0.486995,
-    0.487362,
-    0.487728,
-    0.488093,
-    0.488456,
-    0.488818,
-    0.489179,
-    0.489539,
-    0.489898,
-    0.490256,
-    0.490613,
-    0.490968,
-    0.491322,
-    0.491675,
-    0.492027,
-    0.492378,
-    0.492727,
-    0.493076,
-    0.493423,
-    0.493769,
-    0.494114,
-    0.494458,
-    0.494801,
-    0.495142,
-    0.495482,
-    0.495821,
-    0.496159,
-    0.496496,
-    0.496832,
-    0.497166,
-    0.497499,
-    0.497832,
-    0.498163,
-    0.498492,
-    0.498821,
-    0.499148,
-    0.499475,
-    0.4998,
-    0.500124,
-    0.500446,
-    0.500768,
-    0.501088,
-    0.501407,
-    0.501725,
-    0.502042,
-    0.502358,
-    0.502672,
-    0.502986,
-    0.503298,
-    0.503609,
-    0.503918,
-    0.504227,
-    0.504534,
-    0.50484,
-    0.505145,
-    0.505449,
-    0.505752,
-    0.506053,
-    0.506353,
-    0.506652,
-    0.50695,
-    0.507247,
-    0.507542,
-    0.507836,
-    0.50813,
-    0.508421,
-    0.508712,
-    0.509001,
-    0.50929,
-    0.509577,
-    0.509863,
-    0.510147,
-    0.510431,
-    0.510713,
-    0.510994,
-    0.511274,
-    0.511553,
-    0.51183,
-    0.512106,
-    0.512381,
-    0.512655,
-    0.512928,
-    0.513199,
-    0.51347,
-    0.513739,
-    0.514006,
-    0.514273,
-    0.514538,
-    0.514803,
-    0.515066,
-    0.515327,
-    0.515588,
-    0.515847,
-    0.516105,
-    0.516362,
-    0.516618,
-    0.516872,
-    0.517126,
-    0.517378,
-    0.517628,
-    0.517878,
-    0.518126,
-    0.518374,
-    0.51862,
-    0.518864,
-    0.519108,
-    0.51935,
-    0.519591,
-    0.519831,
-    0.52007,
-    0.520307,
-    0.520543,
-    0.520778,
-    0.521012,
-    0.521244,
-    0.521475,
-    0.521706,
-    0.521934,
-    0.522162,
-    0.522388,
-    0.522613,
-    0.522837,
-    0.52306,
-    0.523281,
-    0.523502,
-    0.523721,
-    0.523938,
-    0.524155,
-    0.52437,
-    0.524584,
-    0.524797,
-    0.525008,
-    0.525219,
-    0.525428,
-    0.525636,
-    0.525842,
-    0.526048,
-    0.526252,
-    0.526455,
-    0.526656,
-    0.526857,
-    0.527056,
-    0.527254,
-    0.527451,
-    0.527646,
-    0.52784,
-    0.528033,
-    0.528225,
-    0.528416,
-    0.528605,
-    0.528793,
-    0.52898,
-    0.529165,
-    0.529349,
-    0.529532,
-    0.529714,
-    0.529895,
-    0.530074,
-    0.530252,
-    0.530429,
-    0.530604,
-    0.530779,
-    0.530952,
-    0.531124,
-    0.531294,
-    0.531463,
-    0.531631,
-    0.531798,
-    0.531964,
-    0.532128,
-    0.532291,
-    0.532453,
-    0.532614,
-    0.532773,
-    0.532931,
-    0.533088,
-    0.533243,
-    0.533397,
-    0.53355,
-    0.533702,
-    0.533853,
-    0.534002,
-    0.53415,
-    0.534297,
-    0.534442,
-    0.534586,
-    0.534729,
-    0.534871,
-    0.535011,
-    0.535151,
-    0.535289,
-    0.535425,
-    0.535561,
-    0.535695,
-    0.535828,
-    0.535959,
-    0.53609,
-    0.536219,
-    0.536346,
-    0.536473,
-    0.536598,
-    0.536722,
-    0.536845,
-    0.536967,
-    0.537087,
-    0.537206,
-    0.537324,
-    0.53744,
-    0.537555,
-    0.537669,
-    0.537782,
-    0.537893,
-    0.538004,
-    0.538112,
-    0.53822,
-    0.538326,
-    0.538432,
-    0.538535,
-    0.538638,
-    0.538739,
-    0.538839,
-    0.538938,
-    0.539035,
-    0.539132,
-    0.539226,
-    0.53932,
-    0.539413,
-    0.539504,
-    0.539594,
-    0.539682,
-    0.539769,
-    0.539855,
-    0.53994,
-    0.540024,
-    0.540106,
-    0.540187,
-    0.540267,
-    0.540345,
-    0.540422,
-    0.540498,
-    0.540573,
-    0.540646,
-    0.540718,
-    0.540789,
-    0.540858,
-    0.540927,
-    0.540994,
-    0.541059,
-    0.541124,
-    0.541187,
-    0.541249,
-    0.541309,
-    0.541369,
-    0.541427,
-    0.541484,
-    0.541539,
-    0.541593,
-    0.541646,
-    0.541698,
-    0.541748,
-    0.541798,
-    0.541845,
-    0.541892,
-    0.541937,
-    0.541981,
-    0.542024,
-    0.542066,
-    0.542106,
-    0.542145,
-    0.542182,
-    0.542219,
-    0.542254,
-    0.542288,
-    0.54232,
-    0.542352,
-    0.542382,
-    0.54241,
-    0.542438,
-    0.542464,
-    0.542489,
-    0.542512,
-    0.542535,
-    0.542556,
-    0.542576,
-    0.542594,
-    0.542611,
-    0.542627,
-    0.542642,
-    0.542656,
-    0.542668,
-    0.542678,
-    0.542688,
-    0.542696,
-    0.542703,
-    0.542709,
-    0.542714,
-    0.542717,
-    0.542719,
-    0.542719,
-    0.542719,
-    0.542717,
-    0.542714,
-    0.542709,
-    0.542703,
-    0.542696,
-    0.542688,
-    0.542678,
-    0.542668,
-    0.542656,
-    0.542642,
-    0.542627,
-    0.542611,
-    0.542594,
-    0.542576,
-    0.542556,
-    0.542535,
-    0.542512,
-    0.542489,
-    0.542464,
-    0.542438,
-    0.54241,
-    0.542382,
-    0.542352,
-    0.54232,
-    0.542288,
-    0.542254,
-    0.542219,
-    0.542182,
-    0.542145,
-    0.542106,
-    0.542066,
-    0.542024,
-    0.541981,
-    0.541937,
-    0.541892,
-    0.541845,
-    0.541798,
-    0.541748,
-    0.541698,
-    0.541646,
-    0.541593,
-    0.541539,
-    0.541484,
-    0.541427,
-    0.541369,
-    0.541309,
-    0.541249,
-    0.541187,
-    0.541124,
-    0.541059,
-    0.540994,
-    0.540927,
-    0.540858,
-    0.540789,
-    0.540718,
-    0.540646,
-    0.540573,
-    0.540498,
-    0.540422,
-    0.540345,
-    0.540267,
-    0.540187,
-    0.540106,
-    0.540024,
-    0.53994,
-    0.539855,
-    0.539769,
-    0.539682,
-    0.539594,
-    0.539504,
-    0.539413,
-    0.53932,
-    0.539226,
-    0.539132,
-    0.539035,
-    0.538938,
-    0.538839,
-    0.538739,
-    0.538638,
-    0.538535,
-    0.538432,
-    0.538326,
-    0.53822,
-    0.538112,
-    0.538004,
-    0.537893,
-    0.537782,
-    0.537669,
-    0.537555,
-    0.53744,
-    0.537324,
-    0.537206,
-    0.537087,
-    0.536967,
-    0.536845,
-    0.536722,
-    0.536598,
-    0.536473,
-    0.536346,
-    0.536219,
-    0.53609,
-    0.535959,
-    0.535828,
-    0.535695,
-    0.535561,
-    0.535425,
-    0.535289,
-    0.535151,
-    0.535011,
-    0.534871,
-    0.534729,
-    0.534586,
-    0.534442,
-    0.534297,
-    0.53415,
-    0.534002,
-    0.533853,
-    0.533702,
-    0.53355,
-    0.533397,
-    0.533243,
-    0.533088,
-    0.532931,
-    0.532773,
-    0.532614,
-    0.532453,
-    0.532291,
-    0.532128,
-    0.531964,
-    0.531798,
-    0.531631,
-    0.531463,
-    0.531294,
-    0.531124,
-    0.530952,
-    0.530779,
-    0.530604,
-    0.530429,
-    0.530252,
-    0.530074,
-    0.529895,
-    0.529714,
-    0.529532,
-    0.529349,
-    0.529165,
-    0.52898,
-    0.528793,
-    0.528605,
-    0.528416,
-    0.528225,
-    0.528033,
-    0.52784,
-    0.527646,
-    0.527451,
-    0.527254,
-    0.527056,
-    0.526857,
-    0.526656,
-    0.526455,
-    0.526252,
-    0.526048,
-    0.525842,
-    0.525636,
-    0.525428,
-    0.525219,
-    0.525008,
-    0.524797,
-    0.524584,
-    0.52437,
-    0.524155,
-    0.523938,
-    0.523721,
-    0.523502,
-    0.523281,
-    0.52306,
-    0.522837,
-    0.522613,
-    0.522388,
-    0.522162,
-    0.521934,
-    0.521706,
-    0.521475,
-    0.521244,
-    0.521012,
-    0.520778,
-    0.520543,
-    0.520307,
-    0.52007,
-    0.519831,
-    0.519591,
-    0.51935,
-    0.519108,
-    0.518864,
-    0.51862,
-    0.518374,
-    0.518126,
-    0.517878,
-    0.517628,
-    0.517378,
-    0.517126,
-    0.516872,
-    0.516618,
-    0.516362,
-    0.516105,
-    0.515847,
-    0.515588,
-    0.515327,
-    0.515066,
-    0.514803,
-    0.514538,
-    0.514273,
-    0.514006,
-    0.513739,
-    0.51347,
-    0.513199,
-    0.512928,
-    0.512655,
-    0.512381,
-    0.512106,
-    0.51183,
-    0.511553,
-    0.511274,
-    0.510994,
-    0.510713,
-    0.510431,
-    0.510147,
-    0.509863,
-    0.509577,
-    0.50929,
-    0.509001,
-    0.508712,
-    0.508421,
-    0.50813,
-    0.507836,
-    0.507542,
-    0.507247,
-    0.50695,
-    0.506652,
-    0.506353,
-    0.506053,
-    0.505752,
-    0.505449,
-    0.505145,
-    0.50484,
-    0.504534,
-    0.504227,
-    0.503918,
-    0.503609,
-    0.503298,
-    0.502986,
-    0.502672,
-    0.502358,
-    0.502042,
-    0.501725,
-    0.501407,
-    0.501088,
-    0.500768,
-    0.500446,
-    0.500124,
-    0.4998,
-    0.499475,
-    0.499148,
-    0.498821,
-    0.498492,
-    0.498163,
-    0.497832,
-    0.497499,
-    0.497166,
-    0.496832,
-    0.496496,
-    0.496159,
-    0.495821,
-    0.495482,
-    0.495142,
-    0.494801,
-    0.494458,
-    0.494114,
-    0.493769,
-    0.493423,
-    0.493076,
-    0.492727,
-    0.492378,
-    0.492027,
-    0.491675,
-    0.491322,
-    0.490968,
-    0.490613,
-    0.490256,
-    0.489898,
-    0.489539,
-    0.489179,
-    0.488818,
-    0.488456,
-    0.488093,
-    0.487728,
-    0.487362,
-    0.486995,
-    0.486627,
-    0.486258,
-    0.485888,
-    0.485516,
-    0.485144,
-    0.48477,
-    0.484395,
-    0.484019,
-    0.483642,
-    0.483264,
-    0.482884,
-    0.482504,
-    0.482122,
-    0.481739,
-    0.481355,
-    0.48097,
-    0.480584,
-    0.480197,
-    0.479808,
-    0.479418,
-    0.479028,
-    0.478636,
-    0.478243,
-    0.477849,
-    0.477453,
-    0.477057,
-    0.476659,
-    0.476261,
-    0.475861,
-    0.47546,
-    0.475058,
-    0.474655,
-    0.474251,
-    0.473846,
-    0.473439,
-    0.473032,
-    0.472623,
-    0.472213,
-    0.471802,
-    0.47139,
-    0.470977,
-    0.470563,
-    0.470147,
-    0.469731,
-    0.469313,
-    0.468895,
-    0.468475,
-    0.468054,
-    0.467632,
-    0.467209,
-    0.466785,
-    0.46636,
-    0.465933,
-    0.465506,
-    0.465077,
-    0.464648,
-    0.464217,
-    0.463785,
-    0.463352,
-    0.462918,
-    0.462483,
-    0.462047,
-    0.46161,
-    0.461171,
-    0.460732,
-    0.460291,
-    0.45985,
-    0.459407,
-    0.458963,
-    0.458518,
-    0.458072,
-    0.457625,
-    0.457177,
-    0.456728,
-    0.456278,
-    0.455827,
-    0.455374,
-    0.454921,
-    0.454466,
-    0.454011,
-    0.453554,
-    0.453096,
-    0.452637,
-    0.452178,
-    0.451717,
-    0.451255,
-    0.450792,
-    0.450327,
-    0.449862,
-    0.449396,
-    0.448929,
-    0.44846,
-    0.447991,
-    0.447521,
-    0.447049,
-    0.446577,
-    0.446103,
-    0.445628,
-    0.445153,
-    0.444676,
-    0.444198,
-    0.443719,
-    0.443239,
-    0.442758,
-    0.442276,
-    0.441793,
-    0.441309,
-    0.440824,
-    0.440338,
-    0.439851,
-    0.439363,
-    0.438873,
-    0.438383,
-    0.437892,
-    0.437399,
-    0.436906,
-    0.436412,
-    0.435916,
-    0.43542,
-    0.434922,
-    0.434424,
-    0.433924,
-    0.433424,
-    0.432922,
-    0.43242,
-    0.431916,
-    0.431412,
-    0.430906,
-    0.430399,
-    0.429892,
-    0.429383,
-    0.428873,
-    0.428363,
-    0.427851,
-    0.427338,
-    0.426824,
-    0.42631,
-    0.425794,
-    0.425277,
-    0.42476,
-    0.424241,
-    0.423721,
-    0.423201,
-    0.422679,
-    0.422156,
-    0.421632,
-    0.421108,
-    0.420582,
-    0.420055,
-    0.419528,
-    0.418999,
-    0.418469,
-    0.417939,
-    0.417407,
-    0.416875,
-    0.416341,
-    0.415807,
-    0.415271,
-    0.414735,
-    0.414197,
-    0.413659,
-    0.413119,
-    0.412579,
-    0.412038,
-    0.411495,
-    0.410952,
-    0.410408,
-    0.409862,
-    0.409316,
-    0.408769,
-    0.408221,
-    0.407672,
-    0.407122,
-    0.406571,
-    0.406019,
-    0.405466,
-    0.404912,
-    0.404357,
-    0.403802,
-    0.403245,
-    0.402687,
-    0.402129,
-    0.401569,
-    0.401008,
-    0.400447,
-    0.399885,
-    0.399321,
-    0.398757,
-    0.398192,
-    0.397626,
-    0.397059,
-    0.396491,
-    0.395922,
-    0.395352,
-    0.394781,
-    0.394209,
-    0.393637,
-    0.393063,
-    0.392488,
-    0.391913,
-    0.391337,
-    0.390759,
-    0.390181,
-    0.389602,
-    0.389022,
-    0.388441,
-    0.387859,
-    0.387276,
-    0.386693,
-    0.386108,
-    0.385523,
-    0.384936,
-    0.384349,
-    0.383761,
-    0.383171,
-    0.382581,
-    0.38199,
-    0.381399,
-    0.380806,
-    0.380212,
-    0.379618,
-    0.379022,
-    0.378426,
-    0.377829,
-    0.377231,
-    0.376632,
-    0.376032,
-    0.375431,
-    0.37483,
-    0.374227,
-    0.373624,
-    0.373019,
-    0.372414,
-    0.371808,
-    0.371201,
-    0.370593,
-    0.369985,
-    0.369375,
-    0.368765,
-    0.368154,
-    0.367542,
-    0.366929,
-    0.366315,
-    0.3657,
-    0.365084,
-    0.364468,
-    0.363851,
-    0.363233,
-    0.362614,
-    0.361994,
-    0.361373,
-    0.360752,
-    0.360129,
-    0.359506,
-    0.358882,
-    0.358257,
-    0.357631,
-    0.357004,
-    0.356377,
-    0.355749,
-    0.35512,
-    0.35449,
-    0.353859,
-    0.353227,
-    0.352595,
-    0.351961,
-    0.351327,
-    0.350692,
-    0.350056,
-    0.34942,
-    0.348782,
-    0.348144,
-    0.347505,
-    0.346865,
-    0.346225,
-    0.345583,
-    0.344941,
-    0.344298,
-    0.343654,
-    0.343009,
-    0.342363,
-    0.341717,
-    0.34107,
-    0.340422,
-    0.339773,
-    0.339123,
-    0.338473,
-    0.337822,
-    0.33717,
-    0.336517,
-    0.335864,
-    0.335209,
-    0.334554,
-    0.333898,
-    0.333241,
-    0.332584,
-    0.331926,
-    0.331267,
-    0.330607,
-    0.329946,
-    0.329285,
-    0.328623,
-    0.32796,
-    0.327296,
-    0.326631,
-    0.325966,
-    0.3253,
-    0.324633,
-    0.323966,
-    0.323298,
-    0.322628,
-    0.321959,
-    0.321288,
-    0.320617,
-    0.319945,
-    0.319272,
-    0.318598,
-    0.317924,
-    0.317249,
-    0.316573,
-    0.315896,
-    0.315219,
-    0.314541,
-    0.313862,
-    0.313183,
-    0.312502,
-    0.311821,
-    0.311139,
-    0.310457,
-    0.309774,
-    0.30909,
-    0.308405,
-    0.30772,
-    0.307034,
-    0.306347,
-    0.305659,
-    0.304971,
-    0.304282,
-    0.303592,
-    0.302902,
-    0.302211,
-    0.301519,
-    0.300826,
-    0.300133,
-    0.299439,
-    0.298744,
-    0.298049,
-    0.297353,
-    0.296656,
-    0.295958,
-    0.29526,
-    0.294561,
-    0.293862,
-    0.293162,
-    0.292461,
-    0.291759,
-    0.291057,
-    0.290354,
-    0.28965,
-    0.288945,
-    0.28824,
-    0.287535,
-    0.286828,
-    0.286121,
-    0.285413,
-    0.284705,
-    0.283996,
-    0.283286,
-    0.282576,
-    0.281865,
-    0.281153,
-    0.28044,
-    0.279727,
-    0.279014,
-    0.278299,
-    0.277584,
-    0.276868,
-    0.276152,
-    0.275435,
-    0.274717,
-    0.273999,
-    0.27328,
-    0.27256,
-    0.27184,
-    0.271119,
-    0.270398,
-    0.269676,
-    0.268953,
-    0.268229,
-    0.267505,
-    0.266781,
-    0.266055,
-    0.265329,
-    0.264603,
-    0.263876,
-    0.263148,
-    0.26242,
-    0.26169,
-    0.260961,
-    0.260231,
-    0.2595,
-    0.258768,
-    0.258036,
-    0.257303,
-    0.25657,
-    0.255836,
-    0.255102,
-    0.254366,
-    0.253631,
-    0.252894,
-    0.252158,
-    0.25142,
-    0.250682,
-    0.249943,
-    0.249204,
-    0.248464,
-    0.247724,
-    0.246983,
-    0.246241,
-    0.245499,
-    0.244756,
-    0.244013,
-    0.243269,
-    0.242524,
-    0.241779,
-    0.241034,
-    0.240287,
-    0.239541,
-    0.238793,
-    0.238046,
-    0.237297,
-    0.236548,
-    0.235799,
-    0.235048,
-    0.234298,
-    0.233547,
-    0.232795,
-    0.232042,
-    0.23129,
-    0.230536,
-    0.229782,
-    0.229028,
-    0.228273,
-    0.227517,
-    0.226761,
-    0.226004,
-    0.225247,
-    0.22449,
-    0.223731,
-    0.222973,
-    0.222213,
-    0.221453,
-    0.220693,
-    0.219932,
-    0.219171,
-    0.218409,
-    0.217647,
-    0.216884,
-    0.21612,
-    0.215356,
-    0.214592,
-    0.213827,
-    0.213062,
-    0.212296,
-    0.211529,
-    0.210762,
-    0.209995,
-    0.209227,
-    0.208459,
-    0.20769,
-    0.20692,
-    0.20615,
-    0.20538,
-    0.204609,
-    0.203838,
-    0.203066,
-    0.202294,
-    0.201521,
-    0.200748,
-    0.199974,
-    0.1992,
-    0.198425,
-    0.19765,
-    0.196875,
-    0.196099,
-    0.195322,
-    0.194545,
-    0.193768,
-    0.19299,
-    0.192211,
-    0.191433,
-    0.190653,
-    0.189874,
-    0.189094,
-    0.188313,
-    0.187532,
-    0.186751,
-    0.185969,
-    0.185186,
-    0.184403,
-    0.18362,
-    0.182837,
-    0.182053,
-    0.181268,
-    0.180483,
-    0.179698,
-    0.178912,
-    0.178126,
-    0.177339,
-    0.176552,
-    0.175765,
-    0.174977,
-    0.174189,
-    0.1734,
-    0.172611,
-    0.171821,
-    0.171031,
-    0.170241,
-    0.16945,
-    0.168659,
-    0.167868,
-    0.167076,
-    0.166284,
-    0.165491,
-    0.164698,
-    0.163904,
-    0.163111,
-    0.162316,
-    0.161522,
-    0.160727,
-    0.159931,
-    0.159136,
-    0.15834,
-    0.157543,
-    0.156746,
-    0.155949,
-    0.155151,
-    0.154353,
-    0.153555,
-    0.152756,
-    0.151957,
-    0.151158,
-    0.150358,
-    0.149558,
-    0.148758,
-    0.147957,
-    0.147156,
-    0.146354,
-    0.145552,
-    0.14475,
-    0.143948,
-    0.143145,
-    0.142342,
-    0.141538,
-    0.140734,
-    0.13993,
-    0.139125,
-    0.138321,
-    0.137515,
-    0.13671,
-    0.135904,
-    0.135098,
-    0.134291,
-    0.133485,
-    0.132677,
-    0.13187,
-    0.131062,
-    0.130254,
-    0.129446,
-    0.128637,
-    0.127828,
-    0.127019,
-    0.12621,
-    0.1254,
-    0.12459,
-    0.123779,
-    0.122968,
-    0.122157,
-    0.121346,
-    0.120535,
-    0.119723,
-    0.11891,
-    0.118098,
-    0.117285,
-    0.116472,
-    0.115659,
-    0.114846,
-    0.114032,
-    0.113218,
-    0.112403,
-    0.111589,
-    0.110774,
-    0.109959,
-    0.109143,
-    0.108328,
-    0.107512,
-    0.106696,
-    0.105879,
-    0.105063,
-    0.104246,
-    0.103429,
-    0.102611,
-    0.101794,
-    0.100976,
-    0.100158,
-    0.0993393,
-    0.0985207,
-    0.0977019,
-    0.0968829,
-    0.0960636,
-    0.0952441,
-    0.0944244,
-    0.0936045,
-    0.0927843,
-    0.091964,
-    0.0911434,
-    0.0903226,
-    0.0895015,
-    0.0886803,
-    0.0878589,
-    0.0870372,
-    0.0862154,
-    0.0853933,
-    0.0845711,
-    0.0837486,
-    0.082926,
-    0.0821031,
-    0.0812801,
-    0.0804569,
-    0.0796335,
-    0.0788099,
-    0.0779861,
-    0.0771621,
-    0.0763379,
-    0.0755136,
-    0.0746891,
-    0.0738644,
-    0.0730396,
-    0.0722145,
-    0.0713893,
-    0.0705639,
-    0.0697384,
-    0.0689127,
-    0.0680868,
-    0.0672608,
-    0.0664346,
-    0.0656083,
-    0.0647818,
-    0.0639552,
-    0.0631284,
-    0.0623014,
-    0.0614743,
-    0.0606471,
-    0.0598197,
-    0.0589922,
-    0.0581646,
-    0.0573368,
-    0.0565088,
-    0.0556808,
-    0.0548526,
-    0.0540242,
-    0.0531958,
-    0.0523672,
-    0.0515385,
-    0.0507097,
-    0.0498808,
-    0.0490517,
-    0.0482225,
-    0.0473933,
-    0.0465639,
-    0.0457344,
-    0.0449047,
-    0.044075,
-    0.0432452,
-    0.0424153,
-    0.0415853,
-    0.0407551,
-    0.0399249,
-    0.0390946,
-    0.0382642,
-    0.0374337,
-    0.0366031,
-    0.0357725,
-    0.0349417,
-    0.0341109,
-    0.03328,
-    0.032449,
-    0.0316179,
-    0.0307867,
-    0.0299555,
-    0.0291242,
-    0.0282929,
-    0.0274615,
-    0.02663,
-    0.0257984,
-    0.0249668,
-    0.0241351,
-    0.0233034,
-    0.0224716,
-    0.0216398,
-    0.0208079,
-    0.019976,
-    0.019144,
-    0.018312,
-    0.0174799,
-    0.0166478,
-    0.0158157,
-    0.0149835,
-    0.0141513,
-    0.013319,
-    0.0124867,
-    0.0116544,
-    0.0108221,
-    0.00998969,
-    0.0091573,
-    0.00832488,
-    0.00749245,
-    0.00666,
-    0.00582754,
-    0.00499506,
-    0.00416256,
-    0.00333006,
-    0.00249755,
-    0.00166504,
-    0.000832521
-};
-
-constexpr static std::array<std::array<float, 4096>, 10> wt_sawtooth =
-{
-    wt_sawtooth_0x1,
-    wt_sawtooth_0x2,
-    wt_sawtooth_0x3,
-    wt_sawtooth_0x4,
-    wt_sawtooth_0x5,
-    wt_sawtooth_0x6,
-    wt_sawtooth_0x7,
-    wt_sawtooth_0x8,
-    wt_sawtooth_0x9,
-    wt_sawtooth_0xA
-};
-
-#endif
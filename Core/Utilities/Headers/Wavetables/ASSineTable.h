@@ -1,532 +0,0 @@
-//  Assemble
-//  Created by David Spry on 28/4/20.
-//  Copyright © 2020 David Spry. All rights reserved.
-
-#ifndef ASSINETABLE_H
-#define ASSINETABLE_H
-
-#include <array>
-
-/// \brief The number of samples in the sine wavetable.
-
-constexpr static int kSineTableLength = 512;
-
-/// \brief One period of the sine function sampled 512 times.
-
-constexpr static std::array<float, 512> wt_sine =
-{
-    0.0,
-    0.012295551828511666,
-    0.024589244737924121,
-    0.036879220090181269,
-    0.049163619809270781,
-    0.061440586662139689,
-    0.073708264539482662,
-    0.085964798736360301,
-    0.098208336232605081,
-    0.11043702597297274,
-    0.12264901914699637,
-    0.13484246946850131,
-    0.14701553345473842,
-    0.15916637070509318,
-    0.17129314417932939,
-    0.18339402047532427,
-    0.19546717010625381,
-    0.20751076777718619,
-    0.21952299266104139,
-    0.23150202867387518,
-    0.2434460647494463,
-    0.25535329511302479,
-    0.26722191955440056,
-    0.27905014370005027,
-    0.29083617928442218,
-    0.30257824442029746,
-    0.31427456386818708,
-    0.32592336930472382,
-    0.33752289959000836,
-    0.34907140103386958,
-    0.36056712766099874,
-    0.37200834147491668,
-    0.3833933127207354,
-    0.39472032014667302,
-    0.40598765126428382,
-    0.41719360260736282,
-    0.42833647998948654,
-    0.43941459876015088,
-    0.45042628405946727,
-    0.46136987107137845,
-    0.47224370527535575,
-    0.48304614269654028,
-    0.49377555015428903,
-    0.50443030550908974,
-    0.51500879790780607,
-    0.52550942802721656,
-    0.53593060831581019,
-    0.54627076323380275,
-    0.55652832949133679,
-    0.56670175628482955,
-    0.57678950553143327,
-    0.58679005210157231,
-    0.59670188404952196,
-    0.60652350284199352,
-    0.61625342358469237,
-    0.62589017524681378,
-    0.63543230088344238,
-    0.64487835785582204,
-    0.65422691804946387,
-    0.66347656809005673,
-    0.67262590955715051,
-    0.68167355919557837,
-    0.69061814912458541,
-    0.69945832704463395,
-    0.70819275644185242,
-    0.71682011679009838,
-    0.7253391037506034,
-    0.73374842936917195,
-    0.74204682227090157,
-    0.7502330278523982,
-    0.75830580847145446,
-    0.76626394363416428,
-    0.77410623017944535,
-    0.78183148246094003,
-    0.78943853252626894,
-    0.79692623029360976,
-    0.80429344372557343,
-    0.81153905900035284,
-    0.81866198068011742,
-    0.82566113187662848,
-    0.83253545441404986,
-    0.83928390898892968,
-    0.84590547532732863,
-    0.8523991523390716,
-    0.85876395826909879,
-    0.86499893084589352,
-    0.8711031274269645,
-    0.87707562514136084,
-    0.8829155210291969,
-    0.88862193217816798,
-    0.89419399585703419,
-    0.8996308696460541,
-    0.90493173156434636,
-    0.9100957801941626,
-    0.91512223480205057,
-    0.92001033545689015,
-    0.92475934314478492,
-    0.92936853988079071,
-    0.93383722881746523,
-    0.93816473435022141,
-    0.94235040221947042,
-    0.94639359960953584,
-    0.95029371524432737,
-    0.95405015947975724,
-    0.9576623643928861,
-    0.96112978386778547,
-    0.96445189367810291,
-    0.96762819156631774,
-    0.97065819731967562,
-    0.97354145284279026,
-    0.97627752222690101,
-    0.97886599181577605,
-    0.98130647026825224,
-    0.9835985886173999,
-    0.98574200032630566,
-    0.9877363813404646,
-    0.98958143013677202,
-    0.99127686776911061,
-    0.99282243791052216,
-    0.99421790689196177,
-    0.9954630637376245,
-    0.99655772019684274,
-    0.99750171077254668,
-    0.99829489274628525,
-    0.99893714619980356,
-    0.99942837403317231,
-    0.99976850197946865,
-    0.99995747861600359,
-    0.99999527537209698,
-    0.99988188653339682,
-    0.99961732924274305,
-    0.99920164349757601,
-    0.99863489214388934,
-    0.99791716086672833,
-    0.9970485581772357,
-    0.99602921539624611,
-    0.99485928663443224,
-    0.99353894876900573,
-    0.99206840141697494,
-    0.99044786690496656,
-    0.98867759023561208,
-    0.98675783905050729,
-    0.98468890358974825,
-    0.9824710966480511,
-    0.9801047535274614,
-    0.97759023198666184,
-    0.97492791218688313,
-    0.97211819663442955,
-    0.96916151011982499,
-    0.9660582996535908,
-    0.96280903439866361,
-    0.95941420559946466,
-    0.95587432650763016,
-    0.95218993230441451,
-    0.94836158001977866,
-    0.94438984844817431,
-    0.94027533806103858,
-    0.93601867091601054,
-    0.93162049056288487,
-    0.92708146194631591,
-    0.92240227130528718,
-    0.91758362606936106,
-    0.91262625475172576,
-    0.90753090683905357,
-    0.90229835267818881,
-    0.89692938335968231,
-    0.8914248105981889,
-    0.88578546660974755,
-    0.88001220398596158,
-    0.87410589556509843,
-    0.86806743430012878,
-    0.86189773312372375,
-    0.85559772481023244,
-    0.84916836183465905,
-    0.84261061622866151,
-    0.83592547943359419,
-    0.82911396215061484,
-    0.82217709418788076,
-    0.8151159243048558,
-    0.80793152005375268,
-    0.80062496761813295,
-    0.79319737164869175,
-    0.78564985509624885,
-    0.77798355904197491,
-    0.77019964252487461,
-    0.76229928236655653,
-    0.75428367299331345,
-    0.74615402625554172,
-    0.73791157124452589,
-    0.7295575541066166,
-    0.72109323785483148,
-    0.7125199021779034,
-    0.7038388432468099,
-    0.69505137351880997,
-    0.68615882153901797,
-    0.67716253173954621,
-    0.66806386423624486,
-    0.65886419462307144,
-    0.64956491376411973,
-    0.64016742758333989,
-    0.63067315685198244,
-    0.6210835369737967,
-    0.61140001776801767,
-    0.60162406325017326,
-    0.59175715141074459,
-    0.58180077399171504,
-    0.57175643626103845,
-    0.5616256567850636,
-    0.55140996719894764,
-    0.54111091197509398,
-    0.53073004818964908,
-    0.52026894528709389,
-    0.50972918484296514,
-    0.49911236032474326,
-    0.4884200768509413,
-    0.47765395094843355,
-    0.4668156103080584,
-    0.45590669353853391,
-    0.44492884991872272,
-    0.43388373914828349,
-    0.42277303109674713,
-    0.41159840555105537,
-    0.40036155196159989,
-    0.38906416918680076,
-    0.37770796523626204,
-    0.36629465701254443,
-    0.35482597005159272,
-    0.34330363826185867,
-    0.33172940366215775,
-    0.32010501611829967,
-    0.30843223307853262,
-    0.29671281930784121,
-    0.28494854662113817,
-    0.27314119361539019,
-    0.26129254540071833,
-    0.24940439333051395,
-    0.23747853473061042,
-    0.22551677262755224,
-    0.21352091547600202,
-    0.20149277688532691,
-    0.18943417534540569,
-    0.17734693395169795,
-    0.1652328801296172,
-    0.15309384535824888,
-    0.14093166489345607,
-    0.12874817749041373,
-    0.11654522512561423,
-    0.1043246527183856,
-    0.092088307851965118,
-    0.079838040494169898,
-    0.067575702717707173,
-    0.055303148420166225,
-    0.043022233043734426,
-    0.030734813294679818,
-    0.018442746862642544,
-    0.0061478921397775752,
-    -0.0061478920602087064,
-    -0.018442746783085707,
-    -0.030734813215147039,
-    -0.043022232964237718,
-    -0.055303148340717617,
-    -0.067575702638318677,
-    -0.079838040414853512,
-    -0.092088307772732844,
-    -0.10432465263924942,
-    -0.1165452250465861,
-    -0.12874817741150563,
-    -0.14093166481467989,
-    -0.15309384527961656,
-    -0.16523288005114059,
-    -0.17734693387338893,
-    -0.18943417526727607,
-    -0.20149277680738856,
-    -0.21352091539826668,
-    -0.22551677255003169,
-    -0.23747853465331636,
-    -0.24940439325345806,
-    -0.26129254532391233,
-    -0.27314119353884558,
-    -0.28494854654486662,
-    -0.29671281923185416,
-    -0.30843223300284162,
-    -0.32010501604291614,
-    -0.33172940358709313,
-    -0.34330363818712423,
-    -0.35482596997719978,
-    -0.36629465693850427,
-    -0.37770796516258592,
-    -0.38906416911349967,
-    -0.400361551888685,
-    -0.41159840547853771,
-    -0.42277303102463765,
-    -0.43388373907659311,
-    -0.44492884984746223,
-    -0.45590669346771412,
-    -0.46681561023768997,
-    -0.47765395087852719,
-    -0.48842007678150756,
-    -0.49911236025579259,
-    -0.50972918477450802,
-    -0.52026894521914058,
-    -0.53073004812221003,
-    -0.54111091190817917,
-    -0.55140996713256729,
-    -0.56162565671922771,
-    -0.57175643619575711,
-    -0.58180077392699803,
-    -0.59175715134660167,
-    -0.6016240631866141,
-    -0.61140001770505203,
-    -0.62108353691143392,
-    -0.63067315679023195,
-    -0.64016742752221112,
-    -0.6495649137036219,
-    -0.65886419456321377,
-    -0.66806386417703623,
-    -0.67716253168099572,
-    -0.6861588214811345,
-    -0.69505137346160217,
-    -0.70383884319028645,
-    -0.71251990212207272,
-    -0.72109323779970214,
-    -0.72955755405219691,
-    -0.73791157119082396,
-    -0.74615402620256588,
-    -0.75428367294107157,
-    -0.7622992823150565,
-    -0.77019964247412431,
-    -0.77798355899198202,
-    -0.7856498550470209,
-    -0.79319737160023607,
-    -0.80062496757045709,
-    -0.80793152000686375,
-    -0.81511592425876089,
-    -0.82217709414258666,
-    -0.82911396210612853,
-    -0.83592547938992245,
-    -0.84261061618581101,
-    -0.849168361792636,
-    -0.85559772476904339,
-    -0.86189773308337503,
-    -0.86806743426062627,
-    -0.87410589552644824,
-    -0.88001220394816948,
-    -0.88578546657281931,
-    -0.89142481056213008,
-    -0.89692938332449834,
-    -0.90229835264388514,
-    -0.9075309068056352,
-    -0.91262625471919789,
-    -0.91758362603772858,
-    -0.92240227127455476,
-    -0.92708146191648833,
-    -0.93162049053396645,
-    -0.93601867088800572,
-    -0.94027533803395169,
-    -0.94438984842200946,
-    -0.94836157999453974,
-    -0.95218993228010529,
-    -0.95587432648425441,
-    -0.95941420557702584,
-    -0.96280903437716514,
-    -0.96605829963303591,
-    -0.96916151010021678,
-    -0.97211819661577104,
-    -0.97492791216917707,
-    -0.97759023196991091,
-    -0.98010475351166826,
-    -0.98247109663321797,
-    -0.98468890357587757,
-    -0.98675783903760106,
-    -0.98867759022367219,
-    -0.99044786689399478,
-    -0.99206840140697305,
-    -0.99353894875997517,
-    -0.99485928662637446,
-    -0.99602921538916223,
-    -0.99704855817112681,
-    -0.99791716086159543,
-    -0.99863489213973311,
-    -0.99920164349439711,
-    -0.99961732924054192,
-    -0.9998818865321738,
-    -0.9999952753718524,
-    -0.99995747861673734,
-    -0.99976850198118061,
-    -0.99942837403586238,
-    -0.99893714620347118,
-    -0.99829489275092997,
-    -0.99750171077816763,
-    -0.99655772020343925,
-    -0.99546306374519555,
-    -0.99421790690050604,
-    -0.99282243792003855,
-    -0.99127686777959756,
-    -0.98958143014822808,
-    -0.98773638135288788,
-    -0.98574200033969439,
-    -0.98359858863175198,
-    -0.98130647028356566,
-    -0.97886599183204837,
-    -0.97627752224412978,
-    -0.97354145286097293,
-    -0.97065819733880931,
-    -0.96762819158639957,
-    -0.96445189369912998,
-    -0.96112978388975456,
-    -0.95766236441579378,
-    -0.95405015950360017,
-    -0.95029371526910189,
-    -0.94639359963523817,
-    -0.94235040224609679,
-    -0.93816473437776771,
-    -0.93383722884592735,
-    -0.92936853991016433,
-    -0.92475934317506558,
-    -0.92001033548807321,
-    -0.91512223483413135,
-    -0.91009578022713633,
-    -0.90493173159820794,
-    -0.89963086968079853,
-    -0.89419399589265613,
-    -0.88862193221466201,
-    -0.88291552106655757,
-    -0.8770756251795826,
-    -0.87110312746604146,
-    -0.86499893088581969,
-    -0.85876395830986829,
-    -0.8523991523806782,
-    -0.84590547536976601,
-    -0.83928390903219141,
-    -0.83253545445812938,
-    -0.82566113192151913,
-    -0.81866198072581242,
-    -0.8115390590468452,
-    -0.80429344377285628,
-    -0.79692623034167587,
-    -0.78943853257511098,
-    -0.78183148251055068,
-    -0.77410623022981706,
-    -0.76626394368528938,
-    -0.7583058085233253,
-    -0.7502330279050069,
-    -0.74204682232424024,
-    -0.7337484294232326,
-    -0.72533910380537769,
-    -0.71682011684557811,
-    -0.70819275649802915,
-    -0.69945832710149913,
-    -0.69061814918213049,
-    -0.68167355925379469,
-    -0.6726259096160293,
-    -0.66347656814958889,
-    -0.65422691810964062,
-    -0.64487835791663428,
-    -0.63543230094488068,
-    -0.62589017530886915,
-    -0.61625342364735525,
-    -0.60652350290525436,
-    -0.59670188411337133,
-    -0.58679005216600066,
-    -0.57678950559643061,
-    -0.56670175635038622,
-    -0.5565283295574428,
-    -0.5462707633004481,
-    -0.53593060838298479,
-    -0.5255094280949103,
-    -0.51500879797600874,
-    -0.504430305577791,
-    -0.49377555022347852,
-    -0.4830461427662075,
-    -0.47224370534549021,
-    -0.46136987114196953,
-    -0.4504262841305044,
-    -0.4394145988316232,
-    -0.42833648006138325,
-    -0.41719360267967309,
-    -0.40598765133699677,
-    -0.3947203202197776,
-    -0.38339331279422051,
-    -0.37200834154877127,
-    -0.36056712773521166,
-    -0.34907140110842955,
-    -0.33752289966490412,
-    -0.32592336937994409,
-    -0.31427456394372044,
-    -0.30257824449613252,
-    -0.29083617936054745,
-    -0.27905014377645426,
-    -0.26722191963107172,
-    -0.25535329518995153,
-    -0.24344606482661696,
-    -0.23150202875127812,
-    -0.21952299273866488,
-    -0.20751076785501854,
-    -0.19546717018428322,
-    -0.18339402055353896,
-    -0.17129314425771752,
-    -0.1591663707836429,
-    -0.14701553353343785,
-    -0.13484246954733858,
-    -0.12264901922595951,
-    -0.11043702605204984,
-    -0.098208336311784189,
-    -0.085964798815629448,
-    -0.073708264618829858,
-    -0.061440586741552936,
-    -0.049163619888738068,
-    -0.036879220169690592,
-    -0.024589244817463451,
-    -0.012295551908068978,
-    -7.9563267766097047e-11
-};
-
-#endif
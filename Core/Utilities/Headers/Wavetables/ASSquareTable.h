@@ -1,41059 +0,0 @@
-//  Assemble
-//  Created by David Spry on 9/5/20.
-//  Copyright © 2020 David Spry. All rights reserved.
-
-#ifndef ASSQUARETABLE_H
-#define ASSQUARETABLE_H
-
-#include <array>
-
-/// \note The collection of tables is at the bottom of this file.
-///
-/// \brief A collection of wavetables containing a bandlimited square wave.
-/// The square wave is oversampled by a factor of 2 and bandlimited in order to
-/// contain the maximum number of harmonics in each table without exceeding the Nyquist frequency.
-///
-/// Correct use of these wavetables should ensure that aliasing from the synthesiser is minimised if not obviated completely.
-///
-/// For each table, the top frequency and the number of harmonics follows.
-/// 1. 40Hz             735
-/// 2. 80Hz             367
-/// 3. 160Hz           183
-/// 4. 320Hz             91
-/// 5. 640Hz             45
-/// 6. 1280Hz           22
-/// 7. 2560Hz           11
-/// 8. 5120Hz            5
-/// 9. 10240Hz          2
-/// 10. 20480Hz+      1
-///
-/// \note These tables were generated with Nigel Redmon's C++ program, "WaveTableOsc", which is available for download from his blog, EarLevel Engineering.
-/// http://www.earlevel.com/main/2012/05/03/a-wavetable-oscillator—introduction/
-
-constexpr static int kSquareTableLength = 4096;
-
-// Top frequency: 44.1K * 0.000907029
-constexpr static std::array<float, 4096> wt_square_0x1 =
-{
-    0,
-    0.570307,
-    0.926007,
-    0.999,
-    0.894804,
-    0.786979,
-    0.778453,
-    0.846777,
-    0.903369,
-    0.8937,
-    0.841677,
-    0.809354,
-    0.827128,
-    0.868232,
-    0.885593,
-    0.86397,
-    0.831571,
-    0.824569,
-    0.847622,
-    0.872502,
-    0.871985,
-    0.849113,
-    0.830943,
-    0.836941,
-    0.858474,
-    0.87062,
-    0.860752,
-    0.841404,
-    0.834617,
-    0.847008,
-    0.86357,
-    0.865685,
-    0.851926,
-    0.838539,
-    0.840374,
-    0.854508,
-    0.864521,
-    0.859487,
-    0.845818,
-    0.839208,
-    0.846676,
-    0.859188,
-    0.86252,
-    0.853378,
-    0.842562,
-    0.842253,
-    0.852337,
-    0.861068,
-    0.858718,
-    0.848377,
-    0.841969,
-    0.846531,
-    0.856515,
-    0.860501,
-    0.854235,
-    0.845134,
-    0.843534,
-    0.850969,
-    0.858761,
-    0.858128,
-    0.850066,
-    0.843897,
-    0.846509,
-    0.854679,
-    0.859024,
-    0.854766,
-    0.846967,
-    0.844528,
-    0.850043,
-    0.857058,
-    0.857613,
-    0.851265,
-    0.845372,
-    0.846577,
-    0.853326,
-    0.857847,
-    0.855091,
-    0.848362,
-    0.845367,
-    0.849397,
-    0.85572,
-    0.857129,
-    0.852151,
-    0.84657,
-    0.846715,
-    0.852286,
-    0.856853,
-    0.855271,
-    0.849469,
-    0.846111,
-    0.848944,
-    0.854625,
-    0.856657,
-    0.852819,
-    0.847582,
-    0.846909,
-    0.851467,
-    0.855984,
-    0.855342,
-    0.850372,
-    0.846794,
-    0.848637,
-    0.853705,
-    0.85619,
-    0.853323,
-    0.848458,
-    0.847149,
-    0.850815,
-    0.855206,
-    0.855327,
-    0.851118,
-    0.847432,
-    0.848443,
-    0.85292,
-    0.855722,
-    0.853698,
-    0.849227,
-    0.847428,
-    0.850296,
-    0.854499,
-    0.855241,
-    0.851738,
-    0.848035,
-    0.848342,
-    0.852246,
-    0.855255,
-    0.853966,
-    0.84991,
-    0.847738,
-    0.849888,
-    0.853852,
-    0.855098,
-    0.852251,
-    0.848607,
-    0.84832,
-    0.851665,
-    0.854789,
-    0.854144,
-    0.850517,
-    0.848073,
-    0.849575,
-    0.853259,
-    0.854906,
-    0.852673,
-    0.84915,
-    0.848363,
-    0.851168,
-    0.854328,
-    0.854244,
-    0.851055,
-    0.848428,
-    0.849345,
-    0.852716,
-    0.854675,
-    0.853012,
-    0.849664,
-    0.848462,
-    0.850746,
-    0.853874,
-    0.854277,
-    0.851529,
-    0.848796,
-    0.849188,
-    0.852221,
-    0.854412,
-    0.853277,
-    0.850148,
-    0.848609,
-    0.850393,
-    0.853431,
-    0.854251,
-    0.851944,
-    0.849173,
-    0.849097,
-    0.851773,
-    0.854123,
-    0.853475,
-    0.8506,
-    0.848796,
-    0.850105,
-    0.853003,
-    0.854173,
-    0.852301,
-    0.849552,
-    0.849065,
-    0.851372,
-    0.853815,
-    0.853611,
-    0.851019,
-    0.849017,
-    0.849878,
-    0.852593,
-    0.85405,
-    0.852602,
-    0.849928,
-    0.849086,
-    0.851017,
-    0.853494,
-    0.85369,
-    0.851403,
-    0.849264,
-    0.849708,
-    0.852204,
-    0.853889,
-    0.85285,
-    0.850297,
-    0.849153,
-    0.850709,
-    0.853166,
-    0.853717,
-    0.85175,
-    0.849531,
-    0.849591,
-    0.85184,
-    0.853696,
-    0.853047,
-    0.850655,
-    0.849262,
-    0.850447,
-    0.852837,
-    0.853696,
-    0.852059,
-    0.849814,
-    0.849524,
-    0.851505,
-    0.853477,
-    0.853194,
-    0.850996,
-    0.849406,
-    0.850231,
-    0.852511,
-    0.853633,
-    0.852329,
-    0.850105,
-    0.849504,
-    0.851199,
-    0.853238,
-    0.853293,
-    0.851318,
-    0.849581,
-    0.850061,
-    0.852193,
-    0.853533,
-    0.852559,
-    0.850399,
-    0.849527,
-    0.850926,
-    0.852984,
-    0.853348,
-    0.851617,
-    0.84978,
-    0.849934,
-    0.851888,
-    0.853399,
-    0.852748,
-    0.850693,
-    0.849588,
-    0.850687,
-    0.85272,
-    0.853361,
-    0.851889,
-    0.849999,
-    0.84985,
-    0.851599,
-    0.853238,
-    0.852897,
-    0.85098,
-    0.849684,
-    0.850484,
-    0.852452,
-    0.853335,
-    0.852133,
-    0.850232,
-    0.849806,
-    0.851331,
-    0.853053,
-    0.853006,
-    0.851256,
-    0.849811,
-    0.850317,
-    0.852185,
-    0.853273,
-    0.852346,
-    0.850474,
-    0.8498,
-    0.851085,
-    0.85285,
-    0.853077,
-    0.851518,
-    0.849963,
-    0.850187,
-    0.851923,
-    0.85318,
-    0.852527,
-    0.85072,
-    0.84983,
-    0.850866,
-    0.852634,
-    0.853111,
-    0.851762,
-    0.850137,
-    0.850093,
-    0.85167,
-    0.853058,
-    0.852674,
-    0.850967,
-    0.849893,
-    0.850675,
-    0.852408,
-    0.85311,
-    0.851984,
-    0.850327,
-    0.850034,
-    0.85143,
-    0.852913,
-    0.852789,
-    0.851209,
-    0.849985,
-    0.850513,
-    0.852179,
-    0.853075,
-    0.852183,
-    0.85053,
-    0.850009,
-    0.851208,
-    0.852748,
-    0.852869,
-    0.851442,
-    0.850103,
-    0.850382,
-    0.85195,
-    0.853011,
-    0.852355,
-    0.850742,
-    0.850017,
-    0.851005,
-    0.852567,
-    0.852917,
-    0.851662,
-    0.850243,
-    0.850282,
-    0.851726,
-    0.852919,
-    0.8525,
-    0.850956,
-    0.850056,
-    0.850824,
-    0.852375,
-    0.852933,
-    0.851867,
-    0.850402,
-    0.850213,
-    0.85151,
-    0.852803,
-    0.852617,
-    0.851171,
-    0.850123,
-    0.850668,
-    0.852175,
-    0.852919,
-    0.852053,
-    0.850575,
-    0.850175,
-    0.851305,
-    0.852667,
-    0.852704,
-    0.85138,
-    0.850215,
-    0.850537,
-    0.851973,
-    0.852876,
-    0.852218,
-    0.850758,
-    0.850167,
-    0.851116,
-    0.852514,
-    0.852762,
-    0.851582,
-    0.850329,
-    0.850434,
-    0.851771,
-    0.852807,
-    0.85236,
-    0.850947,
-    0.850187,
-    0.850945,
-    0.852348,
-    0.852791,
-    0.851772,
-    0.850462,
-    0.850358,
-    0.851574,
-    0.852715,
-    0.852477,
-    0.851139,
-    0.850234,
-    0.850794,
-    0.852173,
-    0.852792,
-    0.851947,
-    0.85061,
-    0.85031,
-    0.851386,
-    0.852602,
-    0.852569,
-    0.85133,
-    0.850305,
-    0.850665,
-    0.851992,
-    0.852766,
-    0.852105,
-    0.850771,
-    0.85029,
-    0.851208,
-    0.852471,
-    0.852634,
-    0.851515,
-    0.850398,
-    0.85056,
-    0.851809,
-    0.852715,
-    0.852244,
-    0.850939,
-    0.850295,
-    0.851045,
-    0.852327,
-    0.852673,
-    0.851692,
-    0.850511,
-    0.850479,
-    0.851629,
-    0.852642,
-    0.852361,
-    0.851112,
-    0.850326,
-    0.850899,
-    0.852171,
-    0.852686,
-    0.851858,
-    0.850639,
-    0.850423,
-    0.851453,
-    0.852548,
-    0.852455,
-    0.851287,
-    0.850381,
-    0.850772,
-    0.852008,
-    0.852674,
-    0.85201,
-    0.850781,
-    0.850392,
-    0.851286,
-    0.852436,
-    0.852526,
-    0.851458,
-    0.850457,
-    0.850666,
-    0.851842,
-    0.852638,
-    0.852145,
-    0.850932,
-    0.850387,
-    0.851131,
-    0.852309,
-    0.852573,
-    0.851625,
-    0.850552,
-    0.850581,
-    0.851675,
-    0.85258,
-    0.852262,
-    0.851089,
-    0.850404,
-    0.850989,
-    0.85217,
-    0.852596,
-    0.851782,
-    0.850663,
-    0.850519,
-    0.851511,
-    0.852502,
-    0.852359,
-    0.851249,
-    0.850445,
-    0.850864,
-    0.852023,
-    0.852596,
-    0.851928,
-    0.850789,
-    0.85048,
-    0.851353,
-    0.852406,
-    0.852434,
-    0.851409,
-    0.850506,
-    0.850757,
-    0.851871,
-    0.852572,
-    0.852061,
-    0.850924,
-    0.850465,
-    0.851204,
-    0.852295,
-    0.852488,
-    0.851566,
-    0.850586,
-    0.850669,
-    0.851716,
-    0.852528,
-    0.852177,
-    0.851068,
-    0.850471,
-    0.851067,
-    0.852171,
-    0.852519,
-    0.851716,
-    0.850683,
-    0.850602,
-    0.851562,
-    0.852463,
-    0.852275,
-    0.851216,
-    0.8505,
-    0.850943,
-    0.852037,
-    0.852528,
-    0.851857,
-    0.850795,
-    0.850556,
-    0.851412,
-    0.852381,
-    0.852354,
-    0.851366,
-    0.850549,
-    0.850836,
-    0.851896,
-    0.852515,
-    0.851987,
-    0.850918,
-    0.850532,
-    0.851269,
-    0.852283,
-    0.852413,
-    0.851514,
-    0.850616,
-    0.850746,
-    0.851752,
-    0.852482,
-    0.852102,
-    0.851049,
-    0.850529,
-    0.851136,
-    0.852171,
-    0.852452,
-    0.851658,
-    0.8507,
-    0.850675,
-    0.851607,
-    0.85243,
-    0.852201,
-    0.851187,
-    0.850548,
-    0.851014,
-    0.85205,
-    0.852469,
-    0.851794,
-    0.8508,
-    0.850623,
-    0.851465,
-    0.852359,
-    0.852284,
-    0.851327,
-    0.850585,
-    0.850906,
-    0.85192,
-    0.852466,
-    0.851921,
-    0.850911,
-    0.850592,
-    0.851327,
-    0.852273,
-    0.852347,
-    0.851468,
-    0.850642,
-    0.850814,
-    0.851785,
-    0.852443,
-    0.852035,
-    0.851032,
-    0.850581,
-    0.851197,
-    0.852173,
-    0.852392,
-    0.851605,
-    0.850715,
-    0.850739,
-    0.851648,
-    0.8524,
-    0.852136,
-    0.85116,
-    0.85059,
-    0.851077,
-    0.852062,
-    0.852417,
-    0.851737,
-    0.850803,
-    0.850683,
-    0.851512,
-    0.852341,
-    0.852221,
-    0.851292,
-    0.850618,
-    0.850969,
-    0.851941,
-    0.852422,
-    0.851861,
-    0.850904,
-    0.850645,
-    0.851379,
-    0.852265,
-    0.852289,
-    0.851425,
-    0.850664,
-    0.850875,
-    0.851815,
-    0.852407,
-    0.851975,
-    0.851015,
-    0.850626,
-    0.851252,
-    0.852175,
-    0.852338,
-    0.851557,
-    0.850727,
-    0.850797,
-    0.851686,
-    0.852375,
-    0.852077,
-    0.851134,
-    0.850627,
-    0.851134,
-    0.852073,
-    0.85237,
-    0.851686,
-    0.850805,
-    0.850736,
-    0.851555,
-    0.852324,
-    0.852164,
-    0.851259,
-    0.850646,
-    0.851026,
-    0.851962,
-    0.852382,
-    0.851808,
-    0.850897,
-    0.850693,
-    0.851427,
-    0.852258,
-    0.852235,
-    0.851386,
-    0.850684,
-    0.850931,
-    0.851843,
-    0.852376,
-    0.851921,
-    0.851,
-    0.850667,
-    0.851303,
-    0.852177,
-    0.85229,
-    0.851514,
-    0.850738,
-    0.85085,
-    0.85172,
-    0.852352,
-    0.852023,
-    0.851111,
-    0.850661,
-    0.851186,
-    0.852084,
-    0.852327,
-    0.851638,
-    0.850807,
-    0.850785,
-    0.851595,
-    0.85231,
-    0.852112,
-    0.851229,
-    0.850672,
-    0.851078,
-    0.851981,
-    0.852347,
-    0.851758,
-    0.85089,
-    0.850736,
-    0.851471,
-    0.852253,
-    0.852187,
-    0.85135,
-    0.850701,
-    0.850982,
-    0.85187,
-    0.852348,
-    0.85187,
-    0.850984,
-    0.850705,
-    0.85135,
-    0.852181,
-    0.852246,
-    0.851473,
-    0.850747,
-    0.850898,
-    0.851753,
-    0.852332,
-    0.851973,
-    0.851088,
-    0.850691,
-    0.851234,
-    0.852096,
-    0.852289,
-    0.851594,
-    0.850808,
-    0.850829,
-    0.851633,
-    0.852298,
-    0.852064,
-    0.8512,
-    0.850695,
-    0.851127,
-    0.852,
-    0.852314,
-    0.851712,
-    0.850882,
-    0.850776,
-    0.851512,
-    0.852249,
-    0.852142,
-    0.851316,
-    0.850716,
-    0.851029,
-    0.851895,
-    0.852323,
-    0.851823,
-    0.85097,
-    0.850739,
-    0.851394,
-    0.852184,
-    0.852206,
-    0.851434,
-    0.850754,
-    0.850943,
-    0.851784,
-    0.852314,
-    0.851927,
-    0.851067,
-    0.850719,
-    0.851279,
-    0.852107,
-    0.852253,
-    0.851553,
-    0.850807,
-    0.85087,
-    0.851668,
-    0.852288,
-    0.85202,
-    0.851172,
-    0.850716,
-    0.851172,
-    0.852018,
-    0.852285,
-    0.851668,
-    0.850875,
-    0.850812,
-    0.851551,
-    0.852246,
-    0.852101,
-    0.851283,
-    0.85073,
-    0.851073,
-    0.851919,
-    0.8523,
-    0.851779,
-    0.850955,
-    0.85077,
-    0.851435,
-    0.852189,
-    0.852168,
-    0.851398,
-    0.85076,
-    0.850985,
-    0.851813,
-    0.852297,
-    0.851883,
-    0.851046,
-    0.850744,
-    0.851322,
-    0.852118,
-    0.852221,
-    0.851513,
-    0.850806,
-    0.850909,
-    0.851702,
-    0.852278,
-    0.851978,
-    0.851146,
-    0.850734,
-    0.851214,
-    0.852035,
-    0.852258,
-    0.851627,
-    0.850867,
-    0.850846,
-    0.851589,
-    0.852243,
-    0.852062,
-    0.851252,
-    0.850742,
-    0.851114,
-    0.851943,
-    0.852278,
-    0.851738,
-    0.85094,
-    0.850799,
-    0.851475,
-    0.852193,
-    0.852133,
-    0.851363,
-    0.850765,
-    0.851024,
-    0.851842,
-    0.852283,
-    0.851842,
-    0.851025,
-    0.850767,
-    0.851363,
-    0.85213,
-    0.85219,
-    0.851476,
-    0.850805,
-    0.850945,
-    0.851735,
-    0.85227,
-    0.851938,
-    0.85112,
-    0.850752,
-    0.851255,
-    0.852053,
-    0.852232,
-    0.851588,
-    0.850858,
-    0.850878,
-    0.851624,
-    0.852242,
-    0.852025,
-    0.851222,
-    0.850752,
-    0.851154,
-    0.851966,
-    0.852259,
-    0.851698,
-    0.850926,
-    0.850826,
-    0.851513,
-    0.852199,
-    0.8521,
-    0.851329,
-    0.850769,
-    0.851061,
-    0.85187,
-    0.852269,
-    0.851803,
-    0.851005,
-    0.850789,
-    0.851402,
-    0.852141,
-    0.852161,
-    0.851439,
-    0.850802,
-    0.850979,
-    0.851767,
-    0.852264,
-    0.851901,
-    0.851094,
-    0.850767,
-    0.851294,
-    0.852071,
-    0.852208,
-    0.85155,
-    0.850849,
-    0.850909,
-    0.851659,
-    0.852242,
-    0.85199,
-    0.851192,
-    0.850762,
-    0.851192,
-    0.851989,
-    0.852241,
-    0.851659,
-    0.850911,
-    0.850852,
-    0.851549,
-    0.852205,
-    0.852068,
-    0.851296,
-    0.850772,
-    0.851097,
-    0.851897,
-    0.852257,
-    0.851765,
-    0.850984,
-    0.850809,
-    0.851439,
-    0.852153,
-    0.852134,
-    0.851404,
-    0.850799,
-    0.851012,
-    0.851798,
-    0.852258,
-    0.851865,
-    0.851069,
-    0.850782,
-    0.851332,
-    0.852089,
-    0.852186,
-    0.851513,
-    0.85084,
-    0.850937,
-    0.851694,
-    0.852242,
-    0.851956,
-    0.851162,
-    0.85077,
-    0.851228,
-    0.852012,
-    0.852224,
-    0.851622,
-    0.850895,
-    0.850876,
-    0.851586,
-    0.852212,
-    0.852038,
-    0.851263,
-    0.850775,
-    0.851131,
-    0.851925,
-    0.852246,
-    0.851728,
-    0.850964,
-    0.850828,
-    0.851476,
-    0.852166,
-    0.852108,
-    0.851368,
-    0.850795,
-    0.851043,
-    0.851829,
-    0.852253,
-    0.851829,
-    0.851044,
-    0.850795,
-    0.851368,
-    0.852107,
-    0.852165,
-    0.851477,
-    0.85083,
-    0.850965,
-    0.851727,
-    0.852244,
-    0.851923,
-    0.851133,
-    0.850778,
-    0.851264,
-    0.852035,
-    0.852208,
-    0.851585,
-    0.85088,
-    0.850899,
-    0.851621,
-    0.852219,
-    0.852009,
-    0.851231,
-    0.850776,
-    0.851165,
-    0.851952,
-    0.852236,
-    0.851692,
-    0.850943,
-    0.850846,
-    0.851513,
-    0.852179,
-    0.852083,
-    0.851334,
-    0.85079,
-    0.851074,
-    0.85186,
-    0.852249,
-    0.851795,
-    0.851018,
-    0.850808,
-    0.851405,
-    0.852126,
-    0.852145,
-    0.851441,
-    0.850819,
-    0.850992,
-    0.851761,
-    0.852246,
-    0.851892,
-    0.851104,
-    0.850784,
-    0.851299,
-    0.852059,
-    0.852193,
-    0.851549,
-    0.850863,
-    0.850921,
-    0.851657,
-    0.852227,
-    0.85198,
-    0.851198,
-    0.850776,
-    0.851198,
-    0.85198,
-    0.852227,
-    0.851657,
-    0.850921,
-    0.850863,
-    0.851549,
-    0.852193,
-    0.852059,
-    0.851299,
-    0.850784,
-    0.851104,
-    0.851892,
-    0.852246,
-    0.851761,
-    0.850992,
-    0.850819,
-    0.851441,
-    0.852145,
-    0.852126,
-    0.851405,
-    0.850808,
-    0.851018,
-    0.851795,
-    0.852249,
-    0.85186,
-    0.851074,
-    0.85079,
-    0.851334,
-    0.852083,
-    0.852179,
-    0.851513,
-    0.850846,
-    0.850943,
-    0.851692,
-    0.852236,
-    0.851952,
-    0.851165,
-    0.850776,
-    0.851231,
-    0.852009,
-    0.852219,
-    0.851621,
-    0.850899,
-    0.85088,
-    0.851585,
-    0.852208,
-    0.852035,
-    0.851264,
-    0.850778,
-    0.851133,
-    0.851923,
-    0.852244,
-    0.851727,
-    0.850965,
-    0.85083,
-    0.851477,
-    0.852165,
-    0.852107,
-    0.851368,
-    0.850795,
-    0.851044,
-    0.851829,
-    0.852253,
-    0.851829,
-    0.851043,
-    0.850795,
-    0.851368,
-    0.852108,
-    0.852166,
-    0.851476,
-    0.850828,
-    0.850964,
-    0.851728,
-    0.852246,
-    0.851925,
-    0.851131,
-    0.850775,
-    0.851263,
-    0.852038,
-    0.852212,
-    0.851586,
-    0.850876,
-    0.850895,
-    0.851622,
-    0.852224,
-    0.852012,
-    0.851228,
-    0.85077,
-    0.851162,
-    0.851956,
-    0.852242,
-    0.851694,
-    0.850937,
-    0.85084,
-    0.851513,
-    0.852186,
-    0.852089,
-    0.851332,
-    0.850782,
-    0.851069,
-    0.851865,
-    0.852258,
-    0.851798,
-    0.851012,
-    0.850799,
-    0.851404,
-    0.852134,
-    0.852153,
-    0.851439,
-    0.850809,
-    0.850984,
-    0.851765,
-    0.852257,
-    0.851897,
-    0.851097,
-    0.850772,
-    0.851296,
-    0.852068,
-    0.852205,
-    0.851549,
-    0.850852,
-    0.850911,
-    0.851659,
-    0.852241,
-    0.851989,
-    0.851192,
-    0.850762,
-    0.851192,
-    0.85199,
-    0.852242,
-    0.851659,
-    0.850909,
-    0.850849,
-    0.85155,
-    0.852208,
-    0.852071,
-    0.851294,
-    0.850767,
-    0.851094,
-    0.851901,
-    0.852264,
-    0.851767,
-    0.850979,
-    0.850802,
-    0.851439,
-    0.852161,
-    0.852141,
-    0.851402,
-    0.850789,
-    0.851005,
-    0.851803,
-    0.852269,
-    0.85187,
-    0.851061,
-    0.850769,
-    0.851329,
-    0.8521,
-    0.852199,
-    0.851513,
-    0.850826,
-    0.850926,
-    0.851698,
-    0.852259,
-    0.851966,
-    0.851154,
-    0.850752,
-    0.851222,
-    0.852025,
-    0.852242,
-    0.851624,
-    0.850878,
-    0.850858,
-    0.851588,
-    0.852232,
-    0.852053,
-    0.851255,
-    0.850752,
-    0.85112,
-    0.851938,
-    0.85227,
-    0.851735,
-    0.850945,
-    0.850805,
-    0.851476,
-    0.85219,
-    0.85213,
-    0.851363,
-    0.850767,
-    0.851025,
-    0.851842,
-    0.852283,
-    0.851842,
-    0.851024,
-    0.850765,
-    0.851363,
-    0.852133,
-    0.852193,
-    0.851475,
-    0.850799,
-    0.85094,
-    0.851738,
-    0.852278,
-    0.851943,
-    0.851114,
-    0.850742,
-    0.851252,
-    0.852062,
-    0.852243,
-    0.851589,
-    0.850846,
-    0.850867,
-    0.851627,
-    0.852258,
-    0.852035,
-    0.851214,
-    0.850734,
-    0.851146,
-    0.851978,
-    0.852278,
-    0.851702,
-    0.850909,
-    0.850806,
-    0.851513,
-    0.852221,
-    0.852118,
-    0.851322,
-    0.850744,
-    0.851046,
-    0.851883,
-    0.852297,
-    0.851813,
-    0.850985,
-    0.85076,
-    0.851398,
-    0.852168,
-    0.852189,
-    0.851435,
-    0.85077,
-    0.850955,
-    0.851779,
-    0.8523,
-    0.851919,
-    0.851073,
-    0.85073,
-    0.851283,
-    0.852101,
-    0.852246,
-    0.851551,
-    0.850812,
-    0.850875,
-    0.851668,
-    0.852285,
-    0.852018,
-    0.851172,
-    0.850716,
-    0.851172,
-    0.85202,
-    0.852288,
-    0.851668,
-    0.85087,
-    0.850807,
-    0.851553,
-    0.852253,
-    0.852107,
-    0.851279,
-    0.850719,
-    0.851067,
-    0.851927,
-    0.852314,
-    0.851784,
-    0.850943,
-    0.850754,
-    0.851434,
-    0.852206,
-    0.852184,
-    0.851394,
-    0.850739,
-    0.85097,
-    0.851823,
-    0.852323,
-    0.851895,
-    0.851029,
-    0.850716,
-    0.851316,
-    0.852142,
-    0.852249,
-    0.851512,
-    0.850776,
-    0.850882,
-    0.851712,
-    0.852314,
-    0.852,
-    0.851127,
-    0.850695,
-    0.8512,
-    0.852064,
-    0.852298,
-    0.851633,
-    0.850829,
-    0.850808,
-    0.851594,
-    0.852289,
-    0.852096,
-    0.851234,
-    0.850691,
-    0.851088,
-    0.851973,
-    0.852332,
-    0.851753,
-    0.850898,
-    0.850747,
-    0.851473,
-    0.852246,
-    0.852181,
-    0.85135,
-    0.850705,
-    0.850984,
-    0.85187,
-    0.852348,
-    0.85187,
-    0.850982,
-    0.850701,
-    0.85135,
-    0.852187,
-    0.852253,
-    0.851471,
-    0.850736,
-    0.85089,
-    0.851758,
-    0.852347,
-    0.851981,
-    0.851078,
-    0.850672,
-    0.851229,
-    0.852112,
-    0.85231,
-    0.851595,
-    0.850785,
-    0.850807,
-    0.851638,
-    0.852327,
-    0.852084,
-    0.851186,
-    0.850661,
-    0.851111,
-    0.852023,
-    0.852352,
-    0.85172,
-    0.85085,
-    0.850738,
-    0.851514,
-    0.85229,
-    0.852177,
-    0.851303,
-    0.850667,
-    0.851,
-    0.851921,
-    0.852376,
-    0.851843,
-    0.850931,
-    0.850684,
-    0.851386,
-    0.852235,
-    0.852258,
-    0.851427,
-    0.850693,
-    0.850897,
-    0.851808,
-    0.852382,
-    0.851962,
-    0.851026,
-    0.850646,
-    0.851259,
-    0.852164,
-    0.852324,
-    0.851555,
-    0.850736,
-    0.850805,
-    0.851686,
-    0.85237,
-    0.852073,
-    0.851134,
-    0.850627,
-    0.851134,
-    0.852077,
-    0.852375,
-    0.851686,
-    0.850797,
-    0.850727,
-    0.851557,
-    0.852338,
-    0.852175,
-    0.851252,
-    0.850626,
-    0.851015,
-    0.851975,
-    0.852407,
-    0.851815,
-    0.850875,
-    0.850664,
-    0.851425,
-    0.852289,
-    0.852265,
-    0.851379,
-    0.850645,
-    0.850904,
-    0.851861,
-    0.852422,
-    0.851941,
-    0.850969,
-    0.850618,
-    0.851292,
-    0.852221,
-    0.852341,
-    0.851512,
-    0.850683,
-    0.850803,
-    0.851737,
-    0.852417,
-    0.852062,
-    0.851077,
-    0.85059,
-    0.85116,
-    0.852136,
-    0.8524,
-    0.851648,
-    0.850739,
-    0.850715,
-    0.851605,
-    0.852392,
-    0.852173,
-    0.851197,
-    0.850581,
-    0.851032,
-    0.852035,
-    0.852443,
-    0.851785,
-    0.850814,
-    0.850642,
-    0.851468,
-    0.852347,
-    0.852273,
-    0.851327,
-    0.850592,
-    0.850911,
-    0.851921,
-    0.852466,
-    0.85192,
-    0.850906,
-    0.850585,
-    0.851327,
-    0.852284,
-    0.852359,
-    0.851465,
-    0.850623,
-    0.8508,
-    0.851794,
-    0.852469,
-    0.85205,
-    0.851014,
-    0.850548,
-    0.851187,
-    0.852201,
-    0.85243,
-    0.851607,
-    0.850675,
-    0.8507,
-    0.851658,
-    0.852452,
-    0.852171,
-    0.851136,
-    0.850529,
-    0.851049,
-    0.852102,
-    0.852482,
-    0.851752,
-    0.850746,
-    0.850616,
-    0.851514,
-    0.852413,
-    0.852283,
-    0.851269,
-    0.850532,
-    0.850918,
-    0.851987,
-    0.852515,
-    0.851896,
-    0.850836,
-    0.850549,
-    0.851366,
-    0.852354,
-    0.852381,
-    0.851412,
-    0.850556,
-    0.850795,
-    0.851857,
-    0.852528,
-    0.852037,
-    0.850943,
-    0.8505,
-    0.851216,
-    0.852275,
-    0.852463,
-    0.851562,
-    0.850602,
-    0.850683,
-    0.851716,
-    0.852519,
-    0.852171,
-    0.851067,
-    0.850471,
-    0.851068,
-    0.852177,
-    0.852528,
-    0.851716,
-    0.850669,
-    0.850586,
-    0.851566,
-    0.852488,
-    0.852295,
-    0.851204,
-    0.850465,
-    0.850924,
-    0.852061,
-    0.852572,
-    0.851871,
-    0.850757,
-    0.850506,
-    0.851409,
-    0.852434,
-    0.852406,
-    0.851353,
-    0.85048,
-    0.850789,
-    0.851928,
-    0.852596,
-    0.852023,
-    0.850864,
-    0.850445,
-    0.851249,
-    0.852359,
-    0.852502,
-    0.851511,
-    0.850519,
-    0.850663,
-    0.851782,
-    0.852596,
-    0.85217,
-    0.850989,
-    0.850404,
-    0.851089,
-    0.852262,
-    0.85258,
-    0.851675,
-    0.850581,
-    0.850552,
-    0.851625,
-    0.852573,
-    0.852309,
-    0.851131,
-    0.850387,
-    0.850932,
-    0.852145,
-    0.852638,
-    0.851842,
-    0.850666,
-    0.850457,
-    0.851458,
-    0.852526,
-    0.852436,
-    0.851286,
-    0.850392,
-    0.850781,
-    0.85201,
-    0.852674,
-    0.852008,
-    0.850772,
-    0.850381,
-    0.851287,
-    0.852455,
-    0.852548,
-    0.851453,
-    0.850423,
-    0.850639,
-    0.851858,
-    0.852686,
-    0.852171,
-    0.850899,
-    0.850326,
-    0.851112,
-    0.852361,
-    0.852642,
-    0.851629,
-    0.850479,
-    0.850511,
-    0.851692,
-    0.852673,
-    0.852327,
-    0.851045,
-    0.850295,
-    0.850939,
-    0.852244,
-    0.852715,
-    0.851809,
-    0.85056,
-    0.850398,
-    0.851515,
-    0.852634,
-    0.852471,
-    0.851208,
-    0.85029,
-    0.850771,
-    0.852105,
-    0.852766,
-    0.851992,
-    0.850665,
-    0.850305,
-    0.85133,
-    0.852569,
-    0.852602,
-    0.851386,
-    0.85031,
-    0.85061,
-    0.851947,
-    0.852792,
-    0.852173,
-    0.850794,
-    0.850234,
-    0.851139,
-    0.852477,
-    0.852715,
-    0.851574,
-    0.850358,
-    0.850462,
-    0.851772,
-    0.852791,
-    0.852348,
-    0.850945,
-    0.850187,
-    0.850947,
-    0.85236,
-    0.852807,
-    0.851771,
-    0.850434,
-    0.850329,
-    0.851582,
-    0.852762,
-    0.852514,
-    0.851116,
-    0.850167,
-    0.850758,
-    0.852218,
-    0.852876,
-    0.851973,
-    0.850537,
-    0.850215,
-    0.85138,
-    0.852704,
-    0.852667,
-    0.851305,
-    0.850175,
-    0.850575,
-    0.852053,
-    0.852919,
-    0.852175,
-    0.850668,
-    0.850123,
-    0.851171,
-    0.852617,
-    0.852803,
-    0.85151,
-    0.850213,
-    0.850402,
-    0.851867,
-    0.852933,
-    0.852375,
-    0.850824,
-    0.850056,
-    0.850956,
-    0.8525,
-    0.852919,
-    0.851726,
-    0.850282,
-    0.850243,
-    0.851662,
-    0.852917,
-    0.852567,
-    0.851005,
-    0.850017,
-    0.850742,
-    0.852355,
-    0.853011,
-    0.85195,
-    0.850382,
-    0.850103,
-    0.851442,
-    0.852869,
-    0.852748,
-    0.851208,
-    0.850009,
-    0.85053,
-    0.852183,
-    0.853075,
-    0.852179,
-    0.850513,
-    0.849985,
-    0.851209,
-    0.852789,
-    0.852913,
-    0.85143,
-    0.850034,
-    0.850327,
-    0.851984,
-    0.85311,
-    0.852408,
-    0.850675,
-    0.849893,
-    0.850967,
-    0.852674,
-    0.853058,
-    0.85167,
-    0.850093,
-    0.850137,
-    0.851762,
-    0.853111,
-    0.852634,
-    0.850866,
-    0.84983,
-    0.85072,
-    0.852527,
-    0.85318,
-    0.851923,
-    0.850187,
-    0.849963,
-    0.851518,
-    0.853077,
-    0.85285,
-    0.851085,
-    0.8498,
-    0.850474,
-    0.852346,
-    0.853273,
-    0.852185,
-    0.850317,
-    0.849811,
-    0.851256,
-    0.853006,
-    0.853053,
-    0.851331,
-    0.849806,
-    0.850232,
-    0.852133,
-    0.853335,
-    0.852452,
-    0.850484,
-    0.849684,
-    0.85098,
-    0.852897,
-    0.853238,
-    0.851599,
-    0.84985,
-    0.849999,
-    0.851889,
-    0.853361,
-    0.85272,
-    0.850687,
-    0.849588,
-    0.850693,
-    0.852748,
-    0.853399,
-    0.851888,
-    0.849934,
-    0.84978,
-    0.851617,
-    0.853348,
-    0.852984,
-    0.850926,
-    0.849527,
-    0.850399,
-    0.852559,
-    0.853533,
-    0.852193,
-    0.850061,
-    0.849581,
-    0.851318,
-    0.853293,
-    0.853238,
-    0.851199,
-    0.849504,
-    0.850105,
-    0.852329,
-    0.853633,
-    0.852511,
-    0.850231,
-    0.849406,
-    0.850996,
-    0.853194,
-    0.853477,
-    0.851505,
-    0.849524,
-    0.849814,
-    0.852059,
-    0.853696,
-    0.852837,
-    0.850447,
-    0.849262,
-    0.850655,
-    0.853047,
-    0.853696,
-    0.85184,
-    0.849591,
-    0.849531,
-    0.85175,
-    0.853717,
-    0.853166,
-    0.850709,
-    0.849153,
-    0.850297,
-    0.85285,
-    0.853889,
-    0.852204,
-    0.849708,
-    0.849264,
-    0.851403,
-    0.85369,
-    0.853494,
-    0.851017,
-    0.849086,
-    0.849928,
-    0.852602,
-    0.85405,
-    0.852593,
-    0.849878,
-    0.849017,
-    0.851019,
-    0.853611,
-    0.853815,
-    0.851372,
-    0.849065,
-    0.849552,
-    0.852301,
-    0.854173,
-    0.853003,
-    0.850105,
-    0.848796,
-    0.8506,
-    0.853475,
-    0.854123,
-    0.851773,
-    0.849097,
-    0.849173,
-    0.851944,
-    0.854251,
-    0.853431,
-    0.850393,
-    0.848609,
-    0.850148,
-    0.853277,
-    0.854412,
-    0.852221,
-    0.849188,
-    0.848796,
-    0.851529,
-    0.854277,
-    0.853874,
-    0.850746,
-    0.848462,
-    0.849664,
-    0.853012,
-    0.854675,
-    0.852716,
-    0.849345,
-    0.848428,
-    0.851055,
-    0.854244,
-    0.854328,
-    0.851168,
-    0.848363,
-    0.84915,
-    0.852673,
-    0.854906,
-    0.853259,
-    0.849575,
-    0.848073,
-    0.850517,
-    0.854144,
-    0.854789,
-    0.851665,
-    0.84832,
-    0.848607,
-    0.852251,
-    0.855098,
-    0.853852,
-    0.849888,
-    0.847738,
-    0.84991,
-    0.853966,
-    0.855255,
-    0.852246,
-    0.848342,
-    0.848035,
-    0.851738,
-    0.855241,
-    0.854499,
-    0.850296,
-    0.847428,
-    0.849227,
-    0.853698,
-    0.855722,
-    0.85292,
-    0.848443,
-    0.847432,
-    0.851118,
-    0.855327,
-    0.855206,
-    0.850815,
-    0.847149,
-    0.848458,
-    0.853323,
-    0.85619,
-    0.853705,
-    0.848637,
-    0.846794,
-    0.850372,
-    0.855342,
-    0.855984,
-    0.851467,
-    0.846909,
-    0.847582,
-    0.852819,
-    0.856657,
-    0.854625,
-    0.848944,
-    0.846111,
-    0.849469,
-    0.855271,
-    0.856853,
-    0.852286,
-    0.846715,
-    0.84657,
-    0.852151,
-    0.857129,
-    0.85572,
-    0.849397,
-    0.845367,
-    0.848362,
-    0.855091,
-    0.857847,
-    0.853326,
-    0.846577,
-    0.845372,
-    0.851265,
-    0.857613,
-    0.857058,
-    0.850043,
-    0.844528,
-    0.846967,
-    0.854766,
-    0.859024,
-    0.854679,
-    0.846509,
-    0.843897,
-    0.850066,
-    0.858128,
-    0.858761,
-    0.850969,
-    0.843534,
-    0.845134,
-    0.854235,
-    0.860501,
-    0.856515,
-    0.846531,
-    0.841969,
-    0.848377,
-    0.858718,
-    0.861068,
-    0.852337,
-    0.842253,
-    0.842562,
-    0.853378,
-    0.86252,
-    0.859188,
-    0.846676,
-    0.839208,
-    0.845818,
-    0.859487,
-    0.864521,
-    0.854508,
-    0.840374,
-    0.838539,
-    0.851926,
-    0.865685,
-    0.86357,
-    0.847008,
-    0.834617,
-    0.841404,
-    0.860752,
-    0.87062,
-    0.858474,
-    0.836941,
-    0.830943,
-    0.849113,
-    0.871985,
-    0.872502,
-    0.847622,
-    0.824569,
-    0.831571,
-    0.86397,
-    0.885593,
-    0.868232,
-    0.827128,
-    0.809354,
-    0.841677,
-    0.8937,
-    0.903369,
-    0.846777,
-    0.778453,
-    0.786979,
-    0.894804,
-    0.999,
-    0.926007,
-    0.570307,
-    0,
-    -0.570307,
-    -0.926007,
-    -0.999,
-    -0.894804,
-    -0.786979,
-    -0.778453,
-    -0.846777,
-    -0.903369,
-    -0.8937,
-    -0.841677,
-    -0.809354,
-    -0.827128,
-    -0.868232,
-    -0.885593,
-    -0.86397,
-    -0.831571,
-    -0.824569,
-    -0.847622,
-    -0.872502,
-    -0.871985,
-    -0.849113,
-    -0.830943,
-    -0.836941,
-    -0.858474,
-    -0.87062,
-    -0.860752,
-    -0.841404,
-    -0.834617,
-    -0.847008,
-    -0.86357,
-    -0.865685,
-    -0.851926,
-    -0.838539,
-    -0.840374,
-    -0.854508,
-    -0.864521,
-    -0.859487,
-    -0.845818,
-    -0.839208,
-    -0.846676,
-    -0.859188,
-    -0.86252,
-    -0.853378,
-    -0.842562,
-    -0.842253,
-    -0.852337,
-    -0.861068,
-    -0.858718,
-    -0.848377,
-    -0.841969,
-    -0.846531,
-    -0.856515,
-    -0.860501,
-    -0.854235,
-    -0.845134,
-    -0.843534,
-    -0.850969,
-    -0.858761,
-    -0.858128,
-    -0.850066,
-    -0.843897,
-    -0.846509,
-    -0.854679,
-    -0.859024,
-    -0.854766,
-    -0.846967,
-    -0.844528,
-    -0.850043,
-    -0.857058,
-    -0.857613,
-    -0.851265,
-    -0.845372,
-    -0.846577,
-    -0.853326,
-    -0.857847,
-    -0.855091,
-    -0.848362,
-    -0.845367,
-    -0.849397,
-    -0.85572,
-    -0.857129,
-    -0.852151,
-    -0.84657,
-    -0.846715,
-    -0.852286,
-    -0.856853,
-    -0.855271,
-    -0.849469,
-    -0.846111,
-    -0.848944,
-    -0.854625,
-    -0.856657,
-    -0.852819,
-    -0.847582,
-    -0.846909,
-    -0.851467,
-    -0.855984,
-    -0.855342,
-    -0.850372,
-    -0.846794,
-    -0.848637,
-    -0.853705,
-    -0.85619,
-    -0.853323,
-    -0.848458,
-    -0.847149,
-    -0.850815,
-    -0.855206,
-    -0.855327,
-    -0.851118,
-    -0.847432,
-    -0.848443,
-    -0.85292,
-    -0.855722,
-    -0.853698,
-    -0.849227,
-    -0.847428,
-    -0.850296,
-    -0.854499,
-    -0.855241,
-    -0.851738,
-    -0.848035,
-    -0.848342,
-    -0.852246,
-    -0.855255,
-    -0.853966,
-    -0.84991,
-    -0.847738,
-    -0.849888,
-    -0.853852,
-    -0.855098,
-    -0.852251,
-    -0.848607,
-    -0.84832,
-    -0.851665,
-    -0.854789,
-    -0.854144,
-    -0.850517,
-    -0.848073,
-    -0.849575,
-    -0.853259,
-    -0.854906,
-    -0.852673,
-    -0.84915,
-    -0.848363,
-    -0.851168,
-    -0.854328,
-    -0.854244,
-    -0.851055,
-    -0.848428,
-    -0.849345,
-    -0.852716,
-    -0.854675,
-    -0.853012,
-    -0.849664,
-    -0.848462,
-    -0.850746,
-    -0.853874,
-    -0.854277,
-    -0.851529,
-    -0.848796,
-    -0.849188,
-    -0.852221,
-    -0.854412,
-    -0.853277,
-    -0.850148,
-    -0.848609,
-    -0.850393,
-    -0.853431,
-    -0.854251,
-    -0.851944,
-    -0.849173,
-    -0.849097,
-    -0.851773,
-    -0.854123,
-    -0.853475,
-    -0.8506,
-    -0.848796,
-    -0.850105,
-    -0.853003,
-    -0.854173,
-    -0.852301,
-    -0.849552,
-    -0.849065,
-    -0.851372,
-    -0.853815,
-    -0.853611,
-    -0.851019,
-    -0.849017,
-    -0.849878,
-    -0.852593,
-    -0.85405,
-    -0.852602,
-    -0.849928,
-    -0.849086,
-    -0.851017,
-    -0.853494,
-    -0.85369,
-    -0.851403,
-    -0.849264,
-    -0.849708,
-    -0.852204,
-    -0.853889,
-    -0.85285,
-    -0.850297,
-    -0.849153,
-    -0.850709,
-    -0.853166,
-    -0.853717,
-    -0.85175,
-    -0.849531,
-    -0.849591,
-    -0.85184,
-    -0.853696,
-    -0.853047,
-    -0.850655,
-    -0.849262,
-    -0.850447,
-    -0.852837,
-    -0.853696,
-    -0.852059,
-    -0.849814,
-    -0.849524,
-    -0.851505,
-    -0.853477,
-    -0.853194,
-    -0.850996,
-    -0.849406,
-    -0.850231,
-    -0.852511,
-    -0.853633,
-    -0.852329,
-    -0.850105,
-    -0.849504,
-    -0.851199,
-    -0.853238,
-    -0.853293,
-    -0.851318,
-    -0.849581,
-    -0.850061,
-    -0.852193,
-    -0.853533,
-    -0.852559,
-    -0.850399,
-    -0.849527,
-    -0.850926,
-    -0.852984,
-    -0.853348,
-    -0.851617,
-    -0.84978,
-    -0.849934,
-    -0.851888,
-    -0.853399,
-    -0.852748,
-    -0.850693,
-    -0.849588,
-    -0.850687,
-    -0.85272,
-    -0.853361,
-    -0.851889,
-    -0.849999,
-    -0.84985,
-    -0.851599,
-    -0.853238,
-    -0.852897,
-    -0.85098,
-    -0.849684,
-    -0.850484,
-    -0.852452,
-    -0.853335,
-    -0.852133,
-    -0.850232,
-    -0.849806,
-    -0.851331,
-    -0.853053,
-    -0.853006,
-    -0.851256,
-    -0.849811,
-    -0.850317,
-    -0.852185,
-    -0.853273,
-    -0.852346,
-    -0.850474,
-    -0.8498,
-    -0.851085,
-    -0.85285,
-    -0.853077,
-    -0.851518,
-    -0.849963,
-    -0.850187,
-    -0.851923,
-    -0.85318,
-    -0.852527,
-    -0.85072,
-    -0.84983,
-    -0.850866,
-    -0.852634,
-    -0.853111,
-    -0.851762,
-    -0.850137,
-    -0.850093,
-    -0.85167,
-    -0.853058,
-    -0.852674,
-    -0.850967,
-    -0.849893,
-    -0.850675,
-    -0.852408,
-    -0.85311,
-    -0.851984,
-    -0.850327,
-    -0.850034,
-    -0.85143,
-    -0.852913,
-    -0.852789,
-    -0.851209,
-    -0.849985,
-    -0.850513,
-    -0.852179,
-    -0.853075,
-    -0.852183,
-    -0.85053,
-    -0.850009,
-    -0.851208,
-    -0.852748,
-    -0.852869,
-    -0.851442,
-    -0.850103,
-    -0.850382,
-    -0.85195,
-    -0.853011,
-    -0.852355,
-    -0.850742,
-    -0.850017,
-    -0.851005,
-    -0.852567,
-    -0.852917,
-    -0.851662,
-    -0.850243,
-    -0.850282,
-    -0.851726,
-    -0.852919,
-    -0.8525,
-    -0.850956,
-    -0.850056,
-    -0.850824,
-    -0.852375,
-    -0.852933,
-    -0.851867,
-    -0.850402,
-    -0.850213,
-    -0.85151,
-    -0.852803,
-    -0.852617,
-    -0.851171,
-    -0.850123,
-    -0.850668,
-    -0.852175,
-    -0.852919,
-    -0.852053,
-    -0.850575,
-    -0.850175,
-    -0.851305,
-    -0.852667,
-    -0.852704,
-    -0.85138,
-    -0.850215,
-    -0.850537,
-    -0.851973,
-    -0.852876,
-    -0.852218,
-    -0.850758,
-    -0.850167,
-    -0.851116,
-    -0.852514,
-    -0.852762,
-    -0.851582,
-    -0.850329,
-    -0.850434,
-    -0.851771,
-    -0.852807,
-    -0.85236,
-    -0.850947,
-    -0.850187,
-    -0.850945,
-    -0.852348,
-    -0.852791,
-    -0.851772,
-    -0.850462,
-    -0.850358,
-    -0.851574,
-    -0.852715,
-    -0.852477,
-    -0.851139,
-    -0.850234,
-    -0.850794,
-    -0.852173,
-    -0.852792,
-    -0.851947,
-    -0.85061,
-    -0.85031,
-    -0.851386,
-    -0.852602,
-    -0.852569,
-    -0.85133,
-    -0.850305,
-    -0.850665,
-    -0.851992,
-    -0.852766,
-    -0.852105,
-    -0.850771,
-    -0.85029,
-    -0.851208,
-    -0.852471,
-    -0.852634,
-    -0.851515,
-    -0.850398,
-    -0.85056,
-    -0.851809,
-    -0.852715,
-    -0.852244,
-    -0.850939,
-    -0.850295,
-    -0.851045,
-    -0.852327,
-    -0.852673,
-    -0.851692,
-    -0.850511,
-    -0.850479,
-    -0.851629,
-    -0.852642,
-    -0.852361,
-    -0.851112,
-    -0.850326,
-    -0.850899,
-    -0.852171,
-    -0.852686,
-    -0.851858,
-    -0.850639,
-    -0.850423,
-    -0.851453,
-    -0.852548,
-    -0.852455,
-    -0.851287,
-    -0.850381,
-    -0.850772,
-    -0.852008,
-    -0.852674,
-    -0.85201,
-    -0.850781,
-    -0.850392,
-    -0.851286,
-    -0.852436,
-    -0.852526,
-    -0.851458,
-    -0.850457,
-    -0.850666,
-    -0.851842,
-    -0.852638,
-    -0.852145,
-    -0.850932,
-    -0.850387,
-    -0.851131,
-    -0.852309,
-    -0.852573,
-    -0.851625,
-    -0.850552,
-    -0.850581,
-    -0.851675,
-    -0.85258,
-    -0.852262,
-    -0.851089,
-    -0.850404,
-    -0.850989,
-    -0.85217,
-    -0.852596,
-    -0.851782,
-    -0.850663,
-    -0.850519,
-    -0.851511,
-    -0.852502,
-    -0.852359,
-    -0.851249,
-    -0.850445,
-    -0.850864,
-    -0.852023,
-    -0.852596,
-    -0.851928,
-    -0.850789,
-    -0.85048,
-    -0.851353,
-    -0.852406,
-    -0.852434,
-    -0.851409,
-    -0.850506,
-    -0.850757,
-    -0.851871,
-    -0.852572,
-    -0.852061,
-    -0.850924,
-    -0.850465,
-    -0.851204,
-    -0.852295,
-    -0.852488,
-    -0.851566,
-    -0.850586,
-    -0.850669,
-    -0.851716,
-    -0.852528,
-    -0.852177,
-    -0.851068,
-    -0.850471,
-    -0.851067,
-    -0.852171,
-    -0.852519,
-    -0.851716,
-    -0.850683,
-    -0.850602,
-    -0.851562,
-    -0.852463,
-    -0.852275,
-    -0.851216,
-    -0.8505,
-    -0.850943,
-    -0.852037,
-    -0.852528,
-    -0.851857,
-    -0.850795,
-    -0.850556,
-    -0.851412,
-    -0.852381,
-    -0.852354,
-    -0.851366,
-    -0.850549,
-    -0.850836,
-    -0.851896,
-    -0.852515,
-    -0.851987,
-    -0.850918,
-    -0.850532,
-    -0.851269,
-    -0.852283,
-    -0.852413,
-    -0.851514,
-    -0.850616,
-    -0.850746,
-    -0.851752,
-    -0.852482,
-    -0.852102,
-    -0.851049,
-    -0.850529,
-    -0.851136,
-    -0.852171,
-    -0.852452,
-    -0.851658,
-    -0.8507,
-    -0.850675,
-    -0.851607,
-    -0.85243,
-    -0.852201,
-    -0.851187,
-    -0.850548,
-    -0.851014,
-    -0.85205,
-    -0.852469,
-    -0.851794,
-    -0.8508,
-    -0.850623,
-    -0.851465,
-    -0.852359,
-    -0.852284,
-    -0.851327,
-    -0.850585,
-    -0.850906,
-    -0.85192,
-    -0.852466,
-    -0.851921,
-    -0.850911,
-    -0.850592,
-    -0.851327,
-    -0.852273,
-    -0.852347,
-    -0.851468,
-    -0.850642,
-    -0.850814,
-    -0.851785,
-    -0.852443,
-    -0.852035,
-    -0.851032,
-    -0.850581,
-    -0.851197,
-    -0.852173,
-    -0.852392,
-    -0.851605,
-    -0.850715,
-    -0.850739,
-    -0.851648,
-    -0.8524,
-    -0.852136,
-    -0.85116,
-    -0.85059,
-    -0.851077,
-    -0.852062,
-    -0.852417,
-    -0.851737,
-    -0.850803,
-    -0.850683,
-    -0.851512,
-    -0.852341,
-    -0.852221,
-    -0.851292,
-    -0.850618,
-    -0.850969,
-    -0.851941,
-    -0.852422,
-    -0.851861,
-    -0.850904,
-    -0.850645,
-    -0.851379,
-    -0.852265,
-    -0.852289,
-    -0.851425,
-    -0.850664,
-    -0.850875,
-    -0.851815,
-    -0.852407,
-    -0.851975,
-    -0.851015,
-    -0.850626,
-    -0.851252,
-    -0.852175,
-    -0.852338,
-    -0.851557,
-    -0.850727,
-    -0.850797,
-    -0.851686,
-    -0.852375,
-    -0.852077,
-    -0.851134,
-    -0.850627,
-    -0.851134,
-    -0.852073,
-    -0.85237,
-    -0.851686,
-    -0.850805,
-    -0.850736,
-    -0.851555,
-    -0.852324,
-    -0.852164,
-    -0.851259,
-    -0.850646,
-    -0.851026,
-    -0.851962,
-    -0.852382,
-    -0.851808,
-    -0.850897,
-    -0.850693,
-    -0.851427,
-    -0.852258,
-    -0.852235,
-    -0.851386,
-    -0.850684,
-    -0.850931,
-    -0.851843,
-    -0.852376,
-    -0.851921,
-    -0.851,
-    -0.850667,
-    -0.851303,
-    -0.852177,
-    -0.85229,
-    -0.851514,
-    -0.850738,
-    -0.85085,
-    -0.85172,
-    -0.852352,
-    -0.852023,
-    -0.851111,
-    -0.850661,
-    -0.851186,
-    -0.852084,
-    -0.852327,
-    -0.851638,
-    -0.850807,
-    -0.850785,
-    -0.851595,
-    -0.85231,
-    -0.852112,
-    -0.851229,
-    -0.850672,
-    -0.851078,
-    -0.851981,
-    -0.852347,
-    -0.851758,
-    -0.85089,
-    -0.850736,
-    -0.851471,
-    -0.852253,
-    -0.852187,
-    -0.85135,
-    -0.850701,
-    -0.850982,
-    -0.85187,
-    -0.852348,
-    -0.85187,
-    -0.850984,
-    -0.850705,
-    -0.85135,
-    -0.852181,
-    -0.852246,
-    -0.851473,
-    -0.850747,
-    -0.850898,
-    -0.851753,
-    -0.852332,
-    -0.851973,
-    -0.851088,
-    -0.850691,
-    -0.851234,
-    -0.852096,
-    -0.852289,
-    -0.851594,
-    -0.850808,
-    -0.850829,
-    -0.851633,
-    -0.852298,
-    -0.852064,
-    -0.8512,
-    -0.850695,
-    -0.851127,
-    -0.852,
-    -0.852314,
-    -0.851712,
-    -0.850882,
-    -0.850776,
-    -0.851512,
-    -0.852249,
-    -0.852142,
-    -0.851316,
-    -0.850716,
-    -0.851029,
-    -0.851895,
-    -0.852323,
-    -0.851823,
-    -0.85097,
-    -0.850739,
-    -0.851394,
-    -0.852184,
-    -0.852206,
-    -0.851434,
-    -0.850754,
-    -0.850943,
-    -0.851784,
-    -0.852314,
-    -0.851927,
-    -0.851067,
-    -0.850719,
-    -0.851279,
-    -0.852107,
-    -0.852253,
-    -0.851553,
-    -0.850807,
-    -0.85087,
-    -0.851668,
-    -0.852288,
-    -0.85202,
-    -0.851172,
-    -0.850716,
-    -0.851172,
-    -0.852018,
-    -0.852285,
-    -0.851668,
-    -0.850875,
-    -0.850812,
-    -0.851551,
-    -0.852246,
-    -0.852101,
-    -0.851283,
-    -0.85073,
-    -0.851073,
-    -0.851919,
-    -0.8523,
-    -0.851779,
-    -0.850955,
-    -0.85077,
-    -0.851435,
-    -0.852189,
-    -0.852168,
-    -0.851398,
-    -0.85076,
-    -0.850985,
-    -0.851813,
-    -0.852297,
-    -0.851883,
-    -0.851046,
-    -0.850744,
-    -0.851322,
-    -0.852118,
-    -0.852221,
-    -0.851513,
-    -0.850806,
-    -0.850909,
-    -0.851702,
-    -0.852278,
-    -0.851978,
-    -0.851146,
-    -0.850734,
-    -0.851214,
-    -0.852035,
-    -0.852258,
-    -0.851627,
-    -0.850867,
-    -0.850846,
-    -0.851589,
-    -0.852243,
-    -0.852062,
-    -0.851252,
-    -0.850742,
-    -0.851114,
-    -0.851943,
-    -0.852278,
-    -0.851738,
-    -0.85094,
-    -0.850799,
-    -0.851475,
-    -0.852193,
-    -0.852133,
-    -0.851363,
-    -0.850765,
-    -0.851024,
-    -0.851842,
-    -0.852283,
-    -0.851842,
-    -0.851025,
-    -0.850767,
-    -0.851363,
-    -0.85213,
-    -0.85219,
-    -0.851476,
-    -0.850805,
-    -0.850945,
-    -0.851735,
-    -0.85227,
-    -0.851938,
-    -0.85112,
-    -0.850752,
-    -0.851255,
-    -0.852053,
-    -0.852232,
-    -0.851588,
-    -0.850858,
-    -0.850878,
-    -0.851624,
-    -0.852242,
-    -0.852025,
-    -0.851222,
-    -0.850752,
-    -0.851154,
-    -0.851966,
-    -0.852259,
-    -0.851698,
-    -0.850926,
-    -0.850826,
-    -0.851513,
-    -0.852199,
-    -0.8521,
-    -0.851329,
-    -0.850769,
-    -0.851061,
-    -0.85187,
-    -0.852269,
-    -0.851803,
-    -0.851005,
-    -0.850789,
-    -0.851402,
-    -0.852141,
-    -0.852161,
-    -0.851439,
-    -0.850802,
-    -0.850979,
-    -0.851767,
-    -0.852264,
-    -0.851901,
-    -0.851094,
-    -0.850767,
-    -0.851294,
-    -0.852071,
-    -0.852208,
-    -0.85155,
-    -0.850849,
-    -0.850909,
-    -0.851659,
-    -0.852242,
-    -0.85199,
-    -0.851192,
-    -0.850762,
-    -0.851192,
-    -0.851989,
-    -0.852241,
-    -0.851659,
-    -0.850911,
-    -0.850852,
-    -0.851549,
-    -0.852205,
-    -0.852068,
-    -0.851296,
-    -0.850772,
-    -0.851097,
-    -0.851897,
-    -0.852257,
-    -0.851765,
-    -0.850984,
-    -0.850809,
-    -0.851439,
-    -0.852153,
-    -0.852134,
-    -0.851404,
-    -0.850799,
-    -0.851012,
-    -0.851798,
-    -0.852258,
-    -0.851865,
-    -0.851069,
-    -0.850782,
-    -0.851332,
-    -0.852089,
-    -0.852186,
-    -0.851513,
-    -0.85084,
-    -0.850937,
-    -0.851694,
-    -0.852242,
-    -0.851956,
-    -0.851162,
-    -0.85077,
-    -0.851228,
-    -0.852012,
-    -0.852224,
-    -0.851622,
-    -0.850895,
-    -0.850876,
-    -0.851586,
-    -0.852212,
-    -0.852038,
-    -0.851263,
-    -0.850775,
-    -0.851131,
-    -0.851925,
-    -0.852246,
-    -0.851728,
-    -0.850964,
-    -0.850828,
-    -0.851476,
-    -0.852166,
-    -0.852108,
-    -0.851368,
-    -0.850795,
-    -0.851043,
-    -0.851829,
-    -0.852253,
-    -0.851829,
-    -0.851044,
-    -0.850795,
-    -0.851368,
-    -0.852107,
-    -0.852165,
-    -0.851477,
-    -0.85083,
-    -0.850965,
-    -0.851727,
-    -0.852244,
-    -0.851923,
-    -0.851133,
-    -0.850778,
-    -0.851264,
-    -0.852035,
-    -0.852208,
-    -0.851585,
-    -0.85088,
-    -0.850899,
-    -0.851621,
-    -0.852219,
-    -0.852009,
-    -0.851231,
-    -0.850776,
-    -0.851165,
-    -0.851952,
-    -0.852236,
-    -0.851692,
-    -0.850943,
-    -0.850846,
-    -0.851513,
-    -0.852179,
-    -0.852083,
-    -0.851334,
-    -0.85079,
-    -0.851074,
-    -0.85186,
-    -0.852249,
-    -0.851795,
-    -0.851018,
-    -0.850808,
-    -0.851405,
-    -0.852126,
-    -0.852145,
-    -0.851441,
-    -0.850819,
-    -0.850992,
-    -0.851761,
-    -0.852246,
-    -0.851892,
-    -0.851104,
-    -0.850784,
-    -0.851299,
-    -0.852059,
-    -0.852193,
-    -0.851549,
-    -0.850863,
-    -0.850921,
-    -0.851657,
-    -0.852227,
-    -0.85198,
-    -0.851198,
-    -0.850776,
-    -0.851198,
-    -0.85198,
-    -0.852227,
-    -0.851657,
-    -0.850921,
-    -0.850863,
-    -0.851549,
-    -0.852193,
-    -0.852059,
-    -0.851299,
-    -0.850784,
-    -0.851104,
-    -0.851892,
-    -0.852246,
-    -0.851761,
-    -0.850992,
-    -0.850819,
-    -0.851441,
-    -0.852145,
-    -0.852126,
-    -0.851405,
-    -0.850808,
-    -0.851018,
-    -0.851795,
-    -0.852249,
-    -0.85186,
-    -0.851074,
-    -0.85079,
-    -0.851334,
-    -0.852083,
-    -0.852179,
-    -0.851513,
-    -0.850846,
-    -0.850943,
-    -0.851692,
-    -0.852236,
-    -0.851952,
-    -0.851165,
-    -0.850776,
-    -0.851231,
-    -0.852009,
-    -0.852219,
-    -0.851621,
-    -0.850899,
-    -0.85088,
-    -0.851585,
-    -0.852208,
-    -0.852035,
-    -0.851264,
-    -0.850778,
-    -0.851133,
-    -0.851923,
-    -0.852244,
-    -0.851727,
-    -0.850965,
-    -0.85083,
-    -0.851477,
-    -0.852165,
-    -0.852107,
-    -0.851368,
-    -0.850795,
-    -0.851044,
-    -0.851829,
-    -0.852253,
-    -0.851829,
-    -0.851043,
-    -0.850795,
-    -0.851368,
-    -0.852108,
-    -0.852166,
-    -0.851476,
-    -0.850828,
-    -0.850964,
-    -0.851728,
-    -0.852246,
-    -0.851925,
-    -0.851131,
-    -0.850775,
-    -0.851263,
-    -0.852038,
-    -0.852212,
-    -0.851586,
-    -0.850876,
-    -0.850895,
-    -0.851622,
-    -0.852224,
-    -0.852012,
-    -0.851228,
-    -0.85077,
-    -0.851162,
-    -0.851956,
-    -0.852242,
-    -0.851694,
-    -0.850937,
-    -0.85084,
-    -0.851513,
-    -0.852186,
-    -0.852089,
-    -0.851332,
-    -0.850782,
-    -0.851069,
-    -0.851865,
-    -0.852258,
-    -0.851798,
-    -0.851012,
-    -0.850799,
-    -0.851404,
-    -0.852134,
-    -0.852153,
-    -0.851439,
-    -0.850809,
-    -0.850984,
-    -0.851765,
-    -0.852257,
-    -0.851897,
-    -0.851097,
-    -0.850772,
-    -0.851296,
-    -0.852068,
-    -0.852205,
-    -0.851549,
-    -0.850852,
-    -0.850911,
-    -0.851659,
-    -0.852241,
-    -0.851989,
-    -0.851192,
-    -0.850762,
-    -0.851192,
-    -0.85199,
-    -0.852242,
-    -0.851659,
-    -0.850909,
-    -0.850849,
-    -0.85155,
-    -0.852208,
-    -0.852071,
-    -0.851294,
-    -0.850767,
-    -0.851094,
-    -0.851901,
-    -0.852264,
-    -0.851767,
-    -0.850979,
-    -0.850802,
-    -0.851439,
-    -0.852161,
-    -0.852141,
-    -0.851402,
-    -0.850789,
-    -0.851005,
-    -0.851803,
-    -0.852269,
-    -0.85187,
-    -0.851061,
-    -0.850769,
-    -0.851329,
-    -0.8521,
-    -0.852199,
-    -0.851513,
-    -0.850826,
-    -0.850926,
-    -0.851698,
-    -0.852259,
-    -0.851966,
-    -0.851154,
-    -0.850752,
-    -0.851222,
-    -0.852025,
-    -0.852242,
-    -0.851624,
-    -0.850878,
-    -0.850858,
-    -0.851588,
-    -0.852232,
-    -0.852053,
-    -0.851255,
-    -0.850752,
-    -0.85112,
-    -0.851938,
-    -0.85227,
-    -0.851735,
-    -0.850945,
-    -0.850805,
-    -0.851476,
-    -0.85219,
-    -0.85213,
-    -0.851363,
-    -0.850767,
-    -0.851025,
-    -0.851842,
-    -0.852283,
-    -0.851842,
-    -0.851024,
-    -0.850765,
-    -0.851363,
-    -0.852133,
-    -0.852193,
-    -0.851475,
-    -0.850799,
-    -0.85094,
-    -0.851738,
-    -0.852278,
-    -0.851943,
-    -0.851114,
-    -0.850742,
-    -0.851252,
-    -0.852062,
-    -0.852243,
-    -0.851589,
-    -0.850846,
-    -0.850867,
-    -0.851627,
-    -0.852258,
-    -0.852035,
-    -0.851214,
-    -0.850734,
-    -0.851146,
-    -0.851978,
-    -0.852278,
-    -0.851702,
-    -0.850909,
-    -0.850806,
-    -0.851513,
-    -0.852221,
-    -0.852118,
-    -0.851322,
-    -0.850744,
-    -0.851046,
-    -0.851883,
-    -0.852297,
-    -0.851813,
-    -0.850985,
-    -0.85076,
-    -0.851398,
-    -0.852168,
-    -0.852189,
-    -0.851435,
-    -0.85077,
-    -0.850955,
-    -0.851779,
-    -0.8523,
-    -0.851919,
-    -0.851073,
-    -0.85073,
-    -0.851283,
-    -0.852101,
-    -0.852246,
-    -0.851551,
-    -0.850812,
-    -0.850875,
-    -0.851668,
-    -0.852285,
-    -0.852018,
-    -0.851172,
-    -0.850716,
-    -0.851172,
-    -0.85202,
-    -0.852288,
-    -0.851668,
-    -0.85087,
-    -0.850807,
-    -0.851553,
-    -0.852253,
-    -0.852107,
-    -0.851279,
-    -0.850719,
-    -0.851067,
-    -0.851927,
-    -0.852314,
-    -0.851784,
-    -0.850943,
-    -0.850754,
-    -0.851434,
-    -0.852206,
-    -0.852184,
-    -0.851394,
-    -0.850739,
-    -0.85097,
-    -0.851823,
-    -0.852323,
-    -0.851895,
-    -0.851029,
-    -0.850716,
-    -0.851316,
-    -0.852142,
-    -0.852249,
-    -0.851512,
-    -0.850776,
-    -0.850882,
-    -0.851712,
-    -0.852314,
-    -0.852,
-    -0.851127,
-    -0.850695,
-    -0.8512,
-    -0.852064,
-    -0.852298,
-    -0.851633,
-    -0.850829,
-    -0.850808,
-    -0.851594,
-    -0.852289,
-    -0.852096,
-    -0.851234,
-    -0.850691,
-    -0.851088,
-    -0.851973,
-    -0.852332,
-    -0.851753,
-    -0.850898,
-    -0.850747,
-    -0.851473,
-    -0.852246,
-    -0.852181,
-    -0.85135,
-    -0.850705,
-    -0.850984,
-    -0.85187,
-    -0.852348,
-    -0.85187,
-    -0.850982,
-    -0.850701,
-    -0.85135,
-    -0.852187,
-    -0.852253,
-    -0.851471,
-    -0.850736,
-    -0.85089,
-    -0.851758,
-    -0.852347,
-    -0.851981,
-    -0.851078,
-    -0.850672,
-    -0.851229,
-    -0.852112,
-    -0.85231,
-    -0.851595,
-    -0.850785,
-    -0.850807,
-    -0.851638,
-    -0.852327,
-    -0.852084,
-    -0.851186,
-    -0.850661,
-    -0.851111,
-    -0.852023,
-    -0.852352,
-    -0.85172,
-    -0.85085,
-    -0.850738,
-    -0.851514,
-    -0.85229,
-    -0.852177,
-    -0.851303,
-    -0.850667,
-    -0.851,
-    -0.851921,
-    -0.852376,
-    -0.851843,
-    -0.850931,
-    -0.850684,
-    -0.851386,
-    -0.852235,
-    -0.852258,
-    -0.851427,
-    -0.850693,
-    -0.850897,
-    -0.851808,
-    -0.852382,
-    -0.851962,
-    -0.851026,
-    -0.850646,
-    -0.851259,
-    -0.852164,
-    -0.852324,
-    -0.851555,
-    -0.850736,
-    -0.850805,
-    -0.851686,
-    -0.85237,
-    -0.852073,
-    -0.851134,
-    -0.850627,
-    -0.851134,
-    -0.852077,
-    -0.852375,
-    -0.851686,
-    -0.850797,
-    -0.850727,
-    -0.851557,
-    -0.852338,
-    -0.852175,
-    -0.851252,
-    -0.850626,
-    -0.851015,
-    -0.851975,
-    -0.852407,
-    -0.851815,
-    -0.850875,
-    -0.850664,
-    -0.851425,
-    -0.852289,
-    -0.852265,
-    -0.851379,
-    -0.850645,
-    -0.850904,
-    -0.851861,
-    -0.852422,
-    -0.851941,
-    -0.850969,
-    -0.850618,
-    -0.851292,
-    -0.852221,
-    -0.852341,
-    -0.851512,
-    -0.850683,
-    -0.850803,
-    -0.851737,
-    -0.852417,
-    -0.852062,
-    -0.851077,
-    -0.85059,
-    -0.85116,
-    -0.852136,
-    -0.8524,
-    -0.851648,
-    -0.850739,
-    -0.850715,
-    -0.851605,
-    -0.852392,
-    -0.852173,
-    -0.851197,
-    -0.850581,
-    -0.851032,
-    -0.852035,
-    -0.852443,
-    -0.851785,
-    -0.850814,
-    -0.850642,
-    -0.851468,
-    -0.852347,
-    -0.852273,
-    -0.851327,
-    -0.850592,
-    -0.850911,
-    -0.851921,
-    -0.852466,
-    -0.85192,
-    -0.850906,
-    -0.850585,
-    -0.851327,
-    -0.852284,
-    -0.852359,
-    -0.851465,
-    -0.850623,
-    -0.8508,
-    -0.851794,
-    -0.852469,
-    -0.85205,
-    -0.851014,
-    -0.850548,
-    -0.851187,
-    -0.852201,
-    -0.85243,
-    -0.851607,
-    -0.850675,
-    -0.8507,
-    -0.851658,
-    -0.852452,
-    -0.852171,
-    -0.851136,
-    -0.850529,
-    -0.851049,
-    -0.852102,
-    -0.852482,
-    -0.851752,
-    -0.850746,
-    -0.850616,
-    -0.851514,
-    -0.852413,
-    -0.852283,
-    -0.851269,
-    -0.850532,
-    -0.850918,
-    -0.851987,
-    -0.852515,
-    -0.851896,
-    -0.850836,
-    -0.850549,
-    -0.851366,
-    -0.852354,
-    -0.852381,
-    -0.851412,
-    -0.850556,
-    -0.850795,
-    -0.851857,
-    -0.852528,
-    -0.852037,
-    -0.850943,
-    -0.8505,
-    -0.851216,
-    -0.852275,
-    -0.852463,
-    -0.851562,
-    -0.850602,
-    -0.850683,
-    -0.851716,
-    -0.852519,
-    -0.852171,
-    -0.851067,
-    -0.850471,
-    -0.851068,
-    -0.852177,
-    -0.852528,
-    -0.851716,
-    -0.850669,
-    -0.850586,
-    -0.851566,
-    -0.852488,
-    -0.852295,
-    -0.851204,
-    -0.850465,
-    -0.850924,
-    -0.852061,
-    -0.852572,
-    -0.851871,
-    -0.850757,
-    -0.850506,
-    -0.851409,
-    -0.852434,
-    -0.852406,
-    -0.851353,
-    -0.85048,
-    -0.850789,
-    -0.851928,
-    -0.852596,
-    -0.852023,
-    -0.850864,
-    -0.850445,
-    -0.851249,
-    -0.852359,
-    -0.852502,
-    -0.851511,
-    -0.850519,
-    -0.850663,
-    -0.851782,
-    -0.852596,
-    -0.85217,
-    -0.850989,
-    -0.850404,
-    -0.851089,
-    -0.852262,
-    -0.85258,
-    -0.851675,
-    -0.850581,
-    -0.850552,
-    -0.851625,
-    -0.852573,
-    -0.852309,
-    -0.851131,
-    -0.850387,
-    -0.850932,
-    -0.852145,
-    -0.852638,
-    -0.851842,
-    -0.850666,
-    -0.850457,
-    -0.851458,
-    -0.852526,
-    -0.852436,
-    -0.851286,
-    -0.850392,
-    -0.850781,
-    -0.85201,
-    -0.852674,
-    -0.852008,
-    -0.850772,
-    -0.850381,
-    -0.851287,
-    -0.852455,
-    -0.852548,
-    -0.851453,
-    -0.850423,
-    -0.850639,
-    -0.851858,
-    -0.852686,
-    -0.852171,
-    -0.850899,
-    -0.850326,
-    -0.851112,
-    -0.852361,
-    -0.852642,
-    -0.851629,
-    -0.850479,
-    -0.850511,
-    -0.851692,
-    -0.852673,
-    -0.852327,
-    -0.851045,
-    -0.850295,
-    -0.850939,
-    -0.852244,
-    -0.852715,
-    -0.851809,
-    -0.85056,
-    -0.850398,
-    -0.851515,
-    -0.852634,
-    -0.852471,
-    -0.851208,
-    -0.85029,
-    -0.850771,
-    -0.852105,
-    -0.852766,
-    -0.851992,
-    -0.850665,
-    -0.850305,
-    -0.85133,
-    -0.852569,
-    -0.852602,
-    -0.851386,
-    -0.85031,
-    -0.85061,
-    -0.851947,
-    -0.852792,
-    -0.852173,
-    -0.850794,
-    -0.850234,
-    -0.851139,
-    -0.852477,
-    -0.852715,
-    -0.851574,
-    -0.850358,
-    -0.850462,
-    -0.851772,
-    -0.852791,
-    -0.852348,
-    -0.850945,
-    -0.850187,
-    -0.850947,
-    -0.85236,
-    -0.852807,
-    -0.851771,
-    -0.850434,
-    -0.850329,
-    -0.851582,
-    -0.852762,
-    -0.852514,
-    -0.851116,
-    -0.850167,
-    -0.850758,
-    -0.852218,
-    -0.852876,
-    -0.851973,
-    -0.850537,
-    -0.850215,
-    -0.85138,
-    -0.852704,
-    -0.852667,
-    -0.851305,
-    -0.850175,
-    -0.850575,
-    -0.852053,
-    -0.852919,
-    -0.852175,
-    -0.850668,
-    -0.850123,
-    -0.851171,
-    -0.852617,
-    -0.852803,
-    -0.85151,
-    -0.850213,
-    -0.850402,
-    -0.851867,
-    -0.852933,
-    -0.852375,
-    -0.850824,
-    -0.850056,
-    -0.850956,
-    -0.8525,
-    -0.852919,
-    -0.851726,
-    -0.850282,
-    -0.850243,
-    -0.851662,
-    -0.852917,
-    -0.852567,
-    -0.851005,
-    -0.850017,
-    -0.850742,
-    -0.852355,
-    -0.853011,
-    -0.85195,
-    -0.850382,
-    -0.850103,
-    -0.851442,
-    -0.852869,
-    -0.852748,
-    -0.851208,
-    -0.850009,
-    -0.85053,
-    -0.852183,
-    -0.853075,
-    -0.852179,
-    -0.850513,
-    -0.849985,
-    -0.851209,
-    -0.852789,
-    -0.852913,
-    -0.85143,
-    -0.850034,
-    -0.850327,
-    -0.851984,
-    -0.85311,
-    -0.852408,
-    -0.850675,
-    -0.849893,
-    -0.850967,
-    -0.852674,
-    -0.853058,
-    -0.85167,
-    -0.850093,
-    -0.850137,
-    -0.851762,
-    -0.853111,
-    -0.852634,
-    -0.850866,
-    -0.84983,
-    -0.85072,
-    -0.852527,
-    -0.85318,
-    -0.851923,
-    -0.850187,
-    -0.849963,
-    -0.851518,
-    -0.853077,
-    -0.85285,
-    -0.851085,
-    -0.8498,
-    -0.850474,
-    -0.852346,
-    -0.853273,
-    -0.852185,
-    -0.850317,
-    -0.849811,
-    -0.851256,
-    -0.853006,
-    -0.853053,
-    -0.851331,
-    -0.849806,
-    -0.850232,
-    -0.852133,
-    -0.853335,
-    -0.852452,
-    -0.850484,
-    -0.849684,
-    -0.85098,
-    -0.852897,
-    -0.853238,
-    -0.851599,
-    -0.84985,
-    -0.849999,
-    -0.851889,
-    -0.853361,
-    -0.85272,
-    -0.850687,
-    -0.849588,
-    -0.850693,
-    -0.852748,
-    -0.853399,
-    -0.851888,
-    -0.849934,
-    -0.84978,
-    -0.851617,
-    -0.853348,
-    -0.852984,
-    -0.850926,
-    -0.849527,
-    -0.850399,
-    -0.852559,
-    -0.853533,
-    -0.852193,
-    -0.850061,
-    -0.849581,
-    -0.851318,
-    -0.853293,
-    -0.853238,
-    -0.851199,
-    -0.849504,
-    -0.850105,
-    -0.852329,
-    -0.853633,
-    -0.852511,
-    -0.850231,
-    -0.849406,
-    -0.850996,
-    -0.853194,
-    -0.853477,
-    -0.851505,
-    -0.849524,
-    -0.849814,
-    -0.852059,
-    -0.853696,
-    -0.852837,
-    -0.850447,
-    -0.849262,
-    -0.850655,
-    -0.853047,
-    -0.853696,
-    -0.85184,
-    -0.849591,
-    -0.849531,
-    -0.85175,
-    -0.853717,
-    -0.853166,
-    -0.850709,
-    -0.849153,
-    -0.850297,
-    -0.85285,
-    -0.853889,
-    -0.852204,
-    -0.849708,
-    -0.849264,
-    -0.851403,
-    -0.85369,
-    -0.853494,
-    -0.851017,
-    -0.849086,
-    -0.849928,
-    -0.852602,
-    -0.85405,
-    -0.852593,
-    -0.849878,
-    -0.849017,
-    -0.851019,
-    -0.853611,
-    -0.853815,
-    -0.851372,
-    -0.849065,
-    -0.849552,
-    -0.852301,
-    -0.854173,
-    -0.853003,
-    -0.850105,
-    -0.848796,
-    -0.8506,
-    -0.853475,
-    -0.854123,
-    -0.851773,
-    -0.849097,
-    -0.849173,
-    -0.851944,
-    -0.854251,
-    -0.853431,
-    -0.850393,
-    -0.848609,
-    -0.850148,
-    -0.853277,
-    -0.854412,
-    -0.852221,
-    -0.849188,
-    -0.848796,
-    -0.851529,
-    -0.854277,
-    -0.853874,
-    -0.850746,
-    -0.848462,
-    -0.849664,
-    -0.853012,
-    -0.854675,
-    -0.852716,
-    -0.849345,
-    -0.848428,
-    -0.851055,
-    -0.854244,
-    -0.854328,
-    -0.851168,
-    -0.848363,
-    -0.84915,
-    -0.852673,
-    -0.854906,
-    -0.853259,
-    -0.849575,
-    -0.848073,
-    -0.850517,
-    -0.854144,
-    -0.854789,
-    -0.851665,
-    -0.84832,
-    -0.848607,
-    -0.852251,
-    -0.855098,
-    -0.853852,
-    -0.849888,
-    -0.847738,
-    -0.84991,
-    -0.853966,
-    -0.855255,
-    -0.852246,
-    -0.848342,
-    -0.848035,
-    -0.851738,
-    -0.855241,
-    -0.854499,
-    -0.850296,
-    -0.847428,
-    -0.849227,
-    -0.853698,
-    -0.855722,
-    -0.85292,
-    -0.848443,
-    -0.847432,
-    -0.851118,
-    -0.855327,
-    -0.855206,
-    -0.850815,
-    -0.847149,
-    -0.848458,
-    -0.853323,
-    -0.85619,
-    -0.853705,
-    -0.848637,
-    -0.846794,
-    -0.850372,
-    -0.855342,
-    -0.855984,
-    -0.851467,
-    -0.846909,
-    -0.847582,
-    -0.852819,
-    -0.856657,
-    -0.854625,
-    -0.848944,
-    -0.846111,
-    -0.849469,
-    -0.855271,
-    -0.856853,
-    -0.852286,
-    -0.846715,
-    -0.84657,
-    -0.852151,
-    -0.857129,
-    -0.85572,
-    -0.849397,
-    -0.845367,
-    -0.848362,
-    -0.855091,
-    -0.857847,
-    -0.853326,
-    -0.846577,
-    -0.845372,
-    -0.851265,
-    -0.857613,
-    -0.857058,
-    -0.850043,
-    -0.844528,
-    -0.846967,
-    -0.854766,
-    -0.859024,
-    -0.854679,
-    -0.846509,
-    -0.843897,
-    -0.850066,
-    -0.858128,
-    -0.858761,
-    -0.850969,
-    -0.843534,
-    -0.845134,
-    -0.854235,
-    -0.860501,
-    -0.856515,
-    -0.846531,
-    -0.841969,
-    -0.848377,
-    -0.858718,
-    -0.861068,
-    -0.852337,
-    -0.842253,
-    -0.842562,
-    -0.853378,
-    -0.86252,
-    -0.859188,
-    -0.846676,
-    -0.839208,
-    -0.845818,
-    -0.859487,
-    -0.864521,
-    -0.854508,
-    -0.840374,
-    -0.838539,
-    -0.851926,
-    -0.865685,
-    -0.86357,
-    -0.847008,
-    -0.834617,
-    -0.841404,
-    -0.860752,
-    -0.87062,
-    -0.858474,
-    -0.836941,
-    -0.830943,
-    -0.849113,
-    -0.871985,
-    -0.872502,
-    -0.847622,
-    -0.824569,
-    -0.831571,
-    -0.86397,
-    -0.885593,
-    -0.868232,
-    -0.827128,
-    -0.809354,
-    -0.841677,
-    -0.8937,
-    -0.903369,
-    -0.846777,
-    -0.778453,
-    -0.786979,
-    -0.894804,
-    -0.999,
-    -0.926007,
-    -0.570307
-};
-
-// Top frequency: 44.1K * 0.00181406
-constexpr static std::array<float, 4096> wt_square_0x2 =
-{
-    0,
-    0.300646,
-    0.570307,
-    0.783755,
-    0.926009,
-    0.994572,
-    0.999002,
-    0.958,
-    0.894804,
-    0.832001,
-    0.786977,
-    0.768997,
-    0.77845,
-    0.808238,
-    0.846777,
-    0.881718,
-    0.903374,
-    0.907041,
-    0.893703,
-    0.869116,
-    0.841675,
-    0.819762,
-    0.809348,
-    0.812499,
-    0.827125,
-    0.847934,
-    0.868236,
-    0.882006,
-    0.885601,
-    0.878658,
-    0.863972,
-    0.846461,
-    0.831564,
-    0.823603,
-    0.82456,
-    0.833631,
-    0.847622,
-    0.862041,
-    0.872511,
-    0.876071,
-    0.871994,
-    0.86189,
-    0.849111,
-    0.837653,
-    0.830931,
-    0.83077,
-    0.836933,
-    0.847275,
-    0.858479,
-    0.867105,
-    0.870634,
-    0.868194,
-    0.860758,
-    0.850781,
-    0.841395,
-    0.835438,
-    0.834602,
-    0.838961,
-    0.847005,
-    0.856155,
-    0.863583,
-    0.867078,
-    0.865701,
-    0.860027,
-    0.851926,
-    0.843946,
-    0.838522,
-    0.837236,
-    0.840359,
-    0.846808,
-    0.854514,
-    0.861084,
-    0.864541,
-    0.863912,
-    0.859499,
-    0.852756,
-    0.845808,
-    0.840789,
-    0.839186,
-    0.841404,
-    0.846668,
-    0.853289,
-    0.859204,
-    0.862618,
-    0.862543,
-    0.859084,
-    0.853381,
-    0.847235,
-    0.842541,
-    0.840706,
-    0.842232,
-    0.846574,
-    0.85234,
-    0.857728,
-    0.861094,
-    0.861445,
-    0.858737,
-    0.853864,
-    0.848367,
-    0.843948,
-    0.841941,
-    0.842917,
-    0.846516,
-    0.851583,
-    0.856532,
-    0.859843,
-    0.860531,
-    0.858432,
-    0.854243,
-    0.84929,
-    0.845111,
-    0.842975,
-    0.843505,
-    0.846489,
-    0.850968,
-    0.855537,
-    0.85879,
-    0.859748,
-    0.858155,
-    0.854543,
-    0.850059,
-    0.846095,
-    0.843864,
-    0.844024,
-    0.846487,
-    0.85046,
-    0.854694,
-    0.857883,
-    0.859061,
-    0.857895,
-    0.854781,
-    0.850707,
-    0.846943,
-    0.844642,
-    0.844492,
-    0.846507,
-    0.850036,
-    0.85397,
-    0.857089,
-    0.858447,
-    0.857648,
-    0.854969,
-    0.851262,
-    0.847684,
-    0.845334,
-    0.844922,
-    0.846547,
-    0.849681,
-    0.853339,
-    0.856385,
-    0.857889,
-    0.857408,
-    0.855114,
-    0.85174,
-    0.848339,
-    0.845959,
-    0.845323,
-    0.846603,
-    0.849382,
-    0.852784,
-    0.855752,
-    0.857376,
-    0.857172,
-    0.855225,
-    0.852155,
-    0.848924,
-    0.846529,
-    0.845701,
-    0.846675,
-    0.849131,
-    0.852293,
-    0.855179,
-    0.8569,
-    0.85694,
-    0.855304,
-    0.852516,
-    0.84945,
-    0.847054,
-    0.846061,
-    0.846761,
-    0.848921,
-    0.851857,
-    0.854656,
-    0.856455,
-    0.856709,
-    0.855356,
-    0.852831,
-    0.849926,
-    0.84754,
-    0.846405,
-    0.84686,
-    0.848746,
-    0.851467,
-    0.854176,
-    0.856035,
-    0.856479,
-    0.855385,
-    0.853106,
-    0.850358,
-    0.847993,
-    0.846738,
-    0.84697,
-    0.848603,
-    0.851119,
-    0.853733,
-    0.855636,
-    0.856249,
-    0.855392,
-    0.853345,
-    0.850752,
-    0.848417,
-    0.84706,
-    0.847091,
-    0.848488,
-    0.850807,
-    0.853323,
-    0.855258,
-    0.856018,
-    0.85538,
-    0.853553,
-    0.851111,
-    0.848815,
-    0.847372,
-    0.847221,
-    0.848398,
-    0.850527,
-    0.852943,
-    0.854896,
-    0.855787,
-    0.855351,
-    0.853731,
-    0.85144,
-    0.84919,
-    0.847676,
-    0.847361,
-    0.848331,
-    0.850277,
-    0.852589,
-    0.85455,
-    0.855556,
-    0.855305,
-    0.853884,
-    0.85174,
-    0.849544,
-    0.847973,
-    0.847509,
-    0.848286,
-    0.850054,
-    0.85226,
-    0.854218,
-    0.855325,
-    0.855245,
-    0.854012,
-    0.852015,
-    0.849878,
-    0.848263,
-    0.847664,
-    0.84826,
-    0.849857,
-    0.851954,
-    0.8539,
-    0.855094,
-    0.855171,
-    0.854117,
-    0.852265,
-    0.850194,
-    0.848545,
-    0.847826,
-    0.848251,
-    0.849683,
-    0.85167,
-    0.853595,
-    0.854862,
-    0.855086,
-    0.854202,
-    0.852493,
-    0.850493,
-    0.848821,
-    0.847994,
-    0.84826,
-    0.84953,
-    0.851406,
-    0.853302,
-    0.854632,
-    0.854989,
-    0.854268,
-    0.8527,
-    0.850775,
-    0.849091,
-    0.848167,
-    0.848284,
-    0.849398,
-    0.85116,
-    0.85302,
-    0.854402,
-    0.854881,
-    0.854316,
-    0.852886,
-    0.851041,
-    0.849354,
-    0.848344,
-    0.848321,
-    0.849286,
-    0.850934,
-    0.85275,
-    0.854173,
-    0.854764,
-    0.854346,
-    0.853054,
-    0.851293,
-    0.84961,
-    0.848526,
-    0.848373,
-    0.849192,
-    0.850724,
-    0.852492,
-    0.853946,
-    0.854639,
-    0.854361,
-    0.853203,
-    0.851529,
-    0.849859,
-    0.848711,
-    0.848436,
-    0.849115,
-    0.850532,
-    0.852244,
-    0.853721,
-    0.854506,
-    0.854361,
-    0.853335,
-    0.85175,
-    0.850102,
-    0.848899,
-    0.848511,
-    0.849055,
-    0.850356,
-    0.852008,
-    0.853499,
-    0.854366,
-    0.854346,
-    0.853449,
-    0.851958,
-    0.850337,
-    0.849088,
-    0.848596,
-    0.84901,
-    0.850196,
-    0.851783,
-    0.853279,
-    0.85422,
-    0.854318,
-    0.853548,
-    0.852152,
-    0.850565,
-    0.849279,
-    0.848692,
-    0.84898,
-    0.850051,
-    0.85157,
-    0.853063,
-    0.854069,
-    0.854278,
-    0.853631,
-    0.852332,
-    0.850785,
-    0.849471,
-    0.848796,
-    0.848965,
-    0.849922,
-    0.851367,
-    0.85285,
-    0.853912,
-    0.854227,
-    0.8537,
-    0.852498,
-    0.850997,
-    0.849663,
-    0.848908,
-    0.848963,
-    0.849807,
-    0.851175,
-    0.852642,
-    0.853752,
-    0.854164,
-    0.853754,
-    0.852651,
-    0.851201,
-    0.849854,
-    0.849027,
-    0.848973,
-    0.849706,
-    0.850995,
-    0.852438,
-    0.853589,
-    0.854092,
-    0.853794,
-    0.852791,
-    0.851397,
-    0.850045,
-    0.849153,
-    0.848996,
-    0.849619,
-    0.850826,
-    0.85224,
-    0.853423,
-    0.854009,
-    0.85382,
-    0.852918,
-    0.851584,
-    0.850234,
-    0.849285,
-    0.849031,
-    0.849546,
-    0.850668,
-    0.852047,
-    0.853255,
-    0.853919,
-    0.853835,
-    0.853032,
-    0.851762,
-    0.85042,
-    0.849422,
-    0.849076,
-    0.849485,
-    0.850521,
-    0.85186,
-    0.853086,
-    0.85382,
-    0.853836,
-    0.853133,
-    0.851931,
-    0.850604,
-    0.849564,
-    0.849131,
-    0.849438,
-    0.850386,
-    0.851679,
-    0.852916,
-    0.853714,
-    0.853827,
-    0.853222,
-    0.852091,
-    0.850785,
-    0.849709,
-    0.849196,
-    0.849403,
-    0.850262,
-    0.851505,
-    0.852746,
-    0.853601,
-    0.853805,
-    0.853299,
-    0.852242,
-    0.850962,
-    0.849858,
-    0.84927,
-    0.84938,
-    0.850149,
-    0.851338,
-    0.852577,
-    0.853482,
-    0.853774,
-    0.853364,
-    0.852382,
-    0.851135,
-    0.850009,
-    0.849353,
-    0.849368,
-    0.850048,
-    0.851179,
-    0.852409,
-    0.853358,
-    0.853732,
-    0.853417,
-    0.852514,
-    0.851303,
-    0.850162,
-    0.849443,
-    0.849368,
-    0.849957,
-    0.851027,
-    0.852243,
-    0.853229,
-    0.85368,
-    0.853459,
-    0.852635,
-    0.851466,
-    0.850316,
-    0.84954,
-    0.849378,
-    0.849878,
-    0.850883,
-    0.852079,
-    0.853097,
-    0.85362,
-    0.853489,
-    0.852746,
-    0.851623,
-    0.85047,
-    0.849644,
-    0.849399,
-    0.84981,
-    0.850747,
-    0.851919,
-    0.852961,
-    0.853551,
-    0.853508,
-    0.852847,
-    0.851775,
-    0.850625,
-    0.849753,
-    0.84943,
-    0.849753,
-    0.85062,
-    0.851761,
-    0.852822,
-    0.853474,
-    0.853517,
-    0.852938,
-    0.85192,
-    0.850778,
-    0.849868,
-    0.84947,
-    0.849706,
-    0.850501,
-    0.851608,
-    0.852681,
-    0.85339,
-    0.853515,
-    0.853019,
-    0.852058,
-    0.850931,
-    0.849987,
-    0.849519,
-    0.84967,
-    0.850392,
-    0.851459,
-    0.852539,
-    0.853299,
-    0.853503,
-    0.85309,
-    0.852189,
-    0.851081,
-    0.850111,
-    0.849577,
-    0.849645,
-    0.850291,
-    0.851314,
-    0.852396,
-    0.853202,
-    0.853481,
-    0.85315,
-    0.852313,
-    0.85123,
-    0.850237,
-    0.849643,
-    0.849629,
-    0.8502,
-    0.851175,
-    0.852253,
-    0.853099,
-    0.853451,
-    0.853201,
-    0.852429,
-    0.851375,
-    0.850367,
-    0.849716,
-    0.849624,
-    0.850117,
-    0.851042,
-    0.85211,
-    0.852991,
-    0.853411,
-    0.853242,
-    0.852537,
-    0.851517,
-    0.850498,
-    0.849796,
-    0.849628,
-    0.850045,
-    0.850915,
-    0.851968,
-    0.852878,
-    0.853363,
-    0.853272,
-    0.852637,
-    0.851655,
-    0.850631,
-    0.849883,
-    0.849642,
-    0.849981,
-    0.850794,
-    0.851828,
-    0.852762,
-    0.853306,
-    0.853294,
-    0.852729,
-    0.851789,
-    0.850765,
-    0.849976,
-    0.849665,
-    0.849927,
-    0.85068,
-    0.85169,
-    0.852642,
-    0.853242,
-    0.853305,
-    0.852812,
-    0.851918,
-    0.8509,
-    0.850074,
-    0.849696,
-    0.849882,
-    0.850573,
-    0.851554,
-    0.85252,
-    0.853171,
-    0.853307,
-    0.852887,
-    0.852042,
-    0.851034,
-    0.850177,
-    0.849736,
-    0.849847,
-    0.850474,
-    0.851421,
-    0.852395,
-    0.853093,
-    0.8533,
-    0.852953,
-    0.85216,
-    0.851168,
-    0.850285,
-    0.849784,
-    0.849821,
-    0.850382,
-    0.851292,
-    0.852269,
-    0.853009,
-    0.853284,
-    0.85301,
-    0.852272,
-    0.8513,
-    0.850396,
-    0.84984,
-    0.849804,
-    0.850298,
-    0.851167,
-    0.852142,
-    0.85292,
-    0.85326,
-    0.853058,
-    0.852377,
-    0.85143,
-    0.85051,
-    0.849903,
-    0.849796,
-    0.850222,
-    0.851046,
-    0.852014,
-    0.852825,
-    0.853227,
-    0.853097,
-    0.852477,
-    0.851558,
-    0.850627,
-    0.849973,
-    0.849797,
-    0.850154,
-    0.850931,
-    0.851887,
-    0.852725,
-    0.853186,
-    0.853128,
-    0.852569,
-    0.851683,
-    0.850747,
-    0.850049,
-    0.849807,
-    0.850094,
-    0.85082,
-    0.85176,
-    0.852622,
-    0.853138,
-    0.85315,
-    0.852654,
-    0.851805,
-    0.850867,
-    0.850131,
-    0.849825,
-    0.850042,
-    0.850715,
-    0.851634,
-    0.852514,
-    0.853082,
-    0.853163,
-    0.852731,
-    0.851923,
-    0.850989,
-    0.850219,
-    0.849851,
-    0.849999,
-    0.850617,
-    0.85151,
-    0.852404,
-    0.853019,
-    0.853167,
-    0.852801,
-    0.852037,
-    0.851111,
-    0.850312,
-    0.849886,
-    0.849965,
-    0.850524,
-    0.851389,
-    0.852291,
-    0.85295,
-    0.853163,
-    0.852864,
-    0.852146,
-    0.851233,
-    0.850409,
-    0.849928,
-    0.849939,
-    0.850438,
-    0.85127,
-    0.852176,
-    0.852875,
-    0.85315,
-    0.852918,
-    0.85225,
-    0.851355,
-    0.85051,
-    0.849977,
-    0.849921,
-    0.850359,
-    0.851154,
-    0.852059,
-    0.852793,
-    0.85313,
-    0.852964,
-    0.852349,
-    0.851475,
-    0.850614,
-    0.850034,
-    0.849912,
-    0.850287,
-    0.851042,
-    0.851942,
-    0.852707,
-    0.853101,
-    0.853002,
-    0.852442,
-    0.851594,
-    0.850722,
-    0.850097,
-    0.849911,
-    0.850223,
-    0.850934,
-    0.851824,
-    0.852616,
-    0.853065,
-    0.853032,
-    0.852528,
-    0.85171,
-    0.850832,
-    0.850166,
-    0.849918,
-    0.850166,
-    0.85083,
-    0.851706,
-    0.85252,
-    0.853022,
-    0.853054,
-    0.852609,
-    0.851824,
-    0.850944,
-    0.850241,
-    0.849934,
-    0.850116,
-    0.850732,
-    0.851589,
-    0.852421,
-    0.852971,
-    0.853068,
-    0.852682,
-    0.851935,
-    0.851057,
-    0.850322,
-    0.849957,
-    0.850075,
-    0.850638,
-    0.851473,
-    0.852319,
-    0.852914,
-    0.853073,
-    0.852749,
-    0.852042,
-    0.851171,
-    0.850408,
-    0.849988,
-    0.850041,
-    0.850551,
-    0.851358,
-    0.852213,
-    0.85285,
-    0.853071,
-    0.852809,
-    0.852145,
-    0.851286,
-    0.850498,
-    0.850026,
-    0.850015,
-    0.850469,
-    0.851246,
-    0.852105,
-    0.85278,
-    0.853061,
-    0.852861,
-    0.852244,
-    0.8514,
-    0.850593,
-    0.850071,
-    0.849997,
-    0.850393,
-    0.851137,
-    0.851996,
-    0.852704,
-    0.853043,
-    0.852906,
-    0.852338,
-    0.851514,
-    0.850691,
-    0.850123,
-    0.849987,
-    0.850324,
-    0.85103,
-    0.851885,
-    0.852623,
-    0.853017,
-    0.852944,
-    0.852427,
-    0.851627,
-    0.850792,
-    0.850182,
-    0.849985,
-    0.850262,
-    0.850927,
-    0.851773,
-    0.852538,
-    0.852984,
-    0.852973,
-    0.85251,
-    0.851738,
-    0.850896,
-    0.850247,
-    0.849991,
-    0.850207,
-    0.850828,
-    0.851661,
-    0.852447,
-    0.852943,
-    0.852995,
-    0.852587,
-    0.851846,
-    0.851003,
-    0.850318,
-    0.850004,
-    0.850159,
-    0.850733,
-    0.851549,
-    0.852353,
-    0.852896,
-    0.85301,
-    0.852659,
-    0.851953,
-    0.851111,
-    0.850394,
-    0.850025,
-    0.850118,
-    0.850643,
-    0.851438,
-    0.852255,
-    0.852842,
-    0.853016,
-    0.852724,
-    0.852056,
-    0.85122,
-    0.850476,
-    0.850053,
-    0.850084,
-    0.850558,
-    0.851328,
-    0.852155,
-    0.852782,
-    0.853015,
-    0.852782,
-    0.852155,
-    0.85133,
-    0.850562,
-    0.850089,
-    0.850058,
-    0.850479,
-    0.85122,
-    0.852051,
-    0.852715,
-    0.853006,
-    0.852833,
-    0.852251,
-    0.85144,
-    0.850652,
-    0.850132,
-    0.85004,
-    0.850405,
-    0.851114,
-    0.851946,
-    0.852643,
-    0.852989,
-    0.852877,
-    0.852342,
-    0.85155,
-    0.850747,
-    0.850181,
-    0.850029,
-    0.850338,
-    0.85101,
-    0.851839,
-    0.852565,
-    0.852965,
-    0.852915,
-    0.852429,
-    0.851659,
-    0.850845,
-    0.850238,
-    0.850026,
-    0.850277,
-    0.85091,
-    0.85173,
-    0.852483,
-    0.852934,
-    0.852944,
-    0.85251,
-    0.851767,
-    0.850945,
-    0.8503,
-    0.850031,
-    0.850222,
-    0.850813,
-    0.851622,
-    0.852396,
-    0.852896,
-    0.852967,
-    0.852586,
-    0.851873,
-    0.851049,
-    0.850368,
-    0.850043,
-    0.850174,
-    0.850721,
-    0.851512,
-    0.852304,
-    0.85285,
-    0.852981,
-    0.852657,
-    0.851977,
-    0.851154,
-    0.850442,
-    0.850063,
-    0.850133,
-    0.850632,
-    0.851404,
-    0.852209,
-    0.852798,
-    0.852989,
-    0.852721,
-    0.852078,
-    0.851261,
-    0.850521,
-    0.85009,
-    0.8501,
-    0.850548,
-    0.851296,
-    0.852111,
-    0.85274,
-    0.852988,
-    0.852779,
-    0.852176,
-    0.851368,
-    0.850605,
-    0.850124,
-    0.850074,
-    0.85047,
-    0.85119,
-    0.852009,
-    0.852675,
-    0.85298,
-    0.85283,
-    0.852271,
-    0.851477,
-    0.850694,
-    0.850165,
-    0.850055,
-    0.850397,
-    0.851085,
-    0.851906,
-    0.852605,
-    0.852965,
-    0.852874,
-    0.852361,
-    0.851585,
-    0.850787,
-    0.850214,
-    0.850044,
-    0.85033,
-    0.850983,
-    0.8518,
-    0.852529,
-    0.852942,
-    0.852912,
-    0.852447,
-    0.851693,
-    0.850883,
-    0.850268,
-    0.85004,
-    0.850268,
-    0.850883,
-    0.851693,
-    0.852447,
-    0.852912,
-    0.852942,
-    0.852529,
-    0.8518,
-    0.850983,
-    0.85033,
-    0.850044,
-    0.850214,
-    0.850787,
-    0.851585,
-    0.852361,
-    0.852874,
-    0.852965,
-    0.852605,
-    0.851906,
-    0.851085,
-    0.850397,
-    0.850055,
-    0.850165,
-    0.850694,
-    0.851477,
-    0.852271,
-    0.85283,
-    0.85298,
-    0.852675,
-    0.852009,
-    0.85119,
-    0.85047,
-    0.850074,
-    0.850124,
-    0.850605,
-    0.851368,
-    0.852176,
-    0.852779,
-    0.852988,
-    0.85274,
-    0.852111,
-    0.851296,
-    0.850548,
-    0.8501,
-    0.85009,
-    0.850521,
-    0.851261,
-    0.852078,
-    0.852721,
-    0.852989,
-    0.852798,
-    0.852209,
-    0.851404,
-    0.850632,
-    0.850133,
-    0.850063,
-    0.850442,
-    0.851154,
-    0.851977,
-    0.852657,
-    0.852981,
-    0.85285,
-    0.852304,
-    0.851512,
-    0.850721,
-    0.850174,
-    0.850043,
-    0.850368,
-    0.851049,
-    0.851873,
-    0.852586,
-    0.852967,
-    0.852896,
-    0.852396,
-    0.851622,
-    0.850813,
-    0.850222,
-    0.850031,
-    0.8503,
-    0.850945,
-    0.851767,
-    0.85251,
-    0.852944,
-    0.852934,
-    0.852483,
-    0.85173,
-    0.85091,
-    0.850277,
-    0.850026,
-    0.850238,
-    0.850845,
-    0.851659,
-    0.852429,
-    0.852915,
-    0.852965,
-    0.852565,
-    0.851839,
-    0.85101,
-    0.850338,
-    0.850029,
-    0.850181,
-    0.850747,
-    0.85155,
-    0.852342,
-    0.852877,
-    0.852989,
-    0.852643,
-    0.851946,
-    0.851114,
-    0.850405,
-    0.85004,
-    0.850132,
-    0.850652,
-    0.85144,
-    0.852251,
-    0.852833,
-    0.853006,
-    0.852715,
-    0.852051,
-    0.85122,
-    0.850479,
-    0.850058,
-    0.850089,
-    0.850562,
-    0.85133,
-    0.852155,
-    0.852782,
-    0.853015,
-    0.852782,
-    0.852155,
-    0.851328,
-    0.850558,
-    0.850084,
-    0.850053,
-    0.850476,
-    0.85122,
-    0.852056,
-    0.852724,
-    0.853016,
-    0.852842,
-    0.852255,
-    0.851438,
-    0.850643,
-    0.850118,
-    0.850025,
-    0.850394,
-    0.851111,
-    0.851953,
-    0.852659,
-    0.85301,
-    0.852896,
-    0.852353,
-    0.851549,
-    0.850733,
-    0.850159,
-    0.850004,
-    0.850318,
-    0.851003,
-    0.851846,
-    0.852587,
-    0.852995,
-    0.852943,
-    0.852447,
-    0.851661,
-    0.850828,
-    0.850207,
-    0.849991,
-    0.850247,
-    0.850896,
-    0.851738,
-    0.85251,
-    0.852973,
-    0.852984,
-    0.852538,
-    0.851773,
-    0.850927,
-    0.850262,
-    0.849985,
-    0.850182,
-    0.850792,
-    0.851627,
-    0.852427,
-    0.852944,
-    0.853017,
-    0.852623,
-    0.851885,
-    0.85103,
-    0.850324,
-    0.849987,
-    0.850123,
-    0.850691,
-    0.851514,
-    0.852338,
-    0.852906,
-    0.853043,
-    0.852704,
-    0.851996,
-    0.851137,
-    0.850393,
-    0.849997,
-    0.850071,
-    0.850593,
-    0.8514,
-    0.852244,
-    0.852861,
-    0.853061,
-    0.85278,
-    0.852105,
-    0.851246,
-    0.850469,
-    0.850015,
-    0.850026,
-    0.850498,
-    0.851286,
-    0.852145,
-    0.852809,
-    0.853071,
-    0.85285,
-    0.852213,
-    0.851358,
-    0.850551,
-    0.850041,
-    0.849988,
-    0.850408,
-    0.851171,
-    0.852042,
-    0.852749,
-    0.853073,
-    0.852914,
-    0.852319,
-    0.851473,
-    0.850638,
-    0.850075,
-    0.849957,
-    0.850322,
-    0.851057,
-    0.851935,
-    0.852682,
-    0.853068,
-    0.852971,
-    0.852421,
-    0.851589,
-    0.850732,
-    0.850116,
-    0.849934,
-    0.850241,
-    0.850944,
-    0.851824,
-    0.852609,
-    0.853054,
-    0.853022,
-    0.85252,
-    0.851706,
-    0.85083,
-    0.850166,
-    0.849918,
-    0.850166,
-    0.850832,
-    0.85171,
-    0.852528,
-    0.853032,
-    0.853065,
-    0.852616,
-    0.851824,
-    0.850934,
-    0.850223,
-    0.849911,
-    0.850097,
-    0.850722,
-    0.851594,
-    0.852442,
-    0.853002,
-    0.853101,
-    0.852707,
-    0.851942,
-    0.851042,
-    0.850287,
-    0.849912,
-    0.850034,
-    0.850614,
-    0.851475,
-    0.852349,
-    0.852964,
-    0.85313,
-    0.852793,
-    0.852059,
-    0.851154,
-    0.850359,
-    0.849921,
-    0.849977,
-    0.85051,
-    0.851355,
-    0.85225,
-    0.852918,
-    0.85315,
-    0.852875,
-    0.852176,
-    0.85127,
-    0.850438,
-    0.849939,
-    0.849928,
-    0.850409,
-    0.851233,
-    0.852146,
-    0.852864,
-    0.853163,
-    0.85295,
-    0.852291,
-    0.851389,
-    0.850524,
-    0.849965,
-    0.849886,
-    0.850312,
-    0.851111,
-    0.852037,
-    0.852801,
-    0.853167,
-    0.853019,
-    0.852404,
-    0.85151,
-    0.850617,
-    0.849999,
-    0.849851,
-    0.850219,
-    0.850989,
-    0.851923,
-    0.852731,
-    0.853163,
-    0.853082,
-    0.852514,
-    0.851634,
-    0.850715,
-    0.850042,
-    0.849825,
-    0.850131,
-    0.850867,
-    0.851805,
-    0.852654,
-    0.85315,
-    0.853138,
-    0.852622,
-    0.85176,
-    0.85082,
-    0.850094,
-    0.849807,
-    0.850049,
-    0.850747,
-    0.851683,
-    0.852569,
-    0.853128,
-    0.853186,
-    0.852725,
-    0.851887,
-    0.850931,
-    0.850154,
-    0.849797,
-    0.849973,
-    0.850627,
-    0.851558,
-    0.852477,
-    0.853097,
-    0.853227,
-    0.852825,
-    0.852014,
-    0.851046,
-    0.850222,
-    0.849796,
-    0.849903,
-    0.85051,
-    0.85143,
-    0.852377,
-    0.853058,
-    0.85326,
-    0.85292,
-    0.852142,
-    0.851167,
-    0.850298,
-    0.849804,
-    0.84984,
-    0.850396,
-    0.8513,
-    0.852272,
-    0.85301,
-    0.853284,
-    0.853009,
-    0.852269,
-    0.851292,
-    0.850382,
-    0.849821,
-    0.849784,
-    0.850285,
-    0.851168,
-    0.85216,
-    0.852953,
-    0.8533,
-    0.853093,
-    0.852395,
-    0.851421,
-    0.850474,
-    0.849847,
-    0.849736,
-    0.850177,
-    0.851034,
-    0.852042,
-    0.852887,
-    0.853307,
-    0.853171,
-    0.85252,
-    0.851554,
-    0.850573,
-    0.849882,
-    0.849696,
-    0.850074,
-    0.8509,
-    0.851918,
-    0.852812,
-    0.853305,
-    0.853242,
-    0.852642,
-    0.85169,
-    0.85068,
-    0.849927,
-    0.849665,
-    0.849976,
-    0.850765,
-    0.851789,
-    0.852729,
-    0.853294,
-    0.853306,
-    0.852762,
-    0.851828,
-    0.850794,
-    0.849981,
-    0.849642,
-    0.849883,
-    0.850631,
-    0.851655,
-    0.852637,
-    0.853272,
-    0.853363,
-    0.852878,
-    0.851968,
-    0.850915,
-    0.850045,
-    0.849628,
-    0.849796,
-    0.850498,
-    0.851517,
-    0.852537,
-    0.853242,
-    0.853411,
-    0.852991,
-    0.85211,
-    0.851042,
-    0.850117,
-    0.849624,
-    0.849716,
-    0.850367,
-    0.851375,
-    0.852429,
-    0.853201,
-    0.853451,
-    0.853099,
-    0.852253,
-    0.851175,
-    0.8502,
-    0.849629,
-    0.849643,
-    0.850237,
-    0.85123,
-    0.852313,
-    0.85315,
-    0.853481,
-    0.853202,
-    0.852396,
-    0.851314,
-    0.850291,
-    0.849645,
-    0.849577,
-    0.850111,
-    0.851081,
-    0.852189,
-    0.85309,
-    0.853503,
-    0.853299,
-    0.852539,
-    0.851459,
-    0.850392,
-    0.84967,
-    0.849519,
-    0.849987,
-    0.850931,
-    0.852058,
-    0.853019,
-    0.853515,
-    0.85339,
-    0.852681,
-    0.851608,
-    0.850501,
-    0.849706,
-    0.84947,
-    0.849868,
-    0.850778,
-    0.85192,
-    0.852938,
-    0.853517,
-    0.853474,
-    0.852822,
-    0.851761,
-    0.85062,
-    0.849753,
-    0.84943,
-    0.849753,
-    0.850625,
-    0.851775,
-    0.852847,
-    0.853508,
-    0.853551,
-    0.852961,
-    0.851919,
-    0.850747,
-    0.84981,
-    0.849399,
-    0.849644,
-    0.85047,
-    0.851623,
-    0.852746,
-    0.853489,
-    0.85362,
-    0.853097,
-    0.852079,
-    0.850883,
-    0.849878,
-    0.849378,
-    0.84954,
-    0.850316,
-    0.851466,
-    0.852635,
-    0.853459,
-    0.85368,
-    0.853229,
-    0.852243,
-    0.851027,
-    0.849957,
-    0.849368,
-    0.849443,
-    0.850162,
-    0.851303,
-    0.852514,
-    0.853417,
-    0.853732,
-    0.853358,
-    0.852409,
-    0.851179,
-    0.850048,
-    0.849368,
-    0.849353,
-    0.850009,
-    0.851135,
-    0.852382,
-    0.853364,
-    0.853774,
-    0.853482,
-    0.852577,
-    0.851338,
-    0.850149,
-    0.84938,
-    0.84927,
-    0.849858,
-    0.850962,
-    0.852242,
-    0.853299,
-    0.853805,
-    0.853601,
-    0.852746,
-    0.851505,
-    0.850262,
-    0.849403,
-    0.849196,
-    0.849709,
-    0.850785,
-    0.852091,
-    0.853222,
-    0.853827,
-    0.853714,
-    0.852916,
-    0.851679,
-    0.850386,
-    0.849438,
-    0.849131,
-    0.849564,
-    0.850604,
-    0.851931,
-    0.853133,
-    0.853836,
-    0.85382,
-    0.853086,
-    0.85186,
-    0.850521,
-    0.849485,
-    0.849076,
-    0.849422,
-    0.85042,
-    0.851762,
-    0.853032,
-    0.853835,
-    0.853919,
-    0.853255,
-    0.852047,
-    0.850668,
-    0.849546,
-    0.849031,
-    0.849285,
-    0.850234,
-    0.851584,
-    0.852918,
-    0.85382,
-    0.854009,
-    0.853423,
-    0.85224,
-    0.850826,
-    0.849619,
-    0.848996,
-    0.849153,
-    0.850045,
-    0.851397,
-    0.852791,
-    0.853794,
-    0.854092,
-    0.853589,
-    0.852438,
-    0.850995,
-    0.849706,
-    0.848973,
-    0.849027,
-    0.849854,
-    0.851201,
-    0.852651,
-    0.853754,
-    0.854164,
-    0.853752,
-    0.852642,
-    0.851175,
-    0.849807,
-    0.848963,
-    0.848908,
-    0.849663,
-    0.850997,
-    0.852498,
-    0.8537,
-    0.854227,
-    0.853912,
-    0.85285,
-    0.851367,
-    0.849922,
-    0.848965,
-    0.848796,
-    0.849471,
-    0.850785,
-    0.852332,
-    0.853631,
-    0.854278,
-    0.854069,
-    0.853063,
-    0.85157,
-    0.850051,
-    0.84898,
-    0.848692,
-    0.849279,
-    0.850565,
-    0.852152,
-    0.853548,
-    0.854318,
-    0.85422,
-    0.853279,
-    0.851783,
-    0.850196,
-    0.84901,
-    0.848596,
-    0.849088,
-    0.850337,
-    0.851958,
-    0.853449,
-    0.854346,
-    0.854366,
-    0.853499,
-    0.852008,
-    0.850356,
-    0.849055,
-    0.848511,
-    0.848899,
-    0.850102,
-    0.85175,
-    0.853335,
-    0.854361,
-    0.854506,
-    0.853721,
-    0.852244,
-    0.850532,
-    0.849115,
-    0.848436,
-    0.848711,
-    0.849859,
-    0.851529,
-    0.853203,
-    0.854361,
-    0.854639,
-    0.853946,
-    0.852492,
-    0.850724,
-    0.849192,
-    0.848373,
-    0.848526,
-    0.84961,
-    0.851293,
-    0.853054,
-    0.854346,
-    0.854764,
-    0.854173,
-    0.85275,
-    0.850934,
-    0.849286,
-    0.848321,
-    0.848344,
-    0.849354,
-    0.851041,
-    0.852886,
-    0.854316,
-    0.854881,
-    0.854402,
-    0.85302,
-    0.85116,
-    0.849398,
-    0.848284,
-    0.848167,
-    0.849091,
-    0.850775,
-    0.8527,
-    0.854268,
-    0.854989,
-    0.854632,
-    0.853302,
-    0.851406,
-    0.84953,
-    0.84826,
-    0.847994,
-    0.848821,
-    0.850493,
-    0.852493,
-    0.854202,
-    0.855086,
-    0.854862,
-    0.853595,
-    0.85167,
-    0.849683,
-    0.848251,
-    0.847826,
-    0.848545,
-    0.850194,
-    0.852265,
-    0.854117,
-    0.855171,
-    0.855094,
-    0.8539,
-    0.851954,
-    0.849857,
-    0.84826,
-    0.847664,
-    0.848263,
-    0.849878,
-    0.852015,
-    0.854012,
-    0.855245,
-    0.855325,
-    0.854218,
-    0.85226,
-    0.850054,
-    0.848286,
-    0.847509,
-    0.847973,
-    0.849544,
-    0.85174,
-    0.853884,
-    0.855305,
-    0.855556,
-    0.85455,
-    0.852589,
-    0.850277,
-    0.848331,
-    0.847361,
-    0.847676,
-    0.84919,
-    0.85144,
-    0.853731,
-    0.855351,
-    0.855787,
-    0.854896,
-    0.852943,
-    0.850527,
-    0.848398,
-    0.847221,
-    0.847372,
-    0.848815,
-    0.851111,
-    0.853553,
-    0.85538,
-    0.856018,
-    0.855258,
-    0.853323,
-    0.850807,
-    0.848488,
-    0.847091,
-    0.84706,
-    0.848417,
-    0.850752,
-    0.853345,
-    0.855392,
-    0.856249,
-    0.855636,
-    0.853733,
-    0.851119,
-    0.848603,
-    0.84697,
-    0.846738,
-    0.847993,
-    0.850358,
-    0.853106,
-    0.855385,
-    0.856479,
-    0.856035,
-    0.854176,
-    0.851467,
-    0.848746,
-    0.84686,
-    0.846405,
-    0.84754,
-    0.849926,
-    0.852831,
-    0.855356,
-    0.856709,
-    0.856455,
-    0.854656,
-    0.851857,
-    0.848921,
-    0.846761,
-    0.846061,
-    0.847054,
-    0.84945,
-    0.852516,
-    0.855304,
-    0.85694,
-    0.8569,
-    0.855179,
-    0.852293,
-    0.849131,
-    0.846675,
-    0.845701,
-    0.846529,
-    0.848924,
-    0.852155,
-    0.855225,
-    0.857172,
-    0.857376,
-    0.855752,
-    0.852784,
-    0.849382,
-    0.846603,
-    0.845323,
-    0.845959,
-    0.848339,
-    0.85174,
-    0.855114,
-    0.857408,
-    0.857889,
-    0.856385,
-    0.853339,
-    0.849681,
-    0.846547,
-    0.844922,
-    0.845334,
-    0.847684,
-    0.851262,
-    0.854969,
-    0.857648,
-    0.858447,
-    0.857089,
-    0.85397,
-    0.850036,
-    0.846507,
-    0.844492,
-    0.844642,
-    0.846943,
-    0.850707,
-    0.854781,
-    0.857895,
-    0.859061,
-    0.857883,
-    0.854694,
-    0.85046,
-    0.846487,
-    0.844024,
-    0.843864,
-    0.846095,
-    0.850059,
-    0.854543,
-    0.858155,
-    0.859748,
-    0.85879,
-    0.855537,
-    0.850968,
-    0.846489,
-    0.843505,
-    0.842975,
-    0.845111,
-    0.84929,
-    0.854243,
-    0.858432,
-    0.860531,
-    0.859843,
-    0.856532,
-    0.851583,
-    0.846516,
-    0.842917,
-    0.841941,
-    0.843948,
-    0.848367,
-    0.853864,
-    0.858737,
-    0.861445,
-    0.861094,
-    0.857728,
-    0.85234,
-    0.846574,
-    0.842232,
-    0.840706,
-    0.842541,
-    0.847235,
-    0.853381,
-    0.859084,
-    0.862543,
-    0.862618,
-    0.859204,
-    0.853289,
-    0.846668,
-    0.841404,
-    0.839186,
-    0.840789,
-    0.845808,
-    0.852756,
-    0.859499,
-    0.863912,
-    0.864541,
-    0.861084,
-    0.854514,
-    0.846808,
-    0.840359,
-    0.837236,
-    0.838522,
-    0.843946,
-    0.851926,
-    0.860027,
-    0.865701,
-    0.867078,
-    0.863583,
-    0.856155,
-    0.847005,
-    0.838961,
-    0.834602,
-    0.835438,
-    0.841395,
-    0.850781,
-    0.860758,
-    0.868194,
-    0.870634,
-    0.867105,
-    0.858479,
-    0.847275,
-    0.836933,
-    0.83077,
-    0.830931,
-    0.837653,
-    0.849111,
-    0.86189,
-    0.871994,
-    0.876071,
-    0.872511,
-    0.862041,
-    0.847622,
-    0.833631,
-    0.82456,
-    0.823603,
-    0.831564,
-    0.846461,
-    0.863972,
-    0.878658,
-    0.885601,
-    0.882006,
-    0.868236,
-    0.847934,
-    0.827125,
-    0.812499,
-    0.809348,
-    0.819762,
-    0.841675,
-    0.869116,
-    0.893703,
-    0.907041,
-    0.903374,
-    0.881718,
-    0.846777,
-    0.808238,
-    0.77845,
-    0.768997,
-    0.786977,
-    0.832001,
-    0.894804,
-    0.958,
-    0.999002,
-    0.994572,
-    0.926009,
-    0.783755,
-    0.570307,
-    0.300646,
-    0,
-    -0.300646,
-    -0.570307,
-    -0.783755,
-    -0.926009,
-    -0.994572,
-    -0.999002,
-    -0.958,
-    -0.894804,
-    -0.832001,
-    -0.786977,
-    -0.768997,
-    -0.77845,
-    -0.808238,
-    -0.846777,
-    -0.881718,
-    -0.903374,
-    -0.907041,
-    -0.893703,
-    -0.869116,
-    -0.841675,
-    -0.819762,
-    -0.809348,
-    -0.812499,
-    -0.827125,
-    -0.847934,
-    -0.868236,
-    -0.882006,
-    -0.885601,
-    -0.878658,
-    -0.863972,
-    -0.846461,
-    -0.831564,
-    -0.823603,
-    -0.82456,
-    -0.833631,
-    -0.847622,
-    -0.862041,
-    -0.872511,
-    -0.876071,
-    -0.871994,
-    -0.86189,
-    -0.849111,
-    -0.837653,
-    -0.830931,
-    -0.83077,
-    -0.836933,
-    -0.847275,
-    -0.858479,
-    -0.867105,
-    -0.870634,
-    -0.868194,
-    -0.860758,
-    -0.850781,
-    -0.841395,
-    -0.835438,
-    -0.834602,
-    -0.838961,
-    -0.847005,
-    -0.856155,
-    -0.863583,
-    -0.867078,
-    -0.865701,
-    -0.860027,
-    -0.851926,
-    -0.843946,
-    -0.838522,
-    -0.837236,
-    -0.840359,
-    -0.846808,
-    -0.854514,
-    -0.861084,
-    -0.864541,
-    -0.863912,
-    -0.859499,
-    -0.852756,
-    -0.845808,
-    -0.840789,
-    -0.839186,
-    -0.841404,
-    -0.846668,
-    -0.853289,
-    -0.859204,
-    -0.862618,
-    -0.862543,
-    -0.859084,
-    -0.853381,
-    -0.847235,
-    -0.842541,
-    -0.840706,
-    -0.842232,
-    -0.846574,
-    -0.85234,
-    -0.857728,
-    -0.861094,
-    -0.861445,
-    -0.858737,
-    -0.853864,
-    -0.848367,
-    -0.843948,
-    -0.841941,
-    -0.842917,
-    -0.846516,
-    -0.851583,
-    -0.856532,
-    -0.859843,
-    -0.860531,
-    -0.858432,
-    -0.854243,
-    -0.84929,
-    -0.845111,
-    -0.842975,
-    -0.843505,
-    -0.846489,
-    -0.850968,
-    -0.855537,
-    -0.85879,
-    -0.859748,
-    -0.858155,
-    -0.854543,
-    -0.850059,
-    -0.846095,
-    -0.843864,
-    -0.844024,
-    -0.846487,
-    -0.85046,
-    -0.854694,
-    -0.857883,
-    -0.859061,
-    -0.857895,
-    -0.854781,
-    -0.850707,
-    -0.846943,
-    -0.844642,
-    -0.844492,
-    -0.846507,
-    -0.850036,
-    -0.85397,
-    -0.857089,
-    -0.858447,
-    -0.857648,
-    -0.854969,
-    -0.851262,
-    -0.847684,
-    -0.845334,
-    -0.844922,
-    -0.846547,
-    -0.849681,
-    -0.853339,
-    -0.856385,
-    -0.857889,
-    -0.857408,
-    -0.855114,
-    -0.85174,
-    -0.848339,
-    -0.845959,
-    -0.845323,
-    -0.846603,
-    -0.849382,
-    -0.852784,
-    -0.855752,
-    -0.857376,
-    -0.857172,
-    -0.855225,
-    -0.852155,
-    -0.848924,
-    -0.846529,
-    -0.845701,
-    -0.846675,
-    -0.849131,
-    -0.852293,
-    -0.855179,
-    -0.8569,
-    -0.85694,
-    -0.855304,
-    -0.852516,
-    -0.84945,
-    -0.847054,
-    -0.846061,
-    -0.846761,
-    -0.848921,
-    -0.851857,
-    -0.854656,
-    -0.856455,
-    -0.856709,
-    -0.855356,
-    -0.852831,
-    -0.849926,
-    -0.84754,
-    -0.846405,
-    -0.84686,
-    -0.848746,
-    -0.851467,
-    -0.854176,
-    -0.856035,
-    -0.856479,
-    -0.855385,
-    -0.853106,
-    -0.850358,
-    -0.847993,
-    -0.846738,
-    -0.84697,
-    -0.848603,
-    -0.851119,
-    -0.853733,
-    -0.855636,
-    -0.856249,
-    -0.855392,
-    -0.853345,
-    -0.850752,
-    -0.848417,
-    -0.84706,
-    -0.847091,
-    -0.848488,
-    -0.850807,
-    -0.853323,
-    -0.855258,
-    -0.856018,
-    -0.85538,
-    -0.853553,
-    -0.851111,
-    -0.848815,
-    -0.847372,
-    -0.847221,
-    -0.848398,
-    -0.850527,
-    -0.852943,
-    -0.854896,
-    -0.855787,
-    -0.855351,
-    -0.853731,
-    -0.85144,
-    -0.84919,
-    -0.847676,
-    -0.847361,
-    -0.848331,
-    -0.850277,
-    -0.852589,
-    -0.85455,
-    -0.855556,
-    -0.855305,
-    -0.853884,
-    -0.85174,
-    -0.849544,
-    -0.847973,
-    -0.847509,
-    -0.848286,
-    -0.850054,
-    -0.85226,
-    -0.854218,
-    -0.855325,
-    -0.855245,
-    -0.854012,
-    -0.852015,
-    -0.849878,
-    -0.848263,
-    -0.847664,
-    -0.84826,
-    -0.849857,
-    -0.851954,
-    -0.8539,
-    -0.855094,
-    -0.855171,
-    -0.854117,
-    -0.852265,
-    -0.850194,
-    -0.848545,
-    -0.847826,
-    -0.848251,
-    -0.849683,
-    -0.85167,
-    -0.853595,
-    -0.854862,
-    -0.855086,
-    -0.854202,
-    -0.852493,
-    -0.850493,
-    -0.848821,
-    -0.847994,
-    -0.84826,
-    -0.84953,
-    -0.851406,
-    -0.853302,
-    -0.854632,
-    -0.854989,
-    -0.854268,
-    -0.8527,
-    -0.850775,
-    -0.849091,
-    -0.848167,
-    -0.848284,
-    -0.849398,
-    -0.85116,
-    -0.85302,
-    -0.854402,
-    -0.854881,
-    -0.854316,
-    -0.852886,
-    -0.851041,
-    -0.849354,
-    -0.848344,
-    -0.848321,
-    -0.849286,
-    -0.850934,
-    -0.85275,
-    -0.854173,
-    -0.854764,
-    -0.854346,
-    -0.853054,
-    -0.851293,
-    -0.84961,
-    -0.848526,
-    -0.848373,
-    -0.849192,
-    -0.850724,
-    -0.852492,
-    -0.853946,
-    -0.854639,
-    -0.854361,
-    -0.853203,
-    -0.851529,
-    -0.849859,
-    -0.848711,
-    -0.848436,
-    -0.849115,
-    -0.850532,
-    -0.852244,
-    -0.853721,
-    -0.854506,
-    -0.854361,
-    -0.853335,
-    -0.85175,
-    -0.850102,
-    -0.848899,
-    -0.848511,
-    -0.849055,
-    -0.850356,
-    -0.852008,
-    -0.853499,
-    -0.854366,
-    -0.854346,
-    -0.853449,
-    -0.851958,
-    -0.850337,
-    -0.849088,
-    -0.848596,
-    -0.84901,
-    -0.850196,
-    -0.851783,
-    -0.853279,
-    -0.85422,
-    -0.854318,
-    -0.853548,
-    -0.852152,
-    -0.850565,
-    -0.849279,
-    -0.848692,
-    -0.84898,
-    -0.850051,
-    -0.85157,
-    -0.853063,
-    -0.854069,
-    -0.854278,
-    -0.853631,
-    -0.852332,
-    -0.850785,
-    -0.849471,
-    -0.848796,
-    -0.848965,
-    -0.849922,
-    -0.851367,
-    -0.85285,
-    -0.853912,
-    -0.854227,
-    -0.8537,
-    -0.852498,
-    -0.850997,
-    -0.849663,
-    -0.848908,
-    -0.848963,
-    -0.849807,
-    -0.851175,
-    -0.852642,
-    -0.853752,
-    -0.854164,
-    -0.853754,
-    -0.852651,
-    -0.851201,
-    -0.849854,
-    -0.849027,
-    -0.848973,
-    -0.849706,
-    -0.850995,
-    -0.852438,
-    -0.853589,
-    -0.854092,
-    -0.853794,
-    -0.852791,
-    -0.851397,
-    -0.850045,
-    -0.849153,
-    -0.848996,
-    -0.849619,
-    -0.850826,
-    -0.85224,
-    -0.853423,
-    -0.854009,
-    -0.85382,
-    -0.852918,
-    -0.851584,
-    -0.850234,
-    -0.849285,
-    -0.849031,
-    -0.849546,
-    -0.850668,
-    -0.852047,
-    -0.853255,
-    -0.853919,
-    -0.853835,
-    -0.853032,
-    -0.851762,
-    -0.85042,
-    -0.849422,
-    -0.849076,
-    -0.849485,
-    -0.850521,
-    -0.85186,
-    -0.853086,
-    -0.85382,
-    -0.853836,
-    -0.853133,
-    -0.851931,
-    -0.850604,
-    -0.849564,
-    -0.849131,
-    -0.849438,
-    -0.850386,
-    -0.851679,
-    -0.852916,
-    -0.853714,
-    -0.853827,
-    -0.853222,
-    -0.852091,
-    -0.850785,
-    -0.849709,
-    -0.849196,
-    -0.849403,
-    -0.850262,
-    -0.851505,
-    -0.852746,
-    -0.853601,
-    -0.853805,
-    -0.853299,
-    -0.852242,
-    -0.850962,
-    -0.849858,
-    -0.84927,
-    -0.84938,
-    -0.850149,
-    -0.851338,
-    -0.852577,
-    -0.853482,
-    -0.853774,
-    -0.853364,
-    -0.852382,
-    -0.851135,
-    -0.850009,
-    -0.849353,
-    -0.849368,
-    -0.850048,
-    -0.851179,
-    -0.852409,
-    -0.853358,
-    -0.853732,
-    -0.853417,
-    -0.852514,
-    -0.851303,
-    -0.850162,
-    -0.849443,
-    -0.849368,
-    -0.849957,
-    -0.851027,
-    -0.852243,
-    -0.853229,
-    -0.85368,
-    -0.853459,
-    -0.852635,
-    -0.851466,
-    -0.850316,
-    -0.84954,
-    -0.849378,
-    -0.849878,
-    -0.850883,
-    -0.852079,
-    -0.853097,
-    -0.85362,
-    -0.853489,
-    -0.852746,
-    -0.851623,
-    -0.85047,
-    -0.849644,
-    -0.849399,
-    -0.84981,
-    -0.850747,
-    -0.851919,
-    -0.852961,
-    -0.853551,
-    -0.853508,
-    -0.852847,
-    -0.851775,
-    -0.850625,
-    -0.849753,
-    -0.84943,
-    -0.849753,
-    -0.85062,
-    -0.851761,
-    -0.852822,
-    -0.853474,
-    -0.853517,
-    -0.852938,
-    -0.85192,
-    -0.850778,
-    -0.849868,
-    -0.84947,
-    -0.849706,
-    -0.850501,
-    -0.851608,
-    -0.852681,
-    -0.85339,
-    -0.853515,
-    -0.853019,
-    -0.852058,
-    -0.850931,
-    -0.849987,
-    -0.849519,
-    -0.84967,
-    -0.850392,
-    -0.851459,
-    -0.852539,
-    -0.853299,
-    -0.853503,
-    -0.85309,
-    -0.852189,
-    -0.851081,
-    -0.850111,
-    -0.849577,
-    -0.849645,
-    -0.850291,
-    -0.851314,
-    -0.852396,
-    -0.853202,
-    -0.853481,
-    -0.85315,
-    -0.852313,
-    -0.85123,
-    -0.850237,
-    -0.849643,
-    -0.849629,
-    -0.8502,
-    -0.851175,
-    -0.852253,
-    -0.853099,
-    -0.853451,
-    -0.853201,
-    -0.852429,
-    -0.851375,
-    -0.850367,
-    -0.849716,
-    -0.849624,
-    -0.850117,
-    -0.851042,
-    -0.85211,
-    -0.852991,
-    -0.853411,
-    -0.853242,
-    -0.852537,
-    -0.851517,
-    -0.850498,
-    -0.849796,
-    -0.849628,
-    -0.850045,
-    -0.850915,
-    -0.851968,
-    -0.852878,
-    -0.853363,
-    -0.853272,
-    -0.852637,
-    -0.851655,
-    -0.850631,
-    -0.849883,
-    -0.849642,
-    -0.849981,
-    -0.850794,
-    -0.851828,
-    -0.852762,
-    -0.853306,
-    -0.853294,
-    -0.852729,
-    -0.851789,
-    -0.850765,
-    -0.849976,
-    -0.849665,
-    -0.849927,
-    -0.85068,
-    -0.85169,
-    -0.852642,
-    -0.853242,
-    -0.853305,
-    -0.852812,
-    -0.851918,
-    -0.8509,
-    -0.850074,
-    -0.849696,
-    -0.849882,
-    -0.850573,
-    -0.851554,
-    -0.85252,
-    -0.853171,
-    -0.853307,
-    -0.852887,
-    -0.852042,
-    -0.851034,
-    -0.850177,
-    -0.849736,
-    -0.849847,
-    -0.850474,
-    -0.851421,
-    -0.852395,
-    -0.853093,
-    -0.8533,
-    -0.852953,
-    -0.85216,
-    -0.851168,
-    -0.850285,
-    -0.849784,
-    -0.849821,
-    -0.850382,
-    -0.851292,
-    -0.852269,
-    -0.853009,
-    -0.853284,
-    -0.85301,
-    -0.852272,
-    -0.8513,
-    -0.850396,
-    -0.84984,
-    -0.849804,
-    -0.850298,
-    -0.851167,
-    -0.852142,
-    -0.85292,
-    -0.85326,
-    -0.853058,
-    -0.852377,
-    -0.85143,
-    -0.85051,
-    -0.849903,
-    -0.849796,
-    -0.850222,
-    -0.851046,
-    -0.852014,
-    -0.852825,
-    -0.853227,
-    -0.853097,
-    -0.852477,
-    -0.851558,
-    -0.850627,
-    -0.849973,
-    -0.849797,
-    -0.850154,
-    -0.850931,
-    -0.851887,
-    -0.852725,
-    -0.853186,
-    -0.853128,
-    -0.852569,
-    -0.851683,
-    -0.850747,
-    -0.850049,
-    -0.849807,
-    -0.850094,
-    -0.85082,
-    -0.85176,
-    -0.852622,
-    -0.853138,
-    -0.85315,
-    -0.852654,
-    -0.851805,
-    -0.850867,
-    -0.850131,
-    -0.849825,
-    -0.850042,
-    -0.850715,
-    -0.851634,
-    -0.852514,
-    -0.853082,
-    -0.853163,
-    -0.852731,
-    -0.851923,
-    -0.850989,
-    -0.850219,
-    -0.849851,
-    -0.849999,
-    -0.850617,
-    -0.85151,
-    -0.852404,
-    -0.853019,
-    -0.853167,
-    -0.852801,
-    -0.852037,
-    -0.851111,
-    -0.850312,
-    -0.849886,
-    -0.849965,
-    -0.850524,
-    -0.851389,
-    -0.852291,
-    -0.85295,
-    -0.853163,
-    -0.852864,
-    -0.852146,
-    -0.851233,
-    -0.850409,
-    -0.849928,
-    -0.849939,
-    -0.850438,
-    -0.85127,
-    -0.852176,
-    -0.852875,
-    -0.85315,
-    -0.852918,
-    -0.85225,
-    -0.851355,
-    -0.85051,
-    -0.849977,
-    -0.849921,
-    -0.850359,
-    -0.851154,
-    -0.852059,
-    -0.852793,
-    -0.85313,
-    -0.852964,
-    -0.852349,
-    -0.851475,
-    -0.850614,
-    -0.850034,
-    -0.849912,
-    -0.850287,
-    -0.851042,
-    -0.851942,
-    -0.852707,
-    -0.853101,
-    -0.853002,
-    -0.852442,
-    -0.851594,
-    -0.850722,
-    -0.850097,
-    -0.849911,
-    -0.850223,
-    -0.850934,
-    -0.851824,
-    -0.852616,
-    -0.853065,
-    -0.853032,
-    -0.852528,
-    -0.85171,
-    -0.850832,
-    -0.850166,
-    -0.849918,
-    -0.850166,
-    -0.85083,
-    -0.851706,
-    -0.85252,
-    -0.853022,
-    -0.853054,
-    -0.852609,
-    -0.851824,
-    -0.850944,
-    -0.850241,
-    -0.849934,
-    -0.850116,
-    -0.850732,
-    -0.851589,
-    -0.852421,
-    -0.852971,
-    -0.853068,
-    -0.852682,
-    -0.851935,
-    -0.851057,
-    -0.850322,
-    -0.849957,
-    -0.850075,
-    -0.850638,
-    -0.851473,
-    -0.852319,
-    -0.852914,
-    -0.853073,
-    -0.852749,
-    -0.852042,
-    -0.851171,
-    -0.850408,
-    -0.849988,
-    -0.850041,
-    -0.850551,
-    -0.851358,
-    -0.852213,
-    -0.85285,
-    -0.853071,
-    -0.852809,
-    -0.852145,
-    -0.851286,
-    -0.850498,
-    -0.850026,
-    -0.850015,
-    -0.850469,
-    -0.851246,
-    -0.852105,
-    -0.85278,
-    -0.853061,
-    -0.852861,
-    -0.852244,
-    -0.8514,
-    -0.850593,
-    -0.850071,
-    -0.849997,
-    -0.850393,
-    -0.851137,
-    -0.851996,
-    -0.852704,
-    -0.853043,
-    -0.852906,
-    -0.852338,
-    -0.851514,
-    -0.850691,
-    -0.850123,
-    -0.849987,
-    -0.850324,
-    -0.85103,
-    -0.851885,
-    -0.852623,
-    -0.853017,
-    -0.852944,
-    -0.852427,
-    -0.851627,
-    -0.850792,
-    -0.850182,
-    -0.849985,
-    -0.850262,
-    -0.850927,
-    -0.851773,
-    -0.852538,
-    -0.852984,
-    -0.852973,
-    -0.85251,
-    -0.851738,
-    -0.850896,
-    -0.850247,
-    -0.849991,
-    -0.850207,
-    -0.850828,
-    -0.851661,
-    -0.852447,
-    -0.852943,
-    -0.852995,
-    -0.852587,
-    -0.851846,
-    -0.851003,
-    -0.850318,
-    -0.850004,
-    -0.850159,
-    -0.850733,
-    -0.851549,
-    -0.852353,
-    -0.852896,
-    -0.85301,
-    -0.852659,
-    -0.851953,
-    -0.851111,
-    -0.850394,
-    -0.850025,
-    -0.850118,
-    -0.850643,
-    -0.851438,
-    -0.852255,
-    -0.852842,
-    -0.853016,
-    -0.852724,
-    -0.852056,
-    -0.85122,
-    -0.850476,
-    -0.850053,
-    -0.850084,
-    -0.850558,
-    -0.851328,
-    -0.852155,
-    -0.852782,
-    -0.853015,
-    -0.852782,
-    -0.852155,
-    -0.85133,
-    -0.850562,
-    -0.850089,
-    -0.850058,
-    -0.850479,
-    -0.85122,
-    -0.852051,
-    -0.852715,
-    -0.853006,
-    -0.852833,
-    -0.852251,
-    -0.85144,
-    -0.850652,
-    -0.850132,
-    -0.85004,
-    -0.850405,
-    -0.851114,
-    -0.851946,
-    -0.852643,
-    -0.852989,
-    -0.852877,
-    -0.852342,
-    -0.85155,
-    -0.850747,
-    -0.850181,
-    -0.850029,
-    -0.850338,
-    -0.85101,
-    -0.851839,
-    -0.852565,
-    -0.852965,
-    -0.852915,
-    -0.852429,
-    -0.851659,
-    -0.850845,
-    -0.850238,
-    -0.850026,
-    -0.850277,
-    -0.85091,
-    -0.85173,
-    -0.852483,
-    -0.852934,
-    -0.852944,
-    -0.85251,
-    -0.851767,
-    -0.850945,
-    -0.8503,
-    -0.850031,
-    -0.850222,
-    -0.850813,
-    -0.851622,
-    -0.852396,
-    -0.852896,
-    -0.852967,
-    -0.852586,
-    -0.851873,
-    -0.851049,
-    -0.850368,
-    -0.850043,
-    -0.850174,
-    -0.850721,
-    -0.851512,
-    -0.852304,
-    -0.85285,
-    -0.852981,
-    -0.852657,
-    -0.851977,
-    -0.851154,
-    -0.850442,
-    -0.850063,
-    -0.850133,
-    -0.850632,
-    -0.851404,
-    -0.852209,
-    -0.852798,
-    -0.852989,
-    -0.852721,
-    -0.852078,
-    -0.851261,
-    -0.850521,
-    -0.85009,
-    -0.8501,
-    -0.850548,
-    -0.851296,
-    -0.852111,
-    -0.85274,
-    -0.852988,
-    -0.852779,
-    -0.852176,
-    -0.851368,
-    -0.850605,
-    -0.850124,
-    -0.850074,
-    -0.85047,
-    -0.85119,
-    -0.852009,
-    -0.852675,
-    -0.85298,
-    -0.85283,
-    -0.852271,
-    -0.851477,
-    -0.850694,
-    -0.850165,
-    -0.850055,
-    -0.850397,
-    -0.851085,
-    -0.851906,
-    -0.852605,
-    -0.852965,
-    -0.852874,
-    -0.852361,
-    -0.851585,
-    -0.850787,
-    -0.850214,
-    -0.850044,
-    -0.85033,
-    -0.850983,
-    -0.8518,
-    -0.852529,
-    -0.852942,
-    -0.852912,
-    -0.852447,
-    -0.851693,
-    -0.850883,
-    -0.850268,
-    -0.85004,
-    -0.850268,
-    -0.850883,
-    -0.851693,
-    -0.852447,
-    -0.852912,
-    -0.852942,
-    -0.852529,
-    -0.8518,
-    -0.850983,
-    -0.85033,
-    -0.850044,
-    -0.850214,
-    -0.850787,
-    -0.851585,
-    -0.852361,
-    -0.852874,
-    -0.852965,
-    -0.852605,
-    -0.851906,
-    -0.851085,
-    -0.850397,
-    -0.850055,
-    -0.850165,
-    -0.850694,
-    -0.851477,
-    -0.852271,
-    -0.85283,
-    -0.85298,
-    -0.852675,
-    -0.852009,
-    -0.85119,
-    -0.85047,
-    -0.850074,
-    -0.850124,
-    -0.850605,
-    -0.851368,
-    -0.852176,
-    -0.852779,
-    -0.852988,
-    -0.85274,
-    -0.852111,
-    -0.851296,
-    -0.850548,
-    -0.8501,
-    -0.85009,
-    -0.850521,
-    -0.851261,
-    -0.852078,
-    -0.852721,
-    -0.852989,
-    -0.852798,
-    -0.852209,
-    -0.851404,
-    -0.850632,
-    -0.850133,
-    -0.850063,
-    -0.850442,
-    -0.851154,
-    -0.851977,
-    -0.852657,
-    -0.852981,
-    -0.85285,
-    -0.852304,
-    -0.851512,
-    -0.850721,
-    -0.850174,
-    -0.850043,
-    -0.850368,
-    -0.851049,
-    -0.851873,
-    -0.852586,
-    -0.852967,
-    -0.852896,
-    -0.852396,
-    -0.851622,
-    -0.850813,
-    -0.850222,
-    -0.850031,
-    -0.8503,
-    -0.850945,
-    -0.851767,
-    -0.85251,
-    -0.852944,
-    -0.852934,
-    -0.852483,
-    -0.85173,
-    -0.85091,
-    -0.850277,
-    -0.850026,
-    -0.850238,
-    -0.850845,
-    -0.851659,
-    -0.852429,
-    -0.852915,
-    -0.852965,
-    -0.852565,
-    -0.851839,
-    -0.85101,
-    -0.850338,
-    -0.850029,
-    -0.850181,
-    -0.850747,
-    -0.85155,
-    -0.852342,
-    -0.852877,
-    -0.852989,
-    -0.852643,
-    -0.851946,
-    -0.851114,
-    -0.850405,
-    -0.85004,
-    -0.850132,
-    -0.850652,
-    -0.85144,
-    -0.852251,
-    -0.852833,
-    -0.853006,
-    -0.852715,
-    -0.852051,
-    -0.85122,
-    -0.850479,
-    -0.850058,
-    -0.850089,
-    -0.850562,
-    -0.85133,
-    -0.852155,
-    -0.852782,
-    -0.853015,
-    -0.852782,
-    -0.852155,
-    -0.851328,
-    -0.850558,
-    -0.850084,
-    -0.850053,
-    -0.850476,
-    -0.85122,
-    -0.852056,
-    -0.852724,
-    -0.853016,
-    -0.852842,
-    -0.852255,
-    -0.851438,
-    -0.850643,
-    -0.850118,
-    -0.850025,
-    -0.850394,
-    -0.851111,
-    -0.851953,
-    -0.852659,
-    -0.85301,
-    -0.852896,
-    -0.852353,
-    -0.851549,
-    -0.850733,
-    -0.850159,
-    -0.850004,
-    -0.850318,
-    -0.851003,
-    -0.851846,
-    -0.852587,
-    -0.852995,
-    -0.852943,
-    -0.852447,
-    -0.851661,
-    -0.850828,
-    -0.850207,
-    -0.849991,
-    -0.850247,
-    -0.850896,
-    -0.851738,
-    -0.85251,
-    -0.852973,
-    -0.852984,
-    -0.852538,
-    -0.851773,
-    -0.850927,
-    -0.850262,
-    -0.849985,
-    -0.850182,
-    -0.850792,
-    -0.851627,
-    -0.852427,
-    -0.852944,
-    -0.853017,
-    -0.852623,
-    -0.851885,
-    -0.85103,
-    -0.850324,
-    -0.849987,
-    -0.850123,
-    -0.850691,
-    -0.851514,
-    -0.852338,
-    -0.852906,
-    -0.853043,
-    -0.852704,
-    -0.851996,
-    -0.851137,
-    -0.850393,
-    -0.849997,
-    -0.850071,
-    -0.850593,
-    -0.8514,
-    -0.852244,
-    -0.852861,
-    -0.853061,
-    -0.85278,
-    -0.852105,
-    -0.851246,
-    -0.850469,
-    -0.850015,
-    -0.850026,
-    -0.850498,
-    -0.851286,
-    -0.852145,
-    -0.852809,
-    -0.853071,
-    -0.85285,
-    -0.852213,
-    -0.851358,
-    -0.850551,
-    -0.850041,
-    -0.849988,
-    -0.850408,
-    -0.851171,
-    -0.852042,
-    -0.852749,
-    -0.853073,
-    -0.852914,
-    -0.852319,
-    -0.851473,
-    -0.850638,
-    -0.850075,
-    -0.849957,
-    -0.850322,
-    -0.851057,
-    -0.851935,
-    -0.852682,
-    -0.853068,
-    -0.852971,
-    -0.852421,
-    -0.851589,
-    -0.850732,
-    -0.850116,
-    -0.849934,
-    -0.850241,
-    -0.850944,
-    -0.851824,
-    -0.852609,
-    -0.853054,
-    -0.853022,
-    -0.85252,
-    -0.851706,
-    -0.85083,
-    -0.850166,
-    -0.849918,
-    -0.850166,
-    -0.850832,
-    -0.85171,
-    -0.852528,
-    -0.853032,
-    -0.853065,
-    -0.852616,
-    -0.851824,
-    -0.850934,
-    -0.850223,
-    -0.849911,
-    -0.850097,
-    -0.850722,
-    -0.851594,
-    -0.852442,
-    -0.853002,
-    -0.853101,
-    -0.852707,
-    -0.851942,
-    -0.851042,
-    -0.850287,
-    -0.849912,
-    -0.850034,
-    -0.850614,
-    -0.851475,
-    -0.852349,
-    -0.852964,
-    -0.85313,
-    -0.852793,
-    -0.852059,
-    -0.851154,
-    -0.850359,
-    -0.849921,
-    -0.849977,
-    -0.85051,
-    -0.851355,
-    -0.85225,
-    -0.852918,
-    -0.85315,
-    -0.852875,
-    -0.852176,
-    -0.85127,
-    -0.850438,
-    -0.849939,
-    -0.849928,
-    -0.850409,
-    -0.851233,
-    -0.852146,
-    -0.852864,
-    -0.853163,
-    -0.85295,
-    -0.852291,
-    -0.851389,
-    -0.850524,
-    -0.849965,
-    -0.849886,
-    -0.850312,
-    -0.851111,
-    -0.852037,
-    -0.852801,
-    -0.853167,
-    -0.853019,
-    -0.852404,
-    -0.85151,
-    -0.850617,
-    -0.849999,
-    -0.849851,
-    -0.850219,
-    -0.850989,
-    -0.851923,
-    -0.852731,
-    -0.853163,
-    -0.853082,
-    -0.852514,
-    -0.851634,
-    -0.850715,
-    -0.850042,
-    -0.849825,
-    -0.850131,
-    -0.850867,
-    -0.851805,
-    -0.852654,
-    -0.85315,
-    -0.853138,
-    -0.852622,
-    -0.85176,
-    -0.85082,
-    -0.850094,
-    -0.849807,
-    -0.850049,
-    -0.850747,
-    -0.851683,
-    -0.852569,
-    -0.853128,
-    -0.853186,
-    -0.852725,
-    -0.851887,
-    -0.850931,
-    -0.850154,
-    -0.849797,
-    -0.849973,
-    -0.850627,
-    -0.851558,
-    -0.852477,
-    -0.853097,
-    -0.853227,
-    -0.852825,
-    -0.852014,
-    -0.851046,
-    -0.850222,
-    -0.849796,
-    -0.849903,
-    -0.85051,
-    -0.85143,
-    -0.852377,
-    -0.853058,
-    -0.85326,
-    -0.85292,
-    -0.852142,
-    -0.851167,
-    -0.850298,
-    -0.849804,
-    -0.84984,
-    -0.850396,
-    -0.8513,
-    -0.852272,
-    -0.85301,
-    -0.853284,
-    -0.853009,
-    -0.852269,
-    -0.851292,
-    -0.850382,
-    -0.849821,
-    -0.849784,
-    -0.850285,
-    -0.851168,
-    -0.85216,
-    -0.852953,
-    -0.8533,
-    -0.853093,
-    -0.852395,
-    -0.851421,
-    -0.850474,
-    -0.849847,
-    -0.849736,
-    -0.850177,
-    -0.851034,
-    -0.852042,
-    -0.852887,
-    -0.853307,
-    -0.853171,
-    -0.85252,
-    -0.851554,
-    -0.850573,
-    -0.849882,
-    -0.849696,
-    -0.850074,
-    -0.8509,
-    -0.851918,
-    -0.852812,
-    -0.853305,
-    -0.853242,
-    -0.852642,
-    -0.85169,
-    -0.85068,
-    -0.849927,
-    -0.849665,
-    -0.849976,
-    -0.850765,
-    -0.851789,
-    -0.852729,
-    -0.853294,
-    -0.853306,
-    -0.852762,
-    -0.851828,
-    -0.850794,
-    -0.849981,
-    -0.849642,
-    -0.849883,
-    -0.850631,
-    -0.851655,
-    -0.852637,
-    -0.853272,
-    -0.853363,
-    -0.852878,
-    -0.851968,
-    -0.850915,
-    -0.850045,
-    -0.849628,
-    -0.849796,
-    -0.850498,
-    -0.851517,
-    -0.852537,
-    -0.853242,
-    -0.853411,
-    -0.852991,
-    -0.85211,
-    -0.851042,
-    -0.850117,
-    -0.849624,
-    -0.849716,
-    -0.850367,
-    -0.851375,
-    -0.852429,
-    -0.853201,
-    -0.853451,
-    -0.853099,
-    -0.852253,
-    -0.851175,
-    -0.8502,
-    -0.849629,
-    -0.849643,
-    -0.850237,
-    -0.85123,
-    -0.852313,
-    -0.85315,
-    -0.853481,
-    -0.853202,
-    -0.852396,
-    -0.851314,
-    -0.850291,
-    -0.849645,
-    -0.849577,
-    -0.850111,
-    -0.851081,
-    -0.852189,
-    -0.85309,
-    -0.853503,
-    -0.853299,
-    -0.852539,
-    -0.851459,
-    -0.850392,
-    -0.84967,
-    -0.849519,
-    -0.849987,
-    -0.850931,
-    -0.852058,
-    -0.853019,
-    -0.853515,
-    -0.85339,
-    -0.852681,
-    -0.851608,
-    -0.850501,
-    -0.849706,
-    -0.84947,
-    -0.849868,
-    -0.850778,
-    -0.85192,
-    -0.852938,
-    -0.853517,
-    -0.853474,
-    -0.852822,
-    -0.851761,
-    -0.85062,
-    -0.849753,
-    -0.84943,
-    -0.849753,
-    -0.850625,
-    -0.851775,
-    -0.852847,
-    -0.853508,
-    -0.853551,
-    -0.852961,
-    -0.851919,
-    -0.850747,
-    -0.84981,
-    -0.849399,
-    -0.849644,
-    -0.85047,
-    -0.851623,
-    -0.852746,
-    -0.853489,
-    -0.85362,
-    -0.853097,
-    -0.852079,
-    -0.850883,
-    -0.849878,
-    -0.849378,
-    -0.84954,
-    -0.850316,
-    -0.851466,
-    -0.852635,
-    -0.853459,
-    -0.85368,
-    -0.853229,
-    -0.852243,
-    -0.851027,
-    -0.849957,
-    -0.849368,
-    -0.849443,
-    -0.850162,
-    -0.851303,
-    -0.852514,
-    -0.853417,
-    -0.853732,
-    -0.853358,
-    -0.852409,
-    -0.851179,
-    -0.850048,
-    -0.849368,
-    -0.849353,
-    -0.850009,
-    -0.851135,
-    -0.852382,
-    -0.853364,
-    -0.853774,
-    -0.853482,
-    -0.852577,
-    -0.851338,
-    -0.850149,
-    -0.84938,
-    -0.84927,
-    -0.849858,
-    -0.850962,
-    -0.852242,
-    -0.853299,
-    -0.853805,
-    -0.853601,
-    -0.852746,
-    -0.851505,
-    -0.850262,
-    -0.849403,
-    -0.849196,
-    -0.849709,
-    -0.850785,
-    -0.852091,
-    -0.853222,
-    -0.853827,
-    -0.853714,
-    -0.852916,
-    -0.851679,
-    -0.850386,
-    -0.849438,
-    -0.849131,
-    -0.849564,
-    -0.850604,
-    -0.851931,
-    -0.853133,
-    -0.853836,
-    -0.85382,
-    -0.853086,
-    -0.85186,
-    -0.850521,
-    -0.849485,
-    -0.849076,
-    -0.849422,
-    -0.85042,
-    -0.851762,
-    -0.853032,
-    -0.853835,
-    -0.853919,
-    -0.853255,
-    -0.852047,
-    -0.850668,
-    -0.849546,
-    -0.849031,
-    -0.849285,
-    -0.850234,
-    -0.851584,
-    -0.852918,
-    -0.85382,
-    -0.854009,
-    -0.853423,
-    -0.85224,
-    -0.850826,
-    -0.849619,
-    -0.848996,
-    -0.849153,
-    -0.850045,
-    -0.851397,
-    -0.852791,
-    -0.853794,
-    -0.854092,
-    -0.853589,
-    -0.852438,
-    -0.850995,
-    -0.849706,
-    -0.848973,
-    -0.849027,
-    -0.849854,
-    -0.851201,
-    -0.852651,
-    -0.853754,
-    -0.854164,
-    -0.853752,
-    -0.852642,
-    -0.851175,
-    -0.849807,
-    -0.848963,
-    -0.848908,
-    -0.849663,
-    -0.850997,
-    -0.852498,
-    -0.8537,
-    -0.854227,
-    -0.853912,
-    -0.85285,
-    -0.851367,
-    -0.849922,
-    -0.848965,
-    -0.848796,
-    -0.849471,
-    -0.850785,
-    -0.852332,
-    -0.853631,
-    -0.854278,
-    -0.854069,
-    -0.853063,
-    -0.85157,
-    -0.850051,
-    -0.84898,
-    -0.848692,
-    -0.849279,
-    -0.850565,
-    -0.852152,
-    -0.853548,
-    -0.854318,
-    -0.85422,
-    -0.853279,
-    -0.851783,
-    -0.850196,
-    -0.84901,
-    -0.848596,
-    -0.849088,
-    -0.850337,
-    -0.851958,
-    -0.853449,
-    -0.854346,
-    -0.854366,
-    -0.853499,
-    -0.852008,
-    -0.850356,
-    -0.849055,
-    -0.848511,
-    -0.848899,
-    -0.850102,
-    -0.85175,
-    -0.853335,
-    -0.854361,
-    -0.854506,
-    -0.853721,
-    -0.852244,
-    -0.850532,
-    -0.849115,
-    -0.848436,
-    -0.848711,
-    -0.849859,
-    -0.851529,
-    -0.853203,
-    -0.854361,
-    -0.854639,
-    -0.853946,
-    -0.852492,
-    -0.850724,
-    -0.849192,
-    -0.848373,
-    -0.848526,
-    -0.84961,
-    -0.851293,
-    -0.853054,
-    -0.854346,
-    -0.854764,
-    -0.854173,
-    -0.85275,
-    -0.850934,
-    -0.849286,
-    -0.848321,
-    -0.848344,
-    -0.849354,
-    -0.851041,
-    -0.852886,
-    -0.854316,
-    -0.854881,
-    -0.854402,
-    -0.85302,
-    -0.85116,
-    -0.849398,
-    -0.848284,
-    -0.848167,
-    -0.849091,
-    -0.850775,
-    -0.8527,
-    -0.854268,
-    -0.854989,
-    -0.854632,
-    -0.853302,
-    -0.851406,
-    -0.84953,
-    -0.84826,
-    -0.847994,
-    -0.848821,
-    -0.850493,
-    -0.852493,
-    -0.854202,
-    -0.855086,
-    -0.854862,
-    -0.853595,
-    -0.85167,
-    -0.849683,
-    -0.848251,
-    -0.847826,
-    -0.848545,
-    -0.850194,
-    -0.852265,
-    -0.854117,
-    -0.855171,
-    -0.855094,
-    -0.8539,
-    -0.851954,
-    -0.849857,
-    -0.84826,
-    -0.847664,
-    -0.848263,
-    -0.849878,
-    -0.852015,
-    -0.854012,
-    -0.855245,
-    -0.855325,
-    -0.854218,
-    -0.85226,
-    -0.850054,
-    -0.848286,
-    -0.847509,
-    -0.847973,
-    -0.849544,
-    -0.85174,
-    -0.853884,
-    -0.855305,
-    -0.855556,
-    -0.85455,
-    -0.852589,
-    -0.850277,
-    -0.848331,
-    -0.847361,
-    -0.847676,
-    -0.84919,
-    -0.85144,
-    -0.853731,
-    -0.855351,
-    -0.855787,
-    -0.854896,
-    -0.852943,
-    -0.850527,
-    -0.848398,
-    -0.847221,
-    -0.847372,
-    -0.848815,
-    -0.851111,
-    -0.853553,
-    -0.85538,
-    -0.856018,
-    -0.855258,
-    -0.853323,
-    -0.850807,
-    -0.848488,
-    -0.847091,
-    -0.84706,
-    -0.848417,
-    -0.850752,
-    -0.853345,
-    -0.855392,
-    -0.856249,
-    -0.855636,
-    -0.853733,
-    -0.851119,
-    -0.848603,
-    -0.84697,
-    -0.846738,
-    -0.847993,
-    -0.850358,
-    -0.853106,
-    -0.855385,
-    -0.856479,
-    -0.856035,
-    -0.854176,
-    -0.851467,
-    -0.848746,
-    -0.84686,
-    -0.846405,
-    -0.84754,
-    -0.849926,
-    -0.852831,
-    -0.855356,
-    -0.856709,
-    -0.856455,
-    -0.854656,
-    -0.851857,
-    -0.848921,
-    -0.846761,
-    -0.846061,
-    -0.847054,
-    -0.84945,
-    -0.852516,
-    -0.855304,
-    -0.85694,
-    -0.8569,
-    -0.855179,
-    -0.852293,
-    -0.849131,
-    -0.846675,
-    -0.845701,
-    -0.846529,
-    -0.848924,
-    -0.852155,
-    -0.855225,
-    -0.857172,
-    -0.857376,
-    -0.855752,
-    -0.852784,
-    -0.849382,
-    -0.846603,
-    -0.845323,
-    -0.845959,
-    -0.848339,
-    -0.85174,
-    -0.855114,
-    -0.857408,
-    -0.857889,
-    -0.856385,
-    -0.853339,
-    -0.849681,
-    -0.846547,
-    -0.844922,
-    -0.845334,
-    -0.847684,
-    -0.851262,
-    -0.854969,
-    -0.857648,
-    -0.858447,
-    -0.857089,
-    -0.85397,
-    -0.850036,
-    -0.846507,
-    -0.844492,
-    -0.844642,
-    -0.846943,
-    -0.850707,
-    -0.854781,
-    -0.857895,
-    -0.859061,
-    -0.857883,
-    -0.854694,
-    -0.85046,
-    -0.846487,
-    -0.844024,
-    -0.843864,
-    -0.846095,
-    -0.850059,
-    -0.854543,
-    -0.858155,
-    -0.859748,
-    -0.85879,
-    -0.855537,
-    -0.850968,
-    -0.846489,
-    -0.843505,
-    -0.842975,
-    -0.845111,
-    -0.84929,
-    -0.854243,
-    -0.858432,
-    -0.860531,
-    -0.859843,
-    -0.856532,
-    -0.851583,
-    -0.846516,
-    -0.842917,
-    -0.841941,
-    -0.843948,
-    -0.848367,
-    -0.853864,
-    -0.858737,
-    -0.861445,
-    -0.861094,
-    -0.857728,
-    -0.85234,
-    -0.846574,
-    -0.842232,
-    -0.840706,
-    -0.842541,
-    -0.847235,
-    -0.853381,
-    -0.859084,
-    -0.862543,
-    -0.862618,
-    -0.859204,
-    -0.853289,
-    -0.846668,
-    -0.841404,
-    -0.839186,
-    -0.840789,
-    -0.845808,
-    -0.852756,
-    -0.859499,
-    -0.863912,
-    -0.864541,
-    -0.861084,
-    -0.854514,
-    -0.846808,
-    -0.840359,
-    -0.837236,
-    -0.838522,
-    -0.843946,
-    -0.851926,
-    -0.860027,
-    -0.865701,
-    -0.867078,
-    -0.863583,
-    -0.856155,
-    -0.847005,
-    -0.838961,
-    -0.834602,
-    -0.835438,
-    -0.841395,
-    -0.850781,
-    -0.860758,
-    -0.868194,
-    -0.870634,
-    -0.867105,
-    -0.858479,
-    -0.847275,
-    -0.836933,
-    -0.83077,
-    -0.830931,
-    -0.837653,
-    -0.849111,
-    -0.86189,
-    -0.871994,
-    -0.876071,
-    -0.872511,
-    -0.862041,
-    -0.847622,
-    -0.833631,
-    -0.82456,
-    -0.823603,
-    -0.831564,
-    -0.846461,
-    -0.863972,
-    -0.878658,
-    -0.885601,
-    -0.882006,
-    -0.868236,
-    -0.847934,
-    -0.827125,
-    -0.812499,
-    -0.809348,
-    -0.819762,
-    -0.841675,
-    -0.869116,
-    -0.893703,
-    -0.907041,
-    -0.903374,
-    -0.881718,
-    -0.846777,
-    -0.808238,
-    -0.77845,
-    -0.768997,
-    -0.786977,
-    -0.832001,
-    -0.894804,
-    -0.958,
-    -0.999002,
-    -0.994572,
-    -0.926009,
-    -0.783755,
-    -0.570307,
-    -0.300646
-};
-
-// Top frequency: 44.1K * 0.00362812
-constexpr static std::array<float, 4096> wt_square_0x3 =
-{
-    0,
-    0.152331,
-    0.300647,
-    0.441124,
-    0.570308,
-    0.685274,
-    0.783757,
-    0.864241,
-    0.926013,
-    0.969169,
-    0.994578,
-    1.00381,
-    0.999008,
-    0.982778,
-    0.958004,
-    0.927692,
-    0.894804,
-    0.862098,
-    0.831995,
-    0.806469,
-    0.786966,
-    0.774369,
-    0.768985,
-    0.77058,
-    0.778439,
-    0.791455,
-    0.808232,
-    0.82721,
-    0.84678,
-    0.865407,
-    0.881729,
-    0.894649,
-    0.903391,
-    0.907543,
-    0.90706,
-    0.902246,
-    0.893717,
-    0.882331,
-    0.86912,
-    0.855195,
-    0.841667,
-    0.829561,
-    0.819743,
-    0.812865,
-    0.809323,
-    0.809242,
-    0.812476,
-    0.818632,
-    0.827111,
-    0.83716,
-    0.847935,
-    0.858573,
-    0.868253,
-    0.87626,
-    0.882034,
-    0.88521,
-    0.885632,
-    0.883367,
-    0.878682,
-    0.872026,
-    0.863982,
-    0.855222,
-    0.846451,
-    0.838353,
-    0.831537,
-    0.826495,
-    0.823566,
-    0.822915,
-    0.824525,
-    0.828204,
-    0.833608,
-    0.840264,
-    0.84762,
-    0.855081,
-    0.862062,
-    0.868031,
-    0.872549,
-    0.8753,
-    0.876115,
-    0.874979,
-    0.87203,
-    0.867544,
-    0.861907,
-    0.85559,
-    0.849102,
-    0.842954,
-    0.83762,
-    0.833498,
-    0.830883,
-    0.829945,
-    0.830722,
-    0.833114,
-    0.836899,
-    0.841751,
-    0.847268,
-    0.853002,
-    0.858502,
-    0.86334,
-    0.867152,
-    0.869659,
-    0.870691,
-    0.870196,
-    0.868243,
-    0.865013,
-    0.860784,
-    0.855906,
-    0.850774,
-    0.845795,
-    0.841357,
-    0.837797,
-    0.835379,
-    0.834272,
-    0.83454,
-    0.836137,
-    0.838915,
-    0.842636,
-    0.846991,
-    0.851628,
-    0.856178,
-    0.860286,
-    0.863637,
-    0.86598,
-    0.867147,
-    0.867066,
-    0.865764,
-    0.863361,
-    0.860064,
-    0.856146,
-    0.851924,
-    0.847734,
-    0.843904,
-    0.840731,
-    0.838454,
-    0.837237,
-    0.837161,
-    0.838216,
-    0.840301,
-    0.843238,
-    0.846785,
-    0.850653,
-    0.854535,
-    0.858125,
-    0.861144,
-    0.863365,
-    0.864622,
-    0.864831,
-    0.863988,
-    0.862176,
-    0.859548,
-    0.856322,
-    0.85276,
-    0.849146,
-    0.845765,
-    0.84288,
-    0.840711,
-    0.83942,
-    0.839097,
-    0.839756,
-    0.841332,
-    0.84369,
-    0.846635,
-    0.849928,
-    0.853307,
-    0.856503,
-    0.859269,
-    0.861391,
-    0.86271,
-    0.863132,
-    0.862634,
-    0.861266,
-    0.859146,
-    0.856449,
-    0.853393,
-    0.850224,
-    0.847192,
-    0.844535,
-    0.842456,
-    0.841113,
-    0.840605,
-    0.840961,
-    0.842144,
-    0.844053,
-    0.846529,
-    0.849371,
-    0.852352,
-    0.855236,
-    0.857795,
-    0.859834,
-    0.861196,
-    0.861781,
-    0.86155,
-    0.860532,
-    0.858813,
-    0.856536,
-    0.853886,
-    0.851076,
-    0.848327,
-    0.845857,
-    0.843857,
-    0.842479,
-    0.841827,
-    0.841944,
-    0.842814,
-    0.844362,
-    0.846458,
-    0.848933,
-    0.851588,
-    0.854212,
-    0.8566,
-    0.858564,
-    0.859954,
-    0.860667,
-    0.860651,
-    0.859915,
-    0.858524,
-    0.856592,
-    0.854277,
-    0.851765,
-    0.849255,
-    0.846945,
-    0.845016,
-    0.843615,
-    0.842849,
-    0.842773,
-    0.843387,
-    0.844636,
-    0.846416,
-    0.848583,
-    0.850963,
-    0.853367,
-    0.855604,
-    0.8575,
-    0.858909,
-    0.859722,
-    0.859882,
-    0.85938,
-    0.858263,
-    0.856621,
-    0.854591,
-    0.852333,
-    0.85003,
-    0.847861,
-    0.845997,
-    0.844583,
-    0.843727,
-    0.843491,
-    0.843889,
-    0.844886,
-    0.846398,
-    0.848302,
-    0.850444,
-    0.852655,
-    0.854759,
-    0.856591,
-    0.858008,
-    0.858903,
-    0.859209,
-    0.858905,
-    0.85802,
-    0.856629,
-    0.854844,
-    0.852809,
-    0.850687,
-    0.848645,
-    0.846844,
-    0.845424,
-    0.844495,
-    0.844126,
-    0.844342,
-    0.845122,
-    0.846401,
-    0.848075,
-    0.850008,
-    0.852046,
-    0.854029,
-    0.855799,
-    0.857219,
-    0.85818,
-    0.858608,
-    0.858473,
-    0.85779,
-    0.856616,
-    0.855048,
-    0.853211,
-    0.851252,
-    0.849326,
-    0.847586,
-    0.846167,
-    0.845179,
-    0.844697,
-    0.844756,
-    0.845348,
-    0.846422,
-    0.847892,
-    0.849638,
-    0.85152,
-    0.853391,
-    0.855101,
-    0.856518,
-    0.857531,
-    0.858062,
-    0.858074,
-    0.857568,
-    0.856587,
-    0.855211,
-    0.853552,
-    0.851742,
-    0.849925,
-    0.848244,
-    0.846832,
-    0.845797,
-    0.845219,
-    0.845142,
-    0.845567,
-    0.84646,
-    0.847746,
-    0.849322,
-    0.851062,
-    0.852827,
-    0.854478,
-    0.855886,
-    0.856941,
-    0.857561,
-    0.8577,
-    0.85735,
-    0.856541,
-    0.85534,
-    0.853844,
-    0.852172,
-    0.850457,
-    0.848835,
-    0.847433,
-    0.846361,
-    0.845702,
-    0.845505,
-    0.845783,
-    0.846512,
-    0.847632,
-    0.849052,
-    0.850659,
-    0.852325,
-    0.853918,
-    0.855312,
-    0.856399,
-    0.857095,
-    0.857346,
-    0.857136,
-    0.856482,
-    0.85544,
-    0.854093,
-    0.852549,
-    0.850932,
-    0.849368,
-    0.847982,
-    0.846882,
-    0.846153,
-    0.845851,
-    0.845997,
-    0.846578,
-    0.847546,
-    0.848822,
-    0.850305,
-    0.851875,
-    0.853409,
-    0.854786,
-    0.855898,
-    0.856658,
-    0.857008,
-    0.856922,
-    0.85641,
-    0.855513,
-    0.854305,
-    0.852883,
-    0.851359,
-    0.849854,
-    0.848487,
-    0.847366,
-    0.846578,
-    0.846182,
-    0.84621,
-    0.846657,
-    0.847484,
-    0.848626,
-    0.849991,
-    0.85147,
-    0.852945,
-    0.8543,
-    0.85543,
-    0.856244,
-    0.856682,
-    0.856709,
-    0.856326,
-    0.855564,
-    0.854486,
-    0.853178,
-    0.851744,
-    0.850298,
-    0.848955,
-    0.847819,
-    0.84698,
-    0.846503,
-    0.846424,
-    0.846747,
-    0.847444,
-    0.848461,
-    0.849714,
-    0.851103,
-    0.852519,
-    0.85385,
-    0.85499,
-    0.855851,
-    0.856366,
-    0.856495,
-    0.85623,
-    0.855594,
-    0.854638,
-    0.853439,
-    0.852093,
-    0.850706,
-    0.849389,
-    0.848246,
-    0.847364,
-    0.846815,
-    0.846638,
-    0.846847,
-    0.847424,
-    0.848322,
-    0.849468,
-    0.850771,
-    0.852128,
-    0.85343,
-    0.854576,
-    0.855475,
-    0.856058,
-    0.85628,
-    0.856124,
-    0.855605,
-    0.854764,
-    0.85367,
-    0.852409,
-    0.851083,
-    0.849795,
-    0.848649,
-    0.847732,
-    0.847118,
-    0.846854,
-    0.846958,
-    0.847422,
-    0.848208,
-    0.849251,
-    0.85047,
-    0.851766,
-    0.853037,
-    0.854184,
-    0.855115,
-    0.855758,
-    0.856063,
-    0.856008,
-    0.855598,
-    0.854867,
-    0.853873,
-    0.852696,
-    0.85143,
-    0.850176,
-    0.849031,
-    0.848086,
-    0.847416,
-    0.847071,
-    0.847079,
-    0.847437,
-    0.848116,
-    0.849061,
-    0.850196,
-    0.851431,
-    0.852669,
-    0.853811,
-    0.854767,
-    0.855463,
-    0.855845,
-    0.855883,
-    0.855576,
-    0.854948,
-    0.854051,
-    0.852957,
-    0.851752,
-    0.850533,
-    0.849395,
-    0.848428,
-    0.847708,
-    0.847291,
-    0.847209,
-    0.847467,
-    0.848044,
-    0.848894,
-    0.849947,
-    0.851121,
-    0.852322,
-    0.853456,
-    0.854432,
-    0.855174,
-    0.855625,
-    0.855749,
-    0.855538,
-    0.85501,
-    0.854207,
-    0.853194,
-    0.852051,
-    0.850869,
-    0.849741,
-    0.848758,
-    0.847995,
-    0.847512,
-    0.847347,
-    0.847511,
-    0.847992,
-    0.848749,
-    0.849722,
-    0.850834,
-    0.851996,
-    0.853117,
-    0.854107,
-    0.854889,
-    0.855403,
-    0.855607,
-    0.855487,
-    0.855053,
-    0.854341,
-    0.853408,
-    0.852327,
-    0.851185,
-    0.850073,
-    0.849077,
-    0.848277,
-    0.847735,
-    0.847493,
-    0.847569,
-    0.847957,
-    0.848625,
-    0.849519,
-    0.850568,
-    0.851689,
-    0.852793,
-    0.853792,
-    0.854609,
-    0.855179,
-    0.855457,
-    0.855423,
-    0.85508,
-    0.854455,
-    0.853601,
-    0.852583,
-    0.851484,
-    0.850389,
-    0.849387,
-    0.848556,
-    0.84796,
-    0.847647,
-    0.84764,
-    0.847939,
-    0.84852,
-    0.849336,
-    0.850322,
-    0.8514,
-    0.852483,
-    0.853487,
-    0.854333,
-    0.854953,
-    0.8553,
-    0.855346,
-    0.85509,
-    0.854551,
-    0.853774,
-    0.85282,
-    0.851765,
-    0.850693,
-    0.849688,
-    0.84883,
-    0.848187,
-    0.847808,
-    0.847722,
-    0.847937,
-    0.848434,
-    0.849173,
-    0.850095,
-    0.851127,
-    0.852187,
-    0.853191,
-    0.85406,
-    0.854725,
-    0.855135,
-    0.855258,
-    0.855084,
-    0.854629,
-    0.853928,
-    0.853038,
-    0.85203,
-    0.850983,
-    0.84998,
-    0.849101,
-    0.848415,
-    0.847975,
-    0.847816,
-    0.84795,
-    0.848364,
-    0.849027,
-    0.849885,
-    0.85087,
-    0.851903,
-    0.852903,
-    0.853791,
-    0.854496,
-    0.854965,
-    0.855159,
-    0.855065,
-    0.85469,
-    0.854065,
-    0.853239,
-    0.852279,
-    0.85126,
-    0.850264,
-    0.849368,
-    0.848644,
-    0.848149,
-    0.84792,
-    0.847976,
-    0.848312,
-    0.848899,
-    0.849693,
-    0.850628,
-    0.851631,
-    0.852623,
-    0.853525,
-    0.854266,
-    0.854788,
-    0.85505,
-    0.855031,
-    0.854735,
-    0.854184,
-    0.853423,
-    0.852513,
-    0.851526,
-    0.850539,
-    0.849632,
-    0.848875,
-    0.848328,
-    0.848035,
-    0.848016,
-    0.848274,
-    0.848788,
-    0.849516,
-    0.850401,
-    0.851372,
-    0.852352,
-    0.853263,
-    0.854035,
-    0.854606,
-    0.854931,
-    0.854985,
-    0.854764,
-    0.854287,
-    0.853592,
-    0.852733,
-    0.85178,
-    0.850807,
-    0.849892,
-    0.849107,
-    0.848513,
-    0.848158,
-    0.848069,
-    0.848252,
-    0.848693,
-    0.849356,
-    0.850188,
-    0.851124,
-    0.852088,
-    0.853005,
-    0.853803,
-    0.854418,
-    0.854802,
-    0.854926,
-    0.854779,
-    0.854374,
-    0.853744,
-    0.852939,
-    0.852022,
-    0.851066,
-    0.850148,
-    0.849339,
-    0.848703,
-    0.848291,
-    0.848134,
-    0.848245,
-    0.848614,
-    0.849211,
-    0.849989,
-    0.850887,
-    0.851833,
-    0.852751,
-    0.85357,
-    0.854226,
-    0.854665,
-    0.854855,
-    0.85478,
-    0.854446,
-    0.853882,
-    0.853131,
-    0.852253,
-    0.851318,
-    0.8504,
-    0.849572,
-    0.848898,
-    0.848432,
-    0.848211,
-    0.848251,
-    0.848549,
-    0.849081,
-    0.849804,
-    0.850662,
-    0.851585,
-    0.852501,
-    0.853338,
-    0.854029,
-    0.85452,
-    0.854772,
-    0.854767,
-    0.854504,
-    0.854005,
-    0.853309,
-    0.852473,
-    0.851562,
-    0.850648,
-    0.849804,
-    0.849097,
-    0.848581,
-    0.848299,
-    0.848271,
-    0.848499,
-    0.848965,
-    0.849632,
-    0.850447,
-    0.851345,
-    0.852255,
-    0.853105,
-    0.853828,
-    0.854367,
-    0.854679,
-    0.854741,
-    0.854547,
-    0.854113,
-    0.853474,
-    0.852682,
-    0.851797,
-    0.850892,
-    0.850037,
-    0.849299,
-    0.848738,
-    0.848397,
-    0.848303,
-    0.848463,
-    0.848864,
-    0.849474,
-    0.850244,
-    0.851114,
-    0.852014,
-    0.852873,
-    0.853624,
-    0.854207,
-    0.854575,
-    0.854702,
-    0.854576,
-    0.854207,
-    0.853626,
-    0.852879,
-    0.852025,
-    0.851131,
-    0.850268,
-    0.849505,
-    0.848902,
-    0.848506,
-    0.848348,
-    0.848441,
-    0.848777,
-    0.849328,
-    0.850052,
-    0.85089,
-    0.851777,
-    0.852642,
-    0.853416,
-    0.854039,
-    0.854462,
-    0.85465,
-    0.854591,
-    0.854288,
-    0.853766,
-    0.853066,
-    0.852244,
-    0.851365,
-    0.850499,
-    0.849714,
-    0.849072,
-    0.848624,
-    0.848405,
-    0.848432,
-    0.848703,
-    0.849196,
-    0.849871,
-    0.850675,
-    0.851545,
-    0.852412,
-    0.853206,
-    0.853866,
-    0.854339,
-    0.854587,
-    0.854593,
-    0.854355,
-    0.853892,
-    0.853241,
-    0.852455,
-    0.851594,
-    0.850729,
-    0.849926,
-    0.849249,
-    0.848752,
-    0.848474,
-    0.848437,
-    0.848643,
-    0.849076,
-    0.849701,
-    0.850469,
-    0.851319,
-    0.852183,
-    0.852994,
-    0.853686,
-    0.854206,
-    0.854513,
-    0.854582,
-    0.854408,
-    0.854005,
-    0.853406,
-    0.852657,
-    0.851818,
-    0.850956,
-    0.850139,
-    0.849431,
-    0.848889,
-    0.848554,
-    0.848454,
-    0.848596,
-    0.848969,
-    0.849542,
-    0.850271,
-    0.851098,
-    0.851956,
-    0.852779,
-    0.853501,
-    0.854065,
-    0.854427,
-    0.854558,
-    0.854448,
-    0.854106,
-    0.853559,
-    0.85285,
-    0.852037,
-    0.851182,
-    0.850354,
-    0.849619,
-    0.849034,
-    0.848646,
-    0.848484,
-    0.848563,
-    0.848874,
-    0.849395,
-    0.850082,
-    0.850882,
-    0.851732,
-    0.852563,
-    0.853311,
-    0.853916,
-    0.854331,
-    0.854522,
-    0.854475,
-    0.854194,
-    0.853701,
-    0.853035,
-    0.852249,
-    0.851406,
-    0.850571,
-    0.849812,
-    0.849187,
-    0.848747,
-    0.848527,
-    0.848542,
-    0.848793,
-    0.849258,
-    0.849902,
-    0.850673,
-    0.85151,
-    0.852346,
-    0.853116,
-    0.853759,
-    0.854224,
-    0.854474,
-    0.854489,
-    0.854269,
-    0.853831,
-    0.85321,
-    0.852455,
-    0.851626,
-    0.850788,
-    0.850009,
-    0.849348,
-    0.848859,
-    0.848581,
-    0.848534,
-    0.848724,
-    0.849133,
-    0.849731,
-    0.85047,
-    0.851291,
-    0.852128,
-    0.852917,
-    0.853594,
-    0.854107,
-    0.854413,
-    0.85449,
-    0.854332,
-    0.85395,
-    0.853376,
-    0.852655,
-    0.851843,
-    0.851006,
-    0.85021,
-    0.849516,
-    0.848981,
-    0.848647,
-    0.848539,
-    0.848667,
-    0.84902,
-    0.84957,
-    0.850274,
-    0.851075,
-    0.851911,
-    0.852714,
-    0.853423,
-    0.85398,
-    0.854342,
-    0.854479,
-    0.854382,
-    0.854058,
-    0.853533,
-    0.852848,
-    0.852057,
-    0.851224,
-    0.850414,
-    0.849691,
-    0.849113,
-    0.848724,
-    0.848557,
-    0.848623,
-    0.848918,
-    0.849419,
-    0.850084,
-    0.850863,
-    0.851693,
-    0.852508,
-    0.853245,
-    0.853844,
-    0.854258,
-    0.854455,
-    0.85442,
-    0.854154,
-    0.853679,
-    0.853033,
-    0.852267,
-    0.851442,
-    0.850622,
-    0.849873,
-    0.849254,
-    0.848813,
-    0.848587,
-    0.848592,
-    0.848828,
-    0.849277,
-    0.849902,
-    0.850655,
-    0.851476,
-    0.852299,
-    0.85306,
-    0.853698,
-    0.854164,
-    0.854419,
-    0.854445,
-    0.854238,
-    0.853816,
-    0.853212,
-    0.852473,
-    0.851658,
-    0.850832,
-    0.85006,
-    0.849403,
-    0.848913,
-    0.848629,
-    0.848573,
-    0.84875,
-    0.849145,
-    0.849728,
-    0.850452,
-    0.85126,
-    0.852087,
-    0.85287,
-    0.853545,
-    0.854059,
-    0.854371,
-    0.854457,
-    0.854311,
-    0.853943,
-    0.853382,
-    0.852674,
-    0.851874,
-    0.851045,
-    0.850253,
-    0.849561,
-    0.849024,
-    0.848683,
-    0.848567,
-    0.848683,
-    0.849024,
-    0.849561,
-    0.850253,
-    0.851045,
-    0.851874,
-    0.852674,
-    0.853382,
-    0.853943,
-    0.854311,
-    0.854457,
-    0.854371,
-    0.854059,
-    0.853545,
-    0.85287,
-    0.852087,
-    0.85126,
-    0.850452,
-    0.849728,
-    0.849145,
-    0.84875,
-    0.848573,
-    0.848629,
-    0.848913,
-    0.849403,
-    0.85006,
-    0.850832,
-    0.851658,
-    0.852473,
-    0.853212,
-    0.853816,
-    0.854238,
-    0.854445,
-    0.854419,
-    0.854164,
-    0.853698,
-    0.85306,
-    0.852299,
-    0.851476,
-    0.850655,
-    0.849902,
-    0.849277,
-    0.848828,
-    0.848592,
-    0.848587,
-    0.848813,
-    0.849254,
-    0.849873,
-    0.850622,
-    0.851442,
-    0.852267,
-    0.853033,
-    0.853679,
-    0.854154,
-    0.85442,
-    0.854455,
-    0.854258,
-    0.853844,
-    0.853245,
-    0.852508,
-    0.851693,
-    0.850863,
-    0.850084,
-    0.849419,
-    0.848918,
-    0.848623,
-    0.848557,
-    0.848724,
-    0.849113,
-    0.849691,
-    0.850414,
-    0.851224,
-    0.852057,
-    0.852848,
-    0.853533,
-    0.854058,
-    0.854382,
-    0.854479,
-    0.854342,
-    0.85398,
-    0.853423,
-    0.852714,
-    0.851911,
-    0.851075,
-    0.850274,
-    0.84957,
-    0.84902,
-    0.848667,
-    0.848539,
-    0.848647,
-    0.848981,
-    0.849516,
-    0.85021,
-    0.851006,
-    0.851843,
-    0.852655,
-    0.853376,
-    0.85395,
-    0.854332,
-    0.85449,
-    0.854413,
-    0.854107,
-    0.853594,
-    0.852917,
-    0.852128,
-    0.851291,
-    0.85047,
-    0.849731,
-    0.849133,
-    0.848724,
-    0.848534,
-    0.848581,
-    0.848859,
-    0.849348,
-    0.850009,
-    0.850788,
-    0.851626,
-    0.852455,
-    0.85321,
-    0.853831,
-    0.854269,
-    0.854489,
-    0.854474,
-    0.854224,
-    0.853759,
-    0.853116,
-    0.852346,
-    0.85151,
-    0.850673,
-    0.849902,
-    0.849258,
-    0.848793,
-    0.848542,
-    0.848527,
-    0.848747,
-    0.849187,
-    0.849812,
-    0.850571,
-    0.851406,
-    0.852249,
-    0.853035,
-    0.853701,
-    0.854194,
-    0.854475,
-    0.854522,
-    0.854331,
-    0.853916,
-    0.853311,
-    0.852563,
-    0.851732,
-    0.850882,
-    0.850082,
-    0.849395,
-    0.848874,
-    0.848563,
-    0.848484,
-    0.848646,
-    0.849034,
-    0.849619,
-    0.850354,
-    0.851182,
-    0.852037,
-    0.85285,
-    0.853559,
-    0.854106,
-    0.854448,
-    0.854558,
-    0.854427,
-    0.854065,
-    0.853501,
-    0.852779,
-    0.851956,
-    0.851098,
-    0.850271,
-    0.849542,
-    0.848969,
-    0.848596,
-    0.848454,
-    0.848554,
-    0.848889,
-    0.849431,
-    0.850139,
-    0.850956,
-    0.851818,
-    0.852657,
-    0.853406,
-    0.854005,
-    0.854408,
-    0.854582,
-    0.854513,
-    0.854206,
-    0.853686,
-    0.852994,
-    0.852183,
-    0.851319,
-    0.850469,
-    0.849701,
-    0.849076,
-    0.848643,
-    0.848437,
-    0.848474,
-    0.848752,
-    0.849249,
-    0.849926,
-    0.850729,
-    0.851594,
-    0.852455,
-    0.853241,
-    0.853892,
-    0.854355,
-    0.854593,
-    0.854587,
-    0.854339,
-    0.853866,
-    0.853206,
-    0.852412,
-    0.851545,
-    0.850675,
-    0.849871,
-    0.849196,
-    0.848703,
-    0.848432,
-    0.848405,
-    0.848624,
-    0.849072,
-    0.849714,
-    0.850499,
-    0.851365,
-    0.852244,
-    0.853066,
-    0.853766,
-    0.854288,
-    0.854591,
-    0.85465,
-    0.854462,
-    0.854039,
-    0.853416,
-    0.852642,
-    0.851777,
-    0.85089,
-    0.850052,
-    0.849328,
-    0.848777,
-    0.848441,
-    0.848348,
-    0.848506,
-    0.848902,
-    0.849505,
-    0.850268,
-    0.851131,
-    0.852025,
-    0.852879,
-    0.853626,
-    0.854207,
-    0.854576,
-    0.854702,
-    0.854575,
-    0.854207,
-    0.853624,
-    0.852873,
-    0.852014,
-    0.851114,
-    0.850244,
-    0.849474,
-    0.848864,
-    0.848463,
-    0.848303,
-    0.848397,
-    0.848738,
-    0.849299,
-    0.850037,
-    0.850892,
-    0.851797,
-    0.852682,
-    0.853474,
-    0.854113,
-    0.854547,
-    0.854741,
-    0.854679,
-    0.854367,
-    0.853828,
-    0.853105,
-    0.852255,
-    0.851345,
-    0.850447,
-    0.849632,
-    0.848965,
-    0.848499,
-    0.848271,
-    0.848299,
-    0.848581,
-    0.849097,
-    0.849804,
-    0.850648,
-    0.851562,
-    0.852473,
-    0.853309,
-    0.854005,
-    0.854504,
-    0.854767,
-    0.854772,
-    0.85452,
-    0.854029,
-    0.853338,
-    0.852501,
-    0.851585,
-    0.850662,
-    0.849804,
-    0.849081,
-    0.848549,
-    0.848251,
-    0.848211,
-    0.848432,
-    0.848898,
-    0.849572,
-    0.8504,
-    0.851318,
-    0.852253,
-    0.853131,
-    0.853882,
-    0.854446,
-    0.85478,
-    0.854855,
-    0.854665,
-    0.854226,
-    0.85357,
-    0.852751,
-    0.851833,
-    0.850887,
-    0.849989,
-    0.849211,
-    0.848614,
-    0.848245,
-    0.848134,
-    0.848291,
-    0.848703,
-    0.849339,
-    0.850148,
-    0.851066,
-    0.852022,
-    0.852939,
-    0.853744,
-    0.854374,
-    0.854779,
-    0.854926,
-    0.854802,
-    0.854418,
-    0.853803,
-    0.853005,
-    0.852088,
-    0.851124,
-    0.850188,
-    0.849356,
-    0.848693,
-    0.848252,
-    0.848069,
-    0.848158,
-    0.848513,
-    0.849107,
-    0.849892,
-    0.850807,
-    0.85178,
-    0.852733,
-    0.853592,
-    0.854287,
-    0.854764,
-    0.854985,
-    0.854931,
-    0.854606,
-    0.854035,
-    0.853263,
-    0.852352,
-    0.851372,
-    0.850401,
-    0.849516,
-    0.848788,
-    0.848274,
-    0.848016,
-    0.848035,
-    0.848328,
-    0.848875,
-    0.849632,
-    0.850539,
-    0.851526,
-    0.852513,
-    0.853423,
-    0.854184,
-    0.854735,
-    0.855031,
-    0.85505,
-    0.854788,
-    0.854266,
-    0.853525,
-    0.852623,
-    0.851631,
-    0.850628,
-    0.849693,
-    0.848899,
-    0.848312,
-    0.847976,
-    0.84792,
-    0.848149,
-    0.848644,
-    0.849368,
-    0.850264,
-    0.85126,
-    0.852279,
-    0.853239,
-    0.854065,
-    0.85469,
-    0.855065,
-    0.855159,
-    0.854965,
-    0.854496,
-    0.853791,
-    0.852903,
-    0.851903,
-    0.85087,
-    0.849885,
-    0.849027,
-    0.848364,
-    0.84795,
-    0.847816,
-    0.847975,
-    0.848415,
-    0.849101,
-    0.84998,
-    0.850983,
-    0.85203,
-    0.853038,
-    0.853928,
-    0.854629,
-    0.855084,
-    0.855258,
-    0.855135,
-    0.854725,
-    0.85406,
-    0.853191,
-    0.852187,
-    0.851127,
-    0.850095,
-    0.849173,
-    0.848434,
-    0.847937,
-    0.847722,
-    0.847808,
-    0.848187,
-    0.84883,
-    0.849688,
-    0.850693,
-    0.851765,
-    0.85282,
-    0.853774,
-    0.854551,
-    0.85509,
-    0.855346,
-    0.8553,
-    0.854953,
-    0.854333,
-    0.853487,
-    0.852483,
-    0.8514,
-    0.850322,
-    0.849336,
-    0.84852,
-    0.847939,
-    0.84764,
-    0.847647,
-    0.84796,
-    0.848556,
-    0.849387,
-    0.850389,
-    0.851484,
-    0.852583,
-    0.853601,
-    0.854455,
-    0.85508,
-    0.855423,
-    0.855457,
-    0.855179,
-    0.854609,
-    0.853792,
-    0.852793,
-    0.851689,
-    0.850568,
-    0.849519,
-    0.848625,
-    0.847957,
-    0.847569,
-    0.847493,
-    0.847735,
-    0.848277,
-    0.849077,
-    0.850073,
-    0.851185,
-    0.852327,
-    0.853408,
-    0.854341,
-    0.855053,
-    0.855487,
-    0.855607,
-    0.855403,
-    0.854889,
-    0.854107,
-    0.853117,
-    0.851996,
-    0.850834,
-    0.849722,
-    0.848749,
-    0.847992,
-    0.847511,
-    0.847347,
-    0.847512,
-    0.847995,
-    0.848758,
-    0.849741,
-    0.850869,
-    0.852051,
-    0.853194,
-    0.854207,
-    0.85501,
-    0.855538,
-    0.855749,
-    0.855625,
-    0.855174,
-    0.854432,
-    0.853456,
-    0.852322,
-    0.851121,
-    0.849947,
-    0.848894,
-    0.848044,
-    0.847467,
-    0.847209,
-    0.847291,
-    0.847708,
-    0.848428,
-    0.849395,
-    0.850533,
-    0.851752,
-    0.852957,
-    0.854051,
-    0.854948,
-    0.855576,
-    0.855883,
-    0.855845,
-    0.855463,
-    0.854767,
-    0.853811,
-    0.852669,
-    0.851431,
-    0.850196,
-    0.849061,
-    0.848116,
-    0.847437,
-    0.847079,
-    0.847071,
-    0.847416,
-    0.848086,
-    0.849031,
-    0.850176,
-    0.85143,
-    0.852696,
-    0.853873,
-    0.854867,
-    0.855598,
-    0.856008,
-    0.856063,
-    0.855758,
-    0.855115,
-    0.854184,
-    0.853037,
-    0.851766,
-    0.85047,
-    0.849251,
-    0.848208,
-    0.847422,
-    0.846958,
-    0.846854,
-    0.847118,
-    0.847732,
-    0.848649,
-    0.849795,
-    0.851083,
-    0.852409,
-    0.85367,
-    0.854764,
-    0.855605,
-    0.856124,
-    0.85628,
-    0.856058,
-    0.855475,
-    0.854576,
-    0.85343,
-    0.852128,
-    0.850771,
-    0.849468,
-    0.848322,
-    0.847424,
-    0.846847,
-    0.846638,
-    0.846815,
-    0.847364,
-    0.848246,
-    0.849389,
-    0.850706,
-    0.852093,
-    0.853439,
-    0.854638,
-    0.855594,
-    0.85623,
-    0.856495,
-    0.856366,
-    0.855851,
-    0.85499,
-    0.85385,
-    0.852519,
-    0.851103,
-    0.849714,
-    0.848461,
-    0.847444,
-    0.846747,
-    0.846424,
-    0.846503,
-    0.84698,
-    0.847819,
-    0.848955,
-    0.850298,
-    0.851744,
-    0.853178,
-    0.854486,
-    0.855564,
-    0.856326,
-    0.856709,
-    0.856682,
-    0.856244,
-    0.85543,
-    0.8543,
-    0.852945,
-    0.85147,
-    0.849991,
-    0.848626,
-    0.847484,
-    0.846657,
-    0.84621,
-    0.846182,
-    0.846578,
-    0.847366,
-    0.848487,
-    0.849854,
-    0.851359,
-    0.852883,
-    0.854305,
-    0.855513,
-    0.85641,
-    0.856922,
-    0.857008,
-    0.856658,
-    0.855898,
-    0.854786,
-    0.853409,
-    0.851875,
-    0.850305,
-    0.848822,
-    0.847546,
-    0.846578,
-    0.845997,
-    0.845851,
-    0.846153,
-    0.846882,
-    0.847982,
-    0.849368,
-    0.850932,
-    0.852549,
-    0.854093,
-    0.85544,
-    0.856482,
-    0.857136,
-    0.857346,
-    0.857095,
-    0.856399,
-    0.855312,
-    0.853918,
-    0.852325,
-    0.850659,
-    0.849052,
-    0.847632,
-    0.846512,
-    0.845783,
-    0.845505,
-    0.845702,
-    0.846361,
-    0.847433,
-    0.848835,
-    0.850457,
-    0.852172,
-    0.853844,
-    0.85534,
-    0.856541,
-    0.85735,
-    0.8577,
-    0.857561,
-    0.856941,
-    0.855886,
-    0.854478,
-    0.852827,
-    0.851062,
-    0.849322,
-    0.847746,
-    0.84646,
-    0.845567,
-    0.845142,
-    0.845219,
-    0.845797,
-    0.846832,
-    0.848244,
-    0.849925,
-    0.851742,
-    0.853552,
-    0.855211,
-    0.856587,
-    0.857568,
-    0.858074,
-    0.858062,
-    0.857531,
-    0.856518,
-    0.855101,
-    0.853391,
-    0.85152,
-    0.849638,
-    0.847892,
-    0.846422,
-    0.845348,
-    0.844756,
-    0.844697,
-    0.845179,
-    0.846167,
-    0.847586,
-    0.849326,
-    0.851252,
-    0.853211,
-    0.855048,
-    0.856616,
-    0.85779,
-    0.858473,
-    0.858608,
-    0.85818,
-    0.857219,
-    0.855799,
-    0.854029,
-    0.852046,
-    0.850008,
-    0.848075,
-    0.846401,
-    0.845122,
-    0.844342,
-    0.844126,
-    0.844495,
-    0.845424,
-    0.846844,
-    0.848645,
-    0.850687,
-    0.852809,
-    0.854844,
-    0.856629,
-    0.85802,
-    0.858905,
-    0.859209,
-    0.858903,
-    0.858008,
-    0.856591,
-    0.854759,
-    0.852655,
-    0.850444,
-    0.848302,
-    0.846398,
-    0.844886,
-    0.843889,
-    0.843491,
-    0.843727,
-    0.844583,
-    0.845997,
-    0.847861,
-    0.85003,
-    0.852333,
-    0.854591,
-    0.856621,
-    0.858263,
-    0.85938,
-    0.859882,
-    0.859722,
-    0.858909,
-    0.8575,
-    0.855604,
-    0.853367,
-    0.850963,
-    0.848583,
-    0.846416,
-    0.844636,
-    0.843387,
-    0.842773,
-    0.842849,
-    0.843615,
-    0.845016,
-    0.846945,
-    0.849255,
-    0.851765,
-    0.854277,
-    0.856592,
-    0.858524,
-    0.859915,
-    0.860651,
-    0.860667,
-    0.859954,
-    0.858564,
-    0.8566,
-    0.854212,
-    0.851588,
-    0.848933,
-    0.846458,
-    0.844362,
-    0.842814,
-    0.841944,
-    0.841827,
-    0.842479,
-    0.843857,
-    0.845857,
-    0.848327,
-    0.851076,
-    0.853886,
-    0.856536,
-    0.858813,
-    0.860532,
-    0.86155,
-    0.861781,
-    0.861196,
-    0.859834,
-    0.857795,
-    0.855236,
-    0.852352,
-    0.849371,
-    0.846529,
-    0.844053,
-    0.842144,
-    0.840961,
-    0.840605,
-    0.841113,
-    0.842456,
-    0.844535,
-    0.847192,
-    0.850224,
-    0.853393,
-    0.856449,
-    0.859146,
-    0.861266,
-    0.862634,
-    0.863132,
-    0.86271,
-    0.861391,
-    0.859269,
-    0.856503,
-    0.853307,
-    0.849928,
-    0.846635,
-    0.84369,
-    0.841332,
-    0.839756,
-    0.839097,
-    0.83942,
-    0.840711,
-    0.84288,
-    0.845765,
-    0.849146,
-    0.85276,
-    0.856322,
-    0.859548,
-    0.862176,
-    0.863988,
-    0.864831,
-    0.864622,
-    0.863365,
-    0.861144,
-    0.858125,
-    0.854535,
-    0.850653,
-    0.846785,
-    0.843238,
-    0.840301,
-    0.838216,
-    0.837161,
-    0.837237,
-    0.838454,
-    0.840731,
-    0.843904,
-    0.847734,
-    0.851924,
-    0.856146,
-    0.860064,
-    0.863361,
-    0.865764,
-    0.867066,
-    0.867147,
-    0.86598,
-    0.863637,
-    0.860286,
-    0.856178,
-    0.851628,
-    0.846991,
-    0.842636,
-    0.838915,
-    0.836137,
-    0.83454,
-    0.834272,
-    0.835379,
-    0.837797,
-    0.841357,
-    0.845795,
-    0.850774,
-    0.855906,
-    0.860784,
-    0.865013,
-    0.868243,
-    0.870196,
-    0.870691,
-    0.869659,
-    0.867152,
-    0.86334,
-    0.858502,
-    0.853002,
-    0.847268,
-    0.841751,
-    0.836899,
-    0.833114,
-    0.830722,
-    0.829945,
-    0.830883,
-    0.833498,
-    0.83762,
-    0.842954,
-    0.849102,
-    0.85559,
-    0.861907,
-    0.867544,
-    0.87203,
-    0.874979,
-    0.876115,
-    0.8753,
-    0.872549,
-    0.868031,
-    0.862062,
-    0.855081,
-    0.84762,
-    0.840264,
-    0.833608,
-    0.828204,
-    0.824525,
-    0.822915,
-    0.823566,
-    0.826495,
-    0.831537,
-    0.838353,
-    0.846451,
-    0.855222,
-    0.863982,
-    0.872026,
-    0.878682,
-    0.883367,
-    0.885632,
-    0.88521,
-    0.882034,
-    0.87626,
-    0.868253,
-    0.858573,
-    0.847935,
-    0.83716,
-    0.827111,
-    0.818632,
-    0.812476,
-    0.809242,
-    0.809323,
-    0.812865,
-    0.819743,
-    0.829561,
-    0.841667,
-    0.855195,
-    0.86912,
-    0.882331,
-    0.893717,
-    0.902246,
-    0.90706,
-    0.907543,
-    0.903391,
-    0.894649,
-    0.881729,
-    0.865407,
-    0.84678,
-    0.82721,
-    0.808232,
-    0.791455,
-    0.778439,
-    0.77058,
-    0.768985,
-    0.774369,
-    0.786966,
-    0.806469,
-    0.831995,
-    0.862098,
-    0.894804,
-    0.927692,
-    0.958004,
-    0.982778,
-    0.999008,
-    1.00381,
-    0.994578,
-    0.969169,
-    0.926013,
-    0.864241,
-    0.783757,
-    0.685274,
-    0.570308,
-    0.441124,
-    0.300647,
-    0.152331,
-    0,
-    -0.152331,
-    -0.300647,
-    -0.441124,
-    -0.570308,
-    -0.685274,
-    -0.783757,
-    -0.864241,
-    -0.926013,
-    -0.969169,
-    -0.994578,
-    -1.00381,
-    -0.999008,
-    -0.982778,
-    -0.958004,
-    -0.927692,
-    -0.894804,
-    -0.862098,
-    -0.831995,
-    -0.806469,
-    -0.786966,
-    -0.774369,
-    -0.768985,
-    -0.77058,
-    -0.778439,
-    -0.791455,
-    -0.808232,
-    -0.82721,
-    -0.84678,
-    -0.865407,
-    -0.881729,
-    -0.894649,
-    -0.903391,
-    -0.907543,
-    -0.90706,
-    -0.902246,
-    -0.893717,
-    -0.882331,
-    -0.86912,
-    -0.855195,
-    -0.841667,
-    -0.829561,
-    -0.819743,
-    -0.812865,
-    -0.809323,
-    -0.809242,
-    -0.812476,
-    -0.818632,
-    -0.827111,
-    -0.83716,
-    -0.847935,
-    -0.858573,
-    -0.868253,
-    -0.87626,
-    -0.882034,
-    -0.88521,
-    -0.885632,
-    -0.883367,
-    -0.878682,
-    -0.872026,
-    -0.863982,
-    -0.855222,
-    -0.846451,
-    -0.838353,
-    -0.831537,
-    -0.826495,
-    -0.823566,
-    -0.822915,
-    -0.824525,
-    -0.828204,
-    -0.833608,
-    -0.840264,
-    -0.84762,
-    -0.855081,
-    -0.862062,
-    -0.868031,
-    -0.872549,
-    -0.8753,
-    -0.876115,
-    -0.874979,
-    -0.87203,
-    -0.867544,
-    -0.861907,
-    -0.85559,
-    -0.849102,
-    -0.842954,
-    -0.83762,
-    -0.833498,
-    -0.830883,
-    -0.829945,
-    -0.830722,
-    -0.833114,
-    -0.836899,
-    -0.841751,
-    -0.847268,
-    -0.853002,
-    -0.858502,
-    -0.86334,
-    -0.867152,
-    -0.869659,
-    -0.870691,
-    -0.870196,
-    -0.868243,
-    -0.865013,
-    -0.860784,
-    -0.855906,
-    -0.850774,
-    -0.845795,
-    -0.841357,
-    -0.837797,
-    -0.835379,
-    -0.834272,
-    -0.83454,
-    -0.836137,
-    -0.838915,
-    -0.842636,
-    -0.846991,
-    -0.851628,
-    -0.856178,
-    -0.860286,
-    -0.863637,
-    -0.86598,
-    -0.867147,
-    -0.867066,
-    -0.865764,
-    -0.863361,
-    -0.860064,
-    -0.856146,
-    -0.851924,
-    -0.847734,
-    -0.843904,
-    -0.840731,
-    -0.838454,
-    -0.837237,
-    -0.837161,
-    -0.838216,
-    -0.840301,
-    -0.843238,
-    -0.846785,
-    -0.850653,
-    -0.854535,
-    -0.858125,
-    -0.861144,
-    -0.863365,
-    -0.864622,
-    -0.864831,
-    -0.863988,
-    -0.862176,
-    -0.859548,
-    -0.856322,
-    -0.85276,
-    -0.849146,
-    -0.845765,
-    -0.84288,
-    -0.840711,
-    -0.83942,
-    -0.839097,
-    -0.839756,
-    -0.841332,
-    -0.84369,
-    -0.846635,
-    -0.849928,
-    -0.853307,
-    -0.856503,
-    -0.859269,
-    -0.861391,
-    -0.86271,
-    -0.863132,
-    -0.862634,
-    -0.861266,
-    -0.859146,
-    -0.856449,
-    -0.853393,
-    -0.850224,
-    -0.847192,
-    -0.844535,
-    -0.842456,
-    -0.841113,
-    -0.840605,
-    -0.840961,
-    -0.842144,
-    -0.844053,
-    -0.846529,
-    -0.849371,
-    -0.852352,
-    -0.855236,
-    -0.857795,
-    -0.859834,
-    -0.861196,
-    -0.861781,
-    -0.86155,
-    -0.860532,
-    -0.858813,
-    -0.856536,
-    -0.853886,
-    -0.851076,
-    -0.848327,
-    -0.845857,
-    -0.843857,
-    -0.842479,
-    -0.841827,
-    -0.841944,
-    -0.842814,
-    -0.844362,
-    -0.846458,
-    -0.848933,
-    -0.851588,
-    -0.854212,
-    -0.8566,
-    -0.858564,
-    -0.859954,
-    -0.860667,
-    -0.860651,
-    -0.859915,
-    -0.858524,
-    -0.856592,
-    -0.854277,
-    -0.851765,
-    -0.849255,
-    -0.846945,
-    -0.845016,
-    -0.843615,
-    -0.842849,
-    -0.842773,
-    -0.843387,
-    -0.844636,
-    -0.846416,
-    -0.848583,
-    -0.850963,
-    -0.853367,
-    -0.855604,
-    -0.8575,
-    -0.858909,
-    -0.859722,
-    -0.859882,
-    -0.85938,
-    -0.858263,
-    -0.856621,
-    -0.854591,
-    -0.852333,
-    -0.85003,
-    -0.847861,
-    -0.845997,
-    -0.844583,
-    -0.843727,
-    -0.843491,
-    -0.843889,
-    -0.844886,
-    -0.846398,
-    -0.848302,
-    -0.850444,
-    -0.852655,
-    -0.854759,
-    -0.856591,
-    -0.858008,
-    -0.858903,
-    -0.859209,
-    -0.858905,
-    -0.85802,
-    -0.856629,
-    -0.854844,
-    -0.852809,
-    -0.850687,
-    -0.848645,
-    -0.846844,
-    -0.845424,
-    -0.844495,
-    -0.844126,
-    -0.844342,
-    -0.845122,
-    -0.846401,
-    -0.848075,
-    -0.850008,
-    -0.852046,
-    -0.854029,
-    -0.855799,
-    -0.857219,
-    -0.85818,
-    -0.858608,
-    -0.858473,
-    -0.85779,
-    -0.856616,
-    -0.855048,
-    -0.853211,
-    -0.851252,
-    -0.849326,
-    -0.847586,
-    -0.846167,
-    -0.845179,
-    -0.844697,
-    -0.844756,
-    -0.845348,
-    -0.846422,
-    -0.847892,
-    -0.849638,
-    -0.85152,
-    -0.853391,
-    -0.855101,
-    -0.856518,
-    -0.857531,
-    -0.858062,
-    -0.858074,
-    -0.857568,
-    -0.856587,
-    -0.855211,
-    -0.853552,
-    -0.851742,
-    -0.849925,
-    -0.848244,
-    -0.846832,
-    -0.845797,
-    -0.845219,
-    -0.845142,
-    -0.845567,
-    -0.84646,
-    -0.847746,
-    -0.849322,
-    -0.851062,
-    -0.852827,
-    -0.854478,
-    -0.855886,
-    -0.856941,
-    -0.857561,
-    -0.8577,
-    -0.85735,
-    -0.856541,
-    -0.85534,
-    -0.853844,
-    -0.852172,
-    -0.850457,
-    -0.848835,
-    -0.847433,
-    -0.846361,
-    -0.845702,
-    -0.845505,
-    -0.845783,
-    -0.846512,
-    -0.847632,
-    -0.849052,
-    -0.850659,
-    -0.852325,
-    -0.853918,
-    -0.855312,
-    -0.856399,
-    -0.857095,
-    -0.857346,
-    -0.857136,
-    -0.856482,
-    -0.85544,
-    -0.854093,
-    -0.852549,
-    -0.850932,
-    -0.849368,
-    -0.847982,
-    -0.846882,
-    -0.846153,
-    -0.845851,
-    -0.845997,
-    -0.846578,
-    -0.847546,
-    -0.848822,
-    -0.850305,
-    -0.851875,
-    -0.853409,
-    -0.854786,
-    -0.855898,
-    -0.856658,
-    -0.857008,
-    -0.856922,
-    -0.85641,
-    -0.855513,
-    -0.854305,
-    -0.852883,
-    -0.851359,
-    -0.849854,
-    -0.848487,
-    -0.847366,
-    -0.846578,
-    -0.846182,
-    -0.84621,
-    -0.846657,
-    -0.847484,
-    -0.848626,
-    -0.849991,
-    -0.85147,
-    -0.852945,
-    -0.8543,
-    -0.85543,
-    -0.856244,
-    -0.856682,
-    -0.856709,
-    -0.856326,
-    -0.855564,
-    -0.854486,
-    -0.853178,
-    -0.851744,
-    -0.850298,
-    -0.848955,
-    -0.847819,
-    -0.84698,
-    -0.846503,
-    -0.846424,
-    -0.846747,
-    -0.847444,
-    -0.848461,
-    -0.849714,
-    -0.851103,
-    -0.852519,
-    -0.85385,
-    -0.85499,
-    -0.855851,
-    -0.856366,
-    -0.856495,
-    -0.85623,
-    -0.855594,
-    -0.854638,
-    -0.853439,
-    -0.852093,
-    -0.850706,
-    -0.849389,
-    -0.848246,
-    -0.847364,
-    -0.846815,
-    -0.846638,
-    -0.846847,
-    -0.847424,
-    -0.848322,
-    -0.849468,
-    -0.850771,
-    -0.852128,
-    -0.85343,
-    -0.854576,
-    -0.855475,
-    -0.856058,
-    -0.85628,
-    -0.856124,
-    -0.855605,
-    -0.854764,
-    -0.85367,
-    -0.852409,
-    -0.851083,
-    -0.849795,
-    -0.848649,
-    -0.847732,
-    -0.847118,
-    -0.846854,
-    -0.846958,
-    -0.847422,
-    -0.848208,
-    -0.849251,
-    -0.85047,
-    -0.851766,
-    -0.853037,
-    -0.854184,
-    -0.855115,
-    -0.855758,
-    -0.856063,
-    -0.856008,
-    -0.855598,
-    -0.854867,
-    -0.853873,
-    -0.852696,
-    -0.85143,
-    -0.850176,
-    -0.849031,
-    -0.848086,
-    -0.847416,
-    -0.847071,
-    -0.847079,
-    -0.847437,
-    -0.848116,
-    -0.849061,
-    -0.850196,
-    -0.851431,
-    -0.852669,
-    -0.853811,
-    -0.854767,
-    -0.855463,
-    -0.855845,
-    -0.855883,
-    -0.855576,
-    -0.854948,
-    -0.854051,
-    -0.852957,
-    -0.851752,
-    -0.850533,
-    -0.849395,
-    -0.848428,
-    -0.847708,
-    -0.847291,
-    -0.847209,
-    -0.847467,
-    -0.848044,
-    -0.848894,
-    -0.849947,
-    -0.851121,
-    -0.852322,
-    -0.853456,
-    -0.854432,
-    -0.855174,
-    -0.855625,
-    -0.855749,
-    -0.855538,
-    -0.85501,
-    -0.854207,
-    -0.853194,
-    -0.852051,
-    -0.850869,
-    -0.849741,
-    -0.848758,
-    -0.847995,
-    -0.847512,
-    -0.847347,
-    -0.847511,
-    -0.847992,
-    -0.848749,
-    -0.849722,
-    -0.850834,
-    -0.851996,
-    -0.853117,
-    -0.854107,
-    -0.854889,
-    -0.855403,
-    -0.855607,
-    -0.855487,
-    -0.855053,
-    -0.854341,
-    -0.853408,
-    -0.852327,
-    -0.851185,
-    -0.850073,
-    -0.849077,
-    -0.848277,
-    -0.847735,
-    -0.847493,
-    -0.847569,
-    -0.847957,
-    -0.848625,
-    -0.849519,
-    -0.850568,
-    -0.851689,
-    -0.852793,
-    -0.853792,
-    -0.854609,
-    -0.855179,
-    -0.855457,
-    -0.855423,
-    -0.85508,
-    -0.854455,
-    -0.853601,
-    -0.852583,
-    -0.851484,
-    -0.850389,
-    -0.849387,
-    -0.848556,
-    -0.84796,
-    -0.847647,
-    -0.84764,
-    -0.847939,
-    -0.84852,
-    -0.849336,
-    -0.850322,
-    -0.8514,
-    -0.852483,
-    -0.853487,
-    -0.854333,
-    -0.854953,
-    -0.8553,
-    -0.855346,
-    -0.85509,
-    -0.854551,
-    -0.853774,
-    -0.85282,
-    -0.851765,
-    -0.850693,
-    -0.849688,
-    -0.84883,
-    -0.848187,
-    -0.847808,
-    -0.847722,
-    -0.847937,
-    -0.848434,
-    -0.849173,
-    -0.850095,
-    -0.851127,
-    -0.852187,
-    -0.853191,
-    -0.85406,
-    -0.854725,
-    -0.855135,
-    -0.855258,
-    -0.855084,
-    -0.854629,
-    -0.853928,
-    -0.853038,
-    -0.85203,
-    -0.850983,
-    -0.84998,
-    -0.849101,
-    -0.848415,
-    -0.847975,
-    -0.847816,
-    -0.84795,
-    -0.848364,
-    -0.849027,
-    -0.849885,
-    -0.85087,
-    -0.851903,
-    -0.852903,
-    -0.853791,
-    -0.854496,
-    -0.854965,
-    -0.855159,
-    -0.855065,
-    -0.85469,
-    -0.854065,
-    -0.853239,
-    -0.852279,
-    -0.85126,
-    -0.850264,
-    -0.849368,
-    -0.848644,
-    -0.848149,
-    -0.84792,
-    -0.847976,
-    -0.848312,
-    -0.848899,
-    -0.849693,
-    -0.850628,
-    -0.851631,
-    -0.852623,
-    -0.853525,
-    -0.854266,
-    -0.854788,
-    -0.85505,
-    -0.855031,
-    -0.854735,
-    -0.854184,
-    -0.853423,
-    -0.852513,
-    -0.851526,
-    -0.850539,
-    -0.849632,
-    -0.848875,
-    -0.848328,
-    -0.848035,
-    -0.848016,
-    -0.848274,
-    -0.848788,
-    -0.849516,
-    -0.850401,
-    -0.851372,
-    -0.852352,
-    -0.853263,
-    -0.854035,
-    -0.854606,
-    -0.854931,
-    -0.854985,
-    -0.854764,
-    -0.854287,
-    -0.853592,
-    -0.852733,
-    -0.85178,
-    -0.850807,
-    -0.849892,
-    -0.849107,
-    -0.848513,
-    -0.848158,
-    -0.848069,
-    -0.848252,
-    -0.848693,
-    -0.849356,
-    -0.850188,
-    -0.851124,
-    -0.852088,
-    -0.853005,
-    -0.853803,
-    -0.854418,
-    -0.854802,
-    -0.854926,
-    -0.854779,
-    -0.854374,
-    -0.853744,
-    -0.852939,
-    -0.852022,
-    -0.851066,
-    -0.850148,
-    -0.849339,
-    -0.848703,
-    -0.848291,
-    -0.848134,
-    -0.848245,
-    -0.848614,
-    -0.849211,
-    -0.849989,
-    -0.850887,
-    -0.851833,
-    -0.852751,
-    -0.85357,
-    -0.854226,
-    -0.854665,
-    -0.854855,
-    -0.85478,
-    -0.854446,
-    -0.853882,
-    -0.853131,
-    -0.852253,
-    -0.851318,
-    -0.8504,
-    -0.849572,
-    -0.848898,
-    -0.848432,
-    -0.848211,
-    -0.848251,
-    -0.848549,
-    -0.849081,
-    -0.849804,
-    -0.850662,
-    -0.851585,
-    -0.852501,
-    -0.853338,
-    -0.854029,
-    -0.85452,
-    -0.854772,
-    -0.854767,
-    -0.854504,
-    -0.854005,
-    -0.853309,
-    -0.852473,
-    -0.851562,
-    -0.850648,
-    -0.849804,
-    -0.849097,
-    -0.848581,
-    -0.848299,
-    -0.848271,
-    -0.848499,
-    -0.848965,
-    -0.849632,
-    -0.850447,
-    -0.851345,
-    -0.852255,
-    -0.853105,
-    -0.853828,
-    -0.854367,
-    -0.854679,
-    -0.854741,
-    -0.854547,
-    -0.854113,
-    -0.853474,
-    -0.852682,
-    -0.851797,
-    -0.850892,
-    -0.850037,
-    -0.849299,
-    -0.848738,
-    -0.848397,
-    -0.848303,
-    -0.848463,
-    -0.848864,
-    -0.849474,
-    -0.850244,
-    -0.851114,
-    -0.852014,
-    -0.852873,
-    -0.853624,
-    -0.854207,
-    -0.854575,
-    -0.854702,
-    -0.854576,
-    -0.854207,
-    -0.853626,
-    -0.852879,
-    -0.852025,
-    -0.851131,
-    -0.850268,
-    -0.849505,
-    -0.848902,
-    -0.848506,
-    -0.848348,
-    -0.848441,
-    -0.848777,
-    -0.849328,
-    -0.850052,
-    -0.85089,
-    -0.851777,
-    -0.852642,
-    -0.853416,
-    -0.854039,
-    -0.854462,
-    -0.85465,
-    -0.854591,
-    -0.854288,
-    -0.853766,
-    -0.853066,
-    -0.852244,
-    -0.851365,
-    -0.850499,
-    -0.849714,
-    -0.849072,
-    -0.848624,
-    -0.848405,
-    -0.848432,
-    -0.848703,
-    -0.849196,
-    -0.849871,
-    -0.850675,
-    -0.851545,
-    -0.852412,
-    -0.853206,
-    -0.853866,
-    -0.854339,
-    -0.854587,
-    -0.854593,
-    -0.854355,
-    -0.853892,
-    -0.853241,
-    -0.852455,
-    -0.851594,
-    -0.850729,
-    -0.849926,
-    -0.849249,
-    -0.848752,
-    -0.848474,
-    -0.848437,
-    -0.848643,
-    -0.849076,
-    -0.849701,
-    -0.850469,
-    -0.851319,
-    -0.852183,
-    -0.852994,
-    -0.853686,
-    -0.854206,
-    -0.854513,
-    -0.854582,
-    -0.854408,
-    -0.854005,
-    -0.853406,
-    -0.852657,
-    -0.851818,
-    -0.850956,
-    -0.850139,
-    -0.849431,
-    -0.848889,
-    -0.848554,
-    -0.848454,
-    -0.848596,
-    -0.848969,
-    -0.849542,
-    -0.850271,
-    -0.851098,
-    -0.851956,
-    -0.852779,
-    -0.853501,
-    -0.854065,
-    -0.854427,
-    -0.854558,
-    -0.854448,
-    -0.854106,
-    -0.853559,
-    -0.85285,
-    -0.852037,
-    -0.851182,
-    -0.850354,
-    -0.849619,
-    -0.849034,
-    -0.848646,
-    -0.848484,
-    -0.848563,
-    -0.848874,
-    -0.849395,
-    -0.850082,
-    -0.850882,
-    -0.851732,
-    -0.852563,
-    -0.853311,
-    -0.853916,
-    -0.854331,
-    -0.854522,
-    -0.854475,
-    -0.854194,
-    -0.853701,
-    -0.853035,
-    -0.852249,
-    -0.851406,
-    -0.850571,
-    -0.849812,
-    -0.849187,
-    -0.848747,
-    -0.848527,
-    -0.848542,
-    -0.848793,
-    -0.849258,
-    -0.849902,
-    -0.850673,
-    -0.85151,
-    -0.852346,
-    -0.853116,
-    -0.853759,
-    -0.854224,
-    -0.854474,
-    -0.854489,
-    -0.854269,
-    -0.853831,
-    -0.85321,
-    -0.852455,
-    -0.851626,
-    -0.850788,
-    -0.850009,
-    -0.849348,
-    -0.848859,
-    -0.848581,
-    -0.848534,
-    -0.848724,
-    -0.849133,
-    -0.849731,
-    -0.85047,
-    -0.851291,
-    -0.852128,
-    -0.852917,
-    -0.853594,
-    -0.854107,
-    -0.854413,
-    -0.85449,
-    -0.854332,
-    -0.85395,
-    -0.853376,
-    -0.852655,
-    -0.851843,
-    -0.851006,
-    -0.85021,
-    -0.849516,
-    -0.848981,
-    -0.848647,
-    -0.848539,
-    -0.848667,
-    -0.84902,
-    -0.84957,
-    -0.850274,
-    -0.851075,
-    -0.851911,
-    -0.852714,
-    -0.853423,
-    -0.85398,
-    -0.854342,
-    -0.854479,
-    -0.854382,
-    -0.854058,
-    -0.853533,
-    -0.852848,
-    -0.852057,
-    -0.851224,
-    -0.850414,
-    -0.849691,
-    -0.849113,
-    -0.848724,
-    -0.848557,
-    -0.848623,
-    -0.848918,
-    -0.849419,
-    -0.850084,
-    -0.850863,
-    -0.851693,
-    -0.852508,
-    -0.853245,
-    -0.853844,
-    -0.854258,
-    -0.854455,
-    -0.85442,
-    -0.854154,
-    -0.853679,
-    -0.853033,
-    -0.852267,
-    -0.851442,
-    -0.850622,
-    -0.849873,
-    -0.849254,
-    -0.848813,
-    -0.848587,
-    -0.848592,
-    -0.848828,
-    -0.849277,
-    -0.849902,
-    -0.850655,
-    -0.851476,
-    -0.852299,
-    -0.85306,
-    -0.853698,
-    -0.854164,
-    -0.854419,
-    -0.854445,
-    -0.854238,
-    -0.853816,
-    -0.853212,
-    -0.852473,
-    -0.851658,
-    -0.850832,
-    -0.85006,
-    -0.849403,
-    -0.848913,
-    -0.848629,
-    -0.848573,
-    -0.84875,
-    -0.849145,
-    -0.849728,
-    -0.850452,
-    -0.85126,
-    -0.852087,
-    -0.85287,
-    -0.853545,
-    -0.854059,
-    -0.854371,
-    -0.854457,
-    -0.854311,
-    -0.853943,
-    -0.853382,
-    -0.852674,
-    -0.851874,
-    -0.851045,
-    -0.850253,
-    -0.849561,
-    -0.849024,
-    -0.848683,
-    -0.848567,
-    -0.848683,
-    -0.849024,
-    -0.849561,
-    -0.850253,
-    -0.851045,
-    -0.851874,
-    -0.852674,
-    -0.853382,
-    -0.853943,
-    -0.854311,
-    -0.854457,
-    -0.854371,
-    -0.854059,
-    -0.853545,
-    -0.85287,
-    -0.852087,
-    -0.85126,
-    -0.850452,
-    -0.849728,
-    -0.849145,
-    -0.84875,
-    -0.848573,
-    -0.848629,
-    -0.848913,
-    -0.849403,
-    -0.85006,
-    -0.850832,
-    -0.851658,
-    -0.852473,
-    -0.853212,
-    -0.853816,
-    -0.854238,
-    -0.854445,
-    -0.854419,
-    -0.854164,
-    -0.853698,
-    -0.85306,
-    -0.852299,
-    -0.851476,
-    -0.850655,
-    -0.849902,
-    -0.849277,
-    -0.848828,
-    -0.848592,
-    -0.848587,
-    -0.848813,
-    -0.849254,
-    -0.849873,
-    -0.850622,
-    -0.851442,
-    -0.852267,
-    -0.853033,
-    -0.853679,
-    -0.854154,
-    -0.85442,
-    -0.854455,
-    -0.854258,
-    -0.853844,
-    -0.853245,
-    -0.852508,
-    -0.851693,
-    -0.850863,
-    -0.850084,
-    -0.849419,
-    -0.848918,
-    -0.848623,
-    -0.848557,
-    -0.848724,
-    -0.849113,
-    -0.849691,
-    -0.850414,
-    -0.851224,
-    -0.852057,
-    -0.852848,
-    -0.853533,
-    -0.854058,
-    -0.854382,
-    -0.854479,
-    -0.854342,
-    -0.85398,
-    -0.853423,
-    -0.852714,
-    -0.851911,
-    -0.851075,
-    -0.850274,
-    -0.84957,
-    -0.84902,
-    -0.848667,
-    -0.848539,
-    -0.848647,
-    -0.848981,
-    -0.849516,
-    -0.85021,
-    -0.851006,
-    -0.851843,
-    -0.852655,
-    -0.853376,
-    -0.85395,
-    -0.854332,
-    -0.85449,
-    -0.854413,
-    -0.854107,
-    -0.853594,
-    -0.852917,
-    -0.852128,
-    -0.851291,
-    -0.85047,
-    -0.849731,
-    -0.849133,
-    -0.848724,
-    -0.848534,
-    -0.848581,
-    -0.848859,
-    -0.849348,
-    -0.850009,
-    -0.850788,
-    -0.851626,
-    -0.852455,
-    -0.85321,
-    -0.853831,
-    -0.854269,
-    -0.854489,
-    -0.854474,
-    -0.854224,
-    -0.853759,
-    -0.853116,
-    -0.852346,
-    -0.85151,
-    -0.850673,
-    -0.849902,
-    -0.849258,
-    -0.848793,
-    -0.848542,
-    -0.848527,
-    -0.848747,
-    -0.849187,
-    -0.849812,
-    -0.850571,
-    -0.851406,
-    -0.852249,
-    -0.853035,
-    -0.853701,
-    -0.854194,
-    -0.854475,
-    -0.854522,
-    -0.854331,
-    -0.853916,
-    -0.853311,
-    -0.852563,
-    -0.851732,
-    -0.850882,
-    -0.850082,
-    -0.849395,
-    -0.848874,
-    -0.848563,
-    -0.848484,
-    -0.848646,
-    -0.849034,
-    -0.849619,
-    -0.850354,
-    -0.851182,
-    -0.852037,
-    -0.85285,
-    -0.853559,
-    -0.854106,
-    -0.854448,
-    -0.854558,
-    -0.854427,
-    -0.854065,
-    -0.853501,
-    -0.852779,
-    -0.851956,
-    -0.851098,
-    -0.850271,
-    -0.849542,
-    -0.848969,
-    -0.848596,
-    -0.848454,
-    -0.848554,
-    -0.848889,
-    -0.849431,
-    -0.850139,
-    -0.850956,
-    -0.851818,
-    -0.852657,
-    -0.853406,
-    -0.854005,
-    -0.854408,
-    -0.854582,
-    -0.854513,
-    -0.854206,
-    -0.853686,
-    -0.852994,
-    -0.852183,
-    -0.851319,
-    -0.850469,
-    -0.849701,
-    -0.849076,
-    -0.848643,
-    -0.848437,
-    -0.848474,
-    -0.848752,
-    -0.849249,
-    -0.849926,
-    -0.850729,
-    -0.851594,
-    -0.852455,
-    -0.853241,
-    -0.853892,
-    -0.854355,
-    -0.854593,
-    -0.854587,
-    -0.854339,
-    -0.853866,
-    -0.853206,
-    -0.852412,
-    -0.851545,
-    -0.850675,
-    -0.849871,
-    -0.849196,
-    -0.848703,
-    -0.848432,
-    -0.848405,
-    -0.848624,
-    -0.849072,
-    -0.849714,
-    -0.850499,
-    -0.851365,
-    -0.852244,
-    -0.853066,
-    -0.853766,
-    -0.854288,
-    -0.854591,
-    -0.85465,
-    -0.854462,
-    -0.854039,
-    -0.853416,
-    -0.852642,
-    -0.851777,
-    -0.85089,
-    -0.850052,
-    -0.849328,
-    -0.848777,
-    -0.848441,
-    -0.848348,
-    -0.848506,
-    -0.848902,
-    -0.849505,
-    -0.850268,
-    -0.851131,
-    -0.852025,
-    -0.852879,
-    -0.853626,
-    -0.854207,
-    -0.854576,
-    -0.854702,
-    -0.854575,
-    -0.854207,
-    -0.853624,
-    -0.852873,
-    -0.852014,
-    -0.851114,
-    -0.850244,
-    -0.849474,
-    -0.848864,
-    -0.848463,
-    -0.848303,
-    -0.848397,
-    -0.848738,
-    -0.849299,
-    -0.850037,
-    -0.850892,
-    -0.851797,
-    -0.852682,
-    -0.853474,
-    -0.854113,
-    -0.854547,
-    -0.854741,
-    -0.854679,
-    -0.854367,
-    -0.853828,
-    -0.853105,
-    -0.852255,
-    -0.851345,
-    -0.850447,
-    -0.849632,
-    -0.848965,
-    -0.848499,
-    -0.848271,
-    -0.848299,
-    -0.848581,
-    -0.849097,
-    -0.849804,
-    -0.850648,
-    -0.851562,
-    -0.852473,
-    -0.853309,
-    -0.854005,
-    -0.854504,
-    -0.854767,
-    -0.854772,
-    -0.85452,
-    -0.854029,
-    -0.853338,
-    -0.852501,
-    -0.851585,
-    -0.850662,
-    -0.849804,
-    -0.849081,
-    -0.848549,
-    -0.848251,
-    -0.848211,
-    -0.848432,
-    -0.848898,
-    -0.849572,
-    -0.8504,
-    -0.851318,
-    -0.852253,
-    -0.853131,
-    -0.853882,
-    -0.854446,
-    -0.85478,
-    -0.854855,
-    -0.854665,
-    -0.854226,
-    -0.85357,
-    -0.852751,
-    -0.851833,
-    -0.850887,
-    -0.849989,
-    -0.849211,
-    -0.848614,
-    -0.848245,
-    -0.848134,
-    -0.848291,
-    -0.848703,
-    -0.849339,
-    -0.850148,
-    -0.851066,
-    -0.852022,
-    -0.852939,
-    -0.853744,
-    -0.854374,
-    -0.854779,
-    -0.854926,
-    -0.854802,
-    -0.854418,
-    -0.853803,
-    -0.853005,
-    -0.852088,
-    -0.851124,
-    -0.850188,
-    -0.849356,
-    -0.848693,
-    -0.848252,
-    -0.848069,
-    -0.848158,
-    -0.848513,
-    -0.849107,
-    -0.849892,
-    -0.850807,
-    -0.85178,
-    -0.852733,
-    -0.853592,
-    -0.854287,
-    -0.854764,
-    -0.854985,
-    -0.854931,
-    -0.854606,
-    -0.854035,
-    -0.853263,
-    -0.852352,
-    -0.851372,
-    -0.850401,
-    -0.849516,
-    -0.848788,
-    -0.848274,
-    -0.848016,
-    -0.848035,
-    -0.848328,
-    -0.848875,
-    -0.849632,
-    -0.850539,
-    -0.851526,
-    -0.852513,
-    -0.853423,
-    -0.854184,
-    -0.854735,
-    -0.855031,
-    -0.85505,
-    -0.854788,
-    -0.854266,
-    -0.853525,
-    -0.852623,
-    -0.851631,
-    -0.850628,
-    -0.849693,
-    -0.848899,
-    -0.848312,
-    -0.847976,
-    -0.84792,
-    -0.848149,
-    -0.848644,
-    -0.849368,
-    -0.850264,
-    -0.85126,
-    -0.852279,
-    -0.853239,
-    -0.854065,
-    -0.85469,
-    -0.855065,
-    -0.855159,
-    -0.854965,
-    -0.854496,
-    -0.853791,
-    -0.852903,
-    -0.851903,
-    -0.85087,
-    -0.849885,
-    -0.849027,
-    -0.848364,
-    -0.84795,
-    -0.847816,
-    -0.847975,
-    -0.848415,
-    -0.849101,
-    -0.84998,
-    -0.850983,
-    -0.85203,
-    -0.853038,
-    -0.853928,
-    -0.854629,
-    -0.855084,
-    -0.855258,
-    -0.855135,
-    -0.854725,
-    -0.85406,
-    -0.853191,
-    -0.852187,
-    -0.851127,
-    -0.850095,
-    -0.849173,
-    -0.848434,
-    -0.847937,
-    -0.847722,
-    -0.847808,
-    -0.848187,
-    -0.84883,
-    -0.849688,
-    -0.850693,
-    -0.851765,
-    -0.85282,
-    -0.853774,
-    -0.854551,
-    -0.85509,
-    -0.855346,
-    -0.8553,
-    -0.854953,
-    -0.854333,
-    -0.853487,
-    -0.852483,
-    -0.8514,
-    -0.850322,
-    -0.849336,
-    -0.84852,
-    -0.847939,
-    -0.84764,
-    -0.847647,
-    -0.84796,
-    -0.848556,
-    -0.849387,
-    -0.850389,
-    -0.851484,
-    -0.852583,
-    -0.853601,
-    -0.854455,
-    -0.85508,
-    -0.855423,
-    -0.855457,
-    -0.855179,
-    -0.854609,
-    -0.853792,
-    -0.852793,
-    -0.851689,
-    -0.850568,
-    -0.849519,
-    -0.848625,
-    -0.847957,
-    -0.847569,
-    -0.847493,
-    -0.847735,
-    -0.848277,
-    -0.849077,
-    -0.850073,
-    -0.851185,
-    -0.852327,
-    -0.853408,
-    -0.854341,
-    -0.855053,
-    -0.855487,
-    -0.855607,
-    -0.855403,
-    -0.854889,
-    -0.854107,
-    -0.853117,
-    -0.851996,
-    -0.850834,
-    -0.849722,
-    -0.848749,
-    -0.847992,
-    -0.847511,
-    -0.847347,
-    -0.847512,
-    -0.847995,
-    -0.848758,
-    -0.849741,
-    -0.850869,
-    -0.852051,
-    -0.853194,
-    -0.854207,
-    -0.85501,
-    -0.855538,
-    -0.855749,
-    -0.855625,
-    -0.855174,
-    -0.854432,
-    -0.853456,
-    -0.852322,
-    -0.851121,
-    -0.849947,
-    -0.848894,
-    -0.848044,
-    -0.847467,
-    -0.847209,
-    -0.847291,
-    -0.847708,
-    -0.848428,
-    -0.849395,
-    -0.850533,
-    -0.851752,
-    -0.852957,
-    -0.854051,
-    -0.854948,
-    -0.855576,
-    -0.855883,
-    -0.855845,
-    -0.855463,
-    -0.854767,
-    -0.853811,
-    -0.852669,
-    -0.851431,
-    -0.850196,
-    -0.849061,
-    -0.848116,
-    -0.847437,
-    -0.847079,
-    -0.847071,
-    -0.847416,
-    -0.848086,
-    -0.849031,
-    -0.850176,
-    -0.85143,
-    -0.852696,
-    -0.853873,
-    -0.854867,
-    -0.855598,
-    -0.856008,
-    -0.856063,
-    -0.855758,
-    -0.855115,
-    -0.854184,
-    -0.853037,
-    -0.851766,
-    -0.85047,
-    -0.849251,
-    -0.848208,
-    -0.847422,
-    -0.846958,
-    -0.846854,
-    -0.847118,
-    -0.847732,
-    -0.848649,
-    -0.849795,
-    -0.851083,
-    -0.852409,
-    -0.85367,
-    -0.854764,
-    -0.855605,
-    -0.856124,
-    -0.85628,
-    -0.856058,
-    -0.855475,
-    -0.854576,
-    -0.85343,
-    -0.852128,
-    -0.850771,
-    -0.849468,
-    -0.848322,
-    -0.847424,
-    -0.846847,
-    -0.846638,
-    -0.846815,
-    -0.847364,
-    -0.848246,
-    -0.849389,
-    -0.850706,
-    -0.852093,
-    -0.853439,
-    -0.854638,
-    -0.855594,
-    -0.85623,
-    -0.856495,
-    -0.856366,
-    -0.855851,
-    -0.85499,
-    -0.85385,
-    -0.852519,
-    -0.851103,
-    -0.849714,
-    -0.848461,
-    -0.847444,
-    -0.846747,
-    -0.846424,
-    -0.846503,
-    -0.84698,
-    -0.847819,
-    -0.848955,
-    -0.850298,
-    -0.851744,
-    -0.853178,
-    -0.854486,
-    -0.855564,
-    -0.856326,
-    -0.856709,
-    -0.856682,
-    -0.856244,
-    -0.85543,
-    -0.8543,
-    -0.852945,
-    -0.85147,
-    -0.849991,
-    -0.848626,
-    -0.847484,
-    -0.846657,
-    -0.84621,
-    -0.846182,
-    -0.846578,
-    -0.847366,
-    -0.848487,
-    -0.849854,
-    -0.851359,
-    -0.852883,
-    -0.854305,
-    -0.855513,
-    -0.85641,
-    -0.856922,
-    -0.857008,
-    -0.856658,
-    -0.855898,
-    -0.854786,
-    -0.853409,
-    -0.851875,
-    -0.850305,
-    -0.848822,
-    -0.847546,
-    -0.846578,
-    -0.845997,
-    -0.845851,
-    -0.846153,
-    -0.846882,
-    -0.847982,
-    -0.849368,
-    -0.850932,
-    -0.852549,
-    -0.854093,
-    -0.85544,
-    -0.856482,
-    -0.857136,
-    -0.857346,
-    -0.857095,
-    -0.856399,
-    -0.855312,
-    -0.853918,
-    -0.852325,
-    -0.850659,
-    -0.849052,
-    -0.847632,
-    -0.846512,
-    -0.845783,
-    -0.845505,
-    -0.845702,
-    -0.846361,
-    -0.847433,
-    -0.848835,
-    -0.850457,
-    -0.852172,
-    -0.853844,
-    -0.85534,
-    -0.856541,
-    -0.85735,
-    -0.8577,
-    -0.857561,
-    -0.856941,
-    -0.855886,
-    -0.854478,
-    -0.852827,
-    -0.851062,
-    -0.849322,
-    -0.847746,
-    -0.84646,
-    -0.845567,
-    -0.845142,
-    -0.845219,
-    -0.845797,
-    -0.846832,
-    -0.848244,
-    -0.849925,
-    -0.851742,
-    -0.853552,
-    -0.855211,
-    -0.856587,
-    -0.857568,
-    -0.858074,
-    -0.858062,
-    -0.857531,
-    -0.856518,
-    -0.855101,
-    -0.853391,
-    -0.85152,
-    -0.849638,
-    -0.847892,
-    -0.846422,
-    -0.845348,
-    -0.844756,
-    -0.844697,
-    -0.845179,
-    -0.846167,
-    -0.847586,
-    -0.849326,
-    -0.851252,
-    -0.853211,
-    -0.855048,
-    -0.856616,
-    -0.85779,
-    -0.858473,
-    -0.858608,
-    -0.85818,
-    -0.857219,
-    -0.855799,
-    -0.854029,
-    -0.852046,
-    -0.850008,
-    -0.848075,
-    -0.846401,
-    -0.845122,
-    -0.844342,
-    -0.844126,
-    -0.844495,
-    -0.845424,
-    -0.846844,
-    -0.848645,
-    -0.850687,
-    -0.852809,
-    -0.854844,
-    -0.856629,
-    -0.85802,
-    -0.858905,
-    -0.859209,
-    -0.858903,
-    -0.858008,
-    -0.856591,
-    -0.854759,
-    -0.852655,
-    -0.850444,
-    -0.848302,
-    -0.846398,
-    -0.844886,
-    -0.843889,
-    -0.843491,
-    -0.843727,
-    -0.844583,
-    -0.845997,
-    -0.847861,
-    -0.85003,
-    -0.852333,
-    -0.854591,
-    -0.856621,
-    -0.858263,
-    -0.85938,
-    -0.859882,
-    -0.859722,
-    -0.858909,
-    -0.8575,
-    -0.855604,
-    -0.853367,
-    -0.850963,
-    -0.848583,
-    -0.846416,
-    -0.844636,
-    -0.843387,
-    -0.842773,
-    -0.842849,
-    -0.843615,
-    -0.845016,
-    -0.846945,
-    -0.849255,
-    -0.851765,
-    -0.854277,
-    -0.856592,
-    -0.858524,
-    -0.859915,
-    -0.860651,
-    -0.860667,
-    -0.859954,
-    -0.858564,
-    -0.8566,
-    -0.854212,
-    -0.851588,
-    -0.848933,
-    -0.846458,
-    -0.844362,
-    -0.842814,
-    -0.841944,
-    -0.841827,
-    -0.842479,
-    -0.843857,
-    -0.845857,
-    -0.848327,
-    -0.851076,
-    -0.853886,
-    -0.856536,
-    -0.858813,
-    -0.860532,
-    -0.86155,
-    -0.861781,
-    -0.861196,
-    -0.859834,
-    -0.857795,
-    -0.855236,
-    -0.852352,
-    -0.849371,
-    -0.846529,
-    -0.844053,
-    -0.842144,
-    -0.840961,
-    -0.840605,
-    -0.841113,
-    -0.842456,
-    -0.844535,
-    -0.847192,
-    -0.850224,
-    -0.853393,
-    -0.856449,
-    -0.859146,
-    -0.861266,
-    -0.862634,
-    -0.863132,
-    -0.86271,
-    -0.861391,
-    -0.859269,
-    -0.856503,
-    -0.853307,
-    -0.849928,
-    -0.846635,
-    -0.84369,
-    -0.841332,
-    -0.839756,
-    -0.839097,
-    -0.83942,
-    -0.840711,
-    -0.84288,
-    -0.845765,
-    -0.849146,
-    -0.85276,
-    -0.856322,
-    -0.859548,
-    -0.862176,
-    -0.863988,
-    -0.864831,
-    -0.864622,
-    -0.863365,
-    -0.861144,
-    -0.858125,
-    -0.854535,
-    -0.850653,
-    -0.846785,
-    -0.843238,
-    -0.840301,
-    -0.838216,
-    -0.837161,
-    -0.837237,
-    -0.838454,
-    -0.840731,
-    -0.843904,
-    -0.847734,
-    -0.851924,
-    -0.856146,
-    -0.860064,
-    -0.863361,
-    -0.865764,
-    -0.867066,
-    -0.867147,
-    -0.86598,
-    -0.863637,
-    -0.860286,
-    -0.856178,
-    -0.851628,
-    -0.846991,
-    -0.842636,
-    -0.838915,
-    -0.836137,
-    -0.83454,
-    -0.834272,
-    -0.835379,
-    -0.837797,
-    -0.841357,
-    -0.845795,
-    -0.850774,
-    -0.855906,
-    -0.860784,
-    -0.865013,
-    -0.868243,
-    -0.870196,
-    -0.870691,
-    -0.869659,
-    -0.867152,
-    -0.86334,
-    -0.858502,
-    -0.853002,
-    -0.847268,
-    -0.841751,
-    -0.836899,
-    -0.833114,
-    -0.830722,
-    -0.829945,
-    -0.830883,
-    -0.833498,
-    -0.83762,
-    -0.842954,
-    -0.849102,
-    -0.85559,
-    -0.861907,
-    -0.867544,
-    -0.87203,
-    -0.874979,
-    -0.876115,
-    -0.8753,
-    -0.872549,
-    -0.868031,
-    -0.862062,
-    -0.855081,
-    -0.84762,
-    -0.840264,
-    -0.833608,
-    -0.828204,
-    -0.824525,
-    -0.822915,
-    -0.823566,
-    -0.826495,
-    -0.831537,
-    -0.838353,
-    -0.846451,
-    -0.855222,
-    -0.863982,
-    -0.872026,
-    -0.878682,
-    -0.883367,
-    -0.885632,
-    -0.88521,
-    -0.882034,
-    -0.87626,
-    -0.868253,
-    -0.858573,
-    -0.847935,
-    -0.83716,
-    -0.827111,
-    -0.818632,
-    -0.812476,
-    -0.809242,
-    -0.809323,
-    -0.812865,
-    -0.819743,
-    -0.829561,
-    -0.841667,
-    -0.855195,
-    -0.86912,
-    -0.882331,
-    -0.893717,
-    -0.902246,
-    -0.90706,
-    -0.907543,
-    -0.903391,
-    -0.894649,
-    -0.881729,
-    -0.865407,
-    -0.84678,
-    -0.82721,
-    -0.808232,
-    -0.791455,
-    -0.778439,
-    -0.77058,
-    -0.768985,
-    -0.774369,
-    -0.786966,
-    -0.806469,
-    -0.831995,
-    -0.862098,
-    -0.894804,
-    -0.927692,
-    -0.958004,
-    -0.982778,
-    -0.999008,
-    -1.00381,
-    -0.994578,
-    -0.969169,
-    -0.926013,
-    -0.864241,
-    -0.783757,
-    -0.685274,
-    -0.570308,
-    -0.441124,
-    -0.300647,
-    -0.152331
-};
-
-// Top frequency: 44.1K * 0.00725624
-constexpr static std::array<float, 4096> wt_square_0x4 =
-{
-    0,
-    0.0764185,
-    0.152331,
-    0.227236,
-    0.300647,
-    0.372092,
-    0.441125,
-    0.507326,
-    0.570311,
-    0.629731,
-    0.68528,
-    0.736697,
-    0.783767,
-    0.826324,
-    0.864255,
-    0.897494,
-    0.926031,
-    0.9499,
-    0.96919,
-    0.984032,
-    0.994602,
-    1.00112,
-    1.00383,
-    1.00303,
-    0.999032,
-    0.992169,
-    0.982799,
-    0.971291,
-    0.95802,
-    0.943365,
-    0.927701,
-    0.911395,
-    0.894803,
-    0.878262,
-    0.862087,
-    0.84657,
-    0.831973,
-    0.818529,
-    0.806436,
-    0.795859,
-    0.786925,
-    0.779727,
-    0.774322,
-    0.770728,
-    0.768934,
-    0.768894,
-    0.77053,
-    0.77374,
-    0.778395,
-    0.784344,
-    0.79142,
-    0.799439,
-    0.80821,
-    0.817532,
-    0.827204,
-    0.837022,
-    0.846791,
-    0.856322,
-    0.865436,
-    0.873969,
-    0.881775,
-    0.888724,
-    0.894708,
-    0.899642,
-    0.903461,
-    0.906126,
-    0.907618,
-    0.907945,
-    0.907134,
-    0.905234,
-    0.902314,
-    0.898459,
-    0.893772,
-    0.888366,
-    0.882369,
-    0.875912,
-    0.869135,
-    0.862179,
-    0.855186,
-    0.848293,
-    0.841633,
-    0.835331,
-    0.829503,
-    0.824251,
-    0.819666,
-    0.81582,
-    0.812773,
-    0.810566,
-    0.809223,
-    0.808752,
-    0.809142,
-    0.810367,
-    0.812384,
-    0.815137,
-    0.818556,
-    0.82256,
-    0.827058,
-    0.83195,
-    0.837134,
-    0.8425,
-    0.84794,
-    0.853346,
-    0.85861,
-    0.863633,
-    0.86832,
-    0.872586,
-    0.876353,
-    0.879558,
-    0.882147,
-    0.884081,
-    0.885334,
-    0.885892,
-    0.885758,
-    0.884946,
-    0.883484,
-    0.881412,
-    0.878781,
-    0.875653,
-    0.872098,
-    0.868192,
-    0.86402,
-    0.859667,
-    0.855222,
-    0.850775,
-    0.846412,
-    0.842219,
-    0.838277,
-    0.834658,
-    0.831429,
-    0.828647,
-    0.826362,
-    0.82461,
-    0.823418,
-    0.822801,
-    0.822763,
-    0.823296,
-    0.824382,
-    0.82599,
-    0.828082,
-    0.830609,
-    0.833516,
-    0.83674,
-    0.840212,
-    0.843861,
-    0.847612,
-    0.85139,
-    0.855119,
-    0.858728,
-    0.862145,
-    0.865307,
-    0.868154,
-    0.870633,
-    0.872702,
-    0.874323,
-    0.875472,
-    0.87613,
-    0.876293,
-    0.875961,
-    0.875148,
-    0.873877,
-    0.872177,
-    0.870089,
-    0.867656,
-    0.864933,
-    0.861976,
-    0.858846,
-    0.855607,
-    0.852325,
-    0.849066,
-    0.845892,
-    0.842866,
-    0.840046,
-    0.837485,
-    0.835232,
-    0.833327,
-    0.831803,
-    0.830688,
-    0.829998,
-    0.829742,
-    0.829921,
-    0.830526,
-    0.831541,
-    0.832941,
-    0.834695,
-    0.836764,
-    0.839104,
-    0.841665,
-    0.844396,
-    0.847239,
-    0.850138,
-    0.853035,
-    0.855872,
-    0.858594,
-    0.861148,
-    0.863485,
-    0.865562,
-    0.86734,
-    0.868786,
-    0.869876,
-    0.87059,
-    0.87092,
-    0.870861,
-    0.870419,
-    0.869606,
-    0.868442,
-    0.866953,
-    0.865172,
-    0.863136,
-    0.860889,
-    0.858477,
-    0.855948,
-    0.853355,
-    0.850748,
-    0.84818,
-    0.845702,
-    0.843361,
-    0.841202,
-    0.839267,
-    0.837593,
-    0.836209,
-    0.83514,
-    0.834406,
-    0.834017,
-    0.833979,
-    0.834289,
-    0.834938,
-    0.83591,
-    0.837184,
-    0.838731,
-    0.840519,
-    0.84251,
-    0.844663,
-    0.846934,
-    0.849278,
-    0.851646,
-    0.853993,
-    0.856272,
-    0.858437,
-    0.860448,
-    0.862266,
-    0.863856,
-    0.865189,
-    0.86624,
-    0.86699,
-    0.867427,
-    0.867546,
-    0.867345,
-    0.866832,
-    0.866019,
-    0.864924,
-    0.863572,
-    0.86199,
-    0.860213,
-    0.858276,
-    0.856219,
-    0.854085,
-    0.851915,
-    0.849753,
-    0.847642,
-    0.845623,
-    0.843736,
-    0.842017,
-    0.840498,
-    0.839209,
-    0.838174,
-    0.83741,
-    0.836931,
-    0.836746,
-    0.836854,
-    0.837253,
-    0.837931,
-    0.838875,
-    0.840063,
-    0.841469,
-    0.843066,
-    0.844819,
-    0.846693,
-    0.84865,
-    0.85065,
-    0.852654,
-    0.854622,
-    0.856516,
-    0.858297,
-    0.859932,
-    0.861389,
-    0.862641,
-    0.863664,
-    0.864439,
-    0.864952,
-    0.865196,
-    0.865166,
-    0.864866,
-    0.864302,
-    0.863489,
-    0.862443,
-    0.861186,
-    0.859746,
-    0.858151,
-    0.856435,
-    0.854631,
-    0.852777,
-    0.850909,
-    0.849065,
-    0.84728,
-    0.84559,
-    0.844028,
-    0.842624,
-    0.841405,
-    0.840394,
-    0.839609,
-    0.839066,
-    0.838772,
-    0.838733,
-    0.838948,
-    0.839411,
-    0.840112,
-    0.841035,
-    0.84216,
-    0.843464,
-    0.844921,
-    0.8465,
-    0.848169,
-    0.849896,
-    0.851644,
-    0.85338,
-    0.85507,
-    0.856679,
-    0.858177,
-    0.859534,
-    0.860724,
-    0.861725,
-    0.862518,
-    0.863088,
-    0.863425,
-    0.863524,
-    0.863384,
-    0.863009,
-    0.862408,
-    0.861594,
-    0.860584,
-    0.8594,
-    0.858066,
-    0.856608,
-    0.855057,
-    0.853444,
-    0.851801,
-    0.850161,
-    0.848556,
-    0.847018,
-    0.845577,
-    0.844262,
-    0.843097,
-    0.842106,
-    0.841306,
-    0.840712,
-    0.840337,
-    0.840184,
-    0.840258,
-    0.840554,
-    0.841067,
-    0.841784,
-    0.842691,
-    0.843769,
-    0.844994,
-    0.846344,
-    0.847789,
-    0.849301,
-    0.85085,
-    0.852404,
-    0.853933,
-    0.855407,
-    0.856796,
-    0.858074,
-    0.859216,
-    0.860199,
-    0.861005,
-    0.861619,
-    0.862029,
-    0.862229,
-    0.862215,
-    0.861989,
-    0.861556,
-    0.860925,
-    0.860111,
-    0.859129,
-    0.858001,
-    0.856749,
-    0.855399,
-    0.853978,
-    0.852515,
-    0.851038,
-    0.849577,
-    0.848161,
-    0.846818,
-    0.845574,
-    0.844454,
-    0.843479,
-    0.842667,
-    0.842035,
-    0.841593,
-    0.841351,
-    0.841311,
-    0.841474,
-    0.841835,
-    0.842387,
-    0.843118,
-    0.844012,
-    0.845052,
-    0.846215,
-    0.847479,
-    0.848817,
-    0.850203,
-    0.85161,
-    0.853008,
-    0.854371,
-    0.855672,
-    0.856885,
-    0.857986,
-    0.858954,
-    0.85977,
-    0.860419,
-    0.860889,
-    0.861171,
-    0.861259,
-    0.861154,
-    0.860858,
-    0.860377,
-    0.859723,
-    0.858908,
-    0.857949,
-    0.856866,
-    0.855682,
-    0.854419,
-    0.853104,
-    0.851762,
-    0.85042,
-    0.849105,
-    0.847844,
-    0.846659,
-    0.845576,
-    0.844615,
-    0.843795,
-    0.84313,
-    0.842635,
-    0.842318,
-    0.842185,
-    0.842237,
-    0.842474,
-    0.842889,
-    0.843474,
-    0.844216,
-    0.8451,
-    0.846108,
-    0.84722,
-    0.848413,
-    0.849664,
-    0.850946,
-    0.852235,
-    0.853505,
-    0.854731,
-    0.855889,
-    0.856955,
-    0.85791,
-    0.858734,
-    0.859412,
-    0.85993,
-    0.86028,
-    0.860454,
-    0.86045,
-    0.860269,
-    0.859915,
-    0.859394,
-    0.85872,
-    0.857904,
-    0.856964,
-    0.855919,
-    0.854791,
-    0.853601,
-    0.852374,
-    0.851133,
-    0.849905,
-    0.848713,
-    0.84758,
-    0.846529,
-    0.84558,
-    0.844753,
-    0.844063,
-    0.843522,
-    0.843143,
-    0.84293,
-    0.842889,
-    0.84302,
-    0.843318,
-    0.843778,
-    0.844391,
-    0.845143,
-    0.846019,
-    0.847001,
-    0.848069,
-    0.849203,
-    0.850379,
-    0.851574,
-    0.852763,
-    0.853925,
-    0.855034,
-    0.85607,
-    0.857013,
-    0.857843,
-    0.858545,
-    0.859105,
-    0.859512,
-    0.85976,
-    0.859843,
-    0.85976,
-    0.859514,
-    0.859109,
-    0.858555,
-    0.857863,
-    0.857047,
-    0.856123,
-    0.85511,
-    0.854029,
-    0.852902,
-    0.85175,
-    0.850596,
-    0.849465,
-    0.848377,
-    0.847355,
-    0.846418,
-    0.845586,
-    0.844873,
-    0.844294,
-    0.843861,
-    0.843581,
-    0.843459,
-    0.843497,
-    0.843694,
-    0.844046,
-    0.844546,
-    0.845182,
-    0.845943,
-    0.846812,
-    0.847771,
-    0.848803,
-    0.849885,
-    0.850997,
-    0.852116,
-    0.85322,
-    0.854286,
-    0.855295,
-    0.856226,
-    0.857061,
-    0.857784,
-    0.858379,
-    0.858837,
-    0.859148,
-    0.859307,
-    0.85931,
-    0.859159,
-    0.858856,
-    0.858408,
-    0.857824,
-    0.857117,
-    0.8563,
-    0.855389,
-    0.854405,
-    0.853365,
-    0.852292,
-    0.851205,
-    0.850128,
-    0.849081,
-    0.848085,
-    0.847159,
-    0.846323,
-    0.845591,
-    0.844979,
-    0.844499,
-    0.844158,
-    0.843965,
-    0.843923,
-    0.844031,
-    0.844287,
-    0.844687,
-    0.845221,
-    0.845878,
-    0.846646,
-    0.847509,
-    0.848449,
-    0.849448,
-    0.850486,
-    0.851541,
-    0.852593,
-    0.853621,
-    0.854605,
-    0.855525,
-    0.856364,
-    0.857103,
-    0.857731,
-    0.858233,
-    0.8586,
-    0.858826,
-    0.858906,
-    0.858839,
-    0.858626,
-    0.858273,
-    0.857786,
-    0.857176,
-    0.856455,
-    0.855637,
-    0.854739,
-    0.853779,
-    0.852776,
-    0.85175,
-    0.850722,
-    0.849712,
-    0.84874,
-    0.847825,
-    0.846986,
-    0.846238,
-    0.845596,
-    0.845074,
-    0.844681,
-    0.844424,
-    0.844309,
-    0.844337,
-    0.844508,
-    0.844817,
-    0.845259,
-    0.845824,
-    0.846501,
-    0.847276,
-    0.848133,
-    0.849056,
-    0.850026,
-    0.851023,
-    0.852028,
-    0.853021,
-    0.853981,
-    0.854891,
-    0.855731,
-    0.856486,
-    0.857141,
-    0.857683,
-    0.8581,
-    0.858387,
-    0.858536,
-    0.858545,
-    0.858414,
-    0.858147,
-    0.857748,
-    0.857226,
-    0.856592,
-    0.855858,
-    0.855039,
-    0.854152,
-    0.853214,
-    0.852244,
-    0.851261,
-    0.850286,
-    0.849336,
-    0.848432,
-    0.847591,
-    0.846829,
-    0.846161,
-    0.845602,
-    0.84516,
-    0.844846,
-    0.844665,
-    0.84462,
-    0.844712,
-    0.84494,
-    0.845297,
-    0.845777,
-    0.846371,
-    0.847065,
-    0.847847,
-    0.8487,
-    0.849607,
-    0.85055,
-    0.851511,
-    0.852471,
-    0.853409,
-    0.854308,
-    0.85515,
-    0.855919,
-    0.856598,
-    0.857175,
-    0.857639,
-    0.85798,
-    0.858192,
-    0.858271,
-    0.858215,
-    0.858027,
-    0.857709,
-    0.857269,
-    0.856715,
-    0.856059,
-    0.855313,
-    0.854493,
-    0.853616,
-    0.852698,
-    0.851758,
-    0.850814,
-    0.849886,
-    0.848992,
-    0.84815,
-    0.847376,
-    0.846685,
-    0.846091,
-    0.845606,
-    0.845239,
-    0.844998,
-    0.844886,
-    0.844906,
-    0.845057,
-    0.845337,
-    0.845738,
-    0.846254,
-    0.846874,
-    0.847584,
-    0.848372,
-    0.849221,
-    0.850114,
-    0.851034,
-    0.851961,
-    0.852879,
-    0.853768,
-    0.85461,
-    0.85539,
-    0.856092,
-    0.856701,
-    0.857207,
-    0.857599,
-    0.857869,
-    0.858012,
-    0.858027,
-    0.857911,
-    0.857669,
-    0.857305,
-    0.856826,
-    0.856242,
-    0.855565,
-    0.854808,
-    0.853988,
-    0.853119,
-    0.852219,
-    0.851307,
-    0.8504,
-    0.849516,
-    0.848673,
-    0.847888,
-    0.847176,
-    0.846551,
-    0.846026,
-    0.84561,
-    0.845312,
-    0.845138,
-    0.845091,
-    0.845171,
-    0.845378,
-    0.845706,
-    0.846149,
-    0.846698,
-    0.847342,
-    0.848068,
-    0.848861,
-    0.849707,
-    0.850587,
-    0.851484,
-    0.852381,
-    0.853259,
-    0.854102,
-    0.854892,
-    0.855614,
-    0.856254,
-    0.856798,
-    0.857237,
-    0.857561,
-    0.857765,
-    0.857845,
-    0.857798,
-    0.857627,
-    0.857334,
-    0.856926,
-    0.856411,
-    0.855799,
-    0.855103,
-    0.854336,
-    0.853514,
-    0.852653,
-    0.85177,
-    0.850883,
-    0.85001,
-    0.849168,
-    0.848373,
-    0.847642,
-    0.846988,
-    0.846425,
-    0.845964,
-    0.845613,
-    0.845381,
-    0.84527,
-    0.845284,
-    0.845421,
-    0.845679,
-    0.846053,
-    0.846535,
-    0.847116,
-    0.847783,
-    0.848523,
-    0.849323,
-    0.850165,
-    0.851033,
-    0.851909,
-    0.852777,
-    0.853619,
-    0.854418,
-    0.855159,
-    0.855826,
-    0.856407,
-    0.85689,
-    0.857266,
-    0.857527,
-    0.857668,
-    0.857687,
-    0.857583,
-    0.857358,
-    0.857017,
-    0.856568,
-    0.856018,
-    0.85538,
-    0.854665,
-    0.853888,
-    0.853064,
-    0.852211,
-    0.851344,
-    0.850482,
-    0.849641,
-    0.848837,
-    0.848088,
-    0.847408,
-    0.846809,
-    0.846305,
-    0.845905,
-    0.845616,
-    0.845445,
-    0.845395,
-    0.845466,
-    0.845658,
-    0.845966,
-    0.846383,
-    0.846903,
-    0.847513,
-    0.848203,
-    0.848958,
-    0.849763,
-    0.850602,
-    0.851458,
-    0.852315,
-    0.853155,
-    0.853962,
-    0.85472,
-    0.855413,
-    0.856029,
-    0.856554,
-    0.856978,
-    0.857293,
-    0.857494,
-    0.857575,
-    0.857536,
-    0.857377,
-    0.857101,
-    0.856715,
-    0.856225,
-    0.855642,
-    0.854978,
-    0.854245,
-    0.853458,
-    0.852634,
-    0.851787,
-    0.850936,
-    0.850096,
-    0.849286,
-    0.84852,
-    0.847814,
-    0.847183,
-    0.846637,
-    0.846189,
-    0.845847,
-    0.845618,
-    0.845507,
-    0.845515,
-    0.845642,
-    0.845885,
-    0.846241,
-    0.846701,
-    0.847256,
-    0.847896,
-    0.848607,
-    0.849376,
-    0.850186,
-    0.851023,
-    0.851868,
-    0.852706,
-    0.85352,
-    0.854294,
-    0.855012,
-    0.85566,
-    0.856225,
-    0.856696,
-    0.857064,
-    0.857321,
-    0.857463,
-    0.857486,
-    0.85739,
-    0.857178,
-    0.856853,
-    0.856422,
-    0.855894,
-    0.855279,
-    0.85459,
-    0.853839,
-    0.853043,
-    0.852217,
-    0.851377,
-    0.85054,
-    0.849723,
-    0.848942,
-    0.848212,
-    0.847548,
-    0.846964,
-    0.84647,
-    0.846076,
-    0.845791,
-    0.84562,
-    0.845566,
-    0.84563,
-    0.845811,
-    0.846106,
-    0.846508,
-    0.847009,
-    0.8476,
-    0.848268,
-    0.849,
-    0.849782,
-    0.850598,
-    0.851432,
-    0.852268,
-    0.853088,
-    0.853876,
-    0.854617,
-    0.855296,
-    0.8559,
-    0.856417,
-    0.856835,
-    0.857148,
-    0.857348,
-    0.857433,
-    0.857399,
-    0.857249,
-    0.856985,
-    0.856612,
-    0.856137,
-    0.855571,
-    0.854925,
-    0.85421,
-    0.853442,
-    0.852637,
-    0.851809,
-    0.850975,
-    0.850152,
-    0.849357,
-    0.848604,
-    0.84791,
-    0.847287,
-    0.846749,
-    0.846305,
-    0.845965,
-    0.845736,
-    0.845621,
-    0.845624,
-    0.845743,
-    0.845978,
-    0.846322,
-    0.846769,
-    0.847311,
-    0.847936,
-    0.848633,
-    0.849386,
-    0.850182,
-    0.851003,
-    0.851835,
-    0.852661,
-    0.853463,
-    0.854226,
-    0.854936,
-    0.855577,
-    0.856138,
-    0.856606,
-    0.856973,
-    0.857231,
-    0.857376,
-    0.857404,
-    0.857315,
-    0.85711,
-    0.856795,
-    0.856374,
-    0.855857,
-    0.855253,
-    0.854575,
-    0.853836,
-    0.853051,
-    0.852235,
-    0.851406,
-    0.850578,
-    0.849769,
-    0.848994,
-    0.84827,
-    0.84761,
-    0.847028,
-    0.846535,
-    0.846142,
-    0.845854,
-    0.84568,
-    0.845621,
-    0.84568,
-    0.845854,
-    0.846142,
-    0.846535,
-    0.847028,
-    0.84761,
-    0.84827,
-    0.848994,
-    0.849769,
-    0.850578,
-    0.851406,
-    0.852235,
-    0.853051,
-    0.853836,
-    0.854575,
-    0.855253,
-    0.855857,
-    0.856374,
-    0.856795,
-    0.85711,
-    0.857315,
-    0.857404,
-    0.857376,
-    0.857231,
-    0.856973,
-    0.856606,
-    0.856138,
-    0.855577,
-    0.854936,
-    0.854226,
-    0.853463,
-    0.852661,
-    0.851835,
-    0.851003,
-    0.850182,
-    0.849386,
-    0.848633,
-    0.847936,
-    0.847311,
-    0.846769,
-    0.846322,
-    0.845978,
-    0.845743,
-    0.845624,
-    0.845621,
-    0.845736,
-    0.845965,
-    0.846305,
-    0.846749,
-    0.847287,
-    0.84791,
-    0.848604,
-    0.849357,
-    0.850152,
-    0.850975,
-    0.851809,
-    0.852637,
-    0.853442,
-    0.85421,
-    0.854925,
-    0.855571,
-    0.856137,
-    0.856612,
-    0.856985,
-    0.857249,
-    0.857399,
-    0.857433,
-    0.857348,
-    0.857148,
-    0.856835,
-    0.856417,
-    0.8559,
-    0.855296,
-    0.854617,
-    0.853876,
-    0.853088,
-    0.852268,
-    0.851432,
-    0.850598,
-    0.849782,
-    0.849,
-    0.848268,
-    0.8476,
-    0.847009,
-    0.846508,
-    0.846106,
-    0.845811,
-    0.84563,
-    0.845566,
-    0.84562,
-    0.845791,
-    0.846076,
-    0.84647,
-    0.846964,
-    0.847548,
-    0.848212,
-    0.848942,
-    0.849723,
-    0.85054,
-    0.851377,
-    0.852217,
-    0.853043,
-    0.853839,
-    0.85459,
-    0.855279,
-    0.855894,
-    0.856422,
-    0.856853,
-    0.857178,
-    0.85739,
-    0.857486,
-    0.857463,
-    0.857321,
-    0.857064,
-    0.856696,
-    0.856225,
-    0.85566,
-    0.855012,
-    0.854294,
-    0.85352,
-    0.852706,
-    0.851868,
-    0.851023,
-    0.850186,
-    0.849376,
-    0.848607,
-    0.847896,
-    0.847256,
-    0.846701,
-    0.846241,
-    0.845885,
-    0.845642,
-    0.845515,
-    0.845507,
-    0.845618,
-    0.845847,
-    0.846189,
-    0.846637,
-    0.847183,
-    0.847814,
-    0.84852,
-    0.849286,
-    0.850096,
-    0.850936,
-    0.851787,
-    0.852634,
-    0.853458,
-    0.854245,
-    0.854978,
-    0.855642,
-    0.856225,
-    0.856715,
-    0.857101,
-    0.857377,
-    0.857536,
-    0.857575,
-    0.857494,
-    0.857293,
-    0.856978,
-    0.856554,
-    0.856029,
-    0.855413,
-    0.85472,
-    0.853962,
-    0.853155,
-    0.852315,
-    0.851458,
-    0.850602,
-    0.849763,
-    0.848958,
-    0.848203,
-    0.847513,
-    0.846903,
-    0.846383,
-    0.845966,
-    0.845658,
-    0.845466,
-    0.845395,
-    0.845445,
-    0.845616,
-    0.845905,
-    0.846305,
-    0.846809,
-    0.847408,
-    0.848088,
-    0.848837,
-    0.849641,
-    0.850482,
-    0.851344,
-    0.852211,
-    0.853064,
-    0.853888,
-    0.854665,
-    0.85538,
-    0.856018,
-    0.856568,
-    0.857017,
-    0.857358,
-    0.857583,
-    0.857687,
-    0.857668,
-    0.857527,
-    0.857266,
-    0.85689,
-    0.856407,
-    0.855826,
-    0.855159,
-    0.854418,
-    0.853619,
-    0.852777,
-    0.851909,
-    0.851033,
-    0.850165,
-    0.849323,
-    0.848523,
-    0.847783,
-    0.847116,
-    0.846535,
-    0.846053,
-    0.845679,
-    0.845421,
-    0.845284,
-    0.84527,
-    0.845381,
-    0.845613,
-    0.845964,
-    0.846425,
-    0.846988,
-    0.847642,
-    0.848373,
-    0.849168,
-    0.85001,
-    0.850883,
-    0.85177,
-    0.852653,
-    0.853514,
-    0.854336,
-    0.855103,
-    0.855799,
-    0.856411,
-    0.856926,
-    0.857334,
-    0.857627,
-    0.857798,
-    0.857845,
-    0.857765,
-    0.857561,
-    0.857237,
-    0.856798,
-    0.856254,
-    0.855614,
-    0.854892,
-    0.854102,
-    0.853259,
-    0.852381,
-    0.851484,
-    0.850587,
-    0.849707,
-    0.848861,
-    0.848068,
-    0.847342,
-    0.846698,
-    0.846149,
-    0.845706,
-    0.845378,
-    0.845171,
-    0.845091,
-    0.845138,
-    0.845312,
-    0.84561,
-    0.846026,
-    0.846551,
-    0.847176,
-    0.847888,
-    0.848673,
-    0.849516,
-    0.8504,
-    0.851307,
-    0.852219,
-    0.853119,
-    0.853988,
-    0.854808,
-    0.855565,
-    0.856242,
-    0.856826,
-    0.857305,
-    0.857669,
-    0.857911,
-    0.858027,
-    0.858012,
-    0.857869,
-    0.857599,
-    0.857207,
-    0.856701,
-    0.856092,
-    0.85539,
-    0.85461,
-    0.853768,
-    0.852879,
-    0.851961,
-    0.851034,
-    0.850114,
-    0.849221,
-    0.848372,
-    0.847584,
-    0.846874,
-    0.846254,
-    0.845738,
-    0.845337,
-    0.845057,
-    0.844906,
-    0.844886,
-    0.844998,
-    0.845239,
-    0.845606,
-    0.846091,
-    0.846685,
-    0.847376,
-    0.84815,
-    0.848992,
-    0.849886,
-    0.850814,
-    0.851758,
-    0.852698,
-    0.853616,
-    0.854493,
-    0.855313,
-    0.856059,
-    0.856715,
-    0.857269,
-    0.857709,
-    0.858027,
-    0.858215,
-    0.858271,
-    0.858192,
-    0.85798,
-    0.857639,
-    0.857175,
-    0.856598,
-    0.855919,
-    0.85515,
-    0.854308,
-    0.853409,
-    0.852471,
-    0.851511,
-    0.85055,
-    0.849607,
-    0.8487,
-    0.847847,
-    0.847065,
-    0.846371,
-    0.845777,
-    0.845297,
-    0.84494,
-    0.844712,
-    0.84462,
-    0.844665,
-    0.844846,
-    0.84516,
-    0.845602,
-    0.846161,
-    0.846829,
-    0.847591,
-    0.848432,
-    0.849336,
-    0.850286,
-    0.851261,
-    0.852244,
-    0.853214,
-    0.854152,
-    0.855039,
-    0.855858,
-    0.856592,
-    0.857226,
-    0.857748,
-    0.858147,
-    0.858414,
-    0.858545,
-    0.858536,
-    0.858387,
-    0.8581,
-    0.857683,
-    0.857141,
-    0.856486,
-    0.855731,
-    0.854891,
-    0.853981,
-    0.853021,
-    0.852028,
-    0.851023,
-    0.850026,
-    0.849056,
-    0.848133,
-    0.847276,
-    0.846501,
-    0.845824,
-    0.845259,
-    0.844817,
-    0.844508,
-    0.844337,
-    0.844309,
-    0.844424,
-    0.844681,
-    0.845074,
-    0.845596,
-    0.846238,
-    0.846986,
-    0.847825,
-    0.84874,
-    0.849712,
-    0.850722,
-    0.85175,
-    0.852776,
-    0.853779,
-    0.854739,
-    0.855637,
-    0.856455,
-    0.857176,
-    0.857786,
-    0.858273,
-    0.858626,
-    0.858839,
-    0.858906,
-    0.858826,
-    0.8586,
-    0.858233,
-    0.857731,
-    0.857103,
-    0.856364,
-    0.855525,
-    0.854605,
-    0.853621,
-    0.852593,
-    0.851541,
-    0.850486,
-    0.849448,
-    0.848449,
-    0.847509,
-    0.846646,
-    0.845878,
-    0.845221,
-    0.844687,
-    0.844287,
-    0.844031,
-    0.843923,
-    0.843965,
-    0.844158,
-    0.844499,
-    0.844979,
-    0.845591,
-    0.846323,
-    0.847159,
-    0.848085,
-    0.849081,
-    0.850128,
-    0.851205,
-    0.852292,
-    0.853365,
-    0.854405,
-    0.855389,
-    0.8563,
-    0.857117,
-    0.857824,
-    0.858408,
-    0.858856,
-    0.859159,
-    0.85931,
-    0.859307,
-    0.859148,
-    0.858837,
-    0.858379,
-    0.857784,
-    0.857061,
-    0.856226,
-    0.855295,
-    0.854286,
-    0.85322,
-    0.852116,
-    0.850997,
-    0.849885,
-    0.848803,
-    0.847771,
-    0.846812,
-    0.845943,
-    0.845182,
-    0.844546,
-    0.844046,
-    0.843694,
-    0.843497,
-    0.843459,
-    0.843581,
-    0.843861,
-    0.844294,
-    0.844873,
-    0.845586,
-    0.846418,
-    0.847355,
-    0.848377,
-    0.849465,
-    0.850596,
-    0.85175,
-    0.852902,
-    0.854029,
-    0.85511,
-    0.856123,
-    0.857047,
-    0.857863,
-    0.858555,
-    0.859109,
-    0.859514,
-    0.85976,
-    0.859843,
-    0.85976,
-    0.859512,
-    0.859105,
-    0.858545,
-    0.857843,
-    0.857013,
-    0.85607,
-    0.855034,
-    0.853925,
-    0.852763,
-    0.851574,
-    0.850379,
-    0.849203,
-    0.848069,
-    0.847001,
-    0.846019,
-    0.845143,
-    0.844391,
-    0.843778,
-    0.843318,
-    0.84302,
-    0.842889,
-    0.84293,
-    0.843143,
-    0.843522,
-    0.844063,
-    0.844753,
-    0.84558,
-    0.846529,
-    0.84758,
-    0.848713,
-    0.849905,
-    0.851133,
-    0.852374,
-    0.853601,
-    0.854791,
-    0.855919,
-    0.856964,
-    0.857904,
-    0.85872,
-    0.859394,
-    0.859915,
-    0.860269,
-    0.86045,
-    0.860454,
-    0.86028,
-    0.85993,
-    0.859412,
-    0.858734,
-    0.85791,
-    0.856955,
-    0.855889,
-    0.854731,
-    0.853505,
-    0.852235,
-    0.850946,
-    0.849664,
-    0.848413,
-    0.84722,
-    0.846108,
-    0.8451,
-    0.844216,
-    0.843474,
-    0.842889,
-    0.842474,
-    0.842237,
-    0.842185,
-    0.842318,
-    0.842635,
-    0.84313,
-    0.843795,
-    0.844615,
-    0.845576,
-    0.846659,
-    0.847844,
-    0.849105,
-    0.85042,
-    0.851762,
-    0.853104,
-    0.854419,
-    0.855682,
-    0.856866,
-    0.857949,
-    0.858908,
-    0.859723,
-    0.860377,
-    0.860858,
-    0.861154,
-    0.861259,
-    0.861171,
-    0.860889,
-    0.860419,
-    0.85977,
-    0.858954,
-    0.857986,
-    0.856885,
-    0.855672,
-    0.854371,
-    0.853008,
-    0.85161,
-    0.850203,
-    0.848817,
-    0.847479,
-    0.846215,
-    0.845052,
-    0.844012,
-    0.843118,
-    0.842387,
-    0.841835,
-    0.841474,
-    0.841311,
-    0.841351,
-    0.841593,
-    0.842035,
-    0.842667,
-    0.843479,
-    0.844454,
-    0.845574,
-    0.846818,
-    0.848161,
-    0.849577,
-    0.851038,
-    0.852515,
-    0.853978,
-    0.855399,
-    0.856749,
-    0.858001,
-    0.859129,
-    0.860111,
-    0.860925,
-    0.861556,
-    0.861989,
-    0.862215,
-    0.862229,
-    0.862029,
-    0.861619,
-    0.861005,
-    0.860199,
-    0.859216,
-    0.858074,
-    0.856796,
-    0.855407,
-    0.853933,
-    0.852404,
-    0.85085,
-    0.849301,
-    0.847789,
-    0.846344,
-    0.844994,
-    0.843769,
-    0.842691,
-    0.841784,
-    0.841067,
-    0.840554,
-    0.840258,
-    0.840184,
-    0.840337,
-    0.840712,
-    0.841306,
-    0.842106,
-    0.843097,
-    0.844262,
-    0.845577,
-    0.847018,
-    0.848556,
-    0.850161,
-    0.851801,
-    0.853444,
-    0.855057,
-    0.856608,
-    0.858066,
-    0.8594,
-    0.860584,
-    0.861594,
-    0.862408,
-    0.863009,
-    0.863384,
-    0.863524,
-    0.863425,
-    0.863088,
-    0.862518,
-    0.861725,
-    0.860724,
-    0.859534,
-    0.858177,
-    0.856679,
-    0.85507,
-    0.85338,
-    0.851644,
-    0.849896,
-    0.848169,
-    0.8465,
-    0.844921,
-    0.843464,
-    0.84216,
-    0.841035,
-    0.840112,
-    0.839411,
-    0.838948,
-    0.838733,
-    0.838772,
-    0.839066,
-    0.839609,
-    0.840394,
-    0.841405,
-    0.842624,
-    0.844028,
-    0.84559,
-    0.84728,
-    0.849065,
-    0.850909,
-    0.852777,
-    0.854631,
-    0.856435,
-    0.858151,
-    0.859746,
-    0.861186,
-    0.862443,
-    0.863489,
-    0.864302,
-    0.864866,
-    0.865166,
-    0.865196,
-    0.864952,
-    0.864439,
-    0.863664,
-    0.862641,
-    0.861389,
-    0.859932,
-    0.858297,
-    0.856516,
-    0.854622,
-    0.852654,
-    0.85065,
-    0.84865,
-    0.846693,
-    0.844819,
-    0.843066,
-    0.841469,
-    0.840063,
-    0.838875,
-    0.837931,
-    0.837253,
-    0.836854,
-    0.836746,
-    0.836931,
-    0.83741,
-    0.838174,
-    0.839209,
-    0.840498,
-    0.842017,
-    0.843736,
-    0.845623,
-    0.847642,
-    0.849753,
-    0.851915,
-    0.854085,
-    0.856219,
-    0.858276,
-    0.860213,
-    0.86199,
-    0.863572,
-    0.864924,
-    0.866019,
-    0.866832,
-    0.867345,
-    0.867546,
-    0.867427,
-    0.86699,
-    0.86624,
-    0.865189,
-    0.863856,
-    0.862266,
-    0.860448,
-    0.858437,
-    0.856272,
-    0.853993,
-    0.851646,
-    0.849278,
-    0.846934,
-    0.844663,
-    0.84251,
-    0.840519,
-    0.838731,
-    0.837184,
-    0.83591,
-    0.834938,
-    0.834289,
-    0.833979,
-    0.834017,
-    0.834406,
-    0.83514,
-    0.836209,
-    0.837593,
-    0.839267,
-    0.841202,
-    0.843361,
-    0.845702,
-    0.84818,
-    0.850748,
-    0.853355,
-    0.855948,
-    0.858477,
-    0.860889,
-    0.863136,
-    0.865172,
-    0.866953,
-    0.868442,
-    0.869606,
-    0.870419,
-    0.870861,
-    0.87092,
-    0.87059,
-    0.869876,
-    0.868786,
-    0.86734,
-    0.865562,
-    0.863485,
-    0.861148,
-    0.858594,
-    0.855872,
-    0.853035,
-    0.850138,
-    0.847239,
-    0.844396,
-    0.841665,
-    0.839104,
-    0.836764,
-    0.834695,
-    0.832941,
-    0.831541,
-    0.830526,
-    0.829921,
-    0.829742,
-    0.829998,
-    0.830688,
-    0.831803,
-    0.833327,
-    0.835232,
-    0.837485,
-    0.840046,
-    0.842866,
-    0.845892,
-    0.849066,
-    0.852325,
-    0.855607,
-    0.858846,
-    0.861976,
-    0.864933,
-    0.867656,
-    0.870089,
-    0.872177,
-    0.873877,
-    0.875148,
-    0.875961,
-    0.876293,
-    0.87613,
-    0.875472,
-    0.874323,
-    0.872702,
-    0.870633,
-    0.868154,
-    0.865307,
-    0.862145,
-    0.858728,
-    0.855119,
-    0.85139,
-    0.847612,
-    0.843861,
-    0.840212,
-    0.83674,
-    0.833516,
-    0.830609,
-    0.828082,
-    0.82599,
-    0.824382,
-    0.823296,
-    0.822763,
-    0.822801,
-    0.823418,
-    0.82461,
-    0.826362,
-    0.828647,
-    0.831429,
-    0.834658,
-    0.838277,
-    0.842219,
-    0.846412,
-    0.850775,
-    0.855222,
-    0.859667,
-    0.86402,
-    0.868192,
-    0.872098,
-    0.875653,
-    0.878781,
-    0.881412,
-    0.883484,
-    0.884946,
-    0.885758,
-    0.885892,
-    0.885334,
-    0.884081,
-    0.882147,
-    0.879558,
-    0.876353,
-    0.872586,
-    0.86832,
-    0.863633,
-    0.85861,
-    0.853346,
-    0.84794,
-    0.8425,
-    0.837134,
-    0.83195,
-    0.827058,
-    0.82256,
-    0.818556,
-    0.815137,
-    0.812384,
-    0.810367,
-    0.809142,
-    0.808752,
-    0.809223,
-    0.810566,
-    0.812773,
-    0.81582,
-    0.819666,
-    0.824251,
-    0.829503,
-    0.835331,
-    0.841633,
-    0.848293,
-    0.855186,
-    0.862179,
-    0.869135,
-    0.875912,
-    0.882369,
-    0.888366,
-    0.893772,
-    0.898459,
-    0.902314,
-    0.905234,
-    0.907134,
-    0.907945,
-    0.907618,
-    0.906126,
-    0.903461,
-    0.899642,
-    0.894708,
-    0.888724,
-    0.881775,
-    0.873969,
-    0.865436,
-    0.856322,
-    0.846791,
-    0.837022,
-    0.827204,
-    0.817532,
-    0.80821,
-    0.799439,
-    0.79142,
-    0.784344,
-    0.778395,
-    0.77374,
-    0.77053,
-    0.768894,
-    0.768934,
-    0.770728,
-    0.774322,
-    0.779727,
-    0.786925,
-    0.795859,
-    0.806436,
-    0.818529,
-    0.831973,
-    0.84657,
-    0.862087,
-    0.878262,
-    0.894803,
-    0.911395,
-    0.927701,
-    0.943365,
-    0.95802,
-    0.971291,
-    0.982799,
-    0.992169,
-    0.999032,
-    1.00303,
-    1.00383,
-    1.00112,
-    0.994602,
-    0.984032,
-    0.96919,
-    0.9499,
-    0.926031,
-    0.897494,
-    0.864255,
-    0.826324,
-    0.783767,
-    0.736697,
-    0.68528,
-    0.629731,
-    0.570311,
-    0.507326,
-    0.441125,
-    0.372092,
-    0.300647,
-    0.227236,
-    0.152331,
-    0.0764185,
-    0,
-    -0.0764185,
-    -0.152331,
-    -0.227236,
-    -0.300647,
-    -0.372092,
-    -0.441125,
-    -0.507326,
-    -0.570311,
-    -0.629731,
-    -0.68528,
-    -0.736697,
-    -0.783767,
-    -0.826324,
-    -0.864255,
-    -0.897494,
-    -0.926031,
-    -0.9499,
-    -0.96919,
-    -0.984032,
-    -0.994602,
-    -1.00112,
-    -1.00383,
-    -1.00303,
-    -0.999032,
-    -0.992169,
-    -0.982799,
-    -0.971291,
-    -0.95802,
-    -0.943365,
-    -0.927701,
-    -0.911395,
-    -0.894803,
-    -0.878262,
-    -0.862087,
-    -0.84657,
-    -0.831973,
-    -0.818529,
-    -0.806436,
-    -0.795859,
-    -0.786925,
-    -0.779727,
-    -0.774322,
-    -0.770728,
-    -0.768934,
-    -0.768894,
-    -0.77053,
-    -0.77374,
-    -0.778395,
-    -0.784344,
-    -0.79142,
-    -0.799439,
-    -0.80821,
-    -0.817532,
-    -0.827204,
-    -0.837022,
-    -0.846791,
-    -0.856322,
-    -0.865436,
-    -0.873969,
-    -0.881775,
-    -0.888724,
-    -0.894708,
-    -0.899642,
-    -0.903461,
-    -0.906126,
-    -0.907618,
-    -0.907945,
-    -0.907134,
-    -0.905234,
-    -0.902314,
-    -0.898459,
-    -0.893772,
-    -0.888366,
-    -0.882369,
-    -0.875912,
-    -0.869135,
-    -0.862179,
-    -0.855186,
-    -0.848293,
-    -0.841633,
-    -0.835331,
-    -0.829503,
-    -0.824251,
-    -0.819666,
-    -0.81582,
-    -0.812773,
-    -0.810566,
-    -0.809223,
-    -0.808752,
-    -0.809142,
-    -0.810367,
-    -0.812384,
-    -0.815137,
-    -0.818556,
-    -0.82256,
-    -0.827058,
-    -0.83195,
-    -0.837134,
-    -0.8425,
-    -0.84794,
-    -0.853346,
-    -0.85861,
-    -0.863633,
-    -0.86832,
-    -0.872586,
-    -0.876353,
-    -0.879558,
-    -0.882147,
-    -0.884081,
-    -0.885334,
-    -0.885892,
-    -0.885758,
-    -0.884946,
-    -0.883484,
-    -0.881412,
-    -0.878781,
-    -0.875653,
-    -0.872098,
-    -0.868192,
-    -0.86402,
-    -0.859667,
-    -0.855222,
-    -0.850775,
-    -0.846412,
-    -0.842219,
-    -0.838277,
-    -0.834658,
-    -0.831429,
-    -0.828647,
-    -0.826362,
-    -0.82461,
-    -0.823418,
-    -0.822801,
-    -0.822763,
-    -0.823296,
-    -0.824382,
-    -0.82599,
-    -0.828082,
-    -0.830609,
-    -0.833516,
-    -0.83674,
-    -0.840212,
-    -0.843861,
-    -0.847612,
-    -0.85139,
-    -0.855119,
-    -0.858728,
-    -0.862145,
-    -0.865307,
-    -0.868154,
-    -0.870633,
-    -0.872702,
-    -0.874323,
-    -0.875472,
-    -0.87613,
-    -0.876293,
-    -0.875961,
-    -0.875148,
-    -0.873877,
-    -0.872177,
-    -0.870089,
-    -0.867656,
-    -0.864933,
-    -0.861976,
-    -0.858846,
-    -0.855607,
-    -0.852325,
-    -0.849066,
-    -0.845892,
-    -0.842866,
-    -0.840046,
-    -0.837485,
-    -0.835232,
-    -0.833327,
-    -0.831803,
-    -0.830688,
-    -0.829998,
-    -0.829742,
-    -0.829921,
-    -0.830526,
-    -0.831541,
-    -0.832941,
-    -0.834695,
-    -0.836764,
-    -0.839104,
-    -0.841665,
-    -0.844396,
-    -0.847239,
-    -0.850138,
-    -0.853035,
-    -0.855872,
-    -0.858594,
-    -0.861148,
-    -0.863485,
-    -0.865562,
-    -0.86734,
-    -0.868786,
-    -0.869876,
-    -0.87059,
-    -0.87092,
-    -0.870861,
-    -0.870419,
-    -0.869606,
-    -0.868442,
-    -0.866953,
-    -0.865172,
-    -0.863136,
-    -0.860889,
-    -0.858477,
-    -0.855948,
-    -0.853355,
-    -0.850748,
-    -0.84818,
-    -0.845702,
-    -0.843361,
-    -0.841202,
-    -0.839267,
-    -0.837593,
-    -0.836209,
-    -0.83514,
-    -0.834406,
-    -0.834017,
-    -0.833979,
-    -0.834289,
-    -0.834938,
-    -0.83591,
-    -0.837184,
-    -0.838731,
-    -0.840519,
-    -0.84251,
-    -0.844663,
-    -0.846934,
-    -0.849278,
-    -0.851646,
-    -0.853993,
-    -0.856272,
-    -0.858437,
-    -0.860448,
-    -0.862266,
-    -0.863856,
-    -0.865189,
-    -0.86624,
-    -0.86699,
-    -0.867427,
-    -0.867546,
-    -0.867345,
-    -0.866832,
-    -0.866019,
-    -0.864924,
-    -0.863572,
-    -0.86199,
-    -0.860213,
-    -0.858276,
-    -0.856219,
-    -0.854085,
-    -0.851915,
-    -0.849753,
-    -0.847642,
-    -0.845623,
-    -0.843736,
-    -0.842017,
-    -0.840498,
-    -0.839209,
-    -0.838174,
-    -0.83741,
-    -0.836931,
-    -0.836746,
-    -0.836854,
-    -0.837253,
-    -0.837931,
-    -0.838875,
-    -0.840063,
-    -0.841469,
-    -0.843066,
-    -0.844819,
-    -0.846693,
-    -0.84865,
-    -0.85065,
-    -0.852654,
-    -0.854622,
-    -0.856516,
-    -0.858297,
-    -0.859932,
-    -0.861389,
-    -0.862641,
-    -0.863664,
-    -0.864439,
-    -0.864952,
-    -0.865196,
-    -0.865166,
-    -0.864866,
-    -0.864302,
-    -0.863489,
-    -0.862443,
-    -0.861186,
-    -0.859746,
-    -0.858151,
-    -0.856435,
-    -0.854631,
-    -0.852777,
-    -0.850909,
-    -0.849065,
-    -0.84728,
-    -0.84559,
-    -0.844028,
-    -0.842624,
-    -0.841405,
-    -0.840394,
-    -0.839609,
-    -0.839066,
-    -0.838772,
-    -0.838733,
-    -0.838948,
-    -0.839411,
-    -0.840112,
-    -0.841035,
-    -0.84216,
-    -0.843464,
-    -0.844921,
-    -0.8465,
-    -0.848169,
-    -0.849896,
-    -0.851644,
-    -0.85338,
-    -0.85507,
-    -0.856679,
-    -0.858177,
-    -0.859534,
-    -0.860724,
-    -0.861725,
-    -0.862518,
-    -0.863088,
-    -0.863425,
-    -0.863524,
-    -0.863384,
-    -0.863009,
-    -0.862408,
-    -0.861594,
-    -0.860584,
-    -0.8594,
-    -0.858066,
-    -0.856608,
-    -0.855057,
-    -0.853444,
-    -0.851801,
-    -0.850161,
-    -0.848556,
-    -0.847018,
-    -0.845577,
-    -0.844262,
-    -0.843097,
-    -0.842106,
-    -0.841306,
-    -0.840712,
-    -0.840337,
-    -0.840184,
-    -0.840258,
-    -0.840554,
-    -0.841067,
-    -0.841784,
-    -0.842691,
-    -0.843769,
-    -0.844994,
-    -0.846344,
-    -0.847789,
-    -0.849301,
-    -0.85085,
-    -0.852404,
-    -0.853933,
-    -0.855407,
-    -0.856796,
-    -0.858074,
-    -0.859216,
-    -0.860199,
-    -0.861005,
-    -0.861619,
-    -0.862029,
-    -0.862229,
-    -0.862215,
-    -0.861989,
-    -0.861556,
-    -0.860925,
-    -0.860111,
-    -0.859129,
-    -0.858001,
-    -0.856749,
-    -0.855399,
-    -0.853978,
-    -0.852515,
-    -0.851038,
-    -0.849577,
-    -0.848161,
-    -0.846818,
-    -0.845574,
-    -0.844454,
-    -0.843479,
-    -0.842667,
-    -0.842035,
-    -0.841593,
-    -0.841351,
-    -0.841311,
-    -0.841474,
-    -0.841835,
-    -0.842387,
-    -0.843118,
-    -0.844012,
-    -0.845052,
-    -0.846215,
-    -0.847479,
-    -0.848817,
-    -0.850203,
-    -0.85161,
-    -0.853008,
-    -0.854371,
-    -0.855672,
-    -0.856885,
-    -0.857986,
-    -0.858954,
-    -0.85977,
-    -0.860419,
-    -0.860889,
-    -0.861171,
-    -0.861259,
-    -0.861154,
-    -0.860858,
-    -0.860377,
-    -0.859723,
-    -0.858908,
-    -0.857949,
-    -0.856866,
-    -0.855682,
-    -0.854419,
-    -0.853104,
-    -0.851762,
-    -0.85042,
-    -0.849105,
-    -0.847844,
-    -0.846659,
-    -0.845576,
-    -0.844615,
-    -0.843795,
-    -0.84313,
-    -0.842635,
-    -0.842318,
-    -0.842185,
-    -0.842237,
-    -0.842474,
-    -0.842889,
-    -0.843474,
-    -0.844216,
-    -0.8451,
-    -0.846108,
-    -0.84722,
-    -0.848413,
-    -0.849664,
-    -0.850946,
-    -0.852235,
-    -0.853505,
-    -0.854731,
-    -0.855889,
-    -0.856955,
-    -0.85791,
-    -0.858734,
-    -0.859412,
-    -0.85993,
-    -0.86028,
-    -0.860454,
-    -0.86045,
-    -0.860269,
-    -0.859915,
-    -0.859394,
-    -0.85872,
-    -0.857904,
-    -0.856964,
-    -0.855919,
-    -0.854791,
-    -0.853601,
-    -0.852374,
-    -0.851133,
-    -0.849905,
-    -0.848713,
-    -0.84758,
-    -0.846529,
-    -0.84558,
-    -0.844753,
-    -0.844063,
-    -0.843522,
-    -0.843143,
-    -0.84293,
-    -0.842889,
-    -0.84302,
-    -0.843318,
-    -0.843778,
-    -0.844391,
-    -0.845143,
-    -0.846019,
-    -0.847001,
-    -0.848069,
-    -0.849203,
-    -0.850379,
-    -0.851574,
-    -0.852763,
-    -0.853925,
-    -0.855034,
-    -0.85607,
-    -0.857013,
-    -0.857843,
-    -0.858545,
-    -0.859105,
-    -0.859512,
-    -0.85976,
-    -0.859843,
-    -0.85976,
-    -0.859514,
-    -0.859109,
-    -0.858555,
-    -0.857863,
-    -0.857047,
-    -0.856123,
-    -0.85511,
-    -0.854029,
-    -0.852902,
-    -0.85175,
-    -0.850596,
-    -0.849465,
-    -0.848377,
-    -0.847355,
-    -0.846418,
-    -0.845586,
-    -0.844873,
-    -0.844294,
-    -0.843861,
-    -0.843581,
-    -0.843459,
-    -0.843497,
-    -0.843694,
-    -0.844046,
-    -0.844546,
-    -0.845182,
-    -0.845943,
-    -0.846812,
-    -0.847771,
-    -0.848803,
-    -0.849885,
-    -0.850997,
-    -0.852116,
-    -0.85322,
-    -0.854286,
-    -0.855295,
-    -0.856226,
-    -0.857061,
-    -0.857784,
-    -0.858379,
-    -0.858837,
-    -0.859148,
-    -0.859307,
-    -0.85931,
-    -0.859159,
-    -0.858856,
-    -0.858408,
-    -0.857824,
-    -0.857117,
-    -0.8563,
-    -0.855389,
-    -0.854405,
-    -0.853365,
-    -0.852292,
-    -0.851205,
-    -0.850128,
-    -0.849081,
-    -0.848085,
-    -0.847159,
-    -0.846323,
-    -0.845591,
-    -0.844979,
-    -0.844499,
-    -0.844158,
-    -0.843965,
-    -0.843923,
-    -0.844031,
-    -0.844287,
-    -0.844687,
-    -0.845221,
-    -0.845878,
-    -0.846646,
-    -0.847509,
-    -0.848449,
-    -0.849448,
-    -0.850486,
-    -0.851541,
-    -0.852593,
-    -0.853621,
-    -0.854605,
-    -0.855525,
-    -0.856364,
-    -0.857103,
-    -0.857731,
-    -0.858233,
-    -0.8586,
-    -0.858826,
-    -0.858906,
-    -0.858839,
-    -0.858626,
-    -0.858273,
-    -0.857786,
-    -0.857176,
-    -0.856455,
-    -0.855637,
-    -0.854739,
-    -0.853779,
-    -0.852776,
-    -0.85175,
-    -0.850722,
-    -0.849712,
-    -0.84874,
-    -0.847825,
-    -0.846986,
-    -0.846238,
-    -0.845596,
-    -0.845074,
-    -0.844681,
-    -0.844424,
-    -0.844309,
-    -0.844337,
-    -0.844508,
-    -0.844817,
-    -0.845259,
-    -0.845824,
-    -0.846501,
-    -0.847276,
-    -0.848133,
-    -0.849056,
-    -0.850026,
-    -0.851023,
-    -0.852028,
-    -0.853021,
-    -0.853981,
-    -0.854891,
-    -0.855731,
-    -0.856486,
-    -0.857141,
-    -0.857683,
-    -0.8581,
-    -0.858387,
-    -0.858536,
-    -0.858545,
-    -0.858414,
-    -0.858147,
-    -0.857748,
-    -0.857226,
-    -0.856592,
-    -0.855858,
-    -0.855039,
-    -0.854152,
-    -0.853214,
-    -0.852244,
-    -0.851261,
-    -0.850286,
-    -0.849336,
-    -0.848432,
-    -0.847591,
-    -0.846829,
-    -0.846161,
-    -0.845602,
-    -0.84516,
-    -0.844846,
-    -0.844665,
-    -0.84462,
-    -0.844712,
-    -0.84494,
-    -0.845297,
-    -0.845777,
-    -0.846371,
-    -0.847065,
-    -0.847847,
-    -0.8487,
-    -0.849607,
-    -0.85055,
-    -0.851511,
-    -0.852471,
-    -0.853409,
-    -0.854308,
-    -0.85515,
-    -0.855919,
-    -0.856598,
-    -0.857175,
-    -0.857639,
-    -0.85798,
-    -0.858192,
-    -0.858271,
-    -0.858215,
-    -0.858027,
-    -0.857709,
-    -0.857269,
-    -0.856715,
-    -0.856059,
-    -0.855313,
-    -0.854493,
-    -0.853616,
-    -0.852698,
-    -0.851758,
-    -0.850814,
-    -0.849886,
-    -0.848992,
-    -0.84815,
-    -0.847376,
-    -0.846685,
-    -0.846091,
-    -0.845606,
-    -0.845239,
-    -0.844998,
-    -0.844886,
-    -0.844906,
-    -0.845057,
-    -0.845337,
-    -0.845738,
-    -0.846254,
-    -0.846874,
-    -0.847584,
-    -0.848372,
-    -0.849221,
-    -0.850114,
-    -0.851034,
-    -0.851961,
-    -0.852879,
-    -0.853768,
-    -0.85461,
-    -0.85539,
-    -0.856092,
-    -0.856701,
-    -0.857207,
-    -0.857599,
-    -0.857869,
-    -0.858012,
-    -0.858027,
-    -0.857911,
-    -0.857669,
-    -0.857305,
-    -0.856826,
-    -0.856242,
-    -0.855565,
-    -0.854808,
-    -0.853988,
-    -0.853119,
-    -0.852219,
-    -0.851307,
-    -0.8504,
-    -0.849516,
-    -0.848673,
-    -0.847888,
-    -0.847176,
-    -0.846551,
-    -0.846026,
-    -0.84561,
-    -0.845312,
-    -0.845138,
-    -0.845091,
-    -0.845171,
-    -0.845378,
-    -0.845706,
-    -0.846149,
-    -0.846698,
-    -0.847342,
-    -0.848068,
-    -0.848861,
-    -0.849707,
-    -0.850587,
-    -0.851484,
-    -0.852381,
-    -0.853259,
-    -0.854102,
-    -0.854892,
-    -0.855614,
-    -0.856254,
-    -0.856798,
-    -0.857237,
-    -0.857561,
-    -0.857765,
-    -0.857845,
-    -0.857798,
-    -0.857627,
-    -0.857334,
-    -0.856926,
-    -0.856411,
-    -0.855799,
-    -0.855103,
-    -0.854336,
-    -0.853514,
-    -0.852653,
-    -0.85177,
-    -0.850883,
-    -0.85001,
-    -0.849168,
-    -0.848373,
-    -0.847642,
-    -0.846988,
-    -0.846425,
-    -0.845964,
-    -0.845613,
-    -0.845381,
-    -0.84527,
-    -0.845284,
-    -0.845421,
-    -0.845679,
-    -0.846053,
-    -0.846535,
-    -0.847116,
-    -0.847783,
-    -0.848523,
-    -0.849323,
-    -0.850165,
-    -0.851033,
-    -0.851909,
-    -0.852777,
-    -0.853619,
-    -0.854418,
-    -0.855159,
-    -0.855826,
-    -0.856407,
-    -0.85689,
-    -0.857266,
-    -0.857527,
-    -0.857668,
-    -0.857687,
-    -0.857583,
-    -0.857358,
-    -0.857017,
-    -0.856568,
-    -0.856018,
-    -0.85538,
-    -0.854665,
-    -0.853888,
-    -0.853064,
-    -0.852211,
-    -0.851344,
-    -0.850482,
-    -0.849641,
-    -0.848837,
-    -0.848088,
-    -0.847408,
-    -0.846809,
-    -0.846305,
-    -0.845905,
-    -0.845616,
-    -0.845445,
-    -0.845395,
-    -0.845466,
-    -0.845658,
-    -0.845966,
-    -0.846383,
-    -0.846903,
-    -0.847513,
-    -0.848203,
-    -0.848958,
-    -0.849763,
-    -0.850602,
-    -0.851458,
-    -0.852315,
-    -0.853155,
-    -0.853962,
-    -0.85472,
-    -0.855413,
-    -0.856029,
-    -0.856554,
-    -0.856978,
-    -0.857293,
-    -0.857494,
-    -0.857575,
-    -0.857536,
-    -0.857377,
-    -0.857101,
-    -0.856715,
-    -0.856225,
-    -0.855642,
-    -0.854978,
-    -0.854245,
-    -0.853458,
-    -0.852634,
-    -0.851787,
-    -0.850936,
-    -0.850096,
-    -0.849286,
-    -0.84852,
-    -0.847814,
-    -0.847183,
-    -0.846637,
-    -0.846189,
-    -0.845847,
-    -0.845618,
-    -0.845507,
-    -0.845515,
-    -0.845642,
-    -0.845885,
-    -0.846241,
-    -0.846701,
-    -0.847256,
-    -0.847896,
-    -0.848607,
-    -0.849376,
-    -0.850186,
-    -0.851023,
-    -0.851868,
-    -0.852706,
-    -0.85352,
-    -0.854294,
-    -0.855012,
-    -0.85566,
-    -0.856225,
-    -0.856696,
-    -0.857064,
-    -0.857321,
-    -0.857463,
-    -0.857486,
-    -0.85739,
-    -0.857178,
-    -0.856853,
-    -0.856422,
-    -0.855894,
-    -0.855279,
-    -0.85459,
-    -0.853839,
-    -0.853043,
-    -0.852217,
-    -0.851377,
-    -0.85054,
-    -0.849723,
-    -0.848942,
-    -0.848212,
-    -0.847548,
-    -0.846964,
-    -0.84647,
-    -0.846076,
-    -0.845791,
-    -0.84562,
-    -0.845566,
-    -0.84563,
-    -0.845811,
-    -0.846106,
-    -0.846508,
-    -0.847009,
-    -0.8476,
-    -0.848268,
-    -0.849,
-    -0.849782,
-    -0.850598,
-    -0.851432,
-    -0.852268,
-    -0.853088,
-    -0.853876,
-    -0.854617,
-    -0.855296,
-    -0.8559,
-    -0.856417,
-    -0.856835,
-    -0.857148,
-    -0.857348,
-    -0.857433,
-    -0.857399,
-    -0.857249,
-    -0.856985,
-    -0.856612,
-    -0.856137,
-    -0.855571,
-    -0.854925,
-    -0.85421,
-    -0.853442,
-    -0.852637,
-    -0.851809,
-    -0.850975,
-    -0.850152,
-    -0.849357,
-    -0.848604,
-    -0.84791,
-    -0.847287,
-    -0.846749,
-    -0.846305,
-    -0.845965,
-    -0.845736,
-    -0.845621,
-    -0.845624,
-    -0.845743,
-    -0.845978,
-    -0.846322,
-    -0.846769,
-    -0.847311,
-    -0.847936,
-    -0.848633,
-    -0.849386,
-    -0.850182,
-    -0.851003,
-    -0.851835,
-    -0.852661,
-    -0.853463,
-    -0.854226,
-    -0.854936,
-    -0.855577,
-    -0.856138,
-    -0.856606,
-    -0.856973,
-    -0.857231,
-    -0.857376,
-    -0.857404,
-    -0.857315,
-    -0.85711,
-    -0.856795,
-    -0.856374,
-    -0.855857,
-    -0.855253,
-    -0.854575,
-    -0.853836,
-    -0.853051,
-    -0.852235,
-    -0.851406,
-    -0.850578,
-    -0.849769,
-    -0.848994,
-    -0.84827,
-    -0.84761,
-    -0.847028,
-    -0.846535,
-    -0.846142,
-    -0.845854,
-    -0.84568,
-    -0.845621,
-    -0.84568,
-    -0.845854,
-    -0.846142,
-    -0.846535,
-    -0.847028,
-    -0.84761,
-    -0.84827,
-    -0.848994,
-    -0.849769,
-    -0.850578,
-    -0.851406,
-    -0.852235,
-    -0.853051,
-    -0.853836,
-    -0.854575,
-    -0.855253,
-    -0.855857,
-    -0.856374,
-    -0.856795,
-    -0.85711,
-    -0.857315,
-    -0.857404,
-    -0.857376,
-    -0.857231,
-    -0.856973,
-    -0.856606,
-    -0.856138,
-    -0.855577,
-    -0.854936,
-    -0.854226,
-    -0.853463,
-    -0.852661,
-    -0.851835,
-    -0.851003,
-    -0.850182,
-    -0.849386,
-    -0.848633,
-    -0.847936,
-    -0.847311,
-    -0.846769,
-    -0.846322,
-    -0.845978,
-    -0.845743,
-    -0.845624,
-    -0.845621,
-    -0.845736,
-    -0.845965,
-    -0.846305,
-    -0.846749,
-    -0.847287,
-    -0.84791,
-    -0.848604,
-    -0.849357,
-    -0.850152,
-    -0.850975,
-    -0.851809,
-    -0.852637,
-    -0.853442,
-    -0.85421,
-    -0.854925,
-    -0.855571,
-    -0.856137,
-    -0.856612,
-    -0.856985,
-    -0.857249,
-    -0.857399,
-    -0.857433,
-    -0.857348,
-    -0.857148,
-    -0.856835,
-    -0.856417,
-    -0.8559,
-    -0.855296,
-    -0.854617,
-    -0.853876,
-    -0.853088,
-    -0.852268,
-    -0.851432,
-    -0.850598,
-    -0.849782,
-    -0.849,
-    -0.848268,
-    -0.8476,
-    -0.847009,
-    -0.846508,
-    -0.846106,
-    -0.845811,
-    -0.84563,
-    -0.845566,
-    -0.84562,
-    -0.845791,
-    -0.846076,
-    -0.84647,
-    -0.846964,
-    -0.847548,
-    -0.848212,
-    -0.848942,
-    -0.849723,
-    -0.85054,
-    -0.851377,
-    -0.852217,
-    -0.853043,
-    -0.853839,
-    -0.85459,
-    -0.855279,
-    -0.855894,
-    -0.856422,
-    -0.856853,
-    -0.857178,
-    -0.85739,
-    -0.857486,
-    -0.857463,
-    -0.857321,
-    -0.857064,
-    -0.856696,
-    -0.856225,
-    -0.85566,
-    -0.855012,
-    -0.854294,
-    -0.85352,
-    -0.852706,
-    -0.851868,
-    -0.851023,
-    -0.850186,
-    -0.849376,
-    -0.848607,
-    -0.847896,
-    -0.847256,
-    -0.846701,
-    -0.846241,
-    -0.845885,
-    -0.845642,
-    -0.845515,
-    -0.845507,
-    -0.845618,
-    -0.845847,
-    -0.846189,
-    -0.846637,
-    -0.847183,
-    -0.847814,
-    -0.84852,
-    -0.849286,
-    -0.850096,
-    -0.850936,
-    -0.851787,
-    -0.852634,
-    -0.853458,
-    -0.854245,
-    -0.854978,
-    -0.855642,
-    -0.856225,
-    -0.856715,
-    -0.857101,
-    -0.857377,
-    -0.857536,
-    -0.857575,
-    -0.857494,
-    -0.857293,
-    -0.856978,
-    -0.856554,
-    -0.856029,
-    -0.855413,
-    -0.85472,
-    -0.853962,
-    -0.853155,
-    -0.852315,
-    -0.851458,
-    -0.850602,
-    -0.849763,
-    -0.848958,
-    -0.848203,
-    -0.847513,
-    -0.846903,
-    -0.846383,
-    -0.845966,
-    -0.845658,
-    -0.845466,
-    -0.845395,
-    -0.845445,
-    -0.845616,
-    -0.845905,
-    -0.846305,
-    -0.846809,
-    -0.847408,
-    -0.848088,
-    -0.848837,
-    -0.849641,
-    -0.850482,
-    -0.851344,
-    -0.852211,
-    -0.853064,
-    -0.853888,
-    -0.854665,
-    -0.85538,
-    -0.856018,
-    -0.856568,
-    -0.857017,
-    -0.857358,
-    -0.857583,
-    -0.857687,
-    -0.857668,
-    -0.857527,
-    -0.857266,
-    -0.85689,
-    -0.856407,
-    -0.855826,
-    -0.855159,
-    -0.854418,
-    -0.853619,
-    -0.852777,
-    -0.851909,
-    -0.851033,
-    -0.850165,
-    -0.849323,
-    -0.848523,
-    -0.847783,
-    -0.847116,
-    -0.846535,
-    -0.846053,
-    -0.845679,
-    -0.845421,
-    -0.845284,
-    -0.84527,
-    -0.845381,
-    -0.845613,
-    -0.845964,
-    -0.846425,
-    -0.846988,
-    -0.847642,
-    -0.848373,
-    -0.849168,
-    -0.85001,
-    -0.850883,
-    -0.85177,
-    -0.852653,
-    -0.853514,
-    -0.854336,
-    -0.855103,
-    -0.855799,
-    -0.856411,
-    -0.856926,
-    -0.857334,
-    -0.857627,
-    -0.857798,
-    -0.857845,
-    -0.857765,
-    -0.857561,
-    -0.857237,
-    -0.856798,
-    -0.856254,
-    -0.855614,
-    -0.854892,
-    -0.854102,
-    -0.853259,
-    -0.852381,
-    -0.851484,
-    -0.850587,
-    -0.849707,
-    -0.848861,
-    -0.848068,
-    -0.847342,
-    -0.846698,
-    -0.846149,
-    -0.845706,
-    -0.845378,
-    -0.845171,
-    -0.845091,
-    -0.845138,
-    -0.845312,
-    -0.84561,
-    -0.846026,
-    -0.846551,
-    -0.847176,
-    -0.847888,
-    -0.848673,
-    -0.849516,
-    -0.8504,
-    -0.851307,
-    -0.852219,
-    -0.853119,
-    -0.853988,
-    -0.854808,
-    -0.855565,
-    -0.856242,
-    -0.856826,
-    -0.857305,
-    -0.857669,
-    -0.857911,
-    -0.858027,
-    -0.858012,
-    -0.857869,
-    -0.857599,
-    -0.857207,
-    -0.856701,
-    -0.856092,
-    -0.85539,
-    -0.85461,
-    -0.853768,
-    -0.852879,
-    -0.851961,
-    -0.851034,
-    -0.850114,
-    -0.849221,
-    -0.848372,
-    -0.847584,
-    -0.846874,
-    -0.846254,
-    -0.845738,
-    -0.845337,
-    -0.845057,
-    -0.844906,
-    -0.844886,
-    -0.844998,
-    -0.845239,
-    -0.845606,
-    -0.846091,
-    -0.846685,
-    -0.847376,
-    -0.84815,
-    -0.848992,
-    -0.849886,
-    -0.850814,
-    -0.851758,
-    -0.852698,
-    -0.853616,
-    -0.854493,
-    -0.855313,
-    -0.856059,
-    -0.856715,
-    -0.857269,
-    -0.857709,
-    -0.858027,
-    -0.858215,
-    -0.858271,
-    -0.858192,
-    -0.85798,
-    -0.857639,
-    -0.857175,
-    -0.856598,
-    -0.855919,
-    -0.85515,
-    -0.854308,
-    -0.853409,
-    -0.852471,
-    -0.851511,
-    -0.85055,
-    -0.849607,
-    -0.8487,
-    -0.847847,
-    -0.847065,
-    -0.846371,
-    -0.845777,
-    -0.845297,
-    -0.84494,
-    -0.844712,
-    -0.84462,
-    -0.844665,
-    -0.844846,
-    -0.84516,
-    -0.845602,
-    -0.846161,
-    -0.846829,
-    -0.847591,
-    -0.848432,
-    -0.849336,
-    -0.850286,
-    -0.851261,
-    -0.852244,
-    -0.853214,
-    -0.854152,
-    -0.855039,
-    -0.855858,
-    -0.856592,
-    -0.857226,
-    -0.857748,
-    -0.858147,
-    -0.858414,
-    -0.858545,
-    -0.858536,
-    -0.858387,
-    -0.8581,
-    -0.857683,
-    -0.857141,
-    -0.856486,
-    -0.855731,
-    -0.854891,
-    -0.853981,
-    -0.853021,
-    -0.852028,
-    -0.851023,
-    -0.850026,
-    -0.849056,
-    -0.848133,
-    -0.847276,
-    -0.846501,
-    -0.845824,
-    -0.845259,
-    -0.844817,
-    -0.844508,
-    -0.844337,
-    -0.844309,
-    -0.844424,
-    -0.844681,
-    -0.845074,
-    -0.845596,
-    -0.846238,
-    -0.846986,
-    -0.847825,
-    -0.84874,
-    -0.849712,
-    -0.850722,
-    -0.85175,
-    -0.852776,
-    -0.853779,
-    -0.854739,
-    -0.855637,
-    -0.856455,
-    -0.857176,
-    -0.857786,
-    -0.858273,
-    -0.858626,
-    -0.858839,
-    -0.858906,
-    -0.858826,
-    -0.8586,
-    -0.858233,
-    -0.857731,
-    -0.857103,
-    -0.856364,
-    -0.855525,
-    -0.854605,
-    -0.853621,
-    -0.852593,
-    -0.851541,
-    -0.850486,
-    -0.849448,
-    -0.848449,
-    -0.847509,
-    -0.846646,
-    -0.845878,
-    -0.845221,
-    -0.844687,
-    -0.844287,
-    -0.844031,
-    -0.843923,
-    -0.843965,
-    -0.844158,
-    -0.844499,
-    -0.844979,
-    -0.845591,
-    -0.846323,
-    -0.847159,
-    -0.848085,
-    -0.849081,
-    -0.850128,
-    -0.851205,
-    -0.852292,
-    -0.853365,
-    -0.854405,
-    -0.855389,
-    -0.8563,
-    -0.857117,
-    -0.857824,
-    -0.858408,
-    -0.858856,
-    -0.859159,
-    -0.85931,
-    -0.859307,
-    -0.859148,
-    -0.858837,
-    -0.858379,
-    -0.857784,
-    -0.857061,
-    -0.856226,
-    -0.855295,
-    -0.854286,
-    -0.85322,
-    -0.852116,
-    -0.850997,
-    -0.849885,
-    -0.848803,
-    -0.847771,
-    -0.846812,
-    -0.845943,
-    -0.845182,
-    -0.844546,
-    -0.844046,
-    -0.843694,
-    -0.843497,
-    -0.843459,
-    -0.843581,
-    -0.843861,
-    -0.844294,
-    -0.844873,
-    -0.845586,
-    -0.846418,
-    -0.847355,
-    -0.848377,
-    -0.849465,
-    -0.850596,
-    -0.85175,
-    -0.852902,
-    -0.854029,
-    -0.85511,
-    -0.856123,
-    -0.857047,
-    -0.857863,
-    -0.858555,
-    -0.859109,
-    -0.859514,
-    -0.85976,
-    -0.859843,
-    -0.85976,
-    -0.859512,
-    -0.859105,
-    -0.858545,
-    -0.857843,
-    -0.857013,
-    -0.85607,
-    -0.855034,
-    -0.853925,
-    -0.852763,
-    -0.851574,
-    -0.850379,
-    -0.849203,
-    -0.848069,
-    -0.847001,
-    -0.846019,
-    -0.845143,
-    -0.844391,
-    -0.843778,
-    -0.843318,
-    -0.84302,
-    -0.842889,
-    -0.84293,
-    -0.843143,
-    -0.843522,
-    -0.844063,
-    -0.844753,
-    -0.84558,
-    -0.846529,
-    -0.84758,
-    -0.848713,
-    -0.849905,
-    -0.851133,
-    -0.852374,
-    -0.853601,
-    -0.854791,
-    -0.855919,
-    -0.856964,
-    -0.857904,
-    -0.85872,
-    -0.859394,
-    -0.859915,
-    -0.860269,
-    -0.86045,
-    -0.860454,
-    -0.86028,
-    -0.85993,
-    -0.859412,
-    -0.858734,
-    -0.85791,
-    -0.856955,
-    -0.855889,
-    -0.854731,
-    -0.853505,
-    -0.852235,
-    -0.850946,
-    -0.849664,
-    -0.848413,
-    -0.84722,
-    -0.846108,
-    -0.8451,
-    -0.844216,
-    -0.843474,
-    -0.842889,
-    -0.842474,
-    -0.842237,
-    -0.842185,
-    -0.842318,
-    -0.842635,
-    -0.84313,
-    -0.843795,
-    -0.844615,
-    -0.845576,
-    -0.846659,
-    -0.847844,
-    -0.849105,
-    -0.85042,
-    -0.851762,
-    -0.853104,
-    -0.854419,
-    -0.855682,
-    -0.856866,
-    -0.857949,
-    -0.858908,
-    -0.859723,
-    -0.860377,
-    -0.860858,
-    -0.861154,
-    -0.861259,
-    -0.861171,
-    -0.860889,
-    -0.860419,
-    -0.85977,
-    -0.858954,
-    -0.857986,
-    -0.856885,
-    -0.855672,
-    -0.854371,
-    -0.853008,
-    -0.85161,
-    -0.850203,
-    -0.848817,
-    -0.847479,
-    -0.846215,
-    -0.845052,
-    -0.844012,
-    -0.843118,
-    -0.842387,
-    -0.841835,
-    -0.841474,
-    -0.841311,
-    -0.841351,
-    -0.841593,
-    -0.842035,
-    -0.842667,
-    -0.843479,
-    -0.844454,
-    -0.845574,
-    -0.846818,
-    -0.848161,
-    -0.849577,
-    -0.851038,
-    -0.852515,
-    -0.853978,
-    -0.855399,
-    -0.856749,
-    -0.858001,
-    -0.859129,
-    -0.860111,
-    -0.860925,
-    -0.861556,
-    -0.861989,
-    -0.862215,
-    -0.862229,
-    -0.862029,
-    -0.861619,
-    -0.861005,
-    -0.860199,
-    -0.859216,
-    -0.858074,
-    -0.856796,
-    -0.855407,
-    -0.853933,
-    -0.852404,
-    -0.85085,
-    -0.849301,
-    -0.847789,
-    -0.846344,
-    -0.844994,
-    -0.843769,
-    -0.842691,
-    -0.841784,
-    -0.841067,
-    -0.840554,
-    -0.840258,
-    -0.840184,
-    -0.840337,
-    -0.840712,
-    -0.841306,
-    -0.842106,
-    -0.843097,
-    -0.844262,
-    -0.845577,
-    -0.847018,
-    -0.848556,
-    -0.850161,
-    -0.851801,
-    -0.853444,
-    -0.855057,
-    -0.856608,
-    -0.858066,
-    -0.8594,
-    -0.860584,
-    -0.861594,
-    -0.862408,
-    -0.863009,
-    -0.863384,
-    -0.863524,
-    -0.863425,
-    -0.863088,
-    -0.862518,
-    -0.861725,
-    -0.860724,
-    -0.859534,
-    -0.858177,
-    -0.856679,
-    -0.85507,
-    -0.85338,
-    -0.851644,
-    -0.849896,
-    -0.848169,
-    -0.8465,
-    -0.844921,
-    -0.843464,
-    -0.84216,
-    -0.841035,
-    -0.840112,
-    -0.839411,
-    -0.838948,
-    -0.838733,
-    -0.838772,
-    -0.839066,
-    -0.839609,
-    -0.840394,
-    -0.841405,
-    -0.842624,
-    -0.844028,
-    -0.84559,
-    -0.84728,
-    -0.849065,
-    -0.850909,
-    -0.852777,
-    -0.854631,
-    -0.856435,
-    -0.858151,
-    -0.859746,
-    -0.861186,
-    -0.862443,
-    -0.863489,
-    -0.864302,
-    -0.864866,
-    -0.865166,
-    -0.865196,
-    -0.864952,
-    -0.864439,
-    -0.863664,
-    -0.862641,
-    -0.861389,
-    -0.859932,
-    -0.858297,
-    -0.856516,
-    -0.854622,
-    -0.852654,
-    -0.85065,
-    -0.84865,
-    -0.846693,
-    -0.844819,
-    -0.843066,
-    -0.841469,
-    -0.840063,
-    -0.838875,
-    -0.837931,
-    -0.837253,
-    -0.836854,
-    -0.836746,
-    -0.836931,
-    -0.83741,
-    -0.838174,
-    -0.839209,
-    -0.840498,
-    -0.842017,
-    -0.843736,
-    -0.845623,
-    -0.847642,
-    -0.849753,
-    -0.851915,
-    -0.854085,
-    -0.856219,
-    -0.858276,
-    -0.860213,
-    -0.86199,
-    -0.863572,
-    -0.864924,
-    -0.866019,
-    -0.866832,
-    -0.867345,
-    -0.867546,
-    -0.867427,
-    -0.86699,
-    -0.86624,
-    -0.865189,
-    -0.863856,
-    -0.862266,
-    -0.860448,
-    -0.858437,
-    -0.856272,
-    -0.853993,
-    -0.851646,
-    -0.849278,
-    -0.846934,
-    -0.844663,
-    -0.84251,
-    -0.840519,
-    -0.838731,
-    -0.837184,
-    -0.83591,
-    -0.834938,
-    -0.834289,
-    -0.833979,
-    -0.834017,
-    -0.834406,
-    -0.83514,
-    -0.836209,
-    -0.837593,
-    -0.839267,
-    -0.841202,
-    -0.843361,
-    -0.845702,
-    -0.84818,
-    -0.850748,
-    -0.853355,
-    -0.855948,
-    -0.858477,
-    -0.860889,
-    -0.863136,
-    -0.865172,
-    -0.866953,
-    -0.868442,
-    -0.869606,
-    -0.870419,
-    -0.870861,
-    -0.87092,
-    -0.87059,
-    -0.869876,
-    -0.868786,
-    -0.86734,
-    -0.865562,
-    -0.863485,
-    -0.861148,
-    -0.858594,
-    -0.855872,
-    -0.853035,
-    -0.850138,
-    -0.847239,
-    -0.844396,
-    -0.841665,
-    -0.839104,
-    -0.836764,
-    -0.834695,
-    -0.832941,
-    -0.831541,
-    -0.830526,
-    -0.829921,
-    -0.829742,
-    -0.829998,
-    -0.830688,
-    -0.831803,
-    -0.833327,
-    -0.835232,
-    -0.837485,
-    -0.840046,
-    -0.842866,
-    -0.845892,
-    -0.849066,
-    -0.852325,
-    -0.855607,
-    -0.858846,
-    -0.861976,
-    -0.864933,
-    -0.867656,
-    -0.870089,
-    -0.872177,
-    -0.873877,
-    -0.875148,
-    -0.875961,
-    -0.876293,
-    -0.87613,
-    -0.875472,
-    -0.874323,
-    -0.872702,
-    -0.870633,
-    -0.868154,
-    -0.865307,
-    -0.862145,
-    -0.858728,
-    -0.855119,
-    -0.85139,
-    -0.847612,
-    -0.843861,
-    -0.840212,
-    -0.83674,
-    -0.833516,
-    -0.830609,
-    -0.828082,
-    -0.82599,
-    -0.824382,
-    -0.823296,
-    -0.822763,
-    -0.822801,
-    -0.823418,
-    -0.82461,
-    -0.826362,
-    -0.828647,
-    -0.831429,
-    -0.834658,
-    -0.838277,
-    -0.842219,
-    -0.846412,
-    -0.850775,
-    -0.855222,
-    -0.859667,
-    -0.86402,
-    -0.868192,
-    -0.872098,
-    -0.875653,
-    -0.878781,
-    -0.881412,
-    -0.883484,
-    -0.884946,
-    -0.885758,
-    -0.885892,
-    -0.885334,
-    -0.884081,
-    -0.882147,
-    -0.879558,
-    -0.876353,
-    -0.872586,
-    -0.86832,
-    -0.863633,
-    -0.85861,
-    -0.853346,
-    -0.84794,
-    -0.8425,
-    -0.837134,
-    -0.83195,
-    -0.827058,
-    -0.82256,
-    -0.818556,
-    -0.815137,
-    -0.812384,
-    -0.810367,
-    -0.809142,
-    -0.808752,
-    -0.809223,
-    -0.810566,
-    -0.812773,
-    -0.81582,
-    -0.819666,
-    -0.824251,
-    -0.829503,
-    -0.835331,
-    -0.841633,
-    -0.848293,
-    -0.855186,
-    -0.862179,
-    -0.869135,
-    -0.875912,
-    -0.882369,
-    -0.888366,
-    -0.893772,
-    -0.898459,
-    -0.902314,
-    -0.905234,
-    -0.907134,
-    -0.907945,
-    -0.907618,
-    -0.906126,
-    -0.903461,
-    -0.899642,
-    -0.894708,
-    -0.888724,
-    -0.881775,
-    -0.873969,
-    -0.865436,
-    -0.856322,
-    -0.846791,
-    -0.837022,
-    -0.827204,
-    -0.817532,
-    -0.80821,
-    -0.799439,
-    -0.79142,
-    -0.784344,
-    -0.778395,
-    -0.77374,
-    -0.77053,
-    -0.768894,
-    -0.768934,
-    -0.770728,
-    -0.774322,
-    -0.779727,
-    -0.786925,
-    -0.795859,
-    -0.806436,
-    -0.818529,
-    -0.831973,
-    -0.84657,
-    -0.862087,
-    -0.878262,
-    -0.894803,
-    -0.911395,
-    -0.927701,
-    -0.943365,
-    -0.95802,
-    -0.971291,
-    -0.982799,
-    -0.992169,
-    -0.999032,
-    -1.00303,
-    -1.00383,
-    -1.00112,
-    -0.994602,
-    -0.984032,
-    -0.96919,
-    -0.9499,
-    -0.926031,
-    -0.897494,
-    -0.864255,
-    -0.826324,
-    -0.783767,
-    -0.736697,
-    -0.68528,
-    -0.629731,
-    -0.570311,
-    -0.507326,
-    -0.441125,
-    -0.372092,
-    -0.300647,
-    -0.227236,
-    -0.152331,
-    -0.0764185
-};
-
-// Top frequency: 44.1K * 0.0145125
-constexpr static std::array<float, 4096> wt_square_0x5 =
-{
-    0,
-    0.038241,
-    0.0764185,
-    0.114469,
-    0.152331,
-    0.189941,
-    0.227237,
-    0.26416,
-    0.300649,
-    0.336647,
-    0.372096,
-    0.406942,
-    0.441131,
-    0.474612,
-    0.507336,
-    0.539255,
-    0.570324,
-    0.600503,
-    0.62975,
-    0.658028,
-    0.685305,
-    0.711547,
-    0.736728,
-    0.760821,
-    0.783805,
-    0.80566,
-    0.82637,
-    0.845923,
-    0.864309,
-    0.881521,
-    0.897557,
-    0.912416,
-    0.926101,
-    0.938619,
-    0.949979,
-    0.960192,
-    0.969275,
-    0.977245,
-    0.984123,
-    0.989932,
-    0.994698,
-    0.998449,
-    1.00122,
-    1.00303,
-    1.00393,
-    1.00395,
-    1.00313,
-    1.00151,
-    0.999129,
-    0.996032,
-    0.992262,
-    0.987864,
-    0.982885,
-    0.97737,
-    0.971367,
-    0.964922,
-    0.958084,
-    0.950899,
-    0.943415,
-    0.935678,
-    0.927735,
-    0.919631,
-    0.911412,
-    0.90312,
-    0.8948,
-    0.886492,
-    0.878238,
-    0.870075,
-    0.862042,
-    0.854173,
-    0.846503,
-    0.839063,
-    0.831885,
-    0.824995,
-    0.818419,
-    0.812183,
-    0.806307,
-    0.80081,
-    0.795711,
-    0.791023,
-    0.786761,
-    0.782933,
-    0.779549,
-    0.776614,
-    0.774132,
-    0.772105,
-    0.770531,
-    0.769409,
-    0.768733,
-    0.768497,
-    0.768693,
-    0.769309,
-    0.770333,
-    0.771753,
-    0.773551,
-    0.775713,
-    0.778218,
-    0.781049,
-    0.784184,
-    0.787602,
-    0.79128,
-    0.795196,
-    0.799324,
-    0.803641,
-    0.808122,
-    0.812742,
-    0.817475,
-    0.822295,
-    0.827179,
-    0.832099,
-    0.837032,
-    0.841952,
-    0.846836,
-    0.851661,
-    0.856403,
-    0.86104,
-    0.865552,
-    0.869918,
-    0.87412,
-    0.878139,
-    0.881958,
-    0.885562,
-    0.888937,
-    0.89207,
-    0.894949,
-    0.897563,
-    0.899905,
-    0.901967,
-    0.903742,
-    0.905228,
-    0.90642,
-    0.907317,
-    0.90792,
-    0.90823,
-    0.908249,
-    0.907981,
-    0.907433,
-    0.906611,
-    0.905523,
-    0.904177,
-    0.902586,
-    0.900758,
-    0.898708,
-    0.896448,
-    0.893992,
-    0.891356,
-    0.888554,
-    0.885602,
-    0.882517,
-    0.879317,
-    0.876018,
-    0.872638,
-    0.869196,
-    0.865707,
-    0.862192,
-    0.858666,
-    0.855148,
-    0.851656,
-    0.848205,
-    0.844813,
-    0.841496,
-    0.838268,
-    0.835146,
-    0.832142,
-    0.829272,
-    0.826546,
-    0.823978,
-    0.821577,
-    0.819354,
-    0.817318,
-    0.815476,
-    0.813835,
-    0.812402,
-    0.811181,
-    0.810176,
-    0.809388,
-    0.808821,
-    0.808473,
-    0.808345,
-    0.808435,
-    0.808739,
-    0.809254,
-    0.809976,
-    0.810898,
-    0.812013,
-    0.813315,
-    0.814794,
-    0.816442,
-    0.818249,
-    0.820203,
-    0.822295,
-    0.824512,
-    0.826841,
-    0.829271,
-    0.831788,
-    0.834379,
-    0.83703,
-    0.839728,
-    0.842458,
-    0.845208,
-    0.847962,
-    0.850708,
-    0.853432,
-    0.856121,
-    0.858762,
-    0.861341,
-    0.863847,
-    0.866269,
-    0.868594,
-    0.870813,
-    0.872915,
-    0.874891,
-    0.876732,
-    0.878431,
-    0.87998,
-    0.881374,
-    0.882605,
-    0.883671,
-    0.884566,
-    0.885289,
-    0.885837,
-    0.886208,
-    0.886403,
-    0.886422,
-    0.886267,
-    0.885939,
-    0.885442,
-    0.88478,
-    0.883958,
-    0.88298,
-    0.881854,
-    0.880585,
-    0.879181,
-    0.877651,
-    0.876002,
-    0.874245,
-    0.872389,
-    0.870443,
-    0.868418,
-    0.866325,
-    0.864174,
-    0.861978,
-    0.859746,
-    0.85749,
-    0.855223,
-    0.852954,
-    0.850695,
-    0.848458,
-    0.846253,
-    0.844092,
-    0.841983,
-    0.839938,
-    0.837966,
-    0.836077,
-    0.834278,
-    0.832579,
-    0.830986,
-    0.829508,
-    0.82815,
-    0.826919,
-    0.825819,
-    0.824855,
-    0.824031,
-    0.82335,
-    0.822814,
-    0.822426,
-    0.822185,
-    0.822092,
-    0.822146,
-    0.822346,
-    0.822691,
-    0.823176,
-    0.8238,
-    0.824557,
-    0.825444,
-    0.826455,
-    0.827584,
-    0.828824,
-    0.830169,
-    0.831612,
-    0.833144,
-    0.834757,
-    0.836444,
-    0.838194,
-    0.839999,
-    0.84185,
-    0.843737,
-    0.845651,
-    0.847581,
-    0.849518,
-    0.851454,
-    0.853377,
-    0.855278,
-    0.857149,
-    0.858979,
-    0.860761,
-    0.862486,
-    0.864146,
-    0.865732,
-    0.867237,
-    0.868655,
-    0.869979,
-    0.871202,
-    0.87232,
-    0.873328,
-    0.874221,
-    0.874995,
-    0.875647,
-    0.876176,
-    0.876578,
-    0.876854,
-    0.877001,
-    0.87702,
-    0.876913,
-    0.876679,
-    0.876321,
-    0.875842,
-    0.875244,
-    0.874532,
-    0.873709,
-    0.87278,
-    0.871751,
-    0.870626,
-    0.869413,
-    0.868118,
-    0.866747,
-    0.865307,
-    0.863807,
-    0.862255,
-    0.860657,
-    0.859022,
-    0.85736,
-    0.855677,
-    0.853982,
-    0.852285,
-    0.850593,
-    0.848914,
-    0.847258,
-    0.845631,
-    0.844043,
-    0.8425,
-    0.841011,
-    0.839581,
-    0.838219,
-    0.836929,
-    0.835719,
-    0.834595,
-    0.83356,
-    0.83262,
-    0.831779,
-    0.83104,
-    0.830408,
-    0.829883,
-    0.829469,
-    0.829167,
-    0.828977,
-    0.828901,
-    0.828938,
-    0.829087,
-    0.829347,
-    0.829716,
-    0.830192,
-    0.830771,
-    0.831451,
-    0.832228,
-    0.833096,
-    0.834053,
-    0.835091,
-    0.836206,
-    0.837392,
-    0.838643,
-    0.839952,
-    0.841312,
-    0.842716,
-    0.844158,
-    0.845629,
-    0.847123,
-    0.848632,
-    0.850147,
-    0.851663,
-    0.853171,
-    0.854664,
-    0.856134,
-    0.857574,
-    0.858977,
-    0.860337,
-    0.861647,
-    0.8629,
-    0.864092,
-    0.865215,
-    0.866264,
-    0.867236,
-    0.868125,
-    0.868928,
-    0.86964,
-    0.870258,
-    0.870781,
-    0.871206,
-    0.87153,
-    0.871754,
-    0.871876,
-    0.871896,
-    0.871814,
-    0.871632,
-    0.87135,
-    0.870971,
-    0.870496,
-    0.869929,
-    0.869273,
-    0.868531,
-    0.867708,
-    0.866807,
-    0.865834,
-    0.864794,
-    0.863692,
-    0.862534,
-    0.861326,
-    0.860074,
-    0.858784,
-    0.857464,
-    0.856119,
-    0.854757,
-    0.853385,
-    0.852008,
-    0.850635,
-    0.849271,
-    0.847924,
-    0.846601,
-    0.845307,
-    0.844049,
-    0.842833,
-    0.841665,
-    0.840551,
-    0.839496,
-    0.838504,
-    0.837581,
-    0.836732,
-    0.835959,
-    0.835266,
-    0.834657,
-    0.834134,
-    0.8337,
-    0.833356,
-    0.833103,
-    0.832943,
-    0.832877,
-    0.832903,
-    0.833022,
-    0.833232,
-    0.833533,
-    0.833922,
-    0.834397,
-    0.834955,
-    0.835594,
-    0.83631,
-    0.837098,
-    0.837956,
-    0.838878,
-    0.83986,
-    0.840896,
-    0.841981,
-    0.843109,
-    0.844276,
-    0.845474,
-    0.846698,
-    0.847942,
-    0.849199,
-    0.850463,
-    0.851728,
-    0.852988,
-    0.854235,
-    0.855465,
-    0.856671,
-    0.857847,
-    0.858988,
-    0.860087,
-    0.86114,
-    0.862142,
-    0.863087,
-    0.863971,
-    0.86479,
-    0.865541,
-    0.866219,
-    0.866822,
-    0.867346,
-    0.86779,
-    0.868152,
-    0.868429,
-    0.868622,
-    0.868728,
-    0.868749,
-    0.868684,
-    0.868533,
-    0.868298,
-    0.867981,
-    0.867582,
-    0.867105,
-    0.866552,
-    0.865926,
-    0.86523,
-    0.864468,
-    0.863644,
-    0.862762,
-    0.861827,
-    0.860843,
-    0.859817,
-    0.858752,
-    0.857654,
-    0.856529,
-    0.855383,
-    0.854221,
-    0.853049,
-    0.851873,
-    0.850699,
-    0.849533,
-    0.84838,
-    0.847246,
-    0.846136,
-    0.845057,
-    0.844013,
-    0.84301,
-    0.842052,
-    0.841143,
-    0.840289,
-    0.839494,
-    0.838761,
-    0.838093,
-    0.837494,
-    0.836966,
-    0.836513,
-    0.836135,
-    0.835835,
-    0.835614,
-    0.835473,
-    0.835412,
-    0.835431,
-    0.83553,
-    0.835708,
-    0.835965,
-    0.836298,
-    0.836706,
-    0.837187,
-    0.837737,
-    0.838355,
-    0.839036,
-    0.839777,
-    0.840575,
-    0.841425,
-    0.842323,
-    0.843264,
-    0.844244,
-    0.845257,
-    0.846299,
-    0.847363,
-    0.848446,
-    0.84954,
-    0.850642,
-    0.851745,
-    0.852844,
-    0.853934,
-    0.855008,
-    0.856062,
-    0.857091,
-    0.85809,
-    0.859053,
-    0.859976,
-    0.860854,
-    0.861684,
-    0.862461,
-    0.863182,
-    0.863842,
-    0.86444,
-    0.864972,
-    0.865435,
-    0.865828,
-    0.866149,
-    0.866396,
-    0.866568,
-    0.866665,
-    0.866686,
-    0.866632,
-    0.866503,
-    0.866299,
-    0.866023,
-    0.865675,
-    0.865257,
-    0.864772,
-    0.864222,
-    0.86361,
-    0.862939,
-    0.862213,
-    0.861436,
-    0.860611,
-    0.859743,
-    0.858836,
-    0.857895,
-    0.856924,
-    0.855928,
-    0.854913,
-    0.853884,
-    0.852844,
-    0.851801,
-    0.850759,
-    0.849723,
-    0.848698,
-    0.847689,
-    0.846702,
-    0.845741,
-    0.844811,
-    0.843917,
-    0.843062,
-    0.842251,
-    0.841488,
-    0.840777,
-    0.840121,
-    0.839523,
-    0.838986,
-    0.838512,
-    0.838104,
-    0.837764,
-    0.837493,
-    0.837292,
-    0.837163,
-    0.837105,
-    0.837119,
-    0.837205,
-    0.837361,
-    0.837588,
-    0.837884,
-    0.838246,
-    0.838674,
-    0.839165,
-    0.839717,
-    0.840326,
-    0.840989,
-    0.841703,
-    0.842465,
-    0.84327,
-    0.844115,
-    0.844994,
-    0.845904,
-    0.846841,
-    0.847798,
-    0.848772,
-    0.849758,
-    0.850751,
-    0.851745,
-    0.852736,
-    0.853719,
-    0.854689,
-    0.855642,
-    0.856572,
-    0.857475,
-    0.858346,
-    0.859182,
-    0.859978,
-    0.860731,
-    0.861436,
-    0.86209,
-    0.86269,
-    0.863234,
-    0.863718,
-    0.864141,
-    0.8645,
-    0.864793,
-    0.86502,
-    0.86518,
-    0.865271,
-    0.865293,
-    0.865247,
-    0.865132,
-    0.86495,
-    0.864702,
-    0.864388,
-    0.864011,
-    0.863572,
-    0.863074,
-    0.862519,
-    0.861911,
-    0.861252,
-    0.860546,
-    0.859796,
-    0.859006,
-    0.85818,
-    0.857322,
-    0.856437,
-    0.855529,
-    0.854603,
-    0.853663,
-    0.852714,
-    0.851761,
-    0.850807,
-    0.84986,
-    0.848922,
-    0.847998,
-    0.847094,
-    0.846213,
-    0.845359,
-    0.844538,
-    0.843753,
-    0.843008,
-    0.842307,
-    0.841652,
-    0.841048,
-    0.840497,
-    0.840001,
-    0.839564,
-    0.839186,
-    0.838871,
-    0.838619,
-    0.838432,
-    0.83831,
-    0.838254,
-    0.838264,
-    0.83834,
-    0.838481,
-    0.838687,
-    0.838957,
-    0.839288,
-    0.83968,
-    0.840131,
-    0.840637,
-    0.841196,
-    0.841806,
-    0.842464,
-    0.843165,
-    0.843907,
-    0.844686,
-    0.845497,
-    0.846337,
-    0.847202,
-    0.848087,
-    0.848988,
-    0.849899,
-    0.850818,
-    0.851739,
-    0.852657,
-    0.853568,
-    0.854468,
-    0.855351,
-    0.856215,
-    0.857053,
-    0.857863,
-    0.85864,
-    0.859381,
-    0.860081,
-    0.860738,
-    0.861348,
-    0.861908,
-    0.862415,
-    0.862868,
-    0.863264,
-    0.8636,
-    0.863876,
-    0.86409,
-    0.864241,
-    0.864329,
-    0.864352,
-    0.864312,
-    0.864208,
-    0.864041,
-    0.863812,
-    0.863522,
-    0.863172,
-    0.862765,
-    0.862303,
-    0.861787,
-    0.861221,
-    0.860608,
-    0.85995,
-    0.85925,
-    0.858513,
-    0.857742,
-    0.856942,
-    0.856115,
-    0.855266,
-    0.854399,
-    0.85352,
-    0.852631,
-    0.851738,
-    0.850845,
-    0.849956,
-    0.849076,
-    0.848209,
-    0.84736,
-    0.846532,
-    0.84573,
-    0.844958,
-    0.844219,
-    0.843518,
-    0.842857,
-    0.84224,
-    0.84167,
-    0.841149,
-    0.840681,
-    0.840267,
-    0.839909,
-    0.83961,
-    0.83937,
-    0.839191,
-    0.839074,
-    0.839018,
-    0.839025,
-    0.839094,
-    0.839225,
-    0.839416,
-    0.839668,
-    0.839978,
-    0.840346,
-    0.840768,
-    0.841244,
-    0.84177,
-    0.842345,
-    0.842964,
-    0.843625,
-    0.844325,
-    0.84506,
-    0.845826,
-    0.84662,
-    0.847437,
-    0.848274,
-    0.849126,
-    0.849989,
-    0.850859,
-    0.851731,
-    0.852602,
-    0.853466,
-    0.854319,
-    0.855158,
-    0.855978,
-    0.856775,
-    0.857544,
-    0.858283,
-    0.858988,
-    0.859655,
-    0.860281,
-    0.860862,
-    0.861397,
-    0.861882,
-    0.862314,
-    0.862693,
-    0.863015,
-    0.863281,
-    0.863487,
-    0.863633,
-    0.863719,
-    0.863744,
-    0.863709,
-    0.863612,
-    0.863456,
-    0.86324,
-    0.862966,
-    0.862635,
-    0.862249,
-    0.86181,
-    0.86132,
-    0.860782,
-    0.860197,
-    0.859571,
-    0.858904,
-    0.858201,
-    0.857466,
-    0.856701,
-    0.855912,
-    0.855101,
-    0.854272,
-    0.853431,
-    0.852581,
-    0.851726,
-    0.85087,
-    0.850019,
-    0.849175,
-    0.848344,
-    0.847529,
-    0.846735,
-    0.845965,
-    0.845223,
-    0.844513,
-    0.843838,
-    0.843202,
-    0.842608,
-    0.842058,
-    0.841556,
-    0.841104,
-    0.840704,
-    0.840358,
-    0.840068,
-    0.839835,
-    0.83966,
-    0.839544,
-    0.839488,
-    0.839492,
-    0.839556,
-    0.839679,
-    0.839861,
-    0.840101,
-    0.840398,
-    0.84075,
-    0.841155,
-    0.841611,
-    0.842117,
-    0.842669,
-    0.843264,
-    0.843901,
-    0.844575,
-    0.845283,
-    0.846021,
-    0.846787,
-    0.847576,
-    0.848383,
-    0.849206,
-    0.85004,
-    0.850881,
-    0.851725,
-    0.852567,
-    0.853404,
-    0.85423,
-    0.855043,
-    0.855837,
-    0.85661,
-    0.857357,
-    0.858075,
-    0.858759,
-    0.859407,
-    0.860016,
-    0.860581,
-    0.861102,
-    0.861574,
-    0.861996,
-    0.862366,
-    0.862682,
-    0.862942,
-    0.863144,
-    0.863289,
-    0.863375,
-    0.863402,
-    0.86337,
-    0.863279,
-    0.863129,
-    0.862922,
-    0.862658,
-    0.862338,
-    0.861965,
-    0.861539,
-    0.861064,
-    0.860542,
-    0.859975,
-    0.859366,
-    0.858718,
-    0.858034,
-    0.857318,
-    0.856574,
-    0.855805,
-    0.855014,
-    0.854207,
-    0.853386,
-    0.852556,
-    0.851721,
-    0.850885,
-    0.850053,
-    0.849229,
-    0.848416,
-    0.847618,
-    0.846841,
-    0.846086,
-    0.845359,
-    0.844663,
-    0.844001,
-    0.843377,
-    0.842793,
-    0.842253,
-    0.841759,
-    0.841314,
-    0.84092,
-    0.840578,
-    0.840291,
-    0.84006,
-    0.839887,
-    0.839771,
-    0.839713,
-    0.839714,
-    0.839774,
-    0.839893,
-    0.840069,
-    0.840302,
-    0.840591,
-    0.840935,
-    0.841331,
-    0.841777,
-    0.842272,
-    0.842813,
-    0.843397,
-    0.844022,
-    0.844683,
-    0.845379,
-    0.846105,
-    0.846858,
-    0.847634,
-    0.848429,
-    0.849239,
-    0.850061,
-    0.850889,
-    0.851721,
-    0.852552,
-    0.853377,
-    0.854193,
-    0.854996,
-    0.855781,
-    0.856545,
-    0.857284,
-    0.857994,
-    0.858671,
-    0.859313,
-    0.859916,
-    0.860478,
-    0.860994,
-    0.861463,
-    0.861883,
-    0.862251,
-    0.862566,
-    0.862826,
-    0.863029,
-    0.863175,
-    0.863263,
-    0.863292,
-    0.863263,
-    0.863175,
-    0.863029,
-    0.862826,
-    0.862566,
-    0.862251,
-    0.861883,
-    0.861463,
-    0.860994,
-    0.860478,
-    0.859916,
-    0.859313,
-    0.858671,
-    0.857994,
-    0.857284,
-    0.856545,
-    0.855781,
-    0.854996,
-    0.854193,
-    0.853377,
-    0.852552,
-    0.851721,
-    0.850889,
-    0.850061,
-    0.849239,
-    0.848429,
-    0.847634,
-    0.846858,
-    0.846105,
-    0.845379,
-    0.844683,
-    0.844022,
-    0.843397,
-    0.842813,
-    0.842272,
-    0.841777,
-    0.841331,
-    0.840935,
-    0.840591,
-    0.840302,
-    0.840069,
-    0.839893,
-    0.839774,
-    0.839714,
-    0.839713,
-    0.839771,
-    0.839887,
-    0.84006,
-    0.840291,
-    0.840578,
-    0.84092,
-    0.841314,
-    0.841759,
-    0.842253,
-    0.842793,
-    0.843377,
-    0.844001,
-    0.844663,
-    0.845359,
-    0.846086,
-    0.846841,
-    0.847618,
-    0.848416,
-    0.849229,
-    0.850053,
-    0.850885,
-    0.851721,
-    0.852556,
-    0.853386,
-    0.854207,
-    0.855014,
-    0.855805,
-    0.856574,
-    0.857318,
-    0.858034,
-    0.858718,
-    0.859366,
-    0.859975,
-    0.860542,
-    0.861064,
-    0.861539,
-    0.861965,
-    0.862338,
-    0.862658,
-    0.862922,
-    0.863129,
-    0.863279,
-    0.86337,
-    0.863402,
-    0.863375,
-    0.863289,
-    0.863144,
-    0.862942,
-    0.862682,
-    0.862366,
-    0.861996,
-    0.861574,
-    0.861102,
-    0.860581,
-    0.860016,
-    0.859407,
-    0.858759,
-    0.858075,
-    0.857357,
-    0.85661,
-    0.855837,
-    0.855043,
-    0.85423,
-    0.853404,
-    0.852567,
-    0.851725,
-    0.850881,
-    0.85004,
-    0.849206,
-    0.848383,
-    0.847576,
-    0.846787,
-    0.846021,
-    0.845283,
-    0.844575,
-    0.843901,
-    0.843264,
-    0.842669,
-    0.842117,
-    0.841611,
-    0.841155,
-    0.84075,
-    0.840398,
-    0.840101,
-    0.839861,
-    0.839679,
-    0.839556,
-    0.839492,
-    0.839488,
-    0.839544,
-    0.83966,
-    0.839835,
-    0.840068,
-    0.840358,
-    0.840704,
-    0.841104,
-    0.841556,
-    0.842058,
-    0.842608,
-    0.843202,
-    0.843838,
-    0.844513,
-    0.845223,
-    0.845965,
-    0.846735,
-    0.847529,
-    0.848344,
-    0.849175,
-    0.850019,
-    0.85087,
-    0.851726,
-    0.852581,
-    0.853431,
-    0.854272,
-    0.855101,
-    0.855912,
-    0.856701,
-    0.857466,
-    0.858201,
-    0.858904,
-    0.859571,
-    0.860197,
-    0.860782,
-    0.86132,
-    0.86181,
-    0.862249,
-    0.862635,
-    0.862966,
-    0.86324,
-    0.863456,
-    0.863612,
-    0.863709,
-    0.863744,
-    0.863719,
-    0.863633,
-    0.863487,
-    0.863281,
-    0.863015,
-    0.862693,
-    0.862314,
-    0.861882,
-    0.861397,
-    0.860862,
-    0.860281,
-    0.859655,
-    0.858988,
-    0.858283,
-    0.857544,
-    0.856775,
-    0.855978,
-    0.855158,
-    0.854319,
-    0.853466,
-    0.852602,
-    0.851731,
-    0.850859,
-    0.849989,
-    0.849126,
-    0.848274,
-    0.847437,
-    0.84662,
-    0.845826,
-    0.84506,
-    0.844325,
-    0.843625,
-    0.842964,
-    0.842345,
-    0.84177,
-    0.841244,
-    0.840768,
-    0.840346,
-    0.839978,
-    0.839668,
-    0.839416,
-    0.839225,
-    0.839094,
-    0.839025,
-    0.839018,
-    0.839074,
-    0.839191,
-    0.83937,
-    0.83961,
-    0.839909,
-    0.840267,
-    0.840681,
-    0.841149,
-    0.84167,
-    0.84224,
-    0.842857,
-    0.843518,
-    0.844219,
-    0.844958,
-    0.84573,
-    0.846532,
-    0.84736,
-    0.848209,
-    0.849076,
-    0.849956,
-    0.850845,
-    0.851738,
-    0.852631,
-    0.85352,
-    0.854399,
-    0.855266,
-    0.856115,
-    0.856942,
-    0.857742,
-    0.858513,
-    0.85925,
-    0.85995,
-    0.860608,
-    0.861221,
-    0.861787,
-    0.862303,
-    0.862765,
-    0.863172,
-    0.863522,
-    0.863812,
-    0.864041,
-    0.864208,
-    0.864312,
-    0.864352,
-    0.864329,
-    0.864241,
-    0.86409,
-    0.863876,
-    0.8636,
-    0.863264,
-    0.862868,
-    0.862415,
-    0.861908,
-    0.861348,
-    0.860738,
-    0.860081,
-    0.859381,
-    0.85864,
-    0.857863,
-    0.857053,
-    0.856215,
-    0.855351,
-    0.854468,
-    0.853568,
-    0.852657,
-    0.851739,
-    0.850818,
-    0.849899,
-    0.848988,
-    0.848087,
-    0.847202,
-    0.846337,
-    0.845497,
-    0.844686,
-    0.843907,
-    0.843165,
-    0.842464,
-    0.841806,
-    0.841196,
-    0.840637,
-    0.840131,
-    0.83968,
-    0.839288,
-    0.838957,
-    0.838687,
-    0.838481,
-    0.83834,
-    0.838264,
-    0.838254,
-    0.83831,
-    0.838432,
-    0.838619,
-    0.838871,
-    0.839186,
-    0.839564,
-    0.840001,
-    0.840497,
-    0.841048,
-    0.841652,
-    0.842307,
-    0.843008,
-    0.843753,
-    0.844538,
-    0.845359,
-    0.846213,
-    0.847094,
-    0.847998,
-    0.848922,
-    0.84986,
-    0.850807,
-    0.851761,
-    0.852714,
-    0.853663,
-    0.854603,
-    0.855529,
-    0.856437,
-    0.857322,
-    0.85818,
-    0.859006,
-    0.859796,
-    0.860546,
-    0.861252,
-    0.861911,
-    0.862519,
-    0.863074,
-    0.863572,
-    0.864011,
-    0.864388,
-    0.864702,
-    0.86495,
-    0.865132,
-    0.865247,
-    0.865293,
-    0.865271,
-    0.86518,
-    0.86502,
-    0.864793,
-    0.8645,
-    0.864141,
-    0.863718,
-    0.863234,
-    0.86269,
-    0.86209,
-    0.861436,
-    0.860731,
-    0.859978,
-    0.859182,
-    0.858346,
-    0.857475,
-    0.856572,
-    0.855642,
-    0.854689,
-    0.853719,
-    0.852736,
-    0.851745,
-    0.850751,
-    0.849758,
-    0.848772,
-    0.847798,
-    0.846841,
-    0.845904,
-    0.844994,
-    0.844115,
-    0.84327,
-    0.842465,
-    0.841703,
-    0.840989,
-    0.840326,
-    0.839717,
-    0.839165,
-    0.838674,
-    0.838246,
-    0.837884,
-    0.837588,
-    0.837361,
-    0.837205,
-    0.837119,
-    0.837105,
-    0.837163,
-    0.837292,
-    0.837493,
-    0.837764,
-    0.838104,
-    0.838512,
-    0.838986,
-    0.839523,
-    0.840121,
-    0.840777,
-    0.841488,
-    0.842251,
-    0.843062,
-    0.843917,
-    0.844811,
-    0.845741,
-    0.846702,
-    0.847689,
-    0.848698,
-    0.849723,
-    0.850759,
-    0.851801,
-    0.852844,
-    0.853884,
-    0.854913,
-    0.855928,
-    0.856924,
-    0.857895,
-    0.858836,
-    0.859743,
-    0.860611,
-    0.861436,
-    0.862213,
-    0.862939,
-    0.86361,
-    0.864222,
-    0.864772,
-    0.865257,
-    0.865675,
-    0.866023,
-    0.866299,
-    0.866503,
-    0.866632,
-    0.866686,
-    0.866665,
-    0.866568,
-    0.866396,
-    0.866149,
-    0.865828,
-    0.865435,
-    0.864972,
-    0.86444,
-    0.863842,
-    0.863182,
-    0.862461,
-    0.861684,
-    0.860854,
-    0.859976,
-    0.859053,
-    0.85809,
-    0.857091,
-    0.856062,
-    0.855008,
-    0.853934,
-    0.852844,
-    0.851745,
-    0.850642,
-    0.84954,
-    0.848446,
-    0.847363,
-    0.846299,
-    0.845257,
-    0.844244,
-    0.843264,
-    0.842323,
-    0.841425,
-    0.840575,
-    0.839777,
-    0.839036,
-    0.838355,
-    0.837737,
-    0.837187,
-    0.836706,
-    0.836298,
-    0.835965,
-    0.835708,
-    0.83553,
-    0.835431,
-    0.835412,
-    0.835473,
-    0.835614,
-    0.835835,
-    0.836135,
-    0.836513,
-    0.836966,
-    0.837494,
-    0.838093,
-    0.838761,
-    0.839494,
-    0.840289,
-    0.841143,
-    0.842052,
-    0.84301,
-    0.844013,
-    0.845057,
-    0.846136,
-    0.847246,
-    0.84838,
-    0.849533,
-    0.850699,
-    0.851873,
-    0.853049,
-    0.854221,
-    0.855383,
-    0.856529,
-    0.857654,
-    0.858752,
-    0.859817,
-    0.860843,
-    0.861827,
-    0.862762,
-    0.863644,
-    0.864468,
-    0.86523,
-    0.865926,
-    0.866552,
-    0.867105,
-    0.867582,
-    0.867981,
-    0.868298,
-    0.868533,
-    0.868684,
-    0.868749,
-    0.868728,
-    0.868622,
-    0.868429,
-    0.868152,
-    0.86779,
-    0.867346,
-    0.866822,
-    0.866219,
-    0.865541,
-    0.86479,
-    0.863971,
-    0.863087,
-    0.862142,
-    0.86114,
-    0.860087,
-    0.858988,
-    0.857847,
-    0.856671,
-    0.855465,
-    0.854235,
-    0.852988,
-    0.851728,
-    0.850463,
-    0.849199,
-    0.847942,
-    0.846698,
-    0.845474,
-    0.844276,
-    0.843109,
-    0.841981,
-    0.840896,
-    0.83986,
-    0.838878,
-    0.837956,
-    0.837098,
-    0.83631,
-    0.835594,
-    0.834955,
-    0.834397,
-    0.833922,
-    0.833533,
-    0.833232,
-    0.833022,
-    0.832903,
-    0.832877,
-    0.832943,
-    0.833103,
-    0.833356,
-    0.8337,
-    0.834134,
-    0.834657,
-    0.835266,
-    0.835959,
-    0.836732,
-    0.837581,
-    0.838504,
-    0.839496,
-    0.840551,
-    0.841665,
-    0.842833,
-    0.844049,
-    0.845307,
-    0.846601,
-    0.847924,
-    0.849271,
-    0.850635,
-    0.852008,
-    0.853385,
-    0.854757,
-    0.856119,
-    0.857464,
-    0.858784,
-    0.860074,
-    0.861326,
-    0.862534,
-    0.863692,
-    0.864794,
-    0.865834,
-    0.866807,
-    0.867708,
-    0.868531,
-    0.869273,
-    0.869929,
-    0.870496,
-    0.870971,
-    0.87135,
-    0.871632,
-    0.871814,
-    0.871896,
-    0.871876,
-    0.871754,
-    0.87153,
-    0.871206,
-    0.870781,
-    0.870258,
-    0.86964,
-    0.868928,
-    0.868125,
-    0.867236,
-    0.866264,
-    0.865215,
-    0.864092,
-    0.8629,
-    0.861647,
-    0.860337,
-    0.858977,
-    0.857574,
-    0.856134,
-    0.854664,
-    0.853171,
-    0.851663,
-    0.850147,
-    0.848632,
-    0.847123,
-    0.845629,
-    0.844158,
-    0.842716,
-    0.841312,
-    0.839952,
-    0.838643,
-    0.837392,
-    0.836206,
-    0.835091,
-    0.834053,
-    0.833096,
-    0.832228,
-    0.831451,
-    0.830771,
-    0.830192,
-    0.829716,
-    0.829347,
-    0.829087,
-    0.828938,
-    0.828901,
-    0.828977,
-    0.829167,
-    0.829469,
-    0.829883,
-    0.830408,
-    0.83104,
-    0.831779,
-    0.83262,
-    0.83356,
-    0.834595,
-    0.835719,
-    0.836929,
-    0.838219,
-    0.839581,
-    0.841011,
-    0.8425,
-    0.844043,
-    0.845631,
-    0.847258,
-    0.848914,
-    0.850593,
-    0.852285,
-    0.853982,
-    0.855677,
-    0.85736,
-    0.859022,
-    0.860657,
-    0.862255,
-    0.863807,
-    0.865307,
-    0.866747,
-    0.868118,
-    0.869413,
-    0.870626,
-    0.871751,
-    0.87278,
-    0.873709,
-    0.874532,
-    0.875244,
-    0.875842,
-    0.876321,
-    0.876679,
-    0.876913,
-    0.87702,
-    0.877001,
-    0.876854,
-    0.876578,
-    0.876176,
-    0.875647,
-    0.874995,
-    0.874221,
-    0.873328,
-    0.87232,
-    0.871202,
-    0.869979,
-    0.868655,
-    0.867237,
-    0.865732,
-    0.864146,
-    0.862486,
-    0.860761,
-    0.858979,
-    0.857149,
-    0.855278,
-    0.853377,
-    0.851454,
-    0.849518,
-    0.847581,
-    0.845651,
-    0.843737,
-    0.84185,
-    0.839999,
-    0.838194,
-    0.836444,
-    0.834757,
-    0.833144,
-    0.831612,
-    0.830169,
-    0.828824,
-    0.827584,
-    0.826455,
-    0.825444,
-    0.824557,
-    0.8238,
-    0.823176,
-    0.822691,
-    0.822346,
-    0.822146,
-    0.822092,
-    0.822185,
-    0.822426,
-    0.822814,
-    0.82335,
-    0.824031,
-    0.824855,
-    0.825819,
-    0.826919,
-    0.82815,
-    0.829508,
-    0.830986,
-    0.832579,
-    0.834278,
-    0.836077,
-    0.837966,
-    0.839938,
-    0.841983,
-    0.844092,
-    0.846253,
-    0.848458,
-    0.850695,
-    0.852954,
-    0.855223,
-    0.85749,
-    0.859746,
-    0.861978,
-    0.864174,
-    0.866325,
-    0.868418,
-    0.870443,
-    0.872389,
-    0.874245,
-    0.876002,
-    0.877651,
-    0.879181,
-    0.880585,
-    0.881854,
-    0.88298,
-    0.883958,
-    0.88478,
-    0.885442,
-    0.885939,
-    0.886267,
-    0.886422,
-    0.886403,
-    0.886208,
-    0.885837,
-    0.885289,
-    0.884566,
-    0.883671,
-    0.882605,
-    0.881374,
-    0.87998,
-    0.878431,
-    0.876732,
-    0.874891,
-    0.872915,
-    0.870813,
-    0.868594,
-    0.866269,
-    0.863847,
-    0.861341,
-    0.858762,
-    0.856121,
-    0.853432,
-    0.850708,
-    0.847962,
-    0.845208,
-    0.842458,
-    0.839728,
-    0.83703,
-    0.834379,
-    0.831788,
-    0.829271,
-    0.826841,
-    0.824512,
-    0.822295,
-    0.820203,
-    0.818249,
-    0.816442,
-    0.814794,
-    0.813315,
-    0.812013,
-    0.810898,
-    0.809976,
-    0.809254,
-    0.808739,
-    0.808435,
-    0.808345,
-    0.808473,
-    0.808821,
-    0.809388,
-    0.810176,
-    0.811181,
-    0.812402,
-    0.813835,
-    0.815476,
-    0.817318,
-    0.819354,
-    0.821577,
-    0.823978,
-    0.826546,
-    0.829272,
-    0.832142,
-    0.835146,
-    0.838268,
-    0.841496,
-    0.844813,
-    0.848205,
-    0.851656,
-    0.855148,
-    0.858666,
-    0.862192,
-    0.865707,
-    0.869196,
-    0.872638,
-    0.876018,
-    0.879317,
-    0.882517,
-    0.885602,
-    0.888554,
-    0.891356,
-    0.893992,
-    0.896448,
-    0.898708,
-    0.900758,
-    0.902586,
-    0.904177,
-    0.905523,
-    0.906611,
-    0.907433,
-    0.907981,
-    0.908249,
-    0.90823,
-    0.90792,
-    0.907317,
-    0.90642,
-    0.905228,
-    0.903742,
-    0.901967,
-    0.899905,
-    0.897563,
-    0.894949,
-    0.89207,
-    0.888937,
-    0.885562,
-    0.881958,
-    0.878139,
-    0.87412,
-    0.869918,
-    0.865552,
-    0.86104,
-    0.856403,
-    0.851661,
-    0.846836,
-    0.841952,
-    0.837032,
-    0.832099,
-    0.827179,
-    0.822295,
-    0.817475,
-    0.812742,
-    0.808122,
-    0.803641,
-    0.799324,
-    0.795196,
-    0.79128,
-    0.787602,
-    0.784184,
-    0.781049,
-    0.778218,
-    0.775713,
-    0.773551,
-    0.771753,
-    0.770333,
-    0.769309,
-    0.768693,
-    0.768497,
-    0.768733,
-    0.769409,
-    0.770531,
-    0.772105,
-    0.774132,
-    0.776614,
-    0.779549,
-    0.782933,
-    0.786761,
-    0.791023,
-    0.795711,
-    0.80081,
-    0.806307,
-    0.812183,
-    0.818419,
-    0.824995,
-    0.831885,
-    0.839063,
-    0.846503,
-    0.854173,
-    0.862042,
-    0.870075,
-    0.878238,
-    0.886492,
-    0.8948,
-    0.90312,
-    0.911412,
-    0.919631,
-    0.927735,
-    0.935678,
-    0.943415,
-    0.950899,
-    0.958084,
-    0.964922,
-    0.971367,
-    0.97737,
-    0.982885,
-    0.987864,
-    0.992262,
-    0.996032,
-    0.999129,
-    1.00151,
-    1.00313,
-    1.00395,
-    1.00393,
-    1.00303,
-    1.00122,
-    0.998449,
-    0.994698,
-    0.989932,
-    0.984123,
-    0.977245,
-    0.969275,
-    0.960192,
-    0.949979,
-    0.938619,
-    0.926101,
-    0.912416,
-    0.897557,
-    0.881521,
-    0.864309,
-    0.845923,
-    0.82637,
-    0.80566,
-    0.783805,
-    0.760821,
-    0.736728,
-    0.711547,
-    0.685305,
-    0.658028,
-    0.62975,
-    0.600503,
-    0.570324,
-    0.539255,
-    0.507336,
-    0.474612,
-    0.441131,
-    0.406942,
-    0.372096,
-    0.336647,
-    0.300649,
-    0.26416,
-    0.227237,
-    0.189941,
-    0.152331,
-    0.114469,
-    0.0764185,
-    0.038241,
-    0,
-    -0.038241,
-    -0.0764185,
-    -0.114469,
-    -0.152331,
-    -0.189941,
-    -0.227237,
-    -0.26416,
-    -0.300649,
-    -0.336647,
-    -0.372096,
-    -0.406942,
-    -0.441131,
-    -0.474612,
-    -0.507336,
-    -0.539255,
-    -0.570324,
-    -0.600503,
-    -0.62975,
-    -0.658028,
-    -0.685305,
-    -0.711547,
-    -0.736728,
-    -0.760821,
-    -0.783805,
-    -0.80566,
-    -0.82637,
-    -0.845923,
-    -0.864309,
-    -0.881521,
-    -0.897557,
-    -0.912416,
-    -0.926101,
-    -0.938619,
-    -0.949979,
-    -0.960192,
-    -0.969275,
-    -0.977245,
-    -0.984123,
-    -0.989932,
-    -0.994698,
-    -0.998449,
-    -1.00122,
-    -1.00303,
-    -1.00393,
-    -1.00395,
-    -1.00313,
-    -1.00151,
-    -0.999129,
-    -0.996032,
-    -0.992262,
-    -0.987864,
-    -0.982885,
-    -0.97737,
-    -0.971367,
-    -0.964922,
-    -0.958084,
-    -0.950899,
-    -0.943415,
-    -0.935678,
-    -0.927735,
-    -0.919631,
-    -0.911412,
-    -0.90312,
-    -0.8948,
-    -0.886492,
-    -0.878238,
-    -0.870075,
-    -0.862042,
-    -0.854173,
-    -0.846503,
-    -0.839063,
-    -0.831885,
-    -0.824995,
-    -0.818419,
-    -0.812183,
-    -0.806307,
-    -0.80081,
-    -0.795711,
-    -0.791023,
-    -0.786761,
-    -0.782933,
-    -0.779549,
-    -0.776614,
-    -0.774132,
-    -0.772105,
-    -0.770531,
-    -0.769409,
-    -0.768733,
-    -0.768497,
-    -0.768693,
-    -0.769309,
-    -0.770333,
-    -0.771753,
-    -0.773551,
-    -0.775713,
-    -0.778218,
-    -0.781049,
-    -0.784184,
-    -0.787602,
-    -0.79128,
-    -0.795196,
-    -0.799324,
-    -0.803641,
-    -0.808122,
-    -0.812742,
-    -0.817475,
-    -0.822295,
-    -0.827179,
-    -0.832099,
-    -0.837032,
-    -0.841952,
-    -0.846836,
-    -0.851661,
-    -0.856403,
-    -0.86104,
-    -0.865552,
-    -0.869918,
-    -0.87412,
-    -0.878139,
-    -0.881958,
-    -0.885562,
-    -0.888937,
-    -0.89207,
-    -0.894949,
-    -0.897563,
-    -0.899905,
-    -0.901967,
-    -0.903742,
-    -0.905228,
-    -0.90642,
-    -0.907317,
-    -0.90792,
-    -0.90823,
-    -0.908249,
-    -0.907981,
-    -0.907433,
-    -0.906611,
-    -0.905523,
-    -0.904177,
-    -0.902586,
-    -0.900758,
-    -0.898708,
-    -0.896448,
-    -0.893992,
-    -0.891356,
-    -0.888554,
-    -0.885602,
-    -0.882517,
-    -0.879317,
-    -0.876018,
-    -0.872638,
-    -0.869196,
-    -0.865707,
-    -0.862192,
-    -0.858666,
-    -0.855148,
-    -0.851656,
-    -0.848205,
-    -0.844813,
-    -0.841496,
-    -0.838268,
-    -0.835146,
-    -0.832142,
-    -0.829272,
-    -0.826546,
-    -0.823978,
-    -0.821577,
-    -0.819354,
-    -0.817318,
-    -0.815476,
-    -0.813835,
-    -0.812402,
-    -0.811181,
-    -0.810176,
-    -0.809388,
-    -0.808821,
-    -0.808473,
-    -0.808345,
-    -0.808435,
-    -0.808739,
-    -0.809254,
-    -0.809976,
-    -0.810898,
-    -0.812013,
-    -0.813315,
-    -0.814794,
-    -0.816442,
-    -0.818249,
-    -0.820203,
-    -0.822295,
-    -0.824512,
-    -0.826841,
-    -0.829271,
-    -0.831788,
-    -0.834379,
-    -0.83703,
-    -0.839728,
-    -0.842458,
-    -0.845208,
-    -0.847962,
-    -0.850708,
-    -0.853432,
-    -0.856121,
-    -0.858762,
-    -0.861341,
-    -0.863847,
-    -0.866269,
-    -0.868594,
-    -0.870813,
-    -0.872915,
-    -0.874891,
-    -0.876732,
-    -0.878431,
-    -0.87998,
-    -0.881374,
-    -0.882605,
-    -0.883671,
-    -0.884566,
-    -0.885289,
-    -0.885837,
-    -0.886208,
-    -0.886403,
-    -0.886422,
-    -0.886267,
-    -0.885939,
-    -0.885442,
-    -0.88478,
-    -0.883958,
-    -0.88298,
-    -0.881854,
-    -0.880585,
-    -0.879181,
-    -0.877651,
-    -0.876002,
-    -0.874245,
-    -0.872389,
-    -0.870443,
-    -0.868418,
-    -0.866325,
-    -0.864174,
-    -0.861978,
-    -0.859746,
-    -0.85749,
-    -0.855223,
-    -0.852954,
-    -0.850695,
-    -0.848458,
-    -0.846253,
-    -0.844092,
-    -0.841983,
-    -0.839938,
-    -0.837966,
-    -0.836077,
-    -0.834278,
-    -0.832579,
-    -0.830986,
-    -0.829508,
-    -0.82815,
-    -0.826919,
-    -0.825819,
-    -0.824855,
-    -0.824031,
-    -0.82335,
-    -0.822814,
-    -0.822426,
-    -0.822185,
-    -0.822092,
-    -0.822146,
-    -0.822346,
-    -0.822691,
-    -0.823176,
-    -0.8238,
-    -0.824557,
-    -0.825444,
-    -0.826455,
-    -0.827584,
-    -0.828824,
-    -0.830169,
-    -0.831612,
-    -0.833144,
-    -0.834757,
-    -0.836444,
-    -0.838194,
-    -0.839999,
-    -0.84185,
-    -0.843737,
-    -0.845651,
-    -0.847581,
-    -0.849518,
-    -0.851454,
-    -0.853377,
-    -0.855278,
-    -0.857149,
-    -0.858979,
-    -0.860761,
-    -0.862486,
-    -0.864146,
-    -0.865732,
-    -0.867237,
-    -0.868655,
-    -0.869979,
-    -0.871202,
-    -0.87232,
-    -0.873328,
-    -0.874221,
-    -0.874995,
-    -0.875647,
-    -0.876176,
-    -0.876578,
-    -0.876854,
-    -0.877001,
-    -0.87702,
-    -0.876913,
-    -0.876679,
-    -0.876321,
-    -0.875842,
-    -0.875244,
-    -0.874532,
-    -0.873709,
-    -0.87278,
-    -0.871751,
-    -0.870626,
-    -0.869413,
-    -0.868118,
-    -0.866747,
-    -0.865307,
-    -0.863807,
-    -0.862255,
-    -0.860657,
-    -0.859022,
-    -0.85736,
-    -0.855677,
-    -0.853982,
-    -0.852285,
-    -0.850593,
-    -0.848914,
-    -0.847258,
-    -0.845631,
-    -0.844043,
-    -0.8425,
-    -0.841011,
-    -0.839581,
-    -0.838219,
-    -0.836929,
-    -0.835719,
-    -0.834595,
-    -0.83356,
-    -0.83262,
-    -0.831779,
-    -0.83104,
-    -0.830408,
-    -0.829883,
-    -0.829469,
-    -0.829167,
-    -0.828977,
-    -0.828901,
-    -0.828938,
-    -0.829087,
-    -0.829347,
-    -0.829716,
-    -0.830192,
-    -0.830771,
-    -0.831451,
-    -0.832228,
-    -0.833096,
-    -0.834053,
-    -0.835091,
-    -0.836206,
-    -0.837392,
-    -0.838643,
-    -0.839952,
-    -0.841312,
-    -0.842716,
-    -0.844158,
-    -0.845629,
-    -0.847123,
-    -0.848632,
-    -0.850147,
-    -0.851663,
-    -0.853171,
-    -0.854664,
-    -0.856134,
-    -0.857574,
-    -0.858977,
-    -0.860337,
-    -0.861647,
-    -0.8629,
-    -0.864092,
-    -0.865215,
-    -0.866264,
-    -0.867236,
-    -0.868125,
-    -0.868928,
-    -0.86964,
-    -0.870258,
-    -0.870781,
-    -0.871206,
-    -0.87153,
-    -0.871754,
-    -0.871876,
-    -0.871896,
-    -0.871814,
-    -0.871632,
-    -0.87135,
-    -0.870971,
-    -0.870496,
-    -0.869929,
-    -0.869273,
-    -0.868531,
-    -0.867708,
-    -0.866807,
-    -0.865834,
-    -0.864794,
-    -0.863692,
-    -0.862534,
-    -0.861326,
-    -0.860074,
-    -0.858784,
-    -0.857464,
-    -0.856119,
-    -0.854757,
-    -0.853385,
-    -0.852008,
-    -0.850635,
-    -0.849271,
-    -0.847924,
-    -0.846601,
-    -0.845307,
-    -0.844049,
-    -0.842833,
-    -0.841665,
-    -0.840551,
-    -0.839496,
-    -0.838504,
-    -0.837581,
-    -0.836732,
-    -0.835959,
-    -0.835266,
-    -0.834657,
-    -0.834134,
-    -0.8337,
-    -0.833356,
-    -0.833103,
-    -0.832943,
-    -0.832877,
-    -0.832903,
-    -0.833022,
-    -0.833232,
-    -0.833533,
-    -0.833922,
-    -0.834397,
-    -0.834955,
-    -0.835594,
-    -0.83631,
-    -0.837098,
-    -0.837956,
-    -0.838878,
-    -0.83986,
-    -0.840896,
-    -0.841981,
-    -0.843109,
-    -0.844276,
-    -0.845474,
-    -0.846698,
-    -0.847942,
-    -0.849199,
-    -0.850463,
-    -0.851728,
-    -0.852988,
-    -0.854235,
-    -0.855465,
-    -0.856671,
-    -0.857847,
-    -0.858988,
-    -0.860087,
-    -0.86114,
-    -0.862142,
-    -0.863087,
-    -0.863971,
-    -0.86479,
-    -0.865541,
-    -0.866219,
-    -0.866822,
-    -0.867346,
-    -0.86779,
-    -0.868152,
-    -0.868429,
-    -0.868622,
-    -0.868728,
-    -0.868749,
-    -0.868684,
-    -0.868533,
-    -0.868298,
-    -0.867981,
-    -0.867582,
-    -0.867105,
-    -0.866552,
-    -0.865926,
-    -0.86523,
-    -0.864468,
-    -0.863644,
-    -0.862762,
-    -0.861827,
-    -0.860843,
-    -0.859817,
-    -0.858752,
-    -0.857654,
-    -0.856529,
-    -0.855383,
-    -0.854221,
-    -0.853049,
-    -0.851873,
-    -0.850699,
-    -0.849533,
-    -0.84838,
-    -0.847246,
-    -0.846136,
-    -0.845057,
-    -0.844013,
-    -0.84301,
-    -0.842052,
-    -0.841143,
-    -0.840289,
-    -0.839494,
-    -0.838761,
-    -0.838093,
-    -0.837494,
-    -0.836966,
-    -0.836513,
-    -0.836135,
-    -0.835835,
-    -0.835614,
-    -0.835473,
-    -0.835412,
-    -0.835431,
-    -0.83553,
-    -0.835708,
-    -0.835965,
-    -0.836298,
-    -0.836706,
-    -0.837187,
-    -0.837737,
-    -0.838355,
-    -0.839036,
-    -0.839777,
-    -0.840575,
-    -0.841425,
-    -0.842323,
-    -0.843264,
-    -0.844244,
-    -0.845257,
-    -0.846299,
-    -0.847363,
-    -0.848446,
-    -0.84954,
-    -0.850642,
-    -0.851745,
-    -0.852844,
-    -0.853934,
-    -0.855008,
-    -0.856062,
-    -0.857091,
-    -0.85809,
-    -0.859053,
-    -0.859976,
-    -0.860854,
-    -0.861684,
-    -0.862461,
-    -0.863182,
-    -0.863842,
-    -0.86444,
-    -0.864972,
-    -0.865435,
-    -0.865828,
-    -0.866149,
-    -0.866396,
-    -0.866568,
-    -0.866665,
-    -0.866686,
-    -0.866632,
-    -0.866503,
-    -0.866299,
-    -0.866023,
-    -0.865675,
-    -0.865257,
-    -0.864772,
-    -0.864222,
-    -0.86361,
-    -0.862939,
-    -0.862213,
-    -0.861436,
-    -0.860611,
-    -0.859743,
-    -0.858836,
-    -0.857895,
-    -0.856924,
-    -0.855928,
-    -0.854913,
-    -0.853884,
-    -0.852844,
-    -0.851801,
-    -0.850759,
-    -0.849723,
-    -0.848698,
-    -0.847689,
-    -0.846702,
-    -0.845741,
-    -0.844811,
-    -0.843917,
-    -0.843062,
-    -0.842251,
-    -0.841488,
-    -0.840777,
-    -0.840121,
-    -0.839523,
-    -0.838986,
-    -0.838512,
-    -0.838104,
-    -0.837764,
-    -0.837493,
-    -0.837292,
-    -0.837163,
-    -0.837105,
-    -0.837119,
-    -0.837205,
-    -0.837361,
-    -0.837588,
-    -0.837884,
-    -0.838246,
-    -0.838674,
-    -0.839165,
-    -0.839717,
-    -0.840326,
-    -0.840989,
-    -0.841703,
-    -0.842465,
-    -0.84327,
-    -0.844115,
-    -0.844994,
-    -0.845904,
-    -0.846841,
-    -0.847798,
-    -0.848772,
-    -0.849758,
-    -0.850751,
-    -0.851745,
-    -0.852736,
-    -0.853719,
-    -0.854689,
-    -0.855642,
-    -0.856572,
-    -0.857475,
-    -0.858346,
-    -0.859182,
-    -0.859978,
-    -0.860731,
-    -0.861436,
-    -0.86209,
-    -0.86269,
-    -0.863234,
-    -0.863718,
-    -0.864141,
-    -0.8645,
-    -0.864793,
-    -0.86502,
-    -0.86518,
-    -0.865271,
-    -0.865293,
-    -0.865247,
-    -0.865132,
-    -0.86495,
-    -0.864702,
-    -0.864388,
-    -0.864011,
-    -0.863572,
-    -0.863074,
-    -0.862519,
-    -0.861911,
-    -0.861252,
-    -0.860546,
-    -0.859796,
-    -0.859006,
-    -0.85818,
-    -0.857322,
-    -0.856437,
-    -0.855529,
-    -0.854603,
-    -0.853663,
-    -0.852714,
-    -0.851761,
-    -0.850807,
-    -0.84986,
-    -0.848922,
-    -0.847998,
-    -0.847094,
-    -0.846213,
-    -0.845359,
-    -0.844538,
-    -0.843753,
-    -0.843008,
-    -0.842307,
-    -0.841652,
-    -0.841048,
-    -0.840497,
-    -0.840001,
-    -0.839564,
-    -0.839186,
-    -0.838871,
-    -0.838619,
-    -0.838432,
-    -0.83831,
-    -0.838254,
-    -0.838264,
-    -0.83834,
-    -0.838481,
-    -0.838687,
-    -0.838957,
-    -0.839288,
-    -0.83968,
-    -0.840131,
-    -0.840637,
-    -0.841196,
-    -0.841806,
-    -0.842464,
-    -0.843165,
-    -0.843907,
-    -0.844686,
-    -0.845497,
-    -0.846337,
-    -0.847202,
-    -0.848087,
-    -0.848988,
-    -0.849899,
-    -0.850818,
-    -0.851739,
-    -0.852657,
-    -0.853568,
-    -0.854468,
-    -0.855351,
-    -0.856215,
-    -0.857053,
-    -0.857863,
-    -0.85864,
-    -0.859381,
-    -0.860081,
-    -0.860738,
-    -0.861348,
-    -0.861908,
-    -0.862415,
-    -0.862868,
-    -0.863264,
-    -0.8636,
-    -0.863876,
-    -0.86409,
-    -0.864241,
-    -0.864329,
-    -0.864352,
-    -0.864312,
-    -0.864208,
-    -0.864041,
-    -0.863812,
-    -0.863522,
-    -0.863172,
-    -0.862765,
-    -0.862303,
-    -0.861787,
-    -0.861221,
-    -0.860608,
-    -0.85995,
-    -0.85925,
-    -0.858513,
-    -0.857742,
-    -0.856942,
-    -0.856115,
-    -0.855266,
-    -0.854399,
-    -0.85352,
-    -0.852631,
-    -0.851738,
-    -0.850845,
-    -0.849956,
-    -0.849076,
-    -0.848209,
-    -0.84736,
-    -0.846532,
-    -0.84573,
-    -0.844958,
-    -0.844219,
-    -0.843518,
-    -0.842857,
-    -0.84224,
-    -0.84167,
-    -0.841149,
-    -0.840681,
-    -0.840267,
-    -0.839909,
-    -0.83961,
-    -0.83937,
-    -0.839191,
-    -0.839074,
-    -0.839018,
-    -0.839025,
-    -0.839094,
-    -0.839225,
-    -0.839416,
-    -0.839668,
-    -0.839978,
-    -0.840346,
-    -0.840768,
-    -0.841244,
-    -0.84177,
-    -0.842345,
-    -0.842964,
-    -0.843625,
-    -0.844325,
-    -0.84506,
-    -0.845826,
-    -0.84662,
-    -0.847437,
-    -0.848274,
-    -0.849126,
-    -0.849989,
-    -0.850859,
-    -0.851731,
-    -0.852602,
-    -0.853466,
-    -0.854319,
-    -0.855158,
-    -0.855978,
-    -0.856775,
-    -0.857544,
-    -0.858283,
-    -0.858988,
-    -0.859655,
-    -0.860281,
-    -0.860862,
-    -0.861397,
-    -0.861882,
-    -0.862314,
-    -0.862693,
-    -0.863015,
-    -0.863281,
-    -0.863487,
-    -0.863633,
-    -0.863719,
-    -0.863744,
-    -0.863709,
-    -0.863612,
-    -0.863456,
-    -0.86324,
-    -0.862966,
-    -0.862635,
-    -0.862249,
-    -0.86181,
-    -0.86132,
-    -0.860782,
-    -0.860197,
-    -0.859571,
-    -0.858904,
-    -0.858201,
-    -0.857466,
-    -0.856701,
-    -0.855912,
-    -0.855101,
-    -0.854272,
-    -0.853431,
-    -0.852581,
-    -0.851726,
-    -0.85087,
-    -0.850019,
-    -0.849175,
-    -0.848344,
-    -0.847529,
-    -0.846735,
-    -0.845965,
-    -0.845223,
-    -0.844513,
-    -0.843838,
-    -0.843202,
-    -0.842608,
-    -0.842058,
-    -0.841556,
-    -0.841104,
-    -0.840704,
-    -0.840358,
-    -0.840068,
-    -0.839835,
-    -0.83966,
-    -0.839544,
-    -0.839488,
-    -0.839492,
-    -0.839556,
-    -0.839679,
-    -0.839861,
-    -0.840101,
-    -0.840398,
-    -0.84075,
-    -0.841155,
-    -0.841611,
-    -0.842117,
-    -0.842669,
-    -0.843264,
-    -0.843901,
-    -0.844575,
-    -0.845283,
-    -0.846021,
-    -0.846787,
-    -0.847576,
-    -0.848383,
-    -0.849206,
-    -0.85004,
-    -0.850881,
-    -0.851725,
-    -0.852567,
-    -0.853404,
-    -0.85423,
-    -0.855043,
-    -0.855837,
-    -0.85661,
-    -0.857357,
-    -0.858075,
-    -0.858759,
-    -0.859407,
-    -0.860016,
-    -0.860581,
-    -0.861102,
-    -0.861574,
-    -0.861996,
-    -0.862366,
-    -0.862682,
-    -0.862942,
-    -0.863144,
-    -0.863289,
-    -0.863375,
-    -0.863402,
-    -0.86337,
-    -0.863279,
-    -0.863129,
-    -0.862922,
-    -0.862658,
-    -0.862338,
-    -0.861965,
-    -0.861539,
-    -0.861064,
-    -0.860542,
-    -0.859975,
-    -0.859366,
-    -0.858718,
-    -0.858034,
-    -0.857318,
-    -0.856574,
-    -0.855805,
-    -0.855014,
-    -0.854207,
-    -0.853386,
-    -0.852556,
-    -0.851721,
-    -0.850885,
-    -0.850053,
-    -0.849229,
-    -0.848416,
-    -0.847618,
-    -0.846841,
-    -0.846086,
-    -0.845359,
-    -0.844663,
-    -0.844001,
-    -0.843377,
-    -0.842793,
-    -0.842253,
-    -0.841759,
-    -0.841314,
-    -0.84092,
-    -0.840578,
-    -0.840291,
-    -0.84006,
-    -0.839887,
-    -0.839771,
-    -0.839713,
-    -0.839714,
-    -0.839774,
-    -0.839893,
-    -0.840069,
-    -0.840302,
-    -0.840591,
-    -0.840935,
-    -0.841331,
-    -0.841777,
-    -0.842272,
-    -0.842813,
-    -0.843397,
-    -0.844022,
-    -0.844683,
-    -0.845379,
-    -0.846105,
-    -0.846858,
-    -0.847634,
-    -0.848429,
-    -0.849239,
-    -0.850061,
-    -0.850889,
-    -0.851721,
-    -0.852552,
-    -0.853377,
-    -0.854193,
-    -0.854996,
-    -0.855781,
-    -0.856545,
-    -0.857284,
-    -0.857994,
-    -0.858671,
-    -0.859313,
-    -0.859916,
-    -0.860478,
-    -0.860994,
-    -0.861463,
-    -0.861883,
-    -0.862251,
-    -0.862566,
-    -0.862826,
-    -0.863029,
-    -0.863175,
-    -0.863263,
-    -0.863292,
-    -0.863263,
-    -0.863175,
-    -0.863029,
-    -0.862826,
-    -0.862566,
-    -0.862251,
-    -0.861883,
-    -0.861463,
-    -0.860994,
-    -0.860478,
-    -0.859916,
-    -0.859313,
-    -0.858671,
-    -0.857994,
-    -0.857284,
-    -0.856545,
-    -0.855781,
-    -0.854996,
-    -0.854193,
-    -0.853377,
-    -0.852552,
-    -0.851721,
-    -0.850889,
-    -0.850061,
-    -0.849239,
-    -0.848429,
-    -0.847634,
-    -0.846858,
-    -0.846105,
-    -0.845379,
-    -0.844683,
-    -0.844022,
-    -0.843397,
-    -0.842813,
-    -0.842272,
-    -0.841777,
-    -0.841331,
-    -0.840935,
-    -0.840591,
-    -0.840302,
-    -0.840069,
-    -0.839893,
-    -0.839774,
-    -0.839714,
-    -0.839713,
-    -0.839771,
-    -0.839887,
-    -0.84006,
-    -0.840291,
-    -0.840578,
-    -0.84092,
-    -0.841314,
-    -0.841759,
-    -0.842253,
-    -0.842793,
-    -0.843377,
-    -0.844001,
-    -0.844663,
-    -0.845359,
-    -0.846086,
-    -0.846841,
-    -0.847618,
-    -0.848416,
-    -0.849229,
-    -0.850053,
-    -0.850885,
-    -0.851721,
-    -0.852556,
-    -0.853386,
-    -0.854207,
-    -0.855014,
-    -0.855805,
-    -0.856574,
-    -0.857318,
-    -0.858034,
-    -0.858718,
-    -0.859366,
-    -0.859975,
-    -0.860542,
-    -0.861064,
-    -0.861539,
-    -0.861965,
-    -0.862338,
-    -0.862658,
-    -0.862922,
-    -0.863129,
-    -0.863279,
-    -0.86337,
-    -0.863402,
-    -0.863375,
-    -0.863289,
-    -0.863144,
-    -0.862942,
-    -0.862682,
-    -0.862366,
-    -0.861996,
-    -0.861574,
-    -0.861102,
-    -0.860581,
-    -0.860016,
-    -0.859407,
-    -0.858759,
-    -0.858075,
-    -0.857357,
-    -0.85661,
-    -0.855837,
-    -0.855043,
-    -0.85423,
-    -0.853404,
-    -0.852567,
-    -0.851725,
-    -0.850881,
-    -0.85004,
-    -0.849206,
-    -0.848383,
-    -0.847576,
-    -0.846787,
-    -0.846021,
-    -0.845283,
-    -0.844575,
-    -0.843901,
-    -0.843264,
-    -0.842669,
-    -0.842117,
-    -0.841611,
-    -0.841155,
-    -0.84075,
-    -0.840398,
-    -0.840101,
-    -0.839861,
-    -0.839679,
-    -0.839556,
-    -0.839492,
-    -0.839488,
-    -0.839544,
-    -0.83966,
-    -0.839835,
-    -0.840068,
-    -0.840358,
-    -0.840704,
-    -0.841104,
-    -0.841556,
-    -0.842058,
-    -0.842608,
-    -0.843202,
-    -0.843838,
-    -0.844513,
-    -0.845223,
-    -0.845965,
-    -0.846735,
-    -0.847529,
-    -0.848344,
-    -0.849175,
-    -0.850019,
-    -0.85087,
-    -0.851726,
-    -0.852581,
-    -0.853431,
-    -0.854272,
-    -0.855101,
-    -0.855912,
-    -0.856701,
-    -0.857466,
-    -0.858201,
-    -0.858904,
-    -0.859571,
-    -0.860197,
-    -0.860782,
-    -0.86132,
-    -0.86181,
-    -0.862249,
-    -0.862635,
-    -0.862966,
-    -0.86324,
-    -0.863456,
-    -0.863612,
-    -0.863709,
-    -0.863744,
-    -0.863719,
-    -0.863633,
-    -0.863487,
-    -0.863281,
-    -0.863015,
-    -0.862693,
-    -0.862314,
-    -0.861882,
-    -0.861397,
-    -0.860862,
-    -0.860281,
-    -0.859655,
-    -0.858988,
-    -0.858283,
-    -0.857544,
-    -0.856775,
-    -0.855978,
-    -0.855158,
-    -0.854319,
-    -0.853466,
-    -0.852602,
-    -0.851731,
-    -0.850859,
-    -0.849989,
-    -0.849126,
-    -0.848274,
-    -0.847437,
-    -0.84662,
-    -0.845826,
-    -0.84506,
-    -0.844325,
-    -0.843625,
-    -0.842964,
-    -0.842345,
-    -0.84177,
-    -0.841244,
-    -0.840768,
-    -0.840346,
-    -0.839978,
-    -0.839668,
-    -0.839416,
-    -0.839225,
-    -0.839094,
-    -0.839025,
-    -0.839018,
-    -0.839074,
-    -0.839191,
-    -0.83937,
-    -0.83961,
-    -0.839909,
-    -0.840267,
-    -0.840681,
-    -0.841149,
-    -0.84167,
-    -0.84224,
-    -0.842857,
-    -0.843518,
-    -0.844219,
-    -0.844958,
-    -0.84573,
-    -0.846532,
-    -0.84736,
-    -0.848209,
-    -0.849076,
-    -0.849956,
-    -0.850845,
-    -0.851738,
-    -0.852631,
-    -0.85352,
-    -0.854399,
-    -0.855266,
-    -0.856115,
-    -0.856942,
-    -0.857742,
-    -0.858513,
-    -0.85925,
-    -0.85995,
-    -0.860608,
-    -0.861221,
-    -0.861787,
-    -0.862303,
-    -0.862765,
-    -0.863172,
-    -0.863522,
-    -0.863812,
-    -0.864041,
-    -0.864208,
-    -0.864312,
-    -0.864352,
-    -0.864329,
-    -0.864241,
-    -0.86409,
-    -0.863876,
-    -0.8636,
-    -0.863264,
-    -0.862868,
-    -0.862415,
-    -0.861908,
-    -0.861348,
-    -0.860738,
-    -0.860081,
-    -0.859381,
-    -0.85864,
-    -0.857863,
-    -0.857053,
-    -0.856215,
-    -0.855351,
-    -0.854468,
-    -0.853568,
-    -0.852657,
-    -0.851739,
-    -0.850818,
-    -0.849899,
-    -0.848988,
-    -0.848087,
-    -0.847202,
-    -0.846337,
-    -0.845497,
-    -0.844686,
-    -0.843907,
-    -0.843165,
-    -0.842464,
-    -0.841806,
-    -0.841196,
-    -0.840637,
-    -0.840131,
-    -0.83968,
-    -0.839288,
-    -0.838957,
-    -0.838687,
-    -0.838481,
-    -0.83834,
-    -0.838264,
-    -0.838254,
-    -0.83831,
-    -0.838432,
-    -0.838619,
-    -0.838871,
-    -0.839186,
-    -0.839564,
-    -0.840001,
-    -0.840497,
-    -0.841048,
-    -0.841652,
-    -0.842307,
-    -0.843008,
-    -0.843753,
-    -0.844538,
-    -0.845359,
-    -0.846213,
-    -0.847094,
-    -0.847998,
-    -0.848922,
-    -0.84986,
-    -0.850807,
-    -0.851761,
-    -0.852714,
-    -0.853663,
-    -0.854603,
-    -0.855529,
-    -0.856437,
-    -0.857322,
-    -0.85818,
-    -0.859006,
-    -0.859796,
-    -0.860546,
-    -0.861252,
-    -0.861911,
-    -0.862519,
-    -0.863074,
-    -0.863572,
-    -0.864011,
-    -0.864388,
-    -0.864702,
-    -0.86495,
-    -0.865132,
-    -0.865247,
-    -0.865293,
-    -0.865271,
-    -0.86518,
-    -0.86502,
-    -0.864793,
-    -0.8645,
-    -0.864141,
-    -0.863718,
-    -0.863234,
-    -0.86269,
-    -0.86209,
-    -0.861436,
-    -0.860731,
-    -0.859978,
-    -0.859182,
-    -0.858346,
-    -0.857475,
-    -0.856572,
-    -0.855642,
-    -0.854689,
-    -0.853719,
-    -0.852736,
-    -0.851745,
-    -0.850751,
-    -0.849758,
-    -0.848772,
-    -0.847798,
-    -0.846841,
-    -0.845904,
-    -0.844994,
-    -0.844115,
-    -0.84327,
-    -0.842465,
-    -0.841703,
-    -0.840989,
-    -0.840326,
-    -0.839717,
-    -0.839165,
-    -0.838674,
-    -0.838246,
-    -0.837884,
-    -0.837588,
-    -0.837361,
-    -0.837205,
-    -0.837119,
-    -0.837105,
-    -0.837163,
-    -0.837292,
-    -0.837493,
-    -0.837764,
-    -0.838104,
-    -0.838512,
-    -0.838986,
-    -0.839523,
-    -0.840121,
-    -0.840777,
-    -0.841488,
-    -0.842251,
-    -0.843062,
-    -0.843917,
-    -0.844811,
-    -0.845741,
-    -0.846702,
-    -0.847689,
-    -0.848698,
-    -0.849723,
-    -0.850759,
-    -0.851801,
-    -0.852844,
-    -0.853884,
-    -0.854913,
-    -0.855928,
-    -0.856924,
-    -0.857895,
-    -0.858836,
-    -0.859743,
-    -0.860611,
-    -0.861436,
-    -0.862213,
-    -0.862939,
-    -0.86361,
-    -0.864222,
-    -0.864772,
-    -0.865257,
-    -0.865675,
-    -0.866023,
-    -0.866299,
-    -0.866503,
-    -0.866632,
-    -0.866686,
-    -0.866665,
-    -0.866568,
-    -0.866396,
-    -0.866149,
-    -0.865828,
-    -0.865435,
-    -0.864972,
-    -0.86444,
-    -0.863842,
-    -0.863182,
-    -0.862461,
-    -0.861684,
-    -0.860854,
-    -0.859976,
-    -0.859053,
-    -0.85809,
-    -0.857091,
-    -0.856062,
-    -0.855008,
-    -0.853934,
-    -0.852844,
-    -0.851745,
-    -0.850642,
-    -0.84954,
-    -0.848446,
-    -0.847363,
-    -0.846299,
-    -0.845257,
-    -0.844244,
-    -0.843264,
-    -0.842323,
-    -0.841425,
-    -0.840575,
-    -0.839777,
-    -0.839036,
-    -0.838355,
-    -0.837737,
-    -0.837187,
-    -0.836706,
-    -0.836298,
-    -0.835965,
-    -0.835708,
-    -0.83553,
-    -0.835431,
-    -0.835412,
-    -0.835473,
-    -0.835614,
-    -0.835835,
-    -0.836135,
-    -0.836513,
-    -0.836966,
-    -0.837494,
-    -0.838093,
-    -0.838761,
-    -0.839494,
-    -0.840289,
-    -0.841143,
-    -0.842052,
-    -0.84301,
-    -0.844013,
-    -0.845057,
-    -0.846136,
-    -0.847246,
-    -0.84838,
-    -0.849533,
-    -0.850699,
-    -0.851873,
-    -0.853049,
-    -0.854221,
-    -0.855383,
-    -0.856529,
-    -0.857654,
-    -0.858752,
-    -0.859817,
-    -0.860843,
-    -0.861827,
-    -0.862762,
-    -0.863644,
-    -0.864468,
-    -0.86523,
-    -0.865926,
-    -0.866552,
-    -0.867105,
-    -0.867582,
-    -0.867981,
-    -0.868298,
-    -0.868533,
-    -0.868684,
-    -0.868749,
-    -0.868728,
-    -0.868622,
-    -0.868429,
-    -0.868152,
-    -0.86779,
-    -0.867346,
-    -0.866822,
-    -0.866219,
-    -0.865541,
-    -0.86479,
-    -0.863971,
-    -0.863087,
-    -0.862142,
-    -0.86114,
-    -0.860087,
-    -0.858988,
-    -0.857847,
-    -0.856671,
-    -0.855465,
-    -0.854235,
-    -0.852988,
-    -0.851728,
-    -0.850463,
-    -0.849199,
-    -0.847942,
-    -0.846698,
-    -0.845474,
-    -0.844276,
-    -0.843109,
-    -0.841981,
-    -0.840896,
-    -0.83986,
-    -0.838878,
-    -0.837956,
-    -0.837098,
-    -0.83631,
-    -0.835594,
-    -0.834955,
-    -0.834397,
-    -0.833922,
-    -0.833533,
-    -0.833232,
-    -0.833022,
-    -0.832903,
-    -0.832877,
-    -0.832943,
-    -0.833103,
-    -0.833356,
-    -0.8337,
-    -0.834134,
-    -0.834657,
-    -0.835266,
-    -0.835959,
-    -0.836732,
-    -0.837581,
-    -0.838504,
-    -0.839496,
-    -0.840551,
-    -0.841665,
-    -0.842833,
-    -0.844049,
-    -0.845307,
-    -0.846601,
-    -0.847924,
-    -0.849271,
-    -0.850635,
-    -0.852008,
-    -0.853385,
-    -0.854757,
-    -0.856119,
-    -0.857464,
-    -0.858784,
-    -0.860074,
-    -0.861326,
-    -0.862534,
-    -0.863692,
-    -0.864794,
-    -0.865834,
-    -0.866807,
-    -0.867708,
-    -0.868531,
-    -0.869273,
-    -0.869929,
-    -0.870496,
-    -0.870971,
-    -0.87135,
-    -0.871632,
-    -0.871814,
-    -0.871896,
-    -0.871876,
-    -0.871754,
-    -0.87153,
-    -0.871206,
-    -0.870781,
-    -0.870258,
-    -0.86964,
-    -0.868928,
-    -0.868125,
-    -0.867236,
-    -0.866264,
-    -0.865215,
-    -0.864092,
-    -0.8629,
-    -0.861647,
-    -0.860337,
-    -0.858977,
-    -0.857574,
-    -0.856134,
-    -0.854664,
-    -0.853171,
-    -0.851663,
-    -0.850147,
-    -0.848632,
-    -0.847123,
-    -0.845629,
-    -0.844158,
-    -0.842716,
-    -0.841312,
-    -0.839952,
-    -0.838643,
-    -0.837392,
-    -0.836206,
-    -0.835091,
-    -0.834053,
-    -0.833096,
-    -0.832228,
-    -0.831451,
-    -0.830771,
-    -0.830192,
-    -0.829716,
-    -0.829347,
-    -0.829087,
-    -0.828938,
-    -0.828901,
-    -0.828977,
-    -0.829167,
-    -0.829469,
-    -0.829883,
-    -0.830408,
-    -0.83104,
-    -0.831779,
-    -0.83262,
-    -0.83356,
-    -0.834595,
-    -0.835719,
-    -0.836929,
-    -0.838219,
-    -0.839581,
-    -0.841011,
-    -0.8425,
-    -0.844043,
-    -0.845631,
-    -0.847258,
-    -0.848914,
-    -0.850593,
-    -0.852285,
-    -0.853982,
-    -0.855677,
-    -0.85736,
-    -0.859022,
-    -0.860657,
-    -0.862255,
-    -0.863807,
-    -0.865307,
-    -0.866747,
-    -0.868118,
-    -0.869413,
-    -0.870626,
-    -0.871751,
-    -0.87278,
-    -0.873709,
-    -0.874532,
-    -0.875244,
-    -0.875842,
-    -0.876321,
-    -0.876679,
-    -0.876913,
-    -0.87702,
-    -0.877001,
-    -0.876854,
-    -0.876578,
-    -0.876176,
-    -0.875647,
-    -0.874995,
-    -0.874221,
-    -0.873328,
-    -0.87232,
-    -0.871202,
-    -0.869979,
-    -0.868655,
-    -0.867237,
-    -0.865732,
-    -0.864146,
-    -0.862486,
-    -0.860761,
-    -0.858979,
-    -0.857149,
-    -0.855278,
-    -0.853377,
-    -0.851454,
-    -0.849518,
-    -0.847581,
-    -0.845651,
-    -0.843737,
-    -0.84185,
-    -0.839999,
-    -0.838194,
-    -0.836444,
-    -0.834757,
-    -0.833144,
-    -0.831612,
-    -0.830169,
-    -0.828824,
-    -0.827584,
-    -0.826455,
-    -0.825444,
-    -0.824557,
-    -0.8238,
-    -0.823176,
-    -0.822691,
-    -0.822346,
-    -0.822146,
-    -0.822092,
-    -0.822185,
-    -0.822426,
-    -0.822814,
-    -0.82335,
-    -0.824031,
-    -0.824855,
-    -0.825819,
-    -0.826919,
-    -0.82815,
-    -0.829508,
-    -0.830986,
-    -0.832579,
-    -0.834278,
-    -0.836077,
-    -0.837966,
-    -0.839938,
-    -0.841983,
-    -0.844092,
-    -0.846253,
-    -0.848458,
-    -0.850695,
-    -0.852954,
-    -0.855223,
-    -0.85749,
-    -0.859746,
-    -0.861978,
-    -0.864174,
-    -0.866325,
-    -0.868418,
-    -0.870443,
-    -0.872389,
-    -0.874245,
-    -0.876002,
-    -0.877651,
-    -0.879181,
-    -0.880585,
-    -0.881854,
-    -0.88298,
-    -0.883958,
-    -0.88478,
-    -0.885442,
-    -0.885939,
-    -0.886267,
-    -0.886422,
-    -0.886403,
-    -0.886208,
-    -0.885837,
-    -0.885289,
-    -0.884566,
-    -0.883671,
-    -0.882605,
-    -0.881374,
-    -0.87998,
-    -0.878431,
-    -0.876732,
-    -0.874891,
-    -0.872915,
-    -0.870813,
-    -0.868594,
-    -0.866269,
-    -0.863847,
-    -0.861341,
-    -0.858762,
-    -0.856121,
-    -0.853432,
-    -0.850708,
-    -0.847962,
-    -0.845208,
-    -0.842458,
-    -0.839728,
-    -0.83703,
-    -0.834379,
-    -0.831788,
-    -0.829271,
-    -0.826841,
-    -0.824512,
-    -0.822295,
-    -0.820203,
-    -0.818249,
-    -0.816442,
-    -0.814794,
-    -0.813315,
-    -0.812013,
-    -0.810898,
-    -0.809976,
-    -0.809254,
-    -0.808739,
-    -0.808435,
-    -0.808345,
-    -0.808473,
-    -0.808821,
-    -0.809388,
-    -0.810176,
-    -0.811181,
-    -0.812402,
-    -0.813835,
-    -0.815476,
-    -0.817318,
-    -0.819354,
-    -0.821577,
-    -0.823978,
-    -0.826546,
-    -0.829272,
-    -0.832142,
-    -0.835146,
-    -0.838268,
-    -0.841496,
-    -0.844813,
-    -0.848205,
-    -0.851656,
-    -0.855148,
-    -0.858666,
-    -0.862192,
-    -0.865707,
-    -0.869196,
-    -0.872638,
-    -0.876018,
-    -0.879317,
-    -0.882517,
-    -0.885602,
-    -0.888554,
-    -0.891356,
-    -0.893992,
-    -0.896448,
-    -0.898708,
-    -0.900758,
-    -0.902586,
-    -0.904177,
-    -0.905523,
-    -0.906611,
-    -0.907433,
-    -0.907981,
-    -0.908249,
-    -0.90823,
-    -0.90792,
-    -0.907317,
-    -0.90642,
-    -0.905228,
-    -0.903742,
-    -0.901967,
-    -0.899905,
-    -0.897563,
-    -0.894949,
-    -0.89207,
-    -0.888937,
-    -0.885562,
-    -0.881958,
-    -0.878139,
-    -0.87412,
-    -0.869918,
-    -0.865552,
-    -0.86104,
-    -0.856403,
-    -0.851661,
-    -0.846836,
-    -0.841952,
-    -0.837032,
-    -0.832099,
-    -0.827179,
-    -0.822295,
-    -0.817475,
-    -0.812742,
-    -0.808122,
-    -0.803641,
-    -0.799324,
-    -0.795196,
-    -0.79128,
-    -0.787602,
-    -0.784184,
-    -0.781049,
-    -0.778218,
-    -0.775713,
-    -0.773551,
-    -0.771753,
-    -0.770333,
-    -0.769309,
-    -0.768693,
-    -0.768497,
-    -0.768733,
-    -0.769409,
-    -0.770531,
-    -0.772105,
-    -0.774132,
-    -0.776614,
-    -0.779549,
-    -0.782933,
-    -0.786761,
-    -0.791023,
-    -0.795711,
-    -0.80081,
-    -0.806307,
-    -0.812183,
-    -0.818419,
-    -0.824995,
-    -0.831885,
-    -0.839063,
-    -0.846503,
-    -0.854173,
-    -0.862042,
-    -0.870075,
-    -0.878238,
-    -0.886492,
-    -0.8948,
-    -0.90312,
-    -0.911412,
-    -0.919631,
-    -0.927735,
-    -0.935678,
-    -0.943415,
-    -0.950899,
-    -0.958084,
-    -0.964922,
-    -0.971367,
-    -0.97737,
-    -0.982885,
-    -0.987864,
-    -0.992262,
-    -0.996032,
-    -0.999129,
-    -1.00151,
-    -1.00313,
-    -1.00395,
-    -1.00393,
-    -1.00303,
-    -1.00122,
-    -0.998449,
-    -0.994698,
-    -0.989932,
-    -0.984123,
-    -0.977245,
-    -0.969275,
-    -0.960192,
-    -0.949979,
-    -0.938619,
-    -0.926101,
-    -0.912416,
-    -0.897557,
-    -0.881521,
-    -0.864309,
-    -0.845923,
-    -0.82637,
-    -0.80566,
-    -0.783805,
-    -0.760821,
-    -0.736728,
-    -0.711547,
-    -0.685305,
-    -0.658028,
-    -0.62975,
-    -0.600503,
-    -0.570324,
-    -0.539255,
-    -0.507336,
-    -0.474612,
-    -0.441131,
-    -0.406942,
-    -0.372096,
-    -0.336647,
-    -0.300649,
-    -0.26416,
-    -0.227237,
-    -0.189941,
-    -0.152331,
-    -0.114469,
-    -0.0764185,
-    -0.038241
-};
-
-// Top frequency: 44.1K * 0.0290249
-constexpr static std::array<float, 4096> wt_square_0x6 =
-{
-    0,
-    0.0182931,
-    0.0365792,
-    0.0548515,
-    0.073103,
-    0.0913268,
-    0.109516,
-    0.127664,
-    0.145764,
-    0.163808,
-    0.181791,
-    0.199705,
-    0.217544,
-    0.235302,
-    0.25297,
-    0.270544,
-    0.288017,
-    0.305382,
-    0.322633,
-    0.339764,
-    0.356768,
-    0.37364,
-    0.390374,
-    0.406963,
-    0.423402,
-    0.439686,
-    0.455808,
-    0.471763,
-    0.487547,
-    0.503153,
-    0.518576,
-    0.533813,
-    0.548856,
-    0.563703,
-    0.578348,
-    0.592787,
-    0.607015,
-    0.621029,
-    0.634824,
-    0.648396,
-    0.661742,
-    0.674857,
-    0.687739,
-    0.700384,
-    0.71279,
-    0.724952,
-    0.736868,
-    0.748536,
-    0.759952,
-    0.771115,
-    0.782022,
-    0.792672,
-    0.803062,
-    0.813191,
-    0.823056,
-    0.832658,
-    0.841994,
-    0.851063,
-    0.859865,
-    0.868399,
-    0.876665,
-    0.884661,
-    0.892388,
-    0.899846,
-    0.907034,
-    0.913954,
-    0.920605,
-    0.926988,
-    0.933104,
-    0.938954,
-    0.944539,
-    0.94986,
-    0.954919,
-    0.959716,
-    0.964255,
-    0.968536,
-    0.972561,
-    0.976333,
-    0.979854,
-    0.983127,
-    0.986154,
-    0.988937,
-    0.99148,
-    0.993785,
-    0.995855,
-    0.997695,
-    0.999306,
-    1.00069,
-    1.00186,
-    1.00281,
-    1.00354,
-    1.00407,
-    1.00439,
-    1.0045,
-    1.00442,
-    1.00415,
-    1.00369,
-    1.00304,
-    1.00221,
-    1.00121,
-    1.00004,
-    0.998696,
-    0.997195,
-    0.995537,
-    0.993728,
-    0.991771,
-    0.989673,
-    0.987437,
-    0.98507,
-    0.982576,
-    0.979961,
-    0.977229,
-    0.974385,
-    0.971436,
-    0.968385,
-    0.965238,
-    0.962001,
-    0.958678,
-    0.955275,
-    0.951797,
-    0.948248,
-    0.944635,
-    0.940963,
-    0.937235,
-    0.933459,
-    0.929637,
-    0.925776,
-    0.921881,
-    0.917956,
-    0.914007,
-    0.910038,
-    0.906053,
-    0.902058,
-    0.898058,
-    0.894056,
-    0.890058,
-    0.886068,
-    0.88209,
-    0.878129,
-    0.874188,
-    0.870273,
-    0.866386,
-    0.862533,
-    0.858716,
-    0.85494,
-    0.851209,
-    0.847525,
-    0.843894,
-    0.840317,
-    0.836798,
-    0.833341,
-    0.829949,
-    0.826624,
-    0.823369,
-    0.820188,
-    0.817083,
-    0.814056,
-    0.81111,
-    0.808247,
-    0.80547,
-    0.80278,
-    0.800179,
-    0.79767,
-    0.795254,
-    0.792933,
-    0.790708,
-    0.78858,
-    0.786551,
-    0.784622,
-    0.782794,
-    0.781068,
-    0.779444,
-    0.777924,
-    0.776507,
-    0.775195,
-    0.773987,
-    0.772885,
-    0.771887,
-    0.770994,
-    0.770205,
-    0.769522,
-    0.768942,
-    0.768466,
-    0.768093,
-    0.767822,
-    0.767653,
-    0.767585,
-    0.767617,
-    0.767747,
-    0.767975,
-    0.768299,
-    0.768718,
-    0.769231,
-    0.769835,
-    0.77053,
-    0.771314,
-    0.772184,
-    0.77314,
-    0.774179,
-    0.775299,
-    0.776498,
-    0.777774,
-    0.779125,
-    0.780549,
-    0.782042,
-    0.783604,
-    0.785231,
-    0.786922,
-    0.788672,
-    0.790481,
-    0.792346,
-    0.794263,
-    0.79623,
-    0.798245,
-    0.800304,
-    0.802406,
-    0.804547,
-    0.806724,
-    0.808935,
-    0.811177,
-    0.813447,
-    0.815743,
-    0.818061,
-    0.820399,
-    0.822753,
-    0.825122,
-    0.827502,
-    0.82989,
-    0.832284,
-    0.834681,
-    0.837078,
-    0.839473,
-    0.841862,
-    0.844244,
-    0.846615,
-    0.848973,
-    0.851315,
-    0.853639,
-    0.855943,
-    0.858223,
-    0.860478,
-    0.862705,
-    0.864902,
-    0.867066,
-    0.869196,
-    0.871289,
-    0.873343,
-    0.875357,
-    0.877327,
-    0.879253,
-    0.881132,
-    0.882963,
-    0.884744,
-    0.886474,
-    0.88815,
-    0.889771,
-    0.891336,
-    0.892843,
-    0.894292,
-    0.895681,
-    0.897008,
-    0.898274,
-    0.899476,
-    0.900614,
-    0.901687,
-    0.902694,
-    0.903635,
-    0.904509,
-    0.905316,
-    0.906054,
-    0.906725,
-    0.907326,
-    0.907859,
-    0.908324,
-    0.908719,
-    0.909045,
-    0.909302,
-    0.909491,
-    0.909612,
-    0.909664,
-    0.909649,
-    0.909566,
-    0.909417,
-    0.909202,
-    0.908921,
-    0.908576,
-    0.908167,
-    0.907695,
-    0.907161,
-    0.906566,
-    0.905911,
-    0.905198,
-    0.904427,
-    0.903599,
-    0.902717,
-    0.90178,
-    0.900792,
-    0.899752,
-    0.898663,
-    0.897527,
-    0.896344,
-    0.895116,
-    0.893846,
-    0.892534,
-    0.891183,
-    0.889794,
-    0.888369,
-    0.88691,
-    0.885419,
-    0.883897,
-    0.882347,
-    0.880771,
-    0.879169,
-    0.877546,
-    0.875901,
-    0.874238,
-    0.872558,
-    0.870864,
-    0.869157,
-    0.867439,
-    0.865712,
-    0.863979,
-    0.862241,
-    0.860501,
-    0.85876,
-    0.85702,
-    0.855284,
-    0.853552,
-    0.851828,
-    0.850113,
-    0.848409,
-    0.846718,
-    0.845041,
-    0.843381,
-    0.84174,
-    0.840118,
-    0.838518,
-    0.836941,
-    0.83539,
-    0.833866,
-    0.83237,
-    0.830903,
-    0.829468,
-    0.828066,
-    0.826698,
-    0.825366,
-    0.824071,
-    0.822814,
-    0.821597,
-    0.82042,
-    0.819285,
-    0.818193,
-    0.817144,
-    0.816141,
-    0.815183,
-    0.814272,
-    0.813408,
-    0.812592,
-    0.811825,
-    0.811108,
-    0.81044,
-    0.809823,
-    0.809257,
-    0.808742,
-    0.808279,
-    0.807868,
-    0.807509,
-    0.807202,
-    0.806948,
-    0.806746,
-    0.806597,
-    0.806499,
-    0.806455,
-    0.806462,
-    0.80652,
-    0.806631,
-    0.806792,
-    0.807004,
-    0.807266,
-    0.807578,
-    0.807938,
-    0.808347,
-    0.808804,
-    0.809308,
-    0.809858,
-    0.810453,
-    0.811093,
-    0.811776,
-    0.812502,
-    0.81327,
-    0.814078,
-    0.814925,
-    0.815811,
-    0.816733,
-    0.817692,
-    0.818685,
-    0.819711,
-    0.82077,
-    0.821859,
-    0.822978,
-    0.824124,
-    0.825297,
-    0.826495,
-    0.827717,
-    0.82896,
-    0.830225,
-    0.831508,
-    0.832809,
-    0.834126,
-    0.835457,
-    0.836802,
-    0.838157,
-    0.839522,
-    0.840896,
-    0.842275,
-    0.84366,
-    0.845048,
-    0.846438,
-    0.847828,
-    0.849217,
-    0.850602,
-    0.851983,
-    0.853358,
-    0.854725,
-    0.856084,
-    0.857431,
-    0.858766,
-    0.860088,
-    0.861395,
-    0.862685,
-    0.863958,
-    0.865211,
-    0.866443,
-    0.867654,
-    0.868842,
-    0.870005,
-    0.871142,
-    0.872253,
-    0.873335,
-    0.874388,
-    0.875412,
-    0.876403,
-    0.877363,
-    0.878289,
-    0.879182,
-    0.880039,
-    0.88086,
-    0.881645,
-    0.882392,
-    0.883101,
-    0.883771,
-    0.884402,
-    0.884993,
-    0.885543,
-    0.886053,
-    0.886521,
-    0.886947,
-    0.887331,
-    0.887672,
-    0.887971,
-    0.888228,
-    0.888441,
-    0.888611,
-    0.888738,
-    0.888822,
-    0.888863,
-    0.888861,
-    0.888816,
-    0.888729,
-    0.888599,
-    0.888428,
-    0.888215,
-    0.88796,
-    0.887665,
-    0.887329,
-    0.886953,
-    0.886538,
-    0.886085,
-    0.885593,
-    0.885064,
-    0.884498,
-    0.883897,
-    0.88326,
-    0.88259,
-    0.881885,
-    0.881149,
-    0.880381,
-    0.879582,
-    0.878754,
-    0.877898,
-    0.877014,
-    0.876103,
-    0.875168,
-    0.874209,
-    0.873226,
-    0.872222,
-    0.871198,
-    0.870154,
-    0.869092,
-    0.868013,
-    0.866919,
-    0.865811,
-    0.86469,
-    0.863557,
-    0.862414,
-    0.861263,
-    0.860103,
-    0.858938,
-    0.857767,
-    0.856593,
-    0.855417,
-    0.85424,
-    0.853063,
-    0.851888,
-    0.850716,
-    0.849549,
-    0.848388,
-    0.847233,
-    0.846087,
-    0.84495,
-    0.843825,
-    0.842711,
-    0.841611,
-    0.840526,
-    0.839456,
-    0.838403,
-    0.837368,
-    0.836353,
-    0.835357,
-    0.834383,
-    0.833432,
-    0.832504,
-    0.8316,
-    0.830722,
-    0.82987,
-    0.829045,
-    0.828248,
-    0.82748,
-    0.826741,
-    0.826033,
-    0.825356,
-    0.824711,
-    0.824098,
-    0.823519,
-    0.822973,
-    0.822461,
-    0.821984,
-    0.821541,
-    0.821135,
-    0.820764,
-    0.820429,
-    0.820131,
-    0.819869,
-    0.819644,
-    0.819457,
-    0.819306,
-    0.819193,
-    0.819117,
-    0.819078,
-    0.819076,
-    0.819112,
-    0.819184,
-    0.819293,
-    0.819439,
-    0.81962,
-    0.819838,
-    0.820092,
-    0.820381,
-    0.820704,
-    0.821062,
-    0.821454,
-    0.82188,
-    0.822338,
-    0.822828,
-    0.82335,
-    0.823902,
-    0.824485,
-    0.825097,
-    0.825738,
-    0.826407,
-    0.827103,
-    0.827825,
-    0.828572,
-    0.829344,
-    0.830139,
-    0.830956,
-    0.831795,
-    0.832655,
-    0.833534,
-    0.834431,
-    0.835346,
-    0.836277,
-    0.837224,
-    0.838184,
-    0.839157,
-    0.840143,
-    0.841138,
-    0.842144,
-    0.843157,
-    0.844178,
-    0.845205,
-    0.846237,
-    0.847272,
-    0.84831,
-    0.849349,
-    0.850388,
-    0.851426,
-    0.852462,
-    0.853495,
-    0.854523,
-    0.855545,
-    0.85656,
-    0.857567,
-    0.858565,
-    0.859553,
-    0.860529,
-    0.861493,
-    0.862443,
-    0.863379,
-    0.864299,
-    0.865203,
-    0.866089,
-    0.866956,
-    0.867804,
-    0.868631,
-    0.869437,
-    0.870221,
-    0.870982,
-    0.871719,
-    0.872432,
-    0.873119,
-    0.87378,
-    0.874414,
-    0.87502,
-    0.875599,
-    0.876148,
-    0.876669,
-    0.87716,
-    0.87762,
-    0.87805,
-    0.878448,
-    0.878815,
-    0.87915,
-    0.879453,
-    0.879723,
-    0.87996,
-    0.880165,
-    0.880336,
-    0.880474,
-    0.880579,
-    0.88065,
-    0.880688,
-    0.880693,
-    0.880664,
-    0.880602,
-    0.880507,
-    0.880379,
-    0.880218,
-    0.880025,
-    0.8798,
-    0.879542,
-    0.879254,
-    0.878934,
-    0.878583,
-    0.878202,
-    0.877792,
-    0.877352,
-    0.876883,
-    0.876387,
-    0.875862,
-    0.875311,
-    0.874734,
-    0.874132,
-    0.873505,
-    0.872853,
-    0.872179,
-    0.871482,
-    0.870764,
-    0.870025,
-    0.869266,
-    0.868488,
-    0.867692,
-    0.86688,
-    0.866051,
-    0.865207,
-    0.864348,
-    0.863477,
-    0.862593,
-    0.861699,
-    0.860794,
-    0.85988,
-    0.858959,
-    0.85803,
-    0.857095,
-    0.856156,
-    0.855213,
-    0.854267,
-    0.85332,
-    0.852373,
-    0.851425,
-    0.85048,
-    0.849537,
-    0.848598,
-    0.847664,
-    0.846736,
-    0.845815,
-    0.844902,
-    0.843998,
-    0.843104,
-    0.842221,
-    0.84135,
-    0.840492,
-    0.839648,
-    0.838819,
-    0.838005,
-    0.837209,
-    0.836429,
-    0.835669,
-    0.834927,
-    0.834206,
-    0.833506,
-    0.832827,
-    0.83217,
-    0.831537,
-    0.830927,
-    0.830342,
-    0.829782,
-    0.829247,
-    0.828739,
-    0.828257,
-    0.827803,
-    0.827376,
-    0.826978,
-    0.826608,
-    0.826267,
-    0.825956,
-    0.825674,
-    0.825422,
-    0.8252,
-    0.825008,
-    0.824847,
-    0.824717,
-    0.824617,
-    0.824549,
-    0.824511,
-    0.824504,
-    0.824528,
-    0.824582,
-    0.824667,
-    0.824783,
-    0.824929,
-    0.825105,
-    0.825312,
-    0.825547,
-    0.825812,
-    0.826107,
-    0.826429,
-    0.82678,
-    0.827159,
-    0.827565,
-    0.827997,
-    0.828456,
-    0.828941,
-    0.829451,
-    0.829985,
-    0.830543,
-    0.831125,
-    0.831729,
-    0.832355,
-    0.833001,
-    0.833669,
-    0.834355,
-    0.835061,
-    0.835784,
-    0.836524,
-    0.837281,
-    0.838053,
-    0.838839,
-    0.839639,
-    0.840451,
-    0.841275,
-    0.84211,
-    0.842955,
-    0.843808,
-    0.844669,
-    0.845537,
-    0.84641,
-    0.847289,
-    0.848171,
-    0.849056,
-    0.849943,
-    0.85083,
-    0.851718,
-    0.852604,
-    0.853487,
-    0.854368,
-    0.855244,
-    0.856116,
-    0.85698,
-    0.857838,
-    0.858688,
-    0.859528,
-    0.860358,
-    0.861178,
-    0.861985,
-    0.86278,
-    0.863561,
-    0.864327,
-    0.865078,
-    0.865813,
-    0.866531,
-    0.86723,
-    0.867911,
-    0.868573,
-    0.869215,
-    0.869835,
-    0.870434,
-    0.871011,
-    0.871565,
-    0.872096,
-    0.872603,
-    0.873085,
-    0.873542,
-    0.873973,
-    0.874378,
-    0.874757,
-    0.875109,
-    0.875434,
-    0.875731,
-    0.876,
-    0.876241,
-    0.876454,
-    0.876638,
-    0.876793,
-    0.876919,
-    0.877016,
-    0.877084,
-    0.877122,
-    0.877132,
-    0.877112,
-    0.877063,
-    0.876984,
-    0.876877,
-    0.876741,
-    0.876576,
-    0.876383,
-    0.876162,
-    0.875912,
-    0.875635,
-    0.875331,
-    0.875,
-    0.874642,
-    0.874259,
-    0.873849,
-    0.873415,
-    0.872955,
-    0.872472,
-    0.871965,
-    0.871435,
-    0.870883,
-    0.87031,
-    0.869715,
-    0.8691,
-    0.868465,
-    0.867812,
-    0.86714,
-    0.866451,
-    0.865746,
-    0.865025,
-    0.864289,
-    0.863539,
-    0.862775,
-    0.862,
-    0.861213,
-    0.860416,
-    0.859609,
-    0.858793,
-    0.857969,
-    0.857139,
-    0.856303,
-    0.855462,
-    0.854618,
-    0.85377,
-    0.85292,
-    0.852069,
-    0.851218,
-    0.850368,
-    0.84952,
-    0.848675,
-    0.847833,
-    0.846996,
-    0.846165,
-    0.845341,
-    0.844524,
-    0.843715,
-    0.842916,
-    0.842128,
-    0.84135,
-    0.840584,
-    0.839832,
-    0.839093,
-    0.838369,
-    0.83766,
-    0.836968,
-    0.836292,
-    0.835634,
-    0.834995,
-    0.834375,
-    0.833774,
-    0.833195,
-    0.832636,
-    0.8321,
-    0.831586,
-    0.831094,
-    0.830627,
-    0.830183,
-    0.829764,
-    0.82937,
-    0.829002,
-    0.828659,
-    0.828343,
-    0.828053,
-    0.82779,
-    0.827555,
-    0.827346,
-    0.827166,
-    0.827013,
-    0.826888,
-    0.826792,
-    0.826724,
-    0.826684,
-    0.826672,
-    0.826689,
-    0.826734,
-    0.826807,
-    0.826909,
-    0.827038,
-    0.827196,
-    0.827381,
-    0.827593,
-    0.827833,
-    0.8281,
-    0.828393,
-    0.828712,
-    0.829058,
-    0.829429,
-    0.829825,
-    0.830245,
-    0.83069,
-    0.831158,
-    0.831649,
-    0.832163,
-    0.832699,
-    0.833256,
-    0.833834,
-    0.834431,
-    0.835048,
-    0.835684,
-    0.836337,
-    0.837008,
-    0.837695,
-    0.838397,
-    0.839114,
-    0.839845,
-    0.840589,
-    0.841346,
-    0.842114,
-    0.842892,
-    0.84368,
-    0.844477,
-    0.845281,
-    0.846093,
-    0.84691,
-    0.847733,
-    0.848559,
-    0.849389,
-    0.850221,
-    0.851054,
-    0.851888,
-    0.852721,
-    0.853553,
-    0.854382,
-    0.855207,
-    0.856028,
-    0.856844,
-    0.857654,
-    0.858456,
-    0.859251,
-    0.860036,
-    0.860812,
-    0.861576,
-    0.86233,
-    0.86307,
-    0.863798,
-    0.864511,
-    0.86521,
-    0.865892,
-    0.866558,
-    0.867207,
-    0.867838,
-    0.868451,
-    0.869043,
-    0.869616,
-    0.870168,
-    0.870699,
-    0.871208,
-    0.871694,
-    0.872157,
-    0.872597,
-    0.873012,
-    0.873403,
-    0.873769,
-    0.87411,
-    0.874424,
-    0.874713,
-    0.874975,
-    0.87521,
-    0.875419,
-    0.8756,
-    0.875753,
-    0.875879,
-    0.875977,
-    0.876047,
-    0.876089,
-    0.876103,
-    0.876089,
-    0.876047,
-    0.875977,
-    0.875879,
-    0.875753,
-    0.8756,
-    0.875419,
-    0.87521,
-    0.874975,
-    0.874713,
-    0.874424,
-    0.87411,
-    0.873769,
-    0.873403,
-    0.873012,
-    0.872597,
-    0.872157,
-    0.871694,
-    0.871208,
-    0.870699,
-    0.870168,
-    0.869616,
-    0.869043,
-    0.868451,
-    0.867838,
-    0.867207,
-    0.866558,
-    0.865892,
-    0.86521,
-    0.864511,
-    0.863798,
-    0.86307,
-    0.86233,
-    0.861576,
-    0.860812,
-    0.860036,
-    0.859251,
-    0.858456,
-    0.857654,
-    0.856844,
-    0.856028,
-    0.855207,
-    0.854382,
-    0.853553,
-    0.852721,
-    0.851888,
-    0.851054,
-    0.850221,
-    0.849389,
-    0.848559,
-    0.847733,
-    0.84691,
-    0.846093,
-    0.845281,
-    0.844477,
-    0.84368,
-    0.842892,
-    0.842114,
-    0.841346,
-    0.840589,
-    0.839845,
-    0.839114,
-    0.838397,
-    0.837695,
-    0.837008,
-    0.836337,
-    0.835684,
-    0.835048,
-    0.834431,
-    0.833834,
-    0.833256,
-    0.832699,
-    0.832163,
-    0.831649,
-    0.831158,
-    0.83069,
-    0.830245,
-    0.829825,
-    0.829429,
-    0.829058,
-    0.828712,
-    0.828393,
-    0.8281,
-    0.827833,
-    0.827593,
-    0.827381,
-    0.827196,
-    0.827038,
-    0.826909,
-    0.826807,
-    0.826734,
-    0.826689,
-    0.826672,
-    0.826684,
-    0.826724,
-    0.826792,
-    0.826888,
-    0.827013,
-    0.827166,
-    0.827346,
-    0.827555,
-    0.82779,
-    0.828053,
-    0.828343,
-    0.828659,
-    0.829002,
-    0.82937,
-    0.829764,
-    0.830183,
-    0.830627,
-    0.831094,
-    0.831586,
-    0.8321,
-    0.832636,
-    0.833195,
-    0.833774,
-    0.834375,
-    0.834995,
-    0.835634,
-    0.836292,
-    0.836968,
-    0.83766,
-    0.838369,
-    0.839093,
-    0.839832,
-    0.840584,
-    0.84135,
-    0.842128,
-    0.842916,
-    0.843715,
-    0.844524,
-    0.845341,
-    0.846165,
-    0.846996,
-    0.847833,
-    0.848675,
-    0.84952,
-    0.850368,
-    0.851218,
-    0.852069,
-    0.85292,
-    0.85377,
-    0.854618,
-    0.855462,
-    0.856303,
-    0.857139,
-    0.857969,
-    0.858793,
-    0.859609,
-    0.860416,
-    0.861213,
-    0.862,
-    0.862775,
-    0.863539,
-    0.864289,
-    0.865025,
-    0.865746,
-    0.866451,
-    0.86714,
-    0.867812,
-    0.868465,
-    0.8691,
-    0.869715,
-    0.87031,
-    0.870883,
-    0.871435,
-    0.871965,
-    0.872472,
-    0.872955,
-    0.873415,
-    0.873849,
-    0.874259,
-    0.874642,
-    0.875,
-    0.875331,
-    0.875635,
-    0.875912,
-    0.876162,
-    0.876383,
-    0.876576,
-    0.876741,
-    0.876877,
-    0.876984,
-    0.877063,
-    0.877112,
-    0.877132,
-    0.877122,
-    0.877084,
-    0.877016,
-    0.876919,
-    0.876793,
-    0.876638,
-    0.876454,
-    0.876241,
-    0.876,
-    0.875731,
-    0.875434,
-    0.875109,
-    0.874757,
-    0.874378,
-    0.873973,
-    0.873542,
-    0.873085,
-    0.872603,
-    0.872096,
-    0.871565,
-    0.871011,
-    0.870434,
-    0.869835,
-    0.869215,
-    0.868573,
-    0.867911,
-    0.86723,
-    0.866531,
-    0.865813,
-    0.865078,
-    0.864327,
-    0.863561,
-    0.86278,
-    0.861985,
-    0.861178,
-    0.860358,
-    0.859528,
-    0.858688,
-    0.857838,
-    0.85698,
-    0.856116,
-    0.855244,
-    0.854368,
-    0.853487,
-    0.852604,
-    0.851718,
-    0.85083,
-    0.849943,
-    0.849056,
-    0.848171,
-    0.847289,
-    0.84641,
-    0.845537,
-    0.844669,
-    0.843808,
-    0.842955,
-    0.84211,
-    0.841275,
-    0.840451,
-    0.839639,
-    0.838839,
-    0.838053,
-    0.837281,
-    0.836524,
-    0.835784,
-    0.835061,
-    0.834355,
-    0.833669,
-    0.833001,
-    0.832355,
-    0.831729,
-    0.831125,
-    0.830543,
-    0.829985,
-    0.829451,
-    0.828941,
-    0.828456,
-    0.827997,
-    0.827565,
-    0.827159,
-    0.82678,
-    0.826429,
-    0.826107,
-    0.825812,
-    0.825547,
-    0.825312,
-    0.825105,
-    0.824929,
-    0.824783,
-    0.824667,
-    0.824582,
-    0.824528,
-    0.824504,
-    0.824511,
-    0.824549,
-    0.824617,
-    0.824717,
-    0.824847,
-    0.825008,
-    0.8252,
-    0.825422,
-    0.825674,
-    0.825956,
-    0.826267,
-    0.826608,
-    0.826978,
-    0.827376,
-    0.827803,
-    0.828257,
-    0.828739,
-    0.829247,
-    0.829782,
-    0.830342,
-    0.830927,
-    0.831537,
-    0.83217,
-    0.832827,
-    0.833506,
-    0.834206,
-    0.834927,
-    0.835669,
-    0.836429,
-    0.837209,
-    0.838005,
-    0.838819,
-    0.839648,
-    0.840492,
-    0.84135,
-    0.842221,
-    0.843104,
-    0.843998,
-    0.844902,
-    0.845815,
-    0.846736,
-    0.847664,
-    0.848598,
-    0.849537,
-    0.85048,
-    0.851425,
-    0.852373,
-    0.85332,
-    0.854267,
-    0.855213,
-    0.856156,
-    0.857095,
-    0.85803,
-    0.858959,
-    0.85988,
-    0.860794,
-    0.861699,
-    0.862593,
-    0.863477,
-    0.864348,
-    0.865207,
-    0.866051,
-    0.86688,
-    0.867692,
-    0.868488,
-    0.869266,
-    0.870025,
-    0.870764,
-    0.871482,
-    0.872179,
-    0.872853,
-    0.873505,
-    0.874132,
-    0.874734,
-    0.875311,
-    0.875862,
-    0.876387,
-    0.876883,
-    0.877352,
-    0.877792,
-    0.878202,
-    0.878583,
-    0.878934,
-    0.879254,
-    0.879542,
-    0.8798,
-    0.880025,
-    0.880218,
-    0.880379,
-    0.880507,
-    0.880602,
-    0.880664,
-    0.880693,
-    0.880688,
-    0.88065,
-    0.880579,
-    0.880474,
-    0.880336,
-    0.880165,
-    0.87996,
-    0.879723,
-    0.879453,
-    0.87915,
-    0.878815,
-    0.878448,
-    0.87805,
-    0.87762,
-    0.87716,
-    0.876669,
-    0.876148,
-    0.875599,
-    0.87502,
-    0.874414,
-    0.87378,
-    0.873119,
-    0.872432,
-    0.871719,
-    0.870982,
-    0.870221,
-    0.869437,
-    0.868631,
-    0.867804,
-    0.866956,
-    0.866089,
-    0.865203,
-    0.864299,
-    0.863379,
-    0.862443,
-    0.861493,
-    0.860529,
-    0.859553,
-    0.858565,
-    0.857567,
-    0.85656,
-    0.855545,
-    0.854523,
-    0.853495,
-    0.852462,
-    0.851426,
-    0.850388,
-    0.849349,
-    0.84831,
-    0.847272,
-    0.846237,
-    0.845205,
-    0.844178,
-    0.843157,
-    0.842144,
-    0.841138,
-    0.840143,
-    0.839157,
-    0.838184,
-    0.837224,
-    0.836277,
-    0.835346,
-    0.834431,
-    0.833534,
-    0.832655,
-    0.831795,
-    0.830956,
-    0.830139,
-    0.829344,
-    0.828572,
-    0.827825,
-    0.827103,
-    0.826407,
-    0.825738,
-    0.825097,
-    0.824485,
-    0.823902,
-    0.82335,
-    0.822828,
-    0.822338,
-    0.82188,
-    0.821454,
-    0.821062,
-    0.820704,
-    0.820381,
-    0.820092,
-    0.819838,
-    0.81962,
-    0.819439,
-    0.819293,
-    0.819184,
-    0.819112,
-    0.819076,
-    0.819078,
-    0.819117,
-    0.819193,
-    0.819306,
-    0.819457,
-    0.819644,
-    0.819869,
-    0.820131,
-    0.820429,
-    0.820764,
-    0.821135,
-    0.821541,
-    0.821984,
-    0.822461,
-    0.822973,
-    0.823519,
-    0.824098,
-    0.824711,
-    0.825356,
-    0.826033,
-    0.826741,
-    0.82748,
-    0.828248,
-    0.829045,
-    0.82987,
-    0.830722,
-    0.8316,
-    0.832504,
-    0.833432,
-    0.834383,
-    0.835357,
-    0.836353,
-    0.837368,
-    0.838403,
-    0.839456,
-    0.840526,
-    0.841611,
-    0.842711,
-    0.843825,
-    0.84495,
-    0.846087,
-    0.847233,
-    0.848388,
-    0.849549,
-    0.850716,
-    0.851888,
-    0.853063,
-    0.85424,
-    0.855417,
-    0.856593,
-    0.857767,
-    0.858938,
-    0.860103,
-    0.861263,
-    0.862414,
-    0.863557,
-    0.86469,
-    0.865811,
-    0.866919,
-    0.868013,
-    0.869092,
-    0.870154,
-    0.871198,
-    0.872222,
-    0.873226,
-    0.874209,
-    0.875168,
-    0.876103,
-    0.877014,
-    0.877898,
-    0.878754,
-    0.879582,
-    0.880381,
-    0.881149,
-    0.881885,
-    0.88259,
-    0.88326,
-    0.883897,
-    0.884498,
-    0.885064,
-    0.885593,
-    0.886085,
-    0.886538,
-    0.886953,
-    0.887329,
-    0.887665,
-    0.88796,
-    0.888215,
-    0.888428,
-    0.888599,
-    0.888729,
-    0.888816,
-    0.888861,
-    0.888863,
-    0.888822,
-    0.888738,
-    0.888611,
-    0.888441,
-    0.888228,
-    0.887971,
-    0.887672,
-    0.887331,
-    0.886947,
-    0.886521,
-    0.886053,
-    0.885543,
-    0.884993,
-    0.884402,
-    0.883771,
-    0.883101,
-    0.882392,
-    0.881645,
-    0.88086,
-    0.880039,
-    0.879182,
-    0.878289,
-    0.877363,
-    0.876403,
-    0.875412,
-    0.874388,
-    0.873335,
-    0.872253,
-    0.871142,
-    0.870005,
-    0.868842,
-    0.867654,
-    0.866443,
-    0.865211,
-    0.863958,
-    0.862685,
-    0.861395,
-    0.860088,
-    0.858766,
-    0.857431,
-    0.856084,
-    0.854725,
-    0.853358,
-    0.851983,
-    0.850602,
-    0.849217,
-    0.847828,
-    0.846438,
-    0.845048,
-    0.84366,
-    0.842275,
-    0.840896,
-    0.839522,
-    0.838157,
-    0.836802,
-    0.835457,
-    0.834126,
-    0.832809,
-    0.831508,
-    0.830225,
-    0.82896,
-    0.827717,
-    0.826495,
-    0.825297,
-    0.824124,
-    0.822978,
-    0.821859,
-    0.82077,
-    0.819711,
-    0.818685,
-    0.817692,
-    0.816733,
-    0.815811,
-    0.814925,
-    0.814078,
-    0.81327,
-    0.812502,
-    0.811776,
-    0.811093,
-    0.810453,
-    0.809858,
-    0.809308,
-    0.808804,
-    0.808347,
-    0.807938,
-    0.807578,
-    0.807266,
-    0.807004,
-    0.806792,
-    0.806631,
-    0.80652,
-    0.806462,
-    0.806455,
-    0.806499,
-    0.806597,
-    0.806746,
-    0.806948,
-    0.807202,
-    0.807509,
-    0.807868,
-    0.808279,
-    0.808742,
-    0.809257,
-    0.809823,
-    0.81044,
-    0.811108,
-    0.811825,
-    0.812592,
-    0.813408,
-    0.814272,
-    0.815183,
-    0.816141,
-    0.817144,
-    0.818193,
-    0.819285,
-    0.82042,
-    0.821597,
-    0.822814,
-    0.824071,
-    0.825366,
-    0.826698,
-    0.828066,
-    0.829468,
-    0.830903,
-    0.83237,
-    0.833866,
-    0.83539,
-    0.836941,
-    0.838518,
-    0.840118,
-    0.84174,
-    0.843381,
-    0.845041,
-    0.846718,
-    0.848409,
-    0.850113,
-    0.851828,
-    0.853552,
-    0.855284,
-    0.85702,
-    0.85876,
-    0.860501,
-    0.862241,
-    0.863979,
-    0.865712,
-    0.867439,
-    0.869157,
-    0.870864,
-    0.872558,
-    0.874238,
-    0.875901,
-    0.877546,
-    0.879169,
-    0.880771,
-    0.882347,
-    0.883897,
-    0.885419,
-    0.88691,
-    0.888369,
-    0.889794,
-    0.891183,
-    0.892534,
-    0.893846,
-    0.895116,
-    0.896344,
-    0.897527,
-    0.898663,
-    0.899752,
-    0.900792,
-    0.90178,
-    0.902717,
-    0.903599,
-    0.904427,
-    0.905198,
-    0.905911,
-    0.906566,
-    0.907161,
-    0.907695,
-    0.908167,
-    0.908576,
-    0.908921,
-    0.909202,
-    0.909417,
-    0.909566,
-    0.909649,
-    0.909664,
-    0.909612,
-    0.909491,
-    0.909302,
-    0.909045,
-    0.908719,
-    0.908324,
-    0.907859,
-    0.907326,
-    0.906725,
-    0.906054,
-    0.905316,
-    0.904509,
-    0.903635,
-    0.902694,
-    0.901687,
-    0.900614,
-    0.899476,
-    0.898274,
-    0.897008,
-    0.895681,
-    0.894292,
-    0.892843,
-    0.891336,
-    0.889771,
-    0.88815,
-    0.886474,
-    0.884744,
-    0.882963,
-    0.881132,
-    0.879253,
-    0.877327,
-    0.875357,
-    0.873343,
-    0.871289,
-    0.869196,
-    0.867066,
-    0.864902,
-    0.862705,
-    0.860478,
-    0.858223,
-    0.855943,
-    0.853639,
-    0.851315,
-    0.848973,
-    0.846615,
-    0.844244,
-    0.841862,
-    0.839473,
-    0.837078,
-    0.834681,
-    0.832284,
-    0.82989,
-    0.827502,
-    0.825122,
-    0.822753,
-    0.820399,
-    0.818061,
-    0.815743,
-    0.813447,
-    0.811177,
-    0.808935,
-    0.806724,
-    0.804547,
-    0.802406,
-    0.800304,
-    0.798245,
-    0.79623,
-    0.794263,
-    0.792346,
-    0.790481,
-    0.788672,
-    0.786922,
-    0.785231,
-    0.783604,
-    0.782042,
-    0.780549,
-    0.779125,
-    0.777774,
-    0.776498,
-    0.775299,
-    0.774179,
-    0.77314,
-    0.772184,
-    0.771314,
-    0.77053,
-    0.769835,
-    0.769231,
-    0.768718,
-    0.768299,
-    0.767975,
-    0.767747,
-    0.767617,
-    0.767585,
-    0.767653,
-    0.767822,
-    0.768093,
-    0.768466,
-    0.768942,
-    0.769522,
-    0.770205,
-    0.770994,
-    0.771887,
-    0.772885,
-    0.773987,
-    0.775195,
-    0.776507,
-    0.777924,
-    0.779444,
-    0.781068,
-    0.782794,
-    0.784622,
-    0.786551,
-    0.78858,
-    0.790708,
-    0.792933,
-    0.795254,
-    0.79767,
-    0.800179,
-    0.80278,
-    0.80547,
-    0.808247,
-    0.81111,
-    0.814056,
-    0.817083,
-    0.820188,
-    0.823369,
-    0.826624,
-    0.829949,
-    0.833341,
-    0.836798,
-    0.840317,
-    0.843894,
-    0.847525,
-    0.851209,
-    0.85494,
-    0.858716,
-    0.862533,
-    0.866386,
-    0.870273,
-    0.874188,
-    0.878129,
-    0.88209,
-    0.886068,
-    0.890058,
-    0.894056,
-    0.898058,
-    0.902058,
-    0.906053,
-    0.910038,
-    0.914007,
-    0.917956,
-    0.921881,
-    0.925776,
-    0.929637,
-    0.933459,
-    0.937235,
-    0.940963,
-    0.944635,
-    0.948248,
-    0.951797,
-    0.955275,
-    0.958678,
-    0.962001,
-    0.965238,
-    0.968385,
-    0.971436,
-    0.974385,
-    0.977229,
-    0.979961,
-    0.982576,
-    0.98507,
-    0.987437,
-    0.989673,
-    0.991771,
-    0.993728,
-    0.995537,
-    0.997195,
-    0.998696,
-    1.00004,
-    1.00121,
-    1.00221,
-    1.00304,
-    1.00369,
-    1.00415,
-    1.00442,
-    1.0045,
-    1.00439,
-    1.00407,
-    1.00354,
-    1.00281,
-    1.00186,
-    1.00069,
-    0.999306,
-    0.997695,
-    0.995855,
-    0.993785,
-    0.99148,
-    0.988937,
-    0.986154,
-    0.983127,
-    0.979854,
-    0.976333,
-    0.972561,
-    0.968536,
-    0.964255,
-    0.959716,
-    0.954919,
-    0.94986,
-    0.944539,
-    0.938954,
-    0.933104,
-    0.926988,
-    0.920605,
-    0.913954,
-    0.907034,
-    0.899846,
-    0.892388,
-    0.884661,
-    0.876665,
-    0.868399,
-    0.859865,
-    0.851063,
-    0.841994,
-    0.832658,
-    0.823056,
-    0.813191,
-    0.803062,
-    0.792672,
-    0.782022,
-    0.771115,
-    0.759952,
-    0.748536,
-    0.736868,
-    0.724952,
-    0.71279,
-    0.700384,
-    0.687739,
-    0.674857,
-    0.661742,
-    0.648396,
-    0.634824,
-    0.621029,
-    0.607015,
-    0.592787,
-    0.578348,
-    0.563703,
-    0.548856,
-    0.533813,
-    0.518576,
-    0.503153,
-    0.487547,
-    0.471763,
-    0.455808,
-    0.439686,
-    0.423402,
-    0.406963,
-    0.390374,
-    0.37364,
-    0.356768,
-    0.339764,
-    0.322633,
-    0.305382,
-    0.288017,
-    0.270544,
-    0.25297,
-    0.235302,
-    0.217544,
-    0.199705,
-    0.181791,
-    0.163808,
-    0.145764,
-    0.127664,
-    0.109516,
-    0.0913268,
-    0.073103,
-    0.0548515,
-    0.0365792,
-    0.0182931,
-    0,
-    -0.0182931,
-    -0.0365792,
-    -0.0548515,
-    -0.073103,
-    -0.0913268,
-    -0.109516,
-    -0.127664,
-    -0.145764,
-    -0.163808,
-    -0.181791,
-    -0.199705,
-    -0.217544,
-    -0.235302,
-    -0.25297,
-    -0.270544,
-    -0.288017,
-    -0.305382,
-    -0.322633,
-    -0.339764,
-    -0.356768,
-    -0.37364,
-    -0.390374,
-    -0.406963,
-    -0.423402,
-    -0.439686,
-    -0.455808,
-    -0.471763,
-    -0.487547,
-    -0.503153,
-    -0.518576,
-    -0.533813,
-    -0.548856,
-    -0.563703,
-    -0.578348,
-    -0.592787,
-    -0.607015,
-    -0.621029,
-    -0.634824,
-    -0.648396,
-    -0.661742,
-    -0.674857,
-    -0.687739,
-    -0.700384,
-    -0.71279,
-    -0.724952,
-    -0.736868,
-    -0.748536,
-    -0.759952,
-    -0.771115,
-    -0.782022,
-    -0.792672,
-    -0.803062,
-    -0.813191,
-    -0.823056,
-    -0.832658,
-    -0.841994,
-    -0.851063,
-    -0.859865,
-    -0.868399,
-    -0.876665,
-    -0.884661,
-    -0.892388,
-    -0.899846,
-    -0.907034,
-    -0.913954,
-    -0.920605,
-    -0.926988,
-    -0.933104,
-    -0.938954,
-    -0.944539,
-    -0.94986,
-    -0.954919,
-    -0.959716,
-    -0.964255,
-    -0.968536,
-    -0.972561,
-    -0.976333,
-    -0.979854,
-    -0.983127,
-    -0.986154,
-    -0.988937,
-    -0.99148,
-    -0.993785,
-    -0.995855,
-    -0.997695,
-    -0.999306,
-    -1.00069,
-    -1.00186,
-    -1.00281,
-    -1.00354,
-    -1.00407,
-    -1.00439,
-    -1.0045,
-    -1.00442,
-    -1.00415,
-    -1.00369,
-    -1.00304,
-    -1.00221,
-    -1.00121,
-    -1.00004,
-    -0.998696,
-    -0.997195,
-    -0.995537,
-    -0.993728,
-    -0.991771,
-    -0.989673,
-    -0.987437,
-    -0.98507,
-    -0.982576,
-    -0.979961,
-    -0.977229,
-    -0.974385,
-    -0.971436,
-    -0.968385,
-    -0.965238,
-    -0.962001,
-    -0.958678,
-    -0.955275,
-    -0.951797,
-    -0.948248,
-    -0.944635,
-    -0.940963,
-    -0.937235,
-    -0.933459,
-    -0.929637,
-    -0.925776,
-    -0.921881,
-    -0.917956,
-    -0.914007,
-    -0.910038,
-    -0.906053,
-    -0.902058,
-    -0.898058,
-    -0.894056,
-    -0.890058,
-    -0.886068,
-    -0.88209,
-    -0.878129,
-    -0.874188,
-    -0.870273,
-    -0.866386,
-    -0.862533,
-    -0.858716,
-    -0.85494,
-    -0.851209,
-    -0.847525,
-    -0.843894,
-    -0.840317,
-    -0.836798,
-    -0.833341,
-    -0.829949,
-    -0.826624,
-    -0.823369,
-    -0.820188,
-    -0.817083,
-    -0.814056,
-    -0.81111,
-    -0.808247,
-    -0.80547,
-    -0.80278,
-    -0.800179,
-    -0.79767,
-    -0.795254,
-    -0.792933,
-    -0.790708,
-    -0.78858,
-    -0.786551,
-    -0.784622,
-    -0.782794,
-    -0.781068,
-    -0.779444,
-    -0.777924,
-    -0.776507,
-    -0.775195,
-    -0.773987,
-    -0.772885,
-    -0.771887,
-    -0.770994,
-    -0.770205,
-    -0.769522,
-    -0.768942,
-    -0.768466,
-    -0.768093,
-    -0.767822,
-    -0.767653,
-    -0.767585,
-    -0.767617,
-    -0.767747,
-    -0.767975,
-    -0.768299,
-    -0.768718,
-    -0.769231,
-    -0.769835,
-    -0.77053,
-    -0.771314,
-    -0.772184,
-    -0.77314,
-    -0.774179,
-    -0.775299,
-    -0.776498,
-    -0.777774,
-    -0.779125,
-    -0.780549,
-    -0.782042,
-    -0.783604,
-    -0.785231,
-    -0.786922,
-    -0.788672,
-    -0.790481,
-    -0.792346,
-    -0.794263,
-    -0.79623,
-    -0.798245,
-    -0.800304,
-    -0.802406,
-    -0.804547,
-    -0.806724,
-    -0.808935,
-    -0.811177,
-    -0.813447,
-    -0.815743,
-    -0.818061,
-    -0.820399,
-    -0.822753,
-    -0.825122,
-    -0.827502,
-    -0.82989,
-    -0.832284,
-    -0.834681,
-    -0.837078,
-    -0.839473,
-    -0.841862,
-    -0.844244,
-    -0.846615,
-    -0.848973,
-    -0.851315,
-    -0.853639,
-    -0.855943,
-    -0.858223,
-    -0.860478,
-    -0.862705,
-    -0.864902,
-    -0.867066,
-    -0.869196,
-    -0.871289,
-    -0.873343,
-    -0.875357,
-    -0.877327,
-    -0.879253,
-    -0.881132,
-    -0.882963,
-    -0.884744,
-    -0.886474,
-    -0.88815,
-    -0.889771,
-    -0.891336,
-    -0.892843,
-    -0.894292,
-    -0.895681,
-    -0.897008,
-    -0.898274,
-    -0.899476,
-    -0.900614,
-    -0.901687,
-    -0.902694,
-    -0.903635,
-    -0.904509,
-    -0.905316,
-    -0.906054,
-    -0.906725,
-    -0.907326,
-    -0.907859,
-    -0.908324,
-    -0.908719,
-    -0.909045,
-    -0.909302,
-    -0.909491,
-    -0.909612,
-    -0.909664,
-    -0.909649,
-    -0.909566,
-    -0.909417,
-    -0.909202,
-    -0.908921,
-    -0.908576,
-    -0.908167,
-    -0.907695,
-    -0.907161,
-    -0.906566,
-    -0.905911,
-    -0.905198,
-    -0.904427,
-    -0.903599,
-    -0.902717,
-    -0.90178,
-    -0.900792,
-    -0.899752,
-    -0.898663,
-    -0.897527,
-    -0.896344,
-    -0.895116,
-    -0.893846,
-    -0.892534,
-    -0.891183,
-    -0.889794,
-    -0.888369,
-    -0.88691,
-    -0.885419,
-    -0.883897,
-    -0.882347,
-    -0.880771,
-    -0.879169,
-    -0.877546,
-    -0.875901,
-    -0.874238,
-    -0.872558,
-    -0.870864,
-    -0.869157,
-    -0.867439,
-    -0.865712,
-    -0.863979,
-    -0.862241,
-    -0.860501,
-    -0.85876,
-    -0.85702,
-    -0.855284,
-    -0.853552,
-    -0.851828,
-    -0.850113,
-    -0.848409,
-    -0.846718,
-    -0.845041,
-    -0.843381,
-    -0.84174,
-    -0.840118,
-    -0.838518,
-    -0.836941,
-    -0.83539,
-    -0.833866,
-    -0.83237,
-    -0.830903,
-    -0.829468,
-    -0.828066,
-    -0.826698,
-    -0.825366,
-    -0.824071,
-    -0.822814,
-    -0.821597,
-    -0.82042,
-    -0.819285,
-    -0.818193,
-    -0.817144,
-    -0.816141,
-    -0.815183,
-    -0.814272,
-    -0.813408,
-    -0.812592,
-    -0.811825,
-    -0.811108,
-    -0.81044,
-    -0.809823,
-    -0.809257,
-    -0.808742,
-    -0.808279,
-    -0.807868,
-    -0.807509,
-    -0.807202,
-    -0.806948,
-    -0.806746,
-    -0.806597,
-    -0.806499,
-    -0.806455,
-    -0.806462,
-    -0.80652,
-    -0.806631,
-    -0.806792,
-    -0.807004,
-    -0.807266,
-    -0.807578,
-    -0.807938,
-    -0.808347,
-    -0.808804,
-    -0.809308,
-    -0.809858,
-    -0.810453,
-    -0.811093,
-    -0.811776,
-    -0.812502,
-    -0.81327,
-    -0.814078,
-    -0.814925,
-    -0.815811,
-    -0.816733,
-    -0.817692,
-    -0.818685,
-    -0.819711,
-    -0.82077,
-    -0.821859,
-    -0.822978,
-    -0.824124,
-    -0.825297,
-    -0.826495,
-    -0.827717,
-    -0.82896,
-    -0.830225,
-    -0.831508,
-    -0.832809,
-    -0.834126,
-    -0.835457,
-    -0.836802,
-    -0.838157,
-    -0.839522,
-    -0.840896,
-    -0.842275,
-    -0.84366,
-    -0.845048,
-    -0.846438,
-    -0.847828,
-    -0.849217,
-    -0.850602,
-    -0.851983,
-    -0.853358,
-    -0.854725,
-    -0.856084,
-    -0.857431,
-    -0.858766,
-    -0.860088,
-    -0.861395,
-    -0.862685,
-    -0.863958,
-    -0.865211,
-    -0.866443,
-    -0.867654,
-    -0.868842,
-    -0.870005,
-    -0.871142,
-    -0.872253,
-    -0.873335,
-    -0.874388,
-    -0.875412,
-    -0.876403,
-    -0.877363,
-    -0.878289,
-    -0.879182,
-    -0.880039,
-    -0.88086,
-    -0.881645,
-    -0.882392,
-    -0.883101,
-    -0.883771,
-    -0.884402,
-    -0.884993,
-    -0.885543,
-    -0.886053,
-    -0.886521,
-    -0.886947,
-    -0.887331,
-    -0.887672,
-    -0.887971,
-    -0.888228,
-    -0.888441,
-    -0.888611,
-    -0.888738,
-    -0.888822,
-    -0.888863,
-    -0.888861,
-    -0.888816,
-    -0.888729,
-    -0.888599,
-    -0.888428,
-    -0.888215,
-    -0.88796,
-    -0.887665,
-    -0.887329,
-    -0.886953,
-    -0.886538,
-    -0.886085,
-    -0.885593,
-    -0.885064,
-    -0.884498,
-    -0.883897,
-    -0.88326,
-    -0.88259,
-    -0.881885,
-    -0.881149,
-    -0.880381,
-    -0.879582,
-    -0.878754,
-    -0.877898,
-    -0.877014,
-    -0.876103,
-    -0.875168,
-    -0.874209,
-    -0.873226,
-    -0.872222,
-    -0.871198,
-    -0.870154,
-    -0.869092,
-    -0.868013,
-    -0.866919,
-    -0.865811,
-    -0.86469,
-    -0.863557,
-    -0.862414,
-    -0.861263,
-    -0.860103,
-    -0.858938,
-    -0.857767,
-    -0.856593,
-    -0.855417,
-    -0.85424,
-    -0.853063,
-    -0.851888,
-    -0.850716,
-    -0.849549,
-    -0.848388,
-    -0.847233,
-    -0.846087,
-    -0.84495,
-    -0.843825,
-    -0.842711,
-    -0.841611,
-    -0.840526,
-    -0.839456,
-    -0.838403,
-    -0.837368,
-    -0.836353,
-    -0.835357,
-    -0.834383,
-    -0.833432,
-    -0.832504,
-    -0.8316,
-    -0.830722,
-    -0.82987,
-    -0.829045,
-    -0.828248,
-    -0.82748,
-    -0.826741,
-    -0.826033,
-    -0.825356,
-    -0.824711,
-    -0.824098,
-    -0.823519,
-    -0.822973,
-    -0.822461,
-    -0.821984,
-    -0.821541,
-    -0.821135,
-    -0.820764,
-    -0.820429,
-    -0.820131,
-    -0.819869,
-    -0.819644,
-    -0.819457,
-    -0.819306,
-    -0.819193,
-    -0.819117,
-    -0.819078,
-    -0.819076,
-    -0.819112,
-    -0.819184,
-    -0.819293,
-    -0.819439,
-    -0.81962,
-    -0.819838,
-    -0.820092,
-    -0.820381,
-    -0.820704,
-    -0.821062,
-    -0.821454,
-    -0.82188,
-    -0.822338,
-    -0.822828,
-    -0.82335,
-    -0.823902,
-    -0.824485,
-    -0.825097,
-    -0.825738,
-    -0.826407,
-    -0.827103,
-    -0.827825,
-    -0.828572,
-    -0.829344,
-    -0.830139,
-    -0.830956,
-    -0.831795,
-    -0.832655,
-    -0.833534,
-    -0.834431,
-    -0.835346,
-    -0.836277,
-    -0.837224,
-    -0.838184,
-    -0.839157,
-    -0.840143,
-    -0.841138,
-    -0.842144,
-    -0.843157,
-    -0.844178,
-    -0.845205,
-    -0.846237,
-    -0.847272,
-    -0.84831,
-    -0.849349,
-    -0.850388,
-    -0.851426,
-    -0.852462,
-    -0.853495,
-    -0.854523,
-    -0.855545,
-    -0.85656,
-    -0.857567,
-    -0.858565,
-    -0.859553,
-    -0.860529,
-    -0.861493,
-    -0.862443,
-    -0.863379,
-    -0.864299,
-    -0.865203,
-    -0.866089,
-    -0.866956,
-    -0.867804,
-    -0.868631,
-    -0.869437,
-    -0.870221,
-    -0.870982,
-    -0.871719,
-    -0.872432,
-    -0.873119,
-    -0.87378,
-    -0.874414,
-    -0.87502,
-    -0.875599,
-    -0.876148,
-    -0.876669,
-    -0.87716,
-    -0.87762,
-    -0.87805,
-    -0.878448,
-    -0.878815,
-    -0.87915,
-    -0.879453,
-    -0.879723,
-    -0.87996,
-    -0.880165,
-    -0.880336,
-    -0.880474,
-    -0.880579,
-    -0.88065,
-    -0.880688,
-    -0.880693,
-    -0.880664,
-    -0.880602,
-    -0.880507,
-    -0.880379,
-    -0.880218,
-    -0.880025,
-    -0.8798,
-    -0.879542,
-    -0.879254,
-    -0.878934,
-    -0.878583,
-    -0.878202,
-    -0.877792,
-    -0.877352,
-    -0.876883,
-    -0.876387,
-    -0.875862,
-    -0.875311,
-    -0.874734,
-    -0.874132,
-    -0.873505,
-    -0.872853,
-    -0.872179,
-    -0.871482,
-    -0.870764,
-    -0.870025,
-    -0.869266,
-    -0.868488,
-    -0.867692,
-    -0.86688,
-    -0.866051,
-    -0.865207,
-    -0.864348,
-    -0.863477,
-    -0.862593,
-    -0.861699,
-    -0.860794,
-    -0.85988,
-    -0.858959,
-    -0.85803,
-    -0.857095,
-    -0.856156,
-    -0.855213,
-    -0.854267,
-    -0.85332,
-    -0.852373,
-    -0.851425,
-    -0.85048,
-    -0.849537,
-    -0.848598,
-    -0.847664,
-    -0.846736,
-    -0.845815,
-    -0.844902,
-    -0.843998,
-    -0.843104,
-    -0.842221,
-    -0.84135,
-    -0.840492,
-    -0.839648,
-    -0.838819,
-    -0.838005,
-    -0.837209,
-    -0.836429,
-    -0.835669,
-    -0.834927,
-    -0.834206,
-    -0.833506,
-    -0.832827,
-    -0.83217,
-    -0.831537,
-    -0.830927,
-    -0.830342,
-    -0.829782,
-    -0.829247,
-    -0.828739,
-    -0.828257,
-    -0.827803,
-    -0.827376,
-    -0.826978,
-    -0.826608,
-    -0.826267,
-    -0.825956,
-    -0.825674,
-    -0.825422,
-    -0.8252,
-    -0.825008,
-    -0.824847,
-    -0.824717,
-    -0.824617,
-    -0.824549,
-    -0.824511,
-    -0.824504,
-    -0.824528,
-    -0.824582,
-    -0.824667,
-    -0.824783,
-    -0.824929,
-    -0.825105,
-    -0.825312,
-    -0.825547,
-    -0.825812,
-    -0.826107,
-    -0.826429,
-    -0.82678,
-    -0.827159,
-    -0.827565,
-    -0.827997,
-    -0.828456,
-    -0.828941,
-    -0.829451,
-    -0.829985,
-    -0.830543,
-    -0.831125,
-    -0.831729,
-    -0.832355,
-    -0.833001,
-    -0.833669,
-    -0.834355,
-    -0.835061,
-    -0.835784,
-    -0.836524,
-    -0.837281,
-    -0.838053,
-    -0.838839,
-    -0.839639,
-    -0.840451,
-    -0.841275,
-    -0.84211,
-    -0.842955,
-    -0.843808,
-    -0.844669,
-    -0.845537,
-    -0.84641,
-    -0.847289,
-    -0.848171,
-    -0.849056,
-    -0.849943,
-    -0.85083,
-    -0.851718,
-    -0.852604,
-    -0.853487,
-    -0.854368,
-    -0.855244,
-    -0.856116,
-    -0.85698,
-    -0.857838,
-    -0.858688,
-    -0.859528,
-    -0.860358,
-    -0.861178,
-    -0.861985,
-    -0.86278,
-    -0.863561,
-    -0.864327,
-    -0.865078,
-    -0.865813,
-    -0.866531,
-    -0.86723,
-    -0.867911,
-    -0.868573,
-    -0.869215,
-    -0.869835,
-    -0.870434,
-    -0.871011,
-    -0.871565,
-    -0.872096,
-    -0.872603,
-    -0.873085,
-    -0.873542,
-    -0.873973,
-    -0.874378,
-    -0.874757,
-    -0.875109,
-    -0.875434,
-    -0.875731,
-    -0.876,
-    -0.876241,
-    -0.876454,
-    -0.876638,
-    -0.876793,
-    -0.876919,
-    -0.877016,
-    -0.877084,
-    -0.877122,
-    -0.877132,
-    -0.877112,
-    -0.877063,
-    -0.876984,
-    -0.876877,
-    -0.876741,
-    -0.876576,
-    -0.876383,
-    -0.876162,
-    -0.875912,
-    -0.875635,
-    -0.875331,
-    -0.875,
-    -0.874642,
-    -0.874259,
-    -0.873849,
-    -0.873415,
-    -0.872955,
-    -0.872472,
-    -0.871965,
-    -0.871435,
-    -0.870883,
-    -0.87031,
-    -0.869715,
-    -0.8691,
-    -0.868465,
-    -0.867812,
-    -0.86714,
-    -0.866451,
-    -0.865746,
-    -0.865025,
-    -0.864289,
-    -0.863539,
-    -0.862775,
-    -0.862,
-    -0.861213,
-    -0.860416,
-    -0.859609,
-    -0.858793,
-    -0.857969,
-    -0.857139,
-    -0.856303,
-    -0.855462,
-    -0.854618,
-    -0.85377,
-    -0.85292,
-    -0.852069,
-    -0.851218,
-    -0.850368,
-    -0.84952,
-    -0.848675,
-    -0.847833,
-    -0.846996,
-    -0.846165,
-    -0.845341,
-    -0.844524,
-    -0.843715,
-    -0.842916,
-    -0.842128,
-    -0.84135,
-    -0.840584,
-    -0.839832,
-    -0.839093,
-    -0.838369,
-    -0.83766,
-    -0.836968,
-    -0.836292,
-    -0.835634,
-    -0.834995,
-    -0.834375,
-    -0.833774,
-    -0.833195,
-    -0.832636,
-    -0.8321,
-    -0.831586,
-    -0.831094,
-    -0.830627,
-    -0.830183,
-    -0.829764,
-    -0.82937,
-    -0.829002,
-    -0.828659,
-    -0.828343,
-    -0.828053,
-    -0.82779,
-    -0.827555,
-    -0.827346,
-    -0.827166,
-    -0.827013,
-    -0.826888,
-    -0.826792,
-    -0.826724,
-    -0.826684,
-    -0.826672,
-    -0.826689,
-    -0.826734,
-    -0.826807,
-    -0.826909,
-    -0.827038,
-    -0.827196,
-    -0.827381,
-    -0.827593,
-    -0.827833,
-    -0.8281,
-    -0.828393,
-    -0.828712,
-    -0.829058,
-    -0.829429,
-    -0.829825,
-    -0.830245,
-    -0.83069,
-    -0.831158,
-    -0.831649,
-    -0.832163,
-    -0.832699,
-    -0.833256,
-    -0.833834,
-    -0.834431,
-    -0.835048,
-    -0.835684,
-    -0.836337,
-    -0.837008,
-    -0.837695,
-    -0.838397,
-    -0.839114,
-    -0.839845,
-    -0.840589,
-    -0.841346,
-    -0.842114,
-    -0.842892,
-    -0.84368,
-    -0.844477,
-    -0.845281,
-    -0.846093,
-    -0.84691,
-    -0.847733,
-    -0.848559,
-    -0.849389,
-    -0.850221,
-    -0.851054,
-    -0.851888,
-    -0.852721,
-    -0.853553,
-    -0.854382,
-    -0.855207,
-    -0.856028,
-    -0.856844,
-    -0.857654,
-    -0.858456,
-    -0.859251,
-    -0.860036,
-    -0.860812,
-    -0.861576,
-    -0.86233,
-    -0.86307,
-    -0.863798,
-    -0.864511,
-    -0.86521,
-    -0.865892,
-    -0.866558,
-    -0.867207,
-    -0.867838,
-    -0.868451,
-    -0.869043,
-    -0.869616,
-    -0.870168,
-    -0.870699,
-    -0.871208,
-    -0.871694,
-    -0.872157,
-    -0.872597,
-    -0.873012,
-    -0.873403,
-    -0.873769,
-    -0.87411,
-    -0.874424,
-    -0.874713,
-    -0.874975,
-    -0.87521,
-    -0.875419,
-    -0.8756,
-    -0.875753,
-    -0.875879,
-    -0.875977,
-    -0.876047,
-    -0.876089,
-    -0.876103,
-    -0.876089,
-    -0.876047,
-    -0.875977,
-    -0.875879,
-    -0.875753,
-    -0.8756,
-    -0.875419,
-    -0.87521,
-    -0.874975,
-    -0.874713,
-    -0.874424,
-    -0.87411,
-    -0.873769,
-    -0.873403,
-    -0.873012,
-    -0.872597,
-    -0.872157,
-    -0.871694,
-    -0.871208,
-    -0.870699,
-    -0.870168,
-    -0.869616,
-    -0.869043,
-    -0.868451,
-    -0.867838,
-    -0.867207,
-    -0.866558,
-    -0.865892,
-    -0.86521,
-    -0.864511,
-    -0.863798,
-    -0.86307,
-    -0.86233,
-    -0.861576,
-    -0.860812,
-    -0.860036,
-    -0.859251,
-    -0.858456,
-    -0.857654,
-    -0.856844,
-    -0.856028,
-    -0.855207,
-    -0.854382,
-    -0.853553,
-    -0.852721,
-    -0.851888,
-    -0.851054,
-    -0.850221,
-    -0.849389,
-    -0.848559,
-    -0.847733,
-    -0.84691,
-    -0.846093,
-    -0.845281,
-    -0.844477,
-    -0.84368,
-    -0.842892,
-    -0.842114,
-    -0.841346,
-    -0.840589,
-    -0.839845,
-    -0.839114,
-    -0.838397,
-    -0.837695,
-    -0.837008,
-    -0.836337,
-    -0.835684,
-    -0.835048,
-    -0.834431,
-    -0.833834,
-    -0.833256,
-    -0.832699,
-    -0.832163,
-    -0.831649,
-    -0.831158,
-    -0.83069,
-    -0.830245,
-    -0.829825,
-    -0.829429,
-    -0.829058,
-    -0.828712,
-    -0.828393,
-    -0.8281,
-    -0.827833,
-    -0.827593,
-    -0.827381,
-    -0.827196,
-    -0.827038,
-    -0.826909,
-    -0.826807,
-    -0.826734,
-    -0.826689,
-    -0.826672,
-    -0.826684,
-    -0.826724,
-    -0.826792,
-    -0.826888,
-    -0.827013,
-    -0.827166,
-    -0.827346,
-    -0.827555,
-    -0.82779,
-    -0.828053,
-    -0.828343,
-    -0.828659,
-    -0.829002,
-    -0.82937,
-    -0.829764,
-    -0.830183,
-    -0.830627,
-    -0.831094,
-    -0.831586,
-    -0.8321,
-    -0.832636,
-    -0.833195,
-    -0.833774,
-    -0.834375,
-    -0.834995,
-    -0.835634,
-    -0.836292,
-    -0.836968,
-    -0.83766,
-    -0.838369,
-    -0.839093,
-    -0.839832,
-    -0.840584,
-    -0.84135,
-    -0.842128,
-    -0.842916,
-    -0.843715,
-    -0.844524,
-    -0.845341,
-    -0.846165,
-    -0.846996,
-    -0.847833,
-    -0.848675,
-    -0.84952,
-    -0.850368,
-    -0.851218,
-    -0.852069,
-    -0.85292,
-    -0.85377,
-    -0.854618,
-    -0.855462,
-    -0.856303,
-    -0.857139,
-    -0.857969,
-    -0.858793,
-    -0.859609,
-    -0.860416,
-    -0.861213,
-    -0.862,
-    -0.862775,
-    -0.863539,
-    -0.864289,
-    -0.865025,
-    -0.865746,
-    -0.866451,
-    -0.86714,
-    -0.867812,
-    -0.868465,
-    -0.8691,
-    -0.869715,
-    -0.87031,
-    -0.870883,
-    -0.871435,
-    -0.871965,
-    -0.872472,
-    -0.872955,
-    -0.873415,
-    -0.873849,
-    -0.874259,
-    -0.874642,
-    -0.875,
-    -0.875331,
-    -0.875635,
-    -0.875912,
-    -0.876162,
-    -0.876383,
-    -0.876576,
-    -0.876741,
-    -0.876877,
-    -0.876984,
-    -0.877063,
-    -0.877112,
-    -0.877132,
-    -0.877122,
-    -0.877084,
-    -0.877016,
-    -0.876919,
-    -0.876793,
-    -0.876638,
-    -0.876454,
-    -0.876241,
-    -0.876,
-    -0.875731,
-    -0.875434,
-    -0.875109,
-    -0.874757,
-    -0.874378,
-    -0.873973,
-    -0.873542,
-    -0.873085,
-    -0.872603,
-    -0.872096,
-    -0.871565,
-    -0.871011,
-    -0.870434,
-    -0.869835,
-    -0.869215,
-    -0.868573,
-    -0.867911,
-    -0.86723,
-    -0.866531,
-    -0.865813,
-    -0.865078,
-    -0.864327,
-    -0.863561,
-    -0.86278,
-    -0.861985,
-    -0.861178,
-    -0.860358,
-    -0.859528,
-    -0.858688,
-    -0.857838,
-    -0.85698,
-    -0.856116,
-    -0.855244,
-    -0.854368,
-    -0.853487,
-    -0.852604,
-    -0.851718,
-    -0.85083,
-    -0.849943,
-    -0.849056,
-    -0.848171,
-    -0.847289,
-    -0.84641,
-    -0.845537,
-    -0.844669,
-    -0.843808,
-    -0.842955,
-    -0.84211,
-    -0.841275,
-    -0.840451,
-    -0.839639,
-    -0.838839,
-    -0.838053,
-    -0.837281,
-    -0.836524,
-    -0.835784,
-    -0.835061,
-    -0.834355,
-    -0.833669,
-    -0.833001,
-    -0.832355,
-    -0.831729,
-    -0.831125,
-    -0.830543,
-    -0.829985,
-    -0.829451,
-    -0.828941,
-    -0.828456,
-    -0.827997,
-    -0.827565,
-    -0.827159,
-    -0.82678,
-    -0.826429,
-    -0.826107,
-    -0.825812,
-    -0.825547,
-    -0.825312,
-    -0.825105,
-    -0.824929,
-    -0.824783,
-    -0.824667,
-    -0.824582,
-    -0.824528,
-    -0.824504,
-    -0.824511,
-    -0.824549,
-    -0.824617,
-    -0.824717,
-    -0.824847,
-    -0.825008,
-    -0.8252,
-    -0.825422,
-    -0.825674,
-    -0.825956,
-    -0.826267,
-    -0.826608,
-    -0.826978,
-    -0.827376,
-    -0.827803,
-    -0.828257,
-    -0.828739,
-    -0.829247,
-    -0.829782,
-    -0.830342,
-    -0.830927,
-    -0.831537,
-    -0.83217,
-    -0.832827,
-    -0.833506,
-    -0.834206,
-    -0.834927,
-    -0.835669,
-    -0.836429,
-    -0.837209,
-    -0.838005,
-    -0.838819,
-    -0.839648,
-    -0.840492,
-    -0.84135,
-    -0.842221,
-    -0.843104,
-    -0.843998,
-    -0.844902,
-    -0.845815,
-    -0.846736,
-    -0.847664,
-    -0.848598,
-    -0.849537,
-    -0.85048,
-    -0.851425,
-    -0.852373,
-    -0.85332,
-    -0.854267,
-    -0.855213,
-    -0.856156,
-    -0.857095,
-    -0.85803,
-    -0.858959,
-    -0.85988,
-    -0.860794,
-    -0.861699,
-    -0.862593,
-    -0.863477,
-    -0.864348,
-    -0.865207,
-    -0.866051,
-    -0.86688,
-    -0.867692,
-    -0.868488,
-    -0.869266,
-    -0.870025,
-    -0.870764,
-    -0.871482,
-    -0.872179,
-    -0.872853,
-    -0.873505,
-    -0.874132,
-    -0.874734,
-    -0.875311,
-    -0.875862,
-    -0.876387,
-    -0.876883,
-    -0.877352,
-    -0.877792,
-    -0.878202,
-    -0.878583,
-    -0.878934,
-    -0.879254,
-    -0.879542,
-    -0.8798,
-    -0.880025,
-    -0.880218,
-    -0.880379,
-    -0.880507,
-    -0.880602,
-    -0.880664,
-    -0.880693,
-    -0.880688,
-    -0.88065,
-    -0.880579,
-    -0.880474,
-    -0.880336,
-    -0.880165,
-    -0.87996,
-    -0.879723,
-    -0.879453,
-    -0.87915,
-    -0.878815,
-    -0.878448,
-    -0.87805,
-    -0.87762,
-    -0.87716,
-    -0.876669,
-    -0.876148,
-    -0.875599,
-    -0.87502,
-    -0.874414,
-    -0.87378,
-    -0.873119,
-    -0.872432,
-    -0.871719,
-    -0.870982,
-    -0.870221,
-    -0.869437,
-    -0.868631,
-    -0.867804,
-    -0.866956,
-    -0.866089,
-    -0.865203,
-    -0.864299,
-    -0.863379,
-    -0.862443,
-    -0.861493,
-    -0.860529,
-    -0.859553,
-    -0.858565,
-    -0.857567,
-    -0.85656,
-    -0.855545,
-    -0.854523,
-    -0.853495,
-    -0.852462,
-    -0.851426,
-    -0.850388,
-    -0.849349,
-    -0.84831,
-    -0.847272,
-    -0.846237,
-    -0.845205,
-    -0.844178,
-    -0.843157,
-    -0.842144,
-    -0.841138,
-    -0.840143,
-    -0.839157,
-    -0.838184,
-    -0.837224,
-    -0.836277,
-    -0.835346,
-    -0.834431,
-    -0.833534,
-    -0.832655,
-    -0.831795,
-    -0.830956,
-    -0.830139,
-    -0.829344,
-    -0.828572,
-    -0.827825,
-    -0.827103,
-    -0.826407,
-    -0.825738,
-    -0.825097,
-    -0.824485,
-    -0.823902,
-    -0.82335,
-    -0.822828,
-    -0.822338,
-    -0.82188,
-    -0.821454,
-    -0.821062,
-    -0.820704,
-    -0.820381,
-    -0.820092,
-    -0.819838,
-    -0.81962,
-    -0.819439,
-    -0.819293,
-    -0.819184,
-    -0.819112,
-    -0.819076,
-    -0.819078,
-    -0.819117,
-    -0.819193,
-    -0.819306,
-    -0.819457,
-    -0.819644,
-    -0.819869,
-    -0.820131,
-    -0.820429,
-    -0.820764,
-    -0.821135,
-    -0.821541,
-    -0.821984,
-    -0.822461,
-    -0.822973,
-    -0.823519,
-    -0.824098,
-    -0.824711,
-    -0.825356,
-    -0.826033,
-    -0.826741,
-    -0.82748,
-    -0.828248,
-    -0.829045,
-    -0.82987,
-    -0.830722,
-    -0.8316,
-    -0.832504,
-    -0.833432,
-    -0.834383,
-    -0.835357,
-    -0.836353,
-    -0.837368,
-    -0.838403,
-    -0.839456,
-    -0.840526,
-    -0.841611,
-    -0.842711,
-    -0.843825,
-    -0.84495,
-    -0.846087,
-    -0.847233,
-    -0.848388,
-    -0.849549,
-    -0.850716,
-    -0.851888,
-    -0.853063,
-    -0.85424,
-    -0.855417,
-    -0.856593,
-    -0.857767,
-    -0.858938,
-    -0.860103,
-    -0.861263,
-    -0.862414,
-    -0.863557,
-    -0.86469,
-    -0.865811,
-    -0.866919,
-    -0.868013,
-    -0.869092,
-    -0.870154,
-    -0.871198,
-    -0.872222,
-    -0.873226,
-    -0.874209,
-    -0.875168,
-    -0.876103,
-    -0.877014,
-    -0.877898,
-    -0.878754,
-    -0.879582,
-    -0.880381,
-    -0.881149,
-    -0.881885,
-    -0.88259,
-    -0.88326,
-    -0.883897,
-    -0.884498,
-    -0.885064,
-    -0.885593,
-    -0.886085,
-    -0.886538,
-    -0.886953,
-    -0.887329,
-    -0.887665,
-    -0.88796,
-    -0.888215,
-    -0.888428,
-    -0.888599,
-    -0.888729,
-    -0.888816,
-    -0.888861,
-    -0.888863,
-    -0.888822,
-    -0.888738,
-    -0.888611,
-    -0.888441,
-    -0.888228,
-    -0.887971,
-    -0.887672,
-    -0.887331,
-    -0.886947,
-    -0.886521,
-    -0.886053,
-    -0.885543,
-    -0.884993,
-    -0.884402,
-    -0.883771,
-    -0.883101,
-    -0.882392,
-    -0.881645,
-    -0.88086,
-    -0.880039,
-    -0.879182,
-    -0.878289,
-    -0.877363,
-    -0.876403,
-    -0.875412,
-    -0.874388,
-    -0.873335,
-    -0.872253,
-    -0.871142,
-    -0.870005,
-    -0.868842,
-    -0.867654,
-    -0.866443,
-    -0.865211,
-    -0.863958,
-    -0.862685,
-    -0.861395,
-    -0.860088,
-    -0.858766,
-    -0.857431,
-    -0.856084,
-    -0.854725,
-    -0.853358,
-    -0.851983,
-    -0.850602,
-    -0.849217,
-    -0.847828,
-    -0.846438,
-    -0.845048,
-    -0.84366,
-    -0.842275,
-    -0.840896,
-    -0.839522,
-    -0.838157,
-    -0.836802,
-    -0.835457,
-    -0.834126,
-    -0.832809,
-    -0.831508,
-    -0.830225,
-    -0.82896,
-    -0.827717,
-    -0.826495,
-    -0.825297,
-    -0.824124,
-    -0.822978,
-    -0.821859,
-    -0.82077,
-    -0.819711,
-    -0.818685,
-    -0.817692,
-    -0.816733,
-    -0.815811,
-    -0.814925,
-    -0.814078,
-    -0.81327,
-    -0.812502,
-    -0.811776,
-    -0.811093,
-    -0.810453,
-    -0.809858,
-    -0.809308,
-    -0.808804,
-    -0.808347,
-    -0.807938,
-    -0.807578,
-    -0.807266,
-    -0.807004,
-    -0.806792,
-    -0.806631,
-    -0.80652,
-    -0.806462,
-    -0.806455,
-    -0.806499,
-    -0.806597,
-    -0.806746,
-    -0.806948,
-    -0.807202,
-    -0.807509,
-    -0.807868,
-    -0.808279,
-    -0.808742,
-    -0.809257,
-    -0.809823,
-    -0.81044,
-    -0.811108,
-    -0.811825,
-    -0.812592,
-    -0.813408,
-    -0.814272,
-    -0.815183,
-    -0.816141,
-    -0.817144,
-    -0.818193,
-    -0.819285,
-    -0.82042,
-    -0.821597,
-    -0.822814,
-    -0.824071,
-    -0.825366,
-    -0.826698,
-    -0.828066,
-    -0.829468,
-    -0.830903,
-    -0.83237,
-    -0.833866,
-    -0.83539,
-    -0.836941,
-    -0.838518,
-    -0.840118,
-    -0.84174,
-    -0.843381,
-    -0.845041,
-    -0.846718,
-    -0.848409,
-    -0.850113,
-    -0.851828,
-    -0.853552,
-    -0.855284,
-    -0.85702,
-    -0.85876,
-    -0.860501,
-    -0.862241,
-    -0.863979,
-    -0.865712,
-    -0.867439,
-    -0.869157,
-    -0.870864,
-    -0.872558,
-    -0.874238,
-    -0.875901,
-    -0.877546,
-    -0.879169,
-    -0.880771,
-    -0.882347,
-    -0.883897,
-    -0.885419,
-    -0.88691,
-    -0.888369,
-    -0.889794,
-    -0.891183,
-    -0.892534,
-    -0.893846,
-    -0.895116,
-    -0.896344,
-    -0.897527,
-    -0.898663,
-    -0.899752,
-    -0.900792,
-    -0.90178,
-    -0.902717,
-    -0.903599,
-    -0.904427,
-    -0.905198,
-    -0.905911,
-    -0.906566,
-    -0.907161,
-    -0.907695,
-    -0.908167,
-    -0.908576,
-    -0.908921,
-    -0.909202,
-    -0.909417,
-    -0.909566,
-    -0.909649,
-    -0.909664,
-    -0.909612,
-    -0.909491,
-    -0.909302,
-    -0.909045,
-    -0.908719,
-    -0.908324,
-    -0.907859,
-    -0.907326,
-    -0.906725,
-    -0.906054,
-    -0.905316,
-    -0.904509,
-    -0.903635,
-    -0.902694,
-    -0.901687,
-    -0.900614,
-    -0.899476,
-    -0.898274,
-    -0.897008,
-    -0.895681,
-    -0.894292,
-    -0.892843,
-    -0.891336,
-    -0.889771,
-    -0.88815,
-    -0.886474,
-    -0.884744,
-    -0.882963,
-    -0.881132,
-    -0.879253,
-    -0.877327,
-    -0.875357,
-    -0.873343,
-    -0.871289,
-    -0.869196,
-    -0.867066,
-    -0.864902,
-    -0.862705,
-    -0.860478,
-    -0.858223,
-    -0.855943,
-    -0.853639,
-    -0.851315,
-    -0.848973,
-    -0.846615,
-    -0.844244,
-    -0.841862,
-    -0.839473,
-    -0.837078,
-    -0.834681,
-    -0.832284,
-    -0.82989,
-    -0.827502,
-    -0.825122,
-    -0.822753,
-    -0.820399,
-    -0.818061,
-    -0.815743,
-    -0.813447,
-    -0.811177,
-    -0.808935,
-    -0.806724,
-    -0.804547,
-    -0.802406,
-    -0.800304,
-    -0.798245,
-    -0.79623,
-    -0.794263,
-    -0.792346,
-    -0.790481,
-    -0.788672,
-    -0.786922,
-    -0.785231,
-    -0.783604,
-    -0.782042,
-    -0.780549,
-    -0.779125,
-    -0.777774,
-    -0.776498,
-    -0.775299,
-    -0.774179,
-    -0.77314,
-    -0.772184,
-    -0.771314,
-    -0.77053,
-    -0.769835,
-    -0.769231,
-    -0.768718,
-    -0.768299,
-    -0.767975,
-    -0.767747,
-    -0.767617,
-    -0.767585,
-    -0.767653,
-    -0.767822,
-    -0.768093,
-    -0.768466,
-    -0.768942,
-    -0.769522,
-    -0.770205,
-    -0.770994,
-    -0.771887,
-    -0.772885,
-    -0.773987,
-    -0.775195,
-    -0.776507,
-    -0.777924,
-    -0.779444,
-    -0.781068,
-    -0.782794,
-    -0.784622,
-    -0.786551,
-    -0.78858,
-    -0.790708,
-    -0.792933,
-    -0.795254,
-    -0.79767,
-    -0.800179,
-    -0.80278,
-    -0.80547,
-    -0.808247,
-    -0.81111,
-    -0.814056,
-    -0.817083,
-    -0.820188,
-    -0.823369,
-    -0.826624,
-    -0.829949,
-    -0.833341,
-    -0.836798,
-    -0.840317,
-    -0.843894,
-    -0.847525,
-    -0.851209,
-    -0.85494,
-    -0.858716,
-    -0.862533,
-    -0.866386,
-    -0.870273,
-    -0.874188,
-    -0.878129,
-    -0.88209,
-    -0.886068,
-    -0.890058,
-    -0.894056,
-    -0.898058,
-    -0.902058,
-    -0.906053,
-    -0.910038,
-    -0.914007,
-    -0.917956,
-    -0.921881,
-    -0.925776,
-    -0.929637,
-    -0.933459,
-    -0.937235,
-    -0.940963,
-    -0.944635,
-    -0.948248,
-    -0.951797,
-    -0.955275,
-    -0.958678,
-    -0.962001,
-    -0.965238,
-    -0.968385,
-    -0.971436,
-    -0.974385,
-    -0.977229,
-    -0.979961,
-    -0.982576,
-    -0.98507,
-    -0.987437,
-    -0.989673,
-    -0.991771,
-    -0.993728,
-    -0.995537,
-    -0.997195,
-    -0.998696,
-    -1.00004,
-    -1.00121,
-    -1.00221,
-    -1.00304,
-    -1.00369,
-    -1.00415,
-    -1.00442,
-    -1.0045,
-    -1.00439,
-    -1.00407,
-    -1.00354,
-    -1.00281,
-    -1.00186,
-    -1.00069,
-    -0.999306,
-    -0.997695,
-    -0.995855,
-    -0.993785,
-    -0.99148,
-    -0.988937,
-    -0.986154,
-    -0.983127,
-    -0.979854,
-    -0.976333,
-    -0.972561,
-    -0.968536,
-    -0.964255,
-    -0.959716,
-    -0.954919,
-    -0.94986,
-    -0.944539,
-    -0.938954,
-    -0.933104,
-    -0.926988,
-    -0.920605,
-    -0.913954,
-    -0.907034,
-    -0.899846,
-    -0.892388,
-    -0.884661,
-    -0.876665,
-    -0.868399,
-    -0.859865,
-    -0.851063,
-    -0.841994,
-    -0.832658,
-    -0.823056,
-    -0.813191,
-    -0.803062,
-    -0.792672,
-    -0.782022,
-    -0.771115,
-    -0.759952,
-    -0.748536,
-    -0.736868,
-    -0.724952,
-    -0.71279,
-    -0.700384,
-    -0.687739,
-    -0.674857,
-    -0.661742,
-    -0.648396,
-    -0.634824,
-    -0.621029,
-    -0.607015,
-    -0.592787,
-    -0.578348,
-    -0.563703,
-    -0.548856,
-    -0.533813,
-    -0.518576,
-    -0.503153,
-    -0.487547,
-    -0.471763,
-    -0.455808,
-    -0.439686,
-    -0.423402,
-    -0.406963,
-    -0.390374,
-    -0.37364,
-    -0.356768,
-    -0.339764,
-    -0.322633,
-    -0.305382,
-    -0.288017,
-    -0.270544,
-    -0.25297,
-    -0.235302,
-    -0.217544,
-    -0.199705,
-    -0.181791,
-    -0.163808,
-    -0.145764,
-    -0.127664,
-    -0.109516,
-    -0.0913268,
-    -0.073103,
-    -0.0548515,
-    -0.0365792,
-    -0.0182931
-};
-
-// Top frequency: 44.1K * 0.0580499
-constexpr static std::array<float, 4096> wt_square_0x7 =
-{
-    0,
-    0.00997848,
-    0.0199558,
-    0.029931,
-    0.0399027,
-    0.04987,
-    0.0598317,
-    0.0697867,
-    0.0797339,
-    0.0896721,
-    0.0996003,
-    0.109517,
-    0.119422,
-    0.129314,
-    0.13919,
-    0.149052,
-    0.158897,
-    0.168723,
-    0.178532,
-    0.18832,
-    0.198087,
-    0.207832,
-    0.217554,
-    0.227252,
-    0.236924,
-    0.24657,
-    0.256189,
-    0.265779,
-    0.27534,
-    0.28487,
-    0.294368,
-    0.303835,
-    0.313267,
-    0.322665,
-    0.332027,
-    0.341353,
-    0.350641,
-    0.35989,
-    0.3691,
-    0.378269,
-    0.387397,
-    0.396483,
-    0.405525,
-    0.414523,
-    0.423475,
-    0.432382,
-    0.441241,
-    0.450053,
-    0.458815,
-    0.467528,
-    0.47619,
-    0.484801,
-    0.49336,
-    0.501866,
-    0.510317,
-    0.518714,
-    0.527055,
-    0.53534,
-    0.543568,
-    0.551738,
-    0.559849,
-    0.5679,
-    0.575892,
-    0.583823,
-    0.591692,
-    0.599498,
-    0.607242,
-    0.614922,
-    0.622538,
-    0.630088,
-    0.637573,
-    0.644992,
-    0.652344,
-    0.659629,
-    0.666845,
-    0.673993,
-    0.681071,
-    0.68808,
-    0.695018,
-    0.701886,
-    0.708682,
-    0.715407,
-    0.722059,
-    0.728638,
-    0.735144,
-    0.741577,
-    0.747935,
-    0.754219,
-    0.760428,
-    0.766562,
-    0.77262,
-    0.778602,
-    0.784508,
-    0.790337,
-    0.796089,
-    0.801763,
-    0.807361,
-    0.81288,
-    0.818321,
-    0.823684,
-    0.828969,
-    0.834174,
-    0.839301,
-    0.844349,
-    0.849317,
-    0.854206,
-    0.859015,
-    0.863745,
-    0.868394,
-    0.872964,
-    0.877454,
-    0.881864,
-    0.886194,
-    0.890443,
-    0.894613,
-    0.898702,
-    0.902711,
-    0.90664,
-    0.910489,
-    0.914258,
-    0.917947,
-    0.921556,
-    0.925085,
-    0.928535,
-    0.931905,
-    0.935196,
-    0.938407,
-    0.941539,
-    0.944593,
-    0.947567,
-    0.950463,
-    0.953281,
-    0.956021,
-    0.958683,
-    0.961267,
-    0.963775,
-    0.966205,
-    0.968558,
-    0.970835,
-    0.973036,
-    0.975161,
-    0.977211,
-    0.979186,
-    0.981087,
-    0.982913,
-    0.984665,
-    0.986344,
-    0.98795,
-    0.989483,
-    0.990944,
-    0.992334,
-    0.993652,
-    0.9949,
-    0.996077,
-    0.997185,
-    0.998223,
-    0.999193,
-    1.00009,
-    1.00093,
-    1.0017,
-    1.0024,
-    1.00303,
-    1.0036,
-    1.00411,
-    1.00455,
-    1.00492,
-    1.00524,
-    1.00549,
-    1.00568,
-    1.00581,
-    1.00588,
-    1.00589,
-    1.00584,
-    1.00573,
-    1.00557,
-    1.00535,
-    1.00507,
-    1.00474,
-    1.00435,
-    1.00391,
-    1.00341,
-    1.00286,
-    1.00226,
-    1.00161,
-    1.00091,
-    1.00016,
-    0.999365,
-    0.998519,
-    0.997625,
-    0.996685,
-    0.995699,
-    0.994668,
-    0.993594,
-    0.992476,
-    0.991316,
-    0.990114,
-    0.988872,
-    0.98759,
-    0.986268,
-    0.984909,
-    0.983512,
-    0.982078,
-    0.980608,
-    0.979104,
-    0.977565,
-    0.975993,
-    0.974389,
-    0.972753,
-    0.971087,
-    0.96939,
-    0.967664,
-    0.965911,
-    0.964129,
-    0.962322,
-    0.960488,
-    0.95863,
-    0.956748,
-    0.954842,
-    0.952914,
-    0.950965,
-    0.948995,
-    0.947006,
-    0.944997,
-    0.94297,
-    0.940926,
-    0.938866,
-    0.93679,
-    0.934699,
-    0.932594,
-    0.930476,
-    0.928346,
-    0.926204,
-    0.924052,
-    0.92189,
-    0.919718,
-    0.917538,
-    0.915351,
-    0.913158,
-    0.910958,
-    0.908753,
-    0.906544,
-    0.904331,
-    0.902116,
-    0.899898,
-    0.897679,
-    0.89546,
-    0.893241,
-    0.891023,
-    0.888807,
-    0.886593,
-    0.884382,
-    0.882175,
-    0.879973,
-    0.877776,
-    0.875585,
-    0.873401,
-    0.871224,
-    0.869055,
-    0.866895,
-    0.864744,
-    0.862604,
-    0.860474,
-    0.858355,
-    0.856248,
-    0.854154,
-    0.852073,
-    0.850006,
-    0.847953,
-    0.845915,
-    0.843892,
-    0.841886,
-    0.839896,
-    0.837924,
-    0.835969,
-    0.834033,
-    0.832115,
-    0.830217,
-    0.828339,
-    0.826481,
-    0.824643,
-    0.822827,
-    0.821033,
-    0.819261,
-    0.817512,
-    0.815786,
-    0.814083,
-    0.812404,
-    0.81075,
-    0.80912,
-    0.807516,
-    0.805937,
-    0.804384,
-    0.802857,
-    0.801356,
-    0.799883,
-    0.798437,
-    0.797018,
-    0.795627,
-    0.794265,
-    0.792931,
-    0.791625,
-    0.790349,
-    0.789101,
-    0.787883,
-    0.786695,
-    0.785537,
-    0.784409,
-    0.783311,
-    0.782243,
-    0.781206,
-    0.7802,
-    0.779225,
-    0.778282,
-    0.777369,
-    0.776488,
-    0.775638,
-    0.77482,
-    0.774033,
-    0.773278,
-    0.772556,
-    0.771865,
-    0.771205,
-    0.770578,
-    0.769983,
-    0.76942,
-    0.768889,
-    0.76839,
-    0.767923,
-    0.767488,
-    0.767085,
-    0.766714,
-    0.766375,
-    0.766067,
-    0.765791,
-    0.765547,
-    0.765335,
-    0.765154,
-    0.765004,
-    0.764885,
-    0.764798,
-    0.764742,
-    0.764716,
-    0.764721,
-    0.764757,
-    0.764823,
-    0.764919,
-    0.765045,
-    0.765201,
-    0.765386,
-    0.765601,
-    0.765845,
-    0.766117,
-    0.766419,
-    0.766748,
-    0.767106,
-    0.767492,
-    0.767905,
-    0.768346,
-    0.768813,
-    0.769308,
-    0.769829,
-    0.770376,
-    0.770949,
-    0.771547,
-    0.772171,
-    0.772819,
-    0.773492,
-    0.774189,
-    0.77491,
-    0.775654,
-    0.776422,
-    0.777212,
-    0.778025,
-    0.778859,
-    0.779715,
-    0.780593,
-    0.781491,
-    0.782409,
-    0.783348,
-    0.784306,
-    0.785283,
-    0.786279,
-    0.787293,
-    0.788326,
-    0.789375,
-    0.790442,
-    0.791526,
-    0.792625,
-    0.793741,
-    0.794871,
-    0.796017,
-    0.797177,
-    0.79835,
-    0.799538,
-    0.800738,
-    0.801951,
-    0.803176,
-    0.804412,
-    0.80566,
-    0.806919,
-    0.808187,
-    0.809466,
-    0.810753,
-    0.81205,
-    0.813355,
-    0.814668,
-    0.815988,
-    0.817315,
-    0.818648,
-    0.819988,
-    0.821333,
-    0.822683,
-    0.824037,
-    0.825396,
-    0.826758,
-    0.828123,
-    0.829491,
-    0.830861,
-    0.832233,
-    0.833606,
-    0.83498,
-    0.836354,
-    0.837728,
-    0.839102,
-    0.840474,
-    0.841845,
-    0.843214,
-    0.84458,
-    0.845944,
-    0.847304,
-    0.84866,
-    0.850012,
-    0.85136,
-    0.852702,
-    0.854039,
-    0.85537,
-    0.856695,
-    0.858013,
-    0.859324,
-    0.860627,
-    0.861922,
-    0.863208,
-    0.864486,
-    0.865755,
-    0.867014,
-    0.868263,
-    0.869501,
-    0.870729,
-    0.871946,
-    0.873151,
-    0.874344,
-    0.875526,
-    0.876694,
-    0.87785,
-    0.878992,
-    0.880121,
-    0.881236,
-    0.882336,
-    0.883423,
-    0.884494,
-    0.88555,
-    0.88659,
-    0.887615,
-    0.888624,
-    0.889616,
-    0.890592,
-    0.891551,
-    0.892493,
-    0.893417,
-    0.894324,
-    0.895212,
-    0.896083,
-    0.896935,
-    0.897769,
-    0.898584,
-    0.89938,
-    0.900157,
-    0.900914,
-    0.901652,
-    0.902369,
-    0.903067,
-    0.903745,
-    0.904403,
-    0.90504,
-    0.905657,
-    0.906252,
-    0.906827,
-    0.907381,
-    0.907914,
-    0.908426,
-    0.908917,
-    0.909386,
-    0.909833,
-    0.910259,
-    0.910664,
-    0.911047,
-    0.911408,
-    0.911747,
-    0.912064,
-    0.912359,
-    0.912633,
-    0.912884,
-    0.913114,
-    0.913322,
-    0.913507,
-    0.913671,
-    0.913813,
-    0.913933,
-    0.914031,
-    0.914107,
-    0.914161,
-    0.914194,
-    0.914205,
-    0.914194,
-    0.914161,
-    0.914108,
-    0.914032,
-    0.913936,
-    0.913818,
-    0.913679,
-    0.913519,
-    0.913338,
-    0.913136,
-    0.912914,
-    0.912671,
-    0.912408,
-    0.912124,
-    0.911821,
-    0.911497,
-    0.911154,
-    0.910792,
-    0.91041,
-    0.910008,
-    0.909588,
-    0.909149,
-    0.908691,
-    0.908215,
-    0.907721,
-    0.907208,
-    0.906678,
-    0.906131,
-    0.905566,
-    0.904984,
-    0.904385,
-    0.90377,
-    0.903138,
-    0.90249,
-    0.901827,
-    0.901148,
-    0.900454,
-    0.899745,
-    0.899021,
-    0.898282,
-    0.89753,
-    0.896764,
-    0.895984,
-    0.895191,
-    0.894385,
-    0.893566,
-    0.892735,
-    0.891892,
-    0.891037,
-    0.890171,
-    0.889294,
-    0.888406,
-    0.887508,
-    0.886599,
-    0.885681,
-    0.884754,
-    0.883817,
-    0.882872,
-    0.881918,
-    0.880956,
-    0.879987,
-    0.87901,
-    0.878026,
-    0.877035,
-    0.876038,
-    0.875035,
-    0.874027,
-    0.873013,
-    0.871994,
-    0.870971,
-    0.869943,
-    0.868912,
-    0.867877,
-    0.866839,
-    0.865798,
-    0.864755,
-    0.86371,
-    0.862663,
-    0.861614,
-    0.860565,
-    0.859515,
-    0.858465,
-    0.857415,
-    0.856365,
-    0.855316,
-    0.854268,
-    0.853221,
-    0.852177,
-    0.851134,
-    0.850094,
-    0.849057,
-    0.848023,
-    0.846993,
-    0.845966,
-    0.844944,
-    0.843926,
-    0.842913,
-    0.841906,
-    0.840903,
-    0.839907,
-    0.838917,
-    0.837933,
-    0.836956,
-    0.835987,
-    0.835024,
-    0.83407,
-    0.833123,
-    0.832185,
-    0.831256,
-    0.830335,
-    0.829424,
-    0.828522,
-    0.82763,
-    0.826748,
-    0.825876,
-    0.825015,
-    0.824165,
-    0.823326,
-    0.822499,
-    0.821683,
-    0.820879,
-    0.820087,
-    0.819307,
-    0.818541,
-    0.817787,
-    0.817046,
-    0.816318,
-    0.815604,
-    0.814904,
-    0.814218,
-    0.813545,
-    0.812888,
-    0.812244,
-    0.811616,
-    0.811002,
-    0.810404,
-    0.80982,
-    0.809252,
-    0.8087,
-    0.808164,
-    0.807643,
-    0.807138,
-    0.80665,
-    0.806178,
-    0.805722,
-    0.805283,
-    0.80486,
-    0.804454,
-    0.804065,
-    0.803694,
-    0.803339,
-    0.803001,
-    0.802681,
-    0.802378,
-    0.802092,
-    0.801824,
-    0.801573,
-    0.80134,
-    0.801124,
-    0.800926,
-    0.800746,
-    0.800583,
-    0.800438,
-    0.800311,
-    0.800202,
-    0.80011,
-    0.800036,
-    0.79998,
-    0.799942,
-    0.799921,
-    0.799918,
-    0.799933,
-    0.799965,
-    0.800015,
-    0.800083,
-    0.800168,
-    0.80027,
-    0.80039,
-    0.800527,
-    0.800681,
-    0.800852,
-    0.801041,
-    0.801246,
-    0.801469,
-    0.801708,
-    0.801963,
-    0.802235,
-    0.802524,
-    0.802829,
-    0.80315,
-    0.803487,
-    0.80384,
-    0.804208,
-    0.804593,
-    0.804992,
-    0.805407,
-    0.805837,
-    0.806283,
-    0.806742,
-    0.807217,
-    0.807705,
-    0.808208,
-    0.808726,
-    0.809256,
-    0.809801,
-    0.810359,
-    0.81093,
-    0.811514,
-    0.812111,
-    0.812721,
-    0.813343,
-    0.813977,
-    0.814622,
-    0.81528,
-    0.815949,
-    0.816629,
-    0.81732,
-    0.818022,
-    0.818734,
-    0.819456,
-    0.820188,
-    0.82093,
-    0.821681,
-    0.822442,
-    0.823211,
-    0.823989,
-    0.824775,
-    0.825569,
-    0.826371,
-    0.82718,
-    0.827997,
-    0.82882,
-    0.829651,
-    0.830487,
-    0.831329,
-    0.832178,
-    0.833031,
-    0.83389,
-    0.834754,
-    0.835622,
-    0.836494,
-    0.837371,
-    0.838251,
-    0.839135,
-    0.840021,
-    0.84091,
-    0.841802,
-    0.842696,
-    0.843592,
-    0.844489,
-    0.845388,
-    0.846288,
-    0.847188,
-    0.848088,
-    0.848989,
-    0.849889,
-    0.850789,
-    0.851688,
-    0.852586,
-    0.853482,
-    0.854376,
-    0.855269,
-    0.856159,
-    0.857046,
-    0.85793,
-    0.858811,
-    0.859689,
-    0.860563,
-    0.861432,
-    0.862297,
-    0.863158,
-    0.864013,
-    0.864864,
-    0.865708,
-    0.866547,
-    0.86738,
-    0.868206,
-    0.869026,
-    0.869839,
-    0.870644,
-    0.871443,
-    0.872233,
-    0.873016,
-    0.87379,
-    0.874556,
-    0.875313,
-    0.876061,
-    0.8768,
-    0.87753,
-    0.87825,
-    0.87896,
-    0.87966,
-    0.880349,
-    0.881028,
-    0.881696,
-    0.882353,
-    0.882999,
-    0.883634,
-    0.884257,
-    0.884868,
-    0.885467,
-    0.886054,
-    0.886628,
-    0.88719,
-    0.887739,
-    0.888276,
-    0.888799,
-    0.889309,
-    0.889805,
-    0.890288,
-    0.890758,
-    0.891213,
-    0.891654,
-    0.892082,
-    0.892495,
-    0.892893,
-    0.893278,
-    0.893647,
-    0.894002,
-    0.894342,
-    0.894667,
-    0.894977,
-    0.895272,
-    0.895552,
-    0.895816,
-    0.896065,
-    0.896299,
-    0.896517,
-    0.89672,
-    0.896906,
-    0.897078,
-    0.897233,
-    0.897373,
-    0.897497,
-    0.897606,
-    0.897698,
-    0.897775,
-    0.897836,
-    0.897881,
-    0.89791,
-    0.897923,
-    0.89792,
-    0.897902,
-    0.897868,
-    0.897817,
-    0.897752,
-    0.89767,
-    0.897573,
-    0.89746,
-    0.897331,
-    0.897187,
-    0.897028,
-    0.896853,
-    0.896662,
-    0.896457,
-    0.896236,
-    0.896,
-    0.89575,
-    0.895484,
-    0.895203,
-    0.894908,
-    0.894598,
-    0.894274,
-    0.893935,
-    0.893582,
-    0.893215,
-    0.892834,
-    0.892439,
-    0.892031,
-    0.891608,
-    0.891173,
-    0.890724,
-    0.890262,
-    0.889787,
-    0.8893,
-    0.8888,
-    0.888287,
-    0.887763,
-    0.887226,
-    0.886677,
-    0.886117,
-    0.885545,
-    0.884962,
-    0.884368,
-    0.883763,
-    0.883148,
-    0.882522,
-    0.881886,
-    0.881239,
-    0.880583,
-    0.879918,
-    0.879243,
-    0.878559,
-    0.877866,
-    0.877165,
-    0.876455,
-    0.875738,
-    0.875012,
-    0.874278,
-    0.873538,
-    0.87279,
-    0.872035,
-    0.871274,
-    0.870506,
-    0.869732,
-    0.868953,
-    0.868168,
-    0.867377,
-    0.866582,
-    0.865781,
-    0.864977,
-    0.864168,
-    0.863355,
-    0.862538,
-    0.861718,
-    0.860895,
-    0.86007,
-    0.859241,
-    0.85841,
-    0.857578,
-    0.856743,
-    0.855908,
-    0.855071,
-    0.854233,
-    0.853394,
-    0.852556,
-    0.851717,
-    0.850878,
-    0.85004,
-    0.849203,
-    0.848367,
-    0.847533,
-    0.8467,
-    0.845869,
-    0.84504,
-    0.844214,
-    0.84339,
-    0.84257,
-    0.841753,
-    0.840939,
-    0.84013,
-    0.839324,
-    0.838523,
-    0.837727,
-    0.836936,
-    0.836149,
-    0.835369,
-    0.834594,
-    0.833825,
-    0.833062,
-    0.832306,
-    0.831557,
-    0.830814,
-    0.830079,
-    0.829352,
-    0.828632,
-    0.82792,
-    0.827216,
-    0.826521,
-    0.825835,
-    0.825157,
-    0.824489,
-    0.82383,
-    0.82318,
-    0.822541,
-    0.821911,
-    0.821292,
-    0.820683,
-    0.820085,
-    0.819497,
-    0.818921,
-    0.818356,
-    0.817802,
-    0.81726,
-    0.816729,
-    0.816211,
-    0.815705,
-    0.815211,
-    0.814729,
-    0.81426,
-    0.813804,
-    0.813361,
-    0.812931,
-    0.812514,
-    0.81211,
-    0.81172,
-    0.811344,
-    0.810981,
-    0.810632,
-    0.810297,
-    0.809977,
-    0.80967,
-    0.809378,
-    0.8091,
-    0.808837,
-    0.808588,
-    0.808354,
-    0.808134,
-    0.80793,
-    0.80774,
-    0.807565,
-    0.807406,
-    0.807261,
-    0.807131,
-    0.807017,
-    0.806918,
-    0.806834,
-    0.806765,
-    0.806711,
-    0.806673,
-    0.80665,
-    0.806642,
-    0.80665,
-    0.806673,
-    0.806711,
-    0.806765,
-    0.806834,
-    0.806918,
-    0.807017,
-    0.807131,
-    0.807261,
-    0.807406,
-    0.807565,
-    0.80774,
-    0.80793,
-    0.808134,
-    0.808354,
-    0.808588,
-    0.808837,
-    0.8091,
-    0.809378,
-    0.80967,
-    0.809977,
-    0.810297,
-    0.810632,
-    0.810981,
-    0.811344,
-    0.81172,
-    0.81211,
-    0.812514,
-    0.812931,
-    0.813361,
-    0.813804,
-    0.81426,
-    0.814729,
-    0.815211,
-    0.815705,
-    0.816211,
-    0.816729,
-    0.81726,
-    0.817802,
-    0.818356,
-    0.818921,
-    0.819497,
-    0.820085,
-    0.820683,
-    0.821292,
-    0.821911,
-    0.822541,
-    0.82318,
-    0.82383,
-    0.824489,
-    0.825157,
-    0.825835,
-    0.826521,
-    0.827216,
-    0.82792,
-    0.828632,
-    0.829352,
-    0.830079,
-    0.830814,
-    0.831557,
-    0.832306,
-    0.833062,
-    0.833825,
-    0.834594,
-    0.835369,
-    0.836149,
-    0.836936,
-    0.837727,
-    0.838523,
-    0.839324,
-    0.84013,
-    0.840939,
-    0.841753,
-    0.84257,
-    0.84339,
-    0.844214,
-    0.84504,
-    0.845869,
-    0.8467,
-    0.847533,
-    0.848367,
-    0.849203,
-    0.85004,
-    0.850878,
-    0.851717,
-    0.852556,
-    0.853394,
-    0.854233,
-    0.855071,
-    0.855908,
-    0.856743,
-    0.857578,
-    0.85841,
-    0.859241,
-    0.86007,
-    0.860895,
-    0.861718,
-    0.862538,
-    0.863355,
-    0.864168,
-    0.864977,
-    0.865781,
-    0.866582,
-    0.867377,
-    0.868168,
-    0.868953,
-    0.869732,
-    0.870506,
-    0.871274,
-    0.872035,
-    0.87279,
-    0.873538,
-    0.874278,
-    0.875012,
-    0.875738,
-    0.876455,
-    0.877165,
-    0.877866,
-    0.878559,
-    0.879243,
-    0.879918,
-    0.880583,
-    0.881239,
-    0.881886,
-    0.882522,
-    0.883148,
-    0.883763,
-    0.884368,
-    0.884962,
-    0.885545,
-    0.886117,
-    0.886677,
-    0.887226,
-    0.887763,
-    0.888287,
-    0.8888,
-    0.8893,
-    0.889787,
-    0.890262,
-    0.890724,
-    0.891173,
-    0.891608,
-    0.892031,
-    0.892439,
-    0.892834,
-    0.893215,
-    0.893582,
-    0.893935,
-    0.894274,
-    0.894598,
-    0.894908,
-    0.895203,
-    0.895484,
-    0.89575,
-    0.896,
-    0.896236,
-    0.896457,
-    0.896662,
-    0.896853,
-    0.897028,
-    0.897187,
-    0.897331,
-    0.89746,
-    0.897573,
-    0.89767,
-    0.897752,
-    0.897817,
-    0.897868,
-    0.897902,
-    0.89792,
-    0.897923,
-    0.89791,
-    0.897881,
-    0.897836,
-    0.897775,
-    0.897698,
-    0.897606,
-    0.897497,
-    0.897373,
-    0.897233,
-    0.897078,
-    0.896906,
-    0.89672,
-    0.896517,
-    0.896299,
-    0.896065,
-    0.895816,
-    0.895552,
-    0.895272,
-    0.894977,
-    0.894667,
-    0.894342,
-    0.894002,
-    0.893647,
-    0.893278,
-    0.892893,
-    0.892495,
-    0.892082,
-    0.891654,
-    0.891213,
-    0.890758,
-    0.890288,
-    0.889805,
-    0.889309,
-    0.888799,
-    0.888276,
-    0.887739,
-    0.88719,
-    0.886628,
-    0.886054,
-    0.885467,
-    0.884868,
-    0.884257,
-    0.883634,
-    0.882999,
-    0.882353,
-    0.881696,
-    0.881028,
-    0.880349,
-    0.87966,
-    0.87896,
-    0.87825,
-    0.87753,
-    0.8768,
-    0.876061,
-    0.875313,
-    0.874556,
-    0.87379,
-    0.873016,
-    0.872233,
-    0.871443,
-    0.870644,
-    0.869839,
-    0.869026,
-    0.868206,
-    0.86738,
-    0.866547,
-    0.865708,
-    0.864864,
-    0.864013,
-    0.863158,
-    0.862297,
-    0.861432,
-    0.860563,
-    0.859689,
-    0.858811,
-    0.85793,
-    0.857046,
-    0.856159,
-    0.855269,
-    0.854376,
-    0.853482,
-    0.852586,
-    0.851688,
-    0.850789,
-    0.849889,
-    0.848989,
-    0.848088,
-    0.847188,
-    0.846288,
-    0.845388,
-    0.844489,
-    0.843592,
-    0.842696,
-    0.841802,
-    0.84091,
-    0.840021,
-    0.839135,
-    0.838251,
-    0.837371,
-    0.836494,
-    0.835622,
-    0.834754,
-    0.83389,
-    0.833031,
-    0.832178,
-    0.831329,
-    0.830487,
-    0.829651,
-    0.82882,
-    0.827997,
-    0.82718,
-    0.826371,
-    0.825569,
-    0.824775,
-    0.823989,
-    0.823211,
-    0.822442,
-    0.821681,
-    0.82093,
-    0.820188,
-    0.819456,
-    0.818734,
-    0.818022,
-    0.81732,
-    0.816629,
-    0.815949,
-    0.81528,
-    0.814622,
-    0.813977,
-    0.813343,
-    0.812721,
-    0.812111,
-    0.811514,
-    0.81093,
-    0.810359,
-    0.809801,
-    0.809256,
-    0.808726,
-    0.808208,
-    0.807705,
-    0.807217,
-    0.806742,
-    0.806283,
-    0.805837,
-    0.805407,
-    0.804992,
-    0.804593,
-    0.804208,
-    0.80384,
-    0.803487,
-    0.80315,
-    0.802829,
-    0.802524,
-    0.802235,
-    0.801963,
-    0.801708,
-    0.801469,
-    0.801246,
-    0.801041,
-    0.800852,
-    0.800681,
-    0.800527,
-    0.80039,
-    0.80027,
-    0.800168,
-    0.800083,
-    0.800015,
-    0.799965,
-    0.799933,
-    0.799918,
-    0.799921,
-    0.799942,
-    0.79998,
-    0.800036,
-    0.80011,
-    0.800202,
-    0.800311,
-    0.800438,
-    0.800583,
-    0.800746,
-    0.800926,
-    0.801124,
-    0.80134,
-    0.801573,
-    0.801824,
-    0.802092,
-    0.802378,
-    0.802681,
-    0.803001,
-    0.803339,
-    0.803694,
-    0.804065,
-    0.804454,
-    0.80486,
-    0.805283,
-    0.805722,
-    0.806178,
-    0.80665,
-    0.807138,
-    0.807643,
-    0.808164,
-    0.8087,
-    0.809252,
-    0.80982,
-    0.810404,
-    0.811002,
-    0.811616,
-    0.812244,
-    0.812888,
-    0.813545,
-    0.814218,
-    0.814904,
-    0.815604,
-    0.816318,
-    0.817046,
-    0.817787,
-    0.818541,
-    0.819307,
-    0.820087,
-    0.820879,
-    0.821683,
-    0.822499,
-    0.823326,
-    0.824165,
-    0.825015,
-    0.825876,
-    0.826748,
-    0.82763,
-    0.828522,
-    0.829424,
-    0.830335,
-    0.831256,
-    0.832185,
-    0.833123,
-    0.83407,
-    0.835024,
-    0.835987,
-    0.836956,
-    0.837933,
-    0.838917,
-    0.839907,
-    0.840903,
-    0.841906,
-    0.842913,
-    0.843926,
-    0.844944,
-    0.845966,
-    0.846993,
-    0.848023,
-    0.849057,
-    0.850094,
-    0.851134,
-    0.852177,
-    0.853221,
-    0.854268,
-    0.855316,
-    0.856365,
-    0.857415,
-    0.858465,
-    0.859515,
-    0.860565,
-    0.861614,
-    0.862663,
-    0.86371,
-    0.864755,
-    0.865798,
-    0.866839,
-    0.867877,
-    0.868912,
-    0.869943,
-    0.870971,
-    0.871994,
-    0.873013,
-    0.874027,
-    0.875035,
-    0.876038,
-    0.877035,
-    0.878026,
-    0.87901,
-    0.879987,
-    0.880956,
-    0.881918,
-    0.882872,
-    0.883817,
-    0.884754,
-    0.885681,
-    0.886599,
-    0.887508,
-    0.888406,
-    0.889294,
-    0.890171,
-    0.891037,
-    0.891892,
-    0.892735,
-    0.893566,
-    0.894385,
-    0.895191,
-    0.895984,
-    0.896764,
-    0.89753,
-    0.898282,
-    0.899021,
-    0.899745,
-    0.900454,
-    0.901148,
-    0.901827,
-    0.90249,
-    0.903138,
-    0.90377,
-    0.904385,
-    0.904984,
-    0.905566,
-    0.906131,
-    0.906678,
-    0.907208,
-    0.907721,
-    0.908215,
-    0.908691,
-    0.909149,
-    0.909588,
-    0.910008,
-    0.91041,
-    0.910792,
-    0.911154,
-    0.911497,
-    0.911821,
-    0.912124,
-    0.912408,
-    0.912671,
-    0.912914,
-    0.913136,
-    0.913338,
-    0.913519,
-    0.913679,
-    0.913818,
-    0.913936,
-    0.914032,
-    0.914108,
-    0.914161,
-    0.914194,
-    0.914205,
-    0.914194,
-    0.914161,
-    0.914107,
-    0.914031,
-    0.913933,
-    0.913813,
-    0.913671,
-    0.913507,
-    0.913322,
-    0.913114,
-    0.912884,
-    0.912633,
-    0.912359,
-    0.912064,
-    0.911747,
-    0.911408,
-    0.911047,
-    0.910664,
-    0.910259,
-    0.909833,
-    0.909386,
-    0.908917,
-    0.908426,
-    0.907914,
-    0.907381,
-    0.906827,
-    0.906252,
-    0.905657,
-    0.90504,
-    0.904403,
-    0.903745,
-    0.903067,
-    0.902369,
-    0.901652,
-    0.900914,
-    0.900157,
-    0.89938,
-    0.898584,
-    0.897769,
-    0.896935,
-    0.896083,
-    0.895212,
-    0.894324,
-    0.893417,
-    0.892493,
-    0.891551,
-    0.890592,
-    0.889616,
-    0.888624,
-    0.887615,
-    0.88659,
-    0.88555,
-    0.884494,
-    0.883423,
-    0.882336,
-    0.881236,
-    0.880121,
-    0.878992,
-    0.87785,
-    0.876694,
-    0.875526,
-    0.874344,
-    0.873151,
-    0.871946,
-    0.870729,
-    0.869501,
-    0.868263,
-    0.867014,
-    0.865755,
-    0.864486,
-    0.863208,
-    0.861922,
-    0.860627,
-    0.859324,
-    0.858013,
-    0.856695,
-    0.85537,
-    0.854039,
-    0.852702,
-    0.85136,
-    0.850012,
-    0.84866,
-    0.847304,
-    0.845944,
-    0.84458,
-    0.843214,
-    0.841845,
-    0.840474,
-    0.839102,
-    0.837728,
-    0.836354,
-    0.83498,
-    0.833606,
-    0.832233,
-    0.830861,
-    0.829491,
-    0.828123,
-    0.826758,
-    0.825396,
-    0.824037,
-    0.822683,
-    0.821333,
-    0.819988,
-    0.818648,
-    0.817315,
-    0.815988,
-    0.814668,
-    0.813355,
-    0.81205,
-    0.810753,
-    0.809466,
-    0.808187,
-    0.806919,
-    0.80566,
-    0.804412,
-    0.803176,
-    0.801951,
-    0.800738,
-    0.799538,
-    0.79835,
-    0.797177,
-    0.796017,
-    0.794871,
-    0.793741,
-    0.792625,
-    0.791526,
-    0.790442,
-    0.789375,
-    0.788326,
-    0.787293,
-    0.786279,
-    0.785283,
-    0.784306,
-    0.783348,
-    0.782409,
-    0.781491,
-    0.780593,
-    0.779715,
-    0.778859,
-    0.778025,
-    0.777212,
-    0.776422,
-    0.775654,
-    0.77491,
-    0.774189,
-    0.773492,
-    0.772819,
-    0.772171,
-    0.771547,
-    0.770949,
-    0.770376,
-    0.769829,
-    0.769308,
-    0.768813,
-    0.768346,
-    0.767905,
-    0.767492,
-    0.767106,
-    0.766748,
-    0.766419,
-    0.766117,
-    0.765845,
-    0.765601,
-    0.765386,
-    0.765201,
-    0.765045,
-    0.764919,
-    0.764823,
-    0.764757,
-    0.764721,
-    0.764716,
-    0.764742,
-    0.764798,
-    0.764885,
-    0.765004,
-    0.765154,
-    0.765335,
-    0.765547,
-    0.765791,
-    0.766067,
-    0.766375,
-    0.766714,
-    0.767085,
-    0.767488,
-    0.767923,
-    0.76839,
-    0.768889,
-    0.76942,
-    0.769983,
-    0.770578,
-    0.771205,
-    0.771865,
-    0.772556,
-    0.773278,
-    0.774033,
-    0.77482,
-    0.775638,
-    0.776488,
-    0.777369,
-    0.778282,
-    0.779225,
-    0.7802,
-    0.781206,
-    0.782243,
-    0.783311,
-    0.784409,
-    0.785537,
-    0.786695,
-    0.787883,
-    0.789101,
-    0.790349,
-    0.791625,
-    0.792931,
-    0.794265,
-    0.795627,
-    0.797018,
-    0.798437,
-    0.799883,
-    0.801356,
-    0.802857,
-    0.804384,
-    0.805937,
-    0.807516,
-    0.80912,
-    0.81075,
-    0.812404,
-    0.814083,
-    0.815786,
-    0.817512,
-    0.819261,
-    0.821033,
-    0.822827,
-    0.824643,
-    0.826481,
-    0.828339,
-    0.830217,
-    0.832115,
-    0.834033,
-    0.835969,
-    0.837924,
-    0.839896,
-    0.841886,
-    0.843892,
-    0.845915,
-    0.847953,
-    0.850006,
-    0.852073,
-    0.854154,
-    0.856248,
-    0.858355,
-    0.860474,
-    0.862604,
-    0.864744,
-    0.866895,
-    0.869055,
-    0.871224,
-    0.873401,
-    0.875585,
-    0.877776,
-    0.879973,
-    0.882175,
-    0.884382,
-    0.886593,
-    0.888807,
-    0.891023,
-    0.893241,
-    0.89546,
-    0.897679,
-    0.899898,
-    0.902116,
-    0.904331,
-    0.906544,
-    0.908753,
-    0.910958,
-    0.913158,
-    0.915351,
-    0.917538,
-    0.919718,
-    0.92189,
-    0.924052,
-    0.926204,
-    0.928346,
-    0.930476,
-    0.932594,
-    0.934699,
-    0.93679,
-    0.938866,
-    0.940926,
-    0.94297,
-    0.944997,
-    0.947006,
-    0.948995,
-    0.950965,
-    0.952914,
-    0.954842,
-    0.956748,
-    0.95863,
-    0.960488,
-    0.962322,
-    0.964129,
-    0.965911,
-    0.967664,
-    0.96939,
-    0.971087,
-    0.972753,
-    0.974389,
-    0.975993,
-    0.977565,
-    0.979104,
-    0.980608,
-    0.982078,
-    0.983512,
-    0.984909,
-    0.986268,
-    0.98759,
-    0.988872,
-    0.990114,
-    0.991316,
-    0.992476,
-    0.993594,
-    0.994668,
-    0.995699,
-    0.996685,
-    0.997625,
-    0.998519,
-    0.999365,
-    1.00016,
-    1.00091,
-    1.00161,
-    1.00226,
-    1.00286,
-    1.00341,
-    1.00391,
-    1.00435,
-    1.00474,
-    1.00507,
-    1.00535,
-    1.00557,
-    1.00573,
-    1.00584,
-    1.00589,
-    1.00588,
-    1.00581,
-    1.00568,
-    1.00549,
-    1.00524,
-    1.00492,
-    1.00455,
-    1.00411,
-    1.0036,
-    1.00303,
-    1.0024,
-    1.0017,
-    1.00093,
-    1.00009,
-    0.999193,
-    0.998223,
-    0.997185,
-    0.996077,
-    0.9949,
-    0.993652,
-    0.992334,
-    0.990944,
-    0.989483,
-    0.98795,
-    0.986344,
-    0.984665,
-    0.982913,
-    0.981087,
-    0.979186,
-    0.977211,
-    0.975161,
-    0.973036,
-    0.970835,
-    0.968558,
-    0.966205,
-    0.963775,
-    0.961267,
-    0.958683,
-    0.956021,
-    0.953281,
-    0.950463,
-    0.947567,
-    0.944593,
-    0.941539,
-    0.938407,
-    0.935196,
-    0.931905,
-    0.928535,
-    0.925085,
-    0.921556,
-    0.917947,
-    0.914258,
-    0.910489,
-    0.90664,
-    0.902711,
-    0.898702,
-    0.894613,
-    0.890443,
-    0.886194,
-    0.881864,
-    0.877454,
-    0.872964,
-    0.868394,
-    0.863745,
-    0.859015,
-    0.854206,
-    0.849317,
-    0.844349,
-    0.839301,
-    0.834174,
-    0.828969,
-    0.823684,
-    0.818321,
-    0.81288,
-    0.807361,
-    0.801763,
-    0.796089,
-    0.790337,
-    0.784508,
-    0.778602,
-    0.77262,
-    0.766562,
-    0.760428,
-    0.754219,
-    0.747935,
-    0.741577,
-    0.735144,
-    0.728638,
-    0.722059,
-    0.715407,
-    0.708682,
-    0.701886,
-    0.695018,
-    0.68808,
-    0.681071,
-    0.673993,
-    0.666845,
-    0.659629,
-    0.652344,
-    0.644992,
-    0.637573,
-    0.630088,
-    0.622538,
-    0.614922,
-    0.607242,
-    0.599498,
-    0.591692,
-    0.583823,
-    0.575892,
-    0.5679,
-    0.559849,
-    0.551738,
-    0.543568,
-    0.53534,
-    0.527055,
-    0.518714,
-    0.510317,
-    0.501866,
-    0.49336,
-    0.484801,
-    0.47619,
-    0.467528,
-    0.458815,
-    0.450053,
-    0.441241,
-    0.432382,
-    0.423475,
-    0.414523,
-    0.405525,
-    0.396483,
-    0.387397,
-    0.378269,
-    0.3691,
-    0.35989,
-    0.350641,
-    0.341353,
-    0.332027,
-    0.322665,
-    0.313267,
-    0.303835,
-    0.294368,
-    0.28487,
-    0.27534,
-    0.265779,
-    0.256189,
-    0.24657,
-    0.236924,
-    0.227252,
-    0.217554,
-    0.207832,
-    0.198087,
-    0.18832,
-    0.178532,
-    0.168723,
-    0.158897,
-    0.149052,
-    0.13919,
-    0.129314,
-    0.119422,
-    0.109517,
-    0.0996003,
-    0.0896721,
-    0.0797339,
-    0.0697867,
-    0.0598317,
-    0.04987,
-    0.0399027,
-    0.029931,
-    0.0199558,
-    0.00997848,
-    0,
-    -0.00997848,
-    -0.0199558,
-    -0.029931,
-    -0.0399027,
-    -0.04987,
-    -0.0598317,
-    -0.0697867,
-    -0.0797339,
-    -0.0896721,
-    -0.0996003,
-    -0.109517,
-    -0.119422,
-    -0.129314,
-    -0.13919,
-    -0.149052,
-    -0.158897,
-    -0.168723,
-    -0.178532,
-    -0.18832,
-    -0.198087,
-    -0.207832,
-    -0.217554,
-    -0.227252,
-    -0.236924,
-    -0.24657,
-    -0.256189,
-    -0.265779,
-    -0.27534,
-    -0.28487,
-    -0.294368,
-    -0.303835,
-    -0.313267,
-    -0.322665,
-    -0.332027,
-    -0.341353,
-    -0.350641,
-    -0.35989,
-    -0.3691,
-    -0.378269,
-    -0.387397,
-    -0.396483,
-    -0.405525,
-    -0.414523,
-    -0.423475,
-    -0.432382,
-    -0.441241,
-    -0.450053,
-    -0.458815,
-    -0.467528,
-    -0.47619,
-    -0.484801,
-    -0.49336,
-    -0.501866,
-    -0.510317,
-    -0.518714,
-    -0.527055,
-    -0.53534,
-    -0.543568,
-    -0.551738,
-    -0.559849,
-    -0.5679,
-    -0.575892,
-    -0.583823,
-    -0.591692,
-    -0.599498,
-    -0.607242,
-    -0.614922,
-    -0.622538,
-    -0.630088,
-    -0.637573,
-    -0.644992,
-    -0.652344,
-    -0.659629,
-    -0.666845,
-    -0.673993,
-    -0.681071,
-    -0.68808,
-    -0.695018,
-    -0.701886,
-    -0.708682,
-    -0.715407,
-    -0.722059,
-    -0.728638,
-    -0.735144,
-    -0.741577,
-    -0.747935,
-    -0.754219,
-    -0.760428,
-    -0.766562,
-    -0.77262,
-    -0.778602,
-    -0.784508,
-    -0.790337,
-    -0.796089,
-    -0.801763,
-    -0.807361,
-    -0.81288,
-    -0.818321,
-    -0.823684,
-    -0.828969,
-    -0.834174,
-    -0.839301,
-    -0.844349,
-    -0.849317,
-    -0.854206,
-    -0.859015,
-    -0.863745,
-    -0.868394,
-    -0.872964,
-    -0.877454,
-    -0.881864,
-    -0.886194,
-    -0.890443,
-    -0.894613,
-    -0.898702,
-    -0.902711,
-    -0.90664,
-    -0.910489,
-    -0.914258,
-    -0.917947,
-    -0.921556,
-    -0.925085,
-    -0.928535,
-    -0.931905,
-    -0.935196,
-    -0.938407,
-    -0.941539,
-    -0.944593,
-    -0.947567,
-    -0.950463,
-    -0.953281,
-    -0.956021,
-    -0.958683,
-    -0.961267,
-    -0.963775,
-    -0.966205,
-    -0.968558,
-    -0.970835,
-    -0.973036,
-    -0.975161,
-    -0.977211,
-    -0.979186,
-    -0.981087,
-    -0.982913,
-    -0.984665,
-    -0.986344,
-    -0.98795,
-    -0.989483,
-    -0.990944,
-    -0.992334,
-    -0.993652,
-    -0.9949,
-    -0.996077,
-    -0.997185,
-    -0.998223,
-    -0.999193,
-    -1.00009,
-    -1.00093,
-    -1.0017,
-    -1.0024,
-    -1.00303,
-    -1.0036,
-    -1.00411,
-    -1.00455,
-    -1.00492,
-    -1.00524,
-    -1.00549,
-    -1.00568,
-    -1.00581,
-    -1.00588,
-    -1.00589,
-    -1.00584,
-    -1.00573,
-    -1.00557,
-    -1.00535,
-    -1.00507,
-    -1.00474,
-    -1.00435,
-    -1.00391,
-    -1.00341,
-    -1.00286,
-    -1.00226,
-    -1.00161,
-    -1.00091,
-    -1.00016,
-    -0.999365,
-    -0.998519,
-    -0.997625,
-    -0.996685,
-    -0.995699,
-    -0.994668,
-    -0.993594,
-    -0.992476,
-    -0.991316,
-    -0.990114,
-    -0.988872,
-    -0.98759,
-    -0.986268,
-    -0.984909,
-    -0.983512,
-    -0.982078,
-    -0.980608,
-    -0.979104,
-    -0.977565,
-    -0.975993,
-    -0.974389,
-    -0.972753,
-    -0.971087,
-    -0.96939,
-    -0.967664,
-    -0.965911,
-    -0.964129,
-    -0.962322,
-    -0.960488,
-    -0.95863,
-    -0.956748,
-    -0.954842,
-    -0.952914,
-    -0.950965,
-    -0.948995,
-    -0.947006,
-    -0.944997,
-    -0.94297,
-    -0.940926,
-    -0.938866,
-    -0.93679,
-    -0.934699,
-    -0.932594,
-    -0.930476,
-    -0.928346,
-    -0.926204,
-    -0.924052,
-    -0.92189,
-    -0.919718,
-    -0.917538,
-    -0.915351,
-    -0.913158,
-    -0.910958,
-    -0.908753,
-    -0.906544,
-    -0.904331,
-    -0.902116,
-    -0.899898,
-    -0.897679,
-    -0.89546,
-    -0.893241,
-    -0.891023,
-    -0.888807,
-    -0.886593,
-    -0.884382,
-    -0.882175,
-    -0.879973,
-    -0.877776,
-    -0.875585,
-    -0.873401,
-    -0.871224,
-    -0.869055,
-    -0.866895,
-    -0.864744,
-    -0.862604,
-    -0.860474,
-    -0.858355,
-    -0.856248,
-    -0.854154,
-    -0.852073,
-    -0.850006,
-    -0.847953,
-    -0.845915,
-    -0.843892,
-    -0.841886,
-    -0.839896,
-    -0.837924,
-    -0.835969,
-    -0.834033,
-    -0.832115,
-    -0.830217,
-    -0.828339,
-    -0.826481,
-    -0.824643,
-    -0.822827,
-    -0.821033,
-    -0.819261,
-    -0.817512,
-    -0.815786,
-    -0.814083,
-    -0.812404,
-    -0.81075,
-    -0.80912,
-    -0.807516,
-    -0.805937,
-    -0.804384,
-    -0.802857,
-    -0.801356,
-    -0.799883,
-    -0.798437,
-    -0.797018,
-    -0.795627,
-    -0.794265,
-    -0.792931,
-    -0.791625,
-    -0.790349,
-    -0.789101,
-    -0.787883,
-    -0.786695,
-    -0.785537,
-    -0.784409,
-    -0.783311,
-    -0.782243,
-    -0.781206,
-    -0.7802,
-    -0.779225,
-    -0.778282,
-    -0.777369,
-    -0.776488,
-    -0.775638,
-    -0.77482,
-    -0.774033,
-    -0.773278,
-    -0.772556,
-    -0.771865,
-    -0.771205,
-    -0.770578,
-    -0.769983,
-    -0.76942,
-    -0.768889,
-    -0.76839,
-    -0.767923,
-    -0.767488,
-    -0.767085,
-    -0.766714,
-    -0.766375,
-    -0.766067,
-    -0.765791,
-    -0.765547,
-    -0.765335,
-    -0.765154,
-    -0.765004,
-    -0.764885,
-    -0.764798,
-    -0.764742,
-    -0.764716,
-    -0.764721,
-    -0.764757,
-    -0.764823,
-    -0.764919,
-    -0.765045,
-    -0.765201,
-    -0.765386,
-    -0.765601,
-    -0.765845,
-    -0.766117,
-    -0.766419,
-    -0.766748,
-    -0.767106,
-    -0.767492,
-    -0.767905,
-    -0.768346,
-    -0.768813,
-    -0.769308,
-    -0.769829,
-    -0.770376,
-    -0.770949,
-    -0.771547,
-    -0.772171,
-    -0.772819,
-    -0.773492,
-    -0.774189,
-    -0.77491,
-    -0.775654,
-    -0.776422,
-    -0.777212,
-    -0.778025,
-    -0.778859,
-    -0.779715,
-    -0.780593,
-    -0.781491,
-    -0.782409,
-    -0.783348,
-    -0.784306,
-    -0.785283,
-    -0.786279,
-    -0.787293,
-    -0.788326,
-    -0.789375,
-    -0.790442,
-    -0.791526,
-    -0.792625,
-    -0.793741,
-    -0.794871,
-    -0.796017,
-    -0.797177,
-    -0.79835,
-    -0.799538,
-    -0.800738,
-    -0.801951,
-    -0.803176,
-    -0.804412,
-    -0.80566,
-    -0.806919,
-    -0.808187,
-    -0.809466,
-    -0.810753,
-    -0.81205,
-    -0.813355,
-    -0.814668,
-    -0.815988,
-    -0.817315,
-    -0.818648,
-    -0.819988,
-    -0.821333,
-    -0.822683,
-    -0.824037,
-    -0.825396,
-    -0.826758,
-    -0.828123,
-    -0.829491,
-    -0.830861,
-    -0.832233,
-    -0.833606,
-    -0.83498,
-    -0.836354,
-    -0.837728,
-    -0.839102,
-    -0.840474,
-    -0.841845,
-    -0.843214,
-    -0.84458,
-    -0.845944,
-    -0.847304,
-    -0.84866,
-    -0.850012,
-    -0.85136,
-    -0.852702,
-    -0.854039,
-    -0.85537,
-    -0.856695,
-    -0.858013,
-    -0.859324,
-    -0.860627,
-    -0.861922,
-    -0.863208,
-    -0.864486,
-    -0.865755,
-    -0.867014,
-    -0.868263,
-    -0.869501,
-    -0.870729,
-    -0.871946,
-    -0.873151,
-    -0.874344,
-    -0.875526,
-    -0.876694,
-    -0.87785,
-    -0.878992,
-    -0.880121,
-    -0.881236,
-    -0.882336,
-    -0.883423,
-    -0.884494,
-    -0.88555,
-    -0.88659,
-    -0.887615,
-    -0.888624,
-    -0.889616,
-    -0.890592,
-    -0.891551,
-    -0.892493,
-    -0.893417,
-    -0.894324,
-    -0.895212,
-    -0.896083,
-    -0.896935,
-    -0.897769,
-    -0.898584,
-    -0.89938,
-    -0.900157,
-    -0.900914,
-    -0.901652,
-    -0.902369,
-    -0.903067,
-    -0.903745,
-    -0.904403,
-    -0.90504,
-    -0.905657,
-    -0.906252,
-    -0.906827,
-    -0.907381,
-    -0.907914,
-    -0.908426,
-    -0.908917,
-    -0.909386,
-    -0.909833,
-    -0.910259,
-    -0.910664,
-    -0.911047,
-    -0.911408,
-    -0.911747,
-    -0.912064,
-    -0.912359,
-    -0.912633,
-    -0.912884,
-    -0.913114,
-    -0.913322,
-    -0.913507,
-    -0.913671,
-    -0.913813,
-    -0.913933,
-    -0.914031,
-    -0.914107,
-    -0.914161,
-    -0.914194,
-    -0.914205,
-    -0.914194,
-    -0.914161,
-    -0.914108,
-    -0.914032,
-    -0.913936,
-    -0.913818,
-    -0.913679,
-    -0.913519,
-    -0.913338,
-    -0.913136,
-    -0.912914,
-    -0.912671,
-    -0.912408,
-    -0.912124,
-    -0.911821,
-    -0.911497,
-    -0.911154,
-    -0.910792,
-    -0.91041,
-    -0.910008,
-    -0.909588,
-    -0.909149,
-    -0.908691,
-    -0.908215,
-    -0.907721,
-    -0.907208,
-    -0.906678,
-    -0.906131,
-    -0.905566,
-    -0.904984,
-    -0.904385,
-    -0.90377,
-    -0.903138,
-    -0.90249,
-    -0.901827,
-    -0.901148,
-    -0.900454,
-    -0.899745,
-    -0.899021,
-    -0.898282,
-    -0.89753,
-    -0.896764,
-    -0.895984,
-    -0.895191,
-    -0.894385,
-    -0.893566,
-    -0.892735,
-    -0.891892,
-    -0.891037,
-    -0.890171,
-    -0.889294,
-    -0.888406,
-    -0.887508,
-    -0.886599,
-    -0.885681,
-    -0.884754,
-    -0.883817,
-    -0.882872,
-    -0.881918,
-    -0.880956,
-    -0.879987,
-    -0.87901,
-    -0.878026,
-    -0.877035,
-    -0.876038,
-    -0.875035,
-    -0.874027,
-    -0.873013,
-    -0.871994,
-    -0.870971,
-    -0.869943,
-    -0.868912,
-    -0.867877,
-    -0.866839,
-    -0.865798,
-    -0.864755,
-    -0.86371,
-    -0.862663,
-    -0.861614,
-    -0.860565,
-    -0.859515,
-    -0.858465,
-    -0.857415,
-    -0.856365,
-    -0.855316,
-    -0.854268,
-    -0.853221,
-    -0.852177,
-    -0.851134,
-    -0.850094,
-    -0.849057,
-    -0.848023,
-    -0.846993,
-    -0.845966,
-    -0.844944,
-    -0.843926,
-    -0.842913,
-    -0.841906,
-    -0.840903,
-    -0.839907,
-    -0.838917,
-    -0.837933,
-    -0.836956,
-    -0.835987,
-    -0.835024,
-    -0.83407,
-    -0.833123,
-    -0.832185,
-    -0.831256,
-    -0.830335,
-    -0.829424,
-    -0.828522,
-    -0.82763,
-    -0.826748,
-    -0.825876,
-    -0.825015,
-    -0.824165,
-    -0.823326,
-    -0.822499,
-    -0.821683,
-    -0.820879,
-    -0.820087,
-    -0.819307,
-    -0.818541,
-    -0.817787,
-    -0.817046,
-    -0.816318,
-    -0.815604,
-    -0.814904,
-    -0.814218,
-    -0.813545,
-    -0.812888,
-    -0.812244,
-    -0.811616,
-    -0.811002,
-    -0.810404,
-    -0.80982,
-    -0.809252,
-    -0.8087,
-    -0.808164,
-    -0.807643,
-    -0.807138,
-    -0.80665,
-    -0.806178,
-    -0.805722,
-    -0.805283,
-    -0.80486,
-    -0.804454,
-    -0.804065,
-    -0.803694,
-    -0.803339,
-    -0.803001,
-    -0.802681,
-    -0.802378,
-    -0.802092,
-    -0.801824,
-    -0.801573,
-    -0.80134,
-    -0.801124,
-    -0.800926,
-    -0.800746,
-    -0.800583,
-    -0.800438,
-    -0.800311,
-    -0.800202,
-    -0.80011,
-    -0.800036,
-    -0.79998,
-    -0.799942,
-    -0.799921,
-    -0.799918,
-    -0.799933,
-    -0.799965,
-    -0.800015,
-    -0.800083,
-    -0.800168,
-    -0.80027,
-    -0.80039,
-    -0.800527,
-    -0.800681,
-    -0.800852,
-    -0.801041,
-    -0.801246,
-    -0.801469,
-    -0.801708,
-    -0.801963,
-    -0.802235,
-    -0.802524,
-    -0.802829,
-    -0.80315,
-    -0.803487,
-    -0.80384,
-    -0.804208,
-    -0.804593,
-    -0.804992,
-    -0.805407,
-    -0.805837,
-    -0.806283,
-    -0.806742,
-    -0.807217,
-    -0.807705,
-    -0.808208,
-    -0.808726,
-    -0.809256,
-    -0.809801,
-    -0.810359,
-    -0.81093,
-    -0.811514,
-    -0.812111,
-    -0.812721,
-    -0.813343,
-    -0.813977,
-    -0.814622,
-    -0.81528,
-    -0.815949,
-    -0.816629,
-    -0.81732,
-    -0.818022,
-    -0.818734,
-    -0.819456,
-    -0.820188,
-    -0.82093,
-    -0.821681,
-    -0.822442,
-    -0.823211,
-    -0.823989,
-    -0.824775,
-    -0.825569,
-    -0.826371,
-    -0.82718,
-    -0.827997,
-    -0.82882,
-    -0.829651,
-    -0.830487,
-    -0.831329,
-    -0.832178,
-    -0.833031,
-    -0.83389,
-    -0.834754,
-    -0.835622,
-    -0.836494,
-    -0.837371,
-    -0.838251,
-    -0.839135,
-    -0.840021,
-    -0.84091,
-    -0.841802,
-    -0.842696,
-    -0.843592,
-    -0.844489,
-    -0.845388,
-    -0.846288,
-    -0.847188,
-    -0.848088,
-    -0.848989,
-    -0.849889,
-    -0.850789,
-    -0.851688,
-    -0.852586,
-    -0.853482,
-    -0.854376,
-    -0.855269,
-    -0.856159,
-    -0.857046,
-    -0.85793,
-    -0.858811,
-    -0.859689,
-    -0.860563,
-    -0.861432,
-    -0.862297,
-    -0.863158,
-    -0.864013,
-    -0.864864,
-    -0.865708,
-    -0.866547,
-    -0.86738,
-    -0.868206,
-    -0.869026,
-    -0.869839,
-    -0.870644,
-    -0.871443,
-    -0.872233,
-    -0.873016,
-    -0.87379,
-    -0.874556,
-    -0.875313,
-    -0.876061,
-    -0.8768,
-    -0.87753,
-    -0.87825,
-    -0.87896,
-    -0.87966,
-    -0.880349,
-    -0.881028,
-    -0.881696,
-    -0.882353,
-    -0.882999,
-    -0.883634,
-    -0.884257,
-    -0.884868,
-    -0.885467,
-    -0.886054,
-    -0.886628,
-    -0.88719,
-    -0.887739,
-    -0.888276,
-    -0.888799,
-    -0.889309,
-    -0.889805,
-    -0.890288,
-    -0.890758,
-    -0.891213,
-    -0.891654,
-    -0.892082,
-    -0.892495,
-    -0.892893,
-    -0.893278,
-    -0.893647,
-    -0.894002,
-    -0.894342,
-    -0.894667,
-    -0.894977,
-    -0.895272,
-    -0.895552,
-    -0.895816,
-    -0.896065,
-    -0.896299,
-    -0.896517,
-    -0.89672,
-    -0.896906,
-    -0.897078,
-    -0.897233,
-    -0.897373,
-    -0.897497,
-    -0.897606,
-    -0.897698,
-    -0.897775,
-    -0.897836,
-    -0.897881,
-    -0.89791,
-    -0.897923,
-    -0.89792,
-    -0.897902,
-    -0.897868,
-    -0.897817,
-    -0.897752,
-    -0.89767,
-    -0.897573,
-    -0.89746,
-    -0.897331,
-    -0.897187,
-    -0.897028,
-    -0.896853,
-    -0.896662,
-    -0.896457,
-    -0.896236,
-    -0.896,
-    -0.89575,
-    -0.895484,
-    -0.895203,
-    -0.894908,
-    -0.894598,
-    -0.894274,
-    -0.893935,
-    -0.893582,
-    -0.893215,
-    -0.892834,
-    -0.892439,
-    -0.892031,
-    -0.891608,
-    -0.891173,
-    -0.890724,
-    -0.890262,
-    -0.889787,
-    -0.8893,
-    -0.8888,
-    -0.888287,
-    -0.887763,
-    -0.887226,
-    -0.886677,
-    -0.886117,
-    -0.885545,
-    -0.884962,
-    -0.884368,
-    -0.883763,
-    -0.883148,
-    -0.882522,
-    -0.881886,
-    -0.881239,
-    -0.880583,
-    -0.879918,
-    -0.879243,
-    -0.878559,
-    -0.877866,
-    -0.877165,
-    -0.876455,
-    -0.875738,
-    -0.875012,
-    -0.874278,
-    -0.873538,
-    -0.87279,
-    -0.872035,
-    -0.871274,
-    -0.870506,
-    -0.869732,
-    -0.868953,
-    -0.868168,
-    -0.867377,
-    -0.866582,
-    -0.865781,
-    -0.864977,
-    -0.864168,
-    -0.863355,
-    -0.862538,
-    -0.861718,
-    -0.860895,
-    -0.86007,
-    -0.859241,
-    -0.85841,
-    -0.857578,
-    -0.856743,
-    -0.855908,
-    -0.855071,
-    -0.854233,
-    -0.853394,
-    -0.852556,
-    -0.851717,
-    -0.850878,
-    -0.85004,
-    -0.849203,
-    -0.848367,
-    -0.847533,
-    -0.8467,
-    -0.845869,
-    -0.84504,
-    -0.844214,
-    -0.84339,
-    -0.84257,
-    -0.841753,
-    -0.840939,
-    -0.84013,
-    -0.839324,
-    -0.838523,
-    -0.837727,
-    -0.836936,
-    -0.836149,
-    -0.835369,
-    -0.834594,
-    -0.833825,
-    -0.833062,
-    -0.832306,
-    -0.831557,
-    -0.830814,
-    -0.830079,
-    -0.829352,
-    -0.828632,
-    -0.82792,
-    -0.827216,
-    -0.826521,
-    -0.825835,
-    -0.825157,
-    -0.824489,
-    -0.82383,
-    -0.82318,
-    -0.822541,
-    -0.821911,
-    -0.821292,
-    -0.820683,
-    -0.820085,
-    -0.819497,
-    -0.818921,
-    -0.818356,
-    -0.817802,
-    -0.81726,
-    -0.816729,
-    -0.816211,
-    -0.815705,
-    -0.815211,
-    -0.814729,
-    -0.81426,
-    -0.813804,
-    -0.813361,
-    -0.812931,
-    -0.812514,
-    -0.81211,
-    -0.81172,
-    -0.811344,
-    -0.810981,
-    -0.810632,
-    -0.810297,
-    -0.809977,
-    -0.80967,
-    -0.809378,
-    -0.8091,
-    -0.808837,
-    -0.808588,
-    -0.808354,
-    -0.808134,
-    -0.80793,
-    -0.80774,
-    -0.807565,
-    -0.807406,
-    -0.807261,
-    -0.807131,
-    -0.807017,
-    -0.806918,
-    -0.806834,
-    -0.806765,
-    -0.806711,
-    -0.806673,
-    -0.80665,
-    -0.806642,
-    -0.80665,
-    -0.806673,
-    -0.806711,
-    -0.806765,
-    -0.806834,
-    -0.806918,
-    -0.807017,
-    -0.807131,
-    -0.807261,
-    -0.807406,
-    -0.807565,
-    -0.80774,
-    -0.80793,
-    -0.808134,
-    -0.808354,
-    -0.808588,
-    -0.808837,
-    -0.8091,
-    -0.809378,
-    -0.80967,
-    -0.809977,
-    -0.810297,
-    -0.810632,
-    -0.810981,
-    -0.811344,
-    -0.81172,
-    -0.81211,
-    -0.812514,
-    -0.812931,
-    -0.813361,
-    -0.813804,
-    -0.81426,
-    -0.814729,
-    -0.815211,
-    -0.815705,
-    -0.816211,
-    -0.816729,
-    -0.81726,
-    -0.817802,
-    -0.818356,
-    -0.818921,
-    -0.819497,
-    -0.820085,
-    -0.820683,
-    -0.821292,
-    -0.821911,
-    -0.822541,
-    -0.82318,
-    -0.82383,
-    -0.824489,
-    -0.825157,
-    -0.825835,
-    -0.826521,
-    -0.827216,
-    -0.82792,
-    -0.828632,
-    -0.829352,
-    -0.830079,
-    -0.830814,
-    -0.831557,
-    -0.832306,
-    -0.833062,
-    -0.833825,
-    -0.834594,
-    -0.835369,
-    -0.836149,
-    -0.836936,
-    -0.837727,
-    -0.838523,
-    -0.839324,
-    -0.84013,
-    -0.840939,
-    -0.841753,
-    -0.84257,
-    -0.84339,
-    -0.844214,
-    -0.84504,
-    -0.845869,
-    -0.8467,
-    -0.847533,
-    -0.848367,
-    -0.849203,
-    -0.85004,
-    -0.850878,
-    -0.851717,
-    -0.852556,
-    -0.853394,
-    -0.854233,
-    -0.855071,
-    -0.855908,
-    -0.856743,
-    -0.857578,
-    -0.85841,
-    -0.859241,
-    -0.86007,
-    -0.860895,
-    -0.861718,
-    -0.862538,
-    -0.863355,
-    -0.864168,
-    -0.864977,
-    -0.865781,
-    -0.866582,
-    -0.867377,
-    -0.868168,
-    -0.868953,
-    -0.869732,
-    -0.870506,
-    -0.871274,
-    -0.872035,
-    -0.87279,
-    -0.873538,
-    -0.874278,
-    -0.875012,
-    -0.875738,
-    -0.876455,
-    -0.877165,
-    -0.877866,
-    -0.878559,
-    -0.879243,
-    -0.879918,
-    -0.880583,
-    -0.881239,
-    -0.881886,
-    -0.882522,
-    -0.883148,
-    -0.883763,
-    -0.884368,
-    -0.884962,
-    -0.885545,
-    -0.886117,
-    -0.886677,
-    -0.887226,
-    -0.887763,
-    -0.888287,
-    -0.8888,
-    -0.8893,
-    -0.889787,
-    -0.890262,
-    -0.890724,
-    -0.891173,
-    -0.891608,
-    -0.892031,
-    -0.892439,
-    -0.892834,
-    -0.893215,
-    -0.893582,
-    -0.893935,
-    -0.894274,
-    -0.894598,
-    -0.894908,
-    -0.895203,
-    -0.895484,
-    -0.89575,
-    -0.896,
-    -0.896236,
-    -0.896457,
-    -0.896662,
-    -0.896853,
-    -0.897028,
-    -0.897187,
-    -0.897331,
-    -0.89746,
-    -0.897573,
-    -0.89767,
-    -0.897752,
-    -0.897817,
-    -0.897868,
-    -0.897902,
-    -0.89792,
-    -0.897923,
-    -0.89791,
-    -0.897881,
-    -0.897836,
-    -0.897775,
-    -0.897698,
-    -0.897606,
-    -0.897497,
-    -0.897373,
-    -0.897233,
-    -0.897078,
-    -0.896906,
-    -0.89672,
-    -0.896517,
-    -0.896299,
-    -0.896065,
-    -0.895816,
-    -0.895552,
-    -0.895272,
-    -0.894977,
-    -0.894667,
-    -0.894342,
-    -0.894002,
-    -0.893647,
-    -0.893278,
-    -0.892893,
-    -0.892495,
-    -0.892082,
-    -0.891654,
-    -0.891213,
-    -0.890758,
-    -0.890288,
-    -0.889805,
-    -0.889309,
-    -0.888799,
-    -0.888276,
-    -0.887739,
-    -0.88719,
-    -0.886628,
-    -0.886054,
-    -0.885467,
-    -0.884868,
-    -0.884257,
-    -0.883634,
-    -0.882999,
-    -0.882353,
-    -0.881696,
-    -0.881028,
-    -0.880349,
-    -0.87966,
-    -0.87896,
-    -0.87825,
-    -0.87753,
-    -0.8768,
-    -0.876061,
-    -0.875313,
-    -0.874556,
-    -0.87379,
-    -0.873016,
-    -0.872233,
-    -0.871443,
-    -0.870644,
-    -0.869839,
-    -0.869026,
-    -0.868206,
-    -0.86738,
-    -0.866547,
-    -0.865708,
-    -0.864864,
-    -0.864013,
-    -0.863158,
-    -0.862297,
-    -0.861432,
-    -0.860563,
-    -0.859689,
-    -0.858811,
-    -0.85793,
-    -0.857046,
-    -0.856159,
-    -0.855269,
-    -0.854376,
-    -0.853482,
-    -0.852586,
-    -0.851688,
-    -0.850789,
-    -0.849889,
-    -0.848989,
-    -0.848088,
-    -0.847188,
-    -0.846288,
-    -0.845388,
-    -0.844489,
-    -0.843592,
-    -0.842696,
-    -0.841802,
-    -0.84091,
-    -0.840021,
-    -0.839135,
-    -0.838251,
-    -0.837371,
-    -0.836494,
-    -0.835622,
-    -0.834754,
-    -0.83389,
-    -0.833031,
-    -0.832178,
-    -0.831329,
-    -0.830487,
-    -0.829651,
-    -0.82882,
-    -0.827997,
-    -0.82718,
-    -0.826371,
-    -0.825569,
-    -0.824775,
-    -0.823989,
-    -0.823211,
-    -0.822442,
-    -0.821681,
-    -0.82093,
-    -0.820188,
-    -0.819456,
-    -0.818734,
-    -0.818022,
-    -0.81732,
-    -0.816629,
-    -0.815949,
-    -0.81528,
-    -0.814622,
-    -0.813977,
-    -0.813343,
-    -0.812721,
-    -0.812111,
-    -0.811514,
-    -0.81093,
-    -0.810359,
-    -0.809801,
-    -0.809256,
-    -0.808726,
-    -0.808208,
-    -0.807705,
-    -0.807217,
-    -0.806742,
-    -0.806283,
-    -0.805837,
-    -0.805407,
-    -0.804992,
-    -0.804593,
-    -0.804208,
-    -0.80384,
-    -0.803487,
-    -0.80315,
-    -0.802829,
-    -0.802524,
-    -0.802235,
-    -0.801963,
-    -0.801708,
-    -0.801469,
-    -0.801246,
-    -0.801041,
-    -0.800852,
-    -0.800681,
-    -0.800527,
-    -0.80039,
-    -0.80027,
-    -0.800168,
-    -0.800083,
-    -0.800015,
-    -0.799965,
-    -0.799933,
-    -0.799918,
-    -0.799921,
-    -0.799942,
-    -0.79998,
-    -0.800036,
-    -0.80011,
-    -0.800202,
-    -0.800311,
-    -0.800438,
-    -0.800583,
-    -0.800746,
-    -0.800926,
-    -0.801124,
-    -0.80134,
-    -0.801573,
-    -0.801824,
-    -0.802092,
-    -0.802378,
-    -0.802681,
-    -0.803001,
-    -0.803339,
-    -0.803694,
-    -0.804065,
-    -0.804454,
-    -0.80486,
-    -0.805283,
-    -0.805722,
-    -0.806178,
-    -0.80665,
-    -0.807138,
-    -0.807643,
-    -0.808164,
-    -0.8087,
-    -0.809252,
-    -0.80982,
-    -0.810404,
-    -0.811002,
-    -0.811616,
-    -0.812244,
-    -0.812888,
-    -0.813545,
-    -0.814218,
-    -0.814904,
-    -0.815604,
-    -0.816318,
-    -0.817046,
-    -0.817787,
-    -0.818541,
-    -0.819307,
-    -0.820087,
-    -0.820879,
-    -0.821683,
-    -0.822499,
-    -0.823326,
-    -0.824165,
-    -0.825015,
-    -0.825876,
-    -0.826748,
-    -0.82763,
-    -0.828522,
-    -0.829424,
-    -0.830335,
-    -0.831256,
-    -0.832185,
-    -0.833123,
-    -0.83407,
-    -0.835024,
-    -0.835987,
-    -0.836956,
-    -0.837933,
-    -0.838917,
-    -0.839907,
-    -0.840903,
-    -0.841906,
-    -0.842913,
-    -0.843926,
-    -0.844944,
-    -0.845966,
-    -0.846993,
-    -0.848023,
-    -0.849057,
-    -0.850094,
-    -0.851134,
-    -0.852177,
-    -0.853221,
-    -0.854268,
-    -0.855316,
-    -0.856365,
-    -0.857415,
-    -0.858465,
-    -0.859515,
-    -0.860565,
-    -0.861614,
-    -0.862663,
-    -0.86371,
-    -0.864755,
-    -0.865798,
-    -0.866839,
-    -0.867877,
-    -0.868912,
-    -0.869943,
-    -0.870971,
-    -0.871994,
-    -0.873013,
-    -0.874027,
-    -0.875035,
-    -0.876038,
-    -0.877035,
-    -0.878026,
-    -0.87901,
-    -0.879987,
-    -0.880956,
-    -0.881918,
-    -0.882872,
-    -0.883817,
-    -0.884754,
-    -0.885681,
-    -0.886599,
-    -0.887508,
-    -0.888406,
-    -0.889294,
-    -0.890171,
-    -0.891037,
-    -0.891892,
-    -0.892735,
-    -0.893566,
-    -0.894385,
-    -0.895191,
-    -0.895984,
-    -0.896764,
-    -0.89753,
-    -0.898282,
-    -0.899021,
-    -0.899745,
-    -0.900454,
-    -0.901148,
-    -0.901827,
-    -0.90249,
-    -0.903138,
-    -0.90377,
-    -0.904385,
-    -0.904984,
-    -0.905566,
-    -0.906131,
-    -0.906678,
-    -0.907208,
-    -0.907721,
-    -0.908215,
-    -0.908691,
-    -0.909149,
-    -0.909588,
-    -0.910008,
-    -0.91041,
-    -0.910792,
-    -0.911154,
-    -0.911497,
-    -0.911821,
-    -0.912124,
-    -0.912408,
-    -0.912671,
-    -0.912914,
-    -0.913136,
-    -0.913338,
-    -0.913519,
-    -0.913679,
-    -0.913818,
-    -0.913936,
-    -0.914032,
-    -0.914108,
-    -0.914161,
-    -0.914194,
-    -0.914205,
-    -0.914194,
-    -0.914161,
-    -0.914107,
-    -0.914031,
-    -0.913933,
-    -0.913813,
-    -0.913671,
-    -0.913507,
-    -0.913322,
-    -0.913114,
-    -0.912884,
-    -0.912633,
-    -0.912359,
-    -0.912064,
-    -0.911747,
-    -0.911408,
-    -0.911047,
-    -0.910664,
-    -0.910259,
-    -0.909833,
-    -0.909386,
-    -0.908917,
-    -0.908426,
-    -0.907914,
-    -0.907381,
-    -0.906827,
-    -0.906252,
-    -0.905657,
-    -0.90504,
-    -0.904403,
-    -0.903745,
-    -0.903067,
-    -0.902369,
-    -0.901652,
-    -0.900914,
-    -0.900157,
-    -0.89938,
-    -0.898584,
-    -0.897769,
-    -0.896935,
-    -0.896083,
-    -0.895212,
-    -0.894324,
-    -0.893417,
-    -0.892493,
-    -0.891551,
-    -0.890592,
-    -0.889616,
-    -0.888624,
-    -0.887615,
-    -0.88659,
-    -0.88555,
-    -0.884494,
-    -0.883423,
-    -0.882336,
-    -0.881236,
-    -0.880121,
-    -0.878992,
-    -0.87785,
-    -0.876694,
-    -0.875526,
-    -0.874344,
-    -0.873151,
-    -0.871946,
-    -0.870729,
-    -0.869501,
-    -0.868263,
-    -0.867014,
-    -0.865755,
-    -0.864486,
-    -0.863208,
-    -0.861922,
-    -0.860627,
-    -0.859324,
-    -0.858013,
-    -0.856695,
-    -0.85537,
-    -0.854039,
-    -0.852702,
-    -0.85136,
-    -0.850012,
-    -0.84866,
-    -0.847304,
-    -0.845944,
-    -0.84458,
-    -0.843214,
-    -0.841845,
-    -0.840474,
-    -0.839102,
-    -0.837728,
-    -0.836354,
-    -0.83498,
-    -0.833606,
-    -0.832233,
-    -0.830861,
-    -0.829491,
-    -0.828123,
-    -0.826758,
-    -0.825396,
-    -0.824037,
-    -0.822683,
-    -0.821333,
-    -0.819988,
-    -0.818648,
-    -0.817315,
-    -0.815988,
-    -0.814668,
-    -0.813355,
-    -0.81205,
-    -0.810753,
-    -0.809466,
-    -0.808187,
-    -0.806919,
-    -0.80566,
-    -0.804412,
-    -0.803176,
-    -0.801951,
-    -0.800738,
-    -0.799538,
-    -0.79835,
-    -0.797177,
-    -0.796017,
-    -0.794871,
-    -0.793741,
-    -0.792625,
-    -0.791526,
-    -0.790442,
-    -0.789375,
-    -0.788326,
-    -0.787293,
-    -0.786279,
-    -0.785283,
-    -0.784306,
-    -0.783348,
-    -0.782409,
-    -0.781491,
-    -0.780593,
-    -0.779715,
-    -0.778859,
-    -0.778025,
-    -0.777212,
-    -0.776422,
-    -0.775654,
-    -0.77491,
-    -0.774189,
-    -0.773492,
-    -0.772819,
-    -0.772171,
-    -0.771547,
-    -0.770949,
-    -0.770376,
-    -0.769829,
-    -0.769308,
-    -0.768813,
-    -0.768346,
-    -0.767905,
-    -0.767492,
-    -0.767106,
-    -0.766748,
-    -0.766419,
-    -0.766117,
-    -0.765845,
-    -0.765601,
-    -0.765386,
-    -0.765201,
-    -0.765045,
-    -0.764919,
-    -0.764823,
-    -0.764757,
-    -0.764721,
-    -0.764716,
-    -0.764742,
-    -0.764798,
-    -0.764885,
-    -0.765004,
-    -0.765154,
-    -0.765335,
-    -0.765547,
-    -0.765791,
-    -0.766067,
-    -0.766375,
-    -0.766714,
-    -0.767085,
-    -0.767488,
-    -0.767923,
-    -0.76839,
-    -0.768889,
-    -0.76942,
-    -0.769983,
-    -0.770578,
-    -0.771205,
-    -0.771865,
-    -0.772556,
-    -0.773278,
-    -0.774033,
-    -0.77482,
-    -0.775638,
-    -0.776488,
-    -0.777369,
-    -0.778282,
-    -0.779225,
-    -0.7802,
-    -0.781206,
-    -0.782243,
-    -0.783311,
-    -0.784409,
-    -0.785537,
-    -0.786695,
-    -0.787883,
-    -0.789101,
-    -0.790349,
-    -0.791625,
-    -0.792931,
-    -0.794265,
-    -0.795627,
-    -0.797018,
-    -0.798437,
-    -0.799883,
-    -0.801356,
-    -0.802857,
-    -0.804384,
-    -0.805937,
-    -0.807516,
-    -0.80912,
-    -0.81075,
-    -0.812404,
-    -0.814083,
-    -0.815786,
-    -0.817512,
-    -0.819261,
-    -0.821033,
-    -0.822827,
-    -0.824643,
-    -0.826481,
-    -0.828339,
-    -0.830217,
-    -0.832115,
-    -0.834033,
-    -0.835969,
-    -0.837924,
-    -0.839896,
-    -0.841886,
-    -0.843892,
-    -0.845915,
-    -0.847953,
-    -0.850006,
-    -0.852073,
-    -0.854154,
-    -0.856248,
-    -0.858355,
-    -0.860474,
-    -0.862604,
-    -0.864744,
-    -0.866895,
-    -0.869055,
-    -0.871224,
-    -0.873401,
-    -0.875585,
-    -0.877776,
-    -0.879973,
-    -0.882175,
-    -0.884382,
-    -0.886593,
-    -0.888807,
-    -0.891023,
-    -0.893241,
-    -0.89546,
-    -0.897679,
-    -0.899898,
-    -0.902116,
-    -0.904331,
-    -0.906544,
-    -0.908753,
-    -0.910958,
-    -0.913158,
-    -0.915351,
-    -0.917538,
-    -0.919718,
-    -0.92189,
-    -0.924052,
-    -0.926204,
-    -0.928346,
-    -0.930476,
-    -0.932594,
-    -0.934699,
-    -0.93679,
-    -0.938866,
-    -0.940926,
-    -0.94297,
-    -0.944997,
-    -0.947006,
-    -0.948995,
-    -0.950965,
-    -0.952914,
-    -0.954842,
-    -0.956748,
-    -0.95863,
-    -0.960488,
-    -0.962322,
-    -0.964129,
-    -0.965911,
-    -0.967664,
-    -0.96939,
-    -0.971087,
-    -0.972753,
-    -0.974389,
-    -0.975993,
-    -0.977565,
-    -0.979104,
-    -0.980608,
-    -0.982078,
-    -0.983512,
-    -0.984909,
-    -0.986268,
-    -0.98759,
-    -0.988872,
-    -0.990114,
-    -0.991316,
-    -0.992476,
-    -0.993594,
-    -0.994668,
-    -0.995699,
-    -0.996685,
-    -0.997625,
-    -0.998519,
-    -0.999365,
-    -1.00016,
-    -1.00091,
-    -1.00161,
-    -1.00226,
-    -1.00286,
-    -1.00341,
-    -1.00391,
-    -1.00435,
-    -1.00474,
-    -1.00507,
-    -1.00535,
-    -1.00557,
-    -1.00573,
-    -1.00584,
-    -1.00589,
-    -1.00588,
-    -1.00581,
-    -1.00568,
-    -1.00549,
-    -1.00524,
-    -1.00492,
-    -1.00455,
-    -1.00411,
-    -1.0036,
-    -1.00303,
-    -1.0024,
-    -1.0017,
-    -1.00093,
-    -1.00009,
-    -0.999193,
-    -0.998223,
-    -0.997185,
-    -0.996077,
-    -0.9949,
-    -0.993652,
-    -0.992334,
-    -0.990944,
-    -0.989483,
-    -0.98795,
-    -0.986344,
-    -0.984665,
-    -0.982913,
-    -0.981087,
-    -0.979186,
-    -0.977211,
-    -0.975161,
-    -0.973036,
-    -0.970835,
-    -0.968558,
-    -0.966205,
-    -0.963775,
-    -0.961267,
-    -0.958683,
-    -0.956021,
-    -0.953281,
-    -0.950463,
-    -0.947567,
-    -0.944593,
-    -0.941539,
-    -0.938407,
-    -0.935196,
-    -0.931905,
-    -0.928535,
-    -0.925085,
-    -0.921556,
-    -0.917947,
-    -0.914258,
-    -0.910489,
-    -0.90664,
-    -0.902711,
-    -0.898702,
-    -0.894613,
-    -0.890443,
-    -0.886194,
-    -0.881864,
-    -0.877454,
-    -0.872964,
-    -0.868394,
-    -0.863745,
-    -0.859015,
-    -0.854206,
-    -0.849317,
-    -0.844349,
-    -0.839301,
-    -0.834174,
-    -0.828969,
-    -0.823684,
-    -0.818321,
-    -0.81288,
-    -0.807361,
-    -0.801763,
-    -0.796089,
-    -0.790337,
-    -0.784508,
-    -0.778602,
-    -0.77262,
-    -0.766562,
-    -0.760428,
-    -0.754219,
-    -0.747935,
-    -0.741577,
-    -0.735144,
-    -0.728638,
-    -0.722059,
-    -0.715407,
-    -0.708682,
-    -0.701886,
-    -0.695018,
-    -0.68808,
-    -0.681071,
-    -0.673993,
-    -0.666845,
-    -0.659629,
-    -0.652344,
-    -0.644992,
-    -0.637573,
-    -0.630088,
-    -0.622538,
-    -0.614922,
-    -0.607242,
-    -0.599498,
-    -0.591692,
-    -0.583823,
-    -0.575892,
-    -0.5679,
-    -0.559849,
-    -0.551738,
-    -0.543568,
-    -0.53534,
-    -0.527055,
-    -0.518714,
-    -0.510317,
-    -0.501866,
-    -0.49336,
-    -0.484801,
-    -0.47619,
-    -0.467528,
-    -0.458815,
-    -0.450053,
-    -0.441241,
-    -0.432382,
-    -0.423475,
-    -0.414523,
-    -0.405525,
-    -0.396483,
-    -0.387397,
-    -0.378269,
-    -0.3691,
-    -0.35989,
-    -0.350641,
-    -0.341353,
-    -0.332027,
-    -0.322665,
-    -0.313267,
-    -0.303835,
-    -0.294368,
-    -0.28487,
-    -0.27534,
-    -0.265779,
-    -0.256189,
-    -0.24657,
-    -0.236924,
-    -0.227252,
-    -0.217554,
-    -0.207832,
-    -0.198087,
-    -0.18832,
-    -0.178532,
-    -0.168723,
-    -0.158897,
-    -0.149052,
-    -0.13919,
-    -0.129314,
-    -0.119422,
-    -0.109517,
-    -0.0996003,
-    -0.0896721,
-    -0.0797339,
-    -0.0697867,
-    -0.0598317,
-    -0.04987,
-    -0.0399027,
-    -0.029931,
-    -0.0199558,
-    -0.00997848
-};
-
-// Top frequency: 44.1K * 0.1161
-constexpr static std::array<float, 4096> wt_square_0x8 =
-{
-    0,
-    0.00498931,
-    0.00997848,
-    0.0149674,
-    0.0199559,
-    0.0249438,
-    0.0299311,
-    0.0349175,
-    0.039903,
-    0.0448874,
-    0.0498705,
-    0.0548523,
-    0.0598326,
-    0.0648112,
-    0.0697881,
-    0.074763,
-    0.0797359,
-    0.0847066,
-    0.089675,
-    0.0946409,
-    0.0996042,
-    0.104565,
-    0.109523,
-    0.114477,
-    0.119429,
-    0.124377,
-    0.129322,
-    0.134263,
-    0.139201,
-    0.144135,
-    0.149065,
-    0.153991,
-    0.158912,
-    0.16383,
-    0.168743,
-    0.173651,
-    0.178554,
-    0.183453,
-    0.188346,
-    0.193235,
-    0.198118,
-    0.202996,
-    0.207868,
-    0.212734,
-    0.217595,
-    0.22245,
-    0.227298,
-    0.232141,
-    0.236977,
-    0.241807,
-    0.24663,
-    0.251446,
-    0.256256,
-    0.261059,
-    0.265854,
-    0.270642,
-    0.275423,
-    0.280197,
-    0.284963,
-    0.289721,
-    0.294471,
-    0.299213,
-    0.303947,
-    0.308673,
-    0.313391,
-    0.3181,
-    0.3228,
-    0.327492,
-    0.332175,
-    0.336849,
-    0.341514,
-    0.346169,
-    0.350816,
-    0.355452,
-    0.36008,
-    0.364697,
-    0.369305,
-    0.373902,
-    0.37849,
-    0.383068,
-    0.387635,
-    0.392192,
-    0.396738,
-    0.401273,
-    0.405798,
-    0.410312,
-    0.414815,
-    0.419307,
-    0.423788,
-    0.428257,
-    0.432715,
-    0.437161,
-    0.441596,
-    0.446019,
-    0.45043,
-    0.454829,
-    0.459216,
-    0.463591,
-    0.467953,
-    0.472303,
-    0.47664,
-    0.480965,
-    0.485277,
-    0.489576,
-    0.493863,
-    0.498136,
-    0.502396,
-    0.506643,
-    0.510876,
-    0.515096,
-    0.519302,
-    0.523495,
-    0.527674,
-    0.531839,
-    0.53599,
-    0.540127,
-    0.54425,
-    0.548358,
-    0.552452,
-    0.556532,
-    0.560597,
-    0.564648,
-    0.568684,
-    0.572705,
-    0.576711,
-    0.580702,
-    0.584678,
-    0.588639,
-    0.592585,
-    0.596515,
-    0.60043,
-    0.604329,
-    0.608213,
-    0.612081,
-    0.615933,
-    0.619769,
-    0.62359,
-    0.627394,
-    0.631182,
-    0.634954,
-    0.63871,
-    0.64245,
-    0.646173,
-    0.649879,
-    0.653569,
-    0.657242,
-    0.660899,
-    0.664538,
-    0.668161,
-    0.671767,
-    0.675356,
-    0.678927,
-    0.682482,
-    0.686019,
-    0.689539,
-    0.693042,
-    0.696527,
-    0.699995,
-    0.703445,
-    0.706877,
-    0.710292,
-    0.713689,
-    0.717068,
-    0.720429,
-    0.723772,
-    0.727098,
-    0.730405,
-    0.733694,
-    0.736965,
-    0.740217,
-    0.743452,
-    0.746667,
-    0.749865,
-    0.753044,
-    0.756205,
-    0.759347,
-    0.76247,
-    0.765575,
-    0.768661,
-    0.771728,
-    0.774776,
-    0.777806,
-    0.780816,
-    0.783808,
-    0.786781,
-    0.789734,
-    0.792669,
-    0.795584,
-    0.798481,
-    0.801358,
-    0.804216,
-    0.807054,
-    0.809873,
-    0.812673,
-    0.815454,
-    0.818215,
-    0.820957,
-    0.823679,
-    0.826381,
-    0.829064,
-    0.831728,
-    0.834372,
-    0.836996,
-    0.839601,
-    0.842186,
-    0.844751,
-    0.847296,
-    0.849822,
-    0.852328,
-    0.854814,
-    0.85728,
-    0.859726,
-    0.862153,
-    0.86456,
-    0.866946,
-    0.869313,
-    0.87166,
-    0.873987,
-    0.876294,
-    0.878581,
-    0.880848,
-    0.883095,
-    0.885322,
-    0.887529,
-    0.889716,
-    0.891882,
-    0.894029,
-    0.896156,
-    0.898263,
-    0.900349,
-    0.902416,
-    0.904462,
-    0.906489,
-    0.908495,
-    0.910481,
-    0.912448,
-    0.914394,
-    0.91632,
-    0.918226,
-    0.920112,
-    0.921978,
-    0.923823,
-    0.925649,
-    0.927455,
-    0.929241,
-    0.931006,
-    0.932752,
-    0.934478,
-    0.936184,
-    0.937869,
-    0.939535,
-    0.941181,
-    0.942807,
-    0.944413,
-    0.945999,
-    0.947565,
-    0.949112,
-    0.950638,
-    0.952145,
-    0.953632,
-    0.955099,
-    0.956547,
-    0.957975,
-    0.959383,
-    0.960771,
-    0.96214,
-    0.963489,
-    0.964819,
-    0.966129,
-    0.967419,
-    0.96869,
-    0.969942,
-    0.971174,
-    0.972386,
-    0.97358,
-    0.974754,
-    0.975908,
-    0.977044,
-    0.97816,
-    0.979257,
-    0.980335,
-    0.981394,
-    0.982433,
-    0.983454,
-    0.984456,
-    0.985439,
-    0.986402,
-    0.987347,
-    0.988274,
-    0.989181,
-    0.99007,
-    0.99094,
-    0.991791,
-    0.992624,
-    0.993439,
-    0.994235,
-    0.995012,
-    0.995771,
-    0.996512,
-    0.997234,
-    0.997939,
-    0.998625,
-    0.999293,
-    0.999943,
-    1.00058,
-    1.00119,
-    1.00179,
-    1.00236,
-    1.00292,
-    1.00347,
-    1.00399,
-    1.0045,
-    1.00499,
-    1.00546,
-    1.00592,
-    1.00636,
-    1.00678,
-    1.00718,
-    1.00757,
-    1.00794,
-    1.00829,
-    1.00863,
-    1.00895,
-    1.00925,
-    1.00953,
-    1.0098,
-    1.01005,
-    1.01029,
-    1.01051,
-    1.01071,
-    1.0109,
-    1.01107,
-    1.01122,
-    1.01136,
-    1.01148,
-    1.01159,
-    1.01168,
-    1.01176,
-    1.01182,
-    1.01186,
-    1.01189,
-    1.0119,
-    1.0119,
-    1.01188,
-    1.01185,
-    1.0118,
-    1.01174,
-    1.01166,
-    1.01157,
-    1.01146,
-    1.01134,
-    1.0112,
-    1.01105,
-    1.01088,
-    1.0107,
-    1.01051,
-    1.0103,
-    1.01008,
-    1.00984,
-    1.00959,
-    1.00933,
-    1.00905,
-    1.00876,
-    1.00845,
-    1.00813,
-    1.0078,
-    1.00746,
-    1.0071,
-    1.00673,
-    1.00634,
-    1.00595,
-    1.00554,
-    1.00511,
-    1.00468,
-    1.00423,
-    1.00377,
-    1.0033,
-    1.00281,
-    1.00232,
-    1.00181,
-    1.00129,
-    1.00076,
-    1.00021,
-    0.999657,
-    0.99909,
-    0.998511,
-    0.997922,
-    0.997321,
-    0.996709,
-    0.996085,
-    0.995451,
-    0.994807,
-    0.994151,
-    0.993485,
-    0.992808,
-    0.992121,
-    0.991424,
-    0.990716,
-    0.989998,
-    0.989271,
-    0.988533,
-    0.987786,
-    0.987029,
-    0.986262,
-    0.985486,
-    0.984701,
-    0.983906,
-    0.983102,
-    0.98229,
-    0.981468,
-    0.980637,
-    0.979798,
-    0.97895,
-    0.978093,
-    0.977228,
-    0.976355,
-    0.975473,
-    0.974584,
-    0.973686,
-    0.972781,
-    0.971867,
-    0.970946,
-    0.970018,
-    0.969082,
-    0.968139,
-    0.967188,
-    0.96623,
-    0.965266,
-    0.964294,
-    0.963315,
-    0.96233,
-    0.961339,
-    0.96034,
-    0.959336,
-    0.958325,
-    0.957308,
-    0.956284,
-    0.955255,
-    0.95422,
-    0.95318,
-    0.952133,
-    0.951081,
-    0.950024,
-    0.948962,
-    0.947894,
-    0.946821,
-    0.945743,
-    0.94466,
-    0.943573,
-    0.942481,
-    0.941384,
-    0.940283,
-    0.939177,
-    0.938067,
-    0.936953,
-    0.935835,
-    0.934713,
-    0.933588,
-    0.932458,
-    0.931325,
-    0.930189,
-    0.929049,
-    0.927906,
-    0.92676,
-    0.92561,
-    0.924458,
-    0.923303,
-    0.922145,
-    0.920984,
-    0.919821,
-    0.918656,
-    0.917488,
-    0.916318,
-    0.915145,
-    0.913971,
-    0.912795,
-    0.911617,
-    0.910437,
-    0.909256,
-    0.908073,
-    0.906889,
-    0.905703,
-    0.904516,
-    0.903328,
-    0.902139,
-    0.90095,
-    0.899759,
-    0.898568,
-    0.897376,
-    0.896184,
-    0.894991,
-    0.893798,
-    0.892605,
-    0.891411,
-    0.890218,
-    0.889025,
-    0.887832,
-    0.886639,
-    0.885447,
-    0.884255,
-    0.883064,
-    0.881873,
-    0.880683,
-    0.879494,
-    0.878306,
-    0.877119,
-    0.875934,
-    0.874749,
-    0.873566,
-    0.872384,
-    0.871204,
-    0.870025,
-    0.868848,
-    0.867673,
-    0.8665,
-    0.865329,
-    0.86416,
-    0.862993,
-    0.861828,
-    0.860666,
-    0.859506,
-    0.858348,
-    0.857194,
-    0.856042,
-    0.854892,
-    0.853746,
-    0.852602,
-    0.851462,
-    0.850325,
-    0.84919,
-    0.84806,
-    0.846932,
-    0.845808,
-    0.844688,
-    0.843571,
-    0.842458,
-    0.841348,
-    0.840243,
-    0.839141,
-    0.838044,
-    0.836951,
-    0.835861,
-    0.834776,
-    0.833696,
-    0.83262,
-    0.831548,
-    0.830481,
-    0.829418,
-    0.82836,
-    0.827308,
-    0.826259,
-    0.825216,
-    0.824178,
-    0.823145,
-    0.822117,
-    0.821094,
-    0.820077,
-    0.819065,
-    0.818058,
-    0.817057,
-    0.816062,
-    0.815072,
-    0.814087,
-    0.813109,
-    0.812136,
-    0.81117,
-    0.810209,
-    0.809254,
-    0.808306,
-    0.807363,
-    0.806427,
-    0.805497,
-    0.804573,
-    0.803656,
-    0.802745,
-    0.801841,
-    0.800943,
-    0.800052,
-    0.799167,
-    0.79829,
-    0.797419,
-    0.796555,
-    0.795698,
-    0.794847,
-    0.794004,
-    0.793168,
-    0.792339,
-    0.791517,
-    0.790703,
-    0.789895,
-    0.789095,
-    0.788302,
-    0.787517,
-    0.786739,
-    0.785969,
-    0.785206,
-    0.784451,
-    0.783704,
-    0.782964,
-    0.782232,
-    0.781507,
-    0.780791,
-    0.780082,
-    0.779381,
-    0.778688,
-    0.778003,
-    0.777326,
-    0.776657,
-    0.775996,
-    0.775344,
-    0.774699,
-    0.774063,
-    0.773435,
-    0.772815,
-    0.772203,
-    0.7716,
-    0.771005,
-    0.770418,
-    0.76984,
-    0.76927,
-    0.768709,
-    0.768156,
-    0.767612,
-    0.767076,
-    0.766549,
-    0.76603,
-    0.76552,
-    0.765019,
-    0.764526,
-    0.764042,
-    0.763567,
-    0.7631,
-    0.762643,
-    0.762194,
-    0.761753,
-    0.761322,
-    0.760899,
-    0.760486,
-    0.760081,
-    0.759685,
-    0.759297,
-    0.758919,
-    0.75855,
-    0.758189,
-    0.757838,
-    0.757495,
-    0.757162,
-    0.756837,
-    0.756521,
-    0.756215,
-    0.755917,
-    0.755628,
-    0.755349,
-    0.755078,
-    0.754816,
-    0.754563,
-    0.75432,
-    0.754085,
-    0.75386,
-    0.753643,
-    0.753435,
-    0.753237,
-    0.753047,
-    0.752867,
-    0.752695,
-    0.752533,
-    0.752379,
-    0.752235,
-    0.752099,
-    0.751973,
-    0.751855,
-    0.751747,
-    0.751647,
-    0.751557,
-    0.751475,
-    0.751403,
-    0.751339,
-    0.751284,
-    0.751238,
-    0.751201,
-    0.751173,
-    0.751154,
-    0.751144,
-    0.751142,
-    0.75115,
-    0.751166,
-    0.751191,
-    0.751225,
-    0.751267,
-    0.751318,
-    0.751378,
-    0.751447,
-    0.751524,
-    0.751611,
-    0.751705,
-    0.751808,
-    0.75192,
-    0.752041,
-    0.75217,
-    0.752307,
-    0.752453,
-    0.752608,
-    0.752771,
-    0.752942,
-    0.753122,
-    0.75331,
-    0.753507,
-    0.753711,
-    0.753924,
-    0.754146,
-    0.754375,
-    0.754613,
-    0.754859,
-    0.755113,
-    0.755375,
-    0.755645,
-    0.755923,
-    0.756209,
-    0.756503,
-    0.756804,
-    0.757114,
-    0.757432,
-    0.757757,
-    0.75809,
-    0.758431,
-    0.758779,
-    0.759135,
-    0.759499,
-    0.75987,
-    0.760249,
-    0.760635,
-    0.761029,
-    0.76143,
-    0.761838,
-    0.762254,
-    0.762677,
-    0.763107,
-    0.763544,
-    0.763988,
-    0.764439,
-    0.764898,
-    0.765363,
-    0.765835,
-    0.766314,
-    0.7668,
-    0.767293,
-    0.767793,
-    0.768299,
-    0.768811,
-    0.769331,
-    0.769856,
-    0.770389,
-    0.770927,
-    0.771472,
-    0.772024,
-    0.772581,
-    0.773145,
-    0.773715,
-    0.774291,
-    0.774873,
-    0.775461,
-    0.776055,
-    0.776654,
-    0.77726,
-    0.777871,
-    0.778488,
-    0.779111,
-    0.779739,
-    0.780373,
-    0.781012,
-    0.781657,
-    0.782306,
-    0.782962,
-    0.783622,
-    0.784288,
-    0.784958,
-    0.785634,
-    0.786314,
-    0.787,
-    0.78769,
-    0.788385,
-    0.789085,
-    0.78979,
-    0.790499,
-    0.791213,
-    0.791931,
-    0.792653,
-    0.79338,
-    0.794111,
-    0.794846,
-    0.795586,
-    0.796329,
-    0.797077,
-    0.797828,
-    0.798584,
-    0.799343,
-    0.800106,
-    0.800872,
-    0.801642,
-    0.802416,
-    0.803193,
-    0.803974,
-    0.804758,
-    0.805545,
-    0.806336,
-    0.807129,
-    0.807926,
-    0.808725,
-    0.809528,
-    0.810333,
-    0.811141,
-    0.811952,
-    0.812766,
-    0.813582,
-    0.8144,
-    0.815221,
-    0.816045,
-    0.81687,
-    0.817698,
-    0.818528,
-    0.819361,
-    0.820195,
-    0.821031,
-    0.821869,
-    0.822709,
-    0.82355,
-    0.824393,
-    0.825238,
-    0.826085,
-    0.826932,
-    0.827781,
-    0.828632,
-    0.829484,
-    0.830336,
-    0.83119,
-    0.832045,
-    0.832901,
-    0.833758,
-    0.834616,
-    0.835474,
-    0.836333,
-    0.837193,
-    0.838053,
-    0.838913,
-    0.839774,
-    0.840635,
-    0.841497,
-    0.842359,
-    0.84322,
-    0.844082,
-    0.844944,
-    0.845805,
-    0.846667,
-    0.847528,
-    0.848389,
-    0.849249,
-    0.850109,
-    0.850969,
-    0.851827,
-    0.852686,
-    0.853543,
-    0.854399,
-    0.855255,
-    0.85611,
-    0.856963,
-    0.857816,
-    0.858667,
-    0.859518,
-    0.860366,
-    0.861214,
-    0.86206,
-    0.862904,
-    0.863747,
-    0.864588,
-    0.865428,
-    0.866266,
-    0.867102,
-    0.867936,
-    0.868768,
-    0.869598,
-    0.870425,
-    0.871251,
-    0.872074,
-    0.872895,
-    0.873714,
-    0.87453,
-    0.875344,
-    0.876155,
-    0.876963,
-    0.877769,
-    0.878572,
-    0.879372,
-    0.880169,
-    0.880964,
-    0.881755,
-    0.882543,
-    0.883328,
-    0.884109,
-    0.884888,
-    0.885663,
-    0.886434,
-    0.887203,
-    0.887967,
-    0.888728,
-    0.889486,
-    0.890239,
-    0.890989,
-    0.891735,
-    0.892477,
-    0.893216,
-    0.89395,
-    0.89468,
-    0.895406,
-    0.896128,
-    0.896845,
-    0.897559,
-    0.898268,
-    0.898972,
-    0.899672,
-    0.900367,
-    0.901058,
-    0.901745,
-    0.902426,
-    0.903103,
-    0.903775,
-    0.904442,
-    0.905105,
-    0.905762,
-    0.906414,
-    0.907062,
-    0.907704,
-    0.908341,
-    0.908973,
-    0.909599,
-    0.910221,
-    0.910837,
-    0.911447,
-    0.912052,
-    0.912652,
-    0.913246,
-    0.913834,
-    0.914417,
-    0.914994,
-    0.915565,
-    0.916131,
-    0.916691,
-    0.917244,
-    0.917792,
-    0.918334,
-    0.918871,
-    0.919401,
-    0.919924,
-    0.920442,
-    0.920954,
-    0.921459,
-    0.921959,
-    0.922451,
-    0.922938,
-    0.923418,
-    0.923892,
-    0.92436,
-    0.924821,
-    0.925275,
-    0.925723,
-    0.926165,
-    0.926599,
-    0.927027,
-    0.927449,
-    0.927864,
-    0.928272,
-    0.928673,
-    0.929067,
-    0.929455,
-    0.929836,
-    0.93021,
-    0.930576,
-    0.930936,
-    0.931289,
-    0.931635,
-    0.931974,
-    0.932306,
-    0.932631,
-    0.932949,
-    0.933259,
-    0.933563,
-    0.933859,
-    0.934148,
-    0.93443,
-    0.934705,
-    0.934972,
-    0.935232,
-    0.935485,
-    0.93573,
-    0.935968,
-    0.936198,
-    0.936422,
-    0.936638,
-    0.936846,
-    0.937047,
-    0.93724,
-    0.937427,
-    0.937605,
-    0.937776,
-    0.93794,
-    0.938096,
-    0.938244,
-    0.938385,
-    0.938519,
-    0.938645,
-    0.938763,
-    0.938873,
-    0.938977,
-    0.939072,
-    0.93916,
-    0.93924,
-    0.939313,
-    0.939378,
-    0.939435,
-    0.939485,
-    0.939527,
-    0.939561,
-    0.939588,
-    0.939607,
-    0.939619,
-    0.939623,
-    0.939619,
-    0.939607,
-    0.939588,
-    0.939561,
-    0.939527,
-    0.939485,
-    0.939435,
-    0.939378,
-    0.939313,
-    0.93924,
-    0.93916,
-    0.939072,
-    0.938977,
-    0.938873,
-    0.938763,
-    0.938645,
-    0.938519,
-    0.938385,
-    0.938244,
-    0.938096,
-    0.93794,
-    0.937776,
-    0.937605,
-    0.937427,
-    0.93724,
-    0.937047,
-    0.936846,
-    0.936638,
-    0.936422,
-    0.936198,
-    0.935968,
-    0.93573,
-    0.935485,
-    0.935232,
-    0.934972,
-    0.934705,
-    0.93443,
-    0.934148,
-    0.933859,
-    0.933563,
-    0.933259,
-    0.932949,
-    0.932631,
-    0.932306,
-    0.931974,
-    0.931635,
-    0.931289,
-    0.930936,
-    0.930576,
-    0.93021,
-    0.929836,
-    0.929455,
-    0.929067,
-    0.928673,
-    0.928272,
-    0.927864,
-    0.927449,
-    0.927027,
-    0.926599,
-    0.926165,
-    0.925723,
-    0.925275,
-    0.924821,
-    0.92436,
-    0.923892,
-    0.923418,
-    0.922938,
-    0.922451,
-    0.921959,
-    0.921459,
-    0.920954,
-    0.920442,
-    0.919924,
-    0.919401,
-    0.918871,
-    0.918334,
-    0.917792,
-    0.917244,
-    0.916691,
-    0.916131,
-    0.915565,
-    0.914994,
-    0.914417,
-    0.913834,
-    0.913246,
-    0.912652,
-    0.912052,
-    0.911447,
-    0.910837,
-    0.910221,
-    0.909599,
-    0.908973,
-    0.908341,
-    0.907704,
-    0.907062,
-    0.906414,
-    0.905762,
-    0.905105,
-    0.904442,
-    0.903775,
-    0.903103,
-    0.902426,
-    0.901745,
-    0.901058,
-    0.900367,
-    0.899672,
-    0.898972,
-    0.898268,
-    0.897559,
-    0.896845,
-    0.896128,
-    0.895406,
-    0.89468,
-    0.89395,
-    0.893216,
-    0.892477,
-    0.891735,
-    0.890989,
-    0.890239,
-    0.889486,
-    0.888728,
-    0.887967,
-    0.887203,
-    0.886434,
-    0.885663,
-    0.884888,
-    0.884109,
-    0.883328,
-    0.882543,
-    0.881755,
-    0.880964,
-    0.880169,
-    0.879372,
-    0.878572,
-    0.877769,
-    0.876963,
-    0.876155,
-    0.875344,
-    0.87453,
-    0.873714,
-    0.872895,
-    0.872074,
-    0.871251,
-    0.870425,
-    0.869598,
-    0.868768,
-    0.867936,
-    0.867102,
-    0.866266,
-    0.865428,
-    0.864588,
-    0.863747,
-    0.862904,
-    0.86206,
-    0.861214,
-    0.860366,
-    0.859518,
-    0.858667,
-    0.857816,
-    0.856963,
-    0.85611,
-    0.855255,
-    0.854399,
-    0.853543,
-    0.852686,
-    0.851827,
-    0.850969,
-    0.850109,
-    0.849249,
-    0.848389,
-    0.847528,
-    0.846667,
-    0.845805,
-    0.844944,
-    0.844082,
-    0.84322,
-    0.842359,
-    0.841497,
-    0.840635,
-    0.839774,
-    0.838913,
-    0.838053,
-    0.837193,
-    0.836333,
-    0.835474,
-    0.834616,
-    0.833758,
-    0.832901,
-    0.832045,
-    0.83119,
-    0.830336,
-    0.829484,
-    0.828632,
-    0.827781,
-    0.826932,
-    0.826085,
-    0.825238,
-    0.824393,
-    0.82355,
-    0.822709,
-    0.821869,
-    0.821031,
-    0.820195,
-    0.819361,
-    0.818528,
-    0.817698,
-    0.81687,
-    0.816045,
-    0.815221,
-    0.8144,
-    0.813582,
-    0.812766,
-    0.811952,
-    0.811141,
-    0.810333,
-    0.809528,
-    0.808725,
-    0.807926,
-    0.807129,
-    0.806336,
-    0.805545,
-    0.804758,
-    0.803974,
-    0.803193,
-    0.802416,
-    0.801642,
-    0.800872,
-    0.800106,
-    0.799343,
-    0.798584,
-    0.797828,
-    0.797077,
-    0.796329,
-    0.795586,
-    0.794846,
-    0.794111,
-    0.79338,
-    0.792653,
-    0.791931,
-    0.791213,
-    0.790499,
-    0.78979,
-    0.789085,
-    0.788385,
-    0.78769,
-    0.787,
-    0.786314,
-    0.785634,
-    0.784958,
-    0.784288,
-    0.783622,
-    0.782962,
-    0.782306,
-    0.781657,
-    0.781012,
-    0.780373,
-    0.779739,
-    0.779111,
-    0.778488,
-    0.777871,
-    0.77726,
-    0.776654,
-    0.776055,
-    0.775461,
-    0.774873,
-    0.774291,
-    0.773715,
-    0.773145,
-    0.772581,
-    0.772024,
-    0.771472,
-    0.770927,
-    0.770389,
-    0.769856,
-    0.769331,
-    0.768811,
-    0.768299,
-    0.767793,
-    0.767293,
-    0.7668,
-    0.766314,
-    0.765835,
-    0.765363,
-    0.764898,
-    0.764439,
-    0.763988,
-    0.763544,
-    0.763107,
-    0.762677,
-    0.762254,
-    0.761838,
-    0.76143,
-    0.761029,
-    0.760635,
-    0.760249,
-    0.75987,
-    0.759499,
-    0.759135,
-    0.758779,
-    0.758431,
-    0.75809,
-    0.757757,
-    0.757432,
-    0.757114,
-    0.756804,
-    0.756503,
-    0.756209,
-    0.755923,
-    0.755645,
-    0.755375,
-    0.755113,
-    0.754859,
-    0.754613,
-    0.754375,
-    0.754146,
-    0.753924,
-    0.753711,
-    0.753507,
-    0.75331,
-    0.753122,
-    0.752942,
-    0.752771,
-    0.752608,
-    0.752453,
-    0.752307,
-    0.75217,
-    0.752041,
-    0.75192,
-    0.751808,
-    0.751705,
-    0.751611,
-    0.751524,
-    0.751447,
-    0.751378,
-    0.751318,
-    0.751267,
-    0.751225,
-    0.751191,
-    0.751166,
-    0.75115,
-    0.751142,
-    0.751144,
-    0.751154,
-    0.751173,
-    0.751201,
-    0.751238,
-    0.751284,
-    0.751339,
-    0.751403,
-    0.751475,
-    0.751557,
-    0.751647,
-    0.751747,
-    0.751855,
-    0.751973,
-    0.752099,
-    0.752235,
-    0.752379,
-    0.752533,
-    0.752695,
-    0.752867,
-    0.753047,
-    0.753237,
-    0.753435,
-    0.753643,
-    0.75386,
-    0.754085,
-    0.75432,
-    0.754563,
-    0.754816,
-    0.755078,
-    0.755349,
-    0.755628,
-    0.755917,
-    0.756215,
-    0.756521,
-    0.756837,
-    0.757162,
-    0.757495,
-    0.757838,
-    0.758189,
-    0.75855,
-    0.758919,
-    0.759297,
-    0.759685,
-    0.760081,
-    0.760486,
-    0.760899,
-    0.761322,
-    0.761753,
-    0.762194,
-    0.762643,
-    0.7631,
-    0.763567,
-    0.764042,
-    0.764526,
-    0.765019,
-    0.76552,
-    0.76603,
-    0.766549,
-    0.767076,
-    0.767612,
-    0.768156,
-    0.768709,
-    0.76927,
-    0.76984,
-    0.770418,
-    0.771005,
-    0.7716,
-    0.772203,
-    0.772815,
-    0.773435,
-    0.774063,
-    0.774699,
-    0.775344,
-    0.775996,
-    0.776657,
-    0.777326,
-    0.778003,
-    0.778688,
-    0.779381,
-    0.780082,
-    0.780791,
-    0.781507,
-    0.782232,
-    0.782964,
-    0.783704,
-    0.784451,
-    0.785206,
-    0.785969,
-    0.786739,
-    0.787517,
-    0.788302,
-    0.789095,
-    0.789895,
-    0.790703,
-    0.791517,
-    0.792339,
-    0.793168,
-    0.794004,
-    0.794847,
-    0.795698,
-    0.796555,
-    0.797419,
-    0.79829,
-    0.799167,
-    0.800052,
-    0.800943,
-    0.801841,
-    0.802745,
-    0.803656,
-    0.804573,
-    0.805497,
-    0.806427,
-    0.807363,
-    0.808306,
-    0.809254,
-    0.810209,
-    0.81117,
-    0.812136,
-    0.813109,
-    0.814087,
-    0.815072,
-    0.816062,
-    0.817057,
-    0.818058,
-    0.819065,
-    0.820077,
-    0.821094,
-    0.822117,
-    0.823145,
-    0.824178,
-    0.825216,
-    0.826259,
-    0.827308,
-    0.82836,
-    0.829418,
-    0.830481,
-    0.831548,
-    0.83262,
-    0.833696,
-    0.834776,
-    0.835861,
-    0.836951,
-    0.838044,
-    0.839141,
-    0.840243,
-    0.841348,
-    0.842458,
-    0.843571,
-    0.844688,
-    0.845808,
-    0.846932,
-    0.84806,
-    0.84919,
-    0.850325,
-    0.851462,
-    0.852602,
-    0.853746,
-    0.854892,
-    0.856042,
-    0.857194,
-    0.858348,
-    0.859506,
-    0.860666,
-    0.861828,
-    0.862993,
-    0.86416,
-    0.865329,
-    0.8665,
-    0.867673,
-    0.868848,
-    0.870025,
-    0.871204,
-    0.872384,
-    0.873566,
-    0.874749,
-    0.875934,
-    0.877119,
-    0.878306,
-    0.879494,
-    0.880683,
-    0.881873,
-    0.883064,
-    0.884255,
-    0.885447,
-    0.886639,
-    0.887832,
-    0.889025,
-    0.890218,
-    0.891411,
-    0.892605,
-    0.893798,
-    0.894991,
-    0.896184,
-    0.897376,
-    0.898568,
-    0.899759,
-    0.90095,
-    0.902139,
-    0.903328,
-    0.904516,
-    0.905703,
-    0.906889,
-    0.908073,
-    0.909256,
-    0.910437,
-    0.911617,
-    0.912795,
-    0.913971,
-    0.915145,
-    0.916318,
-    0.917488,
-    0.918656,
-    0.919821,
-    0.920984,
-    0.922145,
-    0.923303,
-    0.924458,
-    0.92561,
-    0.92676,
-    0.927906,
-    0.929049,
-    0.930189,
-    0.931325,
-    0.932458,
-    0.933588,
-    0.934713,
-    0.935835,
-    0.936953,
-    0.938067,
-    0.939177,
-    0.940283,
-    0.941384,
-    0.942481,
-    0.943573,
-    0.94466,
-    0.945743,
-    0.946821,
-    0.947894,
-    0.948962,
-    0.950024,
-    0.951081,
-    0.952133,
-    0.95318,
-    0.95422,
-    0.955255,
-    0.956284,
-    0.957308,
-    0.958325,
-    0.959336,
-    0.96034,
-    0.961339,
-    0.96233,
-    0.963315,
-    0.964294,
-    0.965266,
-    0.96623,
-    0.967188,
-    0.968139,
-    0.969082,
-    0.970018,
-    0.970946,
-    0.971867,
-    0.972781,
-    0.973686,
-    0.974584,
-    0.975473,
-    0.976355,
-    0.977228,
-    0.978093,
-    0.97895,
-    0.979798,
-    0.980637,
-    0.981468,
-    0.98229,
-    0.983102,
-    0.983906,
-    0.984701,
-    0.985486,
-    0.986262,
-    0.987029,
-    0.987786,
-    0.988533,
-    0.989271,
-    0.989998,
-    0.990716,
-    0.991424,
-    0.992121,
-    0.992808,
-    0.993485,
-    0.994151,
-    0.994807,
-    0.995451,
-    0.996085,
-    0.996709,
-    0.997321,
-    0.997922,
-    0.998511,
-    0.99909,
-    0.999657,
-    1.00021,
-    1.00076,
-    1.00129,
-    1.00181,
-    1.00232,
-    1.00281,
-    1.0033,
-    1.00377,
-    1.00423,
-    1.00468,
-    1.00511,
-    1.00554,
-    1.00595,
-    1.00634,
-    1.00673,
-    1.0071,
-    1.00746,
-    1.0078,
-    1.00813,
-    1.00845,
-    1.00876,
-    1.00905,
-    1.00933,
-    1.00959,
-    1.00984,
-    1.01008,
-    1.0103,
-    1.01051,
-    1.0107,
-    1.01088,
-    1.01105,
-    1.0112,
-    1.01134,
-    1.01146,
-    1.01157,
-    1.01166,
-    1.01174,
-    1.0118,
-    1.01185,
-    1.01188,
-    1.0119,
-    1.0119,
-    1.01189,
-    1.01186,
-    1.01182,
-    1.01176,
-    1.01168,
-    1.01159,
-    1.01148,
-    1.01136,
-    1.01122,
-    1.01107,
-    1.0109,
-    1.01071,
-    1.01051,
-    1.01029,
-    1.01005,
-    1.0098,
-    1.00953,
-    1.00925,
-    1.00895,
-    1.00863,
-    1.00829,
-    1.00794,
-    1.00757,
-    1.00718,
-    1.00678,
-    1.00636,
-    1.00592,
-    1.00546,
-    1.00499,
-    1.0045,
-    1.00399,
-    1.00347,
-    1.00292,
-    1.00236,
-    1.00179,
-    1.00119,
-    1.00058,
-    0.999943,
-    0.999293,
-    0.998625,
-    0.997939,
-    0.997234,
-    0.996512,
-    0.995771,
-    0.995012,
-    0.994235,
-    0.993439,
-    0.992624,
-    0.991791,
-    0.99094,
-    0.99007,
-    0.989181,
-    0.988274,
-    0.987347,
-    0.986402,
-    0.985439,
-    0.984456,
-    0.983454,
-    0.982433,
-    0.981394,
-    0.980335,
-    0.979257,
-    0.97816,
-    0.977044,
-    0.975908,
-    0.974754,
-    0.97358,
-    0.972386,
-    0.971174,
-    0.969942,
-    0.96869,
-    0.967419,
-    0.966129,
-    0.964819,
-    0.963489,
-    0.96214,
-    0.960771,
-    0.959383,
-    0.957975,
-    0.956547,
-    0.955099,
-    0.953632,
-    0.952145,
-    0.950638,
-    0.949112,
-    0.947565,
-    0.945999,
-    0.944413,
-    0.942807,
-    0.941181,
-    0.939535,
-    0.937869,
-    0.936184,
-    0.934478,
-    0.932752,
-    0.931006,
-    0.929241,
-    0.927455,
-    0.925649,
-    0.923823,
-    0.921978,
-    0.920112,
-    0.918226,
-    0.91632,
-    0.914394,
-    0.912448,
-    0.910481,
-    0.908495,
-    0.906489,
-    0.904462,
-    0.902416,
-    0.900349,
-    0.898263,
-    0.896156,
-    0.894029,
-    0.891882,
-    0.889716,
-    0.887529,
-    0.885322,
-    0.883095,
-    0.880848,
-    0.878581,
-    0.876294,
-    0.873987,
-    0.87166,
-    0.869313,
-    0.866946,
-    0.86456,
-    0.862153,
-    0.859726,
-    0.85728,
-    0.854814,
-    0.852328,
-    0.849822,
-    0.847296,
-    0.844751,
-    0.842186,
-    0.839601,
-    0.836996,
-    0.834372,
-    0.831728,
-    0.829064,
-    0.826381,
-    0.823679,
-    0.820957,
-    0.818215,
-    0.815454,
-    0.812673,
-    0.809873,
-    0.807054,
-    0.804216,
-    0.801358,
-    0.798481,
-    0.795584,
-    0.792669,
-    0.789734,
-    0.786781,
-    0.783808,
-    0.780816,
-    0.777806,
-    0.774776,
-    0.771728,
-    0.768661,
-    0.765575,
-    0.76247,
-    0.759347,
-    0.756205,
-    0.753044,
-    0.749865,
-    0.746667,
-    0.743452,
-    0.740217,
-    0.736965,
-    0.733694,
-    0.730405,
-    0.727098,
-    0.723772,
-    0.720429,
-    0.717068,
-    0.713689,
-    0.710292,
-    0.706877,
-    0.703445,
-    0.699995,
-    0.696527,
-    0.693042,
-    0.689539,
-    0.686019,
-    0.682482,
-    0.678927,
-    0.675356,
-    0.671767,
-    0.668161,
-    0.664538,
-    0.660899,
-    0.657242,
-    0.653569,
-    0.649879,
-    0.646173,
-    0.64245,
-    0.63871,
-    0.634954,
-    0.631182,
-    0.627394,
-    0.62359,
-    0.619769,
-    0.615933,
-    0.612081,
-    0.608213,
-    0.604329,
-    0.60043,
-    0.596515,
-    0.592585,
-    0.588639,
-    0.584678,
-    0.580702,
-    0.576711,
-    0.572705,
-    0.568684,
-    0.564648,
-    0.560597,
-    0.556532,
-    0.552452,
-    0.548358,
-    0.54425,
-    0.540127,
-    0.53599,
-    0.531839,
-    0.527674,
-    0.523495,
-    0.519302,
-    0.515096,
-    0.510876,
-    0.506643,
-    0.502396,
-    0.498136,
-    0.493863,
-    0.489576,
-    0.485277,
-    0.480965,
-    0.47664,
-    0.472303,
-    0.467953,
-    0.463591,
-    0.459216,
-    0.454829,
-    0.45043,
-    0.446019,
-    0.441596,
-    0.437161,
-    0.432715,
-    0.428257,
-    0.423788,
-    0.419307,
-    0.414815,
-    0.410312,
-    0.405798,
-    0.401273,
-    0.396738,
-    0.392192,
-    0.387635,
-    0.383068,
-    0.37849,
-    0.373902,
-    0.369305,
-    0.364697,
-    0.36008,
-    0.355452,
-    0.350816,
-    0.346169,
-    0.341514,
-    0.336849,
-    0.332175,
-    0.327492,
-    0.3228,
-    0.3181,
-    0.313391,
-    0.308673,
-    0.303947,
-    0.299213,
-    0.294471,
-    0.289721,
-    0.284963,
-    0.280197,
-    0.275423,
-    0.270642,
-    0.265854,
-    0.261059,
-    0.256256,
-    0.251446,
-    0.24663,
-    0.241807,
-    0.236977,
-    0.232141,
-    0.227298,
-    0.22245,
-    0.217595,
-    0.212734,
-    0.207868,
-    0.202996,
-    0.198118,
-    0.193235,
-    0.188346,
-    0.183453,
-    0.178554,
-    0.173651,
-    0.168743,
-    0.16383,
-    0.158912,
-    0.153991,
-    0.149065,
-    0.144135,
-    0.139201,
-    0.134263,
-    0.129322,
-    0.124377,
-    0.119429,
-    0.114477,
-    0.109523,
-    0.104565,
-    0.0996042,
-    0.0946409,
-    0.089675,
-    0.0847066,
-    0.0797359,
-    0.074763,
-    0.0697881,
-    0.0648112,
-    0.0598326,
-    0.0548523,
-    0.0498705,
-    0.0448874,
-    0.039903,
-    0.0349175,
-    0.0299311,
-    0.0249438,
-    0.0199559,
-    0.0149674,
-    0.00997848,
-    0.00498931,
-    0,
-    -0.00498931,
-    -0.00997848,
-    -0.0149674,
-    -0.0199559,
-    -0.0249438,
-    -0.0299311,
-    -0.0349175,
-    -0.039903,
-    -0.0448874,
-    -0.0498705,
-    -0.0548523,
-    -0.0598326,
-    -0.0648112,
-    -0.0697881,
-    -0.074763,
-    -0.0797359,
-    -0.0847066,
-    -0.089675,
-    -0.0946409,
-    -0.0996042,
-    -0.104565,
-    -0.109523,
-    -0.114477,
-    -0.119429,
-    -0.124377,
-    -0.129322,
-    -0.134263,
-    -0.139201,
-    -0.144135,
-    -0.149065,
-    -0.153991,
-    -0.158912,
-    -0.16383,
-    -0.168743,
-    -0.173651,
-    -0.178554,
-    -0.183453,
-    -0.188346,
-    -0.193235,
-    -0.198118,
-    -0.202996,
-    -0.207868,
-    -0.212734,
-    -0.217595,
-    -0.22245,
-    -0.227298,
-    -0.232141,
-    -0.236977,
-    -0.241807,
-    -0.24663,
-    -0.251446,
-    -0.256256,
-    -0.261059,
-    -0.265854,
-    -0.270642,
-    -0.275423,
-    -0.280197,
-    -0.284963,
-    -0.289721,
-    -0.294471,
-    -0.299213,
-    -0.303947,
-    -0.308673,
-    -0.313391,
-    -0.3181,
-    -0.3228,
-    -0.327492,
-    -0.332175,
-    -0.336849,
-    -0.341514,
-    -0.346169,
-    -0.350816,
-    -0.355452,
-    -0.36008,
-    -0.364697,
-    -0.369305,
-    -0.373902,
-    -0.37849,
-    -0.383068,
-    -0.387635,
-    -0.392192,
-    -0.396738,
-    -0.401273,
-    -0.405798,
-    -0.410312,
-    -0.414815,
-    -0.419307,
-    -0.423788,
-    -0.428257,
-    -0.432715,
-    -0.437161,
-    -0.441596,
-    -0.446019,
-    -0.45043,
-    -0.454829,
-    -0.459216,
-    -0.463591,
-    -0.467953,
-    -0.472303,
-    -0.47664,
-    -0.480965,
-    -0.485277,
-    -0.489576,
-    -0.493863,
-    -0.498136,
-    -0.502396,
-    -0.506643,
-    -0.510876,
-    -0.515096,
-    -0.519302,
-    -0.523495,
-    -0.527674,
-    -0.531839,
-    -0.53599,
-    -0.540127,
-    -0.54425,
-    -0.548358,
-    -0.552452,
-    -0.556532,
-    -0.560597,
-    -0.564648,
-    -0.568684,
-    -0.572705,
-    -0.576711,
-    -0.580702,
-    -0.584678,
-    -0.588639,
-    -0.592585,
-    -0.596515,
-    -0.60043,
-    -0.604329,
-    -0.608213,
-    -0.612081,
-    -0.615933,
-    -0.619769,
-    -0.62359,
-    -0.627394,
-    -0.631182,
-    -0.634954,
-    -0.63871,
-    -0.64245,
-    -0.646173,
-    -0.649879,
-    -0.653569,
-    -0.657242,
-    -0.660899,
-    -0.664538,
-    -0.668161,
-    -0.671767,
-    -0.675356,
-    -0.678927,
-    -0.682482,
-    -0.686019,
-    -0.689539,
-    -0.693042,
-    -0.696527,
-    -0.699995,
-    -0.703445,
-    -0.706877,
-    -0.710292,
-    -0.713689,
-    -0.717068,
-    -0.720429,
-    -0.723772,
-    -0.727098,
-    -0.730405,
-    -0.733694,
-    -0.736965,
-    -0.740217,
-    -0.743452,
-    -0.746667,
-    -0.749865,
-    -0.753044,
-    -0.756205,
-    -0.759347,
-    -0.76247,
-    -0.765575,
-    -0.768661,
-    -0.771728,
-    -0.774776,
-    -0.777806,
-    -0.780816,
-    -0.783808,
-    -0.786781,
-    -0.789734,
-    -0.792669,
-    -0.795584,
-    -0.798481,
-    -0.801358,
-    -0.804216,
-    -0.807054,
-    -0.809873,
-    -0.812673,
-    -0.815454,
-    -0.818215,
-    -0.820957,
-    -0.823679,
-    -0.826381,
-    -0.829064,
-    -0.831728,
-    -0.834372,
-    -0.836996,
-    -0.839601,
-    -0.842186,
-    -0.844751,
-    -0.847296,
-    -0.849822,
-    -0.852328,
-    -0.854814,
-    -0.85728,
-    -0.859726,
-    -0.862153,
-    -0.86456,
-    -0.866946,
-    -0.869313,
-    -0.87166,
-    -0.873987,
-    -0.876294,
-    -0.878581,
-    -0.880848,
-    -0.883095,
-    -0.885322,
-    -0.887529,
-    -0.889716,
-    -0.891882,
-    -0.894029,
-    -0.896156,
-    -0.898263,
-    -0.900349,
-    -0.902416,
-    -0.904462,
-    -0.906489,
-    -0.908495,
-    -0.910481,
-    -0.912448,
-    -0.914394,
-    -0.91632,
-    -0.918226,
-    -0.920112,
-    -0.921978,
-    -0.923823,
-    -0.925649,
-    -0.927455,
-    -0.929241,
-    -0.931006,
-    -0.932752,
-    -0.934478,
-    -0.936184,
-    -0.937869,
-    -0.939535,
-    -0.941181,
-    -0.942807,
-    -0.944413,
-    -0.945999,
-    -0.947565,
-    -0.949112,
-    -0.950638,
-    -0.952145,
-    -0.953632,
-    -0.955099,
-    -0.956547,
-    -0.957975,
-    -0.959383,
-    -0.960771,
-    -0.96214,
-    -0.963489,
-    -0.964819,
-    -0.966129,
-    -0.967419,
-    -0.96869,
-    -0.969942,
-    -0.971174,
-    -0.972386,
-    -0.97358,
-    -0.974754,
-    -0.975908,
-    -0.977044,
-    -0.97816,
-    -0.979257,
-    -0.980335,
-    -0.981394,
-    -0.982433,
-    -0.983454,
-    -0.984456,
-    -0.985439,
-    -0.986402,
-    -0.987347,
-    -0.988274,
-    -0.989181,
-    -0.99007,
-    -0.99094,
-    -0.991791,
-    -0.992624,
-    -0.993439,
-    -0.994235,
-    -0.995012,
-    -0.995771,
-    -0.996512,
-    -0.997234,
-    -0.997939,
-    -0.998625,
-    -0.999293,
-    -0.999943,
-    -1.00058,
-    -1.00119,
-    -1.00179,
-    -1.00236,
-    -1.00292,
-    -1.00347,
-    -1.00399,
-    -1.0045,
-    -1.00499,
-    -1.00546,
-    -1.00592,
-    -1.00636,
-    -1.00678,
-    -1.00718,
-    -1.00757,
-    -1.00794,
-    -1.00829,
-    -1.00863,
-    -1.00895,
-    -1.00925,
-    -1.00953,
-    -1.0098,
-    -1.01005,
-    -1.01029,
-    -1.01051,
-    -1.01071,
-    -1.0109,
-    -1.01107,
-    -1.01122,
-    -1.01136,
-    -1.01148,
-    -1.01159,
-    -1.01168,
-    -1.01176,
-    -1.01182,
-    -1.01186,
-    -1.01189,
-    -1.0119,
-    -1.0119,
-    -1.01188,
-    -1.01185,
-    -1.0118,
-    -1.01174,
-    -1.01166,
-    -1.01157,
-    -1.01146,
-    -1.01134,
-    -1.0112,
-    -1.01105,
-    -1.01088,
-    -1.0107,
-    -1.01051,
-    -1.0103,
-    -1.01008,
-    -1.00984,
-    -1.00959,
-    -1.00933,
-    -1.00905,
-    -1.00876,
-    -1.00845,
-    -1.00813,
-    -1.0078,
-    -1.00746,
-    -1.0071,
-    -1.00673,
-    -1.00634,
-    -1.00595,
-    -1.00554,
-    -1.00511,
-    -1.00468,
-    -1.00423,
-    -1.00377,
-    -1.0033,
-    -1.00281,
-    -1.00232,
-    -1.00181,
-    -1.00129,
-    -1.00076,
-    -1.00021,
-    -0.999657,
-    -0.99909,
-    -0.998511,
-    -0.997922,
-    -0.997321,
-    -0.996709,
-    -0.996085,
-    -0.995451,
-    -0.994807,
-    -0.994151,
-    -0.993485,
-    -0.992808,
-    -0.992121,
-    -0.991424,
-    -0.990716,
-    -0.989998,
-    -0.989271,
-    -0.988533,
-    -0.987786,
-    -0.987029,
-    -0.986262,
-    -0.985486,
-    -0.984701,
-    -0.983906,
-    -0.983102,
-    -0.98229,
-    -0.981468,
-    -0.980637,
-    -0.979798,
-    -0.97895,
-    -0.978093,
-    -0.977228,
-    -0.976355,
-    -0.975473,
-    -0.974584,
-    -0.973686,
-    -0.972781,
-    -0.971867,
-    -0.970946,
-    -0.970018,
-    -0.969082,
-    -0.968139,
-    -0.967188,
-    -0.96623,
-    -0.965266,
-    -0.964294,
-    -0.963315,
-    -0.96233,
-    -0.961339,
-    -0.96034,
-    -0.959336,
-    -0.958325,
-    -0.957308,
-    -0.956284,
-    -0.955255,
-    -0.95422,
-    -0.95318,
-    -0.952133,
-    -0.951081,
-    -0.950024,
-    -0.948962,
-    -0.947894,
-    -0.946821,
-    -0.945743,
-    -0.94466,
-    -0.943573,
-    -0.942481,
-    -0.941384,
-    -0.940283,
-    -0.939177,
-    -0.938067,
-    -0.936953,
-    -0.935835,
-    -0.934713,
-    -0.933588,
-    -0.932458,
-    -0.931325,
-    -0.930189,
-    -0.929049,
-    -0.927906,
-    -0.92676,
-    -0.92561,
-    -0.924458,
-    -0.923303,
-    -0.922145,
-    -0.920984,
-    -0.919821,
-    -0.918656,
-    -0.917488,
-    -0.916318,
-    -0.915145,
-    -0.913971,
-    -0.912795,
-    -0.911617,
-    -0.910437,
-    -0.909256,
-    -0.908073,
-    -0.906889,
-    -0.905703,
-    -0.904516,
-    -0.903328,
-    -0.902139,
-    -0.90095,
-    -0.899759,
-    -0.898568,
-    -0.897376,
-    -0.896184,
-    -0.894991,
-    -0.893798,
-    -0.892605,
-    -0.891411,
-    -0.890218,
-    -0.889025,
-    -0.887832,
-    -0.886639,
-    -0.885447,
-    -0.884255,
-    -0.883064,
-    -0.881873,
-    -0.880683,
-    -0.879494,
-    -0.878306,
-    -0.877119,
-    -0.875934,
-    -0.874749,
-    -0.873566,
-    -0.872384,
-    -0.871204,
-    -0.870025,
-    -0.868848,
-    -0.867673,
-    -0.8665,
-    -0.865329,
-    -0.86416,
-    -0.862993,
-    -0.861828,
-    -0.860666,
-    -0.859506,
-    -0.858348,
-    -0.857194,
-    -0.856042,
-    -0.854892,
-    -0.853746,
-    -0.852602,
-    -0.851462,
-    -0.850325,
-    -0.84919,
-    -0.84806,
-    -0.846932,
-    -0.845808,
-    -0.844688,
-    -0.843571,
-    -0.842458,
-    -0.841348,
-    -0.840243,
-    -0.839141,
-    -0.838044,
-    -0.836951,
-    -0.835861,
-    -0.834776,
-    -0.833696,
-    -0.83262,
-    -0.831548,
-    -0.830481,
-    -0.829418,
-    -0.82836,
-    -0.827308,
-    -0.826259,
-    -0.825216,
-    -0.824178,
-    -0.823145,
-    -0.822117,
-    -0.821094,
-    -0.820077,
-    -0.819065,
-    -0.818058,
-    -0.817057,
-    -0.816062,
-    -0.815072,
-    -0.814087,
-    -0.813109,
-    -0.812136,
-    -0.81117,
-    -0.810209,
-    -0.809254,
-    -0.808306,
-    -0.807363,
-    -0.806427,
-    -0.805497,
-    -0.804573,
-    -0.803656,
-    -0.802745,
-    -0.801841,
-    -0.800943,
-    -0.800052,
-    -0.799167,
-    -0.79829,
-    -0.797419,
-    -0.796555,
-    -0.795698,
-    -0.794847,
-    -0.794004,
-    -0.793168,
-    -0.792339,
-    -0.791517,
-    -0.790703,
-    -0.789895,
-    -0.789095,
-    -0.788302,
-    -0.787517,
-    -0.786739,
-    -0.785969,
-    -0.785206,
-    -0.784451,
-    -0.783704,
-    -0.782964,
-    -0.782232,
-    -0.781507,
-    -0.780791,
-    -0.780082,
-    -0.779381,
-    -0.778688,
-    -0.778003,
-    -0.777326,
-    -0.776657,
-    -0.775996,
-    -0.775344,
-    -0.774699,
-    -0.774063,
-    -0.773435,
-    -0.772815,
-    -0.772203,
-    -0.7716,
-    -0.771005,
-    -0.770418,
-    -0.76984,
-    -0.76927,
-    -0.768709,
-    -0.768156,
-    -0.767612,
-    -0.767076,
-    -0.766549,
-    -0.76603,
-    -0.76552,
-    -0.765019,
-    -0.764526,
-    -0.764042,
-    -0.763567,
-    -0.7631,
-    -0.762643,
-    -0.762194,
-    -0.761753,
-    -0.761322,
-    -0.760899,
-    -0.760486,
-    -0.760081,
-    -0.759685,
-    -0.759297,
-    -0.758919,
-    -0.75855,
-    -0.758189,
-    -0.757838,
-    -0.757495,
-    -0.757162,
-    -0.756837,
-    -0.756521,
-    -0.756215,
-    -0.755917,
-    -0.755628,
-    -0.755349,
-    -0.755078,
-    -0.754816,
-    -0.754563,
-    -0.75432,
-    -0.754085,
-    -0.75386,
-    -0.753643,
-    -0.753435,
-    -0.753237,
-    -0.753047,
-    -0.752867,
-    -0.752695,
-    -0.752533,
-    -0.752379,
-    -0.752235,
-    -0.752099,
-    -0.751973,
-    -0.751855,
-    -0.751747,
-    -0.751647,
-    -0.751557,
-    -0.751475,
-    -0.751403,
-    -0.751339,
-    -0.751284,
-    -0.751238,
-    -0.751201,
-    -0.751173,
-    -0.751154,
-    -0.751144,
-    -0.751142,
-    -0.75115,
-    -0.751166,
-    -0.751191,
-    -0.751225,
-    -0.751267,
-    -0.751318,
-    -0.751378,
-    -0.751447,
-    -0.751524,
-    -0.751611,
-    -0.751705,
-    -0.751808,
-    -0.75192,
-    -0.752041,
-    -0.75217,
-    -0.752307,
-    -0.752453,
-    -0.752608,
-    -0.752771,
-    -0.752942,
-    -0.753122,
-    -0.75331,
-    -0.753507,
-    -0.753711,
-    -0.753924,
-    -0.754146,
-    -0.754375,
-    -0.754613,
-    -0.754859,
-    -0.755113,
-    -0.755375,
-    -0.755645,
-    -0.755923,
-    -0.756209,
-    -0.756503,
-    -0.756804,
-    -0.757114,
-    -0.757432,
-    -0.757757,
-    -0.75809,
-    -0.758431,
-    -0.758779,
-    -0.759135,
-    -0.759499,
-    -0.75987,
-    -0.760249,
-    -0.760635,
-    -0.761029,
-    -0.76143,
-    -0.761838,
-    -0.762254,
-    -0.762677,
-    -0.763107,
-    -0.763544,
-    -0.763988,
-    -0.764439,
-    -0.764898,
-    -0.765363,
-    -0.765835,
-    -0.766314,
-    -0.7668,
-    -0.767293,
-    -0.767793,
-    -0.768299,
-    -0.768811,
-    -0.769331,
-    -0.769856,
-    -0.770389,
-    -0.770927,
-    -0.771472,
-    -0.772024,
-    -0.772581,
-    -0.773145,
-    -0.773715,
-    -0.774291,
-    -0.774873,
-    -0.775461,
-    -0.776055,
-    -0.776654,
-    -0.77726,
-    -0.777871,
-    -0.778488,
-    -0.779111,
-    -0.779739,
-    -0.780373,
-    -0.781012,
-    -0.781657,
-    -0.782306,
-    -0.782962,
-    -0.783622,
-    -0.784288,
-    -0.784958,
-    -0.785634,
-    -0.786314,
-    -0.787,
-    -0.78769,
-    -0.788385,
-    -0.789085,
-    -0.78979,
-    -0.790499,
-    -0.791213,
-    -0.791931,
-    -0.792653,
-    -0.79338,
-    -0.794111,
-    -0.794846,
-    -0.795586,
-    -0.796329,
-    -0.797077,
-    -0.797828,
-    -0.798584,
-    -0.799343,
-    -0.800106,
-    -0.800872,
-    -0.801642,
-    -0.802416,
-    -0.803193,
-    -0.803974,
-    -0.804758,
-    -0.805545,
-    -0.806336,
-    -0.807129,
-    -0.807926,
-    -0.808725,
-    -0.809528,
-    -0.810333,
-    -0.811141,
-    -0.811952,
-    -0.812766,
-    -0.813582,
-    -0.8144,
-    -0.815221,
-    -0.816045,
-    -0.81687,
-    -0.817698,
-    -0.818528,
-    -0.819361,
-    -0.820195,
-    -0.821031,
-    -0.821869,
-    -0.822709,
-    -0.82355,
-    -0.824393,
-    -0.825238,
-    -0.826085,
-    -0.826932,
-    -0.827781,
-    -0.828632,
-    -0.829484,
-    -0.830336,
-    -0.83119,
-    -0.832045,
-    -0.832901,
-    -0.833758,
-    -0.834616,
-    -0.835474,
-    -0.836333,
-    -0.837193,
-    -0.838053,
-    -0.838913,
-    -0.839774,
-    -0.840635,
-    -0.841497,
-    -0.842359,
-    -0.84322,
-    -0.844082,
-    -0.844944,
-    -0.845805,
-    -0.846667,
-    -0.847528,
-    -0.848389,
-    -0.849249,
-    -0.850109,
-    -0.850969,
-    -0.851827,
-    -0.852686,
-    -0.853543,
-    -0.854399,
-    -0.855255,
-    -0.85611,
-    -0.856963,
-    -0.857816,
-    -0.858667,
-    -0.859518,
-    -0.860366,
-    -0.861214,
-    -0.86206,
-    -0.862904,
-    -0.863747,
-    -0.864588,
-    -0.865428,
-    -0.866266,
-    -0.867102,
-    -0.867936,
-    -0.868768,
-    -0.869598,
-    -0.870425,
-    -0.871251,
-    -0.872074,
-    -0.872895,
-    -0.873714,
-    -0.87453,
-    -0.875344,
-    -0.876155,
-    -0.876963,
-    -0.877769,
-    -0.878572,
-    -0.879372,
-    -0.880169,
-    -0.880964,
-    -0.881755,
-    -0.882543,
-    -0.883328,
-    -0.884109,
-    -0.884888,
-    -0.885663,
-    -0.886434,
-    -0.887203,
-    -0.887967,
-    -0.888728,
-    -0.889486,
-    -0.890239,
-    -0.890989,
-    -0.891735,
-    -0.892477,
-    -0.893216,
-    -0.89395,
-    -0.89468,
-    -0.895406,
-    -0.896128,
-    -0.896845,
-    -0.897559,
-    -0.898268,
-    -0.898972,
-    -0.899672,
-    -0.900367,
-    -0.901058,
-    -0.901745,
-    -0.902426,
-    -0.903103,
-    -0.903775,
-    -0.904442,
-    -0.905105,
-    -0.905762,
-    -0.906414,
-    -0.907062,
-    -0.907704,
-    -0.908341,
-    -0.908973,
-    -0.909599,
-    -0.910221,
-    -0.910837,
-    -0.911447,
-    -0.912052,
-    -0.912652,
-    -0.913246,
-    -0.913834,
-    -0.914417,
-    -0.914994,
-    -0.915565,
-    -0.916131,
-    -0.916691,
-    -0.917244,
-    -0.917792,
-    -0.918334,
-    -0.918871,
-    -0.919401,
-    -0.919924,
-    -0.920442,
-    -0.920954,
-    -0.921459,
-    -0.921959,
-    -0.922451,
-    -0.922938,
-    -0.923418,
-    -0.923892,
-    -0.92436,
-    -0.924821,
-    -0.925275,
-    -0.925723,
-    -0.926165,
-    -0.926599,
-    -0.927027,
-    -0.927449,
-    -0.927864,
-    -0.928272,
-    -0.928673,
-    -0.929067,
-    -0.929455,
-    -0.929836,
-    -0.93021,
-    -0.930576,
-    -0.930936,
-    -0.931289,
-    -0.931635,
-    -0.931974,
-    -0.932306,
-    -0.932631,
-    -0.932949,
-    -0.933259,
-    -0.933563,
-    -0.933859,
-    -0.934148,
-    -0.93443,
-    -0.934705,
-    -0.934972,
-    -0.935232,
-    -0.935485,
-    -0.93573,
-    -0.935968,
-    -0.936198,
-    -0.936422,
-    -0.936638,
-    -0.936846,
-    -0.937047,
-    -0.93724,
-    -0.937427,
-    -0.937605,
-    -0.937776,
-    -0.93794,
-    -0.938096,
-    -0.938244,
-    -0.938385,
-    -0.938519,
-    -0.938645,
-    -0.938763,
-    -0.938873,
-    -0.938977,
-    -0.939072,
-    -0.93916,
-    -0.93924,
-    -0.939313,
-    -0.939378,
-    -0.939435,
-    -0.939485,
-    -0.939527,
-    -0.939561,
-    -0.939588,
-    -0.939607,
-    -0.939619,
-    -0.939623,
-    -0.939619,
-    -0.939607,
-    -0.939588,
-    -0.939561,
-    -0.939527,
-    -0.939485,
-    -0.939435,
-    -0.939378,
-    -0.939313,
-    -0.93924,
-    -0.93916,
-    -0.939072,
-    -0.938977,
-    -0.938873,
-    -0.938763,
-    -0.938645,
-    -0.938519,
-    -0.938385,
-    -0.938244,
-    -0.938096,
-    -0.93794,
-    -0.937776,
-    -0.937605,
-    -0.937427,
-    -0.93724,
-    -0.937047,
-    -0.936846,
-    -0.936638,
-    -0.936422,
-    -0.936198,
-    -0.935968,
-    -0.93573,
-    -0.935485,
-    -0.935232,
-    -0.934972,
-    -0.934705,
-    -0.93443,
-    -0.934148,
-    -0.933859,
-    -0.933563,
-    -0.933259,
-    -0.932949,
-    -0.932631,
-    -0.932306,
-    -0.931974,
-    -0.931635,
-    -0.931289,
-    -0.930936,
-    -0.930576,
-    -0.93021,
-    -0.929836,
-    -0.929455,
-    -0.929067,
-    -0.928673,
-    -0.928272,
-    -0.927864,
-    -0.927449,
-    -0.927027,
-    -0.926599,
-    -0.926165,
-    -0.925723,
-    -0.925275,
-    -0.924821,
-    -0.92436,
-    -0.923892,
-    -0.923418,
-    -0.922938,
-    -0.922451,
-    -0.921959,
-    -0.921459,
-    -0.920954,
-    -0.920442,
-    -0.919924,
-    -0.919401,
-    -0.918871,
-    -0.918334,
-    -0.917792,
-    -0.917244,
-    -0.916691,
-    -0.916131,
-    -0.915565,
-    -0.914994,
-    -0.914417,
-    -0.913834,
-    -0.913246,
-    -0.912652,
-    -0.912052,
-    -0.911447,
-    -0.910837,
-    -0.910221,
-    -0.909599,
-    -0.908973,
-    -0.908341,
-    -0.907704,
-    -0.907062,
-    -0.906414,
-    -0.905762,
-    -0.905105,
-    -0.904442,
-    -0.903775,
-    -0.903103,
-    -0.902426,
-    -0.901745,
-    -0.901058,
-    -0.900367,
-    -0.899672,
-    -0.898972,
-    -0.898268,
-    -0.897559,
-    -0.896845,
-    -0.896128,
-    -0.895406,
-    -0.89468,
-    -0.89395,
-    -0.893216,
-    -0.892477,
-    -0.891735,
-    -0.890989,
-    -0.890239,
-    -0.889486,
-    -0.888728,
-    -0.887967,
-    -0.887203,
-    -0.886434,
-    -0.885663,
-    -0.884888,
-    -0.884109,
-    -0.883328,
-    -0.882543,
-    -0.881755,
-    -0.880964,
-    -0.880169,
-    -0.879372,
-    -0.878572,
-    -0.877769,
-    -0.876963,
-    -0.876155,
-    -0.875344,
-    -0.87453,
-    -0.873714,
-    -0.872895,
-    -0.872074,
-    -0.871251,
-    -0.870425,
-    -0.869598,
-    -0.868768,
-    -0.867936,
-    -0.867102,
-    -0.866266,
-    -0.865428,
-    -0.864588,
-    -0.863747,
-    -0.862904,
-    -0.86206,
-    -0.861214,
-    -0.860366,
-    -0.859518,
-    -0.858667,
-    -0.857816,
-    -0.856963,
-    -0.85611,
-    -0.855255,
-    -0.854399,
-    -0.853543,
-    -0.852686,
-    -0.851827,
-    -0.850969,
-    -0.850109,
-    -0.849249,
-    -0.848389,
-    -0.847528,
-    -0.846667,
-    -0.845805,
-    -0.844944,
-    -0.844082,
-    -0.84322,
-    -0.842359,
-    -0.841497,
-    -0.840635,
-    -0.839774,
-    -0.838913,
-    -0.838053,
-    -0.837193,
-    -0.836333,
-    -0.835474,
-    -0.834616,
-    -0.833758,
-    -0.832901,
-    -0.832045,
-    -0.83119,
-    -0.830336,
-    -0.829484,
-    -0.828632,
-    -0.827781,
-    -0.826932,
-    -0.826085,
-    -0.825238,
-    -0.824393,
-    -0.82355,
-    -0.822709,
-    -0.821869,
-    -0.821031,
-    -0.820195,
-    -0.819361,
-    -0.818528,
-    -0.817698,
-    -0.81687,
-    -0.816045,
-    -0.815221,
-    -0.8144,
-    -0.813582,
-    -0.812766,
-    -0.811952,
-    -0.811141,
-    -0.810333,
-    -0.809528,
-    -0.808725,
-    -0.807926,
-    -0.807129,
-    -0.806336,
-    -0.805545,
-    -0.804758,
-    -0.803974,
-    -0.803193,
-    -0.802416,
-    -0.801642,
-    -0.800872,
-    -0.800106,
-    -0.799343,
-    -0.798584,
-    -0.797828,
-    -0.797077,
-    -0.796329,
-    -0.795586,
-    -0.794846,
-    -0.794111,
-    -0.79338,
-    -0.792653,
-    -0.791931,
-    -0.791213,
-    -0.790499,
-    -0.78979,
-    -0.789085,
-    -0.788385,
-    -0.78769,
-    -0.787,
-    -0.786314,
-    -0.785634,
-    -0.784958,
-    -0.784288,
-    -0.783622,
-    -0.782962,
-    -0.782306,
-    -0.781657,
-    -0.781012,
-    -0.780373,
-    -0.779739,
-    -0.779111,
-    -0.778488,
-    -0.777871,
-    -0.77726,
-    -0.776654,
-    -0.776055,
-    -0.775461,
-    -0.774873,
-    -0.774291,
-    -0.773715,
-    -0.773145,
-    -0.772581,
-    -0.772024,
-    -0.771472,
-    -0.770927,
-    -0.770389,
-    -0.769856,
-    -0.769331,
-    -0.768811,
-    -0.768299,
-    -0.767793,
-    -0.767293,
-    -0.7668,
-    -0.766314,
-    -0.765835,
-    -0.765363,
-    -0.764898,
-    -0.764439,
-    -0.763988,
-    -0.763544,
-    -0.763107,
-    -0.762677,
-    -0.762254,
-    -0.761838,
-    -0.76143,
-    -0.761029,
-    -0.760635,
-    -0.760249,
-    -0.75987,
-    -0.759499,
-    -0.759135,
-    -0.758779,
-    -0.758431,
-    -0.75809,
-    -0.757757,
-    -0.757432,
-    -0.757114,
-    -0.756804,
-    -0.756503,
-    -0.756209,
-    -0.755923,
-    -0.755645,
-    -0.755375,
-    -0.755113,
-    -0.754859,
-    -0.754613,
-    -0.754375,
-    -0.754146,
-    -0.753924,
-    -0.753711,
-    -0.753507,
-    -0.75331,
-    -0.753122,
-    -0.752942,
-    -0.752771,
-    -0.752608,
-    -0.752453,
-    -0.752307,
-    -0.75217,
-    -0.752041,
-    -0.75192,
-    -0.751808,
-    -0.751705,
-    -0.751611,
-    -0.751524,
-    -0.751447,
-    -0.751378,
-    -0.751318,
-    -0.751267,
-    -0.751225,
-    -0.751191,
-    -0.751166,
-    -0.75115,
-    -0.751142,
-    -0.751144,
-    -0.751154,
-    -0.751173,
-    -0.751201,
-    -0.751238,
-    -0.751284,
-    -0.751339,
-    -0.751403,
-    -0.751475,
-    -0.751557,
-    -0.751647,
-    -0.751747,
-    -0.751855,
-    -0.751973,
-    -0.752099,
-    -0.752235,
-    -0.752379,
-    -0.752533,
-    -0.752695,
-    -0.752867,
-    -0.753047,
-    -0.753237,
-    -0.753435,
-    -0.753643,
-    -0.75386,
-    -0.754085,
-    -0.75432,
-    -0.754563,
-    -0.754816,
-    -0.755078,
-    -0.755349,
-    -0.755628,
-    -0.755917,
-    -0.756215,
-    -0.756521,
-    -0.756837,
-    -0.757162,
-    -0.757495,
-    -0.757838,
-    -0.758189,
-    -0.75855,
-    -0.758919,
-    -0.759297,
-    -0.759685,
-    -0.760081,
-    -0.760486,
-    -0.760899,
-    -0.761322,
-    -0.761753,
-    -0.762194,
-    -0.762643,
-    -0.7631,
-    -0.763567,
-    -0.764042,
-    -0.764526,
-    -0.765019,
-    -0.76552,
-    -0.76603,
-    -0.766549,
-    -0.767076,
-    -0.767612,
-    -0.768156,
-    -0.768709,
-    -0.76927,
-    -0.76984,
-    -0.770418,
-    -0.771005,
-    -0.7716,
-    -0.772203,
-    -0.772815,
-    -0.773435,
-    -0.774063,
-    -0.774699,
-    -0.775344,
-    -0.775996,
-    -0.776657,
-    -0.777326,
-    -0.778003,
-    -0.778688,
-    -0.779381,
-    -0.780082,
-    -0.780791,
-    -0.781507,
-    -0.782232,
-    -0.782964,
-    -0.783704,
-    -0.784451,
-    -0.785206,
-    -0.785969,
-    -0.786739,
-    -0.787517,
-    -0.788302,
-    -0.789095,
-    -0.789895,
-    -0.790703,
-    -0.791517,
-    -0.792339,
-    -0.793168,
-    -0.794004,
-    -0.794847,
-    -0.795698,
-    -0.796555,
-    -0.797419,
-    -0.79829,
-    -0.799167,
-    -0.800052,
-    -0.800943,
-    -0.801841,
-    -0.802745,
-    -0.803656,
-    -0.804573,
-    -0.805497,
-    -0.806427,
-    -0.807363,
-    -0.808306,
-    -0.809254,
-    -0.810209,
-    -0.81117,
-    -0.812136,
-    -0.813109,
-    -0.814087,
-    -0.815072,
-    -0.816062,
-    -0.817057,
-    -0.818058,
-    -0.819065,
-    -0.820077,
-    -0.821094,
-    -0.822117,
-    -0.823145,
-    -0.824178,
-    -0.825216,
-    -0.826259,
-    -0.827308,
-    -0.82836,
-    -0.829418,
-    -0.830481,
-    -0.831548,
-    -0.83262,
-    -0.833696,
-    -0.834776,
-    -0.835861,
-    -0.836951,
-    -0.838044,
-    -0.839141,
-    -0.840243,
-    -0.841348,
-    -0.842458,
-    -0.843571,
-    -0.844688,
-    -0.845808,
-    -0.846932,
-    -0.84806,
-    -0.84919,
-    -0.850325,
-    -0.851462,
-    -0.852602,
-    -0.853746,
-    -0.854892,
-    -0.856042,
-    -0.857194,
-    -0.858348,
-    -0.859506,
-    -0.860666,
-    -0.861828,
-    -0.862993,
-    -0.86416,
-    -0.865329,
-    -0.8665,
-    -0.867673,
-    -0.868848,
-    -0.870025,
-    -0.871204,
-    -0.872384,
-    -0.873566,
-    -0.874749,
-    -0.875934,
-    -0.877119,
-    -0.878306,
-    -0.879494,
-    -0.880683,
-    -0.881873,
-    -0.883064,
-    -0.884255,
-    -0.885447,
-    -0.886639,
-    -0.887832,
-    -0.889025,
-    -0.890218,
-    -0.891411,
-    -0.892605,
-    -0.893798,
-    -0.894991,
-    -0.896184,
-    -0.897376,
-    -0.898568,
-    -0.899759,
-    -0.90095,
-    -0.902139,
-    -0.903328,
-    -0.904516,
-    -0.905703,
-    -0.906889,
-    -0.908073,
-    -0.909256,
-    -0.910437,
-    -0.911617,
-    -0.912795,
-    -0.913971,
-    -0.915145,
-    -0.916318,
-    -0.917488,
-    -0.918656,
-    -0.919821,
-    -0.920984,
-    -0.922145,
-    -0.923303,
-    -0.924458,
-    -0.92561,
-    -0.92676,
-    -0.927906,
-    -0.929049,
-    -0.930189,
-    -0.931325,
-    -0.932458,
-    -0.933588,
-    -0.934713,
-    -0.935835,
-    -0.936953,
-    -0.938067,
-    -0.939177,
-    -0.940283,
-    -0.941384,
-    -0.942481,
-    -0.943573,
-    -0.94466,
-    -0.945743,
-    -0.946821,
-    -0.947894,
-    -0.948962,
-    -0.950024,
-    -0.951081,
-    -0.952133,
-    -0.95318,
-    -0.95422,
-    -0.955255,
-    -0.956284,
-    -0.957308,
-    -0.958325,
-    -0.959336,
-    -0.96034,
-    -0.961339,
-    -0.96233,
-    -0.963315,
-    -0.964294,
-    -0.965266,
-    -0.96623,
-    -0.967188,
-    -0.968139,
-    -0.969082,
-    -0.970018,
-    -0.970946,
-    -0.971867,
-    -0.972781,
-    -0.973686,
-    -0.974584,
-    -0.975473,
-    -0.976355,
-    -0.977228,
-    -0.978093,
-    -0.97895,
-    -0.979798,
-    -0.980637,
-    -0.981468,
-    -0.98229,
-    -0.983102,
-    -0.983906,
-    -0.984701,
-    -0.985486,
-    -0.986262,
-    -0.987029,
-    -0.987786,
-    -0.988533,
-    -0.989271,
-    -0.989998,
-    -0.990716,
-    -0.991424,
-    -0.992121,
-    -0.992808,
-    -0.993485,
-    -0.994151,
-    -0.994807,
-    -0.995451,
-    -0.996085,
-    -0.996709,
-    -0.997321,
-    -0.997922,
-    -0.998511,
-    -0.99909,
-    -0.999657,
-    -1.00021,
-    -1.00076,
-    -1.00129,
-    -1.00181,
-    -1.00232,
-    -1.00281,
-    -1.0033,
-    -1.00377,
-    -1.00423,
-    -1.00468,
-    -1.00511,
-    -1.00554,
-    -1.00595,
-    -1.00634,
-    -1.00673,
-    -1.0071,
-    -1.00746,
-    -1.0078,
-    -1.00813,
-    -1.00845,
-    -1.00876,
-    -1.00905,
-    -1.00933,
-    -1.00959,
-    -1.00984,
-    -1.01008,
-    -1.0103,
-    -1.01051,
-    -1.0107,
-    -1.01088,
-    -1.01105,
-    -1.0112,
-    -1.01134,
-    -1.01146,
-    -1.01157,
-    -1.01166,
-    -1.01174,
-    -1.0118,
-    -1.01185,
-    -1.01188,
-    -1.0119,
-    -1.0119,
-    -1.01189,
-    -1.01186,
-    -1.01182,
-    -1.01176,
-    -1.01168,
-    -1.01159,
-    -1.01148,
-    -1.01136,
-    -1.01122,
-    -1.01107,
-    -1.0109,
-    -1.01071,
-    -1.01051,
-    -1.01029,
-    -1.01005,
-    -1.0098,
-    -1.00953,
-    -1.00925,
-    -1.00895,
-    -1.00863,
-    -1.00829,
-    -1.00794,
-    -1.00757,
-    -1.00718,
-    -1.00678,
-    -1.00636,
-    -1.00592,
-    -1.00546,
-    -1.00499,
-    -1.0045,
-    -1.00399,
-    -1.00347,
-    -1.00292,
-    -1.00236,
-    -1.00179,
-    -1.00119,
-    -1.00058,
-    -0.999943,
-    -0.999293,
-    -0.998625,
-    -0.997939,
-    -0.997234,
-    -0.996512,
-    -0.995771,
-    -0.995012,
-    -0.994235,
-    -0.993439,
-    -0.992624,
-    -0.991791,
-    -0.99094,
-    -0.99007,
-    -0.989181,
-    -0.988274,
-    -0.987347,
-    -0.986402,
-    -0.985439,
-    -0.984456,
-    -0.983454,
-    -0.982433,
-    -0.981394,
-    -0.980335,
-    -0.979257,
-    -0.97816,
-    -0.977044,
-    -0.975908,
-    -0.974754,
-    -0.97358,
-    -0.972386,
-    -0.971174,
-    -0.969942,
-    -0.96869,
-    -0.967419,
-    -0.966129,
-    -0.964819,
-    -0.963489,
-    -0.96214,
-    -0.960771,
-    -0.959383,
-    -0.957975,
-    -0.956547,
-    -0.955099,
-    -0.953632,
-    -0.952145,
-    -0.950638,
-    -0.949112,
-    -0.947565,
-    -0.945999,
-    -0.944413,
-    -0.942807,
-    -0.941181,
-    -0.939535,
-    -0.937869,
-    -0.936184,
-    -0.934478,
-    -0.932752,
-    -0.931006,
-    -0.929241,
-    -0.927455,
-    -0.925649,
-    -0.923823,
-    -0.921978,
-    -0.920112,
-    -0.918226,
-    -0.91632,
-    -0.914394,
-    -0.912448,
-    -0.910481,
-    -0.908495,
-    -0.906489,
-    -0.904462,
-    -0.902416,
-    -0.900349,
-    -0.898263,
-    -0.896156,
-    -0.894029,
-    -0.891882,
-    -0.889716,
-    -0.887529,
-    -0.885322,
-    -0.883095,
-    -0.880848,
-    -0.878581,
-    -0.876294,
-    -0.873987,
-    -0.87166,
-    -0.869313,
-    -0.866946,
-    -0.86456,
-    -0.862153,
-    -0.859726,
-    -0.85728,
-    -0.854814,
-    -0.852328,
-    -0.849822,
-    -0.847296,
-    -0.844751,
-    -0.842186,
-    -0.839601,
-    -0.836996,
-    -0.834372,
-    -0.831728,
-    -0.829064,
-    -0.826381,
-    -0.823679,
-    -0.820957,
-    -0.818215,
-    -0.815454,
-    -0.812673,
-    -0.809873,
-    -0.807054,
-    -0.804216,
-    -0.801358,
-    -0.798481,
-    -0.795584,
-    -0.792669,
-    -0.789734,
-    -0.786781,
-    -0.783808,
-    -0.780816,
-    -0.777806,
-    -0.774776,
-    -0.771728,
-    -0.768661,
-    -0.765575,
-    -0.76247,
-    -0.759347,
-    -0.756205,
-    -0.753044,
-    -0.749865,
-    -0.746667,
-    -0.743452,
-    -0.740217,
-    -0.736965,
-    -0.733694,
-    -0.730405,
-    -0.727098,
-    -0.723772,
-    -0.720429,
-    -0.717068,
-    -0.713689,
-    -0.710292,
-    -0.706877,
-    -0.703445,
-    -0.699995,
-    -0.696527,
-    -0.693042,
-    -0.689539,
-    -0.686019,
-    -0.682482,
-    -0.678927,
-    -0.675356,
-    -0.671767,
-    -0.668161,
-    -0.664538,
-    -0.660899,
-    -0.657242,
-    -0.653569,
-    -0.649879,
-    -0.646173,
-    -0.64245,
-    -0.63871,
-    -0.634954,
-    -0.631182,
-    -0.627394,
-    -0.62359,
-    -0.619769,
-    -0.615933,
-    -0.612081,
-    -0.608213,
-    -0.604329,
-    -0.60043,
-    -0.596515,
-    -0.592585,
-    -0.588639,
-    -0.584678,
-    -0.580702,
-    -0.576711,
-    -0.572705,
-    -0.568684,
-    -0.564648,
-    -0.560597,
-    -0.556532,
-    -0.552452,
-    -0.548358,
-    -0.54425,
-    -0.540127,
-    -0.53599,
-    -0.531839,
-    -0.527674,
-    -0.523495,
-    -0.519302,
-    -0.515096,
-    -0.510876,
-    -0.506643,
-    -0.502396,
-    -0.498136,
-    -0.493863,
-    -0.489576,
-    -0.485277,
-    -0.480965,
-    -0.47664,
-    -0.472303,
-    -0.467953,
-    -0.463591,
-    -0.459216,
-    -0.454829,
-    -0.45043,
-    -0.446019,
-    -0.441596,
-    -0.437161,
-    -0.432715,
-    -0.428257,
-    -0.423788,
-    -0.419307,
-    -0.414815,
-    -0.410312,
-    -0.405798,
-    -0.401273,
-    -0.396738,
-    -0.392192,
-    -0.387635,
-    -0.383068,
-    -0.37849,
-    -0.373902,
-    -0.369305,
-    -0.364697,
-    -0.36008,
-    -0.355452,
-    -0.350816,
-    -0.346169,
-    -0.341514,
-    -0.336849,
-    -0.332175,
-    -0.327492,
-    -0.3228,
-    -0.3181,
-    -0.313391,
-    -0.308673,
-    -0.303947,
-    -0.299213,
-    -0.294471,
-    -0.289721,
-    -0.284963,
-    -0.280197,
-    -0.275423,
-    -0.270642,
-    -0.265854,
-    -0.261059,
-    -0.256256,
-    -0.251446,
-    -0.24663,
-    -0.241807,
-    -0.236977,
-    -0.232141,
-    -0.227298,
-    -0.22245,
-    -0.217595,
-    -0.212734,
-    -0.207868,
-    -0.202996,
-    -0.198118,
-    -0.193235,
-    -0.188346,
-    -0.183453,
-    -0.178554,
-    -0.173651,
-    -0.168743,
-    -0.16383,
-    -0.158912,
-    -0.153991,
-    -0.149065,
-    -0.144135,
-    -0.139201,
-    -0.134263,
-    -0.129322,
-    -0.124377,
-    -0.119429,
-    -0.114477,
-    -0.109523,
-    -0.104565,
-    -0.0996042,
-    -0.0946409,
-    -0.089675,
-    -0.0847066,
-    -0.0797359,
-    -0.074763,
-    -0.0697881,
-    -0.0648112,
-    -0.0598326,
-    -0.0548523,
-    -0.0498705,
-    -0.0448874,
-    -0.039903,
-    -0.0349175,
-    -0.0299311,
-    -0.0249438,
-    -0.0199559,
-    -0.0149674,
-    -0.00997848,
-    -0.00498931
-};
-
-// Top frequency: 44.1K * 0.2322
-constexpr static std::array<float, 4096> wt_square_0x9 =
-{
-    0,
-    0.00166311,
-    0.00332622,
-    0.00498932,
-    0.0066524,
-    0.00831547,
-    0.00997853,
-    0.0116416,
-    0.0133046,
-    0.0149675,
-    0.0166305,
-    0.0182934,
-    0.0199562,
-    0.021619,
-    0.0232818,
-    0.0249445,
-    0.0266071,
-    0.0282697,
-    0.0299322,
-    0.0315946,
-    0.033257,
-    0.0349193,
-    0.0365815,
-    0.0382436,
-    0.0399056,
-    0.0415676,
-    0.0432294,
-    0.0448912,
-    0.0465528,
-    0.0482143,
-    0.0498757,
-    0.051537,
-    0.0531982,
-    0.0548592,
-    0.0565201,
-    0.0581809,
-    0.0598416,
-    0.0615021,
-    0.0631624,
-    0.0648227,
-    0.0664827,
-    0.0681426,
-    0.0698024,
-    0.0714619,
-    0.0731213,
-    0.0747806,
-    0.0764396,
-    0.0780985,
-    0.0797572,
-    0.0814157,
-    0.083074,
-    0.0847322,
-    0.0863901,
-    0.0880478,
-    0.0897053,
-    0.0913626,
-    0.0930197,
-    0.0946766,
-    0.0963332,
-    0.0979897,
-    0.0996458,
-    0.101302,
-    0.102958,
-    0.104613,
-    0.106268,
-    0.107923,
-    0.109578,
-    0.111232,
-    0.112887,
-    0.114541,
-    0.116194,
-    0.117848,
-    0.119501,
-    0.121154,
-    0.122806,
-    0.124458,
-    0.12611,
-    0.127762,
-    0.129413,
-    0.131064,
-    0.132715,
-    0.134366,
-    0.136016,
-    0.137666,
-    0.139315,
-    0.140964,
-    0.142613,
-    0.144262,
-    0.14591,
-    0.147558,
-    0.149205,
-    0.150852,
-    0.152499,
-    0.154145,
-    0.155791,
-    0.157437,
-    0.159082,
-    0.160727,
-    0.162372,
-    0.164016,
-    0.16566,
-    0.167303,
-    0.168946,
-    0.170589,
-    0.172231,
-    0.173873,
-    0.175514,
-    0.177155,
-    0.178795,
-    0.180436,
-    0.182075,
-    0.183715,
-    0.185353,
-    0.186992,
-    0.18863,
-    0.190267,
-    0.191904,
-    0.193541,
-    0.195177,
-    0.196813,
-    0.198448,
-    0.200083,
-    0.201717,
-    0.203351,
-    0.204984,
-    0.206617,
-    0.20825,
-    0.209882,
-    0.211513,
-    0.213144,
-    0.214774,
-    0.216404,
-    0.218034,
-    0.219662,
-    0.221291,
-    0.222919,
-    0.224546,
-    0.226173,
-    0.227799,
-    0.229425,
-    0.23105,
-    0.232675,
-    0.234299,
-    0.235922,
-    0.237545,
-    0.239168,
-    0.240789,
-    0.242411,
-    0.244031,
-    0.245652,
-    0.247271,
-    0.24889,
-    0.250509,
-    0.252126,
-    0.253744,
-    0.25536,
-    0.256976,
-    0.258592,
-    0.260206,
-    0.261821,
-    0.263434,
-    0.265047,
-    0.26666,
-    0.268271,
-    0.269882,
-    0.271493,
-    0.273103,
-    0.274712,
-    0.27632,
-    0.277928,
-    0.279535,
-    0.281142,
-    0.282748,
-    0.284353,
-    0.285958,
-    0.287561,
-    0.289165,
-    0.290767,
-    0.292369,
-    0.29397,
-    0.295571,
-    0.29717,
-    0.298769,
-    0.300368,
-    0.301965,
-    0.303562,
-    0.305159,
-    0.306754,
-    0.308349,
-    0.309943,
-    0.311536,
-    0.313129,
-    0.314721,
-    0.316312,
-    0.317902,
-    0.319492,
-    0.321081,
-    0.322669,
-    0.324256,
-    0.325843,
-    0.327429,
-    0.329014,
-    0.330598,
-    0.332182,
-    0.333764,
-    0.335346,
-    0.336928,
-    0.338508,
-    0.340087,
-    0.341666,
-    0.343244,
-    0.344821,
-    0.346398,
-    0.347973,
-    0.349548,
-    0.351122,
-    0.352695,
-    0.354267,
-    0.355839,
-    0.357409,
-    0.358979,
-    0.360548,
-    0.362116,
-    0.363683,
-    0.365249,
-    0.366815,
-    0.368379,
-    0.369943,
-    0.371506,
-    0.373068,
-    0.374629,
-    0.376189,
-    0.377749,
-    0.379307,
-    0.380865,
-    0.382421,
-    0.383977,
-    0.385532,
-    0.387086,
-    0.388639,
-    0.390191,
-    0.391742,
-    0.393292,
-    0.394842,
-    0.39639,
-    0.397938,
-    0.399484,
-    0.40103,
-    0.402575,
-    0.404118,
-    0.405661,
-    0.407203,
-    0.408744,
-    0.410284,
-    0.411823,
-    0.413361,
-    0.414898,
-    0.416434,
-    0.417969,
-    0.419503,
-    0.421036,
-    0.422568,
-    0.424099,
-    0.425629,
-    0.427158,
-    0.428686,
-    0.430213,
-    0.431739,
-    0.433265,
-    0.434789,
-    0.436312,
-    0.437834,
-    0.439354,
-    0.440874,
-    0.442393,
-    0.443911,
-    0.445428,
-    0.446944,
-    0.448458,
-    0.449972,
-    0.451485,
-    0.452996,
-    0.454507,
-    0.456016,
-    0.457524,
-    0.459031,
-    0.460538,
-    0.462043,
-    0.463547,
-    0.46505,
-    0.466551,
-    0.468052,
-    0.469552,
-    0.47105,
-    0.472547,
-    0.474044,
-    0.475539,
-    0.477033,
-    0.478526,
-    0.480018,
-    0.481508,
-    0.482998,
-    0.484486,
-    0.485973,
-    0.48746,
-    0.488945,
-    0.490428,
-    0.491911,
-    0.493392,
-    0.494873,
-    0.496352,
-    0.49783,
-    0.499307,
-    0.500782,
-    0.502257,
-    0.50373,
-    0.505202,
-    0.506673,
-    0.508143,
-    0.509612,
-    0.511079,
-    0.512545,
-    0.51401,
-    0.515474,
-    0.516936,
-    0.518397,
-    0.519857,
-    0.521316,
-    0.522774,
-    0.52423,
-    0.525685,
-    0.527139,
-    0.528592,
-    0.530043,
-    0.531494,
-    0.532943,
-    0.53439,
-    0.535837,
-    0.537282,
-    0.538726,
-    0.540168,
-    0.54161,
-    0.54305,
-    0.544489,
-    0.545926,
-    0.547362,
-    0.548797,
-    0.550231,
-    0.551663,
-    0.553094,
-    0.554524,
-    0.555953,
-    0.55738,
-    0.558806,
-    0.56023,
-    0.561653,
-    0.563075,
-    0.564496,
-    0.565915,
-    0.567333,
-    0.56875,
-    0.570165,
-    0.571579,
-    0.572991,
-    0.574402,
-    0.575812,
-    0.577221,
-    0.578628,
-    0.580034,
-    0.581438,
-    0.582841,
-    0.584243,
-    0.585643,
-    0.587042,
-    0.588439,
-    0.589836,
-    0.59123,
-    0.592624,
-    0.594016,
-    0.595406,
-    0.596795,
-    0.598183,
-    0.59957,
-    0.600955,
-    0.602338,
-    0.60372,
-    0.605101,
-    0.60648,
-    0.607858,
-    0.609234,
-    0.610609,
-    0.611983,
-    0.613355,
-    0.614726,
-    0.616095,
-    0.617463,
-    0.618829,
-    0.620194,
-    0.621557,
-    0.622919,
-    0.62428,
-    0.625639,
-    0.626996,
-    0.628352,
-    0.629707,
-    0.63106,
-    0.632411,
-    0.633762,
-    0.63511,
-    0.636457,
-    0.637803,
-    0.639147,
-    0.64049,
-    0.641831,
-    0.643171,
-    0.644509,
-    0.645845,
-    0.64718,
-    0.648514,
-    0.649846,
-    0.651176,
-    0.652505,
-    0.653833,
-    0.655159,
-    0.656483,
-    0.657806,
-    0.659127,
-    0.660447,
-    0.661765,
-    0.663081,
-    0.664396,
-    0.66571,
-    0.667022,
-    0.668332,
-    0.669641,
-    0.670948,
-    0.672254,
-    0.673558,
-    0.67486,
-    0.676161,
-    0.67746,
-    0.678758,
-    0.680054,
-    0.681348,
-    0.682641,
-    0.683932,
-    0.685222,
-    0.68651,
-    0.687796,
-    0.689081,
-    0.690364,
-    0.691646,
-    0.692926,
-    0.694204,
-    0.695481,
-    0.696756,
-    0.698029,
-    0.699301,
-    0.700571,
-    0.701839,
-    0.703106,
-    0.704371,
-    0.705635,
-    0.706897,
-    0.708157,
-    0.709415,
-    0.710672,
-    0.711927,
-    0.713181,
-    0.714433,
-    0.715683,
-    0.716931,
-    0.718178,
-    0.719423,
-    0.720666,
-    0.721908,
-    0.723148,
-    0.724386,
-    0.725623,
-    0.726858,
-    0.728091,
-    0.729322,
-    0.730552,
-    0.73178,
-    0.733006,
-    0.734231,
-    0.735453,
-    0.736675,
-    0.737894,
-    0.739112,
-    0.740327,
-    0.741542,
-    0.742754,
-    0.743965,
-    0.745173,
-    0.746381,
-    0.747586,
-    0.74879,
-    0.749991,
-    0.751192,
-    0.75239,
-    0.753586,
-    0.754781,
-    0.755974,
-    0.757165,
-    0.758355,
-    0.759543,
-    0.760728,
-    0.761913,
-    0.763095,
-    0.764275,
-    0.765454,
-    0.766631,
-    0.767806,
-    0.768979,
-    0.770151,
-    0.77132,
-    0.772488,
-    0.773654,
-    0.774819,
-    0.775981,
-    0.777142,
-    0.7783,
-    0.779457,
-    0.780612,
-    0.781765,
-    0.782917,
-    0.784066,
-    0.785214,
-    0.78636,
-    0.787504,
-    0.788646,
-    0.789786,
-    0.790925,
-    0.792061,
-    0.793196,
-    0.794329,
-    0.79546,
-    0.796589,
-    0.797716,
-    0.798842,
-    0.799965,
-    0.801087,
-    0.802206,
-    0.803324,
-    0.80444,
-    0.805554,
-    0.806666,
-    0.807777,
-    0.808885,
-    0.809991,
-    0.811096,
-    0.812199,
-    0.813299,
-    0.814398,
-    0.815495,
-    0.81659,
-    0.817683,
-    0.818774,
-    0.819863,
-    0.820951,
-    0.822036,
-    0.823119,
-    0.824201,
-    0.82528,
-    0.826358,
-    0.827434,
-    0.828507,
-    0.829579,
-    0.830649,
-    0.831717,
-    0.832782,
-    0.833846,
-    0.834908,
-    0.835968,
-    0.837026,
-    0.838082,
-    0.839136,
-    0.840189,
-    0.841239,
-    0.842287,
-    0.843333,
-    0.844377,
-    0.845419,
-    0.84646,
-    0.847498,
-    0.848534,
-    0.849568,
-    0.8506,
-    0.851631,
-    0.852659,
-    0.853685,
-    0.854709,
-    0.855732,
-    0.856752,
-    0.85777,
-    0.858786,
-    0.8598,
-    0.860812,
-    0.861822,
-    0.86283,
-    0.863836,
-    0.86484,
-    0.865842,
-    0.866842,
-    0.86784,
-    0.868836,
-    0.86983,
-    0.870821,
-    0.871811,
-    0.872799,
-    0.873784,
-    0.874768,
-    0.875749,
-    0.876729,
-    0.877706,
-    0.878681,
-    0.879655,
-    0.880626,
-    0.881595,
-    0.882562,
-    0.883527,
-    0.88449,
-    0.88545,
-    0.886409,
-    0.887366,
-    0.88832,
-    0.889273,
-    0.890223,
-    0.891171,
-    0.892117,
-    0.893061,
-    0.894003,
-    0.894943,
-    0.895881,
-    0.896816,
-    0.89775,
-    0.898681,
-    0.89961,
-    0.900538,
-    0.901463,
-    0.902386,
-    0.903306,
-    0.904225,
-    0.905142,
-    0.906056,
-    0.906968,
-    0.907878,
-    0.908786,
-    0.909692,
-    0.910596,
-    0.911498,
-    0.912397,
-    0.913294,
-    0.914189,
-    0.915082,
-    0.915973,
-    0.916862,
-    0.917748,
-    0.918633,
-    0.919515,
-    0.920395,
-    0.921273,
-    0.922149,
-    0.923022,
-    0.923894,
-    0.924763,
-    0.92563,
-    0.926495,
-    0.927357,
-    0.928218,
-    0.929076,
-    0.929932,
-    0.930786,
-    0.931638,
-    0.932487,
-    0.933335,
-    0.93418,
-    0.935023,
-    0.935863,
-    0.936702,
-    0.937538,
-    0.938372,
-    0.939204,
-    0.940034,
-    0.940862,
-    0.941687,
-    0.94251,
-    0.943331,
-    0.944149,
-    0.944966,
-    0.94578,
-    0.946592,
-    0.947402,
-    0.948209,
-    0.949015,
-    0.949818,
-    0.950618,
-    0.951417,
-    0.952213,
-    0.953007,
-    0.953799,
-    0.954589,
-    0.955376,
-    0.956161,
-    0.956944,
-    0.957725,
-    0.958503,
-    0.959279,
-    0.960053,
-    0.960825,
-    0.961594,
-    0.962361,
-    0.963126,
-    0.963888,
-    0.964649,
-    0.965407,
-    0.966162,
-    0.966916,
-    0.967667,
-    0.968416,
-    0.969162,
-    0.969907,
-    0.970649,
-    0.971389,
-    0.972126,
-    0.972861,
-    0.973594,
-    0.974325,
-    0.975053,
-    0.975779,
-    0.976503,
-    0.977224,
-    0.977943,
-    0.97866,
-    0.979375,
-    0.980087,
-    0.980797,
-    0.981505,
-    0.98221,
-    0.982913,
-    0.983613,
-    0.984312,
-    0.985008,
-    0.985702,
-    0.986393,
-    0.987082,
-    0.987769,
-    0.988453,
-    0.989135,
-    0.989815,
-    0.990493,
-    0.991168,
-    0.991841,
-    0.992511,
-    0.993179,
-    0.993845,
-    0.994508,
-    0.99517,
-    0.995828,
-    0.996485,
-    0.997139,
-    0.997791,
-    0.99844,
-    0.999087,
-    0.999732,
-    1.00037,
-    1.00101,
-    1.00165,
-    1.00229,
-    1.00292,
-    1.00355,
-    1.00418,
-    1.0048,
-    1.00543,
-    1.00605,
-    1.00667,
-    1.00728,
-    1.0079,
-    1.00851,
-    1.00912,
-    1.00973,
-    1.01033,
-    1.01093,
-    1.01153,
-    1.01213,
-    1.01272,
-    1.01332,
-    1.01391,
-    1.0145,
-    1.01508,
-    1.01566,
-    1.01624,
-    1.01682,
-    1.0174,
-    1.01797,
-    1.01854,
-    1.01911,
-    1.01968,
-    1.02024,
-    1.0208,
-    1.02136,
-    1.02192,
-    1.02247,
-    1.02303,
-    1.02357,
-    1.02412,
-    1.02467,
-    1.02521,
-    1.02575,
-    1.02629,
-    1.02682,
-    1.02735,
-    1.02788,
-    1.02841,
-    1.02894,
-    1.02946,
-    1.02998,
-    1.0305,
-    1.03101,
-    1.03153,
-    1.03204,
-    1.03255,
-    1.03305,
-    1.03356,
-    1.03406,
-    1.03455,
-    1.03505,
-    1.03554,
-    1.03604,
-    1.03653,
-    1.03701,
-    1.0375,
-    1.03798,
-    1.03846,
-    1.03893,
-    1.03941,
-    1.03988,
-    1.04035,
-    1.04081,
-    1.04128,
-    1.04174,
-    1.0422,
-    1.04266,
-    1.04311,
-    1.04356,
-    1.04401,
-    1.04446,
-    1.04491,
-    1.04535,
-    1.04579,
-    1.04623,
-    1.04666,
-    1.04709,
-    1.04752,
-    1.04795,
-    1.04838,
-    1.0488,
-    1.04922,
-    1.04964,
-    1.05005,
-    1.05046,
-    1.05088,
-    1.05128,
-    1.05169,
-    1.05209,
-    1.05249,
-    1.05289,
-    1.05329,
-    1.05368,
-    1.05407,
-    1.05446,
-    1.05484,
-    1.05522,
-    1.05561,
-    1.05598,
-    1.05636,
-    1.05673,
-    1.0571,
-    1.05747,
-    1.05784,
-    1.0582,
-    1.05856,
-    1.05892,
-    1.05927,
-    1.05963,
-    1.05998,
-    1.06033,
-    1.06067,
-    1.06102,
-    1.06136,
-    1.06169,
-    1.06203,
-    1.06236,
-    1.06269,
-    1.06302,
-    1.06335,
-    1.06367,
-    1.06399,
-    1.06431,
-    1.06463,
-    1.06494,
-    1.06525,
-    1.06556,
-    1.06586,
-    1.06617,
-    1.06647,
-    1.06677,
-    1.06706,
-    1.06735,
-    1.06764,
-    1.06793,
-    1.06822,
-    1.0685,
-    1.06878,
-    1.06906,
-    1.06934,
-    1.06961,
-    1.06988,
-    1.07015,
-    1.07041,
-    1.07068,
-    1.07094,
-    1.07119,
-    1.07145,
-    1.0717,
-    1.07195,
-    1.0722,
-    1.07245,
-    1.07269,
-    1.07293,
-    1.07317,
-    1.0734,
-    1.07363,
-    1.07386,
-    1.07409,
-    1.07432,
-    1.07454,
-    1.07476,
-    1.07498,
-    1.07519,
-    1.0754,
-    1.07561,
-    1.07582,
-    1.07603,
-    1.07623,
-    1.07643,
-    1.07663,
-    1.07682,
-    1.07701,
-    1.0772,
-    1.07739,
-    1.07757,
-    1.07776,
-    1.07794,
-    1.07811,
-    1.07829,
-    1.07846,
-    1.07863,
-    1.07879,
-    1.07896,
-    1.07912,
-    1.07928,
-    1.07944,
-    1.07959,
-    1.07974,
-    1.07989,
-    1.08004,
-    1.08018,
-    1.08032,
-    1.08046,
-    1.0806,
-    1.08073,
-    1.08086,
-    1.08099,
-    1.08112,
-    1.08124,
-    1.08136,
-    1.08148,
-    1.0816,
-    1.08171,
-    1.08182,
-    1.08193,
-    1.08204,
-    1.08214,
-    1.08224,
-    1.08234,
-    1.08243,
-    1.08253,
-    1.08262,
-    1.08271,
-    1.08279,
-    1.08287,
-    1.08295,
-    1.08303,
-    1.08311,
-    1.08318,
-    1.08325,
-    1.08332,
-    1.08338,
-    1.08345,
-    1.08351,
-    1.08356,
-    1.08362,
-    1.08367,
-    1.08372,
-    1.08377,
-    1.08381,
-    1.08385,
-    1.08389,
-    1.08393,
-    1.08396,
-    1.084,
-    1.08403,
-    1.08405,
-    1.08408,
-    1.0841,
-    1.08412,
-    1.08413,
-    1.08415,
-    1.08416,
-    1.08417,
-    1.08417,
-    1.08418,
-    1.08418,
-    1.08418,
-    1.08417,
-    1.08417,
-    1.08416,
-    1.08415,
-    1.08413,
-    1.08412,
-    1.0841,
-    1.08408,
-    1.08405,
-    1.08403,
-    1.084,
-    1.08396,
-    1.08393,
-    1.08389,
-    1.08385,
-    1.08381,
-    1.08377,
-    1.08372,
-    1.08367,
-    1.08362,
-    1.08356,
-    1.08351,
-    1.08345,
-    1.08338,
-    1.08332,
-    1.08325,
-    1.08318,
-    1.08311,
-    1.08303,
-    1.08295,
-    1.08287,
-    1.08279,
-    1.08271,
-    1.08262,
-    1.08253,
-    1.08243,
-    1.08234,
-    1.08224,
-    1.08214,
-    1.08204,
-    1.08193,
-    1.08182,
-    1.08171,
-    1.0816,
-    1.08148,
-    1.08136,
-    1.08124,
-    1.08112,
-    1.08099,
-    1.08086,
-    1.08073,
-    1.0806,
-    1.08046,
-    1.08032,
-    1.08018,
-    1.08004,
-    1.07989,
-    1.07974,
-    1.07959,
-    1.07944,
-    1.07928,
-    1.07912,
-    1.07896,
-    1.07879,
-    1.07863,
-    1.07846,
-    1.07829,
-    1.07811,
-    1.07794,
-    1.07776,
-    1.07757,
-    1.07739,
-    1.0772,
-    1.07701,
-    1.07682,
-    1.07663,
-    1.07643,
-    1.07623,
-    1.07603,
-    1.07582,
-    1.07561,
-    1.0754,
-    1.07519,
-    1.07498,
-    1.07476,
-    1.07454,
-    1.07432,
-    1.07409,
-    1.07386,
-    1.07363,
-    1.0734,
-    1.07317,
-    1.07293,
-    1.07269,
-    1.07245,
-    1.0722,
-    1.07195,
-    1.0717,
-    1.07145,
-    1.07119,
-    1.07094,
-    1.07068,
-    1.07041,
-    1.07015,
-    1.06988,
-    1.06961,
-    1.06934,
-    1.06906,
-    1.06878,
-    1.0685,
-    1.06822,
-    1.06793,
-    1.06764,
-    1.06735,
-    1.06706,
-    1.06677,
-    1.06647,
-    1.06617,
-    1.06586,
-    1.06556,
-    1.06525,
-    1.06494,
-    1.06463,
-    1.06431,
-    1.06399,
-    1.06367,
-    1.06335,
-    1.06302,
-    1.06269,
-    1.06236,
-    1.06203,
-    1.06169,
-    1.06136,
-    1.06102,
-    1.06067,
-    1.06033,
-    1.05998,
-    1.05963,
-    1.05927,
-    1.05892,
-    1.05856,
-    1.0582,
-    1.05784,
-    1.05747,
-    1.0571,
-    1.05673,
-    1.05636,
-    1.05598,
-    1.05561,
-    1.05522,
-    1.05484,
-    1.05446,
-    1.05407,
-    1.05368,
-    1.05329,
-    1.05289,
-    1.05249,
-    1.05209,
-    1.05169,
-    1.05128,
-    1.05088,
-    1.05046,
-    1.05005,
-    1.04964,
-    1.04922,
-    1.0488,
-    1.04838,
-    1.04795,
-    1.04752,
-    1.04709,
-    1.04666,
-    1.04623,
-    1.04579,
-    1.04535,
-    1.04491,
-    1.04446,
-    1.04401,
-    1.04356,
-    1.04311,
-    1.04266,
-    1.0422,
-    1.04174,
-    1.04128,
-    1.04081,
-    1.04035,
-    1.03988,
-    1.03941,
-    1.03893,
-    1.03846,
-    1.03798,
-    1.0375,
-    1.03701,
-    1.03653,
-    1.03604,
-    1.03554,
-    1.03505,
-    1.03455,
-    1.03406,
-    1.03356,
-    1.03305,
-    1.03255,
-    1.03204,
-    1.03153,
-    1.03101,
-    1.0305,
-    1.02998,
-    1.02946,
-    1.02894,
-    1.02841,
-    1.02788,
-    1.02735,
-    1.02682,
-    1.02629,
-    1.02575,
-    1.02521,
-    1.02467,
-    1.02412,
-    1.02357,
-    1.02303,
-    1.02247,
-    1.02192,
-    1.02136,
-    1.0208,
-    1.02024,
-    1.01968,
-    1.01911,
-    1.01854,
-    1.01797,
-    1.0174,
-    1.01682,
-    1.01624,
-    1.01566,
-    1.01508,
-    1.0145,
-    1.01391,
-    1.01332,
-    1.01272,
-    1.01213,
-    1.01153,
-    1.01093,
-    1.01033,
-    1.00973,
-    1.00912,
-    1.00851,
-    1.0079,
-    1.00728,
-    1.00667,
-    1.00605,
-    1.00543,
-    1.0048,
-    1.00418,
-    1.00355,
-    1.00292,
-    1.00229,
-    1.00165,
-    1.00101,
-    1.00037,
-    0.999732,
-    0.999087,
-    0.99844,
-    0.997791,
-    0.997139,
-    0.996485,
-    0.995828,
-    0.99517,
-    0.994508,
-    0.993845,
-    0.993179,
-    0.992511,
-    0.991841,
-    0.991168,
-    0.990493,
-    0.989815,
-    0.989135,
-    0.988453,
-    0.987769,
-    0.987082,
-    0.986393,
-    0.985702,
-    0.985008,
-    0.984312,
-    0.983613,
-    0.982913,
-    0.98221,
-    0.981505,
-    0.980797,
-    0.980087,
-    0.979375,
-    0.97866,
-    0.977943,
-    0.977224,
-    0.976503,
-    0.975779,
-    0.975053,
-    0.974325,
-    0.973594,
-    0.972861,
-    0.972126,
-    0.971389,
-    0.970649,
-    0.969907,
-    0.969162,
-    0.968416,
-    0.967667,
-    0.966916,
-    0.966162,
-    0.965407,
-    0.964649,
-    0.963888,
-    0.963126,
-    0.962361,
-    0.961594,
-    0.960825,
-    0.960053,
-    0.959279,
-    0.958503,
-    0.957725,
-    0.956944,
-    0.956161,
-    0.955376,
-    0.954589,
-    0.953799,
-    0.953007,
-    0.952213,
-    0.951417,
-    0.950618,
-    0.949818,
-    0.949015,
-    0.948209,
-    0.947402,
-    0.946592,
-    0.94578,
-    0.944966,
-    0.944149,
-    0.943331,
-    0.94251,
-    0.941687,
-    0.940862,
-    0.940034,
-    0.939204,
-    0.938372,
-    0.937538,
-    0.936702,
-    0.935863,
-    0.935023,
-    0.93418,
-    0.933335,
-    0.932487,
-    0.931638,
-    0.930786,
-    0.929932,
-    0.929076,
-    0.928218,
-    0.927357,
-    0.926495,
-    0.92563,
-    0.924763,
-    0.923894,
-    0.923022,
-    0.922149,
-    0.921273,
-    0.920395,
-    0.919515,
-    0.918633,
-    0.917748,
-    0.916862,
-    0.915973,
-    0.915082,
-    0.914189,
-    0.913294,
-    0.912397,
-    0.911498,
-    0.910596,
-    0.909692,
-    0.908786,
-    0.907878,
-    0.906968,
-    0.906056,
-    0.905142,
-    0.904225,
-    0.903306,
-    0.902386,
-    0.901463,
-    0.900538,
-    0.89961,
-    0.898681,
-    0.89775,
-    0.896816,
-    0.895881,
-    0.894943,
-    0.894003,
-    0.893061,
-    0.892117,
-    0.891171,
-    0.890223,
-    0.889273,
-    0.88832,
-    0.887366,
-    0.886409,
-    0.88545,
-    0.88449,
-    0.883527,
-    0.882562,
-    0.881595,
-    0.880626,
-    0.879655,
-    0.878681,
-    0.877706,
-    0.876729,
-    0.875749,
-    0.874768,
-    0.873784,
-    0.872799,
-    0.871811,
-    0.870821,
-    0.86983,
-    0.868836,
-    0.86784,
-    0.866842,
-    0.865842,
-    0.86484,
-    0.863836,
-    0.86283,
-    0.861822,
-    0.860812,
-    0.8598,
-    0.858786,
-    0.85777,
-    0.856752,
-    0.855732,
-    0.854709,
-    0.853685,
-    0.852659,
-    0.851631,
-    0.8506,
-    0.849568,
-    0.848534,
-    0.847498,
-    0.84646,
-    0.845419,
-    0.844377,
-    0.843333,
-    0.842287,
-    0.841239,
-    0.840189,
-    0.839136,
-    0.838082,
-    0.837026,
-    0.835968,
-    0.834908,
-    0.833846,
-    0.832782,
-    0.831717,
-    0.830649,
-    0.829579,
-    0.828507,
-    0.827434,
-    0.826358,
-    0.82528,
-    0.824201,
-    0.823119,
-    0.822036,
-    0.820951,
-    0.819863,
-    0.818774,
-    0.817683,
-    0.81659,
-    0.815495,
-    0.814398,
-    0.813299,
-    0.812199,
-    0.811096,
-    0.809991,
-    0.808885,
-    0.807777,
-    0.806666,
-    0.805554,
-    0.80444,
-    0.803324,
-    0.802206,
-    0.801087,
-    0.799965,
-    0.798842,
-    0.797716,
-    0.796589,
-    0.79546,
-    0.794329,
-    0.793196,
-    0.792061,
-    0.790925,
-    0.789786,
-    0.788646,
-    0.787504,
-    0.78636,
-    0.785214,
-    0.784066,
-    0.782917,
-    0.781765,
-    0.780612,
-    0.779457,
-    0.7783,
-    0.777142,
-    0.775981,
-    0.774819,
-    0.773654,
-    0.772488,
-    0.77132,
-    0.770151,
-    0.768979,
-    0.767806,
-    0.766631,
-    0.765454,
-    0.764275,
-    0.763095,
-    0.761913,
-    0.760728,
-    0.759543,
-    0.758355,
-    0.757165,
-    0.755974,
-    0.754781,
-    0.753586,
-    0.75239,
-    0.751192,
-    0.749991,
-    0.74879,
-    0.747586,
-    0.746381,
-    0.745173,
-    0.743965,
-    0.742754,
-    0.741542,
-    0.740327,
-    0.739112,
-    0.737894,
-    0.736675,
-    0.735453,
-    0.734231,
-    0.733006,
-    0.73178,
-    0.730552,
-    0.729322,
-    0.728091,
-    0.726858,
-    0.725623,
-    0.724386,
-    0.723148,
-    0.721908,
-    0.720666,
-    0.719423,
-    0.718178,
-    0.716931,
-    0.715683,
-    0.714433,
-    0.713181,
-    0.711927,
-    0.710672,
-    0.709415,
-    0.708157,
-    0.706897,
-    0.705635,
-    0.704371,
-    0.703106,
-    0.701839,
-    0.700571,
-    0.699301,
-    0.698029,
-    0.696756,
-    0.695481,
-    0.694204,
-    0.692926,
-    0.691646,
-    0.690364,
-    0.689081,
-    0.687796,
-    0.68651,
-    0.685222,
-    0.683932,
-    0.682641,
-    0.681348,
-    0.680054,
-    0.678758,
-    0.67746,
-    0.676161,
-    0.67486,
-    0.673558,
-    0.672254,
-    0.670948,
-    0.669641,
-    0.668332,
-    0.667022,
-    0.66571,
-    0.664396,
-    0.663081,
-    0.661765,
-    0.660447,
-    0.659127,
-    0.657806,
-    0.656483,
-    0.655159,
-    0.653833,
-    0.652505,
-    0.651176,
-    0.649846,
-    0.648514,
-    0.64718,
-    0.645845,
-    0.644509,
-    0.643171,
-    0.641831,
-    0.64049,
-    0.639147,
-    0.637803,
-    0.636457,
-    0.63511,
-    0.633762,
-    0.632411,
-    0.63106,
-    0.629707,
-    0.628352,
-    0.626996,
-    0.625639,
-    0.62428,
-    0.622919,
-    0.621557,
-    0.620194,
-    0.618829,
-    0.617463,
-    0.616095,
-    0.614726,
-    0.613355,
-    0.611983,
-    0.610609,
-    0.609234,
-    0.607858,
-    0.60648,
-    0.605101,
-    0.60372,
-    0.602338,
-    0.600955,
-    0.59957,
-    0.598183,
-    0.596795,
-    0.595406,
-    0.594016,
-    0.592624,
-    0.59123,
-    0.589836,
-    0.588439,
-    0.587042,
-    0.585643,
-    0.584243,
-    0.582841,
-    0.581438,
-    0.580034,
-    0.578628,
-    0.577221,
-    0.575812,
-    0.574402,
-    0.572991,
-    0.571579,
-    0.570165,
-    0.56875,
-    0.567333,
-    0.565915,
-    0.564496,
-    0.563075,
-    0.561653,
-    0.56023,
-    0.558806,
-    0.55738,
-    0.555953,
-    0.554524,
-    0.553094,
-    0.551663,
-    0.550231,
-    0.548797,
-    0.547362,
-    0.545926,
-    0.544489,
-    0.54305,
-    0.54161,
-    0.540168,
-    0.538726,
-    0.537282,
-    0.535837,
-    0.53439,
-    0.532943,
-    0.531494,
-    0.530043,
-    0.528592,
-    0.527139,
-    0.525685,
-    0.52423,
-    0.522774,
-    0.521316,
-    0.519857,
-    0.518397,
-    0.516936,
-    0.515474,
-    0.51401,
-    0.512545,
-    0.511079,
-    0.509612,
-    0.508143,
-    0.506673,
-    0.505202,
-    0.50373,
-    0.502257,
-    0.500782,
-    0.499307,
-    0.49783,
-    0.496352,
-    0.494873,
-    0.493392,
-    0.491911,
-    0.490428,
-    0.488945,
-    0.48746,
-    0.485973,
-    0.484486,
-    0.482998,
-    0.481508,
-    0.480018,
-    0.478526,
-    0.477033,
-    0.475539,
-    0.474044,
-    0.472547,
-    0.47105,
-    0.469552,
-    0.468052,
-    0.466551,
-    0.46505,
-    0.463547,
-    0.462043,
-    0.460538,
-    0.459031,
-    0.457524,
-    0.456016,
-    0.454507,
-    0.452996,
-    0.451485,
-    0.449972,
-    0.448458,
-    0.446944,
-    0.445428,
-    0.443911,
-    0.442393,
-    0.440874,
-    0.439354,
-    0.437834,
-    0.436312,
-    0.434789,
-    0.433265,
-    0.431739,
-    0.430213,
-    0.428686,
-    0.427158,
-    0.425629,
-    0.424099,
-    0.422568,
-    0.421036,
-    0.419503,
-    0.417969,
-    0.416434,
-    0.414898,
-    0.413361,
-    0.411823,
-    0.410284,
-    0.408744,
-    0.407203,
-    0.405661,
-    0.404118,
-    0.402575,
-    0.40103,
-    0.399484,
-    0.397938,
-    0.39639,
-    0.394842,
-    0.393292,
-    0.391742,
-    0.390191,
-    0.388639,
-    0.387086,
-    0.385532,
-    0.383977,
-    0.382421,
-    0.380865,
-    0.379307,
-    0.377749,
-    0.376189,
-    0.374629,
-    0.373068,
-    0.371506,
-    0.369943,
-    0.368379,
-    0.366815,
-    0.365249,
-    0.363683,
-    0.362116,
-    0.360548,
-    0.358979,
-    0.357409,
-    0.355839,
-    0.354267,
-    0.352695,
-    0.351122,
-    0.349548,
-    0.347973,
-    0.346398,
-    0.344821,
-    0.343244,
-    0.341666,
-    0.340087,
-    0.338508,
-    0.336928,
-    0.335346,
-    0.333764,
-    0.332182,
-    0.330598,
-    0.329014,
-    0.327429,
-    0.325843,
-    0.324256,
-    0.322669,
-    0.321081,
-    0.319492,
-    0.317902,
-    0.316312,
-    0.314721,
-    0.313129,
-    0.311536,
-    0.309943,
-    0.308349,
-    0.306754,
-    0.305159,
-    0.303562,
-    0.301965,
-    0.300368,
-    0.298769,
-    0.29717,
-    0.295571,
-    0.29397,
-    0.292369,
-    0.290767,
-    0.289165,
-    0.287561,
-    0.285958,
-    0.284353,
-    0.282748,
-    0.281142,
-    0.279535,
-    0.277928,
-    0.27632,
-    0.274712,
-    0.273103,
-    0.271493,
-    0.269882,
-    0.268271,
-    0.26666,
-    0.265047,
-    0.263434,
-    0.261821,
-    0.260206,
-    0.258592,
-    0.256976,
-    0.25536,
-    0.253744,
-    0.252126,
-    0.250509,
-    0.24889,
-    0.247271,
-    0.245652,
-    0.244031,
-    0.242411,
-    0.240789,
-    0.239168,
-    0.237545,
-    0.235922,
-    0.234299,
-    0.232675,
-    0.23105,
-    0.229425,
-    0.227799,
-    0.226173,
-    0.224546,
-    0.222919,
-    0.221291,
-    0.219662,
-    0.218034,
-    0.216404,
-    0.214774,
-    0.213144,
-    0.211513,
-    0.209882,
-    0.20825,
-    0.206617,
-    0.204984,
-    0.203351,
-    0.201717,
-    0.200083,
-    0.198448,
-    0.196813,
-    0.195177,
-    0.193541,
-    0.191904,
-    0.190267,
-    0.18863,
-    0.186992,
-    0.185353,
-    0.183715,
-    0.182075,
-    0.180436,
-    0.178795,
-    0.177155,
-    0.175514,
-    0.173873,
-    0.172231,
-    0.170589,
-    0.168946,
-    0.167303,
-    0.16566,
-    0.164016,
-    0.162372,
-    0.160727,
-    0.159082,
-    0.157437,
-    0.155791,
-    0.154145,
-    0.152499,
-    0.150852,
-    0.149205,
-    0.147558,
-    0.14591,
-    0.144262,
-    0.142613,
-    0.140964,
-    0.139315,
-    0.137666,
-    0.136016,
-    0.134366,
-    0.132715,
-    0.131064,
-    0.129413,
-    0.127762,
-    0.12611,
-    0.124458,
-    0.122806,
-    0.121154,
-    0.119501,
-    0.117848,
-    0.116194,
-    0.114541,
-    0.112887,
-    0.111232,
-    0.109578,
-    0.107923,
-    0.106268,
-    0.104613,
-    0.102958,
-    0.101302,
-    0.0996458,
-    0.0979897,
-    0.0963332,
-    0.0946766,
-    0.0930197,
-    0.0913626,
-    0.0897053,
-    0.0880478,
-    0.0863901,
-    0.0847322,
-    0.083074,
-    0.0814157,
-    0.0797572,
-    0.0780985,
-    0.0764396,
-    0.0747806,
-    0.0731213,
-    0.0714619,
-    0.0698024,
-    0.0681426,
-    0.0664827,
-    0.0648227,
-    0.0631624,
-    0.0615021,
-    0.0598416,
-    0.0581809,
-    0.0565201,
-    0.0548592,
-    0.0531982,
-    0.051537,
-    0.0498757,
-    0.0482143,
-    0.0465528,
-    0.0448912,
-    0.0432294,
-    0.0415676,
-    0.0399056,
-    0.0382436,
-    0.0365815,
-    0.0349193,
-    0.033257,
-    0.0315946,
-    0.0299322,
-    0.0282697,
-    0.0266071,
-    0.0249445,
-    0.0232818,
-    0.021619,
-    0.0199562,
-    0.0182934,
-    0.0166305,
-    0.0149675,
-    0.0133046,
-    0.0116416,
-    0.00997853,
-    0.00831547,
-    0.0066524,
-    0.00498932,
-    0.00332622,
-    0.00166311,
-    0,
-    -0.00166311,
-    -0.00332622,
-    -0.00498932,
-    -0.0066524,
-    -0.00831547,
-    -0.00997853,
-    -0.0116416,
-    -0.0133046,
-    -0.0149675,
-    -0.0166305,
-    -0.0182934,
-    -0.0199562,
-    -0.021619,
-    -0.0232818,
-    -0.0249445,
-    -0.0266071,
-    -0.0282697,
-    -0.0299322,
-    -0.0315946,
-    -0.033257,
-    -0.0349193,
-    -0.0365815,
-    -0.0382436,
-    -0.0399056,
-    -0.0415676,
-    -0.0432294,
-    -0.0448912,
-    -0.0465528,
-    -0.0482143,
-    -0.0498757,
-    -0.051537,
-    -0.0531982,
-    -0.0548592,
-    -0.0565201,
-    -0.0581809,
-    -0.0598416,
-    -0.0615021,
-    -0.0631624,
-    -0.0648227,
-    -0.0664827,
-    -0.0681426,
-    -0.0698024,
-    -0.0714619,
-    -0.0731213,
-    -0.0747806,
-    -0.0764396,
-    -0.0780985,
-    -0.0797572,
-    -0.0814157,
-    -0.083074,
-    -0.0847322,
-    -0.0863901,
-    -0.0880478,
-    -0.0897053,
-    -0.0913626,
-    -0.0930197,
-    -0.0946766,
-    -0.0963332,
-    -0.0979897,
-    -0.0996458,
-    -0.101302,
-    -0.102958,
-    -0.104613,
-    -0.106268,
-    -0.107923,
-    -0.109578,
-    -0.111232,
-    -0.112887,
-    -0.114541,
-    -0.116194,
-    -0.117848,
-    -0.119501,
-    -0.121154,
-    -0.122806,
-    -0.124458,
-    -0.12611,
-    -0.127762,
-    -0.129413,
-    -0.131064,
-    -0.132715,
-    -0.134366,
-    -0.136016,
-    -0.137666,
-    -0.139315,
-    -0.140964,
-    -0.142613,
-    -0.144262,
-    -0.14591,
-    -0.147558,
-    -0.149205,
-    -0.150852,
-    -0.152499,
-    -0.154145,
-    -0.155791,
-    -0.157437,
-    -0.159082,
-    -0.160727,
-    -0.162372,
-    -0.164016,
-    -0.16566,
-    -0.167303,
-    -0.168946,
-    -0.170589,
-    -0.172231,
-    -0.173873,
-    -0.175514,
-    -0.177155,
-    -0.178795,
-    -0.180436,
-    -0.182075,
-    -0.183715,
-    -0.185353,
-    -0.186992,
-    -0.18863,
-    -0.190267,
-    -0.191904,
-    -0.193541,
-    -0.195177,
-    -0.196813,
-    -0.198448,
-    -0.200083,
-    -0.201717,
-    -0.203351,
-    -0.204984,
-    -0.206617,
-    -0.20825,
-    -0.209882,
-    -0.211513,
-    -0.213144,
-    -0.214774,
-    -0.216404,
-    -0.218034,
-    -0.219662,
-    -0.221291,
-    -0.222919,
-    -0.224546,
-    -0.226173,
-    -0.227799,
-    -0.229425,
-    -0.23105,
-    -0.232675,
-    -0.234299,
-    -0.235922,
-    -0.237545,
-    -0.239168,
-    -0.240789,
-    -0.242411,
-    -0.244031,
-    -0.245652,
-    -0.247271,
-    -0.24889,
-    -0.250509,
-    -0.252126,
-    -0.253744,
-    -0.25536,
-    -0.256976,
-    -0.258592,
-    -0.260206,
-    -0.261821,
-    -0.263434,
-    -0.265047,
-    -0.26666,
-    -0.268271,
-    -0.269882,
-    -0.271493,
-    -0.273103,
-    -0.274712,
-    -0.27632,
-    -0.277928,
-    -0.279535,
-    -0.281142,
-    -0.282748,
-    -0.284353,
-    -0.285958,
-    -0.287561,
-    -0.289165,
-    -0.290767,
-    -0.292369,
-    -0.29397,
-    -0.295571,
-    -0.29717,
-    -0.298769,
-    -0.300368,
-    -0.301965,
-    -0.303562,
-    -0.305159,
-    -0.306754,
-    -0.308349,
-    -0.309943,
-    -0.311536,
-    -0.313129,
-    -0.314721,
-    -0.316312,
-    -0.317902,
-    -0.319492,
-    -0.321081,
-    -0.322669,
-    -0.324256,
-    -0.325843,
-    -0.327429,
-    -0.329014,
-    -0.330598,
-    -0.332182,
-    -0.333764,
-    -0.335346,
-    -0.336928,
-    -0.338508,
-    -0.340087,
-    -0.341666,
-    -0.343244,
-    -0.344821,
-    -0.346398,
-    -0.347973,
-    -0.349548,
-    -0.351122,
-    -0.352695,
-    -0.354267,
-    -0.355839,
-    -0.357409,
-    -0.358979,
-    -0.360548,
-    -0.362116,
-    -0.363683,
-    -0.365249,
-    -0.366815,
-    -0.368379,
-    -0.369943,
-    -0.371506,
-    -0.373068,
-    -0.374629,
-    -0.376189,
-    -0.377749,
-    -0.379307,
-    -0.380865,
-    -0.382421,
-    -0.383977,
-    -0.385532,
-    -0.387086,
-    -0.388639,
-    -0.390191,
-    -0.391742,
-    -0.393292,
-    -0.394842,
-    -0.39639,
-    -0.397938,
-    -0.399484,
-    -0.40103,
-    -0.402575,
-    -0.404118,
-    -0.405661,
-    -0.407203,
-    -0.408744,
-    -0.410284,
-    -0.411823,
-    -0.413361,
-    -0.414898,
-    -0.416434,
-    -0.417969,
-    -0.419503,
-    -0.421036,
-    -0.422568,
-    -0.424099,
-    -0.425629,
-    -0.427158,
-    -0.428686,
-    -0.430213,
-    -0.431739,
-    -0.433265,
-    -0.434789,
-    -0.436312,
-    -0.437834,
-    -0.439354,
-    -0.440874,
-    -0.442393,
-    -0.443911,
-    -0.445428,
-    -0.446944,
-    -0.448458,
-    -0.449972,
-    -0.451485,
-    -0.452996,
-    -0.454507,
-    -0.456016,
-    -0.457524,
-    -0.459031,
-    -0.460538,
-    -0.462043,
-    -0.463547,
-    -0.46505,
-    -0.466551,
-    -0.468052,
-    -0.469552,
-    -0.47105,
-    -0.472547,
-    -0.474044,
-    -0.475539,
-    -0.477033,
-    -0.478526,
-    -0.480018,
-    -0.481508,
-    -0.482998,
-    -0.484486,
-    -0.485973,
-    -0.48746,
-    -0.488945,
-    -0.490428,
-    -0.491911,
-    -0.493392,
-    -0.494873,
-    -0.496352,
-    -0.49783,
-    -0.499307,
-    -0.500782,
-    -0.502257,
-    -0.50373,
-    -0.505202,
-    -0.506673,
-    -0.508143,
-    -0.509612,
-    -0.511079,
-    -0.512545,
-    -0.51401,
-    -0.515474,
-    -0.516936,
-    -0.518397,
-    -0.519857,
-    -0.521316,
-    -0.522774,
-    -0.52423,
-    -0.525685,
-    -0.527139,
-    -0.528592,
-    -0.530043,
-    -0.531494,
-    -0.532943,
-    -0.53439,
-    -0.535837,
-    -0.537282,
-    -0.538726,
-    -0.540168,
-    -0.54161,
-    -0.54305,
-    -0.544489,
-    -0.545926,
-    -0.547362,
-    -0.548797,
-    -0.550231,
-    -0.551663,
-    -0.553094,
-    -0.554524,
-    -0.555953,
-    -0.55738,
-    -0.558806,
-    -0.56023,
-    -0.561653,
-    -0.563075,
-    -0.564496,
-    -0.565915,
-    -0.567333,
-    -0.56875,
-    -0.570165,
-    -0.571579,
-    -0.572991,
-    -0.574402,
-    -0.575812,
-    -0.577221,
-    -0.578628,
-    -0.580034,
-    -0.581438,
-    -0.582841,
-    -0.584243,
-    -0.585643,
-    -0.587042,
-    -0.588439,
-    -0.589836,
-    -0.59123,
-    -0.592624,
-    -0.594016,
-    -0.595406,
-    -0.596795,
-    -0.598183,
-    -0.59957,
-    -0.600955,
-    -0.602338,
-    -0.60372,
-    -0.605101,
-    -0.60648,
-    -0.607858,
-    -0.609234,
-    -0.610609,
-    -0.611983,
-    -0.613355,
-    -0.614726,
-    -0.616095,
-    -0.617463,
-    -0.618829,
-    -0.620194,
-    -0.621557,
-    -0.622919,
-    -0.62428,
-    -0.625639,
-    -0.626996,
-    -0.628352,
-    -0.629707,
-    -0.63106,
-    -0.632411,
-    -0.633762,
-    -0.63511,
-    -0.636457,
-    -0.637803,
-    -0.639147,
-    -0.64049,
-    -0.641831,
-    -0.643171,
-    -0.644509,
-    -0.645845,
-    -0.64718,
-    -0.648514,
-    -0.649846,
-    -0.651176,
-    -0.652505,
-    -0.653833,
-    -0.655159,
-    -0.656483,
-    -0.657806,
-    -0.659127,
-    -0.660447,
-    -0.661765,
-    -0.663081,
-    -0.664396,
-    -0.66571,
-    -0.667022,
-    -0.668332,
-    -0.669641,
-    -0.670948,
-    -0.672254,
-    -0.673558,
-    -0.67486,
-    -0.676161,
-    -0.67746,
-    -0.678758,
-    -0.680054,
-    -0.681348,
-    -0.682641,
-    -0.683932,
-    -0.685222,
-    -0.68651,
-    -0.687796,
-    -0.689081,
-    -0.690364,
-    -0.691646,
-    -0.692926,
-    -0.694204,
-    -0.695481,
-    -0.696756,
-    -0.698029,
-    -0.699301,
-    -0.700571,
-    -0.701839,
-    -0.703106,
-    -0.704371,
-    -0.705635,
-    -0.706897,
-    -0.708157,
-    -0.709415,
-    -0.710672,
-    -0.711927,
-    -0.713181,
-    -0.714433,
-    -0.715683,
-    -0.716931,
-    -0.718178,
-    -0.719423,
-    -0.720666,
-    -0.721908,
-    -0.723148,
-    -0.724386,
-    -0.725623,
-    -0.726858,
-    -0.728091,
-    -0.729322,
-    -0.730552,
-    -0.73178,
-    -0.733006,
-    -0.734231,
-    -0.735453,
-    -0.736675,
-    -0.737894,
-    -0.739112,
-    -0.740327,
-    -0.741542,
-    -0.742754,
-    -0.743965,
-    -0.745173,
-    -0.746381,
-    -0.747586,
-    -0.74879,
-    -0.749991,
-    -0.751192,
-    -0.75239,
-    -0.753586,
-    -0.754781,
-    -0.755974,
-    -0.757165,
-    -0.758355,
-    -0.759543,
-    -0.760728,
-    -0.761913,
-    -0.763095,
-    -0.764275,
-    -0.765454,
-    -0.766631,
-    -0.767806,
-    -0.768979,
-    -0.770151,
-    -0.77132,
-    -0.772488,
-    -0.773654,
-    -0.774819,
-    -0.775981,
-    -0.777142,
-    -0.7783,
-    -0.779457,
-    -0.780612,
-    -0.781765,
-    -0.782917,
-    -0.784066,
-    -0.785214,
-    -0.78636,
-    -0.787504,
-    -0.788646,
-    -0.789786,
-    -0.790925,
-    -0.792061,
-    -0.793196,
-    -0.794329,
-    -0.79546,
-    -0.796589,
-    -0.797716,
-    -0.798842,
-    -0.799965,
-    -0.801087,
-    -0.802206,
-    -0.803324,
-    -0.80444,
-    -0.805554,
-    -0.806666,
-    -0.807777,
-    -0.808885,
-    -0.809991,
-    -0.811096,
-    -0.812199,
-    -0.813299,
-    -0.814398,
-    -0.815495,
-    -0.81659,
-    -0.817683,
-    -0.818774,
-    -0.819863,
-    -0.820951,
-    -0.822036,
-    -0.823119,
-    -0.824201,
-    -0.82528,
-    -0.826358,
-    -0.827434,
-    -0.828507,
-    -0.829579,
-    -0.830649,
-    -0.831717,
-    -0.832782,
-    -0.833846,
-    -0.834908,
-    -0.835968,
-    -0.837026,
-    -0.838082,
-    -0.839136,
-    -0.840189,
-    -0.841239,
-    -0.842287,
-    -0.843333,
-    -0.844377,
-    -0.845419,
-    -0.84646,
-    -0.847498,
-    -0.848534,
-    -0.849568,
-    -0.8506,
-    -0.851631,
-    -0.852659,
-    -0.853685,
-    -0.854709,
-    -0.855732,
-    -0.856752,
-    -0.85777,
-    -0.858786,
-    -0.8598,
-    -0.860812,
-    -0.861822,
-    -0.86283,
-    -0.863836,
-    -0.86484,
-    -0.865842,
-    -0.866842,
-    -0.86784,
-    -0.868836,
-    -0.86983,
-    -0.870821,
-    -0.871811,
-    -0.872799,
-    -0.873784,
-    -0.874768,
-    -0.875749,
-    -0.876729,
-    -0.877706,
-    -0.878681,
-    -0.879655,
-    -0.880626,
-    -0.881595,
-    -0.882562,
-    -0.883527,
-    -0.88449,
-    -0.88545,
-    -0.886409,
-    -0.887366,
-    -0.88832,
-    -0.889273,
-    -0.890223,
-    -0.891171,
-    -0.892117,
-    -0.893061,
-    -0.894003,
-    -0.894943,
-    -0.895881,
-    -0.896816,
-    -0.89775,
-    -0.898681,
-    -0.89961,
-    -0.900538,
-    -0.901463,
-    -0.902386,
-    -0.903306,
-    -0.904225,
-    -0.905142,
-    -0.906056,
-    -0.906968,
-    -0.907878,
-    -0.908786,
-    -0.909692,
-    -0.910596,
-    -0.911498,
-    -0.912397,
-    -0.913294,
-    -0.914189,
-    -0.915082,
-    -0.915973,
-    -0.916862,
-    -0.917748,
-    -0.918633,
-    -0.919515,
-    -0.920395,
-    -0.921273,
-    -0.922149,
-    -0.923022,
-    -0.923894,
-    -0.924763,
-    -0.92563,
-    -0.926495,
-    -0.927357,
-    -0.928218,
-    -0.929076,
-    -0.929932,
-    -0.930786,
-    -0.931638,
-    -0.932487,
-    -0.933335,
-    -0.93418,
-    -0.935023,
-    -0.935863,
-    -0.936702,
-    -0.937538,
-    -0.938372,
-    -0.939204,
-    -0.940034,
-    -0.940862,
-    -0.941687,
-    -0.94251,
-    -0.943331,
-    -0.944149,
-    -0.944966,
-    -0.94578,
-    -0.946592,
-    -0.947402,
-    -0.948209,
-    -0.949015,
-    -0.949818,
-    -0.950618,
-    -0.951417,
-    -0.952213,
-    -0.953007,
-    -0.953799,
-    -0.954589,
-    -0.955376,
-    -0.956161,
-    -0.956944,
-    -0.957725,
-    -0.958503,
-    -0.959279,
-    -0.960053,
-    -0.960825,
-    -0.961594,
-    -0.962361,
-    -0.963126,
-    -0.963888,
-    -0.964649,
-    -0.965407,
-    -0.966162,
-    -0.966916,
-    -0.967667,
-    -0.968416,
-    -0.969162,
-    -0.969907,
-    -0.970649,
-    -0.971389,
-    -0.972126,
-    -0.972861,
-    -0.973594,
-    -0.974325,
-    -0.975053,
-    -0.975779,
-    -0.976503,
-    -0.977224,
-    -0.977943,
-    -0.97866,
-    -0.979375,
-    -0.980087,
-    -0.980797,
-    -0.981505,
-    -0.98221,
-    -0.982913,
-    -0.983613,
-    -0.984312,
-    -0.985008,
-    -0.985702,
-    -0.986393,
-    -0.987082,
-    -0.987769,
-    -0.988453,
-    -0.989135,
-    -0.989815,
-    -0.990493,
-    -0.991168,
-    -0.991841,
-    -0.992511,
-    -0.993179,
-    -0.993845,
-    -0.994508,
-    -0.99517,
-    -0.995828,
-    -0.996485,
-    -0.997139,
-    -0.997791,
-    -0.99844,
-    -0.999087,
-    -0.999732,
-    -1.00037,
-    -1.00101,
-    -1.00165,
-    -1.00229,
-    -1.00292,
-    -1.00355,
-    -1.00418,
-    -1.0048,
-    -1.00543,
-    -1.00605,
-    -1.00667,
-    -1.00728,
-    -1.0079,
-    -1.00851,
-    -1.00912,
-    -1.00973,
-    -1.01033,
-    -1.01093,
-    -1.01153,
-    -1.01213,
-    -1.01272,
-    -1.01332,
-    -1.01391,
-    -1.0145,
-    -1.01508,
-    -1.01566,
-    -1.01624,
-    -1.01682,
-    -1.0174,
-    -1.01797,
-    -1.01854,
-    -1.01911,
-    -1.01968,
-    -1.02024,
-    -1.0208,
-    -1.02136,
-    -1.02192,
-    -1.02247,
-    -1.02303,
-    -1.02357,
-    -1.02412,
-    -1.02467,
-    -1.02521,
-    -1.02575,
-    -1.02629,
-    -1.02682,
-    -1.02735,
-    -1.02788,
-    -1.02841,
-    -1.02894,
-    -1.02946,
-    -1.02998,
-    -1.0305,
-    -1.03101,
-    -1.03153,
-    -1.03204,
-    -1.03255,
-    -1.03305,
-    -1.03356,
-    -1.03406,
-    -1.03455,
-    -1.03505,
-    -1.03554,
-    -1.03604,
-    -1.03653,
-    -1.03701,
-    -1.0375,
-    -1.03798,
-    -1.03846,
-    -1.03893,
-    -1.03941,
-    -1.03988,
-    -1.04035,
-    -1.04081,
-    -1.04128,
-    -1.04174,
-    -1.0422,
-    -1.04266,
-    -1.04311,
-    -1.04356,
-    -1.04401,
-    -1.04446,
-    -1.04491,
-    -1.04535,
-    -1.04579,
-    -1.04623,
-    -1.04666,
-    -1.04709,
-    -1.04752,
-    -1.04795,
-    -1.04838,
-    -1.0488,
-    -1.04922,
-    -1.04964,
-    -1.05005,
-    -1.05046,
-    -1.05088,
-    -1.05128,
-    -1.05169,
-    -1.05209,
-    -1.05249,
-    -1.05289,
-    -1.05329,
-    -1.05368,
-    -1.05407,
-    -1.05446,
-    -1.05484,
-    -1.05522,
-    -1.05561,
-    -1.05598,
-    -1.05636,
-    -1.05673,
-    -1.0571,
-    -1.05747,
-    -1.05784,
-    -1.0582,
-    -1.05856,
-    -1.05892,
-    -1.05927,
-    -1.05963,
-    -1.05998,
-    -1.06033,
-    -1.06067,
-    -1.06102,
-    -1.06136,
-    -1.06169,
-    -1.06203,
-    -1.06236,
-    -1.06269,
-    -1.06302,
-    -1.06335,
-    -1.06367,
-    -1.06399,
-    -1.06431,
-    -1.06463,
-    -1.06494,
-    -1.06525,
-    -1.06556,
-    -1.06586,
-    -1.06617,
-    -1.06647,
-    -1.06677,
-    -1.06706,
-    -1.06735,
-    -1.06764,
-    -1.06793,
-    -1.06822,
-    -1.0685,
-    -1.06878,
-    -1.06906,
-    -1.06934,
-    -1.06961,
-    -1.06988,
-    -1.07015,
-    -1.07041,
-    -1.07068,
-    -1.07094,
-    -1.07119,
-    -1.07145,
-    -1.0717,
-    -1.07195,
-    -1.0722,
-    -1.07245,
-    -1.07269,
-    -1.07293,
-    -1.07317,
-    -1.0734,
-    -1.07363,
-    -1.07386,
-    -1.07409,
-    -1.07432,
-    -1.07454,
-    -1.07476,
-    -1.07498,
-    -1.07519,
-    -1.0754,
-    -1.07561,
-    -1.07582,
-    -1.07603,
-    -1.07623,
-    -1.07643,
-    -1.07663,
-    -1.07682,
-    -1.07701,
-    -1.0772,
-    -1.07739,
-    -1.07757,
-    -1.07776,
-    -1.07794,
-    -1.07811,
-    -1.07829,
-    -1.07846,
-    -1.07863,
-    -1.07879,
-    -1.07896,
-    -1.07912,
-    -1.07928,
-    -1.07944,
-    -1.07959,
-    -1.07974,
-    -1.07989,
-    -1.08004,
-    -1.08018,
-    -1.08032,
-    -1.08046,
-    -1.0806,
-    -1.08073,
-    -1.08086,
-    -1.08099,
-    -1.08112,
-    -1.08124,
-    -1.08136,
-    -1.08148,
-    -1.0816,
-    -1.08171,
-    -1.08182,
-    -1.08193,
-    -1.08204,
-    -1.08214,
-    -1.08224,
-    -1.08234,
-    -1.08243,
-    -1.08253,
-    -1.08262,
-    -1.08271,
-    -1.08279,
-    -1.08287,
-    -1.08295,
-    -1.08303,
-    -1.08311,
-    -1.08318,
-    -1.08325,
-    -1.08332,
-    -1.08338,
-    -1.08345,
-    -1.08351,
-    -1.08356,
-    -1.08362,
-    -1.08367,
-    -1.08372,
-    -1.08377,
-    -1.08381,
-    -1.08385,
-    -1.08389,
-    -1.08393,
-    -1.08396,
-    -1.084,
-    -1.08403,
-    -1.08405,
-    -1.08408,
-    -1.0841,
-    -1.08412,
-    -1.08413,
-    -1.08415,
-    -1.08416,
-    -1.08417,
-    -1.08417,
-    -1.08418,
-    -1.08418,
-    -1.08418,
-    -1.08417,
-    -1.08417,
-    -1.08416,
-    -1.08415,
-    -1.08413,
-    -1.08412,
-    -1.0841,
-    -1.08408,
-    -1.08405,
-    -1.08403,
-    -1.084,
-    -1.08396,
-    -1.08393,
-    -1.08389,
-    -1.08385,
-    -1.08381,
-    -1.08377,
-    -1.08372,
-    -1.08367,
-    -1.08362,
-    -1.08356,
-    -1.08351,
-    -1.08345,
-    -1.08338,
-    -1.08332,
-    -1.08325,
-    -1.08318,
-    -1.08311,
-    -1.08303,
-    -1.08295,
-    -1.08287,
-    -1.08279,
-    -1.08271,
-    -1.08262,
-    -1.08253,
-    -1.08243,
-    -1.08234,
-    -1.08224,
-    -1.08214,
-    -1.08204,
-    -1.08193,
-    -1.08182,
-    -1.08171,
-    -1.0816,
-    -1.08148,
-    -1.08136,
-    -1.08124,
-    -1.08112,
-    -1.08099,
-    -1.08086,
-    -1.08073,
-    -1.0806,
-    -1.08046,
-    -1.08032,
-    -1.08018,
-    -1.08004,
-    -1.07989,
-    -1.07974,
-    -1.07959,
-    -1.07944,
-    -1.07928,
-    -1.07912,
-    -1.07896,
-    -1.07879,
-    -1.07863,
-    -1.07846,
-    -1.07829,
-    -1.07811,
-    -1.07794,
-    -1.07776,
-    -1.07757,
-    -1.07739,
-    -1.0772,
-    -1.07701,
-    -1.07682,
-    -1.07663,
-    -1.07643,
-    -1.07623,
-    -1.07603,
-    -1.07582,
-    -1.07561,
-    -1.0754,
-    -1.07519,
-    -1.07498,
-    -1.07476,
-    -1.07454,
-    -1.07432,
-    -1.07409,
-    -1.07386,
-    -1.07363,
-    -1.0734,
-    -1.07317,
-    -1.07293,
-    -1.07269,
-    -1.07245,
-    -1.0722,
-    -1.07195,
-    -1.0717,
-    -1.07145,
-    -1.07119,
-    -1.07094,
-    -1.07068,
-    -1.07041,
-    -1.07015,
-    -1.06988,
-    -1.06961,
-    -1.06934,
-    -1.06906,
-    -1.06878,
-    -1.0685,
-    -1.06822,
-    -1.06793,
-    -1.06764,
-    -1.06735,
-    -1.06706,
-    -1.06677,
-    -1.06647,
-    -1.06617,
-    -1.06586,
-    -1.06556,
-    -1.06525,
-    -1.06494,
-    -1.06463,
-    -1.06431,
-    -1.06399,
-    -1.06367,
-    -1.06335,
-    -1.06302,
-    -1.06269,
-    -1.06236,
-    -1.06203,
-    -1.06169,
-    -1.06136,
-    -1.06102,
-    -1.06067,
-    -1.06033,
-    -1.05998,
-    -1.05963,
-    -1.05927,
-    -1.05892,
-    -1.05856,
-    -1.0582,
-    -1.05784,
-    -1.05747,
-    -1.0571,
-    -1.05673,
-    -1.05636,
-    -1.05598,
-    -1.05561,
-    -1.05522,
-    -1.05484,
-    -1.05446,
-    -1.05407,
-    -1.05368,
-    -1.05329,
-    -1.05289,
-    -1.05249,
-    -1.05209,
-    -1.05169,
-    -1.05128,
-    -1.05088,
-    -1.05046,
-    -1.05005,
-    -1.04964,
-    -1.04922,
-    -1.0488,
-    -1.04838,
-    -1.04795,
-    -1.04752,
-    -1.04709,
-    -1.04666,
-    -1.04623,
-    -1.04579,
-    -1.04535,
-    -1.04491,
-    -1.04446,
-    -1.04401,
-    -1.04356,
-    -1.04311,
-    -1.04266,
-    -1.0422,
-    -1.04174,
-    -1.04128,
-    -1.04081,
-    -1.04035,
-    -1.03988,
-    -1.03941,
-    -1.03893,
-    -1.03846,
-    -1.03798,
-    -1.0375,
-    -1.03701,
-    -1.03653,
-    -1.03604,
-    -1.03554,
-    -1.03505,
-    -1.03455,
-    -1.03406,
-    -1.03356,
-    -1.03305,
-    -1.03255,
-    -1.03204,
-    -1.03153,
-    -1.03101,
-    -1.0305,
-    -1.02998,
-    -1.02946,
-    -1.02894,
-    -1.02841,
-    -1.02788,
-    -1.02735,
-    -1.02682,
-    -1.02629,
-    -1.02575,
-    -1.02521,
-    -1.02467,
-    -1.02412,
-    -1.02357,
-    -1.02303,
-    -1.02247,
-    -1.02192,
-    -1.02136,
-    -1.0208,
-    -1.02024,
-    -1.01968,
-    -1.01911,
-    -1.01854,
-    -1.01797,
-    -1.0174,
-    -1.01682,
-    -1.01624,
-    -1.01566,
-    -1.01508,
-    -1.0145,
-    -1.01391,
-    -1.01332,
-    -1.01272,
-    -1.01213,
-    -1.01153,
-    -1.01093,
-    -1.01033,
-    -1.00973,
-    -1.00912,
-    -1.00851,
-    -1.0079,
-    -1.00728,
-    -1.00667,
-    -1.00605,
-    -1.00543,
-    -1.0048,
-    -1.00418,
-    -1.00355,
-    -1.00292,
-    -1.00229,
-    -1.00165,
-    -1.00101,
-    -1.00037,
-    -0.999732,
-    -0.999087,
-    -0.99844,
-    -0.997791,
-    -0.997139,
-    -0.996485,
-    -0.995828,
-    -0.99517,
-    -0.994508,
-    -0.993845,
-    -0.993179,
-    -0.992511,
-    -0.991841,
-    -0.991168,
-    -0.990493,
-    -0.989815,
-    -0.989135,
-    -0.988453,
-    -0.987769,
-    -0.987082,
-    -0.986393,
-    -0.985702,
-    -0.985008,
-    -0.984312,
-    -0.983613,
-    -0.982913,
-    -0.98221,
-    -0.981505,
-    -0.980797,
-    -0.980087,
-    -0.979375,
-    -0.97866,
-    -0.977943,
-    -0.977224,
-    -0.976503,
-    -0.975779,
-    -0.975053,
-    -0.974325,
-    -0.973594,
-    -0.972861,
-    -0.972126,
-    -0.971389,
-    -0.970649,
-    -0.969907,
-    -0.969162,
-    -0.968416,
-    -0.967667,
-    -0.966916,
-    -0.966162,
-    -0.965407,
-    -0.964649,
-    -0.963888,
-    -0.963126,
-    -0.962361,
-    -0.961594,
-    -0.960825,
-    -0.960053,
-    -0.959279,
-    -0.958503,
-    -0.957725,
-    -0.956944,
-    -0.956161,
-    -0.955376,
-    -0.954589,
-    -0.953799,
-    -0.953007,
-    -0.952213,
-    -0.951417,
-    -0.950618,
-    -0.949818,
-    -0.949015,
-    -0.948209,
-    -0.947402,
-    -0.946592,
-    -0.94578,
-    -0.944966,
-    -0.944149,
-    -0.943331,
-    -0.94251,
-    -0.941687,
-    -0.940862,
-    -0.940034,
-    -0.939204,
-    -0.938372,
-    -0.937538,
-    -0.936702,
-    -0.935863,
-    -0.935023,
-    -0.93418,
-    -0.933335,
-    -0.932487,
-    -0.931638,
-    -0.930786,
-    -0.929932,
-    -0.929076,
-    -0.928218,
-    -0.927357,
-    -0.926495,
-    -0.92563,
-    -0.924763,
-    -0.923894,
-    -0.923022,
-    -0.922149,
-    -0.921273,
-    -0.920395,
-    -0.919515,
-    -0.918633,
-    -0.917748,
-    -0.916862,
-    -0.915973,
-    -0.915082,
-    -0.914189,
-    -0.913294,
-    -0.912397,
-    -0.911498,
-    -0.910596,
-    -0.909692,
-    -0.908786,
-    -0.907878,
-    -0.906968,
-    -0.906056,
-    -0.905142,
-    -0.904225,
-    -0.903306,
-    -0.902386,
-    -0.901463,
-    -0.900538,
-    -0.89961,
-    -0.898681,
-    -0.89775,
-    -0.896816,
-    -0.895881,
-    -0.894943,
-    -0.894003,
-    -0.893061,
-    -0.892117,
-    -0.891171,
-    -0.890223,
-    -0.889273,
-    -0.88832,
-    -0.887366,
-    -0.886409,
-    -0.88545,
-    -0.88449,
-    -0.883527,
-    -0.882562,
-    -0.881595,
-    -0.880626,
-    -0.879655,
-    -0.878681,
-    -0.877706,
-    -0.876729,
-    -0.875749,
-    -0.874768,
-    -0.873784,
-    -0.872799,
-    -0.871811,
-    -0.870821,
-    -0.86983,
-    -0.868836,
-    -0.86784,
-    -0.866842,
-    -0.865842,
-    -0.86484,
-    -0.863836,
-    -0.86283,
-    -0.861822,
-    -0.860812,
-    -0.8598,
-    -0.858786,
-    -0.85777,
-    -0.856752,
-    -0.855732,
-    -0.854709,
-    -0.853685,
-    -0.852659,
-    -0.851631,
-    -0.8506,
-    -0.849568,
-    -0.848534,
-    -0.847498,
-    -0.84646,
-    -0.845419,
-    -0.844377,
-    -0.843333,
-    -0.842287,
-    -0.841239,
-    -0.840189,
-    -0.839136,
-    -0.838082,
-    -0.837026,
-    -0.835968,
-    -0.834908,
-    -0.833846,
-    -0.832782,
-    -0.831717,
-    -0.830649,
-    -0.829579,
-    -0.828507,
-    -0.827434,
-    -0.826358,
-    -0.82528,
-    -0.824201,
-    -0.823119,
-    -0.822036,
-    -0.820951,
-    -0.819863,
-    -0.818774,
-    -0.817683,
-    -0.81659,
-    -0.815495,
-    -0.814398,
-    -0.813299,
-    -0.812199,
-    -0.811096,
-    -0.809991,
-    -0.808885,
-    -0.807777,
-    -0.806666,
-    -0.805554,
-    -0.80444,
-    -0.803324,
-    -0.802206,
-    -0.801087,
-    -0.799965,
-    -0.798842,
-    -0.797716,
-    -0.796589,
-    -0.79546,
-    -0.794329,
-    -0.793196,
-    -0.792061,
-    -0.790925,
-    -0.789786,
-    -0.788646,
-    -0.787504,
-    -0.78636,
-    -0.785214,
-    -0.784066,
-    -0.782917,
-    -0.781765,
-    -0.780612,
-    -0.779457,
-    -0.7783,
-    -0.777142,
-    -0.775981,
-    -0.774819,
-    -0.773654,
-    -0.772488,
-    -0.77132,
-    -0.770151,
-    -0.768979,
-    -0.767806,
-    -0.766631,
-    -0.765454,
-    -0.764275,
-    -0.763095,
-    -0.761913,
-    -0.760728,
-    -0.759543,
-    -0.758355,
-    -0.757165,
-    -0.755974,
-    -0.754781,
-    -0.753586,
-    -0.75239,
-    -0.751192,
-    -0.749991,
-    -0.74879,
-    -0.747586,
-    -0.746381,
-    -0.745173,
-    -0.743965,
-    -0.742754,
-    -0.741542,
-    -0.740327,
-    -0.739112,
-    -0.737894,
-    -0.736675,
-    -0.735453,
-    -0.734231,
-    -0.733006,
-    -0.73178,
-    -0.730552,
-    -0.729322,
-    -0.728091,
-    -0.726858,
-    -0.725623,
-    -0.724386,
-    -0.723148,
-    -0.721908,
-    -0.720666,
-    -0.719423,
-    -0.718178,
-    -0.716931,
-    -0.715683,
-    -0.714433,
-    -0.713181,
-    -0.711927,
-    -0.710672,
-    -0.709415,
-    -0.708157,
-    -0.706897,
-    -0.705635,
-    -0.704371,
-    -0.703106,
-    -0.701839,
-    -0.700571,
-    -0.699301,
-    -0.698029,
-    -0.696756,
-    -0.695481,
-    -0.694204,
-    -0.692926,
-    -0.691646,
-    -0.690364,
-    -0.689081,
-    -0.687796,
-    -0.68651,
-    -0.685222,
-    -0.683932,
-    -0.682641,
-    -0.681348,
-    -0.680054,
-    -0.678758,
-    -0.67746,
-    -0.676161,
-    -0.67486,
-    -0.673558,
-    -0.672254,
-    -0.670948,
-    -0.669641,
-    -0.668332,
-    -0.667022,
-    -0.66571,
-    -0.664396,
-    -0.663081,
-    -0.661765,
-    -0.660447,
-    -0.659127,
-    -0.657806,
-    -0.656483,
-    -0.655159,
-    -0.653833,
-    -0.652505,
-    -0.651176,
-    -0.649846,
-    -0.648514,
-    -0.64718,
-    -0.645845,
-    -0.644509,
-    -0.643171,
-    -0.641831,
-    -0.64049,
-    -0.639147,
-    -0.637803,
-    -0.636457,
-    -0.63511,
-    -0.633762,
-    -0.632411,
-    -0.63106,
-    -0.629707,
-    -0.628352,
-    -0.626996,
-    -0.625639,
-    -0.62428,
-    -0.622919,
-    -0.621557,
-    -0.620194,
-    -0.618829,
-    -0.617463,
-    -0.616095,
-    -0.614726,
-    -0.613355,
-    -0.611983,
-    -0.610609,
-    -0.609234,
-    -0.607858,
-    -0.60648,
-    -0.605101,
-    -0.60372,
-    -0.602338,
-    -0.600955,
-    -0.59957,
-    -0.598183,
-    -0.596795,
-    -0.595406,
-    -0.594016,
-    -0.592624,
-    -0.59123,
-    -0.589836,
-    -0.588439,
-    -0.587042,
-    -0.585643,
-    -0.584243,
-    -0.582841,
-    -0.581438,
-    -0.580034,
-    -0.578628,
-    -0.577221,
-    -0.575812,
-    -0.574402,
-    -0.572991,
-    -0.571579,
-    -0.570165,
-    -0.56875,
-    -0.567333,
-    -0.565915,
-    -0.564496,
-    -0.563075,
-    -0.561653,
-    -0.56023,
-    -0.558806,
-    -0.55738,
-    -0.555953,
-    -0.554524,
-    -0.553094,
-    -0.551663,
-    -0.550231,
-    -0.548797,
-    -0.547362,
-    -0.545926,
-    -0.544489,
-    -0.54305,
-    -0.54161,
-    -0.540168,
-    -0.538726,
-    -0.537282,
-    -0.535837,
-    -0.53439,
-    -0.532943,
-    -0.531494,
-    -0.530043,
-    -0.528592,
-    -0.527139,
-    -0.525685,
-    -0.52423,
-    -0.522774,
-    -0.521316,
-    -0.519857,
-    -0.518397,
-    -0.516936,
-    -0.515474,
-    -0.51401,
-    -0.512545,
-    -0.511079,
-    -0.509612,
-    -0.508143,
-    -0.506673,
-    -0.505202,
-    -0.50373,
-    -0.502257,
-    -0.500782,
-    -0.499307,
-    -0.49783,
-    -0.496352,
-    -0.494873,
-    -0.493392,
-    -0.491911,
-    -0.490428,
-    -0.488945,
-    -0.48746,
-    -0.485973,
-    -0.484486,
-    -0.482998,
-    -0.481508,
-    -0.480018,
-    -0.478526,
-    -0.477033,
-    -0.475539,
-    -0.474044,
-    -0.472547,
-    -0.47105,
-    -0.469552,
-    -0.468052,
-    -0.466551,
-    -0.46505,
-    -0.463547,
-    -0.462043,
-    -0.460538,
-    -0.459031,
-    -0.457524,
-    -0.456016,
-    -0.454507,
-    -0.452996,
-    -0.451485,
-    -0.449972,
-    -0.448458,
-    -0.446944,
-    -0.445428,
-    -0.443911,
-    -0.442393,
-    -0.440874,
-    -0.439354,
-    -0.437834,
-    -0.436312,
-    -0.434789,
-    -0.433265,
-    -0.431739,
-    -0.430213,
-    -0.428686,
-    -0.427158,
-    -0.425629,
-    -0.424099,
-    -0.422568,
-    -0.421036,
-    -0.419503,
-    -0.417969,
-    -0.416434,
-    -0.414898,
-    -0.413361,
-    -0.411823,
-    -0.410284,
-    -0.408744,
-    -0.407203,
-    -0.405661,
-    -0.404118,
-    -0.402575,
-    -0.40103,
-    -0.399484,
-    -0.397938,
-    -0.39639,
-    -0.394842,
-    -0.393292,
-    -0.391742,
-    -0.390191,
-    -0.388639,
-    -0.387086,
-    -0.385532,
-    -0.383977,
-    -0.382421,
-    -0.380865,
-    -0.379307,
-    -0.377749,
-    -0.376189,
-    -0.374629,
-    -0.373068,
-    -0.371506,
-    -0.369943,
-    -0.368379,
-    -0.366815,
-    -0.365249,
-    -0.363683,
-    -0.362116,
-    -0.360548,
-    -0.358979,
-    -0.357409,
-    -0.355839,
-    -0.354267,
-    -0.352695,
-    -0.351122,
-    -0.349548,
-    -0.347973,
-    -0.346398,
-    -0.344821,
-    -0.343244,
-    -0.341666,
-    -0.340087,
-    -0.338508,
-    -0.336928,
-    -0.335346,
-    -0.333764,
-    -0.332182,
-    -0.330598,
-    -0.329014,
-    -0.327429,
-    -0.325843,
-    -0.324256,
-    -0.322669,
-    -0.321081,
-    -0.319492,
-    -0.317902,
-    -0.316312,
-    -0.314721,
-    -0.313129,
-    -0.311536,
-    -0.309943,
-    -0.308349,
-    -0.306754,
-    -0.305159,
-    -0.303562,
-    -0.301965,
-    -0.300368,
-    -0.298769,
-    -0.29717,
-    -0.295571,
-    -0.29397,
-    -0.292369,
-    -0.290767,
-    -0.289165,
-    -0.287561,
-    -0.285958,
-    -0.284353,
-    -0.282748,
-    -0.281142,
-    -0.279535,
-    -0.277928,
-    -0.27632,
-    -0.274712,
-    -0.273103,
-    -0.271493,
-    -0.269882,
-    -0.268271,
-    -0.26666,
-    -0.265047,
-    -0.263434,
-    -0.261821,
-    -0.260206,
-    -0.258592,
-    -0.256976,
-    -0.25536,
-    -0.253744,
-    -0.252126,
-    -0.250509,
-    -0.24889,
-    -0.247271,
-    -0.245652,
-    -0.244031,
-    -0.242411,
-    -0.240789,
-    -0.239168,
-    -0.237545,
-    -0.235922,
-    -0.234299,
-    -0.232675,
-    -0.23105,
-    -0.229425,
-    -0.227799,
-    -0.226173,
-    -0.224546,
-    -0.222919,
-    -0.221291,
-    -0.219662,
-    -0.218034,
-    -0.216404,
-    -0.214774,
-    -0.213144,
-    -0.211513,
-    -0.209882,
-    -0.20825,
-    -0.206617,
-    -0.204984,
-    -0.203351,
-    -0.201717,
-    -0.200083,
-    -0.198448,
-    -0.196813,
-    -0.195177,
-    -0.193541,
-    -0.191904,
-    -0.190267,
-    -0.18863,
-    -0.186992,
-    -0.185353,
-    -0.183715,
-    -0.182075,
-    -0.180436,
-    -0.178795,
-    -0.177155,
-    -0.175514,
-    -0.173873,
-    -0.172231,
-    -0.170589,
-    -0.168946,
-    -0.167303,
-    -0.16566,
-    -0.164016,
-    -0.162372,
-    -0.160727,
-    -0.159082,
-    -0.157437,
-    -0.155791,
-    -0.154145,
-    -0.152499,
-    -0.150852,
-    -0.149205,
-    -0.147558,
-    -0.14591,
-    -0.144262,
-    -0.142613,
-    -0.140964,
-    -0.139315,
-    -0.137666,
-    -0.136016,
-    -0.134366,
-    -0.132715,
-    -0.131064,
-    -0.129413,
-    -0.127762,
-    -0.12611,
-    -0.124458,
-    -0.122806,
-    -0.121154,
-    -0.119501,
-    -0.117848,
-    -0.116194,
-    -0.114541,
-    -0.112887,
-    -0.111232,
-    -0.109578,
-    -0.107923,
-    -0.106268,
-    -0.104613,
-    -0.102958,
-    -0.101302,
-    -0.0996458,
-    -0.0979897,
-    -0.0963332,
-    -0.0946766,
-    -0.0930197,
-    -0.0913626,
-    -0.0897053,
-    -0.0880478,
-    -0.0863901,
-    -0.0847322,
-    -0.083074,
-    -0.0814157,
-    -0.0797572,
-    -0.0780985,
-    -0.0764396,
-    -0.0747806,
-    -0.0731213,
-    -0.0714619,
-    -0.0698024,
-    -0.0681426,
-    -0.0664827,
-    -0.0648227,
-    -0.0631624,
-    -0.0615021,
-    -0.0598416,
-    -0.0581809,
-    -0.0565201,
-    -0.0548592,
-    -0.0531982,
-    -0.051537,
-    -0.0498757,
-    -0.0482143,
-    -0.0465528,
-    -0.0448912,
-    -0.0432294,
-    -0.0415676,
-    -0.0399056,
-    -0.0382436,
-    -0.0365815,
-    -0.0349193,
-    -0.033257,
-    -0.0315946,
-    -0.0299322,
-    -0.0282697,
-    -0.0266071,
-    -0.0249445,
-    -0.0232818,
-    -0.021619,
-    -0.0199562,
-    -0.0182934,
-    -0.0166305,
-    -0.0149675,
-    -0.0133046,
-    -0.0116416,
-    -0.00997853,
-    -0.00831547,
-    -0.0066524,
-    -0.00498932,
-    -0.00332622,
-    -0.00166311
-};
-
-// Top frequency: 44.1K * 0.464399
-constexpr static std::array<float, 4096> wt_square_0xA =
-{
-    0,
-    0.00166311,
-    0.00332622,
-    0.00498932,
-    0.0066524,
-    0.00831547,
-    0.00997853,
-    0.0116416,
-    0.0133046,
-    0.0149675,
-    0.0166305,
-    0.0182934,
-    0.0199562,
-    0.021619,
-    0.0232818,
-    0.0249445,
-    0.0266071,
-    0.0282697,
-    0.0299322,
-    0.0315946,
-    0.033257,
-    0.0349193,
-    0.0365815,
-    0.0382436,
-    0.0399056,
-    0.0415676,
-    0.0432294,
-    0.0448912,
-    0.0465528,
-    0.0482143,
-    0.0498757,
-    0.051537,
-    0.0531982,
-    0.0548592,
-    0.0565201,
-    0.0581809,
-    0.0598416,
-    0.0615021,
-    0.0631624,
-    0.0648227,
-    0.0664827,
-    0.0681426,
-    0.0698024,
-    0.0714619,
-    0.0731213,
-    0.0747806,
-    0.0764396,
-    0.0780985,
-    0.0797572,
-    0.0814157,
-    0.083074,
-    0.0847322,
-    0.0863901,
-    0.0880478,
-    0.0897053,
-    0.0913626,
-    0.0930197,
-    0.0946766,
-    0.0963332,
-    0.0979897,
-    0.0996458,
-    0.101302,
-    0.102958,
-    0.104613,
-    0.106268,
-    0.107923,
-    0.109578,
-    0.111232,
-    0.112887,
-    0.114541,
-    0.116194,
-    0.117848,
-    0.119501,
-    0.121154,
-    0.122806,
-    0.124458,
-    0.12611,
-    0.127762,
-    0.129413,
-    0.131064,
-    0.132715,
-    0.134366,
-    0.136016,
-    0.137666,
-    0.139315,
-    0.140964,
-    0.142613,
-    0.144262,
-    0.14591,
-    0.147558,
-    0.149205,
-    0.150852,
-    0.152499,
-    0.154145,
-    0.155791,
-    0.157437,
-    0.159082,
-    0.160727,
-    0.162372,
-    0.164016,
-    0.16566,
-    0.167303,
-    0.168946,
-    0.170589,
-    0.172231,
-    0.173873,
-    0.175514,
-    0.177155,
-    0.178795,
-    0.180436,
-    0.182075,
-    0.183715,
-    0.185353,
-    0.186992,
-    0.18863,
-    0.190267,
-    0.191904,
-    0.193541,
-    0.195177,
-    0.196813,
-    0.198448,
-    0.200083,
-    0.201717,
-    0.203351,
-    0.204984,
-    0.206617,
-    0.20825,
-    0.209882,
-    0.211513,
-    0.213144,
-    0.214774,
-    0.216404,
-    0.218034,
-    0.219662,
-    0.221291,
-    0.222919,
-    0.224546,
-    0.226173,
-    0.227799,
-    0.229425,
-    0.23105,
-    0.232675,
-    0.234299,
-    0.235922,
-    0.237545,
-    0.239168,
-    0.240789,
-    0.242411,
-    0.244031,
-    0.245652,
-    0.247271,
-    0.24889,
-    0.250509,
-    0.252126,
-    0.253744,
-    0.25536,
-    0.256976,
-    0.258592,
-    0.260206,
-    0.261821,
-    0.263434,
-    0.265047,
-    0.26666,
-    0.268271,
-    0.269882,
-    0.271493,
-    0.273103,
-    0.274712,
-    0.27632,
-    0.277928,
-    0.279535,
-    0.281142,
-    0.282748,
-    0.284353,
-    0.285958,
-    0.287561,
-    0.289165,
-    0.290767,
-    0.292369,
-    0.29397,
-    0.295571,
-    0.29717,
-    0.298769,
-    0.300368,
-    0.301965,
-    0.303562,
-    0.305159,
-    0.306754,
-    0.308349,
-    0.309943,
-    0.311536,
-    0.313129,
-    0.314721,
-    0.316312,
-    0.317902,
-    0.319492,
-    0.321081,
-    0.322669,
-    0.324256,
-    0.325843,
-    0.327429,
-    0.329014,
-    0.330598,
-    0.332182,
-    0.333764,
-    0.335346,
-    0.336928,
-    0.338508,
-    0.340087,
-    0.341666,
-    0.343244,
-    0.344821,
-    0.346398,
-    0.347973,
-    0.349548,
-    0.351122,
-    0.352695,
-    0.354267,
-    0.355839,
-    0.357409,
-    0.358979,
-    0.360548,
-    0.362116,
-    0.363683,
-    0.365249,
-    0.366815,
-    0.368379,
-    0.369943,
-    0.371506,
-    0.373068,
-    0.374629,
-    0.376189,
-    0.377749,
-    0.379307,
-    0.380865,
-    0.382421,
-    0.383977,
-    0.385532,
-    0.387086,
-    0.388639,
-    0.390191,
-    0.391742,
-    0.393292,
-    0.394842,
-    0.39639,
-    0.397938,
-    0.399484,
-    0.40103,
-    0.402575,
-    0.404118,
-    0.405661,
-    0.407203,
-    0.408744,
-    0.410284,
-    0.411823,
-    0.413361,
-    0.414898,
-    0.416434,
-    0.417969,
-    0.419503,
-    0.421036,
-    0.422568,
-    0.424099,
-    0.425629,
-    0.427158,
-    0.428686,
-    0.430213,
-    0.431739,
-    0.433265,
-    0.434789,
-    0.436312,
-    0.437834,
-    0.439354,
-    0.440874,
-    0.442393,
-    0.443911,
-    0.445428,
-    0.446944,
-    0.448458,
-    0.449972,
-    0.451485,
-    0.452996,
-    0.454507,
-    0.456016,
-    0.457524,
-    0.459031,
-    0.460538,
-    0.462043,
-    0.463547,
-    0.46505,
-    0.466551,
-    0.468052,
-    0.469552,
-    0.47105,
-    0.472547,
-    0.474044,
-    0.475539,
-    0.477033,
-    0.478526,
-    0.480018,
-    0.481508,
-    0.482998,
-    0.484486,
-    0.485973,
-    0.48746,
-    0.488945,
-    0.490428,
-    0.491911,
-    0.493392,
-    0.494873,
-    0.496352,
-    0.49783,
-    0.499307,
-    0.500782,
-    0.502257,
-    0.50373,
-    0.505202,
-    0.506673,
-    0.508143,
-    0.509612,
-    0.511079,
-    0.512545,
-    0.51401,
-    0.515474,
-    0.516936,
-    0.518397,
-    0.519857,
-    0.521316,
-    0.522774,
-    0.52423,
-    0.525685,
-    0.527139,
-    0.528592,
-    0.530043,
-    0.531494,
-    0.532943,
-    0.53439,
-    0.535837,
-    0.537282,
-    0.538726,
-    0.540168,
-    0.54161,
-    0.54305,
-    0.544489,
-    0.545926,
-    0.547362,
-    0.548797,
-    0.550231,
-    0.551663,
-    0.553094,
-    0.554524,
-    0.555953,
-    0.55738,
-    0.558806,
-    0.56023,
-    0.561653,
-    0.563075,
-    0.564496,
-    0.565915,
-    0.567333,
-    0.56875,
-    0.570165,
-    0.571579,
-    0.572991,
-    0.574402,
-    0.575812,
-    0.577221,
-    0.578628,
-    0.580034,
-    0.581438,
-    0.582841,
-    0.584243,
-    0.585643,
-    0.587042,
-    0.588439,
-    0.589836,
-    0.59123,
-    0.592624,
-    0.594016,
-    0.595406,
-    0.596795,
-    0.598183,
-    0.59957,
-    0.600955,
-    0.602338,
-    0.60372,
-    0.605101,
-    0.60648,
-    0.607858,
-    0.609234,
-    0.610609,
-    0.611983,
-    0.613355,
-    0.614726,
-    0.616095,
-    0.617463,
-    0.618829,
-    0.620194,
-    0.621557,
-    0.622919,
-    0.62428,
-    0.625639,
-    0.626996,
-    0.628352,
-    0.629707,
-    0.63106,
-    0.632411,
-    0.633762,
-    0.63511,
-    0.636457,
-    0.637803,
-    0.639147,
-    0.64049,
-    0.641831,
-    0.643171,
-    0.644509,
-    0.645845,
-    0.64718,
-    0.648514,
-    0.649846,
-    0.651176,
-    0.652505,
-    0.653833,
-    0.655159,
-    0.656483,
-    0.657806,
-    0.659127,
-    0.660447,
-    0.661765,
-    0.663081,
-    0.664396,
-    0.66571,
-    0.667022,
-    0.668332,
-    0.669641,
-    0.670948,
-    0.672254,
-    0.673558,
-    0.67486,
-    0.676161,
-    0.67746,
-    0.678758,
-    0.680054,
-    0.681348,
-    0.682641,
-    0.683932,
-    0.685222,
-    0.68651,
-    0.687796,
-    0.689081,
-    0.690364,
-    0.691646,
-    0.692926,
-    0.694204,
-    0.695481,
-    0.696756,
-    0.698029,
-    0.699301,
-    0.700571,
-    0.701839,
-    0.703106,
-    0.704371,
-    0.705635,
-    0.706897,
-    0.708157,
-    0.709415,
-    0.710672,
-    0.711927,
-    0.713181,
-    0.714433,
-    0.715683,
-    0.716931,
-    0.718178,
-    0.719423,
-    0.720666,
-    0.721908,
-    0.723148,
-    0.724386,
-    0.725623,
-    0.726858,
-    0.728091,
-    0.729322,
-    0.730552,
-    0.73178,
-    0.733006,
-    0.734231,
-    0.735453,
-    0.736675,
-    0.737894,
-    0.739112,
-    0.740327,
-    0.741542,
-    0.742754,
-    0.743965,
-    0.745173,
-    0.746381,
-    0.747586,
-    0.74879,
-    0.749991,
-    0.751192,
-    0.75239,
-    0.753586,
-    0.754781,
-    0.755974,
-    0.757165,
-    0.758355,
-    0.759543,
-    0.760728,
-    0.761913,
-    0.763095,
-    0.764275,
-    0.765454,
-    0.766631,
-    0.767806,
-    0.768979,
-    0.770151,
-    0.77132,
-    0.772488,
-    0.773654,
-    0.774819,
-    0.775981,
-    0.777142,
-    0.7783,
-    0.779457,
-    0.780612,
-    0.781765,
-    0.782917,
-    0.784066,
-    0.785214,
-    0.78636,
-    0.787504,
-    0.788646,
-    0.789786,
-    0.790925,
-    0.792061,
-    0.793196,
-    0.794329,
-    0.79546,
-    0.796589,
-    0.797716,
-    0.798842,
-    0.799965,
-    0.801087,
-    0.802206,
-    0.803324,
-    0.80444,
-    0.805554,
-    0.806666,
-    0.807777,
-    0.808885,
-    0.809991,
-    0.811096,
-    0.812199,
-    0.813299,
-    0.814398,
-    0.815495,
-    0.81659,
-    0.817683,
-    0.818774,
-    0.819863,
-    0.820951,
-    0.822036,
-    0.823119,
-    0.824201,
-    0.82528,
-    0.826358,
-    0.827434,
-    0.828507,
-    0.829579,
-    0.830649,
-    0.831717,
-    0.832782,
-    0.833846,
-    0.834908,
-    0.835968,
-    0.837026,
-    0.838082,
-    0.839136,
-    0.840189,
-    0.841239,
-    0.842287,
-    0.843333,
-    0.844377,
-    0.845419,
-    0.84646,
-    0.847498,
-    0.848534,
-    0.849568,
-    0.8506,
-    0.851631,
-    0.852659,
-    0.853685,
-    0.854709,
-    0.855732,
-    0.856752,
-    0.85777,
-    0.858786,
-    0.8598,
-    0.860812,
-    0.861822,
-    0.86283,
-    0.863836,
-    0.86484,
-    0.865842,
-    0.866842,
-    0.86784,
-    0.868836,
-    0.86983,
-    0.870821,
-    0.871811,
-    0.872799,
-    0.873784,
-    0.874768,
-    0.875749,
-    0.876729,
-    0.877706,
-    0.878681,
-    0.879655,
-    0.880626,
-    0.881595,
-    0.882562,
-    0.883527,
-    0.88449,
-    0.88545,
-    0.886409,
-    0.887366,
-    0.88832,
-    0.889273,
-    0.890223,
-    0.891171,
-    0.892117,
-    0.893061,
-    0.894003,
-    0.894943,
-    0.895881,
-    0.896816,
-    0.89775,
-    0.898681,
-    0.89961,
-    0.900538,
-    0.901463,
-    0.902386,
-    0.903306,
-    0.904225,
-    0.905142,
-    0.906056,
-    0.906968,
-    0.907878,
-    0.908786,
-    0.909692,
-    0.910596,
-    0.911498,
-    0.912397,
-    0.913294,
-    0.914189,
-    0.915082,
-    0.915973,
-    0.916862,
-    0.917748,
-    0.918633,
-    0.919515,
-    0.920395,
-    0.921273,
-    0.922149,
-    0.923022,
-    0.923894,
-    0.924763,
-    0.92563,
-    0.926495,
-    0.927357,
-    0.928218,
-    0.929076,
-    0.929932,
-    0.930786,
-    0.931638,
-    0.932487,
-    0.933335,
-    0.93418,
-    0.935023,
-    0.935863,
-    0.936702,
-    0.937538,
-    0.938372,
-    0.939204,
-    0.940034,
-    0.940862,
-    0.941687,
-    0.94251,
-    0.943331,
-    0.944149,
-    0.944966,
-    0.94578,
-    0.946592,
-    0.947402,
-    0.948209,
-    0.949015,
-    0.949818,
-    0.950618,
-    0.951417,
-    0.952213,
-    0.953007,
-    0.953799,
-    0.954589,
-    0.955376,
-    0.956161,
-    0.956944,
-    0.957725,
-    0.958503,
-    0.959279,
-    0.960053,
-    0.960825,
-    0.961594,
-    0.962361,
-    0.963126,
-    0.963888,
-    0.964649,
-    0.965407,
-    0.966162,
-    0.966916,
-    0.967667,
-    0.968416,
-    0.969162,
-    0.969907,
-    0.970649,
-    0.971389,
-    0.972126,
-    0.972861,
-    0.973594,
-    0.974325,
-    0.975053,
-    0.975779,
-    0.976503,
-    0.977224,
-    0.977943,
-    0.97866,
-    0.979375,
-    0.980087,
-    0.980797,
-    0.981505,
-    0.98221,
-    0.982913,
-    0.983613,
-    0.984312,
-    0.985008,
-    0.985702,
-    0.986393,
-    0.987082,
-    0.987769,
-    0.988453,
-    0.989135,
-    0.989815,
-    0.990493,
-    0.991168,
-    0.991841,
-    0.992511,
-    0.993179,
-    0.993845,
-    0.994508,
-    0.99517,
-    0.995828,
-    0.996485,
-    0.997139,
-    0.997791,
-    0.99844,
-    0.999087,
-    0.999732,
-    1.00037,
-    1.00101,
-    1.00165,
-    1.00229,
-    1.00292,
-    1.00355,
-    1.00418,
-    1.0048,
-    1.00543,
-    1.00605,
-    1.00667,
-    1.00728,
-    1.0079,
-    1.00851,
-    1.00912,
-    1.00973,
-    1.01033,
-    1.01093,
-    1.01153,
-    1.01213,
-    1.01272,
-    1.01332,
-    1.01391,
-    1.0145,
-    1.01508,
-    1.01566,
-    1.01624,
-    1.01682,
-    1.0174,
-    1.01797,
-    1.01854,
-    1.01911,
-    1.01968,
-    1.02024,
-    1.0208,
-    1.02136,
-    1.02192,
-    1.02247,
-    1.02303,
-    1.02357,
-    1.02412,
-    1.02467,
-    1.02521,
-    1.02575,
-    1.02629,
-    1.02682,
-    1.02735,
-    1.02788,
-    1.02841,
-    1.02894,
-    1.02946,
-    1.02998,
-    1.0305,
-    1.03101,
-    1.03153,
-    1.03204,
-    1.03255,
-    1.03305,
-    1.03356,
-    1.03406,
-    1.03455,
-    1.03505,
-    1.03554,
-    1.03604,
-    1.03653,
-    1.03701,
-    1.0375,
-    1.03798,
-    1.03846,
-    1.03893,
-    1.03941,
-    1.03988,
-    1.04035,
-    1.04081,
-    1.04128,
-    1.04174,
-    1.0422,
-    1.04266,
-    1.04311,
-    1.04356,
-    1.04401,
-    1.04446,
-    1.04491,
-    1.04535,
-    1.04579,
-    1.04623,
-    1.04666,
-    1.04709,
-    1.04752,
-    1.04795,
-    1.04838,
-    1.0488,
-    1.04922,
-    1.04964,
-    1.05005,
-    1.05046,
-    1.05088,
-    1.05128,
-    1.05169,
-    1.05209,
-    1.05249,
-    1.05289,
-    1.05329,
-    1.05368,
-    1.05407,
-    1.05446,
-    1.05484,
-    1.05522,
-    1.05561,
-    1.05598,
-    1.05636,
-    1.05673,
-    1.0571,
-    1.05747,
-    1.05784,
-    1.0582,
-    1.05856,
-    1.05892,
-    1.05927,
-    1.05963,
-    1.05998,
-    1.06033,
-    1.06067,
-    1.06102,
-    1.06136,
-    1.06169,
-    1.06203,
-    1.06236,
-    1.06269,
-    1.06302,
-    1.06335,
-    1.06367,
-    1.06399,
-    1.06431,
-    1.06463,
-    1.06494,
-    1.06525,
-    1.06556,
-    1.06586,
-    1.06617,
-    1.06647,
-    1.06677,
-    1.06706,
-    1.06735,
-    1.06764,
-    1.06793,
-    1.06822,
-    1.0685,
-    1.06878,
-    1.06906,
-    1.06934,
-    1.06961,
-    1.06988,
-    1.07015,
-    1.07041,
-    1.07068,
-    1.07094,
-    1.07119,
-    1.07145,
-    1.0717,
-    1.07195,
-    1.0722,
-    1.07245,
-    1.07269,
-    1.07293,
-    1.07317,
-    1.0734,
-    1.07363,
-    1.07386,
-    1.07409,
-    1.07432,
-    1.07454,
-    1.07476,
-    1.07498,
-    1.07519,
-    1.0754,
-    1.07561,
-    1.07582,
-    1.07603,
-    1.07623,
-    1.07643,
-    1.07663,
-    1.07682,
-    1.07701,
-    1.0772,
-    1.07739,
-    1.07757,
-    1.07776,
-    1.07794,
-    1.07811,
-    1.07829,
-    1.07846,
-    1.07863,
-    1.07879,
-    1.07896,
-    1.07912,
-    1.07928,
-    1.07944,
-    1.07959,
-    1.07974,
-    1.07989,
-    1.08004,
-    1.08018,
-    1.08032,
-    1.08046,
-    1.0806,
-    1.08073,
-    1.08086,
-    1.08099,
-    1.08112,
-    1.08124,
-    1.08136,
-    1.08148,
-    1.0816,
-    1.08171,
-    1.08182,
-    1.08193,
-    1.08204,
-    1.08214,
-    1.08224,
-    1.08234,
-    1.08243,
-    1.08253,
-    1.08262,
-    1.08271,
-    1.08279,
-    1.08287,
-    1.08295,
-    1.08303,
-    1.08311,
-    1.08318,
-    1.08325,
-    1.08332,
-    1.08338,
-    1.08345,
-    1.08351,
-    1.08356,
-    1.08362,
-    1.08367,
-    1.08372,
-    1.08377,
-    1.08381,
-    1.08385,
-    1.08389,
-    1.08393,
-    1.08396,
-    1.084,
-    1.08403,
-    1.08405,
-    1.08408,
-    1.0841,
-    1.08412,
-    1.08413,
-    1.08415,
-    1.08416,
-    1.08417,
-    1.08417,
-    1.08418,
-    1.08418,
-    1.08418,
-    1.08417,
-    1.08417,
-    1.08416,
-    1.08415,
-    1.08413,
-    1.08412,
-    1.0841,
-    1.08408,
-    1.08405,
-    1.08403,
-    1.084,
-    1.08396,
-    1.08393,
-    1.08389,
-    1.08385,
-    1.08381,
-    1.08377,
-    1.08372,
-    1.08367,
-    1.08362,
-    1.08356,
-    1.08351,
-    1.08345,
-    1.08338,
-    1.08332,
-    1.08325,
-    1.08318,
-    1.08311,
-    1.08303,
-    1.08295,
-    1.08287,
-    1.08279,
-    1.08271,
-    1.08262,
-    1.08253,
-    1.08243,
-    1.08234,
-    1.08224,
-    1.08214,
-    1.08204,
-    1.08193,
-    1.08182,
-    1.08171,
-    1.0816,
-    1.08148,
-    1.08136,
-    1.08124,
-    1.08112,
-    1.08099,
-    1.08086,
-    1.08073,
-    1.0806,
-    1.08046,
-    1.08032,
-    1.08018,
-    1.08004,
-    1.07989,
-    1.07974,
-    1.07959,
-    1.07944,
-    1.07928,
-    1.07912,
-    1.07896,
-    1.07879,
-    1.07863,
-    1.07846,
-    1.07829,
-    1.07811,
-    1.07794,
-    1.07776,
-    1.07757,
-    1.07739,
-    1.0772,
-    1.07701,
-    1.07682,
-    1.07663,
-    1.07643,
-    1.07623,
-    1.07603,
-    1.07582,
-    1.07561,
-    1.0754,
-    1.07519,
-    1.07498,
-    1.07476,
-    1.07454,
-    1.07432,
-    1.07409,
-    1.07386,
-    1.07363,
-    1.0734,
-    1.07317,
-    1.07293,
-    1.07269,
-    1.07245,
-    1.0722,
-    1.07195,
-    1.0717,
-    1.07145,
-    1.07119,
-    1.07094,
-    1.07068,
-    1.07041,
-    1.07015,
-    1.06988,
-    1.06961,
-    1.06934,
-    1.06906,
-    1.06878,
-    1.0685,
-    1.06822,
-    1.06793,
-    1.06764,
-    1.06735,
-    1.06706,
-    1.06677,
-    1.06647,
-    1.06617,
-    1.06586,
-    1.06556,
-    1.06525,
-    1.06494,
-    1.06463,
-    1.06431,
-    1.06399,
-    1.06367,
-    1.06335,
-    1.06302,
-    1.06269,
-    1.06236,
-    1.06203,
-    1.06169,
-    1.06136,
-    1.06102,
-    1.06067,
-    1.06033,
-    1.05998,
-    1.05963,
-    1.05927,
-    1.05892,
-    1.05856,
-    1.0582,
-    1.05784,
-    1.05747,
-    1.0571,
-    1.05673,
-    1.05636,
-    1.05598,
-    1.05561,
-    1.05522,
-    1.05484,
-    1.05446,
-    1.05407,
-    1.05368,
-    1.05329,
-    1.05289,
-    1.05249,
-    1.05209,
-    1.05169,
-    1.05128,
-    1.05088,
-    1.05046,
-    1.05005,
-    1.04964,
-    1.04922,
-    1.0488,
-    1.04838,
-    1.04795,
-    1.04752,
-    1.04709,
-    1.04666,
-    1.04623,
-    1.04579,
-    1.04535,
-    1.04491,
-    1.04446,
-    1.04401,
-    1.04356,
-    1.04311,
-    1.04266,
-    1.0422,
-    1.04174,
-    1.04128,
-    1.04081,
-    1.04035,
-    1.03988,
-    1.03941,
-    1.03893,
-    1.03846,
-    1.03798,
-    1.0375,
-    1.03701,
-    1.03653,
-    1.03604,
-    1.03554,
-    1.03505,
-    1.03455,
-    1.03406,
-    1.03356,
-    1.03305,
-    1.03255,
-    1.03204,
-    1.03153,
-    1.03101,
-    1.0305,
-    1.02998,
-    1.02946,
-    1.02894,
-    1.02841,
-    1.02788,
-    1.02735,
-    1.02682,
-    1.02629,
-    1.02575,
-    1.02521,
-    1.02467,
-    1.02412,
-    1.02357,
-    1.02303,
-    1.02247,
-    1.02192,
-    1.02136,
-    1.0208,
-    1.02024,
-    1.01968,
-    1.01911,
-    1.01854,
-    1.01797,
-    1.0174,
-    1.01682,
-    1.01624,
-    1.01566,
-    1.01508,
-    1.0145,
-    1.01391,
-    1.01332,
-    1.01272,
-    1.01213,
-    1.01153,
-    1.01093,
-    1.01033,
-    1.00973,
-    1.00912,
-    1.00851,
-    1.0079,
-    1.00728,
-    1.00667,
-    1.00605,
-    1.00543,
-    1.0048,
-    1.00418,
-    1.00355,
-    1.00292,
-    1.00229,
-    1.00165,
-    1.00101,
-    1.00037,
-    0.999732,
-    0.999087,
-    0.99844,
-    0.997791,
-    0.997139,
-    0.996485,
-    0.995828,
-    0.99517,
-    0.994508,
-    0.993845,
-    0.993179,
-    0.992511,
-    0.991841,
-    0.991168,
-    0.990493,
-    0.989815,
-    0.989135,
-    0.988453,
-    0.987769,
-    0.987082,
-    0.986393,
-    0.985702,
-    0.985008,
-    0.984312,
-    0.983613,
-    0.982913,
-    0.98221,
-    0.981505,
-    0.980797,
-    0.980087,
-    0.979375,
-    0.97866,
-    0.977943,
-    0.977224,
-    0.976503,
-    0.975779,
-    0.975053,
-    0.974325,
-    0.973594,
-    0.972861,
-    0.972126,
-    0.971389,
-    0.970649,
-    0.969907,
-    0.969162,
-    0.968416,
-    0.967667,
-    0.966916,
-    0.966162,
-    0.965407,
-    0.964649,
-    0.963888,
-    0.963126,
-    0.962361,
-    0.961594,
-    0.960825,
-    0.960053,
-    0.959279,
-    0.958503,
-    0.957725,
-    0.956944,
-    0.956161,
-    0.955376,
-    0.954589,
-    0.953799,
-    0.953007,
-    0.952213,
-    0.951417,
-    0.950618,
-    0.949818,
-    0.949015,
-    0.948209,
-    0.947402,
-    0.946592,
-    0.94578,
-    0.944966,
-    0.944149,
-    0.943331,
-    0.94251,
-    0.941687,
-    0.940862,
-    0.940034,
-    0.939204,
-    0.938372,
-    0.937538,
-    0.936702,
-    0.935863,
-    0.935023,
-    0.93418,
-    0.933335,
-    0.932487,
-    0.931638,
-    0.930786,
-    0.929932,
-    0.929076,
-    0.928218,
-    0.927357,
-    0.926495,
-    0.92563,
-    0.924763,
-    0.923894,
-    0.923022,
-    0.922149,
-    0.921273,
-    0.920395,
-    0.919515,
-    0.918633,
-    0.917748,
-    0.916862,
-    0.915973,
-    0.915082,
-    0.914189,
-    0.913294,
-    0.912397,
-    0.911498,
-    0.910596,
-    0.909692,
-    0.908786,
-    0.907878,
-    0.906968,
-    0.906056,
-    0.905142,
-    0.904225,
-    0.903306,
-    0.902386,
-    0.901463,
-    0.900538,
-    0.89961,
-    0.898681,
-    0.89775,
-    0.896816,
-    0.895881,
-    0.894943,
-    0.894003,
-    0.893061,
-    0.892117,
-    0.891171,
-    0.890223,
-    0.889273,
-    0.88832,
-    0.887366,
-    0.886409,
-    0.88545,
-    0.88449,
-    0.883527,
-    0.882562,
-    0.881595,
-    0.880626,
-    0.879655,
-    0.878681,
-    0.877706,
-    0.876729,
-    0.875749,
-    0.874768,
-    0.873784,
-    0.872799,
-    0.871811,
-    0.870821,
-    0.86983,
-    0.868836,
-    0.86784,
-    0.866842,
-    0.865842,
-    0.86484,
-    0.863836,
-    0.86283,
-    0.861822,
-    0.860812,
-    0.8598,
-    0.858786,
-    0.85777,
-    0.856752,
-    0.855732,
-    0.854709,
-    0.853685,
-    0.852659,
-    0.851631,
-    0.8506,
-    0.849568,
-    0.848534,
-    0.847498,
-    0.84646,
-    0.845419,
-    0.844377,
-    0.843333,
-    0.842287,
-    0.841239,
-    0.840189,
-    0.839136,
-    0.838082,
-    0.837026,
-    0.835968,
-    0.834908,
-    0.833846,
-    0.832782,
-    0.831717,
-    0.830649,
-    0.829579,
-    0.828507,
-    0.827434,
-    0.826358,
-    0.82528,
-    0.824201,
-    0.823119,
-    0.822036,
-    0.820951,
-    0.819863,
-    0.818774,
-    0.817683,
-    0.81659,
-    0.815495,
-    0.814398,
-    0.813299,
-    0.812199,
-    0.811096,
-    0.809991,
-    0.808885,
-    0.807777,
-    0.806666,
-    0.805554,
-    0.80444,
-    0.803324,
-    0.802206,
-    0.801087,
-    0.799965,
-    0.798842,
-    0.797716,
-    0.796589,
-    0.79546,
-    0.794329,
-    0.793196,
-    0.792061,
-    0.790925,
-    0.789786,
-    0.788646,
-    0.787504,
-    0.78636,
-    0.785214,
-    0.784066,
-    0.782917,
-    0.781765,
-    0.780612,
-    0.779457,
-    0.7783,
-    0.777142,
-    0.775981,
-    0.774819,
-    0.773654,
-    0.772488,
-    0.77132,
-    0.770151,
-    0.768979,
-    0.767806,
-    0.766631,
-    0.765454,
-    0.764275,
-    0.763095,
-    0.761913,
-    0.760728,
-    0.759543,
-    0.758355,
-    0.757165,
-    0.755974,
-    0.754781,
-    0.753586,
-    0.75239,
-    0.751192,
-    0.749991,
-    0.74879,
-    0.747586,
-    0.746381,
-    0.745173,
-    0.743965,
-    0.742754,
-    0.741542,
-    0.740327,
-    0.739112,
-    0.737894,
-    0.736675,
-    0.735453,
-    0.734231,
-    0.733006,
-    0.73178,
-    0.730552,
-    0.729322,
-    0.728091,
-    0.726858,
-    0.725623,
-    0.724386,
-    0.723148,
-    0.721908,
-    0.720666,
-    0.719423,
-    0.718178,
-    0.716931,
-    0.715683,
-    0.714433,
-    0.713181,
-    0.711927,
-    0.710672,
-    0.709415,
-    0.708157,
-    0.706897,
-    0.705635,
-    0.704371,
-    0.703106,
-    0.701839,
-    0.700571,
-    0.699301,
-    0.698029,
-    0.696756,
-    0.695481,
-    0.694204,
-    0.692926,
-    0.691646,
-    0.690364,
-    0.689081,
-    0.687796,
-    0.68651,
-    0.685222,
-    0.683932,
-    0.682641,
-    0.681348,
-    0.680054,
-    0.678758,
-    0.67746,
-    0.676161,
-    0.67486,
-    0.673558,
-    0.672254,
-    0.670948,
-    0.669641,
-    0.668332,
-    0.667022,
-    0.66571,
-    0.664396,
-    0.663081,
-    0.661765,
-    0.660447,
-    0.659127,
-    0.657806,
-    0.656483,
-    0.655159,
-    0.653833,
-    0.652505,
-    0.651176,
-    0.649846,
-    0.648514,
-    0.64718,
-    0.645845,
-    0.644509,
-    0.643171,
-    0.641831,
-    0.64049,
-    0.639147,
-    0.637803,
-    0.636457,
-    0.63511,
-    0.633762,
-    0.632411,
-    0.63106,
-    0.629707,
-    0.628352,
-    0.626996,
-    0.625639,
-    0.62428,
-    0.622919,
-    0.621557,
-    0.620194,
-    0.618829,
-    0.617463,
-    0.616095,
-    0.614726,
-    0.613355,
-    0.611983,
-    0.610609,
-    0.609234,
-    0.607858,
-    0.60648,
-    0.605101,
-    0.60372,
-    0.602338,
-    0.600955,
-    0.59957,
-    0.598183,
-    0.596795,
-    0.595406,
-    0.594016,
-    0.592624,
-    0.59123,
-    0.589836,
-    0.588439,
-    0.587042,
-    0.585643,
-    0.584243,
-    0.582841,
-    0.581438,
-    0.580034,
-    0.578628,
-    0.577221,
-    0.575812,
-    0.574402,
-    0.572991,
-    0.571579,
-    0.570165,
-    0.56875,
-    0.567333,
-    0.565915,
-    0.564496,
-    0.563075,
-    0.561653,
-    0.56023,
-    0.558806,
-    0.55738,
-    0.555953,
-    0.554524,
-    0.553094,
-    0.551663,
-    0.550231,
-    0.548797,
-    0.547362,
-    0.545926,
-    0.544489,
-    0.54305,
-    0.54161,
-    0.540168,
-    0.538726,
-    0.537282,
-    0.535837,
-    0.53439,
-    0.532943,
-    0.531494,
-    0.530043,
-    0.528592,
-    0.527139,
-    0.525685,
-    0.52423,
-    0.522774,
-    0.521316,
-    0.519857,
-    0.518397,
-    0.516936,
-    0.515474,
-    0.51401,
-    0.512545,
-    0.511079,
-    0.509612,
-    0.508143,
-    0.506673,
-    0.505202,
-    0.50373,
-    0.502257,
-    0.500782,
-    0.499307,
-    0.49783,
-    0.496352,
-    0.494873,
-    0.493392,
-    0.491911,
-    0.490428,
-    0.488945,
-    0.48746,
-    0.485973,
-    0.484486,
-    0.482998,
-    0.481508,
-    0.480018,
-    0.478526,
-    0.477033,
-    0.475539,
-    0.474044,
-    0.472547,
-    0.47105,
-    0.469552,
-    0.468052,
-    0.466551,
-    0.46505,
-    0.463547,
-    0.462043,
-    0.460538,
-    0.459031,
-    0.457524,
-    0.456016,
-    0.454507,
-    0.452996,
-    0.451485,
-    0.449972,
-    0.448458,
-    0.446944,
-    0.445428,
-    0.443911,
-    0.442393,
-    0.440874,
-    0.439354,
-    0.437834,
-    0.436312,
-    0.434789,
-    0.433265,
-    0.431739,
-    0.430213,
-    0.428686,
-    0.427158,
-    0.425629,
-    0.424099,
-    0.422568,
-    0.421036,
-    0.419503,
-    0.417969,
-    0.416434,
-    0.414898,
-    0.413361,
-    0.411823,
-    0.410284,
-    0.408744,
-    0.407203,
-    0.405661,
-    0.404118,
-    0.402575,
-    0.40103,
-    0.399484,
-    0.397938,
-    0.39639,
-    0.394842,
-    0.393292,
-    0.391742,
-    0.390191,
-    0.388639,
-    0.387086,
-    0.385532,
-    0.383977,
-    0.382421,
-    0.380865,
-    0.379307,
-    0.377749,
-    0.376189,
-    0.374629,
-    0.373068,
-    0.371506,
-    0.369943,
-    0.368379,
-    0.366815,
-    0.365249,
-    0.363683,
-    0.362116,
-    0.360548,
-    0.358979,
-    0.357409,
-    0.355839,
-    0.354267,
-    0.352695,
-    0.351122,
-    0.349548,
-    0.347973,
-    0.346398,
-    0.344821,
-    0.343244,
-    0.341666,
-    0.340087,
-    0.338508,
-    0.336928,
-    0.335346,
-    0.333764,
-    0.332182,
-    0.330598,
-    0.329014,
-    0.327429,
-    0.325843,
-    0.324256,
-    0.322669,
-    0.321081,
-    0.319492,
-    0.317902,
-    0.316312,
-    0.314721,
-    0.313129,
-    0.311536,
-    0.309943,
-    0.308349,
-    0.306754,
-    0.305159,
-    0.303562,
-    0.301965,
-    0.300368,
-    0.298769,
-    0.29717,
-    0.295571,
-    0.29397,
-    0.292369,
-    0.290767,
-    0.289165,
-    0.287561,
-    0.285958,
-    0.284353,
-    0.282748,
-    0.281142,
-    0.279535,
-    0.277928,
-    0.27632,
-    0.274712,
-    0.273103,
-    0.271493,
-    0.269882,
-    0.268271,
-    0.26666,
-    0.265047,
-    0.263434,
-    0.261821,
-    0.260206,
-    0.258592,
-    0.256976,
-    0.25536,
-    0.253744,
-    0.252126,
-    0.250509,
-    0.24889,
-    0.247271,
-    0.245652,
-    0.244031,
-    0.242411,
-    0.240789,
-    0.239168,
-    0.237545,
-    0.235922,
-    0.234299,
-    0.232675,
-    0.23105,
-    0.229425,
-    0.227799,
-    0.226173,
-    0.224546,
-    0.222919,
-    0.221291,
-    0.219662,
-    0.218034,
-    0.216404,
-    0.214774,
-    0.213144,
-    0.211513,
-    0.209882,
-    0.20825,
-    0.206617,
-    0.204984,
-    0.203351,
-    0.201717,
-    0.200083,
-    0.198448,
-    0.196813,
-    0.195177,
-    0.193541,
-    0.191904,
-    0.190267,
-    0.18863,
-    0.186992,
-    0.185353,
-    0.183715,
-    0.182075,
-    0.180436,
-    0.178795,
-    0.177155,
-    0.175514,
-    0.173873,
-    0.172231,
-    0.170589,
-    0.168946,
-    0.167303,
-    0.16566,
-    0.164016,
-    0.162372,
-    0.160727,
-    0.159082,
-    0.157437,
-    0.155791,
-    0.154145,
-    0.152499,
-    0.150852,
-    0.149205,
-    0.147558,
-    0.14591,
-    0.144262,
-    0.142613,
-    0.140964,
-    0.139315,
-    0.137666,
-    0.136016,
-    0.134366,
-    0.132715,
-    0.131064,
-    0.129413,
-    0.127762,
-    0.12611,
-    0.124458,
-    0.122806,
-    0.121154,
-    0.119501,
-    0.117848,
-    0.116194,
-    0.114541,
-    0.112887,
-    0.111232,
-    0.109578,
-    0.107923,
-    0.106268,
-    0.104613,
-    0.102958,
-    0.101302,
-    0.0996458,
-    0.0979897,
-    0.0963332,
-    0.0946766,
-    0.0930197,
-    0.0913626,
-    0.0897053,
-    0.0880478,
-    0.0863901,
-    0.0847322,
-    0.083074,
-    0.0814157,
-    0.0797572,
-    0.0780985,
-    0.0764396,
-    0.0747806,
-    0.0731213,
-    0.0714619,
-    0.0698024,
-    0.0681426,
-    0.0664827,
-    0.0648227,
-    0.0631624,
-    0.0615021,
-    0.0598416,
-    0.0581809,
-    0.0565201,
-    0.0548592,
-    0.0531982,
-    0.051537,
-    0.0498757,
-    0.0482143,
-    0.0465528,
-    0.0448912,
-    0.0432294,
-    0.0415676,
-    0.0399056,
-    0.0382436,
-    0.0365815,
-    0.0349193,
-    0.033257,
-    0.0315946,
-    0.0299322,
-    0.0282697,
-    0.0266071,
-    0.0249445,
-    0.0232818,
-    0.021619,
-    0.0199562,
-    0.0182934,
-    0.0166305,
-    0.0149675,
-    0.0133046,
-    0.0116416,
-    0.00997853,
-    0.00831547,
-    0.0066524,
-    0.00498932,
-    0.00332622,
-    0.00166311,
-    0,
-    -0.00166311,
-    -0.00332622,
-    -0.00498932,
-    -0.0066524,
-    -0.00831547,
-    -0.00997853,
-    -0.0116416,
-    -0.0133046,
-    -0.0149675,
-    -0.0166305,
-    -0.0182934,
-    -0.0199562,
-    -0.021619,
-    -0.0232818,
-    -0.0249445,
-    -0.0266071,
-    -0.0282697,
-    -0.0299322,
-    -0.0315946,
-    -0.033257,
-    -0.0349193,
-    -0.0365815,
-    -0.0382436,
-    -0.0399056,
-    -0.0415676,
-    -0.0432294,
-    -0.0448912,
-    -0.0465528,
-    -0.0482143,
-    -0.0498757,
-    -0.051537,
-    -0.0531982,
-    -0.0548592,
-    -0.0565201,
-    -0.0581809,
-    -0.0598416,
-    -0.0615021,
-    -0.0631624,
-    -0.0648227,
-    -0.0664827,
-    -0.0681426,
-    -0.0698024,
-    -0.0714619,
-    -0.0731213,
-    -0.0747806,
-    -0.0764396,
-    -0.0780985,
-    -0.0797572,
-    -0.0814157,
-    -0.083074,
-    -0.0847322,
-    -0.0863901,
-    -0.0880478,
-    -0.0897053,
-    -0.0913626,
-    -0.0930197,
-    -0.0946766,
-    -0.0963332,
-    -0.0979897,
-    -0.0996458,
-    -0.101302,
-    -0.102958,
-    -0.104613,
-    -0.106268,
-    -0.107923,
-    -0.109578,
-    -0.111232,
-    -0.112887,
-    -0.114541,
-    -0.116194,
-    -0.117848,
-    -0.119501,
-    -0.121154,
-    -0.122806,
-    -0.124458,
-    -0.12611,
-    -0.127762,
-    -0.129413,
-    -0.131064,
-    -0.132715,
-    -0.134366,
-    -0.136016,
-    -0.137666,
-    -0.139315,
-    -0.140964,
-    -0.142613,
-    -0.144262,
-    -0.14591,
-    -0.147558,
-    -0.149205,
-    -0.150852,
-    -0.152499,
-    -0.154145,
-    -0.155791,
-    -0.157437,
-    -0.159082,
-    -0.160727,
-    -0.162372,
-    -0.164016,
-    -0.16566,
-    -0.167303,
-    -0.168946,
-    -0.170589,
-    -0.172231,
-    -0.173873,
-    -0.175514,
-    -0.177155,
-    -0.178795,
-    -0.180436,
-    -0.182075,
-    -0.183715,
-    -0.185353,
-    -0.186992,
-    -0.18863,
-    -0.190267,
-    -0.191904,
-    -0.193541,
-    -0.195177,
-    -0.196813,
-    -0.198448,
-    -0.200083,
-    -0.201717,
-    -0.203351,
-    -0.204984,
-    -0.206617,
-    -0.20825,
-    -0.209882,
-    -0.211513,
-    -0.213144,
-    -0.214774,
-    -0.216404,
-    -0.218034,
-    -0.219662,
-    -0.221291,
-    -0.222919,
-    -0.224546,
-    -0.226173,
-    -0.227799,
-    -0.229425,
-    -0.23105,
-    -0.232675,
-    -0.234299,
-    -0.235922,
-    -0.237545,
-    -0.239168,
-    -0.240789,
-    -0.242411,
-    -0.244031,
-    -0.245652,
-    -0.247271,
-    -0.24889,
-    -0.250509,
-    -0.252126,
-    -0.253744,
-    -0.25536,
-    -0.256976,
-    -0.258592,
-    -0.260206,
-    -0.261821,
-    -0.263434,
-    -0.265047,
-    -0.26666,
-    -0.268271,
-    -0.269882,
-    -0.271493,
-    -0.273103,
-    -0.274712,
-    -0.27632,
-    -0.277928,
-    -0.279535,
-    -0.281142,
-    -0.282748,
-    -0.284353,
-    -0.285958,
-    -0.287561,
-    -0.289165,
-    -0.290767,
-    -0.292369,
-    -0.29397,
-    -0.295571,
-    -0.29717,
-    -0.298769,
-    -0.300368,
-    -0.301965,
-    -0.303562,
-    -0.305159,
-    -0.306754,
-    -0.308349,
-    -0.309943,
-    -0.311536,
-    -0.313129,
-    -0.314721,
-    -0.316312,
-    -0.317902,
-    -0.319492,
-    -0.321081,
-    -0.322669,
-    -0.324256,
-    -0.325843,
-    -0.327429,
-    -0.329014,
-    -0.330598,
-    -0.332182,
-    -0.333764,
-    -0.335346,
-    -0.336928,
-    -0.338508,
-    -0.340087,
-    -0.341666,
-    -0.343244,
-    -0.344821,
-    -0.346398,
-    -0.347973,
-    -0.349548,
-    -0.351122,
-    -0.352695,
-    -0.354267,
-    -0.355839,
-    -0.357409,
-    -0.358979,
-    -0.360548,
-    -0.362116,
-    -0.363683,
-    -0.365249,
-    -0.366815,
-    -0.368379,
-    -0.369943,
-    -0.371506,
-    -0.373068,
-    -0.374629,
-    -0.376189,
-    -0.377749,
-    -0.379307,
-    -0.380865,
-    -0.382421,
-    -0.383977,
-    -0.385532,
-    -0.387086,
-    -0.388639,
-    -0.390191,
-    -0.391742,
-    -0.393292,
-    -0.394842,
-    -0.39639,
-    -0.397938,
-    -0.399484,
-    -0.40103,
-    -0.402575,
-    -0.404118,
-    -0.405661,
-    -0.407203,
-    -0.408744,
-    -0.410284,
-    -0.411823,
-    -0.413361,
-    -0.414898,
-    -0.416434,
-    -0.417969,
-    -0.419503,
-    -0.421036,
-    -0.422568,
-    -0.424099,
-    -0.425629,
-    -0.427158,
-    -0.428686,
-    -0.430213,
-    -0.431739,
-    -0.433265,
-    -0.434789,
-    -0.436312,
-    -0.437834,
-    -0.439354,
-    -0.440874,
-    -0.442393,
-    -0.443911,
-    -0.445428,
-    -0.446944,
-    -0.448458,
-    -0.449972,
-    -0.451485,
-    -0.452996,
-    -0.454507,
-    -0.456016,
-    -0.457524,
-    -0.459031,
-    -0.460538,
-    -0.462043,
-    -0.463547,
-    -0.46505,
-    -0.466551,
-    -0.468052,
-    -0.469552,
-    -0.47105,
-    -0.472547,
-    -0.474044,
-    -0.475539,
-    -0.477033,
-    -0.478526,
-    -0.480018,
-    -0.481508,
-    -0.482998,
-    -0.484486,
-    -0.485973,
-    -0.48746,
-    -0.488945,
-    -0.490428,
-    -0.491911,
-    -0.493392,
-    -0.494873,
-    -0.496352,
-    -0.49783,
-    -0.499307,
-    -0.500782,
-    -0.502257,
-    -0.50373,
-    -0.505202,
-    -0.506673,
-    -0.508143,
-    -0.509612,
-    -0.511079,
-    -0.512545,
-    -0.51401,
-    -0.515474,
-    -0.516936,
-    -0.518397,
-    -0.519857,
-    -0.521316,
-    -0.522774,
-    -0.52423,
-    -0.525685,
-    -0.527139,
-    -0.528592,
-    -0.530043,
-    -0.531494,
-    -0.532943,
-    -0.53439,
-    -0.535837,
-    -0.537282,
-    -0.538726,
-    -0.540168,
-    -0.54161,
-    -0.54305,
-    -0.544489,
-    -0.545926,
-    -0.547362,
-    -0.548797,
-    -0.550231,
-    -0.551663,
-    -0.553094,
-    -0.554524,
-    -0.555953,
-    -0.55738,
-    -0.558806,
-    -0.56023,
-    -0.561653,
-    -0.563075,
-    -0.564496,
-    -0.565915,
-    -0.567333,
-    -0.56875,
-    -0.570165,
-    -0.571579,
-    -0.572991,
-    -0.574402,
-    -0.575812,
-    -0.577221,
-    -0.578628,
-    -0.580034,
-    -0.581438,
-    -0.582841,
-    -0.584243,
-    -0.585643,
-    -0.587042,
-    -0.588439,
-    -0.589836,
-    -0.59123,
-    -0.592624,
-    -0.594016,
-    -0.595406,
-    -0.596795,
-    -0.598183,
-    -0.59957,
-    -0.600955,
-    -0.602338,
-    -0.60372,
-    -0.605101,
-    -0.60648,
-    -0.607858,
-    -0.609234,
-    -0.610609,
-    -0.611983,
-    -0.613355,
-    -0.614726,
-    -0.616095,
-    -0.617463,
-    -0.618829,
-    -0.620194,
-    -0.621557,
-    -0.622919,
-    -0.62428,
-    -0.625639,
-    -0.626996,
-    -0.628352,
-    -0.629707,
-    -0.63106,
-    -0.632411,
-    -0.633762,
-    -0.63511,
-    -0.636457,
-    -0.637803,
-    -0.639147,
-    -0.64049,
-    -0.641831,
-    -0.643171,
-    -0.644509,
-    -0.645845,
-    -0.64718,
-    -0.648514,
-    -0.649846,
-    -0.651176,
-    -0.652505,
-    -0.653833,
-    -0.655159,
-    -0.656483,
-    -0.657806,
-    -0.659127,
-    -0.660447,
-    -0.661765,
-    -0.663081,
-    -0.664396,
-    -0.66571,
-    -0.667022,
-    -0.668332,
-    -0.669641,
-    -0.670948,
-    -0.672254,
-    -0.673558,
-    -0.67486,
-    -0.676161,
-    -0.67746,
-    -0.678758,
-    -0.680054,
-    -0.681348,
-    -0.682641,
-    -0.683932,
-    -0.685222,
-    -0.68651,
-    -0.687796,
-    -0.689081,
-    -0.690364,
-    -0.691646,
-    -0.692926,
-    -0.694204,
-    -0.695481,
-    -0.696756,
-    -0.698029,
-    -0.699301,
-    -0.700571,
-    -0.701839,
-    -0.703106,
-    -0.704371,
-    -0.705635,
-    -0.706897,
-    -0.708157,
-    -0.709415,
-    -0.710672,
-    -0.711927,
-    -0.713181,
-    -0.714433,
-    -0.715683,
-    -0.716931,
-    -0.718178,
-    -0.719423,
-    -0.720666,
-    -0.721908,
-    -0.723148,
-    -0.724386,
-    -0.725623,
-    -0.726858,
-    -0.728091,
-    -0.729322,
-    -0.730552,
-    -0.73178,
-    -0.733006,
-    -0.734231,
-    -0.735453,
-    -0.736675,
-    -0.737894,
-    -0.739112,
-    -0.740327,
-    -0.741542,
-    -0.742754,
-    -0.743965,
-    -0.745173,
-    -0.746381,
-    -0.747586,
-    -0.74879,
-    -0.749991,
-    -0.751192,
-    -0.75239,
-    -0.753586,
-    -0.754781,
-    -0.755974,
-    -0.757165,
-    -0.758355,
-    -0.759543,
-    -0.760728,
-    -0.761913,
-    -0.763095,
-    -0.764275,
-    -0.765454,
-    -0.766631,
-    -0.767806,
-    -0.768979,
-    -0.770151,
-    -0.77132,
-    -0.772488,
-    -0.773654,
-    -0.774819,
-    -0.775981,
-    -0.777142,
-    -0.7783,
-    -0.779457,
-    -0.780612,
-    -0.781765,
-    -0.782917,
-    -0.784066,
-    -0.785214,
-    -0.78636,
-    -0.787504,
-    -0.788646,
-    -0.789786,
-    -0.790925,
-    -0.792061,
-    -0.793196,
-    -0.794329,
-    -0.79546,
-    -0.796589,
-    -0.797716,
-    -0.798842,
-    -0.799965,
-    -0.801087,
-    -0.802206,
-    -0.803324,
-    -0.80444,
-    -0.805554,
-    -0.806666,
-    -0.807777,
-    -0.808885,
-    -0.809991,
-    -0.811096,
-    -0.812199,
-    -0.813299,
-    -0.814398,
-    -0.815495,
-    -0.81659,
-    -0.817683,
-    -0.818774,
-    -0.819863,
-    -0.820951,
-    -0.822036,
-    -0.823119,
-    -0.824201,
-    -0.82528,
-    -0.826358,
-    -0.827434,
-    -0.828507,
-    -0.829579,
-    -0.830649,
-    -0.831717,
-    -0.832782,
-    -0.833846,
-    -0.834908,
-    -0.835968,
-    -0.837026,
-    -0.838082,
-    -0.839136,
-    -0.840189,
-    -0.841239,
-    -0.842287,
-    -0.843333,
-    -0.844377,
-    -0.845419,
-    -0.84646,
-    -0.847498,
-    -0.848534,
-    -0.849568,
-    -0.8506,
-    -0.851631,
-    -0.852659,
-    -0.853685,
-    -0.854709,
-    -0.855732,
-    -0.856752,
-    -0.85777,
-    -0.858786,
-    -0.8598,
-    -0.860812,
-    -0.861822,
-    -0.86283,
-    -0.863836,
-    -0.86484,
-    -0.865842,
-    -0.866842,
-    -0.86784,
-    -0.868836,
-    -0.86983,
-    -0.870821,
-    -0.871811,
-    -0.872799,
-    -0.873784,
-    -0.874768,
-    -0.875749,
-    -0.876729,
-    -0.877706,
-    -0.878681,
-    -0.879655,
-    -0.880626,
-    -0.881595,
-    -0.882562,
-    -0.883527,
-    -0.88449,
-    -0.88545,
-    -0.886409,
-    -0.887366,
-    -0.88832,
-    -0.889273,
-    -0.890223,
-    -0.891171,
-    -0.892117,
-    -0.893061,
-    -0.894003,
-    -0.894943,
-    -0.895881,
-    -0.896816,
-    -0.89775,
-    -0.898681,
-    -0.89961,
-    -0.900538,
-    -0.901463,
-    -0.902386,
-    -0.903306,
-    -0.904225,
-    -0.905142,
-    -0.906056,
-    -0.906968,
-    -0.907878,
-    -0.908786,
-    -0.909692,
-    -0.910596,
-    -0.911498,
-    -0.912397,
-    -0.913294,
-    -0.914189,
-    -0.915082,
-    -0.915973,
-    -0.916862,
-    -0.917748,
-    -0.918633,
-    -0.919515,
-    -0.920395,
-    -0.921273,
-    -0.922149,
-    -0.923022,
-    -0.923894,
-    -0.924763,
-    -0.92563,
-    -0.926495,
-    -0.927357,
-    -0.928218,
-    -0.929076,
-    -0.929932,
-    -0.930786,
-    -0.931638,
-    -0.932487,
-    -0.933335,
-    -0.93418,
-    -0.935023,
-    -0.935863,
-    -0.936702,
-    -0.937538,
-    -0.938372,
-    -0.939204,
-    -0.940034,
-    -0.940862,
-    -0.941687,
-    -0.94251,
-    -0.943331,
-    -0.944149,
-    -0.944966,
-    -0.94578,
-    -0.946592,
-    -0.947402,
-    -0.948209,
-    -0.949015,
-    -0.949818,
-    -0.950618,
-    -0.951417,
-    -0.952213,
-    -0.953007,
-    -0.953799,
-    -0.954589,
-    -0.955376,
-    -0.956161,
-    -0.956944,
-    -0.957725,
-    -0.958503,
-    -0.959279,
-    -0.960053,
-    -0.960825,
-    -0.961594,
-    -0.962361,
-    -0.963126,
-    -0.963888,
-    -0.964649,
-    -0.965407,
-    -0.966162,
-    -0.966916,
-    -0.967667,
-    -0.968416,
-    -0.969162,
-    -0.969907,
-    -0.970649,
-    -0.971389,
-    -0.972126,
-    -0.972861,
-    -0.973594,
-    -0.974325,
-    -0.975053,
-    -0.975779,
-    -0.976503,
-    -0.977224,
-    -0.977943,
-    -0.97866,
-    -0.979375,
-    -0.980087,
-    -0.980797,
-    -0.981505,
-    -0.98221,
-    -0.982913,
-    -0.983613,
-    -0.984312,
-    -0.985008,
-    -0.985702,
-    -0.986393,
-    -0.987082,
-    -0.987769,
-    -0.988453,
-    -0.989135,
-    -0.989815,
-    -0.990493,
-    -0.991168,
-    -0.991841,
-    -0.992511,
-    -0.993179,
-    -0.993845,
-    -0.994508,
-    -0.99517,
-    -0.995828,
-    -0.996485,
-    -0.997139,
-    -0.997791,
-    -0.99844,
-    -0.999087,
-    -0.999732,
-    -1.00037,
-    -1.00101,
-    -1.00165,
-    -1.00229,
-    -1.00292,
-    -1.00355,
-    -1.00418,
-    -1.0048,
-    -1.00543,
-    -1.00605,
-    -1.00667,
-    -1.00728,
-    -1.0079,
-    -1.00851,
-    -1.00912,
-    -1.00973,
-    -1.01033,
-    -1.01093,
-    -1.01153,
-    -1.01213,
-    -1.01272,
-    -1.01332,
-    -1.01391,
-    -1.0145,
-    -1.01508,
-    -1.01566,
-    -1.01624,
-    -1.01682,
-    -1.0174,
-    -1.01797,
-    -1.01854,
-    -1.01911,
-    -1.01968,
-    -1.02024,
-    -1.0208,
-    -1.02136,
-    -1.02192,
-    -1.02247,
-    -1.02303,
-    -1.02357,
-    -1.02412,
-    -1.02467,
-    -1.02521,
-    -1.02575,
-    -1.02629,
-    -1.02682,
-    -1.02735,
-    -1.02788,
-    -1.02841,
-    -1.02894,
-    -1.02946,
-    -1.02998,
-    -1.0305,
-    -1.03101,
-    -1.03153,
-    -1.03204,
-    -1.03255,
-    -1.03305,
-    -1.03356,
-    -1.03406,
-    -1.03455,
-    -1.03505,
-    -1.03554,
-    -1.03604,
-    -1.03653,
-    -1.03701,
-    -1.0375,
-    -1.03798,
-    -1.03846,
-    -1.03893,
-    -1.03941,
-    -1.03988,
-    -1.04035,
-    -1.04081,
-    -1.04128,
-    -1.04174,
-    -1.0422,
-    -1.04266,
-    -1.04311,
-    -1.04356,
-    -1.04401,
-    -1.04446,
-    -1.04491,
-    -1.04535,
-    -1.04579,
-    -1.04623,
-    -1.04666,
-    -1.04709,
-    -1.04752,
-    -1.04795,
-    -1.04838,
-    -1.0488,
-    -1.04922,
-    -1.04964,
-    -1.05005,
-    -1.05046,
-    -1.05088,
-    -1.05128,
-    -1.05169,
-    -1.05209,
-    -1.05249,
-    -1.05289,
-    -1.05329,
-    -1.05368,
-    -1.05407,
-    -1.05446,
-    -1.05484,
-    -1.05522,
-    -1.05561,
-    -1.05598,
-    -1.05636,
-    -1.05673,
-    -1.0571,
-    -1.05747,
-    -1.05784,
-    -1.0582,
-    -1.05856,
-    -1.05892,
-    -1.05927,
-    -1.05963,
-    -1.05998,
-    -1.06033,
-    -1.06067,
-    -1.06102,
-    -1.06136,
-    -1.06169,
-    -1.06203,
-    -1.06236,
-    -1.06269,
-    -1.06302,
-    -1.06335,
-    -1.06367,
-    -1.06399,
-    -1.06431,
-    -1.06463,
-    -1.06494,
-    -1.06525,
-    -1.06556,
-    -1.06586,
-    -1.06617,
-    -1.06647,
-    -1.06677,
-    -1.06706,
-    -1.06735,
-    -1.06764,
-    -1.06793,
-    -1.06822,
-    -1.0685,
-    -1.06878,
-    -1.06906,
-    -1.06934,
-    -1.06961,
-    -1.06988,
-    -1.07015,
-    -1.07041,
-    -1.07068,
-    -1.07094,
-    -1.07119,
-    -1.07145,
-    -1.0717,
-    -1.07195,
-    -1.0722,
-    -1.07245,
-    -1.07269,
-    -1.07293,
-    -1.07317,
-    -1.0734,
-    -1.07363,
-    -1.07386,
-    -1.07409,
-    -1.07432,
-    -1.07454,
-    -1.07476,
-    -1.07498,
-    -1.07519,
-    -1.0754,
-    -1.07561,
-    -1.07582,
-    -1.07603,
-    -1.07623,
-    -1.07643,
-    -1.07663,
-    -1.07682,
-    -1.07701,
-    -1.0772,
-    -1.07739,
-    -1.07757,
-    -1.07776,
-    -1.07794,
-    -1.07811,
-    -1.07829,
-    -1.07846,
-    -1.07863,
-    -1.07879,
-    -1.07896,
-    -1.07912,
-    -1.07928,
-    -1.07944,
-    -1.07959,
-    -1.07974,
-    -1.07989,
-    -1.08004,
-    -1.08018,
-    -1.08032,
-    -1.08046,
-    -1.0806,
-    -1.08073,
-    -1.08086,
-    -1.08099,
-    -1.08112,
-    -1.08124,
-    -1.08136,
-    -1.08148,
-    -1.0816,
-    -1.08171,
-    -1.08182,
-    -1.08193,
-    -1.08204,
-    -1.08214,
-    -1.08224,
-    -1.08234,
-    -1.08243,
-    -1.08253,
-    -1.08262,
-    -1.08271,
-    -1.08279,
-    -1.08287,
-    -1.08295,
-    -1.08303,
-    -1.08311,
-    -1.08318,
-    -1.08325,
-    -1.08332,
-    -1.08338,
-    -1.08345,
-    -1.08351,
-    -1.08356,
-    -1.08362,
-    -1.08367,
-    -1.08372,
-    -1.08377,
-    -1.08381,
-    -1.08385,
-    -1.08389,
-    -1.08393,
-    -1.08396,
-    -1.084,
-    -1.08403,
-    -1.08405,
-    -1.08408,
-    -1.0841,
-    -1.08412,
-    -1.08413,
-    -1.08415,
-    -1.08416,
-    -1.08417,
-    -1.08417,
-    -1.08418,
-    -1.08418,
-    -1.08418,
-    -1.08417,
-    -1.08417,
-    -1.08416,
-    -1.08415,
-    -1.08413,
-    -1.08412,
-    -1.0841,
-    -1.08408,
-    -1.08405,
-    -1.08403,
-    -1.084,
-    -1.08396,
-    -1.08393,
-    -1.08389,
-    -1.08385,
-    -1.08381,
-    -1.08377,
-    -1.08372,
-    -1.08367,
-    -1.08362,
-    -1.08356,
-    -1.08351,
-    -1.08345,
-    -1.08338,
-    -1.08332,
-    -1.08325,
-    -1.08318,
-    -1.08311,
-    -1.08303,
-    -1.08295,
-    -1.08287,
-    -1.08279,
-    -1.08271,
-    -1.08262,
-    -1.08253,
-    -1.08243,
-    -1.08234,
-    -1.08224,
-    -1.08214,
-    -1.08204,
-    -1.08193,
-    -1.08182,
-    -1.08171,
-    -1.0816,
-    -1.08148,
-    -1.08136,
-    -1.08124,
-    -1.08112,
-    -1.08099,
-    -1.08086,
-    -1.08073,
-    -1.0806,
-    -1.08046,
-    -1.08032,
-    -1.08018,
-    -1.08004,
-    -1.07989,
-    -1.07974,
-    -1.07959,
-    -1.07944,
-    -1.07928,
-    -1.07912,
-    -1.07896,
-    -1.07879,
-    -1.07863,
-    -1.07846,
-    -1.07829,
-    -1.07811,
-    -1.07794,
-    -1.07776,
-    -1.07757,
-    -1.07739,
-    -1.0772,
-    -1.07701,
-    -1.07682,
-    -1.07663,
-    -1.07643,
-    -1.07623,
-    -1.07603,
-    -1.07582,
-    -1.07561,
-    -1.0754,
-    -1.07519,
-    -1.07498,
-    -1.07476,
-    -1.07454,
-    -1.07432,
-    -1.07409,
-    -1.07386,
-    -1.07363,
-    -1.0734,
-    -1.07317,
-    -1.07293,
-    -1.07269,
-    -1.07245,
-    -1.0722,
-    -1.07195,
-    -1.0717,
-    -1.07145,
-    -1.07119,
-    -1.07094,
-    -1.07068,
-    -1.07041,
-    -1.07015,
-    -1.06988,
-    -1.06961,
-    -1.06934,
-    -1.06906,
-    -1.06878,
-    -1.0685,
-    -1.06822,
-    -1.06793,
-    -1.06764,
-    -1.06735,
-    -1.06706,
-    -1.06677,
-    -1.06647,
-    -1.06617,
-    -1.06586,
-    -1.06556,
-    -1.06525,
-    -1.06494,
-    -1.06463,
-    -1.06431,
-    -1.06399,
-    -1.06367,
-    -1.06335,
-    -1.06302,
-    -1.06269,
-    -1.06236,
-    -1.06203,
-    -1.06169,
-    -1.06136,
-    -1.06102,
-    -1.06067,
-    -1.06033,
-    -1.05998,
-    -1.05963,
-    -1.05927,
-    -1.05892,
-    -1.05856,
-    -1.0582,
-    -1.05784,
-    -1.05747,
-    -1.0571,
-    -1.05673,
-    -1.05636,
-    -1.05598,
-    -1.05561,
-    -1.05522,
-    -1.05484,
-    -1.05446,
-    -1.05407,
-    -1.05368,
-    -1.05329,
-    -1.05289,
-    -1.05249,
-    -1.05209,
-    -1.05169,
-    -1.05128,
-    -1.05088,
-    -1.05046,
-    -1.05005,
-    -1.04964,
-    -1.04922,
-    -1.0488,
-    -1.04838,
-    -1.04795,
-    -1.04752,
-    -1.04709,
-    -1.04666,
-    -1.04623,
-    -1.04579,
-    -1.04535,
-    -1.04491,
-    -1.04446,
-    -1.04401,
-    -1.04356,
-    -1.04311,
-    -1.04266,
-    -1.0422,
-    -1.04174,
-    -1.04128,
-    -1.04081,
-    -1.04035,
-    -1.03988,
-    -1.03941,
-    -1.03893,
-    -1.03846,
-    -1.03798,
-    -1.0375,
-    -1.03701,
-    -1.03653,
-    -1.03604,
-    -1.03554,
-    -1.03505,
-    -1.03455,
-    -1.03406,
-    -1.03356,
-    -1.03305,
-    -1.03255,
-    -1.03204,
-    -1.03153,
-    -1.03101,
-    -1.0305,
-    -1.02998,
-    -1.02946,
-    -1.02894,
-    -1.02841,
-    -1.02788,
-    -1.02735,
-    -1.02682,
-    -1.02629,
-    -1.02575,
-    -1.02521,
-    -1.02467,
-    -1.02412,
-    -1.02357,
-    -1.02303,
-    -1.02247,
-    -1.02192,
-    -1.02136,
-    -1.0208,
-    -1.02024,
-    -1.01968,
-    -1.01911,
-    -1.01854,
-    -1.01797,
-    -1.0174,
-    -1.01682,
-    -1.01624,
-    -1.01566,
-    -1.01508,
-    -1.0145,
-    -1.01391,
-    -1.01332,
-    -1.01272,
-    -1.01213,
-    -1.01153,
-    -1.01093,
-    -1.01033,
-    -1.00973,
-    -1.00912,
-    -1.00851,
-    -1.0079,
-    -1.00728,
-    -1.00667,
-    -1.00605,
-    -1.00543,
-    -1.0048,
-    -1.00418,
-    -1.00355,
-    -1.00292,
-    -1.00229,
-    -1.00165,
-    -1.00101,
-    -1.00037,
-    -0.999732,
-    -0.999087,
-    -0.99844,
-    -0.997791,
-    -0.997139,
-    -0.996485,
-    -0.995828,
-    -0.99517,
-    -0.994508,
-    -0.993845,
-    -0.993179,
-    -0.992511,
-    -0.991841,
-    -0.991168,
-    -0.990493,
-    -0.989815,
-    -0.989135,
-    -0.988453,
-    -0.987769,
-    -0.987082,
-    -0.986393,
-    -0.985702,
-    -0.985008,
-    -0.984312,
-    -0.983613,
-    -0.982913,
-    -0.98221,
-    -0.981505,
-    -0.980797,
-    -0.980087,
-    -0.979375,
-    -0.97866,
-    -0.977943,
-    -0.977224,
-    -0.976503,
-    -0.975779,
-    -0.975053,
-    -0.974325,
-    -0.973594,
-    -0.972861,
-    -0.972126,
-    -0.971389,
-    -0.970649,
-    -0.969907,
-    -0.969162,
-    -0.968416,
-    -0.967667,
-    -0.966916,
-    -0.966162,
-    -0.965407,
-    -0.964649,
-    -0.963888,
-    -0.963126,
-    -0.962361,
-    -0.961594,
-    -0.960825,
-    -0.960053,
-    -0.959279,
-    -0.958503,
-    -0.957725,
-    -0.956944,
-    -0.956161,
-    -0.955376,
-    -0.954589,
-    -0.953799,
-    -0.953007,
-    -0.952213,
-    -0.951417,
-    -0.950618,
-    -0.949818,
-    -0.949015,
-    -0.948209,
-    -0.947402,
-    -0.946592,
-    -0.94578,
-    -0.944966,
-    -0.944149,
-    -0.943331,
-    -0.94251,
-    -0.941687,
-    -0.940862,
-    -0.940034,
-    -0.939204,
-    -0.938372,
-    -0.937538,
-    -0.936702,
-    -0.935863,
-    -0.935023,
-    -0.93418,
-    -0.933335,
-    -0.932487,
-    -0.931638,
-    -0.930786,
-    -0.929932,
-    -0.929076,
-    -0.928218,
-    -0.927357,
-    -0.926495,
-    -0.92563,
-    -0.924763,
-    -0.923894,
-    -0.923022,
-    -0.922149,
-    -0.921273,
-    -0.920395,
-    -0.919515,
-    -0.918633,
-    -0.917748,
-    -0.916862,
-    -0.915973,
-    -0.915082,
-    -0.914189,
-    -0.913294,
-    -0.912397,
-    -0.911498,
-    -0.910596,
-    -0.909692,
-    -0.908786,
-    -0.907878,
-    -0.906968,
-    -0.906056,
-    -0.905142,
-    -0.904225,
-    -0.903306,
-    -0.902386,
-    -0.901463,
-    -0.900538,
-    -0.89961,
-    -0.898681,
-    -0.89775,
-    -0.896816,
-    -0.895881,
-    -0.894943,
-    -0.894003,
-    -0.893061,
-    -0.892117,
-    -0.891171,
-    -0.890223,
-    -0.889273,
-    -0.88832,
-    -0.887366,
-    -0.886409,
-    -0.88545,
-    -0.88449,
-    -0.883527,
-    -0.882562,
-    -0.881595,
-    -0.880626,
-    -0.879655,
-    -0.878681,
-    -0.877706,
-    -0.876729,
-    -0.875749,
-    -0.874768,
-    -0.873784,
-    -0.872799,
-    -0.871811,
-    -0.870821,
-    -0.86983,
-    -0.868836,
-    -0.86784,
-    -0.866842,
-    -0.865842,
-    -0.86484,
-    -0.863836,
-    -0.86283,
-    -0.861822,
-    -0.860812,
-    -0.8598,
-    -0.858786,
-    -0.85777,
-    -0.856752,
-    -0.855732,
-    -0.854709,
-    -0.853685,
-    -0.852659,
-    -0.851631,
-    -0.8506,
-    -0.849568,
-    -0.848534,
-    -0.847498,
-    -0.84646,
-    -0.845419,
-    -0.844377,
-    -0.843333,
-    -0.842287,
-    -0.841239,
-    -0.840189,
-    -0.839136,
-    -0.838082,
-    -0.837026,
-    -0.835968,
-    -0.834908,
-    -0.833846,
-    -0.832782,
-    -0.831717,
-    -0.830649,
-    -0.829579,
-    -0.828507,
-    -0.827434,
-    -0.826358,
-    -0.82528,
-    -0.824201,
-    -0.823119,
-    -0.822036,
-    -0.820951,
-    -0.819863,
-    -0.818774,
-    -0.817683,
-    -0.81659,
-    -0.815495,
-    -0.814398,
-    -0.813299,
-    -0.812199,
-    -0.811096,
-    -0.809991,
-    -0.808885,
-    -0.807777,
-    -0.806666,
-    -0.805554,
-    -0.80444,
-    -0.803324,
-    -0.802206,
-    -0.801087,
-    -0.799965,
-    -0.798842,
-    -0.797716,
-    -0.796589,
-    -0.79546,
-    -0.794329,
-    -0.793196,
-    -0.792061,
-    -0.790925,
-    -0.789786,
-    -0.788646,
-    -0.787504,
-    -0.78636,
-    -0.785214,
-    -0.784066,
-    -0.782917,
-    -0.781765,
-    -0.780612,
-    -0.779457,
-    -0.7783,
-    -0.777142,
-    -0.775981,
-    -0.774819,
-    -0.773654,
-    -0.772488,
-    -0.77132,
-    -0.770151,
-    -0.768979,
-    -0.767806,
-    -0.766631,
-    -0.765454,
-    -0.764275,
-    -0.763095,
-    -0.761913,
-    -0.760728,
-    -0.759543,
-    -0.758355,
-    -0.757165,
-    -0.755974,
-    -0.754781,
-    -0.753586,
-    -0.75239,
-    -0.751192,
-    -0.749991,
-    -0.74879,
-    -0.747586,
-    -0.746381,
-    -0.745173,
-    -0.743965,
-    -0.742754,
-    -0.741542,
-    -0.740327,
-    -0.739112,
-    -0.737894,
-    -0.736675,
-    -0.735453,
-    -0.734231,
-    -0.733006,
-    -0.73178,
-    -0.730552,
-    -0.729322,
-    -0.728091,
-    -0.726858,
-    -0.725623,
-    -0.724386,
-    -0.723148,
-    -0.721908,
-    -0.720666,
-    -0.719423,
-    -0.718178,
-    -0.716931,
-    -0.715683,
-    -0.714433,
-    -0.713181,
-    -0.711927,
-    -0.710672,
-    -0.709415,
-    -0.708157,
-    -0.706897,
-    -0.705635,
-    -0.704371,
-    -0.703106,
-    -0.701839,
-    -0.700571,
-    -0.699301,
-    -0.698029,
-    -0.696756,
-    -0.695481,
-    -0.694204,
-    -0.692926,
-    -0.691646,
-    -0.690364,
-    -0.689081,
-    -0.687796,
-    -0.68651,
-    -0.685222,
-    -0.683932,
-    -0.682641,
-    -0.681348,
-    -0.680054,
-    -0.678758,
-    -0.67746,
-    -0.676161,
-    -0.67486,
-    -0.673558,
-    -0.672254,
-    -0.670948,
-    -0.669641,
-    -0.668332,
-    -0.667022,
-    -0.66571,
-    -0.664396,
-    -0.663081,
-    -0.661765,
-    -0.660447,
-    -0.659127,
-    -0.657806,
-    -0.656483,
-    -0.655159,
-    -0.653833,
-    -0.652505,
-    -0.651176,
-    -0.649846,
-    -0.648514,
-    -0.64718,
-    -0.645845,
-    -0.644509,
-    -0.643171,
-    -0.641831,
-    -0.64049,
-    -0.639147,
-    -0.637803,
-    -0.636457,
-    -0.63511,
-    -0.633762,
-    -0.632411,
-    -0.63106,
-    -0.629707,
-    -0.628352,
-    -0.626996,
-    -0.625639,
-    -0.62428,
-    -0.622919,
-    -0.621557,
-    -0.620194,
-    -0.618829,
-    -0.617463,
-    -0.616095,
-    -0.614726,
-    -0.613355,
-    -0.611983,
-    -0.610609,
-    -0.609234,
-    -0.607858,
-    -0.60648,
-    -0.605101,
-    -0.60372,
-    -0.602338,
-    -0.600955,
-    -0.59957,
-    -0.598183,
-    -0.596795,
-    -0.595406,
-    -0.594016,
-    -0.592624,
-    -0.59123,
-    -0.589836,
-    -0.588439,
-    -0.587042,
-    -0.585643,
-    -0.584243,
-    -0.582841,
-    -0.581438,
-    -0.580034,
-    -0.578628,
-    -0.577221,
-    -0.575812,
-    -0.574402,
-    -0.572991,
-    -0.571579,
-    -0.570165,
-    -0.56875,
-    -0.567333,
-    -0.565915,
-    -0.564496,
-    -0.563075,
-    -0.561653,
-    -0.56023,
-    -0.558806,
-    -0.55738,
-    -0.555953,
-    -0.554524,
-    -0.553094,
-    -0.551663,
-    -0.550231,
-    -0.548797,
-    -0.547362,
-    -0.545926,
-    -0.544489,
-    -0.54305,
-    -0.54161,
-    -0.540168,
-    -0.538726,
-    -0.537282,
-    -0.535837,
-    -0.53439,
-    -0.532943,
-    -0.531494,
-    -0.530043,
-    -0.528592,
-    -0.527139,
-    -0.525685,
-    -0.52423,
-    -0.522774,
-    -0.521316,
-    -0.519857,
-    -0.518397,
-    -0.516936,
-    -0.515474,
-    -0.51401,
-    -0.512545,
-    -0.511079,
-    -0.509612,
-    -0.508143,
-    -0.506673,
-    -0.505202,
-    -0.50373,
-    -0.502257,
-    -0.500782,
-    -0.499307,
-    -0.49783,
-    -0.496352,
-    -0.494873,
-    -0.493392,
-    -0.491911,
-    -0.490428,
-    -0.488945,
-    -0.48746,
-    -0.485973,
-    -0.484486,
-    -0.482998,
-    -0.481508,
-    -0.480018,
-    -0.478526,
-    -0.477033,
-    -0.475539,
-    -0.474044,
-    -0.472547,
-    -0.47105,
-    -0.469552,
-    -0.468052,
-    -0.466551,
-    -0.46505,
-    -0.463547,
-    -0.462043,
-    -0.460538,
-    -0.459031,
-    -0.457524,
-    -0.456016,
-    -0.454507,
-    -0.452996,
-    -0.451485,
-    -0.449972,
-    -0.448458,
-    -0.446944,
-    -0.445428,
-    -0.443911,
-    -0.442393,
-    -0.440874,
-    -0.439354,
-    -0.437834,
-    -0.436312,
-    -0.434789,
-    -0.433265,
-    -0.431739,
-    -0.430213,
-    -0.428686,
-    -0.427158,
-    -0.425629,
-    -0.424099,
-    -0.422568,
-    -0.421036,
-    -0.419503,
-    -0.417969,
-    -0.416434,
-    -0.414898,
-    -0.413361,
-    -0.411823,
-    -0.410284,
-    -0.408744,
-    -0.407203,
-    -0.405661,
-    -0.404118,
-    -0.402575,
-    -0.40103,
-    -0.399484,
-    -0.397938,
-    -0.39639,
-    -0.394842,
-    -0.393292,
-    -0.391742,
-    -0.390191,
-    -0.388639,
-    -0.387086,
-    -0.385532,
-    -0.383977,
-    -0.382421,
-    -0.380865,
-    -0.379307,
-    -0.377749,
-    -0.376189,
-    -0.374629,
-    -0.373068,
-    -0.371506,
-    -0.369943,
-    -0.368379,
-    -0.366815,
-    -0.365249,
-    -0.363683,
-    -0.362116,
-    -0.360548,
-    -0.358979,
-    -0.357409,
-    -0.355839,
-    -0.354267,
-    -0.352695,
-    -0.351122,
-    -0.349548,
-    -0.347973,
-    -0.346398,
-    -0.344821,
-    -0.343244,
-    -0.341666,
-    -0.340087,
-    -0.338508,
-    -0.336928,
-    -0.335346,
-    -0.333764,
-    -0.332182,
-    -0.330598,
-    -0.329014,
-    -0.327429,
-    -0.325843,
-    -0.324256,
-    -0.322669,
-    -0.321081,
-    -0.319492,
-    -0.317902,
-    -0.316312,
-    -0.314721,
-    -0.313129,
-    -0.311536,
-    -0.309943,
-    -0.308349,
-    -0.306754,
-    -0.305159,
-    -0.303562,
-    -0.301965,
-    -0.300368,
-    -0.298769,
-    -0.29717,
-    -0.295571,
-    -0.29397,
-    -0.292369,
-    -0.290767,
-    -0.289165,
-    -0.287561,
-    -0.285958,
-    -0.284353,
-    -0.282748,
-    -0.281142,
-    -0.279535,
-    -0.277928,
-    -0.27632,
-    -0.274712,
-    -0.273103,
-    -0.271493,
-    -0.269882,
-    -0.268271,
-    -0.26666,
-    -0.265047,
-    -0.263434,
-    -0.261821,
-    -0.260206,
-    -0.258592,
-    -0.256976,
-    -0.25536,
-    -0.253744,
-    -0.252126,
-    -0.250509,
-    -0.24889,
-    -0.247271,
-    -0.245652,
-    -0.244031,
-    -0.242411,
-    -0.240789,
-    -0.239168,
-    -0.237545,
-    -0.235922,
-    -0.234299,
-    -0.232675,
-    -0.23105,
-    -0.229425,
-    -0.227799,
-    -0.226173,
-    -0.224546,
-    -0.222919,
-    -0.221291,
-    -0.219662,
-    -0.218034,
-    -0.216404,
-    -0.214774,
-    -0.213144,
-    -0.211513,
-    -0.209882,
-    -0.20825,
-    -0.206617,
-    -0.204984,
-    -0.203351,
-    -0.201717,
-    -0.200083,
-    -0.198448,
-    -0.196813,
-    -0.195177,
-    -0.193541,
-    -0.191904,
-    -0.190267,
-    -0.18863,
-    -0.186992,
-    -0.185353,
-    -0.183715,
-    -0.182075,
-    -0.180436,
-    -0.178795,
-    -0.177155,
-    -0.175514,
-    -0.173873,
-    -0.172231,
-    -0.170589,
-    -0.168946,
-    -0.167303,
-    -0.16566,
-    -0.164016,
-    -0.162372,
-    -0.160727,
-    -0.159082,
-    -0.157437,
-    -0.155791,
-    -0.154145,
-    -0.152499,
-    -0.150852,
-    -0.149205,
-    -0.147558,
-    -0.14591,
-    -0.144262,
-    -0.142613,
-    -0.140964,
-    -0.139315,
-    -0.137666,
-    -0.136016,
-    -0.134366,
-    -0.132715,
-    -0.131064,
-    -0.129413,
-    -0.127762,
-    -0.12611,
-    -0.124458,
-    -0.122806,
-    -0.121154,
-    -0.119501,
-    -0.117848,
-    -0.116194,
-    -0.114541,
-    -0.112887,
-    -0.111232,
-    -0.109578,
-    -0.107923,
-    -0.106268,
-    -0.104613,
-    -0.102958,
-    -0.101302,
-    -0.0996458,
-    -0.0979897,
-    -0.0963332,
-    -0.0946766,
-    -0.0930197,
-    -0.0913626,
-    -0.0897053,
-    -0.0880478,
-    -0.0863901,
-    -0.0847322,
-    -0.083074,
-    -0.0814157,
-    -0.0797572,
-    -0.0780985,
-    -0.0764396,
-    -0.0747806,
-    -0.0731213,
-    -0.0714619,
-    -0.0698024,
-    -0.0681426,
-    -0.0664827,
-    -0.0648227,
-    -0.0631624,
-    -0.0615021,
-    -0.0598416,
-    -0.0581809,
-    -0.0565201,
-    -0.0548592,
-    -0.0531982,
-    -0.051537,
-    -0.0498757,
-    -0.0482143,
-    -0.0465528,
-    -0.0448912,
-    -0.0432294,
-    -0.0415676,
-    -0.0399056,
-    -0.0382436,
-    -0.0365815,
-    -0.0349193,
-    -0.033257,
-    -0.0315946,
-    -0.0299322,
-    -0.0282697,
-    -0.0266071,
-    -0.0249445,
-    -0.0232818,
-    -0.021619,
-    -0.0199562,
-    -0.0182934,
-    -0.0166305,
-    -0.0149675,
-    -0.0133046,
-    -0.0116416,
-    -0.00997853,
-    -0.00831547,
-    -0.0066524,
-    -0.00498932,
-    -0.00332622,
-    -0.00166311,
-};
-
-constexpr static std::array<std::array<float, 4096>, 10> wt_square =
-{
-    wt_square_0x1,
-    wt_square_0x2,
-    wt_square_0x3,
-    wt_square_0x4,
-    wt_square_0x5,
-    wt_square_0x6,
-    wt_square_0x7,
-    wt_square_0x8,
-    wt_square_0x9,
-    wt_square_0xA
-};
-
-#endif
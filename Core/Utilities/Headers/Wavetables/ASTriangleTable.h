@@ -1,41060 +0,0 @@
-//  Assemble
-//  Created by David Spry on 10/5/20.
-//  Copyright © 2020 David Spry. All rights reserved.
-
-#ifndef ASTRIANGLETABLE_H
-#define ASTRIANGLETABLE_H
-
-#include <array>
-
-/// \note The collection of tables is at the bottom of this file.
-///
-/// \brief A collection of wavetables containing a bandlimited triangle wave.
-/// The square wave is oversampled by a factor of 2 and bandlimited in order to
-/// contain the maximum number of harmonics in each table without exceeding the Nyquist frequency.
-///
-/// Correct use of these wavetables should ensure that aliasing from the synthesiser is minimised if not obviated completely.
-///
-/// For each table, the top frequency and the number of harmonics follows.
-/// 1. 40Hz             735
-/// 2. 80Hz             367
-/// 3. 160Hz           183
-/// 4. 320Hz             91
-/// 5. 640Hz             45
-/// 6. 1280Hz           22
-/// 7. 2560Hz           11
-/// 8. 5120Hz            5
-/// 9. 10240Hz          2
-/// 10. 20480Hz+      1
-///
-/// \note These tables were generated with Nigel Redmon's C++ program, "WaveTableOsc", which is available for download from his blog, EarLevel Engineering.
-/// http://www.earlevel.com/main/2012/05/03/a-wavetable-oscillator—introduction/
-
-constexpr static int kTriangleTableLength = 4096;
-
-// Top frequency: 44.1K * 0.000907029
-constexpr static std::array<float, 4096> wt_triangle_0x1 =
-{
-    0,
-    -0.000975447,
-    -0.00195167,
-    -0.00292855,
-    -0.00390523,
-    -0.00488106,
-    -0.00585639,
-    -0.00683212,
-    -0.0078087,
-    -0.00878561,
-    -0.00976195,
-    -0.0107375,
-    -0.0117129,
-    -0.012689,
-    -0.0136658,
-    -0.0146426,
-    -0.0156185,
-    -0.0165938,
-    -0.0175695,
-    -0.018546,
-    -0.0195229,
-    -0.0204993,
-    -0.0214749,
-    -0.0224503,
-    -0.0234263,
-    -0.024403,
-    -0.0253799,
-    -0.0263559,
-    -0.0273313,
-    -0.0283069,
-    -0.0292832,
-    -0.0302601,
-    -0.0312367,
-    -0.0322124,
-    -0.0331877,
-    -0.0341636,
-    -0.0351403,
-    -0.0361172,
-    -0.0370934,
-    -0.0380688,
-    -0.0390442,
-    -0.0400205,
-    -0.0409974,
-    -0.041974,
-    -0.0429498,
-    -0.0439252,
-    -0.0449009,
-    -0.0458775,
-    -0.0468545,
-    -0.0478308,
-    -0.0488062,
-    -0.0497817,
-    -0.0507578,
-    -0.0517347,
-    -0.0527114,
-    -0.0536873,
-    -0.0546626,
-    -0.0556383,
-    -0.0566148,
-    -0.0575917,
-    -0.0585681,
-    -0.0595437,
-    -0.0605191,
-    -0.0614951,
-    -0.0624719,
-    -0.0634487,
-    -0.0644247,
-    -0.0654001,
-    -0.0663757,
-    -0.0673521,
-    -0.068329,
-    -0.0693055,
-    -0.0702812,
-    -0.0712565,
-    -0.0722324,
-    -0.0732092,
-    -0.074186,
-    -0.0751621,
-    -0.0761376,
-    -0.077113,
-    -0.0780893,
-    -0.0790663,
-    -0.0800429,
-    -0.0810186,
-    -0.081994,
-    -0.0829697,
-    -0.0839464,
-    -0.0849233,
-    -0.0858996,
-    -0.086875,
-    -0.0878504,
-    -0.0888266,
-    -0.0898035,
-    -0.0907802,
-    -0.0917561,
-    -0.0927314,
-    -0.0937071,
-    -0.0946837,
-    -0.0956606,
-    -0.096637,
-    -0.0976125,
-    -0.0985879,
-    -0.0995639,
-    -0.100541,
-    -0.101518,
-    -0.102494,
-    -0.103469,
-    -0.104444,
-    -0.105421,
-    -0.106398,
-    -0.107374,
-    -0.10835,
-    -0.109325,
-    -0.110301,
-    -0.111278,
-    -0.112255,
-    -0.113231,
-    -0.114206,
-    -0.115182,
-    -0.116158,
-    -0.117135,
-    -0.118112,
-    -0.119087,
-    -0.120063,
-    -0.121039,
-    -0.122015,
-    -0.122992,
-    -0.123968,
-    -0.124944,
-    -0.125919,
-    -0.126895,
-    -0.127872,
-    -0.128849,
-    -0.129825,
-    -0.1308,
-    -0.131776,
-    -0.132752,
-    -0.133729,
-    -0.134706,
-    -0.135681,
-    -0.136657,
-    -0.137633,
-    -0.13861,
-    -0.139586,
-    -0.140562,
-    -0.141538,
-    -0.142513,
-    -0.14349,
-    -0.144467,
-    -0.145443,
-    -0.146419,
-    -0.147394,
-    -0.14837,
-    -0.149347,
-    -0.150324,
-    -0.1513,
-    -0.152275,
-    -0.153251,
-    -0.154227,
-    -0.155204,
-    -0.156181,
-    -0.157156,
-    -0.158132,
-    -0.159107,
-    -0.160084,
-    -0.161061,
-    -0.162037,
-    -0.163013,
-    -0.163988,
-    -0.164964,
-    -0.165941,
-    -0.166918,
-    -0.167894,
-    -0.168869,
-    -0.169845,
-    -0.170821,
-    -0.171798,
-    -0.172775,
-    -0.17375,
-    -0.174725,
-    -0.175702,
-    -0.176678,
-    -0.177655,
-    -0.178631,
-    -0.179606,
-    -0.180582,
-    -0.181559,
-    -0.182536,
-    -0.183512,
-    -0.184488,
-    -0.185463,
-    -0.186439,
-    -0.187416,
-    -0.188393,
-    -0.189369,
-    -0.190344,
-    -0.191319,
-    -0.192296,
-    -0.193273,
-    -0.194249,
-    -0.195225,
-    -0.1962,
-    -0.197176,
-    -0.198153,
-    -0.19913,
-    -0.200106,
-    -0.201081,
-    -0.202057,
-    -0.203033,
-    -0.20401,
-    -0.204987,
-    -0.205962,
-    -0.206938,
-    -0.207914,
-    -0.20889,
-    -0.209867,
-    -0.210843,
-    -0.211819,
-    -0.212794,
-    -0.21377,
-    -0.214747,
-    -0.215724,
-    -0.2167,
-    -0.217675,
-    -0.218651,
-    -0.219627,
-    -0.220604,
-    -0.221581,
-    -0.222556,
-    -0.223532,
-    -0.224508,
-    -0.225485,
-    -0.226461,
-    -0.227437,
-    -0.228413,
-    -0.229388,
-    -0.230365,
-    -0.231342,
-    -0.232318,
-    -0.233294,
-    -0.234269,
-    -0.235245,
-    -0.236222,
-    -0.237199,
-    -0.238175,
-    -0.23915,
-    -0.240126,
-    -0.241102,
-    -0.242079,
-    -0.243056,
-    -0.244031,
-    -0.245007,
-    -0.245982,
-    -0.246959,
-    -0.247936,
-    -0.248912,
-    -0.249888,
-    -0.250863,
-    -0.251839,
-    -0.252816,
-    -0.253793,
-    -0.254769,
-    -0.255744,
-    -0.25672,
-    -0.257696,
-    -0.258673,
-    -0.25965,
-    -0.260625,
-    -0.2616,
-    -0.262577,
-    -0.263553,
-    -0.26453,
-    -0.265506,
-    -0.266481,
-    -0.267457,
-    -0.268434,
-    -0.269411,
-    -0.270387,
-    -0.271363,
-    -0.272338,
-    -0.273314,
-    -0.274291,
-    -0.275268,
-    -0.276244,
-    -0.277219,
-    -0.278194,
-    -0.279171,
-    -0.280148,
-    -0.281124,
-    -0.2821,
-    -0.283075,
-    -0.284051,
-    -0.285028,
-    -0.286005,
-    -0.286981,
-    -0.287956,
-    -0.288932,
-    -0.289908,
-    -0.290885,
-    -0.291862,
-    -0.292838,
-    -0.293813,
-    -0.294788,
-    -0.295765,
-    -0.296742,
-    -0.297718,
-    -0.298694,
-    -0.299669,
-    -0.300645,
-    -0.301622,
-    -0.302599,
-    -0.303575,
-    -0.30455,
-    -0.305526,
-    -0.306502,
-    -0.307479,
-    -0.308456,
-    -0.309431,
-    -0.310407,
-    -0.311383,
-    -0.31236,
-    -0.313336,
-    -0.314312,
-    -0.315288,
-    -0.316263,
-    -0.31724,
-    -0.318217,
-    -0.319193,
-    -0.320169,
-    -0.321144,
-    -0.32212,
-    -0.323097,
-    -0.324074,
-    -0.32505,
-    -0.326025,
-    -0.327001,
-    -0.327977,
-    -0.328954,
-    -0.329931,
-    -0.330906,
-    -0.331881,
-    -0.332857,
-    -0.333834,
-    -0.334811,
-    -0.335787,
-    -0.336763,
-    -0.337738,
-    -0.338714,
-    -0.339691,
-    -0.340668,
-    -0.341644,
-    -0.342619,
-    -0.343595,
-    -0.344571,
-    -0.345548,
-    -0.346525,
-    -0.3475,
-    -0.348475,
-    -0.349451,
-    -0.350428,
-    -0.351405,
-    -0.352381,
-    -0.353356,
-    -0.354332,
-    -0.355308,
-    -0.356286,
-    -0.357262,
-    -0.358238,
-    -0.359213,
-    -0.360189,
-    -0.361166,
-    -0.362143,
-    -0.363119,
-    -0.364094,
-    -0.365069,
-    -0.366046,
-    -0.367023,
-    -0.367999,
-    -0.368975,
-    -0.36995,
-    -0.370926,
-    -0.371903,
-    -0.37288,
-    -0.373856,
-    -0.374831,
-    -0.375807,
-    -0.376783,
-    -0.37776,
-    -0.378737,
-    -0.379713,
-    -0.380688,
-    -0.381663,
-    -0.38264,
-    -0.383617,
-    -0.384594,
-    -0.385569,
-    -0.386544,
-    -0.38752,
-    -0.388497,
-    -0.389474,
-    -0.39045,
-    -0.391425,
-    -0.392401,
-    -0.393377,
-    -0.394354,
-    -0.395331,
-    -0.396306,
-    -0.397282,
-    -0.398258,
-    -0.399234,
-    -0.400211,
-    -0.401187,
-    -0.402163,
-    -0.403138,
-    -0.404115,
-    -0.405092,
-    -0.406068,
-    -0.407044,
-    -0.408019,
-    -0.408995,
-    -0.409972,
-    -0.410949,
-    -0.411925,
-    -0.4129,
-    -0.413875,
-    -0.414852,
-    -0.415829,
-    -0.416806,
-    -0.417781,
-    -0.418756,
-    -0.419732,
-    -0.420709,
-    -0.421686,
-    -0.422662,
-    -0.423638,
-    -0.424613,
-    -0.425589,
-    -0.426566,
-    -0.427543,
-    -0.428519,
-    -0.429494,
-    -0.430469,
-    -0.431446,
-    -0.432423,
-    -0.4334,
-    -0.434375,
-    -0.43535,
-    -0.436326,
-    -0.437303,
-    -0.43828,
-    -0.439256,
-    -0.440231,
-    -0.441207,
-    -0.442183,
-    -0.443161,
-    -0.444137,
-    -0.445113,
-    -0.446088,
-    -0.447064,
-    -0.448041,
-    -0.449018,
-    -0.449994,
-    -0.450969,
-    -0.451944,
-    -0.452921,
-    -0.453898,
-    -0.454875,
-    -0.45585,
-    -0.456825,
-    -0.457801,
-    -0.458778,
-    -0.459755,
-    -0.460731,
-    -0.461706,
-    -0.462682,
-    -0.463658,
-    -0.464635,
-    -0.465612,
-    -0.466588,
-    -0.467563,
-    -0.468538,
-    -0.469515,
-    -0.470492,
-    -0.471469,
-    -0.472444,
-    -0.473419,
-    -0.474395,
-    -0.475372,
-    -0.476349,
-    -0.477325,
-    -0.4783,
-    -0.479276,
-    -0.480252,
-    -0.481229,
-    -0.482206,
-    -0.483181,
-    -0.484156,
-    -0.485132,
-    -0.486109,
-    -0.487087,
-    -0.488063,
-    -0.489038,
-    -0.490013,
-    -0.490989,
-    -0.491967,
-    -0.492943,
-    -0.493919,
-    -0.494894,
-    -0.49587,
-    -0.496847,
-    -0.497824,
-    -0.4988,
-    -0.499775,
-    -0.50075,
-    -0.501727,
-    -0.502704,
-    -0.503681,
-    -0.504656,
-    -0.505631,
-    -0.506607,
-    -0.507584,
-    -0.508561,
-    -0.509537,
-    -0.510513,
-    -0.511488,
-    -0.512464,
-    -0.513441,
-    -0.514418,
-    -0.515394,
-    -0.516369,
-    -0.517344,
-    -0.518321,
-    -0.519298,
-    -0.520275,
-    -0.52125,
-    -0.522225,
-    -0.523201,
-    -0.524178,
-    -0.525155,
-    -0.526131,
-    -0.527106,
-    -0.528082,
-    -0.529058,
-    -0.530035,
-    -0.531012,
-    -0.531988,
-    -0.532963,
-    -0.533938,
-    -0.534915,
-    -0.535893,
-    -0.536869,
-    -0.537844,
-    -0.538819,
-    -0.539795,
-    -0.540773,
-    -0.54175,
-    -0.542725,
-    -0.5437,
-    -0.544676,
-    -0.545653,
-    -0.54663,
-    -0.547606,
-    -0.548581,
-    -0.549556,
-    -0.550533,
-    -0.55151,
-    -0.552487,
-    -0.553463,
-    -0.554438,
-    -0.555413,
-    -0.55639,
-    -0.557367,
-    -0.558344,
-    -0.559319,
-    -0.560294,
-    -0.56127,
-    -0.562247,
-    -0.563224,
-    -0.5642,
-    -0.565175,
-    -0.56615,
-    -0.567127,
-    -0.568104,
-    -0.569081,
-    -0.570057,
-    -0.571031,
-    -0.572007,
-    -0.572984,
-    -0.573962,
-    -0.574938,
-    -0.575913,
-    -0.576888,
-    -0.577864,
-    -0.578842,
-    -0.579819,
-    -0.580794,
-    -0.581769,
-    -0.582744,
-    -0.583721,
-    -0.584699,
-    -0.585675,
-    -0.58665,
-    -0.587625,
-    -0.588601,
-    -0.589579,
-    -0.590556,
-    -0.591532,
-    -0.592506,
-    -0.593482,
-    -0.594459,
-    -0.595436,
-    -0.596413,
-    -0.597388,
-    -0.598363,
-    -0.599339,
-    -0.600316,
-    -0.601293,
-    -0.602269,
-    -0.603244,
-    -0.604219,
-    -0.605196,
-    -0.606173,
-    -0.60715,
-    -0.608125,
-    -0.6091,
-    -0.610076,
-    -0.611053,
-    -0.612031,
-    -0.613007,
-    -0.613981,
-    -0.614956,
-    -0.615933,
-    -0.616911,
-    -0.617887,
-    -0.618863,
-    -0.619838,
-    -0.620813,
-    -0.62179,
-    -0.622768,
-    -0.623744,
-    -0.624719,
-    -0.625694,
-    -0.62667,
-    -0.627648,
-    -0.628625,
-    -0.6296,
-    -0.630575,
-    -0.63155,
-    -0.632527,
-    -0.633505,
-    -0.634482,
-    -0.635457,
-    -0.636431,
-    -0.637407,
-    -0.638385,
-    -0.639362,
-    -0.640338,
-    -0.641313,
-    -0.642288,
-    -0.643265,
-    -0.644242,
-    -0.645219,
-    -0.646194,
-    -0.647169,
-    -0.648145,
-    -0.649122,
-    -0.650099,
-    -0.651075,
-    -0.65205,
-    -0.653025,
-    -0.654002,
-    -0.654979,
-    -0.655956,
-    -0.656932,
-    -0.657906,
-    -0.658882,
-    -0.659859,
-    -0.660837,
-    -0.661813,
-    -0.662788,
-    -0.663763,
-    -0.664739,
-    -0.665717,
-    -0.666694,
-    -0.667669,
-    -0.668644,
-    -0.669619,
-    -0.670596,
-    -0.671574,
-    -0.67255,
-    -0.673525,
-    -0.6745,
-    -0.675476,
-    -0.676454,
-    -0.677431,
-    -0.678407,
-    -0.679381,
-    -0.680357,
-    -0.681333,
-    -0.682311,
-    -0.683288,
-    -0.684263,
-    -0.685237,
-    -0.686213,
-    -0.687191,
-    -0.688168,
-    -0.689144,
-    -0.690119,
-    -0.691094,
-    -0.692071,
-    -0.693048,
-    -0.694025,
-    -0.695001,
-    -0.695975,
-    -0.696951,
-    -0.697928,
-    -0.698906,
-    -0.699882,
-    -0.700856,
-    -0.701831,
-    -0.702808,
-    -0.703786,
-    -0.704763,
-    -0.705738,
-    -0.706712,
-    -0.707688,
-    -0.708665,
-    -0.709643,
-    -0.710619,
-    -0.711594,
-    -0.712569,
-    -0.713545,
-    -0.714523,
-    -0.7155,
-    -0.716476,
-    -0.71745,
-    -0.718425,
-    -0.719402,
-    -0.72038,
-    -0.721357,
-    -0.722332,
-    -0.723306,
-    -0.724282,
-    -0.72526,
-    -0.726238,
-    -0.727213,
-    -0.728188,
-    -0.729162,
-    -0.730139,
-    -0.731117,
-    -0.732094,
-    -0.733069,
-    -0.734044,
-    -0.735019,
-    -0.735997,
-    -0.736975,
-    -0.737951,
-    -0.738925,
-    -0.7399,
-    -0.740876,
-    -0.741855,
-    -0.742832,
-    -0.743807,
-    -0.744781,
-    -0.745756,
-    -0.746734,
-    -0.747712,
-    -0.748688,
-    -0.749663,
-    -0.750637,
-    -0.751614,
-    -0.752592,
-    -0.753569,
-    -0.754545,
-    -0.755519,
-    -0.756494,
-    -0.757471,
-    -0.758449,
-    -0.759426,
-    -0.7604,
-    -0.761375,
-    -0.762351,
-    -0.763329,
-    -0.764307,
-    -0.765282,
-    -0.766256,
-    -0.767231,
-    -0.768208,
-    -0.769186,
-    -0.770163,
-    -0.771138,
-    -0.772112,
-    -0.773088,
-    -0.774066,
-    -0.775044,
-    -0.77602,
-    -0.776994,
-    -0.777968,
-    -0.778945,
-    -0.779924,
-    -0.780901,
-    -0.781876,
-    -0.78285,
-    -0.783825,
-    -0.784803,
-    -0.785781,
-    -0.786758,
-    -0.787731,
-    -0.788706,
-    -0.789682,
-    -0.790661,
-    -0.791638,
-    -0.792614,
-    -0.793587,
-    -0.794562,
-    -0.79554,
-    -0.796518,
-    -0.797495,
-    -0.798469,
-    -0.799443,
-    -0.800419,
-    -0.801398,
-    -0.802376,
-    -0.803351,
-    -0.804325,
-    -0.805299,
-    -0.806277,
-    -0.807256,
-    -0.808233,
-    -0.809207,
-    -0.81018,
-    -0.811156,
-    -0.812135,
-    -0.813113,
-    -0.814089,
-    -0.815062,
-    -0.816037,
-    -0.817014,
-    -0.817993,
-    -0.81897,
-    -0.819945,
-    -0.820918,
-    -0.821893,
-    -0.822872,
-    -0.823851,
-    -0.824827,
-    -0.8258,
-    -0.826774,
-    -0.827751,
-    -0.82873,
-    -0.829708,
-    -0.830683,
-    -0.831656,
-    -0.83263,
-    -0.833609,
-    -0.834588,
-    -0.835564,
-    -0.836538,
-    -0.837511,
-    -0.838488,
-    -0.839467,
-    -0.840445,
-    -0.84142,
-    -0.842393,
-    -0.843368,
-    -0.844346,
-    -0.845325,
-    -0.846302,
-    -0.847276,
-    -0.848249,
-    -0.849225,
-    -0.850204,
-    -0.851183,
-    -0.852158,
-    -0.853131,
-    -0.854105,
-    -0.855082,
-    -0.856062,
-    -0.85704,
-    -0.858014,
-    -0.858986,
-    -0.859962,
-    -0.860941,
-    -0.86192,
-    -0.862896,
-    -0.863869,
-    -0.864842,
-    -0.865819,
-    -0.866799,
-    -0.867777,
-    -0.868752,
-    -0.869724,
-    -0.870698,
-    -0.871677,
-    -0.872657,
-    -0.873634,
-    -0.874607,
-    -0.875579,
-    -0.876556,
-    -0.877536,
-    -0.878515,
-    -0.87949,
-    -0.880461,
-    -0.881435,
-    -0.882414,
-    -0.883395,
-    -0.884372,
-    -0.885345,
-    -0.886317,
-    -0.887293,
-    -0.888273,
-    -0.889253,
-    -0.890228,
-    -0.891199,
-    -0.892172,
-    -0.893151,
-    -0.894132,
-    -0.89511,
-    -0.896083,
-    -0.897054,
-    -0.898029,
-    -0.89901,
-    -0.89999,
-    -0.900966,
-    -0.901937,
-    -0.902909,
-    -0.903887,
-    -0.904869,
-    -0.905848,
-    -0.906821,
-    -0.907791,
-    -0.908766,
-    -0.909746,
-    -0.910728,
-    -0.911704,
-    -0.912675,
-    -0.913646,
-    -0.914624,
-    -0.915606,
-    -0.916586,
-    -0.917559,
-    -0.918529,
-    -0.919502,
-    -0.920483,
-    -0.921465,
-    -0.922442,
-    -0.923413,
-    -0.924383,
-    -0.92536,
-    -0.926342,
-    -0.927324,
-    -0.928298,
-    -0.929267,
-    -0.930239,
-    -0.931219,
-    -0.932202,
-    -0.933181,
-    -0.934152,
-    -0.93512,
-    -0.936096,
-    -0.937079,
-    -0.938062,
-    -0.939037,
-    -0.940005,
-    -0.940975,
-    -0.941954,
-    -0.942939,
-    -0.94392,
-    -0.944891,
-    -0.945857,
-    -0.946831,
-    -0.947815,
-    -0.9488,
-    -0.949776,
-    -0.950743,
-    -0.951711,
-    -0.95269,
-    -0.953676,
-    -0.954659,
-    -0.95563,
-    -0.956594,
-    -0.957566,
-    -0.95855,
-    -0.959538,
-    -0.960517,
-    -0.961482,
-    -0.962446,
-    -0.963424,
-    -0.964413,
-    -0.9654,
-    -0.966371,
-    -0.967331,
-    -0.968299,
-    -0.969285,
-    -0.970278,
-    -0.971259,
-    -0.972221,
-    -0.97318,
-    -0.974155,
-    -0.97515,
-    -0.976143,
-    -0.977114,
-    -0.978068,
-    -0.979029,
-    -0.980016,
-    -0.981019,
-    -0.982006,
-    -0.982963,
-    -0.983909,
-    -0.98488,
-    -0.985886,
-    -0.986895,
-    -0.987867,
-    -0.9888,
-    -0.989742,
-    -0.990738,
-    -0.991774,
-    -0.992783,
-    -0.993711,
-    -0.994598,
-    -0.995555,
-    -0.996649,
-    -0.997777,
-    -0.998661,
-    -0.999,
-    -0.998661,
-    -0.997777,
-    -0.996649,
-    -0.995555,
-    -0.994598,
-    -0.993711,
-    -0.992783,
-    -0.991774,
-    -0.990738,
-    -0.989742,
-    -0.9888,
-    -0.987867,
-    -0.986895,
-    -0.985886,
-    -0.98488,
-    -0.983909,
-    -0.982963,
-    -0.982006,
-    -0.981019,
-    -0.980016,
-    -0.979029,
-    -0.978068,
-    -0.977114,
-    -0.976143,
-    -0.97515,
-    -0.974155,
-    -0.97318,
-    -0.972221,
-    -0.971259,
-    -0.970278,
-    -0.969285,
-    -0.968299,
-    -0.967331,
-    -0.966371,
-    -0.9654,
-    -0.964413,
-    -0.963424,
-    -0.962446,
-    -0.961482,
-    -0.960517,
-    -0.959538,
-    -0.95855,
-    -0.957566,
-    -0.956594,
-    -0.95563,
-    -0.954659,
-    -0.953676,
-    -0.95269,
-    -0.951711,
-    -0.950743,
-    -0.949776,
-    -0.9488,
-    -0.947815,
-    -0.946831,
-    -0.945857,
-    -0.944891,
-    -0.94392,
-    -0.942939,
-    -0.941954,
-    -0.940975,
-    -0.940005,
-    -0.939037,
-    -0.938062,
-    -0.937079,
-    -0.936096,
-    -0.93512,
-    -0.934152,
-    -0.933181,
-    -0.932202,
-    -0.931219,
-    -0.930239,
-    -0.929267,
-    -0.928298,
-    -0.927324,
-    -0.926342,
-    -0.92536,
-    -0.924383,
-    -0.923413,
-    -0.922442,
-    -0.921465,
-    -0.920483,
-    -0.919502,
-    -0.918529,
-    -0.917559,
-    -0.916586,
-    -0.915606,
-    -0.914624,
-    -0.913646,
-    -0.912675,
-    -0.911704,
-    -0.910728,
-    -0.909746,
-    -0.908766,
-    -0.907791,
-    -0.906821,
-    -0.905848,
-    -0.904869,
-    -0.903887,
-    -0.902909,
-    -0.901937,
-    -0.900966,
-    -0.89999,
-    -0.89901,
-    -0.898029,
-    -0.897054,
-    -0.896083,
-    -0.89511,
-    -0.894132,
-    -0.893151,
-    -0.892172,
-    -0.891199,
-    -0.890228,
-    -0.889253,
-    -0.888273,
-    -0.887293,
-    -0.886317,
-    -0.885345,
-    -0.884372,
-    -0.883395,
-    -0.882414,
-    -0.881435,
-    -0.880461,
-    -0.87949,
-    -0.878515,
-    -0.877536,
-    -0.876556,
-    -0.875579,
-    -0.874607,
-    -0.873634,
-    -0.872657,
-    -0.871677,
-    -0.870698,
-    -0.869724,
-    -0.868752,
-    -0.867777,
-    -0.866799,
-    -0.865819,
-    -0.864842,
-    -0.863869,
-    -0.862896,
-    -0.86192,
-    -0.860941,
-    -0.859962,
-    -0.858986,
-    -0.858014,
-    -0.85704,
-    -0.856062,
-    -0.855082,
-    -0.854105,
-    -0.853131,
-    -0.852158,
-    -0.851183,
-    -0.850204,
-    -0.849225,
-    -0.848249,
-    -0.847276,
-    -0.846302,
-    -0.845325,
-    -0.844346,
-    -0.843368,
-    -0.842393,
-    -0.84142,
-    -0.840445,
-    -0.839467,
-    -0.838488,
-    -0.837511,
-    -0.836538,
-    -0.835564,
-    -0.834588,
-    -0.833609,
-    -0.83263,
-    -0.831656,
-    -0.830683,
-    -0.829708,
-    -0.82873,
-    -0.827751,
-    -0.826774,
-    -0.8258,
-    -0.824827,
-    -0.823851,
-    -0.822872,
-    -0.821893,
-    -0.820918,
-    -0.819945,
-    -0.81897,
-    -0.817993,
-    -0.817014,
-    -0.816037,
-    -0.815062,
-    -0.814089,
-    -0.813113,
-    -0.812135,
-    -0.811156,
-    -0.81018,
-    -0.809207,
-    -0.808233,
-    -0.807256,
-    -0.806277,
-    -0.805299,
-    -0.804325,
-    -0.803351,
-    -0.802376,
-    -0.801398,
-    -0.800419,
-    -0.799443,
-    -0.798469,
-    -0.797495,
-    -0.796518,
-    -0.79554,
-    -0.794562,
-    -0.793587,
-    -0.792614,
-    -0.791638,
-    -0.790661,
-    -0.789682,
-    -0.788706,
-    -0.787731,
-    -0.786758,
-    -0.785781,
-    -0.784803,
-    -0.783825,
-    -0.78285,
-    -0.781876,
-    -0.780901,
-    -0.779924,
-    -0.778945,
-    -0.777968,
-    -0.776994,
-    -0.77602,
-    -0.775044,
-    -0.774066,
-    -0.773088,
-    -0.772112,
-    -0.771138,
-    -0.770163,
-    -0.769186,
-    -0.768208,
-    -0.767231,
-    -0.766256,
-    -0.765282,
-    -0.764307,
-    -0.763329,
-    -0.762351,
-    -0.761375,
-    -0.7604,
-    -0.759426,
-    -0.758449,
-    -0.757471,
-    -0.756494,
-    -0.755519,
-    -0.754545,
-    -0.753569,
-    -0.752592,
-    -0.751614,
-    -0.750637,
-    -0.749663,
-    -0.748688,
-    -0.747712,
-    -0.746734,
-    -0.745756,
-    -0.744781,
-    -0.743807,
-    -0.742832,
-    -0.741855,
-    -0.740876,
-    -0.7399,
-    -0.738925,
-    -0.737951,
-    -0.736975,
-    -0.735997,
-    -0.735019,
-    -0.734044,
-    -0.733069,
-    -0.732094,
-    -0.731117,
-    -0.730139,
-    -0.729162,
-    -0.728188,
-    -0.727213,
-    -0.726238,
-    -0.72526,
-    -0.724282,
-    -0.723306,
-    -0.722332,
-    -0.721357,
-    -0.72038,
-    -0.719402,
-    -0.718425,
-    -0.71745,
-    -0.716476,
-    -0.7155,
-    -0.714523,
-    -0.713545,
-    -0.712569,
-    -0.711594,
-    -0.710619,
-    -0.709643,
-    -0.708665,
-    -0.707688,
-    -0.706712,
-    -0.705738,
-    -0.704763,
-    -0.703786,
-    -0.702808,
-    -0.701831,
-    -0.700856,
-    -0.699882,
-    -0.698906,
-    -0.697928,
-    -0.696951,
-    -0.695975,
-    -0.695001,
-    -0.694025,
-    -0.693048,
-    -0.692071,
-    -0.691094,
-    -0.690119,
-    -0.689144,
-    -0.688168,
-    -0.687191,
-    -0.686213,
-    -0.685237,
-    -0.684263,
-    -0.683288,
-    -0.682311,
-    -0.681333,
-    -0.680357,
-    -0.679381,
-    -0.678407,
-    -0.677431,
-    -0.676454,
-    -0.675476,
-    -0.6745,
-    -0.673525,
-    -0.67255,
-    -0.671574,
-    -0.670596,
-    -0.669619,
-    -0.668644,
-    -0.667669,
-    -0.666694,
-    -0.665717,
-    -0.664739,
-    -0.663763,
-    -0.662788,
-    -0.661813,
-    -0.660837,
-    -0.659859,
-    -0.658882,
-    -0.657906,
-    -0.656932,
-    -0.655956,
-    -0.654979,
-    -0.654002,
-    -0.653025,
-    -0.65205,
-    -0.651075,
-    -0.650099,
-    -0.649122,
-    -0.648145,
-    -0.647169,
-    -0.646194,
-    -0.645219,
-    -0.644242,
-    -0.643265,
-    -0.642288,
-    -0.641313,
-    -0.640338,
-    -0.639362,
-    -0.638385,
-    -0.637407,
-    -0.636431,
-    -0.635457,
-    -0.634482,
-    -0.633505,
-    -0.632527,
-    -0.63155,
-    -0.630575,
-    -0.6296,
-    -0.628625,
-    -0.627648,
-    -0.62667,
-    -0.625694,
-    -0.624719,
-    -0.623744,
-    -0.622768,
-    -0.62179,
-    -0.620813,
-    -0.619838,
-    -0.618863,
-    -0.617887,
-    -0.616911,
-    -0.615933,
-    -0.614956,
-    -0.613981,
-    -0.613007,
-    -0.612031,
-    -0.611053,
-    -0.610076,
-    -0.6091,
-    -0.608125,
-    -0.60715,
-    -0.606173,
-    -0.605196,
-    -0.604219,
-    -0.603244,
-    -0.602269,
-    -0.601293,
-    -0.600316,
-    -0.599339,
-    -0.598363,
-    -0.597388,
-    -0.596413,
-    -0.595436,
-    -0.594459,
-    -0.593482,
-    -0.592506,
-    -0.591532,
-    -0.590556,
-    -0.589579,
-    -0.588601,
-    -0.587625,
-    -0.58665,
-    -0.585675,
-    -0.584699,
-    -0.583721,
-    -0.582744,
-    -0.581769,
-    -0.580794,
-    -0.579819,
-    -0.578842,
-    -0.577864,
-    -0.576888,
-    -0.575913,
-    -0.574938,
-    -0.573962,
-    -0.572984,
-    -0.572007,
-    -0.571031,
-    -0.570057,
-    -0.569081,
-    -0.568104,
-    -0.567127,
-    -0.56615,
-    -0.565175,
-    -0.5642,
-    -0.563224,
-    -0.562247,
-    -0.56127,
-    -0.560294,
-    -0.559319,
-    -0.558344,
-    -0.557367,
-    -0.55639,
-    -0.555413,
-    -0.554438,
-    -0.553463,
-    -0.552487,
-    -0.55151,
-    -0.550533,
-    -0.549556,
-    -0.548581,
-    -0.547606,
-    -0.54663,
-    -0.545653,
-    -0.544676,
-    -0.5437,
-    -0.542725,
-    -0.54175,
-    -0.540773,
-    -0.539795,
-    -0.538819,
-    -0.537844,
-    -0.536869,
-    -0.535893,
-    -0.534915,
-    -0.533938,
-    -0.532963,
-    -0.531988,
-    -0.531012,
-    -0.530035,
-    -0.529058,
-    -0.528082,
-    -0.527106,
-    -0.526131,
-    -0.525155,
-    -0.524178,
-    -0.523201,
-    -0.522225,
-    -0.52125,
-    -0.520275,
-    -0.519298,
-    -0.518321,
-    -0.517344,
-    -0.516369,
-    -0.515394,
-    -0.514418,
-    -0.513441,
-    -0.512464,
-    -0.511488,
-    -0.510513,
-    -0.509537,
-    -0.508561,
-    -0.507584,
-    -0.506607,
-    -0.505631,
-    -0.504656,
-    -0.503681,
-    -0.502704,
-    -0.501727,
-    -0.50075,
-    -0.499775,
-    -0.4988,
-    -0.497824,
-    -0.496847,
-    -0.49587,
-    -0.494894,
-    -0.493919,
-    -0.492943,
-    -0.491967,
-    -0.490989,
-    -0.490013,
-    -0.489038,
-    -0.488063,
-    -0.487087,
-    -0.486109,
-    -0.485132,
-    -0.484156,
-    -0.483181,
-    -0.482206,
-    -0.481229,
-    -0.480252,
-    -0.479276,
-    -0.4783,
-    -0.477325,
-    -0.476349,
-    -0.475372,
-    -0.474395,
-    -0.473419,
-    -0.472444,
-    -0.471469,
-    -0.470492,
-    -0.469515,
-    -0.468538,
-    -0.467563,
-    -0.466588,
-    -0.465612,
-    -0.464635,
-    -0.463658,
-    -0.462682,
-    -0.461706,
-    -0.460731,
-    -0.459755,
-    -0.458778,
-    -0.457801,
-    -0.456825,
-    -0.45585,
-    -0.454875,
-    -0.453898,
-    -0.452921,
-    -0.451944,
-    -0.450969,
-    -0.449994,
-    -0.449018,
-    -0.448041,
-    -0.447064,
-    -0.446088,
-    -0.445113,
-    -0.444137,
-    -0.443161,
-    -0.442183,
-    -0.441207,
-    -0.440231,
-    -0.439256,
-    -0.43828,
-    -0.437303,
-    -0.436326,
-    -0.43535,
-    -0.434375,
-    -0.4334,
-    -0.432423,
-    -0.431446,
-    -0.430469,
-    -0.429494,
-    -0.428519,
-    -0.427543,
-    -0.426566,
-    -0.425589,
-    -0.424613,
-    -0.423638,
-    -0.422662,
-    -0.421686,
-    -0.420709,
-    -0.419732,
-    -0.418756,
-    -0.417781,
-    -0.416806,
-    -0.415829,
-    -0.414852,
-    -0.413875,
-    -0.4129,
-    -0.411925,
-    -0.410949,
-    -0.409972,
-    -0.408995,
-    -0.408019,
-    -0.407044,
-    -0.406068,
-    -0.405092,
-    -0.404115,
-    -0.403138,
-    -0.402163,
-    -0.401187,
-    -0.400211,
-    -0.399234,
-    -0.398258,
-    -0.397282,
-    -0.396306,
-    -0.395331,
-    -0.394354,
-    -0.393377,
-    -0.392401,
-    -0.391425,
-    -0.39045,
-    -0.389474,
-    -0.388497,
-    -0.38752,
-    -0.386544,
-    -0.385569,
-    -0.384594,
-    -0.383617,
-    -0.38264,
-    -0.381663,
-    -0.380688,
-    -0.379713,
-    -0.378737,
-    -0.37776,
-    -0.376783,
-    -0.375807,
-    -0.374831,
-    -0.373856,
-    -0.37288,
-    -0.371903,
-    -0.370926,
-    -0.36995,
-    -0.368975,
-    -0.367999,
-    -0.367023,
-    -0.366046,
-    -0.365069,
-    -0.364094,
-    -0.363119,
-    -0.362143,
-    -0.361166,
-    -0.360189,
-    -0.359213,
-    -0.358238,
-    -0.357262,
-    -0.356286,
-    -0.355308,
-    -0.354332,
-    -0.353356,
-    -0.352381,
-    -0.351405,
-    -0.350428,
-    -0.349451,
-    -0.348475,
-    -0.3475,
-    -0.346525,
-    -0.345548,
-    -0.344571,
-    -0.343595,
-    -0.342619,
-    -0.341644,
-    -0.340668,
-    -0.339691,
-    -0.338714,
-    -0.337738,
-    -0.336763,
-    -0.335787,
-    -0.334811,
-    -0.333834,
-    -0.332857,
-    -0.331881,
-    -0.330906,
-    -0.329931,
-    -0.328954,
-    -0.327977,
-    -0.327001,
-    -0.326025,
-    -0.32505,
-    -0.324074,
-    -0.323097,
-    -0.32212,
-    -0.321144,
-    -0.320169,
-    -0.319193,
-    -0.318217,
-    -0.31724,
-    -0.316263,
-    -0.315288,
-    -0.314312,
-    -0.313336,
-    -0.31236,
-    -0.311383,
-    -0.310407,
-    -0.309431,
-    -0.308456,
-    -0.307479,
-    -0.306502,
-    -0.305526,
-    -0.30455,
-    -0.303575,
-    -0.302599,
-    -0.301622,
-    -0.300645,
-    -0.299669,
-    -0.298694,
-    -0.297718,
-    -0.296742,
-    -0.295765,
-    -0.294788,
-    -0.293813,
-    -0.292838,
-    -0.291862,
-    -0.290885,
-    -0.289908,
-    -0.288932,
-    -0.287956,
-    -0.286981,
-    -0.286005,
-    -0.285028,
-    -0.284051,
-    -0.283075,
-    -0.2821,
-    -0.281124,
-    -0.280148,
-    -0.279171,
-    -0.278194,
-    -0.277219,
-    -0.276244,
-    -0.275268,
-    -0.274291,
-    -0.273314,
-    -0.272338,
-    -0.271363,
-    -0.270387,
-    -0.269411,
-    -0.268434,
-    -0.267457,
-    -0.266481,
-    -0.265506,
-    -0.26453,
-    -0.263553,
-    -0.262577,
-    -0.2616,
-    -0.260625,
-    -0.25965,
-    -0.258673,
-    -0.257696,
-    -0.25672,
-    -0.255744,
-    -0.254769,
-    -0.253793,
-    -0.252816,
-    -0.251839,
-    -0.250863,
-    -0.249888,
-    -0.248912,
-    -0.247936,
-    -0.246959,
-    -0.245982,
-    -0.245007,
-    -0.244031,
-    -0.243056,
-    -0.242079,
-    -0.241102,
-    -0.240126,
-    -0.23915,
-    -0.238175,
-    -0.237199,
-    -0.236222,
-    -0.235245,
-    -0.234269,
-    -0.233294,
-    -0.232318,
-    -0.231342,
-    -0.230365,
-    -0.229388,
-    -0.228413,
-    -0.227437,
-    -0.226461,
-    -0.225485,
-    -0.224508,
-    -0.223532,
-    -0.222556,
-    -0.221581,
-    -0.220604,
-    -0.219627,
-    -0.218651,
-    -0.217675,
-    -0.2167,
-    -0.215724,
-    -0.214747,
-    -0.21377,
-    -0.212794,
-    -0.211819,
-    -0.210843,
-    -0.209867,
-    -0.20889,
-    -0.207914,
-    -0.206938,
-    -0.205962,
-    -0.204987,
-    -0.20401,
-    -0.203033,
-    -0.202057,
-    -0.201081,
-    -0.200106,
-    -0.19913,
-    -0.198153,
-    -0.197176,
-    -0.1962,
-    -0.195225,
-    -0.194249,
-    -0.193273,
-    -0.192296,
-    -0.191319,
-    -0.190344,
-    -0.189369,
-    -0.188393,
-    -0.187416,
-    -0.186439,
-    -0.185463,
-    -0.184488,
-    -0.183512,
-    -0.182536,
-    -0.181559,
-    -0.180582,
-    -0.179606,
-    -0.178631,
-    -0.177655,
-    -0.176678,
-    -0.175702,
-    -0.174725,
-    -0.17375,
-    -0.172775,
-    -0.171798,
-    -0.170821,
-    -0.169845,
-    -0.168869,
-    -0.167894,
-    -0.166918,
-    -0.165941,
-    -0.164964,
-    -0.163988,
-    -0.163013,
-    -0.162037,
-    -0.161061,
-    -0.160084,
-    -0.159107,
-    -0.158132,
-    -0.157156,
-    -0.156181,
-    -0.155204,
-    -0.154227,
-    -0.153251,
-    -0.152275,
-    -0.1513,
-    -0.150324,
-    -0.149347,
-    -0.14837,
-    -0.147394,
-    -0.146419,
-    -0.145443,
-    -0.144467,
-    -0.14349,
-    -0.142513,
-    -0.141538,
-    -0.140562,
-    -0.139586,
-    -0.13861,
-    -0.137633,
-    -0.136657,
-    -0.135681,
-    -0.134706,
-    -0.133729,
-    -0.132752,
-    -0.131776,
-    -0.1308,
-    -0.129825,
-    -0.128849,
-    -0.127872,
-    -0.126895,
-    -0.125919,
-    -0.124944,
-    -0.123968,
-    -0.122992,
-    -0.122015,
-    -0.121039,
-    -0.120063,
-    -0.119087,
-    -0.118112,
-    -0.117135,
-    -0.116158,
-    -0.115182,
-    -0.114206,
-    -0.113231,
-    -0.112255,
-    -0.111278,
-    -0.110301,
-    -0.109325,
-    -0.10835,
-    -0.107374,
-    -0.106398,
-    -0.105421,
-    -0.104444,
-    -0.103469,
-    -0.102494,
-    -0.101518,
-    -0.100541,
-    -0.0995639,
-    -0.0985879,
-    -0.0976125,
-    -0.096637,
-    -0.0956606,
-    -0.0946837,
-    -0.0937071,
-    -0.0927314,
-    -0.0917561,
-    -0.0907802,
-    -0.0898035,
-    -0.0888266,
-    -0.0878504,
-    -0.086875,
-    -0.0858996,
-    -0.0849233,
-    -0.0839464,
-    -0.0829697,
-    -0.081994,
-    -0.0810186,
-    -0.0800429,
-    -0.0790663,
-    -0.0780893,
-    -0.077113,
-    -0.0761376,
-    -0.0751621,
-    -0.074186,
-    -0.0732092,
-    -0.0722324,
-    -0.0712565,
-    -0.0702812,
-    -0.0693055,
-    -0.068329,
-    -0.0673521,
-    -0.0663757,
-    -0.0654001,
-    -0.0644247,
-    -0.0634487,
-    -0.0624719,
-    -0.0614951,
-    -0.0605191,
-    -0.0595437,
-    -0.0585681,
-    -0.0575917,
-    -0.0566148,
-    -0.0556383,
-    -0.0546626,
-    -0.0536873,
-    -0.0527114,
-    -0.0517347,
-    -0.0507578,
-    -0.0497817,
-    -0.0488062,
-    -0.0478308,
-    -0.0468545,
-    -0.0458775,
-    -0.0449009,
-    -0.0439252,
-    -0.0429498,
-    -0.041974,
-    -0.0409974,
-    -0.0400205,
-    -0.0390442,
-    -0.0380688,
-    -0.0370934,
-    -0.0361172,
-    -0.0351403,
-    -0.0341636,
-    -0.0331877,
-    -0.0322124,
-    -0.0312367,
-    -0.0302601,
-    -0.0292832,
-    -0.0283069,
-    -0.0273313,
-    -0.0263559,
-    -0.0253799,
-    -0.024403,
-    -0.0234263,
-    -0.0224503,
-    -0.0214749,
-    -0.0204993,
-    -0.0195229,
-    -0.018546,
-    -0.0175695,
-    -0.0165938,
-    -0.0156185,
-    -0.0146426,
-    -0.0136658,
-    -0.012689,
-    -0.0117129,
-    -0.0107375,
-    -0.00976195,
-    -0.00878561,
-    -0.0078087,
-    -0.00683212,
-    -0.00585639,
-    -0.00488106,
-    -0.00390523,
-    -0.00292855,
-    -0.00195167,
-    -0.000975447,
-    0,
-    0.000975447,
-    0.00195167,
-    0.00292855,
-    0.00390523,
-    0.00488106,
-    0.00585639,
-    0.00683212,
-    0.0078087,
-    0.00878561,
-    0.00976195,
-    0.0107375,
-    0.0117129,
-    0.012689,
-    0.0136658,
-    0.0146426,
-    0.0156185,
-    0.0165938,
-    0.0175695,
-    0.018546,
-    0.0195229,
-    0.0204993,
-    0.0214749,
-    0.0224503,
-    0.0234263,
-    0.024403,
-    0.0253799,
-    0.0263559,
-    0.0273313,
-    0.0283069,
-    0.0292832,
-    0.0302601,
-    0.0312367,
-    0.0322124,
-    0.0331877,
-    0.0341636,
-    0.0351403,
-    0.0361172,
-    0.0370934,
-    0.0380688,
-    0.0390442,
-    0.0400205,
-    0.0409974,
-    0.041974,
-    0.0429498,
-    0.0439252,
-    0.0449009,
-    0.0458775,
-    0.0468545,
-    0.0478308,
-    0.0488062,
-    0.0497817,
-    0.0507578,
-    0.0517347,
-    0.0527114,
-    0.0536873,
-    0.0546626,
-    0.0556383,
-    0.0566148,
-    0.0575917,
-    0.0585681,
-    0.0595437,
-    0.0605191,
-    0.0614951,
-    0.0624719,
-    0.0634487,
-    0.0644247,
-    0.0654001,
-    0.0663757,
-    0.0673521,
-    0.068329,
-    0.0693055,
-    0.0702812,
-    0.0712565,
-    0.0722324,
-    0.0732092,
-    0.074186,
-    0.0751621,
-    0.0761376,
-    0.077113,
-    0.0780893,
-    0.0790663,
-    0.0800429,
-    0.0810186,
-    0.081994,
-    0.0829697,
-    0.0839464,
-    0.0849233,
-    0.0858996,
-    0.086875,
-    0.0878504,
-    0.0888266,
-    0.0898035,
-    0.0907802,
-    0.0917561,
-    0.0927314,
-    0.0937071,
-    0.0946837,
-    0.0956606,
-    0.096637,
-    0.0976125,
-    0.0985879,
-    0.0995639,
-    0.100541,
-    0.101518,
-    0.102494,
-    0.103469,
-    0.104444,
-    0.105421,
-    0.106398,
-    0.107374,
-    0.10835,
-    0.109325,
-    0.110301,
-    0.111278,
-    0.112255,
-    0.113231,
-    0.114206,
-    0.115182,
-    0.116158,
-    0.117135,
-    0.118112,
-    0.119087,
-    0.120063,
-    0.121039,
-    0.122015,
-    0.122992,
-    0.123968,
-    0.124944,
-    0.125919,
-    0.126895,
-    0.127872,
-    0.128849,
-    0.129825,
-    0.1308,
-    0.131776,
-    0.132752,
-    0.133729,
-    0.134706,
-    0.135681,
-    0.136657,
-    0.137633,
-    0.13861,
-    0.139586,
-    0.140562,
-    0.141538,
-    0.142513,
-    0.14349,
-    0.144467,
-    0.145443,
-    0.146419,
-    0.147394,
-    0.14837,
-    0.149347,
-    0.150324,
-    0.1513,
-    0.152275,
-    0.153251,
-    0.154227,
-    0.155204,
-    0.156181,
-    0.157156,
-    0.158132,
-    0.159107,
-    0.160084,
-    0.161061,
-    0.162037,
-    0.163013,
-    0.163988,
-    0.164964,
-    0.165941,
-    0.166918,
-    0.167894,
-    0.168869,
-    0.169845,
-    0.170821,
-    0.171798,
-    0.172775,
-    0.17375,
-    0.174725,
-    0.175702,
-    0.176678,
-    0.177655,
-    0.178631,
-    0.179606,
-    0.180582,
-    0.181559,
-    0.182536,
-    0.183512,
-    0.184488,
-    0.185463,
-    0.186439,
-    0.187416,
-    0.188393,
-    0.189369,
-    0.190344,
-    0.191319,
-    0.192296,
-    0.193273,
-    0.194249,
-    0.195225,
-    0.1962,
-    0.197176,
-    0.198153,
-    0.19913,
-    0.200106,
-    0.201081,
-    0.202057,
-    0.203033,
-    0.20401,
-    0.204987,
-    0.205962,
-    0.206938,
-    0.207914,
-    0.20889,
-    0.209867,
-    0.210843,
-    0.211819,
-    0.212794,
-    0.21377,
-    0.214747,
-    0.215724,
-    0.2167,
-    0.217675,
-    0.218651,
-    0.219627,
-    0.220604,
-    0.221581,
-    0.222556,
-    0.223532,
-    0.224508,
-    0.225485,
-    0.226461,
-    0.227437,
-    0.228413,
-    0.229388,
-    0.230365,
-    0.231342,
-    0.232318,
-    0.233294,
-    0.234269,
-    0.235245,
-    0.236222,
-    0.237199,
-    0.238175,
-    0.23915,
-    0.240126,
-    0.241102,
-    0.242079,
-    0.243056,
-    0.244031,
-    0.245007,
-    0.245982,
-    0.246959,
-    0.247936,
-    0.248912,
-    0.249888,
-    0.250863,
-    0.251839,
-    0.252816,
-    0.253793,
-    0.254769,
-    0.255744,
-    0.25672,
-    0.257696,
-    0.258673,
-    0.25965,
-    0.260625,
-    0.2616,
-    0.262577,
-    0.263553,
-    0.26453,
-    0.265506,
-    0.266481,
-    0.267457,
-    0.268434,
-    0.269411,
-    0.270387,
-    0.271363,
-    0.272338,
-    0.273314,
-    0.274291,
-    0.275268,
-    0.276244,
-    0.277219,
-    0.278194,
-    0.279171,
-    0.280148,
-    0.281124,
-    0.2821,
-    0.283075,
-    0.284051,
-    0.285028,
-    0.286005,
-    0.286981,
-    0.287956,
-    0.288932,
-    0.289908,
-    0.290885,
-    0.291862,
-    0.292838,
-    0.293813,
-    0.294788,
-    0.295765,
-    0.296742,
-    0.297718,
-    0.298694,
-    0.299669,
-    0.300645,
-    0.301622,
-    0.302599,
-    0.303575,
-    0.30455,
-    0.305526,
-    0.306502,
-    0.307479,
-    0.308456,
-    0.309431,
-    0.310407,
-    0.311383,
-    0.31236,
-    0.313336,
-    0.314312,
-    0.315288,
-    0.316263,
-    0.31724,
-    0.318217,
-    0.319193,
-    0.320169,
-    0.321144,
-    0.32212,
-    0.323097,
-    0.324074,
-    0.32505,
-    0.326025,
-    0.327001,
-    0.327977,
-    0.328954,
-    0.329931,
-    0.330906,
-    0.331881,
-    0.332857,
-    0.333834,
-    0.334811,
-    0.335787,
-    0.336763,
-    0.337738,
-    0.338714,
-    0.339691,
-    0.340668,
-    0.341644,
-    0.342619,
-    0.343595,
-    0.344571,
-    0.345548,
-    0.346525,
-    0.3475,
-    0.348475,
-    0.349451,
-    0.350428,
-    0.351405,
-    0.352381,
-    0.353356,
-    0.354332,
-    0.355308,
-    0.356286,
-    0.357262,
-    0.358238,
-    0.359213,
-    0.360189,
-    0.361166,
-    0.362143,
-    0.363119,
-    0.364094,
-    0.365069,
-    0.366046,
-    0.367023,
-    0.367999,
-    0.368975,
-    0.36995,
-    0.370926,
-    0.371903,
-    0.37288,
-    0.373856,
-    0.374831,
-    0.375807,
-    0.376783,
-    0.37776,
-    0.378737,
-    0.379713,
-    0.380688,
-    0.381663,
-    0.38264,
-    0.383617,
-    0.384594,
-    0.385569,
-    0.386544,
-    0.38752,
-    0.388497,
-    0.389474,
-    0.39045,
-    0.391425,
-    0.392401,
-    0.393377,
-    0.394354,
-    0.395331,
-    0.396306,
-    0.397282,
-    0.398258,
-    0.399234,
-    0.400211,
-    0.401187,
-    0.402163,
-    0.403138,
-    0.404115,
-    0.405092,
-    0.406068,
-    0.407044,
-    0.408019,
-    0.408995,
-    0.409972,
-    0.410949,
-    0.411925,
-    0.4129,
-    0.413875,
-    0.414852,
-    0.415829,
-    0.416806,
-    0.417781,
-    0.418756,
-    0.419732,
-    0.420709,
-    0.421686,
-    0.422662,
-    0.423638,
-    0.424613,
-    0.425589,
-    0.426566,
-    0.427543,
-    0.428519,
-    0.429494,
-    0.430469,
-    0.431446,
-    0.432423,
-    0.4334,
-    0.434375,
-    0.43535,
-    0.436326,
-    0.437303,
-    0.43828,
-    0.439256,
-    0.440231,
-    0.441207,
-    0.442183,
-    0.443161,
-    0.444137,
-    0.445113,
-    0.446088,
-    0.447064,
-    0.448041,
-    0.449018,
-    0.449994,
-    0.450969,
-    0.451944,
-    0.452921,
-    0.453898,
-    0.454875,
-    0.45585,
-    0.456825,
-    0.457801,
-    0.458778,
-    0.459755,
-    0.460731,
-    0.461706,
-    0.462682,
-    0.463658,
-    0.464635,
-    0.465612,
-    0.466588,
-    0.467563,
-    0.468538,
-    0.469515,
-    0.470492,
-    0.471469,
-    0.472444,
-    0.473419,
-    0.474395,
-    0.475372,
-    0.476349,
-    0.477325,
-    0.4783,
-    0.479276,
-    0.480252,
-    0.481229,
-    0.482206,
-    0.483181,
-    0.484156,
-    0.485132,
-    0.486109,
-    0.487087,
-    0.488063,
-    0.489038,
-    0.490013,
-    0.490989,
-    0.491967,
-    0.492943,
-    0.493919,
-    0.494894,
-    0.49587,
-    0.496847,
-    0.497824,
-    0.4988,
-    0.499775,
-    0.50075,
-    0.501727,
-    0.502704,
-    0.503681,
-    0.504656,
-    0.505631,
-    0.506607,
-    0.507584,
-    0.508561,
-    0.509537,
-    0.510513,
-    0.511488,
-    0.512464,
-    0.513441,
-    0.514418,
-    0.515394,
-    0.516369,
-    0.517344,
-    0.518321,
-    0.519298,
-    0.520275,
-    0.52125,
-    0.522225,
-    0.523201,
-    0.524178,
-    0.525155,
-    0.526131,
-    0.527106,
-    0.528082,
-    0.529058,
-    0.530035,
-    0.531012,
-    0.531988,
-    0.532963,
-    0.533938,
-    0.534915,
-    0.535893,
-    0.536869,
-    0.537844,
-    0.538819,
-    0.539795,
-    0.540773,
-    0.54175,
-    0.542725,
-    0.5437,
-    0.544676,
-    0.545653,
-    0.54663,
-    0.547606,
-    0.548581,
-    0.549556,
-    0.550533,
-    0.55151,
-    0.552487,
-    0.553463,
-    0.554438,
-    0.555413,
-    0.55639,
-    0.557367,
-    0.558344,
-    0.559319,
-    0.560294,
-    0.56127,
-    0.562247,
-    0.563224,
-    0.5642,
-    0.565175,
-    0.56615,
-    0.567127,
-    0.568104,
-    0.569081,
-    0.570057,
-    0.571031,
-    0.572007,
-    0.572984,
-    0.573962,
-    0.574938,
-    0.575913,
-    0.576888,
-    0.577864,
-    0.578842,
-    0.579819,
-    0.580794,
-    0.581769,
-    0.582744,
-    0.583721,
-    0.584699,
-    0.585675,
-    0.58665,
-    0.587625,
-    0.588601,
-    0.589579,
-    0.590556,
-    0.591532,
-    0.592506,
-    0.593482,
-    0.594459,
-    0.595436,
-    0.596413,
-    0.597388,
-    0.598363,
-    0.599339,
-    0.600316,
-    0.601293,
-    0.602269,
-    0.603244,
-    0.604219,
-    0.605196,
-    0.606173,
-    0.60715,
-    0.608125,
-    0.6091,
-    0.610076,
-    0.611053,
-    0.612031,
-    0.613007,
-    0.613981,
-    0.614956,
-    0.615933,
-    0.616911,
-    0.617887,
-    0.618863,
-    0.619838,
-    0.620813,
-    0.62179,
-    0.622768,
-    0.623744,
-    0.624719,
-    0.625694,
-    0.62667,
-    0.627648,
-    0.628625,
-    0.6296,
-    0.630575,
-    0.63155,
-    0.632527,
-    0.633505,
-    0.634482,
-    0.635457,
-    0.636431,
-    0.637407,
-    0.638385,
-    0.639362,
-    0.640338,
-    0.641313,
-    0.642288,
-    0.643265,
-    0.644242,
-    0.645219,
-    0.646194,
-    0.647169,
-    0.648145,
-    0.649122,
-    0.650099,
-    0.651075,
-    0.65205,
-    0.653025,
-    0.654002,
-    0.654979,
-    0.655956,
-    0.656932,
-    0.657906,
-    0.658882,
-    0.659859,
-    0.660837,
-    0.661813,
-    0.662788,
-    0.663763,
-    0.664739,
-    0.665717,
-    0.666694,
-    0.667669,
-    0.668644,
-    0.669619,
-    0.670596,
-    0.671574,
-    0.67255,
-    0.673525,
-    0.6745,
-    0.675476,
-    0.676454,
-    0.677431,
-    0.678407,
-    0.679381,
-    0.680357,
-    0.681333,
-    0.682311,
-    0.683288,
-    0.684263,
-    0.685237,
-    0.686213,
-    0.687191,
-    0.688168,
-    0.689144,
-    0.690119,
-    0.691094,
-    0.692071,
-    0.693048,
-    0.694025,
-    0.695001,
-    0.695975,
-    0.696951,
-    0.697928,
-    0.698906,
-    0.699882,
-    0.700856,
-    0.701831,
-    0.702808,
-    0.703786,
-    0.704763,
-    0.705738,
-    0.706712,
-    0.707688,
-    0.708665,
-    0.709643,
-    0.710619,
-    0.711594,
-    0.712569,
-    0.713545,
-    0.714523,
-    0.7155,
-    0.716476,
-    0.71745,
-    0.718425,
-    0.719402,
-    0.72038,
-    0.721357,
-    0.722332,
-    0.723306,
-    0.724282,
-    0.72526,
-    0.726238,
-    0.727213,
-    0.728188,
-    0.729162,
-    0.730139,
-    0.731117,
-    0.732094,
-    0.733069,
-    0.734044,
-    0.735019,
-    0.735997,
-    0.736975,
-    0.737951,
-    0.738925,
-    0.7399,
-    0.740876,
-    0.741855,
-    0.742832,
-    0.743807,
-    0.744781,
-    0.745756,
-    0.746734,
-    0.747712,
-    0.748688,
-    0.749663,
-    0.750637,
-    0.751614,
-    0.752592,
-    0.753569,
-    0.754545,
-    0.755519,
-    0.756494,
-    0.757471,
-    0.758449,
-    0.759426,
-    0.7604,
-    0.761375,
-    0.762351,
-    0.763329,
-    0.764307,
-    0.765282,
-    0.766256,
-    0.767231,
-    0.768208,
-    0.769186,
-    0.770163,
-    0.771138,
-    0.772112,
-    0.773088,
-    0.774066,
-    0.775044,
-    0.77602,
-    0.776994,
-    0.777968,
-    0.778945,
-    0.779924,
-    0.780901,
-    0.781876,
-    0.78285,
-    0.783825,
-    0.784803,
-    0.785781,
-    0.786758,
-    0.787731,
-    0.788706,
-    0.789682,
-    0.790661,
-    0.791638,
-    0.792614,
-    0.793587,
-    0.794562,
-    0.79554,
-    0.796518,
-    0.797495,
-    0.798469,
-    0.799443,
-    0.800419,
-    0.801398,
-    0.802376,
-    0.803351,
-    0.804325,
-    0.805299,
-    0.806277,
-    0.807256,
-    0.808233,
-    0.809207,
-    0.81018,
-    0.811156,
-    0.812135,
-    0.813113,
-    0.814089,
-    0.815062,
-    0.816037,
-    0.817014,
-    0.817993,
-    0.81897,
-    0.819945,
-    0.820918,
-    0.821893,
-    0.822872,
-    0.823851,
-    0.824827,
-    0.8258,
-    0.826774,
-    0.827751,
-    0.82873,
-    0.829708,
-    0.830683,
-    0.831656,
-    0.83263,
-    0.833609,
-    0.834588,
-    0.835564,
-    0.836538,
-    0.837511,
-    0.838488,
-    0.839467,
-    0.840445,
-    0.84142,
-    0.842393,
-    0.843368,
-    0.844346,
-    0.845325,
-    0.846302,
-    0.847276,
-    0.848249,
-    0.849225,
-    0.850204,
-    0.851183,
-    0.852158,
-    0.853131,
-    0.854105,
-    0.855082,
-    0.856062,
-    0.85704,
-    0.858014,
-    0.858986,
-    0.859962,
-    0.860941,
-    0.86192,
-    0.862896,
-    0.863869,
-    0.864842,
-    0.865819,
-    0.866799,
-    0.867777,
-    0.868752,
-    0.869724,
-    0.870698,
-    0.871677,
-    0.872657,
-    0.873634,
-    0.874607,
-    0.875579,
-    0.876556,
-    0.877536,
-    0.878515,
-    0.87949,
-    0.880461,
-    0.881435,
-    0.882414,
-    0.883395,
-    0.884372,
-    0.885345,
-    0.886317,
-    0.887293,
-    0.888273,
-    0.889253,
-    0.890228,
-    0.891199,
-    0.892172,
-    0.893151,
-    0.894132,
-    0.89511,
-    0.896083,
-    0.897054,
-    0.898029,
-    0.89901,
-    0.89999,
-    0.900966,
-    0.901937,
-    0.902909,
-    0.903887,
-    0.904869,
-    0.905848,
-    0.906821,
-    0.907791,
-    0.908766,
-    0.909746,
-    0.910728,
-    0.911704,
-    0.912675,
-    0.913646,
-    0.914624,
-    0.915606,
-    0.916586,
-    0.917559,
-    0.918529,
-    0.919502,
-    0.920483,
-    0.921465,
-    0.922442,
-    0.923413,
-    0.924383,
-    0.92536,
-    0.926342,
-    0.927324,
-    0.928298,
-    0.929267,
-    0.930239,
-    0.931219,
-    0.932202,
-    0.933181,
-    0.934152,
-    0.93512,
-    0.936096,
-    0.937079,
-    0.938062,
-    0.939037,
-    0.940005,
-    0.940975,
-    0.941954,
-    0.942939,
-    0.94392,
-    0.944891,
-    0.945857,
-    0.946831,
-    0.947815,
-    0.9488,
-    0.949776,
-    0.950743,
-    0.951711,
-    0.95269,
-    0.953676,
-    0.954659,
-    0.95563,
-    0.956594,
-    0.957566,
-    0.95855,
-    0.959538,
-    0.960517,
-    0.961482,
-    0.962446,
-    0.963424,
-    0.964413,
-    0.9654,
-    0.966371,
-    0.967331,
-    0.968299,
-    0.969285,
-    0.970278,
-    0.971259,
-    0.972221,
-    0.97318,
-    0.974155,
-    0.97515,
-    0.976143,
-    0.977114,
-    0.978068,
-    0.979029,
-    0.980016,
-    0.981019,
-    0.982006,
-    0.982963,
-    0.983909,
-    0.98488,
-    0.985886,
-    0.986895,
-    0.987867,
-    0.9888,
-    0.989742,
-    0.990738,
-    0.991774,
-    0.992783,
-    0.993711,
-    0.994598,
-    0.995555,
-    0.996649,
-    0.997777,
-    0.998661,
-    0.999,
-    0.998661,
-    0.997777,
-    0.996649,
-    0.995555,
-    0.994598,
-    0.993711,
-    0.992783,
-    0.991774,
-    0.990738,
-    0.989742,
-    0.9888,
-    0.987867,
-    0.986895,
-    0.985886,
-    0.98488,
-    0.983909,
-    0.982963,
-    0.982006,
-    0.981019,
-    0.980016,
-    0.979029,
-    0.978068,
-    0.977114,
-    0.976143,
-    0.97515,
-    0.974155,
-    0.97318,
-    0.972221,
-    0.971259,
-    0.970278,
-    0.969285,
-    0.968299,
-    0.967331,
-    0.966371,
-    0.9654,
-    0.964413,
-    0.963424,
-    0.962446,
-    0.961482,
-    0.960517,
-    0.959538,
-    0.95855,
-    0.957566,
-    0.956594,
-    0.95563,
-    0.954659,
-    0.953676,
-    0.95269,
-    0.951711,
-    0.950743,
-    0.949776,
-    0.9488,
-    0.947815,
-    0.946831,
-    0.945857,
-    0.944891,
-    0.94392,
-    0.942939,
-    0.941954,
-    0.940975,
-    0.940005,
-    0.939037,
-    0.938062,
-    0.937079,
-    0.936096,
-    0.93512,
-    0.934152,
-    0.933181,
-    0.932202,
-    0.931219,
-    0.930239,
-    0.929267,
-    0.928298,
-    0.927324,
-    0.926342,
-    0.92536,
-    0.924383,
-    0.923413,
-    0.922442,
-    0.921465,
-    0.920483,
-    0.919502,
-    0.918529,
-    0.917559,
-    0.916586,
-    0.915606,
-    0.914624,
-    0.913646,
-    0.912675,
-    0.911704,
-    0.910728,
-    0.909746,
-    0.908766,
-    0.907791,
-    0.906821,
-    0.905848,
-    0.904869,
-    0.903887,
-    0.902909,
-    0.901937,
-    0.900966,
-    0.89999,
-    0.89901,
-    0.898029,
-    0.897054,
-    0.896083,
-    0.89511,
-    0.894132,
-    0.893151,
-    0.892172,
-    0.891199,
-    0.890228,
-    0.889253,
-    0.888273,
-    0.887293,
-    0.886317,
-    0.885345,
-    0.884372,
-    0.883395,
-    0.882414,
-    0.881435,
-    0.880461,
-    0.87949,
-    0.878515,
-    0.877536,
-    0.876556,
-    0.875579,
-    0.874607,
-    0.873634,
-    0.872657,
-    0.871677,
-    0.870698,
-    0.869724,
-    0.868752,
-    0.867777,
-    0.866799,
-    0.865819,
-    0.864842,
-    0.863869,
-    0.862896,
-    0.86192,
-    0.860941,
-    0.859962,
-    0.858986,
-    0.858014,
-    0.85704,
-    0.856062,
-    0.855082,
-    0.854105,
-    0.853131,
-    0.852158,
-    0.851183,
-    0.850204,
-    0.849225,
-    0.848249,
-    0.847276,
-    0.846302,
-    0.845325,
-    0.844346,
-    0.843368,
-    0.842393,
-    0.84142,
-    0.840445,
-    0.839467,
-    0.838488,
-    0.837511,
-    0.836538,
-    0.835564,
-    0.834588,
-    0.833609,
-    0.83263,
-    0.831656,
-    0.830683,
-    0.829708,
-    0.82873,
-    0.827751,
-    0.826774,
-    0.8258,
-    0.824827,
-    0.823851,
-    0.822872,
-    0.821893,
-    0.820918,
-    0.819945,
-    0.81897,
-    0.817993,
-    0.817014,
-    0.816037,
-    0.815062,
-    0.814089,
-    0.813113,
-    0.812135,
-    0.811156,
-    0.81018,
-    0.809207,
-    0.808233,
-    0.807256,
-    0.806277,
-    0.805299,
-    0.804325,
-    0.803351,
-    0.802376,
-    0.801398,
-    0.800419,
-    0.799443,
-    0.798469,
-    0.797495,
-    0.796518,
-    0.79554,
-    0.794562,
-    0.793587,
-    0.792614,
-    0.791638,
-    0.790661,
-    0.789682,
-    0.788706,
-    0.787731,
-    0.786758,
-    0.785781,
-    0.784803,
-    0.783825,
-    0.78285,
-    0.781876,
-    0.780901,
-    0.779924,
-    0.778945,
-    0.777968,
-    0.776994,
-    0.77602,
-    0.775044,
-    0.774066,
-    0.773088,
-    0.772112,
-    0.771138,
-    0.770163,
-    0.769186,
-    0.768208,
-    0.767231,
-    0.766256,
-    0.765282,
-    0.764307,
-    0.763329,
-    0.762351,
-    0.761375,
-    0.7604,
-    0.759426,
-    0.758449,
-    0.757471,
-    0.756494,
-    0.755519,
-    0.754545,
-    0.753569,
-    0.752592,
-    0.751614,
-    0.750637,
-    0.749663,
-    0.748688,
-    0.747712,
-    0.746734,
-    0.745756,
-    0.744781,
-    0.743807,
-    0.742832,
-    0.741855,
-    0.740876,
-    0.7399,
-    0.738925,
-    0.737951,
-    0.736975,
-    0.735997,
-    0.735019,
-    0.734044,
-    0.733069,
-    0.732094,
-    0.731117,
-    0.730139,
-    0.729162,
-    0.728188,
-    0.727213,
-    0.726238,
-    0.72526,
-    0.724282,
-    0.723306,
-    0.722332,
-    0.721357,
-    0.72038,
-    0.719402,
-    0.718425,
-    0.71745,
-    0.716476,
-    0.7155,
-    0.714523,
-    0.713545,
-    0.712569,
-    0.711594,
-    0.710619,
-    0.709643,
-    0.708665,
-    0.707688,
-    0.706712,
-    0.705738,
-    0.704763,
-    0.703786,
-    0.702808,
-    0.701831,
-    0.700856,
-    0.699882,
-    0.698906,
-    0.697928,
-    0.696951,
-    0.695975,
-    0.695001,
-    0.694025,
-    0.693048,
-    0.692071,
-    0.691094,
-    0.690119,
-    0.689144,
-    0.688168,
-    0.687191,
-    0.686213,
-    0.685237,
-    0.684263,
-    0.683288,
-    0.682311,
-    0.681333,
-    0.680357,
-    0.679381,
-    0.678407,
-    0.677431,
-    0.676454,
-    0.675476,
-    0.6745,
-    0.673525,
-    0.67255,
-    0.671574,
-    0.670596,
-    0.669619,
-    0.668644,
-    0.667669,
-    0.666694,
-    0.665717,
-    0.664739,
-    0.663763,
-    0.662788,
-    0.661813,
-    0.660837,
-    0.659859,
-    0.658882,
-    0.657906,
-    0.656932,
-    0.655956,
-    0.654979,
-    0.654002,
-    0.653025,
-    0.65205,
-    0.651075,
-    0.650099,
-    0.649122,
-    0.648145,
-    0.647169,
-    0.646194,
-    0.645219,
-    0.644242,
-    0.643265,
-    0.642288,
-    0.641313,
-    0.640338,
-    0.639362,
-    0.638385,
-    0.637407,
-    0.636431,
-    0.635457,
-    0.634482,
-    0.633505,
-    0.632527,
-    0.63155,
-    0.630575,
-    0.6296,
-    0.628625,
-    0.627648,
-    0.62667,
-    0.625694,
-    0.624719,
-    0.623744,
-    0.622768,
-    0.62179,
-    0.620813,
-    0.619838,
-    0.618863,
-    0.617887,
-    0.616911,
-    0.615933,
-    0.614956,
-    0.613981,
-    0.613007,
-    0.612031,
-    0.611053,
-    0.610076,
-    0.6091,
-    0.608125,
-    0.60715,
-    0.606173,
-    0.605196,
-    0.604219,
-    0.603244,
-    0.602269,
-    0.601293,
-    0.600316,
-    0.599339,
-    0.598363,
-    0.597388,
-    0.596413,
-    0.595436,
-    0.594459,
-    0.593482,
-    0.592506,
-    0.591532,
-    0.590556,
-    0.589579,
-    0.588601,
-    0.587625,
-    0.58665,
-    0.585675,
-    0.584699,
-    0.583721,
-    0.582744,
-    0.581769,
-    0.580794,
-    0.579819,
-    0.578842,
-    0.577864,
-    0.576888,
-    0.575913,
-    0.574938,
-    0.573962,
-    0.572984,
-    0.572007,
-    0.571031,
-    0.570057,
-    0.569081,
-    0.568104,
-    0.567127,
-    0.56615,
-    0.565175,
-    0.5642,
-    0.563224,
-    0.562247,
-    0.56127,
-    0.560294,
-    0.559319,
-    0.558344,
-    0.557367,
-    0.55639,
-    0.555413,
-    0.554438,
-    0.553463,
-    0.552487,
-    0.55151,
-    0.550533,
-    0.549556,
-    0.548581,
-    0.547606,
-    0.54663,
-    0.545653,
-    0.544676,
-    0.5437,
-    0.542725,
-    0.54175,
-    0.540773,
-    0.539795,
-    0.538819,
-    0.537844,
-    0.536869,
-    0.535893,
-    0.534915,
-    0.533938,
-    0.532963,
-    0.531988,
-    0.531012,
-    0.530035,
-    0.529058,
-    0.528082,
-    0.527106,
-    0.526131,
-    0.525155,
-    0.524178,
-    0.523201,
-    0.522225,
-    0.52125,
-    0.520275,
-    0.519298,
-    0.518321,
-    0.517344,
-    0.516369,
-    0.515394,
-    0.514418,
-    0.513441,
-    0.512464,
-    0.511488,
-    0.510513,
-    0.509537,
-    0.508561,
-    0.507584,
-    0.506607,
-    0.505631,
-    0.504656,
-    0.503681,
-    0.502704,
-    0.501727,
-    0.50075,
-    0.499775,
-    0.4988,
-    0.497824,
-    0.496847,
-    0.49587,
-    0.494894,
-    0.493919,
-    0.492943,
-    0.491967,
-    0.490989,
-    0.490013,
-    0.489038,
-    0.488063,
-    0.487087,
-    0.486109,
-    0.485132,
-    0.484156,
-    0.483181,
-    0.482206,
-    0.481229,
-    0.480252,
-    0.479276,
-    0.4783,
-    0.477325,
-    0.476349,
-    0.475372,
-    0.474395,
-    0.473419,
-    0.472444,
-    0.471469,
-    0.470492,
-    0.469515,
-    0.468538,
-    0.467563,
-    0.466588,
-    0.465612,
-    0.464635,
-    0.463658,
-    0.462682,
-    0.461706,
-    0.460731,
-    0.459755,
-    0.458778,
-    0.457801,
-    0.456825,
-    0.45585,
-    0.454875,
-    0.453898,
-    0.452921,
-    0.451944,
-    0.450969,
-    0.449994,
-    0.449018,
-    0.448041,
-    0.447064,
-    0.446088,
-    0.445113,
-    0.444137,
-    0.443161,
-    0.442183,
-    0.441207,
-    0.440231,
-    0.439256,
-    0.43828,
-    0.437303,
-    0.436326,
-    0.43535,
-    0.434375,
-    0.4334,
-    0.432423,
-    0.431446,
-    0.430469,
-    0.429494,
-    0.428519,
-    0.427543,
-    0.426566,
-    0.425589,
-    0.424613,
-    0.423638,
-    0.422662,
-    0.421686,
-    0.420709,
-    0.419732,
-    0.418756,
-    0.417781,
-    0.416806,
-    0.415829,
-    0.414852,
-    0.413875,
-    0.4129,
-    0.411925,
-    0.410949,
-    0.409972,
-    0.408995,
-    0.408019,
-    0.407044,
-    0.406068,
-    0.405092,
-    0.404115,
-    0.403138,
-    0.402163,
-    0.401187,
-    0.400211,
-    0.399234,
-    0.398258,
-    0.397282,
-    0.396306,
-    0.395331,
-    0.394354,
-    0.393377,
-    0.392401,
-    0.391425,
-    0.39045,
-    0.389474,
-    0.388497,
-    0.38752,
-    0.386544,
-    0.385569,
-    0.384594,
-    0.383617,
-    0.38264,
-    0.381663,
-    0.380688,
-    0.379713,
-    0.378737,
-    0.37776,
-    0.376783,
-    0.375807,
-    0.374831,
-    0.373856,
-    0.37288,
-    0.371903,
-    0.370926,
-    0.36995,
-    0.368975,
-    0.367999,
-    0.367023,
-    0.366046,
-    0.365069,
-    0.364094,
-    0.363119,
-    0.362143,
-    0.361166,
-    0.360189,
-    0.359213,
-    0.358238,
-    0.357262,
-    0.356286,
-    0.355308,
-    0.354332,
-    0.353356,
-    0.352381,
-    0.351405,
-    0.350428,
-    0.349451,
-    0.348475,
-    0.3475,
-    0.346525,
-    0.345548,
-    0.344571,
-    0.343595,
-    0.342619,
-    0.341644,
-    0.340668,
-    0.339691,
-    0.338714,
-    0.337738,
-    0.336763,
-    0.335787,
-    0.334811,
-    0.333834,
-    0.332857,
-    0.331881,
-    0.330906,
-    0.329931,
-    0.328954,
-    0.327977,
-    0.327001,
-    0.326025,
-    0.32505,
-    0.324074,
-    0.323097,
-    0.32212,
-    0.321144,
-    0.320169,
-    0.319193,
-    0.318217,
-    0.31724,
-    0.316263,
-    0.315288,
-    0.314312,
-    0.313336,
-    0.31236,
-    0.311383,
-    0.310407,
-    0.309431,
-    0.308456,
-    0.307479,
-    0.306502,
-    0.305526,
-    0.30455,
-    0.303575,
-    0.302599,
-    0.301622,
-    0.300645,
-    0.299669,
-    0.298694,
-    0.297718,
-    0.296742,
-    0.295765,
-    0.294788,
-    0.293813,
-    0.292838,
-    0.291862,
-    0.290885,
-    0.289908,
-    0.288932,
-    0.287956,
-    0.286981,
-    0.286005,
-    0.285028,
-    0.284051,
-    0.283075,
-    0.2821,
-    0.281124,
-    0.280148,
-    0.279171,
-    0.278194,
-    0.277219,
-    0.276244,
-    0.275268,
-    0.274291,
-    0.273314,
-    0.272338,
-    0.271363,
-    0.270387,
-    0.269411,
-    0.268434,
-    0.267457,
-    0.266481,
-    0.265506,
-    0.26453,
-    0.263553,
-    0.262577,
-    0.2616,
-    0.260625,
-    0.25965,
-    0.258673,
-    0.257696,
-    0.25672,
-    0.255744,
-    0.254769,
-    0.253793,
-    0.252816,
-    0.251839,
-    0.250863,
-    0.249888,
-    0.248912,
-    0.247936,
-    0.246959,
-    0.245982,
-    0.245007,
-    0.244031,
-    0.243056,
-    0.242079,
-    0.241102,
-    0.240126,
-    0.23915,
-    0.238175,
-    0.237199,
-    0.236222,
-    0.235245,
-    0.234269,
-    0.233294,
-    0.232318,
-    0.231342,
-    0.230365,
-    0.229388,
-    0.228413,
-    0.227437,
-    0.226461,
-    0.225485,
-    0.224508,
-    0.223532,
-    0.222556,
-    0.221581,
-    0.220604,
-    0.219627,
-    0.218651,
-    0.217675,
-    0.2167,
-    0.215724,
-    0.214747,
-    0.21377,
-    0.212794,
-    0.211819,
-    0.210843,
-    0.209867,
-    0.20889,
-    0.207914,
-    0.206938,
-    0.205962,
-    0.204987,
-    0.20401,
-    0.203033,
-    0.202057,
-    0.201081,
-    0.200106,
-    0.19913,
-    0.198153,
-    0.197176,
-    0.1962,
-    0.195225,
-    0.194249,
-    0.193273,
-    0.192296,
-    0.191319,
-    0.190344,
-    0.189369,
-    0.188393,
-    0.187416,
-    0.186439,
-    0.185463,
-    0.184488,
-    0.183512,
-    0.182536,
-    0.181559,
-    0.180582,
-    0.179606,
-    0.178631,
-    0.177655,
-    0.176678,
-    0.175702,
-    0.174725,
-    0.17375,
-    0.172775,
-    0.171798,
-    0.170821,
-    0.169845,
-    0.168869,
-    0.167894,
-    0.166918,
-    0.165941,
-    0.164964,
-    0.163988,
-    0.163013,
-    0.162037,
-    0.161061,
-    0.160084,
-    0.159107,
-    0.158132,
-    0.157156,
-    0.156181,
-    0.155204,
-    0.154227,
-    0.153251,
-    0.152275,
-    0.1513,
-    0.150324,
-    0.149347,
-    0.14837,
-    0.147394,
-    0.146419,
-    0.145443,
-    0.144467,
-    0.14349,
-    0.142513,
-    0.141538,
-    0.140562,
-    0.139586,
-    0.13861,
-    0.137633,
-    0.136657,
-    0.135681,
-    0.134706,
-    0.133729,
-    0.132752,
-    0.131776,
-    0.1308,
-    0.129825,
-    0.128849,
-    0.127872,
-    0.126895,
-    0.125919,
-    0.124944,
-    0.123968,
-    0.122992,
-    0.122015,
-    0.121039,
-    0.120063,
-    0.119087,
-    0.118112,
-    0.117135,
-    0.116158,
-    0.115182,
-    0.114206,
-    0.113231,
-    0.112255,
-    0.111278,
-    0.110301,
-    0.109325,
-    0.10835,
-    0.107374,
-    0.106398,
-    0.105421,
-    0.104444,
-    0.103469,
-    0.102494,
-    0.101518,
-    0.100541,
-    0.0995639,
-    0.0985879,
-    0.0976125,
-    0.096637,
-    0.0956606,
-    0.0946837,
-    0.0937071,
-    0.0927314,
-    0.0917561,
-    0.0907802,
-    0.0898035,
-    0.0888266,
-    0.0878504,
-    0.086875,
-    0.0858996,
-    0.0849233,
-    0.0839464,
-    0.0829697,
-    0.081994,
-    0.0810186,
-    0.0800429,
-    0.0790663,
-    0.0780893,
-    0.077113,
-    0.0761376,
-    0.0751621,
-    0.074186,
-    0.0732092,
-    0.0722324,
-    0.0712565,
-    0.0702812,
-    0.0693055,
-    0.068329,
-    0.0673521,
-    0.0663757,
-    0.0654001,
-    0.0644247,
-    0.0634487,
-    0.0624719,
-    0.0614951,
-    0.0605191,
-    0.0595437,
-    0.0585681,
-    0.0575917,
-    0.0566148,
-    0.0556383,
-    0.0546626,
-    0.0536873,
-    0.0527114,
-    0.0517347,
-    0.0507578,
-    0.0497817,
-    0.0488062,
-    0.0478308,
-    0.0468545,
-    0.0458775,
-    0.0449009,
-    0.0439252,
-    0.0429498,
-    0.041974,
-    0.0409974,
-    0.0400205,
-    0.0390442,
-    0.0380688,
-    0.0370934,
-    0.0361172,
-    0.0351403,
-    0.0341636,
-    0.0331877,
-    0.0322124,
-    0.0312367,
-    0.0302601,
-    0.0292832,
-    0.0283069,
-    0.0273313,
-    0.0263559,
-    0.0253799,
-    0.024403,
-    0.0234263,
-    0.0224503,
-    0.0214749,
-    0.0204993,
-    0.0195229,
-    0.018546,
-    0.0175695,
-    0.0165938,
-    0.0156185,
-    0.0146426,
-    0.0136658,
-    0.012689,
-    0.0117129,
-    0.0107375,
-    0.00976195,
-    0.00878561,
-    0.0078087,
-    0.00683212,
-    0.00585639,
-    0.00488106,
-    0.00390523,
-    0.00292855,
-    0.00195167,
-    0.000975447
-};
-
-// Top frequency: 44.1K * 0.00181406
-constexpr static std::array<float, 4096> wt_triangle_0x2 =
-{
-    0,
-    -0.000974523,
-    -0.00194954,
-    -0.0029254,
-    -0.00390218,
-    -0.00487968,
-    -0.00585747,
-    -0.00683503,
-    -0.00781192,
-    -0.0087879,
-    -0.00976302,
-    -0.0107376,
-    -0.0117121,
-    -0.012687,
-    -0.0136627,
-    -0.0146394,
-    -0.0156168,
-    -0.0165946,
-    -0.0175722,
-    -0.0185492,
-    -0.0195253,
-    -0.0205005,
-    -0.0214752,
-    -0.0224496,
-    -0.0234245,
-    -0.0244001,
-    -0.0253766,
-    -0.026354,
-    -0.0273318,
-    -0.0283094,
-    -0.0292865,
-    -0.0302627,
-    -0.0312381,
-    -0.0322127,
-    -0.0331872,
-    -0.034162,
-    -0.0351375,
-    -0.0361139,
-    -0.0370912,
-    -0.0380689,
-    -0.0390466,
-    -0.0400238,
-    -0.0410002,
-    -0.0419756,
-    -0.0429503,
-    -0.0439248,
-    -0.0448995,
-    -0.0458748,
-    -0.0468512,
-    -0.0478283,
-    -0.048806,
-    -0.0497838,
-    -0.0507611,
-    -0.0517375,
-    -0.0527131,
-    -0.0536879,
-    -0.0546623,
-    -0.055637,
-    -0.0566122,
-    -0.0575884,
-    -0.0585655,
-    -0.0595432,
-    -0.0605209,
-    -0.0614983,
-    -0.0624749,
-    -0.0634506,
-    -0.0644254,
-    -0.0653999,
-    -0.0663745,
-    -0.0673497,
-    -0.0683257,
-    -0.0693027,
-    -0.0702803,
-    -0.0712581,
-    -0.0722356,
-    -0.0732123,
-    -0.074188,
-    -0.075163,
-    -0.0761375,
-    -0.077112,
-    -0.0780871,
-    -0.079063,
-    -0.0800399,
-    -0.0810174,
-    -0.0819952,
-    -0.0829728,
-    -0.0839496,
-    -0.0849255,
-    -0.0859005,
-    -0.0868751,
-    -0.0878496,
-    -0.0888245,
-    -0.0898004,
-    -0.0907771,
-    -0.0917546,
-    -0.0927324,
-    -0.09371,
-    -0.0946869,
-    -0.0956629,
-    -0.0966381,
-    -0.0976126,
-    -0.0985871,
-    -0.099562,
-    -0.100538,
-    -0.101514,
-    -0.102492,
-    -0.10347,
-    -0.104447,
-    -0.105424,
-    -0.1064,
-    -0.107376,
-    -0.10835,
-    -0.109325,
-    -0.110299,
-    -0.111275,
-    -0.112252,
-    -0.113229,
-    -0.114207,
-    -0.115184,
-    -0.116162,
-    -0.117138,
-    -0.118113,
-    -0.119088,
-    -0.120062,
-    -0.121037,
-    -0.122012,
-    -0.122989,
-    -0.123966,
-    -0.124944,
-    -0.125922,
-    -0.126899,
-    -0.127875,
-    -0.128851,
-    -0.129825,
-    -0.1308,
-    -0.131774,
-    -0.13275,
-    -0.133726,
-    -0.134703,
-    -0.135681,
-    -0.136659,
-    -0.137636,
-    -0.138613,
-    -0.139588,
-    -0.140563,
-    -0.141537,
-    -0.142512,
-    -0.143487,
-    -0.144463,
-    -0.14544,
-    -0.146418,
-    -0.147396,
-    -0.148373,
-    -0.14935,
-    -0.150326,
-    -0.151301,
-    -0.152275,
-    -0.153249,
-    -0.154225,
-    -0.155201,
-    -0.156178,
-    -0.157155,
-    -0.158133,
-    -0.159111,
-    -0.160087,
-    -0.161063,
-    -0.162038,
-    -0.163013,
-    -0.163987,
-    -0.164962,
-    -0.165938,
-    -0.166915,
-    -0.167892,
-    -0.16887,
-    -0.169848,
-    -0.170825,
-    -0.171801,
-    -0.172776,
-    -0.17375,
-    -0.174725,
-    -0.175699,
-    -0.176675,
-    -0.177652,
-    -0.178629,
-    -0.179607,
-    -0.180585,
-    -0.181562,
-    -0.182538,
-    -0.183513,
-    -0.184488,
-    -0.185462,
-    -0.186437,
-    -0.187413,
-    -0.188389,
-    -0.189367,
-    -0.190344,
-    -0.191322,
-    -0.192299,
-    -0.193275,
-    -0.194251,
-    -0.195225,
-    -0.1962,
-    -0.197174,
-    -0.19815,
-    -0.199126,
-    -0.200104,
-    -0.201082,
-    -0.202059,
-    -0.203037,
-    -0.204013,
-    -0.204988,
-    -0.205963,
-    -0.206937,
-    -0.207912,
-    -0.208887,
-    -0.209864,
-    -0.210841,
-    -0.211819,
-    -0.212797,
-    -0.213774,
-    -0.21475,
-    -0.215726,
-    -0.2167,
-    -0.217675,
-    -0.218649,
-    -0.219625,
-    -0.220601,
-    -0.221578,
-    -0.222556,
-    -0.223534,
-    -0.224511,
-    -0.225488,
-    -0.226463,
-    -0.227438,
-    -0.228412,
-    -0.229387,
-    -0.230362,
-    -0.231338,
-    -0.232315,
-    -0.233293,
-    -0.234271,
-    -0.235248,
-    -0.236225,
-    -0.237201,
-    -0.238176,
-    -0.23915,
-    -0.240124,
-    -0.241099,
-    -0.242075,
-    -0.243052,
-    -0.24403,
-    -0.245008,
-    -0.245986,
-    -0.246962,
-    -0.247938,
-    -0.248913,
-    -0.249888,
-    -0.250862,
-    -0.251837,
-    -0.252813,
-    -0.25379,
-    -0.254767,
-    -0.255745,
-    -0.256723,
-    -0.2577,
-    -0.258676,
-    -0.259651,
-    -0.260625,
-    -0.2616,
-    -0.262574,
-    -0.26355,
-    -0.264527,
-    -0.265504,
-    -0.266482,
-    -0.26746,
-    -0.268437,
-    -0.269413,
-    -0.270388,
-    -0.271363,
-    -0.272337,
-    -0.273312,
-    -0.274287,
-    -0.275264,
-    -0.276241,
-    -0.277219,
-    -0.278197,
-    -0.279174,
-    -0.280151,
-    -0.281126,
-    -0.2821,
-    -0.283075,
-    -0.284049,
-    -0.285025,
-    -0.286001,
-    -0.286979,
-    -0.287957,
-    -0.288934,
-    -0.289912,
-    -0.290888,
-    -0.291863,
-    -0.292838,
-    -0.293812,
-    -0.294787,
-    -0.295762,
-    -0.296738,
-    -0.297716,
-    -0.298694,
-    -0.299672,
-    -0.300649,
-    -0.301625,
-    -0.302601,
-    -0.303576,
-    -0.30455,
-    -0.305524,
-    -0.306499,
-    -0.307476,
-    -0.308453,
-    -0.309431,
-    -0.310409,
-    -0.311386,
-    -0.312363,
-    -0.313338,
-    -0.314313,
-    -0.315287,
-    -0.316262,
-    -0.317237,
-    -0.318213,
-    -0.31919,
-    -0.320168,
-    -0.321146,
-    -0.322123,
-    -0.3231,
-    -0.324076,
-    -0.325051,
-    -0.326025,
-    -0.326999,
-    -0.327974,
-    -0.32895,
-    -0.329927,
-    -0.330905,
-    -0.331883,
-    -0.332861,
-    -0.333838,
-    -0.334814,
-    -0.335788,
-    -0.336763,
-    -0.337737,
-    -0.338712,
-    -0.339687,
-    -0.340664,
-    -0.341642,
-    -0.34262,
-    -0.343598,
-    -0.344575,
-    -0.345551,
-    -0.346526,
-    -0.3475,
-    -0.348474,
-    -0.349449,
-    -0.350425,
-    -0.351402,
-    -0.352379,
-    -0.353357,
-    -0.354335,
-    -0.355312,
-    -0.356288,
-    -0.357264,
-    -0.358238,
-    -0.359212,
-    -0.360187,
-    -0.361162,
-    -0.362139,
-    -0.363116,
-    -0.364094,
-    -0.365072,
-    -0.36605,
-    -0.367026,
-    -0.368001,
-    -0.368976,
-    -0.36995,
-    -0.370924,
-    -0.371899,
-    -0.372876,
-    -0.373853,
-    -0.374831,
-    -0.375809,
-    -0.376787,
-    -0.377763,
-    -0.378739,
-    -0.379713,
-    -0.380687,
-    -0.381662,
-    -0.382637,
-    -0.383613,
-    -0.38459,
-    -0.385568,
-    -0.386547,
-    -0.387524,
-    -0.388501,
-    -0.389476,
-    -0.390451,
-    -0.391425,
-    -0.392399,
-    -0.393374,
-    -0.39435,
-    -0.395328,
-    -0.396306,
-    -0.397284,
-    -0.398261,
-    -0.399238,
-    -0.400214,
-    -0.401188,
-    -0.402162,
-    -0.403137,
-    -0.404112,
-    -0.405088,
-    -0.406065,
-    -0.407043,
-    -0.408021,
-    -0.408999,
-    -0.409976,
-    -0.410951,
-    -0.411926,
-    -0.4129,
-    -0.413874,
-    -0.414849,
-    -0.415825,
-    -0.416802,
-    -0.41778,
-    -0.418758,
-    -0.419736,
-    -0.420713,
-    -0.421689,
-    -0.422664,
-    -0.423638,
-    -0.424612,
-    -0.425586,
-    -0.426562,
-    -0.427539,
-    -0.428517,
-    -0.429495,
-    -0.430473,
-    -0.43145,
-    -0.432426,
-    -0.433401,
-    -0.434375,
-    -0.435349,
-    -0.436324,
-    -0.437299,
-    -0.438276,
-    -0.439254,
-    -0.440232,
-    -0.44121,
-    -0.442188,
-    -0.443164,
-    -0.444139,
-    -0.445113,
-    -0.446087,
-    -0.447061,
-    -0.448037,
-    -0.449013,
-    -0.449991,
-    -0.450969,
-    -0.451947,
-    -0.452925,
-    -0.453901,
-    -0.454876,
-    -0.455851,
-    -0.456825,
-    -0.457799,
-    -0.458774,
-    -0.459751,
-    -0.460728,
-    -0.461706,
-    -0.462685,
-    -0.463662,
-    -0.464639,
-    -0.465614,
-    -0.466588,
-    -0.467562,
-    -0.468536,
-    -0.469511,
-    -0.470488,
-    -0.471465,
-    -0.472443,
-    -0.473422,
-    -0.4744,
-    -0.475376,
-    -0.476352,
-    -0.477326,
-    -0.4783,
-    -0.479274,
-    -0.480249,
-    -0.481225,
-    -0.482202,
-    -0.48318,
-    -0.484159,
-    -0.485137,
-    -0.486114,
-    -0.487089,
-    -0.488064,
-    -0.489038,
-    -0.490011,
-    -0.490986,
-    -0.491962,
-    -0.492939,
-    -0.493917,
-    -0.494896,
-    -0.495874,
-    -0.496851,
-    -0.497827,
-    -0.498801,
-    -0.499775,
-    -0.500749,
-    -0.501724,
-    -0.502699,
-    -0.503676,
-    -0.504655,
-    -0.505633,
-    -0.506611,
-    -0.507588,
-    -0.508564,
-    -0.509539,
-    -0.510513,
-    -0.511487,
-    -0.512461,
-    -0.513437,
-    -0.514414,
-    -0.515392,
-    -0.51637,
-    -0.517348,
-    -0.518326,
-    -0.519302,
-    -0.520277,
-    -0.521251,
-    -0.522224,
-    -0.523198,
-    -0.524174,
-    -0.525151,
-    -0.526129,
-    -0.527107,
-    -0.528086,
-    -0.529063,
-    -0.530039,
-    -0.531014,
-    -0.531988,
-    -0.532962,
-    -0.533936,
-    -0.534911,
-    -0.535888,
-    -0.536866,
-    -0.537844,
-    -0.538823,
-    -0.5398,
-    -0.540777,
-    -0.541752,
-    -0.542726,
-    -0.5437,
-    -0.544674,
-    -0.545649,
-    -0.546625,
-    -0.547603,
-    -0.548581,
-    -0.54956,
-    -0.550538,
-    -0.551514,
-    -0.55249,
-    -0.553464,
-    -0.554437,
-    -0.555411,
-    -0.556386,
-    -0.557362,
-    -0.55834,
-    -0.559318,
-    -0.560297,
-    -0.561275,
-    -0.562252,
-    -0.563227,
-    -0.564201,
-    -0.565175,
-    -0.566149,
-    -0.567123,
-    -0.568099,
-    -0.569077,
-    -0.570055,
-    -0.571034,
-    -0.572012,
-    -0.572989,
-    -0.573965,
-    -0.574939,
-    -0.575913,
-    -0.576886,
-    -0.577861,
-    -0.578836,
-    -0.579814,
-    -0.580792,
-    -0.581771,
-    -0.582749,
-    -0.583727,
-    -0.584702,
-    -0.585677,
-    -0.58665,
-    -0.587624,
-    -0.588598,
-    -0.589574,
-    -0.590551,
-    -0.591529,
-    -0.592508,
-    -0.593487,
-    -0.594464,
-    -0.59544,
-    -0.596415,
-    -0.597388,
-    -0.598361,
-    -0.599335,
-    -0.600311,
-    -0.601288,
-    -0.602266,
-    -0.603245,
-    -0.604224,
-    -0.605201,
-    -0.606178,
-    -0.607152,
-    -0.608126,
-    -0.609099,
-    -0.610073,
-    -0.611048,
-    -0.612025,
-    -0.613003,
-    -0.613982,
-    -0.614961,
-    -0.615939,
-    -0.616915,
-    -0.61789,
-    -0.618864,
-    -0.619837,
-    -0.62081,
-    -0.621785,
-    -0.622762,
-    -0.62374,
-    -0.624719,
-    -0.625698,
-    -0.626676,
-    -0.627653,
-    -0.628628,
-    -0.629601,
-    -0.630574,
-    -0.631548,
-    -0.632523,
-    -0.633499,
-    -0.634477,
-    -0.635456,
-    -0.636435,
-    -0.637413,
-    -0.63839,
-    -0.639365,
-    -0.640339,
-    -0.641312,
-    -0.642285,
-    -0.64326,
-    -0.644236,
-    -0.645214,
-    -0.646193,
-    -0.647172,
-    -0.648151,
-    -0.649128,
-    -0.650103,
-    -0.651077,
-    -0.65205,
-    -0.653023,
-    -0.653997,
-    -0.654973,
-    -0.655951,
-    -0.65693,
-    -0.657909,
-    -0.658888,
-    -0.659865,
-    -0.660841,
-    -0.661815,
-    -0.662788,
-    -0.663761,
-    -0.664735,
-    -0.66571,
-    -0.666688,
-    -0.667667,
-    -0.668646,
-    -0.669625,
-    -0.670603,
-    -0.671579,
-    -0.672553,
-    -0.673525,
-    -0.674498,
-    -0.675472,
-    -0.676447,
-    -0.677425,
-    -0.678404,
-    -0.679383,
-    -0.680362,
-    -0.68134,
-    -0.682316,
-    -0.68329,
-    -0.684263,
-    -0.685236,
-    -0.686209,
-    -0.687185,
-    -0.688162,
-    -0.68914,
-    -0.69012,
-    -0.6911,
-    -0.692078,
-    -0.693054,
-    -0.694028,
-    -0.695001,
-    -0.695974,
-    -0.696947,
-    -0.697922,
-    -0.698899,
-    -0.699877,
-    -0.700857,
-    -0.701837,
-    -0.702815,
-    -0.703792,
-    -0.704766,
-    -0.705739,
-    -0.706711,
-    -0.707684,
-    -0.708659,
-    -0.709636,
-    -0.710614,
-    -0.711594,
-    -0.712574,
-    -0.713552,
-    -0.714529,
-    -0.715504,
-    -0.716477,
-    -0.717449,
-    -0.718422,
-    -0.719396,
-    -0.720372,
-    -0.721351,
-    -0.722331,
-    -0.723311,
-    -0.72429,
-    -0.725267,
-    -0.726242,
-    -0.727215,
-    -0.728187,
-    -0.729159,
-    -0.730133,
-    -0.731109,
-    -0.732088,
-    -0.733068,
-    -0.734048,
-    -0.735027,
-    -0.736005,
-    -0.73698,
-    -0.737953,
-    -0.738925,
-    -0.739897,
-    -0.740871,
-    -0.741846,
-    -0.742824,
-    -0.743804,
-    -0.744785,
-    -0.745764,
-    -0.746742,
-    -0.747717,
-    -0.748691,
-    -0.749663,
-    -0.750635,
-    -0.751608,
-    -0.752583,
-    -0.753561,
-    -0.754541,
-    -0.755522,
-    -0.756502,
-    -0.75748,
-    -0.758455,
-    -0.759429,
-    -0.760401,
-    -0.761372,
-    -0.762345,
-    -0.76332,
-    -0.764298,
-    -0.765278,
-    -0.766258,
-    -0.767239,
-    -0.768217,
-    -0.769193,
-    -0.770167,
-    -0.771139,
-    -0.77211,
-    -0.773083,
-    -0.774057,
-    -0.775035,
-    -0.776014,
-    -0.776995,
-    -0.777976,
-    -0.778955,
-    -0.779931,
-    -0.780905,
-    -0.781877,
-    -0.782848,
-    -0.78382,
-    -0.784794,
-    -0.785771,
-    -0.786751,
-    -0.787732,
-    -0.788713,
-    -0.789692,
-    -0.790669,
-    -0.791643,
-    -0.792615,
-    -0.793586,
-    -0.794557,
-    -0.795531,
-    -0.796508,
-    -0.797487,
-    -0.798469,
-    -0.79945,
-    -0.80043,
-    -0.801407,
-    -0.802381,
-    -0.803353,
-    -0.804324,
-    -0.805295,
-    -0.806268,
-    -0.807245,
-    -0.808224,
-    -0.809205,
-    -0.810187,
-    -0.811167,
-    -0.812145,
-    -0.813119,
-    -0.814091,
-    -0.815062,
-    -0.816032,
-    -0.817005,
-    -0.817981,
-    -0.81896,
-    -0.819942,
-    -0.820924,
-    -0.821905,
-    -0.822883,
-    -0.823858,
-    -0.82483,
-    -0.8258,
-    -0.82677,
-    -0.827742,
-    -0.828718,
-    -0.829697,
-    -0.830678,
-    -0.831661,
-    -0.832642,
-    -0.833621,
-    -0.834596,
-    -0.835568,
-    -0.836538,
-    -0.837508,
-    -0.838479,
-    -0.839454,
-    -0.840433,
-    -0.841415,
-    -0.842397,
-    -0.84338,
-    -0.844359,
-    -0.845335,
-    -0.846307,
-    -0.847276,
-    -0.848245,
-    -0.849216,
-    -0.850191,
-    -0.851169,
-    -0.852151,
-    -0.853134,
-    -0.854117,
-    -0.855097,
-    -0.856073,
-    -0.857045,
-    -0.858015,
-    -0.858983,
-    -0.859953,
-    -0.860927,
-    -0.861905,
-    -0.862887,
-    -0.863871,
-    -0.864854,
-    -0.865835,
-    -0.866812,
-    -0.867784,
-    -0.868753,
-    -0.869721,
-    -0.87069,
-    -0.871663,
-    -0.872641,
-    -0.873623,
-    -0.874607,
-    -0.875591,
-    -0.876573,
-    -0.87755,
-    -0.878523,
-    -0.879492,
-    -0.880459,
-    -0.881427,
-    -0.882399,
-    -0.883377,
-    -0.884358,
-    -0.885343,
-    -0.886329,
-    -0.887311,
-    -0.888289,
-    -0.889262,
-    -0.890231,
-    -0.891197,
-    -0.892164,
-    -0.893135,
-    -0.894112,
-    -0.895094,
-    -0.896079,
-    -0.897066,
-    -0.89805,
-    -0.899029,
-    -0.900002,
-    -0.90097,
-    -0.901935,
-    -0.902901,
-    -0.903871,
-    -0.904847,
-    -0.905829,
-    -0.906815,
-    -0.907803,
-    -0.908788,
-    -0.909768,
-    -0.910742,
-    -0.91171,
-    -0.912674,
-    -0.913638,
-    -0.914607,
-    -0.915581,
-    -0.916563,
-    -0.91755,
-    -0.918539,
-    -0.919527,
-    -0.920508,
-    -0.921483,
-    -0.92245,
-    -0.923413,
-    -0.924375,
-    -0.925342,
-    -0.926315,
-    -0.927297,
-    -0.928285,
-    -0.929276,
-    -0.930266,
-    -0.931249,
-    -0.932224,
-    -0.933191,
-    -0.934152,
-    -0.935112,
-    -0.936076,
-    -0.937048,
-    -0.938029,
-    -0.939019,
-    -0.940013,
-    -0.941005,
-    -0.941991,
-    -0.942967,
-    -0.943933,
-    -0.944892,
-    -0.945849,
-    -0.946809,
-    -0.947779,
-    -0.94876,
-    -0.949752,
-    -0.950749,
-    -0.951745,
-    -0.952735,
-    -0.953713,
-    -0.954678,
-    -0.955633,
-    -0.956585,
-    -0.957541,
-    -0.958507,
-    -0.959488,
-    -0.960482,
-    -0.961485,
-    -0.962488,
-    -0.963483,
-    -0.964463,
-    -0.965426,
-    -0.966376,
-    -0.96732,
-    -0.968268,
-    -0.969229,
-    -0.970209,
-    -0.971209,
-    -0.972221,
-    -0.973235,
-    -0.974239,
-    -0.975223,
-    -0.976183,
-    -0.977122,
-    -0.97805,
-    -0.978982,
-    -0.979934,
-    -0.980914,
-    -0.981925,
-    -0.982959,
-    -0.983998,
-    -0.985023,
-    -0.986015,
-    -0.986963,
-    -0.987871,
-    -0.988756,
-    -0.989645,
-    -0.99057,
-    -0.991559,
-    -0.992622,
-    -0.993747,
-    -0.994895,
-    -0.996003,
-    -0.99699,
-    -0.997772,
-    -0.998276,
-    -0.99845,
-    -0.998276,
-    -0.997772,
-    -0.99699,
-    -0.996003,
-    -0.994895,
-    -0.993747,
-    -0.992622,
-    -0.991559,
-    -0.99057,
-    -0.989645,
-    -0.988756,
-    -0.987871,
-    -0.986963,
-    -0.986015,
-    -0.985023,
-    -0.983998,
-    -0.982959,
-    -0.981925,
-    -0.980914,
-    -0.979934,
-    -0.978982,
-    -0.97805,
-    -0.977122,
-    -0.976183,
-    -0.975223,
-    -0.974239,
-    -0.973235,
-    -0.972221,
-    -0.971209,
-    -0.970209,
-    -0.969229,
-    -0.968268,
-    -0.96732,
-    -0.966376,
-    -0.965426,
-    -0.964463,
-    -0.963483,
-    -0.962488,
-    -0.961485,
-    -0.960482,
-    -0.959488,
-    -0.958507,
-    -0.957541,
-    -0.956585,
-    -0.955633,
-    -0.954678,
-    -0.953713,
-    -0.952735,
-    -0.951745,
-    -0.950749,
-    -0.949752,
-    -0.94876,
-    -0.947779,
-    -0.946809,
-    -0.945849,
-    -0.944892,
-    -0.943933,
-    -0.942967,
-    -0.941991,
-    -0.941005,
-    -0.940013,
-    -0.939019,
-    -0.938029,
-    -0.937048,
-    -0.936076,
-    -0.935112,
-    -0.934152,
-    -0.933191,
-    -0.932224,
-    -0.931249,
-    -0.930266,
-    -0.929276,
-    -0.928285,
-    -0.927297,
-    -0.926315,
-    -0.925342,
-    -0.924375,
-    -0.923413,
-    -0.92245,
-    -0.921483,
-    -0.920508,
-    -0.919527,
-    -0.918539,
-    -0.91755,
-    -0.916563,
-    -0.915581,
-    -0.914607,
-    -0.913638,
-    -0.912674,
-    -0.91171,
-    -0.910742,
-    -0.909768,
-    -0.908788,
-    -0.907803,
-    -0.906815,
-    -0.905829,
-    -0.904847,
-    -0.903871,
-    -0.902901,
-    -0.901935,
-    -0.90097,
-    -0.900002,
-    -0.899029,
-    -0.89805,
-    -0.897066,
-    -0.896079,
-    -0.895094,
-    -0.894112,
-    -0.893135,
-    -0.892164,
-    -0.891197,
-    -0.890231,
-    -0.889262,
-    -0.888289,
-    -0.887311,
-    -0.886329,
-    -0.885343,
-    -0.884358,
-    -0.883377,
-    -0.882399,
-    -0.881427,
-    -0.880459,
-    -0.879492,
-    -0.878523,
-    -0.87755,
-    -0.876573,
-    -0.875591,
-    -0.874607,
-    -0.873623,
-    -0.872641,
-    -0.871663,
-    -0.87069,
-    -0.869721,
-    -0.868753,
-    -0.867784,
-    -0.866812,
-    -0.865835,
-    -0.864854,
-    -0.863871,
-    -0.862887,
-    -0.861905,
-    -0.860927,
-    -0.859953,
-    -0.858983,
-    -0.858015,
-    -0.857045,
-    -0.856073,
-    -0.855097,
-    -0.854117,
-    -0.853134,
-    -0.852151,
-    -0.851169,
-    -0.850191,
-    -0.849216,
-    -0.848245,
-    -0.847276,
-    -0.846307,
-    -0.845335,
-    -0.844359,
-    -0.84338,
-    -0.842397,
-    -0.841415,
-    -0.840433,
-    -0.839454,
-    -0.838479,
-    -0.837508,
-    -0.836538,
-    -0.835568,
-    -0.834596,
-    -0.833621,
-    -0.832642,
-    -0.831661,
-    -0.830678,
-    -0.829697,
-    -0.828718,
-    -0.827742,
-    -0.82677,
-    -0.8258,
-    -0.82483,
-    -0.823858,
-    -0.822883,
-    -0.821905,
-    -0.820924,
-    -0.819942,
-    -0.81896,
-    -0.817981,
-    -0.817005,
-    -0.816032,
-    -0.815062,
-    -0.814091,
-    -0.813119,
-    -0.812145,
-    -0.811167,
-    -0.810187,
-    -0.809205,
-    -0.808224,
-    -0.807245,
-    -0.806268,
-    -0.805295,
-    -0.804324,
-    -0.803353,
-    -0.802381,
-    -0.801407,
-    -0.80043,
-    -0.79945,
-    -0.798469,
-    -0.797487,
-    -0.796508,
-    -0.795531,
-    -0.794557,
-    -0.793586,
-    -0.792615,
-    -0.791643,
-    -0.790669,
-    -0.789692,
-    -0.788713,
-    -0.787732,
-    -0.786751,
-    -0.785771,
-    -0.784794,
-    -0.78382,
-    -0.782848,
-    -0.781877,
-    -0.780905,
-    -0.779931,
-    -0.778955,
-    -0.777976,
-    -0.776995,
-    -0.776014,
-    -0.775035,
-    -0.774057,
-    -0.773083,
-    -0.77211,
-    -0.771139,
-    -0.770167,
-    -0.769193,
-    -0.768217,
-    -0.767239,
-    -0.766258,
-    -0.765278,
-    -0.764298,
-    -0.76332,
-    -0.762345,
-    -0.761372,
-    -0.760401,
-    -0.759429,
-    -0.758455,
-    -0.75748,
-    -0.756502,
-    -0.755522,
-    -0.754541,
-    -0.753561,
-    -0.752583,
-    -0.751608,
-    -0.750635,
-    -0.749663,
-    -0.748691,
-    -0.747717,
-    -0.746742,
-    -0.745764,
-    -0.744785,
-    -0.743804,
-    -0.742824,
-    -0.741846,
-    -0.740871,
-    -0.739897,
-    -0.738925,
-    -0.737953,
-    -0.73698,
-    -0.736005,
-    -0.735027,
-    -0.734048,
-    -0.733068,
-    -0.732088,
-    -0.731109,
-    -0.730133,
-    -0.729159,
-    -0.728187,
-    -0.727215,
-    -0.726242,
-    -0.725267,
-    -0.72429,
-    -0.723311,
-    -0.722331,
-    -0.721351,
-    -0.720372,
-    -0.719396,
-    -0.718422,
-    -0.717449,
-    -0.716477,
-    -0.715504,
-    -0.714529,
-    -0.713552,
-    -0.712574,
-    -0.711594,
-    -0.710614,
-    -0.709636,
-    -0.708659,
-    -0.707684,
-    -0.706711,
-    -0.705739,
-    -0.704766,
-    -0.703792,
-    -0.702815,
-    -0.701837,
-    -0.700857,
-    -0.699877,
-    -0.698899,
-    -0.697922,
-    -0.696947,
-    -0.695974,
-    -0.695001,
-    -0.694028,
-    -0.693054,
-    -0.692078,
-    -0.6911,
-    -0.69012,
-    -0.68914,
-    -0.688162,
-    -0.687185,
-    -0.686209,
-    -0.685236,
-    -0.684263,
-    -0.68329,
-    -0.682316,
-    -0.68134,
-    -0.680362,
-    -0.679383,
-    -0.678404,
-    -0.677425,
-    -0.676447,
-    -0.675472,
-    -0.674498,
-    -0.673525,
-    -0.672553,
-    -0.671579,
-    -0.670603,
-    -0.669625,
-    -0.668646,
-    -0.667667,
-    -0.666688,
-    -0.66571,
-    -0.664735,
-    -0.663761,
-    -0.662788,
-    -0.661815,
-    -0.660841,
-    -0.659865,
-    -0.658888,
-    -0.657909,
-    -0.65693,
-    -0.655951,
-    -0.654973,
-    -0.653997,
-    -0.653023,
-    -0.65205,
-    -0.651077,
-    -0.650103,
-    -0.649128,
-    -0.648151,
-    -0.647172,
-    -0.646193,
-    -0.645214,
-    -0.644236,
-    -0.64326,
-    -0.642285,
-    -0.641312,
-    -0.640339,
-    -0.639365,
-    -0.63839,
-    -0.637413,
-    -0.636435,
-    -0.635456,
-    -0.634477,
-    -0.633499,
-    -0.632523,
-    -0.631548,
-    -0.630574,
-    -0.629601,
-    -0.628628,
-    -0.627653,
-    -0.626676,
-    -0.625698,
-    -0.624719,
-    -0.62374,
-    -0.622762,
-    -0.621785,
-    -0.62081,
-    -0.619837,
-    -0.618864,
-    -0.61789,
-    -0.616915,
-    -0.615939,
-    -0.614961,
-    -0.613982,
-    -0.613003,
-    -0.612025,
-    -0.611048,
-    -0.610073,
-    -0.609099,
-    -0.608126,
-    -0.607152,
-    -0.606178,
-    -0.605201,
-    -0.604224,
-    -0.603245,
-    -0.602266,
-    -0.601288,
-    -0.600311,
-    -0.599335,
-    -0.598361,
-    -0.597388,
-    -0.596415,
-    -0.59544,
-    -0.594464,
-    -0.593487,
-    -0.592508,
-    -0.591529,
-    -0.590551,
-    -0.589574,
-    -0.588598,
-    -0.587624,
-    -0.58665,
-    -0.585677,
-    -0.584702,
-    -0.583727,
-    -0.582749,
-    -0.581771,
-    -0.580792,
-    -0.579814,
-    -0.578836,
-    -0.577861,
-    -0.576886,
-    -0.575913,
-    -0.574939,
-    -0.573965,
-    -0.572989,
-    -0.572012,
-    -0.571034,
-    -0.570055,
-    -0.569077,
-    -0.568099,
-    -0.567123,
-    -0.566149,
-    -0.565175,
-    -0.564201,
-    -0.563227,
-    -0.562252,
-    -0.561275,
-    -0.560297,
-    -0.559318,
-    -0.55834,
-    -0.557362,
-    -0.556386,
-    -0.555411,
-    -0.554437,
-    -0.553464,
-    -0.55249,
-    -0.551514,
-    -0.550538,
-    -0.54956,
-    -0.548581,
-    -0.547603,
-    -0.546625,
-    -0.545649,
-    -0.544674,
-    -0.5437,
-    -0.542726,
-    -0.541752,
-    -0.540777,
-    -0.5398,
-    -0.538823,
-    -0.537844,
-    -0.536866,
-    -0.535888,
-    -0.534911,
-    -0.533936,
-    -0.532962,
-    -0.531988,
-    -0.531014,
-    -0.530039,
-    -0.529063,
-    -0.528086,
-    -0.527107,
-    -0.526129,
-    -0.525151,
-    -0.524174,
-    -0.523198,
-    -0.522224,
-    -0.521251,
-    -0.520277,
-    -0.519302,
-    -0.518326,
-    -0.517348,
-    -0.51637,
-    -0.515392,
-    -0.514414,
-    -0.513437,
-    -0.512461,
-    -0.511487,
-    -0.510513,
-    -0.509539,
-    -0.508564,
-    -0.507588,
-    -0.506611,
-    -0.505633,
-    -0.504655,
-    -0.503676,
-    -0.502699,
-    -0.501724,
-    -0.500749,
-    -0.499775,
-    -0.498801,
-    -0.497827,
-    -0.496851,
-    -0.495874,
-    -0.494896,
-    -0.493917,
-    -0.492939,
-    -0.491962,
-    -0.490986,
-    -0.490011,
-    -0.489038,
-    -0.488064,
-    -0.487089,
-    -0.486114,
-    -0.485137,
-    -0.484159,
-    -0.48318,
-    -0.482202,
-    -0.481225,
-    -0.480249,
-    -0.479274,
-    -0.4783,
-    -0.477326,
-    -0.476352,
-    -0.475376,
-    -0.4744,
-    -0.473422,
-    -0.472443,
-    -0.471465,
-    -0.470488,
-    -0.469511,
-    -0.468536,
-    -0.467562,
-    -0.466588,
-    -0.465614,
-    -0.464639,
-    -0.463662,
-    -0.462685,
-    -0.461706,
-    -0.460728,
-    -0.459751,
-    -0.458774,
-    -0.457799,
-    -0.456825,
-    -0.455851,
-    -0.454876,
-    -0.453901,
-    -0.452925,
-    -0.451947,
-    -0.450969,
-    -0.449991,
-    -0.449013,
-    -0.448037,
-    -0.447061,
-    -0.446087,
-    -0.445113,
-    -0.444139,
-    -0.443164,
-    -0.442188,
-    -0.44121,
-    -0.440232,
-    -0.439254,
-    -0.438276,
-    -0.437299,
-    -0.436324,
-    -0.435349,
-    -0.434375,
-    -0.433401,
-    -0.432426,
-    -0.43145,
-    -0.430473,
-    -0.429495,
-    -0.428517,
-    -0.427539,
-    -0.426562,
-    -0.425586,
-    -0.424612,
-    -0.423638,
-    -0.422664,
-    -0.421689,
-    -0.420713,
-    -0.419736,
-    -0.418758,
-    -0.41778,
-    -0.416802,
-    -0.415825,
-    -0.414849,
-    -0.413874,
-    -0.4129,
-    -0.411926,
-    -0.410951,
-    -0.409976,
-    -0.408999,
-    -0.408021,
-    -0.407043,
-    -0.406065,
-    -0.405088,
-    -0.404112,
-    -0.403137,
-    -0.402162,
-    -0.401188,
-    -0.400214,
-    -0.399238,
-    -0.398261,
-    -0.397284,
-    -0.396306,
-    -0.395328,
-    -0.39435,
-    -0.393374,
-    -0.392399,
-    -0.391425,
-    -0.390451,
-    -0.389476,
-    -0.388501,
-    -0.387524,
-    -0.386547,
-    -0.385568,
-    -0.38459,
-    -0.383613,
-    -0.382637,
-    -0.381662,
-    -0.380687,
-    -0.379713,
-    -0.378739,
-    -0.377763,
-    -0.376787,
-    -0.375809,
-    -0.374831,
-    -0.373853,
-    -0.372876,
-    -0.371899,
-    -0.370924,
-    -0.36995,
-    -0.368976,
-    -0.368001,
-    -0.367026,
-    -0.36605,
-    -0.365072,
-    -0.364094,
-    -0.363116,
-    -0.362139,
-    -0.361162,
-    -0.360187,
-    -0.359212,
-    -0.358238,
-    -0.357264,
-    -0.356288,
-    -0.355312,
-    -0.354335,
-    -0.353357,
-    -0.352379,
-    -0.351402,
-    -0.350425,
-    -0.349449,
-    -0.348474,
-    -0.3475,
-    -0.346526,
-    -0.345551,
-    -0.344575,
-    -0.343598,
-    -0.34262,
-    -0.341642,
-    -0.340664,
-    -0.339687,
-    -0.338712,
-    -0.337737,
-    -0.336763,
-    -0.335788,
-    -0.334814,
-    -0.333838,
-    -0.332861,
-    -0.331883,
-    -0.330905,
-    -0.329927,
-    -0.32895,
-    -0.327974,
-    -0.326999,
-    -0.326025,
-    -0.325051,
-    -0.324076,
-    -0.3231,
-    -0.322123,
-    -0.321146,
-    -0.320168,
-    -0.31919,
-    -0.318213,
-    -0.317237,
-    -0.316262,
-    -0.315287,
-    -0.314313,
-    -0.313338,
-    -0.312363,
-    -0.311386,
-    -0.310409,
-    -0.309431,
-    -0.308453,
-    -0.307476,
-    -0.306499,
-    -0.305524,
-    -0.30455,
-    -0.303576,
-    -0.302601,
-    -0.301625,
-    -0.300649,
-    -0.299672,
-    -0.298694,
-    -0.297716,
-    -0.296738,
-    -0.295762,
-    -0.294787,
-    -0.293812,
-    -0.292838,
-    -0.291863,
-    -0.290888,
-    -0.289912,
-    -0.288934,
-    -0.287957,
-    -0.286979,
-    -0.286001,
-    -0.285025,
-    -0.284049,
-    -0.283075,
-    -0.2821,
-    -0.281126,
-    -0.280151,
-    -0.279174,
-    -0.278197,
-    -0.277219,
-    -0.276241,
-    -0.275264,
-    -0.274287,
-    -0.273312,
-    -0.272337,
-    -0.271363,
-    -0.270388,
-    -0.269413,
-    -0.268437,
-    -0.26746,
-    -0.266482,
-    -0.265504,
-    -0.264527,
-    -0.26355,
-    -0.262574,
-    -0.2616,
-    -0.260625,
-    -0.259651,
-    -0.258676,
-    -0.2577,
-    -0.256723,
-    -0.255745,
-    -0.254767,
-    -0.25379,
-    -0.252813,
-    -0.251837,
-    -0.250862,
-    -0.249888,
-    -0.248913,
-    -0.247938,
-    -0.246962,
-    -0.245986,
-    -0.245008,
-    -0.24403,
-    -0.243052,
-    -0.242075,
-    -0.241099,
-    -0.240124,
-    -0.23915,
-    -0.238176,
-    -0.237201,
-    -0.236225,
-    -0.235248,
-    -0.234271,
-    -0.233293,
-    -0.232315,
-    -0.231338,
-    -0.230362,
-    -0.229387,
-    -0.228412,
-    -0.227438,
-    -0.226463,
-    -0.225488,
-    -0.224511,
-    -0.223534,
-    -0.222556,
-    -0.221578,
-    -0.220601,
-    -0.219625,
-    -0.218649,
-    -0.217675,
-    -0.2167,
-    -0.215726,
-    -0.21475,
-    -0.213774,
-    -0.212797,
-    -0.211819,
-    -0.210841,
-    -0.209864,
-    -0.208887,
-    -0.207912,
-    -0.206937,
-    -0.205963,
-    -0.204988,
-    -0.204013,
-    -0.203037,
-    -0.202059,
-    -0.201082,
-    -0.200104,
-    -0.199126,
-    -0.19815,
-    -0.197174,
-    -0.1962,
-    -0.195225,
-    -0.194251,
-    -0.193275,
-    -0.192299,
-    -0.191322,
-    -0.190344,
-    -0.189367,
-    -0.188389,
-    -0.187413,
-    -0.186437,
-    -0.185462,
-    -0.184488,
-    -0.183513,
-    -0.182538,
-    -0.181562,
-    -0.180585,
-    -0.179607,
-    -0.178629,
-    -0.177652,
-    -0.176675,
-    -0.175699,
-    -0.174725,
-    -0.17375,
-    -0.172776,
-    -0.171801,
-    -0.170825,
-    -0.169848,
-    -0.16887,
-    -0.167892,
-    -0.166915,
-    -0.165938,
-    -0.164962,
-    -0.163987,
-    -0.163013,
-    -0.162038,
-    -0.161063,
-    -0.160087,
-    -0.159111,
-    -0.158133,
-    -0.157155,
-    -0.156178,
-    -0.155201,
-    -0.154225,
-    -0.153249,
-    -0.152275,
-    -0.151301,
-    -0.150326,
-    -0.14935,
-    -0.148373,
-    -0.147396,
-    -0.146418,
-    -0.14544,
-    -0.144463,
-    -0.143487,
-    -0.142512,
-    -0.141537,
-    -0.140563,
-    -0.139588,
-    -0.138613,
-    -0.137636,
-    -0.136659,
-    -0.135681,
-    -0.134703,
-    -0.133726,
-    -0.13275,
-    -0.131774,
-    -0.1308,
-    -0.129825,
-    -0.128851,
-    -0.127875,
-    -0.126899,
-    -0.125922,
-    -0.124944,
-    -0.123966,
-    -0.122989,
-    -0.122012,
-    -0.121037,
-    -0.120062,
-    -0.119088,
-    -0.118113,
-    -0.117138,
-    -0.116162,
-    -0.115184,
-    -0.114207,
-    -0.113229,
-    -0.112252,
-    -0.111275,
-    -0.110299,
-    -0.109325,
-    -0.10835,
-    -0.107376,
-    -0.1064,
-    -0.105424,
-    -0.104447,
-    -0.10347,
-    -0.102492,
-    -0.101514,
-    -0.100538,
-    -0.099562,
-    -0.0985871,
-    -0.0976126,
-    -0.0966381,
-    -0.0956629,
-    -0.0946869,
-    -0.09371,
-    -0.0927324,
-    -0.0917546,
-    -0.0907771,
-    -0.0898004,
-    -0.0888245,
-    -0.0878496,
-    -0.0868751,
-    -0.0859005,
-    -0.0849255,
-    -0.0839496,
-    -0.0829728,
-    -0.0819952,
-    -0.0810174,
-    -0.0800399,
-    -0.079063,
-    -0.0780871,
-    -0.077112,
-    -0.0761375,
-    -0.075163,
-    -0.074188,
-    -0.0732123,
-    -0.0722356,
-    -0.0712581,
-    -0.0702803,
-    -0.0693027,
-    -0.0683257,
-    -0.0673497,
-    -0.0663745,
-    -0.0653999,
-    -0.0644254,
-    -0.0634506,
-    -0.0624749,
-    -0.0614983,
-    -0.0605209,
-    -0.0595432,
-    -0.0585655,
-    -0.0575884,
-    -0.0566122,
-    -0.055637,
-    -0.0546623,
-    -0.0536879,
-    -0.0527131,
-    -0.0517375,
-    -0.0507611,
-    -0.0497838,
-    -0.048806,
-    -0.0478283,
-    -0.0468512,
-    -0.0458748,
-    -0.0448995,
-    -0.0439248,
-    -0.0429503,
-    -0.0419756,
-    -0.0410002,
-    -0.0400238,
-    -0.0390466,
-    -0.0380689,
-    -0.0370912,
-    -0.0361139,
-    -0.0351375,
-    -0.034162,
-    -0.0331872,
-    -0.0322127,
-    -0.0312381,
-    -0.0302627,
-    -0.0292865,
-    -0.0283094,
-    -0.0273318,
-    -0.026354,
-    -0.0253766,
-    -0.0244001,
-    -0.0234245,
-    -0.0224496,
-    -0.0214752,
-    -0.0205005,
-    -0.0195253,
-    -0.0185492,
-    -0.0175722,
-    -0.0165946,
-    -0.0156168,
-    -0.0146394,
-    -0.0136627,
-    -0.012687,
-    -0.0117121,
-    -0.0107376,
-    -0.00976302,
-    -0.0087879,
-    -0.00781192,
-    -0.00683503,
-    -0.00585747,
-    -0.00487968,
-    -0.00390218,
-    -0.0029254,
-    -0.00194954,
-    -0.000974523,
-    0,
-    0.000974523,
-    0.00194954,
-    0.0029254,
-    0.00390218,
-    0.00487968,
-    0.00585747,
-    0.00683503,
-    0.00781192,
-    0.0087879,
-    0.00976302,
-    0.0107376,
-    0.0117121,
-    0.012687,
-    0.0136627,
-    0.0146394,
-    0.0156168,
-    0.0165946,
-    0.0175722,
-    0.0185492,
-    0.0195253,
-    0.0205005,
-    0.0214752,
-    0.0224496,
-    0.0234245,
-    0.0244001,
-    0.0253766,
-    0.026354,
-    0.0273318,
-    0.0283094,
-    0.0292865,
-    0.0302627,
-    0.0312381,
-    0.0322127,
-    0.0331872,
-    0.034162,
-    0.0351375,
-    0.0361139,
-    0.0370912,
-    0.0380689,
-    0.0390466,
-    0.0400238,
-    0.0410002,
-    0.0419756,
-    0.0429503,
-    0.0439248,
-    0.0448995,
-    0.0458748,
-    0.0468512,
-    0.0478283,
-    0.048806,
-    0.0497838,
-    0.0507611,
-    0.0517375,
-    0.0527131,
-    0.0536879,
-    0.0546623,
-    0.055637,
-    0.0566122,
-    0.0575884,
-    0.0585655,
-    0.0595432,
-    0.0605209,
-    0.0614983,
-    0.0624749,
-    0.0634506,
-    0.0644254,
-    0.0653999,
-    0.0663745,
-    0.0673497,
-    0.0683257,
-    0.0693027,
-    0.0702803,
-    0.0712581,
-    0.0722356,
-    0.0732123,
-    0.074188,
-    0.075163,
-    0.0761375,
-    0.077112,
-    0.0780871,
-    0.079063,
-    0.0800399,
-    0.0810174,
-    0.0819952,
-    0.0829728,
-    0.0839496,
-    0.0849255,
-    0.0859005,
-    0.0868751,
-    0.0878496,
-    0.0888245,
-    0.0898004,
-    0.0907771,
-    0.0917546,
-    0.0927324,
-    0.09371,
-    0.0946869,
-    0.0956629,
-    0.0966381,
-    0.0976126,
-    0.0985871,
-    0.099562,
-    0.100538,
-    0.101514,
-    0.102492,
-    0.10347,
-    0.104447,
-    0.105424,
-    0.1064,
-    0.107376,
-    0.10835,
-    0.109325,
-    0.110299,
-    0.111275,
-    0.112252,
-    0.113229,
-    0.114207,
-    0.115184,
-    0.116162,
-    0.117138,
-    0.118113,
-    0.119088,
-    0.120062,
-    0.121037,
-    0.122012,
-    0.122989,
-    0.123966,
-    0.124944,
-    0.125922,
-    0.126899,
-    0.127875,
-    0.128851,
-    0.129825,
-    0.1308,
-    0.131774,
-    0.13275,
-    0.133726,
-    0.134703,
-    0.135681,
-    0.136659,
-    0.137636,
-    0.138613,
-    0.139588,
-    0.140563,
-    0.141537,
-    0.142512,
-    0.143487,
-    0.144463,
-    0.14544,
-    0.146418,
-    0.147396,
-    0.148373,
-    0.14935,
-    0.150326,
-    0.151301,
-    0.152275,
-    0.153249,
-    0.154225,
-    0.155201,
-    0.156178,
-    0.157155,
-    0.158133,
-    0.159111,
-    0.160087,
-    0.161063,
-    0.162038,
-    0.163013,
-    0.163987,
-    0.164962,
-    0.165938,
-    0.166915,
-    0.167892,
-    0.16887,
-    0.169848,
-    0.170825,
-    0.171801,
-    0.172776,
-    0.17375,
-    0.174725,
-    0.175699,
-    0.176675,
-    0.177652,
-    0.178629,
-    0.179607,
-    0.180585,
-    0.181562,
-    0.182538,
-    0.183513,
-    0.184488,
-    0.185462,
-    0.186437,
-    0.187413,
-    0.188389,
-    0.189367,
-    0.190344,
-    0.191322,
-    0.192299,
-    0.193275,
-    0.194251,
-    0.195225,
-    0.1962,
-    0.197174,
-    0.19815,
-    0.199126,
-    0.200104,
-    0.201082,
-    0.202059,
-    0.203037,
-    0.204013,
-    0.204988,
-    0.205963,
-    0.206937,
-    0.207912,
-    0.208887,
-    0.209864,
-    0.210841,
-    0.211819,
-    0.212797,
-    0.213774,
-    0.21475,
-    0.215726,
-    0.2167,
-    0.217675,
-    0.218649,
-    0.219625,
-    0.220601,
-    0.221578,
-    0.222556,
-    0.223534,
-    0.224511,
-    0.225488,
-    0.226463,
-    0.227438,
-    0.228412,
-    0.229387,
-    0.230362,
-    0.231338,
-    0.232315,
-    0.233293,
-    0.234271,
-    0.235248,
-    0.236225,
-    0.237201,
-    0.238176,
-    0.23915,
-    0.240124,
-    0.241099,
-    0.242075,
-    0.243052,
-    0.24403,
-    0.245008,
-    0.245986,
-    0.246962,
-    0.247938,
-    0.248913,
-    0.249888,
-    0.250862,
-    0.251837,
-    0.252813,
-    0.25379,
-    0.254767,
-    0.255745,
-    0.256723,
-    0.2577,
-    0.258676,
-    0.259651,
-    0.260625,
-    0.2616,
-    0.262574,
-    0.26355,
-    0.264527,
-    0.265504,
-    0.266482,
-    0.26746,
-    0.268437,
-    0.269413,
-    0.270388,
-    0.271363,
-    0.272337,
-    0.273312,
-    0.274287,
-    0.275264,
-    0.276241,
-    0.277219,
-    0.278197,
-    0.279174,
-    0.280151,
-    0.281126,
-    0.2821,
-    0.283075,
-    0.284049,
-    0.285025,
-    0.286001,
-    0.286979,
-    0.287957,
-    0.288934,
-    0.289912,
-    0.290888,
-    0.291863,
-    0.292838,
-    0.293812,
-    0.294787,
-    0.295762,
-    0.296738,
-    0.297716,
-    0.298694,
-    0.299672,
-    0.300649,
-    0.301625,
-    0.302601,
-    0.303576,
-    0.30455,
-    0.305524,
-    0.306499,
-    0.307476,
-    0.308453,
-    0.309431,
-    0.310409,
-    0.311386,
-    0.312363,
-    0.313338,
-    0.314313,
-    0.315287,
-    0.316262,
-    0.317237,
-    0.318213,
-    0.31919,
-    0.320168,
-    0.321146,
-    0.322123,
-    0.3231,
-    0.324076,
-    0.325051,
-    0.326025,
-    0.326999,
-    0.327974,
-    0.32895,
-    0.329927,
-    0.330905,
-    0.331883,
-    0.332861,
-    0.333838,
-    0.334814,
-    0.335788,
-    0.336763,
-    0.337737,
-    0.338712,
-    0.339687,
-    0.340664,
-    0.341642,
-    0.34262,
-    0.343598,
-    0.344575,
-    0.345551,
-    0.346526,
-    0.3475,
-    0.348474,
-    0.349449,
-    0.350425,
-    0.351402,
-    0.352379,
-    0.353357,
-    0.354335,
-    0.355312,
-    0.356288,
-    0.357264,
-    0.358238,
-    0.359212,
-    0.360187,
-    0.361162,
-    0.362139,
-    0.363116,
-    0.364094,
-    0.365072,
-    0.36605,
-    0.367026,
-    0.368001,
-    0.368976,
-    0.36995,
-    0.370924,
-    0.371899,
-    0.372876,
-    0.373853,
-    0.374831,
-    0.375809,
-    0.376787,
-    0.377763,
-    0.378739,
-    0.379713,
-    0.380687,
-    0.381662,
-    0.382637,
-    0.383613,
-    0.38459,
-    0.385568,
-    0.386547,
-    0.387524,
-    0.388501,
-    0.389476,
-    0.390451,
-    0.391425,
-    0.392399,
-    0.393374,
-    0.39435,
-    0.395328,
-    0.396306,
-    0.397284,
-    0.398261,
-    0.399238,
-    0.400214,
-    0.401188,
-    0.402162,
-    0.403137,
-    0.404112,
-    0.405088,
-    0.406065,
-    0.407043,
-    0.408021,
-    0.408999,
-    0.409976,
-    0.410951,
-    0.411926,
-    0.4129,
-    0.413874,
-    0.414849,
-    0.415825,
-    0.416802,
-    0.41778,
-    0.418758,
-    0.419736,
-    0.420713,
-    0.421689,
-    0.422664,
-    0.423638,
-    0.424612,
-    0.425586,
-    0.426562,
-    0.427539,
-    0.428517,
-    0.429495,
-    0.430473,
-    0.43145,
-    0.432426,
-    0.433401,
-    0.434375,
-    0.435349,
-    0.436324,
-    0.437299,
-    0.438276,
-    0.439254,
-    0.440232,
-    0.44121,
-    0.442188,
-    0.443164,
-    0.444139,
-    0.445113,
-    0.446087,
-    0.447061,
-    0.448037,
-    0.449013,
-    0.449991,
-    0.450969,
-    0.451947,
-    0.452925,
-    0.453901,
-    0.454876,
-    0.455851,
-    0.456825,
-    0.457799,
-    0.458774,
-    0.459751,
-    0.460728,
-    0.461706,
-    0.462685,
-    0.463662,
-    0.464639,
-    0.465614,
-    0.466588,
-    0.467562,
-    0.468536,
-    0.469511,
-    0.470488,
-    0.471465,
-    0.472443,
-    0.473422,
-    0.4744,
-    0.475376,
-    0.476352,
-    0.477326,
-    0.4783,
-    0.479274,
-    0.480249,
-    0.481225,
-    0.482202,
-    0.48318,
-    0.484159,
-    0.485137,
-    0.486114,
-    0.487089,
-    0.488064,
-    0.489038,
-    0.490011,
-    0.490986,
-    0.491962,
-    0.492939,
-    0.493917,
-    0.494896,
-    0.495874,
-    0.496851,
-    0.497827,
-    0.498801,
-    0.499775,
-    0.500749,
-    0.501724,
-    0.502699,
-    0.503676,
-    0.504655,
-    0.505633,
-    0.506611,
-    0.507588,
-    0.508564,
-    0.509539,
-    0.510513,
-    0.511487,
-    0.512461,
-    0.513437,
-    0.514414,
-    0.515392,
-    0.51637,
-    0.517348,
-    0.518326,
-    0.519302,
-    0.520277,
-    0.521251,
-    0.522224,
-    0.523198,
-    0.524174,
-    0.525151,
-    0.526129,
-    0.527107,
-    0.528086,
-    0.529063,
-    0.530039,
-    0.531014,
-    0.531988,
-    0.532962,
-    0.533936,
-    0.534911,
-    0.535888,
-    0.536866,
-    0.537844,
-    0.538823,
-    0.5398,
-    0.540777,
-    0.541752,
-    0.542726,
-    0.5437,
-    0.544674,
-    0.545649,
-    0.546625,
-    0.547603,
-    0.548581,
-    0.54956,
-    0.550538,
-    0.551514,
-    0.55249,
-    0.553464,
-    0.554437,
-    0.555411,
-    0.556386,
-    0.557362,
-    0.55834,
-    0.559318,
-    0.560297,
-    0.561275,
-    0.562252,
-    0.563227,
-    0.564201,
-    0.565175,
-    0.566149,
-    0.567123,
-    0.568099,
-    0.569077,
-    0.570055,
-    0.571034,
-    0.572012,
-    0.572989,
-    0.573965,
-    0.574939,
-    0.575913,
-    0.576886,
-    0.577861,
-    0.578836,
-    0.579814,
-    0.580792,
-    0.581771,
-    0.582749,
-    0.583727,
-    0.584702,
-    0.585677,
-    0.58665,
-    0.587624,
-    0.588598,
-    0.589574,
-    0.590551,
-    0.591529,
-    0.592508,
-    0.593487,
-    0.594464,
-    0.59544,
-    0.596415,
-    0.597388,
-    0.598361,
-    0.599335,
-    0.600311,
-    0.601288,
-    0.602266,
-    0.603245,
-    0.604224,
-    0.605201,
-    0.606178,
-    0.607152,
-    0.608126,
-    0.609099,
-    0.610073,
-    0.611048,
-    0.612025,
-    0.613003,
-    0.613982,
-    0.614961,
-    0.615939,
-    0.616915,
-    0.61789,
-    0.618864,
-    0.619837,
-    0.62081,
-    0.621785,
-    0.622762,
-    0.62374,
-    0.624719,
-    0.625698,
-    0.626676,
-    0.627653,
-    0.628628,
-    0.629601,
-    0.630574,
-    0.631548,
-    0.632523,
-    0.633499,
-    0.634477,
-    0.635456,
-    0.636435,
-    0.637413,
-    0.63839,
-    0.639365,
-    0.640339,
-    0.641312,
-    0.642285,
-    0.64326,
-    0.644236,
-    0.645214,
-    0.646193,
-    0.647172,
-    0.648151,
-    0.649128,
-    0.650103,
-    0.651077,
-    0.65205,
-    0.653023,
-    0.653997,
-    0.654973,
-    0.655951,
-    0.65693,
-    0.657909,
-    0.658888,
-    0.659865,
-    0.660841,
-    0.661815,
-    0.662788,
-    0.663761,
-    0.664735,
-    0.66571,
-    0.666688,
-    0.667667,
-    0.668646,
-    0.669625,
-    0.670603,
-    0.671579,
-    0.672553,
-    0.673525,
-    0.674498,
-    0.675472,
-    0.676447,
-    0.677425,
-    0.678404,
-    0.679383,
-    0.680362,
-    0.68134,
-    0.682316,
-    0.68329,
-    0.684263,
-    0.685236,
-    0.686209,
-    0.687185,
-    0.688162,
-    0.68914,
-    0.69012,
-    0.6911,
-    0.692078,
-    0.693054,
-    0.694028,
-    0.695001,
-    0.695974,
-    0.696947,
-    0.697922,
-    0.698899,
-    0.699877,
-    0.700857,
-    0.701837,
-    0.702815,
-    0.703792,
-    0.704766,
-    0.705739,
-    0.706711,
-    0.707684,
-    0.708659,
-    0.709636,
-    0.710614,
-    0.711594,
-    0.712574,
-    0.713552,
-    0.714529,
-    0.715504,
-    0.716477,
-    0.717449,
-    0.718422,
-    0.719396,
-    0.720372,
-    0.721351,
-    0.722331,
-    0.723311,
-    0.72429,
-    0.725267,
-    0.726242,
-    0.727215,
-    0.728187,
-    0.729159,
-    0.730133,
-    0.731109,
-    0.732088,
-    0.733068,
-    0.734048,
-    0.735027,
-    0.736005,
-    0.73698,
-    0.737953,
-    0.738925,
-    0.739897,
-    0.740871,
-    0.741846,
-    0.742824,
-    0.743804,
-    0.744785,
-    0.745764,
-    0.746742,
-    0.747717,
-    0.748691,
-    0.749663,
-    0.750635,
-    0.751608,
-    0.752583,
-    0.753561,
-    0.754541,
-    0.755522,
-    0.756502,
-    0.75748,
-    0.758455,
-    0.759429,
-    0.760401,
-    0.761372,
-    0.762345,
-    0.76332,
-    0.764298,
-    0.765278,
-    0.766258,
-    0.767239,
-    0.768217,
-    0.769193,
-    0.770167,
-    0.771139,
-    0.77211,
-    0.773083,
-    0.774057,
-    0.775035,
-    0.776014,
-    0.776995,
-    0.777976,
-    0.778955,
-    0.779931,
-    0.780905,
-    0.781877,
-    0.782848,
-    0.78382,
-    0.784794,
-    0.785771,
-    0.786751,
-    0.787732,
-    0.788713,
-    0.789692,
-    0.790669,
-    0.791643,
-    0.792615,
-    0.793586,
-    0.794557,
-    0.795531,
-    0.796508,
-    0.797487,
-    0.798469,
-    0.79945,
-    0.80043,
-    0.801407,
-    0.802381,
-    0.803353,
-    0.804324,
-    0.805295,
-    0.806268,
-    0.807245,
-    0.808224,
-    0.809205,
-    0.810187,
-    0.811167,
-    0.812145,
-    0.813119,
-    0.814091,
-    0.815062,
-    0.816032,
-    0.817005,
-    0.817981,
-    0.81896,
-    0.819942,
-    0.820924,
-    0.821905,
-    0.822883,
-    0.823858,
-    0.82483,
-    0.8258,
-    0.82677,
-    0.827742,
-    0.828718,
-    0.829697,
-    0.830678,
-    0.831661,
-    0.832642,
-    0.833621,
-    0.834596,
-    0.835568,
-    0.836538,
-    0.837508,
-    0.838479,
-    0.839454,
-    0.840433,
-    0.841415,
-    0.842397,
-    0.84338,
-    0.844359,
-    0.845335,
-    0.846307,
-    0.847276,
-    0.848245,
-    0.849216,
-    0.850191,
-    0.851169,
-    0.852151,
-    0.853134,
-    0.854117,
-    0.855097,
-    0.856073,
-    0.857045,
-    0.858015,
-    0.858983,
-    0.859953,
-    0.860927,
-    0.861905,
-    0.862887,
-    0.863871,
-    0.864854,
-    0.865835,
-    0.866812,
-    0.867784,
-    0.868753,
-    0.869721,
-    0.87069,
-    0.871663,
-    0.872641,
-    0.873623,
-    0.874607,
-    0.875591,
-    0.876573,
-    0.87755,
-    0.878523,
-    0.879492,
-    0.880459,
-    0.881427,
-    0.882399,
-    0.883377,
-    0.884358,
-    0.885343,
-    0.886329,
-    0.887311,
-    0.888289,
-    0.889262,
-    0.890231,
-    0.891197,
-    0.892164,
-    0.893135,
-    0.894112,
-    0.895094,
-    0.896079,
-    0.897066,
-    0.89805,
-    0.899029,
-    0.900002,
-    0.90097,
-    0.901935,
-    0.902901,
-    0.903871,
-    0.904847,
-    0.905829,
-    0.906815,
-    0.907803,
-    0.908788,
-    0.909768,
-    0.910742,
-    0.91171,
-    0.912674,
-    0.913638,
-    0.914607,
-    0.915581,
-    0.916563,
-    0.91755,
-    0.918539,
-    0.919527,
-    0.920508,
-    0.921483,
-    0.92245,
-    0.923413,
-    0.924375,
-    0.925342,
-    0.926315,
-    0.927297,
-    0.928285,
-    0.929276,
-    0.930266,
-    0.931249,
-    0.932224,
-    0.933191,
-    0.934152,
-    0.935112,
-    0.936076,
-    0.937048,
-    0.938029,
-    0.939019,
-    0.940013,
-    0.941005,
-    0.941991,
-    0.942967,
-    0.943933,
-    0.944892,
-    0.945849,
-    0.946809,
-    0.947779,
-    0.94876,
-    0.949752,
-    0.950749,
-    0.951745,
-    0.952735,
-    0.953713,
-    0.954678,
-    0.955633,
-    0.956585,
-    0.957541,
-    0.958507,
-    0.959488,
-    0.960482,
-    0.961485,
-    0.962488,
-    0.963483,
-    0.964463,
-    0.965426,
-    0.966376,
-    0.96732,
-    0.968268,
-    0.969229,
-    0.970209,
-    0.971209,
-    0.972221,
-    0.973235,
-    0.974239,
-    0.975223,
-    0.976183,
-    0.977122,
-    0.97805,
-    0.978982,
-    0.979934,
-    0.980914,
-    0.981925,
-    0.982959,
-    0.983998,
-    0.985023,
-    0.986015,
-    0.986963,
-    0.987871,
-    0.988756,
-    0.989645,
-    0.99057,
-    0.991559,
-    0.992622,
-    0.993747,
-    0.994895,
-    0.996003,
-    0.99699,
-    0.997772,
-    0.998276,
-    0.99845,
-    0.998276,
-    0.997772,
-    0.99699,
-    0.996003,
-    0.994895,
-    0.993747,
-    0.992622,
-    0.991559,
-    0.99057,
-    0.989645,
-    0.988756,
-    0.987871,
-    0.986963,
-    0.986015,
-    0.985023,
-    0.983998,
-    0.982959,
-    0.981925,
-    0.980914,
-    0.979934,
-    0.978982,
-    0.97805,
-    0.977122,
-    0.976183,
-    0.975223,
-    0.974239,
-    0.973235,
-    0.972221,
-    0.971209,
-    0.970209,
-    0.969229,
-    0.968268,
-    0.96732,
-    0.966376,
-    0.965426,
-    0.964463,
-    0.963483,
-    0.962488,
-    0.961485,
-    0.960482,
-    0.959488,
-    0.958507,
-    0.957541,
-    0.956585,
-    0.955633,
-    0.954678,
-    0.953713,
-    0.952735,
-    0.951745,
-    0.950749,
-    0.949752,
-    0.94876,
-    0.947779,
-    0.946809,
-    0.945849,
-    0.944892,
-    0.943933,
-    0.942967,
-    0.941991,
-    0.941005,
-    0.940013,
-    0.939019,
-    0.938029,
-    0.937048,
-    0.936076,
-    0.935112,
-    0.934152,
-    0.933191,
-    0.932224,
-    0.931249,
-    0.930266,
-    0.929276,
-    0.928285,
-    0.927297,
-    0.926315,
-    0.925342,
-    0.924375,
-    0.923413,
-    0.92245,
-    0.921483,
-    0.920508,
-    0.919527,
-    0.918539,
-    0.91755,
-    0.916563,
-    0.915581,
-    0.914607,
-    0.913638,
-    0.912674,
-    0.91171,
-    0.910742,
-    0.909768,
-    0.908788,
-    0.907803,
-    0.906815,
-    0.905829,
-    0.904847,
-    0.903871,
-    0.902901,
-    0.901935,
-    0.90097,
-    0.900002,
-    0.899029,
-    0.89805,
-    0.897066,
-    0.896079,
-    0.895094,
-    0.894112,
-    0.893135,
-    0.892164,
-    0.891197,
-    0.890231,
-    0.889262,
-    0.888289,
-    0.887311,
-    0.886329,
-    0.885343,
-    0.884358,
-    0.883377,
-    0.882399,
-    0.881427,
-    0.880459,
-    0.879492,
-    0.878523,
-    0.87755,
-    0.876573,
-    0.875591,
-    0.874607,
-    0.873623,
-    0.872641,
-    0.871663,
-    0.87069,
-    0.869721,
-    0.868753,
-    0.867784,
-    0.866812,
-    0.865835,
-    0.864854,
-    0.863871,
-    0.862887,
-    0.861905,
-    0.860927,
-    0.859953,
-    0.858983,
-    0.858015,
-    0.857045,
-    0.856073,
-    0.855097,
-    0.854117,
-    0.853134,
-    0.852151,
-    0.851169,
-    0.850191,
-    0.849216,
-    0.848245,
-    0.847276,
-    0.846307,
-    0.845335,
-    0.844359,
-    0.84338,
-    0.842397,
-    0.841415,
-    0.840433,
-    0.839454,
-    0.838479,
-    0.837508,
-    0.836538,
-    0.835568,
-    0.834596,
-    0.833621,
-    0.832642,
-    0.831661,
-    0.830678,
-    0.829697,
-    0.828718,
-    0.827742,
-    0.82677,
-    0.8258,
-    0.82483,
-    0.823858,
-    0.822883,
-    0.821905,
-    0.820924,
-    0.819942,
-    0.81896,
-    0.817981,
-    0.817005,
-    0.816032,
-    0.815062,
-    0.814091,
-    0.813119,
-    0.812145,
-    0.811167,
-    0.810187,
-    0.809205,
-    0.808224,
-    0.807245,
-    0.806268,
-    0.805295,
-    0.804324,
-    0.803353,
-    0.802381,
-    0.801407,
-    0.80043,
-    0.79945,
-    0.798469,
-    0.797487,
-    0.796508,
-    0.795531,
-    0.794557,
-    0.793586,
-    0.792615,
-    0.791643,
-    0.790669,
-    0.789692,
-    0.788713,
-    0.787732,
-    0.786751,
-    0.785771,
-    0.784794,
-    0.78382,
-    0.782848,
-    0.781877,
-    0.780905,
-    0.779931,
-    0.778955,
-    0.777976,
-    0.776995,
-    0.776014,
-    0.775035,
-    0.774057,
-    0.773083,
-    0.77211,
-    0.771139,
-    0.770167,
-    0.769193,
-    0.768217,
-    0.767239,
-    0.766258,
-    0.765278,
-    0.764298,
-    0.76332,
-    0.762345,
-    0.761372,
-    0.760401,
-    0.759429,
-    0.758455,
-    0.75748,
-    0.756502,
-    0.755522,
-    0.754541,
-    0.753561,
-    0.752583,
-    0.751608,
-    0.750635,
-    0.749663,
-    0.748691,
-    0.747717,
-    0.746742,
-    0.745764,
-    0.744785,
-    0.743804,
-    0.742824,
-    0.741846,
-    0.740871,
-    0.739897,
-    0.738925,
-    0.737953,
-    0.73698,
-    0.736005,
-    0.735027,
-    0.734048,
-    0.733068,
-    0.732088,
-    0.731109,
-    0.730133,
-    0.729159,
-    0.728187,
-    0.727215,
-    0.726242,
-    0.725267,
-    0.72429,
-    0.723311,
-    0.722331,
-    0.721351,
-    0.720372,
-    0.719396,
-    0.718422,
-    0.717449,
-    0.716477,
-    0.715504,
-    0.714529,
-    0.713552,
-    0.712574,
-    0.711594,
-    0.710614,
-    0.709636,
-    0.708659,
-    0.707684,
-    0.706711,
-    0.705739,
-    0.704766,
-    0.703792,
-    0.702815,
-    0.701837,
-    0.700857,
-    0.699877,
-    0.698899,
-    0.697922,
-    0.696947,
-    0.695974,
-    0.695001,
-    0.694028,
-    0.693054,
-    0.692078,
-    0.6911,
-    0.69012,
-    0.68914,
-    0.688162,
-    0.687185,
-    0.686209,
-    0.685236,
-    0.684263,
-    0.68329,
-    0.682316,
-    0.68134,
-    0.680362,
-    0.679383,
-    0.678404,
-    0.677425,
-    0.676447,
-    0.675472,
-    0.674498,
-    0.673525,
-    0.672553,
-    0.671579,
-    0.670603,
-    0.669625,
-    0.668646,
-    0.667667,
-    0.666688,
-    0.66571,
-    0.664735,
-    0.663761,
-    0.662788,
-    0.661815,
-    0.660841,
-    0.659865,
-    0.658888,
-    0.657909,
-    0.65693,
-    0.655951,
-    0.654973,
-    0.653997,
-    0.653023,
-    0.65205,
-    0.651077,
-    0.650103,
-    0.649128,
-    0.648151,
-    0.647172,
-    0.646193,
-    0.645214,
-    0.644236,
-    0.64326,
-    0.642285,
-    0.641312,
-    0.640339,
-    0.639365,
-    0.63839,
-    0.637413,
-    0.636435,
-    0.635456,
-    0.634477,
-    0.633499,
-    0.632523,
-    0.631548,
-    0.630574,
-    0.629601,
-    0.628628,
-    0.627653,
-    0.626676,
-    0.625698,
-    0.624719,
-    0.62374,
-    0.622762,
-    0.621785,
-    0.62081,
-    0.619837,
-    0.618864,
-    0.61789,
-    0.616915,
-    0.615939,
-    0.614961,
-    0.613982,
-    0.613003,
-    0.612025,
-    0.611048,
-    0.610073,
-    0.609099,
-    0.608126,
-    0.607152,
-    0.606178,
-    0.605201,
-    0.604224,
-    0.603245,
-    0.602266,
-    0.601288,
-    0.600311,
-    0.599335,
-    0.598361,
-    0.597388,
-    0.596415,
-    0.59544,
-    0.594464,
-    0.593487,
-    0.592508,
-    0.591529,
-    0.590551,
-    0.589574,
-    0.588598,
-    0.587624,
-    0.58665,
-    0.585677,
-    0.584702,
-    0.583727,
-    0.582749,
-    0.581771,
-    0.580792,
-    0.579814,
-    0.578836,
-    0.577861,
-    0.576886,
-    0.575913,
-    0.574939,
-    0.573965,
-    0.572989,
-    0.572012,
-    0.571034,
-    0.570055,
-    0.569077,
-    0.568099,
-    0.567123,
-    0.566149,
-    0.565175,
-    0.564201,
-    0.563227,
-    0.562252,
-    0.561275,
-    0.560297,
-    0.559318,
-    0.55834,
-    0.557362,
-    0.556386,
-    0.555411,
-    0.554437,
-    0.553464,
-    0.55249,
-    0.551514,
-    0.550538,
-    0.54956,
-    0.548581,
-    0.547603,
-    0.546625,
-    0.545649,
-    0.544674,
-    0.5437,
-    0.542726,
-    0.541752,
-    0.540777,
-    0.5398,
-    0.538823,
-    0.537844,
-    0.536866,
-    0.535888,
-    0.534911,
-    0.533936,
-    0.532962,
-    0.531988,
-    0.531014,
-    0.530039,
-    0.529063,
-    0.528086,
-    0.527107,
-    0.526129,
-    0.525151,
-    0.524174,
-    0.523198,
-    0.522224,
-    0.521251,
-    0.520277,
-    0.519302,
-    0.518326,
-    0.517348,
-    0.51637,
-    0.515392,
-    0.514414,
-    0.513437,
-    0.512461,
-    0.511487,
-    0.510513,
-    0.509539,
-    0.508564,
-    0.507588,
-    0.506611,
-    0.505633,
-    0.504655,
-    0.503676,
-    0.502699,
-    0.501724,
-    0.500749,
-    0.499775,
-    0.498801,
-    0.497827,
-    0.496851,
-    0.495874,
-    0.494896,
-    0.493917,
-    0.492939,
-    0.491962,
-    0.490986,
-    0.490011,
-    0.489038,
-    0.488064,
-    0.487089,
-    0.486114,
-    0.485137,
-    0.484159,
-    0.48318,
-    0.482202,
-    0.481225,
-    0.480249,
-    0.479274,
-    0.4783,
-    0.477326,
-    0.476352,
-    0.475376,
-    0.4744,
-    0.473422,
-    0.472443,
-    0.471465,
-    0.470488,
-    0.469511,
-    0.468536,
-    0.467562,
-    0.466588,
-    0.465614,
-    0.464639,
-    0.463662,
-    0.462685,
-    0.461706,
-    0.460728,
-    0.459751,
-    0.458774,
-    0.457799,
-    0.456825,
-    0.455851,
-    0.454876,
-    0.453901,
-    0.452925,
-    0.451947,
-    0.450969,
-    0.449991,
-    0.449013,
-    0.448037,
-    0.447061,
-    0.446087,
-    0.445113,
-    0.444139,
-    0.443164,
-    0.442188,
-    0.44121,
-    0.440232,
-    0.439254,
-    0.438276,
-    0.437299,
-    0.436324,
-    0.435349,
-    0.434375,
-    0.433401,
-    0.432426,
-    0.43145,
-    0.430473,
-    0.429495,
-    0.428517,
-    0.427539,
-    0.426562,
-    0.425586,
-    0.424612,
-    0.423638,
-    0.422664,
-    0.421689,
-    0.420713,
-    0.419736,
-    0.418758,
-    0.41778,
-    0.416802,
-    0.415825,
-    0.414849,
-    0.413874,
-    0.4129,
-    0.411926,
-    0.410951,
-    0.409976,
-    0.408999,
-    0.408021,
-    0.407043,
-    0.406065,
-    0.405088,
-    0.404112,
-    0.403137,
-    0.402162,
-    0.401188,
-    0.400214,
-    0.399238,
-    0.398261,
-    0.397284,
-    0.396306,
-    0.395328,
-    0.39435,
-    0.393374,
-    0.392399,
-    0.391425,
-    0.390451,
-    0.389476,
-    0.388501,
-    0.387524,
-    0.386547,
-    0.385568,
-    0.38459,
-    0.383613,
-    0.382637,
-    0.381662,
-    0.380687,
-    0.379713,
-    0.378739,
-    0.377763,
-    0.376787,
-    0.375809,
-    0.374831,
-    0.373853,
-    0.372876,
-    0.371899,
-    0.370924,
-    0.36995,
-    0.368976,
-    0.368001,
-    0.367026,
-    0.36605,
-    0.365072,
-    0.364094,
-    0.363116,
-    0.362139,
-    0.361162,
-    0.360187,
-    0.359212,
-    0.358238,
-    0.357264,
-    0.356288,
-    0.355312,
-    0.354335,
-    0.353357,
-    0.352379,
-    0.351402,
-    0.350425,
-    0.349449,
-    0.348474,
-    0.3475,
-    0.346526,
-    0.345551,
-    0.344575,
-    0.343598,
-    0.34262,
-    0.341642,
-    0.340664,
-    0.339687,
-    0.338712,
-    0.337737,
-    0.336763,
-    0.335788,
-    0.334814,
-    0.333838,
-    0.332861,
-    0.331883,
-    0.330905,
-    0.329927,
-    0.32895,
-    0.327974,
-    0.326999,
-    0.326025,
-    0.325051,
-    0.324076,
-    0.3231,
-    0.322123,
-    0.321146,
-    0.320168,
-    0.31919,
-    0.318213,
-    0.317237,
-    0.316262,
-    0.315287,
-    0.314313,
-    0.313338,
-    0.312363,
-    0.311386,
-    0.310409,
-    0.309431,
-    0.308453,
-    0.307476,
-    0.306499,
-    0.305524,
-    0.30455,
-    0.303576,
-    0.302601,
-    0.301625,
-    0.300649,
-    0.299672,
-    0.298694,
-    0.297716,
-    0.296738,
-    0.295762,
-    0.294787,
-    0.293812,
-    0.292838,
-    0.291863,
-    0.290888,
-    0.289912,
-    0.288934,
-    0.287957,
-    0.286979,
-    0.286001,
-    0.285025,
-    0.284049,
-    0.283075,
-    0.2821,
-    0.281126,
-    0.280151,
-    0.279174,
-    0.278197,
-    0.277219,
-    0.276241,
-    0.275264,
-    0.274287,
-    0.273312,
-    0.272337,
-    0.271363,
-    0.270388,
-    0.269413,
-    0.268437,
-    0.26746,
-    0.266482,
-    0.265504,
-    0.264527,
-    0.26355,
-    0.262574,
-    0.2616,
-    0.260625,
-    0.259651,
-    0.258676,
-    0.2577,
-    0.256723,
-    0.255745,
-    0.254767,
-    0.25379,
-    0.252813,
-    0.251837,
-    0.250862,
-    0.249888,
-    0.248913,
-    0.247938,
-    0.246962,
-    0.245986,
-    0.245008,
-    0.24403,
-    0.243052,
-    0.242075,
-    0.241099,
-    0.240124,
-    0.23915,
-    0.238176,
-    0.237201,
-    0.236225,
-    0.235248,
-    0.234271,
-    0.233293,
-    0.232315,
-    0.231338,
-    0.230362,
-    0.229387,
-    0.228412,
-    0.227438,
-    0.226463,
-    0.225488,
-    0.224511,
-    0.223534,
-    0.222556,
-    0.221578,
-    0.220601,
-    0.219625,
-    0.218649,
-    0.217675,
-    0.2167,
-    0.215726,
-    0.21475,
-    0.213774,
-    0.212797,
-    0.211819,
-    0.210841,
-    0.209864,
-    0.208887,
-    0.207912,
-    0.206937,
-    0.205963,
-    0.204988,
-    0.204013,
-    0.203037,
-    0.202059,
-    0.201082,
-    0.200104,
-    0.199126,
-    0.19815,
-    0.197174,
-    0.1962,
-    0.195225,
-    0.194251,
-    0.193275,
-    0.192299,
-    0.191322,
-    0.190344,
-    0.189367,
-    0.188389,
-    0.187413,
-    0.186437,
-    0.185462,
-    0.184488,
-    0.183513,
-    0.182538,
-    0.181562,
-    0.180585,
-    0.179607,
-    0.178629,
-    0.177652,
-    0.176675,
-    0.175699,
-    0.174725,
-    0.17375,
-    0.172776,
-    0.171801,
-    0.170825,
-    0.169848,
-    0.16887,
-    0.167892,
-    0.166915,
-    0.165938,
-    0.164962,
-    0.163987,
-    0.163013,
-    0.162038,
-    0.161063,
-    0.160087,
-    0.159111,
-    0.158133,
-    0.157155,
-    0.156178,
-    0.155201,
-    0.154225,
-    0.153249,
-    0.152275,
-    0.151301,
-    0.150326,
-    0.14935,
-    0.148373,
-    0.147396,
-    0.146418,
-    0.14544,
-    0.144463,
-    0.143487,
-    0.142512,
-    0.141537,
-    0.140563,
-    0.139588,
-    0.138613,
-    0.137636,
-    0.136659,
-    0.135681,
-    0.134703,
-    0.133726,
-    0.13275,
-    0.131774,
-    0.1308,
-    0.129825,
-    0.128851,
-    0.127875,
-    0.126899,
-    0.125922,
-    0.124944,
-    0.123966,
-    0.122989,
-    0.122012,
-    0.121037,
-    0.120062,
-    0.119088,
-    0.118113,
-    0.117138,
-    0.116162,
-    0.115184,
-    0.114207,
-    0.113229,
-    0.112252,
-    0.111275,
-    0.110299,
-    0.109325,
-    0.10835,
-    0.107376,
-    0.1064,
-    0.105424,
-    0.104447,
-    0.10347,
-    0.102492,
-    0.101514,
-    0.100538,
-    0.099562,
-    0.0985871,
-    0.0976126,
-    0.0966381,
-    0.0956629,
-    0.0946869,
-    0.09371,
-    0.0927324,
-    0.0917546,
-    0.0907771,
-    0.0898004,
-    0.0888245,
-    0.0878496,
-    0.0868751,
-    0.0859005,
-    0.0849255,
-    0.0839496,
-    0.0829728,
-    0.0819952,
-    0.0810174,
-    0.0800399,
-    0.079063,
-    0.0780871,
-    0.077112,
-    0.0761375,
-    0.075163,
-    0.074188,
-    0.0732123,
-    0.0722356,
-    0.0712581,
-    0.0702803,
-    0.0693027,
-    0.0683257,
-    0.0673497,
-    0.0663745,
-    0.0653999,
-    0.0644254,
-    0.0634506,
-    0.0624749,
-    0.0614983,
-    0.0605209,
-    0.0595432,
-    0.0585655,
-    0.0575884,
-    0.0566122,
-    0.055637,
-    0.0546623,
-    0.0536879,
-    0.0527131,
-    0.0517375,
-    0.0507611,
-    0.0497838,
-    0.048806,
-    0.0478283,
-    0.0468512,
-    0.0458748,
-    0.0448995,
-    0.0439248,
-    0.0429503,
-    0.0419756,
-    0.0410002,
-    0.0400238,
-    0.0390466,
-    0.0380689,
-    0.0370912,
-    0.0361139,
-    0.0351375,
-    0.034162,
-    0.0331872,
-    0.0322127,
-    0.0312381,
-    0.0302627,
-    0.0292865,
-    0.0283094,
-    0.0273318,
-    0.026354,
-    0.0253766,
-    0.0244001,
-    0.0234245,
-    0.0224496,
-    0.0214752,
-    0.0205005,
-    0.0195253,
-    0.0185492,
-    0.0175722,
-    0.0165946,
-    0.0156168,
-    0.0146394,
-    0.0136627,
-    0.012687,
-    0.0117121,
-    0.0107376,
-    0.00976302,
-    0.0087879,
-    0.00781192,
-    0.00683503,
-    0.00585747,
-    0.00487968,
-    0.00390218,
-    0.0029254,
-    0.00194954,
-    0.000974523
-};
-
-// Top frequency: 44.1K * 0.00362812
-constexpr static std::array<float, 4096> wt_triangle_0x3 =
-{
-    0,
-    -0.000972791,
-    -0.00194585,
-    -0.00291941,
-    -0.00389368,
-    -0.0048688,
-    -0.00584487,
-    -0.00682187,
-    -0.00779974,
-    -0.00877834,
-    -0.00975748,
-    -0.0107369,
-    -0.0117164,
-    -0.0126956,
-    -0.0136744,
-    -0.0146525,
-    -0.0156297,
-    -0.016606,
-    -0.0175814,
-    -0.0185559,
-    -0.0195296,
-    -0.0205028,
-    -0.0214756,
-    -0.0224484,
-    -0.0234213,
-    -0.0243947,
-    -0.0253688,
-    -0.0263437,
-    -0.0273195,
-    -0.0282963,
-    -0.0292739,
-    -0.0302523,
-    -0.0312314,
-    -0.0322108,
-    -0.0331903,
-    -0.0341696,
-    -0.0351485,
-    -0.0361268,
-    -0.0371042,
-    -0.0380808,
-    -0.0390564,
-    -0.0400311,
-    -0.041005,
-    -0.0419783,
-    -0.0429512,
-    -0.0439239,
-    -0.0448968,
-    -0.0458701,
-    -0.0468439,
-    -0.0478186,
-    -0.0487942,
-    -0.0497707,
-    -0.0507481,
-    -0.0517264,
-    -0.0527053,
-    -0.0536846,
-    -0.0546641,
-    -0.0556435,
-    -0.0566226,
-    -0.057601,
-    -0.0585787,
-    -0.0595555,
-    -0.0605314,
-    -0.0615063,
-    -0.0624804,
-    -0.0634538,
-    -0.0644268,
-    -0.0653995,
-    -0.0663723,
-    -0.0673455,
-    -0.0683191,
-    -0.0692936,
-    -0.0702689,
-    -0.0712452,
-    -0.0722224,
-    -0.0732004,
-    -0.0741792,
-    -0.0751584,
-    -0.0761379,
-    -0.0771174,
-    -0.0780966,
-    -0.0790752,
-    -0.0800532,
-    -0.0810302,
-    -0.0820063,
-    -0.0829815,
-    -0.0839557,
-    -0.0849293,
-    -0.0859023,
-    -0.0868751,
-    -0.0878479,
-    -0.0888209,
-    -0.0897944,
-    -0.0907686,
-    -0.0917437,
-    -0.0927197,
-    -0.0936967,
-    -0.0946745,
-    -0.0956531,
-    -0.0966323,
-    -0.0976118,
-    -0.0985913,
-    -0.0995706,
-    -0.100549,
-    -0.101528,
-    -0.102505,
-    -0.103481,
-    -0.104457,
-    -0.105431,
-    -0.106405,
-    -0.107378,
-    -0.108351,
-    -0.109323,
-    -0.110296,
-    -0.11127,
-    -0.112244,
-    -0.113219,
-    -0.114194,
-    -0.115171,
-    -0.116149,
-    -0.117127,
-    -0.118106,
-    -0.119086,
-    -0.120065,
-    -0.121045,
-    -0.122024,
-    -0.123002,
-    -0.123979,
-    -0.124956,
-    -0.125932,
-    -0.126906,
-    -0.12788,
-    -0.128853,
-    -0.129826,
-    -0.130799,
-    -0.131772,
-    -0.132745,
-    -0.133719,
-    -0.134693,
-    -0.135669,
-    -0.136645,
-    -0.137623,
-    -0.138601,
-    -0.13958,
-    -0.140559,
-    -0.141539,
-    -0.142518,
-    -0.143498,
-    -0.144476,
-    -0.145454,
-    -0.146431,
-    -0.147407,
-    -0.148382,
-    -0.149356,
-    -0.150329,
-    -0.151302,
-    -0.152275,
-    -0.153247,
-    -0.15422,
-    -0.155194,
-    -0.156168,
-    -0.157144,
-    -0.15812,
-    -0.159097,
-    -0.160075,
-    -0.161054,
-    -0.162033,
-    -0.163013,
-    -0.163992,
-    -0.164972,
-    -0.16595,
-    -0.166928,
-    -0.167905,
-    -0.168882,
-    -0.169857,
-    -0.170831,
-    -0.171805,
-    -0.172778,
-    -0.17375,
-    -0.174723,
-    -0.175696,
-    -0.176669,
-    -0.177643,
-    -0.178618,
-    -0.179594,
-    -0.180571,
-    -0.181549,
-    -0.182528,
-    -0.183507,
-    -0.184487,
-    -0.185466,
-    -0.186446,
-    -0.187425,
-    -0.188403,
-    -0.18938,
-    -0.190357,
-    -0.191332,
-    -0.192306,
-    -0.19328,
-    -0.194253,
-    -0.195226,
-    -0.196198,
-    -0.197171,
-    -0.198144,
-    -0.199118,
-    -0.200093,
-    -0.201069,
-    -0.202046,
-    -0.203023,
-    -0.204002,
-    -0.204981,
-    -0.20596,
-    -0.20694,
-    -0.20792,
-    -0.208899,
-    -0.209877,
-    -0.210855,
-    -0.211831,
-    -0.212807,
-    -0.213782,
-    -0.214756,
-    -0.215729,
-    -0.216702,
-    -0.217674,
-    -0.218647,
-    -0.21962,
-    -0.220593,
-    -0.221568,
-    -0.222543,
-    -0.22352,
-    -0.224497,
-    -0.225476,
-    -0.226455,
-    -0.227434,
-    -0.228414,
-    -0.229394,
-    -0.230373,
-    -0.231351,
-    -0.232329,
-    -0.233306,
-    -0.234282,
-    -0.235257,
-    -0.236231,
-    -0.237204,
-    -0.238177,
-    -0.23915,
-    -0.240122,
-    -0.241095,
-    -0.242069,
-    -0.243043,
-    -0.244018,
-    -0.244994,
-    -0.245971,
-    -0.24695,
-    -0.247928,
-    -0.248908,
-    -0.249888,
-    -0.250867,
-    -0.251847,
-    -0.252826,
-    -0.253804,
-    -0.254781,
-    -0.255757,
-    -0.256732,
-    -0.257707,
-    -0.25868,
-    -0.259653,
-    -0.260625,
-    -0.261598,
-    -0.262571,
-    -0.263544,
-    -0.264518,
-    -0.265493,
-    -0.266469,
-    -0.267446,
-    -0.268424,
-    -0.269402,
-    -0.270382,
-    -0.271361,
-    -0.272341,
-    -0.273321,
-    -0.2743,
-    -0.275278,
-    -0.276256,
-    -0.277232,
-    -0.278208,
-    -0.279182,
-    -0.280156,
-    -0.281129,
-    -0.282101,
-    -0.283073,
-    -0.284046,
-    -0.285019,
-    -0.285993,
-    -0.286967,
-    -0.287943,
-    -0.28892,
-    -0.289898,
-    -0.290876,
-    -0.291855,
-    -0.292835,
-    -0.293815,
-    -0.294795,
-    -0.295774,
-    -0.296753,
-    -0.29773,
-    -0.298707,
-    -0.299683,
-    -0.300658,
-    -0.301631,
-    -0.302604,
-    -0.303577,
-    -0.304549,
-    -0.305522,
-    -0.306494,
-    -0.307468,
-    -0.308442,
-    -0.309418,
-    -0.310394,
-    -0.311372,
-    -0.31235,
-    -0.313329,
-    -0.314309,
-    -0.315289,
-    -0.316269,
-    -0.317248,
-    -0.318227,
-    -0.319205,
-    -0.320182,
-    -0.321158,
-    -0.322133,
-    -0.323107,
-    -0.32408,
-    -0.325053,
-    -0.326025,
-    -0.326997,
-    -0.32797,
-    -0.328943,
-    -0.329917,
-    -0.330892,
-    -0.331868,
-    -0.332846,
-    -0.333824,
-    -0.334803,
-    -0.335783,
-    -0.336763,
-    -0.337743,
-    -0.338722,
-    -0.339701,
-    -0.34068,
-    -0.341657,
-    -0.342633,
-    -0.343608,
-    -0.344582,
-    -0.345556,
-    -0.346528,
-    -0.347501,
-    -0.348473,
-    -0.349445,
-    -0.350418,
-    -0.351392,
-    -0.352367,
-    -0.353343,
-    -0.35432,
-    -0.355298,
-    -0.356277,
-    -0.357256,
-    -0.358236,
-    -0.359216,
-    -0.360196,
-    -0.361176,
-    -0.362154,
-    -0.363132,
-    -0.364108,
-    -0.365084,
-    -0.366058,
-    -0.367031,
-    -0.368004,
-    -0.368976,
-    -0.369948,
-    -0.370921,
-    -0.371893,
-    -0.372867,
-    -0.373841,
-    -0.374817,
-    -0.375794,
-    -0.376772,
-    -0.37775,
-    -0.37873,
-    -0.37971,
-    -0.38069,
-    -0.38167,
-    -0.38265,
-    -0.383629,
-    -0.384606,
-    -0.385583,
-    -0.386559,
-    -0.387534,
-    -0.388507,
-    -0.38948,
-    -0.390452,
-    -0.391424,
-    -0.392396,
-    -0.393369,
-    -0.394342,
-    -0.395316,
-    -0.396291,
-    -0.397268,
-    -0.398245,
-    -0.399224,
-    -0.400203,
-    -0.401183,
-    -0.402164,
-    -0.403144,
-    -0.404124,
-    -0.405103,
-    -0.406081,
-    -0.407058,
-    -0.408034,
-    -0.409009,
-    -0.409983,
-    -0.410956,
-    -0.411928,
-    -0.4129,
-    -0.413872,
-    -0.414844,
-    -0.415817,
-    -0.416791,
-    -0.417766,
-    -0.418742,
-    -0.419719,
-    -0.420698,
-    -0.421677,
-    -0.422657,
-    -0.423637,
-    -0.424618,
-    -0.425598,
-    -0.426577,
-    -0.427556,
-    -0.428533,
-    -0.42951,
-    -0.430485,
-    -0.431459,
-    -0.432432,
-    -0.433404,
-    -0.434376,
-    -0.435348,
-    -0.43632,
-    -0.437292,
-    -0.438266,
-    -0.43924,
-    -0.440216,
-    -0.441193,
-    -0.442171,
-    -0.443151,
-    -0.444131,
-    -0.445111,
-    -0.446091,
-    -0.447072,
-    -0.448051,
-    -0.44903,
-    -0.450008,
-    -0.450985,
-    -0.45196,
-    -0.452934,
-    -0.453907,
-    -0.45488,
-    -0.455852,
-    -0.456823,
-    -0.457795,
-    -0.458768,
-    -0.459741,
-    -0.460715,
-    -0.46169,
-    -0.462667,
-    -0.463645,
-    -0.464624,
-    -0.465604,
-    -0.466584,
-    -0.467565,
-    -0.468546,
-    -0.469526,
-    -0.470505,
-    -0.471483,
-    -0.47246,
-    -0.473436,
-    -0.47441,
-    -0.475383,
-    -0.476356,
-    -0.477328,
-    -0.478299,
-    -0.479271,
-    -0.480243,
-    -0.481216,
-    -0.48219,
-    -0.483165,
-    -0.484141,
-    -0.485119,
-    -0.486098,
-    -0.487077,
-    -0.488058,
-    -0.489039,
-    -0.490019,
-    -0.491,
-    -0.491979,
-    -0.492958,
-    -0.493935,
-    -0.494911,
-    -0.495886,
-    -0.496859,
-    -0.497832,
-    -0.498804,
-    -0.499775,
-    -0.500746,
-    -0.501718,
-    -0.502691,
-    -0.503664,
-    -0.504639,
-    -0.505615,
-    -0.506592,
-    -0.507571,
-    -0.508551,
-    -0.509531,
-    -0.510512,
-    -0.511493,
-    -0.512474,
-    -0.513454,
-    -0.514432,
-    -0.51541,
-    -0.516387,
-    -0.517362,
-    -0.518335,
-    -0.519308,
-    -0.52028,
-    -0.521251,
-    -0.522222,
-    -0.523194,
-    -0.524166,
-    -0.525139,
-    -0.526113,
-    -0.527089,
-    -0.528066,
-    -0.529045,
-    -0.530024,
-    -0.531005,
-    -0.531986,
-    -0.532967,
-    -0.533948,
-    -0.534928,
-    -0.535907,
-    -0.536885,
-    -0.537862,
-    -0.538837,
-    -0.539811,
-    -0.540784,
-    -0.541756,
-    -0.542727,
-    -0.543698,
-    -0.544669,
-    -0.545641,
-    -0.546614,
-    -0.547588,
-    -0.548563,
-    -0.54954,
-    -0.550518,
-    -0.551497,
-    -0.552478,
-    -0.553459,
-    -0.55444,
-    -0.555421,
-    -0.556402,
-    -0.557382,
-    -0.55836,
-    -0.559337,
-    -0.560313,
-    -0.561287,
-    -0.56226,
-    -0.563232,
-    -0.564203,
-    -0.565174,
-    -0.566145,
-    -0.567116,
-    -0.568089,
-    -0.569062,
-    -0.570037,
-    -0.571013,
-    -0.571991,
-    -0.572971,
-    -0.573951,
-    -0.574932,
-    -0.575914,
-    -0.576895,
-    -0.577876,
-    -0.578856,
-    -0.579835,
-    -0.580813,
-    -0.581789,
-    -0.582763,
-    -0.583737,
-    -0.584708,
-    -0.58568,
-    -0.58665,
-    -0.587621,
-    -0.588592,
-    -0.589564,
-    -0.590537,
-    -0.591511,
-    -0.592487,
-    -0.593465,
-    -0.594444,
-    -0.595424,
-    -0.596405,
-    -0.597387,
-    -0.598369,
-    -0.59935,
-    -0.600331,
-    -0.60131,
-    -0.602288,
-    -0.603265,
-    -0.60424,
-    -0.605213,
-    -0.606185,
-    -0.607156,
-    -0.608126,
-    -0.609097,
-    -0.610067,
-    -0.611039,
-    -0.612011,
-    -0.612985,
-    -0.613961,
-    -0.614938,
-    -0.615917,
-    -0.616897,
-    -0.617878,
-    -0.61886,
-    -0.619842,
-    -0.620824,
-    -0.621805,
-    -0.622785,
-    -0.623764,
-    -0.624741,
-    -0.625716,
-    -0.626689,
-    -0.627661,
-    -0.628632,
-    -0.629603,
-    -0.630573,
-    -0.631543,
-    -0.632514,
-    -0.633486,
-    -0.634459,
-    -0.635434,
-    -0.636411,
-    -0.63739,
-    -0.63837,
-    -0.639351,
-    -0.640333,
-    -0.641315,
-    -0.642298,
-    -0.643279,
-    -0.64426,
-    -0.645239,
-    -0.646216,
-    -0.647192,
-    -0.648166,
-    -0.649138,
-    -0.650109,
-    -0.651079,
-    -0.652049,
-    -0.653019,
-    -0.653989,
-    -0.65496,
-    -0.655933,
-    -0.656908,
-    -0.657884,
-    -0.658862,
-    -0.659842,
-    -0.660824,
-    -0.661806,
-    -0.662789,
-    -0.663771,
-    -0.664753,
-    -0.665735,
-    -0.666714,
-    -0.667692,
-    -0.668668,
-    -0.669643,
-    -0.670615,
-    -0.671586,
-    -0.672556,
-    -0.673525,
-    -0.674495,
-    -0.675464,
-    -0.676435,
-    -0.677407,
-    -0.678381,
-    -0.679357,
-    -0.680335,
-    -0.681315,
-    -0.682296,
-    -0.683278,
-    -0.684262,
-    -0.685245,
-    -0.686227,
-    -0.687209,
-    -0.68819,
-    -0.689168,
-    -0.690145,
-    -0.691119,
-    -0.692092,
-    -0.693063,
-    -0.694033,
-    -0.695002,
-    -0.695971,
-    -0.69694,
-    -0.69791,
-    -0.698882,
-    -0.699855,
-    -0.70083,
-    -0.701808,
-    -0.702787,
-    -0.703768,
-    -0.704751,
-    -0.705734,
-    -0.706718,
-    -0.707701,
-    -0.708684,
-    -0.709665,
-    -0.710644,
-    -0.711621,
-    -0.712596,
-    -0.713569,
-    -0.71454,
-    -0.71551,
-    -0.716479,
-    -0.717447,
-    -0.718416,
-    -0.719385,
-    -0.720356,
-    -0.721328,
-    -0.722303,
-    -0.72328,
-    -0.724259,
-    -0.72524,
-    -0.726223,
-    -0.727207,
-    -0.728191,
-    -0.729175,
-    -0.730158,
-    -0.73114,
-    -0.73212,
-    -0.733098,
-    -0.734074,
-    -0.735047,
-    -0.736018,
-    -0.736988,
-    -0.737956,
-    -0.738924,
-    -0.739891,
-    -0.74086,
-    -0.74183,
-    -0.742802,
-    -0.743776,
-    -0.744752,
-    -0.745731,
-    -0.746712,
-    -0.747695,
-    -0.748679,
-    -0.749664,
-    -0.750648,
-    -0.751633,
-    -0.752615,
-    -0.753596,
-    -0.754575,
-    -0.755551,
-    -0.756525,
-    -0.757496,
-    -0.758465,
-    -0.759433,
-    -0.7604,
-    -0.761367,
-    -0.762335,
-    -0.763304,
-    -0.764275,
-    -0.765248,
-    -0.766224,
-    -0.767202,
-    -0.768183,
-    -0.769166,
-    -0.77015,
-    -0.771136,
-    -0.772122,
-    -0.773107,
-    -0.774091,
-    -0.775073,
-    -0.776052,
-    -0.777029,
-    -0.778003,
-    -0.778975,
-    -0.779944,
-    -0.780911,
-    -0.781878,
-    -0.782844,
-    -0.78381,
-    -0.784778,
-    -0.785748,
-    -0.78672,
-    -0.787695,
-    -0.788673,
-    -0.789654,
-    -0.790637,
-    -0.791622,
-    -0.792608,
-    -0.793595,
-    -0.794581,
-    -0.795566,
-    -0.796549,
-    -0.79753,
-    -0.798507,
-    -0.799482,
-    -0.800454,
-    -0.801423,
-    -0.80239,
-    -0.803355,
-    -0.804321,
-    -0.805286,
-    -0.806252,
-    -0.807221,
-    -0.808192,
-    -0.809166,
-    -0.810143,
-    -0.811123,
-    -0.812107,
-    -0.813092,
-    -0.814079,
-    -0.815067,
-    -0.816055,
-    -0.817041,
-    -0.818026,
-    -0.819008,
-    -0.819987,
-    -0.820962,
-    -0.821934,
-    -0.822903,
-    -0.823869,
-    -0.824834,
-    -0.825798,
-    -0.826761,
-    -0.827726,
-    -0.828693,
-    -0.829663,
-    -0.830636,
-    -0.831612,
-    -0.832592,
-    -0.833576,
-    -0.834562,
-    -0.83555,
-    -0.836539,
-    -0.837528,
-    -0.838517,
-    -0.839503,
-    -0.840487,
-    -0.841467,
-    -0.842443,
-    -0.843415,
-    -0.844384,
-    -0.84535,
-    -0.846313,
-    -0.847275,
-    -0.848237,
-    -0.8492,
-    -0.850165,
-    -0.851133,
-    -0.852104,
-    -0.85308,
-    -0.85406,
-    -0.855043,
-    -0.85603,
-    -0.857019,
-    -0.85801,
-    -0.859002,
-    -0.859992,
-    -0.860981,
-    -0.861966,
-    -0.862948,
-    -0.863925,
-    -0.864898,
-    -0.865867,
-    -0.866832,
-    -0.867794,
-    -0.868754,
-    -0.869714,
-    -0.870674,
-    -0.871636,
-    -0.872602,
-    -0.873571,
-    -0.874546,
-    -0.875525,
-    -0.876508,
-    -0.877496,
-    -0.878487,
-    -0.879481,
-    -0.880475,
-    -0.881468,
-    -0.88246,
-    -0.883448,
-    -0.884432,
-    -0.885411,
-    -0.886384,
-    -0.887353,
-    -0.888316,
-    -0.889276,
-    -0.890234,
-    -0.89119,
-    -0.892147,
-    -0.893106,
-    -0.894068,
-    -0.895035,
-    -0.896008,
-    -0.896986,
-    -0.89797,
-    -0.898959,
-    -0.899953,
-    -0.900949,
-    -0.901947,
-    -0.902945,
-    -0.903941,
-    -0.904933,
-    -0.90592,
-    -0.906901,
-    -0.907875,
-    -0.908843,
-    -0.909805,
-    -0.910762,
-    -0.911716,
-    -0.912668,
-    -0.913619,
-    -0.914573,
-    -0.915531,
-    -0.916494,
-    -0.917464,
-    -0.918441,
-    -0.919425,
-    -0.920417,
-    -0.921414,
-    -0.922415,
-    -0.923419,
-    -0.924423,
-    -0.925425,
-    -0.926423,
-    -0.927415,
-    -0.928399,
-    -0.929375,
-    -0.930342,
-    -0.931302,
-    -0.932254,
-    -0.933201,
-    -0.934145,
-    -0.935089,
-    -0.936034,
-    -0.936984,
-    -0.937941,
-    -0.938907,
-    -0.939882,
-    -0.940868,
-    -0.941863,
-    -0.942867,
-    -0.943877,
-    -0.944891,
-    -0.945906,
-    -0.946919,
-    -0.947927,
-    -0.948927,
-    -0.949917,
-    -0.950896,
-    -0.951861,
-    -0.952815,
-    -0.953758,
-    -0.954693,
-    -0.955622,
-    -0.95655,
-    -0.957479,
-    -0.958414,
-    -0.95936,
-    -0.960317,
-    -0.96129,
-    -0.962278,
-    -0.963282,
-    -0.9643,
-    -0.96533,
-    -0.966367,
-    -0.967408,
-    -0.968446,
-    -0.969477,
-    -0.970496,
-    -0.971498,
-    -0.972479,
-    -0.973439,
-    -0.974376,
-    -0.975292,
-    -0.976192,
-    -0.977079,
-    -0.977961,
-    -0.978845,
-    -0.979739,
-    -0.980652,
-    -0.98159,
-    -0.982561,
-    -0.983568,
-    -0.984613,
-    -0.985694,
-    -0.986807,
-    -0.987944,
-    -0.989093,
-    -0.99024,
-    -0.991367,
-    -0.992455,
-    -0.993483,
-    -0.994429,
-    -0.995273,
-    -0.995994,
-    -0.996575,
-    -0.997001,
-    -0.997261,
-    -0.997349,
-    -0.997261,
-    -0.997001,
-    -0.996575,
-    -0.995994,
-    -0.995273,
-    -0.994429,
-    -0.993483,
-    -0.992455,
-    -0.991367,
-    -0.99024,
-    -0.989093,
-    -0.987944,
-    -0.986807,
-    -0.985694,
-    -0.984613,
-    -0.983568,
-    -0.982561,
-    -0.98159,
-    -0.980652,
-    -0.979739,
-    -0.978845,
-    -0.977961,
-    -0.977079,
-    -0.976192,
-    -0.975292,
-    -0.974376,
-    -0.973439,
-    -0.972479,
-    -0.971498,
-    -0.970496,
-    -0.969477,
-    -0.968446,
-    -0.967408,
-    -0.966367,
-    -0.96533,
-    -0.9643,
-    -0.963282,
-    -0.962278,
-    -0.96129,
-    -0.960317,
-    -0.95936,
-    -0.958414,
-    -0.957479,
-    -0.95655,
-    -0.955622,
-    -0.954693,
-    -0.953758,
-    -0.952815,
-    -0.951861,
-    -0.950896,
-    -0.949917,
-    -0.948927,
-    -0.947927,
-    -0.946919,
-    -0.945906,
-    -0.944891,
-    -0.943877,
-    -0.942867,
-    -0.941863,
-    -0.940868,
-    -0.939882,
-    -0.938907,
-    -0.937941,
-    -0.936984,
-    -0.936034,
-    -0.935089,
-    -0.934145,
-    -0.933201,
-    -0.932254,
-    -0.931302,
-    -0.930342,
-    -0.929375,
-    -0.928399,
-    -0.927415,
-    -0.926423,
-    -0.925425,
-    -0.924423,
-    -0.923419,
-    -0.922415,
-    -0.921414,
-    -0.920417,
-    -0.919425,
-    -0.918441,
-    -0.917464,
-    -0.916494,
-    -0.915531,
-    -0.914573,
-    -0.913619,
-    -0.912668,
-    -0.911716,
-    -0.910762,
-    -0.909805,
-    -0.908843,
-    -0.907875,
-    -0.906901,
-    -0.90592,
-    -0.904933,
-    -0.903941,
-    -0.902945,
-    -0.901947,
-    -0.900949,
-    -0.899953,
-    -0.898959,
-    -0.89797,
-    -0.896986,
-    -0.896008,
-    -0.895035,
-    -0.894068,
-    -0.893106,
-    -0.892147,
-    -0.89119,
-    -0.890234,
-    -0.889276,
-    -0.888316,
-    -0.887353,
-    -0.886384,
-    -0.885411,
-    -0.884432,
-    -0.883448,
-    -0.88246,
-    -0.881468,
-    -0.880475,
-    -0.879481,
-    -0.878487,
-    -0.877496,
-    -0.876508,
-    -0.875525,
-    -0.874546,
-    -0.873571,
-    -0.872602,
-    -0.871636,
-    -0.870674,
-    -0.869714,
-    -0.868754,
-    -0.867794,
-    -0.866832,
-    -0.865867,
-    -0.864898,
-    -0.863925,
-    -0.862948,
-    -0.861966,
-    -0.860981,
-    -0.859992,
-    -0.859002,
-    -0.85801,
-    -0.857019,
-    -0.85603,
-    -0.855043,
-    -0.85406,
-    -0.85308,
-    -0.852104,
-    -0.851133,
-    -0.850165,
-    -0.8492,
-    -0.848237,
-    -0.847275,
-    -0.846313,
-    -0.84535,
-    -0.844384,
-    -0.843415,
-    -0.842443,
-    -0.841467,
-    -0.840487,
-    -0.839503,
-    -0.838517,
-    -0.837528,
-    -0.836539,
-    -0.83555,
-    -0.834562,
-    -0.833576,
-    -0.832592,
-    -0.831612,
-    -0.830636,
-    -0.829663,
-    -0.828693,
-    -0.827726,
-    -0.826761,
-    -0.825798,
-    -0.824834,
-    -0.823869,
-    -0.822903,
-    -0.821934,
-    -0.820962,
-    -0.819987,
-    -0.819008,
-    -0.818026,
-    -0.817041,
-    -0.816055,
-    -0.815067,
-    -0.814079,
-    -0.813092,
-    -0.812107,
-    -0.811123,
-    -0.810143,
-    -0.809166,
-    -0.808192,
-    -0.807221,
-    -0.806252,
-    -0.805286,
-    -0.804321,
-    -0.803355,
-    -0.80239,
-    -0.801423,
-    -0.800454,
-    -0.799482,
-    -0.798507,
-    -0.79753,
-    -0.796549,
-    -0.795566,
-    -0.794581,
-    -0.793595,
-    -0.792608,
-    -0.791622,
-    -0.790637,
-    -0.789654,
-    -0.788673,
-    -0.787695,
-    -0.78672,
-    -0.785748,
-    -0.784778,
-    -0.78381,
-    -0.782844,
-    -0.781878,
-    -0.780911,
-    -0.779944,
-    -0.778975,
-    -0.778003,
-    -0.777029,
-    -0.776052,
-    -0.775073,
-    -0.774091,
-    -0.773107,
-    -0.772122,
-    -0.771136,
-    -0.77015,
-    -0.769166,
-    -0.768183,
-    -0.767202,
-    -0.766224,
-    -0.765248,
-    -0.764275,
-    -0.763304,
-    -0.762335,
-    -0.761367,
-    -0.7604,
-    -0.759433,
-    -0.758465,
-    -0.757496,
-    -0.756525,
-    -0.755551,
-    -0.754575,
-    -0.753596,
-    -0.752615,
-    -0.751633,
-    -0.750648,
-    -0.749664,
-    -0.748679,
-    -0.747695,
-    -0.746712,
-    -0.745731,
-    -0.744752,
-    -0.743776,
-    -0.742802,
-    -0.74183,
-    -0.74086,
-    -0.739891,
-    -0.738924,
-    -0.737956,
-    -0.736988,
-    -0.736018,
-    -0.735047,
-    -0.734074,
-    -0.733098,
-    -0.73212,
-    -0.73114,
-    -0.730158,
-    -0.729175,
-    -0.728191,
-    -0.727207,
-    -0.726223,
-    -0.72524,
-    -0.724259,
-    -0.72328,
-    -0.722303,
-    -0.721328,
-    -0.720356,
-    -0.719385,
-    -0.718416,
-    -0.717447,
-    -0.716479,
-    -0.71551,
-    -0.71454,
-    -0.713569,
-    -0.712596,
-    -0.711621,
-    -0.710644,
-    -0.709665,
-    -0.708684,
-    -0.707701,
-    -0.706718,
-    -0.705734,
-    -0.704751,
-    -0.703768,
-    -0.702787,
-    -0.701808,
-    -0.70083,
-    -0.699855,
-    -0.698882,
-    -0.69791,
-    -0.69694,
-    -0.695971,
-    -0.695002,
-    -0.694033,
-    -0.693063,
-    -0.692092,
-    -0.691119,
-    -0.690145,
-    -0.689168,
-    -0.68819,
-    -0.687209,
-    -0.686227,
-    -0.685245,
-    -0.684262,
-    -0.683278,
-    -0.682296,
-    -0.681315,
-    -0.680335,
-    -0.679357,
-    -0.678381,
-    -0.677407,
-    -0.676435,
-    -0.675464,
-    -0.674495,
-    -0.673525,
-    -0.672556,
-    -0.671586,
-    -0.670615,
-    -0.669643,
-    -0.668668,
-    -0.667692,
-    -0.666714,
-    -0.665735,
-    -0.664753,
-    -0.663771,
-    -0.662789,
-    -0.661806,
-    -0.660824,
-    -0.659842,
-    -0.658862,
-    -0.657884,
-    -0.656908,
-    -0.655933,
-    -0.65496,
-    -0.653989,
-    -0.653019,
-    -0.652049,
-    -0.651079,
-    -0.650109,
-    -0.649138,
-    -0.648166,
-    -0.647192,
-    -0.646216,
-    -0.645239,
-    -0.64426,
-    -0.643279,
-    -0.642298,
-    -0.641315,
-    -0.640333,
-    -0.639351,
-    -0.63837,
-    -0.63739,
-    -0.636411,
-    -0.635434,
-    -0.634459,
-    -0.633486,
-    -0.632514,
-    -0.631543,
-    -0.630573,
-    -0.629603,
-    -0.628632,
-    -0.627661,
-    -0.626689,
-    -0.625716,
-    -0.624741,
-    -0.623764,
-    -0.622785,
-    -0.621805,
-    -0.620824,
-    -0.619842,
-    -0.61886,
-    -0.617878,
-    -0.616897,
-    -0.615917,
-    -0.614938,
-    -0.613961,
-    -0.612985,
-    -0.612011,
-    -0.611039,
-    -0.610067,
-    -0.609097,
-    -0.608126,
-    -0.607156,
-    -0.606185,
-    -0.605213,
-    -0.60424,
-    -0.603265,
-    -0.602288,
-    -0.60131,
-    -0.600331,
-    -0.59935,
-    -0.598369,
-    -0.597387,
-    -0.596405,
-    -0.595424,
-    -0.594444,
-    -0.593465,
-    -0.592487,
-    -0.591511,
-    -0.590537,
-    -0.589564,
-    -0.588592,
-    -0.587621,
-    -0.58665,
-    -0.58568,
-    -0.584708,
-    -0.583737,
-    -0.582763,
-    -0.581789,
-    -0.580813,
-    -0.579835,
-    -0.578856,
-    -0.577876,
-    -0.576895,
-    -0.575914,
-    -0.574932,
-    -0.573951,
-    -0.572971,
-    -0.571991,
-    -0.571013,
-    -0.570037,
-    -0.569062,
-    -0.568089,
-    -0.567116,
-    -0.566145,
-    -0.565174,
-    -0.564203,
-    -0.563232,
-    -0.56226,
-    -0.561287,
-    -0.560313,
-    -0.559337,
-    -0.55836,
-    -0.557382,
-    -0.556402,
-    -0.555421,
-    -0.55444,
-    -0.553459,
-    -0.552478,
-    -0.551497,
-    -0.550518,
-    -0.54954,
-    -0.548563,
-    -0.547588,
-    -0.546614,
-    -0.545641,
-    -0.544669,
-    -0.543698,
-    -0.542727,
-    -0.541756,
-    -0.540784,
-    -0.539811,
-    -0.538837,
-    -0.537862,
-    -0.536885,
-    -0.535907,
-    -0.534928,
-    -0.533948,
-    -0.532967,
-    -0.531986,
-    -0.531005,
-    -0.530024,
-    -0.529045,
-    -0.528066,
-    -0.527089,
-    -0.526113,
-    -0.525139,
-    -0.524166,
-    -0.523194,
-    -0.522222,
-    -0.521251,
-    -0.52028,
-    -0.519308,
-    -0.518335,
-    -0.517362,
-    -0.516387,
-    -0.51541,
-    -0.514432,
-    -0.513454,
-    -0.512474,
-    -0.511493,
-    -0.510512,
-    -0.509531,
-    -0.508551,
-    -0.507571,
-    -0.506592,
-    -0.505615,
-    -0.504639,
-    -0.503664,
-    -0.502691,
-    -0.501718,
-    -0.500746,
-    -0.499775,
-    -0.498804,
-    -0.497832,
-    -0.496859,
-    -0.495886,
-    -0.494911,
-    -0.493935,
-    -0.492958,
-    -0.491979,
-    -0.491,
-    -0.490019,
-    -0.489039,
-    -0.488058,
-    -0.487077,
-    -0.486098,
-    -0.485119,
-    -0.484141,
-    -0.483165,
-    -0.48219,
-    -0.481216,
-    -0.480243,
-    -0.479271,
-    -0.478299,
-    -0.477328,
-    -0.476356,
-    -0.475383,
-    -0.47441,
-    -0.473436,
-    -0.47246,
-    -0.471483,
-    -0.470505,
-    -0.469526,
-    -0.468546,
-    -0.467565,
-    -0.466584,
-    -0.465604,
-    -0.464624,
-    -0.463645,
-    -0.462667,
-    -0.46169,
-    -0.460715,
-    -0.459741,
-    -0.458768,
-    -0.457795,
-    -0.456823,
-    -0.455852,
-    -0.45488,
-    -0.453907,
-    -0.452934,
-    -0.45196,
-    -0.450985,
-    -0.450008,
-    -0.44903,
-    -0.448051,
-    -0.447072,
-    -0.446091,
-    -0.445111,
-    -0.444131,
-    -0.443151,
-    -0.442171,
-    -0.441193,
-    -0.440216,
-    -0.43924,
-    -0.438266,
-    -0.437292,
-    -0.43632,
-    -0.435348,
-    -0.434376,
-    -0.433404,
-    -0.432432,
-    -0.431459,
-    -0.430485,
-    -0.42951,
-    -0.428533,
-    -0.427556,
-    -0.426577,
-    -0.425598,
-    -0.424618,
-    -0.423637,
-    -0.422657,
-    -0.421677,
-    -0.420698,
-    -0.419719,
-    -0.418742,
-    -0.417766,
-    -0.416791,
-    -0.415817,
-    -0.414844,
-    -0.413872,
-    -0.4129,
-    -0.411928,
-    -0.410956,
-    -0.409983,
-    -0.409009,
-    -0.408034,
-    -0.407058,
-    -0.406081,
-    -0.405103,
-    -0.404124,
-    -0.403144,
-    -0.402164,
-    -0.401183,
-    -0.400203,
-    -0.399224,
-    -0.398245,
-    -0.397268,
-    -0.396291,
-    -0.395316,
-    -0.394342,
-    -0.393369,
-    -0.392396,
-    -0.391424,
-    -0.390452,
-    -0.38948,
-    -0.388507,
-    -0.387534,
-    -0.386559,
-    -0.385583,
-    -0.384606,
-    -0.383629,
-    -0.38265,
-    -0.38167,
-    -0.38069,
-    -0.37971,
-    -0.37873,
-    -0.37775,
-    -0.376772,
-    -0.375794,
-    -0.374817,
-    -0.373841,
-    -0.372867,
-    -0.371893,
-    -0.370921,
-    -0.369948,
-    -0.368976,
-    -0.368004,
-    -0.367031,
-    -0.366058,
-    -0.365084,
-    -0.364108,
-    -0.363132,
-    -0.362154,
-    -0.361176,
-    -0.360196,
-    -0.359216,
-    -0.358236,
-    -0.357256,
-    -0.356277,
-    -0.355298,
-    -0.35432,
-    -0.353343,
-    -0.352367,
-    -0.351392,
-    -0.350418,
-    -0.349445,
-    -0.348473,
-    -0.347501,
-    -0.346528,
-    -0.345556,
-    -0.344582,
-    -0.343608,
-    -0.342633,
-    -0.341657,
-    -0.34068,
-    -0.339701,
-    -0.338722,
-    -0.337743,
-    -0.336763,
-    -0.335783,
-    -0.334803,
-    -0.333824,
-    -0.332846,
-    -0.331868,
-    -0.330892,
-    -0.329917,
-    -0.328943,
-    -0.32797,
-    -0.326997,
-    -0.326025,
-    -0.325053,
-    -0.32408,
-    -0.323107,
-    -0.322133,
-    -0.321158,
-    -0.320182,
-    -0.319205,
-    -0.318227,
-    -0.317248,
-    -0.316269,
-    -0.315289,
-    -0.314309,
-    -0.313329,
-    -0.31235,
-    -0.311372,
-    -0.310394,
-    -0.309418,
-    -0.308442,
-    -0.307468,
-    -0.306494,
-    -0.305522,
-    -0.304549,
-    -0.303577,
-    -0.302604,
-    -0.301631,
-    -0.300658,
-    -0.299683,
-    -0.298707,
-    -0.29773,
-    -0.296753,
-    -0.295774,
-    -0.294795,
-    -0.293815,
-    -0.292835,
-    -0.291855,
-    -0.290876,
-    -0.289898,
-    -0.28892,
-    -0.287943,
-    -0.286967,
-    -0.285993,
-    -0.285019,
-    -0.284046,
-    -0.283073,
-    -0.282101,
-    -0.281129,
-    -0.280156,
-    -0.279182,
-    -0.278208,
-    -0.277232,
-    -0.276256,
-    -0.275278,
-    -0.2743,
-    -0.273321,
-    -0.272341,
-    -0.271361,
-    -0.270382,
-    -0.269402,
-    -0.268424,
-    -0.267446,
-    -0.266469,
-    -0.265493,
-    -0.264518,
-    -0.263544,
-    -0.262571,
-    -0.261598,
-    -0.260625,
-    -0.259653,
-    -0.25868,
-    -0.257707,
-    -0.256732,
-    -0.255757,
-    -0.254781,
-    -0.253804,
-    -0.252826,
-    -0.251847,
-    -0.250867,
-    -0.249888,
-    -0.248908,
-    -0.247928,
-    -0.24695,
-    -0.245971,
-    -0.244994,
-    -0.244018,
-    -0.243043,
-    -0.242069,
-    -0.241095,
-    -0.240122,
-    -0.23915,
-    -0.238177,
-    -0.237204,
-    -0.236231,
-    -0.235257,
-    -0.234282,
-    -0.233306,
-    -0.232329,
-    -0.231351,
-    -0.230373,
-    -0.229394,
-    -0.228414,
-    -0.227434,
-    -0.226455,
-    -0.225476,
-    -0.224497,
-    -0.22352,
-    -0.222543,
-    -0.221568,
-    -0.220593,
-    -0.21962,
-    -0.218647,
-    -0.217674,
-    -0.216702,
-    -0.215729,
-    -0.214756,
-    -0.213782,
-    -0.212807,
-    -0.211831,
-    -0.210855,
-    -0.209877,
-    -0.208899,
-    -0.20792,
-    -0.20694,
-    -0.20596,
-    -0.204981,
-    -0.204002,
-    -0.203023,
-    -0.202046,
-    -0.201069,
-    -0.200093,
-    -0.199118,
-    -0.198144,
-    -0.197171,
-    -0.196198,
-    -0.195226,
-    -0.194253,
-    -0.19328,
-    -0.192306,
-    -0.191332,
-    -0.190357,
-    -0.18938,
-    -0.188403,
-    -0.187425,
-    -0.186446,
-    -0.185466,
-    -0.184487,
-    -0.183507,
-    -0.182528,
-    -0.181549,
-    -0.180571,
-    -0.179594,
-    -0.178618,
-    -0.177643,
-    -0.176669,
-    -0.175696,
-    -0.174723,
-    -0.17375,
-    -0.172778,
-    -0.171805,
-    -0.170831,
-    -0.169857,
-    -0.168882,
-    -0.167905,
-    -0.166928,
-    -0.16595,
-    -0.164972,
-    -0.163992,
-    -0.163013,
-    -0.162033,
-    -0.161054,
-    -0.160075,
-    -0.159097,
-    -0.15812,
-    -0.157144,
-    -0.156168,
-    -0.155194,
-    -0.15422,
-    -0.153247,
-    -0.152275,
-    -0.151302,
-    -0.150329,
-    -0.149356,
-    -0.148382,
-    -0.147407,
-    -0.146431,
-    -0.145454,
-    -0.144476,
-    -0.143498,
-    -0.142518,
-    -0.141539,
-    -0.140559,
-    -0.13958,
-    -0.138601,
-    -0.137623,
-    -0.136645,
-    -0.135669,
-    -0.134693,
-    -0.133719,
-    -0.132745,
-    -0.131772,
-    -0.130799,
-    -0.129826,
-    -0.128853,
-    -0.12788,
-    -0.126906,
-    -0.125932,
-    -0.124956,
-    -0.123979,
-    -0.123002,
-    -0.122024,
-    -0.121045,
-    -0.120065,
-    -0.119086,
-    -0.118106,
-    -0.117127,
-    -0.116149,
-    -0.115171,
-    -0.114194,
-    -0.113219,
-    -0.112244,
-    -0.11127,
-    -0.110296,
-    -0.109323,
-    -0.108351,
-    -0.107378,
-    -0.106405,
-    -0.105431,
-    -0.104457,
-    -0.103481,
-    -0.102505,
-    -0.101528,
-    -0.100549,
-    -0.0995706,
-    -0.0985913,
-    -0.0976118,
-    -0.0966323,
-    -0.0956531,
-    -0.0946745,
-    -0.0936967,
-    -0.0927197,
-    -0.0917437,
-    -0.0907686,
-    -0.0897944,
-    -0.0888209,
-    -0.0878479,
-    -0.0868751,
-    -0.0859023,
-    -0.0849293,
-    -0.0839557,
-    -0.0829815,
-    -0.0820063,
-    -0.0810302,
-    -0.0800532,
-    -0.0790752,
-    -0.0780966,
-    -0.0771174,
-    -0.0761379,
-    -0.0751584,
-    -0.0741792,
-    -0.0732004,
-    -0.0722224,
-    -0.0712452,
-    -0.0702689,
-    -0.0692936,
-    -0.0683191,
-    -0.0673455,
-    -0.0663723,
-    -0.0653995,
-    -0.0644268,
-    -0.0634538,
-    -0.0624804,
-    -0.0615063,
-    -0.0605314,
-    -0.0595555,
-    -0.0585787,
-    -0.057601,
-    -0.0566226,
-    -0.0556435,
-    -0.0546641,
-    -0.0536846,
-    -0.0527053,
-    -0.0517264,
-    -0.0507481,
-    -0.0497707,
-    -0.0487942,
-    -0.0478186,
-    -0.0468439,
-    -0.0458701,
-    -0.0448968,
-    -0.0439239,
-    -0.0429512,
-    -0.0419783,
-    -0.041005,
-    -0.0400311,
-    -0.0390564,
-    -0.0380808,
-    -0.0371042,
-    -0.0361268,
-    -0.0351485,
-    -0.0341696,
-    -0.0331903,
-    -0.0322108,
-    -0.0312314,
-    -0.0302523,
-    -0.0292739,
-    -0.0282963,
-    -0.0273195,
-    -0.0263437,
-    -0.0253688,
-    -0.0243947,
-    -0.0234213,
-    -0.0224484,
-    -0.0214756,
-    -0.0205028,
-    -0.0195296,
-    -0.0185559,
-    -0.0175814,
-    -0.016606,
-    -0.0156297,
-    -0.0146525,
-    -0.0136744,
-    -0.0126956,
-    -0.0117164,
-    -0.0107369,
-    -0.00975748,
-    -0.00877834,
-    -0.00779974,
-    -0.00682187,
-    -0.00584487,
-    -0.0048688,
-    -0.00389368,
-    -0.00291941,
-    -0.00194585,
-    -0.000972791,
-    0,
-    0.000972791,
-    0.00194585,
-    0.00291941,
-    0.00389368,
-    0.0048688,
-    0.00584487,
-    0.00682187,
-    0.00779974,
-    0.00877834,
-    0.00975748,
-    0.0107369,
-    0.0117164,
-    0.0126956,
-    0.0136744,
-    0.0146525,
-    0.0156297,
-    0.016606,
-    0.0175814,
-    0.0185559,
-    0.0195296,
-    0.0205028,
-    0.0214756,
-    0.0224484,
-    0.0234213,
-    0.0243947,
-    0.0253688,
-    0.0263437,
-    0.0273195,
-    0.0282963,
-    0.0292739,
-    0.0302523,
-    0.0312314,
-    0.0322108,
-    0.0331903,
-    0.0341696,
-    0.0351485,
-    0.0361268,
-    0.0371042,
-    0.0380808,
-    0.0390564,
-    0.0400311,
-    0.041005,
-    0.0419783,
-    0.0429512,
-    0.0439239,
-    0.0448968,
-    0.0458701,
-    0.0468439,
-    0.0478186,
-    0.0487942,
-    0.0497707,
-    0.0507481,
-    0.0517264,
-    0.0527053,
-    0.0536846,
-    0.0546641,
-    0.0556435,
-    0.0566226,
-    0.057601,
-    0.0585787,
-    0.0595555,
-    0.0605314,
-    0.0615063,
-    0.0624804,
-    0.0634538,
-    0.0644268,
-    0.0653995,
-    0.0663723,
-    0.0673455,
-    0.0683191,
-    0.0692936,
-    0.0702689,
-    0.0712452,
-    0.0722224,
-    0.0732004,
-    0.0741792,
-    0.0751584,
-    0.0761379,
-    0.0771174,
-    0.0780966,
-    0.0790752,
-    0.0800532,
-    0.0810302,
-    0.0820063,
-    0.0829815,
-    0.0839557,
-    0.0849293,
-    0.0859023,
-    0.0868751,
-    0.0878479,
-    0.0888209,
-    0.0897944,
-    0.0907686,
-    0.0917437,
-    0.0927197,
-    0.0936967,
-    0.0946745,
-    0.0956531,
-    0.0966323,
-    0.0976118,
-    0.0985913,
-    0.0995706,
-    0.100549,
-    0.101528,
-    0.102505,
-    0.103481,
-    0.104457,
-    0.105431,
-    0.106405,
-    0.107378,
-    0.108351,
-    0.109323,
-    0.110296,
-    0.11127,
-    0.112244,
-    0.113219,
-    0.114194,
-    0.115171,
-    0.116149,
-    0.117127,
-    0.118106,
-    0.119086,
-    0.120065,
-    0.121045,
-    0.122024,
-    0.123002,
-    0.123979,
-    0.124956,
-    0.125932,
-    0.126906,
-    0.12788,
-    0.128853,
-    0.129826,
-    0.130799,
-    0.131772,
-    0.132745,
-    0.133719,
-    0.134693,
-    0.135669,
-    0.136645,
-    0.137623,
-    0.138601,
-    0.13958,
-    0.140559,
-    0.141539,
-    0.142518,
-    0.143498,
-    0.144476,
-    0.145454,
-    0.146431,
-    0.147407,
-    0.148382,
-    0.149356,
-    0.150329,
-    0.151302,
-    0.152275,
-    0.153247,
-    0.15422,
-    0.155194,
-    0.156168,
-    0.157144,
-    0.15812,
-    0.159097,
-    0.160075,
-    0.161054,
-    0.162033,
-    0.163013,
-    0.163992,
-    0.164972,
-    0.16595,
-    0.166928,
-    0.167905,
-    0.168882,
-    0.169857,
-    0.170831,
-    0.171805,
-    0.172778,
-    0.17375,
-    0.174723,
-    0.175696,
-    0.176669,
-    0.177643,
-    0.178618,
-    0.179594,
-    0.180571,
-    0.181549,
-    0.182528,
-    0.183507,
-    0.184487,
-    0.185466,
-    0.186446,
-    0.187425,
-    0.188403,
-    0.18938,
-    0.190357,
-    0.191332,
-    0.192306,
-    0.19328,
-    0.194253,
-    0.195226,
-    0.196198,
-    0.197171,
-    0.198144,
-    0.199118,
-    0.200093,
-    0.201069,
-    0.202046,
-    0.203023,
-    0.204002,
-    0.204981,
-    0.20596,
-    0.20694,
-    0.20792,
-    0.208899,
-    0.209877,
-    0.210855,
-    0.211831,
-    0.212807,
-    0.213782,
-    0.214756,
-    0.215729,
-    0.216702,
-    0.217674,
-    0.218647,
-    0.21962,
-    0.220593,
-    0.221568,
-    0.222543,
-    0.22352,
-    0.224497,
-    0.225476,
-    0.226455,
-    0.227434,
-    0.228414,
-    0.229394,
-    0.230373,
-    0.231351,
-    0.232329,
-    0.233306,
-    0.234282,
-    0.235257,
-    0.236231,
-    0.237204,
-    0.238177,
-    0.23915,
-    0.240122,
-    0.241095,
-    0.242069,
-    0.243043,
-    0.244018,
-    0.244994,
-    0.245971,
-    0.24695,
-    0.247928,
-    0.248908,
-    0.249888,
-    0.250867,
-    0.251847,
-    0.252826,
-    0.253804,
-    0.254781,
-    0.255757,
-    0.256732,
-    0.257707,
-    0.25868,
-    0.259653,
-    0.260625,
-    0.261598,
-    0.262571,
-    0.263544,
-    0.264518,
-    0.265493,
-    0.266469,
-    0.267446,
-    0.268424,
-    0.269402,
-    0.270382,
-    0.271361,
-    0.272341,
-    0.273321,
-    0.2743,
-    0.275278,
-    0.276256,
-    0.277232,
-    0.278208,
-    0.279182,
-    0.280156,
-    0.281129,
-    0.282101,
-    0.283073,
-    0.284046,
-    0.285019,
-    0.285993,
-    0.286967,
-    0.287943,
-    0.28892,
-    0.289898,
-    0.290876,
-    0.291855,
-    0.292835,
-    0.293815,
-    0.294795,
-    0.295774,
-    0.296753,
-    0.29773,
-    0.298707,
-    0.299683,
-    0.300658,
-    0.301631,
-    0.302604,
-    0.303577,
-    0.304549,
-    0.305522,
-    0.306494,
-    0.307468,
-    0.308442,
-    0.309418,
-    0.310394,
-    0.311372,
-    0.31235,
-    0.313329,
-    0.314309,
-    0.315289,
-    0.316269,
-    0.317248,
-    0.318227,
-    0.319205,
-    0.320182,
-    0.321158,
-    0.322133,
-    0.323107,
-    0.32408,
-    0.325053,
-    0.326025,
-    0.326997,
-    0.32797,
-    0.328943,
-    0.329917,
-    0.330892,
-    0.331868,
-    0.332846,
-    0.333824,
-    0.334803,
-    0.335783,
-    0.336763,
-    0.337743,
-    0.338722,
-    0.339701,
-    0.34068,
-    0.341657,
-    0.342633,
-    0.343608,
-    0.344582,
-    0.345556,
-    0.346528,
-    0.347501,
-    0.348473,
-    0.349445,
-    0.350418,
-    0.351392,
-    0.352367,
-    0.353343,
-    0.35432,
-    0.355298,
-    0.356277,
-    0.357256,
-    0.358236,
-    0.359216,
-    0.360196,
-    0.361176,
-    0.362154,
-    0.363132,
-    0.364108,
-    0.365084,
-    0.366058,
-    0.367031,
-    0.368004,
-    0.368976,
-    0.369948,
-    0.370921,
-    0.371893,
-    0.372867,
-    0.373841,
-    0.374817,
-    0.375794,
-    0.376772,
-    0.37775,
-    0.37873,
-    0.37971,
-    0.38069,
-    0.38167,
-    0.38265,
-    0.383629,
-    0.384606,
-    0.385583,
-    0.386559,
-    0.387534,
-    0.388507,
-    0.38948,
-    0.390452,
-    0.391424,
-    0.392396,
-    0.393369,
-    0.394342,
-    0.395316,
-    0.396291,
-    0.397268,
-    0.398245,
-    0.399224,
-    0.400203,
-    0.401183,
-    0.402164,
-    0.403144,
-    0.404124,
-    0.405103,
-    0.406081,
-    0.407058,
-    0.408034,
-    0.409009,
-    0.409983,
-    0.410956,
-    0.411928,
-    0.4129,
-    0.413872,
-    0.414844,
-    0.415817,
-    0.416791,
-    0.417766,
-    0.418742,
-    0.419719,
-    0.420698,
-    0.421677,
-    0.422657,
-    0.423637,
-    0.424618,
-    0.425598,
-    0.426577,
-    0.427556,
-    0.428533,
-    0.42951,
-    0.430485,
-    0.431459,
-    0.432432,
-    0.433404,
-    0.434376,
-    0.435348,
-    0.43632,
-    0.437292,
-    0.438266,
-    0.43924,
-    0.440216,
-    0.441193,
-    0.442171,
-    0.443151,
-    0.444131,
-    0.445111,
-    0.446091,
-    0.447072,
-    0.448051,
-    0.44903,
-    0.450008,
-    0.450985,
-    0.45196,
-    0.452934,
-    0.453907,
-    0.45488,
-    0.455852,
-    0.456823,
-    0.457795,
-    0.458768,
-    0.459741,
-    0.460715,
-    0.46169,
-    0.462667,
-    0.463645,
-    0.464624,
-    0.465604,
-    0.466584,
-    0.467565,
-    0.468546,
-    0.469526,
-    0.470505,
-    0.471483,
-    0.47246,
-    0.473436,
-    0.47441,
-    0.475383,
-    0.476356,
-    0.477328,
-    0.478299,
-    0.479271,
-    0.480243,
-    0.481216,
-    0.48219,
-    0.483165,
-    0.484141,
-    0.485119,
-    0.486098,
-    0.487077,
-    0.488058,
-    0.489039,
-    0.490019,
-    0.491,
-    0.491979,
-    0.492958,
-    0.493935,
-    0.494911,
-    0.495886,
-    0.496859,
-    0.497832,
-    0.498804,
-    0.499775,
-    0.500746,
-    0.501718,
-    0.502691,
-    0.503664,
-    0.504639,
-    0.505615,
-    0.506592,
-    0.507571,
-    0.508551,
-    0.509531,
-    0.510512,
-    0.511493,
-    0.512474,
-    0.513454,
-    0.514432,
-    0.51541,
-    0.516387,
-    0.517362,
-    0.518335,
-    0.519308,
-    0.52028,
-    0.521251,
-    0.522222,
-    0.523194,
-    0.524166,
-    0.525139,
-    0.526113,
-    0.527089,
-    0.528066,
-    0.529045,
-    0.530024,
-    0.531005,
-    0.531986,
-    0.532967,
-    0.533948,
-    0.534928,
-    0.535907,
-    0.536885,
-    0.537862,
-    0.538837,
-    0.539811,
-    0.540784,
-    0.541756,
-    0.542727,
-    0.543698,
-    0.544669,
-    0.545641,
-    0.546614,
-    0.547588,
-    0.548563,
-    0.54954,
-    0.550518,
-    0.551497,
-    0.552478,
-    0.553459,
-    0.55444,
-    0.555421,
-    0.556402,
-    0.557382,
-    0.55836,
-    0.559337,
-    0.560313,
-    0.561287,
-    0.56226,
-    0.563232,
-    0.564203,
-    0.565174,
-    0.566145,
-    0.567116,
-    0.568089,
-    0.569062,
-    0.570037,
-    0.571013,
-    0.571991,
-    0.572971,
-    0.573951,
-    0.574932,
-    0.575914,
-    0.576895,
-    0.577876,
-    0.578856,
-    0.579835,
-    0.580813,
-    0.581789,
-    0.582763,
-    0.583737,
-    0.584708,
-    0.58568,
-    0.58665,
-    0.587621,
-    0.588592,
-    0.589564,
-    0.590537,
-    0.591511,
-    0.592487,
-    0.593465,
-    0.594444,
-    0.595424,
-    0.596405,
-    0.597387,
-    0.598369,
-    0.59935,
-    0.600331,
-    0.60131,
-    0.602288,
-    0.603265,
-    0.60424,
-    0.605213,
-    0.606185,
-    0.607156,
-    0.608126,
-    0.609097,
-    0.610067,
-    0.611039,
-    0.612011,
-    0.612985,
-    0.613961,
-    0.614938,
-    0.615917,
-    0.616897,
-    0.617878,
-    0.61886,
-    0.619842,
-    0.620824,
-    0.621805,
-    0.622785,
-    0.623764,
-    0.624741,
-    0.625716,
-    0.626689,
-    0.627661,
-    0.628632,
-    0.629603,
-    0.630573,
-    0.631543,
-    0.632514,
-    0.633486,
-    0.634459,
-    0.635434,
-    0.636411,
-    0.63739,
-    0.63837,
-    0.639351,
-    0.640333,
-    0.641315,
-    0.642298,
-    0.643279,
-    0.64426,
-    0.645239,
-    0.646216,
-    0.647192,
-    0.648166,
-    0.649138,
-    0.650109,
-    0.651079,
-    0.652049,
-    0.653019,
-    0.653989,
-    0.65496,
-    0.655933,
-    0.656908,
-    0.657884,
-    0.658862,
-    0.659842,
-    0.660824,
-    0.661806,
-    0.662789,
-    0.663771,
-    0.664753,
-    0.665735,
-    0.666714,
-    0.667692,
-    0.668668,
-    0.669643,
-    0.670615,
-    0.671586,
-    0.672556,
-    0.673525,
-    0.674495,
-    0.675464,
-    0.676435,
-    0.677407,
-    0.678381,
-    0.679357,
-    0.680335,
-    0.681315,
-    0.682296,
-    0.683278,
-    0.684262,
-    0.685245,
-    0.686227,
-    0.687209,
-    0.68819,
-    0.689168,
-    0.690145,
-    0.691119,
-    0.692092,
-    0.693063,
-    0.694033,
-    0.695002,
-    0.695971,
-    0.69694,
-    0.69791,
-    0.698882,
-    0.699855,
-    0.70083,
-    0.701808,
-    0.702787,
-    0.703768,
-    0.704751,
-    0.705734,
-    0.706718,
-    0.707701,
-    0.708684,
-    0.709665,
-    0.710644,
-    0.711621,
-    0.712596,
-    0.713569,
-    0.71454,
-    0.71551,
-    0.716479,
-    0.717447,
-    0.718416,
-    0.719385,
-    0.720356,
-    0.721328,
-    0.722303,
-    0.72328,
-    0.724259,
-    0.72524,
-    0.726223,
-    0.727207,
-    0.728191,
-    0.729175,
-    0.730158,
-    0.73114,
-    0.73212,
-    0.733098,
-    0.734074,
-    0.735047,
-    0.736018,
-    0.736988,
-    0.737956,
-    0.738924,
-    0.739891,
-    0.74086,
-    0.74183,
-    0.742802,
-    0.743776,
-    0.744752,
-    0.745731,
-    0.746712,
-    0.747695,
-    0.748679,
-    0.749664,
-    0.750648,
-    0.751633,
-    0.752615,
-    0.753596,
-    0.754575,
-    0.755551,
-    0.756525,
-    0.757496,
-    0.758465,
-    0.759433,
-    0.7604,
-    0.761367,
-    0.762335,
-    0.763304,
-    0.764275,
-    0.765248,
-    0.766224,
-    0.767202,
-    0.768183,
-    0.769166,
-    0.77015,
-    0.771136,
-    0.772122,
-    0.773107,
-    0.774091,
-    0.775073,
-    0.776052,
-    0.777029,
-    0.778003,
-    0.778975,
-    0.779944,
-    0.780911,
-    0.781878,
-    0.782844,
-    0.78381,
-    0.784778,
-    0.785748,
-    0.78672,
-    0.787695,
-    0.788673,
-    0.789654,
-    0.790637,
-    0.791622,
-    0.792608,
-    0.793595,
-    0.794581,
-    0.795566,
-    0.796549,
-    0.79753,
-    0.798507,
-    0.799482,
-    0.800454,
-    0.801423,
-    0.80239,
-    0.803355,
-    0.804321,
-    0.805286,
-    0.806252,
-    0.807221,
-    0.808192,
-    0.809166,
-    0.810143,
-    0.811123,
-    0.812107,
-    0.813092,
-    0.814079,
-    0.815067,
-    0.816055,
-    0.817041,
-    0.818026,
-    0.819008,
-    0.819987,
-    0.820962,
-    0.821934,
-    0.822903,
-    0.823869,
-    0.824834,
-    0.825798,
-    0.826761,
-    0.827726,
-    0.828693,
-    0.829663,
-    0.830636,
-    0.831612,
-    0.832592,
-    0.833576,
-    0.834562,
-    0.83555,
-    0.836539,
-    0.837528,
-    0.838517,
-    0.839503,
-    0.840487,
-    0.841467,
-    0.842443,
-    0.843415,
-    0.844384,
-    0.84535,
-    0.846313,
-    0.847275,
-    0.848237,
-    0.8492,
-    0.850165,
-    0.851133,
-    0.852104,
-    0.85308,
-    0.85406,
-    0.855043,
-    0.85603,
-    0.857019,
-    0.85801,
-    0.859002,
-    0.859992,
-    0.860981,
-    0.861966,
-    0.862948,
-    0.863925,
-    0.864898,
-    0.865867,
-    0.866832,
-    0.867794,
-    0.868754,
-    0.869714,
-    0.870674,
-    0.871636,
-    0.872602,
-    0.873571,
-    0.874546,
-    0.875525,
-    0.876508,
-    0.877496,
-    0.878487,
-    0.879481,
-    0.880475,
-    0.881468,
-    0.88246,
-    0.883448,
-    0.884432,
-    0.885411,
-    0.886384,
-    0.887353,
-    0.888316,
-    0.889276,
-    0.890234,
-    0.89119,
-    0.892147,
-    0.893106,
-    0.894068,
-    0.895035,
-    0.896008,
-    0.896986,
-    0.89797,
-    0.898959,
-    0.899953,
-    0.900949,
-    0.901947,
-    0.902945,
-    0.903941,
-    0.904933,
-    0.90592,
-    0.906901,
-    0.907875,
-    0.908843,
-    0.909805,
-    0.910762,
-    0.911716,
-    0.912668,
-    0.913619,
-    0.914573,
-    0.915531,
-    0.916494,
-    0.917464,
-    0.918441,
-    0.919425,
-    0.920417,
-    0.921414,
-    0.922415,
-    0.923419,
-    0.924423,
-    0.925425,
-    0.926423,
-    0.927415,
-    0.928399,
-    0.929375,
-    0.930342,
-    0.931302,
-    0.932254,
-    0.933201,
-    0.934145,
-    0.935089,
-    0.936034,
-    0.936984,
-    0.937941,
-    0.938907,
-    0.939882,
-    0.940868,
-    0.941863,
-    0.942867,
-    0.943877,
-    0.944891,
-    0.945906,
-    0.946919,
-    0.947927,
-    0.948927,
-    0.949917,
-    0.950896,
-    0.951861,
-    0.952815,
-    0.953758,
-    0.954693,
-    0.955622,
-    0.95655,
-    0.957479,
-    0.958414,
-    0.95936,
-    0.960317,
-    0.96129,
-    0.962278,
-    0.963282,
-    0.9643,
-    0.96533,
-    0.966367,
-    0.967408,
-    0.968446,
-    0.969477,
-    0.970496,
-    0.971498,
-    0.972479,
-    0.973439,
-    0.974376,
-    0.975292,
-    0.976192,
-    0.977079,
-    0.977961,
-    0.978845,
-    0.979739,
-    0.980652,
-    0.98159,
-    0.982561,
-    0.983568,
-    0.984613,
-    0.985694,
-    0.986807,
-    0.987944,
-    0.989093,
-    0.99024,
-    0.991367,
-    0.992455,
-    0.993483,
-    0.994429,
-    0.995273,
-    0.995994,
-    0.996575,
-    0.997001,
-    0.997261,
-    0.997349,
-    0.997261,
-    0.997001,
-    0.996575,
-    0.995994,
-    0.995273,
-    0.994429,
-    0.993483,
-    0.992455,
-    0.991367,
-    0.99024,
-    0.989093,
-    0.987944,
-    0.986807,
-    0.985694,
-    0.984613,
-    0.983568,
-    0.982561,
-    0.98159,
-    0.980652,
-    0.979739,
-    0.978845,
-    0.977961,
-    0.977079,
-    0.976192,
-    0.975292,
-    0.974376,
-    0.973439,
-    0.972479,
-    0.971498,
-    0.970496,
-    0.969477,
-    0.968446,
-    0.967408,
-    0.966367,
-    0.96533,
-    0.9643,
-    0.963282,
-    0.962278,
-    0.96129,
-    0.960317,
-    0.95936,
-    0.958414,
-    0.957479,
-    0.95655,
-    0.955622,
-    0.954693,
-    0.953758,
-    0.952815,
-    0.951861,
-    0.950896,
-    0.949917,
-    0.948927,
-    0.947927,
-    0.946919,
-    0.945906,
-    0.944891,
-    0.943877,
-    0.942867,
-    0.941863,
-    0.940868,
-    0.939882,
-    0.938907,
-    0.937941,
-    0.936984,
-    0.936034,
-    0.935089,
-    0.934145,
-    0.933201,
-    0.932254,
-    0.931302,
-    0.930342,
-    0.929375,
-    0.928399,
-    0.927415,
-    0.926423,
-    0.925425,
-    0.924423,
-    0.923419,
-    0.922415,
-    0.921414,
-    0.920417,
-    0.919425,
-    0.918441,
-    0.917464,
-    0.916494,
-    0.915531,
-    0.914573,
-    0.913619,
-    0.912668,
-    0.911716,
-    0.910762,
-    0.909805,
-    0.908843,
-    0.907875,
-    0.906901,
-    0.90592,
-    0.904933,
-    0.903941,
-    0.902945,
-    0.901947,
-    0.900949,
-    0.899953,
-    0.898959,
-    0.89797,
-    0.896986,
-    0.896008,
-    0.895035,
-    0.894068,
-    0.893106,
-    0.892147,
-    0.89119,
-    0.890234,
-    0.889276,
-    0.888316,
-    0.887353,
-    0.886384,
-    0.885411,
-    0.884432,
-    0.883448,
-    0.88246,
-    0.881468,
-    0.880475,
-    0.879481,
-    0.878487,
-    0.877496,
-    0.876508,
-    0.875525,
-    0.874546,
-    0.873571,
-    0.872602,
-    0.871636,
-    0.870674,
-    0.869714,
-    0.868754,
-    0.867794,
-    0.866832,
-    0.865867,
-    0.864898,
-    0.863925,
-    0.862948,
-    0.861966,
-    0.860981,
-    0.859992,
-    0.859002,
-    0.85801,
-    0.857019,
-    0.85603,
-    0.855043,
-    0.85406,
-    0.85308,
-    0.852104,
-    0.851133,
-    0.850165,
-    0.8492,
-    0.848237,
-    0.847275,
-    0.846313,
-    0.84535,
-    0.844384,
-    0.843415,
-    0.842443,
-    0.841467,
-    0.840487,
-    0.839503,
-    0.838517,
-    0.837528,
-    0.836539,
-    0.83555,
-    0.834562,
-    0.833576,
-    0.832592,
-    0.831612,
-    0.830636,
-    0.829663,
-    0.828693,
-    0.827726,
-    0.826761,
-    0.825798,
-    0.824834,
-    0.823869,
-    0.822903,
-    0.821934,
-    0.820962,
-    0.819987,
-    0.819008,
-    0.818026,
-    0.817041,
-    0.816055,
-    0.815067,
-    0.814079,
-    0.813092,
-    0.812107,
-    0.811123,
-    0.810143,
-    0.809166,
-    0.808192,
-    0.807221,
-    0.806252,
-    0.805286,
-    0.804321,
-    0.803355,
-    0.80239,
-    0.801423,
-    0.800454,
-    0.799482,
-    0.798507,
-    0.79753,
-    0.796549,
-    0.795566,
-    0.794581,
-    0.793595,
-    0.792608,
-    0.791622,
-    0.790637,
-    0.789654,
-    0.788673,
-    0.787695,
-    0.78672,
-    0.785748,
-    0.784778,
-    0.78381,
-    0.782844,
-    0.781878,
-    0.780911,
-    0.779944,
-    0.778975,
-    0.778003,
-    0.777029,
-    0.776052,
-    0.775073,
-    0.774091,
-    0.773107,
-    0.772122,
-    0.771136,
-    0.77015,
-    0.769166,
-    0.768183,
-    0.767202,
-    0.766224,
-    0.765248,
-    0.764275,
-    0.763304,
-    0.762335,
-    0.761367,
-    0.7604,
-    0.759433,
-    0.758465,
-    0.757496,
-    0.756525,
-    0.755551,
-    0.754575,
-    0.753596,
-    0.752615,
-    0.751633,
-    0.750648,
-    0.749664,
-    0.748679,
-    0.747695,
-    0.746712,
-    0.745731,
-    0.744752,
-    0.743776,
-    0.742802,
-    0.74183,
-    0.74086,
-    0.739891,
-    0.738924,
-    0.737956,
-    0.736988,
-    0.736018,
-    0.735047,
-    0.734074,
-    0.733098,
-    0.73212,
-    0.73114,
-    0.730158,
-    0.729175,
-    0.728191,
-    0.727207,
-    0.726223,
-    0.72524,
-    0.724259,
-    0.72328,
-    0.722303,
-    0.721328,
-    0.720356,
-    0.719385,
-    0.718416,
-    0.717447,
-    0.716479,
-    0.71551,
-    0.71454,
-    0.713569,
-    0.712596,
-    0.711621,
-    0.710644,
-    0.709665,
-    0.708684,
-    0.707701,
-    0.706718,
-    0.705734,
-    0.704751,
-    0.703768,
-    0.702787,
-    0.701808,
-    0.70083,
-    0.699855,
-    0.698882,
-    0.69791,
-    0.69694,
-    0.695971,
-    0.695002,
-    0.694033,
-    0.693063,
-    0.692092,
-    0.691119,
-    0.690145,
-    0.689168,
-    0.68819,
-    0.687209,
-    0.686227,
-    0.685245,
-    0.684262,
-    0.683278,
-    0.682296,
-    0.681315,
-    0.680335,
-    0.679357,
-    0.678381,
-    0.677407,
-    0.676435,
-    0.675464,
-    0.674495,
-    0.673525,
-    0.672556,
-    0.671586,
-    0.670615,
-    0.669643,
-    0.668668,
-    0.667692,
-    0.666714,
-    0.665735,
-    0.664753,
-    0.663771,
-    0.662789,
-    0.661806,
-    0.660824,
-    0.659842,
-    0.658862,
-    0.657884,
-    0.656908,
-    0.655933,
-    0.65496,
-    0.653989,
-    0.653019,
-    0.652049,
-    0.651079,
-    0.650109,
-    0.649138,
-    0.648166,
-    0.647192,
-    0.646216,
-    0.645239,
-    0.64426,
-    0.643279,
-    0.642298,
-    0.641315,
-    0.640333,
-    0.639351,
-    0.63837,
-    0.63739,
-    0.636411,
-    0.635434,
-    0.634459,
-    0.633486,
-    0.632514,
-    0.631543,
-    0.630573,
-    0.629603,
-    0.628632,
-    0.627661,
-    0.626689,
-    0.625716,
-    0.624741,
-    0.623764,
-    0.622785,
-    0.621805,
-    0.620824,
-    0.619842,
-    0.61886,
-    0.617878,
-    0.616897,
-    0.615917,
-    0.614938,
-    0.613961,
-    0.612985,
-    0.612011,
-    0.611039,
-    0.610067,
-    0.609097,
-    0.608126,
-    0.607156,
-    0.606185,
-    0.605213,
-    0.60424,
-    0.603265,
-    0.602288,
-    0.60131,
-    0.600331,
-    0.59935,
-    0.598369,
-    0.597387,
-    0.596405,
-    0.595424,
-    0.594444,
-    0.593465,
-    0.592487,
-    0.591511,
-    0.590537,
-    0.589564,
-    0.588592,
-    0.587621,
-    0.58665,
-    0.58568,
-    0.584708,
-    0.583737,
-    0.582763,
-    0.581789,
-    0.580813,
-    0.579835,
-    0.578856,
-    0.577876,
-    0.576895,
-    0.575914,
-    0.574932,
-    0.573951,
-    0.572971,
-    0.571991,
-    0.571013,
-    0.570037,
-    0.569062,
-    0.568089,
-    0.567116,
-    0.566145,
-    0.565174,
-    0.564203,
-    0.563232,
-    0.56226,
-    0.561287,
-    0.560313,
-    0.559337,
-    0.55836,
-    0.557382,
-    0.556402,
-    0.555421,
-    0.55444,
-    0.553459,
-    0.552478,
-    0.551497,
-    0.550518,
-    0.54954,
-    0.548563,
-    0.547588,
-    0.546614,
-    0.545641,
-    0.544669,
-    0.543698,
-    0.542727,
-    0.541756,
-    0.540784,
-    0.539811,
-    0.538837,
-    0.537862,
-    0.536885,
-    0.535907,
-    0.534928,
-    0.533948,
-    0.532967,
-    0.531986,
-    0.531005,
-    0.530024,
-    0.529045,
-    0.528066,
-    0.527089,
-    0.526113,
-    0.525139,
-    0.524166,
-    0.523194,
-    0.522222,
-    0.521251,
-    0.52028,
-    0.519308,
-    0.518335,
-    0.517362,
-    0.516387,
-    0.51541,
-    0.514432,
-    0.513454,
-    0.512474,
-    0.511493,
-    0.510512,
-    0.509531,
-    0.508551,
-    0.507571,
-    0.506592,
-    0.505615,
-    0.504639,
-    0.503664,
-    0.502691,
-    0.501718,
-    0.500746,
-    0.499775,
-    0.498804,
-    0.497832,
-    0.496859,
-    0.495886,
-    0.494911,
-    0.493935,
-    0.492958,
-    0.491979,
-    0.491,
-    0.490019,
-    0.489039,
-    0.488058,
-    0.487077,
-    0.486098,
-    0.485119,
-    0.484141,
-    0.483165,
-    0.48219,
-    0.481216,
-    0.480243,
-    0.479271,
-    0.478299,
-    0.477328,
-    0.476356,
-    0.475383,
-    0.47441,
-    0.473436,
-    0.47246,
-    0.471483,
-    0.470505,
-    0.469526,
-    0.468546,
-    0.467565,
-    0.466584,
-    0.465604,
-    0.464624,
-    0.463645,
-    0.462667,
-    0.46169,
-    0.460715,
-    0.459741,
-    0.458768,
-    0.457795,
-    0.456823,
-    0.455852,
-    0.45488,
-    0.453907,
-    0.452934,
-    0.45196,
-    0.450985,
-    0.450008,
-    0.44903,
-    0.448051,
-    0.447072,
-    0.446091,
-    0.445111,
-    0.444131,
-    0.443151,
-    0.442171,
-    0.441193,
-    0.440216,
-    0.43924,
-    0.438266,
-    0.437292,
-    0.43632,
-    0.435348,
-    0.434376,
-    0.433404,
-    0.432432,
-    0.431459,
-    0.430485,
-    0.42951,
-    0.428533,
-    0.427556,
-    0.426577,
-    0.425598,
-    0.424618,
-    0.423637,
-    0.422657,
-    0.421677,
-    0.420698,
-    0.419719,
-    0.418742,
-    0.417766,
-    0.416791,
-    0.415817,
-    0.414844,
-    0.413872,
-    0.4129,
-    0.411928,
-    0.410956,
-    0.409983,
-    0.409009,
-    0.408034,
-    0.407058,
-    0.406081,
-    0.405103,
-    0.404124,
-    0.403144,
-    0.402164,
-    0.401183,
-    0.400203,
-    0.399224,
-    0.398245,
-    0.397268,
-    0.396291,
-    0.395316,
-    0.394342,
-    0.393369,
-    0.392396,
-    0.391424,
-    0.390452,
-    0.38948,
-    0.388507,
-    0.387534,
-    0.386559,
-    0.385583,
-    0.384606,
-    0.383629,
-    0.38265,
-    0.38167,
-    0.38069,
-    0.37971,
-    0.37873,
-    0.37775,
-    0.376772,
-    0.375794,
-    0.374817,
-    0.373841,
-    0.372867,
-    0.371893,
-    0.370921,
-    0.369948,
-    0.368976,
-    0.368004,
-    0.367031,
-    0.366058,
-    0.365084,
-    0.364108,
-    0.363132,
-    0.362154,
-    0.361176,
-    0.360196,
-    0.359216,
-    0.358236,
-    0.357256,
-    0.356277,
-    0.355298,
-    0.35432,
-    0.353343,
-    0.352367,
-    0.351392,
-    0.350418,
-    0.349445,
-    0.348473,
-    0.347501,
-    0.346528,
-    0.345556,
-    0.344582,
-    0.343608,
-    0.342633,
-    0.341657,
-    0.34068,
-    0.339701,
-    0.338722,
-    0.337743,
-    0.336763,
-    0.335783,
-    0.334803,
-    0.333824,
-    0.332846,
-    0.331868,
-    0.330892,
-    0.329917,
-    0.328943,
-    0.32797,
-    0.326997,
-    0.326025,
-    0.325053,
-    0.32408,
-    0.323107,
-    0.322133,
-    0.321158,
-    0.320182,
-    0.319205,
-    0.318227,
-    0.317248,
-    0.316269,
-    0.315289,
-    0.314309,
-    0.313329,
-    0.31235,
-    0.311372,
-    0.310394,
-    0.309418,
-    0.308442,
-    0.307468,
-    0.306494,
-    0.305522,
-    0.304549,
-    0.303577,
-    0.302604,
-    0.301631,
-    0.300658,
-    0.299683,
-    0.298707,
-    0.29773,
-    0.296753,
-    0.295774,
-    0.294795,
-    0.293815,
-    0.292835,
-    0.291855,
-    0.290876,
-    0.289898,
-    0.28892,
-    0.287943,
-    0.286967,
-    0.285993,
-    0.285019,
-    0.284046,
-    0.283073,
-    0.282101,
-    0.281129,
-    0.280156,
-    0.279182,
-    0.278208,
-    0.277232,
-    0.276256,
-    0.275278,
-    0.2743,
-    0.273321,
-    0.272341,
-    0.271361,
-    0.270382,
-    0.269402,
-    0.268424,
-    0.267446,
-    0.266469,
-    0.265493,
-    0.264518,
-    0.263544,
-    0.262571,
-    0.261598,
-    0.260625,
-    0.259653,
-    0.25868,
-    0.257707,
-    0.256732,
-    0.255757,
-    0.254781,
-    0.253804,
-    0.252826,
-    0.251847,
-    0.250867,
-    0.249888,
-    0.248908,
-    0.247928,
-    0.24695,
-    0.245971,
-    0.244994,
-    0.244018,
-    0.243043,
-    0.242069,
-    0.241095,
-    0.240122,
-    0.23915,
-    0.238177,
-    0.237204,
-    0.236231,
-    0.235257,
-    0.234282,
-    0.233306,
-    0.232329,
-    0.231351,
-    0.230373,
-    0.229394,
-    0.228414,
-    0.227434,
-    0.226455,
-    0.225476,
-    0.224497,
-    0.22352,
-    0.222543,
-    0.221568,
-    0.220593,
-    0.21962,
-    0.218647,
-    0.217674,
-    0.216702,
-    0.215729,
-    0.214756,
-    0.213782,
-    0.212807,
-    0.211831,
-    0.210855,
-    0.209877,
-    0.208899,
-    0.20792,
-    0.20694,
-    0.20596,
-    0.204981,
-    0.204002,
-    0.203023,
-    0.202046,
-    0.201069,
-    0.200093,
-    0.199118,
-    0.198144,
-    0.197171,
-    0.196198,
-    0.195226,
-    0.194253,
-    0.19328,
-    0.192306,
-    0.191332,
-    0.190357,
-    0.18938,
-    0.188403,
-    0.187425,
-    0.186446,
-    0.185466,
-    0.184487,
-    0.183507,
-    0.182528,
-    0.181549,
-    0.180571,
-    0.179594,
-    0.178618,
-    0.177643,
-    0.176669,
-    0.175696,
-    0.174723,
-    0.17375,
-    0.172778,
-    0.171805,
-    0.170831,
-    0.169857,
-    0.168882,
-    0.167905,
-    0.166928,
-    0.16595,
-    0.164972,
-    0.163992,
-    0.163013,
-    0.162033,
-    0.161054,
-    0.160075,
-    0.159097,
-    0.15812,
-    0.157144,
-    0.156168,
-    0.155194,
-    0.15422,
-    0.153247,
-    0.152275,
-    0.151302,
-    0.150329,
-    0.149356,
-    0.148382,
-    0.147407,
-    0.146431,
-    0.145454,
-    0.144476,
-    0.143498,
-    0.142518,
-    0.141539,
-    0.140559,
-    0.13958,
-    0.138601,
-    0.137623,
-    0.136645,
-    0.135669,
-    0.134693,
-    0.133719,
-    0.132745,
-    0.131772,
-    0.130799,
-    0.129826,
-    0.128853,
-    0.12788,
-    0.126906,
-    0.125932,
-    0.124956,
-    0.123979,
-    0.123002,
-    0.122024,
-    0.121045,
-    0.120065,
-    0.119086,
-    0.118106,
-    0.117127,
-    0.116149,
-    0.115171,
-    0.114194,
-    0.113219,
-    0.112244,
-    0.11127,
-    0.110296,
-    0.109323,
-    0.108351,
-    0.107378,
-    0.106405,
-    0.105431,
-    0.104457,
-    0.103481,
-    0.102505,
-    0.101528,
-    0.100549,
-    0.0995706,
-    0.0985913,
-    0.0976118,
-    0.0966323,
-    0.0956531,
-    0.0946745,
-    0.0936967,
-    0.0927197,
-    0.0917437,
-    0.0907686,
-    0.0897944,
-    0.0888209,
-    0.0878479,
-    0.0868751,
-    0.0859023,
-    0.0849293,
-    0.0839557,
-    0.0829815,
-    0.0820063,
-    0.0810302,
-    0.0800532,
-    0.0790752,
-    0.0780966,
-    0.0771174,
-    0.0761379,
-    0.0751584,
-    0.0741792,
-    0.0732004,
-    0.0722224,
-    0.0712452,
-    0.0702689,
-    0.0692936,
-    0.0683191,
-    0.0673455,
-    0.0663723,
-    0.0653995,
-    0.0644268,
-    0.0634538,
-    0.0624804,
-    0.0615063,
-    0.0605314,
-    0.0595555,
-    0.0585787,
-    0.057601,
-    0.0566226,
-    0.0556435,
-    0.0546641,
-    0.0536846,
-    0.0527053,
-    0.0517264,
-    0.0507481,
-    0.0497707,
-    0.0487942,
-    0.0478186,
-    0.0468439,
-    0.0458701,
-    0.0448968,
-    0.0439239,
-    0.0429512,
-    0.0419783,
-    0.041005,
-    0.0400311,
-    0.0390564,
-    0.0380808,
-    0.0371042,
-    0.0361268,
-    0.0351485,
-    0.0341696,
-    0.0331903,
-    0.0322108,
-    0.0312314,
-    0.0302523,
-    0.0292739,
-    0.0282963,
-    0.0273195,
-    0.0263437,
-    0.0253688,
-    0.0243947,
-    0.0234213,
-    0.0224484,
-    0.0214756,
-    0.0205028,
-    0.0195296,
-    0.0185559,
-    0.0175814,
-    0.016606,
-    0.0156297,
-    0.0146525,
-    0.0136744,
-    0.0126956,
-    0.0117164,
-    0.0107369,
-    0.00975748,
-    0.00877834,
-    0.00779974,
-    0.00682187,
-    0.00584487,
-    0.0048688,
-    0.00389368,
-    0.00291941,
-    0.00194585,
-    0.000972791
-};
-
-// Top frequency: 44.1K * 0.00725624
-constexpr static std::array<float, 4096> wt_triangle_0x4 =
-{
-    0,
-    -0.000969392,
-    -0.00193892,
-    -0.00290871,
-    -0.00387889,
-    -0.00484958,
-    -0.00582089,
-    -0.00679291,
-    -0.00776573,
-    -0.0087394,
-    -0.00971399,
-    -0.0106895,
-    -0.011666,
-    -0.0126434,
-    -0.0136218,
-    -0.014601,
-    -0.015581,
-    -0.0165618,
-    -0.0175432,
-    -0.0185251,
-    -0.0195075,
-    -0.0204902,
-    -0.021473,
-    -0.0224559,
-    -0.0234386,
-    -0.0244212,
-    -0.0254034,
-    -0.0263851,
-    -0.0273662,
-    -0.0283466,
-    -0.0293262,
-    -0.030305,
-    -0.0312829,
-    -0.0322599,
-    -0.0332359,
-    -0.034211,
-    -0.0351851,
-    -0.0361584,
-    -0.0371308,
-    -0.0381025,
-    -0.0390734,
-    -0.0400439,
-    -0.0410138,
-    -0.0419835,
-    -0.0429529,
-    -0.0439222,
-    -0.0448917,
-    -0.0458613,
-    -0.0468312,
-    -0.0478016,
-    -0.0487726,
-    -0.0497442,
-    -0.0507166,
-    -0.0516898,
-    -0.0526639,
-    -0.053639,
-    -0.054615,
-    -0.0555919,
-    -0.0565698,
-    -0.0575485,
-    -0.0585282,
-    -0.0595086,
-    -0.0604897,
-    -0.0614714,
-    -0.0624536,
-    -0.0634362,
-    -0.0644189,
-    -0.0654019,
-    -0.0663847,
-    -0.0673674,
-    -0.0683498,
-    -0.0693318,
-    -0.0703133,
-    -0.0712941,
-    -0.0722742,
-    -0.0732535,
-    -0.0742318,
-    -0.0752093,
-    -0.0761858,
-    -0.0771614,
-    -0.078136,
-    -0.0791097,
-    -0.0800825,
-    -0.0810545,
-    -0.0820258,
-    -0.0829964,
-    -0.0839666,
-    -0.0849363,
-    -0.0859058,
-    -0.0868751,
-    -0.0878445,
-    -0.0888139,
-    -0.0897836,
-    -0.0907537,
-    -0.0917244,
-    -0.0926956,
-    -0.0936675,
-    -0.0946403,
-    -0.0956139,
-    -0.0965885,
-    -0.0975639,
-    -0.0985404,
-    -0.0995178,
-    -0.100496,
-    -0.101475,
-    -0.102455,
-    -0.103436,
-    -0.104418,
-    -0.1054,
-    -0.106382,
-    -0.107365,
-    -0.108348,
-    -0.109331,
-    -0.110314,
-    -0.111296,
-    -0.112279,
-    -0.11326,
-    -0.114242,
-    -0.115222,
-    -0.116202,
-    -0.117181,
-    -0.118159,
-    -0.119136,
-    -0.120112,
-    -0.121087,
-    -0.122061,
-    -0.123034,
-    -0.124007,
-    -0.124978,
-    -0.125949,
-    -0.126919,
-    -0.127889,
-    -0.128859,
-    -0.129828,
-    -0.130797,
-    -0.131767,
-    -0.132736,
-    -0.133706,
-    -0.134676,
-    -0.135647,
-    -0.136619,
-    -0.137591,
-    -0.138564,
-    -0.139538,
-    -0.140513,
-    -0.141489,
-    -0.142466,
-    -0.143444,
-    -0.144423,
-    -0.145402,
-    -0.146383,
-    -0.147364,
-    -0.148346,
-    -0.149328,
-    -0.150311,
-    -0.151294,
-    -0.152277,
-    -0.15326,
-    -0.154243,
-    -0.155225,
-    -0.156207,
-    -0.157189,
-    -0.15817,
-    -0.15915,
-    -0.16013,
-    -0.161108,
-    -0.162086,
-    -0.163062,
-    -0.164038,
-    -0.165012,
-    -0.165986,
-    -0.166959,
-    -0.167931,
-    -0.168902,
-    -0.169872,
-    -0.170842,
-    -0.171812,
-    -0.172781,
-    -0.17375,
-    -0.174719,
-    -0.175689,
-    -0.176658,
-    -0.177628,
-    -0.178599,
-    -0.17957,
-    -0.180541,
-    -0.181514,
-    -0.182488,
-    -0.183462,
-    -0.184437,
-    -0.185414,
-    -0.186391,
-    -0.18737,
-    -0.188349,
-    -0.189329,
-    -0.19031,
-    -0.191292,
-    -0.192274,
-    -0.193256,
-    -0.194239,
-    -0.195223,
-    -0.196206,
-    -0.197189,
-    -0.198172,
-    -0.199154,
-    -0.200136,
-    -0.201118,
-    -0.202098,
-    -0.203078,
-    -0.204057,
-    -0.205035,
-    -0.206012,
-    -0.206988,
-    -0.207964,
-    -0.208938,
-    -0.209911,
-    -0.210883,
-    -0.211855,
-    -0.212825,
-    -0.213795,
-    -0.214765,
-    -0.215734,
-    -0.216703,
-    -0.217672,
-    -0.218641,
-    -0.219611,
-    -0.22058,
-    -0.22155,
-    -0.222521,
-    -0.223492,
-    -0.224464,
-    -0.225437,
-    -0.226411,
-    -0.227386,
-    -0.228362,
-    -0.229339,
-    -0.230317,
-    -0.231296,
-    -0.232275,
-    -0.233256,
-    -0.234237,
-    -0.235219,
-    -0.236202,
-    -0.237185,
-    -0.238168,
-    -0.239152,
-    -0.240135,
-    -0.241118,
-    -0.242101,
-    -0.243083,
-    -0.244065,
-    -0.245047,
-    -0.246027,
-    -0.247007,
-    -0.247985,
-    -0.248963,
-    -0.249939,
-    -0.250915,
-    -0.25189,
-    -0.252863,
-    -0.253836,
-    -0.254807,
-    -0.255778,
-    -0.256749,
-    -0.257718,
-    -0.258688,
-    -0.259657,
-    -0.260625,
-    -0.261594,
-    -0.262563,
-    -0.263532,
-    -0.264502,
-    -0.265472,
-    -0.266443,
-    -0.267414,
-    -0.268387,
-    -0.26936,
-    -0.270334,
-    -0.27131,
-    -0.272286,
-    -0.273264,
-    -0.274242,
-    -0.275222,
-    -0.276202,
-    -0.277183,
-    -0.278165,
-    -0.279147,
-    -0.28013,
-    -0.281114,
-    -0.282097,
-    -0.283081,
-    -0.284064,
-    -0.285048,
-    -0.286031,
-    -0.287013,
-    -0.287995,
-    -0.288976,
-    -0.289956,
-    -0.290935,
-    -0.291913,
-    -0.29289,
-    -0.293866,
-    -0.294841,
-    -0.295815,
-    -0.296788,
-    -0.297761,
-    -0.298732,
-    -0.299702,
-    -0.300672,
-    -0.301641,
-    -0.30261,
-    -0.303579,
-    -0.304547,
-    -0.305516,
-    -0.306485,
-    -0.307454,
-    -0.308423,
-    -0.309394,
-    -0.310365,
-    -0.311336,
-    -0.312309,
-    -0.313283,
-    -0.314258,
-    -0.315234,
-    -0.31621,
-    -0.317189,
-    -0.318168,
-    -0.319148,
-    -0.320128,
-    -0.32111,
-    -0.322093,
-    -0.323076,
-    -0.324059,
-    -0.325043,
-    -0.326027,
-    -0.32701,
-    -0.327994,
-    -0.328977,
-    -0.32996,
-    -0.330943,
-    -0.331924,
-    -0.332905,
-    -0.333885,
-    -0.334864,
-    -0.335841,
-    -0.336818,
-    -0.337794,
-    -0.338768,
-    -0.339741,
-    -0.340714,
-    -0.341685,
-    -0.342656,
-    -0.343626,
-    -0.344595,
-    -0.345564,
-    -0.346532,
-    -0.347501,
-    -0.348469,
-    -0.349437,
-    -0.350406,
-    -0.351375,
-    -0.352345,
-    -0.353315,
-    -0.354286,
-    -0.355258,
-    -0.356231,
-    -0.357205,
-    -0.358181,
-    -0.359157,
-    -0.360135,
-    -0.361113,
-    -0.362093,
-    -0.363074,
-    -0.364055,
-    -0.365037,
-    -0.36602,
-    -0.367004,
-    -0.367988,
-    -0.368972,
-    -0.369956,
-    -0.37094,
-    -0.371924,
-    -0.372908,
-    -0.37389,
-    -0.374873,
-    -0.375854,
-    -0.376835,
-    -0.377814,
-    -0.378792,
-    -0.37977,
-    -0.380746,
-    -0.381721,
-    -0.382695,
-    -0.383667,
-    -0.384639,
-    -0.38561,
-    -0.38658,
-    -0.387549,
-    -0.388518,
-    -0.389486,
-    -0.390454,
-    -0.391422,
-    -0.39239,
-    -0.393358,
-    -0.394327,
-    -0.395296,
-    -0.396265,
-    -0.397236,
-    -0.398207,
-    -0.39918,
-    -0.400153,
-    -0.401128,
-    -0.402104,
-    -0.403081,
-    -0.404059,
-    -0.405038,
-    -0.406018,
-    -0.407,
-    -0.407982,
-    -0.408965,
-    -0.409948,
-    -0.410933,
-    -0.411917,
-    -0.412902,
-    -0.413886,
-    -0.414871,
-    -0.415855,
-    -0.416838,
-    -0.417821,
-    -0.418803,
-    -0.419784,
-    -0.420765,
-    -0.421744,
-    -0.422722,
-    -0.423698,
-    -0.424674,
-    -0.425648,
-    -0.426621,
-    -0.427594,
-    -0.428565,
-    -0.429535,
-    -0.430504,
-    -0.431473,
-    -0.432441,
-    -0.433408,
-    -0.434376,
-    -0.435343,
-    -0.436311,
-    -0.437279,
-    -0.438247,
-    -0.439216,
-    -0.440186,
-    -0.441156,
-    -0.442128,
-    -0.443101,
-    -0.444075,
-    -0.44505,
-    -0.446026,
-    -0.447004,
-    -0.447983,
-    -0.448963,
-    -0.449944,
-    -0.450926,
-    -0.451909,
-    -0.452893,
-    -0.453877,
-    -0.454862,
-    -0.455847,
-    -0.456832,
-    -0.457817,
-    -0.458801,
-    -0.459786,
-    -0.460769,
-    -0.461752,
-    -0.462734,
-    -0.463715,
-    -0.464695,
-    -0.465674,
-    -0.466651,
-    -0.467627,
-    -0.468602,
-    -0.469576,
-    -0.470548,
-    -0.47152,
-    -0.47249,
-    -0.473459,
-    -0.474428,
-    -0.475395,
-    -0.476363,
-    -0.47733,
-    -0.478297,
-    -0.479264,
-    -0.480231,
-    -0.481198,
-    -0.482167,
-    -0.483136,
-    -0.484105,
-    -0.485076,
-    -0.486048,
-    -0.487021,
-    -0.487996,
-    -0.488971,
-    -0.489948,
-    -0.490927,
-    -0.491906,
-    -0.492887,
-    -0.493869,
-    -0.494852,
-    -0.495836,
-    -0.496821,
-    -0.497806,
-    -0.498791,
-    -0.499777,
-    -0.500762,
-    -0.501748,
-    -0.502733,
-    -0.503717,
-    -0.504701,
-    -0.505684,
-    -0.506666,
-    -0.507647,
-    -0.508626,
-    -0.509604,
-    -0.510581,
-    -0.511557,
-    -0.512531,
-    -0.513504,
-    -0.514475,
-    -0.515446,
-    -0.516415,
-    -0.517383,
-    -0.518351,
-    -0.519318,
-    -0.520285,
-    -0.521251,
-    -0.522217,
-    -0.523184,
-    -0.52415,
-    -0.525118,
-    -0.526085,
-    -0.527054,
-    -0.528024,
-    -0.528995,
-    -0.529967,
-    -0.530941,
-    -0.531916,
-    -0.532892,
-    -0.53387,
-    -0.534849,
-    -0.53583,
-    -0.536812,
-    -0.537795,
-    -0.538779,
-    -0.539763,
-    -0.540749,
-    -0.541735,
-    -0.542721,
-    -0.543707,
-    -0.544694,
-    -0.54568,
-    -0.546665,
-    -0.54765,
-    -0.548634,
-    -0.549617,
-    -0.550599,
-    -0.551579,
-    -0.552558,
-    -0.553536,
-    -0.554512,
-    -0.555487,
-    -0.55646,
-    -0.557432,
-    -0.558403,
-    -0.559372,
-    -0.56034,
-    -0.561308,
-    -0.562274,
-    -0.56324,
-    -0.564206,
-    -0.565171,
-    -0.566137,
-    -0.567102,
-    -0.568069,
-    -0.569035,
-    -0.570003,
-    -0.570972,
-    -0.571942,
-    -0.572913,
-    -0.573886,
-    -0.57486,
-    -0.575835,
-    -0.576813,
-    -0.577791,
-    -0.578772,
-    -0.579753,
-    -0.580736,
-    -0.58172,
-    -0.582705,
-    -0.583691,
-    -0.584678,
-    -0.585665,
-    -0.586652,
-    -0.587639,
-    -0.588626,
-    -0.589613,
-    -0.590599,
-    -0.591584,
-    -0.592568,
-    -0.593551,
-    -0.594533,
-    -0.595513,
-    -0.596491,
-    -0.597468,
-    -0.598444,
-    -0.599418,
-    -0.60039,
-    -0.601361,
-    -0.60233,
-    -0.603298,
-    -0.604265,
-    -0.605231,
-    -0.606197,
-    -0.607161,
-    -0.608126,
-    -0.60909,
-    -0.610055,
-    -0.61102,
-    -0.611986,
-    -0.612952,
-    -0.613919,
-    -0.614888,
-    -0.615858,
-    -0.61683,
-    -0.617803,
-    -0.618777,
-    -0.619754,
-    -0.620732,
-    -0.621712,
-    -0.622693,
-    -0.623676,
-    -0.62466,
-    -0.625646,
-    -0.626632,
-    -0.627619,
-    -0.628607,
-    -0.629596,
-    -0.630584,
-    -0.631572,
-    -0.63256,
-    -0.633548,
-    -0.634534,
-    -0.63552,
-    -0.636504,
-    -0.637487,
-    -0.638468,
-    -0.639448,
-    -0.640426,
-    -0.641402,
-    -0.642377,
-    -0.64335,
-    -0.644321,
-    -0.64529,
-    -0.646258,
-    -0.647225,
-    -0.64819,
-    -0.649155,
-    -0.650118,
-    -0.651082,
-    -0.652045,
-    -0.653008,
-    -0.653972,
-    -0.654936,
-    -0.655901,
-    -0.656866,
-    -0.657834,
-    -0.658802,
-    -0.659772,
-    -0.660744,
-    -0.661718,
-    -0.662693,
-    -0.663671,
-    -0.66465,
-    -0.665631,
-    -0.666614,
-    -0.667598,
-    -0.668584,
-    -0.669571,
-    -0.670559,
-    -0.671548,
-    -0.672538,
-    -0.673528,
-    -0.674518,
-    -0.675507,
-    -0.676496,
-    -0.677485,
-    -0.678472,
-    -0.679458,
-    -0.680442,
-    -0.681425,
-    -0.682406,
-    -0.683386,
-    -0.684363,
-    -0.685338,
-    -0.686312,
-    -0.687283,
-    -0.688252,
-    -0.68922,
-    -0.690186,
-    -0.691151,
-    -0.692114,
-    -0.693077,
-    -0.694039,
-    -0.695001,
-    -0.695962,
-    -0.696924,
-    -0.697886,
-    -0.698849,
-    -0.699813,
-    -0.700778,
-    -0.701745,
-    -0.702713,
-    -0.703683,
-    -0.704656,
-    -0.70563,
-    -0.706607,
-    -0.707585,
-    -0.708566,
-    -0.709549,
-    -0.710533,
-    -0.71152,
-    -0.712508,
-    -0.713497,
-    -0.714487,
-    -0.715478,
-    -0.71647,
-    -0.717462,
-    -0.718454,
-    -0.719445,
-    -0.720435,
-    -0.721425,
-    -0.722413,
-    -0.7234,
-    -0.724385,
-    -0.725367,
-    -0.726348,
-    -0.727327,
-    -0.728303,
-    -0.729277,
-    -0.730249,
-    -0.731218,
-    -0.732186,
-    -0.733151,
-    -0.734115,
-    -0.735077,
-    -0.736038,
-    -0.736998,
-    -0.737958,
-    -0.738917,
-    -0.739877,
-    -0.740836,
-    -0.741797,
-    -0.742758,
-    -0.743721,
-    -0.744685,
-    -0.745651,
-    -0.74662,
-    -0.74759,
-    -0.748563,
-    -0.749538,
-    -0.750516,
-    -0.751496,
-    -0.752479,
-    -0.753464,
-    -0.754451,
-    -0.75544,
-    -0.756431,
-    -0.757423,
-    -0.758416,
-    -0.75941,
-    -0.760405,
-    -0.761399,
-    -0.762393,
-    -0.763387,
-    -0.764379,
-    -0.76537,
-    -0.76636,
-    -0.767347,
-    -0.768332,
-    -0.769315,
-    -0.770296,
-    -0.771273,
-    -0.772248,
-    -0.77322,
-    -0.77419,
-    -0.775157,
-    -0.776122,
-    -0.777084,
-    -0.778045,
-    -0.779004,
-    -0.779961,
-    -0.780918,
-    -0.781874,
-    -0.78283,
-    -0.783786,
-    -0.784743,
-    -0.785701,
-    -0.786661,
-    -0.787622,
-    -0.788585,
-    -0.78955,
-    -0.790518,
-    -0.791489,
-    -0.792463,
-    -0.79344,
-    -0.79442,
-    -0.795402,
-    -0.796388,
-    -0.797376,
-    -0.798367,
-    -0.799359,
-    -0.800354,
-    -0.80135,
-    -0.802348,
-    -0.803346,
-    -0.804344,
-    -0.805342,
-    -0.80634,
-    -0.807337,
-    -0.808332,
-    -0.809325,
-    -0.810316,
-    -0.811305,
-    -0.81229,
-    -0.813273,
-    -0.814252,
-    -0.815229,
-    -0.816202,
-    -0.817171,
-    -0.818138,
-    -0.819101,
-    -0.820061,
-    -0.821019,
-    -0.821975,
-    -0.822929,
-    -0.823882,
-    -0.824834,
-    -0.825785,
-    -0.826736,
-    -0.827688,
-    -0.828641,
-    -0.829595,
-    -0.830551,
-    -0.83151,
-    -0.832472,
-    -0.833436,
-    -0.834404,
-    -0.835376,
-    -0.836351,
-    -0.83733,
-    -0.838312,
-    -0.839299,
-    -0.840289,
-    -0.841282,
-    -0.842278,
-    -0.843276,
-    -0.844277,
-    -0.84528,
-    -0.846283,
-    -0.847288,
-    -0.848292,
-    -0.849296,
-    -0.850299,
-    -0.851301,
-    -0.8523,
-    -0.853297,
-    -0.85429,
-    -0.85528,
-    -0.856267,
-    -0.857249,
-    -0.858227,
-    -0.859201,
-    -0.86017,
-    -0.861136,
-    -0.862097,
-    -0.863054,
-    -0.864008,
-    -0.864959,
-    -0.865907,
-    -0.866853,
-    -0.867797,
-    -0.86874,
-    -0.869684,
-    -0.870627,
-    -0.871572,
-    -0.872518,
-    -0.873466,
-    -0.874418,
-    -0.875373,
-    -0.876332,
-    -0.877295,
-    -0.878263,
-    -0.879235,
-    -0.880213,
-    -0.881196,
-    -0.882184,
-    -0.883177,
-    -0.884174,
-    -0.885176,
-    -0.886182,
-    -0.887191,
-    -0.888202,
-    -0.889216,
-    -0.890231,
-    -0.891247,
-    -0.892262,
-    -0.893276,
-    -0.894289,
-    -0.895298,
-    -0.896305,
-    -0.897307,
-    -0.898305,
-    -0.899298,
-    -0.900285,
-    -0.901266,
-    -0.902242,
-    -0.90321,
-    -0.904173,
-    -0.90513,
-    -0.906081,
-    -0.907026,
-    -0.907967,
-    -0.908903,
-    -0.909836,
-    -0.910766,
-    -0.911694,
-    -0.912621,
-    -0.913549,
-    -0.914477,
-    -0.915407,
-    -0.916341,
-    -0.917278,
-    -0.91822,
-    -0.919168,
-    -0.920122,
-    -0.921083,
-    -0.922052,
-    -0.923028,
-    -0.924013,
-    -0.925005,
-    -0.926005,
-    -0.927013,
-    -0.928028,
-    -0.92905,
-    -0.930077,
-    -0.931109,
-    -0.932145,
-    -0.933184,
-    -0.934225,
-    -0.935265,
-    -0.936305,
-    -0.937342,
-    -0.938376,
-    -0.939405,
-    -0.940427,
-    -0.941442,
-    -0.942448,
-    -0.943445,
-    -0.944432,
-    -0.945408,
-    -0.946373,
-    -0.947327,
-    -0.94827,
-    -0.949202,
-    -0.950123,
-    -0.951035,
-    -0.951938,
-    -0.952834,
-    -0.953723,
-    -0.954608,
-    -0.95549,
-    -0.956372,
-    -0.957254,
-    -0.958139,
-    -0.95903,
-    -0.959928,
-    -0.960835,
-    -0.961753,
-    -0.962684,
-    -0.96363,
-    -0.964592,
-    -0.965571,
-    -0.966569,
-    -0.967585,
-    -0.96862,
-    -0.969674,
-    -0.970747,
-    -0.971837,
-    -0.972943,
-    -0.974063,
-    -0.975195,
-    -0.976337,
-    -0.977485,
-    -0.978635,
-    -0.979785,
-    -0.980929,
-    -0.982064,
-    -0.983184,
-    -0.984284,
-    -0.98536,
-    -0.986405,
-    -0.987415,
-    -0.988385,
-    -0.989308,
-    -0.99018,
-    -0.990996,
-    -0.99175,
-    -0.992438,
-    -0.993056,
-    -0.9936,
-    -0.994066,
-    -0.994452,
-    -0.994755,
-    -0.994972,
-    -0.995103,
-    -0.995147,
-    -0.995103,
-    -0.994972,
-    -0.994755,
-    -0.994452,
-    -0.994066,
-    -0.9936,
-    -0.993056,
-    -0.992438,
-    -0.99175,
-    -0.990996,
-    -0.99018,
-    -0.989308,
-    -0.988385,
-    -0.987415,
-    -0.986405,
-    -0.98536,
-    -0.984284,
-    -0.983184,
-    -0.982064,
-    -0.980929,
-    -0.979785,
-    -0.978635,
-    -0.977485,
-    -0.976337,
-    -0.975195,
-    -0.974063,
-    -0.972943,
-    -0.971837,
-    -0.970747,
-    -0.969674,
-    -0.96862,
-    -0.967585,
-    -0.966569,
-    -0.965571,
-    -0.964592,
-    -0.96363,
-    -0.962684,
-    -0.961753,
-    -0.960835,
-    -0.959928,
-    -0.95903,
-    -0.958139,
-    -0.957254,
-    -0.956372,
-    -0.95549,
-    -0.954608,
-    -0.953723,
-    -0.952834,
-    -0.951938,
-    -0.951035,
-    -0.950123,
-    -0.949202,
-    -0.94827,
-    -0.947327,
-    -0.946373,
-    -0.945408,
-    -0.944432,
-    -0.943445,
-    -0.942448,
-    -0.941442,
-    -0.940427,
-    -0.939405,
-    -0.938376,
-    -0.937342,
-    -0.936305,
-    -0.935265,
-    -0.934225,
-    -0.933184,
-    -0.932145,
-    -0.931109,
-    -0.930077,
-    -0.92905,
-    -0.928028,
-    -0.927013,
-    -0.926005,
-    -0.925005,
-    -0.924013,
-    -0.923028,
-    -0.922052,
-    -0.921083,
-    -0.920122,
-    -0.919168,
-    -0.91822,
-    -0.917278,
-    -0.916341,
-    -0.915407,
-    -0.914477,
-    -0.913549,
-    -0.912621,
-    -0.911694,
-    -0.910766,
-    -0.909836,
-    -0.908903,
-    -0.907967,
-    -0.907026,
-    -0.906081,
-    -0.90513,
-    -0.904173,
-    -0.90321,
-    -0.902242,
-    -0.901266,
-    -0.900285,
-    -0.899298,
-    -0.898305,
-    -0.897307,
-    -0.896305,
-    -0.895298,
-    -0.894289,
-    -0.893276,
-    -0.892262,
-    -0.891247,
-    -0.890231,
-    -0.889216,
-    -0.888202,
-    -0.887191,
-    -0.886182,
-    -0.885176,
-    -0.884174,
-    -0.883177,
-    -0.882184,
-    -0.881196,
-    -0.880213,
-    -0.879235,
-    -0.878263,
-    -0.877295,
-    -0.876332,
-    -0.875373,
-    -0.874418,
-    -0.873466,
-    -0.872518,
-    -0.871572,
-    -0.870627,
-    -0.869684,
-    -0.86874,
-    -0.867797,
-    -0.866853,
-    -0.865907,
-    -0.864959,
-    -0.864008,
-    -0.863054,
-    -0.862097,
-    -0.861136,
-    -0.86017,
-    -0.859201,
-    -0.858227,
-    -0.857249,
-    -0.856267,
-    -0.85528,
-    -0.85429,
-    -0.853297,
-    -0.8523,
-    -0.851301,
-    -0.850299,
-    -0.849296,
-    -0.848292,
-    -0.847288,
-    -0.846283,
-    -0.84528,
-    -0.844277,
-    -0.843276,
-    -0.842278,
-    -0.841282,
-    -0.840289,
-    -0.839299,
-    -0.838312,
-    -0.83733,
-    -0.836351,
-    -0.835376,
-    -0.834404,
-    -0.833436,
-    -0.832472,
-    -0.83151,
-    -0.830551,
-    -0.829595,
-    -0.828641,
-    -0.827688,
-    -0.826736,
-    -0.825785,
-    -0.824834,
-    -0.823882,
-    -0.822929,
-    -0.821975,
-    -0.821019,
-    -0.820061,
-    -0.819101,
-    -0.818138,
-    -0.817171,
-    -0.816202,
-    -0.815229,
-    -0.814252,
-    -0.813273,
-    -0.81229,
-    -0.811305,
-    -0.810316,
-    -0.809325,
-    -0.808332,
-    -0.807337,
-    -0.80634,
-    -0.805342,
-    -0.804344,
-    -0.803346,
-    -0.802348,
-    -0.80135,
-    -0.800354,
-    -0.799359,
-    -0.798367,
-    -0.797376,
-    -0.796388,
-    -0.795402,
-    -0.79442,
-    -0.79344,
-    -0.792463,
-    -0.791489,
-    -0.790518,
-    -0.78955,
-    -0.788585,
-    -0.787622,
-    -0.786661,
-    -0.785701,
-    -0.784743,
-    -0.783786,
-    -0.78283,
-    -0.781874,
-    -0.780918,
-    -0.779961,
-    -0.779004,
-    -0.778045,
-    -0.777084,
-    -0.776122,
-    -0.775157,
-    -0.77419,
-    -0.77322,
-    -0.772248,
-    -0.771273,
-    -0.770296,
-    -0.769315,
-    -0.768332,
-    -0.767347,
-    -0.76636,
-    -0.76537,
-    -0.764379,
-    -0.763387,
-    -0.762393,
-    -0.761399,
-    -0.760405,
-    -0.75941,
-    -0.758416,
-    -0.757423,
-    -0.756431,
-    -0.75544,
-    -0.754451,
-    -0.753464,
-    -0.752479,
-    -0.751496,
-    -0.750516,
-    -0.749538,
-    -0.748563,
-    -0.74759,
-    -0.74662,
-    -0.745651,
-    -0.744685,
-    -0.743721,
-    -0.742758,
-    -0.741797,
-    -0.740836,
-    -0.739877,
-    -0.738917,
-    -0.737958,
-    -0.736998,
-    -0.736038,
-    -0.735077,
-    -0.734115,
-    -0.733151,
-    -0.732186,
-    -0.731218,
-    -0.730249,
-    -0.729277,
-    -0.728303,
-    -0.727327,
-    -0.726348,
-    -0.725367,
-    -0.724385,
-    -0.7234,
-    -0.722413,
-    -0.721425,
-    -0.720435,
-    -0.719445,
-    -0.718454,
-    -0.717462,
-    -0.71647,
-    -0.715478,
-    -0.714487,
-    -0.713497,
-    -0.712508,
-    -0.71152,
-    -0.710533,
-    -0.709549,
-    -0.708566,
-    -0.707585,
-    -0.706607,
-    -0.70563,
-    -0.704656,
-    -0.703683,
-    -0.702713,
-    -0.701745,
-    -0.700778,
-    -0.699813,
-    -0.698849,
-    -0.697886,
-    -0.696924,
-    -0.695962,
-    -0.695001,
-    -0.694039,
-    -0.693077,
-    -0.692114,
-    -0.691151,
-    -0.690186,
-    -0.68922,
-    -0.688252,
-    -0.687283,
-    -0.686312,
-    -0.685338,
-    -0.684363,
-    -0.683386,
-    -0.682406,
-    -0.681425,
-    -0.680442,
-    -0.679458,
-    -0.678472,
-    -0.677485,
-    -0.676496,
-    -0.675507,
-    -0.674518,
-    -0.673528,
-    -0.672538,
-    -0.671548,
-    -0.670559,
-    -0.669571,
-    -0.668584,
-    -0.667598,
-    -0.666614,
-    -0.665631,
-    -0.66465,
-    -0.663671,
-    -0.662693,
-    -0.661718,
-    -0.660744,
-    -0.659772,
-    -0.658802,
-    -0.657834,
-    -0.656866,
-    -0.655901,
-    -0.654936,
-    -0.653972,
-    -0.653008,
-    -0.652045,
-    -0.651082,
-    -0.650118,
-    -0.649155,
-    -0.64819,
-    -0.647225,
-    -0.646258,
-    -0.64529,
-    -0.644321,
-    -0.64335,
-    -0.642377,
-    -0.641402,
-    -0.640426,
-    -0.639448,
-    -0.638468,
-    -0.637487,
-    -0.636504,
-    -0.63552,
-    -0.634534,
-    -0.633548,
-    -0.63256,
-    -0.631572,
-    -0.630584,
-    -0.629596,
-    -0.628607,
-    -0.627619,
-    -0.626632,
-    -0.625646,
-    -0.62466,
-    -0.623676,
-    -0.622693,
-    -0.621712,
-    -0.620732,
-    -0.619754,
-    -0.618777,
-    -0.617803,
-    -0.61683,
-    -0.615858,
-    -0.614888,
-    -0.613919,
-    -0.612952,
-    -0.611986,
-    -0.61102,
-    -0.610055,
-    -0.60909,
-    -0.608126,
-    -0.607161,
-    -0.606197,
-    -0.605231,
-    -0.604265,
-    -0.603298,
-    -0.60233,
-    -0.601361,
-    -0.60039,
-    -0.599418,
-    -0.598444,
-    -0.597468,
-    -0.596491,
-    -0.595513,
-    -0.594533,
-    -0.593551,
-    -0.592568,
-    -0.591584,
-    -0.590599,
-    -0.589613,
-    -0.588626,
-    -0.587639,
-    -0.586652,
-    -0.585665,
-    -0.584678,
-    -0.583691,
-    -0.582705,
-    -0.58172,
-    -0.580736,
-    -0.579753,
-    -0.578772,
-    -0.577791,
-    -0.576813,
-    -0.575835,
-    -0.57486,
-    -0.573886,
-    -0.572913,
-    -0.571942,
-    -0.570972,
-    -0.570003,
-    -0.569035,
-    -0.568069,
-    -0.567102,
-    -0.566137,
-    -0.565171,
-    -0.564206,
-    -0.56324,
-    -0.562274,
-    -0.561308,
-    -0.56034,
-    -0.559372,
-    -0.558403,
-    -0.557432,
-    -0.55646,
-    -0.555487,
-    -0.554512,
-    -0.553536,
-    -0.552558,
-    -0.551579,
-    -0.550599,
-    -0.549617,
-    -0.548634,
-    -0.54765,
-    -0.546665,
-    -0.54568,
-    -0.544694,
-    -0.543707,
-    -0.542721,
-    -0.541735,
-    -0.540749,
-    -0.539763,
-    -0.538779,
-    -0.537795,
-    -0.536812,
-    -0.53583,
-    -0.534849,
-    -0.53387,
-    -0.532892,
-    -0.531916,
-    -0.530941,
-    -0.529967,
-    -0.528995,
-    -0.528024,
-    -0.527054,
-    -0.526085,
-    -0.525118,
-    -0.52415,
-    -0.523184,
-    -0.522217,
-    -0.521251,
-    -0.520285,
-    -0.519318,
-    -0.518351,
-    -0.517383,
-    -0.516415,
-    -0.515446,
-    -0.514475,
-    -0.513504,
-    -0.512531,
-    -0.511557,
-    -0.510581,
-    -0.509604,
-    -0.508626,
-    -0.507647,
-    -0.506666,
-    -0.505684,
-    -0.504701,
-    -0.503717,
-    -0.502733,
-    -0.501748,
-    -0.500762,
-    -0.499777,
-    -0.498791,
-    -0.497806,
-    -0.496821,
-    -0.495836,
-    -0.494852,
-    -0.493869,
-    -0.492887,
-    -0.491906,
-    -0.490927,
-    -0.489948,
-    -0.488971,
-    -0.487996,
-    -0.487021,
-    -0.486048,
-    -0.485076,
-    -0.484105,
-    -0.483136,
-    -0.482167,
-    -0.481198,
-    -0.480231,
-    -0.479264,
-    -0.478297,
-    -0.47733,
-    -0.476363,
-    -0.475395,
-    -0.474428,
-    -0.473459,
-    -0.47249,
-    -0.47152,
-    -0.470548,
-    -0.469576,
-    -0.468602,
-    -0.467627,
-    -0.466651,
-    -0.465674,
-    -0.464695,
-    -0.463715,
-    -0.462734,
-    -0.461752,
-    -0.460769,
-    -0.459786,
-    -0.458801,
-    -0.457817,
-    -0.456832,
-    -0.455847,
-    -0.454862,
-    -0.453877,
-    -0.452893,
-    -0.451909,
-    -0.450926,
-    -0.449944,
-    -0.448963,
-    -0.447983,
-    -0.447004,
-    -0.446026,
-    -0.44505,
-    -0.444075,
-    -0.443101,
-    -0.442128,
-    -0.441156,
-    -0.440186,
-    -0.439216,
-    -0.438247,
-    -0.437279,
-    -0.436311,
-    -0.435343,
-    -0.434376,
-    -0.433408,
-    -0.432441,
-    -0.431473,
-    -0.430504,
-    -0.429535,
-    -0.428565,
-    -0.427594,
-    -0.426621,
-    -0.425648,
-    -0.424674,
-    -0.423698,
-    -0.422722,
-    -0.421744,
-    -0.420765,
-    -0.419784,
-    -0.418803,
-    -0.417821,
-    -0.416838,
-    -0.415855,
-    -0.414871,
-    -0.413886,
-    -0.412902,
-    -0.411917,
-    -0.410933,
-    -0.409948,
-    -0.408965,
-    -0.407982,
-    -0.407,
-    -0.406018,
-    -0.405038,
-    -0.404059,
-    -0.403081,
-    -0.402104,
-    -0.401128,
-    -0.400153,
-    -0.39918,
-    -0.398207,
-    -0.397236,
-    -0.396265,
-    -0.395296,
-    -0.394327,
-    -0.393358,
-    -0.39239,
-    -0.391422,
-    -0.390454,
-    -0.389486,
-    -0.388518,
-    -0.387549,
-    -0.38658,
-    -0.38561,
-    -0.384639,
-    -0.383667,
-    -0.382695,
-    -0.381721,
-    -0.380746,
-    -0.37977,
-    -0.378792,
-    -0.377814,
-    -0.376835,
-    -0.375854,
-    -0.374873,
-    -0.37389,
-    -0.372908,
-    -0.371924,
-    -0.37094,
-    -0.369956,
-    -0.368972,
-    -0.367988,
-    -0.367004,
-    -0.36602,
-    -0.365037,
-    -0.364055,
-    -0.363074,
-    -0.362093,
-    -0.361113,
-    -0.360135,
-    -0.359157,
-    -0.358181,
-    -0.357205,
-    -0.356231,
-    -0.355258,
-    -0.354286,
-    -0.353315,
-    -0.352345,
-    -0.351375,
-    -0.350406,
-    -0.349437,
-    -0.348469,
-    -0.347501,
-    -0.346532,
-    -0.345564,
-    -0.344595,
-    -0.343626,
-    -0.342656,
-    -0.341685,
-    -0.340714,
-    -0.339741,
-    -0.338768,
-    -0.337794,
-    -0.336818,
-    -0.335841,
-    -0.334864,
-    -0.333885,
-    -0.332905,
-    -0.331924,
-    -0.330943,
-    -0.32996,
-    -0.328977,
-    -0.327994,
-    -0.32701,
-    -0.326027,
-    -0.325043,
-    -0.324059,
-    -0.323076,
-    -0.322093,
-    -0.32111,
-    -0.320128,
-    -0.319148,
-    -0.318168,
-    -0.317189,
-    -0.31621,
-    -0.315234,
-    -0.314258,
-    -0.313283,
-    -0.312309,
-    -0.311336,
-    -0.310365,
-    -0.309394,
-    -0.308423,
-    -0.307454,
-    -0.306485,
-    -0.305516,
-    -0.304547,
-    -0.303579,
-    -0.30261,
-    -0.301641,
-    -0.300672,
-    -0.299702,
-    -0.298732,
-    -0.297761,
-    -0.296788,
-    -0.295815,
-    -0.294841,
-    -0.293866,
-    -0.29289,
-    -0.291913,
-    -0.290935,
-    -0.289956,
-    -0.288976,
-    -0.287995,
-    -0.287013,
-    -0.286031,
-    -0.285048,
-    -0.284064,
-    -0.283081,
-    -0.282097,
-    -0.281114,
-    -0.28013,
-    -0.279147,
-    -0.278165,
-    -0.277183,
-    -0.276202,
-    -0.275222,
-    -0.274242,
-    -0.273264,
-    -0.272286,
-    -0.27131,
-    -0.270334,
-    -0.26936,
-    -0.268387,
-    -0.267414,
-    -0.266443,
-    -0.265472,
-    -0.264502,
-    -0.263532,
-    -0.262563,
-    -0.261594,
-    -0.260625,
-    -0.259657,
-    -0.258688,
-    -0.257718,
-    -0.256749,
-    -0.255778,
-    -0.254807,
-    -0.253836,
-    -0.252863,
-    -0.25189,
-    -0.250915,
-    -0.249939,
-    -0.248963,
-    -0.247985,
-    -0.247007,
-    -0.246027,
-    -0.245047,
-    -0.244065,
-    -0.243083,
-    -0.242101,
-    -0.241118,
-    -0.240135,
-    -0.239152,
-    -0.238168,
-    -0.237185,
-    -0.236202,
-    -0.235219,
-    -0.234237,
-    -0.233256,
-    -0.232275,
-    -0.231296,
-    -0.230317,
-    -0.229339,
-    -0.228362,
-    -0.227386,
-    -0.226411,
-    -0.225437,
-    -0.224464,
-    -0.223492,
-    -0.222521,
-    -0.22155,
-    -0.22058,
-    -0.219611,
-    -0.218641,
-    -0.217672,
-    -0.216703,
-    -0.215734,
-    -0.214765,
-    -0.213795,
-    -0.212825,
-    -0.211855,
-    -0.210883,
-    -0.209911,
-    -0.208938,
-    -0.207964,
-    -0.206988,
-    -0.206012,
-    -0.205035,
-    -0.204057,
-    -0.203078,
-    -0.202098,
-    -0.201118,
-    -0.200136,
-    -0.199154,
-    -0.198172,
-    -0.197189,
-    -0.196206,
-    -0.195223,
-    -0.194239,
-    -0.193256,
-    -0.192274,
-    -0.191292,
-    -0.19031,
-    -0.189329,
-    -0.188349,
-    -0.18737,
-    -0.186391,
-    -0.185414,
-    -0.184437,
-    -0.183462,
-    -0.182488,
-    -0.181514,
-    -0.180541,
-    -0.17957,
-    -0.178599,
-    -0.177628,
-    -0.176658,
-    -0.175689,
-    -0.174719,
-    -0.17375,
-    -0.172781,
-    -0.171812,
-    -0.170842,
-    -0.169872,
-    -0.168902,
-    -0.167931,
-    -0.166959,
-    -0.165986,
-    -0.165012,
-    -0.164038,
-    -0.163062,
-    -0.162086,
-    -0.161108,
-    -0.16013,
-    -0.15915,
-    -0.15817,
-    -0.157189,
-    -0.156207,
-    -0.155225,
-    -0.154243,
-    -0.15326,
-    -0.152277,
-    -0.151294,
-    -0.150311,
-    -0.149328,
-    -0.148346,
-    -0.147364,
-    -0.146383,
-    -0.145402,
-    -0.144423,
-    -0.143444,
-    -0.142466,
-    -0.141489,
-    -0.140513,
-    -0.139538,
-    -0.138564,
-    -0.137591,
-    -0.136619,
-    -0.135647,
-    -0.134676,
-    -0.133706,
-    -0.132736,
-    -0.131767,
-    -0.130797,
-    -0.129828,
-    -0.128859,
-    -0.127889,
-    -0.126919,
-    -0.125949,
-    -0.124978,
-    -0.124007,
-    -0.123034,
-    -0.122061,
-    -0.121087,
-    -0.120112,
-    -0.119136,
-    -0.118159,
-    -0.117181,
-    -0.116202,
-    -0.115222,
-    -0.114242,
-    -0.11326,
-    -0.112279,
-    -0.111296,
-    -0.110314,
-    -0.109331,
-    -0.108348,
-    -0.107365,
-    -0.106382,
-    -0.1054,
-    -0.104418,
-    -0.103436,
-    -0.102455,
-    -0.101475,
-    -0.100496,
-    -0.0995178,
-    -0.0985404,
-    -0.0975639,
-    -0.0965885,
-    -0.0956139,
-    -0.0946403,
-    -0.0936675,
-    -0.0926956,
-    -0.0917244,
-    -0.0907537,
-    -0.0897836,
-    -0.0888139,
-    -0.0878445,
-    -0.0868751,
-    -0.0859058,
-    -0.0849363,
-    -0.0839666,
-    -0.0829964,
-    -0.0820258,
-    -0.0810545,
-    -0.0800825,
-    -0.0791097,
-    -0.078136,
-    -0.0771614,
-    -0.0761858,
-    -0.0752093,
-    -0.0742318,
-    -0.0732535,
-    -0.0722742,
-    -0.0712941,
-    -0.0703133,
-    -0.0693318,
-    -0.0683498,
-    -0.0673674,
-    -0.0663847,
-    -0.0654019,
-    -0.0644189,
-    -0.0634362,
-    -0.0624536,
-    -0.0614714,
-    -0.0604897,
-    -0.0595086,
-    -0.0585282,
-    -0.0575485,
-    -0.0565698,
-    -0.0555919,
-    -0.054615,
-    -0.053639,
-    -0.0526639,
-    -0.0516898,
-    -0.0507166,
-    -0.0497442,
-    -0.0487726,
-    -0.0478016,
-    -0.0468312,
-    -0.0458613,
-    -0.0448917,
-    -0.0439222,
-    -0.0429529,
-    -0.0419835,
-    -0.0410138,
-    -0.0400439,
-    -0.0390734,
-    -0.0381025,
-    -0.0371308,
-    -0.0361584,
-    -0.0351851,
-    -0.034211,
-    -0.0332359,
-    -0.0322599,
-    -0.0312829,
-    -0.030305,
-    -0.0293262,
-    -0.0283466,
-    -0.0273662,
-    -0.0263851,
-    -0.0254034,
-    -0.0244212,
-    -0.0234386,
-    -0.0224559,
-    -0.021473,
-    -0.0204902,
-    -0.0195075,
-    -0.0185251,
-    -0.0175432,
-    -0.0165618,
-    -0.015581,
-    -0.014601,
-    -0.0136218,
-    -0.0126434,
-    -0.011666,
-    -0.0106895,
-    -0.00971399,
-    -0.0087394,
-    -0.00776573,
-    -0.00679291,
-    -0.00582089,
-    -0.00484958,
-    -0.00387889,
-    -0.00290871,
-    -0.00193892,
-    -0.000969392,
-    0,
-    0.000969392,
-    0.00193892,
-    0.00290871,
-    0.00387889,
-    0.00484958,
-    0.00582089,
-    0.00679291,
-    0.00776573,
-    0.0087394,
-    0.00971399,
-    0.0106895,
-    0.011666,
-    0.0126434,
-    0.0136218,
-    0.014601,
-    0.015581,
-    0.0165618,
-    0.0175432,
-    0.0185251,
-    0.0195075,
-    0.0204902,
-    0.021473,
-    0.0224559,
-    0.0234386,
-    0.0244212,
-    0.0254034,
-    0.0263851,
-    0.0273662,
-    0.0283466,
-    0.0293262,
-    0.030305,
-    0.0312829,
-    0.0322599,
-    0.0332359,
-    0.034211,
-    0.0351851,
-    0.0361584,
-    0.0371308,
-    0.0381025,
-    0.0390734,
-    0.0400439,
-    0.0410138,
-    0.0419835,
-    0.0429529,
-    0.0439222,
-    0.0448917,
-    0.0458613,
-    0.0468312,
-    0.0478016,
-    0.0487726,
-    0.0497442,
-    0.0507166,
-    0.0516898,
-    0.0526639,
-    0.053639,
-    0.054615,
-    0.0555919,
-    0.0565698,
-    0.0575485,
-    0.0585282,
-    0.0595086,
-    0.0604897,
-    0.0614714,
-    0.0624536,
-    0.0634362,
-    0.0644189,
-    0.0654019,
-    0.0663847,
-    0.0673674,
-    0.0683498,
-    0.0693318,
-    0.0703133,
-    0.0712941,
-    0.0722742,
-    0.0732535,
-    0.0742318,
-    0.0752093,
-    0.0761858,
-    0.0771614,
-    0.078136,
-    0.0791097,
-    0.0800825,
-    0.0810545,
-    0.0820258,
-    0.0829964,
-    0.0839666,
-    0.0849363,
-    0.0859058,
-    0.0868751,
-    0.0878445,
-    0.0888139,
-    0.0897836,
-    0.0907537,
-    0.0917244,
-    0.0926956,
-    0.0936675,
-    0.0946403,
-    0.0956139,
-    0.0965885,
-    0.0975639,
-    0.0985404,
-    0.0995178,
-    0.100496,
-    0.101475,
-    0.102455,
-    0.103436,
-    0.104418,
-    0.1054,
-    0.106382,
-    0.107365,
-    0.108348,
-    0.109331,
-    0.110314,
-    0.111296,
-    0.112279,
-    0.11326,
-    0.114242,
-    0.115222,
-    0.116202,
-    0.117181,
-    0.118159,
-    0.119136,
-    0.120112,
-    0.121087,
-    0.122061,
-    0.123034,
-    0.124007,
-    0.124978,
-    0.125949,
-    0.126919,
-    0.127889,
-    0.128859,
-    0.129828,
-    0.130797,
-    0.131767,
-    0.132736,
-    0.133706,
-    0.134676,
-    0.135647,
-    0.136619,
-    0.137591,
-    0.138564,
-    0.139538,
-    0.140513,
-    0.141489,
-    0.142466,
-    0.143444,
-    0.144423,
-    0.145402,
-    0.146383,
-    0.147364,
-    0.148346,
-    0.149328,
-    0.150311,
-    0.151294,
-    0.152277,
-    0.15326,
-    0.154243,
-    0.155225,
-    0.156207,
-    0.157189,
-    0.15817,
-    0.15915,
-    0.16013,
-    0.161108,
-    0.162086,
-    0.163062,
-    0.164038,
-    0.165012,
-    0.165986,
-    0.166959,
-    0.167931,
-    0.168902,
-    0.169872,
-    0.170842,
-    0.171812,
-    0.172781,
-    0.17375,
-    0.174719,
-    0.175689,
-    0.176658,
-    0.177628,
-    0.178599,
-    0.17957,
-    0.180541,
-    0.181514,
-    0.182488,
-    0.183462,
-    0.184437,
-    0.185414,
-    0.186391,
-    0.18737,
-    0.188349,
-    0.189329,
-    0.19031,
-    0.191292,
-    0.192274,
-    0.193256,
-    0.194239,
-    0.195223,
-    0.196206,
-    0.197189,
-    0.198172,
-    0.199154,
-    0.200136,
-    0.201118,
-    0.202098,
-    0.203078,
-    0.204057,
-    0.205035,
-    0.206012,
-    0.206988,
-    0.207964,
-    0.208938,
-    0.209911,
-    0.210883,
-    0.211855,
-    0.212825,
-    0.213795,
-    0.214765,
-    0.215734,
-    0.216703,
-    0.217672,
-    0.218641,
-    0.219611,
-    0.22058,
-    0.22155,
-    0.222521,
-    0.223492,
-    0.224464,
-    0.225437,
-    0.226411,
-    0.227386,
-    0.228362,
-    0.229339,
-    0.230317,
-    0.231296,
-    0.232275,
-    0.233256,
-    0.234237,
-    0.235219,
-    0.236202,
-    0.237185,
-    0.238168,
-    0.239152,
-    0.240135,
-    0.241118,
-    0.242101,
-    0.243083,
-    0.244065,
-    0.245047,
-    0.246027,
-    0.247007,
-    0.247985,
-    0.248963,
-    0.249939,
-    0.250915,
-    0.25189,
-    0.252863,
-    0.253836,
-    0.254807,
-    0.255778,
-    0.256749,
-    0.257718,
-    0.258688,
-    0.259657,
-    0.260625,
-    0.261594,
-    0.262563,
-    0.263532,
-    0.264502,
-    0.265472,
-    0.266443,
-    0.267414,
-    0.268387,
-    0.26936,
-    0.270334,
-    0.27131,
-    0.272286,
-    0.273264,
-    0.274242,
-    0.275222,
-    0.276202,
-    0.277183,
-    0.278165,
-    0.279147,
-    0.28013,
-    0.281114,
-    0.282097,
-    0.283081,
-    0.284064,
-    0.285048,
-    0.286031,
-    0.287013,
-    0.287995,
-    0.288976,
-    0.289956,
-    0.290935,
-    0.291913,
-    0.29289,
-    0.293866,
-    0.294841,
-    0.295815,
-    0.296788,
-    0.297761,
-    0.298732,
-    0.299702,
-    0.300672,
-    0.301641,
-    0.30261,
-    0.303579,
-    0.304547,
-    0.305516,
-    0.306485,
-    0.307454,
-    0.308423,
-    0.309394,
-    0.310365,
-    0.311336,
-    0.312309,
-    0.313283,
-    0.314258,
-    0.315234,
-    0.31621,
-    0.317189,
-    0.318168,
-    0.319148,
-    0.320128,
-    0.32111,
-    0.322093,
-    0.323076,
-    0.324059,
-    0.325043,
-    0.326027,
-    0.32701,
-    0.327994,
-    0.328977,
-    0.32996,
-    0.330943,
-    0.331924,
-    0.332905,
-    0.333885,
-    0.334864,
-    0.335841,
-    0.336818,
-    0.337794,
-    0.338768,
-    0.339741,
-    0.340714,
-    0.341685,
-    0.342656,
-    0.343626,
-    0.344595,
-    0.345564,
-    0.346532,
-    0.347501,
-    0.348469,
-    0.349437,
-    0.350406,
-    0.351375,
-    0.352345,
-    0.353315,
-    0.354286,
-    0.355258,
-    0.356231,
-    0.357205,
-    0.358181,
-    0.359157,
-    0.360135,
-    0.361113,
-    0.362093,
-    0.363074,
-    0.364055,
-    0.365037,
-    0.36602,
-    0.367004,
-    0.367988,
-    0.368972,
-    0.369956,
-    0.37094,
-    0.371924,
-    0.372908,
-    0.37389,
-    0.374873,
-    0.375854,
-    0.376835,
-    0.377814,
-    0.378792,
-    0.37977,
-    0.380746,
-    0.381721,
-    0.382695,
-    0.383667,
-    0.384639,
-    0.38561,
-    0.38658,
-    0.387549,
-    0.388518,
-    0.389486,
-    0.390454,
-    0.391422,
-    0.39239,
-    0.393358,
-    0.394327,
-    0.395296,
-    0.396265,
-    0.397236,
-    0.398207,
-    0.39918,
-    0.400153,
-    0.401128,
-    0.402104,
-    0.403081,
-    0.404059,
-    0.405038,
-    0.406018,
-    0.407,
-    0.407982,
-    0.408965,
-    0.409948,
-    0.410933,
-    0.411917,
-    0.412902,
-    0.413886,
-    0.414871,
-    0.415855,
-    0.416838,
-    0.417821,
-    0.418803,
-    0.419784,
-    0.420765,
-    0.421744,
-    0.422722,
-    0.423698,
-    0.424674,
-    0.425648,
-    0.426621,
-    0.427594,
-    0.428565,
-    0.429535,
-    0.430504,
-    0.431473,
-    0.432441,
-    0.433408,
-    0.434376,
-    0.435343,
-    0.436311,
-    0.437279,
-    0.438247,
-    0.439216,
-    0.440186,
-    0.441156,
-    0.442128,
-    0.443101,
-    0.444075,
-    0.44505,
-    0.446026,
-    0.447004,
-    0.447983,
-    0.448963,
-    0.449944,
-    0.450926,
-    0.451909,
-    0.452893,
-    0.453877,
-    0.454862,
-    0.455847,
-    0.456832,
-    0.457817,
-    0.458801,
-    0.459786,
-    0.460769,
-    0.461752,
-    0.462734,
-    0.463715,
-    0.464695,
-    0.465674,
-    0.466651,
-    0.467627,
-    0.468602,
-    0.469576,
-    0.470548,
-    0.47152,
-    0.47249,
-    0.473459,
-    0.474428,
-    0.475395,
-    0.476363,
-    0.47733,
-    0.478297,
-    0.479264,
-    0.480231,
-    0.481198,
-    0.482167,
-    0.483136,
-    0.484105,
-    0.485076,
-    0.486048,
-    0.487021,
-    0.487996,
-    0.488971,
-    0.489948,
-    0.490927,
-    0.491906,
-    0.492887,
-    0.493869,
-    0.494852,
-    0.495836,
-    0.496821,
-    0.497806,
-    0.498791,
-    0.499777,
-    0.500762,
-    0.501748,
-    0.502733,
-    0.503717,
-    0.504701,
-    0.505684,
-    0.506666,
-    0.507647,
-    0.508626,
-    0.509604,
-    0.510581,
-    0.511557,
-    0.512531,
-    0.513504,
-    0.514475,
-    0.515446,
-    0.516415,
-    0.517383,
-    0.518351,
-    0.519318,
-    0.520285,
-    0.521251,
-    0.522217,
-    0.523184,
-    0.52415,
-    0.525118,
-    0.526085,
-    0.527054,
-    0.528024,
-    0.528995,
-    0.529967,
-    0.530941,
-    0.531916,
-    0.532892,
-    0.53387,
-    0.534849,
-    0.53583,
-    0.536812,
-    0.537795,
-    0.538779,
-    0.539763,
-    0.540749,
-    0.541735,
-    0.542721,
-    0.543707,
-    0.544694,
-    0.54568,
-    0.546665,
-    0.54765,
-    0.548634,
-    0.549617,
-    0.550599,
-    0.551579,
-    0.552558,
-    0.553536,
-    0.554512,
-    0.555487,
-    0.55646,
-    0.557432,
-    0.558403,
-    0.559372,
-    0.56034,
-    0.561308,
-    0.562274,
-    0.56324,
-    0.564206,
-    0.565171,
-    0.566137,
-    0.567102,
-    0.568069,
-    0.569035,
-    0.570003,
-    0.570972,
-    0.571942,
-    0.572913,
-    0.573886,
-    0.57486,
-    0.575835,
-    0.576813,
-    0.577791,
-    0.578772,
-    0.579753,
-    0.580736,
-    0.58172,
-    0.582705,
-    0.583691,
-    0.584678,
-    0.585665,
-    0.586652,
-    0.587639,
-    0.588626,
-    0.589613,
-    0.590599,
-    0.591584,
-    0.592568,
-    0.593551,
-    0.594533,
-    0.595513,
-    0.596491,
-    0.597468,
-    0.598444,
-    0.599418,
-    0.60039,
-    0.601361,
-    0.60233,
-    0.603298,
-    0.604265,
-    0.605231,
-    0.606197,
-    0.607161,
-    0.608126,
-    0.60909,
-    0.610055,
-    0.61102,
-    0.611986,
-    0.612952,
-    0.613919,
-    0.614888,
-    0.615858,
-    0.61683,
-    0.617803,
-    0.618777,
-    0.619754,
-    0.620732,
-    0.621712,
-    0.622693,
-    0.623676,
-    0.62466,
-    0.625646,
-    0.626632,
-    0.627619,
-    0.628607,
-    0.629596,
-    0.630584,
-    0.631572,
-    0.63256,
-    0.633548,
-    0.634534,
-    0.63552,
-    0.636504,
-    0.637487,
-    0.638468,
-    0.639448,
-    0.640426,
-    0.641402,
-    0.642377,
-    0.64335,
-    0.644321,
-    0.64529,
-    0.646258,
-    0.647225,
-    0.64819,
-    0.649155,
-    0.650118,
-    0.651082,
-    0.652045,
-    0.653008,
-    0.653972,
-    0.654936,
-    0.655901,
-    0.656866,
-    0.657834,
-    0.658802,
-    0.659772,
-    0.660744,
-    0.661718,
-    0.662693,
-    0.663671,
-    0.66465,
-    0.665631,
-    0.666614,
-    0.667598,
-    0.668584,
-    0.669571,
-    0.670559,
-    0.671548,
-    0.672538,
-    0.673528,
-    0.674518,
-    0.675507,
-    0.676496,
-    0.677485,
-    0.678472,
-    0.679458,
-    0.680442,
-    0.681425,
-    0.682406,
-    0.683386,
-    0.684363,
-    0.685338,
-    0.686312,
-    0.687283,
-    0.688252,
-    0.68922,
-    0.690186,
-    0.691151,
-    0.692114,
-    0.693077,
-    0.694039,
-    0.695001,
-    0.695962,
-    0.696924,
-    0.697886,
-    0.698849,
-    0.699813,
-    0.700778,
-    0.701745,
-    0.702713,
-    0.703683,
-    0.704656,
-    0.70563,
-    0.706607,
-    0.707585,
-    0.708566,
-    0.709549,
-    0.710533,
-    0.71152,
-    0.712508,
-    0.713497,
-    0.714487,
-    0.715478,
-    0.71647,
-    0.717462,
-    0.718454,
-    0.719445,
-    0.720435,
-    0.721425,
-    0.722413,
-    0.7234,
-    0.724385,
-    0.725367,
-    0.726348,
-    0.727327,
-    0.728303,
-    0.729277,
-    0.730249,
-    0.731218,
-    0.732186,
-    0.733151,
-    0.734115,
-    0.735077,
-    0.736038,
-    0.736998,
-    0.737958,
-    0.738917,
-    0.739877,
-    0.740836,
-    0.741797,
-    0.742758,
-    0.743721,
-    0.744685,
-    0.745651,
-    0.74662,
-    0.74759,
-    0.748563,
-    0.749538,
-    0.750516,
-    0.751496,
-    0.752479,
-    0.753464,
-    0.754451,
-    0.75544,
-    0.756431,
-    0.757423,
-    0.758416,
-    0.75941,
-    0.760405,
-    0.761399,
-    0.762393,
-    0.763387,
-    0.764379,
-    0.76537,
-    0.76636,
-    0.767347,
-    0.768332,
-    0.769315,
-    0.770296,
-    0.771273,
-    0.772248,
-    0.77322,
-    0.77419,
-    0.775157,
-    0.776122,
-    0.777084,
-    0.778045,
-    0.779004,
-    0.779961,
-    0.780918,
-    0.781874,
-    0.78283,
-    0.783786,
-    0.784743,
-    0.785701,
-    0.786661,
-    0.787622,
-    0.788585,
-    0.78955,
-    0.790518,
-    0.791489,
-    0.792463,
-    0.79344,
-    0.79442,
-    0.795402,
-    0.796388,
-    0.797376,
-    0.798367,
-    0.799359,
-    0.800354,
-    0.80135,
-    0.802348,
-    0.803346,
-    0.804344,
-    0.805342,
-    0.80634,
-    0.807337,
-    0.808332,
-    0.809325,
-    0.810316,
-    0.811305,
-    0.81229,
-    0.813273,
-    0.814252,
-    0.815229,
-    0.816202,
-    0.817171,
-    0.818138,
-    0.819101,
-    0.820061,
-    0.821019,
-    0.821975,
-    0.822929,
-    0.823882,
-    0.824834,
-    0.825785,
-    0.826736,
-    0.827688,
-    0.828641,
-    0.829595,
-    0.830551,
-    0.83151,
-    0.832472,
-    0.833436,
-    0.834404,
-    0.835376,
-    0.836351,
-    0.83733,
-    0.838312,
-    0.839299,
-    0.840289,
-    0.841282,
-    0.842278,
-    0.843276,
-    0.844277,
-    0.84528,
-    0.846283,
-    0.847288,
-    0.848292,
-    0.849296,
-    0.850299,
-    0.851301,
-    0.8523,
-    0.853297,
-    0.85429,
-    0.85528,
-    0.856267,
-    0.857249,
-    0.858227,
-    0.859201,
-    0.86017,
-    0.861136,
-    0.862097,
-    0.863054,
-    0.864008,
-    0.864959,
-    0.865907,
-    0.866853,
-    0.867797,
-    0.86874,
-    0.869684,
-    0.870627,
-    0.871572,
-    0.872518,
-    0.873466,
-    0.874418,
-    0.875373,
-    0.876332,
-    0.877295,
-    0.878263,
-    0.879235,
-    0.880213,
-    0.881196,
-    0.882184,
-    0.883177,
-    0.884174,
-    0.885176,
-    0.886182,
-    0.887191,
-    0.888202,
-    0.889216,
-    0.890231,
-    0.891247,
-    0.892262,
-    0.893276,
-    0.894289,
-    0.895298,
-    0.896305,
-    0.897307,
-    0.898305,
-    0.899298,
-    0.900285,
-    0.901266,
-    0.902242,
-    0.90321,
-    0.904173,
-    0.90513,
-    0.906081,
-    0.907026,
-    0.907967,
-    0.908903,
-    0.909836,
-    0.910766,
-    0.911694,
-    0.912621,
-    0.913549,
-    0.914477,
-    0.915407,
-    0.916341,
-    0.917278,
-    0.91822,
-    0.919168,
-    0.920122,
-    0.921083,
-    0.922052,
-    0.923028,
-    0.924013,
-    0.925005,
-    0.926005,
-    0.927013,
-    0.928028,
-    0.92905,
-    0.930077,
-    0.931109,
-    0.932145,
-    0.933184,
-    0.934225,
-    0.935265,
-    0.936305,
-    0.937342,
-    0.938376,
-    0.939405,
-    0.940427,
-    0.941442,
-    0.942448,
-    0.943445,
-    0.944432,
-    0.945408,
-    0.946373,
-    0.947327,
-    0.94827,
-    0.949202,
-    0.950123,
-    0.951035,
-    0.951938,
-    0.952834,
-    0.953723,
-    0.954608,
-    0.95549,
-    0.956372,
-    0.957254,
-    0.958139,
-    0.95903,
-    0.959928,
-    0.960835,
-    0.961753,
-    0.962684,
-    0.96363,
-    0.964592,
-    0.965571,
-    0.966569,
-    0.967585,
-    0.96862,
-    0.969674,
-    0.970747,
-    0.971837,
-    0.972943,
-    0.974063,
-    0.975195,
-    0.976337,
-    0.977485,
-    0.978635,
-    0.979785,
-    0.980929,
-    0.982064,
-    0.983184,
-    0.984284,
-    0.98536,
-    0.986405,
-    0.987415,
-    0.988385,
-    0.989308,
-    0.99018,
-    0.990996,
-    0.99175,
-    0.992438,
-    0.993056,
-    0.9936,
-    0.994066,
-    0.994452,
-    0.994755,
-    0.994972,
-    0.995103,
-    0.995147,
-    0.995103,
-    0.994972,
-    0.994755,
-    0.994452,
-    0.994066,
-    0.9936,
-    0.993056,
-    0.992438,
-    0.99175,
-    0.990996,
-    0.99018,
-    0.989308,
-    0.988385,
-    0.987415,
-    0.986405,
-    0.98536,
-    0.984284,
-    0.983184,
-    0.982064,
-    0.980929,
-    0.979785,
-    0.978635,
-    0.977485,
-    0.976337,
-    0.975195,
-    0.974063,
-    0.972943,
-    0.971837,
-    0.970747,
-    0.969674,
-    0.96862,
-    0.967585,
-    0.966569,
-    0.965571,
-    0.964592,
-    0.96363,
-    0.962684,
-    0.961753,
-    0.960835,
-    0.959928,
-    0.95903,
-    0.958139,
-    0.957254,
-    0.956372,
-    0.95549,
-    0.954608,
-    0.953723,
-    0.952834,
-    0.951938,
-    0.951035,
-    0.950123,
-    0.949202,
-    0.94827,
-    0.947327,
-    0.946373,
-    0.945408,
-    0.944432,
-    0.943445,
-    0.942448,
-    0.941442,
-    0.940427,
-    0.939405,
-    0.938376,
-    0.937342,
-    0.936305,
-    0.935265,
-    0.934225,
-    0.933184,
-    0.932145,
-    0.931109,
-    0.930077,
-    0.92905,
-    0.928028,
-    0.927013,
-    0.926005,
-    0.925005,
-    0.924013,
-    0.923028,
-    0.922052,
-    0.921083,
-    0.920122,
-    0.919168,
-    0.91822,
-    0.917278,
-    0.916341,
-    0.915407,
-    0.914477,
-    0.913549,
-    0.912621,
-    0.911694,
-    0.910766,
-    0.909836,
-    0.908903,
-    0.907967,
-    0.907026,
-    0.906081,
-    0.90513,
-    0.904173,
-    0.90321,
-    0.902242,
-    0.901266,
-    0.900285,
-    0.899298,
-    0.898305,
-    0.897307,
-    0.896305,
-    0.895298,
-    0.894289,
-    0.893276,
-    0.892262,
-    0.891247,
-    0.890231,
-    0.889216,
-    0.888202,
-    0.887191,
-    0.886182,
-    0.885176,
-    0.884174,
-    0.883177,
-    0.882184,
-    0.881196,
-    0.880213,
-    0.879235,
-    0.878263,
-    0.877295,
-    0.876332,
-    0.875373,
-    0.874418,
-    0.873466,
-    0.872518,
-    0.871572,
-    0.870627,
-    0.869684,
-    0.86874,
-    0.867797,
-    0.866853,
-    0.865907,
-    0.864959,
-    0.864008,
-    0.863054,
-    0.862097,
-    0.861136,
-    0.86017,
-    0.859201,
-    0.858227,
-    0.857249,
-    0.856267,
-    0.85528,
-    0.85429,
-    0.853297,
-    0.8523,
-    0.851301,
-    0.850299,
-    0.849296,
-    0.848292,
-    0.847288,
-    0.846283,
-    0.84528,
-    0.844277,
-    0.843276,
-    0.842278,
-    0.841282,
-    0.840289,
-    0.839299,
-    0.838312,
-    0.83733,
-    0.836351,
-    0.835376,
-    0.834404,
-    0.833436,
-    0.832472,
-    0.83151,
-    0.830551,
-    0.829595,
-    0.828641,
-    0.827688,
-    0.826736,
-    0.825785,
-    0.824834,
-    0.823882,
-    0.822929,
-    0.821975,
-    0.821019,
-    0.820061,
-    0.819101,
-    0.818138,
-    0.817171,
-    0.816202,
-    0.815229,
-    0.814252,
-    0.813273,
-    0.81229,
-    0.811305,
-    0.810316,
-    0.809325,
-    0.808332,
-    0.807337,
-    0.80634,
-    0.805342,
-    0.804344,
-    0.803346,
-    0.802348,
-    0.80135,
-    0.800354,
-    0.799359,
-    0.798367,
-    0.797376,
-    0.796388,
-    0.795402,
-    0.79442,
-    0.79344,
-    0.792463,
-    0.791489,
-    0.790518,
-    0.78955,
-    0.788585,
-    0.787622,
-    0.786661,
-    0.785701,
-    0.784743,
-    0.783786,
-    0.78283,
-    0.781874,
-    0.780918,
-    0.779961,
-    0.779004,
-    0.778045,
-    0.777084,
-    0.776122,
-    0.775157,
-    0.77419,
-    0.77322,
-    0.772248,
-    0.771273,
-    0.770296,
-    0.769315,
-    0.768332,
-    0.767347,
-    0.76636,
-    0.76537,
-    0.764379,
-    0.763387,
-    0.762393,
-    0.761399,
-    0.760405,
-    0.75941,
-    0.758416,
-    0.757423,
-    0.756431,
-    0.75544,
-    0.754451,
-    0.753464,
-    0.752479,
-    0.751496,
-    0.750516,
-    0.749538,
-    0.748563,
-    0.74759,
-    0.74662,
-    0.745651,
-    0.744685,
-    0.743721,
-    0.742758,
-    0.741797,
-    0.740836,
-    0.739877,
-    0.738917,
-    0.737958,
-    0.736998,
-    0.736038,
-    0.735077,
-    0.734115,
-    0.733151,
-    0.732186,
-    0.731218,
-    0.730249,
-    0.729277,
-    0.728303,
-    0.727327,
-    0.726348,
-    0.725367,
-    0.724385,
-    0.7234,
-    0.722413,
-    0.721425,
-    0.720435,
-    0.719445,
-    0.718454,
-    0.717462,
-    0.71647,
-    0.715478,
-    0.714487,
-    0.713497,
-    0.712508,
-    0.71152,
-    0.710533,
-    0.709549,
-    0.708566,
-    0.707585,
-    0.706607,
-    0.70563,
-    0.704656,
-    0.703683,
-    0.702713,
-    0.701745,
-    0.700778,
-    0.699813,
-    0.698849,
-    0.697886,
-    0.696924,
-    0.695962,
-    0.695001,
-    0.694039,
-    0.693077,
-    0.692114,
-    0.691151,
-    0.690186,
-    0.68922,
-    0.688252,
-    0.687283,
-    0.686312,
-    0.685338,
-    0.684363,
-    0.683386,
-    0.682406,
-    0.681425,
-    0.680442,
-    0.679458,
-    0.678472,
-    0.677485,
-    0.676496,
-    0.675507,
-    0.674518,
-    0.673528,
-    0.672538,
-    0.671548,
-    0.670559,
-    0.669571,
-    0.668584,
-    0.667598,
-    0.666614,
-    0.665631,
-    0.66465,
-    0.663671,
-    0.662693,
-    0.661718,
-    0.660744,
-    0.659772,
-    0.658802,
-    0.657834,
-    0.656866,
-    0.655901,
-    0.654936,
-    0.653972,
-    0.653008,
-    0.652045,
-    0.651082,
-    0.650118,
-    0.649155,
-    0.64819,
-    0.647225,
-    0.646258,
-    0.64529,
-    0.644321,
-    0.64335,
-    0.642377,
-    0.641402,
-    0.640426,
-    0.639448,
-    0.638468,
-    0.637487,
-    0.636504,
-    0.63552,
-    0.634534,
-    0.633548,
-    0.63256,
-    0.631572,
-    0.630584,
-    0.629596,
-    0.628607,
-    0.627619,
-    0.626632,
-    0.625646,
-    0.62466,
-    0.623676,
-    0.622693,
-    0.621712,
-    0.620732,
-    0.619754,
-    0.618777,
-    0.617803,
-    0.61683,
-    0.615858,
-    0.614888,
-    0.613919,
-    0.612952,
-    0.611986,
-    0.61102,
-    0.610055,
-    0.60909,
-    0.608126,
-    0.607161,
-    0.606197,
-    0.605231,
-    0.604265,
-    0.603298,
-    0.60233,
-    0.601361,
-    0.60039,
-    0.599418,
-    0.598444,
-    0.597468,
-    0.596491,
-    0.595513,
-    0.594533,
-    0.593551,
-    0.592568,
-    0.591584,
-    0.590599,
-    0.589613,
-    0.588626,
-    0.587639,
-    0.586652,
-    0.585665,
-    0.584678,
-    0.583691,
-    0.582705,
-    0.58172,
-    0.580736,
-    0.579753,
-    0.578772,
-    0.577791,
-    0.576813,
-    0.575835,
-    0.57486,
-    0.573886,
-    0.572913,
-    0.571942,
-    0.570972,
-    0.570003,
-    0.569035,
-    0.568069,
-    0.567102,
-    0.566137,
-    0.565171,
-    0.564206,
-    0.56324,
-    0.562274,
-    0.561308,
-    0.56034,
-    0.559372,
-    0.558403,
-    0.557432,
-    0.55646,
-    0.555487,
-    0.554512,
-    0.553536,
-    0.552558,
-    0.551579,
-    0.550599,
-    0.549617,
-    0.548634,
-    0.54765,
-    0.546665,
-    0.54568,
-    0.544694,
-    0.543707,
-    0.542721,
-    0.541735,
-    0.540749,
-    0.539763,
-    0.538779,
-    0.537795,
-    0.536812,
-    0.53583,
-    0.534849,
-    0.53387,
-    0.532892,
-    0.531916,
-    0.530941,
-    0.529967,
-    0.528995,
-    0.528024,
-    0.527054,
-    0.526085,
-    0.525118,
-    0.52415,
-    0.523184,
-    0.522217,
-    0.521251,
-    0.520285,
-    0.519318,
-    0.518351,
-    0.517383,
-    0.516415,
-    0.515446,
-    0.514475,
-    0.513504,
-    0.512531,
-    0.511557,
-    0.510581,
-    0.509604,
-    0.508626,
-    0.507647,
-    0.506666,
-    0.505684,
-    0.504701,
-    0.503717,
-    0.502733,
-    0.501748,
-    0.500762,
-    0.499777,
-    0.498791,
-    0.497806,
-    0.496821,
-    0.495836,
-    0.494852,
-    0.493869,
-    0.492887,
-    0.491906,
-    0.490927,
-    0.489948,
-    0.488971,
-    0.487996,
-    0.487021,
-    0.486048,
-    0.485076,
-    0.484105,
-    0.483136,
-    0.482167,
-    0.481198,
-    0.480231,
-    0.479264,
-    0.478297,
-    0.47733,
-    0.476363,
-    0.475395,
-    0.474428,
-    0.473459,
-    0.47249,
-    0.47152,
-    0.470548,
-    0.469576,
-    0.468602,
-    0.467627,
-    0.466651,
-    0.465674,
-    0.464695,
-    0.463715,
-    0.462734,
-    0.461752,
-    0.460769,
-    0.459786,
-    0.458801,
-    0.457817,
-    0.456832,
-    0.455847,
-    0.454862,
-    0.453877,
-    0.452893,
-    0.451909,
-    0.450926,
-    0.449944,
-    0.448963,
-    0.447983,
-    0.447004,
-    0.446026,
-    0.44505,
-    0.444075,
-    0.443101,
-    0.442128,
-    0.441156,
-    0.440186,
-    0.439216,
-    0.438247,
-    0.437279,
-    0.436311,
-    0.435343,
-    0.434376,
-    0.433408,
-    0.432441,
-    0.431473,
-    0.430504,
-    0.429535,
-    0.428565,
-    0.427594,
-    0.426621,
-    0.425648,
-    0.424674,
-    0.423698,
-    0.422722,
-    0.421744,
-    0.420765,
-    0.419784,
-    0.418803,
-    0.417821,
-    0.416838,
-    0.415855,
-    0.414871,
-    0.413886,
-    0.412902,
-    0.411917,
-    0.410933,
-    0.409948,
-    0.408965,
-    0.407982,
-    0.407,
-    0.406018,
-    0.405038,
-    0.404059,
-    0.403081,
-    0.402104,
-    0.401128,
-    0.400153,
-    0.39918,
-    0.398207,
-    0.397236,
-    0.396265,
-    0.395296,
-    0.394327,
-    0.393358,
-    0.39239,
-    0.391422,
-    0.390454,
-    0.389486,
-    0.388518,
-    0.387549,
-    0.38658,
-    0.38561,
-    0.384639,
-    0.383667,
-    0.382695,
-    0.381721,
-    0.380746,
-    0.37977,
-    0.378792,
-    0.377814,
-    0.376835,
-    0.375854,
-    0.374873,
-    0.37389,
-    0.372908,
-    0.371924,
-    0.37094,
-    0.369956,
-    0.368972,
-    0.367988,
-    0.367004,
-    0.36602,
-    0.365037,
-    0.364055,
-    0.363074,
-    0.362093,
-    0.361113,
-    0.360135,
-    0.359157,
-    0.358181,
-    0.357205,
-    0.356231,
-    0.355258,
-    0.354286,
-    0.353315,
-    0.352345,
-    0.351375,
-    0.350406,
-    0.349437,
-    0.348469,
-    0.347501,
-    0.346532,
-    0.345564,
-    0.344595,
-    0.343626,
-    0.342656,
-    0.341685,
-    0.340714,
-    0.339741,
-    0.338768,
-    0.337794,
-    0.336818,
-    0.335841,
-    0.334864,
-    0.333885,
-    0.332905,
-    0.331924,
-    0.330943,
-    0.32996,
-    0.328977,
-    0.327994,
-    0.32701,
-    0.326027,
-    0.325043,
-    0.324059,
-    0.323076,
-    0.322093,
-    0.32111,
-    0.320128,
-    0.319148,
-    0.318168,
-    0.317189,
-    0.31621,
-    0.315234,
-    0.314258,
-    0.313283,
-    0.312309,
-    0.311336,
-    0.310365,
-    0.309394,
-    0.308423,
-    0.307454,
-    0.306485,
-    0.305516,
-    0.304547,
-    0.303579,
-    0.30261,
-    0.301641,
-    0.300672,
-    0.299702,
-    0.298732,
-    0.297761,
-    0.296788,
-    0.295815,
-    0.294841,
-    0.293866,
-    0.29289,
-    0.291913,
-    0.290935,
-    0.289956,
-    0.288976,
-    0.287995,
-    0.287013,
-    0.286031,
-    0.285048,
-    0.284064,
-    0.283081,
-    0.282097,
-    0.281114,
-    0.28013,
-    0.279147,
-    0.278165,
-    0.277183,
-    0.276202,
-    0.275222,
-    0.274242,
-    0.273264,
-    0.272286,
-    0.27131,
-    0.270334,
-    0.26936,
-    0.268387,
-    0.267414,
-    0.266443,
-    0.265472,
-    0.264502,
-    0.263532,
-    0.262563,
-    0.261594,
-    0.260625,
-    0.259657,
-    0.258688,
-    0.257718,
-    0.256749,
-    0.255778,
-    0.254807,
-    0.253836,
-    0.252863,
-    0.25189,
-    0.250915,
-    0.249939,
-    0.248963,
-    0.247985,
-    0.247007,
-    0.246027,
-    0.245047,
-    0.244065,
-    0.243083,
-    0.242101,
-    0.241118,
-    0.240135,
-    0.239152,
-    0.238168,
-    0.237185,
-    0.236202,
-    0.235219,
-    0.234237,
-    0.233256,
-    0.232275,
-    0.231296,
-    0.230317,
-    0.229339,
-    0.228362,
-    0.227386,
-    0.226411,
-    0.225437,
-    0.224464,
-    0.223492,
-    0.222521,
-    0.22155,
-    0.22058,
-    0.219611,
-    0.218641,
-    0.217672,
-    0.216703,
-    0.215734,
-    0.214765,
-    0.213795,
-    0.212825,
-    0.211855,
-    0.210883,
-    0.209911,
-    0.208938,
-    0.207964,
-    0.206988,
-    0.206012,
-    0.205035,
-    0.204057,
-    0.203078,
-    0.202098,
-    0.201118,
-    0.200136,
-    0.199154,
-    0.198172,
-    0.197189,
-    0.196206,
-    0.195223,
-    0.194239,
-    0.193256,
-    0.192274,
-    0.191292,
-    0.19031,
-    0.189329,
-    0.188349,
-    0.18737,
-    0.186391,
-    0.185414,
-    0.184437,
-    0.183462,
-    0.182488,
-    0.181514,
-    0.180541,
-    0.17957,
-    0.178599,
-    0.177628,
-    0.176658,
-    0.175689,
-    0.174719,
-    0.17375,
-    0.172781,
-    0.171812,
-    0.170842,
-    0.169872,
-    0.168902,
-    0.167931,
-    0.166959,
-    0.165986,
-    0.165012,
-    0.164038,
-    0.163062,
-    0.162086,
-    0.161108,
-    0.16013,
-    0.15915,
-    0.15817,
-    0.157189,
-    0.156207,
-    0.155225,
-    0.154243,
-    0.15326,
-    0.152277,
-    0.151294,
-    0.150311,
-    0.149328,
-    0.148346,
-    0.147364,
-    0.146383,
-    0.145402,
-    0.144423,
-    0.143444,
-    0.142466,
-    0.141489,
-    0.140513,
-    0.139538,
-    0.138564,
-    0.137591,
-    0.136619,
-    0.135647,
-    0.134676,
-    0.133706,
-    0.132736,
-    0.131767,
-    0.130797,
-    0.129828,
-    0.128859,
-    0.127889,
-    0.126919,
-    0.125949,
-    0.124978,
-    0.124007,
-    0.123034,
-    0.122061,
-    0.121087,
-    0.120112,
-    0.119136,
-    0.118159,
-    0.117181,
-    0.116202,
-    0.115222,
-    0.114242,
-    0.11326,
-    0.112279,
-    0.111296,
-    0.110314,
-    0.109331,
-    0.108348,
-    0.107365,
-    0.106382,
-    0.1054,
-    0.104418,
-    0.103436,
-    0.102455,
-    0.101475,
-    0.100496,
-    0.0995178,
-    0.0985404,
-    0.0975639,
-    0.0965885,
-    0.0956139,
-    0.0946403,
-    0.0936675,
-    0.0926956,
-    0.0917244,
-    0.0907537,
-    0.0897836,
-    0.0888139,
-    0.0878445,
-    0.0868751,
-    0.0859058,
-    0.0849363,
-    0.0839666,
-    0.0829964,
-    0.0820258,
-    0.0810545,
-    0.0800825,
-    0.0791097,
-    0.078136,
-    0.0771614,
-    0.0761858,
-    0.0752093,
-    0.0742318,
-    0.0732535,
-    0.0722742,
-    0.0712941,
-    0.0703133,
-    0.0693318,
-    0.0683498,
-    0.0673674,
-    0.0663847,
-    0.0654019,
-    0.0644189,
-    0.0634362,
-    0.0624536,
-    0.0614714,
-    0.0604897,
-    0.0595086,
-    0.0585282,
-    0.0575485,
-    0.0565698,
-    0.0555919,
-    0.054615,
-    0.053639,
-    0.0526639,
-    0.0516898,
-    0.0507166,
-    0.0497442,
-    0.0487726,
-    0.0478016,
-    0.0468312,
-    0.0458613,
-    0.0448917,
-    0.0439222,
-    0.0429529,
-    0.0419835,
-    0.0410138,
-    0.0400439,
-    0.0390734,
-    0.0381025,
-    0.0371308,
-    0.0361584,
-    0.0351851,
-    0.034211,
-    0.0332359,
-    0.0322599,
-    0.0312829,
-    0.030305,
-    0.0293262,
-    0.0283466,
-    0.0273662,
-    0.0263851,
-    0.0254034,
-    0.0244212,
-    0.0234386,
-    0.0224559,
-    0.021473,
-    0.0204902,
-    0.0195075,
-    0.0185251,
-    0.0175432,
-    0.0165618,
-    0.015581,
-    0.014601,
-    0.0136218,
-    0.0126434,
-    0.011666,
-    0.0106895,
-    0.00971399,
-    0.0087394,
-    0.00776573,
-    0.00679291,
-    0.00582089,
-    0.00484958,
-    0.00387889,
-    0.00290871,
-    0.00193892,
-    0.000969392
-};
-
-// Top frequency: 44.1K * 0.0145125
-constexpr static std::array<float, 4096> wt_triangle_0x5 =
-{
-    0,
-    -0.000989615,
-    -0.00197916,
-    -0.00296858,
-    -0.00395779,
-    -0.00494674,
-    -0.00593536,
-    -0.00692358,
-    -0.00791136,
-    -0.00889863,
-    -0.00988533,
-    -0.0108714,
-    -0.0118568,
-    -0.0128415,
-    -0.0138255,
-    -0.0148086,
-    -0.0157909,
-    -0.0167724,
-    -0.017753,
-    -0.0187326,
-    -0.0197113,
-    -0.0206891,
-    -0.021666,
-    -0.0226419,
-    -0.0236168,
-    -0.0245908,
-    -0.0255638,
-    -0.026536,
-    -0.0275072,
-    -0.0284775,
-    -0.029447,
-    -0.0304157,
-    -0.0313837,
-    -0.0323508,
-    -0.0333173,
-    -0.0342831,
-    -0.0352484,
-    -0.0362131,
-    -0.0371773,
-    -0.0381411,
-    -0.0391045,
-    -0.0400677,
-    -0.0410306,
-    -0.0419933,
-    -0.0429559,
-    -0.0439185,
-    -0.0448811,
-    -0.0458439,
-    -0.0468068,
-    -0.0477699,
-    -0.0487333,
-    -0.0496971,
-    -0.0506613,
-    -0.051626,
-    -0.0525912,
-    -0.053557,
-    -0.0545234,
-    -0.0554906,
-    -0.0564585,
-    -0.0574272,
-    -0.0583966,
-    -0.059367,
-    -0.0603382,
-    -0.0613103,
-    -0.0622833,
-    -0.0632573,
-    -0.0642322,
-    -0.0652081,
-    -0.066185,
-    -0.0671628,
-    -0.0681415,
-    -0.0691212,
-    -0.0701018,
-    -0.0710833,
-    -0.0720656,
-    -0.0730488,
-    -0.0740328,
-    -0.0750175,
-    -0.076003,
-    -0.0769892,
-    -0.077976,
-    -0.0789633,
-    -0.0799512,
-    -0.0809395,
-    -0.0819282,
-    -0.0829173,
-    -0.0839066,
-    -0.0848961,
-    -0.0858858,
-    -0.0868755,
-    -0.0878653,
-    -0.088855,
-    -0.0898445,
-    -0.0908339,
-    -0.0918229,
-    -0.0928117,
-    -0.0938,
-    -0.0947879,
-    -0.0957753,
-    -0.0967622,
-    -0.0977484,
-    -0.0987339,
-    -0.0997187,
-    -0.100703,
-    -0.101686,
-    -0.102668,
-    -0.10365,
-    -0.104631,
-    -0.10561,
-    -0.106589,
-    -0.107567,
-    -0.108544,
-    -0.10952,
-    -0.110494,
-    -0.111468,
-    -0.112441,
-    -0.113413,
-    -0.114385,
-    -0.115355,
-    -0.116324,
-    -0.117293,
-    -0.118261,
-    -0.119228,
-    -0.120194,
-    -0.12116,
-    -0.122125,
-    -0.123089,
-    -0.124053,
-    -0.125017,
-    -0.12598,
-    -0.126943,
-    -0.127906,
-    -0.128868,
-    -0.12983,
-    -0.130793,
-    -0.131755,
-    -0.132718,
-    -0.13368,
-    -0.134643,
-    -0.135606,
-    -0.13657,
-    -0.137534,
-    -0.138498,
-    -0.139463,
-    -0.140429,
-    -0.141395,
-    -0.142362,
-    -0.14333,
-    -0.144298,
-    -0.145268,
-    -0.146238,
-    -0.147209,
-    -0.148181,
-    -0.149154,
-    -0.150128,
-    -0.151103,
-    -0.152079,
-    -0.153055,
-    -0.154033,
-    -0.155012,
-    -0.155992,
-    -0.156973,
-    -0.157954,
-    -0.158937,
-    -0.15992,
-    -0.160904,
-    -0.161889,
-    -0.162875,
-    -0.163861,
-    -0.164848,
-    -0.165836,
-    -0.166824,
-    -0.167813,
-    -0.168802,
-    -0.169791,
-    -0.170781,
-    -0.171771,
-    -0.172761,
-    -0.173751,
-    -0.174741,
-    -0.175731,
-    -0.176721,
-    -0.177711,
-    -0.178701,
-    -0.17969,
-    -0.180678,
-    -0.181667,
-    -0.182654,
-    -0.183642,
-    -0.184628,
-    -0.185614,
-    -0.186599,
-    -0.187583,
-    -0.188567,
-    -0.189549,
-    -0.190531,
-    -0.191512,
-    -0.192492,
-    -0.19347,
-    -0.194448,
-    -0.195425,
-    -0.196401,
-    -0.197376,
-    -0.19835,
-    -0.199323,
-    -0.200295,
-    -0.201266,
-    -0.202236,
-    -0.203205,
-    -0.204173,
-    -0.205141,
-    -0.206107,
-    -0.207073,
-    -0.208039,
-    -0.209003,
-    -0.209967,
-    -0.210931,
-    -0.211894,
-    -0.212857,
-    -0.213819,
-    -0.214781,
-    -0.215743,
-    -0.216705,
-    -0.217667,
-    -0.218629,
-    -0.219591,
-    -0.220553,
-    -0.221515,
-    -0.222478,
-    -0.223441,
-    -0.224404,
-    -0.225368,
-    -0.226333,
-    -0.227298,
-    -0.228264,
-    -0.22923,
-    -0.230198,
-    -0.231166,
-    -0.232135,
-    -0.233105,
-    -0.234076,
-    -0.235047,
-    -0.23602,
-    -0.236994,
-    -0.237969,
-    -0.238945,
-    -0.239922,
-    -0.2409,
-    -0.241879,
-    -0.242859,
-    -0.243839,
-    -0.244821,
-    -0.245804,
-    -0.246788,
-    -0.247772,
-    -0.248758,
-    -0.249744,
-    -0.250731,
-    -0.251718,
-    -0.252707,
-    -0.253695,
-    -0.254685,
-    -0.255674,
-    -0.256664,
-    -0.257655,
-    -0.258645,
-    -0.259636,
-    -0.260627,
-    -0.261618,
-    -0.262609,
-    -0.263599,
-    -0.26459,
-    -0.26558,
-    -0.26657,
-    -0.267559,
-    -0.268548,
-    -0.269536,
-    -0.270524,
-    -0.271511,
-    -0.272497,
-    -0.273483,
-    -0.274468,
-    -0.275451,
-    -0.276434,
-    -0.277416,
-    -0.278397,
-    -0.279377,
-    -0.280356,
-    -0.281334,
-    -0.282311,
-    -0.283287,
-    -0.284262,
-    -0.285236,
-    -0.286208,
-    -0.28718,
-    -0.288151,
-    -0.28912,
-    -0.290089,
-    -0.291057,
-    -0.292024,
-    -0.29299,
-    -0.293956,
-    -0.29492,
-    -0.295884,
-    -0.296847,
-    -0.29781,
-    -0.298773,
-    -0.299735,
-    -0.300696,
-    -0.301657,
-    -0.302619,
-    -0.303579,
-    -0.30454,
-    -0.305501,
-    -0.306462,
-    -0.307424,
-    -0.308385,
-    -0.309347,
-    -0.310309,
-    -0.311272,
-    -0.312235,
-    -0.313199,
-    -0.314163,
-    -0.315128,
-    -0.316094,
-    -0.317061,
-    -0.318029,
-    -0.318998,
-    -0.319967,
-    -0.320938,
-    -0.321909,
-    -0.322882,
-    -0.323855,
-    -0.32483,
-    -0.325806,
-    -0.326783,
-    -0.327761,
-    -0.32874,
-    -0.32972,
-    -0.330702,
-    -0.331684,
-    -0.332667,
-    -0.333651,
-    -0.334637,
-    -0.335623,
-    -0.33661,
-    -0.337597,
-    -0.338586,
-    -0.339575,
-    -0.340564,
-    -0.341555,
-    -0.342545,
-    -0.343536,
-    -0.344528,
-    -0.345519,
-    -0.346511,
-    -0.347503,
-    -0.348495,
-    -0.349487,
-    -0.350479,
-    -0.35147,
-    -0.352461,
-    -0.353452,
-    -0.354442,
-    -0.355432,
-    -0.356422,
-    -0.35741,
-    -0.358398,
-    -0.359385,
-    -0.360371,
-    -0.361357,
-    -0.362341,
-    -0.363325,
-    -0.364307,
-    -0.365288,
-    -0.366269,
-    -0.367248,
-    -0.368226,
-    -0.369203,
-    -0.370179,
-    -0.371154,
-    -0.372127,
-    -0.373099,
-    -0.374071,
-    -0.375041,
-    -0.37601,
-    -0.376978,
-    -0.377945,
-    -0.378912,
-    -0.379877,
-    -0.380841,
-    -0.381805,
-    -0.382768,
-    -0.38373,
-    -0.384692,
-    -0.385653,
-    -0.386614,
-    -0.387574,
-    -0.388534,
-    -0.389494,
-    -0.390454,
-    -0.391413,
-    -0.392373,
-    -0.393333,
-    -0.394293,
-    -0.395253,
-    -0.396213,
-    -0.397174,
-    -0.398136,
-    -0.399098,
-    -0.400061,
-    -0.401024,
-    -0.401988,
-    -0.402953,
-    -0.403919,
-    -0.404886,
-    -0.405854,
-    -0.406823,
-    -0.407793,
-    -0.408764,
-    -0.409737,
-    -0.41071,
-    -0.411685,
-    -0.412661,
-    -0.413638,
-    -0.414616,
-    -0.415595,
-    -0.416576,
-    -0.417558,
-    -0.418541,
-    -0.419525,
-    -0.42051,
-    -0.421496,
-    -0.422483,
-    -0.423471,
-    -0.42446,
-    -0.425449,
-    -0.426439,
-    -0.427431,
-    -0.428422,
-    -0.429414,
-    -0.430407,
-    -0.4314,
-    -0.432393,
-    -0.433386,
-    -0.43438,
-    -0.435373,
-    -0.436367,
-    -0.43736,
-    -0.438353,
-    -0.439346,
-    -0.440338,
-    -0.44133,
-    -0.442321,
-    -0.443312,
-    -0.444302,
-    -0.445291,
-    -0.446279,
-    -0.447266,
-    -0.448253,
-    -0.449238,
-    -0.450222,
-    -0.451205,
-    -0.452187,
-    -0.453168,
-    -0.454147,
-    -0.455126,
-    -0.456103,
-    -0.457079,
-    -0.458053,
-    -0.459026,
-    -0.459998,
-    -0.460969,
-    -0.461939,
-    -0.462907,
-    -0.463874,
-    -0.46484,
-    -0.465805,
-    -0.466769,
-    -0.467733,
-    -0.468695,
-    -0.469656,
-    -0.470617,
-    -0.471577,
-    -0.472536,
-    -0.473495,
-    -0.474454,
-    -0.475412,
-    -0.47637,
-    -0.477327,
-    -0.478285,
-    -0.479243,
-    -0.480201,
-    -0.481159,
-    -0.482117,
-    -0.483076,
-    -0.484035,
-    -0.484995,
-    -0.485955,
-    -0.486916,
-    -0.487878,
-    -0.488841,
-    -0.489805,
-    -0.490769,
-    -0.491735,
-    -0.492702,
-    -0.49367,
-    -0.49464,
-    -0.49561,
-    -0.496582,
-    -0.497555,
-    -0.49853,
-    -0.499506,
-    -0.500483,
-    -0.501461,
-    -0.502441,
-    -0.503422,
-    -0.504405,
-    -0.505389,
-    -0.506374,
-    -0.50736,
-    -0.508347,
-    -0.509336,
-    -0.510325,
-    -0.511316,
-    -0.512307,
-    -0.5133,
-    -0.514293,
-    -0.515286,
-    -0.516281,
-    -0.517275,
-    -0.518271,
-    -0.519266,
-    -0.520262,
-    -0.521258,
-    -0.522254,
-    -0.523249,
-    -0.524245,
-    -0.52524,
-    -0.526235,
-    -0.52723,
-    -0.528224,
-    -0.529217,
-    -0.53021,
-    -0.531202,
-    -0.532192,
-    -0.533182,
-    -0.534171,
-    -0.535159,
-    -0.536146,
-    -0.537131,
-    -0.538115,
-    -0.539098,
-    -0.540079,
-    -0.541059,
-    -0.542037,
-    -0.543015,
-    -0.54399,
-    -0.544964,
-    -0.545937,
-    -0.546908,
-    -0.547878,
-    -0.548847,
-    -0.549814,
-    -0.55078,
-    -0.551744,
-    -0.552708,
-    -0.55367,
-    -0.554631,
-    -0.555591,
-    -0.55655,
-    -0.557509,
-    -0.558466,
-    -0.559423,
-    -0.560379,
-    -0.561335,
-    -0.56229,
-    -0.563245,
-    -0.5642,
-    -0.565155,
-    -0.56611,
-    -0.567065,
-    -0.56802,
-    -0.568975,
-    -0.569931,
-    -0.570888,
-    -0.571845,
-    -0.572803,
-    -0.573761,
-    -0.574721,
-    -0.575682,
-    -0.576643,
-    -0.577606,
-    -0.578571,
-    -0.579536,
-    -0.580503,
-    -0.581471,
-    -0.582441,
-    -0.583412,
-    -0.584385,
-    -0.585359,
-    -0.586335,
-    -0.587313,
-    -0.588292,
-    -0.589272,
-    -0.590255,
-    -0.591238,
-    -0.592224,
-    -0.59321,
-    -0.594198,
-    -0.595188,
-    -0.596178,
-    -0.59717,
-    -0.598163,
-    -0.599158,
-    -0.600153,
-    -0.601149,
-    -0.602146,
-    -0.603143,
-    -0.604141,
-    -0.60514,
-    -0.606139,
-    -0.607138,
-    -0.608138,
-    -0.609137,
-    -0.610137,
-    -0.611136,
-    -0.612135,
-    -0.613133,
-    -0.614131,
-    -0.615129,
-    -0.616125,
-    -0.617121,
-    -0.618115,
-    -0.619109,
-    -0.620101,
-    -0.621093,
-    -0.622082,
-    -0.623071,
-    -0.624058,
-    -0.625043,
-    -0.626027,
-    -0.62701,
-    -0.62799,
-    -0.628969,
-    -0.629946,
-    -0.630922,
-    -0.631895,
-    -0.632867,
-    -0.633837,
-    -0.634806,
-    -0.635773,
-    -0.636738,
-    -0.637702,
-    -0.638664,
-    -0.639624,
-    -0.640584,
-    -0.641542,
-    -0.642498,
-    -0.643454,
-    -0.644408,
-    -0.645362,
-    -0.646315,
-    -0.647267,
-    -0.648218,
-    -0.649169,
-    -0.65012,
-    -0.65107,
-    -0.65202,
-    -0.65297,
-    -0.653921,
-    -0.654871,
-    -0.655823,
-    -0.656774,
-    -0.657726,
-    -0.658679,
-    -0.659633,
-    -0.660588,
-    -0.661545,
-    -0.662502,
-    -0.663461,
-    -0.664421,
-    -0.665382,
-    -0.666346,
-    -0.667311,
-    -0.668277,
-    -0.669246,
-    -0.670216,
-    -0.671188,
-    -0.672162,
-    -0.673138,
-    -0.674116,
-    -0.675096,
-    -0.676078,
-    -0.677062,
-    -0.678048,
-    -0.679035,
-    -0.680024,
-    -0.681016,
-    -0.682008,
-    -0.683003,
-    -0.683999,
-    -0.684996,
-    -0.685995,
-    -0.686995,
-    -0.687996,
-    -0.688998,
-    -0.690001,
-    -0.691004,
-    -0.692009,
-    -0.693013,
-    -0.694018,
-    -0.695024,
-    -0.696029,
-    -0.697034,
-    -0.698039,
-    -0.699044,
-    -0.700048,
-    -0.701052,
-    -0.702054,
-    -0.703056,
-    -0.704056,
-    -0.705056,
-    -0.706054,
-    -0.70705,
-    -0.708045,
-    -0.709039,
-    -0.71003,
-    -0.71102,
-    -0.712008,
-    -0.712993,
-    -0.713977,
-    -0.714958,
-    -0.715938,
-    -0.716915,
-    -0.71789,
-    -0.718863,
-    -0.719833,
-    -0.720801,
-    -0.721767,
-    -0.722731,
-    -0.723693,
-    -0.724653,
-    -0.725611,
-    -0.726567,
-    -0.727521,
-    -0.728474,
-    -0.729425,
-    -0.730374,
-    -0.731322,
-    -0.732269,
-    -0.733215,
-    -0.734159,
-    -0.735103,
-    -0.736047,
-    -0.736989,
-    -0.737932,
-    -0.738874,
-    -0.739817,
-    -0.74076,
-    -0.741703,
-    -0.742646,
-    -0.74359,
-    -0.744535,
-    -0.745481,
-    -0.746429,
-    -0.747377,
-    -0.748327,
-    -0.749279,
-    -0.750233,
-    -0.751188,
-    -0.752145,
-    -0.753105,
-    -0.754067,
-    -0.755031,
-    -0.755997,
-    -0.756966,
-    -0.757937,
-    -0.758911,
-    -0.759888,
-    -0.760867,
-    -0.761848,
-    -0.762833,
-    -0.76382,
-    -0.764809,
-    -0.765801,
-    -0.766795,
-    -0.767792,
-    -0.768791,
-    -0.769792,
-    -0.770795,
-    -0.7718,
-    -0.772807,
-    -0.773816,
-    -0.774826,
-    -0.775838,
-    -0.77685,
-    -0.777864,
-    -0.778879,
-    -0.779894,
-    -0.78091,
-    -0.781926,
-    -0.782942,
-    -0.783958,
-    -0.784974,
-    -0.785989,
-    -0.787004,
-    -0.788017,
-    -0.789029,
-    -0.79004,
-    -0.79105,
-    -0.792058,
-    -0.793064,
-    -0.794068,
-    -0.79507,
-    -0.796069,
-    -0.797066,
-    -0.798061,
-    -0.799052,
-    -0.800041,
-    -0.801027,
-    -0.80201,
-    -0.80299,
-    -0.803967,
-    -0.80494,
-    -0.805911,
-    -0.806878,
-    -0.807842,
-    -0.808803,
-    -0.809761,
-    -0.810716,
-    -0.811668,
-    -0.812618,
-    -0.813564,
-    -0.814508,
-    -0.815449,
-    -0.816388,
-    -0.817325,
-    -0.81826,
-    -0.819193,
-    -0.820125,
-    -0.821055,
-    -0.821984,
-    -0.822912,
-    -0.82384,
-    -0.824767,
-    -0.825693,
-    -0.82662,
-    -0.827547,
-    -0.828474,
-    -0.829403,
-    -0.830332,
-    -0.831263,
-    -0.832195,
-    -0.833128,
-    -0.834064,
-    -0.835002,
-    -0.835943,
-    -0.836886,
-    -0.837832,
-    -0.838781,
-    -0.839733,
-    -0.840689,
-    -0.841648,
-    -0.842611,
-    -0.843578,
-    -0.844548,
-    -0.845522,
-    -0.8465,
-    -0.847483,
-    -0.848469,
-    -0.849459,
-    -0.850454,
-    -0.851452,
-    -0.852455,
-    -0.853461,
-    -0.85447,
-    -0.855484,
-    -0.856501,
-    -0.857521,
-    -0.858544,
-    -0.859571,
-    -0.8606,
-    -0.861631,
-    -0.862665,
-    -0.8637,
-    -0.864738,
-    -0.865776,
-    -0.866816,
-    -0.867857,
-    -0.868898,
-    -0.869939,
-    -0.87098,
-    -0.87202,
-    -0.87306,
-    -0.874098,
-    -0.875135,
-    -0.87617,
-    -0.877203,
-    -0.878233,
-    -0.879261,
-    -0.880285,
-    -0.881306,
-    -0.882323,
-    -0.883336,
-    -0.884345,
-    -0.885349,
-    -0.886349,
-    -0.887344,
-    -0.888333,
-    -0.889318,
-    -0.890297,
-    -0.89127,
-    -0.892238,
-    -0.893201,
-    -0.894157,
-    -0.895108,
-    -0.896054,
-    -0.896994,
-    -0.897928,
-    -0.898857,
-    -0.899781,
-    -0.900699,
-    -0.901613,
-    -0.902523,
-    -0.903428,
-    -0.904329,
-    -0.905226,
-    -0.906119,
-    -0.90701,
-    -0.907898,
-    -0.908784,
-    -0.909667,
-    -0.91055,
-    -0.911431,
-    -0.912312,
-    -0.913194,
-    -0.914075,
-    -0.914958,
-    -0.915842,
-    -0.916728,
-    -0.917617,
-    -0.918509,
-    -0.919404,
-    -0.920304,
-    -0.921208,
-    -0.922118,
-    -0.923033,
-    -0.923954,
-    -0.924881,
-    -0.925816,
-    -0.926758,
-    -0.927708,
-    -0.928665,
-    -0.929631,
-    -0.930606,
-    -0.93159,
-    -0.932583,
-    -0.933585,
-    -0.934596,
-    -0.935617,
-    -0.936648,
-    -0.937688,
-    -0.938737,
-    -0.939796,
-    -0.940864,
-    -0.941941,
-    -0.943027,
-    -0.944121,
-    -0.945223,
-    -0.946333,
-    -0.94745,
-    -0.948574,
-    -0.949704,
-    -0.950839,
-    -0.951978,
-    -0.953122,
-    -0.954269,
-    -0.955418,
-    -0.956568,
-    -0.957719,
-    -0.95887,
-    -0.960018,
-    -0.961165,
-    -0.962307,
-    -0.963445,
-    -0.964576,
-    -0.965701,
-    -0.966816,
-    -0.967923,
-    -0.969017,
-    -0.9701,
-    -0.971169,
-    -0.972223,
-    -0.97326,
-    -0.97428,
-    -0.975281,
-    -0.976261,
-    -0.97722,
-    -0.978155,
-    -0.979067,
-    -0.979952,
-    -0.980811,
-    -0.981641,
-    -0.982441,
-    -0.983212,
-    -0.98395,
-    -0.984655,
-    -0.985326,
-    -0.985962,
-    -0.986562,
-    -0.987125,
-    -0.98765,
-    -0.988136,
-    -0.988583,
-    -0.988989,
-    -0.989354,
-    -0.989678,
-    -0.98996,
-    -0.990199,
-    -0.990395,
-    -0.990548,
-    -0.990658,
-    -0.990723,
-    -0.990745,
-    -0.990723,
-    -0.990658,
-    -0.990548,
-    -0.990395,
-    -0.990199,
-    -0.98996,
-    -0.989678,
-    -0.989354,
-    -0.988989,
-    -0.988583,
-    -0.988136,
-    -0.98765,
-    -0.987125,
-    -0.986562,
-    -0.985962,
-    -0.985326,
-    -0.984655,
-    -0.98395,
-    -0.983212,
-    -0.982441,
-    -0.981641,
-    -0.980811,
-    -0.979952,
-    -0.979067,
-    -0.978155,
-    -0.97722,
-    -0.976261,
-    -0.975281,
-    -0.97428,
-    -0.97326,
-    -0.972223,
-    -0.971169,
-    -0.9701,
-    -0.969017,
-    -0.967923,
-    -0.966816,
-    -0.965701,
-    -0.964576,
-    -0.963445,
-    -0.962307,
-    -0.961165,
-    -0.960018,
-    -0.95887,
-    -0.957719,
-    -0.956568,
-    -0.955418,
-    -0.954269,
-    -0.953122,
-    -0.951978,
-    -0.950839,
-    -0.949704,
-    -0.948574,
-    -0.94745,
-    -0.946333,
-    -0.945223,
-    -0.944121,
-    -0.943027,
-    -0.941941,
-    -0.940864,
-    -0.939796,
-    -0.938737,
-    -0.937688,
-    -0.936648,
-    -0.935617,
-    -0.934596,
-    -0.933585,
-    -0.932583,
-    -0.93159,
-    -0.930606,
-    -0.929631,
-    -0.928665,
-    -0.927708,
-    -0.926758,
-    -0.925816,
-    -0.924881,
-    -0.923954,
-    -0.923033,
-    -0.922118,
-    -0.921208,
-    -0.920304,
-    -0.919404,
-    -0.918509,
-    -0.917617,
-    -0.916728,
-    -0.915842,
-    -0.914958,
-    -0.914075,
-    -0.913194,
-    -0.912312,
-    -0.911431,
-    -0.91055,
-    -0.909667,
-    -0.908784,
-    -0.907898,
-    -0.90701,
-    -0.906119,
-    -0.905226,
-    -0.904329,
-    -0.903428,
-    -0.902523,
-    -0.901613,
-    -0.900699,
-    -0.899781,
-    -0.898857,
-    -0.897928,
-    -0.896994,
-    -0.896054,
-    -0.895108,
-    -0.894157,
-    -0.893201,
-    -0.892238,
-    -0.89127,
-    -0.890297,
-    -0.889318,
-    -0.888333,
-    -0.887344,
-    -0.886349,
-    -0.885349,
-    -0.884345,
-    -0.883336,
-    -0.882323,
-    -0.881306,
-    -0.880285,
-    -0.879261,
-    -0.878233,
-    -0.877203,
-    -0.87617,
-    -0.875135,
-    -0.874098,
-    -0.87306,
-    -0.87202,
-    -0.87098,
-    -0.869939,
-    -0.868898,
-    -0.867857,
-    -0.866816,
-    -0.865776,
-    -0.864738,
-    -0.8637,
-    -0.862665,
-    -0.861631,
-    -0.8606,
-    -0.859571,
-    -0.858544,
-    -0.857521,
-    -0.856501,
-    -0.855484,
-    -0.85447,
-    -0.853461,
-    -0.852455,
-    -0.851452,
-    -0.850454,
-    -0.849459,
-    -0.848469,
-    -0.847483,
-    -0.8465,
-    -0.845522,
-    -0.844548,
-    -0.843578,
-    -0.842611,
-    -0.841648,
-    -0.840689,
-    -0.839733,
-    -0.838781,
-    -0.837832,
-    -0.836886,
-    -0.835943,
-    -0.835002,
-    -0.834064,
-    -0.833128,
-    -0.832195,
-    -0.831263,
-    -0.830332,
-    -0.829403,
-    -0.828474,
-    -0.827547,
-    -0.82662,
-    -0.825693,
-    -0.824767,
-    -0.82384,
-    -0.822912,
-    -0.821984,
-    -0.821055,
-    -0.820125,
-    -0.819193,
-    -0.81826,
-    -0.817325,
-    -0.816388,
-    -0.815449,
-    -0.814508,
-    -0.813564,
-    -0.812618,
-    -0.811668,
-    -0.810716,
-    -0.809761,
-    -0.808803,
-    -0.807842,
-    -0.806878,
-    -0.805911,
-    -0.80494,
-    -0.803967,
-    -0.80299,
-    -0.80201,
-    -0.801027,
-    -0.800041,
-    -0.799052,
-    -0.798061,
-    -0.797066,
-    -0.796069,
-    -0.79507,
-    -0.794068,
-    -0.793064,
-    -0.792058,
-    -0.79105,
-    -0.79004,
-    -0.789029,
-    -0.788017,
-    -0.787004,
-    -0.785989,
-    -0.784974,
-    -0.783958,
-    -0.782942,
-    -0.781926,
-    -0.78091,
-    -0.779894,
-    -0.778879,
-    -0.777864,
-    -0.77685,
-    -0.775838,
-    -0.774826,
-    -0.773816,
-    -0.772807,
-    -0.7718,
-    -0.770795,
-    -0.769792,
-    -0.768791,
-    -0.767792,
-    -0.766795,
-    -0.765801,
-    -0.764809,
-    -0.76382,
-    -0.762833,
-    -0.761848,
-    -0.760867,
-    -0.759888,
-    -0.758911,
-    -0.757937,
-    -0.756966,
-    -0.755997,
-    -0.755031,
-    -0.754067,
-    -0.753105,
-    -0.752145,
-    -0.751188,
-    -0.750233,
-    -0.749279,
-    -0.748327,
-    -0.747377,
-    -0.746429,
-    -0.745481,
-    -0.744535,
-    -0.74359,
-    -0.742646,
-    -0.741703,
-    -0.74076,
-    -0.739817,
-    -0.738874,
-    -0.737932,
-    -0.736989,
-    -0.736047,
-    -0.735103,
-    -0.734159,
-    -0.733215,
-    -0.732269,
-    -0.731322,
-    -0.730374,
-    -0.729425,
-    -0.728474,
-    -0.727521,
-    -0.726567,
-    -0.725611,
-    -0.724653,
-    -0.723693,
-    -0.722731,
-    -0.721767,
-    -0.720801,
-    -0.719833,
-    -0.718863,
-    -0.71789,
-    -0.716915,
-    -0.715938,
-    -0.714958,
-    -0.713977,
-    -0.712993,
-    -0.712008,
-    -0.71102,
-    -0.71003,
-    -0.709039,
-    -0.708045,
-    -0.70705,
-    -0.706054,
-    -0.705056,
-    -0.704056,
-    -0.703056,
-    -0.702054,
-    -0.701052,
-    -0.700048,
-    -0.699044,
-    -0.698039,
-    -0.697034,
-    -0.696029,
-    -0.695024,
-    -0.694018,
-    -0.693013,
-    -0.692009,
-    -0.691004,
-    -0.690001,
-    -0.688998,
-    -0.687996,
-    -0.686995,
-    -0.685995,
-    -0.684996,
-    -0.683999,
-    -0.683003,
-    -0.682008,
-    -0.681016,
-    -0.680024,
-    -0.679035,
-    -0.678048,
-    -0.677062,
-    -0.676078,
-    -0.675096,
-    -0.674116,
-    -0.673138,
-    -0.672162,
-    -0.671188,
-    -0.670216,
-    -0.669246,
-    -0.668277,
-    -0.667311,
-    -0.666346,
-    -0.665382,
-    -0.664421,
-    -0.663461,
-    -0.662502,
-    -0.661545,
-    -0.660588,
-    -0.659633,
-    -0.658679,
-    -0.657726,
-    -0.656774,
-    -0.655823,
-    -0.654871,
-    -0.653921,
-    -0.65297,
-    -0.65202,
-    -0.65107,
-    -0.65012,
-    -0.649169,
-    -0.648218,
-    -0.647267,
-    -0.646315,
-    -0.645362,
-    -0.644408,
-    -0.643454,
-    -0.642498,
-    -0.641542,
-    -0.640584,
-    -0.639624,
-    -0.638664,
-    -0.637702,
-    -0.636738,
-    -0.635773,
-    -0.634806,
-    -0.633837,
-    -0.632867,
-    -0.631895,
-    -0.630922,
-    -0.629946,
-    -0.628969,
-    -0.62799,
-    -0.62701,
-    -0.626027,
-    -0.625043,
-    -0.624058,
-    -0.623071,
-    -0.622082,
-    -0.621093,
-    -0.620101,
-    -0.619109,
-    -0.618115,
-    -0.617121,
-    -0.616125,
-    -0.615129,
-    -0.614131,
-    -0.613133,
-    -0.612135,
-    -0.611136,
-    -0.610137,
-    -0.609137,
-    -0.608138,
-    -0.607138,
-    -0.606139,
-    -0.60514,
-    -0.604141,
-    -0.603143,
-    -0.602146,
-    -0.601149,
-    -0.600153,
-    -0.599158,
-    -0.598163,
-    -0.59717,
-    -0.596178,
-    -0.595188,
-    -0.594198,
-    -0.59321,
-    -0.592224,
-    -0.591238,
-    -0.590255,
-    -0.589272,
-    -0.588292,
-    -0.587313,
-    -0.586335,
-    -0.585359,
-    -0.584385,
-    -0.583412,
-    -0.582441,
-    -0.581471,
-    -0.580503,
-    -0.579536,
-    -0.578571,
-    -0.577606,
-    -0.576643,
-    -0.575682,
-    -0.574721,
-    -0.573761,
-    -0.572803,
-    -0.571845,
-    -0.570888,
-    -0.569931,
-    -0.568975,
-    -0.56802,
-    -0.567065,
-    -0.56611,
-    -0.565155,
-    -0.5642,
-    -0.563245,
-    -0.56229,
-    -0.561335,
-    -0.560379,
-    -0.559423,
-    -0.558466,
-    -0.557509,
-    -0.55655,
-    -0.555591,
-    -0.554631,
-    -0.55367,
-    -0.552708,
-    -0.551744,
-    -0.55078,
-    -0.549814,
-    -0.548847,
-    -0.547878,
-    -0.546908,
-    -0.545937,
-    -0.544964,
-    -0.54399,
-    -0.543015,
-    -0.542037,
-    -0.541059,
-    -0.540079,
-    -0.539098,
-    -0.538115,
-    -0.537131,
-    -0.536146,
-    -0.535159,
-    -0.534171,
-    -0.533182,
-    -0.532192,
-    -0.531202,
-    -0.53021,
-    -0.529217,
-    -0.528224,
-    -0.52723,
-    -0.526235,
-    -0.52524,
-    -0.524245,
-    -0.523249,
-    -0.522254,
-    -0.521258,
-    -0.520262,
-    -0.519266,
-    -0.518271,
-    -0.517275,
-    -0.516281,
-    -0.515286,
-    -0.514293,
-    -0.5133,
-    -0.512307,
-    -0.511316,
-    -0.510325,
-    -0.509336,
-    -0.508347,
-    -0.50736,
-    -0.506374,
-    -0.505389,
-    -0.504405,
-    -0.503422,
-    -0.502441,
-    -0.501461,
-    -0.500483,
-    -0.499506,
-    -0.49853,
-    -0.497555,
-    -0.496582,
-    -0.49561,
-    -0.49464,
-    -0.49367,
-    -0.492702,
-    -0.491735,
-    -0.490769,
-    -0.489805,
-    -0.488841,
-    -0.487878,
-    -0.486916,
-    -0.485955,
-    -0.484995,
-    -0.484035,
-    -0.483076,
-    -0.482117,
-    -0.481159,
-    -0.480201,
-    -0.479243,
-    -0.478285,
-    -0.477327,
-    -0.47637,
-    -0.475412,
-    -0.474454,
-    -0.473495,
-    -0.472536,
-    -0.471577,
-    -0.470617,
-    -0.469656,
-    -0.468695,
-    -0.467733,
-    -0.466769,
-    -0.465805,
-    -0.46484,
-    -0.463874,
-    -0.462907,
-    -0.461939,
-    -0.460969,
-    -0.459998,
-    -0.459026,
-    -0.458053,
-    -0.457079,
-    -0.456103,
-    -0.455126,
-    -0.454147,
-    -0.453168,
-    -0.452187,
-    -0.451205,
-    -0.450222,
-    -0.449238,
-    -0.448253,
-    -0.447266,
-    -0.446279,
-    -0.445291,
-    -0.444302,
-    -0.443312,
-    -0.442321,
-    -0.44133,
-    -0.440338,
-    -0.439346,
-    -0.438353,
-    -0.43736,
-    -0.436367,
-    -0.435373,
-    -0.43438,
-    -0.433386,
-    -0.432393,
-    -0.4314,
-    -0.430407,
-    -0.429414,
-    -0.428422,
-    -0.427431,
-    -0.426439,
-    -0.425449,
-    -0.42446,
-    -0.423471,
-    -0.422483,
-    -0.421496,
-    -0.42051,
-    -0.419525,
-    -0.418541,
-    -0.417558,
-    -0.416576,
-    -0.415595,
-    -0.414616,
-    -0.413638,
-    -0.412661,
-    -0.411685,
-    -0.41071,
-    -0.409737,
-    -0.408764,
-    -0.407793,
-    -0.406823,
-    -0.405854,
-    -0.404886,
-    -0.403919,
-    -0.402953,
-    -0.401988,
-    -0.401024,
-    -0.400061,
-    -0.399098,
-    -0.398136,
-    -0.397174,
-    -0.396213,
-    -0.395253,
-    -0.394293,
-    -0.393333,
-    -0.392373,
-    -0.391413,
-    -0.390454,
-    -0.389494,
-    -0.388534,
-    -0.387574,
-    -0.386614,
-    -0.385653,
-    -0.384692,
-    -0.38373,
-    -0.382768,
-    -0.381805,
-    -0.380841,
-    -0.379877,
-    -0.378912,
-    -0.377945,
-    -0.376978,
-    -0.37601,
-    -0.375041,
-    -0.374071,
-    -0.373099,
-    -0.372127,
-    -0.371154,
-    -0.370179,
-    -0.369203,
-    -0.368226,
-    -0.367248,
-    -0.366269,
-    -0.365288,
-    -0.364307,
-    -0.363325,
-    -0.362341,
-    -0.361357,
-    -0.360371,
-    -0.359385,
-    -0.358398,
-    -0.35741,
-    -0.356422,
-    -0.355432,
-    -0.354442,
-    -0.353452,
-    -0.352461,
-    -0.35147,
-    -0.350479,
-    -0.349487,
-    -0.348495,
-    -0.347503,
-    -0.346511,
-    -0.345519,
-    -0.344528,
-    -0.343536,
-    -0.342545,
-    -0.341555,
-    -0.340564,
-    -0.339575,
-    -0.338586,
-    -0.337597,
-    -0.33661,
-    -0.335623,
-    -0.334637,
-    -0.333651,
-    -0.332667,
-    -0.331684,
-    -0.330702,
-    -0.32972,
-    -0.32874,
-    -0.327761,
-    -0.326783,
-    -0.325806,
-    -0.32483,
-    -0.323855,
-    -0.322882,
-    -0.321909,
-    -0.320938,
-    -0.319967,
-    -0.318998,
-    -0.318029,
-    -0.317061,
-    -0.316094,
-    -0.315128,
-    -0.314163,
-    -0.313199,
-    -0.312235,
-    -0.311272,
-    -0.310309,
-    -0.309347,
-    -0.308385,
-    -0.307424,
-    -0.306462,
-    -0.305501,
-    -0.30454,
-    -0.303579,
-    -0.302619,
-    -0.301657,
-    -0.300696,
-    -0.299735,
-    -0.298773,
-    -0.29781,
-    -0.296847,
-    -0.295884,
-    -0.29492,
-    -0.293956,
-    -0.29299,
-    -0.292024,
-    -0.291057,
-    -0.290089,
-    -0.28912,
-    -0.288151,
-    -0.28718,
-    -0.286208,
-    -0.285236,
-    -0.284262,
-    -0.283287,
-    -0.282311,
-    -0.281334,
-    -0.280356,
-    -0.279377,
-    -0.278397,
-    -0.277416,
-    -0.276434,
-    -0.275451,
-    -0.274468,
-    -0.273483,
-    -0.272497,
-    -0.271511,
-    -0.270524,
-    -0.269536,
-    -0.268548,
-    -0.267559,
-    -0.26657,
-    -0.26558,
-    -0.26459,
-    -0.263599,
-    -0.262609,
-    -0.261618,
-    -0.260627,
-    -0.259636,
-    -0.258645,
-    -0.257655,
-    -0.256664,
-    -0.255674,
-    -0.254685,
-    -0.253695,
-    -0.252707,
-    -0.251718,
-    -0.250731,
-    -0.249744,
-    -0.248758,
-    -0.247772,
-    -0.246788,
-    -0.245804,
-    -0.244821,
-    -0.243839,
-    -0.242859,
-    -0.241879,
-    -0.2409,
-    -0.239922,
-    -0.238945,
-    -0.237969,
-    -0.236994,
-    -0.23602,
-    -0.235047,
-    -0.234076,
-    -0.233105,
-    -0.232135,
-    -0.231166,
-    -0.230198,
-    -0.22923,
-    -0.228264,
-    -0.227298,
-    -0.226333,
-    -0.225368,
-    -0.224404,
-    -0.223441,
-    -0.222478,
-    -0.221515,
-    -0.220553,
-    -0.219591,
-    -0.218629,
-    -0.217667,
-    -0.216705,
-    -0.215743,
-    -0.214781,
-    -0.213819,
-    -0.212857,
-    -0.211894,
-    -0.210931,
-    -0.209967,
-    -0.209003,
-    -0.208039,
-    -0.207073,
-    -0.206107,
-    -0.205141,
-    -0.204173,
-    -0.203205,
-    -0.202236,
-    -0.201266,
-    -0.200295,
-    -0.199323,
-    -0.19835,
-    -0.197376,
-    -0.196401,
-    -0.195425,
-    -0.194448,
-    -0.19347,
-    -0.192492,
-    -0.191512,
-    -0.190531,
-    -0.189549,
-    -0.188567,
-    -0.187583,
-    -0.186599,
-    -0.185614,
-    -0.184628,
-    -0.183642,
-    -0.182654,
-    -0.181667,
-    -0.180678,
-    -0.17969,
-    -0.178701,
-    -0.177711,
-    -0.176721,
-    -0.175731,
-    -0.174741,
-    -0.173751,
-    -0.172761,
-    -0.171771,
-    -0.170781,
-    -0.169791,
-    -0.168802,
-    -0.167813,
-    -0.166824,
-    -0.165836,
-    -0.164848,
-    -0.163861,
-    -0.162875,
-    -0.161889,
-    -0.160904,
-    -0.15992,
-    -0.158937,
-    -0.157954,
-    -0.156973,
-    -0.155992,
-    -0.155012,
-    -0.154033,
-    -0.153055,
-    -0.152079,
-    -0.151103,
-    -0.150128,
-    -0.149154,
-    -0.148181,
-    -0.147209,
-    -0.146238,
-    -0.145268,
-    -0.144298,
-    -0.14333,
-    -0.142362,
-    -0.141395,
-    -0.140429,
-    -0.139463,
-    -0.138498,
-    -0.137534,
-    -0.13657,
-    -0.135606,
-    -0.134643,
-    -0.13368,
-    -0.132718,
-    -0.131755,
-    -0.130793,
-    -0.12983,
-    -0.128868,
-    -0.127906,
-    -0.126943,
-    -0.12598,
-    -0.125017,
-    -0.124053,
-    -0.123089,
-    -0.122125,
-    -0.12116,
-    -0.120194,
-    -0.119228,
-    -0.118261,
-    -0.117293,
-    -0.116324,
-    -0.115355,
-    -0.114385,
-    -0.113413,
-    -0.112441,
-    -0.111468,
-    -0.110494,
-    -0.10952,
-    -0.108544,
-    -0.107567,
-    -0.106589,
-    -0.10561,
-    -0.104631,
-    -0.10365,
-    -0.102668,
-    -0.101686,
-    -0.100703,
-    -0.0997187,
-    -0.0987339,
-    -0.0977484,
-    -0.0967622,
-    -0.0957753,
-    -0.0947879,
-    -0.0938,
-    -0.0928117,
-    -0.0918229,
-    -0.0908339,
-    -0.0898445,
-    -0.088855,
-    -0.0878653,
-    -0.0868755,
-    -0.0858858,
-    -0.0848961,
-    -0.0839066,
-    -0.0829173,
-    -0.0819282,
-    -0.0809395,
-    -0.0799512,
-    -0.0789633,
-    -0.077976,
-    -0.0769892,
-    -0.076003,
-    -0.0750175,
-    -0.0740328,
-    -0.0730488,
-    -0.0720656,
-    -0.0710833,
-    -0.0701018,
-    -0.0691212,
-    -0.0681415,
-    -0.0671628,
-    -0.066185,
-    -0.0652081,
-    -0.0642322,
-    -0.0632573,
-    -0.0622833,
-    -0.0613103,
-    -0.0603382,
-    -0.059367,
-    -0.0583966,
-    -0.0574272,
-    -0.0564585,
-    -0.0554906,
-    -0.0545234,
-    -0.053557,
-    -0.0525912,
-    -0.051626,
-    -0.0506613,
-    -0.0496971,
-    -0.0487333,
-    -0.0477699,
-    -0.0468068,
-    -0.0458439,
-    -0.0448811,
-    -0.0439185,
-    -0.0429559,
-    -0.0419933,
-    -0.0410306,
-    -0.0400677,
-    -0.0391045,
-    -0.0381411,
-    -0.0371773,
-    -0.0362131,
-    -0.0352484,
-    -0.0342831,
-    -0.0333173,
-    -0.0323508,
-    -0.0313837,
-    -0.0304157,
-    -0.029447,
-    -0.0284775,
-    -0.0275072,
-    -0.026536,
-    -0.0255638,
-    -0.0245908,
-    -0.0236168,
-    -0.0226419,
-    -0.021666,
-    -0.0206891,
-    -0.0197113,
-    -0.0187326,
-    -0.017753,
-    -0.0167724,
-    -0.0157909,
-    -0.0148086,
-    -0.0138255,
-    -0.0128415,
-    -0.0118568,
-    -0.0108714,
-    -0.00988533,
-    -0.00889863,
-    -0.00791136,
-    -0.00692358,
-    -0.00593536,
-    -0.00494674,
-    -0.00395779,
-    -0.00296858,
-    -0.00197916,
-    -0.000989615,
-    0,
-    0.000989615,
-    0.00197916,
-    0.00296858,
-    0.00395779,
-    0.00494674,
-    0.00593536,
-    0.00692358,
-    0.00791136,
-    0.00889863,
-    0.00988533,
-    0.0108714,
-    0.0118568,
-    0.0128415,
-    0.0138255,
-    0.0148086,
-    0.0157909,
-    0.0167724,
-    0.017753,
-    0.0187326,
-    0.0197113,
-    0.0206891,
-    0.021666,
-    0.0226419,
-    0.0236168,
-    0.0245908,
-    0.0255638,
-    0.026536,
-    0.0275072,
-    0.0284775,
-    0.029447,
-    0.0304157,
-    0.0313837,
-    0.0323508,
-    0.0333173,
-    0.0342831,
-    0.0352484,
-    0.0362131,
-    0.0371773,
-    0.0381411,
-    0.0391045,
-    0.0400677,
-    0.0410306,
-    0.0419933,
-    0.0429559,
-    0.0439185,
-    0.0448811,
-    0.0458439,
-    0.0468068,
-    0.0477699,
-    0.0487333,
-    0.0496971,
-    0.0506613,
-    0.051626,
-    0.0525912,
-    0.053557,
-    0.0545234,
-    0.0554906,
-    0.0564585,
-    0.0574272,
-    0.0583966,
-    0.059367,
-    0.0603382,
-    0.0613103,
-    0.0622833,
-    0.0632573,
-    0.0642322,
-    0.0652081,
-    0.066185,
-    0.0671628,
-    0.0681415,
-    0.0691212,
-    0.0701018,
-    0.0710833,
-    0.0720656,
-    0.0730488,
-    0.0740328,
-    0.0750175,
-    0.076003,
-    0.0769892,
-    0.077976,
-    0.0789633,
-    0.0799512,
-    0.0809395,
-    0.0819282,
-    0.0829173,
-    0.0839066,
-    0.0848961,
-    0.0858858,
-    0.0868755,
-    0.0878653,
-    0.088855,
-    0.0898445,
-    0.0908339,
-    0.0918229,
-    0.0928117,
-    0.0938,
-    0.0947879,
-    0.0957753,
-    0.0967622,
-    0.0977484,
-    0.0987339,
-    0.0997187,
-    0.100703,
-    0.101686,
-    0.102668,
-    0.10365,
-    0.104631,
-    0.10561,
-    0.106589,
-    0.107567,
-    0.108544,
-    0.10952,
-    0.110494,
-    0.111468,
-    0.112441,
-    0.113413,
-    0.114385,
-    0.115355,
-    0.116324,
-    0.117293,
-    0.118261,
-    0.119228,
-    0.120194,
-    0.12116,
-    0.122125,
-    0.123089,
-    0.124053,
-    0.125017,
-    0.12598,
-    0.126943,
-    0.127906,
-    0.128868,
-    0.12983,
-    0.130793,
-    0.131755,
-    0.132718,
-    0.13368,
-    0.134643,
-    0.135606,
-    0.13657,
-    0.137534,
-    0.138498,
-    0.139463,
-    0.140429,
-    0.141395,
-    0.142362,
-    0.14333,
-    0.144298,
-    0.145268,
-    0.146238,
-    0.147209,
-    0.148181,
-    0.149154,
-    0.150128,
-    0.151103,
-    0.152079,
-    0.153055,
-    0.154033,
-    0.155012,
-    0.155992,
-    0.156973,
-    0.157954,
-    0.158937,
-    0.15992,
-    0.160904,
-    0.161889,
-    0.162875,
-    0.163861,
-    0.164848,
-    0.165836,
-    0.166824,
-    0.167813,
-    0.168802,
-    0.169791,
-    0.170781,
-    0.171771,
-    0.172761,
-    0.173751,
-    0.174741,
-    0.175731,
-    0.176721,
-    0.177711,
-    0.178701,
-    0.17969,
-    0.180678,
-    0.181667,
-    0.182654,
-    0.183642,
-    0.184628,
-    0.185614,
-    0.186599,
-    0.187583,
-    0.188567,
-    0.189549,
-    0.190531,
-    0.191512,
-    0.192492,
-    0.19347,
-    0.194448,
-    0.195425,
-    0.196401,
-    0.197376,
-    0.19835,
-    0.199323,
-    0.200295,
-    0.201266,
-    0.202236,
-    0.203205,
-    0.204173,
-    0.205141,
-    0.206107,
-    0.207073,
-    0.208039,
-    0.209003,
-    0.209967,
-    0.210931,
-    0.211894,
-    0.212857,
-    0.213819,
-    0.214781,
-    0.215743,
-    0.216705,
-    0.217667,
-    0.218629,
-    0.219591,
-    0.220553,
-    0.221515,
-    0.222478,
-    0.223441,
-    0.224404,
-    0.225368,
-    0.226333,
-    0.227298,
-    0.228264,
-    0.22923,
-    0.230198,
-    0.231166,
-    0.232135,
-    0.233105,
-    0.234076,
-    0.235047,
-    0.23602,
-    0.236994,
-    0.237969,
-    0.238945,
-    0.239922,
-    0.2409,
-    0.241879,
-    0.242859,
-    0.243839,
-    0.244821,
-    0.245804,
-    0.246788,
-    0.247772,
-    0.248758,
-    0.249744,
-    0.250731,
-    0.251718,
-    0.252707,
-    0.253695,
-    0.254685,
-    0.255674,
-    0.256664,
-    0.257655,
-    0.258645,
-    0.259636,
-    0.260627,
-    0.261618,
-    0.262609,
-    0.263599,
-    0.26459,
-    0.26558,
-    0.26657,
-    0.267559,
-    0.268548,
-    0.269536,
-    0.270524,
-    0.271511,
-    0.272497,
-    0.273483,
-    0.274468,
-    0.275451,
-    0.276434,
-    0.277416,
-    0.278397,
-    0.279377,
-    0.280356,
-    0.281334,
-    0.282311,
-    0.283287,
-    0.284262,
-    0.285236,
-    0.286208,
-    0.28718,
-    0.288151,
-    0.28912,
-    0.290089,
-    0.291057,
-    0.292024,
-    0.29299,
-    0.293956,
-    0.29492,
-    0.295884,
-    0.296847,
-    0.29781,
-    0.298773,
-    0.299735,
-    0.300696,
-    0.301657,
-    0.302619,
-    0.303579,
-    0.30454,
-    0.305501,
-    0.306462,
-    0.307424,
-    0.308385,
-    0.309347,
-    0.310309,
-    0.311272,
-    0.312235,
-    0.313199,
-    0.314163,
-    0.315128,
-    0.316094,
-    0.317061,
-    0.318029,
-    0.318998,
-    0.319967,
-    0.320938,
-    0.321909,
-    0.322882,
-    0.323855,
-    0.32483,
-    0.325806,
-    0.326783,
-    0.327761,
-    0.32874,
-    0.32972,
-    0.330702,
-    0.331684,
-    0.332667,
-    0.333651,
-    0.334637,
-    0.335623,
-    0.33661,
-    0.337597,
-    0.338586,
-    0.339575,
-    0.340564,
-    0.341555,
-    0.342545,
-    0.343536,
-    0.344528,
-    0.345519,
-    0.346511,
-    0.347503,
-    0.348495,
-    0.349487,
-    0.350479,
-    0.35147,
-    0.352461,
-    0.353452,
-    0.354442,
-    0.355432,
-    0.356422,
-    0.35741,
-    0.358398,
-    0.359385,
-    0.360371,
-    0.361357,
-    0.362341,
-    0.363325,
-    0.364307,
-    0.365288,
-    0.366269,
-    0.367248,
-    0.368226,
-    0.369203,
-    0.370179,
-    0.371154,
-    0.372127,
-    0.373099,
-    0.374071,
-    0.375041,
-    0.37601,
-    0.376978,
-    0.377945,
-    0.378912,
-    0.379877,
-    0.380841,
-    0.381805,
-    0.382768,
-    0.38373,
-    0.384692,
-    0.385653,
-    0.386614,
-    0.387574,
-    0.388534,
-    0.389494,
-    0.390454,
-    0.391413,
-    0.392373,
-    0.393333,
-    0.394293,
-    0.395253,
-    0.396213,
-    0.397174,
-    0.398136,
-    0.399098,
-    0.400061,
-    0.401024,
-    0.401988,
-    0.402953,
-    0.403919,
-    0.404886,
-    0.405854,
-    0.406823,
-    0.407793,
-    0.408764,
-    0.409737,
-    0.41071,
-    0.411685,
-    0.412661,
-    0.413638,
-    0.414616,
-    0.415595,
-    0.416576,
-    0.417558,
-    0.418541,
-    0.419525,
-    0.42051,
-    0.421496,
-    0.422483,
-    0.423471,
-    0.42446,
-    0.425449,
-    0.426439,
-    0.427431,
-    0.428422,
-    0.429414,
-    0.430407,
-    0.4314,
-    0.432393,
-    0.433386,
-    0.43438,
-    0.435373,
-    0.436367,
-    0.43736,
-    0.438353,
-    0.439346,
-    0.440338,
-    0.44133,
-    0.442321,
-    0.443312,
-    0.444302,
-    0.445291,
-    0.446279,
-    0.447266,
-    0.448253,
-    0.449238,
-    0.450222,
-    0.451205,
-    0.452187,
-    0.453168,
-    0.454147,
-    0.455126,
-    0.456103,
-    0.457079,
-    0.458053,
-    0.459026,
-    0.459998,
-    0.460969,
-    0.461939,
-    0.462907,
-    0.463874,
-    0.46484,
-    0.465805,
-    0.466769,
-    0.467733,
-    0.468695,
-    0.469656,
-    0.470617,
-    0.471577,
-    0.472536,
-    0.473495,
-    0.474454,
-    0.475412,
-    0.47637,
-    0.477327,
-    0.478285,
-    0.479243,
-    0.480201,
-    0.481159,
-    0.482117,
-    0.483076,
-    0.484035,
-    0.484995,
-    0.485955,
-    0.486916,
-    0.487878,
-    0.488841,
-    0.489805,
-    0.490769,
-    0.491735,
-    0.492702,
-    0.49367,
-    0.49464,
-    0.49561,
-    0.496582,
-    0.497555,
-    0.49853,
-    0.499506,
-    0.500483,
-    0.501461,
-    0.502441,
-    0.503422,
-    0.504405,
-    0.505389,
-    0.506374,
-    0.50736,
-    0.508347,
-    0.509336,
-    0.510325,
-    0.511316,
-    0.512307,
-    0.5133,
-    0.514293,
-    0.515286,
-    0.516281,
-    0.517275,
-    0.518271,
-    0.519266,
-    0.520262,
-    0.521258,
-    0.522254,
-    0.523249,
-    0.524245,
-    0.52524,
-    0.526235,
-    0.52723,
-    0.528224,
-    0.529217,
-    0.53021,
-    0.531202,
-    0.532192,
-    0.533182,
-    0.534171,
-    0.535159,
-    0.536146,
-    0.537131,
-    0.538115,
-    0.539098,
-    0.540079,
-    0.541059,
-    0.542037,
-    0.543015,
-    0.54399,
-    0.544964,
-    0.545937,
-    0.546908,
-    0.547878,
-    0.548847,
-    0.549814,
-    0.55078,
-    0.551744,
-    0.552708,
-    0.55367,
-    0.554631,
-    0.555591,
-    0.55655,
-    0.557509,
-    0.558466,
-    0.559423,
-    0.560379,
-    0.561335,
-    0.56229,
-    0.563245,
-    0.5642,
-    0.565155,
-    0.56611,
-    0.567065,
-    0.56802,
-    0.568975,
-    0.569931,
-    0.570888,
-    0.571845,
-    0.572803,
-    0.573761,
-    0.574721,
-    0.575682,
-    0.576643,
-    0.577606,
-    0.578571,
-    0.579536,
-    0.580503,
-    0.581471,
-    0.582441,
-    0.583412,
-    0.584385,
-    0.585359,
-    0.586335,
-    0.587313,
-    0.588292,
-    0.589272,
-    0.590255,
-    0.591238,
-    0.592224,
-    0.59321,
-    0.594198,
-    0.595188,
-    0.596178,
-    0.59717,
-    0.598163,
-    0.599158,
-    0.600153,
-    0.601149,
-    0.602146,
-    0.603143,
-    0.604141,
-    0.60514,
-    0.606139,
-    0.607138,
-    0.608138,
-    0.609137,
-    0.610137,
-    0.611136,
-    0.612135,
-    0.613133,
-    0.614131,
-    0.615129,
-    0.616125,
-    0.617121,
-    0.618115,
-    0.619109,
-    0.620101,
-    0.621093,
-    0.622082,
-    0.623071,
-    0.624058,
-    0.625043,
-    0.626027,
-    0.62701,
-    0.62799,
-    0.628969,
-    0.629946,
-    0.630922,
-    0.631895,
-    0.632867,
-    0.633837,
-    0.634806,
-    0.635773,
-    0.636738,
-    0.637702,
-    0.638664,
-    0.639624,
-    0.640584,
-    0.641542,
-    0.642498,
-    0.643454,
-    0.644408,
-    0.645362,
-    0.646315,
-    0.647267,
-    0.648218,
-    0.649169,
-    0.65012,
-    0.65107,
-    0.65202,
-    0.65297,
-    0.653921,
-    0.654871,
-    0.655823,
-    0.656774,
-    0.657726,
-    0.658679,
-    0.659633,
-    0.660588,
-    0.661545,
-    0.662502,
-    0.663461,
-    0.664421,
-    0.665382,
-    0.666346,
-    0.667311,
-    0.668277,
-    0.669246,
-    0.670216,
-    0.671188,
-    0.672162,
-    0.673138,
-    0.674116,
-    0.675096,
-    0.676078,
-    0.677062,
-    0.678048,
-    0.679035,
-    0.680024,
-    0.681016,
-    0.682008,
-    0.683003,
-    0.683999,
-    0.684996,
-    0.685995,
-    0.686995,
-    0.687996,
-    0.688998,
-    0.690001,
-    0.691004,
-    0.692009,
-    0.693013,
-    0.694018,
-    0.695024,
-    0.696029,
-    0.697034,
-    0.698039,
-    0.699044,
-    0.700048,
-    0.701052,
-    0.702054,
-    0.703056,
-    0.704056,
-    0.705056,
-    0.706054,
-    0.70705,
-    0.708045,
-    0.709039,
-    0.71003,
-    0.71102,
-    0.712008,
-    0.712993,
-    0.713977,
-    0.714958,
-    0.715938,
-    0.716915,
-    0.71789,
-    0.718863,
-    0.719833,
-    0.720801,
-    0.721767,
-    0.722731,
-    0.723693,
-    0.724653,
-    0.725611,
-    0.726567,
-    0.727521,
-    0.728474,
-    0.729425,
-    0.730374,
-    0.731322,
-    0.732269,
-    0.733215,
-    0.734159,
-    0.735103,
-    0.736047,
-    0.736989,
-    0.737932,
-    0.738874,
-    0.739817,
-    0.74076,
-    0.741703,
-    0.742646,
-    0.74359,
-    0.744535,
-    0.745481,
-    0.746429,
-    0.747377,
-    0.748327,
-    0.749279,
-    0.750233,
-    0.751188,
-    0.752145,
-    0.753105,
-    0.754067,
-    0.755031,
-    0.755997,
-    0.756966,
-    0.757937,
-    0.758911,
-    0.759888,
-    0.760867,
-    0.761848,
-    0.762833,
-    0.76382,
-    0.764809,
-    0.765801,
-    0.766795,
-    0.767792,
-    0.768791,
-    0.769792,
-    0.770795,
-    0.7718,
-    0.772807,
-    0.773816,
-    0.774826,
-    0.775838,
-    0.77685,
-    0.777864,
-    0.778879,
-    0.779894,
-    0.78091,
-    0.781926,
-    0.782942,
-    0.783958,
-    0.784974,
-    0.785989,
-    0.787004,
-    0.788017,
-    0.789029,
-    0.79004,
-    0.79105,
-    0.792058,
-    0.793064,
-    0.794068,
-    0.79507,
-    0.796069,
-    0.797066,
-    0.798061,
-    0.799052,
-    0.800041,
-    0.801027,
-    0.80201,
-    0.80299,
-    0.803967,
-    0.80494,
-    0.805911,
-    0.806878,
-    0.807842,
-    0.808803,
-    0.809761,
-    0.810716,
-    0.811668,
-    0.812618,
-    0.813564,
-    0.814508,
-    0.815449,
-    0.816388,
-    0.817325,
-    0.81826,
-    0.819193,
-    0.820125,
-    0.821055,
-    0.821984,
-    0.822912,
-    0.82384,
-    0.824767,
-    0.825693,
-    0.82662,
-    0.827547,
-    0.828474,
-    0.829403,
-    0.830332,
-    0.831263,
-    0.832195,
-    0.833128,
-    0.834064,
-    0.835002,
-    0.835943,
-    0.836886,
-    0.837832,
-    0.838781,
-    0.839733,
-    0.840689,
-    0.841648,
-    0.842611,
-    0.843578,
-    0.844548,
-    0.845522,
-    0.8465,
-    0.847483,
-    0.848469,
-    0.849459,
-    0.850454,
-    0.851452,
-    0.852455,
-    0.853461,
-    0.85447,
-    0.855484,
-    0.856501,
-    0.857521,
-    0.858544,
-    0.859571,
-    0.8606,
-    0.861631,
-    0.862665,
-    0.8637,
-    0.864738,
-    0.865776,
-    0.866816,
-    0.867857,
-    0.868898,
-    0.869939,
-    0.87098,
-    0.87202,
-    0.87306,
-    0.874098,
-    0.875135,
-    0.87617,
-    0.877203,
-    0.878233,
-    0.879261,
-    0.880285,
-    0.881306,
-    0.882323,
-    0.883336,
-    0.884345,
-    0.885349,
-    0.886349,
-    0.887344,
-    0.888333,
-    0.889318,
-    0.890297,
-    0.89127,
-    0.892238,
-    0.893201,
-    0.894157,
-    0.895108,
-    0.896054,
-    0.896994,
-    0.897928,
-    0.898857,
-    0.899781,
-    0.900699,
-    0.901613,
-    0.902523,
-    0.903428,
-    0.904329,
-    0.905226,
-    0.906119,
-    0.90701,
-    0.907898,
-    0.908784,
-    0.909667,
-    0.91055,
-    0.911431,
-    0.912312,
-    0.913194,
-    0.914075,
-    0.914958,
-    0.915842,
-    0.916728,
-    0.917617,
-    0.918509,
-    0.919404,
-    0.920304,
-    0.921208,
-    0.922118,
-    0.923033,
-    0.923954,
-    0.924881,
-    0.925816,
-    0.926758,
-    0.927708,
-    0.928665,
-    0.929631,
-    0.930606,
-    0.93159,
-    0.932583,
-    0.933585,
-    0.934596,
-    0.935617,
-    0.936648,
-    0.937688,
-    0.938737,
-    0.939796,
-    0.940864,
-    0.941941,
-    0.943027,
-    0.944121,
-    0.945223,
-    0.946333,
-    0.94745,
-    0.948574,
-    0.949704,
-    0.950839,
-    0.951978,
-    0.953122,
-    0.954269,
-    0.955418,
-    0.956568,
-    0.957719,
-    0.95887,
-    0.960018,
-    0.961165,
-    0.962307,
-    0.963445,
-    0.964576,
-    0.965701,
-    0.966816,
-    0.967923,
-    0.969017,
-    0.9701,
-    0.971169,
-    0.972223,
-    0.97326,
-    0.97428,
-    0.975281,
-    0.976261,
-    0.97722,
-    0.978155,
-    0.979067,
-    0.979952,
-    0.980811,
-    0.981641,
-    0.982441,
-    0.983212,
-    0.98395,
-    0.984655,
-    0.985326,
-    0.985962,
-    0.986562,
-    0.987125,
-    0.98765,
-    0.988136,
-    0.988583,
-    0.988989,
-    0.989354,
-    0.989678,
-    0.98996,
-    0.990199,
-    0.990395,
-    0.990548,
-    0.990658,
-    0.990723,
-    0.990745,
-    0.990723,
-    0.990658,
-    0.990548,
-    0.990395,
-    0.990199,
-    0.98996,
-    0.989678,
-    0.989354,
-    0.988989,
-    0.988583,
-    0.988136,
-    0.98765,
-    0.987125,
-    0.986562,
-    0.985962,
-    0.985326,
-    0.984655,
-    0.98395,
-    0.983212,
-    0.982441,
-    0.981641,
-    0.980811,
-    0.979952,
-    0.979067,
-    0.978155,
-    0.97722,
-    0.976261,
-    0.975281,
-    0.97428,
-    0.97326,
-    0.972223,
-    0.971169,
-    0.9701,
-    0.969017,
-    0.967923,
-    0.966816,
-    0.965701,
-    0.964576,
-    0.963445,
-    0.962307,
-    0.961165,
-    0.960018,
-    0.95887,
-    0.957719,
-    0.956568,
-    0.955418,
-    0.954269,
-    0.953122,
-    0.951978,
-    0.950839,
-    0.949704,
-    0.948574,
-    0.94745,
-    0.946333,
-    0.945223,
-    0.944121,
-    0.943027,
-    0.941941,
-    0.940864,
-    0.939796,
-    0.938737,
-    0.937688,
-    0.936648,
-    0.935617,
-    0.934596,
-    0.933585,
-    0.932583,
-    0.93159,
-    0.930606,
-    0.929631,
-    0.928665,
-    0.927708,
-    0.926758,
-    0.925816,
-    0.924881,
-    0.923954,
-    0.923033,
-    0.922118,
-    0.921208,
-    0.920304,
-    0.919404,
-    0.918509,
-    0.917617,
-    0.916728,
-    0.915842,
-    0.914958,
-    0.914075,
-    0.913194,
-    0.912312,
-    0.911431,
-    0.91055,
-    0.909667,
-    0.908784,
-    0.907898,
-    0.90701,
-    0.906119,
-    0.905226,
-    0.904329,
-    0.903428,
-    0.902523,
-    0.901613,
-    0.900699,
-    0.899781,
-    0.898857,
-    0.897928,
-    0.896994,
-    0.896054,
-    0.895108,
-    0.894157,
-    0.893201,
-    0.892238,
-    0.89127,
-    0.890297,
-    0.889318,
-    0.888333,
-    0.887344,
-    0.886349,
-    0.885349,
-    0.884345,
-    0.883336,
-    0.882323,
-    0.881306,
-    0.880285,
-    0.879261,
-    0.878233,
-    0.877203,
-    0.87617,
-    0.875135,
-    0.874098,
-    0.87306,
-    0.87202,
-    0.87098,
-    0.869939,
-    0.868898,
-    0.867857,
-    0.866816,
-    0.865776,
-    0.864738,
-    0.8637,
-    0.862665,
-    0.861631,
-    0.8606,
-    0.859571,
-    0.858544,
-    0.857521,
-    0.856501,
-    0.855484,
-    0.85447,
-    0.853461,
-    0.852455,
-    0.851452,
-    0.850454,
-    0.849459,
-    0.848469,
-    0.847483,
-    0.8465,
-    0.845522,
-    0.844548,
-    0.843578,
-    0.842611,
-    0.841648,
-    0.840689,
-    0.839733,
-    0.838781,
-    0.837832,
-    0.836886,
-    0.835943,
-    0.835002,
-    0.834064,
-    0.833128,
-    0.832195,
-    0.831263,
-    0.830332,
-    0.829403,
-    0.828474,
-    0.827547,
-    0.82662,
-    0.825693,
-    0.824767,
-    0.82384,
-    0.822912,
-    0.821984,
-    0.821055,
-    0.820125,
-    0.819193,
-    0.81826,
-    0.817325,
-    0.816388,
-    0.815449,
-    0.814508,
-    0.813564,
-    0.812618,
-    0.811668,
-    0.810716,
-    0.809761,
-    0.808803,
-    0.807842,
-    0.806878,
-    0.805911,
-    0.80494,
-    0.803967,
-    0.80299,
-    0.80201,
-    0.801027,
-    0.800041,
-    0.799052,
-    0.798061,
-    0.797066,
-    0.796069,
-    0.79507,
-    0.794068,
-    0.793064,
-    0.792058,
-    0.79105,
-    0.79004,
-    0.789029,
-    0.788017,
-    0.787004,
-    0.785989,
-    0.784974,
-    0.783958,
-    0.782942,
-    0.781926,
-    0.78091,
-    0.779894,
-    0.778879,
-    0.777864,
-    0.77685,
-    0.775838,
-    0.774826,
-    0.773816,
-    0.772807,
-    0.7718,
-    0.770795,
-    0.769792,
-    0.768791,
-    0.767792,
-    0.766795,
-    0.765801,
-    0.764809,
-    0.76382,
-    0.762833,
-    0.761848,
-    0.760867,
-    0.759888,
-    0.758911,
-    0.757937,
-    0.756966,
-    0.755997,
-    0.755031,
-    0.754067,
-    0.753105,
-    0.752145,
-    0.751188,
-    0.750233,
-    0.749279,
-    0.748327,
-    0.747377,
-    0.746429,
-    0.745481,
-    0.744535,
-    0.74359,
-    0.742646,
-    0.741703,
-    0.74076,
-    0.739817,
-    0.738874,
-    0.737932,
-    0.736989,
-    0.736047,
-    0.735103,
-    0.734159,
-    0.733215,
-    0.732269,
-    0.731322,
-    0.730374,
-    0.729425,
-    0.728474,
-    0.727521,
-    0.726567,
-    0.725611,
-    0.724653,
-    0.723693,
-    0.722731,
-    0.721767,
-    0.720801,
-    0.719833,
-    0.718863,
-    0.71789,
-    0.716915,
-    0.715938,
-    0.714958,
-    0.713977,
-    0.712993,
-    0.712008,
-    0.71102,
-    0.71003,
-    0.709039,
-    0.708045,
-    0.70705,
-    0.706054,
-    0.705056,
-    0.704056,
-    0.703056,
-    0.702054,
-    0.701052,
-    0.700048,
-    0.699044,
-    0.698039,
-    0.697034,
-    0.696029,
-    0.695024,
-    0.694018,
-    0.693013,
-    0.692009,
-    0.691004,
-    0.690001,
-    0.688998,
-    0.687996,
-    0.686995,
-    0.685995,
-    0.684996,
-    0.683999,
-    0.683003,
-    0.682008,
-    0.681016,
-    0.680024,
-    0.679035,
-    0.678048,
-    0.677062,
-    0.676078,
-    0.675096,
-    0.674116,
-    0.673138,
-    0.672162,
-    0.671188,
-    0.670216,
-    0.669246,
-    0.668277,
-    0.667311,
-    0.666346,
-    0.665382,
-    0.664421,
-    0.663461,
-    0.662502,
-    0.661545,
-    0.660588,
-    0.659633,
-    0.658679,
-    0.657726,
-    0.656774,
-    0.655823,
-    0.654871,
-    0.653921,
-    0.65297,
-    0.65202,
-    0.65107,
-    0.65012,
-    0.649169,
-    0.648218,
-    0.647267,
-    0.646315,
-    0.645362,
-    0.644408,
-    0.643454,
-    0.642498,
-    0.641542,
-    0.640584,
-    0.639624,
-    0.638664,
-    0.637702,
-    0.636738,
-    0.635773,
-    0.634806,
-    0.633837,
-    0.632867,
-    0.631895,
-    0.630922,
-    0.629946,
-    0.628969,
-    0.62799,
-    0.62701,
-    0.626027,
-    0.625043,
-    0.624058,
-    0.623071,
-    0.622082,
-    0.621093,
-    0.620101,
-    0.619109,
-    0.618115,
-    0.617121,
-    0.616125,
-    0.615129,
-    0.614131,
-    0.613133,
-    0.612135,
-    0.611136,
-    0.610137,
-    0.609137,
-    0.608138,
-    0.607138,
-    0.606139,
-    0.60514,
-    0.604141,
-    0.603143,
-    0.602146,
-    0.601149,
-    0.600153,
-    0.599158,
-    0.598163,
-    0.59717,
-    0.596178,
-    0.595188,
-    0.594198,
-    0.59321,
-    0.592224,
-    0.591238,
-    0.590255,
-    0.589272,
-    0.588292,
-    0.587313,
-    0.586335,
-    0.585359,
-    0.584385,
-    0.583412,
-    0.582441,
-    0.581471,
-    0.580503,
-    0.579536,
-    0.578571,
-    0.577606,
-    0.576643,
-    0.575682,
-    0.574721,
-    0.573761,
-    0.572803,
-    0.571845,
-    0.570888,
-    0.569931,
-    0.568975,
-    0.56802,
-    0.567065,
-    0.56611,
-    0.565155,
-    0.5642,
-    0.563245,
-    0.56229,
-    0.561335,
-    0.560379,
-    0.559423,
-    0.558466,
-    0.557509,
-    0.55655,
-    0.555591,
-    0.554631,
-    0.55367,
-    0.552708,
-    0.551744,
-    0.55078,
-    0.549814,
-    0.548847,
-    0.547878,
-    0.546908,
-    0.545937,
-    0.544964,
-    0.54399,
-    0.543015,
-    0.542037,
-    0.541059,
-    0.540079,
-    0.539098,
-    0.538115,
-    0.537131,
-    0.536146,
-    0.535159,
-    0.534171,
-    0.533182,
-    0.532192,
-    0.531202,
-    0.53021,
-    0.529217,
-    0.528224,
-    0.52723,
-    0.526235,
-    0.52524,
-    0.524245,
-    0.523249,
-    0.522254,
-    0.521258,
-    0.520262,
-    0.519266,
-    0.518271,
-    0.517275,
-    0.516281,
-    0.515286,
-    0.514293,
-    0.5133,
-    0.512307,
-    0.511316,
-    0.510325,
-    0.509336,
-    0.508347,
-    0.50736,
-    0.506374,
-    0.505389,
-    0.504405,
-    0.503422,
-    0.502441,
-    0.501461,
-    0.500483,
-    0.499506,
-    0.49853,
-    0.497555,
-    0.496582,
-    0.49561,
-    0.49464,
-    0.49367,
-    0.492702,
-    0.491735,
-    0.490769,
-    0.489805,
-    0.488841,
-    0.487878,
-    0.486916,
-    0.485955,
-    0.484995,
-    0.484035,
-    0.483076,
-    0.482117,
-    0.481159,
-    0.480201,
-    0.479243,
-    0.478285,
-    0.477327,
-    0.47637,
-    0.475412,
-    0.474454,
-    0.473495,
-    0.472536,
-    0.471577,
-    0.470617,
-    0.469656,
-    0.468695,
-    0.467733,
-    0.466769,
-    0.465805,
-    0.46484,
-    0.463874,
-    0.462907,
-    0.461939,
-    0.460969,
-    0.459998,
-    0.459026,
-    0.458053,
-    0.457079,
-    0.456103,
-    0.455126,
-    0.454147,
-    0.453168,
-    0.452187,
-    0.451205,
-    0.450222,
-    0.449238,
-    0.448253,
-    0.447266,
-    0.446279,
-    0.445291,
-    0.444302,
-    0.443312,
-    0.442321,
-    0.44133,
-    0.440338,
-    0.439346,
-    0.438353,
-    0.43736,
-    0.436367,
-    0.435373,
-    0.43438,
-    0.433386,
-    0.432393,
-    0.4314,
-    0.430407,
-    0.429414,
-    0.428422,
-    0.427431,
-    0.426439,
-    0.425449,
-    0.42446,
-    0.423471,
-    0.422483,
-    0.421496,
-    0.42051,
-    0.419525,
-    0.418541,
-    0.417558,
-    0.416576,
-    0.415595,
-    0.414616,
-    0.413638,
-    0.412661,
-    0.411685,
-    0.41071,
-    0.409737,
-    0.408764,
-    0.407793,
-    0.406823,
-    0.405854,
-    0.404886,
-    0.403919,
-    0.402953,
-    0.401988,
-    0.401024,
-    0.400061,
-    0.399098,
-    0.398136,
-    0.397174,
-    0.396213,
-    0.395253,
-    0.394293,
-    0.393333,
-    0.392373,
-    0.391413,
-    0.390454,
-    0.389494,
-    0.388534,
-    0.387574,
-    0.386614,
-    0.385653,
-    0.384692,
-    0.38373,
-    0.382768,
-    0.381805,
-    0.380841,
-    0.379877,
-    0.378912,
-    0.377945,
-    0.376978,
-    0.37601,
-    0.375041,
-    0.374071,
-    0.373099,
-    0.372127,
-    0.371154,
-    0.370179,
-    0.369203,
-    0.368226,
-    0.367248,
-    0.366269,
-    0.365288,
-    0.364307,
-    0.363325,
-    0.362341,
-    0.361357,
-    0.360371,
-    0.359385,
-    0.358398,
-    0.35741,
-    0.356422,
-    0.355432,
-    0.354442,
-    0.353452,
-    0.352461,
-    0.35147,
-    0.350479,
-    0.349487,
-    0.348495,
-    0.347503,
-    0.346511,
-    0.345519,
-    0.344528,
-    0.343536,
-    0.342545,
-    0.341555,
-    0.340564,
-    0.339575,
-    0.338586,
-    0.337597,
-    0.33661,
-    0.335623,
-    0.334637,
-    0.333651,
-    0.332667,
-    0.331684,
-    0.330702,
-    0.32972,
-    0.32874,
-    0.327761,
-    0.326783,
-    0.325806,
-    0.32483,
-    0.323855,
-    0.322882,
-    0.321909,
-    0.320938,
-    0.319967,
-    0.318998,
-    0.318029,
-    0.317061,
-    0.316094,
-    0.315128,
-    0.314163,
-    0.313199,
-    0.312235,
-    0.311272,
-    0.310309,
-    0.309347,
-    0.308385,
-    0.307424,
-    0.306462,
-    0.305501,
-    0.30454,
-    0.303579,
-    0.302619,
-    0.301657,
-    0.300696,
-    0.299735,
-    0.298773,
-    0.29781,
-    0.296847,
-    0.295884,
-    0.29492,
-    0.293956,
-    0.29299,
-    0.292024,
-    0.291057,
-    0.290089,
-    0.28912,
-    0.288151,
-    0.28718,
-    0.286208,
-    0.285236,
-    0.284262,
-    0.283287,
-    0.282311,
-    0.281334,
-    0.280356,
-    0.279377,
-    0.278397,
-    0.277416,
-    0.276434,
-    0.275451,
-    0.274468,
-    0.273483,
-    0.272497,
-    0.271511,
-    0.270524,
-    0.269536,
-    0.268548,
-    0.267559,
-    0.26657,
-    0.26558,
-    0.26459,
-    0.263599,
-    0.262609,
-    0.261618,
-    0.260627,
-    0.259636,
-    0.258645,
-    0.257655,
-    0.256664,
-    0.255674,
-    0.254685,
-    0.253695,
-    0.252707,
-    0.251718,
-    0.250731,
-    0.249744,
-    0.248758,
-    0.247772,
-    0.246788,
-    0.245804,
-    0.244821,
-    0.243839,
-    0.242859,
-    0.241879,
-    0.2409,
-    0.239922,
-    0.238945,
-    0.237969,
-    0.236994,
-    0.23602,
-    0.235047,
-    0.234076,
-    0.233105,
-    0.232135,
-    0.231166,
-    0.230198,
-    0.22923,
-    0.228264,
-    0.227298,
-    0.226333,
-    0.225368,
-    0.224404,
-    0.223441,
-    0.222478,
-    0.221515,
-    0.220553,
-    0.219591,
-    0.218629,
-    0.217667,
-    0.216705,
-    0.215743,
-    0.214781,
-    0.213819,
-    0.212857,
-    0.211894,
-    0.210931,
-    0.209967,
-    0.209003,
-    0.208039,
-    0.207073,
-    0.206107,
-    0.205141,
-    0.204173,
-    0.203205,
-    0.202236,
-    0.201266,
-    0.200295,
-    0.199323,
-    0.19835,
-    0.197376,
-    0.196401,
-    0.195425,
-    0.194448,
-    0.19347,
-    0.192492,
-    0.191512,
-    0.190531,
-    0.189549,
-    0.188567,
-    0.187583,
-    0.186599,
-    0.185614,
-    0.184628,
-    0.183642,
-    0.182654,
-    0.181667,
-    0.180678,
-    0.17969,
-    0.178701,
-    0.177711,
-    0.176721,
-    0.175731,
-    0.174741,
-    0.173751,
-    0.172761,
-    0.171771,
-    0.170781,
-    0.169791,
-    0.168802,
-    0.167813,
-    0.166824,
-    0.165836,
-    0.164848,
-    0.163861,
-    0.162875,
-    0.161889,
-    0.160904,
-    0.15992,
-    0.158937,
-    0.157954,
-    0.156973,
-    0.155992,
-    0.155012,
-    0.154033,
-    0.153055,
-    0.152079,
-    0.151103,
-    0.150128,
-    0.149154,
-    0.148181,
-    0.147209,
-    0.146238,
-    0.145268,
-    0.144298,
-    0.14333,
-    0.142362,
-    0.141395,
-    0.140429,
-    0.139463,
-    0.138498,
-    0.137534,
-    0.13657,
-    0.135606,
-    0.134643,
-    0.13368,
-    0.132718,
-    0.131755,
-    0.130793,
-    0.12983,
-    0.128868,
-    0.127906,
-    0.126943,
-    0.12598,
-    0.125017,
-    0.124053,
-    0.123089,
-    0.122125,
-    0.12116,
-    0.120194,
-    0.119228,
-    0.118261,
-    0.117293,
-    0.116324,
-    0.115355,
-    0.114385,
-    0.113413,
-    0.112441,
-    0.111468,
-    0.110494,
-    0.10952,
-    0.108544,
-    0.107567,
-    0.106589,
-    0.10561,
-    0.104631,
-    0.10365,
-    0.102668,
-    0.101686,
-    0.100703,
-    0.0997187,
-    0.0987339,
-    0.0977484,
-    0.0967622,
-    0.0957753,
-    0.0947879,
-    0.0938,
-    0.0928117,
-    0.0918229,
-    0.0908339,
-    0.0898445,
-    0.088855,
-    0.0878653,
-    0.0868755,
-    0.0858858,
-    0.0848961,
-    0.0839066,
-    0.0829173,
-    0.0819282,
-    0.0809395,
-    0.0799512,
-    0.0789633,
-    0.077976,
-    0.0769892,
-    0.076003,
-    0.0750175,
-    0.0740328,
-    0.0730488,
-    0.0720656,
-    0.0710833,
-    0.0701018,
-    0.0691212,
-    0.0681415,
-    0.0671628,
-    0.066185,
-    0.0652081,
-    0.0642322,
-    0.0632573,
-    0.0622833,
-    0.0613103,
-    0.0603382,
-    0.059367,
-    0.0583966,
-    0.0574272,
-    0.0564585,
-    0.0554906,
-    0.0545234,
-    0.053557,
-    0.0525912,
-    0.051626,
-    0.0506613,
-    0.0496971,
-    0.0487333,
-    0.0477699,
-    0.0468068,
-    0.0458439,
-    0.0448811,
-    0.0439185,
-    0.0429559,
-    0.0419933,
-    0.0410306,
-    0.0400677,
-    0.0391045,
-    0.0381411,
-    0.0371773,
-    0.0362131,
-    0.0352484,
-    0.0342831,
-    0.0333173,
-    0.0323508,
-    0.0313837,
-    0.0304157,
-    0.029447,
-    0.0284775,
-    0.0275072,
-    0.026536,
-    0.0255638,
-    0.0245908,
-    0.0236168,
-    0.0226419,
-    0.021666,
-    0.0206891,
-    0.0197113,
-    0.0187326,
-    0.017753,
-    0.0167724,
-    0.0157909,
-    0.0148086,
-    0.0138255,
-    0.0128415,
-    0.0118568,
-    0.0108714,
-    0.00988533,
-    0.00889863,
-    0.00791136,
-    0.00692358,
-    0.00593536,
-    0.00494674,
-    0.00395779,
-    0.00296858,
-    0.00197916,
-    0.000989615
-};
-
-// Top frequency: 44.1K * 0.0290249
-constexpr static std::array<float, 4096> wt_triangle_0x6 =
-{
-    0,
-    -0.00100431,
-    -0.00200858,
-    -0.00301279,
-    -0.00401691,
-    -0.00502089,
-    -0.00602472,
-    -0.00702835,
-    -0.00803176,
-    -0.00903492,
-    -0.0100378,
-    -0.0110403,
-    -0.0120426,
-    -0.0130444,
-    -0.0140458,
-    -0.0150468,
-    -0.0160473,
-    -0.0170474,
-    -0.0180469,
-    -0.0190459,
-    -0.0200443,
-    -0.0210421,
-    -0.0220393,
-    -0.0230359,
-    -0.0240317,
-    -0.0250269,
-    -0.0260214,
-    -0.0270152,
-    -0.0280082,
-    -0.0290004,
-    -0.0299918,
-    -0.0309824,
-    -0.0319722,
-    -0.0329611,
-    -0.0339492,
-    -0.0349365,
-    -0.0359228,
-    -0.0369083,
-    -0.0378928,
-    -0.0388764,
-    -0.0398591,
-    -0.0408409,
-    -0.0418217,
-    -0.0428016,
-    -0.0437805,
-    -0.0447585,
-    -0.0457355,
-    -0.0467116,
-    -0.0476867,
-    -0.0486609,
-    -0.0496341,
-    -0.0506064,
-    -0.0515777,
-    -0.0525481,
-    -0.0535175,
-    -0.054486,
-    -0.0554536,
-    -0.0564203,
-    -0.0573861,
-    -0.058351,
-    -0.0593151,
-    -0.0602782,
-    -0.0612406,
-    -0.0622021,
-    -0.0631628,
-    -0.0641226,
-    -0.0650818,
-    -0.0660401,
-    -0.0669977,
-    -0.0679546,
-    -0.0689108,
-    -0.0698663,
-    -0.0708212,
-    -0.0717755,
-    -0.0727291,
-    -0.0736822,
-    -0.0746347,
-    -0.0755867,
-    -0.0765382,
-    -0.0774892,
-    -0.0784398,
-    -0.07939,
-    -0.0803398,
-    -0.0812892,
-    -0.0822384,
-    -0.0831872,
-    -0.0841358,
-    -0.0850841,
-    -0.0860323,
-    -0.0869803,
-    -0.0879281,
-    -0.0888759,
-    -0.0898236,
-    -0.0907712,
-    -0.0917189,
-    -0.0926666,
-    -0.0936143,
-    -0.0945622,
-    -0.0955101,
-    -0.0964582,
-    -0.0974066,
-    -0.0983551,
-    -0.0993039,
-    -0.100253,
-    -0.101202,
-    -0.102152,
-    -0.103102,
-    -0.104053,
-    -0.105004,
-    -0.105955,
-    -0.106907,
-    -0.10786,
-    -0.108813,
-    -0.109766,
-    -0.11072,
-    -0.111675,
-    -0.112631,
-    -0.113587,
-    -0.114543,
-    -0.115501,
-    -0.116459,
-    -0.117418,
-    -0.118378,
-    -0.119339,
-    -0.1203,
-    -0.121263,
-    -0.122226,
-    -0.12319,
-    -0.124155,
-    -0.125121,
-    -0.126087,
-    -0.127055,
-    -0.128024,
-    -0.128993,
-    -0.129964,
-    -0.130935,
-    -0.131907,
-    -0.132881,
-    -0.133855,
-    -0.13483,
-    -0.135807,
-    -0.136784,
-    -0.137762,
-    -0.138741,
-    -0.139721,
-    -0.140703,
-    -0.141685,
-    -0.142668,
-    -0.143652,
-    -0.144637,
-    -0.145623,
-    -0.146609,
-    -0.147597,
-    -0.148586,
-    -0.149575,
-    -0.150565,
-    -0.151557,
-    -0.152549,
-    -0.153541,
-    -0.154535,
-    -0.15553,
-    -0.156525,
-    -0.157521,
-    -0.158517,
-    -0.159515,
-    -0.160513,
-    -0.161511,
-    -0.162511,
-    -0.16351,
-    -0.164511,
-    -0.165512,
-    -0.166513,
-    -0.167515,
-    -0.168518,
-    -0.16952,
-    -0.170524,
-    -0.171527,
-    -0.172531,
-    -0.173536,
-    -0.17454,
-    -0.175545,
-    -0.17655,
-    -0.177555,
-    -0.17856,
-    -0.179565,
-    -0.180571,
-    -0.181576,
-    -0.182582,
-    -0.183587,
-    -0.184593,
-    -0.185598,
-    -0.186603,
-    -0.187608,
-    -0.188613,
-    -0.189618,
-    -0.190622,
-    -0.191626,
-    -0.19263,
-    -0.193633,
-    -0.194636,
-    -0.195639,
-    -0.196641,
-    -0.197642,
-    -0.198644,
-    -0.199644,
-    -0.200644,
-    -0.201644,
-    -0.202642,
-    -0.20364,
-    -0.204638,
-    -0.205635,
-    -0.206631,
-    -0.207626,
-    -0.208621,
-    -0.209614,
-    -0.210607,
-    -0.211599,
-    -0.212591,
-    -0.213581,
-    -0.21457,
-    -0.215559,
-    -0.216547,
-    -0.217533,
-    -0.218519,
-    -0.219504,
-    -0.220488,
-    -0.221471,
-    -0.222453,
-    -0.223434,
-    -0.224413,
-    -0.225392,
-    -0.22637,
-    -0.227347,
-    -0.228323,
-    -0.229298,
-    -0.230272,
-    -0.231244,
-    -0.232216,
-    -0.233187,
-    -0.234157,
-    -0.235126,
-    -0.236093,
-    -0.23706,
-    -0.238026,
-    -0.238991,
-    -0.239955,
-    -0.240918,
-    -0.24188,
-    -0.242841,
-    -0.243801,
-    -0.244761,
-    -0.245719,
-    -0.246677,
-    -0.247634,
-    -0.24859,
-    -0.249545,
-    -0.250499,
-    -0.251453,
-    -0.252406,
-    -0.253359,
-    -0.254311,
-    -0.255262,
-    -0.256212,
-    -0.257162,
-    -0.258112,
-    -0.259061,
-    -0.260009,
-    -0.260957,
-    -0.261905,
-    -0.262852,
-    -0.263799,
-    -0.264745,
-    -0.265691,
-    -0.266637,
-    -0.267583,
-    -0.268529,
-    -0.269474,
-    -0.270419,
-    -0.271364,
-    -0.27231,
-    -0.273255,
-    -0.2742,
-    -0.275145,
-    -0.276091,
-    -0.277036,
-    -0.277982,
-    -0.278928,
-    -0.279874,
-    -0.28082,
-    -0.281767,
-    -0.282714,
-    -0.283661,
-    -0.284609,
-    -0.285557,
-    -0.286506,
-    -0.287455,
-    -0.288405,
-    -0.289355,
-    -0.290306,
-    -0.291257,
-    -0.29221,
-    -0.293162,
-    -0.294116,
-    -0.29507,
-    -0.296025,
-    -0.296981,
-    -0.297938,
-    -0.298896,
-    -0.299854,
-    -0.300813,
-    -0.301773,
-    -0.302735,
-    -0.303697,
-    -0.30466,
-    -0.305624,
-    -0.306589,
-    -0.307555,
-    -0.308522,
-    -0.30949,
-    -0.310459,
-    -0.311429,
-    -0.3124,
-    -0.313372,
-    -0.314345,
-    -0.31532,
-    -0.316295,
-    -0.317272,
-    -0.31825,
-    -0.319228,
-    -0.320208,
-    -0.321189,
-    -0.322171,
-    -0.323154,
-    -0.324138,
-    -0.325123,
-    -0.32611,
-    -0.327097,
-    -0.328085,
-    -0.329075,
-    -0.330065,
-    -0.331056,
-    -0.332049,
-    -0.333042,
-    -0.334036,
-    -0.335031,
-    -0.336027,
-    -0.337024,
-    -0.338022,
-    -0.33902,
-    -0.34002,
-    -0.34102,
-    -0.342021,
-    -0.343023,
-    -0.344025,
-    -0.345028,
-    -0.346032,
-    -0.347036,
-    -0.348041,
-    -0.349047,
-    -0.350053,
-    -0.351059,
-    -0.352066,
-    -0.353073,
-    -0.354081,
-    -0.355089,
-    -0.356098,
-    -0.357106,
-    -0.358115,
-    -0.359124,
-    -0.360134,
-    -0.361143,
-    -0.362153,
-    -0.363162,
-    -0.364172,
-    -0.365181,
-    -0.366191,
-    -0.3672,
-    -0.368209,
-    -0.369218,
-    -0.370227,
-    -0.371236,
-    -0.372244,
-    -0.373252,
-    -0.37426,
-    -0.375267,
-    -0.376274,
-    -0.37728,
-    -0.378286,
-    -0.379291,
-    -0.380296,
-    -0.3813,
-    -0.382303,
-    -0.383306,
-    -0.384308,
-    -0.385309,
-    -0.38631,
-    -0.38731,
-    -0.388308,
-    -0.389306,
-    -0.390304,
-    -0.3913,
-    -0.392295,
-    -0.393289,
-    -0.394283,
-    -0.395275,
-    -0.396266,
-    -0.397257,
-    -0.398246,
-    -0.399234,
-    -0.400221,
-    -0.401207,
-    -0.402192,
-    -0.403175,
-    -0.404158,
-    -0.405139,
-    -0.406119,
-    -0.407098,
-    -0.408076,
-    -0.409053,
-    -0.410028,
-    -0.411002,
-    -0.411975,
-    -0.412947,
-    -0.413918,
-    -0.414887,
-    -0.415856,
-    -0.416823,
-    -0.417789,
-    -0.418753,
-    -0.419717,
-    -0.42068,
-    -0.421641,
-    -0.422601,
-    -0.423561,
-    -0.424519,
-    -0.425476,
-    -0.426432,
-    -0.427387,
-    -0.428341,
-    -0.429294,
-    -0.430246,
-    -0.431197,
-    -0.432147,
-    -0.433097,
-    -0.434045,
-    -0.434993,
-    -0.43594,
-    -0.436886,
-    -0.437832,
-    -0.438776,
-    -0.439721,
-    -0.440664,
-    -0.441607,
-    -0.44255,
-    -0.443491,
-    -0.444433,
-    -0.445374,
-    -0.446315,
-    -0.447255,
-    -0.448195,
-    -0.449134,
-    -0.450074,
-    -0.451013,
-    -0.451952,
-    -0.452891,
-    -0.45383,
-    -0.454769,
-    -0.455708,
-    -0.456647,
-    -0.457586,
-    -0.458526,
-    -0.459465,
-    -0.460405,
-    -0.461345,
-    -0.462285,
-    -0.463226,
-    -0.464167,
-    -0.465108,
-    -0.46605,
-    -0.466993,
-    -0.467936,
-    -0.46888,
-    -0.469824,
-    -0.470769,
-    -0.471715,
-    -0.472661,
-    -0.473609,
-    -0.474557,
-    -0.475506,
-    -0.476456,
-    -0.477407,
-    -0.478358,
-    -0.479311,
-    -0.480265,
-    -0.48122,
-    -0.482176,
-    -0.483133,
-    -0.484091,
-    -0.48505,
-    -0.486011,
-    -0.486973,
-    -0.487936,
-    -0.4889,
-    -0.489865,
-    -0.490832,
-    -0.4918,
-    -0.492769,
-    -0.49374,
-    -0.494711,
-    -0.495685,
-    -0.496659,
-    -0.497635,
-    -0.498612,
-    -0.499591,
-    -0.500571,
-    -0.501552,
-    -0.502535,
-    -0.503519,
-    -0.504504,
-    -0.505491,
-    -0.506478,
-    -0.507468,
-    -0.508458,
-    -0.50945,
-    -0.510443,
-    -0.511438,
-    -0.512433,
-    -0.51343,
-    -0.514428,
-    -0.515428,
-    -0.516428,
-    -0.51743,
-    -0.518432,
-    -0.519436,
-    -0.520441,
-    -0.521447,
-    -0.522454,
-    -0.523462,
-    -0.52447,
-    -0.52548,
-    -0.526491,
-    -0.527502,
-    -0.528514,
-    -0.529527,
-    -0.530541,
-    -0.531555,
-    -0.53257,
-    -0.533585,
-    -0.534601,
-    -0.535618,
-    -0.536635,
-    -0.537652,
-    -0.53867,
-    -0.539688,
-    -0.540706,
-    -0.541725,
-    -0.542743,
-    -0.543762,
-    -0.544781,
-    -0.5458,
-    -0.546819,
-    -0.547838,
-    -0.548857,
-    -0.549875,
-    -0.550893,
-    -0.551912,
-    -0.552929,
-    -0.553947,
-    -0.554964,
-    -0.55598,
-    -0.556996,
-    -0.558012,
-    -0.559026,
-    -0.560041,
-    -0.561054,
-    -0.562067,
-    -0.563079,
-    -0.56409,
-    -0.5651,
-    -0.566109,
-    -0.567118,
-    -0.568125,
-    -0.569131,
-    -0.570136,
-    -0.571141,
-    -0.572143,
-    -0.573145,
-    -0.574146,
-    -0.575145,
-    -0.576143,
-    -0.57714,
-    -0.578135,
-    -0.579129,
-    -0.580121,
-    -0.581113,
-    -0.582102,
-    -0.58309,
-    -0.584077,
-    -0.585062,
-    -0.586046,
-    -0.587028,
-    -0.588009,
-    -0.588988,
-    -0.589965,
-    -0.590941,
-    -0.591915,
-    -0.592888,
-    -0.593859,
-    -0.594829,
-    -0.595797,
-    -0.596763,
-    -0.597728,
-    -0.598691,
-    -0.599652,
-    -0.600612,
-    -0.601571,
-    -0.602528,
-    -0.603483,
-    -0.604437,
-    -0.60539,
-    -0.606341,
-    -0.60729,
-    -0.608238,
-    -0.609185,
-    -0.610131,
-    -0.611075,
-    -0.612017,
-    -0.612959,
-    -0.613899,
-    -0.614838,
-    -0.615776,
-    -0.616713,
-    -0.617649,
-    -0.618583,
-    -0.619517,
-    -0.62045,
-    -0.621382,
-    -0.622313,
-    -0.623243,
-    -0.624172,
-    -0.625101,
-    -0.626029,
-    -0.626956,
-    -0.627883,
-    -0.62881,
-    -0.629736,
-    -0.630661,
-    -0.631586,
-    -0.632511,
-    -0.633436,
-    -0.634361,
-    -0.635285,
-    -0.63621,
-    -0.637134,
-    -0.638059,
-    -0.638984,
-    -0.639908,
-    -0.640834,
-    -0.641759,
-    -0.642685,
-    -0.643611,
-    -0.644538,
-    -0.645466,
-    -0.646394,
-    -0.647322,
-    -0.648252,
-    -0.649182,
-    -0.650113,
-    -0.651045,
-    -0.651978,
-    -0.652912,
-    -0.653847,
-    -0.654783,
-    -0.65572,
-    -0.656659,
-    -0.657599,
-    -0.65854,
-    -0.659482,
-    -0.660426,
-    -0.661372,
-    -0.662319,
-    -0.663267,
-    -0.664217,
-    -0.665169,
-    -0.666122,
-    -0.667077,
-    -0.668034,
-    -0.668992,
-    -0.669953,
-    -0.670915,
-    -0.671879,
-    -0.672845,
-    -0.673813,
-    -0.674782,
-    -0.675754,
-    -0.676727,
-    -0.677703,
-    -0.67868,
-    -0.67966,
-    -0.680641,
-    -0.681625,
-    -0.68261,
-    -0.683597,
-    -0.684587,
-    -0.685578,
-    -0.686572,
-    -0.687567,
-    -0.688564,
-    -0.689564,
-    -0.690565,
-    -0.691568,
-    -0.692573,
-    -0.69358,
-    -0.694589,
-    -0.695599,
-    -0.696612,
-    -0.697626,
-    -0.698642,
-    -0.699659,
-    -0.700678,
-    -0.701699,
-    -0.702721,
-    -0.703745,
-    -0.704771,
-    -0.705798,
-    -0.706826,
-    -0.707855,
-    -0.708886,
-    -0.709918,
-    -0.710951,
-    -0.711986,
-    -0.713021,
-    -0.714057,
-    -0.715095,
-    -0.716133,
-    -0.717171,
-    -0.718211,
-    -0.719251,
-    -0.720292,
-    -0.721333,
-    -0.722375,
-    -0.723417,
-    -0.72446,
-    -0.725502,
-    -0.726545,
-    -0.727588,
-    -0.72863,
-    -0.729673,
-    -0.730716,
-    -0.731758,
-    -0.7328,
-    -0.733841,
-    -0.734882,
-    -0.735923,
-    -0.736962,
-    -0.738001,
-    -0.73904,
-    -0.740077,
-    -0.741113,
-    -0.742149,
-    -0.743183,
-    -0.744216,
-    -0.745248,
-    -0.746278,
-    -0.747307,
-    -0.748335,
-    -0.749361,
-    -0.750385,
-    -0.751408,
-    -0.752428,
-    -0.753448,
-    -0.754465,
-    -0.75548,
-    -0.756493,
-    -0.757504,
-    -0.758513,
-    -0.75952,
-    -0.760525,
-    -0.761527,
-    -0.762527,
-    -0.763525,
-    -0.76452,
-    -0.765512,
-    -0.766503,
-    -0.76749,
-    -0.768475,
-    -0.769458,
-    -0.770438,
-    -0.771415,
-    -0.77239,
-    -0.773362,
-    -0.774331,
-    -0.775297,
-    -0.776261,
-    -0.777222,
-    -0.77818,
-    -0.779135,
-    -0.780088,
-    -0.781038,
-    -0.781985,
-    -0.78293,
-    -0.783872,
-    -0.784811,
-    -0.785747,
-    -0.786681,
-    -0.787612,
-    -0.788541,
-    -0.789467,
-    -0.79039,
-    -0.791311,
-    -0.79223,
-    -0.793146,
-    -0.79406,
-    -0.794972,
-    -0.795881,
-    -0.796788,
-    -0.797693,
-    -0.798597,
-    -0.799498,
-    -0.800397,
-    -0.801294,
-    -0.80219,
-    -0.803084,
-    -0.803976,
-    -0.804867,
-    -0.805756,
-    -0.806645,
-    -0.807531,
-    -0.808417,
-    -0.809302,
-    -0.810186,
-    -0.811068,
-    -0.811951,
-    -0.812832,
-    -0.813713,
-    -0.814594,
-    -0.815474,
-    -0.816354,
-    -0.817234,
-    -0.818114,
-    -0.818994,
-    -0.819874,
-    -0.820755,
-    -0.821636,
-    -0.822518,
-    -0.8234,
-    -0.824284,
-    -0.825168,
-    -0.826053,
-    -0.82694,
-    -0.827828,
-    -0.828717,
-    -0.829608,
-    -0.830501,
-    -0.831395,
-    -0.832292,
-    -0.83319,
-    -0.834091,
-    -0.834993,
-    -0.835899,
-    -0.836806,
-    -0.837717,
-    -0.83863,
-    -0.839545,
-    -0.840464,
-    -0.841386,
-    -0.842311,
-    -0.843239,
-    -0.844171,
-    -0.845105,
-    -0.846044,
-    -0.846986,
-    -0.847932,
-    -0.848881,
-    -0.849834,
-    -0.850792,
-    -0.851753,
-    -0.852718,
-    -0.853688,
-    -0.854661,
-    -0.855639,
-    -0.856622,
-    -0.857608,
-    -0.858599,
-    -0.859594,
-    -0.860594,
-    -0.861599,
-    -0.862608,
-    -0.863621,
-    -0.864639,
-    -0.865662,
-    -0.866689,
-    -0.867721,
-    -0.868757,
-    -0.869798,
-    -0.870843,
-    -0.871893,
-    -0.872948,
-    -0.874007,
-    -0.875071,
-    -0.876138,
-    -0.877211,
-    -0.878287,
-    -0.879368,
-    -0.880453,
-    -0.881542,
-    -0.882635,
-    -0.883732,
-    -0.884833,
-    -0.885938,
-    -0.887046,
-    -0.888158,
-    -0.889273,
-    -0.890392,
-    -0.891513,
-    -0.892638,
-    -0.893766,
-    -0.894897,
-    -0.89603,
-    -0.897166,
-    -0.898304,
-    -0.899444,
-    -0.900586,
-    -0.90173,
-    -0.902876,
-    -0.904023,
-    -0.905171,
-    -0.906321,
-    -0.907471,
-    -0.908622,
-    -0.909773,
-    -0.910924,
-    -0.912076,
-    -0.913227,
-    -0.914378,
-    -0.915528,
-    -0.916677,
-    -0.917825,
-    -0.918971,
-    -0.920116,
-    -0.921258,
-    -0.922399,
-    -0.923537,
-    -0.924672,
-    -0.925804,
-    -0.926933,
-    -0.928058,
-    -0.929179,
-    -0.930296,
-    -0.931409,
-    -0.932516,
-    -0.933619,
-    -0.934717,
-    -0.935808,
-    -0.936894,
-    -0.937974,
-    -0.939047,
-    -0.940113,
-    -0.941172,
-    -0.942224,
-    -0.943267,
-    -0.944303,
-    -0.94533,
-    -0.946349,
-    -0.947358,
-    -0.948359,
-    -0.949349,
-    -0.95033,
-    -0.951301,
-    -0.95226,
-    -0.953209,
-    -0.954147,
-    -0.955074,
-    -0.955988,
-    -0.956891,
-    -0.957781,
-    -0.958659,
-    -0.959523,
-    -0.960375,
-    -0.961213,
-    -0.962037,
-    -0.962847,
-    -0.963642,
-    -0.964423,
-    -0.96519,
-    -0.965941,
-    -0.966676,
-    -0.967396,
-    -0.9681,
-    -0.968788,
-    -0.969459,
-    -0.970113,
-    -0.970751,
-    -0.971372,
-    -0.971975,
-    -0.972561,
-    -0.973128,
-    -0.973678,
-    -0.97421,
-    -0.974723,
-    -0.975218,
-    -0.975694,
-    -0.976151,
-    -0.976589,
-    -0.977008,
-    -0.977407,
-    -0.977786,
-    -0.978146,
-    -0.978487,
-    -0.978807,
-    -0.979107,
-    -0.979387,
-    -0.979646,
-    -0.979885,
-    -0.980104,
-    -0.980302,
-    -0.98048,
-    -0.980636,
-    -0.980772,
-    -0.980887,
-    -0.980982,
-    -0.981055,
-    -0.981107,
-    -0.981139,
-    -0.981149,
-    -0.981139,
-    -0.981107,
-    -0.981055,
-    -0.980982,
-    -0.980887,
-    -0.980772,
-    -0.980636,
-    -0.98048,
-    -0.980302,
-    -0.980104,
-    -0.979885,
-    -0.979646,
-    -0.979387,
-    -0.979107,
-    -0.978807,
-    -0.978487,
-    -0.978146,
-    -0.977786,
-    -0.977407,
-    -0.977008,
-    -0.976589,
-    -0.976151,
-    -0.975694,
-    -0.975218,
-    -0.974723,
-    -0.97421,
-    -0.973678,
-    -0.973128,
-    -0.972561,
-    -0.971975,
-    -0.971372,
-    -0.970751,
-    -0.970113,
-    -0.969459,
-    -0.968788,
-    -0.9681,
-    -0.967396,
-    -0.966676,
-    -0.965941,
-    -0.96519,
-    -0.964423,
-    -0.963642,
-    -0.962847,
-    -0.962037,
-    -0.961213,
-    -0.960375,
-    -0.959523,
-    -0.958659,
-    -0.957781,
-    -0.956891,
-    -0.955988,
-    -0.955074,
-    -0.954147,
-    -0.953209,
-    -0.95226,
-    -0.951301,
-    -0.95033,
-    -0.949349,
-    -0.948359,
-    -0.947358,
-    -0.946349,
-    -0.94533,
-    -0.944303,
-    -0.943267,
-    -0.942224,
-    -0.941172,
-    -0.940113,
-    -0.939047,
-    -0.937974,
-    -0.936894,
-    -0.935808,
-    -0.934717,
-    -0.933619,
-    -0.932516,
-    -0.931409,
-    -0.930296,
-    -0.929179,
-    -0.928058,
-    -0.926933,
-    -0.925804,
-    -0.924672,
-    -0.923537,
-    -0.922399,
-    -0.921258,
-    -0.920116,
-    -0.918971,
-    -0.917825,
-    -0.916677,
-    -0.915528,
-    -0.914378,
-    -0.913227,
-    -0.912076,
-    -0.910924,
-    -0.909773,
-    -0.908622,
-    -0.907471,
-    -0.906321,
-    -0.905171,
-    -0.904023,
-    -0.902876,
-    -0.90173,
-    -0.900586,
-    -0.899444,
-    -0.898304,
-    -0.897166,
-    -0.89603,
-    -0.894897,
-    -0.893766,
-    -0.892638,
-    -0.891513,
-    -0.890392,
-    -0.889273,
-    -0.888158,
-    -0.887046,
-    -0.885938,
-    -0.884833,
-    -0.883732,
-    -0.882635,
-    -0.881542,
-    -0.880453,
-    -0.879368,
-    -0.878287,
-    -0.877211,
-    -0.876138,
-    -0.875071,
-    -0.874007,
-    -0.872948,
-    -0.871893,
-    -0.870843,
-    -0.869798,
-    -0.868757,
-    -0.867721,
-    -0.866689,
-    -0.865662,
-    -0.864639,
-    -0.863621,
-    -0.862608,
-    -0.861599,
-    -0.860594,
-    -0.859594,
-    -0.858599,
-    -0.857608,
-    -0.856622,
-    -0.855639,
-    -0.854661,
-    -0.853688,
-    -0.852718,
-    -0.851753,
-    -0.850792,
-    -0.849834,
-    -0.848881,
-    -0.847932,
-    -0.846986,
-    -0.846044,
-    -0.845105,
-    -0.844171,
-    -0.843239,
-    -0.842311,
-    -0.841386,
-    -0.840464,
-    -0.839545,
-    -0.83863,
-    -0.837717,
-    -0.836806,
-    -0.835899,
-    -0.834993,
-    -0.834091,
-    -0.83319,
-    -0.832292,
-    -0.831395,
-    -0.830501,
-    -0.829608,
-    -0.828717,
-    -0.827828,
-    -0.82694,
-    -0.826053,
-    -0.825168,
-    -0.824284,
-    -0.8234,
-    -0.822518,
-    -0.821636,
-    -0.820755,
-    -0.819874,
-    -0.818994,
-    -0.818114,
-    -0.817234,
-    -0.816354,
-    -0.815474,
-    -0.814594,
-    -0.813713,
-    -0.812832,
-    -0.811951,
-    -0.811068,
-    -0.810186,
-    -0.809302,
-    -0.808417,
-    -0.807531,
-    -0.806645,
-    -0.805756,
-    -0.804867,
-    -0.803976,
-    -0.803084,
-    -0.80219,
-    -0.801294,
-    -0.800397,
-    -0.799498,
-    -0.798597,
-    -0.797693,
-    -0.796788,
-    -0.795881,
-    -0.794972,
-    -0.79406,
-    -0.793146,
-    -0.79223,
-    -0.791311,
-    -0.79039,
-    -0.789467,
-    -0.788541,
-    -0.787612,
-    -0.786681,
-    -0.785747,
-    -0.784811,
-    -0.783872,
-    -0.78293,
-    -0.781985,
-    -0.781038,
-    -0.780088,
-    -0.779135,
-    -0.77818,
-    -0.777222,
-    -0.776261,
-    -0.775297,
-    -0.774331,
-    -0.773362,
-    -0.77239,
-    -0.771415,
-    -0.770438,
-    -0.769458,
-    -0.768475,
-    -0.76749,
-    -0.766503,
-    -0.765512,
-    -0.76452,
-    -0.763525,
-    -0.762527,
-    -0.761527,
-    -0.760525,
-    -0.75952,
-    -0.758513,
-    -0.757504,
-    -0.756493,
-    -0.75548,
-    -0.754465,
-    -0.753448,
-    -0.752428,
-    -0.751408,
-    -0.750385,
-    -0.749361,
-    -0.748335,
-    -0.747307,
-    -0.746278,
-    -0.745248,
-    -0.744216,
-    -0.743183,
-    -0.742149,
-    -0.741113,
-    -0.740077,
-    -0.73904,
-    -0.738001,
-    -0.736962,
-    -0.735923,
-    -0.734882,
-    -0.733841,
-    -0.7328,
-    -0.731758,
-    -0.730716,
-    -0.729673,
-    -0.72863,
-    -0.727588,
-    -0.726545,
-    -0.725502,
-    -0.72446,
-    -0.723417,
-    -0.722375,
-    -0.721333,
-    -0.720292,
-    -0.719251,
-
-    -0.718211,
-    -0.717171,
-    -0.716133,
-    -0.715095,
-    -0.714057,
-    -0.713021,
-    -0.711986,
-    -0.710951,
-    -0.709918,
-    -0.708886,
-    -0.707855,
-    -0.706826,
-    -0.705798,
-    -0.704771,
-    -0.703745,
-    -0.702721,
-    -0.701699,
-    -0.700678,
-    -0.699659,
-    -0.698642,
-    -0.697626,
-    -0.696612,
-    -0.695599,
-    -0.694589,
-    -0.69358,
-    -0.692573,
-    -0.691568,
-    -0.690565,
-    -0.689564,
-    -0.688564,
-    -0.687567,
-    -0.686572,
-    -0.685578,
-    -0.684587,
-    -0.683597,
-    -0.68261,
-    -0.681625,
-    -0.680641,
-    -0.67966,
-    -0.67868,
-    -0.677703,
-    -0.676727,
-    -0.675754,
-    -0.674782,
-    -0.673813,
-    -0.672845,
-    -0.671879,
-    -0.670915,
-    -0.669953,
-    -0.668992,
-    -0.668034,
-    -0.667077,
-    -0.666122,
-    -0.665169,
-    -0.664217,
-    -0.663267,
-    -0.662319,
-    -0.661372,
-    -0.660426,
-    -0.659482,
-    -0.65854,
-    -0.657599,
-    -0.656659,
-    -0.65572,
-    -0.654783,
-    -0.653847,
-    -0.652912,
-    -0.651978,
-    -0.651045,
-    -0.650113,
-    -0.649182,
-    -0.648252,
-    -0.647322,
-    -0.646394,
-    -0.645466,
-    -0.644538,
-    -0.643611,
-    -0.642685,
-    -0.641759,
-    -0.640834,
-    -0.639908,
-    -0.638984,
-    -0.638059,
-    -0.637134,
-    -0.63621,
-    -0.635285,
-    -0.634361,
-    -0.633436,
-    -0.632511,
-    -0.631586,
-    -0.630661,
-    -0.629736,
-    -0.62881,
-    -0.627883,
-    -0.626956,
-    -0.626029,
-    -0.625101,
-    -0.624172,
-    -0.623243,
-    -0.622313,
-    -0.621382,
-    -0.62045,
-    -0.619517,
-    -0.618583,
-    -0.617649,
-    -0.616713,
-    -0.615776,
-    -0.614838,
-    -0.613899,
-    -0.612959,
-    -0.612017,
-    -0.611075,
-    -0.610131,
-    -0.609185,
-    -0.608238,
-    -0.60729,
-    -0.606341,
-    -0.60539,
-    -0.604437,
-    -0.603483,
-    -0.602528,
-    -0.601571,
-    -0.600612,
-    -0.599652,
-    -0.598691,
-    -0.597728,
-    -0.596763,
-    -0.595797,
-    -0.594829,
-    -0.593859,
-    -0.592888,
-    -0.591915,
-    -0.590941,
-    -0.589965,
-    -0.588988,
-    -0.588009,
-    -0.587028,
-    -0.586046,
-    -0.585062,
-    -0.584077,
-    -0.58309,
-    -0.582102,
-    -0.581113,
-    -0.580121,
-    -0.579129,
-    -0.578135,
-    -0.57714,
-    -0.576143,
-    -0.575145,
-    -0.574146,
-    -0.573145,
-    -0.572143,
-    -0.571141,
-    -0.570136,
-    -0.569131,
-    -0.568125,
-    -0.567118,
-    -0.566109,
-    -0.5651,
-    -0.56409,
-    -0.563079,
-    -0.562067,
-    -0.561054,
-    -0.560041,
-    -0.559026,
-    -0.558012,
-    -0.556996,
-    -0.55598,
-    -0.554964,
-    -0.553947,
-    -0.552929,
-    -0.551912,
-    -0.550893,
-    -0.549875,
-    -0.548857,
-    -0.547838,
-    -0.546819,
-    -0.5458,
-    -0.544781,
-    -0.543762,
-    -0.542743,
-    -0.541725,
-    -0.540706,
-    -0.539688,
-    -0.53867,
-    -0.537652,
-    -0.536635,
-    -0.535618,
-    -0.534601,
-    -0.533585,
-    -0.53257,
-    -0.531555,
-    -0.530541,
-    -0.529527,
-    -0.528514,
-    -0.527502,
-    -0.526491,
-    -0.52548,
-    -0.52447,
-    -0.523462,
-    -0.522454,
-    -0.521447,
-    -0.520441,
-    -0.519436,
-    -0.518432,
-    -0.51743,
-    -0.516428,
-    -0.515428,
-    -0.514428,
-    -0.51343,
-    -0.512433,
-    -0.511438,
-    -0.510443,
-    -0.50945,
-    -0.508458,
-    -0.507468,
-    -0.506478,
-    -0.505491,
-    -0.504504,
-    -0.503519,
-    -0.502535,
-    -0.501552,
-    -0.500571,
-    -0.499591,
-    -0.498612,
-    -0.497635,
-    -0.496659,
-    -0.495685,
-    -0.494711,
-    -0.49374,
-    -0.492769,
-    -0.4918,
-    -0.490832,
-    -0.489865,
-    -0.4889,
-    -0.487936,
-    -0.486973,
-    -0.486011,
-    -0.48505,
-    -0.484091,
-    -0.483133,
-    -0.482176,
-    -0.48122,
-    -0.480265,
-    -0.479311,
-    -0.478358,
-    -0.477407,
-    -0.476456,
-    -0.475506,
-    -0.474557,
-    -0.473609,
-    -0.472661,
-    -0.471715,
-    -0.470769,
-    -0.469824,
-    -0.46888,
-    -0.467936,
-    -0.466993,
-    -0.46605,
-    -0.465108,
-    -0.464167,
-    -0.463226,
-    -0.462285,
-    -0.461345,
-    -0.460405,
-    -0.459465,
-    -0.458526,
-    -0.457586,
-    -0.456647,
-    -0.455708,
-    -0.454769,
-    -0.45383,
-    -0.452891,
-    -0.451952,
-    -0.451013,
-    -0.450074,
-    -0.449134,
-    -0.448195,
-    -0.447255,
-    -0.446315,
-    -0.445374,
-    -0.444433,
-    -0.443491,
-    -0.44255,
-    -0.441607,
-    -0.440664,
-    -0.439721,
-    -0.438776,
-    -0.437832,
-    -0.436886,
-    -0.43594,
-    -0.434993,
-    -0.434045,
-    -0.433097,
-    -0.432147,
-    -0.431197,
-    -0.430246,
-    -0.429294,
-    -0.428341,
-    -0.427387,
-    -0.426432,
-    -0.425476,
-    -0.424519,
-    -0.423561,
-    -0.422601,
-    -0.421641,
-    -0.42068,
-    -0.419717,
-    -0.418753,
-    -0.417789,
-    -0.416823,
-    -0.415856,
-    -0.414887,
-    -0.413918,
-    -0.412947,
-    -0.411975,
-    -0.411002,
-    -0.410028,
-    -0.409053,
-    -0.408076,
-    -0.407098,
-    -0.406119,
-    -0.405139,
-    -0.404158,
-    -0.403175,
-    -0.402192,
-    -0.401207,
-    -0.400221,
-    -0.399234,
-    -0.398246,
-    -0.397257,
-    -0.396266,
-    -0.395275,
-    -0.394283,
-    -0.393289,
-    -0.392295,
-    -0.3913,
-    -0.390304,
-    -0.389306,
-    -0.388308,
-    -0.38731,
-    -0.38631,
-    -0.385309,
-    -0.384308,
-    -0.383306,
-    -0.382303,
-    -0.3813,
-    -0.380296,
-    -0.379291,
-    -0.378286,
-    -0.37728,
-    -0.376274,
-    -0.375267,
-    -0.37426,
-    -0.373252,
-    -0.372244,
-    -0.371236,
-    -0.370227,
-    -0.369218,
-    -0.368209,
-    -0.3672,
-    -0.366191,
-    -0.365181,
-    -0.364172,
-    -0.363162,
-    -0.362153,
-    -0.361143,
-    -0.360134,
-    -0.359124,
-    -0.358115,
-    -0.357106,
-    -0.356098,
-    -0.355089,
-    -0.354081,
-    -0.353073,
-    -0.352066,
-    -0.351059,
-    -0.350053,
-    -0.349047,
-    -0.348041,
-    -0.347036,
-    -0.346032,
-    -0.345028,
-    -0.344025,
-    -0.343023,
-    -0.342021,
-    -0.34102,
-    -0.34002,
-    -0.33902,
-    -0.338022,
-    -0.337024,
-    -0.336027,
-    -0.335031,
-    -0.334036,
-    -0.333042,
-    -0.332049,
-    -0.331056,
-    -0.330065,
-    -0.329075,
-    -0.328085,
-    -0.327097,
-    -0.32611,
-    -0.325123,
-    -0.324138,
-    -0.323154,
-    -0.322171,
-    -0.321189,
-    -0.320208,
-    -0.319228,
-    -0.31825,
-    -0.317272,
-    -0.316295,
-    -0.31532,
-    -0.314345,
-    -0.313372,
-    -0.3124,
-    -0.311429,
-    -0.310459,
-    -0.30949,
-    -0.308522,
-    -0.307555,
-    -0.306589,
-    -0.305624,
-    -0.30466,
-    -0.303697,
-    -0.302735,
-    -0.301773,
-    -0.300813,
-    -0.299854,
-    -0.298896,
-    -0.297938,
-    -0.296981,
-    -0.296025,
-    -0.29507,
-    -0.294116,
-    -0.293162,
-    -0.29221,
-    -0.291257,
-    -0.290306,
-    -0.289355,
-    -0.288405,
-    -0.287455,
-    -0.286506,
-    -0.285557,
-    -0.284609,
-    -0.283661,
-    -0.282714,
-    -0.281767,
-    -0.28082,
-    -0.279874,
-    -0.278928,
-    -0.277982,
-    -0.277036,
-    -0.276091,
-    -0.275145,
-    -0.2742,
-    -0.273255,
-    -0.27231,
-    -0.271364,
-    -0.270419,
-    -0.269474,
-    -0.268529,
-    -0.267583,
-    -0.266637,
-    -0.265691,
-    -0.264745,
-    -0.263799,
-    -0.262852,
-    -0.261905,
-    -0.260957,
-    -0.260009,
-    -0.259061,
-    -0.258112,
-    -0.257162,
-    -0.256212,
-    -0.255262,
-    -0.254311,
-    -0.253359,
-    -0.252406,
-    -0.251453,
-    -0.250499,
-    -0.249545,
-    -0.24859,
-    -0.247634,
-    -0.246677,
-    -0.245719,
-    -0.244761,
-    -0.243801,
-    -0.242841,
-    -0.24188,
-    -0.240918,
-    -0.239955,
-    -0.238991,
-    -0.238026,
-    -0.23706,
-    -0.236093,
-    -0.235126,
-    -0.234157,
-    -0.233187,
-    -0.232216,
-    -0.231244,
-    -0.230272,
-    -0.229298,
-    -0.228323,
-    -0.227347,
-    -0.22637,
-    -0.225392,
-    -0.224413,
-    -0.223434,
-    -0.222453,
-    -0.221471,
-    -0.220488,
-    -0.219504,
-    -0.218519,
-    -0.217533,
-    -0.216547,
-    -0.215559,
-    -0.21457,
-    -0.213581,
-    -0.212591,
-    -0.211599,
-    -0.210607,
-    -0.209614,
-    -0.208621,
-    -0.207626,
-    -0.206631,
-    -0.205635,
-    -0.204638,
-    -0.20364,
-    -0.202642,
-    -0.201644,
-    -0.200644,
-    -0.199644,
-    -0.198644,
-    -0.197642,
-    -0.196641,
-    -0.195639,
-    -0.194636,
-    -0.193633,
-    -0.19263,
-    -0.191626,
-    -0.190622,
-    -0.189618,
-    -0.188613,
-    -0.187608,
-    -0.186603,
-    -0.185598,
-    -0.184593,
-    -0.183587,
-    -0.182582,
-    -0.181576,
-    -0.180571,
-    -0.179565,
-    -0.17856,
-    -0.177555,
-    -0.17655,
-    -0.175545,
-    -0.17454,
-    -0.173536,
-    -0.172531,
-    -0.171527,
-    -0.170524,
-    -0.16952,
-    -0.168518,
-    -0.167515,
-    -0.166513,
-    -0.165512,
-    -0.164511,
-    -0.16351,
-    -0.162511,
-    -0.161511,
-    -0.160513,
-    -0.159515,
-    -0.158517,
-    -0.157521,
-    -0.156525,
-    -0.15553,
-    -0.154535,
-    -0.153541,
-    -0.152549,
-    -0.151557,
-    -0.150565,
-    -0.149575,
-    -0.148586,
-    -0.147597,
-    -0.146609,
-    -0.145623,
-    -0.144637,
-    -0.143652,
-    -0.142668,
-    -0.141685,
-    -0.140703,
-    -0.139721,
-    -0.138741,
-    -0.137762,
-    -0.136784,
-    -0.135807,
-    -0.13483,
-    -0.133855,
-    -0.132881,
-    -0.131907,
-    -0.130935,
-    -0.129964,
-    -0.128993,
-    -0.128024,
-    -0.127055,
-    -0.126087,
-    -0.125121,
-    -0.124155,
-    -0.12319,
-    -0.122226,
-    -0.121263,
-    -0.1203,
-    -0.119339,
-    -0.118378,
-    -0.117418,
-    -0.116459,
-    -0.115501,
-    -0.114543,
-    -0.113587,
-    -0.112631,
-    -0.111675,
-    -0.11072,
-    -0.109766,
-    -0.108813,
-    -0.10786,
-    -0.106907,
-    -0.105955,
-    -0.105004,
-    -0.104053,
-    -0.103102,
-    -0.102152,
-    -0.101202,
-    -0.100253,
-    -0.0993039,
-    -0.0983551,
-    -0.0974066,
-    -0.0964582,
-    -0.0955101,
-    -0.0945622,
-    -0.0936143,
-    -0.0926666,
-    -0.0917189,
-    -0.0907712,
-    -0.0898236,
-    -0.0888759,
-    -0.0879281,
-    -0.0869803,
-    -0.0860323,
-    -0.0850841,
-    -0.0841358,
-    -0.0831872,
-    -0.0822384,
-    -0.0812892,
-    -0.0803398,
-    -0.07939,
-    -0.0784398,
-    -0.0774892,
-    -0.0765382,
-    -0.0755867,
-    -0.0746347,
-    -0.0736822,
-    -0.0727291,
-    -0.0717755,
-    -0.0708212,
-    -0.0698663,
-    -0.0689108,
-    -0.0679546,
-    -0.0669977,
-    -0.0660401,
-    -0.0650818,
-    -0.0641226,
-    -0.0631628,
-    -0.0622021,
-    -0.0612406,
-    -0.0602782,
-    -0.0593151,
-    -0.058351,
-    -0.0573861,
-    -0.0564203,
-    -0.0554536,
-    -0.054486,
-    -0.0535175,
-    -0.0525481,
-    -0.0515777,
-    -0.0506064,
-    -0.0496341,
-    -0.0486609,
-    -0.0476867,
-    -0.0467116,
-    -0.0457355,
-    -0.0447585,
-    -0.0437805,
-    -0.0428016,
-    -0.0418217,
-    -0.0408409,
-    -0.0398591,
-    -0.0388764,
-    -0.0378928,
-    -0.0369083,
-    -0.0359228,
-    -0.0349365,
-    -0.0339492,
-    -0.0329611,
-    -0.0319722,
-    -0.0309824,
-    -0.0299918,
-    -0.0290004,
-    -0.0280082,
-    -0.0270152,
-    -0.0260214,
-    -0.0250269,
-    -0.0240317,
-    -0.0230359,
-    -0.0220393,
-    -0.0210421,
-    -0.0200443,
-    -0.0190459,
-    -0.0180469,
-    -0.0170474,
-    -0.0160473,
-    -0.0150468,
-    -0.0140458,
-    -0.0130444,
-    -0.0120426,
-    -0.0110403,
-    -0.0100378,
-    -0.00903492,
-    -0.00803176,
-    -0.00702835,
-    -0.00602472,
-    -0.00502089,
-    -0.00401691,
-    -0.00301279,
-    -0.00200858,
-    -0.00100431,
-    0,
-    0.00100431,
-    0.00200858,
-    0.00301279,
-    0.00401691,
-    0.00502089,
-    0.00602472,
-    0.00702835,
-    0.00803176,
-    0.00903492,
-    0.0100378,
-    0.0110403,
-    0.0120426,
-    0.0130444,
-    0.0140458,
-    0.0150468,
-    0.0160473,
-    0.0170474,
-    0.0180469,
-    0.0190459,
-    0.0200443,
-    0.0210421,
-    0.0220393,
-    0.0230359,
-    0.0240317,
-    0.0250269,
-    0.0260214,
-    0.0270152,
-    0.0280082,
-    0.0290004,
-    0.0299918,
-    0.0309824,
-    0.0319722,
-    0.0329611,
-    0.0339492,
-    0.0349365,
-    0.0359228,
-    0.0369083,
-    0.0378928,
-    0.0388764,
-    0.0398591,
-    0.0408409,
-    0.0418217,
-    0.0428016,
-    0.0437805,
-    0.0447585,
-    0.0457355,
-    0.0467116,
-    0.0476867,
-    0.0486609,
-    0.0496341,
-    0.0506064,
-    0.0515777,
-    0.0525481,
-    0.0535175,
-    0.054486,
-    0.0554536,
-    0.0564203,
-    0.0573861,
-    0.058351,
-    0.0593151,
-    0.0602782,
-    0.0612406,
-    0.0622021,
-    0.0631628,
-    0.0641226,
-    0.0650818,
-    0.0660401,
-    0.0669977,
-    0.0679546,
-    0.0689108,
-    0.0698663,
-    0.0708212,
-    0.0717755,
-    0.0727291,
-    0.0736822,
-    0.0746347,
-    0.0755867,
-    0.0765382,
-    0.0774892,
-    0.0784398,
-    0.07939,
-    0.0803398,
-    0.0812892,
-    0.0822384,
-    0.0831872,
-    0.0841358,
-    0.0850841,
-    0.0860323,
-    0.0869803,
-    0.0879281,
-    0.0888759,
-    0.0898236,
-    0.0907712,
-    0.0917189,
-    0.0926666,
-    0.0936143,
-    0.0945622,
-    0.0955101,
-    0.0964582,
-    0.0974066,
-    0.0983551,
-    0.0993039,
-    0.100253,
-    0.101202,
-    0.102152,
-    0.103102,
-    0.104053,
-    0.105004,
-    0.105955,
-    0.106907,
-    0.10786,
-    0.108813,
-    0.109766,
-    0.11072,
-    0.111675,
-    0.112631,
-    0.113587,
-    0.114543,
-    0.115501,
-    0.116459,
-    0.117418,
-    0.118378,
-    0.119339,
-    0.1203,
-    0.121263,
-    0.122226,
-    0.12319,
-    0.124155,
-    0.125121,
-    0.126087,
-    0.127055,
-    0.128024,
-    0.128993,
-    0.129964,
-    0.130935,
-    0.131907,
-    0.132881,
-    0.133855,
-    0.13483,
-    0.135807,
-    0.136784,
-    0.137762,
-    0.138741,
-    0.139721,
-    0.140703,
-    0.141685,
-    0.142668,
-    0.143652,
-    0.144637,
-    0.145623,
-    0.146609,
-    0.147597,
-    0.148586,
-    0.149575,
-    0.150565,
-    0.151557,
-    0.152549,
-    0.153541,
-    0.154535,
-    0.15553,
-    0.156525,
-    0.157521,
-    0.158517,
-    0.159515,
-    0.160513,
-    0.161511,
-    0.162511,
-    0.16351,
-    0.164511,
-    0.165512,
-    0.166513,
-    0.167515,
-    0.168518,
-    0.16952,
-    0.170524,
-    0.171527,
-    0.172531,
-    0.173536,
-    0.17454,
-    0.175545,
-    0.17655,
-    0.177555,
-    0.17856,
-    0.179565,
-    0.180571,
-    0.181576,
-    0.182582,
-    0.183587,
-    0.184593,
-    0.185598,
-    0.186603,
-    0.187608,
-    0.188613,
-    0.189618,
-    0.190622,
-    0.191626,
-    0.19263,
-    0.193633,
-    0.194636,
-    0.195639,
-    0.196641,
-    0.197642,
-    0.198644,
-    0.199644,
-    0.200644,
-    0.201644,
-    0.202642,
-    0.20364,
-    0.204638,
-    0.205635,
-    0.206631,
-    0.207626,
-    0.208621,
-    0.209614,
-    0.210607,
-    0.211599,
-    0.212591,
-    0.213581,
-    0.21457,
-    0.215559,
-    0.216547,
-    0.217533,
-    0.218519,
-    0.219504,
-    0.220488,
-    0.221471,
-    0.222453,
-    0.223434,
-    0.224413,
-    0.225392,
-    0.22637,
-    0.227347,
-    0.228323,
-    0.229298,
-    0.230272,
-    0.231244,
-    0.232216,
-    0.233187,
-    0.234157,
-    0.235126,
-    0.236093,
-    0.23706,
-    0.238026,
-    0.238991,
-    0.239955,
-    0.240918,
-    0.24188,
-    0.242841,
-    0.243801,
-    0.244761,
-    0.245719,
-    0.246677,
-    0.247634,
-    0.24859,
-    0.249545,
-    0.250499,
-    0.251453,
-    0.252406,
-    0.253359,
-    0.254311,
-    0.255262,
-    0.256212,
-    0.257162,
-    0.258112,
-    0.259061,
-    0.260009,
-    0.260957,
-    0.261905,
-    0.262852,
-    0.263799,
-    0.264745,
-    0.265691,
-    0.266637,
-    0.267583,
-    0.268529,
-    0.269474,
-    0.270419,
-    0.271364,
-    0.27231,
-    0.273255,
-    0.2742,
-    0.275145,
-    0.276091,
-    0.277036,
-    0.277982,
-    0.278928,
-    0.279874,
-    0.28082,
-    0.281767,
-    0.282714,
-    0.283661,
-    0.284609,
-    0.285557,
-    0.286506,
-    0.287455,
-    0.288405,
-    0.289355,
-    0.290306,
-    0.291257,
-    0.29221,
-    0.293162,
-    0.294116,
-    0.29507,
-    0.296025,
-    0.296981,
-    0.297938,
-    0.298896,
-    0.299854,
-    0.300813,
-    0.301773,
-    0.302735,
-    0.303697,
-    0.30466,
-    0.305624,
-    0.306589,
-    0.307555,
-    0.308522,
-    0.30949,
-    0.310459,
-    0.311429,
-    0.3124,
-    0.313372,
-    0.314345,
-    0.31532,
-    0.316295,
-    0.317272,
-    0.31825,
-    0.319228,
-    0.320208,
-    0.321189,
-    0.322171,
-    0.323154,
-    0.324138,
-    0.325123,
-    0.32611,
-    0.327097,
-    0.328085,
-    0.329075,
-    0.330065,
-    0.331056,
-    0.332049,
-    0.333042,
-    0.334036,
-    0.335031,
-    0.336027,
-    0.337024,
-    0.338022,
-    0.33902,
-    0.34002,
-    0.34102,
-    0.342021,
-    0.343023,
-    0.344025,
-    0.345028,
-    0.346032,
-    0.347036,
-    0.348041,
-    0.349047,
-    0.350053,
-    0.351059,
-    0.352066,
-    0.353073,
-    0.354081,
-    0.355089,
-    0.356098,
-    0.357106,
-    0.358115,
-    0.359124,
-    0.360134,
-    0.361143,
-    0.362153,
-    0.363162,
-    0.364172,
-    0.365181,
-    0.366191,
-    0.3672,
-    0.368209,
-    0.369218,
-    0.370227,
-    0.371236,
-    0.372244,
-    0.373252,
-    0.37426,
-    0.375267,
-    0.376274,
-    0.37728,
-    0.378286,
-    0.379291,
-    0.380296,
-    0.3813,
-    0.382303,
-    0.383306,
-    0.384308,
-    0.385309,
-    0.38631,
-    0.38731,
-    0.388308,
-    0.389306,
-    0.390304,
-    0.3913,
-    0.392295,
-    0.393289,
-    0.394283,
-    0.395275,
-    0.396266,
-    0.397257,
-    0.398246,
-    0.399234,
-    0.400221,
-    0.401207,
-    0.402192,
-    0.403175,
-    0.404158,
-    0.405139,
-    0.406119,
-    0.407098,
-    0.408076,
-    0.409053,
-    0.410028,
-    0.411002,
-    0.411975,
-    0.412947,
-    0.413918,
-    0.414887,
-    0.415856,
-    0.416823,
-    0.417789,
-    0.418753,
-    0.419717,
-    0.42068,
-    0.421641,
-    0.422601,
-    0.423561,
-    0.424519,
-    0.425476,
-    0.426432,
-    0.427387,
-    0.428341,
-    0.429294,
-    0.430246,
-    0.431197,
-    0.432147,
-    0.433097,
-    0.434045,
-    0.434993,
-    0.43594,
-    0.436886,
-    0.437832,
-    0.438776,
-    0.439721,
-    0.440664,
-    0.441607,
-    0.44255,
-    0.443491,
-    0.444433,
-    0.445374,
-    0.446315,
-    0.447255,
-    0.448195,
-    0.449134,
-    0.450074,
-    0.451013,
-    0.451952,
-    0.452891,
-    0.45383,
-    0.454769,
-    0.455708,
-    0.456647,
-    0.457586,
-    0.458526,
-    0.459465,
-    0.460405,
-    0.461345,
-    0.462285,
-    0.463226,
-    0.464167,
-    0.465108,
-    0.46605,
-    0.466993,
-    0.467936,
-    0.46888,
-    0.469824,
-    0.470769,
-    0.471715,
-    0.472661,
-    0.473609,
-    0.474557,
-    0.475506,
-    0.476456,
-    0.477407,
-    0.478358,
-    0.479311,
-    0.480265,
-    0.48122,
-    0.482176,
-    0.483133,
-    0.484091,
-    0.48505,
-    0.486011,
-    0.486973,
-    0.487936,
-    0.4889,
-    0.489865,
-    0.490832,
-    0.4918,
-    0.492769,
-    0.49374,
-    0.494711,
-    0.495685,
-    0.496659,
-    0.497635,
-    0.498612,
-    0.499591,
-    0.500571,
-    0.501552,
-    0.502535,
-    0.503519,
-    0.504504,
-    0.505491,
-    0.506478,
-    0.507468,
-    0.508458,
-    0.50945,
-    0.510443,
-    0.511438,
-    0.512433,
-    0.51343,
-    0.514428,
-    0.515428,
-    0.516428,
-    0.51743,
-    0.518432,
-    0.519436,
-    0.520441,
-    0.521447,
-    0.522454,
-    0.523462,
-    0.52447,
-    0.52548,
-    0.526491,
-    0.527502,
-    0.528514,
-    0.529527,
-    0.530541,
-    0.531555,
-    0.53257,
-    0.533585,
-    0.534601,
-    0.535618,
-    0.536635,
-    0.537652,
-    0.53867,
-    0.539688,
-    0.540706,
-    0.541725,
-    0.542743,
-    0.543762,
-    0.544781,
-    0.5458,
-    0.546819,
-    0.547838,
-    0.548857,
-    0.549875,
-    0.550893,
-    0.551912,
-    0.552929,
-    0.553947,
-    0.554964,
-    0.55598,
-    0.556996,
-    0.558012,
-    0.559026,
-    0.560041,
-    0.561054,
-    0.562067,
-    0.563079,
-    0.56409,
-    0.5651,
-    0.566109,
-    0.567118,
-    0.568125,
-    0.569131,
-    0.570136,
-    0.571141,
-    0.572143,
-    0.573145,
-    0.574146,
-    0.575145,
-    0.576143,
-    0.57714,
-    0.578135,
-    0.579129,
-    0.580121,
-    0.581113,
-    0.582102,
-    0.58309,
-    0.584077,
-    0.585062,
-    0.586046,
-    0.587028,
-    0.588009,
-    0.588988,
-    0.589965,
-    0.590941,
-    0.591915,
-    0.592888,
-    0.593859,
-    0.594829,
-    0.595797,
-    0.596763,
-    0.597728,
-    0.598691,
-    0.599652,
-    0.600612,
-    0.601571,
-    0.602528,
-    0.603483,
-    0.604437,
-    0.60539,
-    0.606341,
-    0.60729,
-    0.608238,
-    0.609185,
-    0.610131,
-    0.611075,
-    0.612017,
-    0.612959,
-    0.613899,
-    0.614838,
-    0.615776,
-    0.616713,
-    0.617649,
-    0.618583,
-    0.619517,
-    0.62045,
-    0.621382,
-    0.622313,
-    0.623243,
-    0.624172,
-    0.625101,
-    0.626029,
-    0.626956,
-    0.627883,
-    0.62881,
-    0.629736,
-    0.630661,
-    0.631586,
-    0.632511,
-    0.633436,
-    0.634361,
-    0.635285,
-    0.63621,
-    0.637134,
-    0.638059,
-    0.638984,
-    0.639908,
-    0.640834,
-    0.641759,
-    0.642685,
-    0.643611,
-    0.644538,
-    0.645466,
-    0.646394,
-    0.647322,
-    0.648252,
-    0.649182,
-    0.650113,
-    0.651045,
-    0.651978,
-    0.652912,
-    0.653847,
-    0.654783,
-    0.65572,
-    0.656659,
-    0.657599,
-    0.65854,
-    0.659482,
-    0.660426,
-    0.661372,
-    0.662319,
-    0.663267,
-    0.664217,
-    0.665169,
-    0.666122,
-    0.667077,
-    0.668034,
-    0.668992,
-    0.669953,
-    0.670915,
-    0.671879,
-    0.672845,
-    0.673813,
-    0.674782,
-    0.675754,
-    0.676727,
-    0.677703,
-    0.67868,
-    0.67966,
-    0.680641,
-    0.681625,
-    0.68261,
-    0.683597,
-    0.684587,
-    0.685578,
-    0.686572,
-    0.687567,
-    0.688564,
-    0.689564,
-    0.690565,
-    0.691568,
-    0.692573,
-    0.69358,
-    0.694589,
-    0.695599,
-    0.696612,
-    0.697626,
-    0.698642,
-    0.699659,
-    0.700678,
-    0.701699,
-    0.702721,
-    0.703745,
-    0.704771,
-    0.705798,
-    0.706826,
-    0.707855,
-    0.708886,
-    0.709918,
-    0.710951,
-    0.711986,
-    0.713021,
-    0.714057,
-    0.715095,
-    0.716133,
-    0.717171,
-    0.718211,
-    0.719251,
-    0.720292,
-    0.721333,
-    0.722375,
-    0.723417,
-    0.72446,
-    0.725502,
-    0.726545,
-    0.727588,
-    0.72863,
-    0.729673,
-    0.730716,
-    0.731758,
-    0.7328,
-    0.733841,
-    0.734882,
-    0.735923,
-    0.736962,
-    0.738001,
-    0.73904,
-    0.740077,
-    0.741113,
-    0.742149,
-    0.743183,
-    0.744216,
-    0.745248,
-    0.746278,
-    0.747307,
-    0.748335,
-    0.749361,
-    0.750385,
-    0.751408,
-    0.752428,
-    0.753448,
-    0.754465,
-    0.75548,
-    0.756493,
-    0.757504,
-    0.758513,
-    0.75952,
-    0.760525,
-    0.761527,
-    0.762527,
-    0.763525,
-    0.76452,
-    0.765512,
-    0.766503,
-    0.76749,
-    0.768475,
-    0.769458,
-    0.770438,
-    0.771415,
-    0.77239,
-    0.773362,
-    0.774331,
-    0.775297,
-    0.776261,
-    0.777222,
-    0.77818,
-    0.779135,
-    0.780088,
-    0.781038,
-    0.781985,
-    0.78293,
-    0.783872,
-    0.784811,
-    0.785747,
-    0.786681,
-    0.787612,
-    0.788541,
-    0.789467,
-    0.79039,
-    0.791311,
-    0.79223,
-    0.793146,
-    0.79406,
-    0.794972,
-    0.795881,
-    0.796788,
-    0.797693,
-    0.798597,
-    0.799498,
-    0.800397,
-    0.801294,
-    0.80219,
-    0.803084,
-    0.803976,
-    0.804867,
-    0.805756,
-    0.806645,
-    0.807531,
-    0.808417,
-    0.809302,
-    0.810186,
-    0.811068,
-    0.811951,
-    0.812832,
-    0.813713,
-    0.814594,
-    0.815474,
-    0.816354,
-    0.817234,
-    0.818114,
-    0.818994,
-    0.819874,
-    0.820755,
-    0.821636,
-    0.822518,
-    0.8234,
-    0.824284,
-    0.825168,
-    0.826053,
-    0.82694,
-    0.827828,
-    0.828717,
-    0.829608,
-    0.830501,
-    0.831395,
-    0.832292,
-    0.83319,
-    0.834091,
-    0.834993,
-    0.835899,
-    0.836806,
-    0.837717,
-    0.83863,
-    0.839545,
-    0.840464,
-    0.841386,
-    0.842311,
-    0.843239,
-    0.844171,
-    0.845105,
-    0.846044,
-    0.846986,
-    0.847932,
-    0.848881,
-    0.849834,
-    0.850792,
-    0.851753,
-    0.852718,
-    0.853688,
-    0.854661,
-    0.855639,
-    0.856622,
-    0.857608,
-    0.858599,
-    0.859594,
-    0.860594,
-    0.861599,
-    0.862608,
-    0.863621,
-    0.864639,
-    0.865662,
-    0.866689,
-    0.867721,
-    0.868757,
-    0.869798,
-    0.870843,
-    0.871893,
-    0.872948,
-    0.874007,
-    0.875071,
-    0.876138,
-    0.877211,
-    0.878287,
-    0.879368,
-    0.880453,
-    0.881542,
-    0.882635,
-    0.883732,
-    0.884833,
-    0.885938,
-    0.887046,
-    0.888158,
-    0.889273,
-    0.890392,
-    0.891513,
-    0.892638,
-    0.893766,
-    0.894897,
-    0.89603,
-    0.897166,
-    0.898304,
-    0.899444,
-    0.900586,
-    0.90173,
-    0.902876,
-    0.904023,
-    0.905171,
-    0.906321,
-    0.907471,
-    0.908622,
-    0.909773,
-    0.910924,
-    0.912076,
-    0.913227,
-    0.914378,
-    0.915528,
-    0.916677,
-    0.917825,
-    0.918971,
-    0.920116,
-    0.921258,
-    0.922399,
-    0.923537,
-    0.924672,
-    0.925804,
-    0.926933,
-    0.928058,
-    0.929179,
-    0.930296,
-    0.931409,
-    0.932516,
-    0.933619,
-    0.934717,
-    0.935808,
-    0.936894,
-    0.937974,
-    0.939047,
-    0.940113,
-    0.941172,
-    0.942224,
-    0.943267,
-    0.944303,
-    0.94533,
-    0.946349,
-    0.947358,
-    0.948359,
-    0.949349,
-    0.95033,
-    0.951301,
-    0.95226,
-    0.953209,
-    0.954147,
-    0.955074,
-    0.955988,
-    0.956891,
-    0.957781,
-    0.958659,
-    0.959523,
-    0.960375,
-    0.961213,
-    0.962037,
-    0.962847,
-    0.963642,
-    0.964423,
-    0.96519,
-    0.965941,
-    0.966676,
-    0.967396,
-    0.9681,
-    0.968788,
-    0.969459,
-    0.970113,
-    0.970751,
-    0.971372,
-    0.971975,
-    0.972561,
-    0.973128,
-    0.973678,
-    0.97421,
-    0.974723,
-    0.975218,
-    0.975694,
-    0.976151,
-    0.976589,
-    0.977008,
-    0.977407,
-    0.977786,
-    0.978146,
-    0.978487,
-    0.978807,
-    0.979107,
-    0.979387,
-    0.979646,
-    0.979885,
-    0.980104,
-    0.980302,
-    0.98048,
-    0.980636,
-    0.980772,
-    0.980887,
-    0.980982,
-    0.981055,
-    0.981107,
-    0.981139,
-    0.981149,
-    0.981139,
-    0.981107,
-    0.981055,
-    0.980982,
-    0.980887,
-    0.980772,
-    0.980636,
-    0.98048,
-    0.980302,
-    0.980104,
-    0.979885,
-    0.979646,
-    0.979387,
-    0.979107,
-    0.978807,
-    0.978487,
-    0.978146,
-    0.977786,
-    0.977407,
-    0.977008,
-    0.976589,
-    0.976151,
-    0.975694,
-    0.975218,
-    0.974723,
-    0.97421,
-    0.973678,
-    0.973128,
-    0.972561,
-    0.971975,
-    0.971372,
-    0.970751,
-    0.970113,
-    0.969459,
-    0.968788,
-    0.9681,
-    0.967396,
-    0.966676,
-    0.965941,
-    0.96519,
-    0.964423,
-    0.963642,
-    0.962847,
-    0.962037,
-    0.961213,
-    0.960375,
-    0.959523,
-    0.958659,
-    0.957781,
-    0.956891,
-    0.955988,
-    0.955074,
-    0.954147,
-    0.953209,
-    0.95226,
-    0.951301,
-    0.95033,
-    0.949349,
-    0.948359,
-    0.947358,
-    0.946349,
-    0.94533,
-    0.944303,
-    0.943267,
-    0.942224,
-    0.941172,
-    0.940113,
-    0.939047,
-    0.937974,
-    0.936894,
-    0.935808,
-    0.934717,
-    0.933619,
-    0.932516,
-    0.931409,
-    0.930296,
-    0.929179,
-    0.928058,
-    0.926933,
-    0.925804,
-    0.924672,
-    0.923537,
-    0.922399,
-    0.921258,
-    0.920116,
-    0.918971,
-    0.917825,
-    0.916677,
-    0.915528,
-    0.914378,
-    0.913227,
-    0.912076,
-    0.910924,
-    0.909773,
-    0.908622,
-    0.907471,
-    0.906321,
-    0.905171,
-    0.904023,
-    0.902876,
-    0.90173,
-    0.900586,
-    0.899444,
-    0.898304,
-    0.897166,
-    0.89603,
-    0.894897,
-    0.893766,
-    0.892638,
-    0.891513,
-    0.890392,
-    0.889273,
-    0.888158,
-    0.887046,
-    0.885938,
-    0.884833,
-    0.883732,
-    0.882635,
-    0.881542,
-    0.880453,
-    0.879368,
-    0.878287,
-    0.877211,
-    0.876138,
-    0.875071,
-    0.874007,
-    0.872948,
-    0.871893,
-    0.870843,
-    0.869798,
-    0.868757,
-    0.867721,
-    0.866689,
-    0.865662,
-    0.864639,
-    0.863621,
-    0.862608,
-    0.861599,
-    0.860594,
-    0.859594,
-    0.858599,
-    0.857608,
-    0.856622,
-    0.855639,
-    0.854661,
-    0.853688,
-    0.852718,
-    0.851753,
-    0.850792,
-    0.849834,
-    0.848881,
-    0.847932,
-    0.846986,
-    0.846044,
-    0.845105,
-    0.844171,
-    0.843239,
-    0.842311,
-    0.841386,
-    0.840464,
-    0.839545,
-    0.83863,
-    0.837717,
-    0.836806,
-    0.835899,
-    0.834993,
-    0.834091,
-    0.83319,
-    0.832292,
-    0.831395,
-    0.830501,
-    0.829608,
-    0.828717,
-    0.827828,
-    0.82694,
-    0.826053,
-    0.825168,
-    0.824284,
-    0.8234,
-    0.822518,
-    0.821636,
-    0.820755,
-    0.819874,
-    0.818994,
-    0.818114,
-    0.817234,
-    0.816354,
-    0.815474,
-    0.814594,
-    0.813713,
-    0.812832,
-    0.811951,
-    0.811068,
-    0.810186,
-    0.809302,
-    0.808417,
-    0.807531,
-    0.806645,
-    0.805756,
-    0.804867,
-    0.803976,
-    0.803084,
-    0.80219,
-    0.801294,
-    0.800397,
-    0.799498,
-    0.798597,
-    0.797693,
-    0.796788,
-    0.795881,
-    0.794972,
-    0.79406,
-    0.793146,
-    0.79223,
-    0.791311,
-    0.79039,
-    0.789467,
-    0.788541,
-    0.787612,
-    0.786681,
-    0.785747,
-    0.784811,
-    0.783872,
-    0.78293,
-    0.781985,
-    0.781038,
-    0.780088,
-    0.779135,
-    0.77818,
-    0.777222,
-    0.776261,
-    0.775297,
-    0.774331,
-    0.773362,
-    0.77239,
-    0.771415,
-    0.770438,
-    0.769458,
-    0.768475,
-    0.76749,
-    0.766503,
-    0.765512,
-    0.76452,
-    0.763525,
-    0.762527,
-    0.761527,
-    0.760525,
-    0.75952,
-    0.758513,
-    0.757504,
-    0.756493,
-    0.75548,
-    0.754465,
-    0.753448,
-    0.752428,
-    0.751408,
-    0.750385,
-    0.749361,
-    0.748335,
-    0.747307,
-    0.746278,
-    0.745248,
-    0.744216,
-    0.743183,
-    0.742149,
-    0.741113,
-    0.740077,
-    0.73904,
-    0.738001,
-    0.736962,
-    0.735923,
-    0.734882,
-    0.733841,
-    0.7328,
-    0.731758,
-    0.730716,
-    0.729673,
-    0.72863,
-    0.727588,
-    0.726545,
-    0.725502,
-    0.72446,
-    0.723417,
-    0.722375,
-    0.721333,
-    0.720292,
-    0.719251,
-    0.718211,
-    0.717171,
-    0.716133,
-    0.715095,
-    0.714057,
-    0.713021,
-    0.711986,
-    0.710951,
-    0.709918,
-    0.708886,
-    0.707855,
-    0.706826,
-    0.705798,
-    0.704771,
-    0.703745,
-    0.702721,
-    0.701699,
-    0.700678,
-    0.699659,
-    0.698642,
-    0.697626,
-    0.696612,
-    0.695599,
-    0.694589,
-    0.69358,
-    0.692573,
-    0.691568,
-    0.690565,
-    0.689564,
-    0.688564,
-    0.687567,
-    0.686572,
-    0.685578,
-    0.684587,
-    0.683597,
-    0.68261,
-    0.681625,
-    0.680641,
-    0.67966,
-    0.67868,
-    0.677703,
-    0.676727,
-    0.675754,
-    0.674782,
-    0.673813,
-    0.672845,
-    0.671879,
-    0.670915,
-    0.669953,
-    0.668992,
-    0.668034,
-    0.667077,
-    0.666122,
-    0.665169,
-    0.664217,
-    0.663267,
-    0.662319,
-    0.661372,
-    0.660426,
-    0.659482,
-    0.65854,
-    0.657599,
-    0.656659,
-    0.65572,
-    0.654783,
-    0.653847,
-    0.652912,
-    0.651978,
-    0.651045,
-    0.650113,
-    0.649182,
-    0.648252,
-    0.647322,
-    0.646394,
-    0.645466,
-    0.644538,
-    0.643611,
-    0.642685,
-    0.641759,
-    0.640834,
-    0.639908,
-    0.638984,
-    0.638059,
-    0.637134,
-    0.63621,
-    0.635285,
-    0.634361,
-    0.633436,
-    0.632511,
-    0.631586,
-    0.630661,
-    0.629736,
-    0.62881,
-    0.627883,
-    0.626956,
-    0.626029,
-    0.625101,
-    0.624172,
-    0.623243,
-    0.622313,
-    0.621382,
-    0.62045,
-    0.619517,
-    0.618583,
-    0.617649,
-    0.616713,
-    0.615776,
-    0.614838,
-    0.613899,
-    0.612959,
-    0.612017,
-    0.611075,
-    0.610131,
-    0.609185,
-    0.608238,
-    0.60729,
-    0.606341,
-    0.60539,
-    0.604437,
-    0.603483,
-    0.602528,
-    0.601571,
-    0.600612,
-    0.599652,
-    0.598691,
-    0.597728,
-    0.596763,
-    0.595797,
-    0.594829,
-    0.593859,
-    0.592888,
-    0.591915,
-    0.590941,
-    0.589965,
-    0.588988,
-    0.588009,
-    0.587028,
-    0.586046,
-    0.585062,
-    0.584077,
-    0.58309,
-    0.582102,
-    0.581113,
-    0.580121,
-    0.579129,
-    0.578135,
-    0.57714,
-    0.576143,
-    0.575145,
-    0.574146,
-    0.573145,
-    0.572143,
-    0.571141,
-    0.570136,
-    0.569131,
-    0.568125,
-    0.567118,
-    0.566109,
-    0.5651,
-    0.56409,
-    0.563079,
-    0.562067,
-    0.561054,
-    0.560041,
-    0.559026,
-    0.558012,
-    0.556996,
-    0.55598,
-    0.554964,
-    0.553947,
-    0.552929,
-    0.551912,
-    0.550893,
-    0.549875,
-    0.548857,
-    0.547838,
-    0.546819,
-    0.5458,
-    0.544781,
-    0.543762,
-    0.542743,
-    0.541725,
-    0.540706,
-    0.539688,
-    0.53867,
-    0.537652,
-    0.536635,
-    0.535618,
-    0.534601,
-    0.533585,
-    0.53257,
-    0.531555,
-    0.530541,
-    0.529527,
-    0.528514,
-    0.527502,
-    0.526491,
-    0.52548,
-    0.52447,
-    0.523462,
-    0.522454,
-    0.521447,
-    0.520441,
-    0.519436,
-    0.518432,
-    0.51743,
-    0.516428,
-    0.515428,
-    0.514428,
-    0.51343,
-    0.512433,
-    0.511438,
-    0.510443,
-    0.50945,
-    0.508458,
-    0.507468,
-    0.506478,
-    0.505491,
-    0.504504,
-    0.503519,
-    0.502535,
-    0.501552,
-    0.500571,
-    0.499591,
-    0.498612,
-    0.497635,
-    0.496659,
-    0.495685,
-    0.494711,
-    0.49374,
-    0.492769,
-    0.4918,
-    0.490832,
-    0.489865,
-    0.4889,
-    0.487936,
-    0.486973,
-    0.486011,
-    0.48505,
-    0.484091,
-    0.483133,
-    0.482176,
-    0.48122,
-    0.480265,
-    0.479311,
-    0.478358,
-    0.477407,
-    0.476456,
-    0.475506,
-    0.474557,
-    0.473609,
-    0.472661,
-    0.471715,
-    0.470769,
-    0.469824,
-    0.46888,
-    0.467936,
-    0.466993,
-    0.46605,
-    0.465108,
-    0.464167,
-    0.463226,
-    0.462285,
-    0.461345,
-    0.460405,
-    0.459465,
-    0.458526,
-    0.457586,
-    0.456647,
-    0.455708,
-    0.454769,
-    0.45383,
-    0.452891,
-    0.451952,
-    0.451013,
-    0.450074,
-    0.449134,
-    0.448195,
-    0.447255,
-    0.446315,
-    0.445374,
-    0.444433,
-    0.443491,
-    0.44255,
-    0.441607,
-    0.440664,
-    0.439721,
-    0.438776,
-    0.437832,
-    0.436886,
-    0.43594,
-    0.434993,
-    0.434045,
-    0.433097,
-    0.432147,
-    0.431197,
-    0.430246,
-    0.429294,
-    0.428341,
-    0.427387,
-    0.426432,
-    0.425476,
-    0.424519,
-    0.423561,
-    0.422601,
-    0.421641,
-    0.42068,
-    0.419717,
-    0.418753,
-    0.417789,
-    0.416823,
-    0.415856,
-    0.414887,
-    0.413918,
-    0.412947,
-    0.411975,
-    0.411002,
-    0.410028,
-    0.409053,
-    0.408076,
-    0.407098,
-    0.406119,
-    0.405139,
-    0.404158,
-    0.403175,
-    0.402192,
-    0.401207,
-    0.400221,
-    0.399234,
-    0.398246,
-    0.397257,
-    0.396266,
-    0.395275,
-    0.394283,
-    0.393289,
-    0.392295,
-    0.3913,
-    0.390304,
-    0.389306,
-    0.388308,
-    0.38731,
-    0.38631,
-    0.385309,
-    0.384308,
-    0.383306,
-    0.382303,
-    0.3813,
-    0.380296,
-    0.379291,
-    0.378286,
-    0.37728,
-    0.376274,
-    0.375267,
-    0.37426,
-    0.373252,
-    0.372244,
-    0.371236,
-    0.370227,
-    0.369218,
-    0.368209,
-    0.3672,
-    0.366191,
-    0.365181,
-    0.364172,
-    0.363162,
-    0.362153,
-    0.361143,
-    0.360134,
-    0.359124,
-    0.358115,
-    0.357106,
-    0.356098,
-    0.355089,
-    0.354081,
-    0.353073,
-    0.352066,
-    0.351059,
-    0.350053,
-    0.349047,
-    0.348041,
-    0.347036,
-    0.346032,
-    0.345028,
-    0.344025,
-    0.343023,
-    0.342021,
-    0.34102,
-    0.34002,
-    0.33902,
-    0.338022,
-    0.337024,
-    0.336027,
-    0.335031,
-    0.334036,
-    0.333042,
-    0.332049,
-    0.331056,
-    0.330065,
-    0.329075,
-    0.328085,
-    0.327097,
-    0.32611,
-    0.325123,
-    0.324138,
-    0.323154,
-    0.322171,
-    0.321189,
-    0.320208,
-    0.319228,
-    0.31825,
-    0.317272,
-    0.316295,
-    0.31532,
-    0.314345,
-    0.313372,
-    0.3124,
-    0.311429,
-    0.310459,
-    0.30949,
-    0.308522,
-    0.307555,
-    0.306589,
-    0.305624,
-    0.30466,
-    0.303697,
-    0.302735,
-    0.301773,
-    0.300813,
-    0.299854,
-    0.298896,
-    0.297938,
-    0.296981,
-    0.296025,
-    0.29507,
-    0.294116,
-    0.293162,
-    0.29221,
-    0.291257,
-    0.290306,
-    0.289355,
-    0.288405,
-    0.287455,
-    0.286506,
-    0.285557,
-    0.284609,
-    0.283661,
-    0.282714,
-    0.281767,
-    0.28082,
-    0.279874,
-    0.278928,
-    0.277982,
-    0.277036,
-    0.276091,
-    0.275145,
-    0.2742,
-    0.273255,
-    0.27231,
-    0.271364,
-    0.270419,
-    0.269474,
-    0.268529,
-    0.267583,
-    0.266637,
-    0.265691,
-    0.264745,
-    0.263799,
-    0.262852,
-    0.261905,
-    0.260957,
-    0.260009,
-    0.259061,
-    0.258112,
-    0.257162,
-    0.256212,
-    0.255262,
-    0.254311,
-    0.253359,
-    0.252406,
-    0.251453,
-    0.250499,
-    0.249545,
-    0.24859,
-    0.247634,
-    0.246677,
-    0.245719,
-    0.244761,
-    0.243801,
-    0.242841,
-    0.24188,
-    0.240918,
-    0.239955,
-    0.238991,
-    0.238026,
-    0.23706,
-    0.236093,
-    0.235126,
-    0.234157,
-    0.233187,
-    0.232216,
-    0.231244,
-    0.230272,
-    0.229298,
-    0.228323,
-    0.227347,
-    0.22637,
-    0.225392,
-    0.224413,
-    0.223434,
-    0.222453,
-    0.221471,
-    0.220488,
-    0.219504,
-    0.218519,
-    0.217533,
-    0.216547,
-    0.215559,
-    0.21457,
-    0.213581,
-    0.212591,
-    0.211599,
-    0.210607,
-    0.209614,
-    0.208621,
-    0.207626,
-    0.206631,
-    0.205635,
-    0.204638,
-    0.20364,
-    0.202642,
-    0.201644,
-    0.200644,
-    0.199644,
-    0.198644,
-    0.197642,
-    0.196641,
-    0.195639,
-    0.194636,
-    0.193633,
-    0.19263,
-    0.191626,
-    0.190622,
-    0.189618,
-    0.188613,
-    0.187608,
-    0.186603,
-    0.185598,
-    0.184593,
-    0.183587,
-    0.182582,
-    0.181576,
-    0.180571,
-    0.179565,
-    0.17856,
-    0.177555,
-    0.17655,
-    0.175545,
-    0.17454,
-    0.173536,
-    0.172531,
-    0.171527,
-    0.170524,
-    0.16952,
-    0.168518,
-    0.167515,
-    0.166513,
-    0.165512,
-    0.164511,
-    0.16351,
-    0.162511,
-    0.161511,
-    0.160513,
-    0.159515,
-    0.158517,
-    0.157521,
-    0.156525,
-    0.15553,
-    0.154535,
-    0.153541,
-    0.152549,
-    0.151557,
-    0.150565,
-    0.149575,
-    0.148586,
-    0.147597,
-    0.146609,
-    0.145623,
-    0.144637,
-    0.143652,
-    0.142668,
-    0.141685,
-    0.140703,
-    0.139721,
-    0.138741,
-    0.137762,
-    0.136784,
-    0.135807,
-    0.13483,
-    0.133855,
-    0.132881,
-    0.131907,
-    0.130935,
-    0.129964,
-    0.128993,
-    0.128024,
-    0.127055,
-    0.126087,
-    0.125121,
-    0.124155,
-    0.12319,
-    0.122226,
-    0.121263,
-    0.1203,
-    0.119339,
-    0.118378,
-    0.117418,
-    0.116459,
-    0.115501,
-    0.114543,
-    0.113587,
-    0.112631,
-    0.111675,
-    0.11072,
-    0.109766,
-    0.108813,
-    0.10786,
-    0.106907,
-    0.105955,
-    0.105004,
-    0.104053,
-    0.103102,
-    0.102152,
-    0.101202,
-    0.100253,
-    0.0993039,
-    0.0983551,
-    0.0974066,
-    0.0964582,
-    0.0955101,
-    0.0945622,
-    0.0936143,
-    0.0926666,
-    0.0917189,
-    0.0907712,
-    0.0898236,
-    0.0888759,
-    0.0879281,
-    0.0869803,
-    0.0860323,
-    0.0850841,
-    0.0841358,
-    0.0831872,
-    0.0822384,
-    0.0812892,
-    0.0803398,
-    0.07939,
-    0.0784398,
-    0.0774892,
-    0.0765382,
-    0.0755867,
-    0.0746347,
-    0.0736822,
-    0.0727291,
-    0.0717755,
-    0.0708212,
-    0.0698663,
-    0.0689108,
-    0.0679546,
-    0.0669977,
-    0.0660401,
-    0.0650818,
-    0.0641226,
-    0.0631628,
-    0.0622021,
-    0.0612406,
-    0.0602782,
-    0.0593151,
-    0.058351,
-    0.0573861,
-    0.0564203,
-    0.0554536,
-    0.054486,
-    0.0535175,
-    0.0525481,
-    0.0515777,
-    0.0506064,
-    0.0496341,
-    0.0486609,
-    0.0476867,
-    0.0467116,
-    0.0457355,
-    0.0447585,
-    0.0437805,
-    0.0428016,
-    0.0418217,
-    0.0408409,
-    0.0398591,
-    0.0388764,
-    0.0378928,
-    0.0369083,
-    0.0359228,
-    0.0349365,
-    0.0339492,
-    0.0329611,
-    0.0319722,
-    0.0309824,
-    0.0299918,
-    0.0290004,
-    0.0280082,
-    0.0270152,
-    0.0260214,
-    0.0250269,
-    0.0240317,
-    0.0230359,
-    0.0220393,
-    0.0210421,
-    0.0200443,
-    0.0190459,
-    0.0180469,
-    0.0170474,
-    0.0160473,
-    0.0150468,
-    0.0140458,
-    0.0130444,
-    0.0120426,
-    0.0110403,
-    0.0100378,
-    0.00903492,
-    0.00803176,
-    0.00702835,
-    0.00602472,
-    0.00502089,
-    0.00401691,
-    0.00301279,
-    0.00200858,
-    0.00100431
-};
-
-// Top frequency: 44.1K * 0.0580499
-constexpr static std::array<float, 4096> wt_triangle_0x7 =
-{
-    0,
-    -0.000924689,
-    -0.0018494,
-    -0.00277414,
-    -0.00369893,
-    -0.0046238,
-    -0.00554875,
-    -0.00647381,
-    -0.00739899,
-    -0.00832431,
-    -0.00924978,
-    -0.0101754,
-    -0.0111013,
-    -0.0120273,
-    -0.0129536,
-    -0.0138801,
-    -0.0148069,
-    -0.015734,
-    -0.0166613,
-    -0.017589,
-    -0.018517,
-    -0.0194453,
-    -0.020374,
-    -0.0213031,
-    -0.0222325,
-    -0.0231624,
-    -0.0240927,
-    -0.0250234,
-    -0.0259546,
-    -0.0268862,
-    -0.0278184,
-    -0.028751,
-    -0.0296842,
-    -0.0306179,
-    -0.0315521,
-    -0.0324869,
-    -0.0334223,
-    -0.0343582,
-    -0.0352948,
-    -0.0362319,
-    -0.0371697,
-    -0.0381082,
-    -0.0390473,
-    -0.039987,
-    -0.0409274,
-    -0.0418686,
-    -0.0428104,
-    -0.043753,
-    -0.0446962,
-    -0.0456403,
-    -0.046585,
-    -0.0475305,
-    -0.0484768,
-    -0.0494239,
-    -0.0503718,
-    -0.0513205,
-    -0.05227,
-    -0.0532203,
-    -0.0541714,
-    -0.0551234,
-    -0.0560762,
-    -0.0570299,
-    -0.0579844,
-    -0.0589398,
-    -0.0598961,
-    -0.0608533,
-    -0.0618113,
-    -0.0627703,
-    -0.0637302,
-    -0.0646909,
-    -0.0656526,
-    -0.0666152,
-    -0.0675788,
-    -0.0685432,
-    -0.0695086,
-    -0.070475,
-    -0.0714423,
-    -0.0724105,
-    -0.0733797,
-    -0.0743498,
-    -0.0753209,
-    -0.0762929,
-    -0.0772659,
-    -0.0782399,
-    -0.0792148,
-    -0.0801907,
-    -0.0811675,
-    -0.0821453,
-    -0.0831241,
-    -0.0841038,
-    -0.0850845,
-    -0.0860661,
-    -0.0870487,
-    -0.0880323,
-    -0.0890168,
-    -0.0900022,
-    -0.0909886,
-    -0.091976,
-    -0.0929643,
-    -0.0939535,
-    -0.0949437,
-    -0.0959348,
-    -0.0969268,
-    -0.0979197,
-    -0.0989136,
-    -0.0999084,
-    -0.100904,
-    -0.101901,
-    -0.102898,
-    -0.103896,
-    -0.104896,
-    -0.105896,
-    -0.106897,
-    -0.107898,
-    -0.108901,
-    -0.109905,
-    -0.110909,
-    -0.111914,
-    -0.11292,
-    -0.113927,
-    -0.114934,
-    -0.115942,
-    -0.116952,
-    -0.117961,
-    -0.118972,
-    -0.119983,
-    -0.120995,
-    -0.122008,
-    -0.123021,
-    -0.124036,
-    -0.12505,
-    -0.126066,
-    -0.127082,
-    -0.128099,
-    -0.129116,
-    -0.130134,
-    -0.131153,
-    -0.132172,
-    -0.133191,
-    -0.134212,
-    -0.135233,
-    -0.136254,
-    -0.137276,
-    -0.138298,
-    -0.139321,
-    -0.140344,
-    -0.141368,
-    -0.142392,
-    -0.143417,
-    -0.144441,
-    -0.145467,
-    -0.146493,
-    -0.147519,
-    -0.148545,
-    -0.149572,
-    -0.150599,
-    -0.151626,
-    -0.152653,
-    -0.153681,
-    -0.154709,
-    -0.155737,
-    -0.156766,
-    -0.157794,
-    -0.158823,
-    -0.159852,
-    -0.160881,
-    -0.16191,
-    -0.162939,
-    -0.163968,
-    -0.164998,
-    -0.166027,
-    -0.167056,
-    -0.168086,
-    -0.169115,
-    -0.170144,
-    -0.171173,
-    -0.172202,
-    -0.173231,
-    -0.17426,
-    -0.175289,
-    -0.176318,
-    -0.177346,
-    -0.178374,
-    -0.179402,
-    -0.18043,
-    -0.181458,
-    -0.182485,
-    -0.183512,
-    -0.184539,
-    -0.185565,
-    -0.186592,
-    -0.187617,
-    -0.188643,
-    -0.189668,
-    -0.190692,
-    -0.191717,
-    -0.19274,
-    -0.193764,
-    -0.194787,
-    -0.195809,
-    -0.196831,
-    -0.197852,
-    -0.198873,
-    -0.199893,
-    -0.200913,
-    -0.201932,
-    -0.202951,
-    -0.203969,
-    -0.204986,
-    -0.206003,
-    -0.207019,
-    -0.208034,
-    -0.209049,
-    -0.210063,
-    -0.211076,
-    -0.212089,
-    -0.213101,
-    -0.214112,
-    -0.215122,
-    -0.216132,
-    -0.217141,
-    -0.218149,
-    -0.219156,
-    -0.220162,
-    -0.221168,
-    -0.222172,
-    -0.223176,
-    -0.224179,
-    -0.225181,
-    -0.226182,
-    -0.227183,
-    -0.228182,
-    -0.229181,
-    -0.230178,
-    -0.231175,
-    -0.232171,
-    -0.233165,
-    -0.234159,
-    -0.235152,
-    -0.236144,
-    -0.237135,
-    -0.238125,
-    -0.239114,
-    -0.240102,
-    -0.241089,
-    -0.242075,
-    -0.24306,
-    -0.244044,
-    -0.245027,
-    -0.246009,
-    -0.24699,
-    -0.24797,
-    -0.248949,
-    -0.249927,
-    -0.250903,
-    -0.251879,
-    -0.252854,
-    -0.253828,
-    -0.2548,
-    -0.255772,
-    -0.256743,
-    -0.257712,
-    -0.258681,
-    -0.259648,
-    -0.260615,
-    -0.261581,
-    -0.262545,
-    -0.263508,
-    -0.264471,
-    -0.265432,
-    -0.266393,
-    -0.267352,
-    -0.268311,
-    -0.269268,
-    -0.270224,
-    -0.27118,
-    -0.272134,
-    -0.273088,
-    -0.27404,
-    -0.274992,
-    -0.275942,
-    -0.276892,
-    -0.277841,
-    -0.278788,
-    -0.279735,
-    -0.280681,
-    -0.281626,
-    -0.28257,
-    -0.283514,
-    -0.284456,
-    -0.285397,
-    -0.286338,
-    -0.287278,
-    -0.288217,
-    -0.289155,
-    -0.290092,
-    -0.291029,
-    -0.291965,
-    -0.2929,
-    -0.293834,
-    -0.294767,
-    -0.2957,
-    -0.296632,
-    -0.297563,
-    -0.298494,
-    -0.299424,
-    -0.300353,
-    -0.301282,
-    -0.30221,
-    -0.303137,
-    -0.304064,
-    -0.30499,
-    -0.305916,
-    -0.306841,
-    -0.307765,
-    -0.308689,
-    -0.309613,
-    -0.310536,
-    -0.311458,
-    -0.312381,
-    -0.313302,
-    -0.314223,
-    -0.315144,
-    -0.316065,
-    -0.316985,
-    -0.317905,
-    -0.318824,
-    -0.319743,
-    -0.320662,
-    -0.321581,
-    -0.322499,
-    -0.323418,
-    -0.324335,
-    -0.325253,
-    -0.326171,
-    -0.327088,
-    -0.328006,
-    -0.328923,
-    -0.32984,
-    -0.330757,
-    -0.331674,
-    -0.332591,
-    -0.333508,
-    -0.334425,
-    -0.335342,
-    -0.336259,
-    -0.337176,
-    -0.338093,
-    -0.339011,
-    -0.339928,
-    -0.340846,
-    -0.341764,
-    -0.342682,
-    -0.3436,
-    -0.344519,
-    -0.345437,
-    -0.346356,
-    -0.347276,
-    -0.348195,
-    -0.349115,
-    -0.350036,
-    -0.350956,
-    -0.351877,
-    -0.352799,
-    -0.353721,
-    -0.354643,
-    -0.355566,
-    -0.35649,
-    -0.357413,
-    -0.358338,
-    -0.359263,
-    -0.360188,
-    -0.361115,
-    -0.362041,
-    -0.362969,
-    -0.363897,
-    -0.364825,
-    -0.365755,
-    -0.366685,
-    -0.367615,
-    -0.368547,
-    -0.369479,
-    -0.370412,
-    -0.371346,
-    -0.37228,
-    -0.373216,
-    -0.374152,
-    -0.375089,
-    -0.376027,
-    -0.376966,
-    -0.377905,
-    -0.378846,
-    -0.379787,
-    -0.38073,
-    -0.381673,
-    -0.382617,
-    -0.383563,
-    -0.384509,
-    -0.385456,
-    -0.386404,
-    -0.387354,
-    -0.388304,
-    -0.389255,
-    -0.390208,
-    -0.391161,
-    -0.392115,
-    -0.393071,
-    -0.394028,
-    -0.394985,
-    -0.395944,
-    -0.396904,
-    -0.397866,
-    -0.398828,
-    -0.399791,
-    -0.400756,
-    -0.401721,
-    -0.402688,
-    -0.403656,
-    -0.404625,
-    -0.405596,
-    -0.406567,
-    -0.40754,
-    -0.408514,
-    -0.409489,
-    -0.410465,
-    -0.411443,
-    -0.412421,
-    -0.413401,
-    -0.414382,
-    -0.415365,
-    -0.416348,
-    -0.417333,
-    -0.418319,
-    -0.419306,
-    -0.420294,
-    -0.421284,
-    -0.422274,
-    -0.423266,
-    -0.424259,
-    -0.425254,
-    -0.426249,
-    -0.427246,
-    -0.428244,
-    -0.429243,
-    -0.430243,
-    -0.431244,
-    -0.432247,
-    -0.43325,
-    -0.434255,
-    -0.435261,
-    -0.436268,
-    -0.437276,
-    -0.438286,
-    -0.439296,
-    -0.440308,
-    -0.44132,
-    -0.442334,
-    -0.443349,
-    -0.444365,
-    -0.445381,
-    -0.446399,
-    -0.447418,
-    -0.448438,
-    -0.449459,
-    -0.450481,
-    -0.451504,
-    -0.452528,
-    -0.453553,
-    -0.454578,
-    -0.455605,
-    -0.456633,
-    -0.457661,
-    -0.45869,
-    -0.45972,
-    -0.460751,
-    -0.461783,
-    -0.462816,
-    -0.463849,
-    -0.464884,
-    -0.465918,
-    -0.466954,
-    -0.46799,
-    -0.469028,
-    -0.470065,
-    -0.471104,
-    -0.472143,
-    -0.473182,
-    -0.474223,
-    -0.475264,
-    -0.476305,
-    -0.477347,
-    -0.478389,
-    -0.479432,
-    -0.480476,
-    -0.48152,
-    -0.482564,
-    -0.483609,
-    -0.484654,
-    -0.485699,
-    -0.486745,
-    -0.487791,
-    -0.488837,
-    -0.489884,
-    -0.490931,
-    -0.491978,
-    -0.493025,
-    -0.494073,
-    -0.49512,
-    -0.496168,
-    -0.497216,
-    -0.498264,
-    -0.499312,
-    -0.50036,
-    -0.501408,
-    -0.502456,
-    -0.503504,
-    -0.504551,
-    -0.505599,
-    -0.506647,
-    -0.507694,
-    -0.508741,
-    -0.509789,
-    -0.510835,
-    -0.511882,
-    -0.512928,
-    -0.513974,
-    -0.51502,
-    -0.516065,
-    -0.51711,
-    -0.518155,
-    -0.519199,
-    -0.520243,
-    -0.521286,
-    -0.522329,
-    -0.523371,
-    -0.524413,
-    -0.525454,
-    -0.526494,
-    -0.527534,
-    -0.528573,
-    -0.529612,
-    -0.53065,
-    -0.531687,
-    -0.532723,
-    -0.533759,
-    -0.534794,
-    -0.535828,
-    -0.536861,
-    -0.537893,
-    -0.538925,
-    -0.539955,
-    -0.540985,
-    -0.542013,
-    -0.543041,
-    -0.544068,
-    -0.545094,
-    -0.546118,
-    -0.547142,
-    -0.548164,
-    -0.549186,
-    -0.550206,
-    -0.551225,
-    -0.552244,
-    -0.553261,
-    -0.554276,
-    -0.555291,
-    -0.556304,
-    -0.557316,
-    -0.558327,
-    -0.559337,
-    -0.560345,
-    -0.561352,
-    -0.562357,
-    -0.563362,
-    -0.564365,
-    -0.565366,
-    -0.566367,
-    -0.567365,
-    -0.568363,
-    -0.569359,
-    -0.570354,
-    -0.571347,
-    -0.572338,
-    -0.573329,
-    -0.574317,
-    -0.575305,
-    -0.576291,
-    -0.577275,
-    -0.578258,
-    -0.579239,
-    -0.580219,
-    -0.581197,
-    -0.582174,
-    -0.583149,
-    -0.584123,
-    -0.585095,
-    -0.586065,
-    -0.587034,
-    -0.588002,
-    -0.588967,
-    -0.589932,
-    -0.590894,
-    -0.591855,
-    -0.592815,
-    -0.593773,
-    -0.594729,
-    -0.595684,
-    -0.596637,
-    -0.597589,
-    -0.598539,
-    -0.599488,
-    -0.600435,
-    -0.60138,
-    -0.602324,
-    -0.603266,
-    -0.604207,
-    -0.605146,
-    -0.606084,
-    -0.60702,
-    -0.607955,
-    -0.608888,
-    -0.609819,
-    -0.61075,
-    -0.611678,
-    -0.612605,
-    -0.613531,
-    -0.614455,
-    -0.615378,
-    -0.6163,
-    -0.61722,
-    -0.618138,
-    -0.619056,
-    -0.619971,
-    -0.620886,
-    -0.621799,
-    -0.622711,
-    -0.623621,
-    -0.624531,
-    -0.625439,
-    -0.626345,
-    -0.627251,
-    -0.628155,
-    -0.629058,
-    -0.62996,
-    -0.630861,
-    -0.631761,
-    -0.632659,
-    -0.633557,
-    -0.634453,
-    -0.635348,
-    -0.636243,
-    -0.637136,
-    -0.638028,
-    -0.63892,
-    -0.63981,
-    -0.6407,
-    -0.641589,
-    -0.642476,
-    -0.643364,
-    -0.64425,
-    -0.645135,
-    -0.64602,
-    -0.646904,
-    -0.647788,
-    -0.648671,
-    -0.649553,
-    -0.650434,
-    -0.651315,
-    -0.652196,
-    -0.653076,
-    -0.653956,
-    -0.654835,
-    -0.655713,
-    -0.656592,
-    -0.65747,
-    -0.658348,
-    -0.659225,
-    -0.660102,
-    -0.66098,
-    -0.661857,
-    -0.662733,
-    -0.66361,
-    -0.664487,
-    -0.665363,
-    -0.66624,
-    -0.667117,
-    -0.667993,
-    -0.66887,
-    -0.669747,
-    -0.670625,
-    -0.671502,
-    -0.67238,
-    -0.673258,
-    -0.674136,
-    -0.675015,
-    -0.675894,
-    -0.676773,
-    -0.677654,
-    -0.678534,
-    -0.679415,
-    -0.680297,
-    -0.681179,
-    -0.682062,
-    -0.682946,
-    -0.68383,
-    -0.684716,
-    -0.685602,
-    -0.686489,
-    -0.687376,
-    -0.688265,
-    -0.689155,
-    -0.690045,
-    -0.690937,
-    -0.69183,
-    -0.692723,
-    -0.693618,
-    -0.694514,
-    -0.695412,
-    -0.69631,
-    -0.69721,
-    -0.698111,
-    -0.699014,
-    -0.699918,
-    -0.700823,
-    -0.70173,
-    -0.702638,
-    -0.703548,
-    -0.704459,
-    -0.705372,
-    -0.706286,
-    -0.707202,
-    -0.70812,
-    -0.70904,
-    -0.709961,
-    -0.710884,
-    -0.711809,
-    -0.712735,
-    -0.713664,
-    -0.714594,
-    -0.715526,
-    -0.71646,
-    -0.717397,
-    -0.718335,
-    -0.719275,
-    -0.720217,
-    -0.721161,
-    -0.722108,
-    -0.723056,
-    -0.724007,
-    -0.72496,
-    -0.725915,
-    -0.726872,
-    -0.727831,
-    -0.728793,
-    -0.729757,
-    -0.730723,
-    -0.731692,
-    -0.732663,
-    -0.733636,
-    -0.734611,
-    -0.735589,
-    -0.73657,
-    -0.737552,
-    -0.738538,
-    -0.739525,
-    -0.740515,
-    -0.741508,
-    -0.742503,
-    -0.7435,
-    -0.7445,
-    -0.745503,
-    -0.746508,
-    -0.747515,
-    -0.748525,
-    -0.749538,
-    -0.750553,
-    -0.75157,
-    -0.752591,
-    -0.753613,
-    -0.754638,
-    -0.755666,
-    -0.756697,
-    -0.757729,
-    -0.758765,
-    -0.759803,
-    -0.760843,
-    -0.761886,
-    -0.762932,
-    -0.76398,
-    -0.76503,
-    -0.766083,
-    -0.767139,
-    -0.768197,
-    -0.769258,
-    -0.770321,
-    -0.771386,
-    -0.772454,
-    -0.773524,
-    -0.774597,
-    -0.775672,
-    -0.776749,
-    -0.777829,
-    -0.778911,
-    -0.779996,
-    -0.781082,
-    -0.782171,
-    -0.783263,
-    -0.784356,
-    -0.785452,
-    -0.78655,
-    -0.78765,
-    -0.788752,
-    -0.789856,
-    -0.790962,
-    -0.79207,
-    -0.793181,
-    -0.794293,
-    -0.795407,
-    -0.796523,
-    -0.797641,
-    -0.798761,
-    -0.799882,
-    -0.801005,
-    -0.80213,
-    -0.803257,
-    -0.804385,
-    -0.805515,
-    -0.806646,
-    -0.807779,
-    -0.808914,
-    -0.810049,
-    -0.811186,
-    -0.812325,
-    -0.813464,
-    -0.814605,
-    -0.815747,
-    -0.81689,
-    -0.818034,
-    -0.819179,
-    -0.820326,
-    -0.821473,
-    -0.82262,
-    -0.823769,
-    -0.824918,
-    -0.826068,
-    -0.827219,
-    -0.82837,
-    -0.829521,
-    -0.830673,
-    -0.831826,
-    -0.832978,
-    -0.834131,
-    -0.835284,
-    -0.836437,
-    -0.83759,
-    -0.838743,
-    -0.839896,
-    -0.841049,
-    -0.842201,
-    -0.843354,
-    -0.844505,
-    -0.845657,
-    -0.846807,
-    -0.847958,
-    -0.849107,
-    -0.850256,
-    -0.851404,
-    -0.85255,
-    -0.853696,
-    -0.854841,
-    -0.855985,
-    -0.857127,
-    -0.858269,
-    -0.859408,
-    -0.860547,
-    -0.861683,
-    -0.862819,
-    -0.863952,
-    -0.865084,
-    -0.866213,
-    -0.867341,
-    -0.868467,
-    -0.86959,
-    -0.870712,
-    -0.871831,
-    -0.872948,
-    -0.874062,
-    -0.875173,
-    -0.876282,
-    -0.877388,
-    -0.878492,
-    -0.879592,
-    -0.88069,
-    -0.881784,
-    -0.882875,
-    -0.883963,
-    -0.885048,
-    -0.886129,
-    -0.887206,
-    -0.88828,
-    -0.88935,
-    -0.890417,
-    -0.891479,
-    -0.892538,
-    -0.893592,
-    -0.894642,
-    -0.895688,
-    -0.89673,
-    -0.897767,
-    -0.898799,
-    -0.899827,
-    -0.90085,
-    -0.901869,
-    -0.902882,
-    -0.90389,
-    -0.904894,
-    -0.905892,
-    -0.906885,
-    -0.907872,
-    -0.908854,
-    -0.90983,
-    -0.910801,
-    -0.911766,
-    -0.912725,
-    -0.913679,
-    -0.914626,
-    -0.915567,
-    -0.916502,
-    -0.917431,
-    -0.918353,
-    -0.919269,
-    -0.920178,
-    -0.921081,
-    -0.921977,
-    -0.922866,
-    -0.923748,
-    -0.924623,
-    -0.925492,
-    -0.926353,
-    -0.927206,
-    -0.928053,
-    -0.928892,
-    -0.929723,
-    -0.930547,
-    -0.931363,
-    -0.932172,
-    -0.932973,
-    -0.933765,
-    -0.93455,
-    -0.935327,
-    -0.936095,
-    -0.936856,
-    -0.937608,
-    -0.938351,
-    -0.939086,
-    -0.939813,
-    -0.940531,
-    -0.94124,
-    -0.941941,
-    -0.942632,
-    -0.943315,
-    -0.943989,
-    -0.944654,
-    -0.945309,
-    -0.945956,
-    -0.946593,
-    -0.947221,
-    -0.947839,
-    -0.948448,
-    -0.949047,
-    -0.949637,
-    -0.950217,
-    -0.950788,
-    -0.951348,
-    -0.951899,
-    -0.95244,
-    -0.952971,
-    -0.953492,
-    -0.954003,
-    -0.954504,
-    -0.954994,
-    -0.955474,
-    -0.955945,
-    -0.956404,
-    -0.956854,
-    -0.957292,
-    -0.957721,
-    -0.958139,
-    -0.958546,
-    -0.958942,
-    -0.959328,
-    -0.959704,
-    -0.960068,
-    -0.960422,
-    -0.960765,
-    -0.961097,
-    -0.961418,
-    -0.961728,
-    -0.962027,
-    -0.962315,
-    -0.962593,
-    -0.962859,
-    -0.963114,
-    -0.963357,
-    -0.96359,
-    -0.963811,
-    -0.964022,
-    -0.964221,
-    -0.964409,
-    -0.964585,
-    -0.96475,
-    -0.964904,
-    -0.965047,
-    -0.965178,
-    -0.965298,
-    -0.965406,
-    -0.965503,
-    -0.965589,
-    -0.965663,
-    -0.965726,
-    -0.965778,
-    -0.965818,
-    -0.965846,
-    -0.965864,
-    -0.965869,
-    -0.965864,
-    -0.965846,
-    -0.965818,
-    -0.965778,
-    -0.965726,
-    -0.965663,
-    -0.965589,
-    -0.965503,
-    -0.965406,
-    -0.965298,
-    -0.965178,
-    -0.965047,
-    -0.964904,
-    -0.96475,
-    -0.964585,
-    -0.964409,
-    -0.964221,
-    -0.964022,
-    -0.963811,
-    -0.96359,
-    -0.963357,
-    -0.963114,
-    -0.962859,
-    -0.962593,
-    -0.962315,
-    -0.962027,
-    -0.961728,
-    -0.961418,
-    -0.961097,
-    -0.960765,
-    -0.960422,
-    -0.960068,
-    -0.959704,
-    -0.959328,
-    -0.958942,
-    -0.958546,
-    -0.958139,
-    -0.957721,
-    -0.957292,
-    -0.956854,
-    -0.956404,
-    -0.955945,
-    -0.955474,
-    -0.954994,
-    -0.954504,
-    -0.954003,
-    -0.953492,
-    -0.952971,
-    -0.95244,
-    -0.951899,
-    -0.951348,
-    -0.950788,
-    -0.950217,
-    -0.949637,
-    -0.949047,
-    -0.948448,
-    -0.947839,
-    -0.947221,
-    -0.946593,
-    -0.945956,
-    -0.945309,
-    -0.944654,
-    -0.943989,
-    -0.943315,
-    -0.942632,
-    -0.941941,
-    -0.94124,
-    -0.940531,
-    -0.939813,
-    -0.939086,
-    -0.938351,
-    -0.937608,
-    -0.936856,
-    -0.936095,
-    -0.935327,
-    -0.93455,
-    -0.933765,
-    -0.932973,
-    -0.932172,
-    -0.931363,
-    -0.930547,
-    -0.929723,
-    -0.928892,
-    -0.928053,
-    -0.927206,
-    -0.926353,
-    -0.925492,
-    -0.924623,
-    -0.923748,
-    -0.922866,
-    -0.921977,
-    -0.921081,
-    -0.920178,
-    -0.919269,
-    -0.918353,
-    -0.917431,
-    -0.916502,
-    -0.915567,
-    -0.914626,
-    -0.913679,
-    -0.912725,
-    -0.911766,
-    -0.910801,
-    -0.90983,
-    -0.908854,
-    -0.907872,
-    -0.906885,
-    -0.905892,
-    -0.904894,
-    -0.90389,
-    -0.902882,
-    -0.901869,
-    -0.90085,
-    -0.899827,
-    -0.898799,
-    -0.897767,
-    -0.89673,
-    -0.895688,
-    -0.894642,
-    -0.893592,
-    -0.892538,
-    -0.891479,
-    -0.890417,
-    -0.88935,
-    -0.88828,
-    -0.887206,
-    -0.886129,
-    -0.885048,
-    -0.883963,
-    -0.882875,
-    -0.881784,
-    -0.88069,
-    -0.879592,
-    -0.878492,
-    -0.877388,
-    -0.876282,
-    -0.875173,
-    -0.874062,
-    -0.872948,
-    -0.871831,
-    -0.870712,
-    -0.86959,
-    -0.868467,
-    -0.867341,
-    -0.866213,
-    -0.865084,
-    -0.863952,
-    -0.862819,
-    -0.861683,
-    -0.860547,
-    -0.859408,
-    -0.858269,
-    -0.857127,
-    -0.855985,
-    -0.854841,
-    -0.853696,
-    -0.85255,
-    -0.851404,
-    -0.850256,
-    -0.849107,
-    -0.847958,
-    -0.846807,
-    -0.845657,
-    -0.844505,
-    -0.843354,
-    -0.842201,
-    -0.841049,
-    -0.839896,
-    -0.838743,
-    -0.83759,
-    -0.836437,
-    -0.835284,
-    -0.834131,
-    -0.832978,
-    -0.831826,
-    -0.830673,
-    -0.829521,
-    -0.82837,
-    -0.827219,
-    -0.826068,
-    -0.824918,
-    -0.823769,
-    -0.82262,
-    -0.821473,
-    -0.820326,
-    -0.819179,
-    -0.818034,
-    -0.81689,
-    -0.815747,
-    -0.814605,
-    -0.813464,
-    -0.812325,
-    -0.811186,
-    -0.810049,
-    -0.808914,
-    -0.807779,
-    -0.806646,
-    -0.805515,
-    -0.804385,
-    -0.803257,
-    -0.80213,
-    -0.801005,
-    -0.799882,
-    -0.798761,
-    -0.797641,
-    -0.796523,
-    -0.795407,
-    -0.794293,
-    -0.793181,
-    -0.79207,
-    -0.790962,
-    -0.789856,
-    -0.788752,
-    -0.78765,
-    -0.78655,
-    -0.785452,
-    -0.784356,
-    -0.783263,
-    -0.782171,
-    -0.781082,
-    -0.779996,
-    -0.778911,
-    -0.777829,
-    -0.776749,
-    -0.775672,
-    -0.774597,
-    -0.773524,
-    -0.772454,
-    -0.771386,
-    -0.770321,
-    -0.769258,
-    -0.768197,
-    -0.767139,
-    -0.766083,
-    -0.76503,
-    -0.76398,
-    -0.762932,
-    -0.761886,
-    -0.760843,
-    -0.759803,
-    -0.758765,
-    -0.757729,
-    -0.756697,
-    -0.755666,
-    -0.754638,
-    -0.753613,
-    -0.752591,
-    -0.75157,
-    -0.750553,
-    -0.749538,
-    -0.748525,
-    -0.747515,
-    -0.746508,
-    -0.745503,
-    -0.7445,
-    -0.7435,
-    -0.742503,
-    -0.741508,
-    -0.740515,
-    -0.739525,
-    -0.738538,
-    -0.737552,
-    -0.73657,
-    -0.735589,
-    -0.734611,
-    -0.733636,
-    -0.732663,
-    -0.731692,
-    -0.730723,
-    -0.729757,
-    -0.728793,
-    -0.727831,
-    -0.726872,
-    -0.725915,
-    -0.72496,
-    -0.724007,
-    -0.723056,
-    -0.722108,
-    -0.721161,
-    -0.720217,
-    -0.719275,
-    -0.718335,
-    -0.717397,
-    -0.71646,
-    -0.715526,
-    -0.714594,
-    -0.713664,
-    -0.712735,
-    -0.711809,
-    -0.710884,
-    -0.709961,
-    -0.70904,
-    -0.70812,
-    -0.707202,
-    -0.706286,
-    -0.705372,
-    -0.704459,
-    -0.703548,
-    -0.702638,
-    -0.70173,
-    -0.700823,
-    -0.699918,
-    -0.699014,
-    -0.698111,
-    -0.69721,
-    -0.69631,
-    -0.695412,
-    -0.694514,
-    -0.693618,
-    -0.692723,
-    -0.69183,
-    -0.690937,
-    -0.690045,
-    -0.689155,
-    -0.688265,
-    -0.687376,
-    -0.686489,
-    -0.685602,
-    -0.684716,
-    -0.68383,
-    -0.682946,
-    -0.682062,
-    -0.681179,
-    -0.680297,
-    -0.679415,
-    -0.678534,
-    -0.677654,
-    -0.676773,
-    -0.675894,
-    -0.675015,
-    -0.674136,
-    -0.673258,
-    -0.67238,
-    -0.671502,
-    -0.670625,
-    -0.669747,
-    -0.66887,
-    -0.667993,
-    -0.667117,
-    -0.66624,
-    -0.665363,
-    -0.664487,
-    -0.66361,
-    -0.662733,
-    -0.661857,
-    -0.66098,
-    -0.660102,
-    -0.659225,
-    -0.658348,
-    -0.65747,
-    -0.656592,
-    -0.655713,
-    -0.654835,
-    -0.653956,
-    -0.653076,
-    -0.652196,
-    -0.651315,
-    -0.650434,
-    -0.649553,
-    -0.648671,
-    -0.647788,
-    -0.646904,
-    -0.64602,
-    -0.645135,
-    -0.64425,
-    -0.643364,
-    -0.642476,
-    -0.641589,
-    -0.6407,
-    -0.63981,
-    -0.63892,
-    -0.638028,
-    -0.637136,
-    -0.636243,
-    -0.635348,
-    -0.634453,
-    -0.633557,
-    -0.632659,
-    -0.631761,
-    -0.630861,
-    -0.62996,
-    -0.629058,
-    -0.628155,
-    -0.627251,
-    -0.626345,
-    -0.625439,
-    -0.624531,
-    -0.623621,
-    -0.622711,
-    -0.621799,
-    -0.620886,
-    -0.619971,
-    -0.619056,
-    -0.618138,
-    -0.61722,
-    -0.6163,
-    -0.615378,
-    -0.614455,
-    -0.613531,
-    -0.612605,
-    -0.611678,
-    -0.61075,
-    -0.609819,
-    -0.608888,
-    -0.607955,
-    -0.60702,
-    -0.606084,
-    -0.605146,
-    -0.604207,
-    -0.603266,
-    -0.602324,
-    -0.60138,
-    -0.600435,
-    -0.599488,
-    -0.598539,
-    -0.597589,
-    -0.596637,
-    -0.595684,
-    -0.594729,
-    -0.593773,
-    -0.592815,
-    -0.591855,
-    -0.590894,
-    -0.589932,
-    -0.588967,
-    -0.588002,
-    -0.587034,
-    -0.586065,
-    -0.585095,
-    -0.584123,
-    -0.583149,
-    -0.582174,
-    -0.581197,
-    -0.580219,
-    -0.579239,
-    -0.578258,
-    -0.577275,
-    -0.576291,
-    -0.575305,
-    -0.574317,
-    -0.573329,
-    -0.572338,
-    -0.571347,
-    -0.570354,
-    -0.569359,
-    -0.568363,
-    -0.567365,
-    -0.566367,
-    -0.565366,
-    -0.564365,
-    -0.563362,
-    -0.562357,
-    -0.561352,
-    -0.560345,
-    -0.559337,
-    -0.558327,
-    -0.557316,
-    -0.556304,
-    -0.555291,
-    -0.554276,
-    -0.553261,
-    -0.552244,
-    -0.551225,
-    -0.550206,
-    -0.549186,
-    -0.548164,
-    -0.547142,
-    -0.546118,
-    -0.545094,
-    -0.544068,
-    -0.543041,
-    -0.542013,
-    -0.540985,
-    -0.539955,
-    -0.538925,
-    -0.537893,
-    -0.536861,
-    -0.535828,
-    -0.534794,
-    -0.533759,
-    -0.532723,
-    -0.531687,
-    -0.53065,
-    -0.529612,
-    -0.528573,
-    -0.527534,
-    -0.526494,
-    -0.525454,
-    -0.524413,
-    -0.523371,
-    -0.522329,
-    -0.521286,
-    -0.520243,
-    -0.519199,
-    -0.518155,
-    -0.51711,
-    -0.516065,
-    -0.51502,
-    -0.513974,
-    -0.512928,
-    -0.511882,
-    -0.510835,
-    -0.509789,
-    -0.508741,
-    -0.507694,
-    -0.506647,
-    -0.505599,
-    -0.504551,
-    -0.503504,
-    -0.502456,
-    -0.501408,
-    -0.50036,
-    -0.499312,
-    -0.498264,
-    -0.497216,
-    -0.496168,
-    -0.49512,
-    -0.494073,
-    -0.493025,
-    -0.491978,
-    -0.490931,
-    -0.489884,
-    -0.488837,
-    -0.487791,
-    -0.486745,
-    -0.485699,
-    -0.484654,
-    -0.483609,
-    -0.482564,
-    -0.48152,
-    -0.480476,
-    -0.479432,
-    -0.478389,
-    -0.477347,
-    -0.476305,
-    -0.475264,
-    -0.474223,
-    -0.473182,
-    -0.472143,
-    -0.471104,
-    -0.470065,
-    -0.469028,
-    -0.46799,
-    -0.466954,
-    -0.465918,
-    -0.464884,
-    -0.463849,
-    -0.462816,
-    -0.461783,
-    -0.460751,
-    -0.45972,
-    -0.45869,
-    -0.457661,
-    -0.456633,
-    -0.455605,
-    -0.454578,
-    -0.453553,
-    -0.452528,
-    -0.451504,
-    -0.450481,
-    -0.449459,
-    -0.448438,
-    -0.447418,
-    -0.446399,
-    -0.445381,
-    -0.444365,
-    -0.443349,
-    -0.442334,
-    -0.44132,
-    -0.440308,
-    -0.439296,
-    -0.438286,
-    -0.437276,
-    -0.436268,
-    -0.435261,
-    -0.434255,
-    -0.43325,
-    -0.432247,
-    -0.431244,
-    -0.430243,
-    -0.429243,
-    -0.428244,
-    -0.427246,
-    -0.426249,
-    -0.425254,
-    -0.424259,
-    -0.423266,
-    -0.422274,
-    -0.421284,
-    -0.420294,
-    -0.419306,
-    -0.418319,
-    -0.417333,
-    -0.416348,
-    -0.415365,
-    -0.414382,
-    -0.413401,
-    -0.412421,
-    -0.411443,
-    -0.410465,
-    -0.409489,
-    -0.408514,
-    -0.40754,
-    -0.406567,
-    -0.405596,
-    -0.404625,
-    -0.403656,
-    -0.402688,
-    -0.401721,
-    -0.400756,
-    -0.399791,
-    -0.398828,
-    -0.397866,
-    -0.396904,
-    -0.395944,
-    -0.394985,
-    -0.394028,
-    -0.393071,
-    -0.392115,
-    -0.391161,
-    -0.390208,
-    -0.389255,
-    -0.388304,
-    -0.387354,
-    -0.386404,
-    -0.385456,
-    -0.384509,
-    -0.383563,
-    -0.382617,
-    -0.381673,
-    -0.38073,
-    -0.379787,
-    -0.378846,
-    -0.377905,
-    -0.376966,
-    -0.376027,
-    -0.375089,
-    -0.374152,
-    -0.373216,
-    -0.37228,
-    -0.371346,
-    -0.370412,
-    -0.369479,
-    -0.368547,
-    -0.367615,
-    -0.366685,
-    -0.365755,
-    -0.364825,
-    -0.363897,
-    -0.362969,
-    -0.362041,
-    -0.361115,
-    -0.360188,
-    -0.359263,
-    -0.358338,
-    -0.357413,
-    -0.35649,
-    -0.355566,
-    -0.354643,
-    -0.353721,
-    -0.352799,
-    -0.351877,
-    -0.350956,
-    -0.350036,
-    -0.349115,
-    -0.348195,
-    -0.347276,
-    -0.346356,
-    -0.345437,
-    -0.344519,
-    -0.3436,
-    -0.342682,
-    -0.341764,
-    -0.340846,
-    -0.339928,
-    -0.339011,
-    -0.338093,
-    -0.337176,
-    -0.336259,
-    -0.335342,
-    -0.334425,
-    -0.333508,
-    -0.332591,
-    -0.331674,
-    -0.330757,
-    -0.32984,
-    -0.328923,
-    -0.328006,
-    -0.327088,
-    -0.326171,
-    -0.325253,
-    -0.324335,
-    -0.323418,
-    -0.322499,
-    -0.321581,
-    -0.320662,
-    -0.319743,
-    -0.318824,
-    -0.317905,
-    -0.316985,
-    -0.316065,
-    -0.315144,
-    -0.314223,
-    -0.313302,
-    -0.312381,
-    -0.311458,
-    -0.310536,
-    -0.309613,
-    -0.308689,
-    -0.307765,
-    -0.306841,
-    -0.305916,
-    -0.30499,
-    -0.304064,
-    -0.303137,
-    -0.30221,
-    -0.301282,
-    -0.300353,
-    -0.299424,
-    -0.298494,
-    -0.297563,
-    -0.296632,
-    -0.2957,
-    -0.294767,
-    -0.293834,
-    -0.2929,
-    -0.291965,
-    -0.291029,
-    -0.290092,
-    -0.289155,
-    -0.288217,
-    -0.287278,
-    -0.286338,
-    -0.285397,
-    -0.284456,
-    -0.283514,
-    -0.28257,
-    -0.281626,
-    -0.280681,
-    -0.279735,
-    -0.278788,
-    -0.277841,
-    -0.276892,
-    -0.275942,
-    -0.274992,
-    -0.27404,
-    -0.273088,
-    -0.272134,
-    -0.27118,
-    -0.270224,
-    -0.269268,
-    -0.268311,
-    -0.267352,
-    -0.266393,
-    -0.265432,
-    -0.264471,
-    -0.263508,
-    -0.262545,
-    -0.261581,
-    -0.260615,
-    -0.259648,
-    -0.258681,
-    -0.257712,
-    -0.256743,
-    -0.255772,
-    -0.2548,
-    -0.253828,
-    -0.252854,
-    -0.251879,
-    -0.250903,
-    -0.249927,
-    -0.248949,
-    -0.24797,
-    -0.24699,
-    -0.246009,
-    -0.245027,
-    -0.244044,
-    -0.24306,
-    -0.242075,
-    -0.241089,
-    -0.240102,
-    -0.239114,
-    -0.238125,
-    -0.237135,
-    -0.236144,
-    -0.235152,
-    -0.234159,
-    -0.233165,
-    -0.232171,
-    -0.231175,
-    -0.230178,
-    -0.229181,
-    -0.228182,
-    -0.227183,
-    -0.226182,
-    -0.225181,
-    -0.224179,
-    -0.223176,
-    -0.222172,
-    -0.221168,
-    -0.220162,
-    -0.219156,
-    -0.218149,
-    -0.217141,
-    -0.216132,
-    -0.215122,
-    -0.214112,
-    -0.213101,
-    -0.212089,
-    -0.211076,
-    -0.210063,
-    -0.209049,
-    -0.208034,
-    -0.207019,
-    -0.206003,
-    -0.204986,
-    -0.203969,
-    -0.202951,
-    -0.201932,
-    -0.200913,
-    -0.199893,
-    -0.198873,
-    -0.197852,
-    -0.196831,
-    -0.195809,
-    -0.194787,
-    -0.193764,
-    -0.19274,
-    -0.191717,
-    -0.190692,
-    -0.189668,
-    -0.188643,
-    -0.187617,
-    -0.186592,
-    -0.185565,
-    -0.184539,
-    -0.183512,
-    -0.182485,
-    -0.181458,
-    -0.18043,
-    -0.179402,
-    -0.178374,
-    -0.177346,
-    -0.176318,
-    -0.175289,
-    -0.17426,
-    -0.173231,
-    -0.172202,
-    -0.171173,
-    -0.170144,
-    -0.169115,
-    -0.168086,
-    -0.167056,
-    -0.166027,
-    -0.164998,
-    -0.163968,
-    -0.162939,
-    -0.16191,
-    -0.160881,
-    -0.159852,
-    -0.158823,
-    -0.157794,
-    -0.156766,
-    -0.155737,
-    -0.154709,
-    -0.153681,
-    -0.152653,
-    -0.151626,
-    -0.150599,
-    -0.149572,
-    -0.148545,
-    -0.147519,
-    -0.146493,
-    -0.145467,
-    -0.144441,
-    -0.143417,
-    -0.142392,
-    -0.141368,
-    -0.140344,
-    -0.139321,
-    -0.138298,
-    -0.137276,
-    -0.136254,
-    -0.135233,
-    -0.134212,
-    -0.133191,
-    -0.132172,
-    -0.131153,
-    -0.130134,
-    -0.129116,
-    -0.128099,
-    -0.127082,
-    -0.126066,
-    -0.12505,
-    -0.124036,
-    -0.123021,
-    -0.122008,
-    -0.120995,
-    -0.119983,
-    -0.118972,
-    -0.117961,
-    -0.116952,
-    -0.115942,
-    -0.114934,
-    -0.113927,
-    -0.11292,
-    -0.111914,
-    -0.110909,
-    -0.109905,
-    -0.108901,
-    -0.107898,
-    -0.106897,
-    -0.105896,
-    -0.104896,
-    -0.103896,
-    -0.102898,
-    -0.101901,
-    -0.100904,
-    -0.0999084,
-    -0.0989136,
-    -0.0979197,
-    -0.0969268,
-    -0.0959348,
-    -0.0949437,
-    -0.0939535,
-    -0.0929643,
-    -0.091976,
-    -0.0909886,
-    -0.0900022,
-    -0.0890168,
-    -0.0880323,
-    -0.0870487,
-    -0.0860661,
-    -0.0850845,
-    -0.0841038,
-    -0.0831241,
-    -0.0821453,
-    -0.0811675,
-    -0.0801907,
-    -0.0792148,
-    -0.0782399,
-    -0.0772659,
-    -0.0762929,
-    -0.0753209,
-    -0.0743498,
-    -0.0733797,
-    -0.0724105,
-    -0.0714423,
-    -0.070475,
-    -0.0695086,
-    -0.0685432,
-    -0.0675788,
-    -0.0666152,
-    -0.0656526,
-    -0.0646909,
-    -0.0637302,
-    -0.0627703,
-    -0.0618113,
-    -0.0608533,
-    -0.0598961,
-    -0.0589398,
-    -0.0579844,
-    -0.0570299,
-    -0.0560762,
-    -0.0551234,
-    -0.0541714,
-    -0.0532203,
-    -0.05227,
-    -0.0513205,
-    -0.0503718,
-    -0.0494239,
-    -0.0484768,
-    -0.0475305,
-    -0.046585,
-    -0.0456403,
-    -0.0446962,
-    -0.043753,
-    -0.0428104,
-    -0.0418686,
-    -0.0409274,
-    -0.039987,
-    -0.0390473,
-    -0.0381082,
-    -0.0371697,
-    -0.0362319,
-    -0.0352948,
-    -0.0343582,
-    -0.0334223,
-    -0.0324869,
-    -0.0315521,
-    -0.0306179,
-    -0.0296842,
-    -0.028751,
-    -0.0278184,
-    -0.0268862,
-    -0.0259546,
-    -0.0250234,
-    -0.0240927,
-    -0.0231624,
-    -0.0222325,
-    -0.0213031,
-    -0.020374,
-    -0.0194453,
-    -0.018517,
-    -0.017589,
-    -0.0166613,
-    -0.015734,
-    -0.0148069,
-    -0.0138801,
-    -0.0129536,
-    -0.0120273,
-    -0.0111013,
-    -0.0101754,
-    -0.00924978,
-    -0.00832431,
-    -0.00739899,
-    -0.00647381,
-    -0.00554875,
-    -0.0046238,
-    -0.00369893,
-    -0.00277414,
-    -0.0018494,
-    -0.000924689,
-    0,
-    0.000924689,
-    0.0018494,
-    0.00277414,
-    0.00369893,
-    0.0046238,
-    0.00554875,
-    0.00647381,
-    0.00739899,
-    0.00832431,
-    0.00924978,
-    0.0101754,
-    0.0111013,
-    0.0120273,
-    0.0129536,
-    0.0138801,
-    0.0148069,
-    0.015734,
-    0.0166613,
-    0.017589,
-    0.018517,
-    0.0194453,
-    0.020374,
-    0.0213031,
-    0.0222325,
-    0.0231624,
-    0.0240927,
-    0.0250234,
-    0.0259546,
-    0.0268862,
-    0.0278184,
-    0.028751,
-    0.0296842,
-    0.0306179,
-    0.0315521,
-    0.0324869,
-    0.0334223,
-    0.0343582,
-    0.0352948,
-    0.0362319,
-    0.0371697,
-    0.0381082,
-    0.0390473,
-    0.039987,
-    0.0409274,
-    0.0418686,
-    0.0428104,
-    0.043753,
-    0.0446962,
-    0.0456403,
-    0.046585,
-    0.0475305,
-    0.0484768,
-    0.0494239,
-    0.0503718,
-    0.0513205,
-    0.05227,
-    0.0532203,
-    0.0541714,
-    0.0551234,
-    0.0560762,
-    0.0570299,
-    0.0579844,
-    0.0589398,
-    0.0598961,
-    0.0608533,
-    0.0618113,
-    0.0627703,
-    0.0637302,
-    0.0646909,
-    0.0656526,
-    0.0666152,
-    0.0675788,
-    0.0685432,
-    0.0695086,
-    0.070475,
-    0.0714423,
-    0.0724105,
-    0.0733797,
-    0.0743498,
-    0.0753209,
-    0.0762929,
-    0.0772659,
-    0.0782399,
-    0.0792148,
-    0.0801907,
-    0.0811675,
-    0.0821453,
-    0.0831241,
-    0.0841038,
-    0.0850845,
-    0.0860661,
-    0.0870487,
-    0.0880323,
-    0.0890168,
-    0.0900022,
-    0.0909886,
-    0.091976,
-    0.0929643,
-    0.0939535,
-    0.0949437,
-    0.0959348,
-    0.0969268,
-    0.0979197,
-    0.0989136,
-    0.0999084,
-    0.100904,
-    0.101901,
-    0.102898,
-    0.103896,
-    0.104896,
-    0.105896,
-    0.106897,
-    0.107898,
-    0.108901,
-    0.109905,
-    0.110909,
-    0.111914,
-    0.11292,
-    0.113927,
-    0.114934,
-    0.115942,
-    0.116952,
-    0.117961,
-    0.118972,
-    0.119983,
-    0.120995,
-    0.122008,
-    0.123021,
-    0.124036,
-    0.12505,
-    0.126066,
-    0.127082,
-    0.128099,
-    0.129116,
-    0.130134,
-    0.131153,
-    0.132172,
-    0.133191,
-    0.134212,
-    0.135233,
-    0.136254,
-    0.137276,
-    0.138298,
-    0.139321,
-    0.140344,
-    0.141368,
-    0.142392,
-    0.143417,
-    0.144441,
-    0.145467,
-    0.146493,
-    0.147519,
-    0.148545,
-    0.149572,
-    0.150599,
-    0.151626,
-    0.152653,
-    0.153681,
-    0.154709,
-    0.155737,
-    0.156766,
-    0.157794,
-    0.158823,
-    0.159852,
-    0.160881,
-    0.16191,
-    0.162939,
-    0.163968,
-    0.164998,
-    0.166027,
-    0.167056,
-    0.168086,
-    0.169115,
-    0.170144,
-    0.171173,
-    0.172202,
-    0.173231,
-    0.17426,
-    0.175289,
-    0.176318,
-    0.177346,
-    0.178374,
-    0.179402,
-    0.18043,
-    0.181458,
-    0.182485,
-    0.183512,
-    0.184539,
-    0.185565,
-    0.186592,
-    0.187617,
-    0.188643,
-    0.189668,
-    0.190692,
-    0.191717,
-    0.19274,
-    0.193764,
-    0.194787,
-    0.195809,
-    0.196831,
-    0.197852,
-    0.198873,
-    0.199893,
-    0.200913,
-    0.201932,
-    0.202951,
-    0.203969,
-    0.204986,
-    0.206003,
-    0.207019,
-    0.208034,
-    0.209049,
-    0.210063,
-    0.211076,
-    0.212089,
-    0.213101,
-    0.214112,
-    0.215122,
-    0.216132,
-    0.217141,
-    0.218149,
-    0.219156,
-    0.220162,
-    0.221168,
-    0.222172,
-    0.223176,
-    0.224179,
-    0.225181,
-    0.226182,
-    0.227183,
-    0.228182,
-    0.229181,
-    0.230178,
-    0.231175,
-    0.232171,
-    0.233165,
-    0.234159,
-    0.235152,
-    0.236144,
-    0.237135,
-    0.238125,
-    0.239114,
-    0.240102,
-    0.241089,
-    0.242075,
-    0.24306,
-    0.244044,
-    0.245027,
-    0.246009,
-    0.24699,
-    0.24797,
-    0.248949,
-    0.249927,
-    0.250903,
-    0.251879,
-    0.252854,
-    0.253828,
-    0.2548,
-    0.255772,
-    0.256743,
-    0.257712,
-    0.258681,
-    0.259648,
-    0.260615,
-    0.261581,
-    0.262545,
-    0.263508,
-    0.264471,
-    0.265432,
-    0.266393,
-    0.267352,
-    0.268311,
-    0.269268,
-    0.270224,
-    0.27118,
-    0.272134,
-    0.273088,
-    0.27404,
-    0.274992,
-    0.275942,
-    0.276892,
-    0.277841,
-    0.278788,
-    0.279735,
-    0.280681,
-    0.281626,
-    0.28257,
-    0.283514,
-    0.284456,
-    0.285397,
-    0.286338,
-    0.287278,
-    0.288217,
-    0.289155,
-    0.290092,
-    0.291029,
-    0.291965,
-    0.2929,
-    0.293834,
-    0.294767,
-    0.2957,
-    0.296632,
-    0.297563,
-    0.298494,
-    0.299424,
-    0.300353,
-    0.301282,
-    0.30221,
-    0.303137,
-    0.304064,
-    0.30499,
-    0.305916,
-    0.306841,
-    0.307765,
-    0.308689,
-    0.309613,
-    0.310536,
-    0.311458,
-    0.312381,
-    0.313302,
-    0.314223,
-    0.315144,
-    0.316065,
-    0.316985,
-    0.317905,
-    0.318824,
-    0.319743,
-    0.320662,
-    0.321581,
-    0.322499,
-    0.323418,
-    0.324335,
-    0.325253,
-    0.326171,
-    0.327088,
-    0.328006,
-    0.328923,
-    0.32984,
-    0.330757,
-    0.331674,
-    0.332591,
-    0.333508,
-    0.334425,
-    0.335342,
-    0.336259,
-    0.337176,
-    0.338093,
-    0.339011,
-    0.339928,
-    0.340846,
-    0.341764,
-    0.342682,
-    0.3436,
-    0.344519,
-    0.345437,
-    0.346356,
-    0.347276,
-    0.348195,
-    0.349115,
-    0.350036,
-    0.350956,
-    0.351877,
-    0.352799,
-    0.353721,
-    0.354643,
-    0.355566,
-    0.35649,
-    0.357413,
-    0.358338,
-    0.359263,
-    0.360188,
-    0.361115,
-    0.362041,
-    0.362969,
-    0.363897,
-    0.364825,
-    0.365755,
-    0.366685,
-    0.367615,
-    0.368547,
-    0.369479,
-    0.370412,
-    0.371346,
-    0.37228,
-    0.373216,
-    0.374152,
-    0.375089,
-    0.376027,
-    0.376966,
-    0.377905,
-    0.378846,
-    0.379787,
-    0.38073,
-    0.381673,
-    0.382617,
-    0.383563,
-    0.384509,
-    0.385456,
-    0.386404,
-    0.387354,
-    0.388304,
-    0.389255,
-    0.390208,
-    0.391161,
-    0.392115,
-    0.393071,
-    0.394028,
-    0.394985,
-    0.395944,
-    0.396904,
-    0.397866,
-    0.398828,
-    0.399791,
-    0.400756,
-    0.401721,
-    0.402688,
-    0.403656,
-    0.404625,
-    0.405596,
-    0.406567,
-    0.40754,
-    0.408514,
-    0.409489,
-    0.410465,
-    0.411443,
-    0.412421,
-    0.413401,
-    0.414382,
-    0.415365,
-    0.416348,
-    0.417333,
-    0.418319,
-    0.419306,
-    0.420294,
-    0.421284,
-    0.422274,
-    0.423266,
-    0.424259,
-    0.425254,
-    0.426249,
-    0.427246,
-    0.428244,
-    0.429243,
-    0.430243,
-    0.431244,
-    0.432247,
-    0.43325,
-    0.434255,
-    0.435261,
-    0.436268,
-    0.437276,
-    0.438286,
-    0.439296,
-    0.440308,
-    0.44132,
-    0.442334,
-    0.443349,
-    0.444365,
-    0.445381,
-    0.446399,
-    0.447418,
-    0.448438,
-    0.449459,
-    0.450481,
-    0.451504,
-    0.452528,
-    0.453553,
-    0.454578,
-    0.455605,
-    0.456633,
-    0.457661,
-    0.45869,
-    0.45972,
-    0.460751,
-    0.461783,
-    0.462816,
-    0.463849,
-    0.464884,
-    0.465918,
-    0.466954,
-    0.46799,
-    0.469028,
-    0.470065,
-    0.471104,
-    0.472143,
-    0.473182,
-    0.474223,
-    0.475264,
-    0.476305,
-    0.477347,
-    0.478389,
-    0.479432,
-    0.480476,
-    0.48152,
-    0.482564,
-    0.483609,
-    0.484654,
-    0.485699,
-    0.486745,
-    0.487791,
-    0.488837,
-    0.489884,
-    0.490931,
-    0.491978,
-    0.493025,
-    0.494073,
-    0.49512,
-    0.496168,
-    0.497216,
-    0.498264,
-    0.499312,
-    0.50036,
-    0.501408,
-    0.502456,
-    0.503504,
-    0.504551,
-    0.505599,
-    0.506647,
-    0.507694,
-    0.508741,
-    0.509789,
-    0.510835,
-    0.511882,
-    0.512928,
-    0.513974,
-    0.51502,
-    0.516065,
-    0.51711,
-    0.518155,
-    0.519199,
-    0.520243,
-    0.521286,
-    0.522329,
-    0.523371,
-    0.524413,
-    0.525454,
-    0.526494,
-    0.527534,
-    0.528573,
-    0.529612,
-    0.53065,
-    0.531687,
-    0.532723,
-    0.533759,
-    0.534794,
-    0.535828,
-    0.536861,
-    0.537893,
-    0.538925,
-    0.539955,
-    0.540985,
-    0.542013,
-    0.543041,
-    0.544068,
-    0.545094,
-    0.546118,
-    0.547142,
-    0.548164,
-    0.549186,
-    0.550206,
-    0.551225,
-    0.552244,
-    0.553261,
-    0.554276,
-    0.555291,
-    0.556304,
-    0.557316,
-    0.558327,
-    0.559337,
-    0.560345,
-    0.561352,
-    0.562357,
-    0.563362,
-    0.564365,
-    0.565366,
-    0.566367,
-    0.567365,
-    0.568363,
-    0.569359,
-    0.570354,
-    0.571347,
-    0.572338,
-    0.573329,
-    0.574317,
-    0.575305,
-    0.576291,
-    0.577275,
-    0.578258,
-    0.579239,
-    0.580219,
-    0.581197,
-    0.582174,
-    0.583149,
-    0.584123,
-    0.585095,
-    0.586065,
-    0.587034,
-    0.588002,
-    0.588967,
-    0.589932,
-    0.590894,
-    0.591855,
-    0.592815,
-    0.593773,
-    0.594729,
-    0.595684,
-    0.596637,
-    0.597589,
-    0.598539,
-    0.599488,
-    0.600435,
-    0.60138,
-    0.602324,
-    0.603266,
-    0.604207,
-    0.605146,
-    0.606084,
-    0.60702,
-    0.607955,
-    0.608888,
-    0.609819,
-    0.61075,
-    0.611678,
-    0.612605,
-    0.613531,
-    0.614455,
-    0.615378,
-    0.6163,
-    0.61722,
-    0.618138,
-    0.619056,
-    0.619971,
-    0.620886,
-    0.621799,
-    0.622711,
-    0.623621,
-    0.624531,
-    0.625439,
-    0.626345,
-    0.627251,
-    0.628155,
-    0.629058,
-    0.62996,
-    0.630861,
-    0.631761,
-    0.632659,
-    0.633557,
-    0.634453,
-    0.635348,
-    0.636243,
-    0.637136,
-    0.638028,
-    0.63892,
-    0.63981,
-    0.6407,
-    0.641589,
-    0.642476,
-    0.643364,
-    0.64425,
-    0.645135,
-    0.64602,
-    0.646904,
-    0.647788,
-    0.648671,
-    0.649553,
-    0.650434,
-    0.651315,
-    0.652196,
-    0.653076,
-    0.653956,
-    0.654835,
-    0.655713,
-    0.656592,
-    0.65747,
-    0.658348,
-    0.659225,
-    0.660102,
-    0.66098,
-    0.661857,
-    0.662733,
-    0.66361,
-    0.664487,
-    0.665363,
-    0.66624,
-    0.667117,
-    0.667993,
-    0.66887,
-    0.669747,
-    0.670625,
-    0.671502,
-    0.67238,
-    0.673258,
-    0.674136,
-    0.675015,
-    0.675894,
-    0.676773,
-    0.677654,
-    0.678534,
-    0.679415,
-    0.680297,
-    0.681179,
-    0.682062,
-    0.682946,
-    0.68383,
-    0.684716,
-    0.685602,
-    0.686489,
-    0.687376,
-    0.688265,
-    0.689155,
-    0.690045,
-    0.690937,
-    0.69183,
-    0.692723,
-    0.693618,
-    0.694514,
-    0.695412,
-    0.69631,
-    0.69721,
-    0.698111,
-    0.699014,
-    0.699918,
-    0.700823,
-    0.70173,
-    0.702638,
-    0.703548,
-    0.704459,
-    0.705372,
-    0.706286,
-    0.707202,
-    0.70812,
-    0.70904,
-    0.709961,
-    0.710884,
-    0.711809,
-    0.712735,
-    0.713664,
-    0.714594,
-    0.715526,
-    0.71646,
-    0.717397,
-    0.718335,
-    0.719275,
-    0.720217,
-    0.721161,
-    0.722108,
-    0.723056,
-    0.724007,
-    0.72496,
-    0.725915,
-    0.726872,
-    0.727831,
-    0.728793,
-    0.729757,
-    0.730723,
-    0.731692,
-    0.732663,
-    0.733636,
-    0.734611,
-    0.735589,
-    0.73657,
-    0.737552,
-    0.738538,
-    0.739525,
-    0.740515,
-    0.741508,
-    0.742503,
-    0.7435,
-    0.7445,
-    0.745503,
-    0.746508,
-    0.747515,
-    0.748525,
-    0.749538,
-    0.750553,
-    0.75157,
-    0.752591,
-    0.753613,
-    0.754638,
-    0.755666,
-    0.756697,
-    0.757729,
-    0.758765,
-    0.759803,
-    0.760843,
-    0.761886,
-    0.762932,
-    0.76398,
-    0.76503,
-    0.766083,
-    0.767139,
-    0.768197,
-    0.769258,
-    0.770321,
-    0.771386,
-    0.772454,
-    0.773524,
-    0.774597,
-    0.775672,
-    0.776749,
-    0.777829,
-    0.778911,
-    0.779996,
-    0.781082,
-    0.782171,
-    0.783263,
-    0.784356,
-    0.785452,
-    0.78655,
-    0.78765,
-    0.788752,
-    0.789856,
-    0.790962,
-    0.79207,
-    0.793181,
-    0.794293,
-    0.795407,
-    0.796523,
-    0.797641,
-    0.798761,
-    0.799882,
-    0.801005,
-    0.80213,
-    0.803257,
-    0.804385,
-    0.805515,
-    0.806646,
-    0.807779,
-    0.808914,
-    0.810049,
-    0.811186,
-    0.812325,
-    0.813464,
-    0.814605,
-    0.815747,
-    0.81689,
-    0.818034,
-    0.819179,
-    0.820326,
-    0.821473,
-    0.82262,
-    0.823769,
-    0.824918,
-    0.826068,
-    0.827219,
-    0.82837,
-    0.829521,
-    0.830673,
-    0.831826,
-    0.832978,
-    0.834131,
-    0.835284,
-    0.836437,
-    0.83759,
-    0.838743,
-    0.839896,
-    0.841049,
-    0.842201,
-    0.843354,
-    0.844505,
-    0.845657,
-    0.846807,
-    0.847958,
-    0.849107,
-    0.850256,
-    0.851404,
-    0.85255,
-    0.853696,
-    0.854841,
-    0.855985,
-    0.857127,
-    0.858269,
-    0.859408,
-    0.860547,
-    0.861683,
-    0.862819,
-    0.863952,
-    0.865084,
-    0.866213,
-    0.867341,
-    0.868467,
-    0.86959,
-    0.870712,
-    0.871831,
-    0.872948,
-    0.874062,
-    0.875173,
-    0.876282,
-    0.877388,
-    0.878492,
-    0.879592,
-    0.88069,
-    0.881784,
-    0.882875,
-    0.883963,
-    0.885048,
-    0.886129,
-    0.887206,
-    0.88828,
-    0.88935,
-    0.890417,
-    0.891479,
-    0.892538,
-    0.893592,
-    0.894642,
-    0.895688,
-    0.89673,
-    0.897767,
-    0.898799,
-    0.899827,
-    0.90085,
-    0.901869,
-    0.902882,
-    0.90389,
-    0.904894,
-    0.905892,
-    0.906885,
-    0.907872,
-    0.908854,
-    0.90983,
-    0.910801,
-    0.911766,
-    0.912725,
-    0.913679,
-    0.914626,
-    0.915567,
-    0.916502,
-    0.917431,
-    0.918353,
-    0.919269,
-    0.920178,
-    0.921081,
-    0.921977,
-    0.922866,
-    0.923748,
-    0.924623,
-    0.925492,
-    0.926353,
-    0.927206,
-    0.928053,
-    0.928892,
-    0.929723,
-    0.930547,
-    0.931363,
-    0.932172,
-    0.932973,
-    0.933765,
-    0.93455,
-    0.935327,
-    0.936095,
-    0.936856,
-    0.937608,
-    0.938351,
-    0.939086,
-    0.939813,
-    0.940531,
-    0.94124,
-    0.941941,
-    0.942632,
-    0.943315,
-    0.943989,
-    0.944654,
-    0.945309,
-    0.945956,
-    0.946593,
-    0.947221,
-    0.947839,
-    0.948448,
-    0.949047,
-    0.949637,
-    0.950217,
-    0.950788,
-    0.951348,
-    0.951899,
-    0.95244,
-    0.952971,
-    0.953492,
-    0.954003,
-    0.954504,
-    0.954994,
-    0.955474,
-    0.955945,
-    0.956404,
-    0.956854,
-    0.957292,
-    0.957721,
-    0.958139,
-    0.958546,
-    0.958942,
-    0.959328,
-    0.959704,
-    0.960068,
-    0.960422,
-    0.960765,
-    0.961097,
-    0.961418,
-    0.961728,
-    0.962027,
-    0.962315,
-    0.962593,
-    0.962859,
-    0.963114,
-    0.963357,
-    0.96359,
-    0.963811,
-    0.964022,
-    0.964221,
-    0.964409,
-    0.964585,
-    0.96475,
-    0.964904,
-    0.965047,
-    0.965178,
-    0.965298,
-    0.965406,
-    0.965503,
-    0.965589,
-    0.965663,
-    0.965726,
-    0.965778,
-    0.965818,
-    0.965846,
-    0.965864,
-    0.965869,
-    0.965864,
-    0.965846,
-    0.965818,
-    0.965778,
-    0.965726,
-    0.965663,
-    0.965589,
-    0.965503,
-    0.965406,
-    0.965298,
-    0.965178,
-    0.965047,
-    0.964904,
-    0.96475,
-    0.964585,
-    0.964409,
-    0.964221,
-    0.964022,
-    0.963811,
-    0.96359,
-    0.963357,
-    0.963114,
-    0.962859,
-    0.962593,
-    0.962315,
-    0.962027,
-    0.961728,
-    0.961418,
-    0.961097,
-    0.960765,
-    0.960422,
-    0.960068,
-    0.959704,
-    0.959328,
-    0.958942,
-    0.958546,
-    0.958139,
-    0.957721,
-    0.957292,
-    0.956854,
-    0.956404,
-    0.955945,
-    0.955474,
-    0.954994,
-    0.954504,
-    0.954003,
-    0.953492,
-    0.952971,
-    0.95244,
-    0.951899,
-    0.951348,
-    0.950788,
-    0.950217,
-    0.949637,
-    0.949047,
-    0.948448,
-    0.947839,
-    0.947221,
-    0.946593,
-    0.945956,
-    0.945309,
-    0.944654,
-    0.943989,
-    0.943315,
-    0.942632,
-    0.941941,
-    0.94124,
-    0.940531,
-    0.939813,
-    0.939086,
-    0.938351,
-    0.937608,
-    0.936856,
-    0.936095,
-    0.935327,
-    0.93455,
-    0.933765,
-    0.932973,
-    0.932172,
-    0.931363,
-    0.930547,
-    0.929723,
-    0.928892,
-    0.928053,
-    0.927206,
-    0.926353,
-    0.925492,
-    0.924623,
-    0.923748,
-    0.922866,
-    0.921977,
-    0.921081,
-    0.920178,
-    0.919269,
-    0.918353,
-    0.917431,
-    0.916502,
-    0.915567,
-    0.914626,
-    0.913679,
-    0.912725,
-    0.911766,
-    0.910801,
-    0.90983,
-    0.908854,
-    0.907872,
-    0.906885,
-    0.905892,
-    0.904894,
-    0.90389,
-    0.902882,
-    0.901869,
-    0.90085,
-    0.899827,
-    0.898799,
-    0.897767,
-    0.89673,
-    0.895688,
-    0.894642,
-    0.893592,
-    0.892538,
-    0.891479,
-    0.890417,
-    0.88935,
-    0.88828,
-    0.887206,
-    0.886129,
-    0.885048,
-    0.883963,
-    0.882875,
-    0.881784,
-    0.88069,
-    0.879592,
-    0.878492,
-    0.877388,
-    0.876282,
-    0.875173,
-    0.874062,
-    0.872948,
-    0.871831,
-    0.870712,
-    0.86959,
-    0.868467,
-    0.867341,
-    0.866213,
-    0.865084,
-    0.863952,
-    0.862819,
-    0.861683,
-    0.860547,
-    0.859408,
-    0.858269,
-    0.857127,
-    0.855985,
-    0.854841,
-    0.853696,
-    0.85255,
-    0.851404,
-    0.850256,
-    0.849107,
-    0.847958,
-    0.846807,
-    0.845657,
-    0.844505,
-    0.843354,
-    0.842201,
-    0.841049,
-    0.839896,
-    0.838743,
-    0.83759,
-    0.836437,
-    0.835284,
-    0.834131,
-    0.832978,
-    0.831826,
-    0.830673,
-    0.829521,
-    0.82837,
-    0.827219,
-    0.826068,
-    0.824918,
-    0.823769,
-    0.82262,
-    0.821473,
-    0.820326,
-    0.819179,
-    0.818034,
-    0.81689,
-    0.815747,
-    0.814605,
-    0.813464,
-    0.812325,
-    0.811186,
-    0.810049,
-    0.808914,
-    0.807779,
-    0.806646,
-    0.805515,
-    0.804385,
-    0.803257,
-    0.80213,
-    0.801005,
-    0.799882,
-    0.798761,
-    0.797641,
-    0.796523,
-    0.795407,
-    0.794293,
-    0.793181,
-    0.79207,
-    0.790962,
-    0.789856,
-    0.788752,
-    0.78765,
-    0.78655,
-    0.785452,
-    0.784356,
-    0.783263,
-    0.782171,
-    0.781082,
-    0.779996,
-    0.778911,
-    0.777829,
-    0.776749,
-    0.775672,
-    0.774597,
-    0.773524,
-    0.772454,
-    0.771386,
-    0.770321,
-    0.769258,
-    0.768197,
-    0.767139,
-    0.766083,
-    0.76503,
-    0.76398,
-    0.762932,
-    0.761886,
-    0.760843,
-    0.759803,
-    0.758765,
-    0.757729,
-    0.756697,
-    0.755666,
-    0.754638,
-    0.753613,
-    0.752591,
-    0.75157,
-    0.750553,
-    0.749538,
-    0.748525,
-    0.747515,
-    0.746508,
-    0.745503,
-    0.7445,
-    0.7435,
-    0.742503,
-    0.741508,
-    0.740515,
-    0.739525,
-    0.738538,
-    0.737552,
-    0.73657,
-    0.735589,
-    0.734611,
-    0.733636,
-    0.732663,
-    0.731692,
-    0.730723,
-    0.729757,
-    0.728793,
-    0.727831,
-    0.726872,
-    0.725915,
-    0.72496,
-    0.724007,
-    0.723056,
-    0.722108,
-    0.721161,
-    0.720217,
-    0.719275,
-    0.718335,
-    0.717397,
-    0.71646,
-    0.715526,
-    0.714594,
-    0.713664,
-    0.712735,
-    0.711809,
-    0.710884,
-    0.709961,
-    0.70904,
-    0.70812,
-    0.707202,
-    0.706286,
-    0.705372,
-    0.704459,
-    0.703548,
-    0.702638,
-    0.70173,
-    0.700823,
-    0.699918,
-    0.699014,
-    0.698111,
-    0.69721,
-    0.69631,
-    0.695412,
-    0.694514,
-    0.693618,
-    0.692723,
-    0.69183,
-    0.690937,
-    0.690045,
-    0.689155,
-    0.688265,
-    0.687376,
-    0.686489,
-    0.685602,
-    0.684716,
-    0.68383,
-    0.682946,
-    0.682062,
-    0.681179,
-    0.680297,
-    0.679415,
-    0.678534,
-    0.677654,
-    0.676773,
-    0.675894,
-    0.675015,
-    0.674136,
-    0.673258,
-    0.67238,
-    0.671502,
-    0.670625,
-    0.669747,
-    0.66887,
-    0.667993,
-    0.667117,
-    0.66624,
-    0.665363,
-    0.664487,
-    0.66361,
-    0.662733,
-    0.661857,
-    0.66098,
-    0.660102,
-    0.659225,
-    0.658348,
-    0.65747,
-    0.656592,
-    0.655713,
-    0.654835,
-    0.653956,
-    0.653076,
-    0.652196,
-    0.651315,
-    0.650434,
-    0.649553,
-    0.648671,
-    0.647788,
-    0.646904,
-    0.64602,
-    0.645135,
-    0.64425,
-    0.643364,
-    0.642476,
-    0.641589,
-    0.6407,
-    0.63981,
-    0.63892,
-    0.638028,
-    0.637136,
-    0.636243,
-    0.635348,
-    0.634453,
-    0.633557,
-    0.632659,
-    0.631761,
-    0.630861,
-    0.62996,
-    0.629058,
-    0.628155,
-    0.627251,
-    0.626345,
-    0.625439,
-    0.624531,
-    0.623621,
-    0.622711,
-    0.621799,
-    0.620886,
-    0.619971,
-    0.619056,
-    0.618138,
-    0.61722,
-    0.6163,
-    0.615378,
-    0.614455,
-    0.613531,
-    0.612605,
-    0.611678,
-    0.61075,
-    0.609819,
-    0.608888,
-    0.607955,
-    0.60702,
-    0.606084,
-    0.605146,
-    0.604207,
-    0.603266,
-    0.602324,
-    0.60138,
-    0.600435,
-    0.599488,
-    0.598539,
-    0.597589,
-    0.596637,
-    0.595684,
-    0.594729,
-    0.593773,
-    0.592815,
-    0.591855,
-    0.590894,
-    0.589932,
-    0.588967,
-    0.588002,
-    0.587034,
-    0.586065,
-    0.585095,
-    0.584123,
-    0.583149,
-    0.582174,
-    0.581197,
-    0.580219,
-    0.579239,
-    0.578258,
-    0.577275,
-    0.576291,
-    0.575305,
-    0.574317,
-    0.573329,
-    0.572338,
-    0.571347,
-    0.570354,
-    0.569359,
-    0.568363,
-    0.567365,
-    0.566367,
-    0.565366,
-    0.564365,
-    0.563362,
-    0.562357,
-    0.561352,
-    0.560345,
-    0.559337,
-    0.558327,
-    0.557316,
-    0.556304,
-    0.555291,
-    0.554276,
-    0.553261,
-    0.552244,
-    0.551225,
-    0.550206,
-    0.549186,
-    0.548164,
-    0.547142,
-    0.546118,
-    0.545094,
-    0.544068,
-    0.543041,
-    0.542013,
-    0.540985,
-    0.539955,
-    0.538925,
-    0.537893,
-    0.536861,
-    0.535828,
-    0.534794,
-    0.533759,
-    0.532723,
-    0.531687,
-    0.53065,
-    0.529612,
-    0.528573,
-    0.527534,
-    0.526494,
-    0.525454,
-    0.524413,
-    0.523371,
-    0.522329,
-    0.521286,
-    0.520243,
-    0.519199,
-    0.518155,
-    0.51711,
-    0.516065,
-    0.51502,
-    0.513974,
-    0.512928,
-    0.511882,
-    0.510835,
-    0.509789,
-    0.508741,
-    0.507694,
-    0.506647,
-    0.505599,
-    0.504551,
-    0.503504,
-    0.502456,
-    0.501408,
-    0.50036,
-    0.499312,
-    0.498264,
-    0.497216,
-    0.496168,
-    0.49512,
-    0.494073,
-    0.493025,
-    0.491978,
-    0.490931,
-    0.489884,
-    0.488837,
-    0.487791,
-    0.486745,
-    0.485699,
-    0.484654,
-    0.483609,
-    0.482564,
-    0.48152,
-    0.480476,
-    0.479432,
-    0.478389,
-    0.477347,
-    0.476305,
-    0.475264,
-    0.474223,
-    0.473182,
-    0.472143,
-    0.471104,
-    0.470065,
-    0.469028,
-    0.46799,
-    0.466954,
-    0.465918,
-    0.464884,
-    0.463849,
-    0.462816,
-    0.461783,
-    0.460751,
-    0.45972,
-    0.45869,
-    0.457661,
-    0.456633,
-    0.455605,
-    0.454578,
-    0.453553,
-    0.452528,
-    0.451504,
-    0.450481,
-    0.449459,
-    0.448438,
-    0.447418,
-    0.446399,
-    0.445381,
-    0.444365,
-    0.443349,
-    0.442334,
-    0.44132,
-    0.440308,
-    0.439296,
-    0.438286,
-    0.437276,
-    0.436268,
-    0.435261,
-    0.434255,
-    0.43325,
-    0.432247,
-    0.431244,
-    0.430243,
-    0.429243,
-    0.428244,
-    0.427246,
-    0.426249,
-    0.425254,
-    0.424259,
-    0.423266,
-    0.422274,
-    0.421284,
-    0.420294,
-    0.419306,
-    0.418319,
-    0.417333,
-    0.416348,
-    0.415365,
-    0.414382,
-    0.413401,
-    0.412421,
-    0.411443,
-    0.410465,
-    0.409489,
-    0.408514,
-    0.40754,
-    0.406567,
-    0.405596,
-    0.404625,
-    0.403656,
-    0.402688,
-    0.401721,
-    0.400756,
-    0.399791,
-    0.398828,
-    0.397866,
-    0.396904,
-    0.395944,
-    0.394985,
-    0.394028,
-    0.393071,
-    0.392115,
-    0.391161,
-    0.390208,
-    0.389255,
-    0.388304,
-    0.387354,
-    0.386404,
-    0.385456,
-    0.384509,
-    0.383563,
-    0.382617,
-    0.381673,
-    0.38073,
-    0.379787,
-    0.378846,
-    0.377905,
-    0.376966,
-    0.376027,
-    0.375089,
-    0.374152,
-    0.373216,
-    0.37228,
-    0.371346,
-    0.370412,
-    0.369479,
-    0.368547,
-    0.367615,
-    0.366685,
-    0.365755,
-    0.364825,
-    0.363897,
-    0.362969,
-    0.362041,
-    0.361115,
-    0.360188,
-    0.359263,
-    0.358338,
-    0.357413,
-    0.35649,
-    0.355566,
-    0.354643,
-    0.353721,
-    0.352799,
-    0.351877,
-    0.350956,
-    0.350036,
-    0.349115,
-    0.348195,
-    0.347276,
-    0.346356,
-    0.345437,
-    0.344519,
-    0.3436,
-    0.342682,
-    0.341764,
-    0.340846,
-    0.339928,
-    0.339011,
-    0.338093,
-    0.337176,
-    0.336259,
-    0.335342,
-    0.334425,
-    0.333508,
-    0.332591,
-    0.331674,
-    0.330757,
-    0.32984,
-    0.328923,
-    0.328006,
-    0.327088,
-    0.326171,
-    0.325253,
-    0.324335,
-    0.323418,
-    0.322499,
-    0.321581,
-    0.320662,
-    0.319743,
-    0.318824,
-    0.317905,
-    0.316985,
-    0.316065,
-    0.315144,
-    0.314223,
-    0.313302,
-    0.312381,
-    0.311458,
-    0.310536,
-    0.309613,
-    0.308689,
-    0.307765,
-    0.306841,
-    0.305916,
-    0.30499,
-    0.304064,
-    0.303137,
-    0.30221,
-    0.301282,
-    0.300353,
-    0.299424,
-    0.298494,
-    0.297563,
-    0.296632,
-    0.2957,
-    0.294767,
-    0.293834,
-    0.2929,
-    0.291965,
-    0.291029,
-    0.290092,
-    0.289155,
-    0.288217,
-    0.287278,
-    0.286338,
-    0.285397,
-    0.284456,
-    0.283514,
-    0.28257,
-    0.281626,
-    0.280681,
-    0.279735,
-    0.278788,
-    0.277841,
-    0.276892,
-    0.275942,
-    0.274992,
-    0.27404,
-    0.273088,
-    0.272134,
-    0.27118,
-    0.270224,
-    0.269268,
-    0.268311,
-    0.267352,
-    0.266393,
-    0.265432,
-    0.264471,
-    0.263508,
-    0.262545,
-    0.261581,
-    0.260615,
-    0.259648,
-    0.258681,
-    0.257712,
-    0.256743,
-    0.255772,
-    0.2548,
-    0.253828,
-    0.252854,
-    0.251879,
-    0.250903,
-    0.249927,
-    0.248949,
-    0.24797,
-    0.24699,
-    0.246009,
-    0.245027,
-    0.244044,
-    0.24306,
-    0.242075,
-    0.241089,
-    0.240102,
-    0.239114,
-    0.238125,
-    0.237135,
-    0.236144,
-    0.235152,
-    0.234159,
-    0.233165,
-    0.232171,
-    0.231175,
-    0.230178,
-    0.229181,
-    0.228182,
-    0.227183,
-    0.226182,
-    0.225181,
-    0.224179,
-    0.223176,
-    0.222172,
-    0.221168,
-    0.220162,
-    0.219156,
-    0.218149,
-    0.217141,
-    0.216132,
-    0.215122,
-    0.214112,
-    0.213101,
-    0.212089,
-    0.211076,
-    0.210063,
-    0.209049,
-    0.208034,
-    0.207019,
-    0.206003,
-    0.204986,
-    0.203969,
-    0.202951,
-    0.201932,
-    0.200913,
-    0.199893,
-    0.198873,
-    0.197852,
-    0.196831,
-    0.195809,
-    0.194787,
-    0.193764,
-    0.19274,
-    0.191717,
-    0.190692,
-    0.189668,
-    0.188643,
-    0.187617,
-    0.186592,
-    0.185565,
-    0.184539,
-    0.183512,
-    0.182485,
-    0.181458,
-    0.18043,
-    0.179402,
-    0.178374,
-    0.177346,
-    0.176318,
-    0.175289,
-    0.17426,
-    0.173231,
-    0.172202,
-    0.171173,
-    0.170144,
-    0.169115,
-    0.168086,
-    0.167056,
-    0.166027,
-    0.164998,
-    0.163968,
-    0.162939,
-    0.16191,
-    0.160881,
-    0.159852,
-    0.158823,
-    0.157794,
-    0.156766,
-    0.155737,
-    0.154709,
-    0.153681,
-    0.152653,
-    0.151626,
-    0.150599,
-    0.149572,
-    0.148545,
-    0.147519,
-    0.146493,
-    0.145467,
-    0.144441,
-    0.143417,
-    0.142392,
-    0.141368,
-    0.140344,
-    0.139321,
-    0.138298,
-    0.137276,
-    0.136254,
-    0.135233,
-    0.134212,
-    0.133191,
-    0.132172,
-    0.131153,
-    0.130134,
-    0.129116,
-    0.128099,
-    0.127082,
-    0.126066,
-    0.12505,
-    0.124036,
-    0.123021,
-    0.122008,
-    0.120995,
-    0.119983,
-    0.118972,
-    0.117961,
-    0.116952,
-    0.115942,
-    0.114934,
-    0.113927,
-    0.11292,
-    0.111914,
-    0.110909,
-    0.109905,
-    0.108901,
-    0.107898,
-    0.106897,
-    0.105896,
-    0.104896,
-    0.103896,
-    0.102898,
-    0.101901,
-    0.100904,
-    0.0999084,
-    0.0989136,
-    0.0979197,
-    0.0969268,
-    0.0959348,
-    0.0949437,
-    0.0939535,
-    0.0929643,
-    0.091976,
-    0.0909886,
-    0.0900022,
-    0.0890168,
-    0.0880323,
-    0.0870487,
-    0.0860661,
-    0.0850845,
-    0.0841038,
-    0.0831241,
-    0.0821453,
-    0.0811675,
-    0.0801907,
-    0.0792148,
-    0.0782399,
-    0.0772659,
-    0.0762929,
-    0.0753209,
-    0.0743498,
-    0.0733797,
-    0.0724105,
-    0.0714423,
-    0.070475,
-    0.0695086,
-    0.0685432,
-    0.0675788,
-    0.0666152,
-    0.0656526,
-    0.0646909,
-    0.0637302,
-    0.0627703,
-    0.0618113,
-    0.0608533,
-    0.0598961,
-    0.0589398,
-    0.0579844,
-    0.0570299,
-    0.0560762,
-    0.0551234,
-    0.0541714,
-    0.0532203,
-    0.05227,
-    0.0513205,
-    0.0503718,
-    0.0494239,
-    0.0484768,
-    0.0475305,
-    0.046585,
-    0.0456403,
-    0.0446962,
-    0.043753,
-    0.0428104,
-    0.0418686,
-    0.0409274,
-    0.039987,
-    0.0390473,
-    0.0381082,
-    0.0371697,
-    0.0362319,
-    0.0352948,
-    0.0343582,
-    0.0334223,
-    0.0324869,
-    0.0315521,
-    0.0306179,
-    0.0296842,
-    0.028751,
-    0.0278184,
-    0.0268862,
-    0.0259546,
-    0.0250234,
-    0.0240927,
-    0.0231624,
-    0.0222325,
-    0.0213031,
-    0.020374,
-    0.0194453,
-    0.018517,
-    0.017589,
-    0.0166613,
-    0.015734,
-    0.0148069,
-    0.0138801,
-    0.0129536,
-    0.0120273,
-    0.0111013,
-    0.0101754,
-    0.00924978,
-    0.00832431,
-    0.00739899,
-    0.00647381,
-    0.00554875,
-    0.0046238,
-    0.00369893,
-    0.00277414,
-    0.0018494,
-    0.000924689
-};
-
-// Top frequency: 44.1K * 0.1161
-constexpr static std::array<float, 4096> wt_triangle_0x8 =
-{
-    0,
-    -0.00107713,
-    -0.00215424,
-    -0.00323134,
-    -0.00430841,
-    -0.00538545,
-    -0.00646245,
-    -0.00753939,
-    -0.00861627,
-    -0.00969308,
-    -0.0107698,
-    -0.0118465,
-    -0.012923,
-    -0.0139994,
-    -0.0150758,
-    -0.016152,
-    -0.0172281,
-    -0.018304,
-    -0.0193798,
-    -0.0204554,
-    -0.0215309,
-    -0.0226062,
-    -0.0236813,
-    -0.0247562,
-    -0.0258309,
-    -0.0269054,
-    -0.0279797,
-    -0.0290537,
-    -0.0301276,
-    -0.0312011,
-    -0.0322745,
-    -0.0333475,
-    -0.0344203,
-    -0.0354929,
-    -0.0365651,
-    -0.0376371,
-    -0.0387087,
-    -0.03978,
-    -0.040851,
-    -0.0419217,
-    -0.0429921,
-    -0.0440621,
-    -0.0451317,
-    -0.046201,
-    -0.04727,
-    -0.0483385,
-    -0.0494067,
-    -0.0504745,
-    -0.0515418,
-    -0.0526088,
-    -0.0536753,
-    -0.0547415,
-    -0.0558072,
-    -0.0568724,
-    -0.0579372,
-    -0.0590016,
-    -0.0600654,
-    -0.0611288,
-    -0.0621918,
-    -0.0632542,
-    -0.0643162,
-    -0.0653776,
-    -0.0664385,
-    -0.067499,
-    -0.0685589,
-    -0.0696182,
-    -0.0706771,
-    -0.0717353,
-    -0.0727931,
-    -0.0738502,
-    -0.0749068,
-    -0.0759628,
-    -0.0770183,
-    -0.0780731,
-    -0.0791273,
-    -0.080181,
-    -0.081234,
-    -0.0822864,
-    -0.0833382,
-    -0.0843894,
-    -0.0854399,
-    -0.0864898,
-    -0.087539,
-    -0.0885876,
-    -0.0896355,
-    -0.0906827,
-    -0.0917292,
-    -0.0927751,
-    -0.0938203,
-    -0.0948648,
-    -0.0959085,
-    -0.0969516,
-    -0.097994,
-    -0.0990356,
-    -0.100076,
-    -0.101117,
-    -0.102156,
-    -0.103195,
-    -0.104233,
-    -0.10527,
-    -0.106306,
-    -0.107342,
-    -0.108377,
-    -0.109411,
-    -0.110444,
-    -0.111477,
-    -0.112508,
-    -0.113539,
-    -0.11457,
-    -0.115599,
-    -0.116627,
-    -0.117655,
-    -0.118682,
-    -0.119708,
-    -0.120733,
-    -0.121757,
-    -0.122781,
-    -0.123804,
-    -0.124825,
-    -0.125846,
-    -0.126866,
-    -0.127886,
-    -0.128904,
-    -0.129922,
-    -0.130938,
-    -0.131954,
-    -0.132969,
-    -0.133983,
-    -0.134996,
-    -0.136008,
-    -0.137019,
-    -0.138029,
-    -0.139039,
-    -0.140047,
-    -0.141055,
-    -0.142062,
-    -0.143067,
-    -0.144072,
-    -0.145076,
-    -0.146079,
-    -0.147081,
-    -0.148082,
-    -0.149082,
-    -0.150082,
-    -0.15108,
-    -0.152077,
-    -0.153074,
-    -0.154069,
-    -0.155063,
-    -0.156057,
-    -0.15705,
-    -0.158041,
-    -0.159032,
-    -0.160021,
-    -0.16101,
-    -0.161998,
-    -0.162985,
-    -0.16397,
-    -0.164955,
-    -0.165939,
-    -0.166922,
-    -0.167904,
-    -0.168885,
-    -0.169865,
-    -0.170844,
-    -0.171822,
-    -0.172798,
-    -0.173774,
-    -0.174749,
-    -0.175724,
-    -0.176697,
-    -0.177669,
-    -0.17864,
-    -0.17961,
-    -0.180579,
-    -0.181547,
-    -0.182514,
-    -0.18348,
-    -0.184445,
-    -0.185409,
-    -0.186373,
-    -0.187335,
-    -0.188296,
-    -0.189256,
-    -0.190215,
-    -0.191174,
-    -0.192131,
-    -0.193087,
-    -0.194042,
-    -0.194997,
-    -0.19595,
-    -0.196902,
-    -0.197854,
-    -0.198804,
-    -0.199753,
-    -0.200702,
-    -0.201649,
-    -0.202596,
-    -0.203541,
-    -0.204486,
-    -0.20543,
-    -0.206372,
-    -0.207314,
-    -0.208255,
-    -0.209194,
-    -0.210133,
-    -0.211071,
-    -0.212008,
-    -0.212944,
-    -0.213879,
-    -0.214813,
-    -0.215746,
-    -0.216678,
-    -0.217609,
-    -0.21854,
-    -0.219469,
-    -0.220397,
-    -0.221325,
-    -0.222252,
-    -0.223177,
-    -0.224102,
-    -0.225026,
-    -0.225949,
-    -0.226871,
-    -0.227792,
-    -0.228712,
-    -0.229632,
-    -0.23055,
-    -0.231468,
-    -0.232385,
-    -0.233301,
-    -0.234216,
-    -0.23513,
-    -0.236043,
-    -0.236956,
-    -0.237867,
-    -0.238778,
-    -0.239688,
-    -0.240597,
-    -0.241505,
-    -0.242412,
-    -0.243319,
-    -0.244225,
-    -0.24513,
-    -0.246034,
-    -0.246937,
-    -0.24784,
-    -0.248742,
-    -0.249643,
-    -0.250543,
-    -0.251442,
-    -0.252341,
-    -0.253239,
-    -0.254136,
-    -0.255033,
-    -0.255928,
-    -0.256823,
-    -0.257717,
-    -0.258611,
-    -0.259504,
-    -0.260396,
-    -0.261287,
-    -0.262178,
-    -0.263068,
-    -0.263957,
-    -0.264845,
-    -0.265733,
-    -0.266621,
-    -0.267507,
-    -0.268393,
-    -0.269279,
-    -0.270163,
-    -0.271047,
-    -0.271931,
-    -0.272814,
-    -0.273696,
-    -0.274577,
-    -0.275458,
-    -0.276339,
-    -0.277219,
-    -0.278098,
-    -0.278977,
-    -0.279855,
-    -0.280733,
-    -0.28161,
-    -0.282486,
-    -0.283362,
-    -0.284238,
-    -0.285113,
-    -0.285987,
-    -0.286861,
-    -0.287735,
-    -0.288608,
-    -0.289481,
-    -0.290353,
-    -0.291225,
-    -0.292096,
-    -0.292967,
-    -0.293837,
-    -0.294707,
-    -0.295577,
-    -0.296446,
-    -0.297315,
-    -0.298183,
-    -0.299051,
-    -0.299919,
-    -0.300787,
-    -0.301654,
-    -0.30252,
-    -0.303387,
-    -0.304253,
-    -0.305119,
-    -0.305984,
-    -0.306849,
-    -0.307714,
-    -0.308579,
-    -0.309443,
-    -0.310307,
-    -0.311171,
-    -0.312035,
-    -0.312898,
-    -0.313762,
-    -0.314625,
-    -0.315487,
-    -0.31635,
-    -0.317212,
-    -0.318075,
-    -0.318937,
-    -0.319799,
-    -0.320661,
-    -0.321523,
-    -0.322384,
-    -0.323246,
-    -0.324107,
-    -0.324969,
-    -0.32583,
-    -0.326691,
-    -0.327552,
-    -0.328414,
-    -0.329275,
-    -0.330136,
-    -0.330997,
-    -0.331858,
-    -0.332719,
-    -0.33358,
-    -0.334441,
-    -0.335302,
-    -0.336164,
-    -0.337025,
-    -0.337886,
-    -0.338748,
-    -0.339609,
-    -0.340471,
-    -0.341332,
-    -0.342194,
-    -0.343056,
-    -0.343918,
-    -0.34478,
-    -0.345643,
-    -0.346505,
-    -0.347368,
-    -0.348231,
-    -0.349094,
-    -0.349958,
-    -0.350821,
-    -0.351685,
-    -0.352549,
-    -0.353413,
-    -0.354278,
-    -0.355143,
-    -0.356008,
-    -0.356873,
-    -0.357739,
-    -0.358605,
-    -0.359471,
-    -0.360338,
-    -0.361205,
-    -0.362073,
-    -0.36294,
-    -0.363809,
-    -0.364677,
-    -0.365546,
-    -0.366415,
-    -0.367285,
-    -0.368155,
-    -0.369026,
-    -0.369897,
-    -0.370769,
-    -0.371641,
-    -0.372513,
-    -0.373386,
-    -0.37426,
-    -0.375134,
-    -0.376008,
-    -0.376883,
-    -0.377759,
-    -0.378635,
-    -0.379511,
-    -0.380389,
-    -0.381267,
-    -0.382145,
-    -0.383024,
-    -0.383904,
-    -0.384784,
-    -0.385665,
-    -0.386546,
-    -0.387428,
-    -0.388311,
-    -0.389195,
-    -0.390079,
-    -0.390964,
-    -0.391849,
-    -0.392736,
-    -0.393623,
-    -0.39451,
-    -0.395399,
-    -0.396288,
-    -0.397178,
-    -0.398069,
-    -0.39896,
-    -0.399852,
-    -0.400745,
-    -0.401639,
-    -0.402534,
-    -0.403429,
-    -0.404326,
-    -0.405223,
-    -0.406121,
-    -0.407019,
-    -0.407919,
-    -0.40882,
-    -0.409721,
-    -0.410623,
-    -0.411527,
-    -0.412431,
-    -0.413336,
-    -0.414242,
-    -0.415149,
-    -0.416056,
-    -0.416965,
-    -0.417875,
-    -0.418786,
-    -0.419697,
-    -0.42061,
-    -0.421524,
-    -0.422438,
-    -0.423354,
-    -0.42427,
-    -0.425188,
-    -0.426107,
-    -0.427026,
-    -0.427947,
-    -0.428869,
-    -0.429792,
-    -0.430716,
-    -0.431641,
-    -0.432567,
-    -0.433494,
-    -0.434422,
-    -0.435351,
-    -0.436282,
-    -0.437213,
-    -0.438146,
-    -0.43908,
-    -0.440015,
-    -0.440951,
-    -0.441888,
-    -0.442826,
-    -0.443766,
-    -0.444706,
-    -0.445648,
-    -0.446591,
-    -0.447536,
-    -0.448481,
-    -0.449428,
-    -0.450375,
-    -0.451324,
-    -0.452274,
-    -0.453226,
-    -0.454178,
-    -0.455132,
-    -0.456087,
-    -0.457044,
-    -0.458001,
-    -0.45896,
-    -0.45992,
-    -0.460881,
-    -0.461844,
-    -0.462808,
-    -0.463773,
-    -0.464739,
-    -0.465707,
-    -0.466676,
-    -0.467646,
-    -0.468618,
-    -0.469591,
-    -0.470565,
-    -0.47154,
-    -0.472517,
-    -0.473495,
-    -0.474474,
-    -0.475455,
-    -0.476437,
-    -0.47742,
-    -0.478405,
-    -0.479391,
-    -0.480378,
-    -0.481367,
-    -0.482356,
-    -0.483348,
-    -0.48434,
-    -0.485334,
-    -0.48633,
-    -0.487326,
-    -0.488324,
-    -0.489324,
-    -0.490324,
-    -0.491327,
-    -0.49233,
-    -0.493335,
-    -0.494341,
-    -0.495348,
-    -0.496357,
-    -0.497368,
-    -0.498379,
-    -0.499392,
-    -0.500407,
-    -0.501422,
-    -0.502439,
-    -0.503458,
-    -0.504478,
-    -0.505499,
-    -0.506521,
-    -0.507545,
-    -0.50857,
-    -0.509597,
-    -0.510625,
-    -0.511654,
-    -0.512685,
-    -0.513717,
-    -0.514751,
-    -0.515786,
-    -0.516822,
-    -0.517859,
-    -0.518898,
-    -0.519939,
-    -0.52098,
-    -0.522023,
-    -0.523068,
-    -0.524113,
-    -0.52516,
-    -0.526209,
-    -0.527259,
-    -0.52831,
-    -0.529362,
-    -0.530416,
-    -0.531471,
-    -0.532527,
-    -0.533585,
-    -0.534644,
-    -0.535705,
-    -0.536766,
-    -0.537829,
-    -0.538894,
-    -0.539959,
-    -0.541026,
-    -0.542095,
-    -0.543164,
-    -0.544235,
-    -0.545307,
-    -0.546381,
-    -0.547455,
-    -0.548531,
-    -0.549608,
-    -0.550687,
-    -0.551767,
-    -0.552848,
-    -0.55393,
-    -0.555014,
-    -0.556098,
-    -0.557184,
-    -0.558272,
-    -0.55936,
-    -0.56045,
-    -0.561541,
-    -0.562633,
-    -0.563726,
-    -0.56482,
-    -0.565916,
-    -0.567013,
-    -0.568111,
-    -0.56921,
-    -0.57031,
-    -0.571412,
-    -0.572514,
-    -0.573618,
-    -0.574723,
-    -0.575829,
-    -0.576936,
-    -0.578044,
-    -0.579153,
-    -0.580264,
-    -0.581375,
-    -0.582488,
-    -0.583601,
-    -0.584716,
-    -0.585831,
-    -0.586948,
-    -0.588066,
-    -0.589185,
-    -0.590304,
-    -0.591425,
-    -0.592547,
-    -0.593669,
-    -0.594793,
-    -0.595918,
-    -0.597043,
-    -0.59817,
-    -0.599297,
-    -0.600426,
-    -0.601555,
-    -0.602685,
-    -0.603816,
-    -0.604948,
-    -0.606081,
-    -0.607214,
-    -0.608349,
-    -0.609484,
-    -0.61062,
-    -0.611757,
-    -0.612895,
-    -0.614033,
-    -0.615173,
-    -0.616313,
-    -0.617453,
-    -0.618595,
-    -0.619737,
-    -0.62088,
-    -0.622024,
-    -0.623168,
-    -0.624313,
-    -0.625458,
-    -0.626605,
-    -0.627752,
-    -0.628899,
-    -0.630047,
-    -0.631196,
-    -0.632345,
-    -0.633495,
-    -0.634645,
-    -0.635796,
-    -0.636948,
-    -0.6381,
-    -0.639252,
-    -0.640405,
-    -0.641559,
-    -0.642712,
-    -0.643867,
-    -0.645021,
-    -0.646176,
-    -0.647332,
-    -0.648488,
-    -0.649644,
-    -0.6508,
-    -0.651957,
-    -0.653115,
-    -0.654272,
-    -0.65543,
-    -0.656588,
-    -0.657746,
-    -0.658905,
-    -0.660063,
-    -0.661222,
-    -0.662381,
-    -0.663541,
-    -0.6647,
-    -0.665859,
-    -0.667019,
-    -0.668179,
-    -0.669339,
-    -0.670499,
-    -0.671659,
-    -0.672818,
-    -0.673979,
-    -0.675138,
-    -0.676298,
-    -0.677458,
-    -0.678618,
-    -0.679778,
-    -0.680938,
-    -0.682097,
-    -0.683257,
-    -0.684416,
-    -0.685575,
-    -0.686734,
-    -0.687893,
-    -0.689051,
-    -0.690209,
-    -0.691367,
-    -0.692525,
-    -0.693683,
-    -0.69484,
-    -0.695997,
-    -0.697153,
-    -0.698309,
-    -0.699465,
-    -0.70062,
-    -0.701775,
-    -0.702929,
-    -0.704083,
-    -0.705236,
-    -0.706389,
-    -0.707541,
-    -0.708693,
-    -0.709844,
-    -0.710995,
-    -0.712145,
-    -0.713294,
-    -0.714443,
-    -0.715591,
-    -0.716739,
-    -0.717885,
-    -0.719031,
-    -0.720176,
-    -0.721321,
-    -0.722464,
-    -0.723607,
-    -0.724749,
-    -0.72589,
-    -0.72703,
-    -0.728169,
-    -0.729308,
-    -0.730445,
-    -0.731582,
-    -0.732717,
-    -0.733851,
-    -0.734985,
-    -0.736117,
-    -0.737249,
-    -0.738379,
-    -0.739508,
-    -0.740636,
-    -0.741763,
-    -0.742888,
-    -0.744013,
-    -0.745136,
-    -0.746258,
-    -0.747378,
-    -0.748498,
-    -0.749616,
-    -0.750733,
-    -0.751848,
-    -0.752962,
-    -0.754075,
-    -0.755186,
-    -0.756295,
-    -0.757404,
-    -0.75851,
-    -0.759616,
-    -0.760719,
-    -0.761822,
-    -0.762922,
-    -0.764021,
-    -0.765118,
-    -0.766214,
-    -0.767308,
-    -0.7684,
-    -0.769491,
-    -0.77058,
-    -0.771667,
-    -0.772752,
-    -0.773836,
-    -0.774918,
-    -0.775998,
-    -0.777076,
-    -0.778152,
-    -0.779226,
-    -0.780298,
-    -0.781368,
-    -0.782436,
-    -0.783503,
-    -0.784567,
-    -0.785629,
-    -0.786689,
-    -0.787747,
-    -0.788803,
-    -0.789857,
-    -0.790908,
-    -0.791957,
-    -0.793004,
-    -0.794049,
-    -0.795092,
-    -0.796132,
-    -0.79717,
-    -0.798206,
-    -0.799239,
-    -0.80027,
-    -0.801299,
-    -0.802325,
-    -0.803348,
-    -0.804369,
-    -0.805388,
-    -0.806404,
-    -0.807418,
-    -0.808429,
-    -0.809437,
-    -0.810443,
-    -0.811446,
-    -0.812447,
-    -0.813445,
-    -0.81444,
-    -0.815432,
-    -0.816422,
-    -0.817409,
-    -0.818393,
-    -0.819375,
-    -0.820353,
-    -0.821329,
-    -0.822301,
-    -0.823271,
-    -0.824238,
-    -0.825202,
-    -0.826163,
-    -0.827121,
-    -0.828076,
-    -0.829028,
-    -0.829977,
-    -0.830923,
-    -0.831865,
-    -0.832805,
-    -0.833741,
-    -0.834674,
-    -0.835604,
-    -0.836531,
-    -0.837455,
-    -0.838375,
-    -0.839292,
-    -0.840206,
-    -0.841116,
-    -0.842023,
-    -0.842926,
-    -0.843827,
-    -0.844723,
-    -0.845617,
-    -0.846507,
-    -0.847393,
-    -0.848276,
-    -0.849155,
-    -0.850031,
-    -0.850904,
-    -0.851772,
-    -0.852637,
-    -0.853499,
-    -0.854356,
-    -0.855211,
-    -0.856061,
-    -0.856908,
-    -0.857751,
-    -0.85859,
-    -0.859425,
-    -0.860257,
-    -0.861085,
-    -0.861908,
-    -0.862728,
-    -0.863545,
-    -0.864357,
-    -0.865165,
-    -0.86597,
-    -0.86677,
-    -0.867567,
-    -0.868359,
-    -0.869148,
-    -0.869932,
-    -0.870712,
-    -0.871488,
-    -0.872261,
-    -0.873029,
-    -0.873792,
-    -0.874552,
-    -0.875308,
-    -0.876059,
-    -0.876806,
-    -0.877549,
-    -0.878288,
-    -0.879022,
-    -0.879752,
-    -0.880478,
-    -0.881199,
-    -0.881916,
-    -0.882629,
-    -0.883337,
-    -0.884041,
-    -0.88474,
-    -0.885435,
-    -0.886126,
-    -0.886812,
-    -0.887493,
-    -0.88817,
-    -0.888843,
-    -0.889511,
-    -0.890174,
-    -0.890833,
-    -0.891487,
-    -0.892137,
-    -0.892782,
-    -0.893422,
-    -0.894058,
-    -0.894689,
-    -0.895315,
-    -0.895937,
-    -0.896553,
-    -0.897165,
-    -0.897773,
-    -0.898375,
-    -0.898973,
-    -0.899566,
-    -0.900154,
-    -0.900737,
-    -0.901315,
-    -0.901889,
-    -0.902457,
-    -0.903021,
-    -0.90358,
-    -0.904134,
-    -0.904683,
-    -0.905227,
-    -0.905765,
-    -0.906299,
-    -0.906828,
-    -0.907352,
-    -0.907871,
-    -0.908385,
-    -0.908894,
-    -0.909397,
-    -0.909896,
-    -0.910389,
-    -0.910878,
-    -0.911361,
-    -0.911839,
-    -0.912312,
-    -0.91278,
-    -0.913242,
-    -0.9137,
-    -0.914152,
-    -0.914599,
-    -0.915041,
-    -0.915477,
-    -0.915908,
-    -0.916334,
-    -0.916755,
-    -0.917171,
-    -0.917581,
-    -0.917986,
-    -0.918385,
-    -0.918779,
-    -0.919168,
-    -0.919551,
-    -0.91993,
-    -0.920302,
-    -0.92067,
-    -0.921032,
-    -0.921388,
-    -0.921739,
-    -0.922085,
-    -0.922425,
-    -0.92276,
-    -0.92309,
-    -0.923413,
-    -0.923732,
-    -0.924045,
-    -0.924352,
-    -0.924654,
-    -0.924951,
-    -0.925242,
-    -0.925527,
-    -0.925807,
-    -0.926082,
-    -0.926351,
-    -0.926614,
-    -0.926872,
-    -0.927124,
-    -0.927371,
-    -0.927612,
-    -0.927847,
-    -0.928077,
-    -0.928301,
-    -0.92852,
-    -0.928733,
-    -0.928941,
-    -0.929143,
-    -0.929339,
-    -0.92953,
-    -0.929715,
-    -0.929894,
-    -0.930068,
-    -0.930236,
-    -0.930398,
-    -0.930555,
-    -0.930706,
-    -0.930851,
-    -0.930991,
-    -0.931125,
-    -0.931253,
-    -0.931376,
-    -0.931493,
-    -0.931605,
-    -0.93171,
-    -0.93181,
-    -0.931904,
-    -0.931993,
-    -0.932076,
-    -0.932153,
-    -0.932224,
-    -0.93229,
-    -0.93235,
-    -0.932404,
-    -0.932453,
-    -0.932496,
-    -0.932533,
-    -0.932565,
-    -0.93259,
-    -0.93261,
-    -0.932625,
-    -0.932633,
-    -0.932636,
-    -0.932633,
-    -0.932625,
-    -0.93261,
-    -0.93259,
-    -0.932565,
-    -0.932533,
-    -0.932496,
-    -0.932453,
-    -0.932404,
-    -0.93235,
-    -0.93229,
-    -0.932224,
-    -0.932153,
-    -0.932076,
-    -0.931993,
-    -0.931904,
-    -0.93181,
-    -0.93171,
-    -0.931605,
-    -0.931493,
-    -0.931376,
-    -0.931253,
-    -0.931125,
-    -0.930991,
-    -0.930851,
-    -0.930706,
-    -0.930555,
-    -0.930398,
-    -0.930236,
-    -0.930068,
-    -0.929894,
-    -0.929715,
-    -0.92953,
-    -0.929339,
-    -0.929143,
-    -0.928941,
-    -0.928733,
-    -0.92852,
-    -0.928301,
-    -0.928077,
-    -0.927847,
-    -0.927612,
-    -0.927371,
-    -0.927124,
-    -0.926872,
-    -0.926614,
-    -0.926351,
-    -0.926082,
-    -0.925807,
-    -0.925527,
-    -0.925242,
-    -0.924951,
-    -0.924654,
-    -0.924352,
-    -0.924045,
-    -0.923732,
-    -0.923413,
-    -0.92309,
-    -0.92276,
-    -0.922425,
-    -0.922085,
-    -0.921739,
-    -0.921388,
-    -0.921032,
-    -0.92067,
-    -0.920302,
-    -0.91993,
-    -0.919551,
-    -0.919168,
-    -0.918779,
-    -0.918385,
-    -0.917986,
-    -0.917581,
-    -0.917171,
-    -0.916755,
-    -0.916334,
-    -0.915908,
-    -0.915477,
-    -0.915041,
-    -0.914599,
-    -0.914152,
-    -0.9137,
-    -0.913242,
-    -0.91278,
-    -0.912312,
-    -0.911839,
-    -0.911361,
-    -0.910878,
-    -0.910389,
-    -0.909896,
-    -0.909397,
-    -0.908894,
-    -0.908385,
-    -0.907871,
-    -0.907352,
-    -0.906828,
-    -0.906299,
-    -0.905765,
-    -0.905227,
-    -0.904683,
-    -0.904134,
-    -0.90358,
-    -0.903021,
-    -0.902457,
-    -0.901889,
-    -0.901315,
-    -0.900737,
-    -0.900154,
-    -0.899566,
-    -0.898973,
-    -0.898375,
-    -0.897773,
-    -0.897165,
-    -0.896553,
-    -0.895937,
-    -0.895315,
-    -0.894689,
-    -0.894058,
-    -0.893422,
-    -0.892782,
-    -0.892137,
-    -0.891487,
-    -0.890833,
-    -0.890174,
-    -0.889511,
-    -0.888843,
-    -0.88817,
-    -0.887493,
-    -0.886812,
-    -0.886126,
-    -0.885435,
-    -0.88474,
-    -0.884041,
-    -0.883337,
-    -0.882629,
-    -0.881916,
-    -0.881199,
-    -0.880478,
-    -0.879752,
-    -0.879022,
-    -0.878288,
-    -0.877549,
-    -0.876806,
-    -0.876059,
-    -0.875308,
-    -0.874552,
-    -0.873792,
-    -0.873029,
-    -0.872261,
-    -0.871488,
-    -0.870712,
-    -0.869932,
-    -0.869148,
-    -0.868359,
-    -0.867567,
-    -0.86677,
-    -0.86597,
-    -0.865165,
-    -0.864357,
-    -0.863545,
-    -0.862728,
-    -0.861908,
-    -0.861085,
-    -0.860257,
-    -0.859425,
-    -0.85859,
-    -0.857751,
-    -0.856908,
-    -0.856061,
-    -0.855211,
-    -0.854356,
-    -0.853499,
-    -0.852637,
-    -0.851772,
-    -0.850904,
-    -0.850031,
-    -0.849155,
-    -0.848276,
-    -0.847393,
-    -0.846507,
-    -0.845617,
-    -0.844723,
-    -0.843827,
-    -0.842926,
-    -0.842023,
-    -0.841116,
-    -0.840206,
-    -0.839292,
-    -0.838375,
-    -0.837455,
-    -0.836531,
-    -0.835604,
-    -0.834674,
-    -0.833741,
-    -0.832805,
-    -0.831865,
-    -0.830923,
-    -0.829977,
-    -0.829028,
-    -0.828076,
-    -0.827121,
-    -0.826163,
-    -0.825202,
-    -0.824238,
-    -0.823271,
-    -0.822301,
-    -0.821329,
-    -0.820353,
-    -0.819375,
-    -0.818393,
-    -0.817409,
-    -0.816422,
-    -0.815432,
-    -0.81444,
-    -0.813445,
-    -0.812447,
-    -0.811446,
-    -0.810443,
-    -0.809437,
-    -0.808429,
-    -0.807418,
-    -0.806404,
-    -0.805388,
-    -0.804369,
-    -0.803348,
-    -0.802325,
-    -0.801299,
-    -0.80027,
-    -0.799239,
-    -0.798206,
-    -0.79717,
-    -0.796132,
-    -0.795092,
-    -0.794049,
-    -0.793004,
-    -0.791957,
-    -0.790908,
-    -0.789857,
-    -0.788803,
-    -0.787747,
-    -0.786689,
-    -0.785629,
-    -0.784567,
-    -0.783503,
-    -0.782436,
-    -0.781368,
-    -0.780298,
-    -0.779226,
-    -0.778152,
-    -0.777076,
-    -0.775998,
-    -0.774918,
-    -0.773836,
-    -0.772752,
-    -0.771667,
-    -0.77058,
-    -0.769491,
-    -0.7684,
-    -0.767308,
-    -0.766214,
-    -0.765118,
-    -0.764021,
-    -0.762922,
-    -0.761822,
-    -0.760719,
-    -0.759616,
-    -0.75851,
-    -0.757404,
-    -0.756295,
-    -0.755186,
-    -0.754075,
-    -0.752962,
-    -0.751848,
-    -0.750733,
-    -0.749616,
-    -0.748498,
-    -0.747378,
-    -0.746258,
-    -0.745136,
-    -0.744013,
-    -0.742888,
-    -0.741763,
-    -0.740636,
-    -0.739508,
-    -0.738379,
-    -0.737249,
-    -0.736117,
-    -0.734985,
-    -0.733851,
-    -0.732717,
-    -0.731582,
-    -0.730445,
-    -0.729308,
-    -0.728169,
-    -0.72703,
-    -0.72589,
-    -0.724749,
-    -0.723607,
-    -0.722464,
-    -0.721321,
-    -0.720176,
-    -0.719031,
-    -0.717885,
-    -0.716739,
-    -0.715591,
-    -0.714443,
-    -0.713294,
-    -0.712145,
-    -0.710995,
-    -0.709844,
-    -0.708693,
-    -0.707541,
-    -0.706389,
-    -0.705236,
-    -0.704083,
-    -0.702929,
-    -0.701775,
-    -0.70062,
-    -0.699465,
-    -0.698309,
-    -0.697153,
-    -0.695997,
-    -0.69484,
-    -0.693683,
-    -0.692525,
-    -0.691367,
-    -0.690209,
-    -0.689051,
-    -0.687893,
-    -0.686734,
-    -0.685575,
-    -0.684416,
-    -0.683257,
-    -0.682097,
-    -0.680938,
-    -0.679778,
-    -0.678618,
-    -0.677458,
-    -0.676298,
-    -0.675138,
-    -0.673979,
-    -0.672818,
-    -0.671659,
-    -0.670499,
-    -0.669339,
-    -0.668179,
-    -0.667019,
-    -0.665859,
-    -0.6647,
-    -0.663541,
-    -0.662381,
-    -0.661222,
-    -0.660063,
-    -0.658905,
-    -0.657746,
-    -0.656588,
-    -0.65543,
-    -0.654272,
-    -0.653115,
-    -0.651957,
-    -0.6508,
-    -0.649644,
-    -0.648488,
-    -0.647332,
-    -0.646176,
-    -0.645021,
-    -0.643867,
-    -0.642712,
-    -0.641559,
-    -0.640405,
-    -0.639252,
-    -0.6381,
-    -0.636948,
-    -0.635796,
-    -0.634645,
-    -0.633495,
-    -0.632345,
-    -0.631196,
-    -0.630047,
-    -0.628899,
-    -0.627752,
-    -0.626605,
-    -0.625458,
-    -0.624313,
-    -0.623168,
-    -0.622024,
-    -0.62088,
-    -0.619737,
-    -0.618595,
-    -0.617453,
-    -0.616313,
-    -0.615173,
-    -0.614033,
-    -0.612895,
-    -0.611757,
-    -0.61062,
-    -0.609484,
-    -0.608349,
-    -0.607214,
-    -0.606081,
-    -0.604948,
-    -0.603816,
-    -0.602685,
-    -0.601555,
-    -0.600426,
-    -0.599297,
-    -0.59817,
-    -0.597043,
-    -0.595918,
-    -0.594793,
-    -0.593669,
-    -0.592547,
-    -0.591425,
-    -0.590304,
-    -0.589185,
-    -0.588066,
-    -0.586948,
-    -0.585831,
-    -0.584716,
-    -0.583601,
-    -0.582488,
-    -0.581375,
-    -0.580264,
-    -0.579153,
-    -0.578044,
-    -0.576936,
-    -0.575829,
-    -0.574723,
-    -0.573618,
-    -0.572514,
-    -0.571412,
-    -0.57031,
-    -0.56921,
-    -0.568111,
-    -0.567013,
-    -0.565916,
-    -0.56482,
-    -0.563726,
-    -0.562633,
-    -0.561541,
-    -0.56045,
-    -0.55936,
-    -0.558272,
-    -0.557184,
-    -0.556098,
-    -0.555014,
-    -0.55393,
-    -0.552848,
-    -0.551767,
-    -0.550687,
-    -0.549608,
-    -0.548531,
-    -0.547455,
-    -0.546381,
-    -0.545307,
-    -0.544235,
-    -0.543164,
-    -0.542095,
-    -0.541026,
-    -0.539959,
-    -0.538894,
-    -0.537829,
-    -0.536766,
-    -0.535705,
-    -0.534644,
-    -0.533585,
-    -0.532527,
-    -0.531471,
-    -0.530416,
-    -0.529362,
-    -0.52831,
-    -0.527259,
-    -0.526209,
-    -0.52516,
-    -0.524113,
-    -0.523068,
-    -0.522023,
-    -0.52098,
-    -0.519939,
-    -0.518898,
-    -0.517859,
-    -0.516822,
-    -0.515786,
-    -0.514751,
-    -0.513717,
-    -0.512685,
-    -0.511654,
-    -0.510625,
-    -0.509597,
-    -0.50857,
-    -0.507545,
-    -0.506521,
-    -0.505499,
-    -0.504478,
-    -0.503458,
-    -0.502439,
-    -0.501422,
-    -0.500407,
-    -0.499392,
-    -0.498379,
-    -0.497368,
-    -0.496357,
-    -0.495348,
-    -0.494341,
-    -0.493335,
-    -0.49233,
-    -0.491327,
-    -0.490324,
-    -0.489324,
-    -0.488324,
-    -0.487326,
-    -0.48633,
-    -0.485334,
-    -0.48434,
-    -0.483348,
-    -0.482356,
-    -0.481367,
-    -0.480378,
-    -0.479391,
-    -0.478405,
-    -0.47742,
-    -0.476437,
-    -0.475455,
-    -0.474474,
-    -0.473495,
-    -0.472517,
-    -0.47154,
-    -0.470565,
-    -0.469591,
-    -0.468618,
-    -0.467646,
-    -0.466676,
-    -0.465707,
-    -0.464739,
-    -0.463773,
-    -0.462808,
-    -0.461844,
-    -0.460881,
-    -0.45992,
-    -0.45896,
-    -0.458001,
-    -0.457044,
-    -0.456087,
-    -0.455132,
-    -0.454178,
-    -0.453226,
-    -0.452274,
-    -0.451324,
-    -0.450375,
-    -0.449428,
-    -0.448481,
-    -0.447536,
-    -0.446591,
-    -0.445648,
-    -0.444706,
-    -0.443766,
-    -0.442826,
-    -0.441888,
-    -0.440951,
-    -0.440015,
-    -0.43908,
-    -0.438146,
-    -0.437213,
-    -0.436282,
-    -0.435351,
-    -0.434422,
-    -0.433494,
-    -0.432567,
-    -0.431641,
-    -0.430716,
-    -0.429792,
-    -0.428869,
-    -0.427947,
-    -0.427026,
-    -0.426107,
-    -0.425188,
-    -0.42427,
-    -0.423354,
-    -0.422438,
-    -0.421524,
-    -0.42061,
-    -0.419697,
-    -0.418786,
-    -0.417875,
-    -0.416965,
-    -0.416056,
-    -0.415149,
-    -0.414242,
-    -0.413336,
-    -0.412431,
-    -0.411527,
-    -0.410623,
-    -0.409721,
-    -0.40882,
-    -0.407919,
-    -0.407019,
-    -0.406121,
-    -0.405223,
-    -0.404326,
-    -0.403429,
-    -0.402534,
-    -0.401639,
-    -0.400745,
-    -0.399852,
-    -0.39896,
-    -0.398069,
-    -0.397178,
-    -0.396288,
-    -0.395399,
-    -0.39451,
-    -0.393623,
-    -0.392736,
-    -0.391849,
-    -0.390964,
-    -0.390079,
-    -0.389195,
-    -0.388311,
-    -0.387428,
-    -0.386546,
-    -0.385665,
-    -0.384784,
-    -0.383904,
-    -0.383024,
-    -0.382145,
-    -0.381267,
-    -0.380389,
-    -0.379511,
-    -0.378635,
-    -0.377759,
-    -0.376883,
-    -0.376008,
-    -0.375134,
-    -0.37426,
-    -0.373386,
-    -0.372513,
-    -0.371641,
-    -0.370769,
-    -0.369897,
-    -0.369026,
-    -0.368155,
-    -0.367285,
-    -0.366415,
-    -0.365546,
-    -0.364677,
-    -0.363809,
-    -0.36294,
-    -0.362073,
-    -0.361205,
-    -0.360338,
-    -0.359471,
-    -0.358605,
-    -0.357739,
-    -0.356873,
-    -0.356008,
-    -0.355143,
-    -0.354278,
-    -0.353413,
-    -0.352549,
-    -0.351685,
-    -0.350821,
-    -0.349958,
-    -0.349094,
-    -0.348231,
-    -0.347368,
-    -0.346505,
-    -0.345643,
-    -0.34478,
-    -0.343918,
-    -0.343056,
-    -0.342194,
-    -0.341332,
-    -0.340471,
-    -0.339609,
-    -0.338748,
-    -0.337886,
-    -0.337025,
-    -0.336164,
-    -0.335302,
-    -0.334441,
-    -0.33358,
-    -0.332719,
-    -0.331858,
-    -0.330997,
-    -0.330136,
-    -0.329275,
-    -0.328414,
-    -0.327552,
-    -0.326691,
-    -0.32583,
-    -0.324969,
-    -0.324107,
-    -0.323246,
-    -0.322384,
-    -0.321523,
-    -0.320661,
-    -0.319799,
-    -0.318937,
-    -0.318075,
-    -0.317212,
-    -0.31635,
-    -0.315487,
-    -0.314625,
-    -0.313762,
-    -0.312898,
-    -0.312035,
-    -0.311171,
-    -0.310307,
-    -0.309443,
-    -0.308579,
-    -0.307714,
-    -0.306849,
-    -0.305984,
-    -0.305119,
-    -0.304253,
-    -0.303387,
-    -0.30252,
-    -0.301654,
-    -0.300787,
-    -0.299919,
-    -0.299051,
-    -0.298183,
-    -0.297315,
-    -0.296446,
-    -0.295577,
-    -0.294707,
-    -0.293837,
-    -0.292967,
-    -0.292096,
-    -0.291225,
-    -0.290353,
-    -0.289481,
-    -0.288608,
-    -0.287735,
-    -0.286861,
-    -0.285987,
-    -0.285113,
-    -0.284238,
-    -0.283362,
-    -0.282486,
-    -0.28161,
-    -0.280733,
-    -0.279855,
-    -0.278977,
-    -0.278098,
-    -0.277219,
-    -0.276339,
-    -0.275458,
-    -0.274577,
-    -0.273696,
-    -0.272814,
-    -0.271931,
-    -0.271047,
-    -0.270163,
-    -0.269279,
-    -0.268393,
-    -0.267507,
-    -0.266621,
-    -0.265733,
-    -0.264845,
-    -0.263957,
-    -0.263068,
-    -0.262178,
-    -0.261287,
-    -0.260396,
-    -0.259504,
-    -0.258611,
-    -0.257717,
-    -0.256823,
-    -0.255928,
-    -0.255033,
-    -0.254136,
-    -0.253239,
-    -0.252341,
-    -0.251442,
-    -0.250543,
-    -0.249643,
-    -0.248742,
-    -0.24784,
-    -0.246937,
-    -0.246034,
-    -0.24513,
-    -0.244225,
-    -0.243319,
-    -0.242412,
-    -0.241505,
-    -0.240597,
-    -0.239688,
-    -0.238778,
-    -0.237867,
-    -0.236956,
-    -0.236043,
-    -0.23513,
-    -0.234216,
-    -0.233301,
-    -0.232385,
-    -0.231468,
-    -0.23055,
-    -0.229632,
-    -0.228712,
-    -0.227792,
-    -0.226871,
-    -0.225949,
-    -0.225026,
-    -0.224102,
-    -0.223177,
-    -0.222252,
-    -0.221325,
-    -0.220397,
-    -0.219469,
-    -0.21854,
-    -0.217609,
-    -0.216678,
-    -0.215746,
-    -0.214813,
-    -0.213879,
-    -0.212944,
-    -0.212008,
-    -0.211071,
-    -0.210133,
-    -0.209194,
-    -0.208255,
-    -0.207314,
-    -0.206372,
-    -0.20543,
-    -0.204486,
-    -0.203541,
-    -0.202596,
-    -0.201649,
-    -0.200702,
-    -0.199753,
-    -0.198804,
-    -0.197854,
-    -0.196902,
-    -0.19595,
-    -0.194997,
-    -0.194042,
-    -0.193087,
-    -0.192131,
-    -0.191174,
-    -0.190215,
-    -0.189256,
-    -0.188296,
-    -0.187335,
-    -0.186373,
-    -0.185409,
-    -0.184445,
-    -0.18348,
-    -0.182514,
-    -0.181547,
-    -0.180579,
-    -0.17961,
-    -0.17864,
-    -0.177669,
-    -0.176697,
-    -0.175724,
-    -0.174749,
-    -0.173774,
-    -0.172798,
-    -0.171822,
-    -0.170844,
-    -0.169865,
-    -0.168885,
-    -0.167904,
-    -0.166922,
-    -0.165939,
-    -0.164955,
-    -0.16397,
-    -0.162985,
-    -0.161998,
-    -0.16101,
-    -0.160021,
-    -0.159032,
-    -0.158041,
-    -0.15705,
-    -0.156057,
-    -0.155063,
-    -0.154069,
-    -0.153074,
-    -0.152077,
-    -0.15108,
-    -0.150082,
-    -0.149082,
-    -0.148082,
-    -0.147081,
-    -0.146079,
-    -0.145076,
-    -0.144072,
-    -0.143067,
-    -0.142062,
-    -0.141055,
-    -0.140047,
-    -0.139039,
-    -0.138029,
-    -0.137019,
-    -0.136008,
-    -0.134996,
-    -0.133983,
-    -0.132969,
-    -0.131954,
-    -0.130938,
-    -0.129922,
-    -0.128904,
-    -0.127886,
-    -0.126866,
-    -0.125846,
-    -0.124825,
-    -0.123804,
-    -0.122781,
-    -0.121757,
-    -0.120733,
-    -0.119708,
-    -0.118682,
-    -0.117655,
-    -0.116627,
-    -0.115599,
-    -0.11457,
-    -0.113539,
-    -0.112508,
-    -0.111477,
-    -0.110444,
-    -0.109411,
-    -0.108377,
-    -0.107342,
-    -0.106306,
-    -0.10527,
-    -0.104233,
-    -0.103195,
-    -0.102156,
-    -0.101117,
-    -0.100076,
-    -0.0990356,
-    -0.097994,
-    -0.0969516,
-    -0.0959085,
-    -0.0948648,
-    -0.0938203,
-    -0.0927751,
-    -0.0917292,
-    -0.0906827,
-    -0.0896355,
-    -0.0885876,
-    -0.087539,
-    -0.0864898,
-    -0.0854399,
-    -0.0843894,
-    -0.0833382,
-    -0.0822864,
-    -0.081234,
-    -0.080181,
-    -0.0791273,
-    -0.0780731,
-    -0.0770183,
-    -0.0759628,
-    -0.0749068,
-    -0.0738502,
-    -0.0727931,
-    -0.0717353,
-    -0.0706771,
-    -0.0696182,
-    -0.0685589,
-    -0.067499,
-    -0.0664385,
-    -0.0653776,
-    -0.0643162,
-    -0.0632542,
-    -0.0621918,
-    -0.0611288,
-    -0.0600654,
-    -0.0590016,
-    -0.0579372,
-    -0.0568724,
-    -0.0558072,
-    -0.0547415,
-    -0.0536753,
-    -0.0526088,
-    -0.0515418,
-    -0.0504745,
-    -0.0494067,
-    -0.0483385,
-    -0.04727,
-    -0.046201,
-    -0.0451317,
-    -0.0440621,
-    -0.0429921,
-    -0.0419217,
-    -0.040851,
-    -0.03978,
-    -0.0387087,
-    -0.0376371,
-    -0.0365651,
-    -0.0354929,
-    -0.0344203,
-    -0.0333475,
-    -0.0322745,
-    -0.0312011,
-    -0.0301276,
-    -0.0290537,
-    -0.0279797,
-    -0.0269054,
-    -0.0258309,
-    -0.0247562,
-    -0.0236813,
-    -0.0226062,
-    -0.0215309,
-    -0.0204554,
-    -0.0193798,
-    -0.018304,
-    -0.0172281,
-    -0.016152,
-    -0.0150758,
-    -0.0139994,
-    -0.012923,
-    -0.0118465,
-    -0.0107698,
-    -0.00969308,
-    -0.00861627,
-    -0.00753939,
-    -0.00646245,
-    -0.00538545,
-    -0.00430841,
-    -0.00323134,
-    -0.00215424,
-    -0.00107713,
-    0,
-    0.00107713,
-    0.00215424,
-    0.00323134,
-    0.00430841,
-    0.00538545,
-    0.00646245,
-    0.00753939,
-    0.00861627,
-    0.00969308,
-    0.0107698,
-    0.0118465,
-    0.012923,
-    0.0139994,
-    0.0150758,
-    0.016152,
-    0.0172281,
-    0.018304,
-    0.0193798,
-    0.0204554,
-    0.0215309,
-    0.0226062,
-    0.0236813,
-    0.0247562,
-    0.0258309,
-    0.0269054,
-    0.0279797,
-    0.0290537,
-    0.0301276,
-    0.0312011,
-    0.0322745,
-    0.0333475,
-    0.0344203,
-    0.0354929,
-    0.0365651,
-    0.0376371,
-    0.0387087,
-    0.03978,
-    0.040851,
-    0.0419217,
-    0.0429921,
-    0.0440621,
-    0.0451317,
-    0.046201,
-    0.04727,
-    0.0483385,
-    0.0494067,
-    0.0504745,
-    0.0515418,
-    0.0526088,
-    0.0536753,
-    0.0547415,
-    0.0558072,
-    0.0568724,
-    0.0579372,
-    0.0590016,
-    0.0600654,
-    0.0611288,
-    0.0621918,
-    0.0632542,
-    0.0643162,
-    0.0653776,
-    0.0664385,
-    0.067499,
-    0.0685589,
-    0.0696182,
-    0.0706771,
-    0.0717353,
-    0.0727931,
-    0.0738502,
-    0.0749068,
-    0.0759628,
-    0.0770183,
-    0.0780731,
-    0.0791273,
-    0.080181,
-    0.081234,
-    0.0822864,
-    0.0833382,
-    0.0843894,
-    0.0854399,
-    0.0864898,
-    0.087539,
-    0.0885876,
-    0.0896355,
-    0.0906827,
-    0.0917292,
-    0.0927751,
-    0.0938203,
-    0.0948648,
-    0.0959085,
-    0.0969516,
-    0.097994,
-    0.0990356,
-    0.100076,
-    0.101117,
-    0.102156,
-    0.103195,
-    0.104233,
-    0.10527,
-    0.106306,
-    0.107342,
-    0.108377,
-    0.109411,
-    0.110444,
-    0.111477,
-    0.112508,
-    0.113539,
-    0.11457,
-    0.115599,
-    0.116627,
-    0.117655,
-    0.118682,
-    0.119708,
-    0.120733,
-    0.121757,
-    0.122781,
-    0.123804,
-    0.124825,
-    0.125846,
-    0.126866,
-    0.127886,
-    0.128904,
-    0.129922,
-    0.130938,
-    0.131954,
-    0.132969,
-    0.133983,
-    0.134996,
-    0.136008,
-    0.137019,
-    0.138029,
-    0.139039,
-    0.140047,
-    0.141055,
-    0.142062,
-    0.143067,
-    0.144072,
-    0.145076,
-    0.146079,
-    0.147081,
-    0.148082,
-    0.149082,
-    0.150082,
-    0.15108,
-    0.152077,
-    0.153074,
-    0.154069,
-    0.155063,
-    0.156057,
-    0.15705,
-    0.158041,
-    0.159032,
-    0.160021,
-    0.16101,
-    0.161998,
-    0.162985,
-    0.16397,
-    0.164955,
-    0.165939,
-    0.166922,
-    0.167904,
-    0.168885,
-    0.169865,
-    0.170844,
-    0.171822,
-    0.172798,
-    0.173774,
-    0.174749,
-    0.175724,
-    0.176697,
-    0.177669,
-    0.17864,
-    0.17961,
-    0.180579,
-    0.181547,
-    0.182514,
-    0.18348,
-    0.184445,
-    0.185409,
-    0.186373,
-    0.187335,
-    0.188296,
-    0.189256,
-    0.190215,
-    0.191174,
-    0.192131,
-    0.193087,
-    0.194042,
-    0.194997,
-    0.19595,
-    0.196902,
-    0.197854,
-    0.198804,
-    0.199753,
-    0.200702,
-    0.201649,
-    0.202596,
-    0.203541,
-    0.204486,
-    0.20543,
-    0.206372,
-    0.207314,
-    0.208255,
-    0.209194,
-    0.210133,
-    0.211071,
-    0.212008,
-    0.212944,
-    0.213879,
-    0.214813,
-    0.215746,
-    0.216678,
-    0.217609,
-    0.21854,
-    0.219469,
-    0.220397,
-    0.221325,
-    0.222252,
-    0.223177,
-    0.224102,
-    0.225026,
-    0.225949,
-    0.226871,
-    0.227792,
-    0.228712,
-    0.229632,
-    0.23055,
-    0.231468,
-    0.232385,
-    0.233301,
-    0.234216,
-    0.23513,
-    0.236043,
-    0.236956,
-    0.237867,
-    0.238778,
-    0.239688,
-    0.240597,
-    0.241505,
-    0.242412,
-    0.243319,
-    0.244225,
-    0.24513,
-    0.246034,
-    0.246937,
-    0.24784,
-    0.248742,
-    0.249643,
-    0.250543,
-    0.251442,
-    0.252341,
-    0.253239,
-    0.254136,
-    0.255033,
-    0.255928,
-    0.256823,
-    0.257717,
-    0.258611,
-    0.259504,
-    0.260396,
-    0.261287,
-    0.262178,
-    0.263068,
-    0.263957,
-    0.264845,
-    0.265733,
-    0.266621,
-    0.267507,
-    0.268393,
-    0.269279,
-    0.270163,
-    0.271047,
-    0.271931,
-    0.272814,
-    0.273696,
-    0.274577,
-    0.275458,
-    0.276339,
-    0.277219,
-    0.278098,
-    0.278977,
-    0.279855,
-    0.280733,
-    0.28161,
-    0.282486,
-    0.283362,
-    0.284238,
-    0.285113,
-    0.285987,
-    0.286861,
-    0.287735,
-    0.288608,
-    0.289481,
-    0.290353,
-    0.291225,
-    0.292096,
-    0.292967,
-    0.293837,
-    0.294707,
-    0.295577,
-    0.296446,
-    0.297315,
-    0.298183,
-    0.299051,
-    0.299919,
-    0.300787,
-    0.301654,
-    0.30252,
-    0.303387,
-    0.304253,
-    0.305119,
-    0.305984,
-    0.306849,
-    0.307714,
-    0.308579,
-    0.309443,
-    0.310307,
-    0.311171,
-    0.312035,
-    0.312898,
-    0.313762,
-    0.314625,
-    0.315487,
-    0.31635,
-    0.317212,
-    0.318075,
-    0.318937,
-    0.319799,
-    0.320661,
-    0.321523,
-    0.322384,
-    0.323246,
-    0.324107,
-    0.324969,
-    0.32583,
-    0.326691,
-    0.327552,
-    0.328414,
-    0.329275,
-    0.330136,
-    0.330997,
-    0.331858,
-    0.332719,
-    0.33358,
-    0.334441,
-    0.335302,
-    0.336164,
-    0.337025,
-    0.337886,
-    0.338748,
-    0.339609,
-    0.340471,
-    0.341332,
-    0.342194,
-    0.343056,
-    0.343918,
-    0.34478,
-    0.345643,
-    0.346505,
-    0.347368,
-    0.348231,
-    0.349094,
-    0.349958,
-    0.350821,
-    0.351685,
-    0.352549,
-    0.353413,
-    0.354278,
-    0.355143,
-    0.356008,
-    0.356873,
-    0.357739,
-    0.358605,
-    0.359471,
-    0.360338,
-    0.361205,
-    0.362073,
-    0.36294,
-    0.363809,
-    0.364677,
-    0.365546,
-    0.366415,
-    0.367285,
-    0.368155,
-    0.369026,
-    0.369897,
-    0.370769,
-    0.371641,
-    0.372513,
-    0.373386,
-    0.37426,
-    0.375134,
-    0.376008,
-    0.376883,
-    0.377759,
-    0.378635,
-    0.379511,
-    0.380389,
-    0.381267,
-    0.382145,
-    0.383024,
-    0.383904,
-    0.384784,
-    0.385665,
-    0.386546,
-    0.387428,
-    0.388311,
-    0.389195,
-    0.390079,
-    0.390964,
-    0.391849,
-    0.392736,
-    0.393623,
-    0.39451,
-    0.395399,
-    0.396288,
-    0.397178,
-    0.398069,
-    0.39896,
-    0.399852,
-    0.400745,
-    0.401639,
-    0.402534,
-    0.403429,
-    0.404326,
-    0.405223,
-    0.406121,
-    0.407019,
-    0.407919,
-    0.40882,
-    0.409721,
-    0.410623,
-    0.411527,
-    0.412431,
-    0.413336,
-    0.414242,
-    0.415149,
-    0.416056,
-    0.416965,
-    0.417875,
-    0.418786,
-    0.419697,
-    0.42061,
-    0.421524,
-    0.422438,
-    0.423354,
-    0.42427,
-    0.425188,
-    0.426107,
-    0.427026,
-    0.427947,
-    0.428869,
-    0.429792,
-    0.430716,
-    0.431641,
-    0.432567,
-    0.433494,
-    0.434422,
-    0.435351,
-    0.436282,
-    0.437213,
-    0.438146,
-    0.43908,
-    0.440015,
-    0.440951,
-    0.441888,
-    0.442826,
-    0.443766,
-    0.444706,
-    0.445648,
-    0.446591,
-    0.447536,
-    0.448481,
-    0.449428,
-    0.450375,
-    0.451324,
-    0.452274,
-    0.453226,
-    0.454178,
-    0.455132,
-    0.456087,
-    0.457044,
-    0.458001,
-    0.45896,
-    0.45992,
-    0.460881,
-    0.461844,
-    0.462808,
-    0.463773,
-    0.464739,
-    0.465707,
-    0.466676,
-    0.467646,
-    0.468618,
-    0.469591,
-    0.470565,
-    0.47154,
-    0.472517,
-    0.473495,
-    0.474474,
-    0.475455,
-    0.476437,
-    0.47742,
-    0.478405,
-    0.479391,
-    0.480378,
-    0.481367,
-    0.482356,
-    0.483348,
-    0.48434,
-    0.485334,
-    0.48633,
-    0.487326,
-    0.488324,
-    0.489324,
-    0.490324,
-    0.491327,
-    0.49233,
-    0.493335,
-    0.494341,
-    0.495348,
-    0.496357,
-    0.497368,
-    0.498379,
-    0.499392,
-    0.500407,
-    0.501422,
-    0.502439,
-    0.503458,
-    0.504478,
-    0.505499,
-    0.506521,
-    0.507545,
-    0.50857,
-    0.509597,
-    0.510625,
-    0.511654,
-    0.512685,
-    0.513717,
-    0.514751,
-    0.515786,
-    0.516822,
-    0.517859,
-    0.518898,
-    0.519939,
-    0.52098,
-    0.522023,
-    0.523068,
-    0.524113,
-    0.52516,
-    0.526209,
-    0.527259,
-    0.52831,
-    0.529362,
-    0.530416,
-    0.531471,
-    0.532527,
-    0.533585,
-    0.534644,
-    0.535705,
-    0.536766,
-    0.537829,
-    0.538894,
-    0.539959,
-    0.541026,
-    0.542095,
-    0.543164,
-    0.544235,
-    0.545307,
-    0.546381,
-    0.547455,
-    0.548531,
-    0.549608,
-    0.550687,
-    0.551767,
-    0.552848,
-    0.55393,
-    0.555014,
-    0.556098,
-    0.557184,
-    0.558272,
-    0.55936,
-    0.56045,
-    0.561541,
-    0.562633,
-    0.563726,
-    0.56482,
-    0.565916,
-    0.567013,
-    0.568111,
-    0.56921,
-    0.57031,
-    0.571412,
-    0.572514,
-    0.573618,
-    0.574723,
-    0.575829,
-    0.576936,
-    0.578044,
-    0.579153,
-    0.580264,
-    0.581375,
-    0.582488,
-    0.583601,
-    0.584716,
-    0.585831,
-    0.586948,
-    0.588066,
-    0.589185,
-    0.590304,
-    0.591425,
-    0.592547,
-    0.593669,
-    0.594793,
-    0.595918,
-    0.597043,
-    0.59817,
-    0.599297,
-    0.600426,
-    0.601555,
-    0.602685,
-    0.603816,
-    0.604948,
-    0.606081,
-    0.607214,
-    0.608349,
-    0.609484,
-    0.61062,
-    0.611757,
-    0.612895,
-    0.614033,
-    0.615173,
-    0.616313,
-    0.617453,
-    0.618595,
-    0.619737,
-    0.62088,
-    0.622024,
-    0.623168,
-    0.624313,
-    0.625458,
-    0.626605,
-    0.627752,
-    0.628899,
-    0.630047,
-    0.631196,
-    0.632345,
-    0.633495,
-    0.634645,
-    0.635796,
-    0.636948,
-    0.6381,
-    0.639252,
-    0.640405,
-    0.641559,
-    0.642712,
-    0.643867,
-    0.645021,
-    0.646176,
-    0.647332,
-    0.648488,
-    0.649644,
-    0.6508,
-    0.651957,
-    0.653115,
-    0.654272,
-    0.65543,
-    0.656588,
-    0.657746,
-    0.658905,
-    0.660063,
-    0.661222,
-    0.662381,
-    0.663541,
-    0.6647,
-    0.665859,
-    0.667019,
-    0.668179,
-    0.669339,
-    0.670499,
-    0.671659,
-    0.672818,
-    0.673979,
-    0.675138,
-    0.676298,
-    0.677458,
-    0.678618,
-    0.679778,
-    0.680938,
-    0.682097,
-    0.683257,
-    0.684416,
-    0.685575,
-    0.686734,
-    0.687893,
-    0.689051,
-    0.690209,
-    0.691367,
-    0.692525,
-    0.693683,
-    0.69484,
-    0.695997,
-    0.697153,
-    0.698309,
-    0.699465,
-    0.70062,
-    0.701775,
-    0.702929,
-    0.704083,
-    0.705236,
-    0.706389,
-    0.707541,
-    0.708693,
-    0.709844,
-    0.710995,
-    0.712145,
-    0.713294,
-    0.714443,
-    0.715591,
-    0.716739,
-    0.717885,
-    0.719031,
-    0.720176,
-    0.721321,
-    0.722464,
-    0.723607,
-    0.724749,
-    0.72589,
-    0.72703,
-    0.728169,
-    0.729308,
-    0.730445,
-    0.731582,
-    0.732717,
-    0.733851,
-    0.734985,
-    0.736117,
-    0.737249,
-    0.738379,
-    0.739508,
-    0.740636,
-    0.741763,
-    0.742888,
-    0.744013,
-    0.745136,
-    0.746258,
-    0.747378,
-    0.748498,
-    0.749616,
-    0.750733,
-    0.751848,
-    0.752962,
-    0.754075,
-    0.755186,
-    0.756295,
-    0.757404,
-    0.75851,
-    0.759616,
-    0.760719,
-    0.761822,
-    0.762922,
-    0.764021,
-    0.765118,
-    0.766214,
-    0.767308,
-    0.7684,
-    0.769491,
-    0.77058,
-    0.771667,
-    0.772752,
-    0.773836,
-    0.774918,
-    0.775998,
-    0.777076,
-    0.778152,
-    0.779226,
-    0.780298,
-    0.781368,
-    0.782436,
-    0.783503,
-    0.784567,
-    0.785629,
-    0.786689,
-    0.787747,
-    0.788803,
-    0.789857,
-    0.790908,
-    0.791957,
-    0.793004,
-    0.794049,
-    0.795092,
-    0.796132,
-    0.79717,
-    0.798206,
-    0.799239,
-    0.80027,
-    0.801299,
-    0.802325,
-    0.803348,
-    0.804369,
-    0.805388,
-    0.806404,
-    0.807418,
-    0.808429,
-    0.809437,
-    0.810443,
-    0.811446,
-    0.812447,
-    0.813445,
-    0.81444,
-    0.815432,
-    0.816422,
-    0.817409,
-    0.818393,
-    0.819375,
-    0.820353,
-    0.821329,
-    0.822301,
-    0.823271,
-    0.824238,
-    0.825202,
-    0.826163,
-    0.827121,
-    0.828076,
-    0.829028,
-    0.829977,
-    0.830923,
-    0.831865,
-    0.832805,
-    0.833741,
-    0.834674,
-    0.835604,
-    0.836531,
-    0.837455,
-    0.838375,
-    0.839292,
-    0.840206,
-    0.841116,
-    0.842023,
-    0.842926,
-    0.843827,
-    0.844723,
-    0.845617,
-    0.846507,
-    0.847393,
-    0.848276,
-    0.849155,
-    0.850031,
-    0.850904,
-    0.851772,
-    0.852637,
-    0.853499,
-    0.854356,
-    0.855211,
-    0.856061,
-    0.856908,
-    0.857751,
-    0.85859,
-    0.859425,
-    0.860257,
-    0.861085,
-    0.861908,
-    0.862728,
-    0.863545,
-    0.864357,
-    0.865165,
-    0.86597,
-    0.86677,
-    0.867567,
-    0.868359,
-    0.869148,
-    0.869932,
-    0.870712,
-    0.871488,
-    0.872261,
-    0.873029,
-    0.873792,
-    0.874552,
-    0.875308,
-    0.876059,
-    0.876806,
-    0.877549,
-    0.878288,
-    0.879022,
-    0.879752,
-    0.880478,
-    0.881199,
-    0.881916,
-    0.882629,
-    0.883337,
-    0.884041,
-    0.88474,
-    0.885435,
-    0.886126,
-    0.886812,
-    0.887493,
-    0.88817,
-    0.888843,
-    0.889511,
-    0.890174,
-    0.890833,
-    0.891487,
-    0.892137,
-    0.892782,
-    0.893422,
-    0.894058,
-    0.894689,
-    0.895315,
-    0.895937,
-    0.896553,
-    0.897165,
-    0.897773,
-    0.898375,
-    0.898973,
-    0.899566,
-    0.900154,
-    0.900737,
-    0.901315,
-    0.901889,
-    0.902457,
-    0.903021,
-    0.90358,
-    0.904134,
-    0.904683,
-    0.905227,
-    0.905765,
-    0.906299,
-    0.906828,
-    0.907352,
-    0.907871,
-    0.908385,
-    0.908894,
-    0.909397,
-    0.909896,
-    0.910389,
-    0.910878,
-    0.911361,
-    0.911839,
-    0.912312,
-    0.91278,
-    0.913242,
-    0.9137,
-    0.914152,
-    0.914599,
-    0.915041,
-    0.915477,
-    0.915908,
-    0.916334,
-    0.916755,
-    0.917171,
-    0.917581,
-    0.917986,
-    0.918385,
-    0.918779,
-    0.919168,
-    0.919551,
-    0.91993,
-    0.920302,
-    0.92067,
-    0.921032,
-    0.921388,
-    0.921739,
-    0.922085,
-    0.922425,
-    0.92276,
-    0.92309,
-    0.923413,
-    0.923732,
-    0.924045,
-    0.924352,
-    0.924654,
-    0.924951,
-    0.925242,
-    0.925527,
-    0.925807,
-    0.926082,
-    0.926351,
-    0.926614,
-    0.926872,
-    0.927124,
-    0.927371,
-    0.927612,
-    0.927847,
-    0.928077,
-    0.928301,
-    0.92852,
-    0.928733,
-    0.928941,
-    0.929143,
-    0.929339,
-    0.92953,
-    0.929715,
-    0.929894,
-    0.930068,
-    0.930236,
-    0.930398,
-    0.930555,
-    0.930706,
-    0.930851,
-    0.930991,
-    0.931125,
-    0.931253,
-    0.931376,
-    0.931493,
-    0.931605,
-    0.93171,
-    0.93181,
-    0.931904,
-    0.931993,
-    0.932076,
-    0.932153,
-    0.932224,
-    0.93229,
-    0.93235,
-    0.932404,
-    0.932453,
-    0.932496,
-    0.932533,
-    0.932565,
-    0.93259,
-    0.93261,
-    0.932625,
-    0.932633,
-    0.932636,
-    0.932633,
-    0.932625,
-    0.93261,
-    0.93259,
-    0.932565,
-    0.932533,
-    0.932496,
-    0.932453,
-    0.932404,
-    0.93235,
-    0.93229,
-    0.932224,
-    0.932153,
-    0.932076,
-    0.931993,
-    0.931904,
-    0.93181,
-    0.93171,
-    0.931605,
-    0.931493,
-    0.931376,
-    0.931253,
-    0.931125,
-    0.930991,
-    0.930851,
-    0.930706,
-    0.930555,
-    0.930398,
-    0.930236,
-    0.930068,
-    0.929894,
-    0.929715,
-    0.92953,
-    0.929339,
-    0.929143,
-    0.928941,
-    0.928733,
-    0.92852,
-    0.928301,
-    0.928077,
-    0.927847,
-    0.927612,
-    0.927371,
-    0.927124,
-    0.926872,
-    0.926614,
-    0.926351,
-    0.926082,
-    0.925807,
-    0.925527,
-    0.925242,
-    0.924951,
-    0.924654,
-    0.924352,
-    0.924045,
-    0.923732,
-    0.923413,
-    0.92309,
-    0.92276,
-    0.922425,
-    0.922085,
-    0.921739,
-    0.921388,
-    0.921032,
-    0.92067,
-    0.920302,
-    0.91993,
-    0.919551,
-    0.919168,
-    0.918779,
-    0.918385,
-    0.917986,
-    0.917581,
-    0.917171,
-    0.916755,
-    0.916334,
-    0.915908,
-    0.915477,
-    0.915041,
-    0.914599,
-    0.914152,
-    0.9137,
-    0.913242,
-    0.91278,
-    0.912312,
-    0.911839,
-    0.911361,
-    0.910878,
-    0.910389,
-    0.909896,
-    0.909397,
-    0.908894,
-    0.908385,
-    0.907871,
-    0.907352,
-    0.906828,
-    0.906299,
-    0.905765,
-    0.905227,
-    0.904683,
-    0.904134,
-    0.90358,
-    0.903021,
-    0.902457,
-    0.901889,
-    0.901315,
-    0.900737,
-    0.900154,
-    0.899566,
-    0.898973,
-    0.898375,
-    0.897773,
-    0.897165,
-    0.896553,
-    0.895937,
-    0.895315,
-    0.894689,
-    0.894058,
-    0.893422,
-    0.892782,
-    0.892137,
-    0.891487,
-    0.890833,
-    0.890174,
-    0.889511,
-    0.888843,
-    0.88817,
-    0.887493,
-    0.886812,
-    0.886126,
-    0.885435,
-    0.88474,
-    0.884041,
-    0.883337,
-    0.882629,
-    0.881916,
-    0.881199,
-    0.880478,
-    0.879752,
-    0.879022,
-    0.878288,
-    0.877549,
-    0.876806,
-    0.876059,
-    0.875308,
-    0.874552,
-    0.873792,
-    0.873029,
-    0.872261,
-    0.871488,
-    0.870712,
-    0.869932,
-    0.869148,
-    0.868359,
-    0.867567,
-    0.86677,
-    0.86597,
-    0.865165,
-    0.864357,
-    0.863545,
-    0.862728,
-    0.861908,
-    0.861085,
-    0.860257,
-    0.859425,
-    0.85859,
-    0.857751,
-    0.856908,
-    0.856061,
-    0.855211,
-    0.854356,
-    0.853499,
-    0.852637,
-    0.851772,
-    0.850904,
-    0.850031,
-    0.849155,
-    0.848276,
-    0.847393,
-    0.846507,
-    0.845617,
-    0.844723,
-    0.843827,
-    0.842926,
-    0.842023,
-    0.841116,
-    0.840206,
-    0.839292,
-    0.838375,
-    0.837455,
-    0.836531,
-    0.835604,
-    0.834674,
-    0.833741,
-    0.832805,
-    0.831865,
-    0.830923,
-    0.829977,
-    0.829028,
-    0.828076,
-    0.827121,
-    0.826163,
-    0.825202,
-    0.824238,
-    0.823271,
-    0.822301,
-    0.821329,
-    0.820353,
-    0.819375,
-    0.818393,
-    0.817409,
-    0.816422,
-    0.815432,
-    0.81444,
-    0.813445,
-    0.812447,
-    0.811446,
-    0.810443,
-    0.809437,
-    0.808429,
-    0.807418,
-    0.806404,
-    0.805388,
-    0.804369,
-    0.803348,
-    0.802325,
-    0.801299,
-    0.80027,
-    0.799239,
-    0.798206,
-    0.79717,
-    0.796132,
-    0.795092,
-    0.794049,
-    0.793004,
-    0.791957,
-    0.790908,
-    0.789857,
-    0.788803,
-    0.787747,
-    0.786689,
-    0.785629,
-    0.784567,
-    0.783503,
-    0.782436,
-    0.781368,
-    0.780298,
-    0.779226,
-    0.778152,
-    0.777076,
-    0.775998,
-    0.774918,
-    0.773836,
-    0.772752,
-    0.771667,
-    0.77058,
-    0.769491,
-    0.7684,
-    0.767308,
-    0.766214,
-    0.765118,
-    0.764021,
-    0.762922,
-    0.761822,
-    0.760719,
-    0.759616,
-    0.75851,
-    0.757404,
-    0.756295,
-    0.755186,
-    0.754075,
-    0.752962,
-    0.751848,
-    0.750733,
-    0.749616,
-    0.748498,
-    0.747378,
-    0.746258,
-    0.745136,
-    0.744013,
-    0.742888,
-    0.741763,
-    0.740636,
-    0.739508,
-    0.738379,
-    0.737249,
-    0.736117,
-    0.734985,
-    0.733851,
-    0.732717,
-    0.731582,
-    0.730445,
-    0.729308,
-    0.728169,
-    0.72703,
-    0.72589,
-    0.724749,
-    0.723607,
-    0.722464,
-    0.721321,
-    0.720176,
-    0.719031,
-    0.717885,
-    0.716739,
-    0.715591,
-    0.714443,
-    0.713294,
-    0.712145,
-    0.710995,
-    0.709844,
-    0.708693,
-    0.707541,
-    0.706389,
-    0.705236,
-    0.704083,
-    0.702929,
-    0.701775,
-    0.70062,
-    0.699465,
-    0.698309,
-    0.697153,
-    0.695997,
-    0.69484,
-    0.693683,
-    0.692525,
-    0.691367,
-    0.690209,
-    0.689051,
-    0.687893,
-    0.686734,
-    0.685575,
-    0.684416,
-    0.683257,
-    0.682097,
-    0.680938,
-    0.679778,
-    0.678618,
-    0.677458,
-    0.676298,
-    0.675138,
-    0.673979,
-    0.672818,
-    0.671659,
-    0.670499,
-    0.669339,
-    0.668179,
-    0.667019,
-    0.665859,
-    0.6647,
-    0.663541,
-    0.662381,
-    0.661222,
-    0.660063,
-    0.658905,
-    0.657746,
-    0.656588,
-    0.65543,
-    0.654272,
-    0.653115,
-    0.651957,
-    0.6508,
-    0.649644,
-    0.648488,
-    0.647332,
-    0.646176,
-    0.645021,
-    0.643867,
-    0.642712,
-    0.641559,
-    0.640405,
-    0.639252,
-    0.6381,
-    0.636948,
-    0.635796,
-    0.634645,
-    0.633495,
-    0.632345,
-    0.631196,
-    0.630047,
-    0.628899,
-    0.627752,
-    0.626605,
-    0.625458,
-    0.624313,
-    0.623168,
-    0.622024,
-    0.62088,
-    0.619737,
-    0.618595,
-    0.617453,
-    0.616313,
-    0.615173,
-    0.614033,
-    0.612895,
-    0.611757,
-    0.61062,
-    0.609484,
-    0.608349,
-    0.607214,
-    0.606081,
-    0.604948,
-    0.603816,
-    0.602685,
-    0.601555,
-    0.600426,
-    0.599297,
-    0.59817,
-    0.597043,
-    0.595918,
-    0.594793,
-    0.593669,
-    0.592547,
-    0.591425,
-    0.590304,
-    0.589185,
-    0.588066,
-    0.586948,
-    0.585831,
-    0.584716,
-    0.583601,
-    0.582488,
-    0.581375,
-    0.580264,
-    0.579153,
-    0.578044,
-    0.576936,
-    0.575829,
-    0.574723,
-    0.573618,
-    0.572514,
-    0.571412,
-    0.57031,
-    0.56921,
-    0.568111,
-    0.567013,
-    0.565916,
-    0.56482,
-    0.563726,
-    0.562633,
-    0.561541,
-    0.56045,
-    0.55936,
-    0.558272,
-    0.557184,
-    0.556098,
-    0.555014,
-    0.55393,
-    0.552848,
-    0.551767,
-    0.550687,
-    0.549608,
-    0.548531,
-    0.547455,
-    0.546381,
-    0.545307,
-    0.544235,
-    0.543164,
-    0.542095,
-    0.541026,
-    0.539959,
-    0.538894,
-    0.537829,
-    0.536766,
-    0.535705,
-    0.534644,
-    0.533585,
-    0.532527,
-    0.531471,
-    0.530416,
-    0.529362,
-    0.52831,
-    0.527259,
-    0.526209,
-    0.52516,
-    0.524113,
-    0.523068,
-    0.522023,
-    0.52098,
-    0.519939,
-    0.518898,
-    0.517859,
-    0.516822,
-    0.515786,
-    0.514751,
-    0.513717,
-    0.512685,
-    0.511654,
-    0.510625,
-    0.509597,
-    0.50857,
-    0.507545,
-    0.506521,
-    0.505499,
-    0.504478,
-    0.503458,
-    0.502439,
-    0.501422,
-    0.500407,
-    0.499392,
-    0.498379,
-    0.497368,
-    0.496357,
-    0.495348,
-    0.494341,
-    0.493335,
-    0.49233,
-    0.491327,
-    0.490324,
-    0.489324,
-    0.488324,
-    0.487326,
-    0.48633,
-    0.485334,
-    0.48434,
-    0.483348,
-    0.482356,
-    0.481367,
-    0.480378,
-    0.479391,
-    0.478405,
-    0.47742,
-    0.476437,
-    0.475455,
-    0.474474,
-    0.473495,
-    0.472517,
-    0.47154,
-    0.470565,
-    0.469591,
-    0.468618,
-    0.467646,
-    0.466676,
-    0.465707,
-    0.464739,
-    0.463773,
-    0.462808,
-    0.461844,
-    0.460881,
-    0.45992,
-    0.45896,
-    0.458001,
-    0.457044,
-    0.456087,
-    0.455132,
-    0.454178,
-    0.453226,
-    0.452274,
-    0.451324,
-    0.450375,
-    0.449428,
-    0.448481,
-    0.447536,
-    0.446591,
-    0.445648,
-    0.444706,
-    0.443766,
-    0.442826,
-    0.441888,
-    0.440951,
-    0.440015,
-    0.43908,
-    0.438146,
-    0.437213,
-    0.436282,
-    0.435351,
-    0.434422,
-    0.433494,
-    0.432567,
-    0.431641,
-    0.430716,
-    0.429792,
-    0.428869,
-    0.427947,
-    0.427026,
-    0.426107,
-    0.425188,
-    0.42427,
-    0.423354,
-    0.422438,
-    0.421524,
-    0.42061,
-    0.419697,
-    0.418786,
-    0.417875,
-    0.416965,
-    0.416056,
-    0.415149,
-    0.414242,
-    0.413336,
-    0.412431,
-    0.411527,
-    0.410623,
-    0.409721,
-    0.40882,
-    0.407919,
-    0.407019,
-    0.406121,
-    0.405223,
-    0.404326,
-    0.403429,
-    0.402534,
-    0.401639,
-    0.400745,
-    0.399852,
-    0.39896,
-    0.398069,
-    0.397178,
-    0.396288,
-    0.395399,
-    0.39451,
-    0.393623,
-    0.392736,
-    0.391849,
-    0.390964,
-    0.390079,
-    0.389195,
-    0.388311,
-    0.387428,
-    0.386546,
-    0.385665,
-    0.384784,
-    0.383904,
-    0.383024,
-    0.382145,
-    0.381267,
-    0.380389,
-    0.379511,
-    0.378635,
-    0.377759,
-    0.376883,
-    0.376008,
-    0.375134,
-    0.37426,
-    0.373386,
-    0.372513,
-    0.371641,
-    0.370769,
-    0.369897,
-    0.369026,
-    0.368155,
-    0.367285,
-    0.366415,
-    0.365546,
-    0.364677,
-    0.363809,
-    0.36294,
-    0.362073,
-    0.361205,
-    0.360338,
-    0.359471,
-    0.358605,
-    0.357739,
-    0.356873,
-    0.356008,
-    0.355143,
-    0.354278,
-    0.353413,
-    0.352549,
-    0.351685,
-    0.350821,
-    0.349958,
-    0.349094,
-    0.348231,
-    0.347368,
-    0.346505,
-    0.345643,
-    0.34478,
-    0.343918,
-    0.343056,
-    0.342194,
-    0.341332,
-    0.340471,
-    0.339609,
-    0.338748,
-    0.337886,
-    0.337025,
-    0.336164,
-    0.335302,
-    0.334441,
-    0.33358,
-    0.332719,
-    0.331858,
-    0.330997,
-    0.330136,
-    0.329275,
-    0.328414,
-    0.327552,
-    0.326691,
-    0.32583,
-    0.324969,
-    0.324107,
-    0.323246,
-    0.322384,
-    0.321523,
-    0.320661,
-    0.319799,
-    0.318937,
-    0.318075,
-    0.317212,
-    0.31635,
-    0.315487,
-    0.314625,
-    0.313762,
-    0.312898,
-    0.312035,
-    0.311171,
-    0.310307,
-    0.309443,
-    0.308579,
-    0.307714,
-    0.306849,
-    0.305984,
-    0.305119,
-    0.304253,
-    0.303387,
-    0.30252,
-    0.301654,
-    0.300787,
-    0.299919,
-    0.299051,
-    0.298183,
-    0.297315,
-    0.296446,
-    0.295577,
-    0.294707,
-    0.293837,
-    0.292967,
-    0.292096,
-    0.291225,
-    0.290353,
-    0.289481,
-    0.288608,
-    0.287735,
-    0.286861,
-    0.285987,
-    0.285113,
-    0.284238,
-    0.283362,
-    0.282486,
-    0.28161,
-    0.280733,
-    0.279855,
-    0.278977,
-    0.278098,
-    0.277219,
-    0.276339,
-    0.275458,
-    0.274577,
-    0.273696,
-    0.272814,
-    0.271931,
-    0.271047,
-    0.270163,
-    0.269279,
-    0.268393,
-    0.267507,
-    0.266621,
-    0.265733,
-    0.264845,
-    0.263957,
-    0.263068,
-    0.262178,
-    0.261287,
-    0.260396,
-    0.259504,
-    0.258611,
-    0.257717,
-    0.256823,
-    0.255928,
-    0.255033,
-    0.254136,
-    0.253239,
-    0.252341,
-    0.251442,
-    0.250543,
-    0.249643,
-    0.248742,
-    0.24784,
-    0.246937,
-    0.246034,
-    0.24513,
-    0.244225,
-    0.243319,
-    0.242412,
-    0.241505,
-    0.240597,
-    0.239688,
-    0.238778,
-    0.237867,
-    0.236956,
-    0.236043,
-    0.23513,
-    0.234216,
-    0.233301,
-    0.232385,
-    0.231468,
-    0.23055,
-    0.229632,
-    0.228712,
-    0.227792,
-    0.226871,
-    0.225949,
-    0.225026,
-    0.224102,
-    0.223177,
-    0.222252,
-    0.221325,
-    0.220397,
-    0.219469,
-    0.21854,
-    0.217609,
-    0.216678,
-    0.215746,
-    0.214813,
-    0.213879,
-    0.212944,
-    0.212008,
-    0.211071,
-    0.210133,
-    0.209194,
-    0.208255,
-    0.207314,
-    0.206372,
-    0.20543,
-    0.204486,
-    0.203541,
-    0.202596,
-    0.201649,
-    0.200702,
-    0.199753,
-    0.198804,
-    0.197854,
-    0.196902,
-    0.19595,
-    0.194997,
-    0.194042,
-    0.193087,
-    0.192131,
-    0.191174,
-    0.190215,
-    0.189256,
-    0.188296,
-    0.187335,
-    0.186373,
-    0.185409,
-    0.184445,
-    0.18348,
-    0.182514,
-    0.181547,
-    0.180579,
-    0.17961,
-    0.17864,
-    0.177669,
-    0.176697,
-    0.175724,
-    0.174749,
-    0.173774,
-    0.172798,
-    0.171822,
-    0.170844,
-    0.169865,
-    0.168885,
-    0.167904,
-    0.166922,
-    0.165939,
-    0.164955,
-    0.16397,
-    0.162985,
-    0.161998,
-    0.16101,
-    0.160021,
-    0.159032,
-    0.158041,
-    0.15705,
-    0.156057,
-    0.155063,
-    0.154069,
-    0.153074,
-    0.152077,
-    0.15108,
-    0.150082,
-    0.149082,
-    0.148082,
-    0.147081,
-    0.146079,
-    0.145076,
-    0.144072,
-    0.143067,
-    0.142062,
-    0.141055,
-    0.140047,
-    0.139039,
-    0.138029,
-    0.137019,
-    0.136008,
-    0.134996,
-    0.133983,
-    0.132969,
-    0.131954,
-    0.130938,
-    0.129922,
-    0.128904,
-    0.127886,
-    0.126866,
-    0.125846,
-    0.124825,
-    0.123804,
-    0.122781,
-    0.121757,
-    0.120733,
-    0.119708,
-    0.118682,
-    0.117655,
-    0.116627,
-    0.115599,
-    0.11457,
-    0.113539,
-    0.112508,
-    0.111477,
-    0.110444,
-    0.109411,
-    0.108377,
-    0.107342,
-    0.106306,
-    0.10527,
-    0.104233,
-    0.103195,
-    0.102156,
-    0.101117,
-    0.100076,
-    0.0990356,
-    0.097994,
-    0.0969516,
-    0.0959085,
-    0.0948648,
-    0.0938203,
-    0.0927751,
-    0.0917292,
-    0.0906827,
-    0.0896355,
-    0.0885876,
-    0.087539,
-    0.0864898,
-    0.0854399,
-    0.0843894,
-    0.0833382,
-    0.0822864,
-    0.081234,
-    0.080181,
-    0.0791273,
-    0.0780731,
-    0.0770183,
-    0.0759628,
-    0.0749068,
-    0.0738502,
-    0.0727931,
-    0.0717353,
-    0.0706771,
-    0.0696182,
-    0.0685589,
-    0.067499,
-    0.0664385,
-    0.0653776,
-    0.0643162,
-    0.0632542,
-    0.0621918,
-    0.0611288,
-    0.0600654,
-    0.0590016,
-    0.0579372,
-    0.0568724,
-    0.0558072,
-    0.0547415,
-    0.0536753,
-    0.0526088,
-    0.0515418,
-    0.0504745,
-    0.0494067,
-    0.0483385,
-    0.04727,
-    0.046201,
-    0.0451317,
-    0.0440621,
-    0.0429921,
-    0.0419217,
-    0.040851,
-    0.03978,
-    0.0387087,
-    0.0376371,
-    0.0365651,
-    0.0354929,
-    0.0344203,
-    0.0333475,
-    0.0322745,
-    0.0312011,
-    0.0301276,
-    0.0290537,
-    0.0279797,
-    0.0269054,
-    0.0258309,
-    0.0247562,
-    0.0236813,
-    0.0226062,
-    0.0215309,
-    0.0204554,
-    0.0193798,
-    0.018304,
-    0.0172281,
-    0.016152,
-    0.0150758,
-    0.0139994,
-    0.012923,
-    0.0118465,
-    0.0107698,
-    0.00969308,
-    0.00861627,
-    0.00753939,
-    0.00646245,
-    0.00538545,
-    0.00430841,
-    0.00323134,
-    0.00215424,
-    0.00107713
-};
-
-// Top frequency: 44.1K * 0.2322
-constexpr static std::array<float, 4096> wt_triangle_0x9 =
-{
-    0,
-    -0.00124284,
-    -0.00248567,
-    -0.0037285,
-    -0.00497132,
-    -0.00621413,
-    -0.00745693,
-    -0.00869971,
-    -0.00994246,
-    -0.0111852,
-    -0.0124279,
-    -0.0136706,
-    -0.0149132,
-    -0.0161558,
-    -0.0173984,
-    -0.0186409,
-    -0.0198834,
-    -0.0211259,
-    -0.0223683,
-    -0.0236106,
-    -0.0248529,
-    -0.0260951,
-    -0.0273373,
-    -0.0285794,
-    -0.0298214,
-    -0.0310634,
-    -0.0323052,
-    -0.0335471,
-    -0.0347888,
-    -0.0360304,
-    -0.037272,
-    -0.0385135,
-    -0.0397549,
-    -0.0409962,
-    -0.0422374,
-    -0.0434785,
-    -0.0447195,
-    -0.0459604,
-    -0.0472011,
-    -0.0484418,
-    -0.0496824,
-    -0.0509228,
-    -0.0521631,
-    -0.0534033,
-    -0.0546434,
-    -0.0558833,
-    -0.0571232,
-    -0.0583628,
-    -0.0596024,
-    -0.0608418,
-    -0.062081,
-    -0.0633202,
-    -0.0645591,
-    -0.0657979,
-    -0.0670366,
-    -0.0682751,
-    -0.0695134,
-    -0.0707516,
-    -0.0719896,
-    -0.0732274,
-    -0.0744651,
-    -0.0757026,
-    -0.0769399,
-    -0.078177,
-    -0.079414,
-    -0.0806507,
-    -0.0818873,
-    -0.0831237,
-    -0.0843599,
-    -0.0855959,
-    -0.0868316,
-    -0.0880672,
-    -0.0893026,
-    -0.0905377,
-    -0.0917727,
-    -0.0930074,
-    -0.0942419,
-    -0.0954762,
-    -0.0967103,
-    -0.0979441,
-    -0.0991777,
-    -0.100411,
-    -0.101644,
-    -0.102877,
-    -0.10411,
-    -0.105342,
-    -0.106574,
-    -0.107806,
-    -0.109038,
-    -0.110269,
-    -0.111501,
-    -0.112731,
-    -0.113962,
-    -0.115192,
-    -0.116422,
-    -0.117652,
-    -0.118882,
-    -0.120111,
-    -0.12134,
-    -0.122569,
-    -0.123797,
-    -0.125025,
-    -0.126253,
-    -0.12748,
-    -0.128708,
-    -0.129935,
-    -0.131161,
-    -0.132387,
-    -0.133613,
-    -0.134839,
-    -0.136064,
-    -0.137289,
-    -0.138514,
-    -0.139739,
-    -0.140963,
-    -0.142186,
-    -0.14341,
-    -0.144633,
-    -0.145855,
-    -0.147078,
-    -0.1483,
-    -0.149521,
-    -0.150743,
-    -0.151964,
-    -0.153184,
-    -0.154405,
-    -0.155625,
-    -0.156844,
-    -0.158063,
-    -0.159282,
-    -0.1605,
-    -0.161718,
-    -0.162936,
-    -0.164153,
-    -0.16537,
-    -0.166587,
-    -0.167803,
-    -0.169018,
-    -0.170234,
-    -0.171449,
-    -0.172663,
-    -0.173877,
-    -0.175091,
-    -0.176304,
-    -0.177517,
-    -0.178729,
-    -0.179941,
-    -0.181153,
-    -0.182364,
-    -0.183575,
-    -0.184785,
-    -0.185995,
-    -0.187204,
-    -0.188413,
-    -0.189622,
-    -0.19083,
-    -0.192038,
-    -0.193245,
-    -0.194452,
-    -0.195658,
-    -0.196864,
-    -0.198069,
-    -0.199274,
-    -0.200478,
-    -0.201682,
-    -0.202886,
-    -0.204089,
-    -0.205291,
-    -0.206493,
-    -0.207695,
-    -0.208896,
-    -0.210097,
-    -0.211297,
-    -0.212496,
-    -0.213695,
-    -0.214894,
-    -0.216092,
-    -0.21729,
-    -0.218487,
-    -0.219683,
-    -0.220879,
-    -0.222075,
-    -0.22327,
-    -0.224464,
-    -0.225658,
-    -0.226851,
-    -0.228044,
-    -0.229237,
-    -0.230428,
-    -0.23162,
-    -0.23281,
-    -0.234001,
-    -0.23519,
-    -0.236379,
-    -0.237568,
-    -0.238756,
-    -0.239943,
-    -0.24113,
-    -0.242316,
-    -0.243502,
-    -0.244687,
-    -0.245871,
-    -0.247055,
-    -0.248239,
-    -0.249421,
-    -0.250604,
-    -0.251785,
-    -0.252966,
-    -0.254147,
-    -0.255326,
-    -0.256506,
-    -0.257684,
-    -0.258862,
-    -0.26004,
-    -0.261216,
-    -0.262392,
-    -0.263568,
-    -0.264743,
-    -0.265917,
-    -0.267091,
-    -0.268264,
-    -0.269436,
-    -0.270608,
-    -0.271779,
-    -0.27295,
-    -0.27412,
-    -0.275289,
-    -0.276458,
-    -0.277625,
-    -0.278793,
-    -0.279959,
-    -0.281125,
-    -0.282291,
-    -0.283455,
-    -0.284619,
-    -0.285782,
-    -0.286945,
-    -0.288107,
-    -0.289268,
-    -0.290429,
-    -0.291589,
-    -0.292748,
-    -0.293907,
-    -0.295064,
-    -0.296221,
-    -0.297378,
-    -0.298534,
-    -0.299689,
-    -0.300843,
-    -0.301997,
-    -0.30315,
-    -0.304302,
-    -0.305453,
-    -0.306604,
-    -0.307754,
-    -0.308903,
-    -0.310052,
-    -0.3112,
-    -0.312347,
-    -0.313493,
-    -0.314639,
-    -0.315784,
-    -0.316928,
-    -0.318072,
-    -0.319214,
-    -0.320356,
-    -0.321497,
-    -0.322638,
-    -0.323778,
-    -0.324916,
-    -0.326055,
-    -0.327192,
-    -0.328329,
-    -0.329464,
-    -0.330599,
-    -0.331734,
-    -0.332867,
-    -0.334,
-    -0.335132,
-    -0.336263,
-    -0.337393,
-    -0.338523,
-    -0.339652,
-    -0.34078,
-    -0.341907,
-    -0.343033,
-    -0.344159,
-    -0.345283,
-    -0.346407,
-    -0.34753,
-    -0.348653,
-    -0.349774,
-    -0.350895,
-    -0.352015,
-    -0.353134,
-    -0.354252,
-    -0.355369,
-    -0.356486,
-    -0.357601,
-    -0.358716,
-    -0.35983,
-    -0.360943,
-    -0.362055,
-    -0.363167,
-    -0.364277,
-    -0.365387,
-    -0.366496,
-    -0.367604,
-    -0.368711,
-    -0.369817,
-    -0.370923,
-    -0.372027,
-    -0.373131,
-    -0.374234,
-    -0.375335,
-    -0.376436,
-    -0.377537,
-    -0.378636,
-    -0.379734,
-    -0.380831,
-    -0.381928,
-    -0.383024,
-    -0.384118,
-    -0.385212,
-    -0.386305,
-    -0.387397,
-    -0.388488,
-    -0.389578,
-    -0.390668,
-    -0.391756,
-    -0.392844,
-    -0.39393,
-    -0.395016,
-    -0.3961,
-    -0.397184,
-    -0.398267,
-    -0.399349,
-    -0.40043,
-    -0.401509,
-    -0.402588,
-    -0.403667,
-    -0.404744,
-    -0.40582,
-    -0.406895,
-    -0.407969,
-    -0.409043,
-    -0.410115,
-    -0.411186,
-    -0.412257,
-    -0.413326,
-    -0.414395,
-    -0.415462,
-    -0.416529,
-    -0.417594,
-    -0.418659,
-    -0.419722,
-    -0.420785,
-    -0.421846,
-    -0.422907,
-    -0.423967,
-    -0.425025,
-    -0.426083,
-    -0.427139,
-    -0.428195,
-    -0.42925,
-    -0.430303,
-    -0.431356,
-    -0.432407,
-    -0.433458,
-    -0.434507,
-    -0.435556,
-    -0.436603,
-    -0.43765,
-    -0.438695,
-    -0.439739,
-    -0.440783,
-    -0.441825,
-    -0.442866,
-    -0.443907,
-    -0.444946,
-    -0.445984,
-    -0.447021,
-    -0.448057,
-    -0.449092,
-    -0.450126,
-    -0.451159,
-    -0.45219,
-    -0.453221,
-    -0.454251,
-    -0.455279,
-    -0.456307,
-    -0.457333,
-    -0.458359,
-    -0.459383,
-    -0.460406,
-    -0.461428,
-    -0.462449,
-    -0.463469,
-    -0.464488,
-    -0.465506,
-    -0.466523,
-    -0.467538,
-    -0.468553,
-    -0.469566,
-    -0.470578,
-    -0.47159,
-    -0.4726,
-    -0.473609,
-    -0.474616,
-    -0.475623,
-    -0.476629,
-    -0.477633,
-    -0.478637,
-    -0.479639,
-    -0.48064,
-    -0.48164,
-    -0.482639,
-    -0.483636,
-    -0.484633,
-    -0.485628,
-    -0.486623,
-    -0.487616,
-    -0.488608,
-    -0.489598,
-    -0.490588,
-    -0.491577,
-    -0.492564,
-    -0.49355,
-    -0.494535,
-    -0.495519,
-    -0.496502,
-    -0.497483,
-    -0.498464,
-    -0.499443,
-    -0.500421,
-    -0.501398,
-    -0.502373,
-    -0.503348,
-    -0.504321,
-    -0.505293,
-    -0.506264,
-    -0.507234,
-    -0.508203,
-    -0.50917,
-    -0.510136,
-    -0.511101,
-    -0.512065,
-    -0.513027,
-    -0.513989,
-    -0.514949,
-    -0.515908,
-    -0.516865,
-    -0.517822,
-    -0.518777,
-    -0.519731,
-    -0.520684,
-    -0.521636,
-    -0.522586,
-    -0.523535,
-    -0.524483,
-    -0.52543,
-    -0.526375,
-    -0.527319,
-    -0.528262,
-    -0.529204,
-    -0.530144,
-    -0.531084,
-    -0.532022,
-    -0.532958,
-    -0.533894,
-    -0.534828,
-    -0.535761,
-    -0.536693,
-    -0.537623,
-    -0.538552,
-    -0.53948,
-    -0.540407,
-    -0.541332,
-    -0.542256,
-    -0.543179,
-    -0.5441,
-    -0.545021,
-    -0.54594,
-    -0.546857,
-    -0.547774,
-    -0.548689,
-    -0.549603,
-    -0.550515,
-    -0.551426,
-    -0.552336,
-    -0.553245,
-    -0.554152,
-    -0.555058,
-    -0.555963,
-    -0.556866,
-    -0.557768,
-    -0.558669,
-    -0.559569,
-    -0.560467,
-    -0.561364,
-    -0.562259,
-    -0.563153,
-    -0.564046,
-    -0.564938,
-    -0.565828,
-    -0.566717,
-    -0.567604,
-    -0.568491,
-    -0.569375,
-    -0.570259,
-    -0.571141,
-    -0.572022,
-    -0.572901,
-    -0.57378,
-    -0.574656,
-    -0.575532,
-    -0.576406,
-    -0.577279,
-    -0.57815,
-    -0.57902,
-    -0.579889,
-    -0.580756,
-    -0.581622,
-    -0.582487,
-    -0.58335,
-    -0.584211,
-    -0.585072,
-    -0.585931,
-    -0.586789,
-    -0.587645,
-    -0.5885,
-    -0.589353,
-    -0.590206,
-    -0.591056,
-    -0.591906,
-    -0.592754,
-    -0.5936,
-    -0.594445,
-    -0.595289,
-    -0.596132,
-    -0.596973,
-    -0.597812,
-    -0.59865,
-    -0.599487,
-    -0.600322,
-    -0.601156,
-    -0.601989,
-    -0.60282,
-    -0.60365,
-    -0.604478,
-    -0.605305,
-    -0.60613,
-    -0.606954,
-    -0.607777,
-    -0.608598,
-    -0.609417,
-    -0.610236,
-    -0.611053,
-    -0.611868,
-    -0.612682,
-    -0.613494,
-    -0.614305,
-    -0.615115,
-    -0.615923,
-    -0.61673,
-    -0.617535,
-    -0.618339,
-    -0.619141,
-    -0.619942,
-    -0.620742,
-    -0.62154,
-    -0.622336,
-    -0.623131,
-    -0.623925,
-    -0.624717,
-    -0.625508,
-    -0.626297,
-    -0.627085,
-    -0.627871,
-    -0.628656,
-    -0.629439,
-    -0.630221,
-    -0.631001,
-    -0.63178,
-    -0.632557,
-    -0.633333,
-    -0.634107,
-    -0.63488,
-    -0.635652,
-    -0.636422,
-    -0.63719,
-    -0.637957,
-    -0.638722,
-    -0.639486,
-    -0.640249,
-    -0.641009,
-    -0.641769,
-    -0.642527,
-    -0.643283,
-    -0.644038,
-    -0.644791,
-    -0.645543,
-    -0.646293,
-    -0.647042,
-    -0.647789,
-    -0.648535,
-    -0.649279,
-    -0.650022,
-    -0.650763,
-    -0.651502,
-    -0.65224,
-    -0.652977,
-    -0.653712,
-    -0.654445,
-    -0.655177,
-    -0.655908,
-    -0.656637,
-    -0.657364,
-    -0.65809,
-    -0.658814,
-    -0.659536,
-    -0.660257,
-    -0.660977,
-    -0.661695,
-    -0.662411,
-    -0.663126,
-    -0.66384,
-    -0.664551,
-    -0.665261,
-    -0.66597,
-    -0.666677,
-    -0.667383,
-    -0.668086,
-    -0.668789,
-    -0.66949,
-    -0.670189,
-    -0.670886,
-    -0.671582,
-    -0.672277,
-    -0.67297,
-    -0.673661,
-    -0.674351,
-    -0.675039,
-    -0.675725,
-    -0.67641,
-    -0.677093,
-    -0.677775,
-    -0.678455,
-    -0.679134,
-    -0.679811,
-    -0.680486,
-    -0.68116,
-    -0.681832,
-    -0.682503,
-    -0.683172,
-    -0.683839,
-    -0.684505,
-    -0.685169,
-    -0.685831,
-    -0.686492,
-    -0.687151,
-    -0.687809,
-    -0.688465,
-    -0.689119,
-    -0.689772,
-    -0.690423,
-    -0.691073,
-    -0.691721,
-    -0.692367,
-    -0.693012,
-    -0.693655,
-    -0.694296,
-    -0.694936,
-    -0.695574,
-    -0.696211,
-    -0.696846,
-    -0.697479,
-    -0.69811,
-    -0.69874,
-    -0.699369,
-    -0.699995,
-    -0.70062,
-    -0.701244,
-    -0.701865,
-    -0.702485,
-    -0.703104,
-    -0.70372,
-    -0.704335,
-    -0.704949,
-    -0.705561,
-    -0.706171,
-    -0.706779,
-    -0.707386,
-    -0.707991,
-    -0.708595,
-    -0.709196,
-    -0.709796,
-    -0.710395,
-    -0.710992,
-    -0.711587,
-    -0.71218,
-    -0.712772,
-    -0.713362,
-    -0.71395,
-    -0.714537,
-    -0.715122,
-    -0.715705,
-    -0.716287,
-    -0.716867,
-    -0.717445,
-    -0.718022,
-    -0.718597,
-    -0.71917,
-    -0.719742,
-    -0.720311,
-    -0.72088,
-    -0.721446,
-    -0.722011,
-    -0.722574,
-    -0.723135,
-    -0.723695,
-    -0.724253,
-    -0.724809,
-    -0.725364,
-    -0.725916,
-    -0.726467,
-    -0.727017,
-    -0.727565,
-    -0.728111,
-    -0.728655,
-    -0.729197,
-    -0.729738,
-    -0.730277,
-    -0.730815,
-    -0.73135,
-    -0.731884,
-    -0.732417,
-    -0.732947,
-    -0.733476,
-    -0.734003,
-    -0.734528,
-    -0.735052,
-    -0.735574,
-    -0.736094,
-    -0.736612,
-    -0.737129,
-    -0.737644,
-    -0.738157,
-    -0.738669,
-    -0.739179,
-    -0.739687,
-    -0.740193,
-    -0.740697,
-    -0.7412,
-    -0.741701,
-    -0.7422,
-    -0.742698,
-    -0.743194,
-    -0.743688,
-    -0.74418,
-    -0.744671,
-    -0.745159,
-    -0.745647,
-    -0.746132,
-    -0.746615,
-    -0.747097,
-    -0.747577,
-    -0.748055,
-    -0.748532,
-    -0.749007,
-    -0.74948,
-    -0.749951,
-    -0.75042,
-    -0.750888,
-    -0.751354,
-    -0.751818,
-    -0.75228,
-    -0.752741,
-    -0.7532,
-    -0.753657,
-    -0.754112,
-    -0.754566,
-    -0.755017,
-    -0.755467,
-    -0.755915,
-    -0.756362,
-    -0.756806,
-    -0.757249,
-    -0.75769,
-    -0.75813,
-    -0.758567,
-    -0.759003,
-    -0.759437,
-    -0.759869,
-    -0.760299,
-    -0.760728,
-    -0.761155,
-    -0.76158,
-    -0.762003,
-    -0.762424,
-    -0.762844,
-    -0.763262,
-    -0.763678,
-    -0.764092,
-    -0.764504,
-    -0.764915,
-    -0.765324,
-    -0.765731,
-    -0.766136,
-    -0.766539,
-    -0.766941,
-    -0.767341,
-    -0.767739,
-    -0.768135,
-    -0.768529,
-    -0.768922,
-    -0.769313,
-    -0.769701,
-    -0.770089,
-    -0.770474,
-    -0.770857,
-    -0.771239,
-    -0.771619,
-    -0.771997,
-    -0.772373,
-    -0.772748,
-    -0.77312,
-    -0.773491,
-    -0.77386,
-    -0.774227,
-    -0.774593,
-    -0.774956,
-    -0.775318,
-    -0.775678,
-    -0.776036,
-    -0.776392,
-    -0.776746,
-    -0.777099,
-    -0.77745,
-    -0.777799,
-    -0.778146,
-    -0.778491,
-    -0.778834,
-    -0.779176,
-    -0.779516,
-    -0.779854,
-    -0.78019,
-    -0.780524,
-    -0.780856,
-    -0.781187,
-    -0.781516,
-    -0.781842,
-    -0.782167,
-    -0.782491,
-    -0.782812,
-    -0.783132,
-    -0.783449,
-    -0.783765,
-    -0.784079,
-    -0.784391,
-    -0.784701,
-    -0.78501,
-    -0.785317,
-    -0.785621,
-    -0.785924,
-    -0.786225,
-    -0.786524,
-    -0.786822,
-    -0.787117,
-    -0.787411,
-    -0.787703,
-    -0.787993,
-    -0.788281,
-    -0.788567,
-    -0.788851,
-    -0.789134,
-    -0.789415,
-    -0.789693,
-    -0.78997,
-    -0.790246,
-    -0.790519,
-    -0.79079,
-    -0.79106,
-    -0.791327,
-    -0.791593,
-    -0.791857,
-    -0.792119,
-    -0.792379,
-    -0.792638,
-    -0.792894,
-    -0.793149,
-    -0.793401,
-    -0.793652,
-    -0.793901,
-    -0.794149,
-    -0.794394,
-    -0.794637,
-    -0.794879,
-    -0.795118,
-    -0.795356,
-    -0.795592,
-    -0.795826,
-    -0.796058,
-    -0.796289,
-    -0.796517,
-    -0.796744,
-    -0.796968,
-    -0.797191,
-    -0.797412,
-    -0.797631,
-    -0.797848,
-    -0.798064,
-    -0.798277,
-    -0.798488,
-    -0.798698,
-    -0.798906,
-    -0.799112,
-    -0.799316,
-    -0.799518,
-    -0.799718,
-    -0.799917,
-    -0.800113,
-    -0.800308,
-    -0.8005,
-    -0.800691,
-    -0.80088,
-    -0.801067,
-    -0.801252,
-    -0.801436,
-    -0.801617,
-    -0.801797,
-    -0.801974,
-    -0.80215,
-    -0.802324,
-    -0.802496,
-    -0.802666,
-    -0.802834,
-    -0.803001,
-    -0.803165,
-    -0.803328,
-    -0.803488,
-    -0.803647,
-    -0.803804,
-    -0.803959,
-    -0.804112,
-    -0.804263,
-    -0.804412,
-    -0.80456,
-    -0.804705,
-    -0.804849,
-    -0.804991,
-    -0.80513,
-    -0.805268,
-    -0.805404,
-    -0.805539,
-    -0.805671,
-    -0.805801,
-    -0.80593,
-    -0.806056,
-    -0.806181,
-    -0.806304,
-    -0.806425,
-    -0.806544,
-    -0.806661,
-    -0.806776,
-    -0.806889,
-    -0.807,
-    -0.80711,
-    -0.807217,
-    -0.807323,
-    -0.807427,
-    -0.807529,
-    -0.807629,
-    -0.807727,
-    -0.807823,
-    -0.807917,
-    -0.80801,
-    -0.8081,
-    -0.808189,
-    -0.808275,
-    -0.80836,
-    -0.808443,
-    -0.808524,
-    -0.808603,
-    -0.80868,
-    -0.808756,
-    -0.808829,
-    -0.8089,
-    -0.80897,
-    -0.809038,
-    -0.809103,
-    -0.809167,
-    -0.809229,
-    -0.809289,
-    -0.809347,
-    -0.809403,
-    -0.809458,
-    -0.80951,
-    -0.809561,
-    -0.809609,
-    -0.809656,
-    -0.809701,
-    -0.809744,
-    -0.809785,
-    -0.809824,
-    -0.809861,
-    -0.809896,
-    -0.80993,
-    -0.809961,
-    -0.809991,
-    -0.810018,
-    -0.810044,
-    -0.810068,
-    -0.81009,
-    -0.81011,
-    -0.810128,
-    -0.810144,
-    -0.810158,
-    -0.810171,
-    -0.810181,
-    -0.81019,
-    -0.810196,
-    -0.810201,
-    -0.810204,
-    -0.810205,
-    -0.810204,
-    -0.810201,
-    -0.810196,
-    -0.81019,
-    -0.810181,
-    -0.810171,
-    -0.810158,
-    -0.810144,
-    -0.810128,
-    -0.81011,
-    -0.81009,
-    -0.810068,
-    -0.810044,
-    -0.810018,
-    -0.809991,
-    -0.809961,
-    -0.80993,
-    -0.809896,
-    -0.809861,
-    -0.809824,
-    -0.809785,
-    -0.809744,
-    -0.809701,
-    -0.809656,
-    -0.809609,
-    -0.809561,
-    -0.80951,
-    -0.809458,
-    -0.809403,
-    -0.809347,
-    -0.809289,
-    -0.809229,
-    -0.809167,
-    -0.809103,
-    -0.809038,
-    -0.80897,
-    -0.8089,
-    -0.808829,
-    -0.808756,
-    -0.80868,
-    -0.808603,
-    -0.808524,
-    -0.808443,
-    -0.80836,
-    -0.808275,
-    -0.808189,
-    -0.8081,
-    -0.80801,
-    -0.807917,
-    -0.807823,
-    -0.807727,
-    -0.807629,
-    -0.807529,
-    -0.807427,
-    -0.807323,
-    -0.807217,
-    -0.80711,
-    -0.807,
-    -0.806889,
-    -0.806776,
-    -0.806661,
-    -0.806544,
-    -0.806425,
-    -0.806304,
-    -0.806181,
-    -0.806056,
-    -0.80593,
-    -0.805801,
-    -0.805671,
-    -0.805539,
-    -0.805404,
-    -0.805268,
-    -0.80513,
-    -0.804991,
-    -0.804849,
-    -0.804705,
-    -0.80456,
-    -0.804412,
-    -0.804263,
-    -0.804112,
-    -0.803959,
-    -0.803804,
-    -0.803647,
-    -0.803488,
-    -0.803328,
-    -0.803165,
-    -0.803001,
-    -0.802834,
-    -0.802666,
-    -0.802496,
-    -0.802324,
-    -0.80215,
-    -0.801974,
-    -0.801797,
-    -0.801617,
-    -0.801436,
-    -0.801252,
-    -0.801067,
-    -0.80088,
-    -0.800691,
-    -0.8005,
-    -0.800308,
-    -0.800113,
-    -0.799917,
-    -0.799718,
-    -0.799518,
-    -0.799316,
-    -0.799112,
-    -0.798906,
-    -0.798698,
-    -0.798488,
-    -0.798277,
-    -0.798064,
-    -0.797848,
-    -0.797631,
-    -0.797412,
-    -0.797191,
-    -0.796968,
-    -0.796744,
-    -0.796517,
-    -0.796289,
-    -0.796058,
-    -0.795826,
-    -0.795592,
-    -0.795356,
-    -0.795118,
-    -0.794879,
-    -0.794637,
-    -0.794394,
-    -0.794149,
-    -0.793901,
-    -0.793652,
-    -0.793401,
-    -0.793149,
-    -0.792894,
-    -0.792638,
-    -0.792379,
-    -0.792119,
-    -0.791857,
-    -0.791593,
-    -0.791327,
-    -0.79106,
-    -0.79079,
-    -0.790519,
-    -0.790246,
-    -0.78997,
-    -0.789693,
-    -0.789415,
-    -0.789134,
-    -0.788851,
-    -0.788567,
-    -0.788281,
-    -0.787993,
-    -0.787703,
-    -0.787411,
-    -0.787117,
-    -0.786822,
-    -0.786524,
-    -0.786225,
-    -0.785924,
-    -0.785621,
-    -0.785317,
-    -0.78501,
-    -0.784701,
-    -0.784391,
-    -0.784079,
-    -0.783765,
-    -0.783449,
-    -0.783132,
-    -0.782812,
-    -0.782491,
-    -0.782167,
-    -0.781842,
-    -0.781516,
-    -0.781187,
-    -0.780856,
-    -0.780524,
-    -0.78019,
-    -0.779854,
-    -0.779516,
-    -0.779176,
-    -0.778834,
-    -0.778491,
-    -0.778146,
-    -0.777799,
-    -0.77745,
-    -0.777099,
-    -0.776746,
-    -0.776392,
-    -0.776036,
-    -0.775678,
-    -0.775318,
-    -0.774956,
-    -0.774593,
-    -0.774227,
-    -0.77386,
-    -0.773491,
-    -0.77312,
-    -0.772748,
-    -0.772373,
-    -0.771997,
-    -0.771619,
-    -0.771239,
-    -0.770857,
-    -0.770474,
-    -0.770089,
-    -0.769701,
-    -0.769313,
-    -0.768922,
-    -0.768529,
-    -0.768135,
-    -0.767739,
-    -0.767341,
-    -0.766941,
-    -0.766539,
-    -0.766136,
-    -0.765731,
-    -0.765324,
-    -0.764915,
-    -0.764504,
-    -0.764092,
-    -0.763678,
-    -0.763262,
-    -0.762844,
-    -0.762424,
-    -0.762003,
-    -0.76158,
-    -0.761155,
-    -0.760728,
-    -0.760299,
-    -0.759869,
-    -0.759437,
-    -0.759003,
-    -0.758567,
-    -0.75813,
-    -0.75769,
-    -0.757249,
-    -0.756806,
-    -0.756362,
-    -0.755915,
-    -0.755467,
-    -0.755017,
-    -0.754566,
-    -0.754112,
-    -0.753657,
-    -0.7532,
-    -0.752741,
-    -0.75228,
-    -0.751818,
-    -0.751354,
-    -0.750888,
-    -0.75042,
-    -0.749951,
-    -0.74948,
-    -0.749007,
-    -0.748532,
-    -0.748055,
-    -0.747577,
-    -0.747097,
-    -0.746615,
-    -0.746132,
-    -0.745647,
-    -0.745159,
-    -0.744671,
-    -0.74418,
-    -0.743688,
-    -0.743194,
-    -0.742698,
-    -0.7422,
-    -0.741701,
-    -0.7412,
-    -0.740697,
-    -0.740193,
-    -0.739687,
-    -0.739179,
-    -0.738669,
-    -0.738157,
-    -0.737644,
-    -0.737129,
-    -0.736612,
-    -0.736094,
-    -0.735574,
-    -0.735052,
-    -0.734528,
-    -0.734003,
-    -0.733476,
-    -0.732947,
-    -0.732417,
-    -0.731884,
-    -0.73135,
-    -0.730815,
-    -0.730277,
-    -0.729738,
-    -0.729197,
-    -0.728655,
-    -0.728111,
-    -0.727565,
-    -0.727017,
-    -0.726467,
-    -0.725916,
-    -0.725364,
-    -0.724809,
-    -0.724253,
-    -0.723695,
-    -0.723135,
-    -0.722574,
-    -0.722011,
-    -0.721446,
-    -0.72088,
-    -0.720311,
-    -0.719742,
-    -0.71917,
-    -0.718597,
-    -0.718022,
-    -0.717445,
-    -0.716867,
-    -0.716287,
-    -0.715705,
-    -0.715122,
-    -0.714537,
-    -0.71395,
-    -0.713362,
-    -0.712772,
-    -0.71218,
-    -0.711587,
-    -0.710992,
-    -0.710395,
-    -0.709796,
-    -0.709196,
-    -0.708595,
-    -0.707991,
-    -0.707386,
-    -0.706779,
-    -0.706171,
-    -0.705561,
-    -0.704949,
-    -0.704335,
-    -0.70372,
-    -0.703104,
-    -0.702485,
-    -0.701865,
-    -0.701244,
-    -0.70062,
-    -0.699995,
-    -0.699369,
-    -0.69874,
-    -0.69811,
-    -0.697479,
-    -0.696846,
-    -0.696211,
-    -0.695574,
-    -0.694936,
-    -0.694296,
-    -0.693655,
-    -0.693012,
-    -0.692367,
-    -0.691721,
-    -0.691073,
-    -0.690423,
-    -0.689772,
-    -0.689119,
-    -0.688465,
-    -0.687809,
-    -0.687151,
-    -0.686492,
-    -0.685831,
-    -0.685169,
-    -0.684505,
-    -0.683839,
-    -0.683172,
-    -0.682503,
-    -0.681832,
-    -0.68116,
-    -0.680486,
-    -0.679811,
-    -0.679134,
-    -0.678455,
-    -0.677775,
-    -0.677093,
-    -0.67641,
-    -0.675725,
-    -0.675039,
-    -0.674351,
-    -0.673661,
-    -0.67297,
-    -0.672277,
-    -0.671582,
-    -0.670886,
-    -0.670189,
-    -0.66949,
-    -0.668789,
-    -0.668086,
-    -0.667383,
-    -0.666677,
-    -0.66597,
-    -0.665261,
-    -0.664551,
-    -0.66384,
-    -0.663126,
-    -0.662411,
-    -0.661695,
-    -0.660977,
-    -0.660257,
-    -0.659536,
-    -0.658814,
-    -0.65809,
-    -0.657364,
-    -0.656637,
-    -0.655908,
-    -0.655177,
-    -0.654445,
-    -0.653712,
-    -0.652977,
-    -0.65224,
-    -0.651502,
-    -0.650763,
-    -0.650022,
-    -0.649279,
-    -0.648535,
-    -0.647789,
-    -0.647042,
-    -0.646293,
-    -0.645543,
-    -0.644791,
-    -0.644038,
-    -0.643283,
-    -0.642527,
-    -0.641769,
-    -0.641009,
-    -0.640249,
-    -0.639486,
-    -0.638722,
-    -0.637957,
-    -0.63719,
-    -0.636422,
-    -0.635652,
-    -0.63488,
-    -0.634107,
-    -0.633333,
-    -0.632557,
-    -0.63178,
-    -0.631001,
-    -0.630221,
-    -0.629439,
-    -0.628656,
-    -0.627871,
-    -0.627085,
-    -0.626297,
-    -0.625508,
-    -0.624717,
-    -0.623925,
-    -0.623131,
-    -0.622336,
-    -0.62154,
-    -0.620742,
-    -0.619942,
-    -0.619141,
-    -0.618339,
-    -0.617535,
-    -0.61673,
-    -0.615923,
-    -0.615115,
-    -0.614305,
-    -0.613494,
-    -0.612682,
-    -0.611868,
-    -0.611053,
-    -0.610236,
-    -0.609417,
-    -0.608598,
-    -0.607777,
-    -0.606954,
-    -0.60613,
-    -0.605305,
-    -0.604478,
-    -0.60365,
-    -0.60282,
-    -0.601989,
-    -0.601156,
-    -0.600322,
-    -0.599487,
-    -0.59865,
-    -0.597812,
-    -0.596973,
-    -0.596132,
-    -0.595289,
-    -0.594445,
-    -0.5936,
-    -0.592754,
-    -0.591906,
-    -0.591056,
-    -0.590206,
-    -0.589353,
-    -0.5885,
-    -0.587645,
-    -0.586789,
-    -0.585931,
-    -0.585072,
-    -0.584211,
-    -0.58335,
-    -0.582487,
-    -0.581622,
-    -0.580756,
-    -0.579889,
-    -0.57902,
-    -0.57815,
-    -0.577279,
-    -0.576406,
-    -0.575532,
-    -0.574656,
-    -0.57378,
-    -0.572901,
-    -0.572022,
-    -0.571141,
-    -0.570259,
-    -0.569375,
-    -0.568491,
-    -0.567604,
-    -0.566717,
-    -0.565828,
-    -0.564938,
-    -0.564046,
-    -0.563153,
-    -0.562259,
-    -0.561364,
-    -0.560467,
-    -0.559569,
-    -0.558669,
-    -0.557768,
-    -0.556866,
-    -0.555963,
-    -0.555058,
-    -0.554152,
-    -0.553245,
-    -0.552336,
-    -0.551426,
-    -0.550515,
-    -0.549603,
-    -0.548689,
-    -0.547774,
-    -0.546857,
-    -0.54594,
-    -0.545021,
-    -0.5441,
-    -0.543179,
-    -0.542256,
-    -0.541332,
-    -0.540407,
-    -0.53948,
-    -0.538552,
-    -0.537623,
-    -0.536693,
-    -0.535761,
-    -0.534828,
-    -0.533894,
-    -0.532958,
-    -0.532022,
-    -0.531084,
-    -0.530144,
-    -0.529204,
-    -0.528262,
-    -0.527319,
-    -0.526375,
-    -0.52543,
-    -0.524483,
-    -0.523535,
-    -0.522586,
-    -0.521636,
-    -0.520684,
-    -0.519731,
-    -0.518777,
-    -0.517822,
-    -0.516865,
-    -0.515908,
-    -0.514949,
-    -0.513989,
-    -0.513027,
-    -0.512065,
-    -0.511101,
-    -0.510136,
-    -0.50917,
-    -0.508203,
-    -0.507234,
-    -0.506264,
-    -0.505293,
-    -0.504321,
-    -0.503348,
-    -0.502373,
-    -0.501398,
-    -0.500421,
-    -0.499443,
-    -0.498464,
-    -0.497483,
-    -0.496502,
-    -0.495519,
-    -0.494535,
-    -0.49355,
-    -0.492564,
-    -0.491577,
-    -0.490588,
-    -0.489598,
-    -0.488608,
-    -0.487616,
-    -0.486623,
-    -0.485628,
-    -0.484633,
-    -0.483636,
-    -0.482639,
-    -0.48164,
-    -0.48064,
-    -0.479639,
-    -0.478637,
-    -0.477633,
-    -0.476629,
-    -0.475623,
-    -0.474616,
-    -0.473609,
-    -0.4726,
-    -0.47159,
-    -0.470578,
-    -0.469566,
-    -0.468553,
-    -0.467538,
-    -0.466523,
-    -0.465506,
-    -0.464488,
-    -0.463469,
-    -0.462449,
-    -0.461428,
-    -0.460406,
-    -0.459383,
-    -0.458359,
-    -0.457333,
-    -0.456307,
-    -0.455279,
-    -0.454251,
-    -0.453221,
-    -0.45219,
-    -0.451159,
-    -0.450126,
-    -0.449092,
-    -0.448057,
-    -0.447021,
-    -0.445984,
-    -0.444946,
-    -0.443907,
-    -0.442866,
-    -0.441825,
-    -0.440783,
-    -0.439739,
-    -0.438695,
-    -0.43765,
-    -0.436603,
-    -0.435556,
-    -0.434507,
-    -0.433458,
-    -0.432407,
-    -0.431356,
-    -0.430303,
-    -0.42925,
-    -0.428195,
-    -0.427139,
-    -0.426083,
-    -0.425025,
-    -0.423967,
-    -0.422907,
-    -0.421846,
-    -0.420785,
-    -0.419722,
-    -0.418659,
-    -0.417594,
-    -0.416529,
-    -0.415462,
-    -0.414395,
-    -0.413326,
-    -0.412257,
-    -0.411186,
-    -0.410115,
-    -0.409043,
-    -0.407969,
-    -0.406895,
-    -0.40582,
-    -0.404744,
-    -0.403667,
-    -0.402588,
-    -0.401509,
-    -0.40043,
-    -0.399349,
-    -0.398267,
-    -0.397184,
-    -0.3961,
-    -0.395016,
-    -0.39393,
-    -0.392844,
-    -0.391756,
-    -0.390668,
-    -0.389578,
-    -0.388488,
-    -0.387397,
-    -0.386305,
-    -0.385212,
-    -0.384118,
-    -0.383024,
-    -0.381928,
-    -0.380831,
-    -0.379734,
-    -0.378636,
-    -0.377537,
-    -0.376436,
-    -0.375335,
-    -0.374234,
-    -0.373131,
-    -0.372027,
-    -0.370923,
-    -0.369817,
-    -0.368711,
-    -0.367604,
-    -0.366496,
-    -0.365387,
-    -0.364277,
-    -0.363167,
-    -0.362055,
-    -0.360943,
-    -0.35983,
-    -0.358716,
-    -0.357601,
-    -0.356486,
-    -0.355369,
-    -0.354252,
-    -0.353134,
-    -0.352015,
-    -0.350895,
-    -0.349774,
-    -0.348653,
-    -0.34753,
-    -0.346407,
-    -0.345283,
-    -0.344159,
-    -0.343033,
-    -0.341907,
-    -0.34078,
-    -0.339652,
-    -0.338523,
-    -0.337393,
-    -0.336263,
-    -0.335132,
-    -0.334,
-    -0.332867,
-    -0.331734,
-    -0.330599,
-    -0.329464,
-    -0.328329,
-    -0.327192,
-    -0.326055,
-    -0.324916,
-    -0.323778,
-    -0.322638,
-    -0.321497,
-    -0.320356,
-    -0.319214,
-    -0.318072,
-    -0.316928,
-    -0.315784,
-    -0.314639,
-    -0.313493,
-    -0.312347,
-    -0.3112,
-    -0.310052,
-    -0.308903,
-    -0.307754,
-    -0.306604,
-    -0.305453,
-    -0.304302,
-    -0.30315,
-    -0.301997,
-    -0.300843,
-    -0.299689,
-    -0.298534,
-    -0.297378,
-    -0.296221,
-    -0.295064,
-    -0.293907,
-    -0.292748,
-    -0.291589,
-    -0.290429,
-    -0.289268,
-    -0.288107,
-    -0.286945,
-    -0.285782,
-    -0.284619,
-    -0.283455,
-    -0.282291,
-    -0.281125,
-    -0.279959,
-    -0.278793,
-    -0.277625,
-    -0.276458,
-    -0.275289,
-    -0.27412,
-    -0.27295,
-    -0.271779,
-    -0.270608,
-    -0.269436,
-    -0.268264,
-    -0.267091,
-    -0.265917,
-    -0.264743,
-    -0.263568,
-    -0.262392,
-    -0.261216,
-    -0.26004,
-    -0.258862,
-    -0.257684,
-    -0.256506,
-    -0.255326,
-    -0.254147,
-    -0.252966,
-    -0.251785,
-    -0.250604,
-    -0.249421,
-    -0.248239,
-    -0.247055,
-    -0.245871,
-    -0.244687,
-    -0.243502,
-    -0.242316,
-    -0.24113,
-    -0.239943,
-    -0.238756,
-    -0.237568,
-    -0.236379,
-    -0.23519,
-    -0.234001,
-    -0.23281,
-    -0.23162,
-    -0.230428,
-    -0.229237,
-    -0.228044,
-    -0.226851,
-    -0.225658,
-    -0.224464,
-    -0.22327,
-    -0.222075,
-    -0.220879,
-    -0.219683,
-    -0.218487,
-    -0.21729,
-    -0.216092,
-    -0.214894,
-    -0.213695,
-    -0.212496,
-    -0.211297,
-    -0.210097,
-    -0.208896,
-    -0.207695,
-    -0.206493,
-    -0.205291,
-    -0.204089,
-    -0.202886,
-    -0.201682,
-    -0.200478,
-    -0.199274,
-    -0.198069,
-    -0.196864,
-    -0.195658,
-    -0.194452,
-    -0.193245,
-    -0.192038,
-    -0.19083,
-    -0.189622,
-    -0.188413,
-    -0.187204,
-    -0.185995,
-    -0.184785,
-    -0.183575,
-    -0.182364,
-    -0.181153,
-    -0.179941,
-    -0.178729,
-    -0.177517,
-    -0.176304,
-    -0.175091,
-    -0.173877,
-    -0.172663,
-    -0.171449,
-    -0.170234,
-    -0.169018,
-    -0.167803,
-    -0.166587,
-    -0.16537,
-    -0.164153,
-    -0.162936,
-    -0.161718,
-    -0.1605,
-    -0.159282,
-    -0.158063,
-    -0.156844,
-    -0.155625,
-    -0.154405,
-    -0.153184,
-    -0.151964,
-    -0.150743,
-    -0.149521,
-    -0.1483,
-    -0.147078,
-    -0.145855,
-    -0.144633,
-    -0.14341,
-    -0.142186,
-    -0.140963,
-    -0.139739,
-    -0.138514,
-    -0.137289,
-    -0.136064,
-    -0.134839,
-    -0.133613,
-    -0.132387,
-    -0.131161,
-    -0.129935,
-    -0.128708,
-    -0.12748,
-    -0.126253,
-    -0.125025,
-    -0.123797,
-    -0.122569,
-    -0.12134,
-    -0.120111,
-    -0.118882,
-    -0.117652,
-    -0.116422,
-    -0.115192,
-    -0.113962,
-    -0.112731,
-    -0.111501,
-    -0.110269,
-    -0.109038,
-    -0.107806,
-    -0.106574,
-    -0.105342,
-    -0.10411,
-    -0.102877,
-    -0.101644,
-    -0.100411,
-    -0.0991777,
-    -0.0979441,
-    -0.0967103,
-    -0.0954762,
-    -0.0942419,
-    -0.0930074,
-    -0.0917727,
-    -0.0905377,
-    -0.0893026,
-    -0.0880672,
-    -0.0868316,
-    -0.0855959,
-    -0.0843599,
-    -0.0831237,
-    -0.0818873,
-    -0.0806507,
-    -0.079414,
-    -0.078177,
-    -0.0769399,
-    -0.0757026,
-    -0.0744651,
-    -0.0732274,
-    -0.0719896,
-    -0.0707516,
-    -0.0695134,
-    -0.0682751,
-    -0.0670366,
-    -0.0657979,
-    -0.0645591,
-    -0.0633202,
-    -0.062081,
-    -0.0608418,
-    -0.0596024,
-    -0.0583628,
-    -0.0571232,
-    -0.0558833,
-    -0.0546434,
-    -0.0534033,
-    -0.0521631,
-    -0.0509228,
-    -0.0496824,
-    -0.0484418,
-    -0.0472011,
-    -0.0459604,
-    -0.0447195,
-    -0.0434785,
-    -0.0422374,
-    -0.0409962,
-    -0.0397549,
-    -0.0385135,
-    -0.037272,
-    -0.0360304,
-    -0.0347888,
-    -0.0335471,
-    -0.0323052,
-    -0.0310634,
-    -0.0298214,
-    -0.0285794,
-    -0.0273373,
-    -0.0260951,
-    -0.0248529,
-    -0.0236106,
-    -0.0223683,
-    -0.0211259,
-    -0.0198834,
-    -0.0186409,
-    -0.0173984,
-    -0.0161558,
-    -0.0149132,
-    -0.0136706,
-    -0.0124279,
-    -0.0111852,
-    -0.00994246,
-    -0.00869971,
-    -0.00745693,
-    -0.00621413,
-    -0.00497132,
-    -0.0037285,
-    -0.00248567,
-    -0.00124284,
-    0,
-    0.00124284,
-    0.00248567,
-    0.0037285,
-    0.00497132,
-    0.00621413,
-    0.00745693,
-    0.00869971,
-    0.00994246,
-    0.0111852,
-    0.0124279,
-    0.0136706,
-    0.0149132,
-    0.0161558,
-    0.0173984,
-    0.0186409,
-    0.0198834,
-    0.0211259,
-    0.0223683,
-    0.0236106,
-    0.0248529,
-    0.0260951,
-    0.0273373,
-    0.0285794,
-    0.0298214,
-    0.0310634,
-    0.0323052,
-    0.0335471,
-    0.0347888,
-    0.0360304,
-    0.037272,
-    0.0385135,
-    0.0397549,
-    0.0409962,
-    0.0422374,
-    0.0434785,
-    0.0447195,
-    0.0459604,
-    0.0472011,
-    0.0484418,
-    0.0496824,
-    0.0509228,
-    0.0521631,
-    0.0534033,
-    0.0546434,
-    0.0558833,
-    0.0571232,
-    0.0583628,
-    0.0596024,
-    0.0608418,
-    0.062081,
-    0.0633202,
-    0.0645591,
-    0.0657979,
-    0.0670366,
-    0.0682751,
-    0.0695134,
-    0.0707516,
-    0.0719896,
-    0.0732274,
-    0.0744651,
-    0.0757026,
-    0.0769399,
-    0.078177,
-    0.079414,
-    0.0806507,
-    0.0818873,
-    0.0831237,
-    0.0843599,
-    0.0855959,
-    0.0868316,
-    0.0880672,
-    0.0893026,
-    0.0905377,
-    0.0917727,
-    0.0930074,
-    0.0942419,
-    0.0954762,
-    0.0967103,
-    0.0979441,
-    0.0991777,
-    0.100411,
-    0.101644,
-    0.102877,
-    0.10411,
-    0.105342,
-    0.106574,
-    0.107806,
-    0.109038,
-    0.110269,
-    0.111501,
-    0.112731,
-    0.113962,
-    0.115192,
-    0.116422,
-    0.117652,
-    0.118882,
-    0.120111,
-    0.12134,
-    0.122569,
-    0.123797,
-    0.125025,
-    0.126253,
-    0.12748,
-    0.128708,
-    0.129935,
-    0.131161,
-    0.132387,
-    0.133613,
-    0.134839,
-    0.136064,
-    0.137289,
-    0.138514,
-    0.139739,
-    0.140963,
-    0.142186,
-    0.14341,
-    0.144633,
-    0.145855,
-    0.147078,
-    0.1483,
-    0.149521,
-    0.150743,
-    0.151964,
-    0.153184,
-    0.154405,
-    0.155625,
-    0.156844,
-    0.158063,
-    0.159282,
-    0.1605,
-    0.161718,
-    0.162936,
-    0.164153,
-    0.16537,
-    0.166587,
-    0.167803,
-    0.169018,
-    0.170234,
-    0.171449,
-    0.172663,
-    0.173877,
-    0.175091,
-    0.176304,
-    0.177517,
-    0.178729,
-    0.179941,
-    0.181153,
-    0.182364,
-    0.183575,
-    0.184785,
-    0.185995,
-    0.187204,
-    0.188413,
-    0.189622,
-    0.19083,
-    0.192038,
-    0.193245,
-    0.194452,
-    0.195658,
-    0.196864,
-    0.198069,
-    0.199274,
-    0.200478,
-    0.201682,
-    0.202886,
-    0.204089,
-    0.205291,
-    0.206493,
-    0.207695,
-    0.208896,
-    0.210097,
-    0.211297,
-    0.212496,
-    0.213695,
-    0.214894,
-    0.216092,
-    0.21729,
-    0.218487,
-    0.219683,
-    0.220879,
-    0.222075,
-    0.22327,
-    0.224464,
-    0.225658,
-    0.226851,
-    0.228044,
-    0.229237,
-    0.230428,
-    0.23162,
-    0.23281,
-    0.234001,
-    0.23519,
-    0.236379,
-    0.237568,
-    0.238756,
-    0.239943,
-    0.24113,
-    0.242316,
-    0.243502,
-    0.244687,
-    0.245871,
-    0.247055,
-    0.248239,
-    0.249421,
-    0.250604,
-    0.251785,
-    0.252966,
-    0.254147,
-    0.255326,
-    0.256506,
-    0.257684,
-    0.258862,
-    0.26004,
-    0.261216,
-    0.262392,
-    0.263568,
-    0.264743,
-    0.265917,
-    0.267091,
-    0.268264,
-    0.269436,
-    0.270608,
-    0.271779,
-    0.27295,
-    0.27412,
-    0.275289,
-    0.276458,
-    0.277625,
-    0.278793,
-    0.279959,
-    0.281125,
-    0.282291,
-    0.283455,
-    0.284619,
-    0.285782,
-    0.286945,
-    0.288107,
-    0.289268,
-    0.290429,
-    0.291589,
-    0.292748,
-    0.293907,
-    0.295064,
-    0.296221,
-    0.297378,
-    0.298534,
-    0.299689,
-    0.300843,
-    0.301997,
-    0.30315,
-    0.304302,
-    0.305453,
-    0.306604,
-    0.307754,
-    0.308903,
-    0.310052,
-    0.3112,
-    0.312347,
-    0.313493,
-    0.314639,
-    0.315784,
-    0.316928,
-    0.318072,
-    0.319214,
-    0.320356,
-    0.321497,
-    0.322638,
-    0.323778,
-    0.324916,
-    0.326055,
-    0.327192,
-    0.328329,
-    0.329464,
-    0.330599,
-    0.331734,
-    0.332867,
-    0.334,
-    0.335132,
-    0.336263,
-    0.337393,
-    0.338523,
-    0.339652,
-    0.34078,
-    0.341907,
-    0.343033,
-    0.344159,
-    0.345283,
-    0.346407,
-    0.34753,
-    0.348653,
-    0.349774,
-    0.350895,
-    0.352015,
-    0.353134,
-    0.354252,
-    0.355369,
-    0.356486,
-    0.357601,
-    0.358716,
-    0.35983,
-    0.360943,
-    0.362055,
-    0.363167,
-    0.364277,
-    0.365387,
-    0.366496,
-    0.367604,
-    0.368711,
-    0.369817,
-    0.370923,
-    0.372027,
-    0.373131,
-    0.374234,
-    0.375335,
-    0.376436,
-    0.377537,
-    0.378636,
-    0.379734,
-    0.380831,
-    0.381928,
-    0.383024,
-    0.384118,
-    0.385212,
-    0.386305,
-    0.387397,
-    0.388488,
-    0.389578,
-    0.390668,
-    0.391756,
-    0.392844,
-    0.39393,
-    0.395016,
-    0.3961,
-    0.397184,
-    0.398267,
-    0.399349,
-    0.40043,
-    0.401509,
-    0.402588,
-    0.403667,
-    0.404744,
-    0.40582,
-    0.406895,
-    0.407969,
-    0.409043,
-    0.410115,
-    0.411186,
-    0.412257,
-    0.413326,
-    0.414395,
-    0.415462,
-    0.416529,
-    0.417594,
-    0.418659,
-    0.419722,
-    0.420785,
-    0.421846,
-    0.422907,
-    0.423967,
-    0.425025,
-    0.426083,
-    0.427139,
-    0.428195,
-    0.42925,
-    0.430303,
-    0.431356,
-    0.432407,
-    0.433458,
-    0.434507,
-    0.435556,
-    0.436603,
-    0.43765,
-    0.438695,
-    0.439739,
-    0.440783,
-    0.441825,
-    0.442866,
-    0.443907,
-    0.444946,
-    0.445984,
-    0.447021,
-    0.448057,
-    0.449092,
-    0.450126,
-    0.451159,
-    0.45219,
-    0.453221,
-    0.454251,
-    0.455279,
-    0.456307,
-    0.457333,
-    0.458359,
-    0.459383,
-    0.460406,
-    0.461428,
-    0.462449,
-    0.463469,
-    0.464488,
-    0.465506,
-    0.466523,
-    0.467538,
-    0.468553,
-    0.469566,
-    0.470578,
-    0.47159,
-    0.4726,
-    0.473609,
-    0.474616,
-    0.475623,
-    0.476629,
-    0.477633,
-    0.478637,
-    0.479639,
-    0.48064,
-    0.48164,
-    0.482639,
-    0.483636,
-    0.484633,
-    0.485628,
-    0.486623,
-    0.487616,
-    0.488608,
-    0.489598,
-    0.490588,
-    0.491577,
-    0.492564,
-    0.49355,
-    0.494535,
-    0.495519,
-    0.496502,
-    0.497483,
-    0.498464,
-    0.499443,
-    0.500421,
-    0.501398,
-    0.502373,
-    0.503348,
-    0.504321,
-    0.505293,
-    0.506264,
-    0.507234,
-    0.508203,
-    0.50917,
-    0.510136,
-    0.511101,
-    0.512065,
-    0.513027,
-    0.513989,
-    0.514949,
-    0.515908,
-    0.516865,
-    0.517822,
-    0.518777,
-    0.519731,
-    0.520684,
-    0.521636,
-    0.522586,
-    0.523535,
-    0.524483,
-    0.52543,
-    0.526375,
-    0.527319,
-    0.528262,
-    0.529204,
-    0.530144,
-    0.531084,
-    0.532022,
-    0.532958,
-    0.533894,
-    0.534828,
-    0.535761,
-    0.536693,
-    0.537623,
-    0.538552,
-    0.53948,
-    0.540407,
-    0.541332,
-    0.542256,
-    0.543179,
-    0.5441,
-    0.545021,
-    0.54594,
-    0.546857,
-    0.547774,
-    0.548689,
-    0.549603,
-    0.550515,
-    0.551426,
-    0.552336,
-    0.553245,
-    0.554152,
-    0.555058,
-    0.555963,
-    0.556866,
-    0.557768,
-    0.558669,
-    0.559569,
-    0.560467,
-    0.561364,
-    0.562259,
-    0.563153,
-    0.564046,
-    0.564938,
-    0.565828,
-    0.566717,
-    0.567604,
-    0.568491,
-    0.569375,
-    0.570259,
-    0.571141,
-    0.572022,
-    0.572901,
-    0.57378,
-    0.574656,
-    0.575532,
-    0.576406,
-    0.577279,
-    0.57815,
-    0.57902,
-    0.579889,
-    0.580756,
-    0.581622,
-    0.582487,
-    0.58335,
-    0.584211,
-    0.585072,
-    0.585931,
-    0.586789,
-    0.587645,
-    0.5885,
-    0.589353,
-    0.590206,
-    0.591056,
-    0.591906,
-    0.592754,
-    0.5936,
-    0.594445,
-    0.595289,
-    0.596132,
-    0.596973,
-    0.597812,
-    0.59865,
-    0.599487,
-    0.600322,
-    0.601156,
-    0.601989,
-    0.60282,
-    0.60365,
-    0.604478,
-    0.605305,
-    0.60613,
-    0.606954,
-    0.607777,
-    0.608598,
-    0.609417,
-    0.610236,
-    0.611053,
-    0.611868,
-    0.612682,
-    0.613494,
-    0.614305,
-    0.615115,
-    0.615923,
-    0.61673,
-    0.617535,
-    0.618339,
-    0.619141,
-    0.619942,
-    0.620742,
-    0.62154,
-    0.622336,
-    0.623131,
-    0.623925,
-    0.624717,
-    0.625508,
-    0.626297,
-    0.627085,
-    0.627871,
-    0.628656,
-    0.629439,
-    0.630221,
-    0.631001,
-    0.63178,
-    0.632557,
-    0.633333,
-    0.634107,
-    0.63488,
-    0.635652,
-    0.636422,
-    0.63719,
-    0.637957,
-    0.638722,
-    0.639486,
-    0.640249,
-    0.641009,
-    0.641769,
-    0.642527,
-    0.643283,
-    0.644038,
-    0.644791,
-    0.645543,
-    0.646293,
-    0.647042,
-    0.647789,
-    0.648535,
-    0.649279,
-    0.650022,
-    0.650763,
-    0.651502,
-    0.65224,
-    0.652977,
-    0.653712,
-    0.654445,
-    0.655177,
-    0.655908,
-    0.656637,
-    0.657364,
-    0.65809,
-    0.658814,
-    0.659536,
-    0.660257,
-    0.660977,
-    0.661695,
-    0.662411,
-    0.663126,
-    0.66384,
-    0.664551,
-    0.665261,
-    0.66597,
-    0.666677,
-    0.667383,
-    0.668086,
-    0.668789,
-    0.66949,
-    0.670189,
-    0.670886,
-    0.671582,
-    0.672277,
-    0.67297,
-    0.673661,
-    0.674351,
-    0.675039,
-    0.675725,
-    0.67641,
-    0.677093,
-    0.677775,
-    0.678455,
-    0.679134,
-    0.679811,
-    0.680486,
-    0.68116,
-    0.681832,
-    0.682503,
-    0.683172,
-    0.683839,
-    0.684505,
-    0.685169,
-    0.685831,
-    0.686492,
-    0.687151,
-    0.687809,
-    0.688465,
-    0.689119,
-    0.689772,
-    0.690423,
-    0.691073,
-    0.691721,
-    0.692367,
-    0.693012,
-    0.693655,
-    0.694296,
-    0.694936,
-    0.695574,
-    0.696211,
-    0.696846,
-    0.697479,
-    0.69811,
-    0.69874,
-    0.699369,
-    0.699995,
-    0.70062,
-    0.701244,
-    0.701865,
-    0.702485,
-    0.703104,
-    0.70372,
-    0.704335,
-    0.704949,
-    0.705561,
-    0.706171,
-    0.706779,
-    0.707386,
-    0.707991,
-    0.708595,
-    0.709196,
-    0.709796,
-    0.710395,
-    0.710992,
-    0.711587,
-    0.71218,
-    0.712772,
-    0.713362,
-    0.71395,
-    0.714537,
-    0.715122,
-    0.715705,
-    0.716287,
-    0.716867,
-    0.717445,
-    0.718022,
-    0.718597,
-    0.71917,
-    0.719742,
-    0.720311,
-    0.72088,
-    0.721446,
-    0.722011,
-    0.722574,
-    0.723135,
-    0.723695,
-    0.724253,
-    0.724809,
-    0.725364,
-    0.725916,
-    0.726467,
-    0.727017,
-    0.727565,
-    0.728111,
-    0.728655,
-    0.729197,
-    0.729738,
-    0.730277,
-    0.730815,
-    0.73135,
-    0.731884,
-    0.732417,
-    0.732947,
-    0.733476,
-    0.734003,
-    0.734528,
-    0.735052,
-    0.735574,
-    0.736094,
-    0.736612,
-    0.737129,
-    0.737644,
-    0.738157,
-    0.738669,
-    0.739179,
-    0.739687,
-    0.740193,
-    0.740697,
-    0.7412,
-    0.741701,
-    0.7422,
-    0.742698,
-    0.743194,
-    0.743688,
-    0.74418,
-    0.744671,
-    0.745159,
-    0.745647,
-    0.746132,
-    0.746615,
-    0.747097,
-    0.747577,
-    0.748055,
-    0.748532,
-    0.749007,
-    0.74948,
-    0.749951,
-    0.75042,
-    0.750888,
-    0.751354,
-    0.751818,
-    0.75228,
-    0.752741,
-    0.7532,
-    0.753657,
-    0.754112,
-    0.754566,
-    0.755017,
-    0.755467,
-    0.755915,
-    0.756362,
-    0.756806,
-    0.757249,
-    0.75769,
-    0.75813,
-    0.758567,
-    0.759003,
-    0.759437,
-    0.759869,
-    0.760299,
-    0.760728,
-    0.761155,
-    0.76158,
-    0.762003,
-    0.762424,
-    0.762844,
-    0.763262,
-    0.763678,
-    0.764092,
-    0.764504,
-    0.764915,
-    0.765324,
-    0.765731,
-    0.766136,
-    0.766539,
-    0.766941,
-    0.767341,
-    0.767739,
-    0.768135,
-    0.768529,
-    0.768922,
-    0.769313,
-    0.769701,
-    0.770089,
-    0.770474,
-    0.770857,
-    0.771239,
-    0.771619,
-    0.771997,
-    0.772373,
-    0.772748,
-    0.77312,
-    0.773491,
-    0.77386,
-    0.774227,
-    0.774593,
-    0.774956,
-    0.775318,
-    0.775678,
-    0.776036,
-    0.776392,
-    0.776746,
-    0.777099,
-    0.77745,
-    0.777799,
-    0.778146,
-    0.778491,
-    0.778834,
-    0.779176,
-    0.779516,
-    0.779854,
-    0.78019,
-    0.780524,
-    0.780856,
-    0.781187,
-    0.781516,
-    0.781842,
-    0.782167,
-    0.782491,
-    0.782812,
-    0.783132,
-    0.783449,
-    0.783765,
-    0.784079,
-    0.784391,
-    0.784701,
-    0.78501,
-    0.785317,
-    0.785621,
-    0.785924,
-    0.786225,
-    0.786524,
-    0.786822,
-    0.787117,
-    0.787411,
-    0.787703,
-    0.787993,
-    0.788281,
-    0.788567,
-    0.788851,
-    0.789134,
-    0.789415,
-    0.789693,
-    0.78997,
-    0.790246,
-    0.790519,
-    0.79079,
-    0.79106,
-    0.791327,
-    0.791593,
-    0.791857,
-    0.792119,
-    0.792379,
-    0.792638,
-    0.792894,
-    0.793149,
-    0.793401,
-    0.793652,
-    0.793901,
-    0.794149,
-    0.794394,
-    0.794637,
-    0.794879,
-    0.795118,
-    0.795356,
-    0.795592,
-    0.795826,
-    0.796058,
-    0.796289,
-    0.796517,
-    0.796744,
-    0.796968,
-    0.797191,
-    0.797412,
-    0.797631,
-    0.797848,
-    0.798064,
-    0.798277,
-    0.798488,
-    0.798698,
-    0.798906,
-    0.799112,
-    0.799316,
-    0.799518,
-    0.799718,
-    0.799917,
-    0.800113,
-    0.800308,
-    0.8005,
-    0.800691,
-    0.80088,
-    0.801067,
-    0.801252,
-    0.801436,
-    0.801617,
-    0.801797,
-    0.801974,
-    0.80215,
-    0.802324,
-    0.802496,
-    0.802666,
-    0.802834,
-    0.803001,
-    0.803165,
-    0.803328,
-    0.803488,
-    0.803647,
-    0.803804,
-    0.803959,
-    0.804112,
-    0.804263,
-    0.804412,
-    0.80456,
-    0.804705,
-    0.804849,
-    0.804991,
-    0.80513,
-    0.805268,
-    0.805404,
-    0.805539,
-    0.805671,
-    0.805801,
-    0.80593,
-    0.806056,
-    0.806181,
-    0.806304,
-    0.806425,
-    0.806544,
-    0.806661,
-    0.806776,
-    0.806889,
-    0.807,
-    0.80711,
-    0.807217,
-    0.807323,
-    0.807427,
-    0.807529,
-    0.807629,
-    0.807727,
-    0.807823,
-    0.807917,
-    0.80801,
-    0.8081,
-    0.808189,
-    0.808275,
-    0.80836,
-    0.808443,
-    0.808524,
-    0.808603,
-    0.80868,
-    0.808756,
-    0.808829,
-    0.8089,
-    0.80897,
-    0.809038,
-    0.809103,
-    0.809167,
-    0.809229,
-    0.809289,
-    0.809347,
-    0.809403,
-    0.809458,
-    0.80951,
-    0.809561,
-    0.809609,
-    0.809656,
-    0.809701,
-    0.809744,
-    0.809785,
-    0.809824,
-    0.809861,
-    0.809896,
-    0.80993,
-    0.809961,
-    0.809991,
-    0.810018,
-    0.810044,
-    0.810068,
-    0.81009,
-    0.81011,
-    0.810128,
-    0.810144,
-    0.810158,
-    0.810171,
-    0.810181,
-    0.81019,
-    0.810196,
-    0.810201,
-    0.810204,
-    0.810205,
-    0.810204,
-    0.810201,
-    0.810196,
-    0.81019,
-    0.810181,
-    0.810171,
-    0.810158,
-    0.810144,
-    0.810128,
-    0.81011,
-    0.81009,
-    0.810068,
-    0.810044,
-    0.810018,
-    0.809991,
-    0.809961,
-    0.80993,
-    0.809896,
-    0.809861,
-    0.809824,
-    0.809785,
-    0.809744,
-    0.809701,
-    0.809656,
-    0.809609,
-    0.809561,
-    0.80951,
-    0.809458,
-    0.809403,
-    0.809347,
-    0.809289,
-    0.809229,
-    0.809167,
-    0.809103,
-    0.809038,
-    0.80897,
-    0.8089,
-    0.808829,
-    0.808756,
-    0.80868,
-    0.808603,
-    0.808524,
-    0.808443,
-    0.80836,
-    0.808275,
-    0.808189,
-    0.8081,
-    0.80801,
-    0.807917,
-    0.807823,
-    0.807727,
-    0.807629,
-    0.807529,
-    0.807427,
-    0.807323,
-    0.807217,
-    0.80711,
-    0.807,
-    0.806889,
-    0.806776,
-    0.806661,
-    0.806544,
-    0.806425,
-    0.806304,
-    0.806181,
-    0.806056,
-    0.80593,
-    0.805801,
-    0.805671,
-    0.805539,
-    0.805404,
-    0.805268,
-    0.80513,
-    0.804991,
-    0.804849,
-    0.804705,
-    0.80456,
-    0.804412,
-    0.804263,
-    0.804112,
-    0.803959,
-    0.803804,
-    0.803647,
-    0.803488,
-    0.803328,
-    0.803165,
-    0.803001,
-    0.802834,
-    0.802666,
-    0.802496,
-    0.802324,
-    0.80215,
-    0.801974,
-    0.801797,
-    0.801617,
-    0.801436,
-    0.801252,
-    0.801067,
-    0.80088,
-    0.800691,
-    0.8005,
-    0.800308,
-    0.800113,
-    0.799917,
-    0.799718,
-    0.799518,
-    0.799316,
-    0.799112,
-    0.798906,
-    0.798698,
-    0.798488,
-    0.798277,
-    0.798064,
-    0.797848,
-    0.797631,
-    0.797412,
-    0.797191,
-    0.796968,
-    0.796744,
-    0.796517,
-    0.796289,
-    0.796058,
-    0.795826,
-    0.795592,
-    0.795356,
-    0.795118,
-    0.794879,
-    0.794637,
-    0.794394,
-    0.794149,
-    0.793901,
-    0.793652,
-    0.793401,
-    0.793149,
-    0.792894,
-    0.792638,
-    0.792379,
-    0.792119,
-    0.791857,
-    0.791593,
-    0.791327,
-    0.79106,
-    0.79079,
-    0.790519,
-    0.790246,
-    0.78997,
-    0.789693,
-    0.789415,
-    0.789134,
-    0.788851,
-    0.788567,
-    0.788281,
-    0.787993,
-    0.787703,
-    0.787411,
-    0.787117,
-    0.786822,
-    0.786524,
-    0.786225,
-    0.785924,
-    0.785621,
-    0.785317,
-    0.78501,
-    0.784701,
-    0.784391,
-    0.784079,
-    0.783765,
-    0.783449,
-    0.783132,
-    0.782812,
-    0.782491,
-    0.782167,
-    0.781842,
-    0.781516,
-    0.781187,
-    0.780856,
-    0.780524,
-    0.78019,
-    0.779854,
-    0.779516,
-    0.779176,
-    0.778834,
-    0.778491,
-    0.778146,
-    0.777799,
-    0.77745,
-    0.777099,
-    0.776746,
-    0.776392,
-    0.776036,
-    0.775678,
-    0.775318,
-    0.774956,
-    0.774593,
-    0.774227,
-    0.77386,
-    0.773491,
-    0.77312,
-    0.772748,
-    0.772373,
-    0.771997,
-    0.771619,
-    0.771239,
-    0.770857,
-    0.770474,
-    0.770089,
-    0.769701,
-    0.769313,
-    0.768922,
-    0.768529,
-    0.768135,
-    0.767739,
-    0.767341,
-    0.766941,
-    0.766539,
-    0.766136,
-    0.765731,
-    0.765324,
-    0.764915,
-    0.764504,
-    0.764092,
-    0.763678,
-    0.763262,
-    0.762844,
-    0.762424,
-    0.762003,
-    0.76158,
-    0.761155,
-    0.760728,
-    0.760299,
-    0.759869,
-    0.759437,
-    0.759003,
-    0.758567,
-    0.75813,
-    0.75769,
-    0.757249,
-    0.756806,
-    0.756362,
-    0.755915,
-    0.755467,
-    0.755017,
-    0.754566,
-    0.754112,
-    0.753657,
-    0.7532,
-    0.752741,
-    0.75228,
-    0.751818,
-    0.751354,
-    0.750888,
-    0.75042,
-    0.749951,
-    0.74948,
-    0.749007,
-    0.748532,
-    0.748055,
-    0.747577,
-    0.747097,
-    0.746615,
-    0.746132,
-    0.745647,
-    0.745159,
-    0.744671,
-    0.74418,
-    0.743688,
-    0.743194,
-    0.742698,
-    0.7422,
-    0.741701,
-    0.7412,
-    0.740697,
-    0.740193,
-    0.739687,
-    0.739179,
-    0.738669,
-    0.738157,
-    0.737644,
-    0.737129,
-    0.736612,
-    0.736094,
-    0.735574,
-    0.735052,
-    0.734528,
-    0.734003,
-    0.733476,
-    0.732947,
-    0.732417,
-    0.731884,
-    0.73135,
-    0.730815,
-    0.730277,
-    0.729738,
-    0.729197,
-    0.728655,
-    0.728111,
-    0.727565,
-    0.727017,
-    0.726467,
-    0.725916,
-    0.725364,
-    0.724809,
-    0.724253,
-    0.723695,
-    0.723135,
-    0.722574,
-    0.722011,
-    0.721446,
-    0.72088,
-    0.720311,
-    0.719742,
-    0.71917,
-    0.718597,
-    0.718022,
-    0.717445,
-    0.716867,
-    0.716287,
-    0.715705,
-    0.715122,
-    0.714537,
-    0.71395,
-    0.713362,
-    0.712772,
-    0.71218,
-    0.711587,
-    0.710992,
-    0.710395,
-    0.709796,
-    0.709196,
-    0.708595,
-    0.707991,
-    0.707386,
-    0.706779,
-    0.706171,
-    0.705561,
-    0.704949,
-    0.704335,
-    0.70372,
-    0.703104,
-    0.702485,
-    0.701865,
-    0.701244,
-    0.70062,
-    0.699995,
-    0.699369,
-    0.69874,
-    0.69811,
-    0.697479,
-    0.696846,
-    0.696211,
-    0.695574,
-    0.694936,
-    0.694296,
-    0.693655,
-    0.693012,
-    0.692367,
-    0.691721,
-    0.691073,
-    0.690423,
-    0.689772,
-    0.689119,
-    0.688465,
-    0.687809,
-    0.687151,
-    0.686492,
-    0.685831,
-    0.685169,
-    0.684505,
-    0.683839,
-    0.683172,
-    0.682503,
-    0.681832,
-    0.68116,
-    0.680486,
-    0.679811,
-    0.679134,
-    0.678455,
-    0.677775,
-    0.677093,
-    0.67641,
-    0.675725,
-    0.675039,
-    0.674351,
-    0.673661,
-    0.67297,
-    0.672277,
-    0.671582,
-    0.670886,
-    0.670189,
-    0.66949,
-    0.668789,
-    0.668086,
-    0.667383,
-    0.666677,
-    0.66597,
-    0.665261,
-    0.664551,
-    0.66384,
-    0.663126,
-    0.662411,
-    0.661695,
-    0.660977,
-    0.660257,
-    0.659536,
-    0.658814,
-    0.65809,
-    0.657364,
-    0.656637,
-    0.655908,
-    0.655177,
-    0.654445,
-    0.653712,
-    0.652977,
-    0.65224,
-    0.651502,
-    0.650763,
-    0.650022,
-    0.649279,
-    0.648535,
-    0.647789,
-    0.647042,
-    0.646293,
-    0.645543,
-    0.644791,
-    0.644038,
-    0.643283,
-    0.642527,
-    0.641769,
-    0.641009,
-    0.640249,
-    0.639486,
-    0.638722,
-    0.637957,
-    0.63719,
-    0.636422,
-    0.635652,
-    0.63488,
-    0.634107,
-    0.633333,
-    0.632557,
-    0.63178,
-    0.631001,
-    0.630221,
-    0.629439,
-    0.628656,
-    0.627871,
-    0.627085,
-    0.626297,
-    0.625508,
-    0.624717,
-    0.623925,
-    0.623131,
-    0.622336,
-    0.62154,
-    0.620742,
-    0.619942,
-    0.619141,
-    0.618339,
-    0.617535,
-    0.61673,
-    0.615923,
-    0.615115,
-    0.614305,
-    0.613494,
-    0.612682,
-    0.611868,
-    0.611053,
-    0.610236,
-    0.609417,
-    0.608598,
-    0.607777,
-    0.606954,
-    0.60613,
-    0.605305,
-    0.604478,
-    0.60365,
-    0.60282,
-    0.601989,
-    0.601156,
-    0.600322,
-    0.599487,
-    0.59865,
-    0.597812,
-    0.596973,
-    0.596132,
-    0.595289,
-    0.594445,
-    0.5936,
-    0.592754,
-    0.591906,
-    0.591056,
-    0.590206,
-    0.589353,
-    0.5885,
-    0.587645,
-    0.586789,
-    0.585931,
-    0.585072,
-    0.584211,
-    0.58335,
-    0.582487,
-    0.581622,
-    0.580756,
-    0.579889,
-    0.57902,
-    0.57815,
-    0.577279,
-    0.576406,
-    0.575532,
-    0.574656,
-    0.57378,
-    0.572901,
-    0.572022,
-    0.571141,
-    0.570259,
-    0.569375,
-    0.568491,
-    0.567604,
-    0.566717,
-    0.565828,
-    0.564938,
-    0.564046,
-    0.563153,
-    0.562259,
-    0.561364,
-    0.560467,
-    0.559569,
-    0.558669,
-    0.557768,
-    0.556866,
-    0.555963,
-    0.555058,
-    0.554152,
-    0.553245,
-    0.552336,
-    0.551426,
-    0.550515,
-    0.549603,
-    0.548689,
-    0.547774,
-    0.546857,
-    0.54594,
-    0.545021,
-    0.5441,
-    0.543179,
-    0.542256,
-    0.541332,
-    0.540407,
-    0.53948,
-    0.538552,
-    0.537623,
-    0.536693,
-    0.535761,
-    0.534828,
-    0.533894,
-    0.532958,
-    0.532022,
-    0.531084,
-    0.530144,
-    0.529204,
-    0.528262,
-    0.527319,
-    0.526375,
-    0.52543,
-    0.524483,
-    0.523535,
-    0.522586,
-    0.521636,
-    0.520684,
-    0.519731,
-    0.518777,
-    0.517822,
-    0.516865,
-    0.515908,
-    0.514949,
-    0.513989,
-    0.513027,
-    0.512065,
-    0.511101,
-    0.510136,
-    0.50917,
-    0.508203,
-    0.507234,
-    0.506264,
-    0.505293,
-    0.504321,
-    0.503348,
-    0.502373,
-    0.501398,
-    0.500421,
-    0.499443,
-    0.498464,
-    0.497483,
-    0.496502,
-    0.495519,
-    0.494535,
-    0.49355,
-    0.492564,
-    0.491577,
-    0.490588,
-    0.489598,
-    0.488608,
-    0.487616,
-    0.486623,
-    0.485628,
-    0.484633,
-    0.483636,
-    0.482639,
-    0.48164,
-    0.48064,
-    0.479639,
-    0.478637,
-    0.477633,
-    0.476629,
-    0.475623,
-    0.474616,
-    0.473609,
-    0.4726,
-    0.47159,
-    0.470578,
-    0.469566,
-    0.468553,
-    0.467538,
-    0.466523,
-    0.465506,
-    0.464488,
-    0.463469,
-    0.462449,
-    0.461428,
-    0.460406,
-    0.459383,
-    0.458359,
-    0.457333,
-    0.456307,
-    0.455279,
-    0.454251,
-    0.453221,
-    0.45219,
-    0.451159,
-    0.450126,
-    0.449092,
-    0.448057,
-    0.447021,
-    0.445984,
-    0.444946,
-    0.443907,
-    0.442866,
-    0.441825,
-    0.440783,
-    0.439739,
-    0.438695,
-    0.43765,
-    0.436603,
-    0.435556,
-    0.434507,
-    0.433458,
-    0.432407,
-    0.431356,
-    0.430303,
-    0.42925,
-    0.428195,
-    0.427139,
-    0.426083,
-    0.425025,
-    0.423967,
-    0.422907,
-    0.421846,
-    0.420785,
-    0.419722,
-    0.418659,
-    0.417594,
-    0.416529,
-    0.415462,
-    0.414395,
-    0.413326,
-    0.412257,
-    0.411186,
-    0.410115,
-    0.409043,
-    0.407969,
-    0.406895,
-    0.40582,
-    0.404744,
-    0.403667,
-    0.402588,
-    0.401509,
-    0.40043,
-    0.399349,
-    0.398267,
-    0.397184,
-    0.3961,
-    0.395016,
-    0.39393,
-    0.392844,
-    0.391756,
-    0.390668,
-    0.389578,
-    0.388488,
-    0.387397,
-    0.386305,
-    0.385212,
-    0.384118,
-    0.383024,
-    0.381928,
-    0.380831,
-    0.379734,
-    0.378636,
-    0.377537,
-    0.376436,
-    0.375335,
-    0.374234,
-    0.373131,
-    0.372027,
-    0.370923,
-    0.369817,
-    0.368711,
-    0.367604,
-    0.366496,
-    0.365387,
-    0.364277,
-    0.363167,
-    0.362055,
-    0.360943,
-    0.35983,
-    0.358716,
-    0.357601,
-    0.356486,
-    0.355369,
-    0.354252,
-    0.353134,
-    0.352015,
-    0.350895,
-    0.349774,
-    0.348653,
-    0.34753,
-    0.346407,
-    0.345283,
-    0.344159,
-    0.343033,
-    0.341907,
-    0.34078,
-    0.339652,
-    0.338523,
-    0.337393,
-    0.336263,
-    0.335132,
-    0.334,
-    0.332867,
-    0.331734,
-    0.330599,
-    0.329464,
-    0.328329,
-    0.327192,
-    0.326055,
-    0.324916,
-    0.323778,
-    0.322638,
-    0.321497,
-    0.320356,
-    0.319214,
-    0.318072,
-    0.316928,
-    0.315784,
-    0.314639,
-    0.313493,
-    0.312347,
-    0.3112,
-    0.310052,
-    0.308903,
-    0.307754,
-    0.306604,
-    0.305453,
-    0.304302,
-    0.30315,
-    0.301997,
-    0.300843,
-    0.299689,
-    0.298534,
-    0.297378,
-    0.296221,
-    0.295064,
-    0.293907,
-    0.292748,
-    0.291589,
-    0.290429,
-    0.289268,
-    0.288107,
-    0.286945,
-    0.285782,
-    0.284619,
-    0.283455,
-    0.282291,
-    0.281125,
-    0.279959,
-    0.278793,
-    0.277625,
-    0.276458,
-    0.275289,
-    0.27412,
-    0.27295,
-    0.271779,
-    0.270608,
-    0.269436,
-    0.268264,
-    0.267091,
-    0.265917,
-    0.264743,
-    0.263568,
-    0.262392,
-    0.261216,
-    0.26004,
-    0.258862,
-    0.257684,
-    0.256506,
-    0.255326,
-    0.254147,
-    0.252966,
-    0.251785,
-    0.250604,
-    0.249421,
-    0.248239,
-    0.247055,
-    0.245871,
-    0.244687,
-    0.243502,
-    0.242316,
-    0.24113,
-    0.239943,
-    0.238756,
-    0.237568,
-    0.236379,
-    0.23519,
-    0.234001,
-    0.23281,
-    0.23162,
-    0.230428,
-    0.229237,
-    0.228044,
-    0.226851,
-    0.225658,
-    0.224464,
-    0.22327,
-    0.222075,
-    0.220879,
-    0.219683,
-    0.218487,
-    0.21729,
-    0.216092,
-    0.214894,
-    0.213695,
-    0.212496,
-    0.211297,
-    0.210097,
-    0.208896,
-    0.207695,
-    0.206493,
-    0.205291,
-    0.204089,
-    0.202886,
-    0.201682,
-    0.200478,
-    0.199274,
-    0.198069,
-    0.196864,
-    0.195658,
-    0.194452,
-    0.193245,
-    0.192038,
-    0.19083,
-    0.189622,
-    0.188413,
-    0.187204,
-    0.185995,
-    0.184785,
-    0.183575,
-    0.182364,
-    0.181153,
-    0.179941,
-    0.178729,
-    0.177517,
-    0.176304,
-    0.175091,
-    0.173877,
-    0.172663,
-    0.171449,
-    0.170234,
-    0.169018,
-    0.167803,
-    0.166587,
-    0.16537,
-    0.164153,
-    0.162936,
-    0.161718,
-    0.1605,
-    0.159282,
-    0.158063,
-    0.156844,
-    0.155625,
-    0.154405,
-    0.153184,
-    0.151964,
-    0.150743,
-    0.149521,
-    0.1483,
-    0.147078,
-    0.145855,
-    0.144633,
-    0.14341,
-    0.142186,
-    0.140963,
-    0.139739,
-    0.138514,
-    0.137289,
-    0.136064,
-    0.134839,
-    0.133613,
-    0.132387,
-    0.131161,
-    0.129935,
-    0.128708,
-    0.12748,
-    0.126253,
-    0.125025,
-    0.123797,
-    0.122569,
-    0.12134,
-    0.120111,
-    0.118882,
-    0.117652,
-    0.116422,
-    0.115192,
-    0.113962,
-    0.112731,
-    0.111501,
-    0.110269,
-    0.109038,
-    0.107806,
-    0.106574,
-    0.105342,
-    0.10411,
-    0.102877,
-    0.101644,
-    0.100411,
-    0.0991777,
-    0.0979441,
-    0.0967103,
-    0.0954762,
-    0.0942419,
-    0.0930074,
-    0.0917727,
-    0.0905377,
-    0.0893026,
-    0.0880672,
-    0.0868316,
-    0.0855959,
-    0.0843599,
-    0.0831237,
-    0.0818873,
-    0.0806507,
-    0.079414,
-    0.078177,
-    0.0769399,
-    0.0757026,
-    0.0744651,
-    0.0732274,
-    0.0719896,
-    0.0707516,
-    0.0695134,
-    0.0682751,
-    0.0670366,
-    0.0657979,
-    0.0645591,
-    0.0633202,
-    0.062081,
-    0.0608418,
-    0.0596024,
-    0.0583628,
-    0.0571232,
-    0.0558833,
-    0.0546434,
-    0.0534033,
-    0.0521631,
-    0.0509228,
-    0.0496824,
-    0.0484418,
-    0.0472011,
-    0.0459604,
-    0.0447195,
-    0.0434785,
-    0.0422374,
-    0.0409962,
-    0.0397549,
-    0.0385135,
-    0.037272,
-    0.0360304,
-    0.0347888,
-    0.0335471,
-    0.0323052,
-    0.0310634,
-    0.0298214,
-    0.0285794,
-    0.0273373,
-    0.0260951,
-    0.0248529,
-    0.0236106,
-    0.0223683,
-    0.0211259,
-    0.0198834,
-    0.0186409,
-    0.0173984,
-    0.0161558,
-    0.0149132,
-    0.0136706,
-    0.0124279,
-    0.0111852,
-    0.00994246,
-    0.00869971,
-    0.00745693,
-    0.00621413,
-    0.00497132,
-    0.0037285,
-    0.00248567,
-    0.00124284
-};
-
-// Top frequency: 44.1K * 0.464399
-constexpr static std::array<float, 4096> wt_triangle_0xA =
-{
-    0,
-    -0.00124284,
-    -0.00248567,
-    -0.0037285,
-    -0.00497132,
-    -0.00621413,
-    -0.00745693,
-    -0.00869971,
-    -0.00994246,
-    -0.0111852,
-    -0.0124279,
-    -0.0136706,
-    -0.0149132,
-    -0.0161558,
-    -0.0173984,
-    -0.0186409,
-    -0.0198834,
-    -0.0211259,
-    -0.0223683,
-    -0.0236106,
-    -0.0248529,
-    -0.0260951,
-    -0.0273373,
-    -0.0285794,
-    -0.0298214,
-    -0.0310634,
-    -0.0323052,
-    -0.0335471,
-    -0.0347888,
-    -0.0360304,
-    -0.037272,
-    -0.0385135,
-    -0.0397549,
-    -0.0409962,
-    -0.0422374,
-    -0.0434785,
-    -0.0447195,
-    -0.0459604,
-    -0.0472011,
-    -0.0484418,
-    -0.0496824,
-    -0.0509228,
-    -0.0521631,
-    -0.0534033,
-    -0.0546434,
-    -0.0558833,
-    -0.0571232,
-    -0.0583628,
-    -0.0596024,
-    -0.0608418,
-    -0.062081,
-    -0.0633202,
-    -0.0645591,
-    -0.0657979,
-    -0.0670366,
-    -0.0682751,
-    -0.0695134,
-    -0.0707516,
-    -0.0719896,
-    -0.0732274,
-    -0.0744651,
-    -0.0757026,
-    -0.0769399,
-    -0.078177,
-    -0.079414,
-    -0.0806507,
-    -0.0818873,
-    -0.0831237,
-    -0.0843599,
-    -0.0855959,
-    -0.0868316,
-    -0.0880672,
-    -0.0893026,
-    -0.0905377,
-    -0.0917727,
-    -0.0930074,
-    -0.0942419,
-    -0.0954762,
-    -0.0967103,
-    -0.0979441,
-    -0.0991777,
-    -0.100411,
-    -0.101644,
-    -0.102877,
-    -0.10411,
-    -0.105342,
-    -0.106574,
-    -0.107806,
-    -0.109038,
-    -0.110269,
-    -0.111501,
-    -0.112731,
-    -0.113962,
-    -0.115192,
-    -0.116422,
-    -0.117652,
-    -0.118882,
-    -0.120111,
-    -0.12134,
-    -0.122569,
-    -0.123797,
-    -0.125025,
-    -0.126253,
-    -0.12748,
-    -0.128708,
-    -0.129935,
-    -0.131161,
-    -0.132387,
-    -0.133613,
-    -0.134839,
-    -0.136064,
-    -0.137289,
-    -0.138514,
-    -0.139739,
-    -0.140963,
-    -0.142186,
-    -0.14341,
-    -0.144633,
-    -0.145855,
-    -0.147078,
-    -0.1483,
-    -0.149521,
-    -0.150743,
-    -0.151964,
-    -0.153184,
-    -0.154405,
-    -0.155625,
-    -0.156844,
-    -0.158063,
-    -0.159282,
-    -0.1605,
-    -0.161718,
-    -0.162936,
-    -0.164153,
-    -0.16537,
-    -0.166587,
-    -0.167803,
-    -0.169018,
-    -0.170234,
-    -0.171449,
-    -0.172663,
-    -0.173877,
-    -0.175091,
-    -0.176304,
-    -0.177517,
-    -0.178729,
-    -0.179941,
-    -0.181153,
-    -0.182364,
-    -0.183575,
-    -0.184785,
-    -0.185995,
-    -0.187204,
-    -0.188413,
-    -0.189622,
-    -0.19083,
-    -0.192038,
-    -0.193245,
-    -0.194452,
-    -0.195658,
-    -0.196864,
-    -0.198069,
-    -0.199274,
-    -0.200478,
-    -0.201682,
-    -0.202886,
-    -0.204089,
-    -0.205291,
-    -0.206493,
-    -0.207695,
-    -0.208896,
-    -0.210097,
-    -0.211297,
-    -0.212496,
-    -0.213695,
-    -0.214894,
-    -0.216092,
-    -0.21729,
-    -0.218487,
-    -0.219683,
-    -0.220879,
-    -0.222075,
-    -0.22327,
-    -0.224464,
-    -0.225658,
-    -0.226851,
-    -0.228044,
-    -0.229237,
-    -0.230428,
-    -0.23162,
-    -0.23281,
-    -0.234001,
-    -0.23519,
-    -0.236379,
-    -0.237568,
-    -0.238756,
-    -0.239943,
-    -0.24113,
-    -0.242316,
-    -0.243502,
-    -0.244687,
-    -0.245871,
-    -0.247055,
-    -0.248239,
-    -0.249421,
-    -0.250604,
-    -0.251785,
-    -0.252966,
-    -0.254147,
-    -0.255326,
-    -0.256506,
-    -0.257684,
-    -0.258862,
-    -0.26004,
-    -0.261216,
-    -0.262392,
-    -0.263568,
-    -0.264743,
-    -0.265917,
-    -0.267091,
-    -0.268264,
-    -0.269436,
-    -0.270608,
-    -0.271779,
-    -0.27295,
-    -0.27412,
-    -0.275289,
-    -0.276458,
-    -0.277625,
-    -0.278793,
-    -0.279959,
-    -0.281125,
-    -0.282291,
-    -0.283455,
-    -0.284619,
-    -0.285782,
-    -0.286945,
-    -0.288107,
-    -0.289268,
-    -0.290429,
-    -0.291589,
-    -0.292748,
-    -0.293907,
-    -0.295064,
-    -0.296221,
-    -0.297378,
-    -0.298534,
-    -0.299689,
-    -0.300843,
-    -0.301997,
-    -0.30315,
-    -0.304302,
-    -0.305453,
-    -0.306604,
-    -0.307754,
-    -0.308903,
-    -0.310052,
-    -0.3112,
-    -0.312347,
-    -0.313493,
-    -0.314639,
-    -0.315784,
-    -0.316928,
-    -0.318072,
-    -0.319214,
-    -0.320356,
-    -0.321497,
-    -0.322638,
-    -0.323778,
-    -0.324916,
-    -0.326055,
-    -0.327192,
-    -0.328329,
-    -0.329464,
-    -0.330599,
-    -0.331734,
-    -0.332867,
-    -0.334,
-    -0.335132,
-    -0.336263,
-    -0.337393,
-    -0.338523,
-    -0.339652,
-    -0.34078,
-    -0.341907,
-    -0.343033,
-    -0.344159,
-    -0.345283,
-    -0.346407,
-    -0.34753,
-    -0.348653,
-    -0.349774,
-    -0.350895,
-    -0.352015,
-    -0.353134,
-    -0.354252,
-    -0.355369,
-    -0.356486,
-    -0.357601,
-    -0.358716,
-    -0.35983,
-    -0.360943,
-    -0.362055,
-    -0.363167,
-    -0.364277,
-    -0.365387,
-    -0.366496,
-    -0.367604,
-    -0.368711,
-    -0.369817,
-    -0.370923,
-    -0.372027,
-    -0.373131,
-    -0.374234,
-    -0.375335,
-    -0.376436,
-    -0.377537,
-    -0.378636,
-    -0.379734,
-    -0.380831,
-    -0.381928,
-    -0.383024,
-    -0.384118,
-    -0.385212,
-    -0.386305,
-    -0.387397,
-    -0.388488,
-    -0.389578,
-    -0.390668,
-    -0.391756,
-    -0.392844,
-    -0.39393,
-    -0.395016,
-    -0.3961,
-    -0.397184,
-    -0.398267,
-    -0.399349,
-    -0.40043,
-    -0.401509,
-    -0.402588,
-    -0.403667,
-    -0.404744,
-    -0.40582,
-    -0.406895,
-    -0.407969,
-    -0.409043,
-    -0.410115,
-    -0.411186,
-    -0.412257,
-    -0.413326,
-    -0.414395,
-    -0.415462,
-    -0.416529,
-    -0.417594,
-    -0.418659,
-    -0.419722,
-    -0.420785,
-    -0.421846,
-    -0.422907,
-    -0.423967,
-    -0.425025,
-    -0.426083,
-    -0.427139,
-    -0.428195,
-    -0.42925,
-    -0.430303,
-    -0.431356,
-    -0.432407,
-    -0.433458,
-    -0.434507,
-    -0.435556,
-    -0.436603,
-    -0.43765,
-    -0.438695,
-    -0.439739,
-    -0.440783,
-    -0.441825,
-    -0.442866,
-    -0.443907,
-    -0.444946,
-    -0.445984,
-    -0.447021,
-    -0.448057,
-    -0.449092,
-    -0.450126,
-    -0.451159,
-    -0.45219,
-    -0.453221,
-    -0.454251,
-    -0.455279,
-    -0.456307,
-    -0.457333,
-    -0.458359,
-    -0.459383,
-    -0.460406,
-    -0.461428,
-    -0.462449,
-    -0.463469,
-    -0.464488,
-    -0.465506,
-    -0.466523,
-    -0.467538,
-    -0.468553,
-    -0.469566,
-    -0.470578,
-    -0.47159,
-    -0.4726,
-    -0.473609,
-    -0.474616,
-    -0.475623,
-    -0.476629,
-    -0.477633,
-    -0.478637,
-    -0.479639,
-    -0.48064,
-    -0.48164,
-    -0.482639,
-    -0.483636,
-    -0.484633,
-    -0.485628,
-    -0.486623,
-    -0.487616,
-    -0.488608,
-    -0.489598,
-    -0.490588,
-    -0.491577,
-    -0.492564,
-    -0.49355,
-    -0.494535,
-    -0.495519,
-    -0.496502,
-    -0.497483,
-    -0.498464,
-    -0.499443,
-    -0.500421,
-    -0.501398,
-    -0.502373,
-    -0.503348,
-    -0.504321,
-    -0.505293,
-    -0.506264,
-    -0.507234,
-    -0.508203,
-    -0.50917,
-    -0.510136,
-    -0.511101,
-    -0.512065,
-    -0.513027,
-    -0.513989,
-    -0.514949,
-    -0.515908,
-    -0.516865,
-    -0.517822,
-    -0.518777,
-    -0.519731,
-    -0.520684,
-    -0.521636,
-    -0.522586,
-    -0.523535,
-    -0.524483,
-    -0.52543,
-    -0.526375,
-    -0.527319,
-    -0.528262,
-    -0.529204,
-    -0.530144,
-    -0.531084,
-    -0.532022,
-    -0.532958,
-    -0.533894,
-    -0.534828,
-    -0.535761,
-    -0.536693,
-    -0.537623,
-    -0.538552,
-    -0.53948,
-    -0.540407,
-    -0.541332,
-    -0.542256,
-    -0.543179,
-    -0.5441,
-    -0.545021,
-    -0.54594,
-    -0.546857,
-    -0.547774,
-    -0.548689,
-    -0.549603,
-    -0.550515,
-    -0.551426,
-    -0.552336,
-    -0.553245,
-    -0.554152,
-    -0.555058,
-    -0.555963,
-    -0.556866,
-    -0.557768,
-    -0.558669,
-    -0.559569,
-    -0.560467,
-    -0.561364,
-    -0.562259,
-    -0.563153,
-    -0.564046,
-    -0.564938,
-    -0.565828,
-    -0.566717,
-    -0.567604,
-    -0.568491,
-    -0.569375,
-    -0.570259,
-    -0.571141,
-    -0.572022,
-    -0.572901,
-    -0.57378,
-    -0.574656,
-    -0.575532,
-    -0.576406,
-    -0.577279,
-    -0.57815,
-    -0.57902,
-    -0.579889,
-    -0.580756,
-    -0.581622,
-    -0.582487,
-    -0.58335,
-    -0.584211,
-    -0.585072,
-    -0.585931,
-    -0.586789,
-    -0.587645,
-    -0.5885,
-    -0.589353,
-    -0.590206,
-    -0.591056,
-    -0.591906,
-    -0.592754,
-    -0.5936,
-    -0.594445,
-    -0.595289,
-    -0.596132,
-    -0.596973,
-    -0.597812,
-    -0.59865,
-    -0.599487,
-    -0.600322,
-    -0.601156,
-    -0.601989,
-    -0.60282,
-    -0.60365,
-    -0.604478,
-    -0.605305,
-    -0.60613,
-    -0.606954,
-    -0.607777,
-    -0.608598,
-    -0.609417,
-    -0.610236,
-    -0.611053,
-    -0.611868,
-    -0.612682,
-    -0.613494,
-    -0.614305,
-    -0.615115,
-    -0.615923,
-    -0.61673,
-    -0.617535,
-    -0.618339,
-    -0.619141,
-    -0.619942,
-    -0.620742,
-    -0.62154,
-    -0.622336,
-    -0.623131,
-    -0.623925,
-    -0.624717,
-    -0.625508,
-    -0.626297,
-    -0.627085,
-    -0.627871,
-    -0.628656,
-    -0.629439,
-    -0.630221,
-    -0.631001,
-    -0.63178,
-    -0.632557,
-    -0.633333,
-    -0.634107,
-    -0.63488,
-    -0.635652,
-    -0.636422,
-    -0.63719,
-    -0.637957,
-    -0.638722,
-    -0.639486,
-    -0.640249,
-    -0.641009,
-    -0.641769,
-    -0.642527,
-    -0.643283,
-    -0.644038,
-    -0.644791,
-    -0.645543,
-    -0.646293,
-    -0.647042,
-    -0.647789,
-    -0.648535,
-    -0.649279,
-    -0.650022,
-    -0.650763,
-    -0.651502,
-    -0.65224,
-    -0.652977,
-    -0.653712,
-    -0.654445,
-    -0.655177,
-    -0.655908,
-    -0.656637,
-    -0.657364,
-    -0.65809,
-    -0.658814,
-    -0.659536,
-    -0.660257,
-    -0.660977,
-    -0.661695,
-    -0.662411,
-    -0.663126,
-    -0.66384,
-    -0.664551,
-    -0.665261,
-    -0.66597,
-    -0.666677,
-    -0.667383,
-    -0.668086,
-    -0.668789,
-    -0.66949,
-    -0.670189,
-    -0.670886,
-    -0.671582,
-    -0.672277,
-    -0.67297,
-    -0.673661,
-    -0.674351,
-    -0.675039,
-    -0.675725,
-    -0.67641,
-    -0.677093,
-    -0.677775,
-    -0.678455,
-    -0.679134,
-    -0.679811,
-    -0.680486,
-    -0.68116,
-    -0.681832,
-    -0.682503,
-    -0.683172,
-    -0.683839,
-    -0.684505,
-    -0.685169,
-    -0.685831,
-    -0.686492,
-    -0.687151,
-    -0.687809,
-    -0.688465,
-    -0.689119,
-    -0.689772,
-    -0.690423,
-    -0.691073,
-    -0.691721,
-    -0.692367,
-    -0.693012,
-    -0.693655,
-    -0.694296,
-    -0.694936,
-    -0.695574,
-    -0.696211,
-    -0.696846,
-    -0.697479,
-    -0.69811,
-    -0.69874,
-    -0.699369,
-    -0.699995,
-    -0.70062,
-    -0.701244,
-    -0.701865,
-    -0.702485,
-    -0.703104,
-    -0.70372,
-    -0.704335,
-    -0.704949,
-    -0.705561,
-    -0.706171,
-    -0.706779,
-    -0.707386,
-    -0.707991,
-    -0.708595,
-    -0.709196,
-    -0.709796,
-    -0.710395,
-    -0.710992,
-    -0.711587,
-    -0.71218,
-    -0.712772,
-    -0.713362,
-    -0.71395,
-    -0.714537,
-    -0.715122,
-    -0.715705,
-    -0.716287,
-    -0.716867,
-    -0.717445,
-    -0.718022,
-    -0.718597,
-    -0.71917,
-    -0.719742,
-    -0.720311,
-    -0.72088,
-    -0.721446,
-    -0.722011,
-    -0.722574,
-    -0.723135,
-    -0.723695,
-    -0.724253,
-    -0.724809,
-    -0.725364,
-    -0.725916,
-    -0.726467,
-    -0.727017,
-    -0.727565,
-    -0.728111,
-    -0.728655,
-    -0.729197,
-    -0.729738,
-    -0.730277,
-    -0.730815,
-    -0.73135,
-    -0.731884,
-    -0.732417,
-    -0.732947,
-    -0.733476,
-    -0.734003,
-    -0.734528,
-    -0.735052,
-    -0.735574,
-    -0.736094,
-    -0.736612,
-    -0.737129,
-    -0.737644,
-    -0.738157,
-    -0.738669,
-    -0.739179,
-    -0.739687,
-    -0.740193,
-    -0.740697,
-    -0.7412,
-    -0.741701,
-    -0.7422,
-    -0.742698,
-    -0.743194,
-    -0.743688,
-    -0.74418,
-    -0.744671,
-    -0.745159,
-    -0.745647,
-    -0.746132,
-    -0.746615,
-    -0.747097,
-    -0.747577,
-    -0.748055,
-    -0.748532,
-    -0.749007,
-    -0.74948,
-    -0.749951,
-    -0.75042,
-    -0.750888,
-    -0.751354,
-    -0.751818,
-    -0.75228,
-    -0.752741,
-    -0.7532,
-    -0.753657,
-    -0.754112,
-    -0.754566,
-    -0.755017,
-    -0.755467,
-    -0.755915,
-    -0.756362,
-    -0.756806,
-    -0.757249,
-    -0.75769,
-    -0.75813,
-    -0.758567,
-    -0.759003,
-    -0.759437,
-    -0.759869,
-    -0.760299,
-    -0.760728,
-    -0.761155,
-    -0.76158,
-    -0.762003,
-    -0.762424,
-    -0.762844,
-    -0.763262,
-    -0.763678,
-    -0.764092,
-    -0.764504,
-    -0.764915,
-    -0.765324,
-    -0.765731,
-    -0.766136,
-    -0.766539,
-    -0.766941,
-    -0.767341,
-    -0.767739,
-    -0.768135,
-    -0.768529,
-    -0.768922,
-    -0.769313,
-    -0.769701,
-    -0.770089,
-    -0.770474,
-    -0.770857,
-    -0.771239,
-    -0.771619,
-    -0.771997,
-    -0.772373,
-    -0.772748,
-    -0.77312,
-    -0.773491,
-    -0.77386,
-    -0.774227,
-    -0.774593,
-    -0.774956,
-    -0.775318,
-    -0.775678,
-    -0.776036,
-    -0.776392,
-    -0.776746,
-    -0.777099,
-    -0.77745,
-    -0.777799,
-    -0.778146,
-    -0.778491,
-    -0.778834,
-    -0.779176,
-    -0.779516,
-    -0.779854,
-    -0.78019,
-    -0.780524,
-    -0.780856,
-    -0.781187,
-    -0.781516,
-    -0.781842,
-    -0.782167,
-    -0.782491,
-    -0.782812,
-    -0.783132,
-    -0.783449,
-    -0.783765,
-    -0.784079,
-    -0.784391,
-    -0.784701,
-    -0.78501,
-    -0.785317,
-    -0.785621,
-    -0.785924,
-    -0.786225,
-    -0.786524,
-    -0.786822,
-    -0.787117,
-    -0.787411,
-    -0.787703,
-    -0.787993,
-    -0.788281,
-    -0.788567,
-    -0.788851,
-    -0.789134,
-    -0.789415,
-    -0.789693,
-    -0.78997,
-    -0.790246,
-    -0.790519,
-    -0.79079,
-    -0.79106,
-    -0.791327,
-    -0.791593,
-    -0.791857,
-    -0.792119,
-    -0.792379,
-    -0.792638,
-    -0.792894,
-    -0.793149,
-    -0.793401,
-    -0.793652,
-    -0.793901,
-    -0.794149,
-    -0.794394,
-    -0.794637,
-    -0.794879,
-    -0.795118,
-    -0.795356,
-    -0.795592,
-    -0.795826,
-    -0.796058,
-    -0.796289,
-    -0.796517,
-    -0.796744,
-    -0.796968,
-    -0.797191,
-    -0.797412,
-    -0.797631,
-    -0.797848,
-    -0.798064,
-    -0.798277,
-    -0.798488,
-    -0.798698,
-    -0.798906,
-    -0.799112,
-    -0.799316,
-    -0.799518,
-    -0.799718,
-    -0.799917,
-    -0.800113,
-    -0.800308,
-    -0.8005,
-    -0.800691,
-    -0.80088,
-    -0.801067,
-    -0.801252,
-    -0.801436,
-    -0.801617,
-    -0.801797,
-    -0.801974,
-    -0.80215,
-    -0.802324,
-    -0.802496,
-    -0.802666,
-    -0.802834,
-    -0.803001,
-    -0.803165,
-    -0.803328,
-    -0.803488,
-    -0.803647,
-    -0.803804,
-    -0.803959,
-    -0.804112,
-    -0.804263,
-    -0.804412,
-    -0.80456,
-    -0.804705,
-    -0.804849,
-    -0.804991,
-    -0.80513,
-    -0.805268,
-    -0.805404,
-    -0.805539,
-    -0.805671,
-    -0.805801,
-    -0.80593,
-    -0.806056,
-    -0.806181,
-    -0.806304,
-    -0.806425,
-    -0.806544,
-    -0.806661,
-    -0.806776,
-    -0.806889,
-    -0.807,
-    -0.80711,
-    -0.807217,
-    -0.807323,
-    -0.807427,
-    -0.807529,
-    -0.807629,
-    -0.807727,
-    -0.807823,
-    -0.807917,
-    -0.80801,
-    -0.8081,
-    -0.808189,
-    -0.808275,
-    -0.80836,
-    -0.808443,
-    -0.808524,
-    -0.808603,
-    -0.80868,
-    -0.808756,
-    -0.808829,
-    -0.8089,
-    -0.80897,
-    -0.809038,
-    -0.809103,
-    -0.809167,
-    -0.809229,
-    -0.809289,
-    -0.809347,
-    -0.809403,
-    -0.809458,
-    -0.80951,
-    -0.809561,
-    -0.809609,
-    -0.809656,
-    -0.809701,
-    -0.809744,
-    -0.809785,
-    -0.809824,
-    -0.809861,
-    -0.809896,
-    -0.80993,
-    -0.809961,
-    -0.809991,
-    -0.810018,
-    -0.810044,
-    -0.810068,
-    -0.81009,
-    -0.81011,
-    -0.810128,
-    -0.810144,
-    -0.810158,
-    -0.810171,
-    -0.810181,
-    -0.81019,
-    -0.810196,
-    -0.810201,
-    -0.810204,
-    -0.810205,
-    -0.810204,
-    -0.810201,
-    -0.810196,
-    -0.81019,
-    -0.810181,
-    -0.810171,
-    -0.810158,
-    -0.810144,
-    -0.810128,
-    -0.81011,
-    -0.81009,
-    -0.810068,
-    -0.810044,
-    -0.810018,
-    -0.809991,
-    -0.809961,
-    -0.80993,
-    -0.809896,
-    -0.809861,
-    -0.809824,
-    -0.809785,
-    -0.809744,
-    -0.809701,
-    -0.809656,
-    -0.809609,
-    -0.809561,
-    -0.80951,
-    -0.809458,
-    -0.809403,
-    -0.809347,
-    -0.809289,
-    -0.809229,
-    -0.809167,
-    -0.809103,
-    -0.809038,
-    -0.80897,
-    -0.8089,
-    -0.808829,
-    -0.808756,
-    -0.80868,
-    -0.808603,
-    -0.808524,
-    -0.808443,
-    -0.80836,
-    -0.808275,
-    -0.808189,
-    -0.8081,
-    -0.80801,
-    -0.807917,
-    -0.807823,
-    -0.807727,
-    -0.807629,
-    -0.807529,
-    -0.807427,
-    -0.807323,
-    -0.807217,
-    -0.80711,
-    -0.807,
-    -0.806889,
-    -0.806776,
-    -0.806661,
-    -0.806544,
-    -0.806425,
-    -0.806304,
-    -0.806181,
-    -0.806056,
-    -0.80593,
-    -0.805801,
-    -0.805671,
-    -0.805539,
-    -0.805404,
-    -0.805268,
-    -0.80513,
-    -0.804991,
-    -0.804849,
-    -0.804705,
-    -0.80456,
-    -0.804412,
-    -0.804263,
-    -0.804112,
-    -0.803959,
-    -0.803804,
-    -0.803647,
-    -0.803488,
-    -0.803328,
-    -0.803165,
-    -0.803001,
-    -0.802834,
-    -0.802666,
-    -0.802496,
-    -0.802324,
-    -0.80215,
-    -0.801974,
-    -0.801797,
-    -0.801617,
-    -0.801436,
-    -0.801252,
-    -0.801067,
-    -0.80088,
-    -0.800691,
-    -0.8005,
-    -0.800308,
-    -0.800113,
-    -0.799917,
-    -0.799718,
-    -0.799518,
-    -0.799316,
-    -0.799112,
-    -0.798906,
-    -0.798698,
-    -0.798488,
-    -0.798277,
-    -0.798064,
-    -0.797848,
-    -0.797631,
-    -0.797412,
-    -0.797191,
-    -0.796968,
-    -0.796744,
-    -0.796517,
-    -0.796289,
-    -0.796058,
-    -0.795826,
-    -0.795592,
-    -0.795356,
-    -0.795118,
-    -0.794879,
-    -0.794637,
-    -0.794394,
-    -0.794149,
-    -0.793901,
-    -0.793652,
-    -0.793401,
-    -0.793149,
-    -0.792894,
-    -0.792638,
-    -0.792379,
-    -0.792119,
-    -0.791857,
-    -0.791593,
-    -0.791327,
-    -0.79106,
-    -0.79079,
-    -0.790519,
-    -0.790246,
-    -0.78997,
-    -0.789693,
-    -0.789415,
-    -0.789134,
-    -0.788851,
-    -0.788567,
-    -0.788281,
-    -0.787993,
-    -0.787703,
-    -0.787411,
-    -0.787117,
-    -0.786822,
-    -0.786524,
-    -0.786225,
-    -0.785924,
-    -0.785621,
-    -0.785317,
-    -0.78501,
-    -0.784701,
-    -0.784391,
-    -0.784079,
-    -0.783765,
-    -0.783449,
-    -0.783132,
-    -0.782812,
-    -0.782491,
-    -0.782167,
-    -0.781842,
-    -0.781516,
-    -0.781187,
-    -0.780856,
-    -0.780524,
-    -0.78019,
-    -0.779854,
-    -0.779516,
-    -0.779176,
-    -0.778834,
-    -0.778491,
-    -0.778146,
-    -0.777799,
-    -0.77745,
-    -0.777099,
-    -0.776746,
-    -0.776392,
-    -0.776036,
-    -0.775678,
-    -0.775318,
-    -0.774956,
-    -0.774593,
-    -0.774227,
-    -0.77386,
-    -0.773491,
-    -0.77312,
-    -0.772748,
-    -0.772373,
-    -0.771997,
-    -0.771619,
-    -0.771239,
-    -0.770857,
-    -0.770474,
-    -0.770089,
-    -0.769701,
-    -0.769313,
-    -0.768922,
-    -0.768529,
-    -0.768135,
-    -0.767739,
-    -0.767341,
-    -0.766941,
-    -0.766539,
-    -0.766136,
-    -0.765731,
-    -0.765324,
-    -0.764915,
-    -0.764504,
-    -0.764092,
-    -0.763678,
-    -0.763262,
-    -0.762844,
-    -0.762424,
-    -0.762003,
-    -0.76158,
-    -0.761155,
-    -0.760728,
-    -0.760299,
-    -0.759869,
-    -0.759437,
-    -0.759003,
-    -0.758567,
-    -0.75813,
-    -0.75769,
-    -0.757249,
-    -0.756806,
-    -0.756362,
-    -0.755915,
-    -0.755467,
-    -0.755017,
-    -0.754566,
-    -0.754112,
-    -0.753657,
-    -0.7532,
-    -0.752741,
-    -0.75228,
-    -0.751818,
-    -0.751354,
-    -0.750888,
-    -0.75042,
-    -0.749951,
-    -0.74948,
-    -0.749007,
-    -0.748532,
-    -0.748055,
-    -0.747577,
-    -0.747097,
-    -0.746615,
-    -0.746132,
-    -0.745647,
-    -0.745159,
-    -0.744671,
-    -0.74418,
-    -0.743688,
-    -0.743194,
-    -0.742698,
-    -0.7422,
-    -0.741701,
-    -0.7412,
-    -0.740697,
-    -0.740193,
-    -0.739687,
-    -0.739179,
-    -0.738669,
-    -0.738157,
-    -0.737644,
-    -0.737129,
-    -0.736612,
-    -0.736094,
-    -0.735574,
-    -0.735052,
-    -0.734528,
-    -0.734003,
-    -0.733476,
-    -0.732947,
-    -0.732417,
-    -0.731884,
-    -0.73135,
-    -0.730815,
-    -0.730277,
-    -0.729738,
-    -0.729197,
-    -0.728655,
-    -0.728111,
-    -0.727565,
-    -0.727017,
-    -0.726467,
-    -0.725916,
-    -0.725364,
-    -0.724809,
-    -0.724253,
-    -0.723695,
-    -0.723135,
-    -0.722574,
-    -0.722011,
-    -0.721446,
-    -0.72088,
-    -0.720311,
-    -0.719742,
-    -0.71917,
-    -0.718597,
-    -0.718022,
-    -0.717445,
-    -0.716867,
-    -0.716287,
-    -0.715705,
-    -0.715122,
-    -0.714537,
-    -0.71395,
-    -0.713362,
-    -0.712772,
-    -0.71218,
-    -0.711587,
-    -0.710992,
-    -0.710395,
-    -0.709796,
-    -0.709196,
-    -0.708595,
-    -0.707991,
-    -0.707386,
-    -0.706779,
-    -0.706171,
-    -0.705561,
-    -0.704949,
-    -0.704335,
-    -0.70372,
-    -0.703104,
-    -0.702485,
-    -0.701865,
-    -0.701244,
-    -0.70062,
-    -0.699995,
-    -0.699369,
-    -0.69874,
-    -0.69811,
-    -0.697479,
-    -0.696846,
-    -0.696211,
-    -0.695574,
-    -0.694936,
-    -0.694296,
-    -0.693655,
-    -0.693012,
-    -0.692367,
-    -0.691721,
-    -0.691073,
-    -0.690423,
-    -0.689772,
-    -0.689119,
-    -0.688465,
-    -0.687809,
-    -0.687151,
-    -0.686492,
-    -0.685831,
-    -0.685169,
-    -0.684505,
-    -0.683839,
-    -0.683172,
-    -0.682503,
-    -0.681832,
-    -0.68116,
-    -0.680486,
-    -0.679811,
-    -0.679134,
-    -0.678455,
-    -0.677775,
-    -0.677093,
-    -0.67641,
-    -0.675725,
-    -0.675039,
-    -0.674351,
-    -0.673661,
-    -0.67297,
-    -0.672277,
-    -0.671582,
-    -0.670886,
-    -0.670189,
-    -0.66949,
-    -0.668789,
-    -0.668086,
-    -0.667383,
-    -0.666677,
-    -0.66597,
-    -0.665261,
-    -0.664551,
-    -0.66384,
-    -0.663126,
-    -0.662411,
-    -0.661695,
-    -0.660977,
-    -0.660257,
-    -0.659536,
-    -0.658814,
-    -0.65809,
-    -0.657364,
-    -0.656637,
-    -0.655908,
-    -0.655177,
-    -0.654445,
-    -0.653712,
-    -0.652977,
-    -0.65224,
-    -0.651502,
-    -0.650763,
-    -0.650022,
-    -0.649279,
-    -0.648535,
-    -0.647789,
-    -0.647042,
-    -0.646293,
-    -0.645543,
-    -0.644791,
-    -0.644038,
-    -0.643283,
-    -0.642527,
-    -0.641769,
-    -0.641009,
-    -0.640249,
-    -0.639486,
-    -0.638722,
-    -0.637957,
-    -0.63719,
-    -0.636422,
-    -0.635652,
-    -0.63488,
-    -0.634107,
-    -0.633333,
-    -0.632557,
-    -0.63178,
-    -0.631001,
-    -0.630221,
-    -0.629439,
-    -0.628656,
-    -0.627871,
-    -0.627085,
-    -0.626297,
-    -0.625508,
-    -0.624717,
-    -0.623925,
-    -0.623131,
-    -0.622336,
-    -0.62154,
-    -0.620742,
-    -0.619942,
-    -0.619141,
-    -0.618339,
-    -0.617535,
-    -0.61673,
-    -0.615923,
-    -0.615115,
-    -0.614305,
-    -0.613494,
-    -0.612682,
-    -0.611868,
-    -0.611053,
-    -0.610236,
-    -0.609417,
-    -0.608598,
-    -0.607777,
-    -0.606954,
-    -0.60613,
-    -0.605305,
-    -0.604478,
-    -0.60365,
-    -0.60282,
-    -0.601989,
-    -0.601156,
-    -0.600322,
-    -0.599487,
-    -0.59865,
-    -0.597812,
-    -0.596973,
-    -0.596132,
-    -0.595289,
-    -0.594445,
-    -0.5936,
-    -0.592754,
-    -0.591906,
-    -0.591056,
-    -0.590206,
-    -0.589353,
-    -0.5885,
-    -0.587645,
-    -0.586789,
-    -0.585931,
-    -0.585072,
-    -0.584211,
-    -0.58335,
-    -0.582487,
-    -0.581622,
-    -0.580756,
-    -0.579889,
-    -0.57902,
-    -0.57815,
-    -0.577279,
-    -0.576406,
-    -0.575532,
-    -0.574656,
-    -0.57378,
-    -0.572901,
-    -0.572022,
-    -0.571141,
-    -0.570259,
-    -0.569375,
-    -0.568491,
-    -0.567604,
-    -0.566717,
-    -0.565828,
-    -0.564938,
-    -0.564046,
-    -0.563153,
-    -0.562259,
-    -0.561364,
-    -0.560467,
-    -0.559569,
-    -0.558669,
-    -0.557768,
-    -0.556866,
-    -0.555963,
-    -0.555058,
-    -0.554152,
-    -0.553245,
-    -0.552336,
-    -0.551426,
-    -0.550515,
-    -0.549603,
-    -0.548689,
-    -0.547774,
-    -0.546857,
-    -0.54594,
-    -0.545021,
-    -0.5441,
-    -0.543179,
-    -0.542256,
-    -0.541332,
-    -0.540407,
-    -0.53948,
-    -0.538552,
-    -0.537623,
-    -0.536693,
-    -0.535761,
-    -0.534828,
-    -0.533894,
-    -0.532958,
-    -0.532022,
-    -0.531084,
-    -0.530144,
-    -0.529204,
-    -0.528262,
-    -0.527319,
-    -0.526375,
-    -0.52543,
-    -0.524483,
-    -0.523535,
-    -0.522586,
-    -0.521636,
-    -0.520684,
-    -0.519731,
-    -0.518777,
-    -0.517822,
-    -0.516865,
-    -0.515908,
-    -0.514949,
-    -0.513989,
-    -0.513027,
-    -0.512065,
-    -0.511101,
-    -0.510136,
-    -0.50917,
-    -0.508203,
-    -0.507234,
-    -0.506264,
-    -0.505293,
-    -0.504321,
-    -0.503348,
-    -0.502373,
-    -0.501398,
-    -0.500421,
-    -0.499443,
-    -0.498464,
-    -0.497483,
-    -0.496502,
-    -0.495519,
-    -0.494535,
-    -0.49355,
-    -0.492564,
-    -0.491577,
-    -0.490588,
-    -0.489598,
-    -0.488608,
-    -0.487616,
-    -0.486623,
-    -0.485628,
-    -0.484633,
-    -0.483636,
-    -0.482639,
-    -0.48164,
-    -0.48064,
-    -0.479639,
-    -0.478637,
-    -0.477633,
-    -0.476629,
-    -0.475623,
-    -0.474616,
-    -0.473609,
-    -0.4726,
-    -0.47159,
-    -0.470578,
-    -0.469566,
-    -0.468553,
-    -0.467538,
-    -0.466523,
-    -0.465506,
-    -0.464488,
-    -0.463469,
-    -0.462449,
-    -0.461428,
-    -0.460406,
-    -0.459383,
-    -0.458359,
-    -0.457333,
-    -0.456307,
-    -0.455279,
-    -0.454251,
-    -0.453221,
-    -0.45219,
-    -0.451159,
-    -0.450126,
-    -0.449092,
-    -0.448057,
-    -0.447021,
-    -0.445984,
-    -0.444946,
-    -0.443907,
-    -0.442866,
-    -0.441825,
-    -0.440783,
-    -0.439739,
-    -0.438695,
-    -0.43765,
-    -0.436603,
-    -0.435556,
-    -0.434507,
-    -0.433458,
-    -0.432407,
-    -0.431356,
-    -0.430303,
-    -0.42925,
-    -0.428195,
-    -0.427139,
-    -0.426083,
-    -0.425025,
-    -0.423967,
-    -0.422907,
-    -0.421846,
-    -0.420785,
-    -0.419722,
-    -0.418659,
-    -0.417594,
-    -0.416529,
-    -0.415462,
-    -0.414395,
-    -0.413326,
-    -0.412257,
-    -0.411186,
-    -0.410115,
-    -0.409043,
-    -0.407969,
-    -0.406895,
-    -0.40582,
-    -0.404744,
-    -0.403667,
-    -0.402588,
-    -0.401509,
-    -0.40043,
-    -0.399349,
-    -0.398267,
-    -0.397184,
-    -0.3961,
-    -0.395016,
-    -0.39393,
-    -0.392844,
-    -0.391756,
-    -0.390668,
-    -0.389578,
-    -0.388488,
-    -0.387397,
-    -0.386305,
-    -0.385212,
-    -0.384118,
-    -0.383024,
-    -0.381928,
-    -0.380831,
-    -0.379734,
-    -0.378636,
-    -0.377537,
-    -0.376436,
-    -0.375335,
-    -0.374234,
-    -0.373131,
-    -0.372027,
-    -0.370923,
-    -0.369817,
-    -0.368711,
-    -0.367604,
-    -0.366496,
-    -0.365387,
-    -0.364277,
-    -0.363167,
-    -0.362055,
-    -0.360943,
-    -0.35983,
-    -0.358716,
-    -0.357601,
-    -0.356486,
-    -0.355369,
-    -0.354252,
-    -0.353134,
-    -0.352015,
-    -0.350895,
-    -0.349774,
-    -0.348653,
-    -0.34753,
-    -0.346407,
-    -0.345283,
-    -0.344159,
-    -0.343033,
-    -0.341907,
-    -0.34078,
-    -0.339652,
-    -0.338523,
-    -0.337393,
-    -0.336263,
-    -0.335132,
-    -0.334,
-    -0.332867,
-    -0.331734,
-    -0.330599,
-    -0.329464,
-    -0.328329,
-    -0.327192,
-    -0.326055,
-    -0.324916,
-    -0.323778,
-    -0.322638,
-    -0.321497,
-    -0.320356,
-    -0.319214,
-    -0.318072,
-    -0.316928,
-    -0.315784,
-    -0.314639,
-    -0.313493,
-    -0.312347,
-    -0.3112,
-    -0.310052,
-    -0.308903,
-    -0.307754,
-    -0.306604,
-    -0.305453,
-    -0.304302,
-    -0.30315,
-    -0.301997,
-    -0.300843,
-    -0.299689,
-    -0.298534,
-    -0.297378,
-    -0.296221,
-    -0.295064,
-    -0.293907,
-    -0.292748,
-    -0.291589,
-    -0.290429,
-    -0.289268,
-    -0.288107,
-    -0.286945,
-    -0.285782,
-    -0.284619,
-    -0.283455,
-    -0.282291,
-    -0.281125,
-    -0.279959,
-    -0.278793,
-    -0.277625,
-    -0.276458,
-    -0.275289,
-    -0.27412,
-    -0.27295,
-    -0.271779,
-    -0.270608,
-    -0.269436,
-    -0.268264,
-    -0.267091,
-    -0.265917,
-    -0.264743,
-    -0.263568,
-    -0.262392,
-    -0.261216,
-    -0.26004,
-    -0.258862,
-    -0.257684,
-    -0.256506,
-    -0.255326,
-    -0.254147,
-    -0.252966,
-    -0.251785,
-    -0.250604,
-    -0.249421,
-    -0.248239,
-    -0.247055,
-    -0.245871,
-    -0.244687,
-    -0.243502,
-    -0.242316,
-    -0.24113,
-    -0.239943,
-    -0.238756,
-    -0.237568,
-    -0.236379,
-    -0.23519,
-    -0.234001,
-    -0.23281,
-    -0.23162,
-    -0.230428,
-    -0.229237,
-    -0.228044,
-    -0.226851,
-    -0.225658,
-    -0.224464,
-    -0.22327,
-    -0.222075,
-    -0.220879,
-    -0.219683,
-    -0.218487,
-    -0.21729,
-    -0.216092,
-    -0.214894,
-    -0.213695,
-    -0.212496,
-    -0.211297,
-    -0.210097,
-    -0.208896,
-    -0.207695,
-    -0.206493,
-    -0.205291,
-    -0.204089,
-    -0.202886,
-    -0.201682,
-    -0.200478,
-    -0.199274,
-    -0.198069,
-    -0.196864,
-    -0.195658,
-    -0.194452,
-    -0.193245,
-    -0.192038,
-    -0.19083,
-    -0.189622,
-    -0.188413,
-    -0.187204,
-    -0.185995,
-    -0.184785,
-    -0.183575,
-    -0.182364,
-    -0.181153,
-    -0.179941,
-    -0.178729,
-    -0.177517,
-    -0.176304,
-    -0.175091,
-    -0.173877,
-    -0.172663,
-    -0.171449,
-    -0.170234,
-    -0.169018,
-    -0.167803,
-    -0.166587,
-    -0.16537,
-    -0.164153,
-    -0.162936,
-    -0.161718,
-    -0.1605,
-    -0.159282,
-    -0.158063,
-    -0.156844,
-    -0.155625,
-    -0.154405,
-    -0.153184,
-    -0.151964,
-    -0.150743,
-    -0.149521,
-    -0.1483,
-    -0.147078,
-    -0.145855,
-    -0.144633,
-    -0.14341,
-    -0.142186,
-    -0.140963,
-    -0.139739,
-    -0.138514,
-    -0.137289,
-    -0.136064,
-    -0.134839,
-    -0.133613,
-    -0.132387,
-    -0.131161,
-    -0.129935,
-    -0.128708,
-    -0.12748,
-    -0.126253,
-    -0.125025,
-    -0.123797,
-    -0.122569,
-    -0.12134,
-    -0.120111,
-    -0.118882,
-    -0.117652,
-    -0.116422,
-    -0.115192,
-    -0.113962,
-    -0.112731,
-    -0.111501,
-    -0.110269,
-    -0.109038,
-    -0.107806,
-    -0.106574,
-    -0.105342,
-    -0.10411,
-    -0.102877,
-    -0.101644,
-    -0.100411,
-    -0.0991777,
-    -0.0979441,
-    -0.0967103,
-    -0.0954762,
-    -0.0942419,
-    -0.0930074,
-    -0.0917727,
-    -0.0905377,
-    -0.0893026,
-    -0.0880672,
-    -0.0868316,
-    -0.0855959,
-    -0.0843599,
-    -0.0831237,
-    -0.0818873,
-    -0.0806507,
-    -0.079414,
-    -0.078177,
-    -0.0769399,
-    -0.0757026,
-    -0.0744651,
-    -0.0732274,
-    -0.0719896,
-    -0.0707516,
-    -0.0695134,
-    -0.0682751,
-    -0.0670366,
-    -0.0657979,
-    -0.0645591,
-    -0.0633202,
-    -0.062081,
-    -0.0608418,
-    -0.0596024,
-    -0.0583628,
-    -0.0571232,
-    -0.0558833,
-    -0.0546434,
-    -0.0534033,
-    -0.0521631,
-    -0.0509228,
-    -0.0496824,
-    -0.0484418,
-    -0.0472011,
-    -0.0459604,
-    -0.0447195,
-    -0.0434785,
-    -0.0422374,
-    -0.0409962,
-    -0.0397549,
-    -0.0385135,
-    -0.037272,
-    -0.0360304,
-    -0.0347888,
-    -0.0335471,
-    -0.0323052,
-    -0.0310634,
-    -0.0298214,
-    -0.0285794,
-    -0.0273373,
-    -0.0260951,
-    -0.0248529,
-    -0.0236106,
-    -0.0223683,
-    -0.0211259,
-    -0.0198834,
-    -0.0186409,
-    -0.0173984,
-    -0.0161558,
-    -0.0149132,
-    -0.0136706,
-    -0.0124279,
-    -0.0111852,
-    -0.00994246,
-    -0.00869971,
-    -0.00745693,
-    -0.00621413,
-    -0.00497132,
-    -0.0037285,
-    -0.00248567,
-    -0.00124284,
-    0,
-    0.00124284,
-    0.00248567,
-    0.0037285,
-    0.00497132,
-    0.00621413,
-    0.00745693,
-    0.00869971,
-    0.00994246,
-    0.0111852,
-    0.0124279,
-    0.0136706,
-    0.0149132,
-    0.0161558,
-    0.0173984,
-    0.0186409,
-    0.0198834,
-    0.0211259,
-    0.0223683,
-    0.0236106,
-    0.0248529,
-    0.0260951,
-    0.0273373,
-    0.0285794,
-    0.0298214,
-    0.0310634,
-    0.0323052,
-    0.0335471,
-    0.0347888,
-    0.0360304,
-    0.037272,
-    0.0385135,
-    0.0397549,
-    0.0409962,
-    0.0422374,
-    0.0434785,
-    0.0447195,
-    0.0459604,
-    0.0472011,
-    0.0484418,
-    0.0496824,
-    0.0509228,
-    0.0521631,
-    0.0534033,
-    0.0546434,
-    0.0558833,
-    0.0571232,
-    0.0583628,
-    0.0596024,
-    0.0608418,
-    0.062081,
-    0.0633202,
-    0.0645591,
-    0.0657979,
-    0.0670366,
-    0.0682751,
-    0.0695134,
-    0.0707516,
-    0.0719896,
-    0.0732274,
-    0.0744651,
-    0.0757026,
-    0.0769399,
-    0.078177,
-    0.079414,
-    0.0806507,
-    0.0818873,
-    0.0831237,
-    0.0843599,
-    0.0855959,
-    0.0868316,
-    0.0880672,
-    0.0893026,
-    0.0905377,
-    0.0917727,
-    0.0930074,
-    0.0942419,
-    0.0954762,
-    0.0967103,
-    0.0979441,
-    0.0991777,
-    0.100411,
-    0.101644,
-    0.102877,
-    0.10411,
-    0.105342,
-    0.106574,
-    0.107806,
-    0.109038,
-    0.110269,
-    0.111501,
-    0.112731,
-    0.113962,
-    0.115192,
-    0.116422,
-    0.117652,
-    0.118882,
-    0.120111,
-    0.12134,
-    0.122569,
-    0.123797,
-    0.125025,
-    0.126253,
-    0.12748,
-    0.128708,
-    0.129935,
-    0.131161,
-    0.132387,
-    0.133613,
-    0.134839,
-    0.136064,
-    0.137289,
-    0.138514,
-    0.139739,
-    0.140963,
-    0.142186,
-    0.14341,
-    0.144633,
-    0.145855,
-    0.147078,
-    0.1483,
-    0.149521,
-    0.150743,
-    0.151964,
-    0.153184,
-    0.154405,
-    0.155625,
-    0.156844,
-    0.158063,
-    0.159282,
-    0.1605,
-    0.161718,
-    0.162936,
-    0.164153,
-    0.16537,
-    0.166587,
-    0.167803,
-    0.169018,
-    0.170234,
-    0.171449,
-    0.172663,
-    0.173877,
-    0.175091,
-    0.176304,
-    0.177517,
-    0.178729,
-    0.179941,
-    0.181153,
-    0.182364,
-    0.183575,
-    0.184785,
-    0.185995,
-    0.187204,
-    0.188413,
-    0.189622,
-    0.19083,
-    0.192038,
-    0.193245,
-    0.194452,
-    0.195658,
-    0.196864,
-    0.198069,
-    0.199274,
-    0.200478,
-    0.201682,
-    0.202886,
-    0.204089,
-    0.205291,
-    0.206493,
-    0.207695,
-    0.208896,
-    0.210097,
-    0.211297,
-    0.212496,
-    0.213695,
-    0.214894,
-    0.216092,
-    0.21729,
-    0.218487,
-    0.219683,
-    0.220879,
-    0.222075,
-    0.22327,
-    0.224464,
-    0.225658,
-    0.226851,
-    0.228044,
-    0.229237,
-    0.230428,
-    0.23162,
-    0.23281,
-    0.234001,
-    0.23519,
-    0.236379,
-    0.237568,
-    0.238756,
-    0.239943,
-    0.24113,
-    0.242316,
-    0.243502,
-    0.244687,
-    0.245871,
-    0.247055,
-    0.248239,
-    0.249421,
-    0.250604,
-    0.251785,
-    0.252966,
-    0.254147,
-    0.255326,
-    0.256506,
-    0.257684,
-    0.258862,
-    0.26004,
-    0.261216,
-    0.262392,
-    0.263568,
-    0.264743,
-    0.265917,
-    0.267091,
-    0.268264,
-    0.269436,
-    0.270608,
-    0.271779,
-    0.27295,
-    0.27412,
-    0.275289,
-    0.276458,
-    0.277625,
-    0.278793,
-    0.279959,
-    0.281125,
-    0.282291,
-    0.283455,
-    0.284619,
-    0.285782,
-    0.286945,
-    0.288107,
-    0.289268,
-    0.290429,
-    0.291589,
-    0.292748,
-    0.293907,
-    0.295064,
-    0.296221,
-    0.297378,
-    0.298534,
-    0.299689,
-    0.300843,
-    0.301997,
-    0.30315,
-    0.304302,
-    0.305453,
-    0.306604,
-    0.307754,
-    0.308903,
-    0.310052,
-    0.3112,
-    0.312347,
-    0.313493,
-    0.314639,
-    0.315784,
-    0.316928,
-    0.318072,
-    0.319214,
-    0.320356,
-    0.321497,
-    0.322638,
-    0.323778,
-    0.324916,
-    0.326055,
-    0.327192,
-    0.328329,
-    0.329464,
-    0.330599,
-    0.331734,
-    0.332867,
-    0.334,
-    0.335132,
-    0.336263,
-    0.337393,
-    0.338523,
-    0.339652,
-    0.34078,
-    0.341907,
-    0.343033,
-    0.344159,
-    0.345283,
-    0.346407,
-    0.34753,
-    0.348653,
-    0.349774,
-    0.350895,
-    0.352015,
-    0.353134,
-    0.354252,
-    0.355369,
-    0.356486,
-    0.357601,
-    0.358716,
-    0.35983,
-    0.360943,
-    0.362055,
-    0.363167,
-    0.364277,
-    0.365387,
-    0.366496,
-    0.367604,
-    0.368711,
-    0.369817,
-    0.370923,
-    0.372027,
-    0.373131,
-    0.374234,
-    0.375335,
-    0.376436,
-    0.377537,
-    0.378636,
-    0.379734,
-    0.380831,
-    0.381928,
-    0.383024,
-    0.384118,
-    0.385212,
-    0.386305,
-    0.387397,
-    0.388488,
-    0.389578,
-    0.390668,
-    0.391756,
-    0.392844,
-    0.39393,
-    0.395016,
-    0.3961,
-    0.397184,
-    0.398267,
-    0.399349,
-    0.40043,
-    0.401509,
-    0.402588,
-    0.403667,
-    0.404744,
-    0.40582,
-    0.406895,
-    0.407969,
-    0.409043,
-    0.410115,
-    0.411186,
-    0.412257,
-    0.413326,
-    0.414395,
-    0.415462,
-    0.416529,
-    0.417594,
-    0.418659,
-    0.419722,
-    0.420785,
-    0.421846,
-    0.422907,
-    0.423967,
-    0.425025,
-    0.426083,
-    0.427139,
-    0.428195,
-    0.42925,
-    0.430303,
-    0.431356,
-    0.432407,
-    0.433458,
-    0.434507,
-    0.435556,
-    0.436603,
-    0.43765,
-    0.438695,
-    0.439739,
-    0.440783,
-    0.441825,
-    0.442866,
-    0.443907,
-    0.444946,
-    0.445984,
-    0.447021,
-    0.448057,
-    0.449092,
-    0.450126,
-    0.451159,
-    0.45219,
-    0.453221,
-    0.454251,
-    0.455279,
-    0.456307,
-    0.457333,
-    0.458359,
-    0.459383,
-    0.460406,
-    0.461428,
-    0.462449,
-    0.463469,
-    0.464488,
-    0.465506,
-    0.466523,
-    0.467538,
-    0.468553,
-    0.469566,
-    0.470578,
-    0.47159,
-    0.4726,
-    0.473609,
-    0.474616,
-    0.475623,
-    0.476629,
-    0.477633,
-    0.478637,
-    0.479639,
-    0.48064,
-    0.48164,
-    0.482639,
-    0.483636,
-    0.484633,
-    0.485628,
-    0.486623,
-    0.487616,
-    0.488608,
-    0.489598,
-    0.490588,
-    0.491577,
-    0.492564,
-    0.49355,
-    0.494535,
-    0.495519,
-    0.496502,
-    0.497483,
-    0.498464,
-    0.499443,
-    0.500421,
-    0.501398,
-    0.502373,
-    0.503348,
-    0.504321,
-    0.505293,
-    0.506264,
-    0.507234,
-    0.508203,
-    0.50917,
-    0.510136,
-    0.511101,
-    0.512065,
-    0.513027,
-    0.513989,
-    0.514949,
-    0.515908,
-    0.516865,
-    0.517822,
-    0.518777,
-    0.519731,
-    0.520684,
-    0.521636,
-    0.522586,
-    0.523535,
-    0.524483,
-    0.52543,
-    0.526375,
-    0.527319,
-    0.528262,
-    0.529204,
-    0.530144,
-    0.531084,
-    0.532022,
-    0.532958,
-    0.533894,
-    0.534828,
-    0.535761,
-    0.536693,
-    0.537623,
-    0.538552,
-    0.53948,
-    0.540407,
-    0.541332,
-    0.542256,
-    0.543179,
-    0.5441,
-    0.545021,
-    0.54594,
-    0.546857,
-    0.547774,
-    0.548689,
-    0.549603,
-    0.550515,
-    0.551426,
-    0.552336,
-    0.553245,
-    0.554152,
-    0.555058,
-    0.555963,
-    0.556866,
-    0.557768,
-    0.558669,
-    0.559569,
-    0.560467,
-    0.561364,
-    0.562259,
-    0.563153,
-    0.564046,
-    0.564938,
-    0.565828,
-    0.566717,
-    0.567604,
-    0.568491,
-    0.569375,
-    0.570259,
-    0.571141,
-    0.572022,
-    0.572901,
-    0.57378,
-    0.574656,
-    0.575532,
-    0.576406,
-    0.577279,
-    0.57815,
-    0.57902,
-    0.579889,
-    0.580756,
-    0.581622,
-    0.582487,
-    0.58335,
-    0.584211,
-    0.585072,
-    0.585931,
-    0.586789,
-    0.587645,
-    0.5885,
-    0.589353,
-    0.590206,
-    0.591056,
-    0.591906,
-    0.592754,
-    0.5936,
-    0.594445,
-    0.595289,
-    0.596132,
-    0.596973,
-    0.597812,
-    0.59865,
-    0.599487,
-    0.600322,
-    0.601156,
-    0.601989,
-    0.60282,
-    0.60365,
-    0.604478,
-    0.605305,
-    0.60613,
-    0.606954,
-    0.607777,
-    0.608598,
-    0.609417,
-    0.610236,
-    0.611053,
-    0.611868,
-    0.612682,
-    0.613494,
-    0.614305,
-    0.615115,
-    0.615923,
-    0.61673,
-    0.617535,
-    0.618339,
-    0.619141,
-    0.619942,
-    0.620742,
-    0.62154,
-    0.622336,
-    0.623131,
-    0.623925,
-    0.624717,
-    0.625508,
-    0.626297,
-    0.627085,
-    0.627871,
-    0.628656,
-    0.629439,
-    0.630221,
-    0.631001,
-    0.63178,
-    0.632557,
-    0.633333,
-    0.634107,
-    0.63488,
-    0.635652,
-    0.636422,
-    0.63719,
-    0.637957,
-    0.638722,
-    0.639486,
-    0.640249,
-    0.641009,
-    0.641769,
-    0.642527,
-    0.643283,
-    0.644038,
-    0.644791,
-    0.645543,
-    0.646293,
-    0.647042,
-    0.647789,
-    0.648535,
-    0.649279,
-    0.650022,
-    0.650763,
-    0.651502,
-    0.65224,
-    0.652977,
-    0.653712,
-    0.654445,
-    0.655177,
-    0.655908,
-    0.656637,
-    0.657364,
-    0.65809,
-    0.658814,
-    0.659536,
-    0.660257,
-    0.660977,
-    0.661695,
-    0.662411,
-    0.663126,
-    0.66384,
-    0.664551,
-    0.665261,
-    0.66597,
-    0.666677,
-    0.667383,
-    0.668086,
-    0.668789,
-    0.66949,
-    0.670189,
-    0.670886,
-    0.671582,
-    0.672277,
-    0.67297,
-    0.673661,
-    0.674351,
-    0.675039,
-    0.675725,
-    0.67641,
-    0.677093,
-    0.677775,
-    0.678455,
-    0.679134,
-    0.679811,
-    0.680486,
-    0.68116,
-    0.681832,
-    0.682503,
-    0.683172,
-    0.683839,
-    0.684505,
-    0.685169,
-    0.685831,
-    0.686492,
-    0.687151,
-    0.687809,
-    0.688465,
-    0.689119,
-    0.689772,
-    0.690423,
-    0.691073,
-    0.691721,
-    0.692367,
-    0.693012,
-    0.693655,
-    0.694296,
-    0.694936,
-    0.695574,
-    0.696211,
-    0.696846,
-    0.697479,
-    0.69811,
-    0.69874,
-    0.699369,
-    0.699995,
-    0.70062,
-    0.701244,
-    0.701865,
-    0.702485,
-    0.703104,
-    0.70372,
-    0.704335,
-    0.704949,
-    0.705561,
-    0.706171,
-    0.706779,
-    0.707386,
-    0.707991,
-    0.708595,
-    0.709196,
-    0.709796,
-    0.710395,
-    0.710992,
-    0.711587,
-    0.71218,
-    0.712772,
-    0.713362,
-    0.71395,
-    0.714537,
-    0.715122,
-    0.715705,
-    0.716287,
-    0.716867,
-    0.717445,
-    0.718022,
-    0.718597,
-    0.71917,
-    0.719742,
-    0.720311,
-    0.72088,
-    0.721446,
-    0.722011,
-    0.722574,
-    0.723135,
-    0.723695,
-    0.724253,
-    0.724809,
-    0.725364,
-    0.725916,
-    0.726467,
-    0.727017,
-    0.727565,
-    0.728111,
-    0.728655,
-    0.729197,
-    0.729738,
-    0.730277,
-    0.730815,
-    0.73135,
-    0.731884,
-    0.732417,
-    0.732947,
-    0.733476,
-    0.734003,
-    0.734528,
-    0.735052,
-    0.735574,
-    0.736094,
-    0.736612,
-    0.737129,
-    0.737644,
-    0.738157,
-    0.738669,
-    0.739179,
-    0.739687,
-    0.740193,
-    0.740697,
-    0.7412,
-    0.741701,
-    0.7422,
-    0.742698,
-    0.743194,
-    0.743688,
-    0.74418,
-    0.744671,
-    0.745159,
-    0.745647,
-    0.746132,
-    0.746615,
-    0.747097,
-    0.747577,
-    0.748055,
-    0.748532,
-    0.749007,
-    0.74948,
-    0.749951,
-    0.75042,
-    0.750888,
-    0.751354,
-    0.751818,
-    0.75228,
-    0.752741,
-    0.7532,
-    0.753657,
-    0.754112,
-    0.754566,
-    0.755017,
-    0.755467,
-    0.755915,
-    0.756362,
-    0.756806,
-    0.757249,
-    0.75769,
-    0.75813,
-    0.758567,
-    0.759003,
-    0.759437,
-    0.759869,
-    0.760299,
-    0.760728,
-    0.761155,
-    0.76158,
-    0.762003,
-    0.762424,
-    0.762844,
-    0.763262,
-    0.763678,
-    0.764092,
-    0.764504,
-    0.764915,
-    0.765324,
-    0.765731,
-    0.766136,
-    0.766539,
-    0.766941,
-    0.767341,
-    0.767739,
-    0.768135,
-    0.768529,
-    0.768922,
-    0.769313,
-    0.769701,
-    0.770089,
-    0.770474,
-    0.770857,
-    0.771239,
-    0.771619,
-    0.771997,
-    0.772373,
-    0.772748,
-    0.77312,
-    0.773491,
-    0.77386,
-    0.774227,
-    0.774593,
-    0.774956,
-    0.775318,
-    0.775678,
-    0.776036,
-    0.776392,
-    0.776746,
-    0.777099,
-    0.77745,
-    0.777799,
-    0.778146,
-    0.778491,
-    0.778834,
-    0.779176,
-    0.779516,
-    0.779854,
-    0.78019,
-    0.780524,
-    0.780856,
-    0.781187,
-    0.781516,
-    0.781842,
-    0.782167,
-    0.782491,
-    0.782812,
-    0.783132,
-    0.783449,
-    0.783765,
-    0.784079,
-    0.784391,
-    0.784701,
-    0.78501,
-    0.785317,
-    0.785621,
-    0.785924,
-    0.786225,
-    0.786524,
-    0.786822,
-    0.787117,
-    0.787411,
-    0.787703,
-    0.787993,
-    0.788281,
-    0.788567,
-    0.788851,
-    0.789134,
-    0.789415,
-    0.789693,
-    0.78997,
-    0.790246,
-    0.790519,
-    0.79079,
-    0.79106,
-    0.791327,
-    0.791593,
-    0.791857,
-    0.792119,
-    0.792379,
-    0.792638,
-    0.792894,
-    0.793149,
-    0.793401,
-    0.793652,
-    0.793901,
-    0.794149,
-    0.794394,
-    0.794637,
-    0.794879,
-    0.795118,
-    0.795356,
-    0.795592,
-    0.795826,
-    0.796058,
-    0.796289,
-    0.796517,
-    0.796744,
-    0.796968,
-    0.797191,
-    0.797412,
-    0.797631,
-    0.797848,
-    0.798064,
-    0.798277,
-    0.798488,
-    0.798698,
-    0.798906,
-    0.799112,
-    0.799316,
-    0.799518,
-    0.799718,
-    0.799917,
-    0.800113,
-    0.800308,
-    0.8005,
-    0.800691,
-    0.80088,
-    0.801067,
-    0.801252,
-    0.801436,
-    0.801617,
-    0.801797,
-    0.801974,
-    0.80215,
-    0.802324,
-    0.802496,
-    0.802666,
-    0.802834,
-    0.803001,
-    0.803165,
-    0.803328,
-    0.803488,
-    0.803647,
-    0.803804,
-    0.803959,
-    0.804112,
-    0.804263,
-    0.804412,
-    0.80456,
-    0.804705,
-    0.804849,
-    0.804991,
-    0.80513,
-    0.805268,
-    0.805404,
-    0.805539,
-    0.805671,
-    0.805801,
-    0.80593,
-    0.806056,
-    0.806181,
-    0.806304,
-    0.806425,
-    0.806544,
-    0.806661,
-    0.806776,
-    0.806889,
-    0.807,
-    0.80711,
-    0.807217,
-    0.807323,
-    0.807427,
-    0.807529,
-    0.807629,
-    0.807727,
-    0.807823,
-    0.807917,
-    0.80801,
-    0.8081,
-    0.808189,
-    0.808275,
-    0.80836,
-    0.808443,
-    0.808524,
-    0.808603,
-    0.80868,
-    0.808756,
-    0.808829,
-    0.8089,
-    0.80897,
-    0.809038,
-    0.809103,
-    0.809167,
-    0.809229,
-    0.809289,
-    0.809347,
-    0.809403,
-    0.809458,
-    0.80951,
-    0.809561,
-    0.809609,
-    0.809656,
-    0.809701,
-    0.809744,
-    0.809785,
-    0.809824,
-    0.809861,
-    0.809896,
-    0.80993,
-    0.809961,
-    0.809991,
-    0.810018,
-    0.810044,
-    0.810068,
-    0.81009,
-    0.81011,
-    0.810128,
-    0.810144,
-    0.810158,
-    0.810171,
-    0.810181,
-    0.81019,
-    0.810196,
-    0.810201,
-    0.810204,
-    0.810205,
-    0.810204,
-    0.810201,
-    0.810196,
-    0.81019,
-    0.810181,
-    0.810171,
-    0.810158,
-    0.810144,
-    0.810128,
-    0.81011,
-    0.81009,
-    0.810068,
-    0.810044,
-    0.810018,
-    0.809991,
-    0.809961,
-    0.80993,
-    0.809896,
-    0.809861,
-    0.809824,
-    0.809785,
-    0.809744,
-    0.809701,
-    0.809656,
-    0.809609,
-    0.809561,
-    0.80951,
-    0.809458,
-    0.809403,
-    0.809347,
-    0.809289,
-    0.809229,
-    0.809167,
-    0.809103,
-    0.809038,
-    0.80897,
-    0.8089,
-    0.808829,
-    0.808756,
-    0.80868,
-    0.808603,
-    0.808524,
-    0.808443,
-    0.80836,
-    0.808275,
-    0.808189,
-    0.8081,
-    0.80801,
-    0.807917,
-    0.807823,
-    0.807727,
-    0.807629,
-    0.807529,
-    0.807427,
-    0.807323,
-    0.807217,
-    0.80711,
-    0.807,
-    0.806889,
-    0.806776,
-    0.806661,
-    0.806544,
-    0.806425,
-    0.806304,
-    0.806181,
-    0.806056,
-    0.80593,
-    0.805801,
-    0.805671,
-    0.805539,
-    0.805404,
-    0.805268,
-    0.80513,
-    0.804991,
-    0.804849,
-    0.804705,
-    0.80456,
-    0.804412,
-    0.804263,
-    0.804112,
-    0.803959,
-    0.803804,
-    0.803647,
-    0.803488,
-    0.803328,
-    0.803165,
-    0.803001,
-    0.802834,
-    0.802666,
-    0.802496,
-    0.802324,
-    0.80215,
-    0.801974,
-    0.801797,
-    0.801617,
-    0.801436,
-    0.801252,
-    0.801067,
-    0.80088,
-    0.800691,
-    0.8005,
-    0.800308,
-    0.800113,
-    0.799917,
-    0.799718,
-    0.799518,
-    0.799316,
-    0.799112,
-    0.798906,
-    0.798698,
-    0.798488,
-    0.798277,
-    0.798064,
-    0.797848,
-    0.797631,
-    0.797412,
-    0.797191,
-    0.796968,
-    0.796744,
-    0.796517,
-    0.796289,
-    0.796058,
-    0.795826,
-    0.795592,
-    0.795356,
-    0.795118,
-    0.794879,
-    0.794637,
-    0.794394,
-    0.794149,
-    0.793901,
-    0.793652,
-    0.793401,
-    0.793149,
-    0.792894,
-    0.792638,
-    0.792379,
-    0.792119,
-    0.791857,
-    0.791593,
-    0.791327,
-    0.79106,
-    0.79079,
-    0.790519,
-    0.790246,
-    0.78997,
-    0.789693,
-    0.789415,
-    0.789134,
-    0.788851,
-    0.788567,
-    0.788281,
-    0.787993,
-    0.787703,
-    0.787411,
-    0.787117,
-    0.786822,
-    0.786524,
-    0.786225,
-    0.785924,
-    0.785621,
-    0.785317,
-    0.78501,
-    0.784701,
-    0.784391,
-    0.784079,
-    0.783765,
-    0.783449,
-    0.783132,
-    0.782812,
-    0.782491,
-    0.782167,
-    0.781842,
-    0.781516,
-    0.781187,
-    0.780856,
-    0.780524,
-    0.78019,
-    0.779854,
-    0.779516,
-    0.779176,
-    0.778834,
-    0.778491,
-    0.778146,
-    0.777799,
-    0.77745,
-    0.777099,
-    0.776746,
-    0.776392,
-    0.776036,
-    0.775678,
-    0.775318,
-    0.774956,
-    0.774593,
-    0.774227,
-    0.77386,
-    0.773491,
-    0.77312,
-    0.772748,
-    0.772373,
-    0.771997,
-    0.771619,
-    0.771239,
-    0.770857,
-    0.770474,
-    0.770089,
-    0.769701,
-    0.769313,
-    0.768922,
-    0.768529,
-    0.768135,
-    0.767739,
-    0.767341,
-    0.766941,
-    0.766539,
-    0.766136,
-    0.765731,
-    0.765324,
-    0.764915,
-    0.764504,
-    0.764092,
-    0.763678,
-    0.763262,
-    0.762844,
-    0.762424,
-    0.762003,
-    0.76158,
-    0.761155,
-    0.760728,
-    0.760299,
-    0.759869,
-    0.759437,
-    0.759003,
-    0.758567,
-    0.75813,
-    0.75769,
-    0.757249,
-    0.756806,
-    0.756362,
-    0.755915,
-    0.755467,
-    0.755017,
-    0.754566,
-    0.754112,
-    0.753657,
-    0.7532,
-    0.752741,
-    0.75228,
-    0.751818,
-    0.751354,
-    0.750888,
-    0.75042,
-    0.749951,
-    0.74948,
-    0.749007,
-    0.748532,
-    0.748055,
-    0.747577,
-    0.747097,
-    0.746615,
-    0.746132,
-    0.745647,
-    0.745159,
-    0.744671,
-    0.74418,
-    0.743688,
-    0.743194,
-    0.742698,
-    0.7422,
-    0.741701,
-    0.7412,
-    0.740697,
-    0.740193,
-    0.739687,
-    0.739179,
-    0.738669,
-    0.738157,
-    0.737644,
-    0.737129,
-    0.736612,
-    0.736094,
-    0.735574,
-    0.735052,
-    0.734528,
-    0.734003,
-    0.733476,
-    0.732947,
-    0.732417,
-    0.731884,
-    0.73135,
-    0.730815,
-    0.730277,
-    0.729738,
-    0.729197,
-    0.728655,
-    0.728111,
-    0.727565,
-    0.727017,
-    0.726467,
-    0.725916,
-    0.725364,
-    0.724809,
-    0.724253,
-    0.723695,
-    0.723135,
-    0.722574,
-    0.722011,
-    0.721446,
-    0.72088,
-    0.720311,
-    0.719742,
-    0.71917,
-    0.718597,
-    0.718022,
-    0.717445,
-    0.716867,
-    0.716287,
-    0.715705,
-    0.715122,
-    0.714537,
-    0.71395,
-    0.713362,
-    0.712772,
-    0.71218,
-    0.711587,
-    0.710992,
-    0.710395,
-    0.709796,
-    0.709196,
-    0.708595,
-    0.707991,
-    0.707386,
-    0.706779,
-    0.706171,
-    0.705561,
-    0.704949,
-    0.704335,
-    0.70372,
-    0.703104,
-    0.702485,
-    0.701865,
-    0.701244,
-    0.70062,
-    0.699995,
-    0.699369,
-    0.69874,
-    0.69811,
-    0.697479,
-    0.696846,
-    0.696211,
-    0.695574,
-    0.694936,
-    0.694296,
-    0.693655,
-    0.693012,
-    0.692367,
-    0.691721,
-    0.691073,
-    0.690423,
-    0.689772,
-    0.689119,
-    0.688465,
-    0.687809,
-    0.687151,
-    0.686492,
-    0.685831,
-    0.685169,
-    0.684505,
-    0.683839,
-    0.683172,
-    0.682503,
-    0.681832,
-    0.68116,
-    0.680486,
-    0.679811,
-    0.679134,
-    0.678455,
-    0.677775,
-    0.677093,
-    0.67641,
-    0.675725,
-    0.675039,
-    0.674351,
-    0.673661,
-    0.67297,
-    0.672277,
-    0.671582,
-    0.670886,
-    0.670189,
-    0.66949,
-    0.668789,
-    0.668086,
-    0.667383,
-    0.666677,
-    0.66597,
-    0.665261,
-    0.664551,
-    0.66384,
-    0.663126,
-    0.662411,
-    0.661695,
-    0.660977,
-    0.660257,
-    0.659536,
-    0.658814,
-    0.65809,
-    0.657364,
-    0.656637,
-    0.655908,
-    0.655177,
-    0.654445,
-    0.653712,
-    0.652977,
-    0.65224,
-    0.651502,
-    0.650763,
-    0.650022,
-    0.649279,
-    0.648535,
-    0.647789,
-    0.647042,
-    0.646293,
-    0.645543,
-    0.644791,
-    0.644038,
-    0.643283,
-    0.642527,
-    0.641769,
-    0.641009,
-    0.640249,
-    0.639486,
-    0.638722,
-    0.637957,
-    0.63719,
-    0.636422,
-    0.635652,
-    0.63488,
-    0.634107,
-    0.633333,
-    0.632557,
-    0.63178,
-    0.631001,
-    0.630221,
-    0.629439,
-    0.628656,
-    0.627871,
-    0.627085,
-    0.626297,
-    0.625508,
-    0.624717,
-    0.623925,
-    0.623131,
-    0.622336,
-    0.62154,
-    0.620742,
-    0.619942,
-    0.619141,
-    0.618339,
-    0.617535,
-    0.61673,
-    0.615923,
-    0.615115,
-    0.614305,
-    0.613494,
-    0.612682,
-    0.611868,
-    0.611053,
-    0.610236,
-    0.609417,
-    0.608598,
-    0.607777,
-    0.606954,
-    0.60613,
-    0.605305,
-    0.604478,
-    0.60365,
-    0.60282,
-    0.601989,
-    0.601156,
-    0.600322,
-    0.599487,
-    0.59865,
-    0.597812,
-    0.596973,
-    0.596132,
-    0.595289,
-    0.594445,
-    0.5936,
-    0.592754,
-    0.591906,
-    0.591056,
-    0.590206,
-    0.589353,
-    0.5885,
-    0.587645,
-    0.586789,
-    0.585931,
-    0.585072,
-    0.584211,
-    0.58335,
-    0.582487,
-    0.581622,
-    0.580756,
-    0.579889,
-    0.57902,
-    0.57815,
-    0.577279,
-    0.576406,
-    0.575532,
-    0.574656,
-    0.57378,
-    0.572901,
-    0.572022,
-    0.571141,
-    0.570259,
-    0.569375,
-    0.568491,
-    0.567604,
-    0.566717,
-    0.565828,
-    0.564938,
-    0.564046,
-    0.563153,
-    0.562259,
-    0.561364,
-    0.560467,
-    0.559569,
-    0.558669,
-    0.557768,
-    0.556866,
-    0.555963,
-    0.555058,
-    0.554152,
-    0.553245,
-    0.552336,
-    0.551426,
-    0.550515,
-    0.549603,
-    0.548689,
-    0.547774,
-    0.546857,
-    0.54594,
-    0.545021,
-    0.5441,
-    0.543179,
-    0.542256,
-    0.541332,
-    0.540407,
-    0.53948,
-    0.538552,
-    0.537623,
-    0.536693,
-    0.535761,
-    0.534828,
-    0.533894,
-    0.532958,
-    0.532022,
-    0.531084,
-    0.530144,
-    0.529204,
-    0.528262,
-    0.527319,
-    0.526375,
-    0.52543,
-    0.524483,
-    0.523535,
-    0.522586,
-    0.521636,
-    0.520684,
-    0.519731,
-    0.518777,
-    0.517822,
-    0.516865,
-    0.515908,
-    0.514949,
-    0.513989,
-    0.513027,
-    0.512065,
-    0.511101,
-    0.510136,
-    0.50917,
-    0.508203,
-    0.507234,
-    0.506264,
-    0.505293,
-    0.504321,
-    0.503348,
-    0.502373,
-    0.501398,
-    0.500421,
-    0.499443,
-    0.498464,
-    0.497483,
-    0.496502,
-    0.495519,
-    0.494535,
-    0.49355,
-    0.492564,
-    0.491577,
-    0.490588,
-    0.489598,
-    0.488608,
-    0.487616,
-    0.486623,
-    0.485628,
-    0.484633,
-    0.483636,
-    0.482639,
-    0.48164,
-    0.48064,
-    0.479639,
-    0.478637,
-    0.477633,
-    0.476629,
-    0.475623,
-    0.474616,
-    0.473609,
-    0.4726,
-    0.47159,
-    0.470578,
-    0.469566,
-    0.468553,
-    0.467538,
-    0.466523,
-    0.465506,
-    0.464488,
-    0.463469,
-    0.462449,
-    0.461428,
-    0.460406,
-    0.459383,
-    0.458359,
-    0.457333,
-    0.456307,
-    0.455279,
-    0.454251,
-    0.453221,
-    0.45219,
-    0.451159,
-    0.450126,
-    0.449092,
-    0.448057,
-    0.447021,
-    0.445984,
-    0.444946,
-    0.443907,
-    0.442866,
-    0.441825,
-    0.440783,
-    0.439739,
-    0.438695,
-    0.43765,
-    0.436603,
-    0.435556,
-    0.434507,
-    0.433458,
-    0.432407,
-    0.431356,
-    0.430303,
-    0.42925,
-    0.428195,
-    0.427139,
-    0.426083,
-    0.425025,
-    0.423967,
-    0.422907,
-    0.421846,
-    0.420785,
-    0.419722,
-    0.418659,
-    0.417594,
-    0.416529,
-    0.415462,
-    0.414395,
-    0.413326,
-    0.412257,
-    0.411186,
-    0.410115,
-    0.409043,
-    0.407969,
-    0.406895,
-    0.40582,
-    0.404744,
-    0.403667,
-    0.402588,
-    0.401509,
-    0.40043,
-    0.399349,
-    0.398267,
-    0.397184,
-    0.3961,
-    0.395016,
-    0.39393,
-    0.392844,
-    0.391756,
-    0.390668,
-    0.389578,
-    0.388488,
-    0.387397,
-    0.386305,
-    0.385212,
-    0.384118,
-    0.383024,
-    0.381928,
-    0.380831,
-    0.379734,
-    0.378636,
-    0.377537,
-    0.376436,
-    0.375335,
-    0.374234,
-    0.373131,
-    0.372027,
-    0.370923,
-    0.369817,
-    0.368711,
-    0.367604,
-    0.366496,
-    0.365387,
-    0.364277,
-    0.363167,
-    0.362055,
-    0.360943,
-    0.35983,
-    0.358716,
-    0.357601,
-    0.356486,
-    0.355369,
-    0.354252,
-    0.353134,
-    0.352015,
-    0.350895,
-    0.349774,
-    0.348653,
-    0.34753,
-    0.346407,
-    0.345283,
-    0.344159,
-    0.343033,
-    0.341907,
-    0.34078,
-    0.339652,
-    0.338523,
-    0.337393,
-    0.336263,
-    0.335132,
-    0.334,
-    0.332867,
-    0.331734,
-    0.330599,
-    0.329464,
-    0.328329,
-    0.327192,
-    0.326055,
-    0.324916,
-    0.323778,
-    0.322638,
-    0.321497,
-    0.320356,
-    0.319214,
-    0.318072,
-    0.316928,
-    0.315784,
-    0.314639,
-    0.313493,
-    0.312347,
-    0.3112,
-    0.310052,
-    0.308903,
-    0.307754,
-    0.306604,
-    0.305453,
-    0.304302,
-    0.30315,
-    0.301997,
-    0.300843,
-    0.299689,
-    0.298534,
-    0.297378,
-    0.296221,
-    0.295064,
-    0.293907,
-    0.292748,
-    0.291589,
-    0.290429,
-    0.289268,
-    0.288107,
-    0.286945,
-    0.285782,
-    0.284619,
-    0.283455,
-    0.282291,
-    0.281125,
-    0.279959,
-    0.278793,
-    0.277625,
-    0.276458,
-    0.275289,
-    0.27412,
-    0.27295,
-    0.271779,
-    0.270608,
-    0.269436,
-    0.268264,
-    0.267091,
-    0.265917,
-    0.264743,
-    0.263568,
-    0.262392,
-    0.261216,
-    0.26004,
-    0.258862,
-    0.257684,
-    0.256506,
-    0.255326,
-    0.254147,
-    0.252966,
-    0.251785,
-    0.250604,
-    0.249421,
-    0.248239,
-    0.247055,
-    0.245871,
-    0.244687,
-    0.243502,
-    0.242316,
-    0.24113,
-    0.239943,
-    0.238756,
-    0.237568,
-    0.236379,
-    0.23519,
-    0.234001,
-    0.23281,
-    0.23162,
-    0.230428,
-    0.229237,
-    0.228044,
-    0.226851,
-    0.225658,
-    0.224464,
-    0.22327,
-    0.222075,
-    0.220879,
-    0.219683,
-    0.218487,
-    0.21729,
-    0.216092,
-    0.214894,
-    0.213695,
-    0.212496,
-    0.211297,
-    0.210097,
-    0.208896,
-    0.207695,
-    0.206493,
-    0.205291,
-    0.204089,
-    0.202886,
-    0.201682,
-    0.200478,
-    0.199274,
-    0.198069,
-    0.196864,
-    0.195658,
-    0.194452,
-    0.193245,
-    0.192038,
-    0.19083,
-    0.189622,
-    0.188413,
-    0.187204,
-    0.185995,
-    0.184785,
-    0.183575,
-    0.182364,
-    0.181153,
-    0.179941,
-    0.178729,
-    0.177517,
-    0.176304,
-    0.175091,
-    0.173877,
-    0.172663,
-    0.171449,
-    0.170234,
-    0.169018,
-    0.167803,
-    0.166587,
-    0.16537,
-    0.164153,
-    0.162936,
-    0.161718,
-    0.1605,
-    0.159282,
-    0.158063,
-    0.156844,
-    0.155625,
-    0.154405,
-    0.153184,
-    0.151964,
-    0.150743,
-    0.149521,
-    0.1483,
-    0.147078,
-    0.145855,
-    0.144633,
-    0.14341,
-    0.142186,
-    0.140963,
-    0.139739,
-    0.138514,
-    0.137289,
-    0.136064,
-    0.134839,
-    0.133613,
-    0.132387,
-    0.131161,
-    0.129935,
-    0.128708,
-    0.12748,
-    0.126253,
-    0.125025,
-    0.123797,
-    0.122569,
-    0.12134,
-    0.120111,
-    0.118882,
-    0.117652,
-    0.116422,
-    0.115192,
-    0.113962,
-    0.112731,
-    0.111501,
-    0.110269,
-    0.109038,
-    0.107806,
-    0.106574,
-    0.105342,
-    0.10411,
-    0.102877,
-    0.101644,
-    0.100411,
-    0.0991777,
-    0.0979441,
-    0.0967103,
-    0.0954762,
-    0.0942419,
-    0.0930074,
-    0.0917727,
-    0.0905377,
-    0.0893026,
-    0.0880672,
-    0.0868316,
-    0.0855959,
-    0.0843599,
-    0.0831237,
-    0.0818873,
-    0.0806507,
-    0.079414,
-    0.078177,
-    0.0769399,
-    0.0757026,
-    0.0744651,
-    0.0732274,
-    0.0719896,
-    0.0707516,
-    0.0695134,
-    0.0682751,
-    0.0670366,
-    0.0657979,
-    0.0645591,
-    0.0633202,
-    0.062081,
-    0.0608418,
-    0.0596024,
-    0.0583628,
-    0.0571232,
-    0.0558833,
-    0.0546434,
-    0.0534033,
-    0.0521631,
-    0.0509228,
-    0.0496824,
-    0.0484418,
-    0.0472011,
-    0.0459604,
-    0.0447195,
-    0.0434785,
-    0.0422374,
-    0.0409962,
-    0.0397549,
-    0.0385135,
-    0.037272,
-    0.0360304,
-    0.0347888,
-    0.0335471,
-    0.0323052,
-    0.0310634,
-    0.0298214,
-    0.0285794,
-    0.0273373,
-    0.0260951,
-    0.0248529,
-    0.0236106,
-    0.0223683,
-    0.0211259,
-    0.0198834,
-    0.0186409,
-    0.0173984,
-    0.0161558,
-    0.0149132,
-    0.0136706,
-    0.0124279,
-    0.0111852,
-    0.00994246,
-    0.00869971,
-    0.00745693,
-    0.00621413,
-    0.00497132,
-    0.0037285,
-    0.00248567,
-    0.00124284
-};
-
-constexpr static std::array<std::array<float, 4096>, 10> wt_triangle =
-{
-    wt_triangle_0x1,
-    wt_triangle_0x2,
-    wt_triangle_0x3,
-    wt_triangle_0x4,
-    wt_triangle_0x5,
-    wt_triangle_0x6,
-    wt_triangle_0x7,
-    wt_triangle_0x8,
-    wt_triangle_0x9,
-    wt_triangle_0xA
-};
-
-#endif
@@ -15,6 +15,18 @@ const float ValueTransition::get()
     return (float) target;
 }
 
+const float ValueTransition::get(int samples)
+{
+    if (timeInSamples > 0) {
+        samples = std::min(samples, timeInSamples);
+        timeInSamples = timeInSamples - samples;
+        value = value * std::pow((double) delta, samples);
+        return (float) value;
+    }
+
+    return (float) target;
+}
+
 void ValueTransition::set(float target)
 {
     set(value, target, timeInSeconds);
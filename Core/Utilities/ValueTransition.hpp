@@ -23,6 +23,12 @@ public:
 
 public:
     const float get();
+
+    /// @brief Advance the transition by the given number of samples and return the value at the end of the span.
+    /// This is equivalent to calling `get()` the given number of times.
+    /// @param samples The number of samples to advance by.
+
+    const float get(int samples);
     
     void set(float target);
     
@@ -37,6 +43,13 @@ public:
         return (float) target;
     }
 
+    /// @brief Return the current value without advancing the transition.
+
+    [[nodiscard]] inline const float getValue() const noexcept
+    {
+        return timeInSamples > 0 ? (float) value : (float) target;
+    }
+
     [[nodiscard]] inline const bool complete() const noexcept
     {
         return timeInSamples <= 0;
@@ -0,0 +1,189 @@
+//  Assemble
+//  ============================
+//  Copyright © 2020 David Spry. All rights reserved.
+
+#include "WorkerGroup.hpp"
+
+#if defined(__APPLE__)
+    #include <pthread.h>
+    #include <mach/mach.h>
+    #include <mach/thread_policy.h>
+#elif defined(__linux__)
+    #include <pthread.h>
+    #include <sched.h>
+    #include <unistd.h>
+    #include <sys/syscall.h>
+    #include <linux/futex.h>
+#endif
+
+void WorkerGroup::start(Job job, void* context)
+{
+    if (isRunning()) return;
+
+    /// A fork that began before the group was last stopped is joined by the audio thread, which claims its tasks.
+    /// Each slot is reset once that cycle has ended, and the group is only published to the audio thread once
+    /// every slot is Idle and every worker has been spawned, so that no fork can be overwritten.
+
+    while (cycling.load(std::memory_order_acquire))
+        std::this_thread::yield();
+
+    this->job = job;
+    this->context = context;
+    alive.store(true, std::memory_order_release);
+
+    for (int w = 0; w < workers; ++w)
+        slots[w].state.store(Idle, std::memory_order_relaxed);
+
+    for (int w = 0; w < workers; ++w)
+        slots[w].thread = std::thread(&WorkerGroup::run, this, w);
+
+    running.store(true, std::memory_order_release);
+}
+
+void WorkerGroup::stop()
+{
+    if (!running.exchange(false)) return;
+    alive.store(false, std::memory_order_seq_cst);
+
+    for (int w = 0; w < workers; ++w)
+    {
+        Slot& slot = slots[w];
+        slot.epoch.fetch_add(1, std::memory_order_seq_cst);
+        wake(slot);
+
+        if (slot.thread.joinable())
+            slot.thread.join();
+    }
+}
+
+void WorkerGroup::fork()
+{
+    cycling.store(true, std::memory_order_relaxed);
+
+    for (int w = 0; w < workers; ++w)
+    {
+        Slot& slot = slots[w];
+        slot.state.store(Pending, std::memory_order_seq_cst);
+        slot.epoch.fetch_add(1, std::memory_order_seq_cst);
+
+        if (slot.parked.load(std::memory_order_seq_cst))
+            wake(slot);
+    }
+}
+
+const bool WorkerGroup::join(Time::time_point deadline)
+{
+    bool punctual = true;
+
+    for (int w = 0; w < workers; ++w)
+    {
+        Slot& slot = slots[w];
+        int state;
+
+        while ((state = slot.state.load(std::memory_order_acquire)) != Complete)
+        {
+            if (state == Pending && (!isRunning() || Time::now() >= deadline))
+            {
+                int expected = Pending;
+                if (slot.state.compare_exchange_strong(expected, Claimed, std::memory_order_acq_rel))
+                {
+                    job(context, w);
+                    slot.state.store(Complete, std::memory_order_relaxed);
+                    misses.fetch_add(1, std::memory_order_relaxed);
+                    punctual = false;
+                }
+
+                continue;
+            }
+
+            pause();
+        }
+
+        slot.state.store(Idle, std::memory_order_relaxed);
+    }
+
+    cycling.store(false, std::memory_order_release);
+    return punctual;
+}
+
+void WorkerGroup::run(const int worker)
+{
+    pin(worker + 1);
+
+    Slot& slot = slots[worker];
+    int spin = 0;
+
+    while (alive.load(std::memory_order_seq_cst))
+    {
+        if (slot.state.load(std::memory_order_acquire) != Pending)
+        {
+            if (++spin < spins)
+            {
+                pause();
+                continue;
+            }
+
+            /// Park until the next fork. The epoch is read before the state is checked, so a fork that publishes
+            /// its task after the check has also advanced the epoch, and the wait returns at once. Either the worker
+            /// sees the task, or the fork sees that the worker has parked and wakes it.
+
+            const uint32_t epoch = slot.epoch.load(std::memory_order_seq_cst);
+            slot.parked.store(true, std::memory_order_seq_cst);
+
+            if (slot.state.load(std::memory_order_seq_cst) != Pending && alive.load(std::memory_order_seq_cst))
+                wait(slot, epoch);
+
+            slot.parked.store(false, std::memory_order_relaxed);
+            spin = spins;
+            continue;
+        }
+
+        int expected = Pending;
+        if (slot.state.compare_exchange_strong(expected, Claimed, std::memory_order_acq_rel))
+        {
+            job(context, worker);
+            slot.state.store(Complete, std::memory_order_release);
+        }
+
+        spin = 0;
+    }
+}
+
+void WorkerGroup::wait(Slot& slot, const uint32_t epoch)
+{
+    #if defined(__linux__)
+        static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t), "The epoch must be a plain 32-bit word");
+        syscall(SYS_futex, reinterpret_cast<uint32_t*>(&slot.epoch), FUTEX_WAIT_PRIVATE, epoch, nullptr, nullptr, 0);
+    #else
+        std::unique_lock<std::mutex> lock(slot.mutex);
+        slot.condition.wait(lock, [&] { return slot.epoch.load(std::memory_order_seq_cst) != epoch; });
+    #endif
+}
+
+void WorkerGroup::wake(Slot& slot)
+{
+    #if defined(__linux__)
+        syscall(SYS_futex, reinterpret_cast<uint32_t*>(&slot.epoch), FUTEX_WAKE_PRIVATE, 1, nullptr, nullptr, 0);
+    #else
+        /// A worker holds the lock from checking its epoch until it waits, so taking the lock here ensures
+        /// that the worker is either waiting, and is notified, or has yet to check the advanced epoch.
+        { std::lock_guard<std::mutex> lock(slot.mutex); }
+        slot.condition.notify_one();
+    #endif
+}
+
+void WorkerGroup::pin(const int core)
+{
+    #if defined(__linux__)
+        const unsigned int cores = std::max(1U, std::thread::hardware_concurrency());
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(core % cores, &set);
+        pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+    #elif defined(__APPLE__)
+        /// Affinity is a hint on macOS and is not supported on iOS, in which case this has no effect.
+        thread_affinity_policy_data_t policy = { core };
+        thread_policy_set(pthread_mach_thread_np(pthread_self()), THREAD_AFFINITY_POLICY,
+                          (thread_policy_t) &policy, THREAD_AFFINITY_POLICY_COUNT);
+    #endif
+}
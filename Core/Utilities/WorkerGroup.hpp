@@ -0,0 +1,150 @@
+//  Assemble
+//  ============================
+//  Copyright © 2020 David Spry. All rights reserved.
+
+#ifndef WORKERGROUP_HPP
+#define WORKERGROUP_HPP
+
+#include "ASHeaders.h"
+
+#include <chrono>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+/// \brief A fixed group of worker threads that execute one task each per fork/join cycle.
+///
+/// The group is designed to be driven from the audio thread. `fork()` and `join()` never allocate
+/// or lock. Each task is claimed with a compare-and-swap, so that the thread calling `join()` can
+/// claim and execute any task that a worker has not started by the deadline. Workers spin for a
+/// short time while waiting for the next fork, then park on their slot's epoch until a fork advances it.
+/// On Linux, a worker parks on a futex, so `fork()` only makes a system call to wake a worker that
+/// has parked. Elsewhere, `fork()` briefly takes the lock of a parked worker before notifying it.
+
+class WorkerGroup
+{
+public:
+    /// \brief The signature of the function executed for each task.
+    /// \param context The context pointer given to `start()`
+    /// \param task The index of the task to execute
+
+    using Job = void (*)(void* context, int task);
+    using Time = std::chrono::steady_clock;
+
+    /// \brief The largest number of workers in a group.
+
+    constexpr static int maximumWorkers = 8;
+
+public:
+    WorkerGroup(const int workers) : workers(std::min(workers, maximumWorkers)) {}
+    ~WorkerGroup() { stop(); }
+
+    WorkerGroup(const WorkerGroup&) = delete;
+    WorkerGroup& operator=(const WorkerGroup&) = delete;
+
+public:
+    /// \brief Spawn the workers, each pinned to its own core where the platform allows it.
+    /// This should not be called from the audio thread.
+    /// \param job The function that each worker should execute when a task is forked
+    /// \param context A pointer that is passed to `job`
+
+    void start(Job job, void* context);
+
+    /// \brief Stop and join the workers. This should not be called from the audio thread.
+    /// Any task that is forked while the group is stopping is executed by the thread that calls `join()`.
+
+    void stop();
+
+    /// \brief Indicate whether the workers are running.
+
+    inline const bool isRunning() const { return running.load(std::memory_order_acquire); }
+
+    /// \brief Return the number of workers, which is also the number of tasks per fork.
+
+    inline const int size() const { return workers; }
+
+    /// \brief Return the number of tasks that were executed by the joining thread because
+    /// the worker responsible for them missed the deadline.
+
+    inline const uint64_t missedDeadlines() const { return misses.load(std::memory_order_relaxed); }
+
+public:
+    /// \brief Publish one task to each worker and wake any worker that has parked.
+
+    void fork();
+
+    /// \brief Wait for each task to complete. Any task that has not been claimed by its worker
+    /// when the deadline passes is executed by the calling thread.
+    /// \param deadline The time by which each worker should have claimed its task
+    /// \return `true` if every task was executed by its worker; `false` otherwise.
+
+    const bool join(Time::time_point deadline);
+
+private:
+    enum State { Idle, Pending, Claimed, Complete };
+    struct Slot;
+
+    /// \brief The loop executed by each worker thread.
+
+    void run(const int worker);
+
+    /// \brief Pin the calling thread to a core.
+
+    static void pin(const int core);
+
+    /// \brief Park the calling worker until the epoch of its slot differs from the given epoch.
+    /// The worker may also return spuriously.
+
+    static void wait(Slot& slot, const uint32_t epoch);
+
+    /// \brief Wake the worker of the given slot if it is parked, or is about to park, on an epoch that has since advanced.
+
+    static void wake(Slot& slot);
+
+    /// \brief Hint to the processor that the calling thread is spinning.
+
+    static inline void pause()
+    {
+        #if defined(__x86_64__) || defined(__i386__)
+            __builtin_ia32_pause();
+        #elif defined(__aarch64__) || defined(__arm__)
+            asm volatile("yield");
+        #endif
+    }
+
+private:
+    /// \brief The state of each worker. The epoch is advanced by each fork, and a worker parks
+    /// on the epoch it read before checking its state, so that a fork cannot go unnoticed.
+
+    struct alignas(64) Slot
+    {
+        std::atomic<int>  state  = {Idle};
+        std::atomic<bool> parked = {false};
+        std::atomic<uint32_t> epoch = {0};
+        std::mutex mutex;
+        std::condition_variable condition;
+        std::thread thread;
+    };
+
+    const int workers;
+    std::array<Slot, maximumWorkers> slots;
+
+private:
+    Job   job     = nullptr;
+    void* context = nullptr;
+    std::atomic<uint64_t> misses  = {0};
+
+    /// \brief Whether the group is published to the audio thread, whether the workers should keep running,
+    /// and whether a fork has yet to be joined.
+
+    std::atomic<bool> running = {false};
+    std::atomic<bool> alive   = {false};
+    std::atomic<bool> cycling = {false};
+
+private:
+    /// \brief The number of times a worker checks for a new task before it parks.
+
+    constexpr static int spins = 1 << 14;
+};
+
+#endif
@@ -0,0 +1,1586 @@
+//  Assemble
+//  ============================
+//  Copyright © 2020 David Spry. All rights reserved.
+
+#include <cmath>
+#include <chrono>
+#include <algorithm>
+#include <memory>
+#include <fstream>
+#include <iostream>
+#include <unistd.h>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#endif
+
+#include "ASCommanderCore.hpp"
+#include "ASOscillators.h"
+#include "ASEffects.h"
+#include "CDSPResampler.h"
+#include "CDSPHBDownsampler.h"
+#include "Oversampler.hpp"
+#include "HuovilainenLadder.hpp"
+#include "Voice.hpp"
+#include "Song.hpp"
+
+/// \brief A micro-benchmark suite for the Assemble core.
+///
+/// Each benchmark drives one component in isolation for a fixed number of samples, and the
+/// measurement is repeated several times. The median and the best times are reported as
+/// nanoseconds per sample and samples per second. The full `ASCommanderCore::render` is measured
+/// at each power-of-two block size from 64 to 4096. The results are written as JSON, so that runs
+/// from different builds can be compared with any JSON diff tool.
+///
+/// With `--sweep`, the suite instead stress-tests `ASCommanderCore::render` with host block sizes from
+/// 1 to 65536 samples, including sizes that are not multiples of `BLOCK_SIZE`. Each render must produce
+/// finite samples and must not write beyond the end of the host's buffers.
+///
+/// On Linux, the level-1 data cache misses of each measurement are counted with `perf_event_open`, where the kernel
+/// permits it, and reported per sample beside the time. Where the counter is unavailable, they are reported as null.
+
+namespace Benchmarks
+{
+    using Time = std::chrono::steady_clock;
+
+    struct Options
+    {
+        std::string song;
+        std::string output;
+        std::string filter;
+        double sampleRate = 48000.0;
+        double seconds = 2.0;
+        int repeats = 5;
+        bool sweep = false;
+    };
+
+    struct Result
+    {
+        std::string name;
+        uint64_t samples;
+        double median;
+        double best;
+        double misses;
+    };
+
+    struct Accuracy
+    {
+        std::string name;
+        double maxError;
+        double rmsError;
+        double latency;
+        double referenceMaxError;
+        double referenceRmsError;
+        double referenceLatency;
+    };
+
+    /// \brief The signal used to measure the accuracy of the Oversampler, which is a sum of sinusoids that spans
+    /// the passband. It can be evaluated between samples, so that it can be delayed by any amount.
+
+    static double signal(const double k, const double sampleRate)
+    {
+        double sample = 0.0;
+        for (const double frequency : {55.0, 440.0, 1760.0, 3520.0, 7040.0})
+            sample += 0.15 * std::sin(2.0 * M_PI * frequency * k / sampleRate);
+
+        return sample;
+    }
+
+    /// \brief A destination for computed samples, which prevents the compiler from discarding the work.
+
+    static volatile float sink = 0.F;
+
+    /// \brief Print the usage string to the given stream.
+
+    static void usage(std::ostream& stream)
+    {
+        stream << "Usage: asbench [options]\n"
+               << "  -r, --rate <Hz>        The sample rate to run each component at (default 48000)\n"
+               << "  -s, --seconds <s>      The duration of audio processed per repetition (default 2)\n"
+               << "  -n, --repeats <n>      The number of repetitions per benchmark (default 5)\n"
+               << "  -f, --filter <text>    Only run the benchmarks whose names contain the given text\n"
+               << "  -o, --output <path>    Write the JSON results to the given path instead of stdout\n"
+               << "      --song <path>      The song to render in the render benchmarks (default: a built-in pattern)\n"
+               << "      --sweep            Stress-test the render with host block sizes from 1 to 65536\n";
+    }
+
+    /// \brief Parse the command-line arguments into `options`.
+    /// \return `true` if the arguments are valid; `false` otherwise.
+
+    static bool parse(int argc, const char* argv[], Options& options)
+    {
+        for (int k = 1; k < argc; ++k)
+        {
+            const std::string argument = argv[k];
+            const bool hasValue = k + 1 < argc;
+
+            if      ((argument == "-r" || argument == "--rate")    && hasValue) options.sampleRate = std::atof(argv[++k]);
+            else if ((argument == "-s" || argument == "--seconds") && hasValue) options.seconds    = std::atof(argv[++k]);
+            else if ((argument == "-n" || argument == "--repeats") && hasValue) options.repeats    = std::atoi(argv[++k]);
+            else if ((argument == "-f" || argument == "--filter")  && hasValue) options.filter     = argv[++k];
+            else if ((argument == "-o" || argument == "--output")  && hasValue) options.output     = argv[++k];
+            else if  (argument == "--song" && hasValue) options.song = argv[++k];
+            else if  (argument == "--sweep") options.sweep = true;
+            else return false;
+        }
+
+        return options.sampleRate > 0.0 && options.seconds > 0.0 && options.repeats > 0;
+    }
+
+    /// \brief A counter of the level-1 data cache misses of the calling thread, which counts nothing where
+    /// `perf_event_open` is unavailable or not permitted.
+
+    class CacheMisses
+    {
+    public:
+        CacheMisses()
+        {
+        #ifdef __linux__
+            perf_event_attr attributes = {};
+            attributes.type   = PERF_TYPE_HW_CACHE;
+            attributes.size   = sizeof(attributes);
+            attributes.config = PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+            attributes.disabled = 1;
+            attributes.exclude_kernel = 1;
+            attributes.exclude_hv = 1;
+            descriptor = static_cast<int>(syscall(SYS_perf_event_open, &attributes, 0, -1, -1, 0));
+        #endif
+        }
+
+        ~CacheMisses()
+        {
+            if (descriptor >= 0) close(descriptor);
+        }
+
+        /// \brief Return `true` if the misses are being counted.
+
+        bool available() const { return descriptor >= 0; }
+
+        /// \brief Reset the count and begin counting.
+
+        void start()
+        {
+        #ifdef __linux__
+            if (!available()) return;
+            ioctl(descriptor, PERF_EVENT_IOC_RESET, 0);
+            ioctl(descriptor, PERF_EVENT_IOC_ENABLE, 0);
+        #endif
+        }
+
+        /// \brief Stop counting and return the count since `start`.
+
+        double stop()
+        {
+            uint64_t count = 0;
+        #ifdef __linux__
+            if (!available()) return 0.0;
+            ioctl(descriptor, PERF_EVENT_IOC_DISABLE, 0);
+            if (read(descriptor, &count, sizeof(count)) != sizeof(count)) count = 0;
+        #endif
+            return static_cast<double>(count);
+        }
+
+    private:
+        int descriptor = -1;
+    };
+
+    /// \brief Measure the given kernel, which must process the given number of samples each time it is called.
+    /// \param kernel A callable that processes `samples` samples
+    /// \param samples The number of samples processed by each call to `kernel`
+    /// \param repeats The number of times the measurement should be repeated
+
+    template <typename Kernel>
+    static Result measure(const std::string& name, Kernel&& kernel, const uint64_t samples, const int repeats)
+    {
+        std::vector<double> times, misses;
+        times.reserve(repeats);
+        misses.reserve(repeats);
+
+        CacheMisses counter;
+        kernel();
+
+        for (int r = 0; r < repeats; ++r)
+        {
+            counter.start();
+            const auto start = Time::now();
+            kernel();
+            const auto elapsed = std::chrono::duration<double, std::nano>(Time::now() - start).count();
+            times.push_back(elapsed / static_cast<double>(samples));
+            misses.push_back(counter.stop() / static_cast<double>(samples));
+        }
+
+        std::sort(times.begin(), times.end());
+        std::sort(misses.begin(), misses.end());
+
+        const double miss = counter.available() ? misses[misses.size() / 2] : std::nan("");
+        return {name, samples, times[times.size() / 2], times.front(), miss};
+    }
+
+    /// \brief Load a short pattern that keeps every VoiceBank busy, for when no song is given.
+
+    static void loadDefaultPattern(ASCommanderCore& core)
+    {
+        const int notes[] = {48, 55, 60, 63, 67, 70, 72, 75};
+
+        for (int y = 0; y < SEQUENCER_HEIGHT; ++y)
+        for (int x = 0; x < 4; ++x)
+            core.writeNote(x, y, notes[(x + y) % 8], (x + y) % OSCILLATORS);
+
+        core.set(kClockBPM, 140.F);
+        core.set(kStereoDelayToggle, 1.F);
+        core.set(kVibratoToggle, 1.F);
+        core.flush();
+    }
+
+    /// \brief Render the given number of samples in blocks of `blockSize` samples, and check that every sample
+    /// is finite and that nothing was written past the end of the output.
+    /// \return The result of the measurement, or `false` if the render failed either check.
+
+    static bool sweep(const Options& options, const unsigned int blockSize, const uint64_t samples, Result& result)
+    {
+        constexpr float sentinel = 12345.F;
+        constexpr size_t guard = 64;
+
+        auto core = std::make_unique<ASCommanderCore>();
+        core->init(options.sampleRate);
+
+        if (options.song.empty()) loadDefaultPattern(*core);
+        else if (!Song::load(options.song, *core)) return false;
+
+        std::vector<float> left (samples + guard, sentinel);
+        std::vector<float> right(samples + guard, sentinel);
+
+        core->playOrPause();
+
+        const std::string name = "ASCommanderCore::render sweep (" + std::to_string(blockSize) + ")";
+        result = measure(name, [&] {
+            for (uint64_t t = 0; t < samples; t += blockSize)
+            {
+                const auto block = static_cast<unsigned int>(std::min<uint64_t>(blockSize, samples - t));
+                float* output[2] = { left.data() + t, right.data() + t };
+                core->render(2, block, output);
+            }
+        }, samples, 1);
+
+        const auto finite = [] (const float sample) { return std::isfinite(sample); };
+        const auto intact = [] (const float sample) { return sample == sentinel; };
+
+        return std::all_of(left .begin(), left .begin() + samples, finite)
+            && std::all_of(right.begin(), right.begin() + samples, finite)
+            && std::all_of(left .begin() + samples, left .end(), intact)
+            && std::all_of(right.begin() + samples, right.end(), intact);
+    }
+
+    /// \brief The double-precision cascade of r8brain halfband stages that preceded the single-precision
+    /// `Oversampler`. It is kept as the reference for the Oversampler's accuracy and speed.
+
+    class HalfbandCascade
+    {
+    public:
+        HalfbandCascade(const int factor, const int steepness, const double attenuation, const int capacity)
+        {
+            int stages = 0;
+            while ((2 << stages) <= factor) stages = stages + 1;
+
+            for (int s = 0; s < stages; ++s)
+                upsamplers.emplace_back(new r8b::CDSPHBUpsampler(attenuation, std::min(steepness + s, 6), false, 0.0));
+
+            for (int s = stages - 1; s >= 0; --s)
+                downsamplers.emplace_back(new r8b::CDSPHBDownsampler(attenuation, std::min(steepness + s, 6), false, 0.0));
+
+            gain = 1.0 / static_cast<double>(factor);
+            buffers[0].assign(std::max(capacity, priming) * factor + 64, 0.0);
+            buffers[1].assign(std::max(capacity, priming) * factor + 64, 0.0);
+
+            /// Priming the stages with silence fills their lookahead, after which
+            /// the number of samples produced by each call is fixed.
+
+            std::vector<double> silence(priming * factor, 0.0);
+            double* output;
+            upsample(silence.data(), priming, output);
+            downsample(silence.data(), priming * factor, output);
+        }
+
+        int upsample(double* input, const int samples, double*& output)
+        {
+            return cascade(upsamplers, input, samples, output);
+        }
+
+        int downsample(double* input, const int samples, double*& output)
+        {
+            const int count = cascade(downsamplers, input, samples, output);
+            for (int k = 0; k < count; ++k)
+                output[k] = output[k] * gain;
+
+            return count;
+        }
+
+    private:
+        template <typename Stages>
+        int cascade(Stages& stages, double* input, int count, double*& output)
+        {
+            output = input;
+            for (auto& stage : stages)
+            {
+                double* target = output == buffers[0].data() ? buffers[1].data() : buffers[0].data();
+                count  = stage->process(output, count, target);
+                output = target;
+            }
+
+            return count;
+        }
+
+    private:
+        std::vector<std::unique_ptr<r8b::CDSPHBUpsampler>>   upsamplers;
+        std::vector<std::unique_ptr<r8b::CDSPHBDownsampler>> downsamplers;
+        std::array<std::vector<double>, 2> buffers;
+        double gain;
+
+        constexpr static int priming = 64;
+    };
+
+    /// \brief Return the largest and the RMS difference, in decibels relative to full scale, between the given
+    /// output and the test signal delayed by `offset` and whichever multiple of `1 / factor` samples matches it most closely.
+
+    template <typename Sample>
+    static std::array<double, 3> error(const std::vector<Sample>& output, const int factor, const double sampleRate,
+                                       const double offset = 0.0)
+    {
+        constexpr int skip = 1024;
+        const int length = static_cast<int>(output.size());
+
+        std::array<double, 3> best = {1.0, 1.0, 0.0};
+        for (int step = 0; step < 64 * factor; ++step)
+        {
+            const double delay = offset + static_cast<double>(step) / factor;
+
+            double peak = 0.0, sum = 0.0;
+            for (int k = skip; k < length && peak < best[0]; ++k)
+            {
+                const double difference = std::abs(static_cast<double>(output[k]) - signal(k - delay, sampleRate));
+                peak = std::max(peak, difference);
+                sum += difference * difference;
+            }
+
+            if (peak < best[0])
+                best = {peak, std::sqrt(sum / static_cast<double>(length - skip)), delay};
+        }
+
+        return {20.0 * std::log10(best[0]), 20.0 * std::log10(best[1]), best[2]};
+    }
+
+    /// \brief Set a parameter of the given StereoDelay as `ASCommanderCore` does, such that its buffer is reserved first.
+
+    static void configure(StereoDelay& delay, const uint64_t parameter, const float value)
+    {
+        delay.prepare(parameter, value);
+        delay.set(parameter, value);
+    }
+
+    /// \brief Pass the test signal through a StereoDelay at the base rate, and through a StereoDelay between two
+    /// Oversamplers, as in `ASCommanderCore`, and compare the left channel of each output to the test signal delayed by
+    /// the delay time and the latency of the path. The delay time is not a whole number of samples, and the StereoDelays
+    /// are neither modulated nor fed back, so that the ideal output is known. The latency of each output is reported
+    /// relative to the delay time.
+
+    static Accuracy compareDelay(const std::string& name, const double sampleRate)
+    {
+        constexpr int length     = 1 << 14;
+        constexpr int resolution = 64;
+
+        Clock clock = {110};
+        clock.setSampleRate(static_cast<float>(sampleRate));
+
+        StereoDelay base(&clock, 1);
+        StereoDelay oversampled(&clock, OVERSAMPLING);
+        for (StereoDelay* delay : {&base, &oversampled})
+        {
+            configure(*delay, kStereoDelayToggle, 1.F);
+            configure(*delay, kDelayMix, 1.F);
+            configure(*delay, kDelayFeedback, 0.F);
+            configure(*delay, kDelayMusicalTime, 8.F);
+            delay->adopt();
+        }
+
+        std::array<Oversampler, 2> oversamplers;
+        for (auto& oversampler : oversamplers)
+            oversampler.configure(OVERSAMPLING, OVERSAMPLING_STEEPNESS, OVERSAMPLING_ATTENUATION, BLOCK_SIZE);
+
+        /// The delay time glides to its target for 2 seconds after the StereoDelays are constructed.
+
+        const int settle = static_cast<int>(3.0 * sampleRate) / BLOCK_SIZE * BLOCK_SIZE;
+        const double time = sampleRate * 60.0 / 110.0 * fDelaySixteenthNote;
+
+        std::vector<float> direct(length), resampled(length);
+        std::vector<float> samples(BLOCK_SIZE * OVERSAMPLING), left(BLOCK_SIZE), right(BLOCK_SIZE * OVERSAMPLING);
+
+        for (int t = 0; t < settle + length; t += BLOCK_SIZE)
+        {
+            for (int k = 0; k < BLOCK_SIZE; ++k)
+                samples[k] = static_cast<float>(signal(t + k, sampleRate));
+
+            std::copy(samples.begin(), samples.begin() + BLOCK_SIZE, left.begin());
+            std::copy(samples.begin(), samples.begin() + BLOCK_SIZE, right.begin());
+            base.process(left.data(), right.data(), BLOCK_SIZE);
+            if (t >= settle) std::copy(left.begin(), left.end(), direct.begin() + t - settle);
+
+            const int count = oversamplers[0].upsample(samples.data(), BLOCK_SIZE);
+            std::copy(samples.begin(), samples.begin() + count, right.begin());
+            oversampled.process(samples.data(), right.data(), count);
+
+            oversamplers[1].downsample(samples.data(), count);
+            if (t >= settle) std::copy(samples.begin(), samples.begin() + BLOCK_SIZE, resampled.begin() + t - settle);
+        }
+
+        const double offset = time - 1.0 - settle;
+        const auto [maxError, rmsError, latency] = error(direct, resolution, sampleRate, offset);
+        const auto [referenceMaxError, referenceRmsError, referenceLatency] = error(resampled, resolution, sampleRate, offset);
+        return {name, maxError, rmsError, latency - offset - 1.0, referenceMaxError, referenceRmsError, referenceLatency - offset - 1.0};
+    }
+
+    /// \brief Pass a test signal through the given Oversampler and through the double-precision reference, and
+    /// compare each output to the ideal output, which is the test signal delayed by the latency of the path.
+
+    static Accuracy compare(const std::string& name, const int factor, const int steepness, const double sampleRate)
+    {
+        constexpr int length = 1 << 14;
+
+        Oversampler oversampler;
+        oversampler.configure(factor, steepness, OVERSAMPLING_ATTENUATION, BLOCK_SIZE);
+        HalfbandCascade reference(factor, steepness, OVERSAMPLING_ATTENUATION, BLOCK_SIZE);
+
+        std::vector<double> input(length);
+        for (int k = 0; k < length; ++k)
+            input[k] = signal(k, sampleRate);
+
+        std::vector<float>  single(length);
+        std::vector<double> precise(length);
+        std::vector<float>  samples(BLOCK_SIZE * factor);
+
+        for (int t = 0; t < length; t += BLOCK_SIZE)
+        {
+            std::copy(input.begin() + t, input.begin() + t + BLOCK_SIZE, samples.begin());
+            const int oversampled = oversampler.upsample(samples.data(), BLOCK_SIZE);
+            oversampler.downsample(samples.data(), oversampled);
+            std::copy(samples.begin(), samples.begin() + BLOCK_SIZE, single.begin() + t);
+
+            double* output;
+            const int upsampled = reference.upsample(input.data() + t, BLOCK_SIZE, output);
+            const int count = reference.downsample(output, upsampled, output);
+            std::copy(output, output + count, precise.begin() + t);
+        }
+
+        const auto [maxError, rmsError, latency] = error(single, factor, sampleRate);
+        const auto [referenceMaxError, referenceRmsError, referenceLatency] = error(precise, factor, sampleRate);
+        return {name, maxError, rmsError, latency, referenceMaxError, referenceRmsError, referenceLatency};
+    }
+
+    /// \brief Render one Voice of the given oscillators at the given frequency, and return the largest alias, relative
+    /// to the fundamental, and the power of every alias, relative to the power of the signal, in decibels. The spectrum
+    /// is computed with a Blackman-Harris window, and every bin below 20kHz that is more than `guard` bins from a
+    /// harmonic below the Nyquist frequency is an audible alias.
+
+    template <typename Oscillators>
+    static std::array<double, 2> aliasing(const float frequency, const float sampleRate)
+    {
+        using namespace Assemble;
+        constexpr int bits   = 16;
+        constexpr int length = 1 << bits;
+        constexpr int guard  = 6;
+
+        Oscillators source;
+        source.setSampleRate(sampleRate);
+        std::array<typename Oscillators::Voice, SIMD::width> voices;
+        source.select(voices[0], frequency);
+
+        SIMD::Bits position  = {};
+        SIMD::Bits increment = {};
+        SIMD::set(increment, 0, Utilities::increment(frequency, sampleRate));
+
+        const typename Oscillators::Group oscillator(voices.data(), increment, false);
+
+        std::vector<double> spectrum(length);
+        for (int k = 0; k < length; ++k)
+        {
+            const double x = 2.0 * PI * k / length;
+            const double window = 0.35875 - 0.48829 * std::cos(x) + 0.14128 * std::cos(2.0 * x) - 0.01168 * std::cos(3.0 * x);
+            spectrum[k] = window * SIMD::lane(oscillator.template sample<false>(position), 0);
+            position = position + increment;
+        }
+
+        r8b::CDSPRealFFTKeeper fft(bits);
+        fft->forward(spectrum.data());
+
+        const double resolution = sampleRate / length;
+        const int fundamental = static_cast<int>(std::round(frequency / resolution));
+
+        double total = 0.0, aliases = 0.0, largest = 0.0, reference = 0.0;
+        const int audible = std::min(length / 2, static_cast<int>(20E3 / resolution));
+        for (int k = 1; k < audible; ++k)
+        {
+            const double power = spectrum[2 * k] * spectrum[2 * k] + spectrum[2 * k + 1] * spectrum[2 * k + 1];
+            const double harmonic = std::round(k * resolution / frequency) * frequency;
+            const bool   alias = harmonic < 1.0 || harmonic >= sampleRate * 0.5 || std::abs(k - harmonic / resolution) > guard;
+
+            total = total + power;
+            if (std::abs(k - fundamental) <= guard) reference = std::max(reference, power);
+            if (!alias) continue;
+
+            aliases = aliases + power;
+            largest = std::max(largest, power);
+        }
+
+        return {10.0 * std::log10(std::max(largest / reference, 1E-20)),
+                10.0 * std::log10(std::max(aliases / total, 1E-20))};
+    }
+
+    /// \brief Return the given ratio in decibels. A ratio of 0 is reported as -200 dB.
+
+    static double decibels(const double ratio)
+    {
+        return 20.0 * std::log10(std::max(ratio, 1E-10));
+    }
+
+    /// \brief Pass the test signal through the round trip of the given Oversampler, as on the oversampled path of
+    /// `ASCommanderCore`, and through a delay of the Oversampler's `latency`, as on its direct path. The round trip is
+    /// delayed by a whole number of samples by construction, so the two paths are aligned, and the residual between
+    /// them, which is heard while they are crossfaded, is the passband error of the Oversampler. The residual is
+    /// reported with the latency of the oversampled path, and the error of the direct path is reported as the reference.
+
+    static Accuracy compareDirect(const std::string& name, const int factor, const int steepness, const double sampleRate)
+    {
+        constexpr int length = 1 << 14;
+        constexpr int skip   = 1024;
+
+        Oversampler oversampler;
+        oversampler.configure(factor, steepness, OVERSAMPLING_ATTENUATION, BLOCK_SIZE);
+        const int latency = oversampler.latency();
+
+        std::vector<float> oversampled(length), direct(length);
+        std::vector<float> samples(BLOCK_SIZE * factor);
+
+        for (int t = 0; t < length; t += BLOCK_SIZE)
+        {
+            for (int k = 0; k < BLOCK_SIZE; ++k)
+                samples[k] = static_cast<float>(signal(t + k, sampleRate));
+
+            const int count = oversampler.upsample(samples.data(), BLOCK_SIZE);
+            oversampler.downsample(samples.data(), count);
+            std::copy(samples.begin(), samples.begin() + BLOCK_SIZE, oversampled.begin() + t);
+        }
+
+        for (int k = latency; k < length; ++k)
+            direct[k] = static_cast<float>(signal(k - latency, sampleRate));
+
+        double peak = 0.0, sum = 0.0;
+        for (int k = skip; k < length; ++k)
+        {
+            const double residual = static_cast<double>(oversampled[k]) - static_cast<double>(direct[k]);
+            peak = std::max(peak, std::abs(residual));
+            sum += residual * residual;
+        }
+
+        const double measured = error(oversampled, factor, sampleRate)[2];
+        const auto [directMaxError, directRmsError, directLatency] = error(direct, factor, sampleRate);
+        return {name, decibels(peak), decibels(std::sqrt(sum / static_cast<double>(length - skip))), measured,
+                directMaxError, directRmsError, directLatency};
+    }
+
+    /// \brief Pass white noise through `SIMD::width` HuovilainenFilters, each with its own cutoff and resonance,
+    /// and through the lanes of a HuovilainenLadder with the same coefficients, using the vectorised nonlinearity
+    /// and, as the reference, the exact nonlinearity. The errors are relative to the peak of the filters' output.
+    /// \param drive The amplitude of the noise. The filters of the Voices, whose amplitude is about 1, do not saturate.
+
+    static Accuracy compareLadder(const std::string& name, const float drive, const float sampleRate)
+    {
+        using namespace Assemble;
+        using Lanes = SIMD::Lanes;
+        constexpr int width  = SIMD::width;
+        constexpr int length = 1 << 14;
+
+        std::vector<std::unique_ptr<HuovilainenFilter>> filters;
+        Lanes G, resonanceFour;
+
+        for (int l = 0; l < width; ++l)
+        {
+            const float cutoff    = 0.4F + 0.6F * static_cast<float>(l) / width;
+            const float resonance = static_cast<float>(l + 1) / width;
+
+            filters.push_back(std::make_unique<HuovilainenFilter>(nullptr));
+            filters[l]->setSampleRate(sampleRate);
+            filters[l]->set(static_cast<uint64_t>(kFrequencyType), cutoff);
+            filters[l]->set(static_cast<uint64_t>(kResonanceType), resonance);
+
+            float g, a, r;
+            const float frequency = std::exp(LN100 + cutoff * (LN20E3 - LN100));
+            HuovilainenFilter::coefficients(frequency, resonance, sampleRate, g, a, r);
+            SIMD::set(G, l, g);
+            SIMD::set(resonanceFour, l, r);
+        }
+
+        WhiteNoise noise;
+        HuovilainenLadder vectorised, exact;
+
+        double peak = 0.0;
+        std::array<double, 2> largest = {0.0, 0.0};
+        std::array<double, 2> sum = {0.0, 0.0};
+
+        for (int k = 0; k < length; ++k)
+        {
+            Lanes input;
+            for (int l = 0; l < width; ++l)
+                SIMD::set(input, l, drive * noise.nextSample());
+
+            const Lanes approximate = vectorised.process<false>(input, G, resonanceFour);
+            const Lanes precise = exact.process<true>(input, G, resonanceFour);
+
+            for (int l = 0; l < width; ++l)
+            {
+                const double reference = filters[l]->process(SIMD::lane(input, l));
+                const std::array<double, 2> difference = {
+                    std::abs(SIMD::lane(approximate, l) - reference),
+                    std::abs(SIMD::lane(precise, l) - reference)
+                };
+
+                peak = std::max(peak, std::abs(reference));
+                for (int m = 0; m < 2; ++m)
+                {
+                    largest[m] = std::max(largest[m], difference[m]);
+                    sum[m] += difference[m] * difference[m];
+                }
+            }
+        }
+
+        const double count = static_cast<double>(length * width);
+        return {name, decibels(largest[0] / peak), decibels(std::sqrt(sum[0] / count) / peak), 0.0,
+                      decibels(largest[1] / peak), decibels(std::sqrt(sum[1] / count) / peak), 0.0};
+    }
+
+    /// \brief Write the results to the given stream as JSON.
+
+    static void write(std::ostream& stream, const Options& options, const std::vector<Result>& results,
+                      const std::vector<Accuracy>& accuracy)
+    {
+        char line[512];
+        char misses[32];
+
+        size_t wavetableBytes = 0;
+        for (const WaveTableType type : {SIN, SQR, TRI, SAW})
+            wavetableBytes += WaveTableBuilder::standard(type).bytes();
+
+        stream << "{\n";
+        stream << "  \"configuration\": \"" <<
+        #ifdef LIGHT
+            "Assemble Light"
+        #else
+            "Assemble"
+        #endif
+               << "\",\n";
+        stream << "  \"sampleRate\": " << options.sampleRate << ",\n";
+        stream << "  \"oversampling\": " << OVERSAMPLING << ",\n";
+        stream << "  \"polyphony\": " << POLYPHONY << ",\n";
+        stream << "  \"blockSize\": " << BLOCK_SIZE << ",\n";
+        stream << "  \"repeats\": " << options.repeats << ",\n";
+        stream << "  \"wavetableFormat\": \"" << (WaveTableSet::compact ? "int16" : "float") << "\",\n";
+        stream << "  \"wavetableBytes\": " << wavetableBytes << ",\n";
+        stream << "  \"results\": [\n";
+
+        for (size_t k = 0; k < results.size(); ++k)
+        {
+            const Result& result = results[k];
+            if (std::isnan(result.misses)) std::snprintf(misses, sizeof(misses), "null");
+            else std::snprintf(misses, sizeof(misses), "%.4f", result.misses);
+
+            std::snprintf(line, sizeof(line),
+                          "    {\"name\": \"%s\", \"samples\": %llu, \"nsPerSample\": %.3f, "
+                          "\"bestNsPerSample\": %.3f, \"samplesPerSecond\": %.0f, \"l1dMissesPerSample\": %s}%s\n",
+                          result.name.c_str(), static_cast<unsigned long long>(result.samples),
+                          result.median, result.best, 1E9 / result.median, misses, k + 1 < results.size() ? "," : "");
+            stream << line;
+        }
+
+        stream << "  ],\n";
+        stream << "  \"accuracy\": [\n";
+
+        for (size_t k = 0; k < accuracy.size(); ++k)
+        {
+            const Accuracy& result = accuracy[k];
+            std::snprintf(line, sizeof(line),
+                          "    {\"name\": \"%s\", \"maxErrorDb\": %.1f, \"rmsErrorDb\": %.1f, \"latency\": %.4g, "
+                          "\"referenceMaxErrorDb\": %.1f, \"referenceRmsErrorDb\": %.1f, \"referenceLatency\": %.4g}%s\n",
+                          result.name.c_str(), result.maxError, result.rmsError, result.latency,
+                          result.referenceMaxError, result.referenceRmsError, result.referenceLatency,
+                          k + 1 < accuracy.size() ? "," : "");
+            stream << line;
+        }
+
+        stream << "  ]\n}\n";
+    }
+}
+
+int main(int argc, const char* argv[])
+{
+    using namespace Benchmarks;
+
+    Options options;
+    if (!parse(argc, argv, options))
+    {
+        usage(std::cerr);
+        return 1;
+    }
+
+    /// The core reports its state on stdout, so the JSON is written to a duplicate of stdout,
+    /// and stdout itself is redirected to stderr while the benchmarks run.
+
+    const int json = dup(STDOUT_FILENO);
+    dup2(STDERR_FILENO, STDOUT_FILENO);
+
+    const float sampleRate = static_cast<float>(options.sampleRate);
+    const auto  samples    = static_cast<uint64_t>(options.seconds * options.sampleRate);
+    const int   repeats    = options.repeats;
+
+    std::vector<Result> results;
+    std::vector<Accuracy> accuracy;
+    std::vector<float>  buffer(BLOCK_SIZE);
+
+    /// Block sizes of one sample, of each power of two, and of a few sizes either side of `BLOCK_SIZE`
+    /// and its multiples are rendered, since they split the host's blocks in different ways.
+
+    if (options.sweep)
+    {
+        std::vector<unsigned int> blockSizes = {3, 5, 7, 13, 100, 1000, 4095, 4097, 44100, 65535};
+        for (unsigned int blockSize = 1; blockSize <= 65536; blockSize *= 2) blockSizes.push_back(blockSize);
+        for (unsigned int blockSize : {BLOCK_SIZE - 1, BLOCK_SIZE + 1, 3 * BLOCK_SIZE - 1, 3 * BLOCK_SIZE + 1})
+            if (blockSize > 0) blockSizes.push_back(blockSize);
+
+        std::sort(blockSizes.begin(), blockSizes.end());
+        blockSizes.erase(std::unique(blockSizes.begin(), blockSizes.end()), blockSizes.end());
+
+        for (unsigned int blockSize : blockSizes)
+        {
+            Result result;
+            if (!sweep(options, blockSize, std::max<uint64_t>(samples, 65536), result))
+            {
+                std::cerr << "[asbench] The render failed with a block size of " << blockSize << " samples\n";
+                return 1;
+            }
+
+            results.push_back(result);
+        }
+    }
+
+    const auto selected = [&options] (const std::string& name) {
+        if (options.sweep) return false;
+        return options.filter.empty() || name.find(options.filter) != std::string::npos;
+    };
+
+    /// Components are processed in chunks of `BLOCK_SIZE` samples. Envelopes and Voices are
+    /// retriggered at the beginning of each chunk, so that they never close during a measurement.
+
+    const auto chunked = [samples] (auto&& chunk) {
+        for (uint64_t t = 0; t < samples; t += BLOCK_SIZE)
+            chunk(static_cast<int>(std::min<uint64_t>(BLOCK_SIZE, samples - t)));
+    };
+
+    if (selected("BandlimitedOscillator<SAW>::nextSample"))
+    {
+        BandlimitedOscillator<SAW> oscillator;
+        oscillator.setSampleRate(sampleRate);
+        oscillator.load(220.F);
+
+        results.push_back(measure("BandlimitedOscillator<SAW>::nextSample", [&] {
+            float sum = 0.F;
+            for (uint64_t k = 0; k < samples; ++k)
+                sum += oscillator.nextSample();
+            sink = sum;
+        }, samples, repeats));
+    }
+
+    if (selected("BandlimitedOscillator<SAW>::process"))
+    {
+        BandlimitedOscillator<SAW> oscillator;
+        oscillator.setSampleRate(sampleRate);
+        oscillator.load(220.F);
+
+        results.push_back(measure("BandlimitedOscillator<SAW>::process", [&] {
+            chunked([&] (const int n) { oscillator.process(buffer.data(), n); });
+            sink = buffer[0];
+        }, samples, repeats));
+    }
+
+    if (selected("FixedPointOscillator<SAW>::nextSample"))
+    {
+        FixedPointOscillator<SAW> oscillator;
+        oscillator.setSampleRate(sampleRate);
+        oscillator.load(220.F);
+
+        results.push_back(measure("FixedPointOscillator<SAW>::nextSample", [&] {
+            float sum = 0.F;
+            for (uint64_t k = 0; k < samples; ++k)
+                sum += oscillator.nextSample();
+            sink = sum;
+        }, samples, repeats));
+    }
+
+    if (selected("FixedPointOscillator<SAW>::process"))
+    {
+        FixedPointOscillator<SAW> oscillator;
+        oscillator.setSampleRate(sampleRate);
+        oscillator.load(220.F);
+
+        results.push_back(measure("FixedPointOscillator<SAW>::process", [&] {
+            chunked([&] (const int n) { oscillator.process(buffer.data(), n); });
+            sink = buffer[0];
+        }, samples, repeats));
+    }
+
+    /// The phase of each oscillator after ten minutes at several frequencies is compared with the exact phase,
+    /// in cycles. The fixed-point phase may only drift by the rounding of its increment, which is half of 2^-32
+    /// cycles per sample, whereas the floating-point phase accumulates the rounding of each addition.
+
+    if (selected("Oscillator phase drift (10 minutes)"))
+    {
+        const uint64_t length = static_cast<uint64_t>(600.0 * sampleRate);
+        const double bound = static_cast<double>(length) * 0.5 / 4294967296.0 + 1E-9;
+
+        const auto drift = [&] (Oscillator& oscillator, const float frequency) {
+            oscillator.setSampleRate(sampleRate);
+            oscillator.load(frequency);
+
+            const double start = oscillator.position();
+            for (uint64_t t = 0; t < length; t += BLOCK_SIZE)
+                oscillator.process(buffer.data(), static_cast<int>(std::min<uint64_t>(BLOCK_SIZE, length - t)));
+
+            const double cycles = static_cast<double>(frequency) / sampleRate * static_cast<double>(length);
+            const double error  = std::abs(std::remainder(oscillator.position() - start - cycles, 1.0));
+            return error;
+        };
+
+        double fixed = 0.0, floating = 0.0;
+        for (const float frequency : {27.5F, 440.F, 4186.F})
+        {
+            FixedPointOscillator<SAW>  fixedPoint;
+            BandlimitedOscillator<SAW> floatingPoint;
+            fixed    = std::max(fixed, drift(fixedPoint, frequency));
+            floating = std::max(floating, drift(floatingPoint, frequency));
+        }
+
+        if (fixed > bound)
+        {
+            std::cerr << "[asbench] The FixedPointOscillator's phase drifted by " << fixed << " cycles\n";
+            return 1;
+        }
+
+        accuracy.push_back({"Oscillator phase drift (10 minutes)", decibels(fixed), decibels(fixed), 0.0,
+                                                                   decibels(floating), decibels(floating), 0.0});
+    }
+
+    if (selected("WhiteNoise::process"))
+    {
+        WhiteNoise noise(1);
+
+        results.push_back(measure("WhiteNoise::process", [&] {
+            chunked([&] (const int n) { noise.process(buffer.data(), n); });
+            sink = buffer[0];
+        }, samples, repeats));
+    }
+
+    if (selected("Voice::nextSample") || selected("Voice::process"))
+    {
+        BandlimitedOscillator<SAW> oscillator;
+        std::vector<float> scratch(BLOCK_SIZE);
+
+        Voice voice;
+        voice.assign(&oscillator);
+        voice.setSampleRate(sampleRate);
+        voice.set(kNoiseType, 0.5F);
+
+        if (selected("Voice::nextSample"))
+        results.push_back(measure("Voice::nextSample", [&] {
+            float sum = 0.F;
+            chunked([&] (const int n) {
+                voice.load(220.F);
+                for (int k = 0; k < n; ++k)
+                    sum += voice.nextSample();
+            });
+            sink = sum;
+        }, samples, repeats));
+
+        if (selected("Voice::process"))
+        results.push_back(measure("Voice::process", [&] {
+            chunked([&] (const int n) {
+                voice.load(220.F);
+                voice.process(buffer.data(), scratch.data(), n);
+            });
+            sink = buffer[0];
+        }, samples, repeats));
+    }
+
+    /// A VoiceBank is measured with no Voices active, with one, and with all of them. Its polyphony limits the
+    /// number of Voices that are loaded, and each Voice is reloaded before its envelope can close.
+
+    for (const int count : {0, 1, POLYPHONY})
+    {
+        const std::string name = "VoiceBank<SAW>::process (" + std::to_string(count) + " of " +
+                                 std::to_string(POLYPHONY) + " Voices active)";
+
+        if (!selected(name)) continue;
+
+        auto bank = std::make_unique<VoiceBank<WaveTables<SAW>, POLYPHONY>>();
+        bank->setSampleRate(sampleRate);
+        bank->set(kSawBankPolyphony, static_cast<float>(std::max(count, 1)));
+
+        results.push_back(measure(name, [&] {
+            chunked([&] (const int n) {
+                for (int v = 0; v < count; ++v)
+                    bank->load(110.F * static_cast<float>(v + 1));
+                bank->process(buffer.data(), n);
+            });
+            sink = buffer[0];
+        }, samples, repeats));
+    }
+
+    /// The same VoiceBank with every Voice active, whose wavetables are crossfaded between adjacent levels.
+
+    if (selected("VoiceBank<SAW>::process (crossfaded)"))
+    {
+        auto bank = std::make_unique<VoiceBank<WaveTables<SAW>, POLYPHONY>>();
+        bank->setSampleRate(sampleRate);
+        bank->setCrossfade(true);
+        bank->set(kSawBankPolyphony, static_cast<float>(POLYPHONY));
+
+        results.push_back(measure("VoiceBank<SAW>::process (crossfaded)", [&] {
+            chunked([&] (const int n) {
+                for (int v = 0; v < POLYPHONY; ++v)
+                    bank->load(110.F * static_cast<float>(v + 1));
+                bank->process(buffer.data(), n);
+            });
+            sink = buffer[0];
+        }, samples, repeats));
+    }
+
+    /// The wavetables selected for every MIDI note at common sample rates, and the wavetables they are crossfaded
+    /// with, must keep their highest harmonic below two thirds of the sample rate.
+
+    if (selected("WaveTableSelector bounds"))
+    {
+        const WaveTableSet& set = WaveTableBuilder::standard(SAW);
+        for (const float rate : {22050.F, 44100.F, 48000.F, 96000.F, 192000.F})
+        {
+            const WaveTableSelector selector(set, rate);
+            for (const float frequency : frequencies)
+            {
+                const auto& selection = selector.select(frequency);
+                const bool safe = selection.level == set.levels() - 1 ||
+                                  set.harmonics(selection.level) * frequency <= rate * 2.F / 3.F;
+
+                if (!safe || selection.next < selection.level || selection.blend < 0.F || selection.blend > 1.F)
+                {
+                    std::cerr << "[asbench] The wavetable selected for " << frequency << "Hz at " << rate << "Hz aliases\n";
+                    return 1;
+                }
+            }
+        }
+    }
+
+    /// The wavetables of two engines at different sample rates must each be selected for their own rate,
+    /// whichever sample rate was set last.
+
+    if (selected("WaveTableSelector independence"))
+    {
+        WaveTables<SAW> low, high;
+        WaveTables<SAW>::Voice lower, higher;
+        low.setSampleRate(22050.F);
+        high.setSampleRate(192000.F);
+        low.select(lower, 2000.F);
+        high.select(higher, 2000.F);
+
+        if (lower.table() == higher.table())
+        {
+            std::cerr << "[asbench] Engines at different sample rates selected the same wavetable\n";
+            return 1;
+        }
+    }
+
+    /// The same VoiceBank with analytic oscillators rather than wavetables.
+
+    if (selected("VoiceBank<PolyBLEP<SAW>>::process (8 of 8 Voices active)"))
+    {
+        auto bank = std::make_unique<VoiceBank<PolyBLEP<SAW>, POLYPHONY>>();
+        bank->setSampleRate(sampleRate);
+        bank->set(kSawBankPolyphony, static_cast<float>(POLYPHONY));
+
+        results.push_back(measure("VoiceBank<PolyBLEP<SAW>>::process (8 of 8 Voices active)", [&] {
+            chunked([&] (const int n) {
+                for (int v = 0; v < POLYPHONY; ++v)
+                    bank->load(110.F * static_cast<float>(v + 1));
+                bank->process(buffer.data(), n);
+            });
+            sink = buffer[0];
+        }, samples, repeats));
+    }
+
+    /// The oscillators alone are measured per sample of `SIMD::width` Voices, each at a different pitch.
+
+    const auto oscillators = [&] (const std::string& name, auto source) {
+        using Oscillators = decltype(source);
+        using namespace Assemble;
+
+        source.setSampleRate(sampleRate);
+        std::array<typename Oscillators::Voice, SIMD::width> voices;
+        SIMD::Bits position = {}, increment = {};
+        for (int l = 0; l < SIMD::width; ++l)
+        {
+            const float frequency = 55.F * static_cast<float>(1 << l);
+            source.select(voices[l], frequency);
+            SIMD::set(increment, l, Utilities::increment(frequency, sampleRate));
+        }
+
+        const typename Oscillators::Group group(voices.data(), increment, false);
+
+        results.push_back(measure(name, [&] {
+            SIMD::Lanes sum = {};
+            for (uint64_t k = 0; k < samples; ++k)
+            {
+                sum = sum + group.template sample<false>(position);
+                position = position + increment;
+            }
+            sink = SIMD::lane(sum, 0);
+        }, samples, repeats));
+    };
+
+    const std::string lanes = " (" + std::to_string(Assemble::SIMD::width) + " lanes)";
+    if (selected("WaveTables<SAW>::Group::sample" + lanes)) oscillators("WaveTables<SAW>::Group::sample" + lanes, WaveTables<SAW>());
+    if (selected("PolyBLEP<SAW>::Group::sample" + lanes))   oscillators("PolyBLEP<SAW>::Group::sample" + lanes, PolyBLEP<SAW>());
+
+    /// The aliasing of each analytic oscillator is compared with that of the wavetables, which are the reference,
+    /// at a high note, where the analytic oscillators alias the most.
+
+    for (const WaveTableType type : {SAW, SQR, TRI})
+    {
+        const char* shape = type == SAW ? "SAW" : type == SQR ? "SQR" : "TRI";
+        const std::string name = std::string("PolyBLEP<") + shape + "> aliasing (2489Hz)";
+        if (!selected(name)) continue;
+
+        constexpr float frequency = 2489.02F;
+        std::array<double, 2> analytic, tables;
+        switch (type)
+        {
+            case SAW: analytic = aliasing<PolyBLEP<SAW>>(frequency, sampleRate); tables = aliasing<WaveTables<SAW>>(frequency, sampleRate); break;
+            case SQR: analytic = aliasing<PolyBLEP<SQR>>(frequency, sampleRate); tables = aliasing<WaveTables<SQR>>(frequency, sampleRate); break;
+            default:  analytic = aliasing<PolyBLEP<TRI>>(frequency, sampleRate); tables = aliasing<WaveTables<TRI>>(frequency, sampleRate); break;
+        }
+
+        accuracy.push_back({name, analytic[0], analytic[1], 0.0, tables[0], tables[1], 0.0});
+    }
+
+    /// A larger VoiceBank, with every Voice active, shows how the VoiceEngine scales with polyphony.
+
+    if (selected("VoiceBank<SAW, 32>::process (32 of 32 Voices active)"))
+    {
+        auto bank = std::make_unique<VoiceBank<WaveTables<SAW>, 32>>();
+        bank->setSampleRate(sampleRate);
+
+        results.push_back(measure("VoiceBank<SAW, 32>::process (32 of 32 Voices active)", [&] {
+            chunked([&] (const int n) {
+                for (int v = 0; v < 32; ++v)
+                    bank->load(55.F * static_cast<float>(v + 1));
+                bank->process(buffer.data(), n);
+            });
+            sink = buffer[0];
+        }, samples, repeats));
+    }
+
+    if (selected("HuovilainenFilter::process"))
+    {
+        AHREnvelope envelope;
+        envelope.setSampleRate(sampleRate);
+
+        HuovilainenFilter filter(&envelope);
+        filter.setSampleRate(sampleRate);
+        filter.set(static_cast<uint64_t>(kFrequencyType), 0.7F);
+        filter.set(static_cast<uint64_t>(kResonanceType), 0.5F);
+
+        WhiteNoise noise;
+
+        results.push_back(measure("HuovilainenFilter::process", [&] {
+            float sum = 0.F;
+            chunked([&] (const int n) {
+                envelope.prepare();
+                for (int k = 0; k < n; ++k)
+                    sum += filter.process(noise.nextSample());
+            });
+            sink = sum;
+        }, samples, repeats));
+    }
+
+    /// The HuovilainenLadder is measured per sample of `SIMD::width` filters, with each nonlinearity.
+
+    for (const bool exact : {true, false})
+    {
+        const std::string name = "HuovilainenLadder::process (" + std::to_string(Assemble::SIMD::width) +
+                                 " lanes, " + (exact ? "exact" : "vectorised") + " tanh)";
+
+        if (!selected(name)) continue;
+
+        float G, A, resonanceFour;
+        HuovilainenFilter::coefficients(2000.F, 0.5F, sampleRate, G, A, resonanceFour);
+
+        const auto gain     = Assemble::SIMD::broadcast(G);
+        const auto feedback = Assemble::SIMD::broadcast(resonanceFour);
+
+        HuovilainenLadder ladder;
+        WhiteNoise noise;
+
+        results.push_back(measure(name, [&] {
+            float sum = 0.F;
+            for (uint64_t k = 0; k < samples; ++k)
+            {
+                const auto input = Assemble::SIMD::broadcast(noise.nextSample());
+                const auto output = exact ? ladder.process<true> (input, gain, feedback)
+                                          : ladder.process<false>(input, gain, feedback);
+                sum += Assemble::SIMD::lane(output, 0);
+            }
+            sink = sum;
+        }, samples, repeats));
+    }
+
+    /// The exact ladder must reproduce HuovilainenFilter, and the vectorised ladder must be within `tolerance`
+    /// of it, both at the level of the Voices and when the filters saturate.
+
+    for (const auto& [drive, level] : {std::pair<float, const char*>{1.F, "nominal"}, {1.5E5F, "saturated"}})
+    {
+        const std::string name = std::string("HuovilainenLadder accuracy (") + level + " input)";
+        if (!selected(name)) continue;
+
+        constexpr double tolerance = -100.0;
+        const Accuracy result = compareLadder(name, drive, sampleRate);
+
+        if (result.referenceMaxError > decibels(0.0))
+        {
+            std::cerr << "[asbench] The exact HuovilainenLadder differs from HuovilainenFilter with " << level << " input\n";
+            return 1;
+        }
+
+        if (result.maxError > tolerance)
+        {
+            std::cerr << "[asbench] The vectorised HuovilainenLadder exceeds its tolerance with " << level << " input\n";
+            return 1;
+        }
+
+        accuracy.push_back(result);
+    }
+
+    if (selected("AHREnvelope::nextSample"))
+    {
+        AHREnvelope envelope;
+        envelope.setSampleRate(sampleRate);
+
+        results.push_back(measure("AHREnvelope::nextSample", [&] {
+            float sum = 0.F;
+            chunked([&] (const int n) {
+                envelope.prepare();
+                for (int k = 0; k < n; ++k)
+                    sum += envelope.nextSample();
+            });
+            sink = sum;
+        }, samples, repeats));
+    }
+
+    if (selected("AHREnvelope::process"))
+    {
+        AHREnvelope envelope;
+        envelope.setSampleRate(sampleRate);
+
+        std::vector<float> buffer(BLOCK_SIZE);
+        results.push_back(measure("AHREnvelope::process", [&] {
+            float sum = 0.F;
+            chunked([&] (const int n) {
+                envelope.prepare();
+                envelope.process(buffer.data(), n);
+                sum += buffer[n - 1];
+            });
+            sink = sum;
+        }, samples, repeats));
+    }
+
+    if (selected("StereoDelay::process"))
+    {
+        /// Both channels of the StereoDelay, which share one MultiTapDelay, are measured per oversampled frame.
+
+        Clock clock = {120};
+        clock.setSampleRate(sampleRate);
+
+        StereoDelay delay(&clock);
+        configure(delay, kStereoDelayToggle, 1.F);
+        configure(delay, kDelayFeedback, 0.5F);
+        configure(delay, kDelayModulation, 0.5F);
+        delay.adopt();
+
+        const uint64_t oversampled = samples * OVERSAMPLING;
+
+        results.push_back(measure("StereoDelay::process", [&] {
+            float sum = 0.F;
+            for (uint64_t k = 0; k < oversampled; ++k)
+            {
+                float lsample = static_cast<float>(k & 63) / 64.F;
+                float rsample = lsample;
+                delay.process(lsample, rsample);
+                sum += lsample + rsample;
+            }
+            sink = sum;
+        }, oversampled, repeats));
+    }
+
+    if (selected("StereoDelay::process (base rate)"))
+    {
+        /// A StereoDelay that runs at the base rate, as with BASE_RATE_DELAY, which is measured per frame.
+
+        Clock clock = {120};
+        clock.setSampleRate(sampleRate);
+
+        StereoDelay delay(&clock, 1);
+        configure(delay, kStereoDelayToggle, 1.F);
+        configure(delay, kDelayFeedback, 0.5F);
+        configure(delay, kDelayModulation, 0.5F);
+        delay.adopt();
+
+        results.push_back(measure("StereoDelay::process (base rate)", [&] {
+            float sum = 0.F;
+            for (uint64_t k = 0; k < samples; ++k)
+            {
+                float lsample = static_cast<float>(k & 63) / 64.F;
+                float rsample = lsample;
+                delay.process(lsample, rsample);
+                sum += lsample + rsample;
+            }
+            sink = sum;
+        }, samples, repeats));
+    }
+
+    if (selected("StereoDelay::process (oversampled, with the Oversamplers)"))
+    {
+        /// The oversampled path of the StereoDelay, as rendered by `ASCommanderCore` without BASE_RATE_DELAY,
+        /// which is measured per frame at the base rate for comparison with the base-rate StereoDelay.
+
+        Clock clock = {120};
+        clock.setSampleRate(sampleRate);
+
+        StereoDelay delay(&clock);
+        configure(delay, kStereoDelayToggle, 1.F);
+        configure(delay, kDelayFeedback, 0.5F);
+        configure(delay, kDelayModulation, 0.5F);
+        delay.adopt();
+
+        std::array<Oversampler, 2> oversamplers;
+        for (auto& oversampler : oversamplers)
+            oversampler.configure(OVERSAMPLING, OVERSAMPLING_STEEPNESS, OVERSAMPLING_ATTENUATION, BLOCK_SIZE);
+
+        std::vector<float> left (BLOCK_SIZE * OVERSAMPLING);
+        std::vector<float> right(BLOCK_SIZE * OVERSAMPLING);
+        results.push_back(measure("StereoDelay::process (oversampled, with the Oversamplers)", [&] {
+            float sum = 0.F;
+            chunked([&] (const int n) {
+                for (int k = 0; k < n; ++k)
+                    left[k] = static_cast<float>(k & 63) / 64.F;
+
+                const int m = oversamplers[0].upsample(left.data(), n);
+                std::copy(left.begin(), left.begin() + m, right.begin());
+                delay.process(left.data(), right.data(), m);
+
+                oversamplers[0].downsample(left.data(), m);
+                oversamplers[1].downsample(right.data(), m);
+                sum += left[0] + right[0];
+            });
+            sink = sum;
+        }, samples, repeats));
+    }
+
+    /// The StereoDelay's block process at the oversampled rate across delay lengths and modulation depths, measured
+    /// per oversampled frame. Each StereoDelay first glides to its delay time and depth, which takes 2 seconds.
+
+    const std::array<std::pair<int, const char*>, 3> lengths = {{ {5, "5 ms"}, {100, "100 ms"}, {1000, "1000 ms"} }};
+    const std::array<std::pair<float, const char*>, 3> depths = {{ {0.F, "depth 0"}, {0.5F, "depth 0.5"}, {1.F, "depth 1"} }};
+
+    for (const auto& [length, lengthName] : lengths)
+    {
+        for (const auto& [depth, depthName] : depths)
+        {
+            const std::string name = std::string("StereoDelay::process (block, ") + lengthName + ", " + depthName + ")";
+            if (!selected(name)) continue;
+
+            Clock clock = {120};
+            clock.setSampleRate(sampleRate);
+
+            StereoDelay delay(&clock);
+            configure(delay, kStereoDelayToggle, 1.F);
+            configure(delay, kDelayFeedback, 0.5F);
+            configure(delay, kDelayModulation, depth);
+            configure(delay, kDelayTimeInMs, static_cast<float>(length));
+            delay.adopt();
+
+            const uint64_t oversampled = samples * OVERSAMPLING;
+            std::vector<float> left (BLOCK_SIZE * OVERSAMPLING);
+            std::vector<float> right(BLOCK_SIZE * OVERSAMPLING);
+            const auto run = [&] {
+                float sum = 0.F;
+                chunked([&] (const int n) {
+                    const int m = n * OVERSAMPLING;
+                    for (int k = 0; k < m; ++k)
+                        left[k] = right[k] = static_cast<float>(k & 63) / 64.F;
+
+                    delay.process(left.data(), right.data(), m);
+                    sum += left[0] + right[0];
+                });
+                sink = sum;
+            };
+
+            const uint64_t settle = static_cast<uint64_t>(2.0 * sampleRate / static_cast<double>(samples)) + 1;
+            for (uint64_t k = 0; k < settle; ++k) run();
+
+            results.push_back(measure(name, run, oversampled, repeats));
+        }
+    }
+
+    if (selected("StereoDelay at the base rate (vs oversampled)"))
+        accuracy.push_back(compareDelay("StereoDelay at the base rate (vs oversampled)", options.sampleRate));
+
+    if (selected("Vibrato::process"))
+    {
+        Vibrato vibrato;
+        vibrato.setSampleRate(sampleRate);
+        vibrato.set(kVibratoToggle, 1.F);
+        vibrato.set(kVibratoDepth, 0.5F);
+        vibrato.set(kVibratoSpeed, 5.F);
+
+        results.push_back(measure("Vibrato::process", [&] {
+            chunked([&] (const int n) {
+                for (int k = 0; k < n; ++k)
+                    buffer[k] = static_cast<float>(k & 63) / 64.F;
+                vibrato.process(buffer.data(), n);
+            });
+            sink = buffer[0];
+        }, samples, repeats));
+    }
+
+    for (const auto& [depth, depthName] : depths)
+    {
+        const std::string name = std::string("Vibrato::process (") + depthName + ")";
+        if (!selected(name)) continue;
+
+        Vibrato vibrato;
+        vibrato.setSampleRate(sampleRate);
+        vibrato.set(kVibratoToggle, 1.F);
+        vibrato.set(kVibratoDepth, depth);
+        vibrato.set(kVibratoSpeed, 5.F);
+
+        results.push_back(measure(name, [&] {
+            chunked([&] (const int n) {
+                for (int k = 0; k < n; ++k)
+                    buffer[k] = static_cast<float>(k & 63) / 64.F;
+                vibrato.process(buffer.data(), n);
+            });
+            sink = buffer[0];
+        }, samples, repeats));
+    }
+
+    if (selected("ValueTransition::get"))
+    {
+        ValueTransition transition;
+        transition.setSampleRate(sampleRate);
+
+        results.push_back(measure("ValueTransition::get", [&] {
+            float sum = 0.F;
+            chunked([&] (const int n) {
+                transition.set(0.F, 1.F, 0.05F);
+                for (int k = 0; k < n; ++k)
+                    sum += transition.get();
+            });
+            sink = sum;
+        }, samples, repeats));
+    }
+
+    if (selected("CDSPResampler24"))
+    {
+        /// One upsampler and one downsampler, as used for each channel by `ASCommanderCore::render`.
+        /// This is measured per sample at the base rate.
+
+        const double rate = options.sampleRate;
+        const int capacity = BLOCK_SIZE * OVERSAMPLING;
+        r8b::CDSPResampler24 upsampler(rate, rate * OVERSAMPLING, capacity);
+        r8b::CDSPResampler24 dnsampler(rate * OVERSAMPLING, rate, capacity);
+
+        std::vector<double> input(BLOCK_SIZE);
+        for (size_t k = 0; k < input.size(); ++k)
+            input[k] = std::sin(0.05 * static_cast<double>(k));
+
+        results.push_back(measure("CDSPResampler24::process (up and down)", [&] {
+            double sum = 0.0;
+            chunked([&] (const int n) {
+                double *oversample, *downsample;
+                const int m = upsampler.process(input.data(), n, oversample);
+                const int d = dnsampler.process(oversample, m, downsample);
+                if (d > 0) sum += downsample[0];
+            });
+            sink = static_cast<float>(sum);
+        }, samples, repeats));
+    }
+
+    /// The halfband Oversampler, which replaced the pair of CDSPResampler24 objects, is measured at each
+    /// power-of-two factor up to 16, and at `OVERSAMPLING` with each of the first three steepness indices.
+    /// Each configuration is also measured with the double-precision reference cascade, and the outputs of
+    /// the two are compared.
+
+    const std::pair<int, int> configurations[] = {{2, 0}, {4, 0}, {8, 0}, {16, 0}, {OVERSAMPLING, 1}, {OVERSAMPLING, 2}};
+
+    for (const auto& [factor, steepness] : configurations)
+    {
+        const std::string name = "Oversampler::upsample and downsample (" +
+                                 std::to_string(factor) + "x, steepness " + std::to_string(steepness) + ")";
+
+        if (selected(name))
+        {
+            Oversampler oversampler;
+            oversampler.configure(factor, steepness, OVERSAMPLING_ATTENUATION, BLOCK_SIZE);
+
+            std::vector<float> input(BLOCK_SIZE);
+            std::vector<float> oversample(BLOCK_SIZE * factor);
+            for (size_t k = 0; k < input.size(); ++k)
+                input[k] = std::sin(0.05F * static_cast<float>(k));
+
+            results.push_back(measure(name, [&] {
+                float sum = 0.F;
+                chunked([&] (const int n) {
+                    std::copy(input.begin(), input.begin() + n, oversample.begin());
+                    const int m = oversampler.upsample(oversample.data(), n);
+                    oversampler.downsample(oversample.data(), m);
+                    sum += oversample[0];
+                });
+                sink = sum;
+            }, samples, repeats));
+        }
+
+        const std::string reference = "HalfbandCascade::upsample and downsample (" +
+                                      std::to_string(factor) + "x, steepness " + std::to_string(steepness) + ", double)";
+
+        if (selected(reference))
+        {
+            HalfbandCascade cascade(factor, steepness, OVERSAMPLING_ATTENUATION, BLOCK_SIZE);
+
+            std::vector<double> input(BLOCK_SIZE);
+            for (size_t k = 0; k < input.size(); ++k)
+                input[k] = std::sin(0.05 * static_cast<double>(k));
+
+            results.push_back(measure(reference, [&] {
+                double sum = 0.0;
+                chunked([&] (const int n) {
+                    double* output;
+                    const int m = cascade.upsample(input.data(), n, output);
+                    const int d = cascade.downsample(output, m, output);
+                    if (d > 0) sum += output[0];
+                });
+                sink = static_cast<float>(sum);
+            }, samples, repeats));
+        }
+
+        const std::string comparison = "Oversampler accuracy (" +
+                                       std::to_string(factor) + "x, steepness " + std::to_string(steepness) + ")";
+
+        if (selected(comparison))
+            accuracy.push_back(compare(comparison, factor, steepness, options.sampleRate));
+    }
+
+#ifndef BASE_RATE_DELAY
+    /// The direct path of the core must be aligned with its oversampled path to within the resolution of `error`,
+    /// so that crossfading between them does not comb filter, and the residual between them must be within `tolerance`.
+
+    if (selected("Direct path alignment (vs oversampled)"))
+    {
+        constexpr double tolerance = -100.0;
+        const Accuracy result = compareDirect("Direct path alignment (vs oversampled)", OVERSAMPLING, OVERSAMPLING_STEEPNESS, options.sampleRate);
+
+        if (result.latency != result.referenceLatency)
+        {
+            std::cerr << "[asbench] The direct path is not aligned with the oversampled path\n";
+            return 1;
+        }
+
+        if (result.maxError > tolerance)
+        {
+            std::cerr << "[asbench] The residual between the direct and oversampled paths exceeds its tolerance\n";
+            return 1;
+        }
+
+        accuracy.push_back(result);
+    }
+#endif
+
+    /// The full render is measured at each block size from 64 to 4096, then once more with the StereoDelay
+    /// bypassed, after its tail has decayed and the core has switched to the direct path.
+
+    std::vector<std::pair<unsigned int, bool>> renders;
+    for (unsigned int blockSize = 64; blockSize <= 4096; blockSize *= 2)
+        renders.push_back({blockSize, false});
+    renders.push_back({512, true});
+
+    for (const auto& [blockSize, bypassed] : renders)
+    {
+        const std::string name = "ASCommanderCore::render (" + std::to_string(blockSize) + (bypassed ? ", direct path)" : ")");
+        if (!selected(name)) continue;
+
+        auto core = std::make_unique<ASCommanderCore>();
+        core->init(options.sampleRate);
+
+        if (options.song.empty()) loadDefaultPattern(*core);
+        else if (!Song::load(options.song, *core))
+        {
+            std::cerr << "[asbench] Could not read the song at " << options.song << "\n";
+            return 1;
+        }
+
+        std::vector<float> left (blockSize);
+        std::vector<float> right(blockSize);
+        float* output[2] = { left.data(), right.data() };
+
+        core->playOrPause();
+
+        if (bypassed)
+        {
+            core->set(kStereoDelayToggle, 0.F);
+            for (uint64_t t = 0; t < 60 * samples && core->isOversampling(); t += blockSize)
+                core->render(2, blockSize, output);
+        }
+
+        results.push_back(measure(name, [&] {
+            for (uint64_t t = 0; t < samples; t += blockSize)
+            {
+                const auto block = static_cast<unsigned int>(std::min<uint64_t>(blockSize, samples - t));
+                core->render(2, block, output);
+            }
+            sink = left[0];
+        }, samples, repeats));
+    }
+
+    std::fflush(stdout);
+    dup2(json, STDOUT_FILENO);
+    close(json);
+
+    if (options.output.empty())
+        write(std::cout, options, results, accuracy);
+
+    else
+    {
+        std::ofstream file(options.output);
+        if (!file.is_open())
+        {
+            std::cerr << "[asbench] Could not open " << options.output << " for writing\n";
+            return 1;
+        }
+
+        write(file, options, results, accuracy);
+    }
+
+    return 0;
+}
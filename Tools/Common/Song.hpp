@@ -0,0 +1,66 @@
+//  Assemble
+//  ============================
+//  Copyright © 2020 David Spry. All rights reserved.
+
+#ifndef SONG_HPP
+#define SONG_HPP
+
+#include <fstream>
+#include <sstream>
+
+#include "ASCommanderCore.hpp"
+
+/// \brief A song is a plain-text file that describes the state of the core. Lines beginning with '#'
+/// are ignored. Every other line is either a parameter, "<address> <value>", as in "0xCA01 120", or a
+/// pattern, "P<index> <codes>", where the codes are the character codes of the string produced by
+/// `encodePatternState`. This is the same representation as the one used by the factory presets.
+
+namespace Song
+{
+    /// \brief Load the song at the given path into the given core. The core's pending commands are
+    /// performed immediately, so this must not be called while the core is rendering.
+    /// \return `true` if the song was loaded; `false` if the file could not be read.
+
+    inline bool load(const std::string& path, ASCommanderCore& core)
+    {
+        std::ifstream file(path);
+        if (!file.is_open()) return false;
+
+        std::string line;
+        while (std::getline(file, line))
+        {
+            std::istringstream stream(line);
+            std::string key;
+
+            if (!(stream >> key) || key[0] == '#')
+                continue;
+
+            if (key[0] == 'P')
+            {
+                const int pattern = std::atoi(key.c_str() + 1);
+                if (pattern < 0 || pattern >= PATTERNS)
+                    continue;
+
+                std::string state;
+                int code;
+                while (stream >> code)
+                    state += static_cast<char>(code);
+
+                core.loadFromEncodedPatternState(state.c_str(), pattern);
+            }
+
+            else
+            {
+                float value;
+                const uint64_t parameter = std::strtoull(key.c_str(), nullptr, 0);
+                if (stream >> value)
+                    core.set(parameter, value);
+            }
+        }
+
+        core.flush();
+        return true;
+    }
+}
+
+#endif
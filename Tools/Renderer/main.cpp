@@ -0,0 +1,246 @@
+//  Assemble
+//  ============================
+//  Copyright © 2020 David Spry. All rights reserved.
+
+#include <chrono>
+#include <fstream>
+#include <iostream>
+
+#include "ASCommanderCore.hpp"
+#include "Song.hpp"
+
+/// \brief A headless renderer for the Assemble core.
+///
+/// The renderer loads a song, starts the Clock, and pulls blocks of samples from
+/// `ASCommanderCore::render` as quickly as possible, streaming them to a WAV file.
+/// When rendering is complete, the real-time factor achieved by the core is reported.
+/// Songs are loaded by `Song::load`.
+
+namespace Renderer
+{
+    struct Options
+    {
+        std::string song;
+        std::string output;
+        double sampleRate = 48000.0;
+        double seconds    = 30.0;
+        unsigned int channels  = 2;
+        unsigned int blockSize = 512;
+        bool  floatingPoint = true;
+        bool  parallel = false;
+        bool  exactFilter = false;
+        bool  crossfade = false;
+        bool  seeded = false;
+        unsigned long long seed = 0;
+        std::string wavetables;
+    };
+
+    /// \brief Print the usage string to the given stream.
+
+    static void usage(std::ostream& stream)
+    {
+        stream << "Usage: asrender [options] <song> <output.wav>\n"
+               << "  -r, --rate <Hz>        The sample rate to render at (default 48000)\n"
+               << "  -s, --seconds <s>      The duration of the render in seconds (default 30)\n"
+               << "  -b, --block <frames>   The number of frames per call to render (default 512)\n"
+               << "  -c, --channels <n>     The number of output channels, 1 or 2 (default 2)\n"
+               << "      --pcm16            Write 16-bit integer samples instead of 32-bit floats\n"
+               << "      --parallel         Render the synthesiser's voice banks on worker threads\n"
+               << "      --exact-filter     Compute the voices' filters with the exact scalar tanh\n"
+               << "      --crossfade        Crossfade the voices' wavetables between adjacent levels\n"
+               << "      --seed <n>         Seed the core's random generators, so that the render is reproducible\n"
+               << "      --wavetables <path> Cache the synthesised wavetables in the given file\n";
+    }
+
+    /// \brief Parse the command-line arguments into `options`.
+    /// \return `true` if the arguments are valid; `false` otherwise.
+
+    static bool parse(int argc, const char* argv[], Options& options)
+    {
+        std::vector<std::string> positional;
+
+        for (int k = 1; k < argc; ++k)
+        {
+            const std::string argument = argv[k];
+            const bool hasValue = k + 1 < argc;
+
+            if      ((argument == "-r" || argument == "--rate")     && hasValue) options.sampleRate = std::atof(argv[++k]);
+            else if ((argument == "-s" || argument == "--seconds")  && hasValue) options.seconds    = std::atof(argv[++k]);
+            else if ((argument == "-b" || argument == "--block")    && hasValue) options.blockSize  = std::atoi(argv[++k]);
+            else if ((argument == "-c" || argument == "--channels") && hasValue) options.channels   = std::atoi(argv[++k]);
+            else if  (argument == "--pcm16") options.floatingPoint = false;
+            else if  (argument == "--parallel") options.parallel = true;
+            else if  (argument == "--exact-filter") options.exactFilter = true;
+            else if  (argument == "--crossfade") options.crossfade = true;
+            else if  (argument == "--wavetables" && hasValue) options.wavetables = argv[++k];
+            else if  (argument == "--seed" && hasValue)
+            {
+                options.seeded = true;
+                options.seed = std::strtoull(argv[++k], nullptr, 10);
+            }
+            else if  (argument.size() > 1 && argument[0] == '-') return false;
+            else     positional.push_back(argument);
+        }
+
+        if (positional.size() != 2) return false;
+
+        options.song   = positional[0];
+        options.output = positional[1];
+
+        return options.sampleRate > 0.0
+            && options.seconds    > 0.0
+            && options.blockSize  > 0
+            && (options.channels == 1 || options.channels == 2);
+    }
+
+    /// \brief A WAV file writer that streams interleaved frames to disk.
+    /// The RIFF and data chunk sizes are written when the file is closed.
+
+    class WaveFile
+    {
+    public:
+        WaveFile(const std::string& path, unsigned int channels, unsigned int sampleRate, bool floatingPoint) :
+        channels(channels),
+        floatingPoint(floatingPoint),
+        file(std::fopen(path.c_str(), "wb"))
+        {
+            if (file == nullptr) return;
+
+            const uint16_t format = floatingPoint ? 3 : 1;
+            const uint16_t bits   = floatingPoint ? 32 : 16;
+            const uint16_t align  = channels * bits / 8;
+            const uint32_t rate   = align * sampleRate;
+
+            std::fwrite("RIFF\0\0\0\0WAVEfmt ", 1, 16, file);
+            field<uint32_t>(16);
+            field<uint16_t>(format);
+            field<uint16_t>(channels);
+            field<uint32_t>(sampleRate);
+            field<uint32_t>(rate);
+            field<uint16_t>(align);
+            field<uint16_t>(bits);
+            std::fwrite("data\0\0\0\0", 1, 8, file);
+        }
+
+        ~WaveFile()
+        {
+            if (file == nullptr) return;
+
+            const uint32_t size = static_cast<uint32_t>(bytes);
+            std::fseek(file, 4, SEEK_SET);
+            field<uint32_t>(size + 36);
+            std::fseek(file, 40, SEEK_SET);
+            field<uint32_t>(size);
+            std::fclose(file);
+        }
+
+        inline const bool isOpen() const { return file != nullptr; }
+
+        /// \brief Interleave and write the given number of frames from the given channel buffers.
+
+        void write(float* const buffers[], unsigned int frames)
+        {
+            for (unsigned int k = 0; k < frames; ++k)
+            for (unsigned int c = 0; c < channels; ++c)
+            {
+                const float sample = buffers[c][k];
+                if (floatingPoint) write<float>(sample);
+                else write<int16_t>(static_cast<int16_t>(32767.F * Assemble::Utilities::bound(sample, -1.F, 1.F)));
+            }
+        }
+
+    private:
+        /// \brief Write a sample, which is counted in the size of the data chunk.
+
+        template <typename T>
+        inline void write(const T value)
+        {
+            bytes += std::fwrite(&value, 1, sizeof(T), file);
+        }
+
+        /// \brief Write a field of the header, which is not counted in the size of the data chunk.
+
+        template <typename T>
+        inline void field(const T value)
+        {
+            std::fwrite(&value, 1, sizeof(T), file);
+        }
+
+    private:
+        unsigned int channels;
+        bool   floatingPoint;
+        size_t bytes = 0;
+        std::FILE* file;
+    };
+}
+
+int main(int argc, const char* argv[])
+{
+    using namespace Renderer;
+    using Time = std::chrono::steady_clock;
+
+    Options options;
+    if (!parse(argc, argv, options))
+    {
+        usage(std::cerr);
+        return 1;
+    }
+
+    WaveTableBuilder::setCachePath(options.wavetables);
+
+    ASCommanderCore core;
+    core.init(options.sampleRate);
+    core.setParallelRendering(options.parallel);
+    core.setVectorisedFilter(!options.exactFilter);
+    core.setCrossfade(options.crossfade);
+
+    if (options.seeded)
+        core.seed(options.seed);
+
+    if (!Song::load(options.song, core))
+    {
+        std::cerr << "[asrender] Could not read the song at " << options.song << "\n";
+        return 1;
+    }
+
+    WaveFile wave(options.output, options.channels, static_cast<unsigned int>(options.sampleRate), options.floatingPoint);
+    if (!wave.isOpen())
+    {
+        std::cerr << "[asrender] Could not open " << options.output << " for writing\n";
+        return 1;
+    }
+
+    std::vector<float> left (options.blockSize);
+    std::vector<float> right(options.blockSize);
+    float* output[2] = { left.data(), right.data() };
+
+    const auto frames = static_cast<uint64_t>(options.seconds * options.sampleRate);
+    uint64_t rendered = 0;
+    Time::duration elapsed {0};
+
+    core.playOrPause();
+
+    while (rendered < frames)
+    {
+        const auto block = static_cast<unsigned int>(std::min<uint64_t>(options.blockSize, frames - rendered));
+
+        std::fill(left.begin(),  left.end(),  0.F);
+        std::fill(right.begin(), right.end(), 0.F);
+
+        const auto start = Time::now();
+        core.render(options.channels, block, output);
+        elapsed += Time::now() - start;
+
+        wave.write(output, block);
+        rendered += block;
+    }
+
+    const double renderTime = std::chrono::duration<double>(elapsed).count();
+    const double audioTime  = static_cast<double>(frames) / options.sampleRate;
+
+    std::printf("[asrender] Rendered %.2f s of audio in %.3f s (%.1fx real time)\n",
+                audioTime, renderTime, audioTime / std::max(renderTime, 1E-9));
+    std::printf("[asrender] The StereoDelay's buffers occupy %.2f MB\n", static_cast<double>(core.delayMemory()) / 1048576.0);
+
+    return 0;
+}